@@ -86,6 +86,41 @@ void compute_perplexity(ng_t *ng,
 			flag include_unks,
 			double log_base);
 
+/** A language model for batch_perplexity(), either binary or ARPA */
+typedef struct {
+  char *filename;
+  flag arpa_lm;
+  ng_t *ng;
+  arpa_lm_t *arpa_ng;
+} batch_lm_t;
+
+/** The counts behind one entry of batch_perplexity()'s table */
+typedef struct {
+  int total_words;
+  int excluded_unks;
+  int excluded_ccs;
+  double sum_log_prob;
+  char *unknown_word;  /**< An OOV of a closed vocabulary model, or NULL */
+} batch_result_t;
+
+/**
+   Compute the perplexity of each language model on each text, and
+   write them as a table.  The texts are read once for all the models,
+   which are evaluated in up to n_threads threads.
+*/
+void batch_perplexity(batch_lm_t *lms,
+		      int n_lms,
+		      char **text_filenames,
+		      int n_texts,
+		      char *fb_list_filename,
+		      flag backoff_from_unk_inc,
+		      flag backoff_from_unk_exc,
+		      flag backoff_from_ccs_inc,
+		      flag backoff_from_ccs_exc,
+		      flag include_unks,
+		      int n_threads,
+		      FILE *fp);
+
 fb_info *gen_fb_list(sih_t *vocab_ht,
 		     vocab_sz_t vocab_size,
 		     char **vocab,
@@ -70,6 +70,30 @@ void calc_mem_req(ng_t *ng, /**< The n-gram */
 		  );
 void write_arpa_lm(ng_t *ng,int verbosity);
 void write_bin_lm(ng_t *ng,int verbosity);
+void write_trie_lm(ng_t *ng,int verbosity);
+
+/* The longest n-grams that sphinxbase can read from a trie LM. */
+#define TRIE_MAX_ORDER 5
+
+/**
+   Parse quantization bits for a trie LM, as probability/back-off bits
+   for each order from bigrams, e.g. "8/8,8".  Orders not given use
+   the last ones which were, and an empty spec means 16 bits.
+   @return -1 if the spec is invalid.
+ */
+int parse_trie_quant(char const *spec, int n,
+		     unsigned char *prob_bits, unsigned char *bo_bits);
+
+/**
+   Called by visit_arpa_ngrams for each (i+1)-gram, whose words are
+   current_pos[0] and ng->word_id[j][current_pos[j]] for j = 1 ... i.
+ */
+typedef void (*arpa_ngram_fn)(ng_t *ng, int i, int *current_pos,
+			      double log10_prob, double log10_alpha,
+			      void *data);
+
+void arpa_unigram(ng_t *ng, int i, double *log10_uniprob, double *log10_alpha);
+void visit_arpa_ngrams(ng_t *ng, int i, arpa_ngram_fn fn, void *data);
 
 index__t new_index(ngram_sz_t full_index,
 		   ptr_tab_t *ind_table,
@@ -452,7 +452,7 @@ void load_arpa_lm(arpa_lm_t *arpa_lm,
 
   /* Process 1-grams */
 
-  printf("Reading unigrams...\n");
+  fprintf(stderr,"Reading unigrams...\n");
   
   i=0;
 
@@ -496,7 +496,7 @@ void load_arpa_lm(arpa_lm_t *arpa_lm,
 
     for (i=2;i<=arpa_lm->n-1;i++) {
 
-      printf("\nReading %d-grams...\n",i);
+      fprintf(stderr,"\nReading %d-grams...\n",i);
 
       previd = -1;
 
@@ -652,7 +652,7 @@ void load_arpa_lm(arpa_lm_t *arpa_lm,
       }					   					   
     }
 
-    printf("\nReading %d-grams...\n",arpa_lm->n);
+    fprintf(stderr,"\nReading %d-grams...\n",arpa_lm->n);
     
     first_one = 1;
     j = 0;
@@ -863,7 +863,7 @@ void robust_load_arpa_lm(arpa_lm_t *arpa_lm,
   
   /* Process 1-grams */
 	
-  printf("Reading unigrams...\n");
+  fprintf(stderr,"Reading unigrams...\n");
 	
   i=0;
 	
@@ -918,7 +918,7 @@ void robust_load_arpa_lm(arpa_lm_t *arpa_lm,
   
   for (i=2;i<=arpa_lm->n-1;i++) {
 		
-    printf("\nReading %d-grams...\n",i);
+    fprintf(stderr,"\nReading %d-grams...\n",i);
     
     previd = -1;
     
@@ -1046,7 +1046,7 @@ void robust_load_arpa_lm(arpa_lm_t *arpa_lm,
 	
   }
   
-  printf("\nReading %d-grams...\n",arpa_lm->n);
+  fprintf(stderr,"\nReading %d-grams...\n",arpa_lm->n);
   
   j = 0;
   previd = 0;
@@ -55,8 +55,11 @@
  *
  */
 
+#include <stdlib.h>
+#include <limits.h>
 #include "idngram2lm.h"
 #include "ngram.h"
+#include "pc_general.h"
 
 void ngram_copy(ngram *tgt, ngram *src,int N)
 {
@@ -155,6 +158,55 @@ void ng_allocate_ptr_table(ng_t * ng, arpa_lm_t *arpa_ng, flag is_arpa )
 
 }
 
+static void *ng_realloc(void *ptr, size_t n_bytes)
+{
+  ptr = realloc(ptr,n_bytes);
+  if (ptr == NULL && n_bytes > 0)
+    quit(-1,"Error : could not reallocate %lu bytes for the n-gram tables.\n",
+	 (unsigned long) n_bytes);
+  return ptr;
+}
+
+void ng_resize_table(ng_t *ng, int N, table_size_t size)
+{
+  assert(N >= 1 && N <= ng->n-1);
+
+  ng->word_id[N] = (id__t *) ng_realloc(ng->word_id[N],sizeof(id__t)*size);
+
+  if (ng->four_byte_counts) 
+    ng->count4[N] = (count_t *) ng_realloc(ng->count4[N],sizeof(count_t)*size);
+  else 
+    ng->count[N] = (count_ind_t *) ng_realloc(ng->count[N],
+					      sizeof(count_ind_t)*size);
+
+  if (N < ng->n-1) {
+    if (ng->four_byte_alphas) 
+      ng->bo_weight4[N] = (four_byte_t *) ng_realloc(ng->bo_weight4[N],
+						     sizeof(four_byte_t)*size);
+    else 
+      ng->bo_weight[N] = (bo_weight_t *) ng_realloc(ng->bo_weight[N],
+						    sizeof(bo_weight_t)*size);
+
+    ng->ind[N] = (index__t *) ng_realloc(ng->ind[N],sizeof(index__t)*size);
+  }
+
+  ng->table_sizes[N] = size;
+}
+
+void ng_grow_table(ng_t *ng, int N, int verbosity)
+{
+  table_size_t size;
+
+  size = ng->table_sizes[N];
+  if (size > (INT_MAX - 1) / 3 * 2)
+    quit(-1,"\nMore than %d %d-grams needed to be stored.\n",size,N+1);
+  size += size/2 + 1;
+
+  pc_message(verbosity,3,"\nGrowing table for %d-grams to %d entries.\n",
+	     N+1,size);
+  ng_resize_table(ng,N,size);
+}
+
 void ng_allocate_vocab_ht(ng_t *ng, /**< ng_t  with binary format stuffs */
 			  arpa_lm_t *arpa_ng,  /**< arpa_lm_t */
 			  flag is_arpa
@@ -178,9 +230,9 @@ void ng_arpa_lm_alloc_struct (arpa_lm_t *arpa_lm  /**< arpa_lm_t */
 			      )
 {
   int i;
-  printf("Reading in a %d-gram language model.\n",arpa_lm->n);
+  fprintf(stderr,"Reading in a %d-gram language model.\n",arpa_lm->n);
   for (i=0;i<=arpa_lm->n-1;i++) {
-    printf("Number of %d-grams = %d.\n",i+1,arpa_lm->table_sizes[i]);
+    fprintf(stderr,"Number of %d-grams = %d.\n",i+1,arpa_lm->table_sizes[i]);
     arpa_lm->num_kgrams[i]=arpa_lm->table_sizes[i];
   }
 
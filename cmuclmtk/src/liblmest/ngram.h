@@ -219,6 +219,12 @@ typedef struct {
 				     written out in binary format */
   char           *bin_filename;   /**< The filaname of the bin format LM */
   FILE           *bin_fp;         /**< The file of the bin format LM */
+  flag           write_trie;      /**< True if the language model is to be 
+				     written out in sphinxbase trie format */
+  char           *trie_filename;  /**< The filename of the trie format LM */
+  FILE           *trie_fp;        /**< The file of the trie format LM */
+  char           *trie_quant;     /**< Quantization bits of the trie, e.g.
+				     "8/8,8", or empty for 16 bits */
 
 
   /* Misc */
@@ -359,6 +365,25 @@ void ng_allocate_ptr_table(ng_t * ng, /**< ng_t with binary format stuffs */
 			   flag is_arpa
 			   );
 
+/**
+   Resize the tables holding the N-grams of one order, keeping their
+   contents.  Back-off weights and indices are only resized for the
+   orders below the highest.
+ */
+void ng_resize_table(ng_t *ng, /**< ng_t with binary format stuffs */
+		     int N,    /**< The table, 1 for bigrams and so on */
+		     table_size_t size /**< The new number of entries */
+		     );
+
+/**
+   Grow the tables of one order by half again, for when more N-grams
+   turn up than they were sized for.
+ */
+void ng_grow_table(ng_t *ng, /**< ng_t with binary format stuffs */
+		   int N,    /**< The table, 1 for bigrams and so on */
+		   int verbosity
+		   );
+
 void ng_allocate_vocab_ht(ng_t *ng, /**< ng_t  with binary format stuffs */
 			  arpa_lm_t *arpa_ng,  /**< arpa_lm_t */
 			  flag is_arpa
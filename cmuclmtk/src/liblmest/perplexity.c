@@ -415,3 +415,255 @@ void compute_perplexity(ng_t *ng,
   free (context);
   free (ngrams_hit);
 }
+
+/* The texts for batch_perplexity(), as indices into a table of the
+   word types found in any of them */
+typedef struct {
+  char **types;
+  vocab_sz_t n_types;
+  int **tokens;
+  int *n_tokens;
+  int max_tokens;
+} batch_texts_t;
+
+/* Language models first, first+step, ... for batch_lm_job() */
+typedef struct {
+  batch_lm_t *lms;
+  int n_lms;
+  int first;
+  int step;
+  batch_texts_t *texts;
+  int n_texts;
+  char *fb_list_filename;
+  flag backoff_from_unk_inc;
+  flag backoff_from_unk_exc;
+  flag backoff_from_ccs_inc;
+  flag backoff_from_ccs_exc;
+  flag include_unks;
+  batch_result_t *results;
+} batch_job_t;
+
+static void *text_realloc(void *ptr, size_t n_bytes)
+{
+  ptr = realloc(ptr,n_bytes);
+  if (ptr == NULL)
+    quit(-1,"Error : could not reallocate %lu bytes for the texts.\n",
+	 (unsigned long) n_bytes);
+  return ptr;
+}
+
+/* Read the texts, splitting them into words as compute_perplexity()
+   does.  Each word type is stored once however many times it occurs,
+   so each language model only has to look it up once. */
+static void read_batch_texts(batch_texts_t *texts, char **text_filenames, 
+			     int n_texts) {
+  sih_t *type_ht;
+  FILE *fp;
+  char current_word[1000];
+  vocab_sz_t type;
+  int i, size;
+
+  type_ht = sih_create(1000,0.5,2.0,0);
+  size = 1000;
+  texts->types = (char **) rr_malloc(size*sizeof(char *));
+  texts->n_types = 0;
+  texts->tokens = (int **) rr_malloc(n_texts*sizeof(int *));
+  texts->n_tokens = (int *) rr_calloc(n_texts,sizeof(int));
+  texts->max_tokens = 0;
+
+  for (i=0;i<n_texts;i++) {
+    int max_tokens = 10000;
+    texts->tokens[i] = (int *) rr_malloc(max_tokens*sizeof(int));
+    fp = rr_iopen(text_filenames[i]);
+    while (fscanf(fp,"%999s",current_word) == 1) {
+      if (!sih_lookup(type_ht,current_word,&type)) {
+	if (texts->n_types == size) {
+	  size *= 2;
+	  texts->types = (char **) text_realloc(texts->types,size*sizeof(char *));
+	}
+	type = texts->n_types++;
+	texts->types[type] = salloc(current_word);
+	sih_add(type_ht,texts->types[type],type);
+      }
+      if (texts->n_tokens[i] == max_tokens) {
+	max_tokens *= 2;
+	texts->tokens[i] = (int *) text_realloc(texts->tokens[i],
+					      max_tokens*sizeof(int));
+      }
+      texts->tokens[i][texts->n_tokens[i]++] = (int) type;
+    }
+    rr_iclose(fp);
+    texts->max_tokens = MAX(texts->max_tokens,texts->n_tokens[i]);
+  }
+
+  free(type_ht->slots);
+  free(type_ht);
+}
+
+/* Evaluate some of the language models on every text.  This follows
+   compute_perplexity() word for word, but the context is just the
+   last few ids of the text. */
+static void *batch_lm_job(void *arg) {
+  batch_job_t *job = (batch_job_t *) arg;
+  batch_texts_t *texts = job->texts;
+  batch_result_t *result;
+  batch_lm_t *lm;
+  fb_info *fb_list;
+  sih_t *vocab_ht;
+  flag *context_cue;
+  id__t *type_ids, *ids;
+  vocab_sz_t current_id;
+  double prob;
+  int bo_case, actual_context_length, context_length;
+  int i, j, t, n;
+
+  type_ids = (id__t *) rr_malloc(MAX(texts->n_types,1)*sizeof(id__t));
+  ids = (id__t *) rr_malloc(MAX(texts->max_tokens,1)*sizeof(id__t));
+
+  for (i=job->first;i<job->n_lms;i+=job->step) {
+    lm = &job->lms[i];
+    if (lm->arpa_lm) {
+      n = lm->arpa_ng->n;
+      vocab_ht = lm->arpa_ng->vocab_ht;
+      context_cue = lm->arpa_ng->context_cue;
+      fb_list = gen_fb_list(vocab_ht,
+			    (int) lm->arpa_ng->vocab_size,
+			    lm->arpa_ng->vocab,
+			    context_cue,
+			    job->backoff_from_unk_inc,
+			    job->backoff_from_unk_exc,
+			    job->backoff_from_ccs_inc,
+			    job->backoff_from_ccs_exc,
+			    job->fb_list_filename);
+    }else {
+      n = lm->ng->n;
+      vocab_ht = lm->ng->vocab_ht;
+      context_cue = lm->ng->context_cue;
+      fb_list = gen_fb_list(vocab_ht,
+			    (int) lm->ng->vocab_size,
+			    lm->ng->vocab,
+			    context_cue,
+			    job->backoff_from_unk_inc,
+			    job->backoff_from_unk_exc,
+			    job->backoff_from_ccs_inc,
+			    job->backoff_from_ccs_exc,
+			    job->fb_list_filename);
+    }
+
+    for (t=0;t<texts->n_types;t++) {
+      sih_lookup(vocab_ht,texts->types[t],&current_id);
+      type_ids[t] = current_id;
+    }
+
+    for (j=0;j<job->n_texts;j++) {
+      result = &job->results[i*job->n_texts+j];
+      memset(result,0,sizeof(batch_result_t));
+
+      for (t=0;t<texts->n_tokens[j];t++) {
+	ids[t] = type_ids[texts->tokens[j][t]];
+	context_length = MIN(t,n-1);
+
+	if (ids[t] == 0 && 
+	    (lm->arpa_lm ? lm->arpa_ng->vocab_type : lm->ng->vocab_type) == CLOSED_VOCAB) {
+	  result->unknown_word = texts->types[texts->tokens[j][t]];
+	  break;
+	}
+
+	if (context_cue[ids[t]])
+	  result->excluded_ccs++;
+	else if (!job->include_unks && ids[t] == 0)
+	  result->excluded_unks++;
+	else {
+	  prob = calc_prob_of(ids[t],
+			      ids+t-context_length,
+			      context_length,
+			      lm->ng,
+			      lm->arpa_ng,
+			      fb_list,
+			      &bo_case,
+			      &actual_context_length,
+			      lm->arpa_lm);
+	  result->sum_log_prob += log10(prob);
+	}
+	result->total_words++;
+      }
+    }
+    free(fb_list);
+  }
+
+  free(ids);
+  free(type_ids);
+  return NULL;
+}
+
+void batch_perplexity(batch_lm_t *lms,
+		      int n_lms,
+		      char **text_filenames,
+		      int n_texts,
+		      char *fb_list_filename,
+		      flag backoff_from_unk_inc,
+		      flag backoff_from_unk_exc,
+		      flag backoff_from_ccs_inc,
+		      flag backoff_from_ccs_exc,
+		      flag include_unks,
+		      int n_threads,
+		      FILE *fp) {
+
+  batch_texts_t texts;
+  batch_job_t *jobs;
+  batch_result_t *results, *result;
+  int i, j, n_jobs, n_words;
+
+  fprintf(stderr,"Reading %d text files\n",n_texts);
+  read_batch_texts(&texts,text_filenames,n_texts);
+  fprintf(stderr,"%lld word types in the texts\n",(long long) texts.n_types);
+
+  results = (batch_result_t *) rr_malloc(n_lms*n_texts*sizeof(batch_result_t));
+  n_jobs = MIN(n_threads,n_lms);
+  jobs = (batch_job_t *) rr_malloc(n_jobs*sizeof(batch_job_t));
+  for (i=0;i<n_jobs;i++) {
+    jobs[i].lms = lms;
+    jobs[i].n_lms = n_lms;
+    jobs[i].first = i;
+    jobs[i].step = n_jobs;
+    jobs[i].texts = &texts;
+    jobs[i].n_texts = n_texts;
+    jobs[i].fb_list_filename = fb_list_filename;
+    jobs[i].backoff_from_unk_inc = backoff_from_unk_inc;
+    jobs[i].backoff_from_unk_exc = backoff_from_unk_exc;
+    jobs[i].backoff_from_ccs_inc = backoff_from_ccs_inc;
+    jobs[i].backoff_from_ccs_exc = backoff_from_ccs_exc;
+    jobs[i].include_unks = include_unks;
+    jobs[i].results = results;
+  }
+  run_jobs(batch_lm_job,jobs,sizeof(batch_job_t),n_jobs);
+
+  fprintf(fp,"# LM\tTEXT\tWORDS\tOOVS\tCCS\tPERPLEXITY\tENTROPY\n");
+  for (i=0;i<n_lms;i++) {
+    for (j=0;j<n_texts;j++) {
+      result = &results[i*n_texts+j];
+      if (result->unknown_word) {
+	fprintf(stderr,"Error : %s is not in the vocabulary of %s, which is a closed\nvocabulary model.\n",
+		result->unknown_word,lms[i].filename);
+	fprintf(fp,"%s\t%s\t-\t-\t-\t-\t-\n",lms[i].filename,text_filenames[j]);
+	continue;
+      }
+      n_words = result->total_words-result->excluded_ccs-result->excluded_unks;
+      fprintf(fp,"%s\t%s\t%d\t%d\t%d\t%.2f\t%.2f\n",
+	      lms[i].filename,text_filenames[j],n_words,
+	      result->excluded_unks,result->excluded_ccs,
+	      exp(-result->sum_log_prob/n_words*log(10.0)),
+	      -result->sum_log_prob/n_words*log(10.0)/log(2.0));
+    }
+  }
+
+  for (i=0;i<texts.n_types;i++)
+    free(texts.types[i]);
+  for (i=0;i<n_texts;i++)
+    free(texts.tokens[i]);
+  free(texts.types);
+  free(texts.tokens);
+  free(texts.n_tokens);
+  free(results);
+  free(jobs);
+}
@@ -182,213 +182,218 @@ log10_bo_biprob(WAS | ZWEIG)  ZWEIG  WAS   log10_bialpha(ZWEIG,WAS)
 \end\
 */
 
-void write_arpa_lm(ng_t *ng,int verbosity) {
-
-  int *current_pos;
-  int *end_pos;
-  ngram_sz_t i;
+/* The log10 probability and back-off weight of unigram i as they
+   appear in the ARPA file. */
+void arpa_unigram(ng_t *ng, int i, double *log10_uniprob, double *log10_alpha)
+{
   double log_10_of_e = 1.0 / log(10.0);
+  double alpha;
 
-  /* HEADER */
-
-  pc_message(verbosity,1,"ARPA-style %d-gram will be written to %s\n",ng->n,ng->arpa_filename);
+  *log10_uniprob = ng->uni_log_probs[i]*log_10_of_e;
 
-  write_arpa_copyright(ng->arpa_fp,ng->n,ng->vocab_size, ng->vocab[1],ng->vocab[2],ng->vocab[3]);
+  if (ng->uni_probs[i]<=0.0)
+    *log10_uniprob = BAD_LOG_PROB;
 
-  display_vocabtype(ng->vocab_type,ng->oov_fraction, ng->arpa_fp);  
-  display_discounting_method(ng,ng->arpa_fp);
-  write_arpa_format(ng->arpa_fp,ng->n);
-  write_arpa_num_grams(ng->arpa_fp,ng,NULL,0);
-  write_arpa_k_gram_header(ng->arpa_fp,1);
-
-  for (i=ng->first_id; i<= (int) ng->vocab_size;i++) {
+  alpha=ng_double_alpha(ng,0,i);
     
-    double log10_uniprob;
-    double log10_alpha;
-    double alpha;
-    
-    log10_uniprob = ng->uni_log_probs[i]*log_10_of_e;
+  if(alpha > 0.0)
+    *log10_alpha = log10(alpha);
+  else
+    *log10_alpha = BAD_LOG_PROB;
+}
 
-    if (ng->uni_probs[i]<=0.0)
-      log10_uniprob = BAD_LOG_PROB;
+/* Go through the (i+1)-grams in the order of the tables, calling fn
+   with the log10 probability and back-off weight of each. */
+void visit_arpa_ngrams(ng_t *ng, int i, arpa_ngram_fn fn, void *data)
+{
+  int *current_pos;
+  int *end_pos;
+  int current_table, j;
+  count_t ngcount, marg_count;
+  double discounted_ngcount;    
+  double ngprob, log_10_ngprob, ngalpha, log_10_ngalpha;
 
-    alpha=ng_double_alpha(ng,0,i);
+  /* Initialise variables for the sake of warning-free compilation */
     
-    if(alpha > 0.0)
-      log10_alpha = log10(alpha);
-    else
-      log10_alpha = BAD_LOG_PROB;
-
-    fprintf(ng->arpa_fp,"%.4f %s",log10_uniprob,ng->vocab[i]);
-    if (ng->n>1)
-      fprintf(ng->arpa_fp,"\t%.4f\n",log10_alpha);
-    else
-      fprintf(ng->arpa_fp,"\n");
-  }
+  discounted_ngcount = 0.0;
+  log_10_ngalpha = 0.0;
 
   current_pos = (int *) rr_malloc(ng->n*sizeof(int));
   end_pos = (int *) rr_malloc(ng->n*sizeof(int)); 
 
-  /* Print 2-gram, ... (n-1)-gram info. */
-
-  for (i=1;i<=ng->n-1;i++) {
-
-    /* Print out the (i+1)-gram */
-
-    int current_table, j;
-    count_t ngcount, marg_count;
-    double discounted_ngcount;    
-    double ngprob, log_10_ngprob, ngalpha, log_10_ngalpha;
-
-    /* Initialise variables for the sake of warning-free compilation */
-    
-    discounted_ngcount = 0.0;
-    log_10_ngalpha = 0.0;
-
-    write_arpa_k_gram_header(ng->arpa_fp,i+1);
-
-    /* Go through the n-gram list in order */
+  /* Go through the n-gram list in order */
     
-    for (j=0;j<=ng->n-1;j++) {
-      current_pos[j] = 0;
-      end_pos[j] = 0;
-    }
+  for (j=0;j<=ng->n-1;j++) {
+    current_pos[j] = 0;
+    end_pos[j] = 0;
+  }
 
-    for (current_pos[0]=ng->first_id;
-	 current_pos[0]<=(int) ng->vocab_size;
-	 current_pos[0]++) {
+  for (current_pos[0]=ng->first_id;
+       current_pos[0]<=(int) ng->vocab_size;
+       current_pos[0]++) {
       
-      if (return_count(ng->four_byte_counts,
-		       ng->count_table[0], 
-		       ng->marg_counts,
-		       ng->marg_counts4,
-		       current_pos[0]) > 0) {
+    if (return_count(ng->four_byte_counts,
+		     ng->count_table[0], 
+		     ng->marg_counts,
+		     ng->marg_counts4,
+		     current_pos[0]) > 0) {
     
-	current_table = 1;
+      current_table = 1;
       
-	if (current_pos[0] == (int) ng->vocab_size)
-	  end_pos[1] = (int ) ng->num_kgrams[1]-1;
-	else {
-	  end_pos[1] = get_full_index(ng->ind[0][current_pos[0]+1],
-				      ng->ptr_table[0],
-				      ng->ptr_table_size[0],
-				      current_pos[0]+1)-1;
-	}
+      if (current_pos[0] == (int) ng->vocab_size)
+	end_pos[1] = (int ) ng->num_kgrams[1]-1;
+      else {
+	end_pos[1] = get_full_index(ng->ind[0][current_pos[0]+1],
+				    ng->ptr_table[0],
+				    ng->ptr_table_size[0],
+				    current_pos[0]+1)-1;
+      }
 
-	while (current_table > 0) {
+      while (current_table > 0) {
 
-	  /*	  fprintf(stderr, "i %d, current_pos[i] %d, end_pos[i] %d\n",
-		  i,
-		  current_pos[i],
-		  end_pos[i]);
-		  fflush(stderr);*/
+	if (current_table == i) {
 
+	  if (current_pos[i] <= end_pos[i]) {
 
-	  if (current_table == i) {
+	    ngcount = return_count(ng->four_byte_counts,
+				   ng->count_table[i],
+				   ng->count[i],
+				   ng->count4[i],
+				   current_pos[i]);
 
-	    if (current_pos[i] <= end_pos[i]) {
+	      
+	    if (i==1) {
+	      marg_count = return_count(ng->four_byte_counts,
+					ng->count_table[0], 
+					ng->marg_counts,
+					ng->marg_counts4,
+					current_pos[0]);
+	    }else {
+	      marg_count = return_count(ng->four_byte_counts,
+					ng->count_table[i-1],
+					ng->count[i-1],
+					ng->count4[i-1],
+					current_pos[i-1]);
+	    }
 
-	      /*	      fprintf(stderr, "%d\n",ng->count[i][current_pos[i]]);
-			      fprintf(stderr, "%d\n",ng->count_table[i][ng->count[i][current_pos[i]]]);*/
+	    if(ng->disc_meth==NULL)
+	      ng->disc_meth=(disc_meth_t*) disc_meth_init(ng->discounting_method);
 
-	      ngcount = return_count(ng->four_byte_counts,
-				     ng->count_table[i],
-				     ng->count[i],
-				     ng->count4[i],
-				     current_pos[i]);
+	    assert(ng->disc_meth);
+	    discounted_ngcount = 
+	      NG_DISC_METH(ng)->dump_discounted_ngram_count(ng,i,ngcount,marg_count,current_pos);
 
-	      
-	      if (i==1) {
-		marg_count = return_count(ng->four_byte_counts,
-					  ng->count_table[0], 
-					  ng->marg_counts,
-					  ng->marg_counts4,
-					  current_pos[0]);
-	      }else {
-		marg_count = return_count(ng->four_byte_counts,
-					  ng->count_table[i-1],
-					  ng->count[i-1],
-					  ng->count4[i-1],
-					  current_pos[i-1]);
-	      }
-
-	      if(ng->disc_meth==NULL)
-		ng->disc_meth=(disc_meth_t*) disc_meth_init(ng->discounting_method);
-
-	      assert(ng->disc_meth);
-	      discounted_ngcount = 
-		NG_DISC_METH(ng)->dump_discounted_ngram_count(ng,i,ngcount,marg_count,current_pos);
-
-	      ngprob = (double) discounted_ngcount / marg_count;
-
-	      if (ngprob > 1.0) {
-		fprintf(stderr,
-			"discounted_ngcount = %f marg_count = %d %d %d %d\n",
-			discounted_ngcount,marg_count,current_pos[0],
-			current_pos[1],current_pos[2]);
-		quit(-1,"Error : probablity of ngram is greater than one.\n");
-	      }
-
-	      if (ngprob > 0.0) 
-		log_10_ngprob = log10(ngprob);
-	      else 
-		log_10_ngprob = BAD_LOG_PROB;
-
-	      if (i <= ng->n-2) {
-		ngalpha = ng_double_alpha(ng, i, current_pos[i]);
-
-		if (ngalpha > 0.0)
-		  log_10_ngalpha = log10(ngalpha);
-		else
-		  log_10_ngalpha = BAD_LOG_PROB;
-	      }
-
-	      fprintf(ng->arpa_fp,"%.4f ",log_10_ngprob);
-	      fprintf(ng->arpa_fp,"%s ",ng->vocab[current_pos[0]]);
-	      for (j=1;j<=i;j++){
-
-		/*		fprintf(stderr, "j %d, ng->wordid[j] %u, current_pos[j] %d, ng->word_id[j][current_pos[j]] %u\n",j, ng->word_id[j], current_pos[j], ng->word_id[j][current_pos[j]]);*/
-
-		fprintf(ng->arpa_fp,"%s ",ng->vocab[(unsigned int) ng->word_id[j][current_pos[j]]]);
-	      }
-
-	      if (i <= ng->n-2)
-		fprintf(ng->arpa_fp,"%.4f\n",log_10_ngalpha);
-	      else
-		fprintf(ng->arpa_fp,"\n");
+	    ngprob = (double) discounted_ngcount / marg_count;
 
-	      current_pos[i]++;
-	    }else {
-	      current_table--;
-	      if (current_table > 0)
-		current_pos[current_table]++;
+	    if (ngprob > 1.0) {
+	      fprintf(stderr,
+		      "discounted_ngcount = %f marg_count = %d %d %d %d\n",
+		      discounted_ngcount,marg_count,current_pos[0],
+		      current_pos[1],current_pos[2]);
+	      quit(-1,"Error : probablity of ngram is greater than one.\n");
 	    }
+
+	    if (ngprob > 0.0) 
+	      log_10_ngprob = log10(ngprob);
+	    else 
+	      log_10_ngprob = BAD_LOG_PROB;
+
+	    if (i <= ng->n-2) {
+	      ngalpha = ng_double_alpha(ng, i, current_pos[i]);
+
+	      if (ngalpha > 0.0)
+		log_10_ngalpha = log10(ngalpha);
+	      else
+		log_10_ngalpha = BAD_LOG_PROB;
+	    }
+
+	    fn(ng,i,current_pos,log_10_ngprob,log_10_ngalpha,data);
+
+	    current_pos[i]++;
 	  }else {
+	    current_table--;
+	    if (current_table > 0)
+	      current_pos[current_table]++;
+	  }
+	}else {
 	    
-	    if (current_pos[current_table] <= end_pos[current_table]) {
-	      current_table++;
-	      if (current_pos[current_table-1] == (int) ng->num_kgrams[current_table-1]-1)
-		end_pos[current_table] = (int) ng->num_kgrams[current_table]-1;
-	      else {
-		end_pos[current_table] = get_full_index(ng->ind[current_table-1][current_pos[current_table-1]+1],
-							ng->ptr_table[current_table-1],
-							ng->ptr_table_size[current_table-1],
-							current_pos[current_table-1]+1) - 1;
-	      }
-	    }else {
-	      current_table--;
-	      if (current_table > 0)
-		current_pos[current_table]++;
+	  if (current_pos[current_table] <= end_pos[current_table]) {
+	    current_table++;
+	    if (current_pos[current_table-1] == (int) ng->num_kgrams[current_table-1]-1)
+	      end_pos[current_table] = (int) ng->num_kgrams[current_table]-1;
+	    else {
+	      end_pos[current_table] = get_full_index(ng->ind[current_table-1][current_pos[current_table-1]+1],
+						      ng->ptr_table[current_table-1],
+						      ng->ptr_table_size[current_table-1],
+						      current_pos[current_table-1]+1) - 1;
 	    }
+	  }else {
+	    current_table--;
+	    if (current_table > 0)
+	      current_pos[current_table]++;
 	  }
 	}
       }
     }
-  } 
+  }
 
   free(current_pos);
   free(end_pos);
+}
+
+static void write_arpa_ngram(ng_t *ng, int i, int *current_pos,
+			     double log_10_ngprob, double log_10_ngalpha,
+			     void *data)
+{
+  int j;
+
+  fprintf(ng->arpa_fp,"%.4f ",log_10_ngprob);
+  fprintf(ng->arpa_fp,"%s ",ng->vocab[current_pos[0]]);
+  for (j=1;j<=i;j++)
+    fprintf(ng->arpa_fp,"%s ",ng->vocab[(unsigned int) ng->word_id[j][current_pos[j]]]);
+
+  if (i <= ng->n-2)
+    fprintf(ng->arpa_fp,"%.4f\n",log_10_ngalpha);
+  else
+    fprintf(ng->arpa_fp,"\n");
+}
+
+void write_arpa_lm(ng_t *ng,int verbosity) {
+
+  ngram_sz_t i;
+
+  /* HEADER */
+
+  pc_message(verbosity,1,"ARPA-style %d-gram will be written to %s\n",ng->n,ng->arpa_filename);
 
+  write_arpa_copyright(ng->arpa_fp,ng->n,ng->vocab_size, ng->vocab[1],ng->vocab[2],ng->vocab[3]);
+
+  display_vocabtype(ng->vocab_type,ng->oov_fraction, ng->arpa_fp);  
+  display_discounting_method(ng,ng->arpa_fp);
+  write_arpa_format(ng->arpa_fp,ng->n);
+  write_arpa_num_grams(ng->arpa_fp,ng,NULL,0);
+  write_arpa_k_gram_header(ng->arpa_fp,1);
+
+  for (i=ng->first_id; i<= (int) ng->vocab_size;i++) {
+    
+    double log10_uniprob;
+    double log10_alpha;
+    
+    arpa_unigram(ng,i,&log10_uniprob,&log10_alpha);
+
+    fprintf(ng->arpa_fp,"%.4f %s",log10_uniprob,ng->vocab[i]);
+    if (ng->n>1)
+      fprintf(ng->arpa_fp,"\t%.4f\n",log10_alpha);
+    else
+      fprintf(ng->arpa_fp,"\n");
+  }
+
+  /* Print 2-gram, ... (n-1)-gram info. */
+
+  for (i=1;i<=ng->n-1;i++) {
+    write_arpa_k_gram_header(ng->arpa_fp,i+1);
+    visit_arpa_ngrams(ng,i,write_arpa_ngram,NULL);
+  }
 
   fprintf(ng->arpa_fp,"\n\\end\\\n");
 
@@ -0,0 +1,580 @@
+/* ====================================================================
+ * Copyright (c) 2026 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/*
+ * write_trie.c - write the language model in the binary trie format
+ * of sphinxbase, the one which sphinx_lm_convert produces and which
+ * the decoders read or map directly, so that it need not go through
+ * an ARPA file first.
+ *
+ * Probabilities and back-off weights are stored as floats in the log
+ * base of the decoders (1.0001), middle orders as index/prob/bo/next
+ * entries packed into bit fields, and probabilities and back-off
+ * weights are quantized to at most 16 bits per order.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "pc_general.h"
+#include "general.h"
+#include "idngram2lm.h"
+#include "ngram.h"
+
+#define TRIE_HEADER "Aligned Trie LM 1.0"
+#define TRIE_BYTE_ORDER 0x11223344
+#define TRIE_ALIGN 8
+#define TRIE_PAD(n) (((n) + TRIE_ALIGN - 1) / TRIE_ALIGN * TRIE_ALIGN)
+#define TRIE_QUANT_16 1   /* 16 bit probs and backoffs for all orders */
+#define TRIE_QUANT_BITS 2 /* Bits for each order follow the type */
+#define TRIE_QUANT_MIN_BITS 1
+#define TRIE_QUANT_MAX_BITS 16
+#define TRIE_LOG_BASE 1.0001
+/* What sphinxbase puts in leading empty bins. */
+#define TRIE_FLOAT_INF (0x7f800000)
+
+typedef unsigned long long trie_bits_t;
+
+typedef struct {
+  float prob;
+  float bo;
+  wordid_t next;
+} trie_unigram_t;
+
+typedef struct {
+  wordid_t *words;   /* Last word first */
+  float prob;
+  float bo;
+} trie_ngram_t;
+
+/* The (i+1)-grams, sorted by their reversed words */
+typedef struct {
+  trie_ngram_t *ngrams;
+  wordid_t *words;
+  ngram_sz_t count;
+  ngram_sz_t size;
+  double inv_log10_of_base;
+} trie_order_t;
+
+/* The packed entries of one order from 2 up */
+typedef struct {
+  unsigned char *base;
+  int word_bits;
+  int quant_bits;
+  int next_bits;
+  int total_bits;
+  wordid_t insert_index;
+} trie_level_t;
+
+typedef struct {
+  int n;
+  wordid_t counts[TRIE_MAX_ORDER];
+  unsigned char prob_bits[TRIE_MAX_ORDER-1];
+  unsigned char bo_bits[TRIE_MAX_ORDER-1];
+  float *centers;
+  size_t centers_size;
+  float *prob_bins[TRIE_MAX_ORDER-1];
+  float *bo_bins[TRIE_MAX_ORDER-1];
+  trie_unigram_t *unigrams;
+  trie_order_t orders[TRIE_MAX_ORDER-1];
+  trie_level_t levels[TRIE_MAX_ORDER-1];
+  unsigned char *mem;
+  size_t mem_size;
+} trie_t;
+
+int parse_trie_quant(char const *spec, int n,
+		     unsigned char *prob_bits, unsigned char *bo_bits)
+{
+  int i, prob, bo, nread;
+
+  prob = bo = TRIE_QUANT_MAX_BITS;
+  for (i = 0; i < n-1; i++) {
+    if (spec && *spec) {
+      if (sscanf(spec, "%d%n", &prob, &nread) != 1)
+	return -1;
+      spec += nread;
+      bo = prob;
+      if (*spec == '/') {
+	if (sscanf(spec+1, "%d%n", &bo, &nread) != 1)
+	  return -1;
+	spec += nread+1;
+      }
+      if (*spec == ',')
+	++spec;
+      else if (*spec)
+	return -1;
+    }
+    /* Orders which are not given use the last ones which were. */
+    if (prob < TRIE_QUANT_MIN_BITS || prob > TRIE_QUANT_MAX_BITS
+	|| bo < TRIE_QUANT_MIN_BITS || bo > TRIE_QUANT_MAX_BITS)
+      return -1;
+    prob_bits[i] = prob;
+    bo_bits[i] = (i < n-2) ? bo : 0;
+  }
+  return 0;
+}
+
+static int required_bits(wordid_t max_value)
+{
+  int res;
+
+  if (!max_value)
+    return 0;
+  res = 1;
+  while (max_value >>= 1)
+    res++;
+  return res;
+}
+
+/* Or value into the bit field at offset, the way sphinxbase's bitarr
+   reads it back: little-endian from the byte holding the first bit. */
+static void write_bits(unsigned char *base, trie_bits_t offset,
+		       int length, trie_bits_t value)
+{
+  trie_bits_t word;
+
+#ifdef WORDS_BIGENDIAN
+  value <<= 64 - length - (offset & 7);
+#else
+  value <<= offset & 7;
+#endif
+  memcpy(&word, base + (offset >> 3), sizeof(word));
+  word |= value;
+  memcpy(base + (offset >> 3), &word, sizeof(word));
+}
+
+static float trie_log(trie_order_t *order, double log10_value)
+{
+  return (float) (log10_value * order->inv_log10_of_base);
+}
+
+static void collect_ngram(ng_t *ng, int i, int *current_pos,
+			  double log10_prob, double log10_alpha, void *data)
+{
+  trie_order_t *order = (trie_order_t *) data;
+  trie_ngram_t *ngram;
+  int j;
+
+  if (order->count >= order->size)
+    quit(-1,"Error : more %d-grams than the %lld counted.\n",
+	 i+1,order->size);
+
+  ngram = &order->ngrams[order->count];
+  ngram->words = order->words + order->count * (i+1);
+  ngram->words[i] = current_pos[0] - ng->first_id;
+  for (j=1;j<=i;j++)
+    ngram->words[i-j] = ng->word_id[j][current_pos[j]] - ng->first_id;
+
+  ngram->prob = trie_log(order, log10_prob > 0.0 ? 0.0 : log10_prob);
+  ngram->bo = (i <= ng->n-2) ? trie_log(order, log10_alpha) : 0.0f;
+  order->count++;
+}
+
+static int compare_words(wordid_t const *a, wordid_t const *b, int n)
+{
+  int i;
+
+  for (i = 0; i < n; i++) {
+    if (a[i] != b[i])
+      return a[i] < b[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+static int sort_order;
+
+static int compare_ngrams(const void *a, const void *b)
+{
+  return compare_words(((trie_ngram_t *) a)->words,
+		       ((trie_ngram_t *) b)->words, sort_order);
+}
+
+static int compare_floats(const void *a, const void *b)
+{
+  float fa = *(float *) a, fb = *(float *) b;
+
+  return (fa > fb) - (fa < fb);
+}
+
+/* Split the sorted values into bins of equal size and use their means
+   as the centers, exactly as sphinxbase trains its quantizer. */
+static void make_bins(float *values, ngram_sz_t values_num,
+		      float *centers, trie_bits_t bins)
+{
+  float *finish, *start;
+  trie_bits_t i;
+
+  qsort(values, values_num, sizeof(*values), compare_floats);
+  start = values;
+  for (i = 0; i < bins; i++, centers++, start = finish) {
+    finish = values + (size_t) ((trie_bits_t) values_num * (i+1) / bins);
+    if (finish == start)
+      *centers = i ? *(centers-1) : (float) -TRIE_FLOAT_INF;
+    else {
+      float sum = 0.0f;
+      float *ptr;
+      for (ptr = start; ptr != finish; ptr++)
+	sum += *ptr;
+      *centers = sum / (float) (finish - start);
+    }
+  }
+}
+
+static void train_bins(trie_order_t *order, int bo, float *centers,
+		       int bits)
+{
+  float *values;
+  ngram_sz_t i;
+
+  values = (float *) rr_malloc(sizeof(float) * (order->count ? order->count : 1));
+  for (i = 0; i < order->count; i++)
+    values[i] = bo ? order->ngrams[i].bo : order->ngrams[i].prob;
+  make_bins(values, order->count, centers, 1ULL << bits);
+  free(values);
+}
+
+static trie_bits_t encode(float *bins, int bits, float value)
+{
+  float *first = bins, *end = bins + (1ULL << bits);
+  ngram_sz_t count = end - first, step;
+
+  /* Lower bound, then the nearer of it and the bin below. */
+  while (count > 0) {
+    step = count / 2;
+    if (first[step] < value) {
+      first += step+1;
+      count -= step+1;
+    }
+    else
+      count = step;
+  }
+  if (first == bins)
+    return 0;
+  if (first == end)
+    return end - bins - 1;
+  return first - bins - (value - *(first-1) < *first - value);
+}
+
+/* Add an entry of order level+2, whose children begin at the next
+   free entry of the order above. */
+static void insert_entry(trie_t *trie, int level, wordid_t word,
+			 float prob, float bo)
+{
+  trie_level_t *l = &trie->levels[level];
+
+  if (trie->mem) {
+    trie_bits_t offset = (trie_bits_t) l->insert_index * l->total_bits;
+
+    write_bits(l->base, offset, l->word_bits, word);
+    offset += l->word_bits;
+    if (level < trie->n-2) {
+      write_bits(l->base, offset, l->quant_bits,
+		 (encode(trie->prob_bins[level], trie->prob_bits[level], prob)
+		  << trie->bo_bits[level])
+		 | encode(trie->bo_bins[level], trie->bo_bits[level], bo));
+      offset += l->quant_bits;
+      write_bits(l->base, offset, l->next_bits,
+		 trie->levels[level+1].insert_index);
+    }
+    else
+      write_bits(l->base, offset, l->quant_bits,
+		 encode(trie->prob_bins[level], trie->prob_bits[level], prob));
+  }
+  l->insert_index++;
+}
+
+/* Merge the unigrams and all the sorted n-grams into the trie, parents
+   before their children.  Contexts that are missing get an entry with
+   the backed-off probability and no back-off weight, so that the
+   n-grams under them can be found.  Without memory, just count. */
+static void insert_ngrams(trie_t *trie)
+{
+  wordid_t words[TRIE_MAX_ORDER];
+  float probs[TRIE_MAX_ORDER];
+  ngram_sz_t pos[TRIE_MAX_ORDER-1];
+  wordid_t unigram;
+  int i, j, m, valid;
+
+  for (i = 0; i < trie->n-1; i++) {
+    pos[i] = 0;
+    trie->levels[i].insert_index = 0;
+  }
+  valid = 0;
+
+  for (unigram = 0; ; ) {
+    trie_ngram_t *top = NULL;
+
+    /* The next one is the smallest, shorter ones first on ties. */
+    m = 1;
+    for (i = 0; i < trie->n-1; i++) {
+      trie_order_t *order = &trie->orders[i];
+      int cmp;
+
+      if (pos[i] == order->count)
+	continue;
+      if (top == NULL)
+	cmp = (order->ngrams[pos[i]].words[0] < unigram) ? -1 : 1;
+      else
+	cmp = compare_words(order->ngrams[pos[i]].words, top->words, m);
+      if (cmp < 0) {
+	top = &order->ngrams[pos[i]];
+	m = i+2;
+      }
+    }
+
+    if (top == NULL) {
+      if (trie->n > 1)
+	trie->unigrams[unigram].next = trie->levels[0].insert_index;
+      if (unigram++ == trie->counts[0])
+	break;
+      words[0] = unigram-1;
+      probs[0] = trie->unigrams[unigram-1].prob;
+      valid = 1;
+      continue;
+    }
+
+    for (i = 1; i < m-1; i++) {
+      if (i >= valid || words[i] != top->words[i])
+	break;
+    }
+    for (j = i; j < m-1; j++) {
+      probs[j] = probs[j-1] + trie->unigrams[top->words[j]].bo;
+      insert_entry(trie, j-1, top->words[j], probs[j], 0.0f);
+      words[j] = top->words[j];
+    }
+    insert_entry(trie, m-2, top->words[m-1], top->prob, top->bo);
+    words[m-1] = top->words[m-1];
+    probs[m-1] = top->prob;
+    valid = m;
+    pos[m-2]++;
+  }
+}
+
+static void write_pad(FILE *fp, size_t size)
+{
+  for (; size % TRIE_ALIGN; size++)
+    fputc(0, fp);
+}
+
+void write_trie_lm(ng_t *ng, int verbosity)
+{
+  trie_t trie;
+  double inv_log10_of_base = 1.0 / log10(TRIE_LOG_BASE);
+  unsigned char n;
+  wordid_t byte_order = TRIE_BYTE_ORDER;
+  size_t hdr_size;
+  int i, is_16;
+  int32 length;
+  ngram_sz_t j;
+
+  pc_message(verbosity,1,"Trie %d-gram will be written to %s\n",ng->n,ng->trie_filename);
+
+  memset(&trie, 0, sizeof(trie));
+  trie.n = ng->n;
+  trie.counts[0] = 1 + ng->vocab_size - ng->first_id;
+  if (parse_trie_quant(ng->trie_quant, trie.n,
+		       trie.prob_bits, trie.bo_bits) < 0)
+    quit(-1,"Error : invalid trie quantization '%s'.\n",ng->trie_quant);
+
+  /* Unigrams stay as floats, with an extra one at the end to mark
+     where the children of the last one end. */
+  trie.unigrams = (trie_unigram_t *) rr_calloc(trie.counts[0]+1,
+					       sizeof(trie_unigram_t));
+  for (j = ng->first_id; j <= (int) ng->vocab_size; j++) {
+    double log10_uniprob, log10_alpha;
+
+    arpa_unigram(ng, j, &log10_uniprob, &log10_alpha);
+    if (log10_uniprob > 0.0)
+      log10_uniprob = 0.0;
+    trie.unigrams[j - ng->first_id].prob =
+      (float) (log10_uniprob * inv_log10_of_base);
+    if (ng->n > 1)
+      trie.unigrams[j - ng->first_id].bo =
+	(float) (log10_alpha * inv_log10_of_base);
+  }
+
+  for (i = 1; i <= ng->n-1; i++) {
+    trie_order_t *order = &trie.orders[i-1];
+
+    order->size = ng->num_kgrams[i];
+    order->ngrams = (trie_ngram_t *) rr_malloc(sizeof(trie_ngram_t)
+					       * (order->size ? order->size : 1));
+    order->words = (wordid_t *) rr_malloc(sizeof(wordid_t) * (i+1)
+					  * (order->size ? order->size : 1));
+    order->inv_log10_of_base = inv_log10_of_base;
+    visit_arpa_ngrams(ng, i, collect_ngram, order);
+    sort_order = i+1;
+    qsort(order->ngrams, order->count, sizeof(trie_ngram_t), compare_ngrams);
+    trie.counts[i] = order->count;
+  }
+
+  if (ng->n > 1) {
+    float *centers;
+    size_t offset;
+
+    pc_message(verbosity,2,"Training quantizer...\n");
+    trie.centers_size = 0;
+    for (i = 0; i < ng->n-1; i++) {
+      trie.centers_size += 1ULL << trie.prob_bits[i];
+      if (i < ng->n-2)
+	trie.centers_size += 1ULL << trie.bo_bits[i];
+    }
+    trie.centers = (float *) rr_malloc(sizeof(float) * trie.centers_size);
+    centers = trie.centers;
+    for (i = 0; i < ng->n-1; i++) {
+      trie.prob_bins[i] = centers;
+      train_bins(&trie.orders[i], 0, centers, trie.prob_bits[i]);
+      centers += 1ULL << trie.prob_bits[i];
+      if (i < ng->n-2) {
+	trie.bo_bins[i] = centers;
+	train_bins(&trie.orders[i], 1, centers, trie.bo_bits[i]);
+	centers += 1ULL << trie.bo_bits[i];
+      }
+    }
+
+    /* Count the entries for missing contexts, then lay out and fill
+       the tables for the counts with them. */
+    insert_ngrams(&trie);
+    for (i = 0; i < ng->n-1; i++)
+      trie.counts[i+1] = trie.levels[i].insert_index;
+
+    pc_message(verbosity,2,"Building trie...\n");
+    trie.mem_size = 0;
+    for (i = 0; i < ng->n-1; i++) {
+      trie_level_t *l = &trie.levels[i];
+
+      l->word_bits = required_bits(trie.counts[0]);
+      l->quant_bits = trie.prob_bits[i] + trie.bo_bits[i];
+      l->next_bits = (i < ng->n-2) ? required_bits(trie.counts[i+2]) : 0;
+      l->total_bits = l->word_bits + l->quant_bits + l->next_bits;
+      if (l->word_bits > 25 || l->next_bits > 25 || trie.counts[i+1] + 1 >= (1U << 25))
+	quit(-1,"Error : too many words or %d-grams for a trie LM.\n",i+2);
+      /* One more entry for the end of the last one's children, and
+	 room for reading whole words past the end. */
+      trie.mem_size += ((trie_bits_t) (1 + trie.counts[i+1]) * l->total_bits + 7) / 8
+	+ sizeof(trie_bits_t);
+    }
+    trie.mem = (unsigned char *) rr_calloc(trie.mem_size, 1);
+    offset = 0;
+    for (i = 0; i < ng->n-1; i++) {
+      trie_level_t *l = &trie.levels[i];
+
+      l->base = trie.mem + offset;
+      offset += ((trie_bits_t) (1 + trie.counts[i+1]) * l->total_bits + 7) / 8
+	+ sizeof(trie_bits_t);
+    }
+    insert_ngrams(&trie);
+    for (i = 0; i < ng->n-2; i++) {
+      trie_level_t *l = &trie.levels[i];
+
+      write_bits(l->base,
+		 (trie_bits_t) (l->insert_index + 1) * l->total_bits - l->next_bits,
+		 l->next_bits, trie.levels[i+1].insert_index);
+    }
+  }
+
+  /* Header */
+
+  n = ng->n;
+  fwrite(TRIE_HEADER, 1, strlen(TRIE_HEADER), ng->trie_fp);
+  fwrite(&n, sizeof(n), 1, ng->trie_fp);
+  fwrite(&byte_order, sizeof(byte_order), 1, ng->trie_fp);
+  fwrite(trie.counts, sizeof(*trie.counts), ng->n, ng->trie_fp);
+  hdr_size = strlen(TRIE_HEADER) + sizeof(n) + sizeof(byte_order)
+    + ng->n * sizeof(*trie.counts);
+  write_pad(ng->trie_fp, hdr_size);
+
+  /* Quantization */
+
+  if (ng->n > 1) {
+    int32 type[2] = { TRIE_QUANT_16, 0 };
+    unsigned char bits[TRIE_MAX_ORDER-1];
+
+    is_16 = 1;
+    for (i = 0; i < ng->n-1; i++) {
+      if (trie.prob_bits[i] != 16 || (i < ng->n-2 && trie.bo_bits[i] != 16))
+	is_16 = 0;
+    }
+    if (is_16)
+      fwrite(type, sizeof(*type), 2, ng->trie_fp);
+    else {
+      type[0] = TRIE_QUANT_BITS;
+      fwrite(type, sizeof(*type), 2, ng->trie_fp);
+      memset(bits, 0, sizeof(bits));
+      memcpy(bits, trie.prob_bits, ng->n-1);
+      fwrite(bits, 1, sizeof(bits), ng->trie_fp);
+      memset(bits, 0, sizeof(bits));
+      memcpy(bits, trie.bo_bits, ng->n-1);
+      fwrite(bits, 1, sizeof(bits), ng->trie_fp);
+    }
+    fwrite(trie.centers, sizeof(float), trie.centers_size, ng->trie_fp);
+  }
+
+  /* Unigrams and the packed n-grams */
+
+  fwrite(trie.unigrams, sizeof(trie_unigram_t), trie.counts[0]+1, ng->trie_fp);
+  write_pad(ng->trie_fp, (trie.counts[0]+1) * sizeof(trie_unigram_t));
+  if (ng->n > 1) {
+    fwrite(trie.mem, 1, trie.mem_size, ng->trie_fp);
+    write_pad(ng->trie_fp, trie.mem_size);
+  }
+
+  /* Words */
+
+  length = 0;
+  for (j = ng->first_id; j <= (int) ng->vocab_size; j++)
+    length += strlen(ng->vocab[j]) + 1;
+  fwrite(&length, sizeof(length), 1, ng->trie_fp);
+  for (j = ng->first_id; j <= (int) ng->vocab_size; j++)
+    fwrite(ng->vocab[j], 1, strlen(ng->vocab[j]) + 1, ng->trie_fp);
+
+  rr_oclose(ng->trie_fp);
+
+  for (i = 0; i < ng->n-1; i++) {
+    free(trie.orders[i].ngrams);
+    free(trie.orders[i].words);
+  }
+  free(trie.unigrams);
+  if (trie.centers)
+    free(trie.centers);
+  if (trie.mem)
+    free(trie.mem);
+}
@@ -42,62 +42,105 @@
 #include "pc_general.h"
 #include "general.h"
 
-/* create a new node, and sets the count to 1 */
-struct node *new_node( char *key )
+#define HASH_BLOCK_SIZE 65536
+
+/* FNV-1a hash of a string */
+static unsigned int string_key( char *key )
+{
+  unsigned int h = 2166136261u;
+  unsigned char *t = (unsigned char *) key;
+
+  for( ; *t; t++ )
+    h = ( h ^ *t ) * 16777619u;
+  return h;
+}
+
+/* copy a word into the table's current block */
+static char *copy_word( struct hash_table *table, char *key )
 {
-  struct node *x;
+  size_t len = strlen( key ) + 1;
+  char *word;
 
-  x = (struct node *) rr_malloc( sizeof( struct node ) );
-  x->word = (char *) rr_malloc( (strlen( key ) + 1) * sizeof( char ) );
-  strcpy( x->word, key );
-  x->count = 1;
-  return x;
+  if ( len > table->block_left ) {
+    table->block_left = MAX( len, HASH_BLOCK_SIZE );
+    table->block = (char *) rr_malloc( table->block_left );
+  }
+  word = table->block;
+  memcpy( word, key, len );
+  table->block += len;
+  table->block_left -= len;
+  return word;
 }
 
 /* create hash table */
 void new_hashtable( struct hash_table *table, int M )
 {
-  int i;
-  
   table->size = M;
-  table->chain = (struct node **) rr_malloc( M * sizeof( struct node *) );
-  for( i = 0; i < M; i++ ) {
-    table->chain[i] = new_node( "HEAD_NODE" );
-    table->chain[i]->next = (struct node *) NULL;
+  table->nslots = 16;
+  while ( table->nslots < (unsigned int) M && table->nslots < 0x40000000u )
+    table->nslots *= 2;
+  table->nentries = 0;
+  table->slots = (struct hash_slot *) rr_calloc( table->nslots, 
+						sizeof( struct hash_slot ) );
+  table->block = NULL;
+  table->block_left = 0;
+}
+
+/* find the slot holding key, or the empty slot where it would go */
+static struct hash_slot *find_slot( struct hash_table *table, char *key, 
+				    unsigned int k )
+{
+  unsigned int mask = table->nslots - 1;
+  unsigned int i;
+  struct hash_slot *slot;
+
+  for( i = k & mask; ; i = ( i + 1 ) & mask ) {
+    slot = &table->slots[i];
+    if ( slot->word == NULL ||
+	 ( slot->key == k && strcmp( slot->word, key ) == 0 ) )
+      return slot;
+  }
+}
+
+/* double the number of slots */
+static void grow_hashtable( struct hash_table *table )
+{
+  struct hash_slot *old_slots = table->slots;
+  unsigned int old_nslots = table->nslots;
+  unsigned int i, j, mask;
+
+  table->nslots *= 2;
+  table->slots = (struct hash_slot *) rr_calloc( table->nslots, 
+						sizeof( struct hash_slot ) );
+  mask = table->nslots - 1;
+  for( i = 0; i < old_nslots; i++ ) {
+    if ( old_slots[i].word == NULL ) continue;
+    for( j = old_slots[i].key & mask; table->slots[j].word;
+	 j = ( j + 1 ) & mask );
+    table->slots[j] = old_slots[i];
   }
+  free( old_slots );
 }
 
-/* update linked list */
-int update_chain( struct node *t, char *key )
+/* find key, adding it with a value of 0 if it is new */
+static struct hash_slot *insert_slot( struct hash_table *table, char *key )
 {
-  struct node *x;
-  int score;
+  unsigned int k = string_key( key );
+  struct hash_slot *slot = find_slot( table, key, k );
 
-  while( t->next != NULL ) {
-    score = strcmp( key, t->next->word ); 
-    /* move to next node */
-    if ( score > 0 ) t = t->next;
-    /* update node */
-    else if ( score == 0 ) {
-      t->next->count++;
-      return 1;
-    }
-    /* add new node */
-    else {
-      x = new_node( key );
-      x->next = t->next;
-      t->next = x;
-      return 0;
+  if ( slot->word == NULL ) {
+    if ( 2 * ( table->nentries + 1 ) > table->nslots ) {
+      grow_hashtable( table );
+      slot = find_slot( table, key, k );
     }
+    slot->word = copy_word( table, key );
+    slot->key = k;
+    slot->value = 0;
+    table->nentries++;
   }
-  /* add node at end */
-  x = new_node( key );
-  x->next = (struct node *) NULL;
-  t->next = x;
-  return 0;
+  return slot;
 }
 
-
 /* generate a hash table address from a variable length character */
 /* string - from R. Sedgewick, "Algorithms in C++". */
 int hash( char *key, int M )
@@ -110,36 +153,48 @@ int hash( char *key, int M )
   return h;
 }
 
-/* print contents of linked list */
-static void print_chain(FILE* outfp, struct node *t )
+/* A word and where it used to be in the table */
+typedef struct {
+  struct hash_slot *slot;
+  int chain;
+} print_rec;
+
+static int compare_print_recs( const void *a, const void *b )
 {
-  t = t->next;  /* don't print head node */
-  while ( t != NULL ) {
-    fprintf(outfp, "%s %d\n", t->word, t->count );
-    t = t->next;
-  }
+  const print_rec *ra = (const print_rec *) a;
+  const print_rec *rb = (const print_rec *) b;
+
+  if ( ra->chain != rb->chain )
+    return ( ra->chain < rb->chain ) ? -1 : 1;
+  return strcmp( ra->slot->word, rb->slot->word );
 }
 
-/* print hash table contents */
+/* print hash table contents, in the order of the chained table this
+   replaced (by chain, then alphabetically), so that the output is
+   unchanged */
 void print(FILE* outfp, struct hash_table *table )
 {
-  int i;
-  for( i = 0; i < table->size; i++ )
-    print_chain(outfp, table->chain[i] );
+  print_rec *recs;
+  unsigned int i, n;
+
+  recs = (print_rec *) rr_malloc( ( table->nentries + 1 ) * sizeof( print_rec ) );
+  n = 0;
+  for( i = 0; i < table->nslots; i++ ) {
+    if ( table->slots[i].word == NULL ) continue;
+    recs[n].slot = &table->slots[i];
+    recs[n].chain = hash( table->slots[i].word, table->size );
+    n++;
+  }
+  qsort( recs, n, sizeof( print_rec ), compare_print_recs );
+  for( i = 0; i < n; i++ )
+    fprintf(outfp, "%s %d\n", recs[i].slot->word, (int) recs[i].slot->value );
+  free( recs );
 }
 
 /* update hash table contents */
 void update( struct hash_table *table, char *key, int verbosity )
 {
-  int chain;
-  
-  chain = hash( key, table->size );
-  if ( chain < 0 || chain >= table->size ) {
-    pc_message(verbosity,1,"WARNING : invalid hash address.\n");
-    pc_message(verbosity,1,"%s ignored\n", key );
-    return;
-  }
-  update_chain( table->chain[ chain ], key );
+  insert_slot( table, key )->value++;
 }
 
 /* Hashing functions, by Gary Cook (gdc@eng.cam.ac.uk).  Could use the
@@ -165,103 +220,17 @@ int nearest_prime(int num)
   return( num );
 }
 
+void add_to_hashtable( struct hash_table *table,
+		       char *vocab_item,
+		       wordid_t ind) {
+  struct hash_slot *slot = insert_slot( table, vocab_item );
 
-/** 
-    ARCHAN 20060122 This is a customized implementation of hash table
-    for text2idngram and wngram2idngram. 
- */
-
-/* create a new node, and sets the index to ind */
-struct idngram_node *idngram_new_node( char *key ,wordid_t ind)
-{
-  struct idngram_node *x;
-
-  x = (struct idngram_node *) rr_malloc( sizeof( struct idngram_node ) );
-  x->word = (char *) rr_malloc( (strlen( key ) + 1) * sizeof( char ) );
-  strcpy( x->word, key );
-  x->ind = ind;
-  return x;
-}
-
-/* generate a hash table address from a variable length character */
-/* string - from R. Sedgewick, "Algorithms in C++". */
-int idngram_hash( char *key, int M )
-{
-  unsigned int h; 
-  char *t = key;
-
-  for( h = 0; *t; t++ )
-    h = ( 256 * h + *t ) % M;
-
-  return h;
-}
-
-/* create hash table */
-void new_idngram_hashtable( struct idngram_hash_table *table, int M )
-{
-  int i;
-  
-  table->size = M;
-  table->chain = (struct idngram_node **) rr_malloc( M * sizeof( struct idngram_node *) );
-  for( i = 0; i < M; i++ ) {
-    table->chain[i] = idngram_new_node( "HEAD_NODE" , 0);
-    table->chain[i]->next = (struct idngram_node *) NULL;
-  }
-
-  /*  for(i = 0; i< M ; i++){
-    fprintf(stderr, "%d %s ind %d, %d\n",i,table->chain[i]->word, table->chain[i]->ind, table->chain[i]->next);
-    fflush(stderr);
-    }*/
+  if ( slot->value == 0 )
+    slot->value = ind;
 }
 
-/* update linked list */
-int idngram_update_chain( struct idngram_node *t, char *key ,wordid_t ind)
-{
-  struct idngram_node *x;
-
-  /* Move to end of list */ 
-
-  while( t->next != NULL )
-    t = t->next;
-
-  /* add node at end */
-  x = idngram_new_node( key,ind );
-  x->next = (struct idngram_node *) NULL;
-  t->next = x;
-  return 0;
-}
-
-
-void add_to_idngram_hashtable( struct idngram_hash_table *table,
-			       unsigned long position,
-			       char *vocab_item,
-			       wordid_t ind) {
-
-  idngram_update_chain( table->chain[position], vocab_item,ind );
-}
-
-wordid_t index2(struct idngram_hash_table *vocab,
+wordid_t index2(struct hash_table *vocab,
 		char *word) {
   
-  unsigned long chain;
-  struct idngram_node *chain_pos;
-
-  chain = idngram_hash( word, vocab->size );
-  if ( chain >= vocab->size ) {
-    fprintf( stderr, "WARNING : invalid hash address\n" );
-    fprintf( stderr, "%s ignored\n", word );
-    return(0);
-  }
-
-  chain_pos = vocab->chain[chain];
-  while (chain_pos->next != NULL) {
-    if (strcmp(word,chain_pos->next->word) ) {
-      fflush(stderr);
-      chain_pos = chain_pos->next;
-    }else
-      return (chain_pos->next->ind);
-  }
-  return (0);
-
+  return find_slot( vocab, word, string_key( word ) )->value;
 }
-
@@ -43,23 +43,29 @@
 #include "general.h"
 #define MAX_STRING_LENGTH 501
 
-struct node {
+/* A word, and its count in text2wfreq or its id in text2idngram and
+   wngram2idngram */
+struct hash_slot {
   char *word;
-  int count;
-  struct node *next;
+  unsigned int key;
+  wordid_t value;
 };
 
+/* An open addressing hash table of words, with linear probing.  The
+   number of slots is a power of two, and is doubled whenever the
+   table gets half full.  The words are copied into large blocks
+   rather than allocated one at a time. */
 struct hash_table {
-  int size;
-  struct node **chain;
+  int size;                  /* size asked for, which sets print()'s order */
+  unsigned int nslots;
+  unsigned int nentries;
+  struct hash_slot *slots;
+  char *block;               /* where the next word will be copied */
+  size_t block_left;
 };
 
-struct node *new_node( char *key );
-
 void new_hashtable( struct hash_table *table, int M );
 
-int update_chain( struct node *t, char *key );
-
 int hash( char *key, int M );
 
 void print( FILE* outfp, struct hash_table *table );
@@ -68,26 +74,11 @@ void update( struct hash_table *table, char *key, int verbosity );
 
 int nearest_prime(int num);
 
-struct idngram_node {
-  char *word;
-  wordid_t ind;
-  struct idngram_node *next;
-};
-
-struct idngram_hash_table {
-  int size;
-  struct idngram_node **chain;
-};
-
-wordid_t index2(struct idngram_hash_table *vocab, char *word);
-
-void add_to_idngram_hashtable( struct idngram_hash_table *table,
-			       unsigned long position,
-			       char *vocab_item,
-			       wordid_t ind);
-
-int idngram_hash( char *key, int M );
+wordid_t index2(struct hash_table *vocab, char *word);
 
-void new_idngram_hashtable( struct idngram_hash_table *table, int M );
+/* Add a word with the given id, unless it is already there */
+void add_to_hashtable( struct hash_table *table,
+		       char *vocab_item,
+		       wordid_t ind);
 
 #endif
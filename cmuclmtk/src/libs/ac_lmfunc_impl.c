@@ -34,6 +34,12 @@
  *
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <ctype.h>
+
 #include "ac_lmfunc_impl.h"
 #include "ac_hash.h"
 #include "ac_parsetext.h"
@@ -198,8 +204,7 @@ int wfreq2vocab_impl(FILE* ifp, FILE* ofp, int cutoff, int vocab_size, int num_r
 
 int read_vocab(char* vocab_filename, 
 	       int verbosity,
-	       struct idngram_hash_table* vocabulary,
-	       int M
+	       struct hash_table* vocabulary
 	       )
 {
   FILE *vocab_file;
@@ -216,20 +221,14 @@ int read_vocab(char* vocab_filename,
     if (strncmp(temp_word,"##",2)==0) continue;
     sscanf (temp_word, "%s ",temp_word2);
 
-    /*    printf("hey hey %s %d\n ", temp_word2, idngram_hash(temp_word2,M));*/
-
     /* Check for repeated words in the vocabulary */    
     if (index2(vocabulary,temp_word2) != 0)
       warn_on_repeated_words(temp_word2);
 
     warn_on_wrong_vocab_comments(temp_word);
     vocab_size++;
-    /*    printf("%s %d\n ", temp_word2, idngram_hash(temp_word2,M));*/
 
-    add_to_idngram_hashtable(vocabulary,idngram_hash(temp_word2,M),temp_word2,vocab_size);
-    if(vocab_size == M){
-      quit(-1, "Number of entries reached the size of the hash.  Run the program again with a larger has size -hash \n");
-    }
+    add_to_hashtable(vocabulary,temp_word2,vocab_size);
   }
 
   if (vocab_size > MAX_VOCAB_SIZE)    
@@ -300,11 +299,294 @@ int get_word( FILE *fp , char *word ) {
   return(rt_val);
 }
 
-/*
-  @return number_of_tempfiles
- */
+/* Write one record of a temporary file: the n word ids followed by the
+   count.  Temporary files never leave this machine, so they are written
+   in native byte order, without the swapping rr_fwrite() does. */
+void write_temp_ngram(FILE *fp, wordid_t *ngram, int count, int n)
+{
+  if (fwrite(ngram,sizeof(wordid_t),n,fp) != (size_t) n ||
+      fwrite(&count,sizeof(int),1,fp) != 1)
+    quit(-1,"Write error encountered while writing temporary n-gram file.\n");
+}
+
+/* Read the next record written by write_temp_ngram().  Returns 0 at
+   the end of the file. */
+static int read_temp_ngram(FILE *fp, wordid_t *ngram, int *count, int n)
+{
+  size_t n_read;
+
+  n_read = fread(ngram,sizeof(wordid_t),n,fp);
+  if (n_read == 0 && feof(fp))
+    return 0;
+  if (n_read != (size_t) n || fread(count,sizeof(int),1,fp) != 1)
+    quit(-1,"Error : Temporary files corrupted, incomplete n-gram found.\n");
+  return 1;
+}
+
+static int ngram_cmp(const wordid_t *ngram1, const wordid_t *ngram2, int n)
+{
+  int i;
+
+  for (i=0;i<n;i++) {
+    if (ngram1[i] != ngram2[i])
+      return ngram1[i] < ngram2[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+/* Restore the heap property below heap[i], where heap holds indices
+   into head, the current n-gram of each sorted source. */
+static void ngram_heap_sift(int *heap, int n_heap, int i,
+			    wordid_t **head, int n)
+{
+  int top, child;
+
+  top = heap[i];
+  while ((child = 2*i+1) < n_heap) {
+    if (child+1 < n_heap &&
+	ngram_cmp(head[heap[child+1]],head[heap[child]],n) < 0)
+      child++;
+    if (ngram_cmp(head[heap[child]],head[top],n) >= 0)
+      break;
+    heap[i] = heap[child];
+    i = child;
+  }
+  heap[i] = top;
+}
+
+static void ngram_heap_init(int *heap, int n_heap, wordid_t **head, int n)
+{
+  int i;
+
+  for (i=n_heap/2-1;i>=0;i--)
+    ngram_heap_sift(heap,n_heap,i,head,n);
+}
+
+/* Start Implementation of text2idngram */
+
+#define TEXT_CHUNK_SIZE (2*1024*1024)
+#define TEMP_FILE_BUFFER_SIZE (1024*1024)
+
+typedef struct {
+  char *text;
+  size_t len;
+  struct hash_table *vocabulary;
+  wordid_t *ids;
+  size_t n_ids;
+} token_job_t;
+
+typedef struct {
+  FILE *fp;
+  flag eof;
+  char *text;
+  size_t n_text;	/* Bytes not yet split into words */
+  token_job_t *job;
+  int n_jobs;
+  int cur_job;
+  size_t cur_id;
+} word_reader_t;
+
+typedef struct {
+  wordid_t *rows;
+  size_t n_rows;
+} sort_job_t;
+
+/* Split a stretch of text into words and look them up.  Words longer
+   than MAX_WORD_LENGTH-1 are split, as get_word() would. */
+static void *tokenize_text(void *arg)
+{
+  token_job_t *job = (token_job_t *) arg;
+  char word[MAX_WORD_LENGTH];
+  size_t i, len;
+
+  job->n_ids = 0;
+  i = 0;
+  while (i < job->len) {
+    if (isspace((unsigned char) job->text[i])) {
+      i++;
+      continue;
+    }
+    for (len=0; i < job->len && len < MAX_WORD_LENGTH-1 &&
+	   !isspace((unsigned char) job->text[i]); i++, len++)
+      word[len] = job->text[i];
+    word[len] = '\0';
+    job->ids[job->n_ids++] = index2(job->vocabulary,word);
+  }
+  return NULL;
+}
+
+static void word_reader_init(word_reader_t *r, FILE *fp,
+			     struct hash_table *vocabulary,
+			     int n_threads)
+{
+  int j;
+
+  r->fp = fp;
+  r->eof = 0;
+  r->text = rr_malloc(TEXT_CHUNK_SIZE);
+  r->n_text = 0;
+  r->n_jobs = n_threads;
+  r->job = (token_job_t *) rr_calloc(n_threads,sizeof(token_job_t));
+  for (j=0;j<n_threads;j++) {
+    r->job[j].vocabulary = vocabulary;
+    r->job[j].ids = (wordid_t *) rr_malloc(sizeof(wordid_t)*
+					   (TEXT_CHUNK_SIZE/2+1));
+  }
+  r->cur_job = r->n_jobs;
+  r->cur_id = 0;
+}
+
+static void word_reader_free(word_reader_t *r)
+{
+  int j;
+
+  for (j=0;j<r->n_jobs;j++)
+    free(r->job[j].ids);
+  free(r->job);
+  free(r->text);
+}
+
+/* Read the next chunk of text and split it between the threads at
+   whitespace.  Returns 0 at the end of the input. */
+static int word_reader_fill(word_reader_t *r)
+{
+  size_t end, start, stop;
+  int j;
+
+  if (!r->eof) {
+    r->n_text += fread(r->text+r->n_text,1,TEXT_CHUNK_SIZE-r->n_text,r->fp);
+    if (ferror(r->fp))
+      quit(-1,"Error reading file");
+    r->eof = feof(r->fp);
+  }
+  if (r->eof && r->n_text == 0)
+    return 0;
+
+  /* Hold the last partial word over for the next chunk.  A chunk with
+     no whitespace at all is split where get_word() would split it. */
+  end = r->n_text;
+  if (!r->eof) {
+    while (end > 0 && !isspace((unsigned char) r->text[end-1]))
+      end--;
+    if (end == 0)
+      end = r->n_text - r->n_text % (MAX_WORD_LENGTH-1);
+  }
+
+  start = 0;
+  for (j=0;j<r->n_jobs;j++) {
+    stop = (j == r->n_jobs-1) ? end : end / r->n_jobs * (j+1);
+    if (stop < start)
+      stop = start;
+    while (stop < end && !isspace((unsigned char) r->text[stop]))
+      stop++;
+    r->job[j].text = r->text+start;
+    r->job[j].len = stop-start;
+    start = stop;
+  }
+  run_jobs(tokenize_text,r->job,sizeof(token_job_t),r->n_jobs);
+
+  memmove(r->text,r->text+end,r->n_text-end);
+  r->n_text -= end;
+  r->cur_job = 0;
+  r->cur_id = 0;
+  return 1;
+}
+
+static int next_word_id(word_reader_t *r, wordid_t *id)
+{
+  for (;;) {
+    if (r->cur_job < r->n_jobs) {
+      if (r->cur_id < r->job[r->cur_job].n_ids) {
+	*id = r->job[r->cur_job].ids[r->cur_id++];
+	return 1;
+      }
+      r->cur_job++;
+      r->cur_id = 0;
+    }
+    else if (!word_reader_fill(r))
+      return 0;
+  }
+}
+
+static void *sort_slice(void *arg)
+{
+  sort_job_t *job = (sort_job_t *) arg;
+
+  qsort((void*) job->rows,job->n_rows,ng*sizeof(wordid_t),compare_ngrams);
+  return NULL;
+}
+
+/* Sort the first n_rows n-grams of the buffer in up to n_threads
+   slices.  Returns the number of slices. */
+static int sort_buffer(wordid_t *buffer, size_t n_rows, unsigned int n,
+		       sort_job_t *slice, int n_threads)
+{
+  size_t start, end;
+  int j, n_slices;
+
+  n_slices = n_rows < (size_t) n_threads ? (int) n_rows : n_threads;
+  for (j=0;j<n_slices;j++) {
+    start = n_rows*j/n_slices;
+    end = n_rows*(j+1)/n_slices;
+    slice[j].rows = buffer+start*n;
+    slice[j].n_rows = end-start;
+  }
+  run_jobs(sort_slice,slice,sizeof(sort_job_t),n_slices);
+  return n_slices;
+}
+
+/* Merge the sorted slices, writing each distinct n-gram once with its
+   count. */
+static void write_sorted_slices(FILE *fp, sort_job_t *slice, int n_slices,
+				unsigned int n)
+{
+  wordid_t **head;
+  size_t *left;
+  int *heap;
+  int n_heap, j, count;
+  wordid_t *run;
+
+  head = (wordid_t **) rr_malloc(sizeof(wordid_t *)*n_slices);
+  left = (size_t *) rr_malloc(sizeof(size_t)*n_slices);
+  heap = (int *) rr_malloc(sizeof(int)*n_slices);
+  n_heap = 0;
+  for (j=0;j<n_slices;j++) {
+    head[j] = slice[j].rows;
+    left[j] = slice[j].n_rows;
+    if (left[j] > 0)
+      heap[n_heap++] = j;
+  }
+  ngram_heap_init(heap,n_heap,head,n);
+
+  run = NULL;
+  count = 0;
+  while (n_heap > 0) {
+    j = heap[0];
+    if (run != NULL && !ngram_cmp(run,head[j],n))
+      count++;
+    else {
+      if (run != NULL)
+	write_temp_ngram(fp,run,count,n);
+      run = head[j];
+      count = 1;
+    }
+    if (--left[j] > 0)
+      head[j] += n;
+    else
+      heap[0] = heap[--n_heap];
+    if (n_heap > 0)
+      ngram_heap_sift(heap,n_heap,0,head,n);
+  }
+  if (run != NULL)
+    write_temp_ngram(fp,run,count,n);
+
+  free(heap);
+  free(left);
+  free(head);
+}
+
 int  read_txt2ngram_buffer(FILE* infp, 
-			   struct idngram_hash_table *vocabulary, 
+			   struct hash_table *vocabulary, 
 			   int32 verbosity,
 			   wordid_t *buffer,
 			   int buffer_size,
@@ -314,132 +596,106 @@ int  read_txt2ngram_buffer(FILE* infp,
 			   FILE* temp_file
 			   )
 {
-  /* Read text into buffer */
-  char temp_word[MAX_WORD_LENGTH];
+  return read_txt2ngram_buffer_mt(infp,vocabulary,verbosity,buffer,
+				  buffer_size,n,temp_file_root,temp_file_ext,
+				  temp_file,1);
+}
+
+/*
+  @return number_of_tempfiles
+ */
+int  read_txt2ngram_buffer_mt(FILE* infp, 
+			      struct hash_table *vocabulary, 
+			      int32 verbosity,
+			      wordid_t *buffer,
+			      int buffer_size,
+			      unsigned int n,
+			      char* temp_file_root,
+			      char* temp_file_ext,
+			      FILE* temp_file,
+			      int n_threads
+			      )
+{
+  char temp_string[1000];
+  word_reader_t reader;
+  sort_job_t *slice;
+  wordid_t word_index;
   int position_in_buffer;
   int number_of_tempfiles;
-  unsigned int i,j;
-  wordid_t *placeholder;
-  wordid_t *temp_ngram;
-  int temp_count;
-
-#if 1
-  int tmpval;
-#endif
+  int n_slices;
+  flag finished;
+  unsigned int i;
 
-  temp_ngram  = (wordid_t *) rr_malloc(sizeof(wordid_t)*n);
-  placeholder = (wordid_t *) rr_malloc(sizeof(wordid_t)*n);
+  if (n_threads < 1)
+    n_threads = 1;
 
   ng=n;
 
-  position_in_buffer = 0;
+  word_reader_init(&reader,infp,vocabulary,n_threads);
+  slice = (sort_job_t *) rr_malloc(sizeof(sort_job_t)*n_threads);
   number_of_tempfiles = 0;
 
-  //tk: looks like things may croak if the corpus has less than n words
-  //not that such a corpus would be useful anyway
-  for (i=0;i<=n-1;i++) {
-    get_word(infp,temp_word);
-    /*
-        fprintf(stderr,"%s \n",temp_word);
-	fprintf(stderr,"%d \n",index2(vocabulary,temp_word));
-        fflush(stderr);
-    */
-    add_to_buffer(index2(vocabulary,temp_word),0,i,buffer);
+  /* Read in the first n-gram */
+  finished = 0;
+  for (i=0;i<=n-1 && !finished;i++) {
+    if (next_word_id(&reader,&word_index))
+      add_to_buffer(word_index,0,i,buffer);
+    else
+      finished = 1;
   }
 
-  while (!rr_feof(infp)) {
-    /* Fill up the buffer */
+  while (!finished) {
+    /* Fill up the buffer.  Each new word completes the n-gram in the
+       row after the last, and the final row is held over for the next
+       buffer unless the text has run out. */
     pc_message(verbosity,2,"Reading text into the n-gram buffer...\n");
     pc_message(verbosity,2,"20,000 n-grams processed for each \".\", 1,000,000 for each line.\n");
 
-    while ((position_in_buffer<buffer_size) && (!rr_feof(infp))) {
+    position_in_buffer = 0;
+    while (position_in_buffer<buffer_size) {
+      if (!next_word_id(&reader,&word_index)) {
+	finished = 1;
+	break;
+      }
       position_in_buffer++;
       show_idngram_nlines(position_in_buffer,verbosity);
 
       for (i=1;i<=n-1;i++) 
 	add_to_buffer(buffer_contents(position_in_buffer-1,i,buffer),
 		      position_in_buffer,i-1,buffer);
-      
-      if (get_word(infp,temp_word) == 1) {
-      /*
-	fprintf(stderr,"%s \n",temp_word);
-	fprintf(stderr,"%d \n",index2(vocabulary,temp_word));
-	fflush(stderr);
-      */
-	add_to_buffer(index2(vocabulary,temp_word),position_in_buffer,
-		      n-1,buffer);
-      }
+      add_to_buffer(word_index,position_in_buffer,n-1,buffer);
     }
 
-    for (i=0;i<=n-1;i++) 
-      placeholder[i] = buffer_contents(position_in_buffer,i,buffer);
-
     /* Sort buffer */
     
     pc_message(verbosity,2,"\nSorting n-grams...\n");    
-    
-    qsort((void*) buffer,(size_t) position_in_buffer,n*sizeof(wordid_t),compare_ngrams);
+
+    n_slices = sort_buffer(buffer,position_in_buffer+finished,n,
+			   slice,n_threads);
 
     /* Output the buffer to temporary BINARY file */    
     number_of_tempfiles++;
 
-    sprintf(temp_word,"%s/%hu%s",temp_file_root,
+    sprintf(temp_string,"%s/%hu%s",temp_file_root,
 	    number_of_tempfiles,temp_file_ext);
 
     pc_message(verbosity,2,"Writing sorted n-grams to temporary file %s\n",
-	       temp_word);
-
-    temp_file = rr_oopen(temp_word);
-
-    for (i=0;i<=n-1;i++) {
-      temp_ngram[i] = buffer_contents(0,i,buffer);
-#if MAX_VOCAB_SIZE < 65535
-      /* This check is well-meaning but completely useless since
-	 buffer_contents() can never return something greater than
-	 MAX_VOCAB_SIZE (dhuggins@cs, 2006-03) */
-      if (temp_ngram[i] > MAX_VOCAB_SIZE)
-	quit(-1,"Invalid trigram in buffer.\nAborting");
-#endif
-    }
-    temp_count = 1;
-
-    for (i=1;i<=position_in_buffer;i++) {
-
-      tmpval=compare_ngrams(temp_ngram,&buffer[i*n]);
-
-      /*      for(k=0;k<=n-1;k++){
-	fprintf(stderr, "tmpval: %d k %d, temp_ngram %d, &buffer[i*n] %d\n",tmpval, k, temp_ngram[k], (&buffer[i*n])[k]);
-	}*/
+	       temp_string);
 
-      if (!compare_ngrams(temp_ngram,&buffer[i*n])) 
-	temp_count++;
-      else {
-	/*	printf("Have been here?\n");*/
-	for (j=0;j<=n-1;j++) {
-	  rr_fwrite((char*) &temp_ngram[j],sizeof(wordid_t),1,
-		    temp_file,"temporary n-gram ids");
-	  temp_ngram[j] = buffer_contents(i,j,buffer);
-	}
-	rr_fwrite((char*)&temp_count,sizeof(int),1,temp_file,
-		  "temporary n-gram counts");
-
-	/*	for(j=0 ; j<=n-1;j++)
-	  fprintf(stderr,"%d ",temp_ngram[j]);
-	  fprintf(stderr,"%d\n",temp_count);*/
-
-	temp_count = 1;
-      }
-    }
-    
+    temp_file = rr_oopen(temp_string);
+    setvbuf(temp_file,NULL,_IOFBF,TEMP_FILE_BUFFER_SIZE);
+    write_sorted_slices(temp_file,slice,n_slices,n);
     rr_oclose(temp_file);
 
-    for (i=0;i<=n-1;i++) 
-      add_to_buffer(placeholder[i],0,i,buffer);
-
-    position_in_buffer = 0;
-
+    if (!finished) {
+      for (i=0;i<=n-1;i++) 
+	add_to_buffer(buffer_contents(position_in_buffer,i,buffer),0,i,buffer);
+    }
   }
 
+  free(slice);
+  word_reader_free(&reader);
+
   return number_of_tempfiles;
 }
 
@@ -713,6 +969,87 @@ int compare_ngrams3(const void *ngram1,
 
 
 
+typedef struct {
+  int n_files;
+  FILE **fp;
+  char **filename;
+  wordid_t **head;	/* Current n-gram of each file */
+  int *count;
+  int *heap;
+  int n_heap;
+} temp_merge_t;
+
+static void temp_merge_open(temp_merge_t *m,
+			    int start_file,
+			    int end_file,
+			    char *temp_file_root,
+			    char *temp_file_ext)
+{
+  char temp_string[1000];
+  int i;
+
+  m->n_files = end_file-start_file+1;
+  m->fp = (FILE **) rr_malloc(sizeof(FILE *)*m->n_files);
+  m->filename = (char **) rr_malloc(sizeof(char *)*m->n_files);
+  m->head = (wordid_t **) rr_malloc(sizeof(wordid_t *)*m->n_files);
+  m->count = (int *) rr_malloc(sizeof(int)*m->n_files);
+  m->heap = (int *) rr_malloc(sizeof(int)*m->n_files);
+  m->n_heap = 0;
+
+  for (i=0;i<m->n_files;i++) {
+    sprintf(temp_string,"%s/%hu%s",temp_file_root,
+	    i+start_file,temp_file_ext);
+    m->filename[i] = salloc(temp_string);
+    m->fp[i] = rr_iopen(m->filename[i]);
+    setvbuf(m->fp[i],NULL,_IOFBF,TEMP_FILE_BUFFER_SIZE);
+    m->head[i] = (wordid_t *) rr_malloc(sizeof(wordid_t)*n);
+    if (read_temp_ngram(m->fp[i],m->head[i],&m->count[i],n))
+      m->heap[m->n_heap++] = i;
+  }
+  ngram_heap_init(m->heap,m->n_heap,m->head,n);
+}
+
+/* Fetch the smallest n-gram left in any of the files, with its count
+   summed over all of them.  Returns 0 once they are all finished. */
+static int temp_merge_next(temp_merge_t *m, wordid_t *ngram, int *count)
+{
+  int i;
+
+  if (m->n_heap == 0)
+    return 0;
+
+  memcpy(ngram,m->head[m->heap[0]],sizeof(wordid_t)*n);
+  *count = 0;
+  do {
+    i = m->heap[0];
+    *count += m->count[i];
+    if (!read_temp_ngram(m->fp[i],m->head[i],&m->count[i],n))
+      m->heap[0] = m->heap[--m->n_heap];
+    if (m->n_heap > 0)
+      ngram_heap_sift(m->heap,m->n_heap,0,m->head,n);
+  } while (m->n_heap > 0 && !ngram_cmp(m->head[m->heap[0]],ngram,n));
+
+  return 1;
+}
+
+/* Close and remove the merged files. */
+static void temp_merge_close(temp_merge_t *m)
+{
+  int i;
+
+  for (i=0;i<m->n_files;i++) {
+    rr_iclose(m->fp[i]);
+    remove(m->filename[i]);
+    free(m->filename[i]);
+    free(m->head[i]);
+  }
+  free(m->heap);
+  free(m->count);
+  free(m->head);
+  free(m->filename);
+  free(m->fp);
+}
+
 void merge_idngramfiles (int start_file, 
 		      int end_file, 
 		      char *temp_file_root,
@@ -724,19 +1061,12 @@ void merge_idngramfiles (int start_file,
 		      int n_order) {
   FILE *new_temp_file;
   char temp_string[1000];
-  char *new_temp_filename;
-  
-  FILE **temp_file;
-  char **temp_filename;
-  wordid_t **current_ngram;
+  temp_merge_t merge;
   wordid_t *smallest_ngram;
   wordid_t *previous_ngram;
 
-  int *current_ngram_count;
-  flag *finished;
-  flag all_finished;
   int temp_count;
-  int i,j;
+  int i;
   flag first_ngram;
   fof_t **fof_array;
   ngram_sz_t *num_kgrams;
@@ -746,24 +1076,12 @@ void merge_idngramfiles (int start_file,
   n = n_order;
   
   pos_of_novelty = n; /* Simply for warning-free compilation */
+  temp_count = 0;
   num_kgrams = (ngram_sz_t *) rr_calloc(n-1,sizeof(ngram_sz_t));
   ng_count = (int *) rr_calloc(n-1,sizeof(int));
   first_ngram = 1;
   
   previous_ngram = (wordid_t *) rr_calloc(n,sizeof(wordid_t));
-  temp_file = (FILE **) rr_malloc(sizeof(FILE *) * (end_file-start_file+1));
-  temp_filename = (char **) rr_malloc(sizeof(char *) * 
-				      (end_file-start_file+1));
-
-  /* should change to 2d array*/
-  current_ngram = (wordid_t **) rr_malloc(sizeof(wordid_t *) * 
-						(end_file-start_file+1));
-  for (i=0;i<=end_file-start_file;i++) 
-    current_ngram[i] = (wordid_t *) rr_malloc(sizeof(wordid_t)*n);
-
-  current_ngram_count = (int *) rr_malloc(sizeof(int)*(end_file-start_file+1));
-
-  finished = (flag *) rr_malloc(sizeof(flag)*(end_file-start_file+1));
   smallest_ngram = (wordid_t *) rr_malloc(sizeof(wordid_t)*n);
 
   /* should change to 2d array*/
@@ -771,165 +1089,92 @@ void merge_idngramfiles (int start_file,
   for (i=0;i<=n-2;i++) 
     fof_array[i] = (fof_t *) rr_calloc(fof_size+1,sizeof(fof_t));
 
-  if (end_file-start_file+1 > max_files) {
+  /* With more files than may be open at once, merge the oldest ones
+     into a new temporary file until few enough are left. */
+  if (max_files < 2)
+    max_files = 2;
+  while (end_file-start_file+1 > max_files) {
     sprintf(temp_string,"%s/%hu%s",temp_file_root,
 	    end_file+1,temp_file_ext);
-    new_temp_filename = salloc(temp_string);
-    new_temp_file = rr_oopen(new_temp_filename);
-    merge_tempfiles(start_file,start_file+max_files-1,
-		    temp_file_root,temp_file_ext,max_files,
-		    new_temp_file,write_ascii,0);
-    merge_tempfiles(start_file+max_files,end_file+1,
-		    temp_file_root,temp_file_ext,max_files,
-		    outfile,write_ascii,0);
-  }else {
-
-    /* Open all the temp files for reading */
-    for (i=0;i<=end_file-start_file;i++) {
-      sprintf(temp_string,"%s/%hu%s",temp_file_root,
-	      i+start_file,temp_file_ext);
-      temp_filename[i] = salloc(temp_string);
-      temp_file[i] = rr_iopen(temp_filename[i]);
-    }
-    
-    /* Now go through the files simultaneously, and write out the appropriate
-       ngram counts to the output file. */
-
-    for (i=end_file-start_file;i>=0;i--) {
-      finished[i] = 0;
-      if (!rr_feof(temp_file[i])) {
-	for (j=0;j<=n-1;j++) {
-	  rr_fread((char*) &current_ngram[i][j], sizeof(wordid_t),1,
-		   temp_file[i],"temporary n-gram ids",0);
-	}    
-	rr_fread((char*) &current_ngram_count[i], sizeof(int),1,
-		 temp_file[i],"temporary n-gram counts",0);
-      }
-    }
-    
-    all_finished = 0;
-
-    while (!all_finished) {
+    new_temp_file = rr_oopen(temp_string);
+    setvbuf(new_temp_file,NULL,_IOFBF,TEMP_FILE_BUFFER_SIZE);
+    temp_merge_open(&merge,start_file,start_file+max_files-1,
+		    temp_file_root,temp_file_ext);
+    while (temp_merge_next(&merge,smallest_ngram,&temp_count))
+      write_temp_ngram(new_temp_file,smallest_ngram,temp_count,n);
+    temp_merge_close(&merge);
+    rr_oclose(new_temp_file);
+    start_file += max_files;
+    end_file++;
+  }
 
-      /* Find the smallest current ngram */
-      for (i=0;i<=n-1;i++) 
-	smallest_ngram[i] = MAX_WORDID;
+  /* Now go through the files simultaneously, and write out the
+     appropriate ngram counts to the output file. */
+  temp_merge_open(&merge,start_file,end_file,temp_file_root,temp_file_ext);
 
-      for (i=0;i<=end_file-start_file;i++) {
-	if (!finished[i]) {
-	  if (compare_ngrams3(smallest_ngram,current_ngram[i]) < 0) {
-	    for (j=0;j<n;j++)
-	      smallest_ngram[j] = current_ngram[i][j];
-	  }
-	}
-      }
+  while (temp_merge_next(&merge,smallest_ngram,&temp_count)) {
 
-#if MAX_VOCAB_SIZE < 65535
-      /* This check is well-meaning but completely useless since
-	 smallest_ngram[i] by definition cannot contain any value
-	 greater than MAX_VOCAB_SIZE (dhuggins@cs, 2006-03) */
+    if (write_ascii) {
       for (i=0;i<=n-1;i++) {
-	if (smallest_ngram[i] > MAX_VOCAB_SIZE) {
-	  quit(-1,"Error : Temporary files corrupted, invalid n-gram found.\n");
-	}
-      }
-#endif
-	  
-      /* For each of the files that are currently holding this ngram,
-	 add its count to the temporary count, and read in a new ngram
-	 from the files. */
-
-      temp_count = 0;
-
-      for (i=0;i<=end_file-start_file;i++) {
-	if (!finished[i]) {
-	  if (compare_ngrams3(smallest_ngram,current_ngram[i]) == 0) {
-	    temp_count = temp_count + current_ngram_count[i];
-	    if (!rr_feof(temp_file[i])) {
-	      for (j=0;j<=n-1;j++) {
-		rr_fread((char*) &current_ngram[i][j],sizeof(wordid_t),1,
-			 temp_file[i],"temporary n-gram ids",0);
-	      }
-	      rr_fread((char*)&current_ngram_count[i],sizeof(int),1,
-		       temp_file[i],"temporary n-gram count",0);
-	    }else {
-	      finished[i] = 1;
-	      all_finished = 1;
-	      for (j=0;j<=end_file-start_file;j++) {
-		if (!finished[j]) 
-		  all_finished = 0;
-	      }
-	    }
+
+	if (fprintf(outfile,"%d ",smallest_ngram[i]) < 0) 
+	  {
+	    quit(-1,"Write error encountered while attempting to merge temporary files.\nAborting, but keeping temporary files.\n");
 	  }
-	}
       }
-      
-      if (write_ascii) {
-	for (i=0;i<=n-1;i++) {
-
-	  if (fprintf(outfile,"%d ",smallest_ngram[i]) < 0) 
-	    {
-	      quit(-1,"Write error encountered while attempting to merge temporary files.\nAborting, but keeping temporary files.\n");
-	    }
-	}
-	if (fprintf(outfile,"%d\n",temp_count) < 0)  
-	  quit(-1,"Write error encountered while attempting to merge temporary files.\nAborting, but keeping temporary files.\n");
+      if (fprintf(outfile,"%d\n",temp_count) < 0)  
+	quit(-1,"Write error encountered while attempting to merge temporary files.\nAborting, but keeping temporary files.\n");
 
-      }else {
-	for (i=0;i<=n-1;i++) {
-	  rr_fwrite((char*)&smallest_ngram[i],sizeof(wordid_t),1,
-		    outfile,"n-gram ids");
-	}
-	rr_fwrite((char*)&temp_count,sizeof(count_t),1,outfile,"n-gram counts");		   
+    }else {
+      for (i=0;i<=n-1;i++) {
+	rr_fwrite((char*)&smallest_ngram[i],sizeof(wordid_t),1,
+		  outfile,"n-gram ids");
       }
+      rr_fwrite((char*)&temp_count,sizeof(count_t),1,outfile,"n-gram counts");		   
+    }
 
-      if (fof_size > 0 && n>1) { /* Add stuff to fof arrays */
+    if (fof_size > 0 && n>1) { /* Add stuff to fof arrays */
 	
-	/* Code from idngram2stats */	
-	pos_of_novelty = n;
-	for (i=0;i<=n-1;i++) {
-	  if (smallest_ngram[i] > previous_ngram[i]) {
-	    pos_of_novelty = i;
-	    i=n;
-	  }
+      /* Code from idngram2stats */	
+      pos_of_novelty = n;
+      for (i=0;i<=n-1;i++) {
+	if (smallest_ngram[i] > previous_ngram[i]) {
+	  pos_of_novelty = i;
+	  i=n;
 	}
+      }
 	  
-	/* Add new N-gram */
+      /* Add new N-gram */
 	  
-	num_kgrams[n-2]++;
-	if (temp_count <= fof_size)
-	  fof_array[n-2][temp_count]++;
-
-	if (!first_ngram) {
-	  for (i=n-2;i>=MAX(1,pos_of_novelty);i--) {
-	    num_kgrams[i-1]++;
-	    if (ng_count[i-1] <= fof_size) {
-	      fof_array[i-1][ng_count[i-1]]++;
-	    }
-	    ng_count[i-1] = temp_count;
-	  }
-	}else {
-	  for (i=n-2;i>=MAX(1,pos_of_novelty);i--) {
-	    ng_count[i-1] = temp_count;
+      num_kgrams[n-2]++;
+      if (temp_count <= fof_size)
+	fof_array[n-2][temp_count]++;
+
+      if (!first_ngram) {
+	for (i=n-2;i>=MAX(1,pos_of_novelty);i--) {
+	  num_kgrams[i-1]++;
+	  if (ng_count[i-1] <= fof_size) {
+	    fof_array[i-1][ng_count[i-1]]++;
 	  }
-	  first_ngram = 0;
+	  ng_count[i-1] = temp_count;
+	}
+      }else {
+	for (i=n-2;i>=MAX(1,pos_of_novelty);i--) {
+	  ng_count[i-1] = temp_count;
 	}
+	first_ngram = 0;
+      }
 	  
-	for (i=0;i<=pos_of_novelty-2;i++)
-	  ng_count[i] += temp_count;
+      for (i=0;i<=pos_of_novelty-2;i++)
+	ng_count[i] += temp_count;
 
-	for (i=0;i<=n-1;i++)
-	  previous_ngram[i]=smallest_ngram[i];
+      for (i=0;i<=n-1;i++)
+	previous_ngram[i]=smallest_ngram[i];
 
-      }
     }
-    
-    for (i=0;i<=end_file-start_file;i++) {
-      fclose(temp_file[i]);
-      remove(temp_filename[i]); 
-    }
-    
-  }    
+  }
+
+  temp_merge_close(&merge);
 
   if (fof_size > 0 && n>1) { /* Display fof arrays */
 
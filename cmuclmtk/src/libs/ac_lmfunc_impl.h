@@ -49,12 +49,11 @@ int wfreq2vocab_impl(FILE* ifp, FILE* ofp, int cutoff, int vocab_size, int num_r
 
 int read_vocab(char* vocab, 
 	       int verbosity,
-	       struct idngram_hash_table* vocabulary,
-	       int M
+	       struct hash_table* vocabulary
 	       );
 
 int  read_txt2ngram_buffer(FILE* infp, 
-			   struct idngram_hash_table *vocabulary, 
+			   struct hash_table *vocabulary, 
 			   int32 verbosity,
 			   wordid_t *buffer,
 			   int buffer_size,
@@ -64,6 +63,20 @@ int  read_txt2ngram_buffer(FILE* infp,
 			   FILE* temp_file
 			   );
 
+/* As read_txt2ngram_buffer(), looking words up and sorting each buffer
+   in n_threads threads. */
+int  read_txt2ngram_buffer_mt(FILE* infp, 
+			      struct hash_table *vocabulary, 
+			      int32 verbosity,
+			      wordid_t *buffer,
+			      int buffer_size,
+			      unsigned int n,
+			      char* temp_file_root,
+			      char* temp_file_ext,
+			      FILE* temp_file,
+			      int n_threads
+			      );
+
 int compare_ngrams(const void *ngram1,
 		   const void *ngram2
 		   );
@@ -80,6 +93,8 @@ void merge_tempfiles (int start_file,
 		      int verbosity);
 
 
+void write_temp_ngram(FILE *fp, wordid_t *ngram, int count, int n);
+
 void merge_idngramfiles (int start_file, 
 		      int end_file, 
 		      char *temp_file_root,
@@ -71,6 +71,7 @@ void *rr_oclose(FILE *fp);
 void parse_line(char *line, int mwords, int canonize,
     char **pword_begin, char **pword_end, int *p_nwords, int *p_overflow);
 int quit(int rc, char *msg, ...);
+void run_jobs(void *(*fn)(void *), void *jobs, size_t job_size, int n_jobs);
 
 typedef char   Boolean;
 typedef int    cluster_t;
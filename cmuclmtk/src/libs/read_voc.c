@@ -45,8 +45,74 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include "general.h"
 #include "sih.h"
+#include "ac_parsetext.h"
+
+/* Read a word list in one go, and point both the hash table and the
+   array (if wanted) at the words in place, so each word is neither
+   read twice nor allocated on its own. */
+static void read_wlist_block(char *wlist_filename, int verbosity,
+			     sih_t *p_word_id_ht, char ***p_wlist,
+			     vocab_sz_t *p_n_wlist)
+{
+  static char rname[]="read_wlist_block";
+  FILE *wlist_fp = rr_iopen(wlist_filename);
+  char **wlist = NULL;
+  char *block, *line, *end, *word;
+  size_t size, len, n_read;
+  vocab_sz_t n_lines, entry_no;
+
+  /* slurp the file */
+  size = 1 << 20;
+  len = 0;
+  block = (char *) rr_malloc(size);
+  while ((n_read = fread(block+len,1,size-len-1,wlist_fp)) > 0) {
+    len += n_read;
+    if (len == size-1) {
+      size *= 2;
+      if ((block = (char *) realloc(block,size)) == NULL)
+	quit(-1,"%s: could not allocate %lu bytes for %s\n",
+	     rname,(unsigned long) size,wlist_filename);
+    }
+  }
+  rr_iclose(wlist_fp);
+  block[len] = '\0';
+  if (len > 0 && block[len-1] != '\n')
+    quit(-1,"%s: no newline at end of %s\n",rname,wlist_filename);
+
+  n_lines = 0;
+  for (line = block; line < block+len; line++)
+    if (*line == '\n') n_lines++;
+  if (p_wlist != NULL)
+    wlist = (char **) rr_malloc((n_lines+1)*sizeof(char *));
+
+  entry_no = 0;
+  for (line = block; line < block+len; line = end+1) {
+    end = strchr(line,'\n');
+    *end = '\0';
+    if (strncmp(line,"##",2) == 0) continue;
+    warn_on_wrong_vocab_comments(line);
+
+    /* the first word on the line */
+    for (word = line; *word == ' ' || *word == '\t' || *word == '\r'; word++);
+    if (*word == '\0') continue;
+    word[strcspn(word," \t\r")] = '\0';
+
+    entry_no++;
+    sih_add(p_word_id_ht, word, entry_no);
+    if (wlist != NULL)
+      wlist[entry_no] = word;
+  }
+
+  if (verbosity)
+     fprintf(stderr,"%s: a list of %d words was read from \"%s\".\n",
+	     rname,(int) entry_no,wlist_filename);
+  if (p_wlist != NULL)
+    *p_wlist = wlist;
+  *p_n_wlist = entry_no;
+}
 
 /**
   If the file extension is "vocab_ht", then read value from file. 
@@ -77,11 +143,9 @@ void read_voc(char *filename,
 	*p_vocab[0] = salloc("<UNK>");
      }
   }else {					     /* file == vocab(ascii) */
-     read_wlist_into_siht(filename, verbosity, p_vocab_ht, &vocab_size);
-     if (p_vocab!=NULL) {
-        read_wlist_into_array(filename, verbosity, p_vocab, &vocab_size);
+     read_wlist_block(filename, verbosity, p_vocab_ht, p_vocab, &vocab_size);
+     if (p_vocab!=NULL)
         *p_vocab[0] = salloc("<UNK>");
-     }
   }
 
   if (p_vocab_size)
@@ -56,7 +56,7 @@
 #include <string.h>
 #include "general.h"
 #include "compat.h" // in win32
-char  RRi_is_Z[100];
+char  RRi_is_Z[4096];
 
 FILE *rr_iopen(char *path)
 {
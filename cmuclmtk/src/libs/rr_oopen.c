@@ -55,7 +55,7 @@
 #include <string.h>
 #include "general.h"
 
-char  RRo_is_Z[100];
+char  RRo_is_Z[4096];
 
 FILE *rr_oopen(char *path)
 {
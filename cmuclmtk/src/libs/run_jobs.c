@@ -0,0 +1,78 @@
+/* ====================================================================
+ * Copyright (c) 2026 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "general.h"
+
+/* Run fn on each of n_jobs job structures, job_size bytes apart.  The
+   first runs in the calling thread and the others in threads of their
+   own, where threads are available. */
+void run_jobs(void *(*fn)(void *), void *jobs, size_t job_size, int n_jobs)
+{
+  int j;
+#ifdef HAVE_PTHREAD
+  pthread_t *thread;
+  Boolean *started;
+
+  if (n_jobs > 1) {
+    thread = (pthread_t *) rr_malloc(sizeof(pthread_t)*n_jobs);
+    started = (Boolean *) rr_calloc(n_jobs,sizeof(Boolean));
+    for (j=1;j<n_jobs;j++)
+      started[j] = !pthread_create(&thread[j],NULL,fn,
+				   (char *) jobs + j*job_size);
+    fn(jobs);
+    for (j=1;j<n_jobs;j++) {
+      if (started[j])
+	pthread_join(thread[j],NULL);
+      else
+	fn((char *) jobs + j*job_size);
+    }
+    free(started);
+    free(thread);
+    return;
+  }
+#endif
+  for (j=0;j<n_jobs;j++)
+    fn((char *) jobs + j*job_size);
+}
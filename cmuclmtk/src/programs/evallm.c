@@ -61,6 +61,143 @@ void help_message(){
    fprintf(stderr,"evallm : Evaluate a language model.\n");
    fprintf(stderr,"Usage : evallm [ -binary .binlm | \n");
    fprintf(stderr,"                 -arpa .arpa [ -context .ccs ] ]\n");
+   fprintf(stderr,"   or : evallm -lms .lmlist -texts .textlist\n");
+   fprintf(stderr,"               [ -nthreads 1 ]\n");
+   fprintf(stderr,"               [ -backoff_from_unk_inc | -backoff_from_unk_exc ]\n");
+   fprintf(stderr,"               [ -backoff_from_ccs_inc | -backoff_from_ccs_exc ]\n");
+   fprintf(stderr,"               [ -backoff_from_list .fblist ]\n");
+   fprintf(stderr,"               [ -include_unks ]\n");
+}
+
+/* Mark the context cues listed in ccs_filename in an ARPA model */
+static void read_context_cues(arpa_lm_t *arpa_ng, char *ccs_filename)
+{
+  char wlist_entry[1024];
+  char current_cc[200];
+  vocab_sz_t current_cc_id;
+  FILE *context_cues_fp;
+
+  arpa_ng->context_cue = 
+    (flag *) rr_calloc(arpa_ng->table_sizes[0],sizeof(flag));    
+  arpa_ng->no_of_ccs = 0;
+  if (strcmp(ccs_filename,"")) {
+    context_cues_fp = rr_iopen(ccs_filename);
+    while (fgets (wlist_entry, sizeof (wlist_entry),context_cues_fp)) {
+      if (strncmp(wlist_entry,"##",2)==0) continue;
+      sscanf (wlist_entry, "%s ",current_cc);
+
+      warn_on_wrong_vocab_comments(wlist_entry);
+	
+      if (sih_lookup(arpa_ng->vocab_ht,current_cc,&current_cc_id) == 0)
+	quit(-1,"Error : %s in the context cues file does not appear in the vocabulary.\n",current_cc);
+	
+      arpa_ng->context_cue[current_cc_id] = 1;
+      arpa_ng->no_of_ccs++;
+      fprintf(stderr,"Context cue word : %s id = %lld\n",current_cc,current_cc_id);
+    }
+    rr_iclose(context_cues_fp);
+  }
+}
+
+/* Compute the perplexity of each of a list of language models on each
+   of a list of texts, and write them as a table to stdout.  Each line
+   of the model list is either "binary .binlm" or "arpa .arpa [ .ccs ]",
+   and each line of the text list is a file name. */
+static void batch_evallm(int *argc, char **argv, char *lm_list_filename)
+{
+  batch_lm_t *lms;
+  char **text_filenames;
+  char line[3000];
+  char type[1000], lm_filename[1000], ccs_filename[1000];
+  char *text_list_filename;
+  char *fb_list_filename;
+  flag backoff_from_unk_inc;
+  flag backoff_from_unk_exc;
+  flag backoff_from_ccs_inc;
+  flag backoff_from_ccs_exc;
+  flag include_unks;
+  int n_lms, n_texts, max_lms, max_texts, n_threads, n_fields;
+  FILE *fp;
+
+  text_list_filename = salloc(pc_stringarg(argc, argv,"-texts",""));
+  n_threads = pc_intarg(argc, argv,"-nthreads",1);
+  backoff_from_unk_inc = pc_flagarg(argc,argv,"-backoff_from_unk_inc");
+  backoff_from_ccs_inc = pc_flagarg(argc,argv,"-backoff_from_ccs_inc");
+  backoff_from_unk_exc = pc_flagarg(argc,argv,"-backoff_from_unk_exc");
+  backoff_from_ccs_exc = pc_flagarg(argc,argv,"-backoff_from_ccs_exc");
+  include_unks = pc_flagarg(argc,argv,"-include_unks");
+  fb_list_filename = salloc(pc_stringarg(argc,argv,"-backoff_from_list",""));
+
+  pc_report_unk_args(argc,argv,2);
+
+  if (!strcmp(text_list_filename,""))
+    quit(-1,"Error : Must specify a list of texts with -texts.\n");
+  if (n_threads < 1)
+    quit(-1,"Error : -nthreads must be at least 1.\n");
+  if (backoff_from_unk_inc && backoff_from_unk_exc)
+    quit(-1,"Error : Cannot specify both -backoff_from_unk_exc and -backoff_from_unk_inc.\n");
+  if (backoff_from_ccs_inc && backoff_from_ccs_exc)
+    quit(-1,"Error : Cannot specify both -backoff_from_ccs_exc and -backoff_from_ccs_inc.\n");
+
+  max_lms = 16;
+  lms = (batch_lm_t *) rr_malloc(max_lms*sizeof(batch_lm_t));
+  n_lms = 0;
+  fp = rr_iopen(lm_list_filename);
+  while (fgets(line,sizeof(line),fp)) {
+    if (strncmp(line,"##",2) == 0) continue;
+    n_fields = sscanf(line,"%999s %999s %999s",type,lm_filename,ccs_filename);
+    if (n_fields <= 0) continue;
+    if (n_fields < 2 || (strcmp(type,"binary") && strcmp(type,"arpa")))
+      quit(-1,"Error : Bad line in %s : %s",lm_list_filename,line);
+    if (n_lms == max_lms) {
+      batch_lm_t *more = (batch_lm_t *) rr_malloc(2*max_lms*sizeof(batch_lm_t));
+      memcpy(more,lms,max_lms*sizeof(batch_lm_t));
+      free(lms);
+      lms = more;
+      max_lms *= 2;
+    }
+    lms[n_lms].filename = salloc(lm_filename);
+    lms[n_lms].arpa_lm = !strcmp(type,"arpa");
+    lms[n_lms].ng = NULL;
+    lms[n_lms].arpa_ng = NULL;
+    fprintf(stderr,"Reading in language model from file %s\n",lm_filename);
+    if (lms[n_lms].arpa_lm) {
+      lms[n_lms].arpa_ng = (arpa_lm_t *) rr_malloc(sizeof(arpa_lm_t));
+      load_arpa_lm(lms[n_lms].arpa_ng,lm_filename);
+      read_context_cues(lms[n_lms].arpa_ng,n_fields > 2 ? ccs_filename : "");
+    }else {
+      lms[n_lms].ng = (ng_t *) rr_malloc(sizeof(ng_t));
+      load_lm(lms[n_lms].ng,lm_filename);
+    }
+    n_lms++;
+  }
+  rr_iclose(fp);
+
+  max_texts = 16;
+  text_filenames = (char **) rr_malloc(max_texts*sizeof(char *));
+  n_texts = 0;
+  fp = rr_iopen(text_list_filename);
+  while (fgets(line,sizeof(line),fp)) {
+    if (strncmp(line,"##",2) == 0) continue;
+    if (sscanf(line,"%999s",lm_filename) != 1) continue;
+    if (n_texts == max_texts) {
+      char **more = (char **) rr_malloc(2*max_texts*sizeof(char *));
+      memcpy(more,text_filenames,max_texts*sizeof(char *));
+      free(text_filenames);
+      text_filenames = more;
+      max_texts *= 2;
+    }
+    text_filenames[n_texts++] = salloc(lm_filename);
+  }
+  rr_iclose(fp);
+
+  if (n_lms == 0 || n_texts == 0)
+    quit(-1,"Error : Need at least one language model and one text.\n");
+
+  batch_perplexity(lms,n_lms,text_filenames,n_texts,fb_list_filename,
+		   backoff_from_unk_inc,backoff_from_unk_exc,
+		   backoff_from_ccs_inc,backoff_from_ccs_exc,
+		   include_unks,n_threads,stdout);
 }
 
 void evallm_command_help_message()
@@ -150,10 +287,7 @@ int main (int argc, char **argv) {
   int generate_size;
   int random_seed;
   double log_base;
-  char wlist_entry[1024];
-  char current_cc[200];
-  vocab_sz_t current_cc_id;
-  FILE *context_cues_fp;
+  char *lm_list_filename;
   int n;
 
   /* Process command line */
@@ -162,11 +296,20 @@ int main (int argc, char **argv) {
 
   if (pc_flagarg(&argc, argv,"-help") || 
       argc == 1 || 
-      (strcmp(argv[1],"-binary") && strcmp(argv[1],"-arpa"))) {
+      (strcmp(argv[1],"-binary") && strcmp(argv[1],"-arpa") &&
+       strcmp(argv[1],"-lms"))) {
     help_message();
     exit(1);
   }
 
+  lm_list_filename = salloc(pc_stringarg(&argc, argv,"-lms",""));
+
+  if (strcmp(lm_list_filename,"")) {
+    batch_evallm(&argc,argv,lm_list_filename);
+    fprintf(stderr,"evallm : Done.\n");
+    exit(0);
+  }
+
   lm_filename_arpa = salloc(pc_stringarg(&argc, argv,"-arpa",""));
 
   if (strcmp(lm_filename_arpa,""))
@@ -212,28 +355,8 @@ int main (int argc, char **argv) {
     arpa_ng.n:
     ng.n;
 
-  if (arpa_lm) {
-    arpa_ng.context_cue = 
-      (flag *) rr_calloc(arpa_ng.table_sizes[0],sizeof(flag));    
-    arpa_ng.no_of_ccs = 0;
-    if (strcmp(ccs_filename,"")) {
-      context_cues_fp = rr_iopen(ccs_filename);
-      while (fgets (wlist_entry, sizeof (wlist_entry),context_cues_fp)) {
-	if (strncmp(wlist_entry,"##",2)==0) continue;
-	sscanf (wlist_entry, "%s ",current_cc);
-
-	warn_on_wrong_vocab_comments(wlist_entry);
-	
-	if (sih_lookup(arpa_ng.vocab_ht,current_cc,&current_cc_id) == 0)
-	  quit(-1,"Error : %s in the context cues file does not appear in the vocabulary.\n",current_cc);
-	
-	arpa_ng.context_cue[(unsigned short) current_cc_id] = 1;
-	arpa_ng.no_of_ccs++;
-	fprintf(stderr,"Context cue word : %s id = %lld\n",current_cc,current_cc_id);
-      }
-      rr_iclose(context_cues_fp);
-    }
-  }
+  if (arpa_lm)
+    read_context_cues(&arpa_ng,ccs_filename);
 
   /* Process commands */
   
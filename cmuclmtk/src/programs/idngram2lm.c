@@ -76,7 +76,8 @@ void help_message()
     fprintf(stderr,"Usage : \n");
     fprintf(stderr,"idngram2lm -idngram .idngram\n");
     fprintf(stderr,"           -vocab .vocab\n");
-    fprintf(stderr,"           -arpa .arpa | -binary .binlm\n");
+    fprintf(stderr,"           -arpa .arpa | -binary .binlm | -trie .lm.bin\n");
+    fprintf(stderr,"         [ -trie_quant 16/16,16 ]\n");
     fprintf(stderr,"         [ -context .ccs ]\n");
     fprintf(stderr,"         [ -calc_mem | -buffer 100 | -spec_num y ... z ]\n");
     fprintf(stderr,"         [ -vocab_type 1 ]\n");
@@ -137,11 +138,25 @@ ng_t * init_ng(
   ng->arpa_filename = salloc(pc_stringarg(argc, argv,"-arpa",""));
   ng->bin_filename = salloc(pc_stringarg(argc, argv,"-binary",""));
   
+  ng->trie_filename = salloc(pc_stringarg(argc, argv,"-trie",""));
+  ng->trie_quant = salloc(pc_stringarg(argc, argv,"-trie_quant",""));
+  
   ng->write_arpa = strcmp("",ng->arpa_filename);
   ng->write_bin = strcmp("",ng->bin_filename);
+  ng->write_trie = strcmp("",ng->trie_filename);
   
-  if (!(ng->write_arpa || ng->write_bin)) 
-    quit(-1,"Error : must specify either an arpa, or a binary output file.\n");
+  if (!(ng->write_arpa || ng->write_bin || ng->write_trie)) 
+    quit(-1,"Error : must specify either an arpa, a binary or a trie output file.\n");
+
+  if (ng->write_trie) {
+    unsigned char prob_bits[TRIE_MAX_ORDER-1], bo_bits[TRIE_MAX_ORDER-1];
+
+    if (ng->n > TRIE_MAX_ORDER)
+      quit(-1,"Error : trie LMs can be at most %d-grams.\n",TRIE_MAX_ORDER);
+    if (parse_trie_quant(ng->trie_quant,ng->n,prob_bits,bo_bits) < 0)
+      quit(-1,"Error : invalid -trie_quant '%s', should be probability/back-off bits\nfor each order from bigrams, from 1 to 16 bits, separated by commas.\n",
+	   ng->trie_quant);
+  }
 
   ng->count_table_size = DEFAULT_COUNT_TABLE_SIZE;
 
@@ -250,6 +265,9 @@ ng_t * init_ng(
   if (ng->write_bin) 
     ng->bin_fp = rr_oopen(ng->bin_filename);
 
+  if (ng->write_trie) 
+    ng->trie_fp = rr_oopen(ng->trie_filename);
+
   return ng;
 }
 	
@@ -392,6 +410,8 @@ void report_param(int verbosity, ng_t *ng,
     pc_message(verbosity,2,"     ARPA format   : %s\n",ng->arpa_filename);
   if (ng->write_bin) 
     pc_message(verbosity,2,"     Binary format : %s\n",ng->bin_filename);
+  if (ng->write_trie) 
+    pc_message(verbosity,2,"     Trie format   : %s\n",ng->trie_filename);
 
   pc_message(verbosity,2,"  Vocabulary file : %s\n",ng->vocab_filename);
   if (ng->context_set) 
@@ -771,7 +791,7 @@ int main(int argc, char **argv) {
 	  ng->num_kgrams[ng->n-1]++;	  
 	  
 	  if (ng->num_kgrams[ng->n-1] >= ng->table_sizes[ng->n-1])
-	    quit(-1,"\nMore than %d %d-grams needed to be stored. Rerun with a higher table size.\n",ng->table_sizes[ng->n-1],ng->n);
+	    ng_grow_table(ng,ng->n-1,verbosity);
 	}
 	/* Deal with new 2,3,...,(n-1)-grams */
       
@@ -793,7 +813,7 @@ int main(int argc, char **argv) {
 	  ng->num_kgrams[i]++;
 	
 	  if (ng->num_kgrams[i] >= ng->table_sizes[i])
-	    quit(-1,"More than %d %d-grams needed to be stored. Rerun with a higher table size.\n",ng->table_sizes[i],i+1);	  
+	    ng_grow_table(ng,i,verbosity);
 	}
       
 	for (i=0;i<=pos_of_novelty-1;i++) 
@@ -871,6 +891,11 @@ int main(int argc, char **argv) {
   /* The idngram reading is completed at this point */
   pc_message(verbosity,2,"\n");
 
+  /* Give back whatever the tables were given beyond what they hold;
+     one spare entry is kept since lookups may read one past the end. */
+  for (i=1;i<=ng->n-1;i++)
+    ng_resize_table(ng,i,ng->num_kgrams[i]+1);
+
   /* Impose a minimum unigram count, if required */
 
   if (ng->min_unicount > 0) {
@@ -956,6 +981,9 @@ int main(int argc, char **argv) {
   if (ng->write_bin) 
     write_bin_lm(ng,verbosity);
 
+  if (ng->write_trie) 
+    write_trie_lm(ng,verbosity);
+
   pc_message(verbosity,0,"idngram2lm : Done.\n");
 
   return 0;    
@@ -84,25 +84,42 @@ default to 1/#-of-models.
 #define  ITEM_FORMAT "%f"
 #define  MCAPTION 20
 
-void eval(double *sum_logprobs, double **fractions, int *tag_of, int *n_in_tag,
-	  double *prob_components, double **lambdas, ITEM_T **model_probs,
-	  int ntags, int from_item, int to_item, int nmodels, char **captions, 
-	  double *p_new_pp, int iter_no, double old_pp, int verbosity, 
-	  FILE *probs_fp) {
+/* The items from_item to to_item, with sums of their own */
+typedef struct {
+  int *tag_of;
+  double **lambdas;
+  ITEM_T **model_probs;
+  int ntags;
+  int nmodels;
+  int from_item;
+  int to_item;
+  int verbosity;
+  FILE *probs_fp;
+  double *sum_logprobs;          /*           sum_logprobs[tag]       */
+  double **fractions;            /*       fractions[model][tag]       */
+  double *prob_components;       /* prob_components[model]            */
+} eval_job_t;
+
+static void *eval_items(void *arg) {
+  eval_job_t *job = (eval_job_t *) arg;
+  double  **fractions = job->fractions;
+  double  *sum_logprobs = job->sum_logprobs;
+  double  *prob_components = job->prob_components;
   int     itag, iitem, tag, imodel;
-  double  total_prob, total_logprobs, new_pp;
+  int     nmodels = job->nmodels, verbosity = job->verbosity;
+  double  total_prob;
 
-  for (itag=0; itag<ntags; itag++) {
+  for (itag=0; itag<job->ntags; itag++) {
      sum_logprobs[itag] = 0.0;
      for (imodel=0; imodel<nmodels; imodel++)
         fractions[imodel][itag] = 0.0;    
   }
-  for (iitem=from_item; iitem<=to_item; iitem++) {
-    tag = tag_of[iitem];
+  for (iitem=job->from_item; iitem<=job->to_item; iitem++) {
+    tag = job->tag_of[iitem];
     total_prob = 0.0;
     for (imodel=0; imodel<nmodels; imodel++) {
       prob_components[imodel] =
-	lambdas[imodel][tag] * model_probs[imodel][iitem];
+	job->lambdas[imodel][tag] * job->model_probs[imodel][iitem];
       total_prob += prob_components[imodel];
     }
     for (imodel=0; imodel<nmodels; imodel++)
@@ -112,7 +129,7 @@ void eval(double *sum_logprobs, double **fractions, int *tag_of, int *n_in_tag,
     pc_message(verbosity,3,"    item #%d (tag %d): ",iitem,tag);
     pc_message(verbosity,4,"\n        probs:  ");
     for (imodel=0; imodel<nmodels; imodel++)
-      pc_message(verbosity,4,"%.4f ",model_probs[imodel][iitem]);
+      pc_message(verbosity,4,"%.4f ",job->model_probs[imodel][iitem]);
 
     pc_message(verbosity,4,"\n        comps:  ");
     for (imodel=0; imodel<nmodels; imodel++)
@@ -128,9 +145,71 @@ void eval(double *sum_logprobs, double **fractions, int *tag_of, int *n_in_tag,
 	       "total_prob=%.4f  logprob=%.3f  sum_logprob[%d]=%.3f\n",
 	       total_prob, log(total_prob), tag, sum_logprobs[tag]);
 
-    if (probs_fp)
-      fprintf(probs_fp,"%g\n",total_prob);
+    if (job->probs_fp)
+      fprintf(job->probs_fp,"%g\n",total_prob);
+  }
+  return NULL;
+}
+
+/* The component probabilities of each item are read once into
+   model_probs, so an iteration only has to weight and sum them.  The
+   items are split between n_threads threads, unless they have to be
+   reported or written in order; with one thread the sums are exactly
+   those of a single pass. */
+void eval(double *sum_logprobs, double **fractions, int *tag_of, int *n_in_tag,
+	  double *prob_components, double **lambdas, ITEM_T **model_probs,
+	  int ntags, int from_item, int to_item, int nmodels, char **captions, 
+	  double *p_new_pp, int iter_no, double old_pp, int verbosity, 
+	  FILE *probs_fp, int n_threads) {
+  int     itag, imodel, j, n_jobs, n_items;
+  double  total_logprobs, new_pp;
+  eval_job_t *jobs;
+
+  n_items = to_item-from_item+1;
+  n_jobs = n_threads;
+  if (verbosity >= 3 || probs_fp || n_jobs > n_items)
+    n_jobs = 1;
+
+  jobs = (eval_job_t *) rr_malloc(n_jobs*sizeof(eval_job_t));
+  for (j=0; j<n_jobs; j++) {
+    jobs[j].tag_of = tag_of;
+    jobs[j].lambdas = lambdas;
+    jobs[j].model_probs = model_probs;
+    jobs[j].ntags = ntags;
+    jobs[j].nmodels = nmodels;
+    jobs[j].from_item = from_item + (int) ((double) n_items*j/n_jobs);
+    jobs[j].to_item = from_item + (int) ((double) n_items*(j+1)/n_jobs) - 1;
+    jobs[j].verbosity = verbosity;
+    jobs[j].probs_fp = probs_fp;
+    jobs[j].sum_logprobs = (double *) rr_malloc(ntags*sizeof(double));
+    jobs[j].fractions = (double **) rr_malloc(nmodels*sizeof(double *));
+    for (imodel=0; imodel<nmodels; imodel++)
+      jobs[j].fractions[imodel] = (double *) rr_malloc(ntags*sizeof(double));
+    jobs[j].prob_components =
+      j ? (double *) rr_malloc(nmodels*sizeof(double)) : prob_components;
+  }
+  run_jobs(eval_items,jobs,sizeof(eval_job_t),n_jobs);
+
+  for (itag=0; itag<ntags; itag++) {
+     sum_logprobs[itag] = 0.0;
+     for (imodel=0; imodel<nmodels; imodel++)
+        fractions[imodel][itag] = 0.0;    
+  }
+  for (j=0; j<n_jobs; j++) {
+    for (itag=0; itag<ntags; itag++) {
+      sum_logprobs[itag] += jobs[j].sum_logprobs[itag];
+      for (imodel=0; imodel<nmodels; imodel++)
+	fractions[imodel][itag] += jobs[j].fractions[imodel][itag];
+    }
+    for (imodel=0; imodel<nmodels; imodel++)
+      free(jobs[j].fractions[imodel]);
+    free(jobs[j].fractions);
+    free(jobs[j].sum_logprobs);
+    if (j)
+      free(jobs[j].prob_components);
   }
+  free(jobs);
+
   pc_message(verbosity,2,"\n");
   total_logprobs = 0.0;
   for (itag=0; itag<ntags; itag++) {
@@ -155,6 +234,36 @@ void eval(double *sum_logprobs, double **fractions, int *tag_of, int *n_in_tag,
   *p_new_pp = new_pp;
 }
 
+/* Models first, first+step, ... for read_probs() */
+typedef struct {
+  FILE **model_fps;
+  ITEM_T **model_probs;
+  int *nnewitems;
+  int first;
+  int step;
+  int nmodels;
+  int Mprobs;
+} read_job_t;
+
+/* Read the probability streams of some of the models.  Each is parsed
+   once here, and only the weights change from one iteration to the
+   next. */
+static void *read_probs(void *arg) {
+  read_job_t *job = (read_job_t *) arg;
+  int imodel, iitem;
+  ITEM_T *pitem;
+
+  for (imodel=job->first; imodel<job->nmodels; imodel+=job->step) {
+     pitem=job->model_probs[imodel];
+     job->nnewitems[imodel] = 0;
+     for (iitem=0; iitem<job->Mprobs+1; iitem++) {
+        if (fscanf(job->model_fps[imodel],ITEM_FORMAT,pitem++) != 1) break;
+        job->nnewitems[imodel]++;
+     }
+  }
+  return NULL;
+}
+
 void help_message()
 {
     fprintf(stderr,"Usage : interpolate +[-] model1.fprobs +[-] model2.fprobs ... \n");
@@ -167,6 +276,7 @@ void help_message()
     fprintf(stderr,"        [ -stop_ratio 0.999 ]\n");
     fprintf(stderr,"        [ -probs .fprobs ]\n");
     fprintf(stderr,"        [ -max_probs 6000000 ]\n");
+    fprintf(stderr,"        [ -nthreads 1 ]\n");
 }
 
 int main (int argc, char **argv) {
@@ -182,6 +292,7 @@ int main (int argc, char **argv) {
   int cv=0;
   int k=2; /* Added at 20060610, default of k-fold validation */
   int Mprobs = 60000; 
+  int n_threads = 1;
   int write_lambdas = 0;
   double stop_ratio = 0.999;
 
@@ -208,6 +319,9 @@ int main (int argc, char **argv) {
   double *sum_logprobs;          /*           sum_logprobs[tag]       */
   int    *n_train_in_tag;        /*            n_in_tag[tag]          */
   int    *n_test_in_tag;         /*            n_in_tag[tag]          */
+  int    *nnewitems_of;          /*        nnewitems_of[model]        */
+  read_job_t *read_jobs;
+  int    n_read_jobs;
   int    nmodels=0; 
   int imodel; 
   int ntags; 
@@ -234,9 +348,6 @@ int main (int argc, char **argv) {
 
   double total_logprob;
   char   **captions;
-  FILE   *fp;
-  ITEM_T *pitem;
-  int    scanfrc; 
   int nnewitems;
   int temp_test_items;
   char *write_fprobs_filename;
@@ -326,6 +437,10 @@ int main (int argc, char **argv) {
 
   Mprobs = pc_intarg(&argc,argv,"-max_probs",6000000);
 
+  n_threads = pc_intarg(&argc,argv,"-nthreads",1);
+  if (n_threads < 1)
+    quit(-1,"%s: -nthreads must be at least 1\n",rname);
+
   pc_report_unk_args(&argc,argv,verbosity);
 
   if (nmodels==0) quit(-1,"%s: no models specified\n",rname);
@@ -360,15 +475,26 @@ int main (int argc, char **argv) {
   for (imodel=0; imodel<nmodels; imodel++) {
      model_fps[imodel] = rr_iopen(model_filenames[imodel]);
      model_probs[imodel] = (ITEM_T *) rr_malloc((Mprobs+1)*sizeof(ITEM_T));
+  }
 
-     /* read in the models probabilities */
-     fp=model_fps[imodel];
-     pitem=model_probs[imodel];
-     nnewitems = 0;
-     for (iitem=0; iitem<Mprobs+1; iitem++) {
-        if ((scanfrc=fscanf(fp,ITEM_FORMAT,pitem++)) != 1) break;
-        nnewitems++;
-     }
+  /* read in the models probabilities, several models at a time */
+  n_read_jobs = MIN(n_threads,nmodels);
+  nnewitems_of = (int *) rr_malloc(nmodels*sizeof(int));
+  read_jobs = (read_job_t *) rr_malloc(n_read_jobs*sizeof(read_job_t));
+  for (i=0; i<n_read_jobs; i++) {
+     read_jobs[i].model_fps = model_fps;
+     read_jobs[i].model_probs = model_probs;
+     read_jobs[i].nnewitems = nnewitems_of;
+     read_jobs[i].first = i;
+     read_jobs[i].step = n_read_jobs;
+     read_jobs[i].nmodels = nmodels;
+     read_jobs[i].Mprobs = Mprobs;
+  }
+  run_jobs(read_probs,read_jobs,sizeof(read_job_t),n_read_jobs);
+  free(read_jobs);
+
+  for (imodel=0; imodel<nmodels; imodel++) {
+     nnewitems = nnewitems_of[imodel];
      if (nnewitems>Mprobs) quit(-1,
         "%s: more than %d probs on %s\n",rname,Mprobs,model_filenames[imodel]);
      if (imodel==0) nitems = nnewitems;
@@ -378,6 +504,7 @@ int main (int argc, char **argv) {
 
      fclose(model_fps[imodel]);
   }
+  free(nnewitems_of);
 
   pc_message(verbosity,2,"Done.\n");
   fflush(stderr);
@@ -586,13 +713,13 @@ int main (int argc, char **argv) {
            eval(sum_logprobs, fractions, tag_of, n_train_in_tag,
                 prob_components, lambdas, model_probs,
                 ntags, n_test_items, nitems-1, nmodels, captions, &new_pp,
-                iter_no, old_pp, verbosity, NULL);
+                iter_no, old_pp, verbosity, NULL, n_threads);
            iter_no++;
         }else {  /* Train on first part and test on last part */
            eval(sum_logprobs, fractions, tag_of, n_train_in_tag,
                 prob_components, lambdas, model_probs,
                 ntags, 0, n_train_items-1, nmodels, captions, &new_pp,
-                iter_no, old_pp, verbosity, NULL);
+                iter_no, old_pp, verbosity, NULL, n_threads);
            iter_no++;
         }
 	pc_message(verbosity,2, " new_pp = %f, old_pp %f, Ratio = %f, Stop Ratio = %f\n",new_pp, old_pp, new_pp/old_pp, stop_ratio);
@@ -625,12 +752,12 @@ int main (int argc, char **argv) {
            eval(sum_logprobs, fractions, tag_of, n_test_in_tag,
                 prob_components, lambdas, model_probs,
                 ntags, 0, n_test_items-1, nmodels,captions, &test_pp,
-                1, 0.0, verbosity, probs_fp);
+                1, 0.0, verbosity, probs_fp, n_threads);
         }else {                  /* Train on first part and test on last part */
            eval(sum_logprobs, fractions, tag_of, n_test_in_tag,
                 prob_components, lambdas, model_probs,
                 ntags, n_train_items, nitems-1, nmodels,captions, &test_pp,
-                1, 0.0, verbosity, probs_fp);
+                1, 0.0, verbosity, probs_fp, n_threads);
         }
 	fprintf(stderr,"\n");
 
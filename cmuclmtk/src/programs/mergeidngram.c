@@ -49,14 +49,32 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
 #include "../libs/pc_general.h"
 #include "../liblmest/toolkit.h"
 #include "../liblmest/ngram.h"
 #include "../libs/general.h"
+#include "../win32/compat.h"
+
+/* Input buffers share this much memory, within the bounds below */
+#define MERGE_BUFFER_TOTAL (256*1024*1024)
+#define MERGE_BUFFER_MIN (64*1024)
+#define MERGE_BUFFER_MAX (1024*1024)
 
 int n;
 flag ascii_in;
 flag ascii_out;
+int max_files;
+char *out_filename;
+
+/* An input file and the n-gram it is at */
+typedef struct {
+  FILE *fp;
+  ngram ng;
+  flag ascii;
+} merge_input_t;
 
 void procComLine( int *argc, char **argv );
 void printUsage( char *name );
@@ -70,16 +88,14 @@ void write_ngram( FILE *id_ngram_fp, ngram *ng, flag ascii )
   
   if ( ascii ) {
     for( i = 0; i < n; i++ ) {
-      if ( fprintf( stdout, "%hu ", ng->id_array[i] ) < 0 ) 
+      if ( fprintf( id_ngram_fp, "%u ", ng->id_array[i] ) < 0 ) 
 	quit( -1, "error writing ascii ngram\n" );
     }
-    if ( fprintf( stdout, "%d\n", ng->count ) < 0 )
+    if ( fprintf( id_ngram_fp, "%d\n", ng->count ) < 0 )
       quit( -1, "error writing ascii ngram\n" );
   }else {
-    for ( i = 0; i < n; i++ ) {
-      rr_fwrite((char*) &ng->id_array[i], sizeof( id__t ), 1, id_ngram_fp,
-		 "binary ngram" );
-    }
+    rr_fwrite((char*) ng->id_array, sizeof( id__t ), n, id_ngram_fp,
+	      "binary ngram" );
     rr_fwrite( (char*) &ng->count, sizeof( int ), 1, id_ngram_fp,
 	       "binary ngram" );
   }
@@ -93,6 +109,8 @@ void procComLine( int *argc, char **argv )
   n = 3;
   ascii_in = 0;
   ascii_out = 0;
+  max_files = 512;
+  out_filename = "-";
 
   i = *argc - 1 ;
   while( i > 0 ) {
@@ -122,8 +140,25 @@ void procComLine( int *argc, char **argv )
       updateArgs( argc, argv, i ) ;
     }
 
+    /* most files to read at once */
+    if( !strcmp( argv[i], "-files" ) ) {
+      max_files = atoi( argv[i+1] ) ;
+      updateArgs( argc, argv, i+1 ) ;
+      updateArgs( argc, argv, i ) ;
+    }
+
+    /* output file instead of stdout */
+    if( !strcmp( argv[i], "-idngram" ) ) {
+      out_filename = salloc( argv[i+1] ) ;
+      updateArgs( argc, argv, i+1 ) ;
+      updateArgs( argc, argv, i ) ;
+    }
+
     i--;
   }
+
+  if ( max_files < 2 )
+    quit( -1, "Error: -files must be at least 2.\n" );
 }
    
 /* show command line usage */ 
@@ -134,6 +169,8 @@ void printUsage( char *name )
   fprintf( stderr, "  -n 3           \tn in n-gram \n" );
   fprintf( stderr, "  -ascii_input   \tinput files are ascii\n" );
   fprintf( stderr, "  -ascii_output  \toutput files are ascii\n" );
+  fprintf( stderr, "  -files 512     \tmost input files to read at once\n" );
+  fprintf( stderr, "  -idngram .idngram\toutput file instead of stdout\n" );
   exit(1);
 }
 
@@ -151,14 +188,93 @@ int cmp_ngram( ngram *ng1, ngram *ng2 )
   }
   return( 0 );
 }
+
+/* Restore the heap order below heap[i] */
+static void heap_sift( merge_input_t **heap, int size, int i )
+{
+  merge_input_t *top = heap[i];
+  int child;
+
+  while ( (child = 2*i + 1) < size ) {
+    if ( child + 1 < size && cmp_ngram( &heap[child+1]->ng, &heap[child]->ng ) < 0 )
+      child++;
+    if ( cmp_ngram( &top->ng, &heap[child]->ng ) <= 0 )
+      break;
+    heap[i] = heap[child];
+    i = child;
+  }
+  heap[i] = top;
+}
+
+/* Merge the sorted files into fp, adding up the counts of n-grams
+   which are in more than one of them.  The inputs are kept in a heap
+   on their current n-grams, so each n-gram costs log(nfiles)
+   comparisons. */
+static void merge_files( char **names, int nfiles, flag ascii, FILE *fp,
+			 flag out_ascii )
+{
+  merge_input_t *inputs;
+  merge_input_t **heap;
+  ngram outng;
+  size_t buffer_size;
+  int i, size;
+
+  buffer_size = MERGE_BUFFER_TOTAL / nfiles;
+  if ( buffer_size > MERGE_BUFFER_MAX ) buffer_size = MERGE_BUFFER_MAX;
+  if ( buffer_size < MERGE_BUFFER_MIN ) buffer_size = MERGE_BUFFER_MIN;
+
+  inputs = (merge_input_t *) rr_malloc( sizeof( merge_input_t ) * nfiles );
+  heap = (merge_input_t **) rr_malloc( sizeof( merge_input_t * ) * nfiles );
+  outng.id_array = (id__t *) rr_calloc( n, sizeof( id__t ) );
+  outng.n = n;
+
+  /* open the input files and read the first ngram from each */
+  size = 0;
+  for( i = 0; i < nfiles; i++ ) {
+    inputs[i].fp = rr_iopen( names[i] );
+    setvbuf( inputs[i].fp, NULL, _IOFBF, buffer_size );
+    inputs[i].ng.id_array = (id__t *) rr_calloc( n, sizeof( id__t ) );
+    inputs[i].ng.n = n;
+    inputs[i].ascii = ascii;
+    if ( get_ngram( inputs[i].fp, &inputs[i].ng, ascii ) )
+      heap[size++] = &inputs[i];
+  }
+  for( i = size/2 - 1; i >= 0; i-- )
+    heap_sift( heap, size, i );
+
+  while ( size > 0 ) {
+    memcpy( outng.id_array, heap[0]->ng.id_array, n * sizeof( id__t ) );
+    
+    /* add counts of equal ngrams */
+    outng.count = 0;
+    while ( size > 0 && cmp_ngram( &outng, &heap[0]->ng ) == 0 ) {
+      outng.count += heap[0]->ng.count;
+      if ( !get_ngram( heap[0]->fp, &heap[0]->ng, heap[0]->ascii ) )
+	heap[0] = heap[--size];
+      if ( size > 0 )
+	heap_sift( heap, size, 0 );
+    }
+
+    write_ngram( fp, &outng, out_ascii );
+  }
+
+  for( i = 0; i < nfiles; i++ ) {
+    rr_iclose( inputs[i].fp );
+    free( inputs[i].ng.id_array );
+  }
+  free( outng.id_array );
+  free( heap );
+  free( inputs );
+}
     
 int main( int argc, char **argv )
 {
-  FILE **fin;
-  ngram *ng;
-  ngram outng;
-  flag *done, finished;
-  int i, j, nfiles;
+  char **names, **merged;
+  char temp_directory[1000];
+  char temp_name[1100];
+  FILE *fp;
+  flag ascii;
+  int i, nfiles, nmerged, pass;
 
   /* Process the command line */
   report_version(&argc,argv);
@@ -168,68 +284,60 @@ int main( int argc, char **argv )
     exit( 1 ) ;
   }
   nfiles = argc - 1;
+  names = argv + 1;
+  ascii = ascii_in;
 
-  /* allocate memory */
-  fin = (FILE **) rr_malloc( sizeof( FILE *) * nfiles );
-  done = (flag *) rr_malloc( sizeof( flag ) * nfiles );
-  ng = (ngram *) rr_malloc( sizeof( ngram ) * nfiles );
-
-  for( i = 0; i < nfiles; i++ ) {
-    ng[i].id_array = (id__t *) rr_calloc( n, sizeof( id__t ) );
-    ng[i].n = n;
+  /* With more files than can be read at once, merge them a group at
+     a time into temporary files, until few enough are left. */
+  pass = 0;
+  if ( nfiles > max_files ) {
+    strcpy( temp_directory, "cmuclmtk-XXXXXX" );
+    if ( mkdtemp( temp_directory ) == NULL )
+      quit( -1, "Failed to create temporary folder: %s\n", strerror( errno ) );
   }
-  outng.id_array = (id__t *) rr_calloc( n, sizeof( id__t ) );
-  outng.n = n;
-
-  /* open the input files */
-  for( i = 0; i < nfiles; i++ )
-    fin[i] = rr_iopen( argv[i+1] );
-
-  /* read first ngram from each file */
-  for( i = 0; i < nfiles; i++ ) {
-    done[i] = 0;
-    if ( !get_ngram( fin[i], &ng[i], ascii_in ) )
-      done[i] = 1;
-  }
-
-  finished = 0;
-  while ( !finished ) {
-  /* set outng to max possible */
-    for( i = 0; i < n; i++ )
-      outng.id_array[i] = MAX_VOCAB_SIZE;
-    
-    /* find smallest ngram */
-    for( i = 0; i < nfiles; i++ ) {
-      if ( !done[i] ) 
-	if ( cmp_ngram( &outng, &ng[i] ) > 0 ) 
-	  for( j = 0; j < n; j++ ) outng.id_array[j] = ng[i].id_array[j];
+  while ( nfiles > max_files ) {
+    nmerged = ( nfiles + max_files - 1 ) / max_files;
+    merged = (char **) rr_malloc( sizeof( char * ) * nmerged );
+    fprintf( stderr, "mergeidngram : Merging %d files into %d...\n",
+	     nfiles, nmerged );
+    for( i = 0; i < nmerged; i++ ) {
+      sprintf( temp_name, "%s/%d.%d", temp_directory, pass, i );
+      merged[i] = salloc( temp_name );
+      fp = rr_fopen( merged[i], "wb" );
+      setvbuf( fp, NULL, _IOFBF, MERGE_BUFFER_MAX );
+      merge_files( names + i * max_files,
+		   MIN( max_files, nfiles - i * max_files ), ascii, fp, 0 );
+      fclose( fp );
     }
-    
-    outng.count = 0;
-    for( i = 0; i < nfiles; i++ ) {
-      if ( !done[i] ) {
-	/* add counts of equal ngrams */
-	if ( cmp_ngram( &outng, &ng[i] ) == 0 ) {
-	  outng.count += ng[i].count;
-	  if ( !get_ngram( fin[i], &ng[i], ascii_in ) ) {
-	    /* check if all files done */
-	    done[i] = 1;
-	    finished = 1;
-	    for( j = 0; j < nfiles; j++ ) 
-	      if ( ! done[j] ) finished = 0;
-	  }
-	}
+    if ( pass > 0 ) {
+      for( i = 0; i < nfiles; i++ ) {
+	remove( names[i] );
+	free( names[i] );
       }
+      free( names );
     }
-
-    write_ngram( stdout, &outng, ascii_out );
+    names = merged;
+    nfiles = nmerged;
+    ascii = 0;
+    pass++;
   }
 
-  for( i = 0; i < nfiles; i++ )
-    rr_iclose( fin[i] );
+  fp = rr_oopen( out_filename );
+  setvbuf( fp, NULL, _IOFBF, MERGE_BUFFER_MAX );
+  merge_files( names, nfiles, ascii, fp, ascii_out );
+  fflush( fp );
+  rr_oclose( fp );
+
+  if ( pass > 0 ) {
+    for( i = 0; i < nfiles; i++ ) {
+      remove( names[i] );
+      free( names[i] );
+    }
+    free( names );
+    rmdir( temp_directory );
+  }
 
   fprintf(stderr,"mergeidngram : Done.\n");
 
   return( 0 );
 }
-
@@ -74,6 +74,7 @@ void help_message()
   fprintf(stderr,"                    [ -n 3 ]\n");
   fprintf(stderr,"                    [ -write_ascii ]\n");
   fprintf(stderr,"                    [ -fof_size 10 ]\n");
+  fprintf(stderr,"                    [ -nthreads 1 ]\n");
   fprintf(stderr,"                    [ -version ]\n");
   fprintf(stderr,"                    [ -help ]\n");
 }
@@ -94,6 +95,7 @@ int main(int argc, char *argv[]) {
   int buffer_size;
   int max_files;
   int fof_size;
+  int n_threads;
 
   wordid_t *buffer;
 
@@ -106,8 +108,7 @@ int main(int argc, char *argv[]) {
   flag gzip_flag;
 
   /* Vocab hash table things */
-  struct idngram_hash_table vocabulary;
-  unsigned long M;
+  struct hash_table vocabulary;
   unsigned long hash_size;
   unsigned int number_of_tempfiles;
   tempfile = NULL; /* Just to prevent compilation warnings. */
@@ -134,6 +135,7 @@ int main(int argc, char *argv[]) {
   n              = pc_intarg( &argc, argv, "-n",DEFAULT_N);
   write_ascii    = pc_flagarg(&argc,argv,"-write_ascii");
   fof_size       = pc_intarg(&argc,argv,"-fof_size",10);
+  n_threads      = pc_intarg(&argc,argv,"-nthreads",1);
 
   /* the version version will be consumed in report_version */
   
@@ -159,6 +161,7 @@ int main(int argc, char *argv[]) {
   pc_report_unk_args(&argc,argv,verbosity);
   
   outfile = rr_fopen(idngram_filename,"wb");
+  setvbuf(outfile,NULL,_IOFBF,1024*1024);
 
   /* If the last charactor in the directory name isn't a / then add one. */
   strcpy (temp_directory, "cmuclmtk-XXXXXX");
@@ -174,6 +177,7 @@ int main(int argc, char *argv[]) {
   pc_message(verbosity,2,"Max open files         : %d\n",max_files);
   pc_message(verbosity,2,"FOF size               : %d\n",fof_size);  
   pc_message(verbosity,2,"n                      : %d\n",n);
+  pc_message(verbosity,2,"Threads                : %d\n",n_threads);
 
   /**
      ARCHAN:
@@ -184,12 +188,11 @@ int main(int argc, char *argv[]) {
   /* Allocate memory for hash table */
   fprintf(stderr,"Initialising hash table...\n");
 
-  M=nearest_prime(hash_size);
-  new_idngram_hashtable(&vocabulary,M);
+  new_hashtable(&vocabulary,hash_size);
 
   /* Read in the vocabulary */
 
-  read_vocab(vocab_filename,verbosity,&vocabulary,M);
+  read_vocab(vocab_filename,verbosity,&vocabulary);
   
   pc_message(verbosity,2,"Allocating memory for the n-gram buffer...\n");
 
@@ -197,16 +200,17 @@ int main(int argc, char *argv[]) {
   buffer=(wordid_t*) rr_malloc(n*(buffer_size+1)*sizeof(wordid_t));
   /* Read in the first ngram */
 
-  number_of_tempfiles =  read_txt2ngram_buffer(stdin,
-					       &vocabulary,
-					       verbosity, 
-					       buffer,
-					       buffer_size, 
-					       n,
-					       temp_directory,
-					       temp_file_ext,
-					       tempfile
-					       );
+  number_of_tempfiles =  read_txt2ngram_buffer_mt(stdin,
+						  &vocabulary,
+						  verbosity, 
+						  buffer,
+						  buffer_size, 
+						  n,
+						  temp_directory,
+						  temp_file_ext,
+						  tempfile,
+						  n_threads
+						  );
   
   /* Merge the temporary files, and output the result to standard output */
 
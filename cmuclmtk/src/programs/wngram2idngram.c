@@ -138,9 +138,8 @@ int main(int argc, char *argv[]) {
 
   /* Vocab hash table things */
 
-  struct idngram_hash_table vocabulary;
+  struct hash_table vocabulary;
   unsigned long hash_size;
-  unsigned long M;
 
   wordid_t *current_ngram;
   int current_count;
@@ -208,9 +207,7 @@ int main(int argc, char *argv[]) {
 
   fprintf(stderr,"Initialising hash table...\n");
 
-  M = nearest_prime(hash_size);
-
-  new_idngram_hashtable(&vocabulary,M);
+  new_hashtable(&vocabulary,hash_size);
 
   /* Read in the vocabulary */
 
@@ -237,7 +234,7 @@ int main(int argc, char *argv[]) {
 
     vocab_size++;
     
-    add_to_idngram_hashtable(&vocabulary,idngram_hash(temp_word2,M),temp_word2,vocab_size);
+    add_to_hashtable(&vocabulary,temp_word2,vocab_size);
     strcpy(temp_word3,temp_word2);
   }
 
@@ -332,22 +329,13 @@ int main(int argc, char *argv[]) {
 	    if (same_ngram) 
 	      sort_count += buffer[i].count;
 	    else {
-	      for (j=0;j<=n-1;j++) {
-		rr_fwrite((char*)&sort_ngram[j],sizeof(wordid_t),1,
-			  tempfile,"temporary n-gram ids");
+	      write_temp_ngram(tempfile,sort_ngram,sort_count,n);
+	      for (j=0;j<=n-1;j++) 
 		sort_ngram[j] = buffer[i].word[j];
-	      }
-	      rr_fwrite((char*)&sort_count,sizeof(int),1,tempfile,
-			"temporary n-gram counts");
 	      sort_count = buffer[i].count;
 	    }
 	  }	    
-	  for (j=0;j<=n-1;j++) 
-	    rr_fwrite((char*)&sort_ngram[j],sizeof(wordid_t),1,
-		      tempfile,"temporary n-gram ids");
-
-	  rr_fwrite((char*)&sort_count,sizeof(int),1,tempfile,
-		    "temporary n-gram counts");
+	  write_temp_ngram(tempfile,sort_ngram,sort_count,n);
 	  rr_oclose(tempfile);
 	  position_in_buffer = 1;
 
@@ -360,12 +348,7 @@ int main(int argc, char *argv[]) {
 
       }else {
 	/* Write to temporary file */
-	for (i=0;i<=n-1;i++) 
-	  rr_fwrite((char*)&current_ngram[i],sizeof(wordid_t),1,
-		    non_unk_fp,"temporary n-gram ids");
-
-	rr_fwrite((char*)&current_count,sizeof(int),1,non_unk_fp,
-		  "temporary n-gram counts");
+	write_temp_ngram(non_unk_fp,current_ngram,current_count,n);
       }
     }
   }
@@ -408,22 +391,13 @@ int main(int argc, char *argv[]) {
       if (same_ngram) 
 	sort_count += buffer[i].count;
       else {
-	for (j=0;j<=n-1;j++) {
-	  rr_fwrite((char*)&sort_ngram[j],sizeof(wordid_t),1,
-		    tempfile,"temporary n-gram ids");
+	write_temp_ngram(tempfile,sort_ngram,sort_count,n);
+	for (j=0;j<=n-1;j++) 
 	  sort_ngram[j] = buffer[i].word[j];
-	}
-	rr_fwrite((char*)&sort_count,sizeof(int),1,tempfile,
-		  "temporary n-gram counts");
 	sort_count = buffer[i].count;
       }
     }	    
-    for (j=0;j<=n-1;j++) 
-      rr_fwrite((char*)&sort_ngram[j],sizeof(wordid_t),1,
-		tempfile,"temporary n-gram ids");
-
-    rr_fwrite((char*)&sort_count,sizeof(int),1,tempfile,
-	      "temporary n-gram counts");
+    write_temp_ngram(tempfile,sort_ngram,sort_count,n);
     fclose(tempfile);
     
 
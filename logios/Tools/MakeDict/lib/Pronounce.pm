@@ -7,6 +7,9 @@
 # [20080324] (air) reorganized as a perl module; integrated into logios platform
 #                  supports both local and web-based resolution (due to licensed LtoS sw)
 #                  new interface to pronounce
+# batch mode: many word lists are resolved with one pass of pronounce, split
+#             across JOBS parallel processes, and the results are kept in a
+#             binary index (CACHE) so that later runs only pronounce new words
 #
 
 package Pronounce;
@@ -15,6 +18,8 @@ use Config;
 use File::Spec;
 use File::stat;
 use LWP::UserAgent;
+use Storable qw(nstore retrieve);
+use Digest::MD5 qw(md5_hex);
 
 sub new {
   my $class = shift;
@@ -36,12 +41,14 @@ sub new {
                 'OUTFILE' => File::Spec->catfile($params{'DICTDIR'}, $params{'OUTFN'}),
                 'LOGFILE' => File::Spec->catfile($params{'DICTDIR'}, $params{'LOGFN'}),
                 'FORCE' => $params{'FORCE'} || 0,
+                'CACHE' => $params{'CACHE'},  # binary index of past results
+                'JOBS' => $params{'JOBS'} || 1,  # parallel pronounce processes
                };
 
   die "Need to know the LOGIOS Tools root." if !defined $params{'TOOLS'};
   require File::Spec->catfile($params{'TOOLS'}, 'lib', 'LogiosLog.pm');
 
-  for ('DICTDIR', 'VOCFN', 'OUTFN', 'LOGFN') {
+  for ('DICTDIR', 'LOGFN', ($params{'BATCH'}? (): ('VOCFN', 'OUTFN'))) {
     &LogiosLog::fail("Must supply $_") if !$params{$_};
   }
 
@@ -98,6 +105,8 @@ sub do_pronounce {
 #  }
   $self->clean_wordfile;
   return $self->get_dic_web if $self->{'SOURCE'} eq 'web';
+  return $self->pronounce_batch([$self->{'WORDFILE'}, $self->{'HANDDICT'}, $self->{'OUTFILE'}])
+    if $self->{'SOURCE'} eq 'loc' and ($self->{'CACHE'} or $self->{'JOBS'} > 1);
   return $self->get_dic_loc if $self->{'SOURCE'} eq 'loc';
   &LogiosLog::fail("Pronounce::getdict(): unknown pronunciation source ".$self->{'SOURCE'});
 }
@@ -137,6 +146,134 @@ sub get_dic_loc {
 }
 
 
+####  batch mode  ####
+# each job is [word file, hand dictionary (or undef), output dictionary]
+# words are looked up in the cache first; the rest are pronounced together,
+# once per distinct hand dictionary since it changes how compounds resolve
+sub pronounce_batch {
+  my ($self, @jobs) = @_;
+
+  my $cache = $self->load_cache;
+  my %pending;  # hand dictionary key => [hand dictionary, [words]]
+  my @lists;
+  for my $job (@jobs) {
+    my ($wordfile, $hand, $outfile) = @$job;
+    $hand = undef if defined $hand and !-e $hand;
+    my $key = &hand_key($hand);
+    my $table = $cache->{'TABLE'}{$key} ||= {};
+    open(WORDS, $wordfile) or &LogiosLog::fail("Pronounce: can't open $wordfile");
+    my @words = map { s/\s+$//; uc } grep { /\S/ and !/^</ } <WORDS>;
+    close WORDS;
+    $pending{$key} ||= [$hand, [], {}];
+    for (@words) {
+      next if exists $table->{$_} or $pending{$key}[2]{$_}++;
+      push @{$pending{$key}[1]}, $_;
+    }
+    push @lists, [$table, \@words, $outfile];
+  }
+
+  open(PLOG, ">$self->{'LOGFILE'}") and close PLOG;  # each chunk appends to it
+  for my $key (keys %pending) {
+    my ($hand, $words) = @{$pending{$key}};
+    next if !@$words;
+    &LogiosLog::say('Pronounce', scalar @$words." new words, ".
+                    scalar(keys %{$cache->{'TABLE'}{$key}})." cached");
+    $self->run_pronounce($hand, $words, $cache->{'TABLE'}{$key});
+  }
+
+  for (@lists) {
+    my ($table, $words, $outfile) = @$_;
+    open(DICT, ">$outfile") or &LogiosLog::fail("Pronounce: can't write $outfile");
+    my %done;
+    for my $w (@$words) {
+      next if $done{$w}++;
+      if (!$table->{$w}) {
+        &LogiosLog::warn("Pronounce: no pronunciation for $w");
+        next;
+      }
+      my $alt = 0;
+      for (@{$table->{$w}}) {
+        print DICT ($alt? "$w($alt)": $w), "\t$_\n";
+        $alt++;
+      }
+    }
+    close DICT;
+  }
+  nstore($cache, $self->{'CACHE'}) if $self->{'CACHE'};
+  return 0;
+}
+
+# the cache only holds while pronounce and its lexicon are unchanged
+sub load_cache {
+  my $self = shift;
+
+  my $stamp = join(':', $self->{'LEXICON'},
+                   map { -e $_? (stat($_)->mtime, stat($_)->size): () }
+                   ($self->{'PRONOUNCE'},
+                    File::Spec->catfile($self->{'LEXILIB'}, 'lexdata', 'lexicon.data')));
+  my $cache;
+  $cache = eval { retrieve($self->{'CACHE'}) } if $self->{'CACHE'} and -e $self->{'CACHE'};
+  if (!$cache or $cache->{'STAMP'} ne $stamp) {
+    $cache = {'STAMP' => $stamp, 'TABLE' => {}};
+  }
+  return $cache;
+}
+
+sub hand_key {
+  my $hand = shift;
+  return '' if !defined $hand;
+  open(HAND, $hand) or return '';
+  binmode HAND;
+  my $key = md5_hex(join('', <HAND>));
+  close HAND;
+  return $key;
+}
+
+# pronounce a list of words in up to JOBS parallel runs, adding the results
+# to the table
+sub run_pronounce {
+  my ($self, $hand, $words, $table) = @_;
+
+  my $jobs = $self->{'JOBS'} < @$words? $self->{'JOBS'}: scalar @$words;
+  my $base = File::Spec->catfile($self->{'OUTDIR'}, "_pronounce_$$");
+  my %child;
+  for my $i (0 .. $jobs-1) {
+    # contiguous chunks, so logs come back in word order
+    my $lo = int($i * @$words / $jobs);
+    my $hi = int(($i+1) * @$words / $jobs) - 1;
+    open(CHUNK, ">$base.$i.words") or &LogiosLog::fail("Pronounce: can't write $base.$i.words");
+    print CHUNK map { "$_\n" } @$words[$lo .. $hi];
+    close CHUNK;
+    my @args = ('-P40', '-r', $self->{'LEXILIB'}, '-d', $self->{'LEXICON'},
+                '-i', "$base.$i.words", '-o', "$base.$i.dict", '-e', "$base.$i.log", '-v');
+    push(@args, '-H', $hand) if defined $hand;
+    if ($jobs == 1) {
+      system($self->{'PRONOUNCE'}, @args);
+      next;
+    }
+    my $pid = fork;
+    &LogiosLog::fail("Pronounce: can't fork") if !defined $pid;
+    if (!$pid) { exec($self->{'PRONOUNCE'}, @args) or exit(1); }
+    $child{$pid} = $i;
+  }
+  waitpid($_, 0) for keys %child;
+
+  open(PLOG, ">>$self->{'LOGFILE'}");
+  for my $i (0 .. $jobs-1) {
+    if (open(CHUNK, "$base.$i.dict")) {
+      while (<CHUNK>) {
+        next if !/^([^\s(]+)(?:\(\d+\))?\s+(.*?)\s*$/;
+        push @{$table->{$1}}, $2;
+      }
+      close CHUNK;
+    }
+    if (open(CHUNK, "$base.$i.log")) { print PLOG <CHUNK>; close CHUNK; }
+    unlink("$base.$i.words", "$base.$i.dict", "$base.$i.log");
+  }
+  close PLOG;
+}
+
+
 # get the pronunciation from the website
 sub get_dic_web {
   my $self = shift;
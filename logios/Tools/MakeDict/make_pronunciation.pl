@@ -9,7 +9,9 @@ use File::Spec;
 # use Pronounce;  # load dynamically (see below)
 use Getopt::Long;
 
-my $usage = "usage: $0 -tools <dir> -dictdir <dir> -words <file> -handdict <file> -dict <file>\n";
+my $usage = "usage: $0 -tools <dir> -dictdir <dir> -words <file> -handdict <file> -dict <file>\n"
+  ."       $0 -tools <dir> -dictdir <dir> -batch <file> [-jobs <n>] [-cache <file>]\n"
+  ."  a batch file lists one job per line: <words file> <dict file> [<hand dict file>]\n";
 
 my $toolsdir = "";
 my $dictdir = "";
@@ -17,15 +19,21 @@ my $dictdir = "";
 my $words = "";  # input word list file
 my $handdict = ""; # hand edited pronunciations
 my $dict = "";   # output pronunciations file
+my $batch = "";  # list of word/dict/handdict jobs to resolve together
+my $jobs = 1;    # parallel pronounce processes
+my $cache = "";  # binary index of past pronunciations, reused across runs
 
-if (scalar @ARGV lt 10) { die "$usage\n"; }
 GetOptions( "words:s", \$words,
 	    "dict:s", \$dict,
 	    "handdict:s", \$handdict,
 	    "tools:s",\$toolsdir,
 	    "dictdir:s",\$dictdir,
+	    "batch:s",\$batch,
+	    "jobs:i",\$jobs,
+	    "cache:s",\$cache,
 	  );
-if (scalar @ARGV gt 0) { die "$usage\n"; }
+if (scalar @ARGV gt 0 or !$toolsdir or !$dictdir) { die "$usage\n"; }
+if (!$batch and (!$words or !$dict)) { die "$usage\n"; }
 
 my $lib = File::Spec->catfile($toolsdir,'MakeDict','lib','Pronounce.pm');
 require $lib;
@@ -36,6 +44,22 @@ my $pronounce = Pronounce->new('TOOLS' => $toolsdir,
                                'OUTFN' => $dict,
                                'LOGFN' => 'pronunciation.log',
 			       'SOURCE' => "",
+                               'BATCH' => $batch,
+                               'JOBS' => $jobs,
+                               'CACHE' => $cache,
     );
-$pronounce->do_pronounce;
+if (!$batch) {
+  $pronounce->do_pronounce;
+  exit;
+}
+
+open(BATCH, $batch) or die "can't open $batch\n";
+my @jobs;
+while (<BATCH>) {
+  my ($w, $d, $h) = split;
+  next if !defined $d or $w =~ /^#/;
+  push @jobs, [map { defined $_? File::Spec->rel2abs($_, $dictdir): undef } ($w, $h, $d)];
+}
+close BATCH;
+$pronounce->pronounce_batch(@jobs);
 
@@ -0,0 +1,63 @@
+
+#ifndef NGRAMCOUNT_H
+#define NGRAMCOUNT_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <tr1/unordered_map>
+
+#include "PCFG.h"
+
+using namespace std;
+
+/*
+ * N-gram counts, hashed on word ids, for writing in the CMU-Cambridge
+ * wngram format.  Sentences are counted with <s> and </s> around them,
+ * and n-grams do not cross sentence boundaries.
+ */
+class NGramCount {
+public:
+  typedef vector<int> key;
+  struct keyHash {
+    size_t operator()(const key& x) const {
+      size_t h = 2166136261U;
+      for(key::const_iterator i = x.begin(); i != x.end(); i++)
+	h = (h ^ (size_t)*i) * 16777619U;
+      return h;
+    }
+  };
+  typedef tr1::unordered_map<key, double, keyHash> table;
+
+protected:
+  int N;
+  tr1::unordered_map<string, int> vocab;
+  vector<string> word;
+  table count;
+
+public:
+  NGramCount(int n = 2) : N(n) {}
+
+  int order() const {return N;}
+  int wordId(const string& x);
+  const string& wordString(int x) const {return word[x];}
+  void add(const key& x, double amount = 1);
+  void add(const sentence& x);
+  void merge(const NGramCount& x);
+  void scale(double amount);
+  size_t size() const {return count.size();}
+
+  /* Counts of every n-gram seen in n sentences sampled from g, using
+   * the given number of threads.  Threads are seeded from rand(). */
+  static NGramCount sample(const PCFG& g, int n, unsigned int samples,
+			   int threads = 1);
+  /* Expected counts of unigrams or bigrams in one sentence from g,
+   * computed from the grammar without sampling. */
+  static NGramCount expected(const PCFG& g, int n);
+
+  /* Writes "w1 ... wn count" lines, sorted, with counts rounded to
+   * integers and those that round to 0 left out. */
+  friend ostream& operator<<(ostream& out, const NGramCount& x);
+};
+
+#endif
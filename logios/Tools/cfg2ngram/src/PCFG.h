@@ -124,8 +124,11 @@ public:
   vector<bool> reachableT() const;
   void reachable(int from, vector<bool>& already, vector<bool>& alreadyT) const;
   sentence generateSample() const;
-  corpus generateSamples(unsigned int n) const;
+  sentence generateSample(unsigned int *seed) const; //thread-safe
+  corpus generateSamples(unsigned int n, int threads = 1) const;
   string stats() const; //returns statistics like grammar size, etc.
+
+  friend class NGramCount;
   
 protected:
   void redoTMap();
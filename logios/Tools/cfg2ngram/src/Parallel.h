@@ -0,0 +1,18 @@
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <vector>
+
+using namespace std;
+
+/*
+ * Runs job(args[i]) for each i, each on its own thread, and waits for
+ * all of them.  Without POSIX threads they are run one after another.
+ */
+void runParallel(void *(*job)(void *), const vector<void *>& args);
+
+/* A well-mixed seed for the i-th of several random streams. */
+unsigned int streamSeed(unsigned int seed, unsigned int i);
+
+#endif
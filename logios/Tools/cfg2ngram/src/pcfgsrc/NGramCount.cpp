@@ -0,0 +1,293 @@
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <sstream>
+
+#include "NGramCount.h"
+#include "Parallel.h"
+#include "debug.h"
+
+int NGramCount::wordId(const string& x) {
+  tr1::unordered_map<string, int>::const_iterator i = vocab.find(x);
+  if(i != vocab.end())
+    return i->second;
+  int index = vocab[x] = word.size();
+  word.push_back(x);
+  return index;
+}
+
+void NGramCount::add(const key& x, double amount) {
+  count[x] += amount;
+}
+
+void NGramCount::add(const sentence& x) {
+  key ids;
+  ids.push_back(wordId("<s>"));
+  for(sentence::const_iterator i = x.begin(); i != x.end(); i++)
+    ids.push_back(wordId(*i));
+  ids.push_back(wordId("</s>"));
+  for(int i = 0; i + N <= (int)ids.size(); i++)
+    count[key(ids.begin() + i, ids.begin() + i + N)] += 1;
+}
+
+void NGramCount::merge(const NGramCount& x) {
+  vector<int> remap;
+  for(vector<string>::const_iterator i = x.word.begin(); i != x.word.end(); i++)
+    remap.push_back(wordId(*i));
+  for(table::const_iterator i = x.count.begin(); i != x.count.end(); i++) {
+    key k;
+    for(key::const_iterator j = i->first.begin(); j != i->first.end(); j++)
+      k.push_back(remap[*j]);
+    count[k] += i->second;
+  }
+}
+
+void NGramCount::scale(double amount) {
+  for(table::iterator i = count.begin(); i != count.end(); i++)
+    i->second *= amount;
+}
+
+struct CountJob {
+  const PCFG* g;
+  unsigned int n;
+  unsigned int seed;
+  NGramCount c;
+  CountJob(int order) : c(order) {}
+};
+
+static void* countJob(void* arg) {
+  CountJob* job = (CountJob*)arg;
+  for(unsigned int i = 0; i < job->n; i++)
+    job->c.add(job->g->generateSample(&job->seed));
+  return NULL;
+}
+
+NGramCount NGramCount::sample(const PCFG& g, int n, unsigned int samples,
+			      int threads) {
+  if(threads < 1) threads = 1;
+  //each thread counts its share of the samples, from its own seed
+  vector<CountJob> jobs(threads, CountJob(n));
+  vector<void*> args;
+  unsigned int seed = rand();
+  for(int i = 0; i < threads; i++) {
+    jobs[i].g = &g;
+    jobs[i].n = samples / threads + ((unsigned int)i < samples % threads);
+    jobs[i].seed = streamSeed(seed, i);
+    args.push_back(&jobs[i]);
+  }
+  runParallel(countJob, args);
+
+  NGramCount ret(jobs[0].c);
+  for(int i = 1; i < threads; i++)
+    ret.merge(jobs[i].c);
+  return ret;
+}
+
+typedef map<int, double> dist;
+
+static const int MAXITER = 10000;
+static const double EPSILON = 1e-12;
+
+//largest difference between two distributions
+static double distDistance(const dist& a, const dist& b) {
+  double d = 0;
+  dist::const_iterator i = a.begin(), j = b.begin();
+  while(i != a.end() || j != b.end()) {
+    if(j == b.end() || (i != a.end() && i->first < j->first)) {
+      d = max(d, fabs(i->second)); i++;
+    } else if(i == a.end() || j->first < i->first) {
+      d = max(d, fabs(j->second)); j++;
+    } else {
+      d = max(d, fabs(i->second - j->second)); i++; j++;
+    }
+  }
+  return d;
+}
+
+static void addScaled(dist& to, const dist& from, double amount) {
+  for(dist::const_iterator i = from.begin(); i != from.end(); i++)
+    to[i->first] += i->second * amount;
+}
+
+/*
+ * Rules with terminals as -1 - (word id) and nonterminals as their
+ * index, so the distributions below can be looked up directly.
+ */
+struct ExpectRule {
+  double p;
+  vector<int> x;
+};
+
+static void notConverging(const string& what) {
+  ostringstream o;
+  o << "expected " << what << " do not converge; "
+    << "the grammar's expected sentence length may be unbounded";
+  throw o.str();
+}
+
+NGramCount NGramCount::expected(const PCFG& g, int n) {
+  if(n < 1 || n > 2) {
+    ostringstream o;
+    o << "expected counts are only computed for unigrams and bigrams, not "
+      << n << "-grams";
+    throw o.str();
+  }
+  NGramCount ret(n);
+  int nNT = g.grammar.size();
+  vector< vector<ExpectRule> > G(nNT);
+  for(int a = 0; a < nNT; a++)
+    for(vector<PCFG::RHS>::const_iterator j = g.grammar[a].rule.begin();
+	j != g.grammar[a].rule.end();
+	j++) {
+      ExpectRule r;
+      r.p = j->probability;
+      for(vector<PCFG::RHSe>::const_iterator k = j->element.begin();
+	  k != j->element.end();
+	  k++)
+	r.x.push_back(k->terminal ? -1 - ret.wordId(k->word) : k->index);
+      G[a].push_back(r);
+    }
+  int bos = ret.wordId("<s>"), eos = ret.wordId("</s>");
+
+  //probability that each nonterminal yields nothing
+  vector<double> E(nNT, 0);
+  for(int iter = 0;; iter++) {
+    double change = 0;
+    vector<double> next(nNT, 0);
+    for(int a = 0; a < nNT; a++) {
+      for(vector<ExpectRule>::const_iterator r = G[a].begin(); r != G[a].end(); r++) {
+	double e = r->p;
+	for(vector<int>::const_iterator x = r->x.begin(); e > 0 && x != r->x.end(); x++)
+	  e *= *x < 0 ? 0 : E[*x];
+	next[a] += e;
+      }
+      change = max(change, fabs(next[a] - E[a]));
+    }
+    E.swap(next);
+    if(change < EPSILON) break;
+    if(iter == MAXITER) notConverging("empty yields");
+  }
+
+  //expected number of times each nonterminal is expanded per sentence
+  vector<double> N(nNT, 0);
+  for(int iter = 0;; iter++) {
+    double change = 0;
+    vector<double> next(nNT, 0);
+    next[g.head] = 1;
+    for(int a = 0; a < nNT; a++)
+      if(N[a] > 0)
+	for(vector<ExpectRule>::const_iterator r = G[a].begin(); r != G[a].end(); r++)
+	  for(vector<int>::const_iterator x = r->x.begin(); x != r->x.end(); x++)
+	    if(*x >= 0) next[*x] += N[a] * r->p;
+    for(int a = 0; a < nNT; a++)
+      change = max(change, fabs(next[a] - N[a]) / max(1.0, next[a]));
+    N.swap(next);
+    if(change < EPSILON) break;
+    if(iter == MAXITER) notConverging("rule counts");
+  }
+
+  if(n == 1) {
+    key k(1);
+    for(int a = 0; a < nNT; a++)
+      for(vector<ExpectRule>::const_iterator r = G[a].begin(); r != G[a].end(); r++)
+	for(vector<int>::const_iterator x = r->x.begin(); x != r->x.end(); x++)
+	  if(*x < 0) {
+	    k[0] = -1 - *x;
+	    ret.add(k, N[a] * r->p);
+	  }
+    k[0] = bos; ret.add(k, 1);
+    k[0] = eos; ret.add(k, 1);
+    return ret;
+  }
+
+  //distributions of the first and last words each nonterminal yields
+  vector<dist> F(nNT), L(nNT);
+  vector<dist> word(ret.word.size());
+  for(int w = 0; w < (int)word.size(); w++)
+    word[w][w] = 1;
+  for(int iter = 0;; iter++) {
+    double change = 0;
+    for(int a = 0; a < nNT; a++) {
+      dist f, l;
+      for(vector<ExpectRule>::const_iterator r = G[a].begin(); r != G[a].end(); r++) {
+	double p = r->p;
+	for(vector<int>::const_iterator x = r->x.begin(); p > 0 && x != r->x.end(); x++) {
+	  addScaled(f, *x < 0 ? word[-1 - *x] : F[*x], p);
+	  p *= *x < 0 ? 0 : E[*x];
+	}
+	p = r->p;
+	for(vector<int>::const_reverse_iterator x = r->x.rbegin(); p > 0 && x != r->x.rend(); x++) {
+	  addScaled(l, *x < 0 ? word[-1 - *x] : L[*x], p);
+	  p *= *x < 0 ? 0 : E[*x];
+	}
+      }
+      change = max(change, max(distDistance(f, F[a]), distDistance(l, L[a])));
+      F[a].swap(f);
+      L[a].swap(l);
+    }
+    if(change < EPSILON) break;
+    if(iter == MAXITER) notConverging("first and last words");
+  }
+
+  //every adjacent pair of words is counted in the rule that spans both
+  key k(2);
+  for(int a = 0; a < nNT; a++) {
+    if(N[a] == 0) continue;
+    for(vector<ExpectRule>::const_iterator r = G[a].begin(); r != G[a].end(); r++) {
+      for(int i = 0; i < (int)r->x.size(); i++) {
+	const dist& left = r->x[i] < 0 ? word[-1 - r->x[i]] : L[r->x[i]];
+	double p = N[a] * r->p;
+	for(int j = i + 1; p > 0 && j < (int)r->x.size(); j++) {
+	  const dist& right = r->x[j] < 0 ? word[-1 - r->x[j]] : F[r->x[j]];
+	  for(dist::const_iterator u = left.begin(); u != left.end(); u++)
+	    for(dist::const_iterator v = right.begin(); v != right.end(); v++) {
+	      k[0] = u->first; k[1] = v->first;
+	      ret.add(k, p * u->second * v->second);
+	    }
+	  p *= r->x[j] < 0 ? 0 : E[r->x[j]];
+	}
+      }
+    }
+  }
+  k[0] = bos;
+  for(dist::const_iterator v = F[g.head].begin(); v != F[g.head].end(); v++) {
+    k[1] = v->first;
+    ret.add(k, v->second);
+  }
+  k[1] = eos;
+  for(dist::const_iterator u = L[g.head].begin(); u != L[g.head].end(); u++) {
+    k[0] = u->first;
+    ret.add(k, u->second);
+  }
+  k[0] = bos;
+  ret.add(k, E[g.head]);
+  return ret;
+}
+
+struct NGramLine {
+  vector<string> w;
+  long count;
+  bool operator<(const NGramLine& x) const {return w < x.w;}
+};
+
+ostream& operator<<(ostream& out, const NGramCount& x) {
+  vector<NGramLine> lines;
+  for(NGramCount::table::const_iterator i = x.count.begin();
+      i != x.count.end();
+      i++) {
+    NGramLine l;
+    l.count = (long)(i->second + 0.5);
+    if(l.count <= 0) continue;
+    for(NGramCount::key::const_iterator j = i->first.begin(); j != i->first.end(); j++)
+      l.w.push_back(x.word[*j]);
+    lines.push_back(l);
+  }
+  sort(lines.begin(), lines.end());
+  for(vector<NGramLine>::const_iterator i = lines.begin(); i != lines.end(); i++) {
+    for(vector<string>::const_iterator j = i->w.begin(); j != i->w.end(); j++)
+      out << *j << ' ';
+    out << i->count << '\n';
+  }
+  return out;
+}
@@ -16,6 +16,7 @@
 #include <pcre.h>
 
 #include "PCFG.h"
+#include "Parallel.h"
 #include "debug.h"
 
 PCFG::PCFG() {}
@@ -1242,6 +1243,22 @@ void PCFG::normalize() {
 }
 
 sentence PCFG::generateSample() const {
+  return generateSample(NULL);
+}
+
+/*
+ * 15 random bits from rand(), or if seed is given, from the same
+ * generator as the POSIX example rand(), which is safe to use from
+ * several threads with their own seeds.
+ */
+static unsigned int random15(unsigned int *seed) {
+  if(seed == NULL)
+    return rand();
+  *seed = *seed * 1103515245U + 12345U;
+  return (*seed >> 16) & 0x7FFFU;
+}
+
+sentence PCFG::generateSample(unsigned int *seed) const {
   /* 
    * Algorithm: 
    * 1. start with RHSe list consisting of just the head
@@ -1264,7 +1281,7 @@ sentence PCFG::generateSample() const {
       s.push_back(top.word);
     } else {
       //find lhs rule
-      LHS lhs = grammar[top.index];
+      const LHS& lhs = grammar[top.index];
 
       //pick a rhs, j
       /*
@@ -1275,7 +1292,7 @@ sentence PCFG::generateSample() const {
        * and is plenty for this application.
        */
       const unsigned int MY_RAND_MAX = 0x7FFFU; 
-      double p = ((double)(rand()%MY_RAND_MAX) / ((double)(MY_RAND_MAX)+1.0L));
+      double p = ((double)(random15(seed)%MY_RAND_MAX) / ((double)(MY_RAND_MAX)+1.0L));
       vector<RHS>::const_iterator j;
       double r = 0;
       for(j = lhs.rule.begin(); j != lhs.rule.end(); j++) {
@@ -1294,11 +1311,42 @@ sentence PCFG::generateSample() const {
   return s;
 }
   
-corpus PCFG::generateSamples(unsigned int n) const {
+struct SampleJob {
+  const PCFG* g;
+  unsigned int n;
+  unsigned int seed;
+  corpus c;
+};
+
+static void* sampleJob(void* arg) {
+  SampleJob* job = (SampleJob*)arg;
+  for(unsigned int i = 0; i < job->n; i++)
+    job->c.push_back(job->g->generateSample(&job->seed));
+  return NULL;
+}
+
+corpus PCFG::generateSamples(unsigned int n, int threads) const {
   corpus c;
-  for(int i=0; i<n; i++) {
-    c.push_back(generateSample());
+  if(threads <= 1) {
+    for(int i=0; i<n; i++) {
+      c.push_back(generateSample());
+    }
+    return c;
+  }
+
+  //each thread makes its share of the corpus from its own seed
+  vector<SampleJob> jobs(threads);
+  vector<void*> args;
+  unsigned int seed = rand();
+  for(int i = 0; i < threads; i++) {
+    jobs[i].g = this;
+    jobs[i].n = n / threads + ((unsigned int)i < n % threads);
+    jobs[i].seed = streamSeed(seed, i);
+    args.push_back(&jobs[i]);
   }
+  runParallel(sampleJob, args);
+  for(int i = 0; i < threads; i++)
+    c.insert(c.end(), jobs[i].c.begin(), jobs[i].c.end());
   return c;
 }
 
@@ -0,0 +1,32 @@
+#include "Parallel.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+void runParallel(void *(*job)(void *), const vector<void *>& args) {
+#ifndef _WIN32
+  vector<pthread_t> thread(args.size());
+  vector<bool> started(args.size(), false);
+  for(unsigned int i = 1; i < args.size(); i++)
+    started[i] = pthread_create(&thread[i], NULL, job, args[i]) == 0;
+  if(!args.empty())
+    job(args[0]);
+  for(unsigned int i = 1; i < args.size(); i++) {
+    if(started[i])
+      pthread_join(thread[i], NULL);
+    else
+      job(args[i]); //couldn't get a thread, do it here
+  }
+#else
+  for(unsigned int i = 0; i < args.size(); i++)
+    job(args[i]);
+#endif
+}
+
+unsigned int streamSeed(unsigned int seed, unsigned int i) {
+  unsigned int x = seed + i * 0x9E3779B9U;
+  x = (x ^ (x >> 16)) * 0x85EBCA6BU;
+  x = (x ^ (x >> 13)) * 0xC2B2AE35U;
+  return x ^ (x >> 16);
+}
@@ -3,29 +3,43 @@
 #include <sstream>
 
 #include <stdlib.h>
+#include <time.h>
 #include "PCFG.h"
 #include "debug.h"
 
 string usage(const char* program_name) {
   ostringstream s;
-  s << "Usage: " << program_name << " {number of samples} {forms file} {grammar file}";
+  s << "Usage: " << program_name << " [-threads T] [-seed S]"
+    << " {number of samples} {forms file} {grammar file}";
   return s.str();
 }
 
 int main(int argc, char* argv[]) {
   DebugStream::threashold_ = DebugStream::I;
-  srand((unsigned)time(0));
+  unsigned int seed = (unsigned)time(0);
+  int threads = 1;
 
-  if(argc-1 < 3) {
+  int a = 1;
+  for(; a+1 < argc && argv[a][0] == '-'; a += 2) {
+    string opt(argv[a]);
+    if(opt == "-threads")
+      istringstream(argv[a+1]) >> threads;
+    else if(opt == "-seed")
+      istringstream(argv[a+1]) >> seed;
+    else
+      break;
+  }
+  if(argc-a < 3) {
     cerr << usage(argv[0]) << endl;
     exit(1);
   }
+  srand(seed);
 
-  unsigned int n; istringstream(argv[1]) >> n;
-  ifstream forms(argv[2]);
-  ifstream grammar(argv[3]);
+  unsigned int n; istringstream(argv[a]) >> n;
+  ifstream forms(argv[a+1]);
+  ifstream grammar(argv[a+2]);
   PCFG g(PCFG::readPhoenixGrammarAndForms(grammar, forms));
   info << "Got Phoenix forms and grammar file: " << endl 
        << g.stats() << endl;
-  cout << g.generateSamples(n);
+  cout << g.generateSamples(n, threads);
 }
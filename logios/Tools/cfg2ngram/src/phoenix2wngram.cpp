@@ -0,0 +1,68 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <stdlib.h>
+#include <time.h>
+#include "PCFG.h"
+#include "NGramCount.h"
+#include "debug.h"
+
+string usage(const char* program_name) {
+  ostringstream s;
+  s << "Usage: " << program_name
+    << " [-n N] [-threads T] [-seed S] [-expected]"
+    << " {number of samples} {forms file} {grammar file}";
+  return s.str();
+}
+
+int main(int argc, char* argv[]) {
+  DebugStream::threashold_ = DebugStream::I;
+  unsigned int seed = (unsigned)time(0);
+  int order = 3, threads = 1;
+  bool expected = false;
+
+  int a = 1;
+  for(; a < argc && argv[a][0] == '-'; a++) {
+    string opt(argv[a]);
+    if(opt == "-expected")
+      expected = true;
+    else if(a+1 < argc && opt == "-n")
+      istringstream(argv[++a]) >> order;
+    else if(a+1 < argc && opt == "-threads")
+      istringstream(argv[++a]) >> threads;
+    else if(a+1 < argc && opt == "-seed")
+      istringstream(argv[++a]) >> seed;
+    else {
+      cerr << usage(argv[0]) << endl;
+      exit(1);
+    }
+  }
+  if(argc-a < 3) {
+    cerr << usage(argv[0]) << endl;
+    exit(1);
+  }
+  srand(seed);
+
+  unsigned int n; istringstream(argv[a]) >> n;
+  ifstream forms(argv[a+1]);
+  ifstream grammar(argv[a+2]);
+  try {
+    PCFG g(PCFG::readPhoenixGrammarAndForms(grammar, forms));
+    info << "Got Phoenix forms and grammar file: " << endl 
+	 << g.stats() << endl;
+    NGramCount c(order);
+    if(expected) {
+      //counts for one sentence, scaled up to the size of a sampled corpus
+      c = NGramCount::expected(g, order);
+      c.scale(n);
+    } else
+      c = NGramCount::sample(g, order, n, threads);
+    info << c.size() << ' ' << order << "-grams" << endl;
+    cout << c;
+  } catch(const string& e) {
+    cerr << e << endl;
+    exit(1);
+  }
+}
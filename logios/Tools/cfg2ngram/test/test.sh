@@ -4,3 +4,8 @@ time ../src/phoenix2corpus 100000 forms.txt MeetingLine.gra > /tmp/corptest
 head /tmp/corptest
 rm -f /tmp/corptest
 
+
+time ../src/phoenix2wngram -threads 4 -n 2 100000 forms.txt MeetingLine.gra > /tmp/wngramtest
+time ../src/phoenix2wngram -expected -n 2 100000 forms.txt MeetingLine.gra > /tmp/wngramexp
+head /tmp/wngramtest /tmp/wngramexp
+rm -f /tmp/wngramtest /tmp/wngramexp
@@ -53,6 +53,7 @@
 #include <sphinxbase/byteorder.h>
 #include <sphinxbase/feat.h>
 #include <sphinxbase/bio.h>
+#include <sphinxbase/profile.h>
 
 /* Local headers. */
 #include "cmdln_macro.h"
@@ -191,6 +192,12 @@ acmod_retain(acmod_t *acmod)
 
 acmod_t *
 acmod_copy(acmod_t *other)
+{
+    return acmod_copy_featbuf(other, other->fb);
+}
+
+acmod_t *
+acmod_copy_featbuf(acmod_t *other, featbuf_t *fb)
 {
     acmod_t *acmod;
 
@@ -201,8 +208,8 @@ acmod_copy(acmod_t *other)
     acmod->mdef = bin_mdef_retain(other->mdef);
     acmod->tmat = tmat_retain(other->tmat);
     acmod->mgau = ps_mgau_copy(other->mgau);
-    acmod->fb = featbuf_retain(other->fb);
-    acmod->fcb = other->fcb; /* Implicitly retained with fb, I think */
+    acmod->fb = featbuf_retain(fb);
+    acmod->fcb = featbuf_get_fcb(acmod->fb);
 
     /* Senone computation stuff. */
     acmod->senone_scores = ckd_calloc(bin_mdef_n_sen(acmod->mdef),
@@ -223,8 +230,11 @@ acmod_consumer_wait(acmod_t *acmod, int timeout)
 {
     int rv;
 
-    if ((rv = featbuf_consumer_wait(acmod->fb, acmod->output_frame,
-                                    timeout, acmod->feat_buf[0][0])) < 0) {
+    PTRACE_BEGIN("acmod", "wait");
+    rv = featbuf_consumer_wait(acmod->fb, acmod->output_frame,
+                               timeout, acmod->feat_buf[0][0]);
+    PTRACE_END("acmod", "wait");
+    if (rv < 0) {
         E_INFO("EOU in frame %d\n", acmod->output_frame);
         /* This means end of utterance. */
         acmod->eou = TRUE;
@@ -245,6 +255,8 @@ acmod_score(acmod_t *acmod, int frame_idx)
     acmod_flags2list(acmod);
 
     /* Generate scores for the next available frame */
+    PTRACE_COUNTER("senones_active", acmod->n_senone_active);
+    PTRACE_BEGIN("acmod", "frame_eval");
     ps_mgau_frame_eval(acmod->mgau,
                        acmod->senone_scores,
                        acmod->senone_active,
@@ -252,6 +264,7 @@ acmod_score(acmod_t *acmod, int frame_idx)
                        acmod->feat_buf[0],
                        frame_idx,
                        acmod->compallsen);
+    PTRACE_END("acmod", "frame_eval");
 
     return acmod->senone_scores;
 }
@@ -162,6 +162,15 @@ acmod_t *acmod_init(cmd_ln_t *config, logmath_t *lmath, featbuf_t *fb);
  */
 acmod_t *acmod_copy(acmod_t *acmod);
 
+/**
+ * Create a partial copy of an acoustic model reading from another
+ * feature buffer.
+ *
+ * As acmod_copy(), but the copy obtains its features from fb, so it
+ * can decode a different stream of audio.
+ */
+acmod_t *acmod_copy_featbuf(acmod_t *acmod, featbuf_t *fb);
+
 /**
  * Retain a pointer to an acoustic model.
  *
@@ -57,7 +57,9 @@ struct arc_buffer_s {
     sbmtx_t *mtx;
     sbsem_t *start, *release;
     sbevent_t *evt;
+    sbevent_t *space; /**< Signalled when the consumer catches up. */
     garray_t *arcs;
+    garray_t *wids;  /**< Word ID of each arc, in the same order. */
     garray_t *sf_idx;
     garray_t *rc_deltas;
     bptbl_t *input_bptbl;
@@ -71,6 +73,11 @@ struct arc_buffer_s {
     int next_sf;   /**< First frame not containing arcs (last frame + 1). */
     bpidx_t next_idx;  /**< Next bptbl index to scan from. */
     int active_arc; /**< First incoming arc. */
+    int high_sf, low_sf; /**< Watermarks for producer back-pressure. */
+    int consumer_waiting; /**< Consumer is waiting for arcs. */
+    int max_n_arcs, max_lag_sf;
+    int n_stalls;
+    ptmr_t stall;
 };
 
 /* Internal functions for producers only. */
@@ -87,10 +94,13 @@ arc_buffer_init(char const *name, bptbl_t *input_bptbl,
     fab->refcount = 1;
     fab->name = ckd_salloc(name);
     fab->sf_idx = garray_init(0, sizeof(int));
+    fab->wids = garray_init(0, sizeof(int32));
     fab->start = sbsem_init("arc_buffer:start",0);
     fab->release = sbsem_init("arc_buffer:release",0);
     fab->evt = sbevent_init(FALSE);
+    fab->space = sbevent_init(FALSE);
     fab->mtx = sbmtx_init();
+    ptmr_init(&fab->stall);
     fab->input_bptbl = bptbl_retain(input_bptbl);
     if (lm)
         fab->lm = ngram_model_retain(lm);
@@ -129,10 +139,12 @@ arc_buffer_free(arc_buffer_t *fab)
 
     garray_free(fab->sf_idx);
     garray_free(fab->arcs);
+    garray_free(fab->wids);
     garray_free(fab->rc_deltas);
     sbsem_free(fab->start);
     sbsem_free(fab->release);
     sbevent_free(fab->evt);
+    sbevent_free(fab->space);
     sbmtx_free(fab->mtx);
     bptbl_free(fab->input_bptbl);
     ngram_model_free(fab->lm);
@@ -166,6 +178,34 @@ arc_buffer_lm(arc_buffer_t *fab)
     return fab->lm;
 }
 
+void
+arc_buffer_set_watermarks(arc_buffer_t *fab, int high_sf, int low_sf)
+{
+    if (low_sf > high_sf)
+        low_sf = high_sf;
+    fab->high_sf = high_sf;
+    fab->low_sf = low_sf;
+}
+
+static int
+arc_buffer_lag_sf(arc_buffer_t *fab)
+{
+    return fab->active_sf - garray_base(fab->sf_idx);
+}
+
+void
+arc_buffer_get_stats(arc_buffer_t *fab, arc_buffer_stats_t *out_stats)
+{
+    arc_buffer_lock(fab);
+    out_stats->n_arcs = fab->active_arc - garray_base(fab->arcs);
+    out_stats->max_n_arcs = fab->max_n_arcs;
+    out_stats->lag_sf = arc_buffer_lag_sf(fab);
+    out_stats->max_lag_sf = fab->max_lag_sf;
+    out_stats->n_stalls = fab->n_stalls;
+    out_stats->stall_sec = fab->stall.t_elapsed;
+    arc_buffer_unlock(fab);
+}
+
 
 void
 arc_buffer_dump(arc_buffer_t *fab, dict_t *dict)
@@ -220,6 +260,8 @@ arc_buffer_consumer_start_utt(arc_buffer_t *fab, int timeout)
 int
 arc_buffer_consumer_end_utt(arc_buffer_t *fab)
 {
+    fab->consumer_waiting = TRUE;
+    sbevent_signal(fab->space);
     return sbsem_up(fab->release);
 }
 
@@ -231,7 +273,12 @@ arc_buffer_producer_start_utt(arc_buffer_t *fab, char *uttid)
     fab->next_idx = 0;
     fab->state = ARC_BUFFER_RUNNING;
     fab->uttid = uttid;
+    fab->consumer_waiting = FALSE;
+    fab->max_n_arcs = fab->max_lag_sf = 0;
+    fab->n_stalls = 0;
+    ptmr_reset(&fab->stall);
     garray_reset(fab->arcs);
+    garray_reset(fab->wids);
     garray_reset(fab->sf_idx);
     /* If we ever have multiple consumers this will be sbsem_set() */
     E_INFO("arc_buffer_producer_start_utt\n");
@@ -274,6 +321,7 @@ arc_buffer_add_bps(arc_buffer_t *fab,
              * length array rc_bits. */
             sarc_t *sp = garray_append(fab->arcs, &sarc);
 
+            garray_append(fab->wids, &sarc.arc.wid);
             E_DEBUG(3,("Added arc %s %d -> %d\n",
                        dict_wordstr(bptbl->d2p->dict, sarc.arc.wid),
                        sarc.arc.src, sarc.arc.dest + 1));
@@ -341,11 +389,43 @@ arc_buffer_max_n_rc(arc_buffer_t *fab)
     return fab->max_n_rc;
 }
 
+/**
+ * Wait for the consumer to release enough frames, if necessary.
+ */
+static void
+arc_buffer_producer_throttle(arc_buffer_t *fab)
+{
+    if (fab->high_sf <= 0)
+        return;
+    arc_buffer_lock(fab);
+    if (arc_buffer_lag_sf(fab) < fab->high_sf) {
+        arc_buffer_unlock(fab);
+        return;
+    }
+    ++fab->n_stalls;
+    ptmr_start(&fab->stall);
+    PTRACE_BEGIN("arc_buffer", "stall");
+    /* The consumer signals fab->space after it releases frames and
+     * whenever it is about to wait for us, in which case it cannot
+     * release anything else until we give it more arcs. */
+    while (fab->state == ARC_BUFFER_RUNNING
+           && !fab->consumer_waiting
+           && arc_buffer_lag_sf(fab) > fab->low_sf) {
+        arc_buffer_unlock(fab);
+        sbevent_wait(fab->space, -1, -1);
+        arc_buffer_lock(fab);
+    }
+    PTRACE_END("arc_buffer", "stall");
+    ptmr_stop(&fab->stall);
+    arc_buffer_unlock(fab);
+}
+
 bpidx_t
 arc_buffer_producer_sweep(arc_buffer_t *fab, int release)
 {
     int next_sf;
 
+    arc_buffer_producer_throttle(fab);
     arc_buffer_lock(fab);
     next_sf = bptbl_active_sf(fab->input_bptbl);
     if (arc_buffer_extend(fab, next_sf) > 0) {
@@ -393,6 +473,10 @@ arc_buffer_producer_end_utt(arc_buffer_t *fab, int release)
         E_INFO("%s: allocated %d right context deltas (%d KiB)\n", fab->name,
                garray_alloc_size(fab->rc_deltas),
                garray_alloc_size(fab->rc_deltas) * sizeof(rcdelta_t) / 1024);
+    E_INFO("%s: at most %d arcs in %d frames queued, "
+           "producer held back %d times (%.3f sec)\n", fab->name,
+           fab->max_n_arcs, fab->max_lag_sf, fab->n_stalls,
+           fab->stall.t_elapsed);
 
     nth = fab->refcount - 1;
     E_INFO("Waiting for %d consumers to finish\n", nth);
@@ -409,6 +493,7 @@ arc_buffer_commit(arc_buffer_t *fab)
     size_t n_arcs;
     int n_active_fr, i, prev_count;
     garray_t *active_arc;
+    garray_t *active_wid;
     garray_t *active_sf;
     int *sf;
 
@@ -436,6 +521,7 @@ arc_buffer_commit(arc_buffer_t *fab)
         /* Permute incoming arcs to match frame counters */
         active_sf = garray_slice(fab->sf_idx, fab->active_sf, n_active_fr);
         active_arc = garray_slice(fab->arcs, fab->active_arc, n_arcs);
+        active_wid = garray_slice(fab->wids, fab->active_arc, n_arcs);
 
         for (i = 0; i < n_arcs; ++i) {
             arc_t *arc = (arc_t *)garray_void(active_arc, i);
@@ -443,17 +529,24 @@ arc_buffer_commit(arc_buffer_t *fab)
                                   arc->src - fab->active_sf);
             /* Copy it into place. */
             memcpy(garray_void(fab->arcs, *pos), arc, fab->arc_size);
+            garray_ent(fab->wids, int32, *pos)
+                = garray_ent(active_wid, int32, i);
             /* Increment local frame counter. */
             *pos += 1;
         }
 
         garray_free(active_sf);
         garray_free(active_arc);
+        garray_free(active_wid);
     }
 
     /* Update frame and arc pointers. */
     fab->active_sf += n_active_fr;
     fab->active_arc += n_arcs;
+    if (fab->active_arc - garray_base(fab->arcs) > fab->max_n_arcs)
+        fab->max_n_arcs = fab->active_arc - garray_base(fab->arcs);
+    if (arc_buffer_lag_sf(fab) > fab->max_lag_sf)
+        fab->max_lag_sf = arc_buffer_lag_sf(fab);
 
     /* Signal consumer thread. */
     sbevent_signal(fab->evt);
@@ -473,6 +566,24 @@ arc_buffer_iter(arc_buffer_t *fab, int sf)
 
 }
 
+int
+arc_buffer_wids(arc_buffer_t *fab, int sf, int ef, int32 const **out_wids)
+{
+    int start, end;
+
+    if (sf < garray_base(fab->sf_idx) || sf >= fab->active_sf || ef <= sf)
+        return 0;
+    start = garray_ent(fab->sf_idx, int, sf);
+    if (ef >= fab->active_sf)
+        end = fab->active_arc;
+    else
+        end = garray_ent(fab->sf_idx, int, ef);
+    if (end <= start)
+        return 0;
+    *out_wids = garray_ptr(fab->wids, int32, start);
+    return end - start;
+}
+
 arc_t *
 arc_buffer_iter_next(arc_buffer_t *fab, arc_t *ab)
 {
@@ -486,6 +597,7 @@ int
 arc_buffer_producer_shutdown(arc_buffer_t *fab)
 {
     fab->state = ARC_BUFFER_CANCELED;
+    sbevent_signal(fab->space);
     return sbsem_up(fab->start);
 }
 
@@ -493,9 +605,16 @@ int
 arc_buffer_consumer_wait(arc_buffer_t *fab, int timeout)
 {
     int sec = timeout / 1000000000;
+    int rv;
+
     if (timeout == -1)
         sec = -1;
-    if (sbevent_wait(fab->evt, sec, timeout) < 0)
+    /* Let the producer go if it is waiting for us. */
+    fab->consumer_waiting = TRUE;
+    sbevent_signal(fab->space);
+    rv = sbevent_wait(fab->evt, sec, timeout);
+    fab->consumer_waiting = FALSE;
+    if (rv < 0)
         return -1;
     if (fab->state == ARC_BUFFER_CANCELED)
         return -1;
@@ -517,8 +636,12 @@ arc_buffer_consumer_release(arc_buffer_t *fab, int first_sf)
     garray_set_base(fab->sf_idx, first_sf);
     garray_shift_from(fab->arcs, next_first_arc);
     garray_set_base(fab->arcs, next_first_arc);
+    garray_shift_from(fab->wids, next_first_arc);
+    garray_set_base(fab->wids, next_first_arc);
     /* FIXME: Have to also release rc deltas, but they are not in the
      * same order so this may not be entirely safe. */
+    if (fab->high_sf > 0 && arc_buffer_lag_sf(fab) <= fab->low_sf)
+        sbevent_signal(fab->space);
     arc_buffer_unlock(fab);
 
     return 0;
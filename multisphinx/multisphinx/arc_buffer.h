@@ -46,6 +46,7 @@
 #include <sphinxbase/garray.h>
 #include <sphinxbase/sbthread.h>
 #include <sphinxbase/bitvec.h>
+#include <sphinxbase/profile.h>
 
 /* MultiSphinx headers. */
 #include <multisphinx/bptbl.h>
@@ -85,6 +86,18 @@ typedef struct sarc_s {
 
 typedef struct arc_buffer_s arc_buffer_t;
 
+/**
+ * Queue depth and lag statistics for an arc buffer.
+ */
+typedef struct arc_buffer_stats_s {
+    int n_arcs;       /**< Arcs committed and not yet released. */
+    int max_n_arcs;   /**< Maximum of n_arcs in this utterance. */
+    int lag_sf;       /**< Frames committed and not yet released. */
+    int max_lag_sf;   /**< Maximum of lag_sf in this utterance. */
+    int n_stalls;     /**< Number of times the producer was held back. */
+    double stall_sec; /**< Wall time the producer spent held back. */
+} arc_buffer_stats_t;
+
 /**
  * Create a new arc buffer.
  */
@@ -113,6 +126,26 @@ bptbl_t *arc_buffer_input_bptbl(arc_buffer_t *fab);
  */
 ngram_model_t *arc_buffer_lm(arc_buffer_t *fab);
 
+/**
+ * Limit how far the producer can get ahead of the consumer.
+ *
+ * Once the consumer has not yet released @a high_sf or more frames,
+ * arc_buffer_producer_sweep() blocks until it has released enough
+ * of them to get down to @a low_sf.  The producer is never held back
+ * while the consumer is waiting for arcs, so this cannot deadlock,
+ * but @a high_sf should be larger than the number of frames the
+ * consumer needs to look ahead or it will not do much good.
+ *
+ * @param high_sf High watermark in frames, or 0 for no limit.
+ * @param low_sf Low watermark in frames, must not exceed @a high_sf.
+ */
+void arc_buffer_set_watermarks(arc_buffer_t *fab, int high_sf, int low_sf);
+
+/**
+ * Get queue depth and lag statistics for the current utterance.
+ */
+void arc_buffer_get_stats(arc_buffer_t *fab, arc_buffer_stats_t *out_stats);
+
 /**
  * Dump contents of arc buffer for debugging.
  */
@@ -127,6 +160,9 @@ void arc_buffer_producer_start_utt(arc_buffer_t *fab, char *uttid);
  * Sweep newly available arcs from the bptbl into the arc buffer and
  * commit them.
  *
+ * If the consumer has fallen behind by the high watermark (see
+ * arc_buffer_set_watermarks()), this waits for it to catch up first.
+ *
  * @param release If true, release arcs from input_bptbl.
  * @return The first backpointer index between start and end which
  *         starts after the next active frame, i.e. the first
@@ -170,6 +206,22 @@ arc_t *arc_buffer_iter(arc_buffer_t *fab, int sf);
  */
 arc_t *arc_buffer_iter_next(arc_buffer_t *fab, arc_t *ab);
 
+/**
+ * Get the word IDs of all arcs starting in a range of frames.
+ *
+ * Word IDs are also stored in an array of their own, in the same
+ * order as the arcs, so that consumers which only need to know what
+ * words are present can scan them without walking the arcs.  Like
+ * the pointers returned by arc_buffer_iter(), this is only valid
+ * while the arc buffer is locked.
+ *
+ * @param sf First start frame.
+ * @param ef Start frame after the last one wanted.
+ * @param out_wids Output: pointer to the first word ID.
+ * @return Number of word IDs, or 0 if frames are not available.
+ */
+int arc_buffer_wids(arc_buffer_t *fab, int sf, int ef, int32 const **out_wids);
+
 /**
  * Get the score corresponding to a right context entry for an arc.
  */
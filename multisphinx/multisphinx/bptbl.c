@@ -233,7 +233,7 @@ bptbl_mark_all(bptbl_t *bptbl, int ef, int cf)
 static int
 bptbl_mark(bptbl_t *bptbl, int ef, int cf)
 {
-    int i, j, n_active_fr, last_gc_fr;
+    int i, j;
 
     assert(ef > bptbl_active_frame(bptbl));
 
@@ -254,9 +254,6 @@ bptbl_mark(bptbl_t *bptbl, int ef, int cf)
                bptbl_ef_idx(bptbl, ef), bptbl_ef_idx(bptbl, cf)));
     /* Mark everything immediately reachable from (ef..cf) */
     bitvec_clear_all(bptbl->valid_fr, cf - bptbl_active_frame(bptbl));
-    n_active_fr = 0;
-    /* NOTE: This for statement can be sped up at the cost of being
-     * less obvious. */
     for (i = bptbl_ef_idx(bptbl, ef);
          i < bptbl_ef_idx(bptbl, cf); ++i) {
         bp_t *ent, *prev;
@@ -265,55 +262,31 @@ bptbl_mark(bptbl_t *bptbl, int ef, int cf)
         prev = bptbl_ent(bptbl, ent->bp);
         if (!ent->valid) /* May be invalidated by maxwpf */
             continue;
-        if (prev != NULL) {
-            int frame = prev->frame;
-            if (frame >= bptbl_active_frame(bptbl)
-                && bitvec_is_clear(bptbl->valid_fr,
-                                   frame - bptbl_active_frame(bptbl))) {
-                E_DEBUG(5,("Validate frame %d\n", frame - bptbl_active_frame(bptbl)));
-                bitvec_set(bptbl->valid_fr, frame - bptbl_active_frame(bptbl));
-                ++n_active_fr;
-            }
+        if (prev != NULL && prev->frame >= bptbl_active_frame(bptbl)) {
+            E_DEBUG(5,("Validate frame %d\n", prev->frame - bptbl_active_frame(bptbl)));
+            bitvec_set(bptbl->valid_fr, prev->frame - bptbl_active_frame(bptbl));
         }
     }
-    
-    /* Track the last frame with outgoing backpointers for gc */
-    last_gc_fr = ef - 1;
-    /* Walk back from every frame marked active up to the last one
-     * marked active in the previous round (this means we scan some of
-     * them multiple times, if this gets slow this can be
-     * optimized). */
-    while (n_active_fr > 0) {
-        int next_gc_fr = 0;
-        n_active_fr = 0;
-        for (i = bptbl_active_frame(bptbl); i <= last_gc_fr; ++i) {
-            /* NOTE: We asserted i >= bptbl_active_frame(bptbl) */
-            if (bitvec_is_set(bptbl->valid_fr, i - bptbl_active_frame(bptbl))) {
-                bitvec_clear(bptbl->valid_fr, i - bptbl_active_frame(bptbl));
-                /* Add all backpointers in this frame (the bogus
-                 * lattice generation algorithm) */
-                for (j = bptbl_ef_idx(bptbl, i);
-                     j < bptbl_ef_idx(bptbl, i + 1); ++j) {
-                    bp_t *ent = bptbl_ent(bptbl, j);
-                    bp_t *prev = bptbl_ent(bptbl, ent->bp);
-                    ent->valid = TRUE;
-                    if (prev != NULL) {
-                        int frame = prev->frame;
-                        if (frame >= bptbl_active_frame(bptbl)
-                            && bitvec_is_clear(bptbl->valid_fr,
-                                               frame - bptbl_active_frame(bptbl))) {
-                            bitvec_set(bptbl->valid_fr,
-                                       frame - bptbl_active_frame(bptbl));
-                            ++n_active_fr;
-                        }
-                        if (frame > next_gc_fr)
-                            next_gc_fr = frame;
-                    }
-                }
-            }
+
+    /* A backpointer never points to an entry exiting in a later
+     * frame, so a single sweep backwards from the last frame before
+     * ef reaches every frame which can still be marked, and the cost
+     * of marking is linear in the size of the active window. */
+    for (i = ef - 1; i >= bptbl_active_frame(bptbl); --i) {
+        if (bitvec_is_clear(bptbl->valid_fr, i - bptbl_active_frame(bptbl)))
+            continue;
+        bitvec_clear(bptbl->valid_fr, i - bptbl_active_frame(bptbl));
+        /* Add all backpointers in this frame (the bogus lattice
+         * generation algorithm) */
+        for (j = bptbl_ef_idx(bptbl, i);
+             j < bptbl_ef_idx(bptbl, i + 1); ++j) {
+            bp_t *ent = bptbl_ent(bptbl, j);
+            bp_t *prev = bptbl_ent(bptbl, ent->bp);
+            ent->valid = TRUE;
+            if (prev != NULL && prev->frame >= bptbl_active_frame(bptbl))
+                bitvec_set(bptbl->valid_fr,
+                           prev->frame - bptbl_active_frame(bptbl));
         }
-        E_DEBUG(3,("last_gc_fr %d => %d\n", last_gc_fr, next_gc_fr));
-        last_gc_fr = next_gc_fr;
     }
     E_DEBUG(2,("Removed"));
     for (j = 0, i = bptbl_ef_idx(bptbl, bptbl_active_frame(bptbl));
@@ -141,6 +141,10 @@
       ARG_BOOLEAN,                                                                              \
       "yes",                                                                                    \
       "Run forward lexicon-tree search (1st pass)" },                                           \
+{ "-fwdtreethreads",                                                                            \
+      ARG_INT32,                                                                                \
+      "1",                                                                                      \
+      "Number of threads evaluating HMMs in forward lexicon-tree search" },                     \
 { "-fwdflat",                                                                                   \
       ARG_BOOLEAN,                                                                              \
       "yes",                                                                                    \
@@ -176,7 +180,23 @@
 { "-fwdflatsfwin",                                                                              \
       ARG_INT32,                                                                                \
       "25",                                                                    	                \
-      "Window of frames in lattice to search for successor words in fwdflat search " }
+      "Window of frames in lattice to search for successor words in fwdflat search " }, \
+{ "-arcbufhwm",                                                                                 \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Frames a search pass may get ahead of the next one before waiting for it (0 for no limit)" }, \
+{ "-arcbuflwm",                                                                                 \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Frames the next search pass must catch up to before a waiting one continues" }, \
+{ "-latwindow",                                                                                 \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Frames of lattice kept open by lattice generation before older parts are finalized (0 for whole utterance)" }, \
+{ "-outlatdir",                                                                                 \
+      ARG_STRING,                                                                               \
+      NULL,                                                                                     \
+      "Directory to write finalized parts of lattices to" }
 
 /** Command-line options for finite state grammars. */
 #define FSG_OPTIONS \
@@ -1113,28 +1113,28 @@ static void fwdflat_search_add_expand_word(fwdflat_search_t *ffs, int32 wid)
 
 static int fwdflat_search_expand_arcs(fwdflat_search_t *ffs, int sf, int ef)
 {
-    arc_t *arc_start, *arc_end, *arc;
+    int32 const *arc_wids;
+    int i, n_arcs;
 
-    arc_start = arc_buffer_iter(search_input_arcs(ffs), sf);
-    arc_end = arc_buffer_iter(search_input_arcs(ffs), ef);
-    E_DEBUG(2,("Expanding %ld arcs in %d:%d\n",
-                    arc_end > arc_start ? arc_end - arc_start : 0, sf, ef));
+    n_arcs = arc_buffer_wids(search_input_arcs(ffs), sf, ef, &arc_wids);
+    E_DEBUG(2,("Expanding %d arcs in %d:%d\n", n_arcs, sf, ef));
     bitvec_clear_all(ffs->expand_words, search_n_words(ffs));
-    for (arc = arc_start; arc != arc_end; arc = arc_buffer_iter_next(
-            search_input_arcs(ffs), arc)) {
+    for (i = 0; i < n_arcs; ++i) {
+        int32 wid = arc_wids[i];
+
         /* Expand things in the vocabulary map, if we have one. */
         if (ffs->vmap) {
             int32 const *wids;
             int32 nwids;
-            if ((wids = vocab_map_unmap(ffs->vmap, arc->wid, &nwids)) != NULL) {
-                int32 i;
-                for (i = 0; i < nwids; ++i)
-                    fwdflat_search_add_expand_word(ffs, wids[i]);
+            if ((wids = vocab_map_unmap(ffs->vmap, wid, &nwids)) != NULL) {
+                int32 j;
+                for (j = 0; j < nwids; ++j)
+                    fwdflat_search_add_expand_word(ffs, wids[j]);
                 continue;
             }
         }
         /* Otherwise, just expand the word normally. */
-        fwdflat_search_add_expand_word(ffs, arc->wid);
+        fwdflat_search_add_expand_word(ffs, wid);
     }
     return 0;
 }
@@ -1232,15 +1232,20 @@ static int fwdflat_search_decode(search_t *base)
             ptmr_start(&ffs->base.t);
 
             /* Lock the arc buffer while we expand arcs. */
+            PTRACE_BEGIN("search", "fwdflat_expand_arcs");
             arc_buffer_lock(search_input_arcs(ffs));
             end_win = frame_idx + ffs->max_sf_win;
             start_win = frame_idx - ffs->max_sf_win;
             if (start_win < 0) start_win = 0;
             fwdflat_search_expand_arcs(ffs, start_win, end_win);
             arc_buffer_unlock(search_input_arcs(ffs));
+            PTRACE_END("search", "fwdflat_expand_arcs");
 
             /* Now do our search. */
-            if ((k = fwdflat_search_one_frame(ffs, frame_idx)) <= 0)
+            PTRACE_BEGIN("search", "fwdflat");
+            k = fwdflat_search_one_frame(ffs, frame_idx);
+            PTRACE_END("search", "fwdflat");
+            if (k <= 0)
             break;
             frame_idx += k;
             arc_buffer_consumer_release(search_input_arcs(ffs), start_win);
@@ -1249,7 +1254,9 @@ static int fwdflat_search_decode(search_t *base)
     }
     arc_buffer_consumer_end_utt(search_input_arcs(ffs));
     ptmr_start(&ffs->base.t);
+    PTRACE_BEGIN("search", "fwdflat_finish");
     fwdflat_search_finish(search_base(ffs));
+    PTRACE_END("search", "fwdflat_finish");
     ptmr_stop(&ffs->base.t);
     return frame_idx;
 
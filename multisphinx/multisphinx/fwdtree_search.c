@@ -46,6 +46,7 @@
 /* SphinxBase headers. */
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/listelem_alloc.h>
+#include <sphinxbase/sbthread.h>
 #include <sphinxbase/err.h>
 
 /* Local headers. */
@@ -188,6 +189,22 @@ typedef struct fwdtree_stats_s {
     int32 n_senone_active_utt;
 } fwdtree_stats_t;
 
+/**
+ * Share of HMM evaluation done by one thread in each frame.
+ *
+ * Partition 0 is done by the search thread itself, the others by
+ * helper threads which wait on @a go and signal @a done.
+ */
+typedef struct fwdtree_part_s {
+    struct fwdtree_search_s *fts;
+    int idx;
+    sbthread_t *thr;
+    sbevent_t *go, *done;
+    int32 bestscore;
+    int32 n_root_chan_eval;
+    int32 n_nonroot_chan_eval;
+} fwdtree_part_t;
+
 /**
  * Approximate tree-based forward search.
  */
@@ -327,6 +344,15 @@ typedef struct fwdtree_search_s {
 
     fwdtree_stats_t st; /**< Various statistics for profiling. */
 
+    /**
+     * Partitions of root and active non-root channels evaluated in
+     * parallel, or NULL if everything is done in the search thread.
+     */
+    fwdtree_part_t *parts;
+    int n_parts;
+    int eval_frame;  /**< Frame being evaluated by helpers. */
+    int quit;        /**< Tell helper threads to exit. */
+
     /* A children's treasury of beam widths. */
     int32 beam;
     int32 dynamic_beam;
@@ -396,6 +422,8 @@ static int32 evaluate_channels(fwdtree_search_t *fts,
 static int32 eval_word_chan(fwdtree_search_t *fts, int frame_idx);
 static int32 eval_nonroot_chan(fwdtree_search_t *fts, int frame_idx);
 static int32 eval_root_chan(fwdtree_search_t *fts, int frame_idx);
+static void fwdtree_search_start_parts(fwdtree_search_t *fts, int n_parts);
+static void fwdtree_search_stop_parts(fwdtree_search_t *fts);
 static void renormalize_scores(fwdtree_search_t *fts,
                                int frame_idx, int32 norm);
 static void compute_sen_active(fwdtree_search_t *fts, int frame_idx);
@@ -444,8 +472,14 @@ fwdtree_search_init(search_t *other, cmd_ln_t *config, acmod_t *acmod, dict2pid_
     fts->active_word_list = ckd_calloc_2d(2, dict_size(d2p->dict),
                                           sizeof(**fts->active_word_list));
 
+    /* Share the language model(s) of another search, if given.  The
+     * models lock their caches, so it can be scored from another thread. */
+    if (other && search_lmset(other)) {
+        fts->lmset = ngram_model_retain(search_lmset(other));
+        E_INFO("Sharing language model with %s\n", search_name(other));
+    }
     /* Load language model(s) */
-    if ((path = cmd_ln_str_r(config, "-lmctl"))) {
+    else if ((path = cmd_ln_str_r(config, "-lmctl"))) {
         fts->lmset = ngram_model_set_read(config, path, acmod->lmath);
         if (fts->lmset == NULL) {
             E_ERROR("Failed to read language model control file: %s\n",
@@ -492,6 +526,7 @@ fwdtree_search_init(search_t *other, cmd_ln_t *config, acmod_t *acmod, dict2pid_
                                    sizeof(*fts->lastphn_cand));
     init_search_tree(fts);
     create_search_tree(fts);
+    fwdtree_search_start_parts(fts, cmd_ln_int32_r(config, "-fwdtreethreads"));
 
     return (search_t *)fts;
 
@@ -908,6 +943,7 @@ fwdtree_search_free(search_t *base)
     int cf;
 
     cf = acmod_frame(search_acmod(fts));
+    fwdtree_search_stop_parts(fts);
 
     /* Reset non-root channels. */
     reinit_search_tree(fts);
@@ -1187,6 +1223,143 @@ eval_nonroot_chan(fwdtree_search_t *fts, int frame_idx)
     return bestscore;
 }
 
+/**
+ * Evaluate one partition of the root and active non-root channels.
+ *
+ * Each partition gets a contiguous slice of the root channels and of
+ * the active channel list.  Evaluating an HMM only writes to that
+ * HMM, so the partitions do not interfere with each other.
+ */
+static void
+eval_part(fwdtree_part_t *part, int frame_idx)
+{
+    fwdtree_search_t *fts = part->fts;
+    root_node_t *rhmm, *rend;
+    nonroot_node_t **acl, **aend;
+    int32 n_active, bestscore;
+
+    bestscore = WORST_SCORE;
+    part->n_root_chan_eval = 0;
+    rhmm = fts->root_chan + fts->n_root_chan * part->idx / fts->n_parts;
+    rend = fts->root_chan + fts->n_root_chan * (part->idx + 1) / fts->n_parts;
+    for (; rhmm < rend; ++rhmm) {
+        if (hmm_frame(&rhmm->hmm) == frame_idx) {
+            int32 score = chan_v_eval(rhmm);
+            if (score BETTER_THAN bestscore)
+                bestscore = score;
+            ++part->n_root_chan_eval;
+        }
+    }
+
+    n_active = fts->n_active_chan[frame_idx & 0x1];
+    acl = fts->active_chan_list[frame_idx & 0x1];
+    aend = acl + n_active * (part->idx + 1) / fts->n_parts;
+    acl += n_active * part->idx / fts->n_parts;
+    part->n_nonroot_chan_eval = aend - acl;
+    for (; acl < aend; ++acl) {
+        int32 score = chan_v_eval(*acl);
+        assert(hmm_frame(&(*acl)->hmm) == frame_idx);
+        if (score BETTER_THAN bestscore)
+            bestscore = score;
+    }
+    part->bestscore = bestscore;
+}
+
+static int
+eval_part_main(sbthread_t *th)
+{
+    fwdtree_part_t *part = sbthread_arg(th);
+
+    while (sbevent_wait(part->go, -1, -1) == 0) {
+        if (part->fts->quit)
+            break;
+        eval_part(part, part->fts->eval_frame);
+        sbevent_signal(part->done);
+    }
+    return 0;
+}
+
+static void
+fwdtree_search_start_parts(fwdtree_search_t *fts, int n_parts)
+{
+    int i, n_emit_state;
+
+    if (n_parts <= 1)
+        return;
+    /* Other topologies use scratch space in the shared HMM context. */
+    n_emit_state = bin_mdef_n_emit_state(search_acmod(fts)->mdef);
+    if (n_emit_state != 3 && n_emit_state != 5) {
+        E_WARN("Cannot evaluate %d-state HMMs in parallel, using one thread\n",
+               n_emit_state);
+        return;
+    }
+    E_INFO("Evaluating HMMs in %d threads\n", n_parts);
+    fts->n_parts = n_parts;
+    fts->parts = ckd_calloc(n_parts, sizeof(*fts->parts));
+    for (i = 0; i < n_parts; ++i) {
+        fwdtree_part_t *part = fts->parts + i;
+
+        part->fts = fts;
+        part->idx = i;
+        if (i == 0)
+            continue;
+        part->go = sbevent_init(FALSE);
+        part->done = sbevent_init(FALSE);
+        part->thr = sbthread_start(NULL, eval_part_main, part);
+    }
+}
+
+static void
+fwdtree_search_stop_parts(fwdtree_search_t *fts)
+{
+    int i;
+
+    if (fts->parts == NULL)
+        return;
+    fts->quit = TRUE;
+    for (i = 1; i < fts->n_parts; ++i) {
+        fwdtree_part_t *part = fts->parts + i;
+
+        sbevent_signal(part->go);
+        sbthread_wait(part->thr);
+        sbthread_free(part->thr);
+        sbevent_free(part->go);
+        sbevent_free(part->done);
+    }
+    ckd_free(fts->parts);
+    fts->parts = NULL;
+    fts->n_parts = 0;
+}
+
+/**
+ * Evaluate root and non-root channels in all partitions.
+ */
+static int32
+eval_parts(fwdtree_search_t *fts, int frame_idx)
+{
+    int32 bestscore;
+    int i;
+
+    fts->eval_frame = frame_idx;
+    for (i = 1; i < fts->n_parts; ++i)
+        sbevent_signal(fts->parts[i].go);
+    eval_part(fts->parts, frame_idx);
+    for (i = 1; i < fts->n_parts; ++i)
+        sbevent_wait(fts->parts[i].done, -1, -1);
+
+    /* Merge best scores and statistics. */
+    bestscore = WORST_SCORE;
+    for (i = 0; i < fts->n_parts; ++i) {
+        fwdtree_part_t *part = fts->parts + i;
+
+        if (part->bestscore BETTER_THAN bestscore)
+            bestscore = part->bestscore;
+        fts->st.n_root_chan_eval += part->n_root_chan_eval;
+        fts->st.n_nonroot_chan_eval += part->n_nonroot_chan_eval;
+    }
+    return bestscore;
+}
+
 static int32
 eval_word_chan(fwdtree_search_t *fts, int frame_idx)
 {
@@ -1254,9 +1427,14 @@ evaluate_channels(fwdtree_search_t *fts, int16 const *senone_scores, int frame_i
     int32 bs;
 
     hmm_context_set_senscore(fts->hmmctx, senone_scores);
-    fts->best_score = eval_root_chan(fts, frame_idx);
-    if ((bs = eval_nonroot_chan(fts, frame_idx)) BETTER_THAN fts->best_score)
-        fts->best_score = bs;
+    if (fts->parts) {
+        fts->best_score = eval_parts(fts, frame_idx);
+    }
+    else {
+        fts->best_score = eval_root_chan(fts, frame_idx);
+        if ((bs = eval_nonroot_chan(fts, frame_idx)) BETTER_THAN fts->best_score)
+            fts->best_score = bs;
+    }
     if ((bs = eval_word_chan(fts, frame_idx)) BETTER_THAN fts->best_score)
         fts->best_score = bs;
     fts->last_phone_best_score = bs;
@@ -2032,12 +2210,14 @@ fwdtree_search_one_frame(fwdtree_search_t *fts)
     }
     E_DEBUG(2,("Searching frame %d\n", frame_idx));
     ptmr_start(&fts->base.t);
+    PTRACE_BEGIN("search", "fwdtree");
     /* Activate our HMMs for the current frame if need be. */
     if (!acmod->compallsen)
         compute_sen_active(fts, frame_idx);
 
     /* Compute GMM scores for the current frame. */
     if ((senscr = acmod_score(acmod, frame_idx)) == NULL) {
+        PTRACE_END("search", "fwdtree");
         ptmr_stop(&fts->base.t);
         return 0;
     }
@@ -2057,6 +2237,7 @@ fwdtree_search_one_frame(fwdtree_search_t *fts)
      * recognition has failed, don't bother to keep trying. */
     if (fts->best_score == WORST_SCORE
         || fts->best_score WORSE_THAN WORST_SCORE) {
+        PTRACE_END("search", "fwdtree");
         ptmr_stop(&fts->base.t);
         return 0;
     }
@@ -2075,7 +2256,9 @@ fwdtree_search_one_frame(fwdtree_search_t *fts)
     fwdtree_maxwpf(fts, frame_idx);
     bptbl_commit(fts->bptbl);
     /* Do word transitions. */
+    PTRACE_BEGIN("lm", "word_transition");
     word_transition(fts, frame_idx);
+    PTRACE_END("lm", "word_transition");
     /* Deactivate pruned HMMs. */
     deactivate_channels(fts, frame_idx);
 
@@ -2086,6 +2269,7 @@ fwdtree_search_one_frame(fwdtree_search_t *fts)
     update_partials(fts, frame_idx);
 
     /* Return the number of frames processed. */
+    PTRACE_END("search", "fwdtree");
     ptmr_stop(&fts->base.t);
     return 1;
 }
@@ -86,6 +86,13 @@ typedef struct latgen_search_s {
     char const *outarcdir;
     int ctr;
 
+    /** Number of frames kept open before finalizing, or 0. */
+    int32 latwindow;
+    /** First frame not yet finalized. */
+    int32 final_frame;
+    /** Number of lattice parts written in this utterance. */
+    int n_parts;
+
     /** Storage for language model state components. */
     int32 *lmhist;
     /** Allocation size of @a lmhist. */
@@ -131,6 +138,10 @@ latgen_search_init(search_t *other,
     latgen->lmath = logmath_retain(acmod->lmath);
 
     latgen->outarcdir = cmd_ln_str_r(config, "-arcdumpdir");
+    if (cmd_ln_exists_r(config, "-outlatdir"))
+        latgen->outlatdir = cmd_ln_str_r(config, "-outlatdir");
+    if (cmd_ln_exists_r(config, "-latwindow"))
+        latgen->latwindow = cmd_ln_int32_r(config, "-latwindow");
 
     /* NOTE: this is one larger than the actual history size for a
      * language model state. */
@@ -719,12 +730,53 @@ latgen_search_cleanup_frame(latgen_search_t *latgen, int32 frame_idx)
     return 0;
 }
 
+/**
+ * Finalize all lattice nodes starting before a given frame.
+ *
+ * These can no longer gain entries, so they are written out as a part
+ * of the lattice, if requested, and their link lists are freed.
+ */
+static int
+latgen_search_finalize(latgen_search_t *latgen, int32 ef)
+{
+    search_t *base = &latgen->base;
+
+    if (ef <= latgen->final_frame)
+        return 0;
+    if (latgen->outlatdir) {
+        char *outfile, *basedir, partstr[16];
+        FILE *fh;
+
+        sprintf(partstr, ".%d", latgen->n_parts);
+        outfile = string_join(latgen->outlatdir, "/",
+                              base->uttid, partstr, ".slf", NULL);
+        basedir = ckd_salloc(outfile);
+        path2dirname(outfile, basedir);
+        build_directory(basedir);
+        if ((fh = fopen(outfile, "w")) == NULL) {
+            E_ERROR_SYSTEM("Failed to open %s", outfile);
+        }
+        else {
+            ms_lattice_write_htk_frames(latgen->output_lattice, fh,
+                                        cmd_ln_int32_r(base->config, "-frate"),
+                                        latgen->final_frame, ef);
+            fclose(fh);
+        }
+        ckd_free(basedir);
+        ckd_free(outfile);
+    }
+    ++latgen->n_parts;
+    ms_lattice_release_frames(latgen->output_lattice, ef);
+    latgen->final_frame = ef;
+    return 0;
+}
+
 static int
 latgen_search_decode(search_t *base)
 {
     latgen_search_t *latgen = (latgen_search_t *)base;
     int frame_idx;
-    FILE *arcfh;
+    FILE *arcfh = NULL;
 
     frame_idx = 0;
     E_INFO("waiting for arc buffer start\n");
@@ -733,6 +785,10 @@ latgen_search_decode(search_t *base)
     base->uttid = arc_buffer_uttid(search_input_arcs(latgen));
 
     /* Create lattice and initial epsilon node. */
+    if (latgen->output_lattice)
+        ms_lattice_free(latgen->output_lattice);
+    latgen->final_frame = 0;
+    latgen->n_parts = 0;
     latgen->output_lattice = ms_lattice_init(latgen->lmath,
                                              search_dict(base));
     ms_lattice_node_init(latgen->output_lattice, 0, -1);
@@ -760,6 +816,7 @@ latgen_search_decode(search_t *base)
     /* Process frames full of arcs. */
     while (arc_buffer_consumer_wait(search_input_arcs(latgen), -1) >= 0) {
         ptmr_start(&base->t);
+        PTRACE_BEGIN("lattice", "latgen");
         while (1) {
             arc_t *itor;
             int n_arc;
@@ -779,11 +836,20 @@ latgen_search_decode(search_t *base)
             /* Remove any inaccessible nodes in this frame. */
             latgen_search_cleanup_frame(latgen, frame_idx);
             ++frame_idx;
+            /* Finalize old parts of the lattice, in chunks of the
+             * window size so as not to write lots of tiny files. */
+            if (latgen->latwindow > 0
+                && frame_idx - latgen->final_frame >= 2 * latgen->latwindow)
+                latgen_search_finalize(latgen, frame_idx - latgen->latwindow);
         }
+        PTRACE_END("lattice", "latgen");
         ptmr_stop(&base->t);
         if (arc_buffer_eou(search_input_arcs(latgen))) {
             E_INFO("latgen: got EOU\n");
             arc_buffer_consumer_end_utt(search_input_arcs(latgen));
+            /* Write the rest, including nodes in the final frame. */
+            if (latgen->latwindow > 0)
+                latgen_search_finalize(latgen, frame_idx + 1);
             if (arcfh) fclose(arcfh);
             return frame_idx;
         }
@@ -802,6 +868,8 @@ latgen_search_free(search_t *base)
     ngram_model_free(latgen->lm);
     ckd_free(latgen->lmhist);
     garray_free(latgen->active_nodes);
+    if (latgen->output_lattice)
+        ms_lattice_free(latgen->output_lattice);
     return 0;
 }
 
@@ -48,6 +48,8 @@
 #include <sphinxbase/err.h>
 #include <sphinxbase/strfuncs.h>
 #include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/hash_table.h>
+#include <sphinxbase/listelem_alloc.h>
 
 #include <multisphinx/ngram_trie.h>
 
@@ -117,8 +119,32 @@ struct ms_lattice_s {
      * Size of history arrays.
      */
     int max_n_hist;
+    /**
+     * Language model word IDs for dictionary word IDs, used during
+     * expansion (-2 where not yet looked up).
+     */
+    int32 *lmwid_map;
+    /**
+     * Language model states found for (source state, link word, node
+     * word) during expansion.
+     */
+    hash_table_t *lmstate_cache;
+    /**
+     * Storage for keys and values of @a lmstate_cache.
+     */
+    listelem_alloc_t *lmstate_cache_alloc;
 };
 
+/**
+ * Memoized result of building a language model state.
+ */
+typedef struct lmstate_memo_s {
+    int32 key[3];  /**< Source lmstate, link word, node LM word. */
+    int32 lmstate; /**< Resulting history lmstate, or -1. */
+    int32 lscr;    /**< Language model score of the node word. */
+    int32 bowt;    /**< Backoff weight incurred. */
+} lmstate_memo_t;
+
 struct ms_latnode_iter_s {
     ms_lattice_t *l;
     int32 cur;
@@ -665,13 +691,9 @@ error_out:
     return -1;
 }
 
-int
-ms_lattice_write_htk(ms_lattice_t *l, FILE *fh, int frate)
+static void
+write_htk_header(ms_lattice_t *l, FILE *fh, int n_nodes, int n_links)
 {
-    int32 zero = logmath_get_zero(l->lmath);
-    int i;
-
-    /* Write a generic header. */
     fprintf(fh, "# Lattice generated by MultiSphinx\n");
     fprintf(fh, "#\n");
     fprintf(fh, "# Header\n");
@@ -680,55 +702,135 @@ ms_lattice_write_htk(ms_lattice_t *l, FILE *fh, int frate)
     fprintf(fh, "start=%d\n", l->start_idx);
     fprintf(fh, "end=%d\n", l->end_idx);
     fprintf(fh, "#\n");
-    fprintf(fh, "N=%u\tL=%u\n",
-            (unsigned)garray_size(l->node_list),
-            (unsigned)garray_size(l->link_list));
+    fprintf(fh, "N=%u\tL=%u\n", (unsigned)n_nodes, (unsigned)n_links);
+}
+
+static void
+write_htk_node(ms_lattice_t *l, FILE *fh, int frate, int32 i)
+{
+    ms_latnode_t *node = garray_ptr(l->node_list, ms_latnode_t, i);
+
+    if (node->id.lmstate != -1) {
+        char const *basestr;
+        int32 wid;
+        ms_lattice_get_lmstate_wids(l, node->id.lmstate, &wid, NULL);
+        basestr = dict_basestr(l->dict, wid);
+        if (node->id.lmstate == dict_startwid(l->dict))
+            basestr = "!SENT_START";
+        if (node->id.lmstate == dict_finishwid(l->dict))
+            basestr = "!SENT_END";
+        fprintf(fh, "I=%d\tt=%.2f\tW=%s\tv=%d\n",
+                i, (double)node->id.sf / frate,
+                basestr,
+                dict_altid(l->dict, node->id.lmstate));
+    }
+    else
+        fprintf(fh, "I=%d\tt=%.2f\n",
+                i, (double)node->id.sf / frate);
+}
+
+static void
+write_htk_link(ms_lattice_t *l, FILE *fh, int32 i)
+{
+    int32 zero = logmath_get_zero(l->lmath);
+    ms_latlink_t *link = garray_ptr(l->link_list, ms_latlink_t, i);
+
+    fprintf(fh, "J=%d\tS=%d\tE=%d\ta=%f",
+            i, link->src, link->dest,
+            logmath_log_to_ln(l->lmath, link->ascr));
+    if (link->wid != -1)
+        fprintf(fh, "\tW=%s",
+                dict_basestr(l->dict, link->wid));
+    if (link->lscr != zero)
+        fprintf(fh, "\tl=%f",
+                logmath_log_to_ln(l->lmath, link->lscr));
+    if (link->alpha != zero
+        && link->beta != zero
+        && l->norm != zero)
+        fprintf(fh, "\tp=%g",
+                logmath_exp(l->lmath, link->alpha + link->beta - l->norm));
+    fprintf(fh, "\n");
+}
+
+int
+ms_lattice_write_htk(ms_lattice_t *l, FILE *fh, int frate)
+{
+    int i;
+
+    write_htk_header(l, fh, garray_size(l->node_list),
+                     garray_size(l->link_list));
     fprintf(fh, "#\n");
     fprintf(fh, "# Node definitions\n");
     fprintf(fh, "#\n");
+    for (i = 0; i < garray_size(l->node_list); ++i)
+        write_htk_node(l, fh, frate, i);
+    fprintf(fh, "#\n");
+    fprintf(fh, "# Link definitions\n");
+    fprintf(fh, "#\n");
+    for (i = 0; i < garray_size(l->link_list); ++i)
+        write_htk_link(l, fh, i);
+
+    return 0;
+}
+
+int
+ms_lattice_write_htk_frames(ms_lattice_t *l, FILE *fh, int frate,
+                            int sf, int ef)
+{
+    int n_nodes, n_links;
+    int i, j;
+
+    /* Count nodes and their exits first for the header. */
+    n_nodes = n_links = 0;
     for (i = 0; i < garray_size(l->node_list); ++i) {
         ms_latnode_t *node = garray_ptr(l->node_list, ms_latnode_t, i);
-        if (node->id.lmstate != -1) {
-            char const *basestr;
-            int32 wid;
-            ms_lattice_get_lmstate_wids(l, node->id.lmstate, &wid, NULL);
-            basestr = dict_basestr(l->dict, wid);
-            if (node->id.lmstate == dict_startwid(l->dict))
-                basestr = "!SENT_START";
-            if (node->id.lmstate == dict_finishwid(l->dict))
-                basestr = "!SENT_END";
-            fprintf(fh, "I=%d\tt=%.2f\tW=%s\tv=%d\n",
-                    i, (double)node->id.sf / frate,
-                    basestr,
-                    dict_altid(l->dict, node->id.lmstate));
-        }
-        else
-            fprintf(fh, "I=%d\tt=%.2f\n",
-                    i, (double)node->id.sf / frate);
+        if (node->id.sf < sf || node->id.sf >= ef)
+            continue;
+        ++n_nodes;
+        n_links += ms_latnode_n_exits(node);
+    }
+
+    write_htk_header(l, fh, n_nodes, n_links);
+    fprintf(fh, "#\n");
+    fprintf(fh, "# Node definitions (frames %d to %d)\n", sf, ef);
+    fprintf(fh, "#\n");
+    for (i = 0; i < garray_size(l->node_list); ++i) {
+        ms_latnode_t *node = garray_ptr(l->node_list, ms_latnode_t, i);
+        if (node->id.sf < sf || node->id.sf >= ef)
+            continue;
+        write_htk_node(l, fh, frate, i);
     }
     fprintf(fh, "#\n");
     fprintf(fh, "# Link definitions\n");
     fprintf(fh, "#\n");
-    for (i = 0; i < garray_size(l->link_list); ++i) {
-        ms_latlink_t *link = garray_ptr(l->link_list, ms_latlink_t, i);
-        fprintf(fh, "J=%d\tS=%d\tE=%d\ta=%f",
-                i, link->src, link->dest,
-                logmath_log_to_ln(l->lmath, link->ascr));
-        if (link->wid != -1)
-            fprintf(fh, "\tW=%s",
-                    dict_basestr(l->dict, link->wid));
-        if (link->lscr != zero)
-            fprintf(fh, "\tl=%f",
-                    logmath_log_to_ln(l->lmath, link->lscr));
-        if (link->alpha != zero
-            && link->beta != zero
-            && l->norm != zero)
-            fprintf(fh, "\tp=%g",
-                    logmath_exp(l->lmath, link->alpha + link->beta - l->norm));
-        fprintf(fh, "\n");
+    for (i = 0; i < garray_size(l->node_list); ++i) {
+        ms_latnode_t *node = garray_ptr(l->node_list, ms_latnode_t, i);
+        if (node->id.sf < sf || node->id.sf >= ef)
+            continue;
+        for (j = 0; j < ms_latnode_n_exits(node); ++j)
+            write_htk_link(l, fh, garray_ent(node->exits, int32, j));
     }
 
-    return 0;
+    return n_nodes;
+}
+
+int
+ms_lattice_release_frames(ms_lattice_t *l, int ef)
+{
+    int i, n_released = 0;
+
+    for (i = 0; i < garray_size(l->node_list); ++i) {
+        ms_latnode_t *node = garray_ptr(l->node_list, ms_latnode_t, i);
+        if (node->id.sf >= ef)
+            continue;
+        if (node->exits == NULL && node->entries == NULL)
+            continue;
+        garray_free(node->exits);
+        garray_free(node->entries);
+        node->exits = node->entries = NULL;
+        ++n_released;
+    }
+    return n_released;
 }
 
 static int
@@ -1206,11 +1308,17 @@ merge_exits(ms_lattice_t *l, ms_latnode_t *new,
  * Map dictionary wids to language model wids.
  */
 static int32
-map_lmwid(dict_t *dict, ngram_model_t *lm, int32 wid)
+map_lmwid(ms_lattice_t *l, ngram_model_t *lm, int32 wid)
 {
     if (wid == -1)
         return wid;
-    return ngram_wid(lm, dict_basestr(dict, wid));
+    /* Looking these up means hashing a string, so remember them. */
+    if (l->lmwid_map && wid < dict_size(l->dict)) {
+        if (l->lmwid_map[wid] == -2)
+            l->lmwid_map[wid] = ngram_wid(lm, dict_basestr(l->dict, wid));
+        return l->lmwid_map[wid];
+    }
+    return ngram_wid(lm, dict_basestr(l->dict, wid));
 }
 
 static void
@@ -1230,7 +1338,7 @@ update_backoff_arcs(ms_lattice_t *l, ms_latnode_t *node,
                 link->lscr = 0;
             else
                 link->lscr = ngram_ng_score(lm,
-                                            map_lmwid(l->dict, lm, link->wid),
+                                            map_lmwid(l, lm, link->wid),
                                             NULL, 0, NULL);
         }
         /* Change it to an epsilon node. */
@@ -1294,6 +1402,8 @@ build_lmstate(ms_lattice_t *l, ngram_model_t *lm,
     int32 entry_latwid, entry_lmwid;
     int32 lmstate;
     ngram_iter_t *ni;
+    lmstate_memo_t *memo;
+    int32 key[3];
     int n_hist, i;
 
     /* Skip arcs with deleted source nodes. */
@@ -1302,15 +1412,28 @@ build_lmstate(ms_lattice_t *l, ngram_model_t *lm,
     if (src->id.lmstate == 0xdeadbeef)
         return 0xdeadbeef;
 
+    /* The result only depends on the source node's language model
+     * state and the two words, which many links share. */
+    key[0] = src->id.lmstate;
+    key[1] = entry->wid;
+    key[2] = node_lmwid;
+    if (l->lmstate_cache
+        && hash_table_lookup_bkey(l->lmstate_cache, (char const *)key,
+                                  sizeof(key), (void **)&memo) == 0) {
+        *out_lscr = memo->lscr;
+        *out_bowt = memo->bowt;
+        return memo->lmstate;
+    }
+
     /* Construct the maximum language model state for this
      * incoming arc.  This consists of the language model
      * state from its source node plus the arc's base word
      * ID. */
     n_hist = ms_lattice_get_lmstate_wids(l, src->id.lmstate,
                                          &src_latwid, l->lathist);
-    src_lmwid = map_lmwid(l->dict, lm, src_latwid);
+    src_lmwid = map_lmwid(l, lm, src_latwid);
     for (i = 0; i < n_hist; ++i) {
-        l->lmhist[i] = map_lmwid(l->dict, lm, l->lathist[i]);
+        l->lmhist[i] = map_lmwid(l, lm, l->lathist[i]);
         E_INFO("%d %s %d -> %d\n", i,
                dict_wordstr(l->dict, l->lathist[i]),
                l->lathist[i], l->lmhist[i]);
@@ -1323,7 +1446,7 @@ build_lmstate(ms_lattice_t *l, ngram_model_t *lm,
         assert(l->lmhist[i] >= 0);
     /* Map link word ID to base ID and lm ID. */
     entry_latwid = dict_basewid(l->dict, entry->wid);
-    entry_lmwid = map_lmwid(l->dict, lm, entry->wid);
+    entry_lmwid = map_lmwid(l, lm, entry->wid);
     /* Rotate in incoming arc word. */
     rotate_lmstate(entry_latwid, l->lathist, n_hist, l->max_n_hist);
     n_hist = rotate_lmstate(entry_lmwid, l->lmhist, n_hist, l->max_n_hist);
@@ -1362,6 +1485,15 @@ build_lmstate(ms_lattice_t *l, ngram_model_t *lm,
                 lmstate = -1;
         }
     }
+    if (l->lmstate_cache) {
+        memo = listelem_malloc(l->lmstate_cache_alloc);
+        memcpy(memo->key, key, sizeof(key));
+        memo->lmstate = lmstate;
+        memo->lscr = *out_lscr;
+        memo->bowt = *out_bowt;
+        hash_table_enter_bkey(l->lmstate_cache, (char const *)memo->key,
+                              sizeof(memo->key), memo);
+    }
     return lmstate;
 }
 
@@ -1433,7 +1565,7 @@ expand_node(ms_lattice_t *l, ngram_model_t *lm,
     nodeid = ms_lattice_get_idx_node(l, node);
     /* Input lattice has word IDs on the nodes - get the word ID. */
     ms_lattice_get_lmstate_wids(l, node->id.lmstate, &node_lmwid, NULL);
-    node_lmwid = map_lmwid(l->dict, lm, node_lmwid);
+    node_lmwid = map_lmwid(l, lm, node_lmwid);
     /* Keep track of which entry links are moved to newly created
      * nodes, and which are deleted as duplicates. */
     /* Expand this node with unique incoming N-gram histories. */
@@ -1513,6 +1645,13 @@ ms_lattice_expand(ms_lattice_t *l, ngram_model_t *lm)
      * model word IDs to get language model scores.  Once expansion is
      * complete the LM word IDs aren't needed. */
     ms_lattice_alloc_hist(l, ngram_model_get_size(lm) - 1);
+    /* Caches shared by all nodes during expansion. */
+    l->lmwid_map = ckd_malloc(dict_size(l->dict) * sizeof(*l->lmwid_map));
+    for (i = 0; i < dict_size(l->dict); ++i)
+        l->lmwid_map[i] = -2;
+    l->lmstate_cache = hash_table_new(garray_size(l->link_list),
+                                      HASH_CASE_YES);
+    l->lmstate_cache_alloc = listelem_alloc_init(sizeof(lmstate_memo_t));
 
     /* New final node (in theory, there are a bunch of different final
      * language model histories, but since nothing follows this there
@@ -1533,6 +1672,15 @@ ms_lattice_expand(ms_lattice_t *l, ngram_model_t *lm)
     end = ms_lattice_get_node_idx(l, endid);
     ms_lattice_set_end(l, end);
 
+    /* Language model states stay valid, but the caches are only
+     * good for this language model. */
+    hash_table_free(l->lmstate_cache);
+    listelem_alloc_free(l->lmstate_cache_alloc);
+    ckd_free(l->lmwid_map);
+    l->lmstate_cache = NULL;
+    l->lmstate_cache_alloc = NULL;
+    l->lmwid_map = NULL;
+
     /* Remove nodes marked for death. */
     for (i = 0; i < garray_size(l->node_list); ++i) {
         ms_latnode_t *node = ms_lattice_get_node_idx(l, i);
@@ -200,6 +200,32 @@ int ms_lattice_read_htk(ms_lattice_t *l, FILE *fh, int frate);
  */
 int ms_lattice_write_htk(ms_lattice_t *l, FILE *fh, int frate);
 
+/**
+ * Write the part of a lattice starting in a range of frames in HTK format.
+ *
+ * Node and link indices are those of the whole lattice, so that the
+ * parts written for consecutive ranges can be joined back together.
+ * Links are written with their source node.
+ *
+ * @param sf First frame to write.
+ * @param ef Frame after the last one to write.
+ * @return Number of nodes written.
+ */
+int ms_lattice_write_htk_frames(ms_lattice_t *l, FILE *fh, int frate,
+                                int sf, int ef);
+
+/**
+ * Release the link lists of all nodes starting before a given frame.
+ *
+ * Nodes and links keep their indices, but the released nodes can no
+ * longer be traversed.  This is used to bound the memory used by a
+ * lattice that is built incrementally, once its older part has been
+ * written out.
+ *
+ * @return Number of nodes released.
+ */
+int ms_lattice_release_frames(ms_lattice_t *l, int ef);
+
 /**
  * Write a lattice in DOT format.
  */
@@ -86,6 +86,11 @@ struct ngram_trie_node_s {
     ngram_trie_node_t *history;
     ngram_trie_node_t *backoff;
     garray_t *successors;
+    /**
+     * Successors sorted by word ID, followed by their word IDs (see
+     * ngram_trie_freeze()), or NULL.
+     */
+    ngram_trie_node_t **by_wid;
 };
 
 /**
@@ -123,6 +128,7 @@ ngram_trie_node_alloc(ngram_trie_t *t)
     node->log_bowt = 0;
     node->history = NULL;
     node->successors = NULL; /* Allocate lazily */
+    node->by_wid = NULL;
     node->backoff = (ngram_trie_node_t *)-1; /* Calculate lazily */
     return node;
 }
@@ -131,6 +137,7 @@ void
 ngram_trie_node_free(ngram_trie_t *t, ngram_trie_node_t *node)
 {
     garray_free(node->successors);
+    ckd_free(node->by_wid);
     listelem_free(t->node_alloc, node);
 }
 
@@ -185,6 +192,7 @@ free_successor_arrays(ngram_trie_node_t *node)
     for (pos = 0; pos < garray_size(node->successors); ++pos)
         free_successor_arrays(garray_ent(node->successors, ngram_trie_node_t *, pos));
     garray_free(node->successors);
+    ckd_free(node->by_wid);
 }
 
 int
@@ -586,10 +594,22 @@ ngram_trie_node_word(ngram_trie_t *t, ngram_trie_node_t *node)
     return node->word;
 }
 
+/**
+ * Drop the word ID index for a node whose successors changed.
+ */
+static void
+ngram_trie_thaw_node(ngram_trie_node_t *node)
+{
+    ckd_free(node->by_wid);
+    node->by_wid = NULL;
+}
+
 void
 ngram_trie_node_set_word(ngram_trie_t *t, ngram_trie_node_t *node, int32 wid)
 {
     node->word = wid;
+    if (node->history)
+        ngram_trie_thaw_node(node->history);
 }
 
 void
@@ -636,6 +656,73 @@ ngram_trie_node_set_params_raw(ngram_trie_t *t,
     node->log_bowt = log_bowt;
 }
 
+static int
+ngram_trie_wid_cmp(void const *a, void const *b)
+{
+    return (*(ngram_trie_node_t **)a)->word - (*(ngram_trie_node_t **)b)->word;
+}
+
+static void
+ngram_trie_freeze_node(ngram_trie_node_t *node)
+{
+    size_t i, nsucc;
+    int32 *wids;
+
+    ngram_trie_thaw_node(node);
+    if (node->successors == NULL
+        || (nsucc = garray_size(node->successors)) == 0)
+        return;
+    node->by_wid = ckd_malloc(nsucc * (sizeof(*node->by_wid) + sizeof(*wids)));
+    memcpy(node->by_wid, garray_void(node->successors, 0),
+           nsucc * sizeof(*node->by_wid));
+    qsort(node->by_wid, nsucc, sizeof(*node->by_wid), ngram_trie_wid_cmp);
+    wids = (int32 *)(node->by_wid + nsucc);
+    for (i = 0; i < nsucc; ++i) {
+        wids[i] = node->by_wid[i]->word;
+        ngram_trie_freeze_node(node->by_wid[i]);
+    }
+}
+
+void
+ngram_trie_freeze(ngram_trie_t *t)
+{
+    ngram_trie_freeze_node(t->root);
+}
+
+/**
+ * Find a successor by interpolation search in the word ID index.
+ *
+ * Word IDs of successors are usually spread fairly evenly over the
+ * vocabulary, so this takes a couple of probes where bisection takes
+ * a dozen string comparisons.
+ */
+static ngram_trie_node_t *
+ngram_trie_successor_by_wid(ngram_trie_node_t *h, int32 w)
+{
+    size_t nsucc = garray_size(h->successors);
+    int32 const *wids = (int32 const *)(h->by_wid + nsucc);
+    int32 lo, hi;
+
+    lo = 0;
+    hi = nsucc - 1;
+    while (lo <= hi && w >= wids[lo] && w <= wids[hi]) {
+        int32 pos;
+
+        if (wids[hi] == wids[lo])
+            pos = lo;
+        else
+            pos = lo + (int32)((int64)(w - wids[lo]) * (hi - lo)
+                               / (wids[hi] - wids[lo]));
+        if (wids[pos] == w)
+            return h->by_wid[pos];
+        if (wids[pos] < w)
+            lo = pos + 1;
+        else
+            hi = pos - 1;
+    }
+    return NULL;
+}
+
 static size_t
 ngram_trie_successor_pos(ngram_trie_t *t, ngram_trie_node_t *h, int32 w)
 {
@@ -658,6 +745,8 @@ ngram_trie_successor(ngram_trie_t *t, ngram_trie_node_t *h, int32 w)
 #endif
     if (h->successors == NULL)
         return NULL;
+    if (h->by_wid)
+        return ngram_trie_successor_by_wid(h, w);
     pos = ngram_trie_successor_pos(t, h, w);
     if (pos >= garray_next_idx(h->successors))
         return NULL;
@@ -680,6 +769,7 @@ ngram_trie_delete_successor(ngram_trie_t *t, ngram_trie_node_t *h, int32 w)
     if (pos >= garray_next_idx(h->successors))
         return -1;
     ng = garray_ent(h->successors, ngram_trie_node_t *, pos);
+    ngram_trie_thaw_node(h);
     /* Delete it. */
     ngram_trie_node_free(t, ng);
     if (garray_delete(h->successors, pos, pos+1) < 0)
@@ -698,6 +788,7 @@ ngram_trie_add_successor(ngram_trie_t *t, ngram_trie_node_t *h, int32 w)
     ng->word = w;
     ng->history = h;
     assert(ng->word >= 0);
+    ngram_trie_thaw_node(h);
     if (h->successors == NULL) {
         h->successors = garray_init(1, sizeof(ngram_trie_node_t *));
         garray_set_cmp(h->successors, &ngram_trie_nodeptr_cmp, t);
@@ -726,6 +817,7 @@ ngram_trie_add_successor_ngram(ngram_trie_t *t,
 
     assert(w->word >= 0);
     assert(w->log_prob <= 0);
+    ngram_trie_thaw_node(h);
     if (h->successors == NULL) {
         h->successors = garray_init(1, sizeof(ngram_trie_node_t *));
         garray_set_cmp(h->successors, &ngram_trie_nodeptr_cmp, t);
@@ -767,6 +859,7 @@ ngram_trie_rename_successor(ngram_trie_t *t,
     }
     assert(w == garray_ent(h->successors, ngram_trie_node_t *, pos));
     garray_delete(h->successors, pos, pos + 1);
+    ngram_trie_thaw_node(h);
 
     w->word = new_wid;
     pos = garray_bisect_right(h->successors, &w);
@@ -1216,6 +1309,7 @@ ngram_trie_read_arpa(ngram_trie_t *t, FILE *arpafile)
     lineiter_free(li);
     if (n < 0)
         return -1;
+    ngram_trie_freeze(t);
 
     return 0;
 }
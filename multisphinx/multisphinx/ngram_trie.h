@@ -87,6 +87,18 @@ int ngram_trie_n(ngram_trie_t *t);
  */
 int ngram_trie_read_arpa(ngram_trie_t *t, FILE *arpafile);
 
+/**
+ * Build fast lookup indices for all successor arrays.
+ *
+ * Successors are kept in alphabetical order, which makes looking one
+ * up by word ID slow.  This adds a copy of each successor array
+ * sorted by word ID, which ngram_trie_successor() then searches
+ * instead.  Adding, deleting or renaming successors of a node drops
+ * its index, so this should be called again after modifying the
+ * trie.  ngram_trie_read_arpa() calls it for you.
+ */
+void ngram_trie_freeze(ngram_trie_t *t);
+
 /**
  * Write N-Grams to an ARPA text format file.
  */
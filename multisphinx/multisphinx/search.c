@@ -40,11 +40,79 @@
  * @author David Huggins-Daines <dhuggins@cs.cmu.edu>
  */
 
+#include <time.h>
+
 #include <multisphinx/search.h>
 #include <multisphinx/arc_buffer.h>
 
 #include "search_internal.h"
 
+struct search_sched_s {
+    int refcount;
+    int n_active;
+    sbsem_t *slots;
+};
+
+search_sched_t *
+search_sched_init(int n_active)
+{
+    search_sched_t *sched;
+
+    if (n_active < 1) {
+        E_ERROR("Need at least one active utterance, got %d\n", n_active);
+        return NULL;
+    }
+    sched = ckd_calloc(1, sizeof(*sched));
+    sched->refcount = 1;
+    sched->n_active = n_active;
+    sched->slots = sbsem_init("search_sched:slots", n_active);
+    return sched;
+}
+
+search_sched_t *
+search_sched_retain(search_sched_t *sched)
+{
+    ++sched->refcount;
+    return sched;
+}
+
+int
+search_sched_free(search_sched_t *sched)
+{
+    if (sched == NULL)
+        return 0;
+    if (--sched->refcount > 0)
+        return sched->refcount;
+    sbsem_free(sched->slots);
+    ckd_free(sched);
+    return 0;
+}
+
+void
+search_set_sched(search_t *search, search_sched_t *sched)
+{
+    search_sched_free(search->sched);
+    search->sched = sched ? search_sched_retain(sched) : NULL;
+}
+
+static void
+search_sched_enter(search_t *search)
+{
+    if (search->sched == NULL || search->sched_active)
+        return;
+    sbsem_down(search->sched->slots, -1, -1);
+    search->sched_active = TRUE;
+}
+
+static void
+search_sched_leave(search_t *search)
+{
+    if (!search->sched_active)
+        return;
+    search->sched_active = FALSE;
+    sbsem_up(search->sched->slots);
+}
+
 void
 search_base_init(search_t *search, searchfuncs_t *vt,
             cmd_ln_t *config, acmod_t *acmod, dict2pid_t *d2p)
@@ -87,6 +155,7 @@ search_free(search_t *search)
     /* Clean up common stuff. */
     arc_buffer_free(search->input_arcs);
     arc_buffer_free(search->output_arcs);
+    search_sched_free(search->sched);
     cmd_ln_free_r(search->config);
     acmod_free(search->acmod);
     dict_free(search->dict);
@@ -115,12 +184,33 @@ search_link(search_t *from, search_t *to,
         return NULL;
     ab = arc_buffer_init(name, search_bptbl(from),
                          search_lmset(from), keep_scores);
+    if (cmd_ln_exists_r(search_config(from), "-arcbufhwm"))
+        arc_buffer_set_watermarks(ab,
+                                  cmd_ln_int32_r(search_config(from), "-arcbufhwm"),
+                                  cmd_ln_int32_r(search_config(from), "-arcbuflwm"));
     search_output_arcs(from) = ab;
     search_input_arcs(to) = arc_buffer_retain(ab);
 
     return ab;
 }
 
+/**
+ * Record the CPU time used so far by the calling search thread.
+ */
+static void
+search_update_thread_cpu(search_t *search)
+{
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+        search->thread_cpu = ts.tv_sec + ts.tv_nsec * 1e-9;
+        return;
+    }
+#endif
+    search->thread_cpu = -1;
+}
+
 static int
 search_main(sbthread_t *thr)
 {
@@ -132,6 +222,9 @@ search_main(sbthread_t *thr)
         if ((rv = (*search->vt->decode)(search)) < 0) {
             E_INFO("%s canceled\n", search->vt->name);
         }
+        /* In case it was canceled before the end of the utterance. */
+        search_sched_leave(search);
+        search_update_thread_cpu(search);
     }
     return 0;
 }
@@ -147,6 +240,13 @@ int
 search_call_event(search_t *search, int event, int frame)
 {
     search_event_t evt;
+
+    /* Utterances start and end with these events, which is where we
+     * wait for and give up our turn. */
+    if (event == SEARCH_START_UTT)
+        search_sched_enter(search);
+    else if (event == SEARCH_END_UTT)
+        search_sched_leave(search);
     if (search->cb != NULL) {
         evt.event = event;
         evt.frame = frame;
@@ -242,3 +342,13 @@ search_uttid(search_t *search)
 {
     return search->uttid;
 }
+
+int32
+search_get_times(search_t *search, double *out_cpu, double *out_wall)
+{
+    if (out_cpu)
+        *out_cpu = search->thread_cpu;
+    if (out_wall)
+        *out_wall = search->t.t_tot_elapsed;
+    return search->total_frames;
+}
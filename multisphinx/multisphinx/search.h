@@ -53,6 +53,11 @@
  */
 typedef struct search_s search_t;
 
+/**
+ * Limit on the number of utterances decoded at once.
+ */
+typedef struct search_sched_s search_sched_t;
+
 /**
  * Structure describing a search algorithm.
  */
@@ -109,10 +114,48 @@ char const *search_name(search_t *search);
 
 /**
  * Link one search structure to another via an arc buffer.
+ *
+ * The -arcbufhwm and -arcbuflwm options in the configuration of @a
+ * from limit how far it can get ahead of @a to.
  */
 arc_buffer_t *search_link(search_t *from, search_t *to,
                           char const *name, int keep_scores);
 
+/**
+ * Create a limit on the number of utterances decoded at once.
+ *
+ * When many decoders run side by side, their threads spend most of
+ * their time idle, waiting for an utterance to start.  Sharing a
+ * search_sched_t between the first passes of all of them lets at
+ * most @a n_active utterances be searched at the same time, so that
+ * busy threads do not outnumber the processors.  The others wait
+ * after their utterance has started and before they search the first
+ * frame.
+ *
+ * @param n_active Maximum number of utterances decoded at once,
+ *                 typically the number of processors divided by
+ *                 the number of search passes.
+ */
+search_sched_t *search_sched_init(int n_active);
+
+/**
+ * Retain a pointer to a search scheduler.
+ */
+search_sched_t *search_sched_retain(search_sched_t *sched);
+
+/**
+ * Release a pointer to a search scheduler.
+ */
+int search_sched_free(search_sched_t *sched);
+
+/**
+ * Make a search wait for its turn at the start of each utterance.
+ *
+ * This should be set on the first pass of each decoder only.  Later
+ * passes are held back by the arc buffers linking them to it.
+ */
+void search_set_sched(search_t *search, search_sched_t *sched);
+
 /**
  * Add a callback for search events.
  */
@@ -173,4 +216,17 @@ cmd_ln_t *search_config(search_t *search);
  */
 char const *search_uttid(search_t *search);
 
+/**
+ * Get the time a search has spent decoding so far.
+ *
+ * This is only updated between utterances, so call it once the
+ * search has finished an utterance, or after search_wait().
+ *
+ * @param out_cpu Output: CPU time used by the search thread, or -1
+ *                if it cannot be measured on this platform.
+ * @param out_wall Output: Wall time spent processing frames.
+ * @return Total number of frames decoded.
+ */
+int32 search_get_times(search_t *search, double *out_cpu, double *out_wall);
+
 #endif /* __PS_SEARCH_H__ */
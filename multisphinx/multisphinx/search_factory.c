@@ -144,6 +144,21 @@ static void init_defaults(cmd_ln_t *config)
     }
 }
 
+static void search_factory_add_searches(search_factory_t *dcf)
+{
+    /* If search engines become pluggable then we would scan for them
+     * here.  For now we just build the list from the ones that are
+     * known inside multisphinx. */
+    dcf->searches = glist_add_ptr(dcf->searches,
+            (void *) fwdtree_search_query());
+    dcf->searches = glist_add_ptr(dcf->searches,
+            (void *) fwdflat_search_query());
+    dcf->searches
+            = glist_add_ptr(dcf->searches, (void *) latgen_search_query());
+    dcf->searches = glist_add_ptr(dcf->searches,
+            (void *) state_align_search_query());
+}
+
 static int search_factory_initialize(search_factory_t *dcf)
 {
     if ((dcf->lmath = logmath_init(
@@ -158,18 +173,7 @@ static int search_factory_initialize(search_factory_t *dcf)
         return -1;
     if ((dcf->d2p = dict2pid_build(dcf->acmod->mdef, dcf->dict)) == NULL)
         return -1;
-
-    /* If search engines become pluggable then we would scan for them
-     * here.  For now we just build the list from the ones that are
-     * known inside multisphinx. */
-    dcf->searches = glist_add_ptr(dcf->searches,
-            (void *) fwdtree_search_query());
-    dcf->searches = glist_add_ptr(dcf->searches,
-            (void *) fwdflat_search_query());
-    dcf->searches
-            = glist_add_ptr(dcf->searches, (void *) latgen_search_query());
-    dcf->searches = glist_add_ptr(dcf->searches,
-            (void *) state_align_search_query());
+    search_factory_add_searches(dcf);
 
     return 0;
 }
@@ -268,6 +272,32 @@ search_factory_retain(search_factory_t *dcf)
     return dcf;
 }
 
+search_factory_t *
+search_factory_copy(search_factory_t *other)
+{
+    search_factory_t *dcf;
+
+    dcf = ckd_calloc(1, sizeof(*dcf));
+    dcf->refcnt = 1;
+
+    dcf->config = cmd_ln_retain(other->config);
+    dcf->lmath = logmath_retain(other->lmath);
+    if ((dcf->fb = featbuf_init(dcf->config)) == NULL)
+        goto error_out;
+    if ((dcf->acmod = acmod_copy_featbuf(other->acmod, dcf->fb)) == NULL)
+        goto error_out;
+    dcf->dict = dict_retain(other->dict);
+    dcf->d2p = dict2pid_retain(other->d2p);
+    if (other->lm)
+        dcf->lm = ngram_model_retain(other->lm);
+    search_factory_add_searches(dcf);
+
+    return dcf;
+
+    error_out: search_factory_free(dcf);
+    return NULL;
+}
+
 int search_factory_free(search_factory_t *dcf)
 {
     int i;
@@ -42,6 +42,16 @@ search_factory_t *search_factory_init_cmdln(cmd_ln_t *config);
  */
 search_factory_t *search_factory_retain(search_factory_t *dcf);
 
+/**
+ * Construct a search factory sharing the models of another.
+ *
+ * The new factory has a feature buffer of its own, so that searches
+ * created from it decode a separate stream of audio, but shares the
+ * acoustic model parameters, dictionary and configuration of the
+ * original.
+ */
+search_factory_t *search_factory_copy(search_factory_t *other);
+
 /**
  * Release a reference to a search factory.
  */
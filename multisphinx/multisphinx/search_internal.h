@@ -82,6 +82,7 @@ struct search_s {
     sbmtx_t *mtx;          /**< Lock for this search. */
     ptmr_t t;              /**< Overall performance timer for this search. */
     int32 total_frames;    /**< Total number of frames processed. */
+    double thread_cpu;     /**< CPU time used by this search's thread. */
 
     cmd_ln_t *config;      /**< Configuration. */
     acmod_t *acmod;        /**< Acoustic model. */
@@ -99,6 +100,9 @@ struct search_s {
     search_cb_func cb;
     void *cb_data;
 
+    search_sched_t *sched;  /**< Limit on concurrent utterances. */
+    int sched_active;       /**< This search holds a slot in sched. */
+
     /* Magical word IDs that must exist in the dictionary: */
     int32 start_wid;       /**< Start word ID. */
     int32 silence_wid;     /**< Silence word ID. */
@@ -41,6 +41,8 @@
  * @author David Huggins-Daines <dhuggins@cs.cmu.edu>
  */
 
+#include <string.h>
+
 #include <sphinxbase/pio.h>
 #include <sphinxbase/strfuncs.h>
 #include <sphinxbase/garray.h>
@@ -58,6 +60,16 @@ struct vocab_map_s {
     garray_t *pseudos; /**< Map pseudo words to words. */
     garray_t *words;   /**< Map words to pseudo words. */
     garray_t *wids;    /**< Word IDs for word sets. */
+    /**
+     * Pseudo word for each word ID, or -1, built from @a words.
+     */
+    int32 *word_map;
+    /**
+     * Index in @a wids for each pseudo word ID, or -1, built from
+     * @a pseudos.
+     */
+    int32 *pseudo_map;
+    int32 n_map;       /**< Size of @a word_map and @a pseudo_map. */
 };
 
 vocab_map_t *
@@ -105,6 +117,8 @@ vocab_map_free(vocab_map_t *vm)
     garray_free(vm->pseudos);
     garray_free(vm->words);
     garray_free(vm->wids);
+    ckd_free(vm->word_map);
+    ckd_free(vm->pseudo_map);
     ckd_free(vm);
     return 0;
 }
@@ -115,6 +129,34 @@ vocab_map_dict(vocab_map_t *vm)
     return vm->dict;
 }
 
+/**
+ * Build direct lookup tables from the sorted mappings.
+ *
+ * The searches map words for every arc they expand, so this saves
+ * bisecting the mappings each time.
+ */
+static void
+vocab_map_build_tables(vocab_map_t *vm)
+{
+    size_t i;
+
+    vm->n_map = dict_size(vm->dict);
+    vm->word_map = ckd_realloc(vm->word_map,
+                               vm->n_map * sizeof(*vm->word_map));
+    vm->pseudo_map = ckd_realloc(vm->pseudo_map,
+                                 vm->n_map * sizeof(*vm->pseudo_map));
+    memset(vm->word_map, -1, vm->n_map * sizeof(*vm->word_map));
+    memset(vm->pseudo_map, -1, vm->n_map * sizeof(*vm->pseudo_map));
+    for (i = 0; i < garray_next_idx(vm->words); ++i) {
+        i32p_t *word = garray_ptr(vm->words, i32p_t, i);
+        vm->word_map[word->a] = word->b;
+    }
+    for (i = 0; i < garray_next_idx(vm->pseudos); ++i) {
+        i32p_t *pseudo = garray_ptr(vm->pseudos, i32p_t, i);
+        vm->pseudo_map[pseudo->a] = pseudo->b;
+    }
+}
+
 int
 vocab_map_read(vocab_map_t *vm, FILE *fh)
 {
@@ -164,6 +206,7 @@ vocab_map_read(vocab_map_t *vm, FILE *fh)
     }
     garray_sort(vm->pseudos);
     garray_sort(vm->words);
+    vocab_map_build_tables(vm);
 
     return 0;
 }
@@ -192,31 +235,24 @@ vocab_map_write(vocab_map_t *vm, FILE *fh)
 int32
 vocab_map_map(vocab_map_t *vm, int32 wid)
 {
-    size_t pos;
-    i32p_t ent;
-
-    ent.a = wid;
-    pos = garray_find_first(vm->words, &ent);
-    if (pos == garray_next_idx(vm->words))
+    /* Words added to the dictionary since reading are never mapped. */
+    if (wid < 0 || wid >= vm->n_map)
         return -1;
-    return garray_ptr(vm->words, i32p_t, pos)->b;
+    return vm->word_map[wid];
 }
 
 int32 const *
 vocab_map_unmap(vocab_map_t *vm, int32 pseudo_wid,
                 int32 *out_n_mapped)
 {
-    size_t pos;
-    i32p_t ent;
+    int32 idx;
 
-    ent.a = pseudo_wid;
-    pos = garray_find_first(vm->pseudos, &ent);
-    if (pos == garray_next_idx(vm->pseudos))
+    if (pseudo_wid < 0 || pseudo_wid >= vm->n_map
+        || (idx = vm->pseudo_map[pseudo_wid]) == -1)
         return NULL;
-    ent = garray_ent(vm->pseudos, i32p_t, pos);
     if (out_n_mapped)
-        *out_n_mapped = garray_ent(vm->wids, int32, ent.b);
-    return garray_ptr(vm->wids, int32, ent.b + 1);
+        *out_n_mapped = garray_ent(vm->wids, int32, idx);
+    return garray_ptr(vm->wids, int32, idx + 1);
 }
 
 struct vocab_map_iter_s {
@@ -40,6 +40,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <sys/time.h>
+#include <sys/resource.h>
 
 /* SphinxBase headers. */
 #include <sphinxbase/pio.h>
@@ -47,8 +48,10 @@
 #include <sphinxbase/strfuncs.h>
 #include <sphinxbase/filename.h>
 #include <sphinxbase/byteorder.h>
+#include <sphinxbase/profile.h>
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/feat.h>
+#include <sphinxbase/sbthread.h>
 
 /* MultiSphinx headers. */
 #include <multisphinx/cmdln_macro.h>
@@ -59,20 +62,72 @@
 #include <multisphinx/vocab_map.h>
 #include <multisphinx/fwdflat_search.h>
 
+/**
+ * Benchmark statistics for one stream.
+ */
+typedef struct batch_stats_s {
+    int n_utt;          /**< Utterances decoded. */
+    double wall;        /**< Wall time from start to end of utterances. */
+    int n_ref_words;    /**< Words in reference transcripts. */
+    int n_errors;       /**< Word errors against reference transcripts. */
+    int max_lag_sf;     /**< Maximum frames the second pass lagged. */
+    int n_stalls;       /**< Times the first pass waited for the second. */
+    double stall_sec;   /**< Time the first pass spent waiting. */
+} batch_stats_t;
+
+/**
+ * Utterances from the control file, handed out to the streams as they
+ * become free, and their hypotheses, written in control file order.
+ */
+typedef struct batch_queue_s {
+    sbmtx_t *mtx;
+    cmd_ln_t *config;
+    FILE *ctlfh;
+    FILE *alignfh;
+    FILE *reffh;
+    FILE *hypfh;
+    lineiter_t *li;     /**< Next line of the control file. */
+    lineiter_t *ali;    /**< Corresponding line of the alignment file. */
+    lineiter_t *rli;    /**< Corresponding line of the reference file. */
+    int n_taken;        /**< Utterances handed out. */
+    int n_written;      /**< Hypotheses written. */
+    char **hyps;        /**< Hypotheses not yet written, by utterance. */
+    int n_hyps_alloc;
+} batch_queue_t;
+
+/**
+ * One utterance taken from the queue.
+ */
+typedef struct batch_utt_s {
+    int idx;            /**< Position in the queue. */
+    int lineno;         /**< Line number in the control file. */
+    char *ctl;          /**< Line of the control file. */
+    char *align;        /**< Line of the alignment file, or NULL. */
+    char *ref;          /**< Line of the reference file, or NULL. */
+} batch_utt_t;
+
 typedef struct batch_decoder_s {
     search_factory_t *sf;
     cmd_ln_t *config;
     search_t *fwdtree;
     search_t *fwdflat;
     search_t *latgen;
+    /** Last pass with a hypothesis (fwdflat, or fwdtree alone). */
+    search_t *final;
+    /** Arc buffer between fwdtree and fwdflat. */
+    arc_buffer_t *tree_arcs;
 
     struct timeval utt_start;
 
-    FILE *ctlfh;
-    FILE *alignfh;
-    FILE *hypfh;
+    /** Source of utterances, shared by all streams. */
+    batch_queue_t *queue;
 
     hash_table_t *hypfiles;
+
+    /** Output files and their lock are shared with the first stream. */
+    int owns_output;
+    sbmtx_t *outmtx;
+    batch_stats_t stats;
 } batch_decoder_t;
 
 /**
@@ -111,6 +166,28 @@ ARG_STRING,
 NULL,
 "Final hypothesis file."},
 
+/* Benchmarking */
+{"-passes",
+ARG_STRING,
+"fwdtree,fwdflat",
+"Comma-separated search passes to run, or several such lists separated by colons to run each in turn"},
+{"-nstreams",
+ARG_INT32,
+"1",
+"Number of utterances to decode concurrently, each with its own searches sharing the same models"},
+{"-ref",
+ARG_STRING,
+NULL,
+"Reference transcripts, one per line of the control file, for word error rate"},
+{"-benchout",
+ARG_STRING,
+NULL,
+"File to append one line of benchmark results per set of passes to (JSON)"},
+{"-trace",
+ARG_STRING,
+NULL,
+"File to write a trace of decoding to (Chrome trace format, needs --enable-trace)"},
+
 /* Input file types and locations. */
 {"-adcin",
 ARG_BOOLEAN,
@@ -227,8 +304,209 @@ static int batch_decoder_decode_mfc(batch_decoder_t *bd, FILE *infh, int sf,
     return rv;
 }
 
+/**
+ * Count word errors (substitutions, insertions, deletions) in a hypothesis.
+ */
+static int count_word_errors(char const *hyp, char const *ref,
+        int *out_n_ref)
+{
+    char *hypstr, *refstr, **hypw, **refw;
+    int *prev, *cur, n_hyp, n_ref, i, j, n_err;
+
+    hypstr = ckd_salloc(hyp ? hyp : "");
+    refstr = ckd_salloc(ref);
+    n_hyp = str2words(hypstr, NULL, 0);
+    n_ref = str2words(refstr, NULL, 0);
+    hypw = ckd_calloc(n_hyp + 1, sizeof(*hypw));
+    refw = ckd_calloc(n_ref + 1, sizeof(*refw));
+    str2words(hypstr, hypw, n_hyp);
+    str2words(refstr, refw, n_ref);
+    /* References may end with the utterance ID in parentheses. */
+    if (n_ref > 0 && refw[n_ref - 1][0] == '('
+            && refw[n_ref - 1][strlen(refw[n_ref - 1]) - 1] == ')')
+        --n_ref;
+
+    /* Edit distance, keeping one row at a time. */
+    prev = ckd_calloc(n_hyp + 1, sizeof(*prev));
+    cur = ckd_calloc(n_hyp + 1, sizeof(*cur));
+    for (j = 0; j <= n_hyp; ++j)
+        prev[j] = j;
+    for (i = 1; i <= n_ref; ++i) {
+        int *tmp;
+        cur[0] = i;
+        for (j = 1; j <= n_hyp; ++j) {
+            int best = prev[j - 1]
+                + (strcmp(refw[i - 1], hypw[j - 1]) != 0);
+            if (prev[j] + 1 < best)
+                best = prev[j] + 1;
+            if (cur[j - 1] + 1 < best)
+                best = cur[j - 1] + 1;
+            cur[j] = best;
+        }
+        tmp = prev;
+        prev = cur;
+        cur = tmp;
+    }
+    n_err = prev[n_hyp];
+
+    ckd_free(prev);
+    ckd_free(cur);
+    ckd_free(hypw);
+    ckd_free(refw);
+    ckd_free(hypstr);
+    ckd_free(refstr);
+    *out_n_ref = n_ref;
+    return n_err;
+}
+
+static void batch_queue_free(batch_queue_t *q)
+{
+    int i;
+
+    if (q == NULL)
+        return;
+    lineiter_free(q->li);
+    lineiter_free(q->ali);
+    lineiter_free(q->rli);
+    for (i = q->n_written; i < q->n_taken; ++i)
+        ckd_free(q->hyps[i]);
+    ckd_free(q->hyps);
+    if (q->ctlfh != NULL)
+        fclose(q->ctlfh);
+    if (q->alignfh != NULL)
+        fclose(q->alignfh);
+    if (q->reffh != NULL)
+        fclose(q->reffh);
+    if (q->hypfh != NULL)
+        fclose(q->hypfh);
+    if (q->mtx != NULL)
+        sbmtx_free(q->mtx);
+    cmd_ln_free_r(q->config);
+    ckd_free(q);
+}
+
+static batch_queue_t *batch_queue_init(cmd_ln_t *config)
+{
+    batch_queue_t *q;
+    char const *str;
+
+    q = ckd_calloc(1, sizeof(*q));
+    q->config = cmd_ln_retain(config);
+    if ((str = cmd_ln_str_r(config, "-ctl")) == NULL) {
+        E_ERROR("-ctl argument not present, nothing to do in batch mode!\n");
+        goto error_out;
+    }
+    if ((q->ctlfh = fopen(str, "r")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open control file '%s'", str);
+        goto error_out;
+    }
+    if ((str = cmd_ln_str_r(config, "-align")) != NULL) {
+        if ((q->alignfh = fopen(str, "r")) == NULL) {
+            E_ERROR_SYSTEM("Failed to open align file '%s'", str);
+        }
+    }
+    if ((str = cmd_ln_str_r(config, "-ref")) != NULL) {
+        if ((q->reffh = fopen(str, "r")) == NULL) {
+            E_ERROR_SYSTEM("Failed to open reference file '%s'", str);
+        }
+    }
+    if ((str = cmd_ln_str_r(config, "-hyp")) != NULL) {
+        if ((q->hypfh = fopen(str, "w")) == NULL) {
+            E_ERROR_SYSTEM("Failed to open hypothesis file '%s'", str);
+        }
+    }
+    q->mtx = sbmtx_init();
+    q->li = lineiter_start(q->ctlfh);
+    if (q->alignfh)
+        q->ali = lineiter_start(q->alignfh);
+    if (q->reffh)
+        q->rli = lineiter_start(q->reffh);
+    return q;
+
+    error_out:
+    batch_queue_free(q);
+    return NULL;
+}
+
+/**
+ * Take the next utterance to decode from the queue.
+ *
+ * @return TRUE if one was taken, FALSE if there are none left.
+ */
+static int batch_queue_next(batch_queue_t *q, batch_utt_t *utt)
+{
+    int32 ctloffset, ctlcount, ctlincr;
+    int found = FALSE;
+
+    ctloffset = cmd_ln_int32_r(q->config, "-ctloffset");
+    ctlcount = cmd_ln_int32_r(q->config, "-ctlcount");
+    ctlincr = cmd_ln_int32_r(q->config, "-ctlincr");
+
+    sbmtx_lock(q->mtx);
+    while (q->li && !found) {
+        if (ctlcount != -1 && q->li->lineno >= ctloffset + ctlcount) {
+            lineiter_free(q->li);
+            q->li = NULL;
+            break;
+        }
+        if (q->li->lineno >= ctloffset
+            && (q->li->lineno - ctloffset) % ctlincr == 0) {
+            if (q->n_taken == q->n_hyps_alloc) {
+                q->n_hyps_alloc = q->n_hyps_alloc ? q->n_hyps_alloc * 2 : 64;
+                q->hyps = ckd_realloc(q->hyps,
+                                      q->n_hyps_alloc * sizeof(*q->hyps));
+                memset(q->hyps + q->n_taken, 0,
+                       (q->n_hyps_alloc - q->n_taken) * sizeof(*q->hyps));
+            }
+            utt->idx = q->n_taken++;
+            utt->lineno = q->li->lineno;
+            utt->ctl = ckd_salloc(q->li->buf);
+            utt->align = q->ali ? ckd_salloc(q->ali->buf) : NULL;
+            utt->ref = q->rli ? ckd_salloc(q->rli->buf) : NULL;
+            found = TRUE;
+        }
+        q->li = lineiter_next(q->li);
+        if (q->ali)
+            q->ali = lineiter_next(q->ali);
+        if (q->rli)
+            q->rli = lineiter_next(q->rli);
+    }
+    sbmtx_unlock(q->mtx);
+    return found;
+}
+
+/**
+ * Finish an utterance taken from the queue, writing its hypothesis
+ * line (or none, if NULL) after those of all the utterances before it.
+ */
+static void batch_queue_done(batch_queue_t *q, batch_utt_t *utt,
+        char const *hypline)
+{
+    sbmtx_lock(q->mtx);
+    q->hyps[utt->idx] = ckd_salloc(hypline ? hypline : "");
+    while (q->n_written < q->n_taken && q->hyps[q->n_written]) {
+        if (q->hypfh)
+            fputs(q->hyps[q->n_written], q->hypfh);
+        ckd_free(q->hyps[q->n_written]);
+        q->hyps[q->n_written++] = NULL;
+    }
+    if (q->hypfh)
+        fflush(q->hypfh);
+    sbmtx_unlock(q->mtx);
+    ckd_free(utt->ctl);
+    ckd_free(utt->align);
+    ckd_free(utt->ref);
+}
+
+/**
+ * Decode one utterance.
+ *
+ * @param out_hypline Output: line for the hypothesis file, to be freed
+ *                    by the caller, if one is being written.
+ */
 int batch_decoder_decode(batch_decoder_t *bd, char *file, char *uttid,
-        int32 sf, int32 ef, alignment_t *al)
+        int32 sf, int32 ef, alignment_t *al, char const *ref,
+        char **out_hypline)
 {
     featbuf_t *fb;
     FILE *infh;
@@ -266,12 +544,31 @@ int batch_decoder_decode(batch_decoder_t *bd, char *file, char *uttid,
     rv = batch_decoder_decode_mfc(bd, infh, sf, ef, al);
 
     featbuf_producer_end_utt(fb);
-    if (bd->hypfh) {
+    bd->stats.wall += get_time_delta(bd);
+    ++bd->stats.n_utt;
+    if (bd->tree_arcs) {
+        arc_buffer_stats_t abs;
+        arc_buffer_get_stats(bd->tree_arcs, &abs);
+        if (abs.max_lag_sf > bd->stats.max_lag_sf)
+            bd->stats.max_lag_sf = abs.max_lag_sf;
+        bd->stats.n_stalls += abs.n_stalls;
+        bd->stats.stall_sec += abs.stall_sec;
+    }
+    if (bd->queue->hypfh || ref) {
         char const *hyp;
         int32 score;
-        hyp = search_hyp(bd->fwdflat, &score);
-        fprintf(bd->hypfh, "%s (%s %d)\n",
-                hyp, uttid, score);
+        hyp = search_hyp(bd->final, &score);
+        if (hyp == NULL)
+            hyp = "";
+        if (bd->queue->hypfh) {
+            *out_hypline = ckd_malloc(strlen(hyp) + strlen(uttid) + 32);
+            sprintf(*out_hypline, "%s (%s %d)\n", hyp, uttid, score);
+        }
+        if (ref) {
+            int n_ref;
+            bd->stats.n_errors += count_word_errors(hyp, ref, &n_ref);
+            bd->stats.n_ref_words += n_ref;
+        }
     }
 
     fclose(infh);
@@ -317,45 +614,32 @@ parse_alignment(char *line, dict2pid_t *d2p)
 
 int batch_decoder_run(batch_decoder_t *bd)
 {
-    int32 ctloffset, ctlcount, ctlincr;
-    lineiter_t *li, *ali = NULL;
+    batch_utt_t utt;
 
     search_run(bd->fwdtree);
-    search_run(bd->fwdflat);
-
-    ctloffset = cmd_ln_int32_r(bd->config, "-ctloffset");
-    ctlcount = cmd_ln_int32_r(bd->config, "-ctlcount");
-    ctlincr = cmd_ln_int32_r(bd->config, "-ctlincr");
+    if (bd->fwdflat)
+        search_run(bd->fwdflat);
+    if (bd->latgen)
+        search_run(bd->latgen);
 
-    if (bd->alignfh)
-        ali = lineiter_start(bd->alignfh);
-    for (li = lineiter_start(bd->ctlfh); li; li = lineiter_next(li)) {
+    /* Take utterances from the queue until there are none left, so
+     * that no stream sits idle while another has a backlog. */
+    while (batch_queue_next(bd->queue, &utt)) {
         alignment_t *al = NULL;
+        char *hypline = NULL;
         char *wptr[4];
         int32 nf, sf, ef;
 
-        if (li->lineno < ctloffset) {
-            if (ali)
-                ali = lineiter_next(ali);
-            continue;
-        }
-        if ((li->lineno - ctloffset) % ctlincr != 0) {
-            if (ali)
-                ali = lineiter_next(ali);
-            continue;
-        }
-        if (ctlcount != -1 && li->lineno >= ctloffset + ctlcount)
-            break;
-        if (ali)
-            al = parse_alignment(ali->buf, search_factory_d2p(bd->sf));
+        if (utt.align)
+            al = parse_alignment(utt.align, search_factory_d2p(bd->sf));
         sf = 0;
         ef = -1;
-        nf = str2words(li->buf, wptr, 4);
+        nf = str2words(utt.ctl, wptr, 4);
         if (nf == 0) {
             /* Do nothing. */
         }
         else if (nf < 0) {
-            E_ERROR("Unexpected extra data in control file at line %d\n", li->lineno);
+            E_ERROR("Unexpected extra data in control file at line %d\n", utt.lineno);
         }
         else
         {
@@ -369,12 +653,20 @@ int batch_decoder_run(batch_decoder_t *bd)
             if (nf > 3)
             uttid = wptr[3];
             /* Do actual decoding. */
-            batch_decoder_decode(bd, file, uttid, sf, ef, al);
+            batch_decoder_decode(bd, file, uttid, sf, ef, al,
+                                 utt.ref, &hypline);
         }
         alignment_free(al);
-        if (ali) ali = lineiter_next(ali);
+        batch_queue_done(bd->queue, &utt, hypline);
+        ckd_free(hypline);
     }
     featbuf_producer_shutdown(search_factory_featbuf(bd->sf));
+    /* Wait for all passes to finish so their times are complete. */
+    search_wait(bd->fwdtree);
+    if (bd->fwdflat)
+        search_wait(bd->fwdflat);
+    if (bd->latgen)
+        search_wait(bd->latgen);
     return 0;
 }
 
@@ -391,6 +683,7 @@ static int search_cb(search_t *search, search_event_t *evt, void *udata)
         hypfh = val;
     else
         hypfh = stdout;
+    sbmtx_lock(bd->outmtx);
     fprintf(hypfh, "time delta %f ", delta);
     switch (evt->event) {
         case SEARCH_PARTIAL_RESULT: {
@@ -426,52 +719,73 @@ static int search_cb(search_t *search, search_event_t *evt, void *udata)
             break;
         }
     }
+    sbmtx_unlock(bd->outmtx);
     return 0;
 }
 
+/**
+ * Check whether a comma-separated list of passes contains one.
+ */
+static int has_pass(char const *passes, char const *name)
+{
+    size_t len = strlen(name);
+    char const *c;
+
+    for (c = passes; c; c = strchr(c, ',')) {
+        if (*c == ',')
+            ++c;
+        if (0 == strncmp(c, name, len) && (c[len] == ',' || c[len] == '\0'))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * Create a decoder for one stream.
+ *
+ * @param passes Comma-separated list of passes to run.
+ * @param first Decoder for the first stream, whose models and output
+ *              files are shared, or NULL if this is the first stream.
+ * @param queue Queue of utterances shared by all streams.
+ */
 batch_decoder_t *
-batch_decoder_init_argv(int argc, char *argv[])
+batch_decoder_init(cmd_ln_t *config, char const *passes,
+        batch_decoder_t *first, batch_queue_t *queue)
 {
     batch_decoder_t *bd;
     char const *str;
 
     bd = ckd_calloc(1, sizeof(*bd));
-    bd->config = cmd_ln_parse_r(NULL, ms_args_def, argc, argv, FALSE);
-    if ((str = cmd_ln_str_r(bd->config, "-ctl")) == NULL) {
-        E_ERROR("-ctl argument not present, nothing to do in batch mode!\n");
-        goto error_out;
-    }
-    if ((bd->ctlfh = fopen(str, "r")) == NULL) {
-        E_ERROR_SYSTEM("Failed to open control file '%s'", str);
-        goto error_out;
-    }
-    if ((str = cmd_ln_str_r(bd->config, "-align")) != NULL) {
-        if ((bd->alignfh = fopen(str, "r")) == NULL) {
-            E_ERROR_SYSTEM("Failed to open align file '%s'", str);
-        }
-    }
-    if ((str = cmd_ln_str_r(bd->config, "-hyp")) != NULL) {
-        if ((bd->hypfh = fopen(str, "w")) == NULL) {
-            E_ERROR_SYSTEM("Failed to open hypothesis file '%s'", str);
-        }
-    }
+    bd->config = cmd_ln_retain(config);
+    bd->queue = queue;
 
-    if ((bd->sf = search_factory_init_cmdln(bd->config)) == NULL)
+    /* Streams after the first share its acoustic model, dictionary
+     * and language models rather than loading their own. */
+    if (first)
+        bd->sf = search_factory_copy(first->sf);
+    else
+        bd->sf = search_factory_init_cmdln(bd->config);
+    if (bd->sf == NULL)
         goto error_out;
     if ((str = cmd_ln_str_r(bd->config, "-fwdtreelm")) != NULL) {
-        if ((bd->fwdtree = search_factory_create(bd->sf, NULL, "fwdtree",
+        if ((bd->fwdtree = search_factory_create(bd->sf,
+                first ? first->fwdtree : NULL, "fwdtree",
                 "-fwdtreelm", str, NULL)) == NULL)
             goto error_out;
-        if ((bd->fwdflat = search_factory_create(bd->sf, NULL, "fwdflat", NULL)) == NULL)
+        if (has_pass(passes, "fwdflat")
+            && (bd->fwdflat = search_factory_create(bd->sf,
+                    first ? first->fwdflat : NULL, "fwdflat", NULL)) == NULL)
             goto error_out;
     }
     else {
-        if ((bd->fwdtree = search_factory_create(bd->sf, NULL, "fwdtree", NULL)) == NULL)
+        if ((bd->fwdtree = search_factory_create(bd->sf,
+                first ? first->fwdtree : NULL, "fwdtree", NULL)) == NULL)
             goto error_out;
-        if ((bd->fwdflat = search_factory_create(bd->sf, bd->fwdtree, "fwdflat", NULL)) == NULL)
+        if (has_pass(passes, "fwdflat")
+            && (bd->fwdflat = search_factory_create(bd->sf, bd->fwdtree, "fwdflat", NULL)) == NULL)
             goto error_out;
     }
-    if ((str = cmd_ln_str_r(bd->config, "-vm")) != NULL) {
+    if (bd->fwdflat && (str = cmd_ln_str_r(bd->config, "-vm")) != NULL) {
         vocab_map_t *vm = vocab_map_init(search_factory_d2p(bd->sf)->dict);
         FILE *vmfh;
         if (vm == NULL)
@@ -487,14 +801,30 @@ batch_decoder_init_argv(int argc, char *argv[])
         fclose(vmfh);
         fwdflat_search_set_vocab_map(bd->fwdflat, vm);
     }
-    //if ((bd->latgen = search_factory_create(bd->sf, "latgen", NULL)) == NULL)
-    //goto error_out;
+    if (bd->fwdflat && has_pass(passes, "latgen")) {
+        if ((bd->latgen = search_factory_create(bd->sf, NULL, "latgen", NULL)) == NULL)
+            goto error_out;
+    }
 
-    search_link(bd->fwdtree, bd->fwdflat, "fwdtree", FALSE);
-    // search_link(bd->fwdflat, bd->latgen, "fwdflat", TRUE);
+    bd->final = bd->fwdtree;
+    if (bd->fwdflat) {
+        bd->tree_arcs = search_link(bd->fwdtree, bd->fwdflat, "fwdtree", FALSE);
+        bd->final = bd->fwdflat;
+    }
+    if (bd->latgen)
+        search_link(bd->fwdflat, bd->latgen, "fwdflat", TRUE);
     search_set_cb(bd->fwdtree, search_cb, bd);
-    search_set_cb(bd->fwdflat, search_cb, bd);
+    if (bd->fwdflat)
+        search_set_cb(bd->fwdflat, search_cb, bd);
 
+    /* Streams after the first write to its output files. */
+    if (first) {
+        bd->hypfiles = first->hypfiles;
+        bd->outmtx = first->outmtx;
+        return bd;
+    }
+    bd->owns_output = TRUE;
+    bd->outmtx = sbmtx_init();
     bd->hypfiles = hash_table_new(0, FALSE);
     if ((str = cmd_ln_str_r(bd->config, "-hypprefix"))) {
         char *hypfile;
@@ -529,37 +859,203 @@ int batch_decoder_free(batch_decoder_t *bd)
     hash_iter_t *itor;
     if (bd == NULL)
         return 0;
-    if (bd->ctlfh != NULL)
-        fclose(bd->ctlfh);
-    if (bd->alignfh != NULL)
-        fclose(bd->alignfh);
-    if (bd->hypfh != NULL)
-        fclose(bd->hypfh);
     cmd_ln_free_r(bd->config);
     search_free(bd->fwdtree);
     search_free(bd->fwdflat);
-    //search_free(bd->latgen);
+    search_free(bd->latgen);
     search_factory_free(bd->sf);
-    for (itor = hash_table_iter(bd->hypfiles); itor; itor
-            = hash_table_iter_next(itor)) {
-        fclose(hash_entry_val(itor->ent));
+    if (bd->owns_output) {
+        for (itor = hash_table_iter(bd->hypfiles); itor; itor
+                = hash_table_iter_next(itor)) {
+            fclose(hash_entry_val(itor->ent));
+        }
+        hash_table_free(bd->hypfiles);
+        sbmtx_free(bd->outmtx);
     }
-    hash_table_free(bd->hypfiles);
     ckd_free(bd);
     return 0;
 }
 
+static int batch_stream_main(sbthread_t *th)
+{
+    return batch_decoder_run(sbthread_arg(th));
+}
+
+/**
+ * Write benchmark results for one pass in JSON.
+ */
+static void batch_bench_pass(batch_decoder_t **bds, int n_streams,
+        char const *name, double audio_sec, FILE *fh)
+{
+    double cpu, wall, total_cpu = 0, total_wall = 0;
+    int i;
+
+    for (i = 0; i < n_streams; ++i) {
+        search_t *search = NULL;
+        if (0 == strcmp(name, "fwdtree"))
+            search = bds[i]->fwdtree;
+        else if (0 == strcmp(name, "fwdflat"))
+            search = bds[i]->fwdflat;
+        else if (0 == strcmp(name, "latgen"))
+            search = bds[i]->latgen;
+        if (search == NULL)
+            return;
+        search_get_times(search, &cpu, &wall);
+        total_cpu += cpu;
+        total_wall += wall;
+    }
+    fprintf(fh, ", \"%s\": {\"cpu_sec\": %.3f, \"busy_sec\": %.3f, "
+            "\"cpu_xrt\": %.4f}", name, total_cpu, total_wall,
+            audio_sec > 0 ? total_cpu / audio_sec : 0.0);
+}
+
+/**
+ * Write one line of benchmark results in JSON.
+ */
+static void batch_bench_report(batch_decoder_t **bds, int n_streams,
+        char const *passes, double elapsed, FILE *fh)
+{
+    batch_stats_t total;
+    struct rusage ru;
+    double audio_sec;
+    int32 n_frames;
+    int i;
+
+    memset(&total, 0, sizeof(total));
+    n_frames = 0;
+    for (i = 0; i < n_streams; ++i) {
+        batch_stats_t *st = &bds[i]->stats;
+        n_frames += search_get_times(bds[i]->fwdtree, NULL, NULL);
+        total.n_utt += st->n_utt;
+        total.wall += st->wall;
+        total.n_ref_words += st->n_ref_words;
+        total.n_errors += st->n_errors;
+        if (st->max_lag_sf > total.max_lag_sf)
+            total.max_lag_sf = st->max_lag_sf;
+        total.n_stalls += st->n_stalls;
+        total.stall_sec += st->stall_sec;
+    }
+    audio_sec = (double)n_frames / cmd_ln_int32_r(bds[0]->config, "-frate");
+    getrusage(RUSAGE_SELF, &ru);
+
+    fprintf(fh, "{\"passes\": \"%s\", \"streams\": %d, \"utts\": %d, "
+            "\"frames\": %d, \"audio_sec\": %.2f, \"wall_sec\": %.3f, "
+            "\"xrt\": %.4f, \"utt_xrt\": %.4f",
+            passes, n_streams, total.n_utt, n_frames, audio_sec, elapsed,
+            audio_sec > 0 ? elapsed / audio_sec : 0.0,
+            audio_sec > 0 ? total.wall / audio_sec : 0.0);
+    batch_bench_pass(bds, n_streams, "fwdtree", audio_sec, fh);
+    batch_bench_pass(bds, n_streams, "fwdflat", audio_sec, fh);
+    batch_bench_pass(bds, n_streams, "latgen", audio_sec, fh);
+    fprintf(fh, ", \"max_lag_frames\": %d, \"stalls\": %d, "
+            "\"stall_sec\": %.3f",
+            total.max_lag_sf, total.n_stalls, total.stall_sec);
+    if (total.n_ref_words > 0)
+        fprintf(fh, ", \"ref_words\": %d, \"errors\": %d, \"wer\": %.4f",
+                total.n_ref_words, total.n_errors,
+                (double)total.n_errors / total.n_ref_words);
+    fprintf(fh, ", \"peak_rss_kb\": %ld}\n", (long)ru.ru_maxrss);
+    fflush(fh);
+}
+
+/**
+ * Decode the control file with one set of passes in each stream.
+ */
+static int batch_run_passes(cmd_ln_t *config, char const *passes,
+        FILE *benchfh)
+{
+    batch_decoder_t **bds;
+    batch_queue_t *queue;
+    struct timeval start, end;
+    int n_streams, i, rv = 0;
+
+    n_streams = cmd_ln_int32_r(config, "-nstreams");
+    if (n_streams < 1)
+        n_streams = 1;
+    if ((queue = batch_queue_init(config)) == NULL)
+        return -1;
+    bds = ckd_calloc(n_streams, sizeof(*bds));
+    for (i = 0; i < n_streams; ++i) {
+        if ((bds[i] = batch_decoder_init(config, passes,
+                i ? bds[0] : NULL, queue)) == NULL) {
+            E_ERROR("Failed to initialize decoder\n");
+            rv = -1;
+            goto error_out;
+        }
+    }
+
+    gettimeofday(&start, NULL);
+    if (n_streams == 1)
+        batch_decoder_run(bds[0]);
+    else {
+        sbthread_t **threads = ckd_calloc(n_streams, sizeof(*threads));
+        for (i = 0; i < n_streams; ++i)
+            threads[i] = sbthread_start(NULL, batch_stream_main, bds[i]);
+        for (i = 0; i < n_streams; ++i)
+            sbthread_free(threads[i]);
+        ckd_free(threads);
+    }
+    gettimeofday(&end, NULL);
+
+    if (benchfh)
+        batch_bench_report(bds, n_streams, passes,
+                (end.tv_sec - start.tv_sec)
+                + (end.tv_usec - start.tv_usec) / 1000000.0,
+                benchfh);
+
+    error_out:
+    /* The first stream owns the shared output files. */
+    for (i = n_streams - 1; i >= 0; --i)
+        batch_decoder_free(bds[i]);
+    ckd_free(bds);
+    batch_queue_free(queue);
+    return rv;
+}
+
 int main(int argc, char *argv[])
 {
-    batch_decoder_t *bd;
+    cmd_ln_t *config;
+    FILE *benchfh = NULL;
+    char const *str;
+    char *passes, *p, *next;
+    int rv = 0;
 
-    if ((bd = batch_decoder_init_argv(argc, argv)) == NULL) {
-        E_ERROR("Failed to initialize decoder\n");
+    if ((config = cmd_ln_parse_r(NULL, ms_args_def, argc, argv, FALSE)) == NULL)
         return 1;
+    if ((str = cmd_ln_str_r(config, "-benchout")) != NULL) {
+        if ((benchfh = fopen(str, "a")) == NULL) {
+            E_ERROR_SYSTEM("Failed to open benchmark output '%s'", str);
+            cmd_ln_free_r(config);
+            return 1;
+        }
+    }
+    if ((str = cmd_ln_str_r(config, "-trace")) != NULL) {
+#ifndef SPHINX_TRACE
+        E_WARN("Tracing hooks were not compiled in, %s will be empty\n", str);
+#endif
+        if (ptrace_open(str) < 0) {
+            if (benchfh)
+                fclose(benchfh);
+            cmd_ln_free_r(config);
+            return 1;
+        }
     }
 
-    batch_decoder_run(bd);
-    batch_decoder_free(bd);
+    /* Run each set of passes in turn. */
+    passes = ckd_salloc(cmd_ln_str_r(config, "-passes"));
+    for (p = passes; p && rv == 0; p = next) {
+        if ((next = strchr(p, ':')) != NULL)
+            *next++ = '\0';
+        if (*p == '\0')
+            continue;
+        if (batch_run_passes(config, p, benchfh) < 0)
+            rv = 1;
+    }
+    ckd_free(passes);
 
-    return 0;
+    ptrace_close();
+    if (benchfh)
+        fclose(benchfh);
+    cmd_ln_free_r(config);
+    return rv;
 }
@@ -81,7 +81,15 @@
 #pragma warning (disable: 4996)
 #endif
 
+#if !defined(_WIN32) || defined(__CYGWIN__)
+#include <pthread.h>
+#endif
+#ifdef HAVE_SYS_SDT_H
+#include <sys/sdt.h>
+#endif
+
 #include "sphinxbase/profile.h"
+#include "sphinxbase/sbthread.h"
 #include "sphinxbase/err.h"
 #include "sphinxbase/ckd_alloc.h"
 
@@ -336,3 +344,116 @@ host_endian(void)
 
     return (endian);
 }
+
+/* Trace file, events written to it and the time it was opened.  The
+ * file pointer is checked without the lock, so it must not change
+ * while other threads are tracing. */
+static FILE *trace_fh;
+static sbmtx_t *trace_mtx;
+static int64 trace_n_events;
+static float64 trace_start;
+
+static float64
+trace_sec(void)
+{
+#if (! defined(_WIN32)) || defined(GNUWINCE) || defined(__SYMBIAN32__)
+    struct timeval tv;
+
+    gettimeofday(&tv, 0);
+    return make_sec(&tv);
+#elif defined(_WIN32_WCE)
+    return GetTickCount() / 1000.0;
+#else
+    return (float64) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static unsigned long
+trace_tid(void)
+{
+#if defined(_WIN32) && !defined(__CYGWIN__)
+    return (unsigned long)GetCurrentThreadId();
+#else
+    return (unsigned long)pthread_self();
+#endif
+}
+
+static void
+trace_event(const char *cat, const char *name, char ph,
+            int has_value, int64 value)
+{
+    float64 ts;
+
+    sbmtx_lock(trace_mtx);
+    ts = (trace_sec() - trace_start) * 1e6;
+    fprintf(trace_fh, "%s{\"ph\":\"%c\",\"name\":\"%s\"",
+            trace_n_events ? ",\n" : "", ph, name);
+    if (cat)
+        fprintf(trace_fh, ",\"cat\":\"%s\"", cat);
+    fprintf(trace_fh, ",\"ts\":%.1f,\"pid\":1,\"tid\":%lu",
+            ts, trace_tid());
+    if (has_value)
+        fprintf(trace_fh, ",\"args\":{\"value\":%lld}", (long long)value);
+    fprintf(trace_fh, "}");
+    ++trace_n_events;
+    sbmtx_unlock(trace_mtx);
+}
+
+int
+ptrace_open(const char *file)
+{
+    if (trace_fh)
+        ptrace_close();
+    if ((trace_fh = fopen(file, "w")) == NULL) {
+        E_ERROR("Failed to open trace file '%s': %s\n", file, strerror(errno));
+        return -1;
+    }
+    if (trace_mtx == NULL)
+        trace_mtx = sbmtx_init();
+    trace_n_events = 0;
+    trace_start = trace_sec();
+    fprintf(trace_fh, "{\"traceEvents\":[\n");
+    return 0;
+}
+
+void
+ptrace_close(void)
+{
+    if (trace_fh == NULL)
+        return;
+    fprintf(trace_fh, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(trace_fh);
+    trace_fh = NULL;
+    sbmtx_free(trace_mtx);
+    trace_mtx = NULL;
+}
+
+void
+ptrace_begin(const char *cat, const char *name)
+{
+#ifdef HAVE_SYS_SDT_H
+    DTRACE_PROBE2(sphinxbase, span_begin, cat, name);
+#endif
+    if (trace_fh)
+        trace_event(cat, name, 'B', FALSE, 0);
+}
+
+void
+ptrace_end(const char *cat, const char *name)
+{
+#ifdef HAVE_SYS_SDT_H
+    DTRACE_PROBE2(sphinxbase, span_end, cat, name);
+#endif
+    if (trace_fh)
+        trace_event(cat, name, 'E', FALSE, 0);
+}
+
+void
+ptrace_counter(const char *name, int64 value)
+{
+#ifdef HAVE_SYS_SDT_H
+    DTRACE_PROBE2(sphinxbase, counter, name, value);
+#endif
+    if (trace_fh)
+        trace_event(NULL, name, 'C', TRUE, value);
+}
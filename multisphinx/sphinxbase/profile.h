@@ -224,6 +224,69 @@ int32 host_pclk (int32 dummy);
 SPHINXBASE_EXPORT
 int32 host_endian ( void );
 
+/**
+ * Start writing trace events to a file.
+ *
+ * Events are written in the Chrome trace event format, which can be
+ * loaded into chrome://tracing or Perfetto to see what each thread
+ * was doing when.  They come from the PTRACE_BEGIN(), PTRACE_END()
+ * and PTRACE_COUNTER() hooks, which are compiled in only if
+ * SPHINX_TRACE is defined (configure with --enable-trace), and cost a
+ * test of a global pointer when no trace file is open.  Where
+ * <sys/sdt.h> is available the hooks are also static probes (USDT)
+ * named sphinxbase:span_begin, sphinxbase:span_end and
+ * sphinxbase:counter, which perf and bpftrace can attach to without
+ * a trace file.
+ *
+ * Open the trace file before starting any threads which use the
+ * hooks, and close it after they have finished.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+SPHINXBASE_EXPORT
+int ptrace_open(const char *file);
+
+/**
+ * Finish and close the trace file.
+ */
+SPHINXBASE_EXPORT
+void ptrace_close(void);
+
+/**
+ * Record the start of a span of time in the current thread.
+ *
+ * Spans in one thread must nest, and each must be ended with
+ * ptrace_end() before its enclosing span is.
+ *
+ * @param cat Category, usually the subsystem (e.g. "acmod", "search").
+ * @param name Name of the span.  Both strings must be constant, as
+ *             they are not copied.
+ */
+SPHINXBASE_EXPORT
+void ptrace_begin(const char *cat, const char *name);
+
+/**
+ * Record the end of the innermost span in the current thread.
+ */
+SPHINXBASE_EXPORT
+void ptrace_end(const char *cat, const char *name);
+
+/**
+ * Record the value of a counter at the current time.
+ */
+SPHINXBASE_EXPORT
+void ptrace_counter(const char *name, int64 value);
+
+#ifdef SPHINX_TRACE
+#define PTRACE_BEGIN(cat, name) ptrace_begin(cat, name)
+#define PTRACE_END(cat, name) ptrace_end(cat, name)
+#define PTRACE_COUNTER(name, value) ptrace_counter(name, value)
+#else
+#define PTRACE_BEGIN(cat, name)
+#define PTRACE_END(cat, name)
+#define PTRACE_COUNTER(name, value)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
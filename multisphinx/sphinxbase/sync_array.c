@@ -44,21 +44,77 @@
 #include <string.h>
 
 #include <sphinxbase/sbthread.h>
-#include <sphinxbase/garray.h>
+#include <sphinxbase/glist.h>
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/err.h>
 
 #include "sync_array.h"
 
+/*
+ * Atomic operations.  The producer publishes new elements by storing
+ * the next index, so consumers never need a lock to get or wait for
+ * them.  These are sequentially consistent, since the producer and
+ * parked consumers have to agree on the order in which the next index
+ * and the number of waiters change.
+ */
+#if defined(__GNUC__)
+#define sa_load(ptr) __atomic_load_n(ptr, __ATOMIC_SEQ_CST)
+#define sa_store(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_SEQ_CST)
+#elif defined(_WIN32)
+#include <windows.h>
+#define sa_load(ptr) (MemoryBarrier(), *(ptr))
+#define sa_store(ptr, val) do { *(ptr) = (val); MemoryBarrier(); } while (0)
+#else
+#error "sync_array requires atomic operations for this compiler"
+#endif
+
+/**
+ * Number of elements in each chunk.
+ */
+#define SYNC_ARRAY_CHUNK 256
+
+/*
+ * Elements are stored in fixed-size chunks which never move, each of
+ * which is followed by SYNC_ARRAY_CHUNK release counts.  Chunk c
+ * holds elements c * SYNC_ARRAY_CHUNK and up.  Only the producer
+ * writes to the chunk directory.  When it has to grow, the old
+ * directory is kept around (on sa->old_chunks) since consumers might
+ * still be looking at it.
+ */
 struct sync_array_s {
     int refcount;
-    garray_t *data;
-    garray_t *count;
-    sbmtx_t *mtx;
-    sbevent_t *evt;
-    size_t final_next_idx;
+    size_t ent_size;
+    uint8 ** volatile chunks;
+    size_t n_chunks_alloc;
+    glist_t old_chunks;
+    size_t max_chunks;
+
+    volatile size_t next_idx;   /**< Published element count. */
+    volatile size_t base_idx;   /**< First unreleased element. */
+    volatile size_t final_next_idx;
+
+    volatile int n_waiters;     /**< Number of consumers on sa->waiters. */
+    struct sa_waiter_s *waiters;
+    sbmtx_t *park_mtx;          /**< Protects waiters. */
+    sbmtx_t *mtx;               /**< Protects refcount and release counts. */
 };
 
+/**
+ * A parked consumer.  Each one has its own wakeup, so that nobody
+ * else can take it.
+ */
+typedef struct sa_waiter_s {
+    sbsem_t *wake;
+    struct sa_waiter_s *next;
+} sa_waiter_t;
+
+#define sa_ent(sa, chunks, idx)                                 \
+    ((chunks)[(idx) / SYNC_ARRAY_CHUNK]                         \
+     + ((idx) % SYNC_ARRAY_CHUNK) * (sa)->ent_size)
+#define sa_count(sa, chunks, idx)                               \
+    ((chunks)[(idx) / SYNC_ARRAY_CHUNK]                         \
+     + SYNC_ARRAY_CHUNK * (sa)->ent_size + (idx) % SYNC_ARRAY_CHUNK)
+
 sync_array_t *
 sync_array_init(size_t n_ent, size_t ent_size)
 {
@@ -66,10 +122,11 @@ sync_array_init(size_t n_ent, size_t ent_size)
 
     sa = ckd_calloc(1, sizeof(*sa));
     sa->refcount = 1;
-    sa->data = garray_init(n_ent, ent_size);
-    sa->count = garray_init(n_ent, 1);
+    sa->ent_size = ent_size;
+    sa->n_chunks_alloc = n_ent / SYNC_ARRAY_CHUNK + 1;
+    sa->chunks = ckd_calloc(sa->n_chunks_alloc, sizeof(*sa->chunks));
+    sa->park_mtx = sbmtx_init();
     sa->mtx = sbmtx_init();
-    sa->evt = sbevent_init(FALSE);
     sa->final_next_idx = (size_t)-1;
 
     return sa;
@@ -89,6 +146,26 @@ sync_array_retain(sync_array_t *sa)
     return sa;
 }
 
+/**
+ * Free all chunks and retired chunk directories.
+ */
+static void
+sync_array_free_chunks(sync_array_t *sa)
+{
+    size_t c;
+    gnode_t *gn;
+
+    for (c = sa->base_idx / SYNC_ARRAY_CHUNK;
+         c * SYNC_ARRAY_CHUNK < sa->next_idx; ++c) {
+        ckd_free(sa->chunks[c]);
+        sa->chunks[c] = NULL;
+    }
+    for (gn = sa->old_chunks; gn; gn = gnode_next(gn))
+        ckd_free(gnode_ptr(gn));
+    glist_free(sa->old_chunks);
+    sa->old_chunks = NULL;
+}
+
 int
 sync_array_free(sync_array_t *sa)
 {
@@ -97,26 +174,28 @@ sync_array_free(sync_array_t *sa)
     sbmtx_lock(sa->mtx);
     if (--sa->refcount > 0) {
         int refcount = sa->refcount;
-        size_t i;
+        size_t i, next_idx;
         /* FIXME: This may lead to memory leaks.  We don't know
          * exactly which elements this thread had laid claim to, so we
          * have to decrement the count on all of them.  Best practice,
          * as described in the header, is to have a consumer release
          * all remaining elements before freeing the array. */
-        for (i = garray_base(sa->count);
-             i < garray_next_idx(sa->count); ++i)
-            if (garray_ent(sa->count, uint8, i) > 0)
-                --garray_ent(sa->count, uint8, i);
+        next_idx = sa_load(&sa->next_idx);
+        for (i = sa->base_idx; i < next_idx; ++i) {
+            uint8 *count = sa_count(sa, sa_load(&sa->chunks), i);
+            if (*count > 0)
+                --*count;
+        }
         sbmtx_unlock(sa->mtx);
         return refcount;
     }		
     sbmtx_unlock(sa->mtx);
     E_INFO("Maximum allocation %d items (%d KiB)\n",
-           garray_alloc_size(sa->data),
-           garray_alloc_size(sa->data) * (garray_ent_size(sa->data) + 1) / 1024);
-    garray_free(sa->data);
-    garray_free(sa->count);
-    sbevent_free(sa->evt);
+           (int)(sa->max_chunks * SYNC_ARRAY_CHUNK),
+           (int)(sa->max_chunks * SYNC_ARRAY_CHUNK * (sa->ent_size + 1) / 1024));
+    sync_array_free_chunks(sa);
+    ckd_free(sa->chunks);
+    sbmtx_free(sa->park_mtx);
     sbmtx_free(sa->mtx);
     ckd_free(sa);
     return 0;
@@ -125,83 +204,164 @@ sync_array_free(sync_array_t *sa)
 size_t
 sync_array_next_idx(sync_array_t *sa)
 {
-    return garray_next_idx(sa->data);
+    return sa_load(&sa->next_idx);
 }
 
-int
-sync_array_wait(sync_array_t *sa, size_t idx, int sec, int nsec)
+/**
+ * Wake up all parked consumers.
+ */
+static void
+sync_array_wake(sync_array_t *sa)
 {
-    int tsec, tnsec, nwait = 0;
+    sa_waiter_t *w, *next;
 
-    if (sec == -1) {
-        tsec = 0;
-        tnsec = 50000; /* Arbitrary polling interval. */
+    /* Consumers count themselves as waiters before checking the next
+     * index one last time, so they can't miss this. */
+    if (sa_load(&sa->n_waiters) == 0)
+        return;
+    sbmtx_lock(sa->park_mtx);
+    for (w = sa->waiters; w; w = next) {
+        /* w may go away as soon as it is woken. */
+        next = w->next;
+        sbsem_up(w->wake);
     }
-    else {
-        tsec = sec;
-        tnsec = nsec;
+    sa->waiters = NULL;
+    sa_store(&sa->n_waiters, 0);
+    sbmtx_unlock(sa->park_mtx);
+}
+
+/**
+ * Join the list of parked consumers.
+ */
+static void
+sync_array_park(sync_array_t *sa, sa_waiter_t *w)
+{
+    sbmtx_lock(sa->park_mtx);
+    w->next = sa->waiters;
+    sa->waiters = w;
+    sa_store(&sa->n_waiters, sa->n_waiters + 1);
+    sbmtx_unlock(sa->park_mtx);
+}
+
+/**
+ * Withdraw from the list of parked consumers.
+ */
+static void
+sync_array_unpark(sync_array_t *sa, sa_waiter_t *w)
+{
+    sa_waiter_t **pw;
+
+    sbmtx_lock(sa->park_mtx);
+    for (pw = &sa->waiters; *pw; pw = &(*pw)->next) {
+        if (*pw == w) {
+            *pw = w->next;
+            sa_store(&sa->n_waiters, sa->n_waiters - 1);
+            sbmtx_unlock(sa->park_mtx);
+            return;
+        }
+    }
+    sbmtx_unlock(sa->park_mtx);
+    /* The producer has already woken us up (while holding
+     * sa->park_mtx), so consume the wakeup it sent. */
+    sbsem_down(w->wake, -1, -1);
+}
+
+/**
+ * Check if an element or the end of the array has been reached.
+ *
+ * @return 0 if idx is available, -1 if it never will be, 1 otherwise.
+ */
+static int
+sync_array_check(sync_array_t *sa, size_t idx)
+{
+    size_t next_idx, final_next_idx;
+
+    next_idx = sa_load(&sa->next_idx);
+    final_next_idx = sa_load(&sa->final_next_idx);
+    if (next_idx > idx)
+        return 0;
+    if (idx >= final_next_idx) {
+        E_INFO("idx %d is final (%d)\n", idx, final_next_idx);
+        return -1;
     }
+    return 1;
+}
+
+int
+sync_array_wait(sync_array_t *sa, size_t idx, int sec, int nsec)
+{
+    sa_waiter_t w;
+    int rv;
 
-    /* Wait until length of sa->data > idx or end of utt. */
-    while (1) {
-        sbmtx_lock(sa->mtx);
-        if (garray_next_idx(sa->data) > idx) {
-            sbmtx_unlock(sa->mtx);
-            return 0;
+    if ((rv = sync_array_check(sa, idx)) <= 0)
+        return rv;
+
+    /* We have caught up with the producer, so park until it
+     * publishes something. */
+    w.wake = sbsem_init("sync_array:wake", 0);
+    while (rv > 0) {
+        sync_array_park(sa, &w);
+        if ((rv = sync_array_check(sa, idx)) <= 0) {
+            sync_array_unpark(sa, &w);
+            break;
         }
-        if (idx >= sa->final_next_idx) {
-            E_INFO("idx %d is final (%d)\n", idx, sa->final_next_idx);
-            sbmtx_unlock(sa->mtx);
-            return -1;
+        if (sbsem_down(w.wake, sec, nsec) < 0) {
+            sync_array_unpark(sa, &w);
+            /* Only time out once, as long as nothing arrived. */
+            rv = sync_array_check(sa, idx) == 0 ? 0 : -1;
+            break;
         }
-        sbmtx_unlock(sa->mtx);
-        if (nwait > 0)
-            return -1;
-        /* If we wait forever here, there's a race condition
-         * between the tests above and the wait here.  So we
-         * poll the array no matter what, and if we had a
-         * timeout, we make sure to only do it once. */
-        if (sbevent_wait(sa->evt, tsec, tnsec) < 0)
-            return -1;
-        if (sec != -1)
-            ++nwait;
+        rv = sync_array_check(sa, idx);
     }
-    /* Never reached. */
-    return -1;
+    /* Make sure the producer is done waking us up before w.wake goes
+     * away. */
+    sbmtx_lock(sa->park_mtx);
+    sbmtx_unlock(sa->park_mtx);
+    sbsem_free(w.wake);
+
+    return rv;
 }
 
 int
 sync_array_get(sync_array_t *sa, size_t idx, void *out_ent)
 {
-    sbmtx_lock(sa->mtx);
-    if (idx < garray_base(sa->data)
-        || idx >= garray_next_idx(sa->data)) {
-        sbmtx_unlock(sa->mtx);
+    size_t next_idx, base_idx;
+
+    next_idx = sa_load(&sa->next_idx);
+    base_idx = sa_load(&sa->base_idx);
+    if (idx < base_idx || idx >= next_idx)
         return -1;
-    }
-    memcpy(out_ent, garray_void(sa->data, idx),
-           garray_ent_size(sa->data));
-    sbmtx_unlock(sa->mtx);
+    memcpy(out_ent, sa_ent(sa, sa_load(&sa->chunks), idx), sa->ent_size);
     return 0;
 }
 
-
 int
 sync_array_append(sync_array_t *sa, void *ent)
 {
-    int zero = 0;
-    void *new_ent;
+    size_t next_idx = sa->next_idx;
+    size_t c = next_idx / SYNC_ARRAY_CHUNK;
 
-    sbmtx_lock(sa->mtx);
     /* Not allowed to append to a finalized array. */
-    if (garray_next_idx(sa->data) >= sa->final_next_idx) {
-        sbmtx_unlock(sa->mtx);
+    if (next_idx >= sa_load(&sa->final_next_idx))
         return -1;
+
+    if (next_idx % SYNC_ARRAY_CHUNK == 0) {
+        if (c == sa->n_chunks_alloc) {
+            uint8 **chunks;
+
+            chunks = ckd_calloc(sa->n_chunks_alloc * 2, sizeof(*chunks));
+            memcpy(chunks, sa->chunks, sa->n_chunks_alloc * sizeof(*chunks));
+            sa->old_chunks = glist_add_ptr(sa->old_chunks, sa->chunks);
+            sa_store(&sa->chunks, chunks);
+            sa->n_chunks_alloc *= 2;
+        }
+        sa->chunks[c] = ckd_calloc(SYNC_ARRAY_CHUNK, sa->ent_size + 1);
+        if (c + 1 - sa_load(&sa->base_idx) / SYNC_ARRAY_CHUNK > sa->max_chunks)
+            sa->max_chunks = c + 1 - sa_load(&sa->base_idx) / SYNC_ARRAY_CHUNK;
     }
-    new_ent = garray_append(sa->data, ent);
-    garray_append(sa->count, &zero);
-    sbevent_signal(sa->evt);
-    sbmtx_unlock(sa->mtx);
+    memcpy(sa_ent(sa, sa->chunks, next_idx), ent, sa->ent_size);
+    sa_store(&sa->next_idx, next_idx + 1);
+    sync_array_wake(sa);
 
     return 0;
 }
@@ -209,15 +369,12 @@ sync_array_append(sync_array_t *sa, void *ent)
 size_t
 sync_array_finalize(sync_array_t *sa)
 {
-    sbmtx_lock(sa->mtx);
     /* Not allowed to do this more than once! (or from multiple
      * threads at the same time) */
-    if (sa->final_next_idx != (size_t) -1) {
-        sbmtx_unlock(sa->mtx);
+    if (sa->final_next_idx != (size_t) -1)
         return -1;
-    }
-    sa->final_next_idx = garray_next_idx(sa->data);
-    sbmtx_unlock(sa->mtx);
+    sa_store(&sa->final_next_idx, sa->next_idx);
+    sync_array_wake(sa);
 
     return sa->final_next_idx;
 }
@@ -225,10 +382,9 @@ sync_array_finalize(sync_array_t *sa)
 int
 sync_array_force_quit(sync_array_t *sa)
 {
-    sbmtx_lock(sa->mtx);
     /* Guaranteed to make everything fail. */
-    sa->final_next_idx = 0;
-    sbmtx_unlock(sa->mtx);
+    sa_store(&sa->final_next_idx, 0);
+    sync_array_wake(sa);
     return 0;
 }
 
@@ -236,9 +392,10 @@ int
 sync_array_reset(sync_array_t *sa)
 {
     sbmtx_lock(sa->mtx);
-    garray_reset(sa->data);
-    garray_reset(sa->count);
-    sa->final_next_idx = (size_t)-1;
+    sync_array_free_chunks(sa);
+    sa_store(&sa->base_idx, 0);
+    sa_store(&sa->next_idx, 0);
+    sa_store(&sa->final_next_idx, (size_t)-1);
     sbmtx_unlock(sa->mtx);
     return 0;
 }
@@ -246,49 +403,44 @@ sync_array_reset(sync_array_t *sa)
 size_t
 sync_array_release(sync_array_t *sa, size_t start_idx, size_t end_idx)
 {
-    size_t i;
+    size_t i, base_idx, next_idx;
+    uint8 **chunks;
 
+    /* Consumers release elements at their own pace, so this is the
+     * only place where they have to agree with each other.  The
+     * producer never takes this lock. */
     sbmtx_lock(sa->mtx);
-    if (start_idx < garray_base(sa->count))
-        start_idx = garray_base(sa->count);
-    if (start_idx > garray_next_idx(sa->count))
-        start_idx = garray_next_idx(sa->count);
-    if (end_idx > garray_next_idx(sa->count))
-        end_idx = garray_next_idx(sa->count);
+    next_idx = sa_load(&sa->next_idx);
+    chunks = sa_load(&sa->chunks);
+    base_idx = sa->base_idx;
+    if (start_idx < base_idx)
+        start_idx = base_idx;
+    if (start_idx > next_idx)
+        start_idx = next_idx;
+    if (end_idx > next_idx)
+        end_idx = next_idx;
     if (end_idx <= start_idx) {
         sbmtx_unlock(sa->mtx);
         return start_idx;
     }
     /* Increment count for all indices. */
     for (i = start_idx; i < end_idx; ++i)
-        ++garray_ent(sa->count, uint8, i);
-
-    /* Print stuff for debugging. */
-#if 0
-    printf("rc %d counts[%d:%d]:", (int)sa->refcount,
-           (int)garray_base(sa->count),
-           (int)garray_next_idx(sa->count));
-    for (i = garray_base(sa->count);
-         i < garray_next_idx(sa->count); ++i)
-        printf(" %d", (int)garray_ent(sa->count, uint8, i));
-    printf("\n");
-#endif
+        ++*sa_count(sa, chunks, i);
 
-    /* Find first reachable element. */
-    for (i = garray_base(sa->count);
-         i < garray_next_idx(sa->count); ++i)
-        /* Note that we assume the producer retains one
-         * reference to the array. */
-        if (garray_ent(sa->count, uint8, i) < sa->refcount - 1)
+    /* Find first reachable element.  Note that we assume the
+     * producer retains one reference to the array. */
+    for (i = base_idx; i < next_idx; ++i)
+        if (*sa_count(sa, chunks, i) < sa->refcount - 1)
             break;
 
-    /* Release unreachable elements. */
-    if (i > garray_base(sa->count)) {
-        /* printf("Releasing up to %d\n", (int)i); */
-        garray_shift_from(sa->count, i);
-        garray_shift_from(sa->data, i);
-        garray_set_base(sa->count, i);
-        garray_set_base(sa->data, i);
+    /* Release chunks that are now completely unreachable. */
+    if (i > base_idx) {
+        size_t c;
+
+        sa_store(&sa->base_idx, i);
+        for (c = base_idx / SYNC_ARRAY_CHUNK;
+             c < i / SYNC_ARRAY_CHUNK; ++c)
+            ckd_free(chunks[c]);
     }
     sbmtx_unlock(sa->mtx);
 
@@ -304,5 +456,5 @@ sync_array_release_all(sync_array_t *sa)
 size_t
 sync_array_available(sync_array_t *sa)
 {
-    return garray_base(sa->count);
+    return sa_load(&sa->base_idx);
 }
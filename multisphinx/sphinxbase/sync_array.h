@@ -54,11 +54,17 @@
  * The producer can append to the end of the array, while the
  * consumers have random access to its contents.
  *
+ * Appending, getting and waiting for elements do not take any locks.
+ * Elements are stored in fixed-size chunks which never move, and the
+ * producer publishes each one by advancing the next index.  A
+ * consumer only goes to sleep in sync_array_wait() when it has caught
+ * up with the producer.
+ *
  * In addition, the elements of the array are reference counted and
  * can be released by consumers.  When all consumers have released
  * claims on an initial sequence of the array, the memory associated
- * with it will be released.  Since this implies that the elements may
- * be moved in memory, the array cannot be accessed through pointers.
+ * with it will be released.  Since this implies that their memory may be
+ * freed, the array cannot be accessed through pointers.
  */
 typedef struct sync_array_s sync_array_t;
 
@@ -1,7 +1,7 @@
 #include <stdio.h>
 #include <math.h>
 
-#include "logmath.h"
+#include <sphinxbase/logmath.h>
 
 #define TEST_ASSERT(x) if (!(x)) { fprintf(stderr, "FAIL: %s:%d: %s\n", \
 					   __FILE__, __LINE__, #x); exit(1); }
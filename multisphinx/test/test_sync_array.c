@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sphinxbase/sync_array.h>
+#include <sphinxbase/sbthread.h>
+#include <sphinxbase/err.h>
+
+#include "test_macros.h"
+
+#define N_CONSUMERS 4
+#define N_ENT 10000
+#define N_STEP 2000
+
+static int
+consumer(sbthread_t *th)
+{
+	sync_array_t *sa = sbthread_arg(th);
+	int i;
+
+	for (i = 0;; ++i) {
+		int ent;
+
+		if (sync_array_wait(sa, i, -1, -1) < 0)
+			break;
+		TEST_EQUAL(0, sync_array_get(sa, i, &ent));
+		TEST_EQUAL(i, ent);
+		sync_array_release(sa, i, i + 1);
+	}
+	TEST_EQUAL(N_ENT, i);
+	sync_array_free(sa);
+	return 0;
+}
+
+/* Consumers that wait for different elements, in lock step with a
+ * producer that appends nothing until the last one was taken. */
+typedef struct stepper_s {
+	sync_array_t *sa;
+	sbsem_t *taken;
+	int first;
+	int timed;
+	sbthread_t *th;
+} stepper_t;
+
+static int
+step_consumer(sbthread_t *th)
+{
+	stepper_t *s = sbthread_arg(th);
+	int i, ent;
+
+	for (i = s->first; i < N_STEP; i += N_CONSUMERS) {
+		if (s->timed) {
+			/* Time out often, to withdraw while others are
+			 * being woken up. */
+			int tries = 0;
+			while (sync_array_wait(s->sa, i, 0, 100000) < 0)
+				TEST_ASSERT(++tries < 100000);
+		}
+		else {
+			/* A lost wakeup would stall the producer. */
+			TEST_EQUAL(0, sync_array_wait(s->sa, i, 10, 0));
+		}
+		TEST_EQUAL(0, sync_array_get(s->sa, i, &ent));
+		TEST_EQUAL(i, ent);
+		sync_array_release(s->sa, 0, i + 1);
+		sbsem_up(s->taken);
+	}
+	TEST_ASSERT(sync_array_wait(s->sa, N_STEP, -1, -1) < 0);
+	sync_array_release_all(s->sa);
+	sync_array_free(s->sa);
+	return 0;
+}
+
+static int
+quit_consumer(sbthread_t *th)
+{
+	sync_array_t *sa = sbthread_arg(th);
+
+	TEST_ASSERT(sync_array_wait(sa, 1, -1, -1) < 0);
+	sync_array_release_all(sa);
+	sync_array_free(sa);
+	return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	sync_array_t *sa;
+	sbthread_t *threads[N_CONSUMERS];
+	int i, ent;
+
+	/* Elements can be read back until everybody has released them. */
+	sa = sync_array_init(0, sizeof(int));
+	TEST_ASSERT(sync_array_retain(sa) == sa);
+	for (i = 0; i < 1000; ++i)
+		TEST_EQUAL(0, sync_array_append(sa, &i));
+	TEST_EQUAL(1000, sync_array_next_idx(sa));
+	TEST_EQUAL(0, sync_array_wait(sa, 999, 0, 0));
+	TEST_ASSERT(sync_array_wait(sa, 1000, 0, 1000) < 0);
+	TEST_EQUAL(0, sync_array_get(sa, 500, &ent));
+	TEST_EQUAL(500, ent);
+	TEST_ASSERT(sync_array_get(sa, 1000, &ent) < 0);
+	TEST_EQUAL(600, sync_array_release(sa, 0, 600));
+	TEST_EQUAL(600, sync_array_available(sa));
+	TEST_ASSERT(sync_array_get(sa, 599, &ent) < 0);
+	TEST_EQUAL(0, sync_array_get(sa, 600, &ent));
+	TEST_EQUAL(600, ent);
+
+	/* Finalized arrays stop growing and waking consumers. */
+	TEST_EQUAL(1000, sync_array_finalize(sa));
+	TEST_ASSERT(sync_array_append(sa, &i) < 0);
+	TEST_ASSERT(sync_array_wait(sa, 1000, -1, -1) < 0);
+	TEST_EQUAL(1000, sync_array_release_all(sa));
+
+	/* Reset arrays start over from zero. */
+	TEST_EQUAL(0, sync_array_reset(sa));
+	TEST_EQUAL(0, sync_array_next_idx(sa));
+	TEST_EQUAL(0, sync_array_available(sa));
+	TEST_EQUAL(0, sync_array_append(sa, &i));
+	TEST_EQUAL(0, sync_array_get(sa, 0, &ent));
+	TEST_EQUAL(1000, ent);
+	sync_array_free(sa);
+	sync_array_free(sa);
+
+	/* Consumers in other threads see every element, in order, and
+	 * memory is returned once they all release it. */
+	sa = sync_array_init(0, sizeof(int));
+	for (i = 0; i < N_CONSUMERS; ++i)
+		TEST_ASSERT(threads[i] = sbthread_start(NULL, consumer,
+							sync_array_retain(sa)));
+	for (i = 0; i < N_ENT; ++i)
+		TEST_EQUAL(0, sync_array_append(sa, &i));
+	sync_array_finalize(sa);
+	for (i = 0; i < N_CONSUMERS; ++i) {
+		TEST_EQUAL(0, sbthread_wait(threads[i]));
+		sbthread_free(threads[i]);
+	}
+	TEST_EQUAL(N_ENT, sync_array_available(sa));
+	sync_array_free(sa);
+
+	/* Each consumer is woken up for its own element, even if the
+	 * others are parked (or giving up) at the same time. */
+	{
+		stepper_t steppers[N_CONSUMERS];
+		sbsem_t *taken = sbsem_init("test:taken", 0);
+
+		sa = sync_array_init(0, sizeof(int));
+		for (i = 0; i < N_CONSUMERS; ++i) {
+			steppers[i].sa = sync_array_retain(sa);
+			steppers[i].taken = taken;
+			steppers[i].first = i;
+			steppers[i].timed = i % 2;
+			TEST_ASSERT(steppers[i].th =
+				    sbthread_start(NULL, step_consumer,
+						   &steppers[i]));
+		}
+		for (i = 0; i < N_STEP; ++i) {
+			TEST_EQUAL(0, sync_array_append(sa, &i));
+			TEST_EQUAL(0, sbsem_down(taken, 10, 0));
+		}
+		sync_array_finalize(sa);
+		for (i = 0; i < N_CONSUMERS; ++i) {
+			TEST_EQUAL(0, sbthread_wait(steppers[i].th));
+			sbthread_free(steppers[i].th);
+		}
+		sbsem_free(taken);
+		sync_array_free(sa);
+	}
+
+	/* Forcing an array to quit wakes up its consumers. */
+	sa = sync_array_init(0, sizeof(int));
+	TEST_ASSERT(threads[0] = sbthread_start(NULL, quit_consumer,
+						sync_array_retain(sa)));
+	TEST_EQUAL(0, sync_array_append(sa, &i));
+	TEST_EQUAL(0, sync_array_force_quit(sa));
+	TEST_EQUAL(0, sbthread_wait(threads[0]));
+	TEST_ASSERT(sync_array_append(sa, &i) < 0);
+	sbthread_free(threads[0]);
+	sync_array_free(sa);
+
+	return 0;
+}
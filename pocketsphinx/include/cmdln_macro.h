@@ -76,7 +76,11 @@
              ARG_STRING,                                \
              NULL,                                      \
              "Directory to log senone score files to"   \
-             }
+             },                                         \
+    { "-stagetime",                                     \
+            ARG_BOOLEAN,                                \
+            "no",                                       \
+            "Time each stage of decoding for ps_get_stats()" }
 
 /** Options defining beam width parameters for tuning the search. */
 #define POCKETSPHINX_BEAM_OPTIONS                                       \
@@ -135,6 +139,22 @@
       ARG_BOOLEAN,                                                                              \
       "no",                                                                                     \
       "Compute all senone scores in every frame (can be faster when there are many senones)" }, \
+{ "-scorebatch",                                                                                \
+      ARG_INT32,                                                                                \
+      "8",                                                                                      \
+      "Number of buffered frames to score in each pass over the acoustic model with -compallsen" }, \
+{ "-pipeline",                                                                                  \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Number of frames to compute all senone scores for ahead of the search in a separate thread (0 for none)" }, \
+{ "-specfinal",                                                                                 \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Number of frames of trailing silence after which to finish the utterance in a separate thread, in case it has ended (0 for never)" }, \
+{ "-senscrcache",                                                                               \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Number of recent frames of active senone scores to keep for searches that score them again" }, \
 { "-fwdtree",                                                                                   \
       ARG_BOOLEAN,                                                                              \
       "yes",                                                                                    \
@@ -147,6 +167,14 @@
       ARG_BOOLEAN,                                                                              \
       "yes",                                                                                    \
       "Run bestpath (Dijkstra) search over word lattice (3rd pass)" },                          \
+{ "-nbestpaths",                                                                                \
+      ARG_INT32,                                                                                \
+      "500",                                                                                    \
+      "Maximum number of partial paths to keep in N-best search" },                             \
+{ "-nbeststack",                                                                                \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Maximum number of partial paths to extend from each frame in N-best search (0 for no limit)" }, \
 { "-backtrace",                                                                                 \
       ARG_BOOLEAN,                                                                              \
       "no",                                                                                     \
@@ -155,6 +183,14 @@
       ARG_INT32,                                                                                \
       "5000",                                                                                   \
       "Initial backpointer table size" },                                                       \
+{ "-bpgcfr",                                                                                    \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Garbage collect the backpointer table every this many frames (0 for never; ignored with -fwdflat or -bestpath)" }, \
+{ "-maxbp",                                                                                     \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Fixed size of the backpointer table (N-Gram search) or word history (FSG search), allocated at initialization; word exits which do not fit are pruned (0 to let it grow)" }, \
 { "-maxwpf",                                                                                    \
       ARG_INT32,                                                                                \
       "-1",                                                                                     \
@@ -163,6 +199,22 @@
       ARG_INT32,                                                                                \
       "30000",                                                                                  \
       "Maximum number of active HMMs to maintain at each frame (or -1 for no pruning)" },       \
+{ "-targethmmpf",                                                                               \
+      ARG_INT32,                                                                                \
+      "-1",                                                                                     \
+      "Number of active HMMs per frame to adapt the beam towards (or -1 for a fixed beam)" },   \
+{ "-targetrtf",                                                                                 \
+      ARG_FLOAT32,                                                                              \
+      "0",                                                                                      \
+      "Real-time factor to adapt the beam towards in fwdtree search (or 0 for none)" },         \
+{ "-lmla",                                                                                      \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "N-Gram order of language model lookahead in fwdtree search (or 0 for none)" },           \
+{ "-lmlacache",                                                                                 \
+      ARG_INT32,                                                                                \
+      "64",                                                                                     \
+      "Number of word histories to keep language model lookahead for" },                        \
 { "-min_endfr",                                                                                 \
       ARG_INT32,                                                                                \
       "0",                                                                                      \
@@ -174,7 +226,11 @@
 { "-fwdflatsfwin",                                                                              \
       ARG_INT32,                                                                                \
       "25",                                                                    	                \
-      "Window of frames in lattice to search for successor words in fwdflat search " }
+      "Window of frames in lattice to search for successor words in fwdflat search " },         \
+{ "-fwdflatlag",                                                                                \
+      ARG_INT32,                                                                                \
+      "0",                                                                                      \
+      "Run fwdflat search alongside fwdtree, this many frames behind (or 0 to run it afterwards)" }
 
 /** Command-line options for keyphrase spotting */
 #define POCKETSPHINX_KWS_OPTIONS \
@@ -220,7 +276,11 @@
 { "-fsgusefiller",                                              \
         ARG_BOOLEAN,                                            \
         "yes",                                                  \
-        "Insert filler words at each state."}
+        "Insert filler words at each state."},                  \
+{ "-fsgcache",                                                  \
+        ARG_STRING,                                             \
+        NULL,                                                   \
+        "Directory of precompiled lextrees for finite state grammars" }
 
 /** Command-line options for statistical language models. */
 #define POCKETSPHINX_NGRAM_OPTIONS \
@@ -244,6 +304,10 @@
       ARG_STRING,									\
       NULL,									\
       "Which language model in -lmctl to use by default"},				\
+{ "-lmbloom",										\
+      ARG_BOOLEAN,									\
+      "no",										\
+      "Build Bloom filters to quickly reject missing N-grams in the language model" }, \
 { "-lw",										\
       ARG_FLOAT32,									\
       "6.5",										\
@@ -310,6 +374,10 @@
       ARG_STRING,                                                               \
       NULL,                                                                     \
       "File containing feature extraction parameters."},                        \
+{ "-fecache",                                                                   \
+      ARG_STRING,                                                               \
+      NULL,                                                                     \
+      "Directory to cache features for whole-utterance input in"},             \
 { "-mdef",                                                                      \
       ARG_STRING,                                                               \
       NULL,                                                                     \
@@ -338,6 +406,22 @@
       ARG_FLOAT32,                                                              \
       "0.0001",                                                                 \
       "Mixture gaussian variance floor (applied to data from -var file)" },     \
+{ "-amimage",                                                                   \
+      ARG_STRING,                                                               \
+      NULL,                                                                     \
+      "Precompiled acoustic model image (instead of -mean, -var, -mixw and -tmat)" }, \
+{ "-gauq8",                                                                     \
+      ARG_STRING,                                                               \
+      NULL,                                                                     \
+      "8-bit quantized mixture gaussian means and variances input file (instead of -mean and -var)" }, \
+{ "-subvq",                                                                     \
+      ARG_STRING,                                                               \
+      NULL,                                                                     \
+      "Sub-vector quantized form of acoustic model, for Gaussian selection (continuous models only)" }, \
+{ "-kdtree",                                                                    \
+      ARG_STRING,                                                               \
+      NULL,                                                                     \
+      "kd-trees for Gaussian selection (semi-continuous and PTM models only)" }, \
 { "-mixw",                                                                      \
       ARG_STRING,                                                               \
       NULL,                                                                     \
@@ -362,10 +446,30 @@
       ARG_BOOLEAN,                                                              \
       "yes",                                                                    \
       "Use memory-mapped I/O (if possible) for model files" },                  \
+{ "-hugepages",                                                                 \
+      ARG_BOOLEAN,                                                              \
+      "no",                                                                     \
+      "Ask for an acoustic model image to be backed by huge pages (Linux)" },   \
+{ "-numa",                                                                      \
+      ARG_STRING,                                                               \
+      "none",                                                                   \
+      "Model placement on multi-socket hosts: none, interleave (spread it over "\
+      "all nodes when loading), or replicate (a copy per node for batch "       \
+      "decoding, with threads pinned to the nodes)" },                          \
 { "-ds",                                                                        \
       ARG_INT32,                                                                \
       "1",                                                                      \
       "Frame GMM computation downsampling ratio" },                             \
+{ "-ds_thresh",                                                                 \
+      ARG_FLOAT32,                                                              \
+      "0",                                                                      \
+      "Adaptive downsampling: skip full codebook evaluation while the mean "    \
+      "squared feature change since the last full one is below this, up to "    \
+      "-ds - 1 frames in a row (0 to skip every -ds frames)" },                \
+{ "-nscorethreads",                                                             \
+      ARG_INT32,                                                                \
+      "1",                                                                      \
+      "Number of threads to use for GMM computation (continuous models only)" },\
 { "-topn",                                                                      \
       ARG_INT32,                                                                \
       "4",                                                                      \
@@ -374,6 +478,22 @@
       ARG_STRING,                                                               \
       "0",                                                                     \
       "Beam width used to determine top-N Gaussians (or a list, per-feature)" },\
+{ "-topn_nbr",                                                                  \
+      ARG_INT32,                                                                \
+      "0",                                                                      \
+      "Number of nearest codewords to each of the last frame's top-N to search instead of the whole codebook (semi-continuous models only, 0 for none)" }, \
+{ "-subvqbeam",                                                                 \
+      ARG_FLOAT64,                                                              \
+      "3e-3",                                                                   \
+      "Beam selecting Gaussians to evaluate within each mixture using -subvq [0(widest)..1(narrowest)]" }, \
+{ "-kdmaxdepth",                                                                \
+      ARG_INT32,                                                                \
+      "0",                                                                      \
+      "Maximum depth of kd-trees to use (0 for all levels)" },                 \
+{ "-kdmaxbbi",                                                                  \
+      ARG_INT32,                                                                \
+      "-1",                                                                     \
+      "Maximum number of Gaussians per leaf node in kd-trees (-1 for all)" },   \
 { "-logbase",                                                                   \
       ARG_FLOAT32,                                                              \
       "1.0001",                                                                 \
@@ -67,6 +67,10 @@ extern "C" {
 typedef struct ps_decoder_s ps_decoder_t;
 
 #include <ps_search.h>
+#include <ps_batch.h>
+#include <ps_longalign.h>
+#include <ps_reload.h>
+#include <ps_scorer.h>
 
 /**
  * PocketSphinx N-best hypothesis iterator object.
@@ -98,6 +102,63 @@ ps_default_search_args(cmd_ln_t *);
 POCKETSPHINX_EXPORT
 ps_decoder_t *ps_init(cmd_ln_t *config);
 
+/**
+ * Initialize a decoder that shares the acoustic model of another one.
+ *
+ * This is for running many decoders with the same acoustic model,
+ * for instance one per thread, without a copy of it in each.  The
+ * model definition, transition matrices, Gaussians and mixture
+ * weights of <code>share</code> are used instead of those given in
+ * <code>config</code>, as is its log base.  Everything else,
+ * including the dictionary, language model and feature extraction,
+ * comes from <code>config</code>.  If it does not give an acoustic
+ * model directory with <code>-hmm</code>, that of <code>share</code>
+ * is used, so that the feature parameters agree.
+ *
+ * The shared parameters are reference-counted, so the decoders can
+ * be freed in any order.  Adapting one of them with ps_update_mllr()
+ * gives it a private copy of the Gaussians, and does not affect the
+ * others.  Calling ps_reinit() loads a separate acoustic model again.
+ *
+ * Sharing is supported for continuous, phonetically-tied and
+ * semi-continuous models, but not with <code>-subvq</code>, in which
+ * case a separate copy of the model is loaded.
+ *
+ * @param config a command-line structure, as for ps_init().
+ * @param share decoder whose acoustic model is used.
+ * @return a new decoder, or NULL on failure.
+ */
+POCKETSPHINX_EXPORT
+ps_decoder_t *ps_init_shared(cmd_ln_t *config, ps_decoder_t *share);
+
+/**
+ * Create a copy of a decoder which shares all of its models.
+ *
+ * This is much cheaper than ps_init_shared(), and is meant for
+ * creating a decoder per connection or per thread.  The acoustic
+ * model, dictionary, language models and N-Gram search trees of
+ * <code>ps</code> are shared rather than loaded or built, and only
+ * the state of the search and feature extraction is allocated.  The
+ * copy has the same searches, with the same one active, and the same
+ * configuration, but starts with its own cepstral mean
+ * normalization.
+ *
+ * The decoder and its copies may decode in different threads.  As
+ * reference counts are not atomic, copies should be created and
+ * freed from one thread at a time, and not while the original is
+ * decoding, so it is simplest to keep the original only as a template
+ * for its copies.  They may be freed in any order.  Words cannot be added to,
+ * nor dictionaries loaded into, the decoder or its copies while they
+ * share them, but new searches can be added to each one, and
+ * ps_reinit() stops a copy from sharing anything.
+ *
+ * @param ps decoder to copy.
+ * @return a new decoder, or NULL on failure, for instance if one of
+ * the searches cannot be copied.
+ */
+POCKETSPHINX_EXPORT
+ps_decoder_t *ps_clone(ps_decoder_t *ps);
+
 /**
  * Reinitialize the decoder with updated configuration.
  *
@@ -211,6 +272,48 @@ feat_t *ps_get_feat(ps_decoder_t *ps);
 POCKETSPHINX_EXPORT
 ps_mllr_t *ps_update_mllr(ps_decoder_t *ps, ps_mllr_t *mllr);
 
+/**
+ * Create an identity feature space transform for the features of a
+ * decoder (or of any decoder with the same feature type).
+ *
+ * @return A new transform, to be freed with ps_fmllr_free().
+ */
+POCKETSPHINX_EXPORT
+ps_fmllr_t *ps_fmllr_init(ps_decoder_t *ps);
+
+/**
+ * Adapt a decoder to a speaker by transforming its features.
+ *
+ * This does not touch the acoustic model, which may be shared with
+ * other decoders (see ps_clone()).  The transform applies to
+ * features computed after this is called, and changes to it made by
+ * ps_fmllr_update() take effect right away.
+ *
+ * @param fmllr The transform to use, or NULL to stop transforming
+ *              features.  The decoder keeps its own reference to it.
+ * @return fmllr, or NULL on failure.
+ */
+POCKETSPHINX_EXPORT
+ps_fmllr_t *ps_set_fmllr(ps_decoder_t *ps, ps_fmllr_t *fmllr);
+
+/**
+ * Accumulate statistics for a feature space transform from the last
+ * utterance decoded.
+ *
+ * The best hypothesis is force-aligned to the utterance, and each
+ * frame of a word counts towards the statistics in proportion to the
+ * posterior probability of that word in the lattice (if any).  Filler
+ * words are left out.  The features of the whole utterance must still
+ * be available, as they are with the default -fwdflat search, or when
+ * it was processed with no_search set.  The acoustic model must keep
+ * its (unquantized) means and variances, as the continuous and
+ * phonetically-tied models do.
+ *
+ * @return Number of frames accumulated, or <0 on failure.
+ */
+POCKETSPHINX_EXPORT
+int ps_accum_fmllr(ps_decoder_t *ps, ps_fmllr_t *fmllr);
+
 /**
  * Reload the pronunciation dictionary from a file.
  *
@@ -236,7 +339,9 @@ int ps_load_dict(ps_decoder_t *ps, char const *dictfile,
  *
  * @param dictfile Path to file where dictionary will be written.
  * @param format Format of the dictionary file, or NULL for the
- *               default (text) format (currently unused, should be NULL)
+ *               default (text) format.  "bin" writes a binary
+ *               dictionary, including fillers, which can be given
+ *               to -dict and is memory-mapped when loaded.
  */
 POCKETSPHINX_EXPORT
 int ps_save_dict(ps_decoder_t *ps, char const *dictfile, char const *format);
@@ -391,6 +496,10 @@ int ps_get_n_frames(ps_decoder_t *ps);
 /**
  * End utterance processing.
  *
+ * With <code>-specfinal</code>, the result may come from a search
+ * which was started in the silence at the end of the speech, and
+ * does not include the rest of it.
+ *
  * @param ps Decoder.
  * @return 0 for success, <0 on error
  */
@@ -408,6 +517,38 @@ int ps_end_utt(ps_decoder_t *ps);
 POCKETSPHINX_EXPORT
 char const *ps_get_hyp(ps_decoder_t *ps, int32 *out_best_score);
 
+/**
+ * Callback for partial hypotheses.
+ *
+ * @param user_data Data passed to ps_set_hyp_callback().
+ * @param hyp New best hypothesis.  It is owned by the decoder and
+ *            valid only until the callback returns.
+ * @param score Path score corresponding to hyp.
+ */
+typedef void (*ps_hyp_cb_f)(void *user_data, char const *hyp, int32 score);
+
+/**
+ * Report partial hypotheses as they change.
+ *
+ * Instead of polling ps_get_hyp() after every call to
+ * ps_process_raw(), live applications can have the decoder call them
+ * back, from inside ps_process_raw() or ps_process_cep(), whenever
+ * the best hypothesis differs from the last one reported in this
+ * utterance.  The hypothesis is checked every min_frames frames of
+ * search regardless of how audio is pushed, and for N-Gram searches
+ * checking it costs little unless it has changed.  The final result
+ * is not reported, call ps_get_hyp() after ps_end_utt() for it.
+ *
+ * @param ps Decoder.
+ * @param callback Function to call, or NULL to stop reporting.
+ * @param user_data Data to pass to callback.
+ * @param min_frames Number of frames between checks (1 or more).
+ * @return 0 for success, <0 on error.
+ */
+POCKETSPHINX_EXPORT
+int ps_set_hyp_callback(ps_decoder_t *ps, ps_hyp_cb_f callback,
+                        void *user_data, int min_frames);
+
 /**
  * Get posterior probability.
  *
@@ -515,6 +656,54 @@ int32 ps_seg_prob(ps_seg_t *seg, int32 *out_ascr, int32 *out_lscr, int32 *out_lb
 POCKETSPHINX_EXPORT
 void ps_seg_free(ps_seg_t *seg);
 
+/**
+ * Word segment of a hypothesis, see ps_get_segs().
+ */
+typedef struct ps_seg_info_s {
+    int32 wid;  /**< Word ID, see ps_word_str(), or -1 for segments
+                     that are not words (such as phones). */
+    int sf;     /**< First frame, as from ps_seg_frames(). */
+    int ef;     /**< Last frame (inclusive). */
+    int32 ascr; /**< Acoustic model score. */
+    int32 lscr; /**< Language model score. */
+} ps_seg_info_t;
+
+/**
+ * Get the best hypothesis into buffers supplied by the caller.
+ *
+ * This gives the same words, frames and scores as ps_seg_iter(), and
+ * optionally the same string as ps_get_hyp(), but is meant for
+ * polling partial results often: nothing is allocated, and for N-Gram
+ * searches the backtrace is only followed again as far as it changed
+ * since the last call.  Other searches, and the final result of
+ * -bestpath, still go through a segment iterator.
+ *
+ * @param ps Decoder.
+ * @param segs Output: array of segments, or NULL if n_segs is 0.
+ * @param n_segs Size of segs.
+ * @param hyp Output: hypothesis string, truncated to fit and always
+ *            terminated, or NULL.
+ * @param hyp_size Size of hyp in bytes.
+ * @param out_best_score Output: path score of the hypothesis, or NULL.
+ * @return Number of segments in the hypothesis, which may be more than
+ *         n_segs (the rest are not filled in), or 0 if there is no
+ *         hypothesis.
+ */
+POCKETSPHINX_EXPORT
+int ps_get_segs(ps_decoder_t *ps, ps_seg_info_t *segs, int n_segs,
+                char *hyp, size_t hyp_size, int32 *out_best_score);
+
+/**
+ * Get the string for a word ID.
+ *
+ * @param ps Decoder.
+ * @param wid Word ID, such as from ps_get_segs() or ps_add_word().
+ * @return Word string, owned by the decoder, or NULL if there is no
+ *         such word.
+ */
+POCKETSPHINX_EXPORT
+char const *ps_word_str(ps_decoder_t *ps, int32 wid);
+
 /**
  * Get an iterator over the best hypotheses. The function may also
  * return a NULL which means that there is no hypothesis available for this
@@ -564,6 +753,19 @@ ps_seg_t *ps_nbest_seg(ps_nbest_t *nbest);
 POCKETSPHINX_EXPORT
 void ps_nbest_free(ps_nbest_t *nbest);
 
+/**
+ * Get a word confusion network for the current utterance.
+ *
+ * Posterior probabilities are computed first if this has not been
+ * done already.  Words less likely than 1e-4 are left out.
+ *
+ * @param ps Decoder.
+ * @return Newly created confusion network, which you must free with
+ *         ps_cn_free(), or NULL if no lattice is available.
+ */
+POCKETSPHINX_EXPORT
+ps_cn_t *ps_get_cn(ps_decoder_t *ps);
+
 /**
  * Get performance information for the current utterance.
  *
@@ -588,6 +790,92 @@ POCKETSPHINX_EXPORT
 void ps_get_all_time(ps_decoder_t *ps, double *out_nspeech,
                      double *out_ncpu, double *out_nwall);
 
+/**
+ * Stages of decoding timed by ps_get_stats().
+ */
+typedef enum ps_stage_e {
+    PS_STAGE_FE,      /**< Front end, from audio to cepstra. */
+    PS_STAGE_FEAT,    /**< Dynamic features and normalization. */
+    PS_STAGE_GMM,     /**< Senone (GMM) scoring. */
+    PS_STAGE_HMM,     /**< HMM evaluation, pruning and phone transitions. */
+    PS_STAGE_WORD,    /**< Word exits and transitions, with LM lookups. */
+    PS_STAGE_LATTICE, /**< Lattice generation and best path search. */
+    PS_N_STAGES
+} ps_stage_t;
+
+/**
+ * Detailed performance information.
+ *
+ * Only the N-Gram and grammar searches count HMMs and backpointers,
+ * and only the N-Gram search counts LM queries.
+ */
+typedef struct ps_stats_s {
+    int32 n_frame;         /**< Frames searched. */
+    int32 n_senone_active; /**< Senones scored. */
+    int32 n_hmm_eval;      /**< HMMs evaluated. */
+    int32 n_lm_query;      /**< Language model scores looked up. */
+    int32 n_bp;            /**< Word exits entered in the backpointer table. */
+    double cpu[PS_N_STAGES];  /**< CPU seconds used by each stage. */
+    double wall[PS_N_STAGES]; /**< Wall-clock seconds used by each stage. */
+} ps_stats_t;
+
+/**
+ * Get detailed performance information.
+ *
+ * Counts are always kept.  Since timing each stage of each frame has
+ * a cost of its own, the times are only measured if the
+ * <code>-stagetime</code> option is enabled, and are zero otherwise.
+ *
+ * @param ps Decoder.
+ * @param out_utt Output: statistics for the current (or last) utterance,
+ *                or NULL.
+ * @param out_all Output: statistics for all utterances so far, or NULL.
+ */
+POCKETSPHINX_EXPORT
+void ps_get_stats(ps_decoder_t *ps, ps_stats_t *out_utt, ps_stats_t *out_all);
+
+/**
+ * Parts of the decoder whose memory is counted by ps_get_memory_report().
+ */
+typedef enum ps_mem_part_e {
+    PS_MEM_ACMOD,    /**< Model definition, transition matrices, front
+                        end, feature and senone score buffers. */
+    PS_MEM_MGAU,     /**< Gaussians, mixture weights and scoring state. */
+    PS_MEM_DICT,     /**< Pronunciation dictionary. */
+    PS_MEM_DICT2PID, /**< Cross-word triphone tables. */
+    PS_MEM_LM,       /**< N-Gram language models. */
+    PS_MEM_SEARCH,   /**< Search trees, HMMs and backpointer tables. */
+    PS_MEM_LATTICE,  /**< Word lattices of the searches. */
+    PS_N_MEM_PARTS
+} ps_mem_part_t;
+
+/**
+ * Memory used by one part of the decoder, in bytes.
+ */
+typedef struct ps_mem_s {
+    size_t heap;   /**< Heap memory used by this decoder alone. */
+    size_t shared; /**< Heap memory shared with clones (see ps_clone()). */
+    size_t mapped; /**< Memory-mapped model files, shared with any other
+                      process using them. */
+} ps_mem_t;
+
+/**
+ * Get the memory used by each part of the decoder.
+ *
+ * This counts the large arrays and tables of each part, not every
+ * small allocation, so the total is somewhat less than the process
+ * will actually use.  Search modules and grammars which do not
+ * report their memory count as zero.  The memory of a decoder and its
+ * clones together is the heap and mapped memory of each plus the
+ * shared memory of any one of them.
+ *
+ * @param ps Decoder.
+ * @param out_mem Output: array of PS_N_MEM_PARTS entries, indexed by
+ *                ps_mem_part_t.
+ */
+POCKETSPHINX_EXPORT
+void ps_get_memory_report(ps_decoder_t *ps, ps_mem_t *out_mem);
+
 /**
  * Checks if the last feed audio buffer contained speech
  *
@@ -602,8 +890,11 @@ uint8 ps_get_in_speech(ps_decoder_t *ps);
  * Sets the limit of the raw audio data to store in decoder
  * to retrieve it later on ps_get_rawdata.
  *
+ * The decoder keeps the most recent size samples of each utterance
+ * in a ring buffer, so long utterances overwrite their beginning.
+ *
  * @param ps Decoder
- * @param size bytes of the utterance to store
+ * @param size samples of the utterance to store
  */
 POCKETSPHINX_EXPORT
 void ps_set_rawdata_size(ps_decoder_t *ps, int32 size);
@@ -611,15 +902,34 @@ void ps_set_rawdata_size(ps_decoder_t *ps, int32 size);
 
 /**
  * Retrieves the raw data collected during utterance decoding.
+ *
+ * If the ring buffer has wrapped around it is rotated in place so
+ * that the data is contiguous.
  * 
  * @param ps Decoder
- * @param buffer preallocated buffer to store the data, must be within the limit
- * set before
+ * @param buffer Output: the data, owned by the decoder
  * @param size size of the data collected in samples (not bytes).
  */
 POCKETSPHINX_EXPORT
 void ps_get_rawdata(ps_decoder_t *ps, int16 **buffer, int32 *size);
 
+/**
+ * Retrieves the raw data collected during utterance decoding without
+ * copying or moving it.
+ *
+ * Once the ring buffer has wrapped around, the data is in two parts,
+ * the first holding the oldest samples.  They remain valid until the
+ * decoder processes more audio.
+ *
+ * @param ps Decoder
+ * @param out_parts Output: pointers to each part of the data.
+ * @param out_sizes Output: size of each part in samples.
+ * @return Number of parts (0, 1 or 2).
+ */
+POCKETSPHINX_EXPORT
+int ps_get_rawdata_parts(ps_decoder_t *ps, int16 const *out_parts[2],
+                         int32 out_sizes[2]);
+
 /**
  * @mainpage PocketSphinx API Documentation
  * @author David Huggins-Daines <dhuggins@cs.cmu.edu>
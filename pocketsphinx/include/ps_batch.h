@@ -0,0 +1,174 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_batch.h Decoding many utterances in parallel
+ */
+
+#ifndef __PS_BATCH_H__
+#define __PS_BATCH_H__
+
+/* SphinxBase headers. */
+#include <sphinxbase/prim_type.h>
+
+/* PocketSphinx headers. */
+#include <pocketsphinx_export.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#if 0
+}
+#endif
+
+/**
+ * Batch of utterances decoded by several threads.
+ *
+ * Each thread has its own decoder, created with ps_init_shared(), so
+ * the acoustic model is loaded only once.  Utterances are handed out
+ * longest first, and a thread which runs out of work takes the
+ * shortest remaining ones from another thread's queue.
+ *
+ * With <code>-numa replicate</code> on a host with several NUMA
+ * nodes, the threads are spread over the nodes and pinned there, and
+ * each node gets its own copy of the models, so that none of them
+ * read their parameters from another socket's memory.  Memory-mapped
+ * files stay in the page cache, which is shared by all nodes, so use
+ * <code>-mmap no</code> as well to replicate everything.
+ *
+ * Every utterance starts with the initial cepstral mean given by
+ * <code>-cmninit</code>, so its result does not depend on which
+ * thread decodes it, or on what that thread decoded before.
+ */
+typedef struct ps_batch_s ps_batch_t;
+
+/**
+ * Create a batch decoder.
+ *
+ * @param ps Decoder whose configuration and acoustic model are used.
+ *           It is also used by one of the threads, so it must not be
+ *           used elsewhere during ps_batch_run().
+ * @param nthreads Number of threads to decode with.
+ * @return Newly created batch decoder, or NULL on failure.
+ */
+POCKETSPHINX_EXPORT
+ps_batch_t *ps_batch_init(ps_decoder_t *ps, int nthreads);
+
+/**
+ * Release a batch decoder, its decoders and its results.
+ */
+POCKETSPHINX_EXPORT
+void ps_batch_free(ps_batch_t *batch);
+
+/**
+ * Add an utterance from a raw audio file to a batch.
+ *
+ * The file is read only when the utterance is decoded, in the same
+ * format as for ps_decode_raw().
+ *
+ * @param uttid Name for the utterance, or NULL for none.
+ * @param file Path to the audio file.
+ * @return Index of the utterance in the batch, or <0 on error.
+ */
+POCKETSPHINX_EXPORT
+int ps_batch_add_file(ps_batch_t *batch, char const *uttid,
+                      char const *file);
+
+/**
+ * Add an utterance from a buffer of audio to a batch.
+ *
+ * @param uttid Name for the utterance, or NULL for none.
+ * @param data 16-bit signed PCM audio.  This is not copied, and must
+ *             remain valid until ps_batch_run() returns.
+ * @param n_samples Number of samples in data.
+ * @return Index of the utterance in the batch, or <0 on error.
+ */
+POCKETSPHINX_EXPORT
+int ps_batch_add_raw(ps_batch_t *batch, char const *uttid,
+                     int16 const *data, size_t n_samples);
+
+/**
+ * Decode all utterances in a batch which have not been decoded yet.
+ *
+ * This returns when all of them are finished.
+ *
+ * @return 0 for success, or <0 if any utterance could not be decoded.
+ */
+POCKETSPHINX_EXPORT
+int ps_batch_run(ps_batch_t *batch);
+
+/**
+ * Get the number of utterances in a batch.
+ */
+POCKETSPHINX_EXPORT
+int ps_batch_n_utts(ps_batch_t *batch);
+
+/**
+ * Get the name of an utterance in a batch.
+ */
+POCKETSPHINX_EXPORT
+char const *ps_batch_uttid(ps_batch_t *batch, int idx);
+
+/**
+ * Get the hypothesis for an utterance in a batch.
+ *
+ * @param idx Index of the utterance, as returned when it was added.
+ * @param out_best_score Output: path score of the hypothesis.
+ * @return String containing best hypothesis, or NULL if it was empty,
+ *         not decoded yet, or failed.  It remains valid until the
+ *         batch is freed.
+ */
+POCKETSPHINX_EXPORT
+char const *ps_batch_hyp(ps_batch_t *batch, int idx, int32 *out_best_score);
+
+/**
+ * Get performance information for an utterance in a batch.
+ *
+ * CPU time is measured for the whole process on most platforms, so
+ * with several threads it includes time spent on other utterances.
+ *
+ * @param idx Index of the utterance, as returned when it was added.
+ * @param out_nspeech Output: Number of seconds of speech.
+ * @param out_ncpu    Output: Number of seconds of CPU time used.
+ * @param out_nwall   Output: Number of seconds of wall time used.
+ * @return 0 for success, <0 if it was not decoded.
+ */
+POCKETSPHINX_EXPORT
+int ps_batch_utt_time(ps_batch_t *batch, int idx, double *out_nspeech,
+                      double *out_ncpu, double *out_nwall);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PS_BATCH_H__ */
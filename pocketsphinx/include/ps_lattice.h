@@ -87,12 +87,30 @@ typedef struct ps_latlink_s ps_latlink_t;
  */
 typedef struct latlink_list_s ps_latlink_iter_t;
 
+/**
+ * Sequential reader for binary lattice files.
+ */
+typedef struct ps_latbin_s ps_latbin_t;
+
+/**
+ * Word confusion network.
+ */
+typedef struct ps_cn_s ps_cn_t;
+
+/**
+ * Iterator over slots in a confusion network.
+ */
+typedef struct ps_cn_iter_s ps_cn_iter_t;
+
 /* Forward declaration needed to avoid circular includes */
 struct ps_decoder_s;
 
 /**
  * Read a lattice from a file on disk.
  *
+ * Both the text format written by ps_lattice_write() and the binary
+ * format written by ps_lattice_write_bin() are recognized.
+ *
  * @param ps Decoder to use for processing this lattice, or NULL.
  * @param file Path to lattice file.
  * @return Newly created lattice, or NULL for failure.
@@ -101,6 +119,21 @@ POCKETSPHINX_EXPORT
 ps_lattice_t *ps_lattice_read(struct ps_decoder_s *ps,
                               char const *file);
 
+/**
+ * Read a lattice in HTK format from a file on disk.
+ *
+ * Only lattices with words on nodes, such as those written by
+ * ps_lattice_write_htk(), can be read.  Node times are taken to be
+ * start times, as that function writes them.
+ *
+ * @param ps Decoder to use for processing this lattice, or NULL.
+ * @param file Path to lattice file.
+ * @return Newly created lattice, or NULL for failure.
+ */
+POCKETSPHINX_EXPORT
+ps_lattice_t *ps_lattice_read_htk(struct ps_decoder_s *ps,
+                                  char const *file);
+
 /**
  * Retain a lattice.
  *
@@ -137,6 +170,104 @@ int ps_lattice_write(ps_lattice_t *dag, char const *filename);
 POCKETSPHINX_EXPORT
 int ps_lattice_write_htk(ps_lattice_t *dag, char const *filename);
 
+/**
+ * Write a lattice to disk in compact binary format.
+ *
+ * The file can be read back with ps_lattice_read(), or node by node
+ * without building the lattice with ps_latbin_open().
+ *
+ * @return 0 for success, <0 on failure.
+ */
+POCKETSPHINX_EXPORT
+int ps_lattice_write_bin(ps_lattice_t *dag, char const *filename);
+
+/**
+ * Open a binary lattice file for reading.
+ *
+ * The file is memory-mapped where possible, and nodes and links are
+ * decoded only as they are read.
+ *
+ * @return Newly created reader, or NULL for failure.
+ */
+POCKETSPHINX_EXPORT
+ps_latbin_t *ps_latbin_open(char const *file);
+
+/**
+ * Close a binary lattice file.
+ */
+POCKETSPHINX_EXPORT
+void ps_latbin_free(ps_latbin_t *lb);
+
+/**
+ * Get the log base of acoustic scores in a binary lattice file.
+ */
+POCKETSPHINX_EXPORT
+float64 ps_latbin_logbase(ps_latbin_t *lb);
+
+/**
+ * Get the number of frames in a binary lattice file.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_latbin_n_frames(ps_latbin_t *lb);
+
+/**
+ * Get the number of nodes in a binary lattice file.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_latbin_n_nodes(ps_latbin_t *lb);
+
+/**
+ * Get the number of links in a binary lattice file.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_latbin_n_links(ps_latbin_t *lb);
+
+/**
+ * Get the ID of the start node in a binary lattice file.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_latbin_start(ps_latbin_t *lb);
+
+/**
+ * Get the ID of the end node in a binary lattice file.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_latbin_end(ps_latbin_t *lb);
+
+/**
+ * Position a binary lattice reader before a given node.
+ *
+ * @return 0 for success, <0 on failure.
+ */
+POCKETSPHINX_EXPORT
+int ps_latbin_seek(ps_latbin_t *lb, int32 node);
+
+/**
+ * Read the next node from a binary lattice file.
+ *
+ * Any exits of the previous node which were not read with
+ * ps_latbin_next_link() are skipped.
+ *
+ * @param out_word Output: word string, valid until ps_latbin_free().
+ * @param out_sf Output: start frame.
+ * @param out_fef Output: first end frame.
+ * @param out_lef Output: last end frame.
+ * @return ID of the node, or <0 at the end of the file or on error.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_latbin_next_node(ps_latbin_t *lb, char const **out_word,
+                          int32 *out_sf, int32 *out_fef, int32 *out_lef);
+
+/**
+ * Read the next exit of the current node from a binary lattice file.
+ *
+ * @param out_ascr Output: acoustic score, in the same units as
+ *                 ps_lattice_write() uses.
+ * @return ID of the destination node, or <0 if there are no more exits.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_latbin_next_link(ps_latbin_t *lb, int32 *out_ascr);
+
 /**
  * Get the log-math computation object for this lattice
  *
@@ -404,6 +535,30 @@ POCKETSPHINX_EXPORT
 ps_latlink_t *ps_lattice_bestpath(ps_lattice_t *dag, ngram_model_t *lmset,
                                   float32 lwf, float32 ascale);
 
+/**
+ * Do best-path search on a word graph with another N-Gram model.
+ *
+ * Where ps_lattice_bestpath() keeps only the best predecessor of each
+ * link, this keeps the best path for each language model state
+ * reaching a node, so that a model of any order, such as one too
+ * large for the first pass, is applied exactly.  Its weights should
+ * already be applied with ngram_model_apply_weights().
+ *
+ * The best path is left in the links as by ps_lattice_bestpath(), so
+ * that ps_lattice_hyp() and ps_lattice_seg_iter() can be used on the
+ * returned link, though the latter gives language model scores from
+ * the lattice's own search.
+ *
+ * @param lm Language model.  It is only read, so the threads share it.
+ * @param lwf Language weight factor, as for ps_lattice_bestpath().
+ * @param max_states Most language model states kept for each node.
+ * @param nthreads Number of threads, counting the calling one.
+ * @return Final link in best path, NULL on error.
+ */
+POCKETSPHINX_EXPORT
+ps_latlink_t *ps_lattice_rescore(ps_lattice_t *dag, ngram_model_t *lm,
+                                 float32 lwf, int32 max_states, int nthreads);
+
 /**
  * Calculate link posterior probabilities on a word graph.
  *
@@ -429,6 +584,111 @@ int32 ps_lattice_posterior(ps_lattice_t *dag, ngram_model_t *lmset,
 POCKETSPHINX_EXPORT
 int32 ps_lattice_posterior_prune(ps_lattice_t *dag, int32 beam);
 
+/**
+ * Build a word confusion network from a lattice.
+ *
+ * Word hypotheses are grouped into a sequence of slots by their
+ * times, so that the words in each slot compete with one another.
+ * This function assumes that ps_lattice_posterior() has already been
+ * called.
+ *
+ * @param beam Minimum posterior probability for word hypotheses, in
+ *         the same units as for ps_lattice_posterior_prune().
+ * @return Newly created confusion network, which retains the lattice.
+ */
+POCKETSPHINX_EXPORT
+ps_cn_t *ps_lattice_cn(ps_lattice_t *dag, int32 beam);
+
+/**
+ * Retain a confusion network.
+ *
+ * @return pointer to the retained confusion network.
+ */
+POCKETSPHINX_EXPORT
+ps_cn_t *ps_cn_retain(ps_cn_t *cn);
+
+/**
+ * Free a confusion network.
+ *
+ * @return new reference count (0 if cn was freed)
+ */
+POCKETSPHINX_EXPORT
+int ps_cn_free(ps_cn_t *cn);
+
+/**
+ * Get the number of slots in a confusion network.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_cn_n_slots(ps_cn_t *cn);
+
+/**
+ * Get the consensus hypothesis from a confusion network.
+ *
+ * This is the most likely word in each slot, leaving out slots where
+ * no word is more likely than any, and fillers.
+ *
+ * @param out_post Output: sum of the log posterior probabilities of
+ *                 the choices made in each slot.
+ * @return Hypothesis string, valid until the next call or until the
+ *         confusion network is freed.
+ */
+POCKETSPHINX_EXPORT
+char const *ps_cn_hyp(ps_cn_t *cn, int32 *out_post);
+
+/**
+ * Start iterating over the slots in a confusion network, in time order.
+ *
+ * @return Iterator, or NULL if there are no slots.
+ */
+POCKETSPHINX_EXPORT
+ps_cn_iter_t *ps_cn_iter(ps_cn_t *cn);
+
+/**
+ * Move to the next slot in a confusion network.
+ *
+ * @return Updated iterator, or NULL if there are no more slots (the
+ *         iterator is freed in this case).
+ */
+POCKETSPHINX_EXPORT
+ps_cn_iter_t *ps_cn_iter_next(ps_cn_iter_t *itor);
+
+/**
+ * Stop iterating over a confusion network early.
+ */
+POCKETSPHINX_EXPORT
+void ps_cn_iter_free(ps_cn_iter_t *itor);
+
+/**
+ * Get the times of the current slot.
+ *
+ * These are the times of the word hypothesis which started the slot.
+ */
+POCKETSPHINX_EXPORT
+void ps_cn_iter_frames(ps_cn_iter_t *itor, int *out_sf, int *out_ef);
+
+/**
+ * Get the number of words in the current slot.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_cn_iter_n_words(ps_cn_iter_t *itor);
+
+/**
+ * Get a word in the current slot.
+ *
+ * @param i Index of the word, where words are sorted by decreasing
+ *          posterior probability.
+ * @param out_post Output: log posterior probability of the word.
+ * @return Word string, or NULL if there is no such word.
+ */
+POCKETSPHINX_EXPORT
+char const *ps_cn_iter_word(ps_cn_iter_t *itor, int32 i, int32 *out_post);
+
+/**
+ * Get the log posterior probability of no word in the current slot.
+ */
+POCKETSPHINX_EXPORT
+int32 ps_cn_iter_del_prob(ps_cn_iter_t *itor);
+
 #ifdef NOT_IMPLEMENTED_YET
 /**
  * Expand lattice using an N-gram language model.
@@ -0,0 +1,140 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_longalign.h Aligning long recordings to their transcripts
+ */
+
+#ifndef __PS_LONGALIGN_H__
+#define __PS_LONGALIGN_H__
+
+/* SphinxBase headers. */
+#include <sphinxbase/prim_type.h>
+
+/* PocketSphinx headers. */
+#include <pocketsphinx_export.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#if 0
+}
+#endif
+
+/**
+ * Aligner for recordings too long to align in one piece.
+ *
+ * The audio is cut into chunks which are recognized in parallel with
+ * the decoder's current search, which should be biased towards the
+ * transcript, for instance with a language model estimated from it.
+ * Runs of recognized words which match a part of the transcript found
+ * nowhere else become anchors, and the rest of the transcript is
+ * force-aligned, again in parallel, to the audio between them.
+ *
+ * As with ps_batch_t, each thread has its own decoder, created with
+ * ps_clone(), and starts every piece of work with the same cepstral
+ * mean, so results do not depend on the number of threads.
+ */
+typedef struct ps_longalign_s ps_longalign_t;
+
+/**
+ * Create a long audio aligner.
+ *
+ * @param ps Decoder whose models and current search are used.  It is
+ *           also used by one of the threads, so it must not be used
+ *           elsewhere during ps_longalign_run().
+ * @param nthreads Number of threads to align with.
+ * @return Newly created aligner, or NULL on failure.
+ */
+POCKETSPHINX_EXPORT
+ps_longalign_t *ps_longalign_init(ps_decoder_t *ps, int nthreads);
+
+/**
+ * Release a long audio aligner, its decoders and its results.
+ */
+POCKETSPHINX_EXPORT
+void ps_longalign_free(ps_longalign_t *la);
+
+/**
+ * Set the length of the chunks recognized to find anchors.
+ *
+ * Words cut by the end of a chunk are not used as anchors, so chunks
+ * should be long compared to words, but short enough to keep all the
+ * threads busy.  The default is 30 seconds.
+ */
+POCKETSPHINX_EXPORT
+void ps_longalign_set_chunk_size(ps_longalign_t *la, double seconds);
+
+/**
+ * Align a recording to its transcript.
+ *
+ * @param text Transcript, as words separated by white space, all of
+ *             which must be in the dictionary.
+ * @param data 16-bit signed PCM audio.
+ * @param n_samples Number of samples in data.
+ * @return Number of words aligned, or <0 on error.  Words in parts of
+ *         the transcript which could not be aligned are left without
+ *         times.
+ */
+POCKETSPHINX_EXPORT
+int ps_longalign_run(ps_longalign_t *la, char const *text,
+                     int16 const *data, size_t n_samples);
+
+/**
+ * Get the number of words in the last transcript aligned.
+ */
+POCKETSPHINX_EXPORT
+int ps_longalign_n_words(ps_longalign_t *la);
+
+/**
+ * Get a word of the last transcript aligned, and its time.
+ *
+ * @param idx Index of the word in the transcript.
+ * @param out_sf Output: first frame of the word, or -1 if it was not
+ *               aligned.
+ * @param out_ef Output: last frame of the word, or -1 if it was not
+ *               aligned.
+ * @param out_anchor Output: whether the word was an anchor, whose
+ *                   time comes from recognition rather than alignment.
+ *                   May be NULL.
+ * @return The word, which remains valid until the aligner is freed.
+ */
+POCKETSPHINX_EXPORT
+char const *ps_longalign_word(ps_longalign_t *la, int idx,
+                              int *out_sf, int *out_ef, int *out_anchor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PS_LONGALIGN_H__ */
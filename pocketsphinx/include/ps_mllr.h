@@ -36,7 +36,7 @@
  */
 
 /**
- * @file ps_mllr.h Model-space linear transforms for speaker adaptation
+ * @file ps_mllr.h Linear transforms for speaker adaptation
  */
 
 #ifndef __PS_MLLR_H__
@@ -79,6 +79,53 @@ ps_mllr_t *ps_mllr_retain(ps_mllr_t *mllr);
 POCKETSPHINX_EXPORT
 int ps_mllr_free(ps_mllr_t *mllr);
 
+/**
+ * Feature space transform object, estimated online.
+ *
+ * Unlike a ps_mllr_t, this transforms the features computed by one
+ * decoder rather than the means of its acoustic model, so decoders
+ * which share a model can each be adapted to a different speaker.
+ * It scales and shifts each dimension of the features separately
+ * (a diagonal constrained MLLR transform).  It is created with
+ * ps_fmllr_init(), applied with ps_set_fmllr(), and its statistics
+ * are accumulated with ps_accum_fmllr().
+ */
+typedef struct ps_fmllr_s ps_fmllr_t;
+
+/**
+ * Retain a pointer to a feature space transform.
+ */
+POCKETSPHINX_EXPORT
+ps_fmllr_t *ps_fmllr_retain(ps_fmllr_t *fmllr);
+
+/**
+ * Release a pointer to a feature space transform.
+ */
+POCKETSPHINX_EXPORT
+int ps_fmllr_free(ps_fmllr_t *fmllr);
+
+/**
+ * Re-estimate a feature space transform from the statistics
+ * accumulated so far.
+ *
+ * The statistics are kept, so this can be called after every
+ * utterance to refine the transform as more data arrives.
+ *
+ * @param prior Number of frames' worth of weight given to the
+ *              identity transform, to keep estimates from a little
+ *              data from straying too far.
+ * @return 0, or -1 if no statistics have been accumulated.
+ */
+POCKETSPHINX_EXPORT
+int ps_fmllr_update(ps_fmllr_t *fmllr, float32 prior);
+
+/**
+ * Forget the statistics of a feature space transform and make it an
+ * identity transform again, for instance when the speaker changes.
+ */
+POCKETSPHINX_EXPORT
+void ps_fmllr_reset(ps_fmllr_t *fmllr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,153 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2017 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_reload.h Replacing language models and dictionaries while decoding
+ */
+
+#ifndef __PS_RELOAD_H__
+#define __PS_RELOAD_H__
+
+/* SphinxBase headers. */
+#include <sphinxbase/prim_type.h>
+#include <sphinxbase/ngram_model.h>
+
+/* PocketSphinx headers. */
+#include <pocketsphinx_export.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#if 0
+}
+#endif
+
+/**
+ * New language models and dictionary for a decoder, prepared while it
+ * keeps decoding.
+ *
+ * ps_set_lm() and ps_load_dict() build their search trees on the spot,
+ * which can take long enough to hold up decoding.  Instead, a reload
+ * is created with ps_reload_init(), filled in with ps_reload_set_lm()
+ * and ps_reload_load_dict() on any thread, and handed to the decoder
+ * with ps_reload_commit().  The decoder puts it in place at the start
+ * of its next utterance, unless a reload is still being prepared, in
+ * which case it carries on with the old ones and tries again at the
+ * following utterance.  Searches, lattices and so on from before the
+ * reload are freed when they are no longer used.
+ *
+ * While a reload is being prepared, the decoder may decode and return
+ * results as usual, but must not otherwise be changed (by adding
+ * searches or words, or by cloning it, for instance).
+ */
+typedef struct ps_reload_s ps_reload_t;
+
+/**
+ * Start preparing a reload.
+ *
+ * This must be called from the thread using the decoder, but is quick.
+ *
+ * @param ps Decoder to be reloaded.  The reload must be committed or
+ *           freed before the decoder is freed.
+ * @return Newly created reload, or NULL on failure.
+ */
+POCKETSPHINX_EXPORT
+ps_reload_t *ps_reload_init(ps_decoder_t *ps);
+
+/**
+ * Load a new dictionary in a reload.
+ *
+ * When the reload is committed, this replaces the decoder's
+ * dictionary, as with ps_load_dict().  Searches whose language models
+ * are not also set in the reload are then updated for it by the
+ * decoder, which takes some time for N-Gram searches.  Like
+ * ps_load_dict(), this cannot be used with a cloned decoder.
+ *
+ * This must be called before any ps_reload_set_lm().
+ *
+ * @return 0 for success, <0 on error.
+ */
+POCKETSPHINX_EXPORT
+int ps_reload_load_dict(ps_reload_t *reload, char const *dictfile,
+                        char const *fdictfile, char const *format);
+
+/**
+ * Set a new language model in a reload.
+ *
+ * When the reload is committed, this replaces the search called name,
+ * or adds it if there is none, as with ps_set_lm().  The search tree
+ * for it is built now, with the dictionary of the reload.
+ *
+ * @param lm Language model, which is retained.  It must use the same
+ *           log-math as the decoder, see ps_get_logmath().
+ * @return 0 for success, <0 on error.
+ */
+POCKETSPHINX_EXPORT
+int ps_reload_set_lm(ps_reload_t *reload, const char *name,
+                     ngram_model_t *lm);
+
+/**
+ * Read a new language model from a file in a reload.
+ *
+ * @return 0 for success, <0 on error.
+ */
+POCKETSPHINX_EXPORT
+int ps_reload_set_lm_file(ps_reload_t *reload, const char *name,
+                          const char *path);
+
+/**
+ * Hand a prepared reload to its decoder.
+ *
+ * This may be called from any thread.  The decoder takes ownership of
+ * the reload, whether or not this succeeds.
+ *
+ * @return 0 for success, <0 if anything went wrong in preparing the
+ *         reload, in which case the decoder discards it.
+ */
+POCKETSPHINX_EXPORT
+int ps_reload_commit(ps_reload_t *reload);
+
+/**
+ * Discard a reload without committing it.
+ *
+ * Like ps_reload_init(), this must be called from the thread using
+ * the decoder.
+ */
+POCKETSPHINX_EXPORT
+void ps_reload_free(ps_reload_t *reload);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PS_RELOAD_H__ */
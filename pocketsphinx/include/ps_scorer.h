@@ -0,0 +1,119 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2017 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_scorer.h External senone scoring
+ */
+
+#ifndef __PS_SCORER_H__
+#define __PS_SCORER_H__
+
+/* SphinxBase headers. */
+#include <sphinxbase/prim_type.h>
+
+/* PocketSphinx headers. */
+#include <pocketsphinx_export.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#if 0
+}
+#endif
+
+/**
+ * Senone scorer supplied by the application, for instance a neural
+ * network which computes the scores of all senones for a window of
+ * frames with one matrix multiplication per layer.
+ *
+ * The scorer is given several consecutive frames at once.  Each
+ * frame is spliced with <code>context</code> frames of features on
+ * either side, so its input is (2 * context + 1) feature vectors one
+ * after the other, earliest first.  Frames before the start of the
+ * utterance, or after the last one available, are replaced with the
+ * nearest one that is there.
+ *
+ * Only one call is made to a scorer at a time, though with look-ahead
+ * it may be from a different thread than the one that is decoding.
+ */
+typedef struct ps_scorer_funcs_s {
+    char const *name;
+    /**
+     * Compute the scores of all senones for some frames.
+     *
+     * @param in Spliced features of each frame, n_frame rows of
+     *           in_dim values.
+     * @param out Natural log-likelihood of each senone in each frame,
+     *            n_frame rows of n_sen values, to fill in.  Scaled
+     *            likelihoods, such as log posteriors less log priors,
+     *            will do, as the scores of each frame are taken
+     *            relative to its best.
+     * @return 0, or <0 on error.
+     */
+    int (*score)(void *data, float32 const *in, int n_frame, int in_dim,
+                 float32 *out, int n_sen);
+    /**
+     * Release the scorer's data, when the decoder is done with it.  It
+     * may be NULL.
+     */
+    void (*free)(void *data);
+} ps_scorer_funcs_t;
+
+/**
+ * Score senones with an external scorer instead of the decoder's
+ * acoustic model, until the decoder is reinitialized.
+ *
+ * This should be called outside an utterance.  The model definition
+ * and transition matrices still come from the acoustic model, and
+ * the features are computed as it says.  MLLR transforms no longer
+ * apply.
+ *
+ * @param funcs Scoring functions, which must stay valid.
+ * @param data Argument passed to them, which the decoder frees with
+ *             funcs->free() when it no longer needs it, even on failure.
+ * @param context Number of frames spliced on either side of each frame.
+ * @param batch Largest number of frames to score in one call.
+ * @param lookahead Whether to score the next batch of frames in a
+ *                  separate thread while the search goes through
+ *                  this one.
+ * @return 0, or <0 on error.
+ */
+POCKETSPHINX_EXPORT
+int ps_set_scorer(ps_decoder_t *ps, ps_scorer_funcs_t const *funcs,
+                  void *data, int context, int batch, int lookahead);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PS_SCORER_H__ */
@@ -48,7 +48,8 @@
  * Each search has a name and can be referenced by a name, names are
  * application-specific. The function ps_set_search allows to activate
  * the search previously added by a name. Only single search can be
- * activated at time.
+ * activated at time, though others can run alongside it with
+ * ps_add_concurrent_search().
  *
  * To add the search one needs to point to the grammar/language model
  * describing the search. The location of the grammar is specific to the
@@ -103,6 +104,47 @@ int ps_set_search(ps_decoder_t *ps, const char *name);
 POCKETSPHINX_EXPORT 
 const char* ps_get_search(ps_decoder_t *ps);
 
+/**
+ * Runs a search alongside the active one.
+ *
+ * The search steps through the same frames as the active one, and
+ * the senones which both of them ask for in a frame are only scored
+ * once.  This is much cheaper than a decoder for each, for instance
+ * to spot a keyphrase while recognizing with a language model.  Its
+ * hypothesis is found with ps_get_search_hyp().  Clones of the
+ * decoder run the same searches.
+ *
+ * The search must be added before, and cannot be added while
+ * decoding.  Activating it with ps_set_search() stops running it
+ * alongside.
+ *
+ * @return 0 on success, -1 on failure
+ */
+POCKETSPHINX_EXPORT
+int ps_add_concurrent_search(ps_decoder_t *ps, const char *name);
+
+/**
+ * Stops running all searches but the active one.
+ *
+ * @see ps_add_concurrent_search
+ * @return 0 on success, -1 if decoding
+ */
+POCKETSPHINX_EXPORT
+int ps_clear_concurrent_searches(ps_decoder_t *ps);
+
+/**
+ * Returns the hypothesis of the active search or one running
+ * alongside it.
+ *
+ * @see ps_add_concurrent_search
+ * @param out_best_score Output: path score of the hypothesis.
+ * @return The hypothesis, or NULL if there is none or the search is
+ *         not running.
+ */
+POCKETSPHINX_EXPORT
+char const *ps_get_search_hyp(ps_decoder_t *ps, const char *name,
+                              int32 *out_best_score);
+
 /**
  * Unsets the search and releases related resources.
  *
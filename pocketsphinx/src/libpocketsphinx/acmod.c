@@ -54,6 +54,7 @@
 #include <sphinxbase/byteorder.h>
 #include <sphinxbase/feat.h>
 #include <sphinxbase/bio.h>
+#include <sphinxbase/pio.h>
 
 /* Local headers. */
 #include "cmdln_macro.h"
@@ -61,13 +62,150 @@
 #include "s2_semi_mgau.h"
 #include "ptm_mgau.h"
 #include "ms_mgau.h"
+#include "subvq_mgau.h"
+#include "ext_mgau.h"
+
+/* Upper limit on -scorebatch. */
+#define ACMOD_MAX_BATCH 64
+
+/* Senone dump file scores are quantized to steps of this many score
+ * units (about 0.4 nats) above the best score in the frame. */
+#define SENFH_QSTEP 4
+/* Size of the fixed part of a coded frame in a senone dump file. */
+#define SENFH_FRAME_HDR 10
+/* Longest unary prefix of a Rice code, past which the value follows
+ * as 8 raw bits. */
+#define RICE_ESCAPE 16
 
 static int32 acmod_process_mfcbuf(acmod_t *acmod);
+static int32 acmod_vec2list(acmod_t *acmod, bitvec_t const *vec);
+
+/**
+ * Forget all batch-computed scores.
+ */
+static void
+acmod_clear_batch(acmod_t *acmod)
+{
+    int i;
+
+    for (i = 0; i < acmod->n_senscr_batch; ++i)
+        acmod->senscr_batch_frame[i] = -1;
+}
+
+/**
+ * Forget all cached scores, when the features or the model change.
+ */
+/**
+ * Allocate the scores for batches of frames, which also have to be
+ * kept for the frames that the search looks back at with -pl_window.
+ */
+static void
+acmod_init_batch(acmod_t *acmod, int score_batch)
+{
+    if (acmod->senscr_batch)
+        ckd_free_2d(acmod->senscr_batch);
+    ckd_free(acmod->senscr_batch_frame);
+    acmod->senscr_batch = NULL;
+    acmod->senscr_batch_frame = NULL;
+    acmod->n_senscr_batch = 0;
+
+    acmod->score_batch = score_batch;
+    if (acmod->score_batch > ACMOD_MAX_BATCH)
+        acmod->score_batch = ACMOD_MAX_BATCH;
+    if ((acmod->score_batch > 1 || acmod->pipeline > 0)
+        && acmod->mgau->vt->frame_eval_batch) {
+        acmod->n_senscr_batch = (acmod->pipeline > acmod->score_batch
+                                 ? acmod->pipeline : acmod->score_batch)
+            + cmd_ln_int32_r(acmod->config, "-pl_window") + 1;
+        acmod->senscr_batch = ckd_calloc_2d(acmod->n_senscr_batch,
+                                            bin_mdef_n_sen(acmod->mdef),
+                                            sizeof(**acmod->senscr_batch));
+        acmod->senscr_batch_frame = ckd_calloc(acmod->n_senscr_batch,
+                                               sizeof(*acmod->senscr_batch_frame));
+        acmod_clear_batch(acmod);
+    }
+}
+
+static void
+acmod_clear_cache(acmod_t *acmod)
+{
+    int i;
+
+    for (i = 0; i < acmod->n_senscr_cache; ++i)
+        acmod->senscr_cache_frame[i] = -1;
+}
+
+/**
+ * Allocate the scores of recent frames for the union of the senones
+ * that the searches asked for, when computing only active senones.
+ */
+static void
+acmod_init_cache(acmod_t *acmod, int n_frame)
+{
+    if (acmod->senscr_cache)
+        ckd_free_2d(acmod->senscr_cache);
+    if (acmod->senscr_cache_vec)
+        ckd_free_2d(acmod->senscr_cache_vec);
+    ckd_free(acmod->senscr_cache_frame);
+    bitvec_free(acmod->senscr_cache_miss);
+    acmod->senscr_cache = NULL;
+    acmod->senscr_cache_vec = NULL;
+    acmod->senscr_cache_frame = NULL;
+    acmod->senscr_cache_miss = NULL;
+    acmod->n_senscr_cache = 0;
+
+    if (n_frame <= 0)
+        return;
+    acmod->n_senscr_cache = n_frame;
+    acmod->senscr_cache = ckd_calloc_2d(acmod->n_senscr_cache,
+                                        bin_mdef_n_sen(acmod->mdef),
+                                        sizeof(**acmod->senscr_cache));
+    acmod->senscr_cache_vec = ckd_calloc_2d(acmod->n_senscr_cache,
+                                            bitvec_size(bin_mdef_n_sen(acmod->mdef)),
+                                            sizeof(**acmod->senscr_cache_vec));
+    acmod->senscr_cache_frame = ckd_calloc(acmod->n_senscr_cache,
+                                           sizeof(*acmod->senscr_cache_frame));
+    acmod->senscr_cache_miss = bitvec_alloc(bin_mdef_n_sen(acmod->mdef));
+    acmod_clear_cache(acmod);
+}
+
+/**
+ * Load the transition matrices and Gaussians from an image, failing
+ * without complaint if it is unusable so that the model files can be
+ * read instead.
+ */
+static int
+acmod_init_am_image(acmod_t *acmod, char const *imagefn)
+{
+    am_image_t *img;
+
+    if ((img = am_image_read(acmod->config, imagefn)) == NULL) {
+        E_WARN("Not using acoustic model image %s\n", imagefn);
+        return -1;
+    }
+    acmod->tmat = am_image_tmat(img);
+    if (acmod->tmat->n_tmat != bin_mdef_n_tmat(acmod->mdef)) {
+        E_WARN("Number of transition matrices in %s does not match: %d != %d\n",
+               imagefn, acmod->tmat->n_tmat, bin_mdef_n_tmat(acmod->mdef));
+        goto error_out;
+    }
+    E_INFO("Using general multi-stream GMM computation\n");
+    if ((acmod->mgau = ms_mgau_init_image(acmod, img)) == NULL)
+        goto error_out;
+    am_image_free(img);
+    return 0;
+
+error_out:
+    tmat_free(acmod->tmat);
+    acmod->tmat = NULL;
+    am_image_free(img);
+    return -1;
+}
 
 static int
 acmod_init_am(acmod_t *acmod)
 {
-    char const *mdeffn, *tmatfn, *mllrfn, *hmmdir;
+    char const *mdeffn, *tmatfn, *mllrfn, *hmmdir, *imagefn;
 
     /* Read model definition. */
     if ((mdeffn = cmd_ln_str_r(acmod->config, "_mdef")) == NULL) {
@@ -86,6 +224,12 @@ acmod_init_am(acmod_t *acmod)
         return -1;
     }
 
+    /* Use a precompiled image of the parameters if there is one. */
+    if ((imagefn = cmd_ln_str_r(acmod->config, "_amimage"))
+        && cmd_ln_str_r(acmod->config, "-subvq") == NULL
+        && acmod_init_am_image(acmod, imagefn) == 0)
+        goto mllr;
+
     /* Read transition matrices. */
     if ((tmatfn = cmd_ln_str_r(acmod->config, "_tmat")) == NULL) {
         E_ERROR("No tmat file specified\n");
@@ -96,14 +240,23 @@ acmod_init_am(acmod_t *acmod)
                             TRUE);
 
     /* Read the acoustic models. */
-    if ((cmd_ln_str_r(acmod->config, "_mean") == NULL)
-        || (cmd_ln_str_r(acmod->config, "_var") == NULL)
+    if ((cmd_ln_str_r(acmod->config, "_gauq8") == NULL
+         && ((cmd_ln_str_r(acmod->config, "_mean") == NULL)
+             || (cmd_ln_str_r(acmod->config, "_var") == NULL)))
         || (cmd_ln_str_r(acmod->config, "_tmat") == NULL)) {
         E_ERROR("No mean/var/tmat files specified\n");
         return -1;
     }
 
-    if (cmd_ln_str_r(acmod->config, "_senmgau")) {
+    if (cmd_ln_str_r(acmod->config, "-subvq")) {
+        E_INFO("Using sub-vector quantized Gaussian selection\n");
+        acmod->mgau = subvq_mgau_init(acmod, acmod->lmath, acmod->mdef);
+        if (acmod->mgau == NULL)
+            return -1;
+    }
+    /* Only the general computation module can use quantized codebooks. */
+    else if (cmd_ln_str_r(acmod->config, "_senmgau")
+        || cmd_ln_str_r(acmod->config, "_gauq8")) {
         E_INFO("Using general multi-stream GMM computation\n");
         acmod->mgau = ms_mgau_init(acmod, acmod->lmath, acmod->mdef);
         if (acmod->mgau == NULL)
@@ -115,6 +268,9 @@ acmod_init_am(acmod_t *acmod)
             E_INFO("Attempting to use semi-continuous computation module\n");
             if ((acmod->mgau = s2_semi_mgau_init(acmod)) == NULL) {
                 E_INFO("Falling back to general multi-stream GMM computation\n");
+                if (cmd_ln_str_r(acmod->config, "_kdtree"))
+                    E_WARN("kd-trees are only used with tied-mixture models, "
+                           "ignoring %s\n", cmd_ln_str_r(acmod->config, "_kdtree"));
                 acmod->mgau = ms_mgau_init(acmod, acmod->lmath, acmod->mdef);
                 if (acmod->mgau == NULL) {
                     E_ERROR("Failed to read acoustic model\n");
@@ -124,6 +280,7 @@ acmod_init_am(acmod_t *acmod)
         }
     }
 
+mllr:
     /* If there is an MLLR transform, apply it. */
     if ((mllrfn = cmd_ln_str_r(acmod->config, "-mllr"))) {
         ps_mllr_t *mllr = ps_mllr_read(mllrfn);
@@ -135,6 +292,30 @@ acmod_init_am(acmod_t *acmod)
     return 0;
 }
 
+static int
+acmod_share_am(acmod_t *acmod, acmod_t *share)
+{
+    if (logmath_get_base(acmod->lmath) != logmath_get_base(share->lmath)) {
+        E_ERROR("Log base %f does not match that of shared model %f\n",
+                logmath_get_base(acmod->lmath),
+                logmath_get_base(share->lmath));
+        return -1;
+    }
+    if (share->mgau->vt->share == NULL) {
+        E_WARN("Cannot share %s acoustic model, loading a separate copy\n",
+               share->mgau->vt->name);
+        return acmod_init_am(acmod);
+    }
+
+    acmod->mdef = bin_mdef_retain(share->mdef);
+    acmod->tmat = tmat_retain(share->tmat);
+    if ((acmod->mgau = ps_mgau_share(share->mgau, acmod)) == NULL)
+        return -1;
+    if (share->mllr)
+        acmod->mllr = ps_mllr_retain(share->mllr);
+    return 0;
+}
+
 static int
 acmod_init_feat(acmod_t *acmod)
 {
@@ -146,6 +327,8 @@ acmod_init_feat(acmod_t *acmod)
                   1, cmd_ln_int32_r(acmod->config, "-ceplen"));
     if (acmod->fcb == NULL)
         return -1;
+    /* Keep every frame of feat_buf aligned for the GMM evaluators. */
+    feat_set_frame_align(acmod->fcb, TRUE);
 
     if (cmd_ln_str_r(acmod->config, "_lda")) {
         E_INFO("Reading linear feature transformation from %s\n",
@@ -173,7 +356,15 @@ acmod_init_feat(acmod_t *acmod)
     }
 
     if (acmod->fcb->cmn_struct
-        && cmd_ln_exists_r(acmod->config, "-cmninit")) {
+        && cmd_ln_exists_r(acmod->config, "-cmninit")
+        && stat_mtime(cmd_ln_str_r(acmod->config, "-cmninit")) >= 0) {
+        /* A prior saved from an earlier stream. */
+        if (cmn_live_read(acmod->fcb->cmn_struct,
+                          cmd_ln_str_r(acmod->config, "-cmninit")) < 0)
+            return -1;
+    }
+    else if (acmod->fcb->cmn_struct
+             && cmd_ln_exists_r(acmod->config, "-cmninit")) {
         char *c, *cc, *vallist;
         int32 nvals;
 
@@ -226,6 +417,13 @@ acmod_feat_mismatch(acmod_t *acmod, feat_t *fcb)
 
 acmod_t *
 acmod_init(cmd_ln_t *config, logmath_t *lmath, fe_t *fe, feat_t *fcb)
+{
+    return acmod_init_shared(config, lmath, fe, fcb, NULL);
+}
+
+acmod_t *
+acmod_init_shared(cmd_ln_t *config, logmath_t *lmath,
+                  fe_t *fe, feat_t *fcb, acmod_t *share)
 {
     acmod_t *acmod;
 
@@ -249,6 +447,12 @@ acmod_init(cmd_ln_t *config, logmath_t *lmath, fe_t *fe, feat_t *fcb)
         if (acmod_fe_mismatch(acmod, acmod->fe))
             goto error_out;
     }
+    if (cmd_ln_str_r(config, "-fecache")) {
+        acmod->fecache = fe_cache_init(acmod->fe,
+                                       cmd_ln_str_r(config, "-fecache"));
+        if (acmod->fecache == NULL)
+            goto error_out;
+    }
     if (fcb) {
         if (acmod_feat_mismatch(acmod, fcb))
             goto error_out;
@@ -261,8 +465,12 @@ acmod_init(cmd_ln_t *config, logmath_t *lmath, fe_t *fe, feat_t *fcb)
             goto error_out;
     }
 
-    /* Load acoustic model parameters. */
-    if (acmod_init_am(acmod) < 0)
+    /* Load acoustic model parameters, or share them. */
+    if (share) {
+        if (acmod_share_am(acmod, share) < 0)
+            goto error_out;
+    }
+    else if (acmod_init_am(acmod) < 0)
         goto error_out;
 
 
@@ -288,6 +496,14 @@ acmod_init(cmd_ln_t *config, logmath_t *lmath, fe_t *fe, feat_t *fcb)
                                                      sizeof(*acmod->senone_active));
     acmod->log_zero = logmath_get_zero(acmod->lmath);
     acmod->compallsen = cmd_ln_boolean_r(config, "-compallsen");
+
+    acmod_init_batch(acmod, cmd_ln_int32_r(config, "-scorebatch"));
+
+    acmod_init_cache(acmod, cmd_ln_int32_r(config, "-senscrcache"));
+
+    if (cmd_ln_boolean_r(config, "-stagetime"))
+        acmod->stage_perf = ckd_calloc(PS_N_STAGES,
+                                       sizeof(*acmod->stage_perf));
     return acmod;
 
 error_out:
@@ -302,6 +518,7 @@ acmod_free(acmod_t *acmod)
         return;
 
     feat_free(acmod->fcb);
+    fe_cache_free(acmod->fecache);
     fe_free(acmod->fe);
     cmd_ln_free_r(acmod->config);
 
@@ -318,10 +535,21 @@ acmod_free(acmod_t *acmod)
         fclose(acmod->senfh);
 
     ckd_free(acmod->framepos);
+    ckd_free(acmod->senfh_buf);
     ckd_free(acmod->senone_scores);
+    if (acmod->senscr_batch)
+        ckd_free_2d(acmod->senscr_batch);
+    ckd_free(acmod->senscr_batch_frame);
+    if (acmod->senscr_cache)
+        ckd_free_2d(acmod->senscr_cache);
+    if (acmod->senscr_cache_vec)
+        ckd_free_2d(acmod->senscr_cache_vec);
+    ckd_free(acmod->senscr_cache_frame);
+    bitvec_free(acmod->senscr_cache_miss);
     ckd_free(acmod->senone_active_vec);
     ckd_free(acmod->senone_active);
     ckd_free(acmod->rawdata);
+    ckd_free(acmod->stage_perf);
 
     if (acmod->mdef)
         bin_mdef_free(acmod->mdef);
@@ -331,6 +559,7 @@ acmod_free(acmod_t *acmod)
         ps_mgau_free(acmod->mgau);
     if (acmod->mllr)
         ps_mllr_free(acmod->mllr);
+    ps_fmllr_free(acmod->fmllr);
 
     ckd_free(acmod);
 }
@@ -341,23 +570,183 @@ acmod_update_mllr(acmod_t *acmod, ps_mllr_t *mllr)
     if (acmod->mllr)
         ps_mllr_free(acmod->mllr);
     acmod->mllr = mllr;
-    ps_mgau_transform(acmod->mgau, mllr);
+    if (acmod->mgau->vt->transform)
+        ps_mgau_transform(acmod->mgau, mllr);
+    else
+        E_WARN("MLLR transforms do not apply to %s acoustic model\n",
+               acmod->mgau->vt->name);
+    acmod_clear_batch(acmod);
+    acmod_clear_cache(acmod);
 
     return mllr;
 }
 
+int
+acmod_set_scorer(acmod_t *acmod, ps_scorer_funcs_t const *funcs,
+                 void *data, int context, int batch, int lookahead)
+{
+    ps_mgau_t *mgau;
+
+    if ((mgau = ext_mgau_init(acmod, funcs, data, context,
+                              batch, lookahead)) == NULL)
+        return -1;
+    ps_mgau_free(acmod->mgau);
+    acmod->mgau = mgau;
+    /* It scores every senone, so it might as well do so in batches. */
+    acmod->compallsen = TRUE;
+    acmod_init_batch(acmod, batch);
+    acmod_clear_cache(acmod);
+    acmod->senscr_frame = -1;
+
+    return 0;
+}
+
+int
+acmod_set_pipeline(acmod_t *acmod, int n_queue)
+{
+    int rv = 0;
+
+    if (n_queue > 0 && acmod->mgau->vt->frame_eval_batch == NULL) {
+        E_WARN("%s acoustic model cannot score frames in batches, "
+               "not scoring in a separate thread\n", acmod->mgau->vt->name);
+        n_queue = 0;
+        rv = -1;
+    }
+    acmod->pipeline = n_queue;
+    /* Which senones the search will want is not known in advance. */
+    if (n_queue > 0)
+        acmod->compallsen = TRUE;
+    acmod_init_batch(acmod, acmod->score_batch);
+    return rv;
+}
+
+int
+acmod_set_senscr_cache(acmod_t *acmod, int n_frame)
+{
+    if (n_frame > acmod->n_senscr_cache)
+        acmod_init_cache(acmod, n_frame);
+    return acmod->n_senscr_cache;
+}
+
+ps_fmllr_t *
+acmod_set_fmllr(acmod_t *acmod, ps_fmllr_t *fmllr)
+{
+    int i;
+
+    if (fmllr) {
+        if (fmllr->n_feat != feat_dimension1(acmod->fcb)) {
+            E_ERROR("Feature space transform has %d streams, not %d\n",
+                    fmllr->n_feat, feat_dimension1(acmod->fcb));
+            return NULL;
+        }
+        for (i = 0; i < fmllr->n_feat; ++i) {
+            if (fmllr->veclen[i] != feat_dimension2(acmod->fcb, i)) {
+                E_ERROR("Feature space transform has length %d "
+                        "for stream %d, not %d\n", fmllr->veclen[i], i,
+                        feat_dimension2(acmod->fcb, i));
+                return NULL;
+            }
+        }
+        ps_fmllr_retain(fmllr);
+    }
+    ps_fmllr_free(acmod->fmllr);
+    acmod->fmllr = fmllr;
+
+    return fmllr;
+}
+
+/**
+ * Transform some frames of dynamic features just computed.
+ */
+static void
+acmod_apply_fmllr(acmod_t *acmod, mfcc_t ***feat, int32 nfr)
+{
+    ps_fmllr_t *fmllr = acmod->fmllr;
+    int32 i, j, k;
+
+    if (fmllr == NULL)
+        return;
+    for (i = 0; i < nfr; ++i) {
+        for (j = 0; j < fmllr->n_feat; ++j) {
+            mfcc_t *x = feat[i][j];
+            float32 const *a = fmllr->a[j];
+            float32 const *b = fmllr->b[j];
+
+            for (k = 0; k < fmllr->veclen[j]; ++k)
+                x[k] = FLOAT2MFCC(a[k] * MFCC2FLOAT(x[k]) + b[k]);
+        }
+    }
+}
+
+int
+acmod_fmllr_accum(acmod_t *acmod, ps_fmllr_t *fmllr,
+                  int frame, int senone, float64 weight)
+{
+    float32 *x, *mean, *ivar;
+    int32 i, k;
+    int rv = 0;
+
+    if (acmod->mgau->vt->nearest == NULL) {
+        E_ERROR("Acoustic model type %s does not support "
+                "feature space adaptation\n", acmod->mgau->vt->name);
+        return -1;
+    }
+    for (i = 0; i < fmllr->n_feat && rv == 0; ++i) {
+        mfcc_t const *obs = acmod->feat_buf[frame][i];
+        int32 veclen = fmllr->veclen[i];
+        float64 **s = fmllr->stats[i];
+
+        x = ckd_calloc(veclen, sizeof(*x));
+        mean = ckd_calloc(veclen, sizeof(*mean));
+        ivar = ckd_calloc(veclen, sizeof(*ivar));
+        if ((rv = ps_mgau_nearest(acmod->mgau, senone, i, obs,
+                                  mean, ivar)) < 0) {
+            E_ERROR("Acoustic model has no means and variances "
+                    "for feature space adaptation\n");
+        }
+        else {
+            /* Take the features back to what they were before the
+             * current transform. */
+            for (k = 0; k < veclen; ++k) {
+                x[k] = MFCC2FLOAT(obs[k]);
+                if (acmod->fmllr)
+                    x[k] = (x[k] - acmod->fmllr->b[i][k])
+                        / acmod->fmllr->a[i][k];
+            }
+            for (k = 0; k < veclen; ++k) {
+                float64 gp = weight * ivar[k];
+
+                s[k][0] += gp * x[k] * x[k];
+                s[k][1] += gp * x[k];
+                s[k][2] += gp;
+                s[k][3] += gp * mean[k] * x[k];
+                s[k][4] += gp * mean[k];
+            }
+        }
+        ckd_free(x);
+        ckd_free(mean);
+        ckd_free(ivar);
+    }
+    if (rv == 0)
+        fmllr->count += weight;
+
+    return rv;
+}
+
 int
 acmod_write_senfh_header(acmod_t *acmod, FILE *logfh)
 {
-    char nsenstr[64], logbasestr[64];
+    char nsenstr[64], logbasestr[64], stepstr[16];
 
     sprintf(nsenstr, "%d", bin_mdef_n_sen(acmod->mdef));
     sprintf(logbasestr, "%f", logmath_get_base(acmod->lmath));
+    sprintf(stepstr, "%d", SENFH_QSTEP);
     return bio_writehdr(logfh,
-                        "version", "0.1",
+                        "version", "0.2",
                         "mdef_file", cmd_ln_str_r(acmod->config, "_mdef"),
                         "n_sen", nsenstr,
-                        "logbase", logbasestr, NULL);
+                        "logbase", logbasestr,
+                        "quant_step", stepstr, NULL);
 }
 
 int
@@ -422,6 +811,8 @@ acmod_set_grow(acmod_t *acmod, int grow_feat)
 int
 acmod_start_utt(acmod_t *acmod)
 {
+    int i;
+
     fe_start_utt(acmod->fe);
     acmod->state = ACMOD_STARTED;
     acmod->n_mfc_frame = 0;
@@ -430,9 +821,23 @@ acmod_start_utt(acmod_t *acmod)
     acmod->feat_outidx = 0;
     acmod->output_frame = 0;
     acmod->senscr_frame = -1;
+    acmod_clear_batch(acmod);
+    acmod_clear_cache(acmod);
     acmod->n_senone_active = 0;
     acmod->mgau->frame_idx = 0;
     acmod->rawdata_pos = 0;
+    acmod->rawdata_full = FALSE;
+
+    /* Fold the last utterance's counts into the totals. */
+    acmod->stats_all.n_frame += acmod->stats.n_frame;
+    acmod->stats_all.n_senone_active += acmod->stats.n_senone_active;
+    acmod->stats_all.n_hmm_eval += acmod->stats.n_hmm_eval;
+    acmod->stats_all.n_lm_query += acmod->stats.n_lm_query;
+    acmod->stats_all.n_bp += acmod->stats.n_bp;
+    memset(&acmod->stats, 0, sizeof(acmod->stats));
+    if (acmod->stage_perf)
+        for (i = 0; i < PS_N_STAGES; ++i)
+            ptmr_reset(&acmod->stage_perf[i]);
 
     return 0;
 }
@@ -448,7 +853,9 @@ acmod_end_utt(acmod_t *acmod)
         /* Where to start writing them (circular buffer) */
         inptr = (acmod->mfc_outidx + acmod->n_mfc_frame) % acmod->n_mfc_alloc;
         /* nfr is always either zero or one. */
+        acmod_stage_start(acmod, PS_STAGE_FE);
         fe_end_utt(acmod->fe, acmod->mfc_buf[inptr], &nfr);
+        acmod_stage_stop(acmod, PS_STAGE_FE);
         acmod->n_mfc_frame += nfr;
         
         /* Process whatever's left, and any leadout or update stats if needed. */
@@ -520,6 +927,7 @@ acmod_process_full_cep(acmod_t *acmod,
     /* Make dynamic features. */
     nfr = feat_s2mfc2feat_live(acmod->fcb, *inout_cep, inout_n_frames,
                                TRUE, TRUE, acmod->feat_buf);
+    acmod_apply_fmllr(acmod, acmod->feat_buf, nfr);
     acmod->n_feat_frame = nfr;
     assert(acmod->n_feat_frame <= acmod->n_feat_alloc);
     *inout_cep += *inout_n_frames;
@@ -528,6 +936,80 @@ acmod_process_full_cep(acmod_t *acmod,
     return nfr;
 }
 
+/**
+ * Get features for a whole utterance from the feature cache.
+ *
+ * The cached frames are copied into mfc_buf rather than used in
+ * place, since they may be mapped read-only and CMN modifies its
+ * input.
+ */
+static int
+acmod_process_cached_raw(acmod_t *acmod,
+                         int16 const **inout_raw,
+                         size_t *inout_n_samps)
+{
+    mfcc_t **cep, **cepptr;
+    int32 nfr;
+
+    acmod_stage_start(acmod, PS_STAGE_FE);
+    if (fe_cache_process_utt(acmod->fecache, *inout_raw, *inout_n_samps,
+                             &cep, &nfr) < 0) {
+        acmod_stage_stop(acmod, PS_STAGE_FE);
+        return -1;
+    }
+    *inout_raw += *inout_n_samps;
+    *inout_n_samps = 0;
+
+    if (acmod->n_mfc_alloc < nfr + 1) {
+        ckd_free_2d(acmod->mfc_buf);
+        acmod->mfc_buf = ckd_calloc_2d(nfr + 1, fe_get_output_size(acmod->fe),
+                                       sizeof(**acmod->mfc_buf));
+        acmod->n_mfc_alloc = nfr + 1;
+    }
+    if (nfr > 0)
+        memcpy(acmod->mfc_buf[0], cep[0],
+               nfr * fe_get_output_size(acmod->fe) * sizeof(**cep));
+    acmod->n_mfc_frame = 0;
+    acmod->mfc_outidx = 0;
+    acmod_stage_stop(acmod, PS_STAGE_FE);
+
+    cepptr = acmod->mfc_buf;
+    nfr = acmod_process_cep(acmod, &cepptr, &nfr, TRUE);
+    acmod->n_mfc_frame = 0;
+    return nfr;
+}
+
+/**
+ * Keep a copy of processed audio in the rawdata ring and the logging
+ * file, if any.
+ */
+static void
+acmod_log_raw(acmod_t *acmod, int16 const *raw, size_t n_samps)
+{
+    size_t n1;
+
+    if (acmod->rawfh)
+        fwrite(raw, sizeof(int16), n_samps, acmod->rawfh);
+    if (acmod->rawdata_size == 0)
+        return;
+
+    /* Only the most recent rawdata_size samples are kept. */
+    if (n_samps >= (size_t)acmod->rawdata_size) {
+        raw += n_samps - acmod->rawdata_size;
+        n_samps = acmod->rawdata_size;
+    }
+    n1 = acmod->rawdata_size - acmod->rawdata_pos;
+    if (n1 > n_samps)
+        n1 = n_samps;
+    memcpy(acmod->rawdata + acmod->rawdata_pos, raw, n1 * sizeof(*raw));
+    memcpy(acmod->rawdata, raw + n1, (n_samps - n1) * sizeof(*raw));
+    acmod->rawdata_pos += n_samps;
+    if (acmod->rawdata_pos >= acmod->rawdata_size) {
+        acmod->rawdata_pos -= acmod->rawdata_size;
+        acmod->rawdata_full = TRUE;
+    }
+}
+
 static int
 acmod_process_full_raw(acmod_t *acmod,
                        int16 const **inout_raw,
@@ -537,15 +1019,13 @@ acmod_process_full_raw(acmod_t *acmod,
     mfcc_t **cepptr;
 
     /* Write to logging file if any. */
-    if (*inout_n_samps + acmod->rawdata_pos < acmod->rawdata_size) {
-	memcpy(acmod->rawdata + acmod->rawdata_pos, *inout_raw, *inout_n_samps * sizeof(int16));
-	acmod->rawdata_pos += *inout_n_samps;
-    }
-    if (acmod->rawfh)
-        fwrite(*inout_raw, sizeof(int16), *inout_n_samps, acmod->rawfh);
+    acmod_log_raw(acmod, *inout_raw, *inout_n_samps);
+    if (acmod->fecache)
+        return acmod_process_cached_raw(acmod, inout_raw, inout_n_samps);
     /* Resize mfc_buf to fit. */
     if (fe_process_frames(acmod->fe, NULL, inout_n_samps, NULL, &nfr, NULL) < 0)
         return -1;
+    acmod_stage_start(acmod, PS_STAGE_FE);
     if (acmod->n_mfc_alloc < nfr + 1) {
         ckd_free_2d(acmod->mfc_buf);
         acmod->mfc_buf = ckd_calloc_2d(nfr + 1, fe_get_output_size(acmod->fe),
@@ -556,13 +1036,16 @@ acmod_process_full_raw(acmod_t *acmod,
     acmod->mfc_outidx = 0;
     fe_start_utt(acmod->fe);
     if (fe_process_frames(acmod->fe, inout_raw, inout_n_samps,
-                          acmod->mfc_buf, &nfr, NULL) < 0)
+                          acmod->mfc_buf, &nfr, NULL) < 0) {
+        acmod_stage_stop(acmod, PS_STAGE_FE);
         return -1;
+    }
     fe_end_utt(acmod->fe, acmod->mfc_buf[nfr], &ntail);
     nfr += ntail;
+    acmod_stage_stop(acmod, PS_STAGE_FE);
 
     cepptr = acmod->mfc_buf;
-    nfr = acmod_process_full_cep(acmod, &cepptr, &nfr);
+    nfr = acmod_process_cep(acmod, &cepptr, &nfr, TRUE);
     acmod->n_mfc_frame = 0;
     return nfr;
 }
@@ -629,27 +1112,22 @@ acmod_process_raw(acmod_t *acmod,
         /* Where to start writing them (circular buffer) */
         inptr = (acmod->mfc_outidx + acmod->n_mfc_frame) % acmod->n_mfc_alloc;
 
+        acmod_stage_start(acmod, PS_STAGE_FE);
         /* Write them in two (or more) parts if there is wraparound. */
         while (inptr + ncep > acmod->n_mfc_alloc) {
             int32 ncep1 = acmod->n_mfc_alloc - inptr;
             if (fe_process_frames(acmod->fe, inout_raw, inout_n_samps,
-                                  acmod->mfc_buf + inptr, &ncep1, &out_frameidx) < 0)
+                                  acmod->mfc_buf + inptr, &ncep1, &out_frameidx) < 0) {
+                acmod_stage_stop(acmod, PS_STAGE_FE);
                 return -1;
+            }
 	    
 	    if (out_frameidx > 0)
 		acmod->utt_start_frame = out_frameidx;
 
     	    processed_samples = *inout_raw - prev_audio_inptr;
-	    if (processed_samples + acmod->rawdata_pos < acmod->rawdata_size) {
-		memcpy(acmod->rawdata + acmod->rawdata_pos, prev_audio_inptr, processed_samples * sizeof(int16));
-		acmod->rawdata_pos += processed_samples;
-	    }
             /* Write to logging file if any. */
-            if (acmod->rawfh) {
-                fwrite(prev_audio_inptr, sizeof(int16),
-                       processed_samples,
-                       acmod->rawfh);
-            }
+            acmod_log_raw(acmod, prev_audio_inptr, processed_samples);
             prev_audio_inptr = *inout_raw;
             
             /* ncep1 now contains the number of frames actually
@@ -669,45 +1147,35 @@ acmod_process_raw(acmod_t *acmod,
 
         assert(inptr + ncep <= acmod->n_mfc_alloc);        
         if (fe_process_frames(acmod->fe, inout_raw, inout_n_samps,
-                              acmod->mfc_buf + inptr, &ncep, &out_frameidx) < 0)
+                              acmod->mfc_buf + inptr, &ncep, &out_frameidx) < 0) {
+            acmod_stage_stop(acmod, PS_STAGE_FE);
             return -1;
+        }
 
 	if (out_frameidx > 0)
 	    acmod->utt_start_frame = out_frameidx;
 
 	
 	processed_samples = *inout_raw - prev_audio_inptr;
-	if (processed_samples + acmod->rawdata_pos < acmod->rawdata_size) {
-	    memcpy(acmod->rawdata + acmod->rawdata_pos, prev_audio_inptr, processed_samples * sizeof(int16));
-	    acmod->rawdata_pos += processed_samples;
-	}
-        if (acmod->rawfh) {
-            fwrite(prev_audio_inptr, sizeof(int16),
-                   processed_samples, acmod->rawfh);
-        }
+        acmod_log_raw(acmod, prev_audio_inptr, processed_samples);
         prev_audio_inptr = *inout_raw;
         acmod->n_mfc_frame += ncep;
     alldone:
-        ;
+        acmod_stage_stop(acmod, PS_STAGE_FE);
     }
 
     /* Hand things off to acmod_process_cep. */
     return acmod_process_mfcbuf(acmod);
 }
 
-int
-acmod_process_cep(acmod_t *acmod,
-                  mfcc_t ***inout_cep,
-                  int *inout_n_frames,
-                  int full_utt)
+static int
+acmod_process_live_cep(acmod_t *acmod,
+                       mfcc_t ***inout_cep,
+                       int *inout_n_frames)
 {
     int32 nfeat, ncep, inptr;
     int orig_n_frames;
 
-    /* If this is a full utterance, process it all at once. */
-    if (full_utt)
-        return acmod_process_full_cep(acmod, inout_cep, inout_n_frames);
-
     /* Write to file. */
     if (acmod->mfcfh)
         acmod_log_mfc(acmod, *inout_cep, *inout_n_frames);
@@ -727,8 +1195,11 @@ acmod_process_cep(acmod_t *acmod,
          * utterance because we can't return a short read there. */
         if (acmod->grow_feat || acmod->state == ACMOD_ENDED)
             acmod_grow_feat_buf(acmod, acmod->n_feat_alloc + nfeat);
-        else
+        else {
             ncep -= (nfeat - (acmod->n_feat_alloc - acmod->n_feat_frame));
+            /* Don't wrap around into frames that are still queued. */
+            nfeat = acmod->n_feat_alloc - acmod->n_feat_frame;
+        }
     }
 
     /* Where to start writing in the feature buffer. */
@@ -764,6 +1235,7 @@ acmod_process_cep(acmod_t *acmod,
                                      acmod->feat_buf + inptr);
         if (nfeat < 0)
             return -1;
+        acmod_apply_fmllr(acmod, acmod->feat_buf + inptr, nfeat);
         /* Move the output feature pointer forward. */
         acmod->n_feat_frame += nfeat;
         assert(acmod->n_feat_frame <= acmod->n_feat_alloc);
@@ -782,6 +1254,7 @@ acmod_process_cep(acmod_t *acmod,
                                  acmod->feat_buf + inptr);
     if (nfeat < 0)
         return -1;
+    acmod_apply_fmllr(acmod, acmod->feat_buf + inptr, nfeat);
     acmod->n_feat_frame += nfeat;
     assert(acmod->n_feat_frame <= acmod->n_feat_alloc);
     /* Move the input feature pointers forward. */
@@ -793,6 +1266,24 @@ acmod_process_cep(acmod_t *acmod,
     return orig_n_frames - *inout_n_frames;
 }
 
+int
+acmod_process_cep(acmod_t *acmod,
+                  mfcc_t ***inout_cep,
+                  int *inout_n_frames,
+                  int full_utt)
+{
+    int nfr;
+
+    acmod_stage_start(acmod, PS_STAGE_FEAT);
+    /* If this is a full utterance, process it all at once. */
+    if (full_utt)
+        nfr = acmod_process_full_cep(acmod, inout_cep, inout_n_frames);
+    else
+        nfr = acmod_process_live_cep(acmod, inout_cep, inout_n_frames);
+    acmod_stage_stop(acmod, PS_STAGE_FEAT);
+    return nfr;
+}
+
 int
 acmod_process_feat(acmod_t *acmod,
                    mfcc_t **feat)
@@ -818,6 +1309,7 @@ acmod_process_feat(acmod_t *acmod,
     for (i = 0; i < feat_dimension1(acmod->fcb); ++i)
         memcpy(acmod->feat_buf[inptr][i],
                feat[i], feat_dimension2(acmod->fcb, i) * sizeof(**feat));
+    acmod_apply_fmllr(acmod, acmod->feat_buf + inptr, 1);
     ++acmod->n_feat_frame;
     assert(acmod->n_feat_frame <= acmod->n_feat_alloc);
 
@@ -833,7 +1325,16 @@ acmod_read_senfh_header(acmod_t *acmod)
 
     if (bio_readhdr(acmod->insenfh, &name, &val, &swap) < 0)
         goto error_out;
+    /* Version 0.1 files have no quant_step and plain int16 scores. */
+    acmod->insen_step = 0;
     for (i = 0; name[i] != NULL; ++i) {
+        if (!strcmp(name[i], "quant_step")) {
+            if ((acmod->insen_step = atoi(val[i])) <= 0) {
+                E_ERROR("Bad quantization step in senone file: %s\n",
+                        val[i]);
+                goto error_out;
+            }
+        }
         if (!strcmp(name[i], "n_sen")) {
             if (atoi(val[i]) != bin_mdef_n_sen(acmod->mdef)) {
                 E_ERROR("Number of senones in senone file (%d) does not "
@@ -866,7 +1367,8 @@ acmod_set_insenfh(acmod_t *acmod, FILE *senfh)
     acmod->insenfh = senfh;
     if (senfh == NULL) {
         acmod->n_feat_frame = 0;
-        acmod->compallsen = cmd_ln_boolean_r(acmod->config, "-compallsen");
+        acmod->compallsen = cmd_ln_boolean_r(acmod->config, "-compallsen")
+            || acmod->pipeline > 0;
         return 0;
     }
     acmod->compallsen = TRUE;
@@ -890,6 +1392,7 @@ acmod_rewind(acmod_t *acmod)
     acmod->feat_outidx = 0;
     acmod->output_frame = 0;
     acmod->senscr_frame = -1;
+    acmod_clear_batch(acmod);
     acmod->mgau->frame_idx = 0;
 
     return 0;
@@ -903,50 +1406,283 @@ acmod_advance(acmod_t *acmod)
         acmod->feat_outidx = 0;
     --acmod->n_feat_frame;
     ++acmod->mgau->frame_idx;
+    ++acmod->stats.n_frame;
 
     return ++acmod->output_frame;
 }
 
+/*
+ * Rice codes for the senone dump file.  Bits are packed LSB first.
+ */
+typedef struct bitbuf_s {
+    uint8 *buf;
+    size_t pos;
+    size_t end;
+    uint64 acc;
+    int nbits;
+} bitbuf_t;
+
+static void
+bitbuf_put(bitbuf_t *bb, uint32 bits, int n)
+{
+    bb->acc |= (uint64)bits << bb->nbits;
+    bb->nbits += n;
+    while (bb->nbits >= 8) {
+        bb->buf[bb->pos++] = (uint8)bb->acc;
+        bb->acc >>= 8;
+        bb->nbits -= 8;
+    }
+}
+
+static void
+bitbuf_flush(bitbuf_t *bb)
+{
+    if (bb->nbits > 0)
+        bb->buf[bb->pos++] = (uint8)bb->acc;
+    bb->acc = 0;
+    bb->nbits = 0;
+}
+
+static void
+rice_put(bitbuf_t *bb, uint32 val, int k)
+{
+    uint32 q = val >> k;
+
+    if (q < RICE_ESCAPE) {
+        /* q ones and a zero, then the low k bits. */
+        bitbuf_put(bb, (1U << q) - 1, q + 1);
+        bitbuf_put(bb, val & ((1U << k) - 1), k);
+    }
+    else {
+        bitbuf_put(bb, (1U << RICE_ESCAPE) - 1, RICE_ESCAPE);
+        bitbuf_put(bb, val, 8);
+    }
+}
+
+static int
+rice_get(bitbuf_t *bb, int k)
+{
+    int q;
+    uint32 val;
+
+    while (bb->nbits <= 56 && bb->pos < bb->end) {
+        bb->acc |= (uint64)bb->buf[bb->pos++] << bb->nbits;
+        bb->nbits += 8;
+    }
+    /* Bits past the end of the frame read as zero, so a truncated
+     * code shows up as needing more bits than there are. */
+    for (q = 0; q < RICE_ESCAPE && (bb->acc >> q) & 1; ++q)
+        ;
+    if (q == RICE_ESCAPE) {
+        if (bb->nbits < RICE_ESCAPE + 8)
+            return -1;
+        val = (uint32)(bb->acc >> RICE_ESCAPE) & 0xff;
+        bb->acc >>= RICE_ESCAPE + 8;
+        bb->nbits -= RICE_ESCAPE + 8;
+        return val;
+    }
+    if (bb->nbits < q + 1 + k)
+        return -1;
+    val = (q << k) | ((uint32)(bb->acc >> (q + 1)) & ((1U << k) - 1));
+    bb->acc >>= q + 1 + k;
+    bb->nbits -= q + 1 + k;
+    return val;
+}
+
+/**
+ * Choose a Rice parameter for values with the given sum.
+ */
+static int
+rice_param(uint32 sum, int n)
+{
+    int k;
+
+    for (k = 0; k < 7 && ((uint32)n << (k + 1)) <= sum; ++k)
+        ;
+    return k;
+}
+
+static uint32
+senfh_quantize(int16 score, int16 best)
+{
+    int32 q = ((int32)score - best + SENFH_QSTEP / 2) / SENFH_QSTEP;
+    return q > 255 ? 255 : q;
+}
+
+/**
+ * Get the coding buffer, big enough for any frame.
+ */
+static uint8 *
+acmod_senfh_buf(acmod_t *acmod)
+{
+    if (acmod->senfh_buf == NULL) {
+        int n_sen = bin_mdef_n_sen(acmod->mdef);
+        /* Deltas and scores for every senone plus bridging entries,
+         * none taking more than 3 bytes. */
+        acmod->senfh_buf = ckd_calloc((n_sen + n_sen / 255 + 1) * 6 + 8, 1);
+    }
+    return acmod->senfh_buf;
+}
+
 int
 acmod_write_scores(acmod_t *acmod, int n_active, uint8 const *active,
                    int16 const *senscr, FILE *senfh)
 {
-    int16 n_active2;
-
-    /* Uncompressed frame format:
-     *
-     * (2 bytes) n_active: Number of active senones
-     * If all senones active:
-     * (n_active * 2 bytes) scores of active senones
+    uint8 hdr[SENFH_FRAME_HDR];
+    bitbuf_t bb;
+    int all_active, i, n;
+    int16 n_active2, best;
+    uint8 k_delta, k_score;
+    uint32 sum;
+    int32 nbytes;
+
+    /* Compressed frame format:
      *
-     * Otherwise:
      * (2 bytes) n_active: Number of active senones
-     * (n_active bytes) deltas to active senones
-     * (n_active * 2 bytes) scores of active senones
+     * (2 bytes) best: Best score of active senones
+     * (1 byte) Rice parameter for deltas
+     * (1 byte) Rice parameter for scores
+     * (4 bytes) Length of the rest of the frame
+     * If not all senones active:
+     * (Rice coded) deltas to active senones
+     * (Rice coded) scores of active senones, in units of quant_step
+     *   above best and saturating at 255, padded to a whole byte
      */
-    n_active2 = n_active;
-    if (fwrite(&n_active2, 2, 1, senfh) != 1)
-        goto error_out;
-    if (n_active == bin_mdef_n_sen(acmod->mdef)) {
-        if (fwrite(senscr, 2, n_active, senfh) != n_active)
-            goto error_out;
-    }
-    else {
-        int i, n;
-        if (fwrite(active, 1, n_active, senfh) != n_active)
-            goto error_out;
-        for (i = n = 0; i < n_active; ++i) {
+    all_active = (n_active == bin_mdef_n_sen(acmod->mdef));
+    best = SENSCR_DUMMY;
+    sum = 0;
+    for (i = n = 0; i < n_active; ++i) {
+        if (!all_active) {
             n += active[i];
-            if (fwrite(senscr + n, 2, 1, senfh) != 1)
-                goto error_out;
+            sum += active[i];
         }
+        else
+            n = i;
+        if (senscr[n] < best)
+            best = senscr[n];
+    }
+    k_delta = all_active ? 0 : rice_param(sum, n_active);
+
+    bb.buf = acmod_senfh_buf(acmod);
+    bb.pos = 0;
+    bb.acc = 0;
+    bb.nbits = 0;
+    if (!all_active) {
+        for (i = 0; i < n_active; ++i)
+            rice_put(&bb, active[i], k_delta);
+    }
+    bitbuf_flush(&bb);
+    /* Quantize the scores once to find the parameter, then again to
+     * code them. */
+    sum = 0;
+    for (i = n = 0; i < n_active; ++i) {
+        n = all_active ? i : n + active[i];
+        sum += senfh_quantize(senscr[n], best);
     }
+    k_score = rice_param(sum, n_active);
+    for (i = n = 0; i < n_active; ++i) {
+        n = all_active ? i : n + active[i];
+        rice_put(&bb, senfh_quantize(senscr[n], best), k_score);
+    }
+    bitbuf_flush(&bb);
+
+    n_active2 = n_active;
+    nbytes = bb.pos;
+    memcpy(hdr, &n_active2, 2);
+    memcpy(hdr + 2, &best, 2);
+    hdr[4] = k_delta;
+    hdr[5] = k_score;
+    memcpy(hdr + 6, &nbytes, 4);
+    if (fwrite(hdr, 1, SENFH_FRAME_HDR, senfh) != SENFH_FRAME_HDR)
+        goto error_out;
+    if (fwrite(bb.buf, 1, nbytes, senfh) != nbytes)
+        goto error_out;
     return 0;
 error_out:
     E_ERROR_SYSTEM("Failed to write frame to senone file");
     return -1;
 }
 
+/**
+ * Read a compressed frame, written by acmod_write_scores().
+ */
+static int
+acmod_read_scores_quant(acmod_t *acmod)
+{
+    FILE *senfh = acmod->insenfh;
+    int n_sen = bin_mdef_n_sen(acmod->mdef);
+    uint8 hdr[SENFH_FRAME_HDR];
+    bitbuf_t bb;
+    int16 n_active, best;
+    int32 nbytes;
+    int i, n, sen, all_active;
+
+    if (fread(hdr, 1, SENFH_FRAME_HDR, senfh) != SENFH_FRAME_HDR)
+        goto error_out;
+    memcpy(&n_active, hdr, 2);
+    memcpy(&best, hdr + 2, 2);
+    memcpy(&nbytes, hdr + 6, 4);
+    if (acmod->insen_swap) {
+        SWAP_INT16(&n_active);
+        SWAP_INT16(&best);
+        SWAP_INT32(&nbytes);
+    }
+    if (n_active < 0 || n_active > n_sen || hdr[4] > 7 || hdr[5] > 7
+        || nbytes < 0 || nbytes > (n_sen + n_sen / 255 + 1) * 6) {
+        E_ERROR("Corrupt frame in senone file\n");
+        return -1;
+    }
+    bb.buf = acmod_senfh_buf(acmod);
+    if (fread(bb.buf, 1, nbytes, senfh) != nbytes)
+        goto error_out;
+    bb.pos = 0;
+    bb.end = nbytes;
+    bb.acc = 0;
+    bb.nbits = 0;
+
+    acmod->n_senone_active = n_active;
+    all_active = (n_active == n_sen);
+    if (!all_active) {
+        for (i = 0; i < n_active; ++i) {
+            int delta = rice_get(&bb, hdr[4]);
+            if (delta < 0)
+                goto corrupt;
+            acmod->senone_active[i] = delta;
+        }
+        /* Scores start on the next byte. */
+        bb.pos -= bb.nbits / 8;
+        bb.acc = 0;
+        bb.nbits = 0;
+    }
+
+    /* n is the last senone filled in, sen the next active one. */
+    for (i = 0, n = -1, sen = 0; i < n_active; ++i) {
+        int32 q, scr;
+
+        if ((q = rice_get(&bb, hdr[5])) < 0)
+            goto corrupt;
+        sen = all_active ? i : sen + acmod->senone_active[i];
+        for (++n; n < sen; ++n)
+            acmod->senone_scores[n] = SENSCR_DUMMY;
+        scr = best + q * acmod->insen_step;
+        acmod->senone_scores[sen] = scr > SENSCR_DUMMY ? SENSCR_DUMMY : scr;
+        n = sen;
+    }
+    for (++n; n < n_sen; ++n)
+        acmod->senone_scores[n] = SENSCR_DUMMY;
+    return 1;
+
+corrupt:
+    E_ERROR("Corrupt frame in senone file\n");
+    return -1;
+error_out:
+    if (ferror(senfh)) {
+        E_ERROR_SYSTEM("Failed to read frame from senone file");
+        return -1;
+    }
+    return 0;
+}
+
 /**
  * Internal version, used for reading previous frames in acmod_score()
  */
@@ -966,6 +1702,8 @@ acmod_read_scores_internal(acmod_t *acmod)
 
     if (senfh == NULL)
         return -1;
+    if (acmod->insen_step)
+        return acmod_read_scores_quant(acmod);
     
     if ((rv = fread(&n_active, 2, 1, senfh)) != 1)
         goto error_out;
@@ -1012,6 +1750,7 @@ int
 acmod_read_scores(acmod_t *acmod)
 {
     int inptr, rv;
+    long pos;
 
     if (acmod->grow_feat) {
         /* Grow to avoid wraparound if grow_feat == TRUE. */
@@ -1026,6 +1765,7 @@ acmod_read_scores(acmod_t *acmod)
                 acmod->n_feat_alloc;
     }
 
+    pos = ftell(acmod->insenfh);
     if ((rv = acmod_read_scores_internal(acmod)) != 1)
         return rv;
 
@@ -1040,7 +1780,7 @@ acmod_read_scores(acmod_t *acmod)
      * position for the relevant frame in the (possibly circular)
      * buffer. */
     ++acmod->n_feat_frame;
-    acmod->framepos[inptr] = ftell(acmod->insenfh);
+    acmod->framepos[inptr] = pos;
 
     return 1;
 }
@@ -1102,8 +1842,170 @@ acmod_get_frame(acmod_t *acmod, int *inout_frame_idx)
     return acmod->feat_buf[feat_idx];
 }
 
-int16 const *
-acmod_score(acmod_t *acmod, int *inout_frame_idx)
+/**
+ * Get all senone scores for a frame into acmod->senone_scores,
+ * scoring it together with the buffered frames following it if it has
+ * not already been scored.
+ *
+ * @return 0 for success, 1 if this is a past frame that has to be
+ * scored by itself, <0 on error.
+ */
+static int
+acmod_score_batch(acmod_t *acmod, int frame_idx)
+{
+    int row;
+
+    row = frame_idx % acmod->n_senscr_batch;
+    if (acmod->senscr_batch_frame[row] != frame_idx) {
+        int16 *senscr[ACMOD_MAX_BATCH];
+        mfcc_t **feat[ACMOD_MAX_BATCH];
+        int feat_idx, n, i;
+
+        if (frame_idx < acmod->mgau->frame_idx)
+            return 1;
+        if ((feat_idx = calc_feat_idx(acmod, frame_idx)) < 0)
+            return -1;
+        n = acmod->output_frame + acmod->n_feat_frame - frame_idx;
+        if (n > acmod->score_batch)
+            n = acmod->score_batch;
+        if (n < 1)
+            n = 1;
+        for (i = 0; i < n; ++i) {
+            senscr[i] = acmod->senscr_batch[(frame_idx + i)
+                                            % acmod->n_senscr_batch];
+            feat[i] = acmod->feat_buf[(feat_idx + i) % acmod->n_feat_alloc];
+        }
+        n = ps_mgau_frame_eval_batch(acmod->mgau, senscr, feat, frame_idx, n);
+        if (n < 0)
+            return -1;
+        for (i = 0; i < n; ++i)
+            acmod->senscr_batch_frame[(frame_idx + i)
+                                      % acmod->n_senscr_batch] = frame_idx + i;
+    }
+    memcpy(acmod->senone_scores, acmod->senscr_batch[row],
+           bin_mdef_n_sen(acmod->mdef) * sizeof(*acmod->senone_scores));
+    return 0;
+}
+
+/**
+ * Find the active senones that have not been scored in a row of the
+ * cache, and one that has, if any.
+ *
+ * @return the number of them.
+ */
+static int32
+acmod_cache_miss(acmod_t *acmod, bitvec_t const *vec, int32 *out_anchor)
+{
+    int32 i, n, n_miss;
+
+    bitvec_clear_all(acmod->senscr_cache_miss, bin_mdef_n_sen(acmod->mdef));
+    *out_anchor = -1;
+    for (i = n = n_miss = 0; i < acmod->n_senone_active; ++i) {
+        n += acmod->senone_active[i];
+        if (bitvec_is_set(vec, n))
+            *out_anchor = n;
+        else {
+            bitvec_set(acmod->senscr_cache_miss, n);
+            ++n_miss;
+        }
+    }
+    return n_miss;
+}
+
+/**
+ * Get scores for the active senones in a frame into
+ * acmod->senone_scores from the cache, scoring only the ones that
+ * have not been scored yet for this frame.
+ *
+ * Models normalize the scores over the senones they are asked for, so
+ * one that has already been scored is scored again along with the
+ * new ones, and the difference in its scores is added to theirs.
+ * The active ones are then normalized as the model would have done.
+ * Models that also normalize their codebooks over the active senones
+ * cannot be combined like this, so the row is started over instead.
+ *
+ * @return 0 for success, <0 on error.
+ */
+static int
+acmod_score_cache(acmod_t *acmod, int frame_idx)
+{
+    bitvec_t *vec;
+    int16 *senscr;
+    int32 n_sen, row, i, n, anchor, best;
+
+    n_sen = bin_mdef_n_sen(acmod->mdef);
+    row = frame_idx % acmod->n_senscr_cache;
+    vec = acmod->senscr_cache_vec[row];
+    senscr = acmod->senscr_cache[row];
+    if (acmod->senscr_cache_frame[row] != frame_idx) {
+        bitvec_clear_all(vec, n_sen);
+        acmod->senscr_cache_frame[row] = frame_idx;
+    }
+
+    acmod_flags2list(acmod);
+    if (acmod_cache_miss(acmod, vec, &anchor) > 0) {
+        int32 feat_idx, offset;
+
+        if ((feat_idx = calc_feat_idx(acmod, frame_idx)) < 0)
+            return -1;
+        if (acmod->mgau->vt->norm == PS_MGAU_NORM_ACTIVE) {
+            bitvec_clear_all(vec, n_sen);
+            acmod_cache_miss(acmod, vec, &anchor);
+        }
+        else if (anchor == -1) {
+            i = bitvec_next_set(vec, n_sen, 0);
+            if (i < n_sen)
+                anchor = i;
+        }
+        if (anchor != -1)
+            bitvec_set(acmod->senscr_cache_miss, anchor);
+        acmod_vec2list(acmod, acmod->senscr_cache_miss);
+        ps_mgau_frame_eval(acmod->mgau, acmod->senone_scores,
+                           acmod->senone_active,
+                           acmod->n_senone_active,
+                           acmod->feat_buf[feat_idx],
+                           frame_idx, FALSE);
+        offset = 0;
+        if (anchor != -1)
+            offset = senscr[anchor] - acmod->senone_scores[anchor];
+        /* This includes any extra senones that were added to the
+         * list to bridge large gaps. */
+        for (i = n = 0; i < acmod->n_senone_active; ++i) {
+            int32 score;
+
+            n += acmod->senone_active[i];
+            if (bitvec_is_set(vec, n))
+                continue;
+            score = acmod->senone_scores[n] + offset;
+            if (score > 32767)
+                score = 32767;
+            if (score < -32768)
+                score = -32768;
+            senscr[n] = score;
+            bitvec_set(vec, n);
+        }
+        acmod_flags2list(acmod);
+    }
+
+    memcpy(acmod->senone_scores, senscr,
+           n_sen * sizeof(*acmod->senone_scores));
+    if (acmod->mgau->vt->norm == PS_MGAU_NORM_NONE)
+        return 0;
+    best = 0x7fffffff;
+    for (i = n = 0; i < acmod->n_senone_active; ++i) {
+        n += acmod->senone_active[i];
+        if (senscr[n] < best)
+            best = senscr[n];
+    }
+    for (i = n = 0; i < acmod->n_senone_active; ++i) {
+        n += acmod->senone_active[i];
+        acmod->senone_scores[n] = senscr[n] - best;
+    }
+    return 0;
+}
+
+static int16 const *
+acmod_score_frame(acmod_t *acmod, int *inout_frame_idx)
 {
     int frame_idx, feat_idx;
 
@@ -1119,6 +2021,34 @@ acmod_score(acmod_t *acmod, int *inout_frame_idx)
         return acmod->senone_scores;
     }
 
+    /* Otherwise they may have been computed along with a previous
+     * frame (not when writing them out, though). */
+    if (acmod->senscr_batch && acmod->compallsen
+        && !acmod->insenfh && !acmod->senfh) {
+        int rv;
+
+        if ((rv = acmod_score_batch(acmod, frame_idx)) < 0)
+            return NULL;
+        if (rv == 0) {
+            if (inout_frame_idx)
+                *inout_frame_idx = frame_idx;
+            acmod->senscr_frame = frame_idx;
+            return acmod->senone_scores;
+        }
+    }
+
+    /* Or for only the active senones, if several searches may ask
+     * for the same frame. */
+    if (acmod->senscr_cache && !acmod->compallsen
+        && !acmod->insenfh && !acmod->senfh) {
+        if (acmod_score_cache(acmod, frame_idx) < 0)
+            return NULL;
+        if (inout_frame_idx)
+            *inout_frame_idx = frame_idx;
+        acmod->senscr_frame = frame_idx;
+        return acmod->senone_scores;
+    }
+
     /* Calculate position of requested frame in circular buffer. */
     if ((feat_idx = calc_feat_idx(acmod, frame_idx)) < 0)
         return NULL;
@@ -1128,9 +2058,12 @@ acmod_score(acmod_t *acmod, int *inout_frame_idx)
      * it.
      */
     if (acmod->insenfh) {
+        /* Go back to where acmod_read_scores() left off afterwards. */
+        long pos = ftell(acmod->insenfh);
         fseek(acmod->insenfh, acmod->framepos[feat_idx], SEEK_SET);
         if (acmod_read_scores_internal(acmod) < 0)
             return NULL;
+        fseek(acmod->insenfh, pos, SEEK_SET);
     }
     else {
         /* Build active senone list. */
@@ -1164,6 +2097,59 @@ acmod_score(acmod_t *acmod, int *inout_frame_idx)
     return acmod->senone_scores;
 }
 
+int
+acmod_score_ahead(acmod_t *acmod, int frame_idx, int n_frame)
+{
+    int16 *senscr[ACMOD_MAX_BATCH];
+    mfcc_t **feat[ACMOD_MAX_BATCH];
+    int feat_idx, done, n, i;
+
+    acmod_stage_start(acmod, PS_STAGE_GMM);
+    for (done = 0; done < n_frame; done += n) {
+        if ((feat_idx = calc_feat_idx(acmod, frame_idx + done)) < 0)
+            break;
+        n = n_frame - done;
+        if (n > acmod->score_batch)
+            n = acmod->score_batch;
+        for (i = 0; i < n; ++i) {
+            int f = frame_idx + done + i;
+            senscr[i] = acmod->senscr_batch[f % acmod->n_senscr_batch];
+            feat[i] = acmod->feat_buf[(feat_idx + i) % acmod->n_feat_alloc];
+        }
+        n = ps_mgau_frame_eval_batch(acmod->mgau, senscr, feat,
+                                     frame_idx + done, n);
+        if (n < 0)
+            break;
+        for (i = 0; i < n; ++i) {
+            int f = frame_idx + done + i;
+            acmod->senscr_batch_frame[f % acmod->n_senscr_batch] = f;
+        }
+    }
+    acmod_stage_stop(acmod, PS_STAGE_GMM);
+
+    return done < n_frame ? -1 : done;
+}
+
+int16 const *
+acmod_score(acmod_t *acmod, int *inout_frame_idx)
+{
+    int16 const *senscr;
+    int prev_frame;
+
+    prev_frame = acmod->senscr_frame;
+    /* With a pipeline, the scores were computed (and timed) in the
+     * other thread. */
+    if (!acmod->pipeline)
+        acmod_stage_start(acmod, PS_STAGE_GMM);
+    senscr = acmod_score_frame(acmod, inout_frame_idx);
+    if (!acmod->pipeline)
+        acmod_stage_stop(acmod, PS_STAGE_GMM);
+    /* Don't count scores which were simply reused. */
+    if (senscr && acmod->senscr_frame != prev_frame)
+        acmod->stats.n_senone_active += acmod->n_senone_active;
+    return senscr;
+}
+
 int
 acmod_best_score(acmod_t *acmod, int *out_best_senid)
 {
@@ -1250,42 +2236,31 @@ acmod_activate_hmm(acmod_t *acmod, hmm_t *hmm)
     }
 }
 
-int32
-acmod_flags2list(acmod_t *acmod)
+/**
+ * Build the list of senones to score in acmod->senone_active from a
+ * bit vector.
+ *
+ * The set bits of each word are visited lowest first by clearing them
+ * one at a time, so the cost follows the number of active senones
+ * rather than the number of senones.
+ */
+static int32
+acmod_vec2list(acmod_t *acmod, bitvec_t const *vec)
 {
-    int32 w, l, n, b, total_dists, total_words, extra_bits;
-    bitvec_t *flagptr;
+    int32 w, l, n, total_dists, total_words, extra_bits;
 
     total_dists = bin_mdef_n_sen(acmod->mdef);
-    if (acmod->compallsen) {
-        acmod->n_senone_active = total_dists;
-        return total_dists;
-    }
-    total_words = total_dists / BITVEC_BITS;
+    total_words = bitvec_size(total_dists);
     extra_bits = total_dists % BITVEC_BITS;
-    w = n = l = 0;
-    for (flagptr = acmod->senone_active_vec; w < total_words; ++w, ++flagptr) {
-        if (*flagptr == 0)
-            continue;
-        for (b = 0; b < BITVEC_BITS; ++b) {
-            if (*flagptr & (1UL << b)) {
-                int32 sen = w * BITVEC_BITS + b;
-                int32 delta = sen - l;
-                /* Handle excessive deltas "lossily" by adding a few
-                   extra senones to bridge the gap. */
-                while (delta > 255) {
-                    acmod->senone_active[n++] = 255;
-                    delta -= 255;
-                }
-                acmod->senone_active[n++] = delta;
-                l = sen;
-            }
-        }
-    }
-
-    for (b = 0; b < extra_bits; ++b) {
-        if (*flagptr & (1UL << b)) {
-            int32 sen = w * BITVEC_BITS + b;
+    n = l = 0;
+    for (w = 0; w < total_words; ++w) {
+        bitvec_t bits = vec[w];
+
+        /* Ignore anything past the last senone. */
+        if (extra_bits && w == total_words - 1)
+            bits &= ((bitvec_t)1 << extra_bits) - 1;
+        while (bits) {
+            int32 sen = w * BITVEC_BITS + bitvec_ctz(bits);
             int32 delta = sen - l;
             /* Handle excessive deltas "lossily" by adding a few
                extra senones to bridge the gap. */
@@ -1295,6 +2270,7 @@ acmod_flags2list(acmod_t *acmod)
             }
             acmod->senone_active[n++] = delta;
             l = sen;
+            bits &= bits - 1;
         }
     }
 
@@ -1304,6 +2280,16 @@ acmod_flags2list(acmod_t *acmod)
     return n;
 }
 
+int32
+acmod_flags2list(acmod_t *acmod)
+{
+    if (acmod->compallsen) {
+        acmod->n_senone_active = bin_mdef_n_sen(acmod->mdef);
+        return acmod->n_senone_active;
+    }
+    return acmod_vec2list(acmod, acmod->senone_active_vec);
+}
+
 int32
 acmod_stream_offset(acmod_t *acmod)
 {
@@ -1322,20 +2308,125 @@ acmod_set_rawdata_size(acmod_t *acmod, int32 size)
 {	
     assert(size >= 0);
     acmod->rawdata_size = size;
-    if (acmod->rawdata_size > 0) {
-	ckd_free(acmod->rawdata);
+    acmod->rawdata_pos = 0;
+    acmod->rawdata_full = FALSE;
+    ckd_free(acmod->rawdata);
+    acmod->rawdata = NULL;
+    if (acmod->rawdata_size > 0)
 	acmod->rawdata = ckd_calloc(size, sizeof(int16));
+}
+
+static void
+reverse_int16(int16 *buf, int32 n)
+{
+    int32 i;
+
+    for (i = 0; i < n / 2; ++i) {
+        int16 tmp = buf[i];
+        buf[i] = buf[n - 1 - i];
+        buf[n - 1 - i] = tmp;
     }
 }
 
 void
 acmod_get_rawdata(acmod_t *acmod, int16 **buffer, int32 *size)
 {
+    /* Rotate the oldest sample to the start of the buffer. */
+    if (acmod->rawdata_full && acmod->rawdata_pos > 0) {
+        reverse_int16(acmod->rawdata, acmod->rawdata_pos);
+        reverse_int16(acmod->rawdata + acmod->rawdata_pos,
+                      acmod->rawdata_size - acmod->rawdata_pos);
+        reverse_int16(acmod->rawdata, acmod->rawdata_size);
+        acmod->rawdata_pos = 0;
+    }
     if (buffer) {
 	*buffer = acmod->rawdata;
     }
     if (size) {
-	*size = acmod->rawdata_pos;
+	*size = acmod->rawdata_full ? acmod->rawdata_size : acmod->rawdata_pos;
+    }
+}
+
+void
+acmod_get_memory(acmod_t *acmod, int shared,
+                 ps_mem_t *out_mem, ps_mem_t *out_mgau)
+{
+    int32 n_sen = bin_mdef_n_sen(acmod->mdef);
+    size_t heap;
+
+    ps_mem_add_heap(out_mem, bin_mdef_mem_size(acmod->mdef,
+                                               &out_mem->mapped), shared);
+    ps_mem_add_heap(out_mem, tmat_mem_size(acmod->tmat), shared);
+
+    /* Feature and senone score buffers. */
+    heap = sizeof(*acmod)
+        + acmod->n_mfc_alloc * (acmod->fcb->cepsize * sizeof(mfcc_t)
+                                + sizeof(mfcc_t *))
+        + acmod->n_feat_alloc * (feat_frame_stride(acmod->fcb) * sizeof(mfcc_t)
+                                 + feat_dimension1(acmod->fcb)
+                                 * sizeof(mfcc_t *)
+                                 + sizeof(mfcc_t **)
+                                 + sizeof(*acmod->framepos))
+        + n_sen * (sizeof(*acmod->senone_scores)
+                   + sizeof(*acmod->senone_active))
+        + bitvec_size(n_sen) * sizeof(bitvec_t)
+        + acmod->n_senscr_batch * (n_sen * sizeof(**acmod->senscr_batch)
+                                   + sizeof(frame_idx_t))
+        + acmod->n_senscr_cache * (n_sen * sizeof(**acmod->senscr_cache)
+                                   + bitvec_size(n_sen) * sizeof(bitvec_t)
+                                   + sizeof(frame_idx_t))
+        + (acmod->senscr_cache_miss ? bitvec_size(n_sen) * sizeof(bitvec_t) : 0)
+        + acmod->rawdata_size * sizeof(*acmod->rawdata);
+    out_mem->heap += heap;
+
+    if (acmod->mgau->vt->mem)
+        (*acmod->mgau->vt->mem)(acmod->mgau, out_mgau);
+}
+
+void
+acmod_get_stats(acmod_t *acmod, ps_stats_t *out_utt, ps_stats_t *out_all)
+{
+    int i;
+
+    if (out_utt) {
+        *out_utt = acmod->stats;
+        if (acmod->stage_perf) {
+            for (i = 0; i < PS_N_STAGES; ++i) {
+                out_utt->cpu[i] = acmod->stage_perf[i].t_cpu;
+                out_utt->wall[i] = acmod->stage_perf[i].t_elapsed;
+            }
+        }
     }
+    if (out_all) {
+        *out_all = acmod->stats_all;
+        out_all->n_frame += acmod->stats.n_frame;
+        out_all->n_senone_active += acmod->stats.n_senone_active;
+        out_all->n_hmm_eval += acmod->stats.n_hmm_eval;
+        out_all->n_lm_query += acmod->stats.n_lm_query;
+        out_all->n_bp += acmod->stats.n_bp;
+        if (acmod->stage_perf) {
+            for (i = 0; i < PS_N_STAGES; ++i) {
+                out_all->cpu[i] = acmod->stage_perf[i].t_tot_cpu;
+                out_all->wall[i] = acmod->stage_perf[i].t_tot_elapsed;
+            }
+        }
+    }
+}
+
+int
+acmod_get_rawdata_parts(acmod_t *acmod, int16 const *out_parts[2],
+                        int32 out_sizes[2])
+{
+    int n = 0;
+
+    if (acmod->rawdata_full) {
+        out_parts[n] = acmod->rawdata + acmod->rawdata_pos;
+        out_sizes[n++] = acmod->rawdata_size - acmod->rawdata_pos;
+    }
+    if (acmod->rawdata_pos > 0) {
+        out_parts[n] = acmod->rawdata;
+        out_sizes[n++] = acmod->rawdata_pos;
+    }
+    return n;
 }
 
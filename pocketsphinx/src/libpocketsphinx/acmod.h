@@ -50,12 +50,15 @@
 #include <sphinxbase/cmd_ln.h>
 #include <sphinxbase/logmath.h>
 #include <sphinxbase/fe.h>
+#include <sphinxbase/fe_cache.h>
 #include <sphinxbase/feat.h>
 #include <sphinxbase/bitvec.h>
 #include <sphinxbase/err.h>
 #include <sphinxbase/prim_type.h>
+#include <sphinxbase/profile.h>
 
 /* Local headers. */
+#include "pocketsphinx.h"
 #include "ps_mllr.h"
 #include "bin_mdef.h"
 #include "tmat.h"
@@ -90,10 +93,41 @@ struct ps_mllr_s {
     int32 *cb2mllr; /**< Mapping from codebooks to transformations. */
 };
 
+/**
+ * Number of statistics kept for each dimension of a ps_fmllr_t.
+ */
+#define PS_FMLLR_N_STATS 5
+
+/**
+ * Diagonal feature space transform, with the statistics to estimate it.
+ */
+struct ps_fmllr_s {
+    int refcnt;       /**< Reference count. */
+    int n_feat;       /**< Number of feature streams. */
+    int *veclen;      /**< Length of vectors for each stream. */
+    float32 **a;      /**< Scale of each dimension. */
+    float32 **b;      /**< Bias of each dimension. */
+    float64 ***stats; /**< Statistics for each stream and dimension
+                         (see ps_fmllr_update()). */
+    float64 count;    /**< Total weight of the frames accumulated. */
+};
+
 /**
  * Acoustic model parameter structure. 
  */
 typedef struct ps_mgau_s ps_mgau_t;
+typedef struct acmod_s acmod_t;
+
+/**
+ * How a model normalizes the senone scores in each frame.
+ */
+enum ps_mgau_norm_e {
+    PS_MGAU_NORM_NONE,  /**< Scores do not depend on the other senones scored. */
+    PS_MGAU_NORM_BEST,  /**< The best of the senones scored is zero. */
+    PS_MGAU_NORM_ACTIVE /**< As PS_MGAU_NORM_BEST, and the codebook
+                           scores are normalized over the codebooks of
+                           the senones scored. */
+};
 
 typedef struct ps_mgaufuncs_s {
     char const *name;
@@ -105,9 +139,57 @@ typedef struct ps_mgaufuncs_s {
                       mfcc_t ** feat,
                       int32 frame,
                       int32 compallsen);
+    /**
+     * Compute all senone scores for several consecutive frames at
+     * once, which allows each codebook to be used for all of them
+     * while it is in cache.  This must give the same scores as
+     * frame_eval() with compallsen for each frame in turn.  It may be
+     * NULL if not supported.
+     *
+     * @return number of frames scored, starting with the first,
+     *         which may be fewer than n_frame, or <0 on error.
+     */
+    int (*frame_eval_batch)(ps_mgau_t *mgau,
+                            int16 **senscr,
+                            mfcc_t ***feat,
+                            int32 frame,
+                            int32 n_frame);
     int (*transform)(ps_mgau_t *mgau,
                      ps_mllr_t *mllr);
+    /**
+     * Create another instance of the model for a different acoustic
+     * model object, sharing its read-only parameters, but with its own
+     * scoring state.  It may be NULL if not supported.
+     */
+    ps_mgau_t *(*share)(ps_mgau_t *mgau,
+                        acmod_t *acmod);
     void (*free)(ps_mgau_t *mgau);
+    /**
+     * How frame_eval() normalizes senone scores, which tells whether
+     * those scored in separate calls for the same frame can be put
+     * together.
+     */
+    enum ps_mgau_norm_e norm;
+    /**
+     * Find the density of a senone's mixture with the highest
+     * likelihood for an observation in one feature stream, for
+     * feature-space adaptation (see ps_fmllr_accum()).  It may be
+     * NULL if not supported.
+     *
+     * @return 0, or -1 if the parameters are not available.
+     */
+    int (*nearest)(ps_mgau_t *mgau,
+                   int32 senone,
+                   int32 feat,
+                   mfcc_t const *obs,
+                   float32 *out_mean,
+                   float32 *out_ivar);
+    /**
+     * Add up the memory used by the model (see
+     * ps_get_memory_report()), counting parameters shared with other
+     * instances as shared.  It may be NULL if not supported.
+     */
+    void (*mem)(ps_mgau_t *mgau, ps_mem_t *out_mem);
 } ps_mgaufuncs_t;    
 
 struct ps_mgau_s {
@@ -119,11 +201,27 @@ struct ps_mgau_s {
 #define ps_mgau_frame_eval(mg,senscr,senone_active,n_senone_active,feat,frame,compallsen) \
     (*ps_mgau_base(mg)->vt->frame_eval)                                 \
     (mg, senscr, senone_active, n_senone_active, feat, frame, compallsen)
+#define ps_mgau_frame_eval_batch(mg,senscr,feat,frame,n_frame)            \
+    (*ps_mgau_base(mg)->vt->frame_eval_batch)                           \
+    (mg, senscr, feat, frame, n_frame)
 #define ps_mgau_transform(mg, mllr)                                  \
     (*ps_mgau_base(mg)->vt->transform)(mg, mllr)
+#define ps_mgau_share(mg, acmod)                                  \
+    (*ps_mgau_base(mg)->vt->share)(mg, acmod)
+#define ps_mgau_nearest(mg, sen, f, obs, mean, ivar)                    \
+    (*ps_mgau_base(mg)->vt->nearest)(mg, sen, f, obs, mean, ivar)
 #define ps_mgau_free(mg)                                  \
     (*ps_mgau_base(mg)->vt->free)(mg)
 
+/**
+ * Count heap memory in a report as shared or not.
+ */
+#define ps_mem_add_heap(mem, bytes, is_shared)                          \
+    do {                                                                \
+        if (is_shared) (mem)->shared += (bytes);                        \
+        else (mem)->heap += (bytes);                                    \
+    } while (0)
+
 /**
  * Acoustic model structure.
  *
@@ -153,6 +251,7 @@ struct acmod_s {
 
     /* Feature computation: */
     fe_t *fe;                  /**< Acoustic feature computation. */
+    fe_cache_t *fecache;       /**< Cache of whole-utterance features. */
     feat_t *fcb;               /**< Dynamic feature computation. */
 
     /* Model parameters: */
@@ -160,12 +259,23 @@ struct acmod_s {
     tmat_t *tmat;              /**< Transition matrices. */
     ps_mgau_t *mgau;           /**< Model parameters. */
     ps_mllr_t *mllr;           /**< Speaker transformation. */
+    ps_fmllr_t *fmllr;         /**< Feature space speaker transformation. */
 
     /* Senone scoring: */
     int16 *senone_scores;      /**< GMM scores for current frame. */
     bitvec_t *senone_active_vec; /**< Active GMMs in current frame. */
     uint8 *senone_active;      /**< Array of deltas to active GMMs. */
     int senscr_frame;          /**< Frame index for senone_scores. */
+    int16 **senscr_batch;      /**< Scores of recent frames, when computing all senones. */
+    frame_idx_t *senscr_batch_frame; /**< Frame index for each row of senscr_batch, or -1. */
+    int n_senscr_batch;        /**< Number of rows in senscr_batch. */
+    int score_batch;           /**< Maximum number of frames to score at once. */
+    int pipeline;              /**< Frames scored ahead by another thread, or 0. */
+    int16 **senscr_cache;      /**< Scores of recent frames, when computing active senones. */
+    bitvec_t **senscr_cache_vec; /**< Senones scored in each row of senscr_cache. */
+    frame_idx_t *senscr_cache_frame; /**< Frame index for each row of senscr_cache, or -1. */
+    int n_senscr_cache;        /**< Number of rows in senscr_cache. */
+    bitvec_t *senscr_cache_miss; /**< Active senones not found in senscr_cache. */
     int n_senone_active;       /**< Number of active GMMs. */
     int log_zero;              /**< Zero log-probability value. */
 
@@ -177,11 +287,20 @@ struct acmod_s {
     FILE *senfh;        /**< File for writing senone score data. */
     FILE *insenfh;	/**< Input senone score file. */
     long *framepos;     /**< File positions of recent frames in senone file. */
+    uint8 *senfh_buf;   /**< Coded frame being written to or read from a senone file. */
+    int16 insen_step;   /**< Quantization step of input senone file, or 0 if not quantized. */
 
-    /* Rawdata collected during decoding */
+    /* Rawdata collected during decoding, a ring buffer holding the
+     * most recent rawdata_size samples. */
     int16 *rawdata;
-    int32 rawdata_size;
-    int32 rawdata_pos;
+    int32 rawdata_size; /**< Size of rawdata in samples. */
+    int32 rawdata_pos;  /**< Position of the next sample in rawdata. */
+    uint8 rawdata_full; /**< Whether rawdata has wrapped around. */
+
+    /* Performance statistics, shared by all searches using this. */
+    ps_stats_t stats;     /**< Counts for the current utterance. */
+    ps_stats_t stats_all; /**< Counts for previous utterances. */
+    ptmr_t *stage_perf;   /**< Timer for each stage, or NULL if not timing. */
 
     /* A whole bunch of flags and counters: */
     uint8 state;        /**< State of utterance processing. */
@@ -199,7 +318,6 @@ struct acmod_s {
     frame_idx_t n_feat_frame; /**< Number of frames active in feat_buf */
     frame_idx_t feat_outidx;  /**< Start of active frames in feat_buf */
 };
-typedef struct acmod_s acmod_t;
 
 /**
  * Initialize an acoustic model.
@@ -219,6 +337,24 @@ typedef struct acmod_s acmod_t;
  */
 acmod_t *acmod_init(cmd_ln_t *config, logmath_t *lmath, fe_t *fe, feat_t *fcb);
 
+/**
+ * Initialize an acoustic model that shares its parameters with another.
+ *
+ * The model definition, transition matrices, and Gaussian and
+ * mixture weight parameters of share are used (and retained) instead
+ * of being loaded from the files in config, as is its current speaker
+ * transformation.  Feature computation and scoring state are separate,
+ * as are any transformations applied later, which make a private copy
+ * of the Gaussians.  If the type of model in share cannot be shared,
+ * a separate copy is loaded from config instead.
+ *
+ * @param share acoustic model to share parameters with.
+ * @param lmath must have the same base as the one used by share.
+ * @return a newly initialized acmod_t, or NULL on failure.
+ */
+acmod_t *acmod_init_shared(cmd_ln_t *config, logmath_t *lmath,
+                           fe_t *fe, feat_t *fcb, acmod_t *share);
+
 /**
  * Adapt acoustic model using a linear transform.
  *
@@ -232,6 +368,69 @@ acmod_t *acmod_init(cmd_ln_t *config, logmath_t *lmath, fe_t *fe, feat_t *fcb);
  */
 ps_mllr_t *acmod_update_mllr(acmod_t *acmod, ps_mllr_t *mllr);
 
+/**
+ * Score senones with an external scorer from now on (see
+ * ps_set_scorer()).
+ *
+ * @return 0, or -1 on failure, in which case the model is unchanged.
+ */
+int acmod_set_scorer(acmod_t *acmod, ps_scorer_funcs_t const *funcs,
+                     void *data, int context, int batch, int lookahead);
+
+/**
+ * Keep the scores of up to n_queue frames computed by another thread
+ * ahead of the search (see ps_pipeline_init()), or stop if n_queue is
+ * 0.  This makes all senones be scored.
+ *
+ * @return 0, or -1 if the model cannot score frames in batches.
+ */
+int acmod_set_pipeline(acmod_t *acmod, int n_queue);
+
+/**
+ * Keep the active senone scores of at least n_frame recent frames, as
+ * -senscrcache does, for searches which score the same frames.
+ *
+ * @return the number of frames kept.
+ */
+int acmod_set_senscr_cache(acmod_t *acmod, int n_frame);
+
+/**
+ * Score all senones of some buffered frames for the search to find
+ * later, without changing the current frame's scores.
+ *
+ * @return number of frames scored, or <0 on error.
+ */
+int acmod_score_ahead(acmod_t *acmod, int frame_idx, int n_frame);
+
+/**
+ * Create an identity feature space transform for the features of an
+ * acoustic model.
+ */
+ps_fmllr_t *ps_fmllr_init_feat(feat_t *fcb);
+
+/**
+ * Apply a feature space transform to the features computed from now
+ * on, or stop transforming them if fmllr is NULL.
+ *
+ * @return fmllr, which the acoustic model retains.
+ */
+ps_fmllr_t *acmod_set_fmllr(acmod_t *acmod, ps_fmllr_t *fmllr);
+
+/**
+ * Accumulate statistics for a feature space transform from one frame
+ * of the current utterance, which must have been rewound.
+ *
+ * The features are taken back through the transform currently
+ * applied, so the statistics do not depend on it.
+ *
+ * @param frame Index of the frame in the utterance.
+ * @param senone Senone aligned to it.
+ * @param weight Posterior probability of the alignment.
+ * @return 0, or -1 if the model does not support this.
+ */
+int acmod_fmllr_accum(acmod_t *acmod, ps_fmllr_t *fmllr,
+                      int frame, int senone, float64 weight);
+
 /**
  * Start logging senone scores to a filehandle.
  *
@@ -281,7 +480,7 @@ int acmod_end_utt(acmod_t *acmod);
  * acmod_score() will return scores starting at the first frame of the
  * current utterance.  Currently, acmod_set_grow() must have been
  * called to enable growing the feature buffer in order for this to
- * work.  In the future, senone scores may be cached instead.
+ * work.  Scores kept with -senscrcache are reused.
  *
  * @return 0 for success, <0 for failure (if the utterance can't be
  *         rewound due to no feature or score data available)
@@ -413,6 +612,11 @@ int acmod_write_senfh_header(acmod_t *acmod, FILE *logfh);
 
 /**
  * Write a frame of senone scores to a dump file.
+ *
+ * Scores are quantized to 8 bits relative to the best one in the
+ * frame and Rice coded, along with the active senone deltas.  Each
+ * frame starts on a byte boundary, so its file position is enough
+ * to seek back to it.
  */
 int acmod_write_scores(acmod_t *acmod, int n_active, uint8 const *active,
                        int16 const *senscr, FILE *senfh);
@@ -438,6 +642,37 @@ void acmod_activate_hmm(acmod_t *acmod, hmm_t *hmm);
  */
 #define acmod_activate_sen(acmod, sen) bitvec_set((acmod)->senone_active_vec, sen)
 
+/**
+ * Start timing a stage of decoding, if -stagetime is enabled.
+ */
+#define acmod_stage_start(acmod, stage)                         \
+    do { if ((acmod)->stage_perf)                               \
+            ptmr_start(&(acmod)->stage_perf[stage]); } while (0)
+
+/**
+ * Stop timing a stage of decoding.
+ */
+#define acmod_stage_stop(acmod, stage)                          \
+    do { if ((acmod)->stage_perf)                               \
+            ptmr_stop(&(acmod)->stage_perf[stage]); } while (0)
+
+/**
+ * Get performance statistics, see ps_get_stats().
+ */
+void acmod_get_stats(acmod_t *acmod, ps_stats_t *out_utt, ps_stats_t *out_all);
+
+/**
+ * Add up the memory used by the acoustic model, see
+ * ps_get_memory_report().
+ *
+ * @param shared Whether the model definition and transition matrices
+ *               are shared with other decoders.
+ * @param out_mem Output: memory of the PS_MEM_ACMOD part.
+ * @param out_mgau Output: memory of the PS_MEM_MGAU part.
+ */
+void acmod_get_memory(acmod_t *acmod, int shared,
+                      ps_mem_t *out_mem, ps_mem_t *out_mgau);
+
 /**
  * Build active list from 
  */
@@ -460,7 +695,21 @@ void acmod_set_rawdata_size(acmod_t *acmod, int32 size);
 
 /**
  * Retrieves the raw data collected during utterance decoding
+ *
+ * The ring buffer is rotated in place if it has wrapped around, so
+ * that the data is contiguous.
  */
 void acmod_get_rawdata(acmod_t *acmod, int16 **buffer, int32 *size);
 
+/**
+ * Retrieves the raw data collected during utterance decoding without
+ * moving it.
+ *
+ * @param out_parts Output: oldest and newest parts of the data.
+ * @param out_sizes Output: sizes of the parts in samples.
+ * @return Number of parts (0, 1 or 2).
+ */
+int acmod_get_rawdata_parts(acmod_t *acmod, int16 const *out_parts[2],
+                            int32 out_sizes[2]);
+
 #endif /* __ACMOD_H__ */
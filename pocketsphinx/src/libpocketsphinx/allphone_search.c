@@ -123,6 +123,9 @@ allphone_search_seg_iter(ps_search_t * search)
     return (ps_seg_t *) iter;
 }
 
+static ps_search_t *allphone_search_clone(ps_search_t * search,
+                                          acmod_t * acmod, dict_t * dict);
+
 static ps_searchfuncs_t allphone_funcs = {
     /* start: */ allphone_search_start,
     /* step: */ allphone_search_step,
@@ -133,6 +136,8 @@ static ps_searchfuncs_t allphone_funcs = {
     /* hyp: */ allphone_search_hyp,
     /* prob: */ allphone_search_prob,
     /* seg_iter: */ allphone_search_seg_iter,
+    /* clone: */ allphone_search_clone,
+    /* mem: */ NULL,
 };
 
 /**
@@ -303,6 +308,9 @@ phmm_build(allphone_search_t * allphs)
     ckd_free(pid2phmm);
     ckd_free(filler);
 
+    allphs->n_phmm = n_phmm;
+    allphs->active = (hmm_t **) ckd_calloc(n_phmm, sizeof(hmm_t *));
+
     /* Create links between PHMM nodes */
     n_link = phmm_link(allphs);
 
@@ -336,6 +344,8 @@ phmm_free(allphone_search_t * allphs)
         }
     }
     ckd_free(allphs->ci_phmm);
+    ckd_free(allphs->active);
+    allphs->active = NULL;
 }
 
 /** Evaluate active PHMMs */
@@ -344,118 +354,106 @@ phmm_eval_all(allphone_search_t * allphs, const int16 * senscr)
 {
     s3cipid_t ci;
     phmm_t *p;
-    int32 best;
     bin_mdef_t *mdef;
     phmm_t **ci_phmm;
 
     mdef = ((ps_search_t *) allphs)->acmod->mdef;
     ci_phmm = allphs->ci_phmm;
 
-    best = WORST_SCORE;
-
+    /* Collect the active PHMMs and evaluate them in batches. */
+    allphs->n_active = 0;
     hmm_context_set_senscore(allphs->hmmctx, senscr);
     for (ci = 0; ci < mdef->n_ciphone; ci++) {
         for (p = ci_phmm[(unsigned) ci]; p; p = p->next) {
-            if (hmm_frame(&(p->hmm)) == allphs->frame) {
-                int32 score;
-                allphs->n_hmm_eval++;
-                score = hmm_vit_eval((hmm_t *) p);
-                if (score > best)
-                    best = score;
-            }
+            if (hmm_frame(&(p->hmm)) == allphs->frame)
+                allphs->active[allphs->n_active++] = &(p->hmm);
         }
     }
+    allphs->n_hmm_eval += allphs->n_active;
 
-    return best;
+    return hmm_vit_eval_batch(allphs->active, allphs->n_active);
 }
 
 static void
 phmm_exit(allphone_search_t * allphs, int32 best)
 {
-    s3cipid_t ci;
     phmm_t *p;
-    int32 th, nf;
+    int32 i, th, nf;
     history_t *h;
     blkarray_list_t *history;
-    bin_mdef_t *mdef;
     int32 curfrm;
-    phmm_t **ci_phmm;
     int32 *ci2lmwid;
 
     th = best + allphs->pbeam;
 
     history = allphs->history;
-    mdef = ps_search_acmod(allphs)->mdef;
     curfrm = allphs->frame;
-    ci_phmm = allphs->ci_phmm;
     ci2lmwid = allphs->ci2lmwid;
 
     nf = curfrm + 1;
 
-    for (ci = 0; ci < mdef->n_ciphone; ci++) {
-        for (p = ci_phmm[(unsigned) ci]; p; p = p->next) {
-            if (hmm_frame(&(p->hmm)) == curfrm) {
+    /* Only the PHMMs evaluated in this frame can be active. */
+    for (i = 0; i < allphs->n_active; i++) {
+        p = (phmm_t *) allphs->active[i];
 
-                if (hmm_bestscore(&(p->hmm)) >= th) {
+        if (hmm_bestscore(&(p->hmm)) >= th) {
 
-                    h = (history_t *) ckd_calloc(1, sizeof(*h));
-                    h->ef = curfrm;
-                    h->phmm = p;
-                    h->hist = hmm_out_history(&(p->hmm));
-                    h->score = hmm_out_score(&(p->hmm));
+            h = (history_t *) ckd_calloc(1, sizeof(*h));
+            h->ef = curfrm;
+            h->phmm = p;
+            h->hist = hmm_out_history(&(p->hmm));
+            h->score = hmm_out_score(&(p->hmm));
 
-                    if (!allphs->lm) {
-                        h->tscore = allphs->inspen;
+            if (!allphs->lm) {
+                h->tscore = allphs->inspen;
+            }
+            else {
+                if (h->hist > 0) {
+                    int32 n_used;
+                    history_t *pred =
+                        blkarray_list_get(history, h->hist);
+
+                    if (pred->hist > 0) {
+                        history_t *pred_pred =
+                            blkarray_list_get(history,
+                                              h->hist);
+                        h->tscore =
+                            ngram_tg_score(allphs->lm,
+                                           ci2lmwid
+                                           [pred_pred->phmm->ci],
+                                           ci2lmwid[pred->
+                                                    phmm->ci],
+                                           ci2lmwid[p->ci],
+                                           &n_used) >>
+                            SENSCR_SHIFT;
                     }
                     else {
-                        if (h->hist > 0) {
-                            int32 n_used;
-                            history_t *pred =
-                                blkarray_list_get(history, h->hist);
-
-                            if (pred->hist > 0) {
-                                history_t *pred_pred =
-                                    blkarray_list_get(history,
-                                                      h->hist);
-                                h->tscore =
-                                    ngram_tg_score(allphs->lm,
-                                                   ci2lmwid
-                                                   [pred_pred->phmm->ci],
-                                                   ci2lmwid[pred->
-                                                            phmm->ci],
-                                                   ci2lmwid[p->ci],
-                                                   &n_used) >>
-                                    SENSCR_SHIFT;
-                            }
-                            else {
-                                h->tscore =
-                                    ngram_bg_score(allphs->lm,
-                                                   ci2lmwid
-                                                   [pred->phmm->ci],
-                                                   ci2lmwid[p->ci],
-                                                   &n_used) >>
-                                    SENSCR_SHIFT;
-                            }
-                        }
-                        else {
-                            /*
-                             * This is the beginning SIL and in srch_allphone_begin()
-                             * it's inscore is set to 0.
-                             */
-                            h->tscore = 0;
-                        }
+                        h->tscore =
+                            ngram_bg_score(allphs->lm,
+                                           ci2lmwid
+                                           [pred->phmm->ci],
+                                           ci2lmwid[p->ci],
+                                           &n_used) >>
+                            SENSCR_SHIFT;
                     }
-
-                    blkarray_list_append(history, h);
-
-                    /* Mark PHMM active in next frame */
-                    hmm_frame(&(p->hmm)) = nf;
                 }
                 else {
-                    /* Reset state scores */
-                    hmm_clear(&(p->hmm));
+                    /*
+                     * This is the beginning SIL and in srch_allphone_begin()
+                     * it's inscore is set to 0.
+                     */
+                    h->tscore = 0;
                 }
             }
+
+            blkarray_list_append(history, h);
+
+            /* Mark PHMM active in next frame */
+            hmm_frame(&(p->hmm)) = nf;
+        }
+        else {
+            /* Reset state scores */
+            hmm_clear(&(p->hmm));
         }
     }
 }
@@ -607,6 +605,23 @@ allphone_search_init(const char *name,
     return (ps_search_t *) allphs;
 }
 
+static ps_search_t *
+allphone_search_clone(ps_search_t * search, acmod_t * acmod, dict_t * dict)
+{
+    allphone_search_t *allphs = (allphone_search_t *) search;
+    ngram_model_t *lm = NULL;
+    ps_search_t *clone;
+
+    /* The phone N-Grams are shared, not their caches. */
+    if (allphs->lm && (lm = ngram_model_clone(allphs->lm)) == NULL)
+        return NULL;
+    clone = allphone_search_init(ps_search_name(search), lm,
+                                 ps_search_config(search), acmod, dict,
+                                 ps_search_dict2pid(search));
+    ngram_model_free(lm);
+    return clone;
+}
+
 int
 allphone_search_reinit(ps_search_t * search, dict_t * dict,
                        dict2pid_t * d2p)
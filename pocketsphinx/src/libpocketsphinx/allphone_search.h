@@ -114,6 +114,8 @@ typedef struct allphone_search_s {
     ngram_model_t *lm;        /**< Ngram model set */
     int32 ci_only; 	      /**< Use context-independent phones for decoding */
     phmm_t **ci_phmm;         /**< PHMM lists (for each CI phone) */
+    hmm_t **active;           /**< PHMMs evaluated in current frame */
+    int32 n_phmm, n_active;
     int32 *ci2lmwid;          /**< Mapping of CI phones to LM word IDs */
 
     int32 beam, pbeam;        /**< Effective beams after applying beam_factor */
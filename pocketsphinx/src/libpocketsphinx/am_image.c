@@ -0,0 +1,525 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file am_image.c
+ * @brief Precompiled, memory-mappable images of continuous acoustic models.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* SphinxBase headers. */
+#include <sphinxbase/bio.h>
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/fixpoint.h>
+#include <sphinxbase/strfuncs.h>
+
+/* Local headers. */
+#include "am_image.h"
+
+#define AM_IMAGE_VERSION "1.0"
+/* Alignment of each array in the image. */
+#define AM_IMAGE_ALIGN 32
+#define AM_IMAGE_PAD(n) (((n) + AM_IMAGE_ALIGN - 1) & ~(size_t)(AM_IMAGE_ALIGN - 1))
+
+#ifdef FIXED_POINT
+#define AM_IMAGE_MFCC "fixed"
+#else
+#define AM_IMAGE_MFCC "float"
+#endif
+
+/* Dimensions at the start of the image, followed by the feature
+ * lengths. */
+enum {
+    AM_IMAGE_N_MGAU,
+    AM_IMAGE_N_FEAT,
+    AM_IMAGE_N_DENSITY,
+    AM_IMAGE_N_SEN,
+    AM_IMAGE_N_GAUDEN,
+    AM_IMAGE_N_CW,
+    AM_IMAGE_N_TMAT,
+    AM_IMAGE_N_STATE,
+    AM_IMAGE_N_DIMS
+};
+
+struct am_image_s {
+    int refcount;
+    mmio_file_t *filemap;  /**< Memory map of the file, or NULL. */
+    char *buf;             /**< Contents, if not memory-mapped. */
+    char *data;            /**< Start of the arrays. */
+    int32 dims[AM_IMAGE_N_DIMS];
+    int32 *featlen;
+    float32 mixwfloor;
+    /* Offsets of the arrays from data, and the end of the last. */
+    size_t mean_off, var_off, det_off, mgau_off, pdf_off, tp_off, end;
+};
+
+/**
+ * Compute the offsets of the arrays in an image from its dimensions.
+ */
+static void
+am_image_layout(am_image_t *img)
+{
+    int32 const *d = img->dims;
+    size_t blk;
+    int32 f;
+
+    for (f = 0, blk = 0; f < d[AM_IMAGE_N_FEAT]; ++f)
+        blk += img->featlen[f];
+    img->mean_off = AM_IMAGE_PAD((AM_IMAGE_N_DIMS + d[AM_IMAGE_N_FEAT])
+                                 * sizeof(int32));
+    img->var_off = AM_IMAGE_PAD(img->mean_off + (size_t)d[AM_IMAGE_N_MGAU]
+                                * d[AM_IMAGE_N_DENSITY] * blk * sizeof(mfcc_t));
+    img->det_off = AM_IMAGE_PAD(img->var_off + img->var_off - img->mean_off);
+    img->mgau_off = AM_IMAGE_PAD(img->det_off + (size_t)d[AM_IMAGE_N_MGAU]
+                                 * d[AM_IMAGE_N_FEAT] * d[AM_IMAGE_N_DENSITY]
+                                 * sizeof(mfcc_t));
+    img->pdf_off = AM_IMAGE_PAD(img->mgau_off
+                                + (size_t)d[AM_IMAGE_N_SEN] * sizeof(uint32));
+    img->tp_off = AM_IMAGE_PAD(img->pdf_off + (size_t)d[AM_IMAGE_N_SEN]
+                               * d[AM_IMAGE_N_FEAT] * d[AM_IMAGE_N_CW]
+                               * sizeof(senprob_t));
+    img->end = img->tp_off + (size_t)d[AM_IMAGE_N_TMAT] * d[AM_IMAGE_N_STATE]
+        * (d[AM_IMAGE_N_STATE] + 1) * sizeof(uint8);
+}
+
+/**
+ * Check a floating-point parameter in the header against config.
+ */
+static int
+am_image_check_float(char const *file, char const *name, char const *val,
+                     cmd_ln_t *config)
+{
+    char *arg = string_join("-", name, NULL);
+    float32 want = cmd_ln_float32_r(config, arg);
+    int rv = 0;
+
+    if ((float32)atof_c(val) != want) {
+        E_WARN("%s was built with %s %s, not %g\n", file, arg, val, want);
+        rv = -1;
+    }
+    ckd_free(arg);
+    return rv;
+}
+
+am_image_t *
+am_image_read(cmd_ln_t *config, char const *file)
+{
+    static char const *floats[] = {
+        "logbase", "varfloor", "mixwfloor", "tmatfloor", NULL
+    };
+    am_image_t *img;
+    FILE *fp;
+    char **argname, **argval;
+    int32 byteswap, i, j, n_found, do_mmap;
+    long pos, size;
+
+    E_INFO("Reading acoustic model image: %s\n", file);
+    if ((fp = fopen(file, "rb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open file '%s' for reading", file);
+        return NULL;
+    }
+    if (bio_readhdr(fp, &argname, &argval, &byteswap) < 0) {
+        E_ERROR("Failed to read header from file '%s'\n", file);
+        fclose(fp);
+        return NULL;
+    }
+    img = ckd_calloc(1, sizeof(*img));
+    img->refcount = 1;
+
+    /* The parameters have to be used as they are. */
+    n_found = 0;
+    if (byteswap) {
+        E_WARN("%s was built on a machine with the other byte order\n", file);
+        goto error_out;
+    }
+    for (i = 0; argname[i]; i++) {
+        if (strcmp(argname[i], "version") == 0) {
+            if (strcmp(argval[i], AM_IMAGE_VERSION) != 0) {
+                E_WARN("Version mismatch(%s): %s, expecting %s\n",
+                       file, argval[i], AM_IMAGE_VERSION);
+                goto error_out;
+            }
+        }
+        else if (strcmp(argname[i], "mfcc") == 0) {
+            if (strcmp(argval[i], AM_IMAGE_MFCC) != 0) {
+                E_WARN("%s was built for %s-point features, not "
+                       AM_IMAGE_MFCC "\n", file, argval[i]);
+                goto error_out;
+            }
+            ++n_found;
+        }
+        else if (strcmp(argname[i], "senscr_shift") == 0) {
+            if (atoi(argval[i]) != SENSCR_SHIFT) {
+                E_WARN("%s was built with senone score shift %s, not %d\n",
+                       file, argval[i], SENSCR_SHIFT);
+                goto error_out;
+            }
+            ++n_found;
+        }
+        else {
+            for (j = 0; floats[j]; ++j)
+                if (strcmp(argname[i], floats[j]) == 0)
+                    break;
+            if (floats[j] == NULL)
+                continue;
+            if (am_image_check_float(file, floats[j], argval[i], config) < 0)
+                goto error_out;
+            if (strcmp(floats[j], "mixwfloor") == 0)
+                img->mixwfloor = atof_c(argval[i]);
+            ++n_found;
+        }
+    }
+    if (n_found != 6) {
+        E_ERROR("%s is missing some of its parameters\n", file);
+        goto error_out;
+    }
+    bio_hdrarg_free(argname, argval);
+    argname = argval = NULL;
+
+    /* Arrays are aligned from the end of the header. */
+    pos = AM_IMAGE_PAD(ftell(fp));
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp) - pos;
+    if (size < (long)(AM_IMAGE_N_DIMS * sizeof(int32))) {
+        E_ERROR("%s is truncated\n", file);
+        goto error_out;
+    }
+
+    do_mmap = cmd_ln_boolean_r(config, "-mmap");
+    if (do_mmap && (img->filemap = mmio_file_read(file)) != NULL) {
+        img->data = (char *)mmio_file_ptr(img->filemap) + pos;
+        if (cmd_ln_boolean_r(config, "-hugepages"))
+            mmio_file_hugepages(img->filemap);
+    }
+    else {
+        img->buf = ckd_malloc(size);
+        /* Before it is touched, so that it is faulted in that way. */
+        if (cmd_ln_boolean_r(config, "-hugepages"))
+            mmio_hugepages(img->buf, size);
+        if (fseek(fp, pos, SEEK_SET) < 0
+            || fread(img->buf, 1, size, fp) != (size_t)size) {
+            E_ERROR_SYSTEM("Failed to read %s", file);
+            goto error_out;
+        }
+        img->data = img->buf;
+    }
+    fclose(fp);
+    fp = NULL;
+
+    memcpy(img->dims, img->data, sizeof(img->dims));
+    for (i = 0; i < AM_IMAGE_N_DIMS; ++i) {
+        if (img->dims[i] <= 0) {
+            E_ERROR("Bad dimensions in %s\n", file);
+            goto error_out;
+        }
+    }
+    if ((long)((AM_IMAGE_N_DIMS + img->dims[AM_IMAGE_N_FEAT]) * sizeof(int32))
+        > size) {
+        E_ERROR("%s is truncated\n", file);
+        goto error_out;
+    }
+    img->featlen = (int32 *)img->data + AM_IMAGE_N_DIMS;
+    am_image_layout(img);
+    if ((long)img->end > size) {
+        E_ERROR("%s is truncated: %ld bytes, expected %ld\n",
+                file, (long)(size + pos), (long)(img->end + pos));
+        goto error_out;
+    }
+    E_INFO("%d codebooks, %d senones, %d transition matrices %s\n",
+           img->dims[AM_IMAGE_N_MGAU], img->dims[AM_IMAGE_N_SEN],
+           img->dims[AM_IMAGE_N_TMAT],
+           img->filemap ? "mapped" : "read");
+    return img;
+
+error_out:
+    if (argname)
+        bio_hdrarg_free(argname, argval);
+    if (fp)
+        fclose(fp);
+    am_image_free(img);
+    return NULL;
+}
+
+am_image_t *
+am_image_retain(am_image_t *img)
+{
+    ++img->refcount;
+    return img;
+}
+
+int
+am_image_free(am_image_t *img)
+{
+    if (img == NULL)
+        return 0;
+    if (--img->refcount > 0)
+        return img->refcount;
+    if (img->filemap)
+        mmio_file_unmap(img->filemap);
+    ckd_free(img->buf);
+    ckd_free(img);
+    return 0;
+}
+
+size_t
+am_image_mem_size(am_image_t *img, size_t *out_mapped)
+{
+    size_t size;
+
+    size = sizeof(*img);
+    if (img->filemap)
+        *out_mapped += img->end;
+    else
+        size += img->end;
+    return size;
+}
+
+/**
+ * Point a [codebook][feature][codeword] array of vectors into an image.
+ */
+static mfcc_t ****
+am_image_gauden_param(am_image_t *img, size_t off)
+{
+    mfcc_t ****out;
+    mfcc_t *buf;
+    int32 i, j, k;
+
+    out = (mfcc_t ****)ckd_calloc_3d(img->dims[AM_IMAGE_N_MGAU],
+                                     img->dims[AM_IMAGE_N_FEAT],
+                                     img->dims[AM_IMAGE_N_DENSITY],
+                                     sizeof(mfcc_t *));
+    buf = (mfcc_t *)(img->data + off);
+    for (i = 0; i < img->dims[AM_IMAGE_N_MGAU]; i++) {
+        for (j = 0; j < img->dims[AM_IMAGE_N_FEAT]; j++) {
+            for (k = 0; k < img->dims[AM_IMAGE_N_DENSITY]; k++) {
+                out[i][j][k] = buf;
+                buf += img->featlen[j];
+            }
+        }
+    }
+    return out;
+}
+
+gauden_t *
+am_image_gauden(am_image_t *img, logmath_t *lmath)
+{
+    gauden_t *g;
+
+    g = ckd_calloc(1, sizeof(*g));
+    g->refcount = 1;
+    g->lmath = lmath;
+    g->image = am_image_retain(img);
+    g->n_mgau = img->dims[AM_IMAGE_N_MGAU];
+    g->n_feat = img->dims[AM_IMAGE_N_FEAT];
+    g->n_density = img->dims[AM_IMAGE_N_DENSITY];
+    g->featlen = ckd_calloc(g->n_feat, sizeof(*g->featlen));
+    memcpy(g->featlen, img->featlen, g->n_feat * sizeof(*g->featlen));
+    g->mean = am_image_gauden_param(img, img->mean_off);
+    g->var = am_image_gauden_param(img, img->var_off);
+    g->det = ckd_alloc_3d_ptr(g->n_mgau, g->n_feat, g->n_density,
+                              img->data + img->det_off, sizeof(mfcc_t));
+    return g;
+}
+
+senone_t *
+am_image_senone(am_image_t *img, logmath_t *lmath)
+{
+    senone_t *s;
+
+    s = ckd_calloc(1, sizeof(*s));
+    s->refcount = 1;
+    s->image = am_image_retain(img);
+    s->lmath = logmath_init(logmath_get_base(lmath), SENSCR_SHIFT, TRUE);
+    s->n_sen = img->dims[AM_IMAGE_N_SEN];
+    s->n_feat = img->dims[AM_IMAGE_N_FEAT];
+    s->n_cw = img->dims[AM_IMAGE_N_CW];
+    s->n_gauden = img->dims[AM_IMAGE_N_GAUDEN];
+    s->mixwfloor = img->mixwfloor;
+    /* See senone_mixw_read() for the two layouts. */
+    if (s->n_gauden > 1)
+        s->pdf = ckd_alloc_3d_ptr(s->n_sen, s->n_feat, s->n_cw,
+                                  img->data + img->pdf_off, sizeof(senprob_t));
+    else
+        s->pdf = ckd_alloc_3d_ptr(s->n_feat, s->n_cw, s->n_sen,
+                                  img->data + img->pdf_off, sizeof(senprob_t));
+    s->mgau = (uint32 *)(img->data + img->mgau_off);
+    return s;
+}
+
+tmat_t *
+am_image_tmat(am_image_t *img)
+{
+    tmat_t *t;
+
+    t = ckd_calloc(1, sizeof(*t));
+    t->refcount = 1;
+    t->image = am_image_retain(img);
+    t->n_tmat = img->dims[AM_IMAGE_N_TMAT];
+    t->n_state = img->dims[AM_IMAGE_N_STATE];
+    t->tp = ckd_alloc_3d_ptr(t->n_tmat, t->n_state, t->n_state + 1,
+                             img->data + img->tp_off, sizeof(uint8));
+    return t;
+}
+
+/**
+ * Write zeros up to the given offset from the start of the arrays.
+ */
+static int
+am_image_pad(FILE *fp, long start, size_t off)
+{
+    long pos = ftell(fp);
+
+    while (pos < start + (long)off) {
+        if (fputc(0, fp) == EOF)
+            return -1;
+        ++pos;
+    }
+    return 0;
+}
+
+int
+am_image_write(char const *file, gauden_t *g, senone_t *s, tmat_t *t,
+               cmd_ln_t *config)
+{
+    am_image_t img;
+    FILE *fp;
+    char logbase[32], varfloor[32], mixwfloor[32], tmatfloor[32], shift[16];
+    size_t blk;
+    long start;
+    int32 m, f, d, i;
+
+    if (g->mean == NULL) {
+        E_ERROR("Quantized codebooks cannot be written to an image\n");
+        return -1;
+    }
+    if (s->n_feat != g->n_feat || s->n_cw != g->n_density) {
+        E_ERROR("Senones do not match codebooks\n");
+        return -1;
+    }
+    if ((fp = fopen(file, "wb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open file '%s' for writing", file);
+        return -1;
+    }
+    E_INFO("Writing acoustic model image: %s\n", file);
+    sprintf(logbase, "%.9g", cmd_ln_float32_r(config, "-logbase"));
+    sprintf(varfloor, "%.9g", cmd_ln_float32_r(config, "-varfloor"));
+    sprintf(mixwfloor, "%.9g", cmd_ln_float32_r(config, "-mixwfloor"));
+    sprintf(tmatfloor, "%.9g", cmd_ln_float32_r(config, "-tmatfloor"));
+    sprintf(shift, "%d", SENSCR_SHIFT);
+    if (bio_writehdr(fp, "version", AM_IMAGE_VERSION,
+                     "mfcc", AM_IMAGE_MFCC,
+                     "senscr_shift", shift,
+                     "logbase", logbase,
+                     "varfloor", varfloor,
+                     "mixwfloor", mixwfloor,
+                     "tmatfloor", tmatfloor, NULL) < 0)
+        goto error_out;
+    start = AM_IMAGE_PAD(ftell(fp));
+    if (am_image_pad(fp, start, 0) < 0)
+        goto error_out;
+
+    memset(&img, 0, sizeof(img));
+    img.dims[AM_IMAGE_N_MGAU] = g->n_mgau;
+    img.dims[AM_IMAGE_N_FEAT] = g->n_feat;
+    img.dims[AM_IMAGE_N_DENSITY] = g->n_density;
+    img.dims[AM_IMAGE_N_SEN] = s->n_sen;
+    img.dims[AM_IMAGE_N_GAUDEN] = s->n_gauden;
+    img.dims[AM_IMAGE_N_CW] = s->n_cw;
+    img.dims[AM_IMAGE_N_TMAT] = t->n_tmat;
+    img.dims[AM_IMAGE_N_STATE] = t->n_state;
+    img.featlen = g->featlen;
+    am_image_layout(&img);
+    if (fwrite(img.dims, sizeof(int32), AM_IMAGE_N_DIMS, fp)
+        != AM_IMAGE_N_DIMS
+        || fwrite(g->featlen, sizeof(int32), g->n_feat, fp)
+        != (size_t)g->n_feat)
+        goto error_out;
+
+    /* Means and precomputed variances are each in one block, as
+     * allocated by gauden_param_read(). */
+    for (f = 0, blk = 0; f < g->n_feat; ++f)
+        blk += g->featlen[f];
+    if (am_image_pad(fp, start, img.mean_off) < 0
+        || fwrite(g->mean[0][0][0], sizeof(mfcc_t),
+                  g->n_mgau * g->n_density * blk, fp)
+        != g->n_mgau * g->n_density * blk
+        || am_image_pad(fp, start, img.var_off) < 0
+        || fwrite(g->var[0][0][0], sizeof(mfcc_t),
+                  g->n_mgau * g->n_density * blk, fp)
+        != g->n_mgau * g->n_density * blk
+        || am_image_pad(fp, start, img.det_off) < 0)
+        goto error_out;
+    for (m = 0; m < g->n_mgau; ++m)
+        for (f = 0; f < g->n_feat; ++f)
+            if (fwrite(g->det[m][f], sizeof(mfcc_t), g->n_density, fp)
+                != (size_t)g->n_density)
+                goto error_out;
+
+    if (am_image_pad(fp, start, img.mgau_off) < 0
+        || fwrite(s->mgau, sizeof(uint32), s->n_sen, fp) != s->n_sen
+        || am_image_pad(fp, start, img.pdf_off) < 0)
+        goto error_out;
+    if (s->n_gauden > 1) {
+        for (i = 0; i < s->n_sen; ++i)
+            for (f = 0; f < s->n_feat; ++f)
+                if (fwrite(s->pdf[i][f], sizeof(senprob_t), s->n_cw, fp)
+                    != s->n_cw)
+                    goto error_out;
+    }
+    else {
+        for (f = 0; f < s->n_feat; ++f)
+            for (d = 0; d < s->n_cw; ++d)
+                if (fwrite(s->pdf[f][d], sizeof(senprob_t), s->n_sen, fp)
+                    != s->n_sen)
+                    goto error_out;
+    }
+
+    if (am_image_pad(fp, start, img.tp_off) < 0)
+        goto error_out;
+    for (i = 0; i < t->n_tmat; ++i)
+        for (f = 0; f < t->n_state; ++f)
+            if (fwrite(t->tp[i][f], sizeof(uint8), t->n_state + 1, fp)
+                != (size_t)t->n_state + 1)
+                goto error_out;
+
+    fclose(fp);
+    return 0;
+
+error_out:
+    E_ERROR_SYSTEM("Failed to write '%s'", file);
+    fclose(fp);
+    return -1;
+}
@@ -0,0 +1,136 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file am_image.h
+ * @brief Precompiled, memory-mappable images of continuous acoustic models.
+ *
+ * Loading a continuous model from its SphinxTrain files means reading
+ * means, variances and mixture weights one after another, applying
+ * floors, precomputing the Gaussian normalization terms and
+ * converting everything to the log domain of the decoder.  An image
+ * holds the result of all of that for the transition matrices,
+ * Gaussians and senones, in native byte order, with each array
+ * aligned, so that it can be memory-mapped and used in place.
+ *
+ * Since the contents depend on the log base, the floors and the
+ * representation of features, these are stored in the header and
+ * checked when the image is loaded.  The model definition is not
+ * included, as the binary format written by
+ * pocketsphinx_mdef_convert can already be used in place.
+ */
+
+#ifndef __AM_IMAGE_H__
+#define __AM_IMAGE_H__
+
+/* SphinxBase headers. */
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/logmath.h>
+#include <sphinxbase/mmio.h>
+
+/* Local headers. */
+#include "ms_gauden.h"
+#include "ms_senone.h"
+#include "tmat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Acoustic model image, read or mapped into memory.
+ *
+ * Parameters created with am_image_gauden(), am_image_senone() and
+ * am_image_tmat() point into it and hold a reference to it.
+ */
+typedef struct am_image_s am_image_t;
+
+/**
+ * Open an acoustic model image.
+ *
+ * It is memory-mapped unless -mmap is off in config.
+ *
+ * @return the image, or NULL if it could not be read or does not
+ *         match the -logbase, -varfloor, -mixwfloor and -tmatfloor
+ *         of config.
+ */
+am_image_t *am_image_read(cmd_ln_t *config, char const *file);
+
+/**
+ * Retain a pointer to an image.
+ */
+am_image_t *am_image_retain(am_image_t *img);
+
+/**
+ * Release a pointer to an image, unmapping it if it was the last one.
+ */
+int am_image_free(am_image_t *img);
+
+/**
+ * Get the number of bytes of heap memory used by an image, adding
+ * those of its memory map, if any, to *out_mapped.
+ */
+size_t am_image_mem_size(am_image_t *img, size_t *out_mapped);
+
+/**
+ * Get the Gaussians of an image.
+ */
+gauden_t *am_image_gauden(am_image_t *img, logmath_t *lmath);
+
+/**
+ * Get the senones of an image.
+ */
+senone_t *am_image_senone(am_image_t *img, logmath_t *lmath);
+
+/**
+ * Get the transition matrices of an image.
+ */
+tmat_t *am_image_tmat(am_image_t *img);
+
+/**
+ * Write an acoustic model image.
+ *
+ * @param g Gaussians from gauden_init() (quantized ones are not supported).
+ * @param s Senones from senone_init() for g.
+ * @param t Transition matrices from tmat_init().
+ * @param config Configuration the parameters were loaded with, which
+ *               provides -logbase, -varfloor, -mixwfloor and -tmatfloor.
+ * @return 0 for success, <0 on error.
+ */
+int am_image_write(char const *file, gauden_t *g, senone_t *s, tmat_t *t,
+                   cmd_ln_t *config);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __AM_IMAGE_H__ */
@@ -62,6 +62,19 @@
 #include "mdef.h"
 #include "bin_mdef.h"
 
+/* Index of a context in the phone ID table. */
+#define PID_MAP_IDX(m,wpos,ci,lc,rc)                                    \
+    ((((wpos) * (m)->n_ciphone + (ci)) * (m)->n_ciphone + (lc))         \
+     * (m)->n_ciphone + (rc))
+
+static void bin_mdef_init_pid_map(bin_mdef_t *m);
+
+static size_t
+pid_map_size(bin_mdef_t *m)
+{
+    return (size_t)N_WORD_POSN * m->n_ciphone * m->n_ciphone * m->n_ciphone;
+}
+
 bin_mdef_t *
 bin_mdef_read_text(cmd_ln_t *config, const char *filename)
 {
@@ -258,6 +271,7 @@ bin_mdef_read_text(cmd_ln_t *config, const char *filename)
     mdef_free(mdef);
 
     bmdef->alloc_mode = BIN_MDEF_FROM_TEXT;
+    bin_mdef_init_pid_map(bmdef);
     return bmdef;
 }
 
@@ -293,12 +307,36 @@ bin_mdef_free(bin_mdef_t * m)
         mmio_file_unmap(m->filemap);
     ckd_free(m->cd2cisen);
     ckd_free(m->sen2cimap);
+    ckd_free(m->pid_map);
     ckd_free(m->ciname);
     ckd_free(m->sseq);
     ckd_free(m);
     return 0;
 }
 
+size_t
+bin_mdef_mem_size(bin_mdef_t * m, size_t * out_mapped)
+{
+    size_t heap, tables;
+    int32 i;
+
+    heap = sizeof(*m) + m->n_ciphone * sizeof(*m->ciname)
+        + m->n_sseq * sizeof(*m->sseq)
+        + m->n_sen * (sizeof(*m->cd2cisen) + sizeof(*m->sen2cimap));
+    if (m->pid_map)
+        heap += pid_map_size(m) * sizeof(*m->pid_map);
+    tables = m->n_phone * sizeof(*m->phone)
+        + m->n_cd_tree * sizeof(*m->cd_tree)
+        + m->n_sseq * m->n_emit_state * sizeof(**m->sseq);
+    for (i = 0; i < m->n_ciphone; ++i)
+        tables += strlen(m->ciname[i]) + 1;
+    if (m->alloc_mode == BIN_MDEF_ON_DISK)
+        *out_mapped += tables;
+    else
+        heap += tables;
+    return heap;
+}
+
 static const char format_desc[] =
     "BEGIN FILE FORMAT DESCRIPTION\n"
     "int32 n_ciphone;    /**< Number of base (CI) phones */\n"
@@ -515,6 +553,7 @@ bin_mdef_read(cmd_ln_t *config, const char *filename)
          m->n_ciphone, m->n_phone - m->n_ciphone, m->n_emit_state,
          m->n_ci_sen, m->n_sen, m->n_sseq);
     fclose(fh);
+    bin_mdef_init_pid_map(m);
     return m;
 }
 
@@ -760,6 +799,11 @@ bin_mdef_phone_id(bin_mdef_t * m, int32 ci, int32 lc, int32 rc, int32 wpos)
     assert((rc >= 0) && (rc < m->n_ciphone));
     assert((wpos >= 0) && (wpos < N_WORD_POSN));
 
+    if (m->pid_map) {
+        int32 pid = m->pid_map[PID_MAP_IDX(m, wpos, ci, lc, rc)];
+        return pid < 0 ? -1 : pid;
+    }
+
     /* Create a context list, mapping fillers to silence. */
     ctx[0] = wpos;
     ctx[1] = ci;
@@ -810,23 +854,15 @@ bin_mdef_phone_id(bin_mdef_t * m, int32 ci, int32 lc, int32 rc, int32 wpos)
     return -1;
 }
 
-int
-bin_mdef_phone_id_nearest(bin_mdef_t * m, int32 b, int32 l, int32 r, int32 pos)
+/**
+ * Find the closest phone to a triphone which is not in the model.
+ */
+static int
+bin_mdef_phone_id_backoff(bin_mdef_t * m, int32 b, int32 l, int32 r, int32 pos)
 {
     int p, tmppos;
 
-
-
-    /* In the future, we might back off when context is not available,
-     * but for now we'll just return the CI phone. */
-    if (l < 0 || r < 0)
-        return b;
-
-    p = bin_mdef_phone_id(m, b, l, r, pos);
-    if (p >= 0)
-        return p;
-
-    /* Exact triphone not found; backoff to other word positions */
+    /* Backoff to other word positions */
     for (tmppos = 0; tmppos < N_WORD_POSN; tmppos++) {
         if (tmppos != pos) {
             p = bin_mdef_phone_id(m, b, l, r, tmppos);
@@ -864,6 +900,103 @@ bin_mdef_phone_id_nearest(bin_mdef_t * m, int32 b, int32 l, int32 r, int32 pos)
     return b;
 }
 
+int
+bin_mdef_phone_id_nearest(bin_mdef_t * m, int32 b, int32 l, int32 r, int32 pos)
+{
+    int p;
+
+    /* In the future, we might back off when context is not available,
+     * but for now we'll just return the CI phone. */
+    if (l < 0 || r < 0)
+        return b;
+
+    if (m->pid_map) {
+        p = m->pid_map[PID_MAP_IDX(m, pos, b, l, r)];
+        return p < 0 ? -1 - p : p;
+    }
+
+    p = bin_mdef_phone_id(m, b, l, r, pos);
+    if (p >= 0)
+        return p;
+    return bin_mdef_phone_id_backoff(m, b, l, r, pos);
+}
+
+/**
+ * Enter the phone IDs under a node of the CD tree into the table.
+ */
+static void
+pid_map_fill(bin_mdef_t *m, cd_tree_t const *node, int level, size_t idx)
+{
+    size_t span;
+    int i;
+
+    if (node->ctx < 0
+        || node->ctx >= (level == 0 ? N_WORD_POSN : m->n_ciphone))
+        return;
+    idx = idx * m->n_ciphone + node->ctx;
+    if (node->n_down == 0) {
+        /* A leaf above the bottom stands for all contexts below it. */
+        for (span = 1, i = level; i < 3; ++i)
+            span *= m->n_ciphone;
+        for (i = 0; i < (int)span; ++i)
+            m->pid_map[idx * span + i] = node->c.pid;
+        return;
+    }
+    if (level == 3)
+        return;
+    for (i = 0; i < node->n_down; ++i)
+        pid_map_fill(m, m->cd_tree + node->c.down + i, level + 1, idx);
+}
+
+/**
+ * Build the table of phone IDs by context, so that neither exact nor
+ * nearest lookups have to search the CD tree.
+ */
+static void
+bin_mdef_init_pid_map(bin_mdef_t *m)
+{
+    size_t i, n = pid_map_size(m);
+    int32 wpos, b, l, r;
+
+    if (n > BIN_MDEF_MAX_PID_MAP) {
+        E_INFO("Too many CI phones (%d) for phone ID table, "
+               "will search CD tree\n", m->n_ciphone);
+        return;
+    }
+    /* Exact phone IDs, with fillers mapped to silence as the tree
+     * walk does.  The contexts they map to map to themselves, so
+     * they can be copied in place. */
+    m->pid_map = ckd_malloc(n * sizeof(*m->pid_map));
+    for (i = 0; i < n; ++i)
+        m->pid_map[i] = -1;
+    for (wpos = 0; wpos < N_WORD_POSN; ++wpos)
+        pid_map_fill(m, m->cd_tree + wpos, 0, 0);
+    if (m->sil >= 0) {
+        for (wpos = 0; wpos < N_WORD_POSN; ++wpos)
+            for (b = 0; b < m->n_ciphone; ++b)
+                for (l = 0; l < m->n_ciphone; ++l)
+                    for (r = 0; r < m->n_ciphone; ++r) {
+                        int32 ml = m->phone[l].info.ci.filler ? m->sil : l;
+                        int32 mr = m->phone[r].info.ci.filler ? m->sil : r;
+                        m->pid_map[PID_MAP_IDX(m, wpos, b, l, r)]
+                            = m->pid_map[PID_MAP_IDX(m, wpos, b, ml, mr)];
+                    }
+    }
+    /* Then the nearest ones where there are none.  The backoff only
+     * looks at exact phone IDs, which are still the non-negative
+     * entries. */
+    for (wpos = 0; wpos < N_WORD_POSN; ++wpos)
+        for (b = 0; b < m->n_ciphone; ++b)
+            for (l = 0; l < m->n_ciphone; ++l)
+                for (r = 0; r < m->n_ciphone; ++r) {
+                    int32 *pid = m->pid_map + PID_MAP_IDX(m, wpos, b, l, r);
+                    if (*pid < 0)
+                        *pid = -1 - bin_mdef_phone_id_backoff(m, b, l, r, wpos);
+                }
+    E_INFO("Allocated %d KiB for phone ID table\n",
+           (int)(n * sizeof(*m->pid_map) / 1024));
+}
+
 int
 bin_mdef_phone_str(bin_mdef_t * m, int pid, char *buf)
 {
@@ -97,6 +97,13 @@ struct mdef_entry_s {
  */
 #define BAD_SENID 0xffff
 
+/**
+ * Largest number of entries in the table of phone IDs by context
+ * (see bin_mdef_t::pid_map).  Models with too many CI phones for it
+ * look up CD phones in the tree instead.
+ */
+#define BIN_MDEF_MAX_PID_MAP (1 << 20)
+
 /**
  * Node in CD phone tree (on-disk, 8 bytes).
  */
@@ -134,9 +141,13 @@ struct bin_mdef_s {
 	uint16 **sseq;       /**< Unique senone sequences (2D array built at load time) */
 	uint8 *sseq_len;     /**< Number of states in each sseq (NULL for homogeneous) */
 
-	/* These two are not stored on disk, but are generated at load time. */
+	/* These are not stored on disk, but are generated at load time. */
 	int16 *cd2cisen;	/**< Parent CI-senone id for each senone */
 	int16 *sen2cimap;	/**< Parent CI-phone for each senone (CI or CD) */
+	int32 *pid_map;		/**< Phone ID for each word position, base phone,
+				   left and right context, or -1 minus the
+				   nearest one if there is none (NULL if too
+				   many CI phones) */
 
 	/** Allocation mode for this object. */
 	enum { BIN_MDEF_FROM_TEXT, BIN_MDEF_IN_MEMORY, BIN_MDEF_ON_DISK } alloc_mode;
@@ -191,6 +202,13 @@ bin_mdef_t *bin_mdef_retain(bin_mdef_t *m);
  */
 int bin_mdef_free(bin_mdef_t *m);
 
+/**
+ * Get the number of bytes of heap memory used by a binary mdef,
+ * adding those used in place from a memory-mapped file to
+ * *out_mapped.
+ */
+size_t bin_mdef_mem_size(bin_mdef_t *m, size_t *out_mapped);
+
 /**
  * Context-independent phone lookup.
  * @return phone id for ciphone.
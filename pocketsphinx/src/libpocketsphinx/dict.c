@@ -36,11 +36,14 @@
  */
 
 /* System headers. */
+#include <stdlib.h>
 #include <string.h>
 
 /* SphinxBase headers. */
 #include <sphinxbase/pio.h>
 #include <sphinxbase/strfuncs.h>
+#include <sphinxbase/byteorder.h>
+#include <sphinxbase/case.h>
 
 /* Local headers. */
 #include "dict.h"
@@ -84,6 +87,10 @@ dict_add_word(dict_t * d, char const *word, s3cipid_t const * p, int32 np)
     s3wid_t newwid;
     char *wword;
 
+    if (d->shared) {
+        E_ERROR("Cannot add words to a shared dictionary\n");
+        return BAD_S3WID;
+    }
     if (d->n_word >= d->max_words) {
         E_INFO("Reallocating to %d KiB for word entries\n",
                (d->max_words + S3DICT_INC_SZ) * sizeof(dictword_t) / 1024);
@@ -103,7 +110,7 @@ dict_add_word(dict_t * d, char const *word, s3cipid_t const * p, int32 np)
         int32 w;
 
         /* Truncated to a baseword string; find its ID */
-        if (hash_table_lookup_int32(d->ht, wword, &w) < 0) {
+        if ((w = dict_wordid(d, wword)) == BAD_S3WID) {
             E_ERROR("Missing base word for: %s\n", word);
             ckd_free(wword);
             ckd_free(wordp->word);
@@ -122,6 +129,11 @@ dict_add_word(dict_t * d, char const *word, s3cipid_t const * p, int32 np)
     ckd_free(wword);
 
     /* Associate word string with d->n_word in hash table */
+    if (d->n_bin_word && dict_wordid(d, wordp->word) != BAD_S3WID) {
+        ckd_free(wordp->word);
+        wordp->word = NULL;
+        return BAD_S3WID;
+    }
     if (hash_table_enter_int32(d->ht, wordp->word, d->n_word) != d->n_word) {
         ckd_free(wordp->word);
         wordp->word = NULL;
@@ -217,12 +229,438 @@ dict_read(FILE * fp, dict_t * d)
     return 0;
 }
 
+static const char format_desc[] =
+    "BEGIN FILE FORMAT DESCRIPTION\n"
+    "int32 n_word;       /**< Number of words, including fillers */\n"
+    "int32 filler_start; /**< First filler word id */\n"
+    "int32 filler_end;   /**< Last filler word id */\n"
+    "int32 nocase;       /**< Whether words are case-insensitive */\n"
+    "int32 n_ciphone;    /**< Number of CI phones named below */\n"
+    "int32 n_phone;      /**< Total length of all pronunciations */\n"
+    "int32 n_slot;       /**< Number of perfect hash slots (a power of 2) */\n"
+    "int32 n_bucket;     /**< Number of perfect hash buckets */\n"
+    "int32 seed;         /**< Seed for the perfect hash */\n"
+    "int32 strsize;      /**< Size of word strings */\n"
+    "char ciphones[][];  /**< CI phone strings (null-terminated) */\n"
+    "char padding[];     /**< Padding to a 4-bytes boundary */\n"
+    "int32 word[n_word]; /**< Offset of each word string */\n"
+    "int32 pron[n_word+1]; /**< Offset of each pronunciation */\n"
+    "int32 alt[n_word];  /**< Next alternative pronunciation */\n"
+    "int32 basewid[n_word]; /**< Base pronunciation */\n"
+    "int32 disp[n_bucket]; /**< Displacement for each bucket */\n"
+    "int32 slot[n_slot]; /**< Word id in each slot, -1 if empty */\n"
+    "int16 phones[n_phone]; /**< CI phone ids */\n"
+    "char padding[];     /**< Padding to a 4-bytes boundary */\n"
+    "char words[strsize]; /**< Word strings (null-terminated) */\n"
+    "END FILE FORMAT DESCRIPTION\n";
+
+#define DICT_BIN_N_HEADER 10
+#define DICT_BIN_MAX_SEEDS 8
+#define DICT_BIN_BUCKET_KEYS 4
+
+/*
+ * Hash for the perfect hash index, split into a bucket hash (returned)
+ * and a slot hash.  This is part of the file format, so it does not
+ * depend on the byte order or word size.
+ */
+static uint32
+dict_bin_hash(const char *word, int32 nocase, uint32 seed, uint32 *h2)
+{
+    uint64 h = (seed + 1) * 0x9e3779b97f4a7c15ULL;
+
+    for (; *word; ++word) {
+        unsigned char c = *word;
+        if (nocase)
+            c = UPPER_CASE(c);
+        h = (h ^ c) * 0x100000001b3ULL;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    *h2 = (uint32) h;
+    return (uint32) (h >> 32);
+}
+
+#define dict_bin_bucket(n_bucket, h1) \
+    ((int32) (((uint64) (h1) * (n_bucket)) >> 32))
+#define dict_bin_slot(n_slot, h1, h2, d) \
+    (((h2) + (d) * ((h1) | 1)) & ((n_slot) - 1))
+
+static s3wid_t
+dict_bin_wordid(dict_t *d, const char *word)
+{
+    uint32 h1, h2;
+    int32 w;
+
+    h1 = dict_bin_hash(word, d->nocase, d->bin_seed, &h2);
+    w = d->bin_slot[dict_bin_slot(d->n_bin_slot, h1, h2,
+                                  d->bin_disp[dict_bin_bucket
+                                              (d->n_bin_bucket, h1)])];
+    if (w < 0)
+        return BAD_S3WID;
+    if (d->nocase ? strcmp_nocase(d->word[w].word, word)
+        : strcmp(d->word[w].word, word))
+        return BAD_S3WID;
+    return w;
+}
+
+static int32 *bucket_size_cmp_sizes;
+
+static int
+bucket_size_cmp(const void *a, const void *b)
+{
+    return bucket_size_cmp_sizes[*(const int32 *)b]
+        - bucket_size_cmp_sizes[*(const int32 *)a];
+}
+
+/*
+ * Build a perfect hash ("hash, displace") over all words: each bucket
+ * of about DICT_BIN_BUCKET_KEYS words gets the smallest displacement
+ * which places all of them in free slots, largest buckets first.
+ */
+static int
+dict_bin_index(dict_t *d, int32 n_slot, int32 n_bucket, uint32 seed,
+               int32 *slot, int32 *disp)
+{
+    uint32 *h1, *h2;
+    int32 *start, *size, *order, *keys, *pos;
+    int32 i, j, k, b, n = d->n_word;
+    int rv = -1;
+
+    h1 = ckd_calloc(n, sizeof(*h1));
+    h2 = ckd_calloc(n, sizeof(*h2));
+    start = ckd_calloc(n_bucket + 1, sizeof(*start));
+    size = ckd_calloc(n_bucket, sizeof(*size));
+    order = ckd_calloc(n_bucket, sizeof(*order));
+    keys = ckd_calloc(n, sizeof(*keys));
+    pos = ckd_calloc(n, sizeof(*pos));
+    for (i = 0; i < n; ++i) {
+        h1[i] = dict_bin_hash(d->word[i].word, d->nocase, seed, &h2[i]);
+        ++size[dict_bin_bucket(n_bucket, h1[i])];
+    }
+    for (b = 0; b < n_bucket; ++b) {
+        start[b + 1] = start[b] + size[b];
+        order[b] = b;
+    }
+    memcpy(pos, start, n_bucket * sizeof(*pos));
+    for (i = 0; i < n; ++i)
+        keys[pos[dict_bin_bucket(n_bucket, h1[i])]++] = i;
+    bucket_size_cmp_sizes = size;
+    qsort(order, n_bucket, sizeof(*order), bucket_size_cmp);
+
+    for (i = 0; i < n_slot; ++i)
+        slot[i] = -1;
+    for (i = 0; i < n_bucket && size[order[i]] > 0; ++i) {
+        int32 dd;
+        b = order[i];
+        for (dd = 0; dd < n_slot; ++dd) {
+            for (j = 0; j < size[b]; ++j) {
+                k = keys[start[b] + j];
+                pos[j] = dict_bin_slot(n_slot, h1[k], h2[k], dd);
+                if (slot[pos[j]] != -1)
+                    break;
+                for (k = 0; k < j; ++k)
+                    if (pos[k] == pos[j])
+                        break;
+                if (k < j)
+                    break;
+            }
+            if (j == size[b])
+                break;
+        }
+        if (dd == n_slot)
+            goto error_out;
+        disp[b] = dd;
+        for (j = 0; j < size[b]; ++j)
+            slot[pos[j]] = keys[start[b] + j];
+    }
+    rv = 0;
+
+error_out:
+    ckd_free(pos);
+    ckd_free(keys);
+    ckd_free(order);
+    ckd_free(size);
+    ckd_free(start);
+    ckd_free(h2);
+    ckd_free(h1);
+    return rv;
+}
+
+static void
+fwrite_pad(FILE *fh)
+{
+    int32 zero = 0;
+    long pos = ftell(fh);
+    fwrite(&zero, 1, ((pos + 3) & ~3) - pos, fh);
+}
+
+static int
+dict_write_bin(dict_t *d, char const *filename)
+{
+    FILE *fh;
+    int32 *slot, *disp, *tab;
+    int32 hdr[DICT_BIN_N_HEADER];
+    int32 i, val, n_slot, n_bucket, n_phone, strsize;
+    uint32 seed;
+
+    if (d->mdef == NULL) {
+        E_ERROR("Cannot write a binary dictionary without an acoustic model\n");
+        return -1;
+    }
+
+    n_bucket = d->n_word / DICT_BIN_BUCKET_KEYS + 1;
+    for (n_slot = 2; n_slot < d->n_word + d->n_word / 16; n_slot <<= 1)
+        ;
+    slot = ckd_calloc(n_slot, sizeof(*slot));
+    disp = ckd_calloc(n_bucket, sizeof(*disp));
+    for (seed = 0; seed < DICT_BIN_MAX_SEEDS; ++seed)
+        if (dict_bin_index(d, n_slot, n_bucket, seed, slot, disp) == 0)
+            break;
+    if (seed == DICT_BIN_MAX_SEEDS) {
+        E_ERROR("Failed to build perfect hash for %d words\n", d->n_word);
+        ckd_free(disp);
+        ckd_free(slot);
+        return -1;
+    }
+
+    if ((fh = fopen(filename, "wb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open '%s'", filename);
+        ckd_free(disp);
+        ckd_free(slot);
+        return -1;
+    }
+    val = DICT_BIN_NATIVE_ENDIAN;
+    fwrite(&val, 4, 1, fh);
+    val = DICT_BIN_FORMAT_VERSION;
+    fwrite(&val, 4, 1, fh);
+    val = (sizeof(format_desc) + 3) & ~3;
+    fwrite(&val, 4, 1, fh);
+    fwrite(format_desc, 1, sizeof(format_desc), fh);
+    fwrite_pad(fh);
+
+    n_phone = strsize = 0;
+    for (i = 0; i < d->n_word; ++i) {
+        n_phone += d->word[i].pronlen;
+        strsize += strlen(d->word[i].word) + 1;
+    }
+    hdr[0] = d->n_word;
+    hdr[1] = d->filler_start;
+    hdr[2] = d->filler_end;
+    hdr[3] = d->nocase;
+    hdr[4] = bin_mdef_n_ciphone(d->mdef);
+    hdr[5] = n_phone;
+    hdr[6] = n_slot;
+    hdr[7] = n_bucket;
+    hdr[8] = seed;
+    hdr[9] = strsize;
+    fwrite(hdr, 4, DICT_BIN_N_HEADER, fh);
+    for (i = 0; i < bin_mdef_n_ciphone(d->mdef); ++i) {
+        const char *name = bin_mdef_ciphone_str(d->mdef, i);
+        fwrite(name, 1, strlen(name) + 1, fh);
+    }
+    fwrite_pad(fh);
+
+    /* Word table: string offsets, pronunciation offsets, alternates. */
+    tab = ckd_calloc(d->n_word + 1, sizeof(*tab));
+    for (val = i = 0; i < d->n_word; ++i) {
+        tab[i] = val;
+        val += strlen(d->word[i].word) + 1;
+    }
+    fwrite(tab, 4, d->n_word, fh);
+    for (val = i = 0; i < d->n_word; ++i) {
+        tab[i] = val;
+        val += d->word[i].pronlen;
+    }
+    tab[i] = val;
+    fwrite(tab, 4, d->n_word + 1, fh);
+    for (i = 0; i < d->n_word; ++i)
+        tab[i] = d->word[i].alt;
+    fwrite(tab, 4, d->n_word, fh);
+    for (i = 0; i < d->n_word; ++i)
+        tab[i] = d->word[i].basewid;
+    fwrite(tab, 4, d->n_word, fh);
+    ckd_free(tab);
+
+    fwrite(disp, 4, n_bucket, fh);
+    fwrite(slot, 4, n_slot, fh);
+    for (i = 0; i < d->n_word; ++i)
+        fwrite(d->word[i].ciphone, sizeof(s3cipid_t), d->word[i].pronlen, fh);
+    fwrite_pad(fh);
+    for (i = 0; i < d->n_word; ++i)
+        fwrite(d->word[i].word, 1, strlen(d->word[i].word) + 1, fh);
+
+    ckd_free(disp);
+    ckd_free(slot);
+    if (fclose(fh) != 0) {
+        E_ERROR_SYSTEM("Failed to write '%s'", filename);
+        return -1;
+    }
+    E_INFO("Wrote %d words to binary dictionary %s\n", d->n_word, filename);
+    return 0;
+}
+
+/* Check for the byte order marker of a binary dictionary. */
+static int
+dict_is_bin(FILE *fp)
+{
+    int32 val;
+
+    if (fread(&val, 4, 1, fp) != 1)
+        val = 0;
+    fseek(fp, 0L, SEEK_SET);
+    return val == DICT_BIN_NATIVE_ENDIAN || val == DICT_BIN_OTHER_ENDIAN;
+}
+
+/*
+ * Set up the word table of d over a binary dictionary, memory-mapped
+ * if possible.  If its phone ids differ from those of d->mdef (or it
+ * is byte-swapped) it is read into memory and fixed up instead.
+ */
+static int
+dict_read_bin(FILE *fp, cmd_ln_t *config, char const *filename, dict_t * d)
+{
+    int32 hdr[DICT_BIN_N_HEADER];
+    int32 i, j, val, swap, do_mmap, remap, n_int32;
+    int32 *tab;
+    s3cipid_t *ciremap, *phones;
+    char *base, *strings, name[256];
+    long pos, end;
+
+    if (fread(&val, 4, 1, fp) != 1)
+        return -1;
+    swap = (val == DICT_BIN_OTHER_ENDIAN);
+    if (swap)
+        E_INFO("Must byte-swap %s\n", filename);
+    if (fread(&val, 4, 1, fp) != 1)
+        return -1;
+    if (swap)
+        SWAP_INT32(&val);
+    if (val > DICT_BIN_FORMAT_VERSION) {
+        E_ERROR("File format version %d for %s is newer than library\n",
+                val, filename);
+        return -1;
+    }
+    if (fread(&val, 4, 1, fp) != 1)
+        return -1;
+    if (swap)
+        SWAP_INT32(&val);
+    fseek(fp, val, SEEK_CUR);
+    if (fread(hdr, 4, DICT_BIN_N_HEADER, fp) != DICT_BIN_N_HEADER) {
+        E_ERROR_SYSTEM("Failed to read header from %s", filename);
+        return -1;
+    }
+    if (swap)
+        for (i = 0; i < DICT_BIN_N_HEADER; ++i)
+            SWAP_INT32(&hdr[i]);
+    if (hdr[0] >= MAX_S3WID) {
+        E_ERROR("Number of words in dictionary (%d) exceeds limit (%d)\n",
+                hdr[0], MAX_S3WID);
+        return -1;
+    }
+    if (d->mdef == NULL) {
+        E_ERROR("Cannot read a binary dictionary without an acoustic model\n");
+        return -1;
+    }
+    pos = ftell(fp);
+
+    /* Match phone names against the acoustic model. */
+    ciremap = ckd_calloc(hdr[4], sizeof(*ciremap));
+    remap = FALSE;
+    for (i = 0; i < hdr[4]; ++i) {
+        int c = EOF;
+        for (j = 0; j < sizeof(name); ++j)
+            if ((c = fgetc(fp)) == EOF || (name[j] = c) == '\0')
+                break;
+        if (c != '\0') {
+            E_ERROR("Failed to read phone names from %s\n", filename);
+            ckd_free(ciremap);
+            return -1;
+        }
+        ciremap[i] = bin_mdef_ciphone_id(d->mdef, name);
+        if (NOT_S3CIPID(ciremap[i])) {
+            E_ERROR("Phone '%s' in %s is missing in the acoustic model\n",
+                    name, filename);
+            ckd_free(ciremap);
+            return -1;
+        }
+        if (ciremap[i] != i)
+            remap = TRUE;
+    }
+    /* Skip the padding. */
+    pos += (ftell(fp) - pos + 3) & ~3;
+
+    do_mmap = (config && cmd_ln_exists_r(config, "-mmap"))
+        ? cmd_ln_boolean_r(config, "-mmap") : TRUE;
+    if (swap || remap)
+        do_mmap = FALSE;
+    if (do_mmap && (d->filemap = mmio_file_read(filename)) != NULL) {
+        base = (char *)mmio_file_ptr(d->filemap) + pos;
+    }
+    else {
+        fseek(fp, 0L, SEEK_END);
+        end = ftell(fp);
+        fseek(fp, pos, SEEK_SET);
+        d->binsize = end - pos;
+        d->bindata = base = ckd_malloc(d->binsize);
+        if (fread(base, 1, d->binsize, fp) != d->binsize) {
+            E_ERROR_SYSTEM("Failed to read %ld bytes from %s",
+                           (long)d->binsize, filename);
+            ckd_free(ciremap);
+            return -1;
+        }
+    }
+
+    /* Word table and index, then phones and strings. */
+    n_int32 = 4 * hdr[0] + 1 + hdr[7] + hdr[6];
+    tab = (int32 *)base;
+    phones = (s3cipid_t *)(tab + n_int32);
+    strings = base + ((n_int32 * 4 + hdr[5] * sizeof(*phones) + 3) & ~3);
+    if (swap) {
+        for (i = 0; i < n_int32; ++i)
+            SWAP_INT32(tab + i);
+        for (i = 0; i < hdr[5]; ++i)
+            SWAP_INT16(phones + i);
+    }
+    if (remap)
+        for (i = 0; i < hdr[5]; ++i)
+            phones[i] = ciremap[phones[i]];
+    ckd_free(ciremap);
+
+    d->n_word = d->n_bin_word = hdr[0];
+    d->filler_start = hdr[1];
+    d->filler_end = hdr[2];
+    if (d->nocase != hdr[3])
+        E_WARN("%s is case-%ssensitive, ignoring -dictcase\n",
+               filename, hdr[3] ? "in" : "");
+    d->nocase = hdr[3];
+    d->n_bin_slot = hdr[6];
+    d->n_bin_bucket = hdr[7];
+    d->bin_seed = hdr[8];
+    d->bin_disp = tab + 4 * hdr[0] + 1;
+    d->bin_slot = d->bin_disp + hdr[7];
+    d->max_words = d->n_word + S3DICT_INC_SZ < MAX_S3WID
+        ? d->n_word + S3DICT_INC_SZ : MAX_S3WID;
+    d->word = ckd_calloc(d->max_words, sizeof(*d->word));
+    for (i = 0; i < d->n_word; ++i) {
+        int32 const *pron = tab + hdr[0];
+        d->word[i].word = strings + tab[i];
+        d->word[i].ciphone = phones + pron[i];
+        d->word[i].pronlen = pron[i + 1] - pron[i];
+        d->word[i].alt = tab[2 * hdr[0] + 1 + i];
+        d->word[i].basewid = tab[3 * hdr[0] + 1 + i];
+    }
+    return 0;
+}
+
 int
 dict_write(dict_t *dict, char const *filename, char const *format)
 {
     FILE *fh;
     int i;
 
+    if (format && 0 == strcmp(format, "bin"))
+        return dict_write_bin(dict, filename);
     if ((fh = fopen(filename, "w")) == NULL) {
         E_ERROR_SYSTEM("Failed to open '%s'", filename);
         return -1;
@@ -248,6 +686,54 @@ dict_write(dict_t *dict, char const *filename, char const *format)
 }
 
 
+/* Fillers and special words are all in a binary dictionary. */
+static dict_t *
+dict_init_bin(cmd_ln_t *config, char const *dictfile,
+              char const *fillerfile, bin_mdef_t * mdef)
+{
+    FILE *fp;
+    dict_t *d;
+
+    if ((fp = fopen(dictfile, "rb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open dictionary file '%s' for reading", dictfile);
+        return NULL;
+    }
+    d = (dict_t *) ckd_calloc(1, sizeof(dict_t));       /* freed in dict_free() */
+    d->refcnt = 1;
+    if (mdef)
+        d->mdef = bin_mdef_retain(mdef);
+    if (config && cmd_ln_exists_r(config, "-dictcase"))
+        d->nocase = cmd_ln_boolean_r(config, "-dictcase");
+
+    E_INFO("Reading binary dictionary: %s\n", dictfile);
+    if (dict_read_bin(fp, config, dictfile, d) < 0) {
+        E_ERROR("Failed to read binary dictionary %s\n", dictfile);
+        fclose(fp);
+        dict_free(d);
+        return NULL;
+    }
+    fclose(fp);
+    E_INFO("%d words read (%d fillers), %s\n", d->n_word,
+           d->filler_end - d->filler_start + 1,
+           d->filemap ? "memory-mapped" : "in memory");
+    if (fillerfile)
+        E_INFO("Using fillers from binary dictionary, not %s\n", fillerfile);
+
+    /* Only words added later go in the hash table. */
+    d->ht = hash_table_new(S3DICT_INC_SZ, d->nocase);
+
+    d->startwid = dict_wordid(d, S3_START_WORD);
+    d->finishwid = dict_wordid(d, S3_FINISH_WORD);
+    d->silwid = dict_wordid(d, S3_SILENCE_WORD);
+    if (d->startwid == BAD_S3WID || d->finishwid == BAD_S3WID
+        || d->silwid == BAD_S3WID || !dict_filler_word(d, d->silwid)) {
+        E_ERROR("Binary dictionary %s lacks special words\n", dictfile);
+        dict_free(d);
+        return NULL;
+    }
+    return d;
+}
+
 dict_t *
 dict_init(cmd_ln_t *config, bin_mdef_t * mdef)
 {
@@ -275,6 +761,10 @@ dict_init(cmd_ln_t *config, bin_mdef_t * mdef)
             E_ERROR_SYSTEM("Failed to open dictionary file '%s' for reading", dictfile);
             return NULL;
         }
+        if (dict_is_bin(fp)) {
+            fclose(fp);
+            return dict_init_bin(config, dictfile, fillerfile, mdef);
+        }
         for (li = lineiter_start(fp); li; li = lineiter_next(li)) {
             if (0 != strncmp(li->buf, "##", 2)
                 && 0 != strncmp(li->buf, ";;", 2))
@@ -375,6 +865,8 @@ dict_init(cmd_ln_t *config, bin_mdef_t * mdef)
     }
 
     d->filler_end = d->n_word - 1;
+    /* Words added later on are found in the ordinary table. */
+    hash_table_freeze(d->ht);
 
     /* Initialize distinguished word-ids */
     d->startwid = dict_wordid(d, S3_START_WORD);
@@ -403,6 +895,8 @@ dict_wordid(dict_t *d, const char *word)
     assert(d);
     assert(word);
 
+    if (d->n_bin_word && (w = dict_bin_wordid(d, word)) != BAD_S3WID)
+        return w;
     if (hash_table_lookup_int32(d->ht, word, &w) < 0)
         return (BAD_S3WID);
     return w;
@@ -464,6 +958,20 @@ dict_retain(dict_t *d)
     return d;
 }
 
+dict_t *
+dict_share(dict_t *d)
+{
+    dict_t *s;
+
+    if (d->shared)
+        d = d->shared;
+    s = ckd_malloc(sizeof(*s));
+    *s = *d;
+    s->refcnt = 1;
+    s->shared = dict_retain(d);
+    return s;
+}
+
 int
 dict_free(dict_t * d)
 {
@@ -474,9 +982,14 @@ dict_free(dict_t * d)
         return 0;
     if (--d->refcnt > 0)
         return d->refcnt;
+    if (d->shared) {
+        dict_free(d->shared);
+        ckd_free(d);
+        return 0;
+    }
 
     /* First Step, free all memory allocated for each word */
-    for (i = 0; i < d->n_word; i++) {
+    for (i = d->n_bin_word; i < d->n_word; i++) {
         word = (dictword_t *) & (d->word[i]);
         if (word->word)
             ckd_free((void *) word->word);
@@ -490,11 +1003,33 @@ dict_free(dict_t * d)
         hash_table_free(d->ht);
     if (d->mdef)
         bin_mdef_free(d->mdef);
+    if (d->filemap)
+        mmio_file_unmap(d->filemap);
+    ckd_free(d->bindata);
     ckd_free((void *) d);
 
     return 0;
 }
 
+size_t
+dict_mem_size(dict_t * d)
+{
+    size_t size;
+    int32 i;
+
+    size = sizeof(*d);
+    if (d->shared)
+        d = d->shared;
+    size += d->max_words * sizeof(*d->word) + hash_table_mem_size(d->ht);
+    size += d->binsize;
+    for (i = d->n_bin_word; i < d->n_word; ++i) {
+        if (d->word[i].word)
+            size += strlen(d->word[i].word) + 1;
+        size += d->word[i].pronlen * sizeof(*d->word[i].ciphone);
+    }
+    return size;
+}
+
 void
 dict_report(dict_t * d)
 {
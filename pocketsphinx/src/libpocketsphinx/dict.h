@@ -44,6 +44,7 @@
 
 /* SphinxBase headers. */
 #include <sphinxbase/hash_table.h>
+#include <sphinxbase/mmio.h>
 
 /* Local headers. */
 #include "s3types.h"
@@ -52,6 +53,13 @@
 
 #define S3DICT_INC_SZ 4096
 
+#define DICT_BIN_FORMAT_VERSION 1
+/* Format 1:
+ *  Header, word table and perfect hash index, phones, word strings.
+ */
+#define DICT_BIN_NATIVE_ENDIAN 0x43494442 /* 'BDIC' in little-endian order */
+#define DICT_BIN_OTHER_ENDIAN 0x42444943  /* 'BDIC' in big-endian order */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -73,8 +81,9 @@ typedef struct {
     \brief a structure for a dictionary. 
 */
 
-typedef struct {
+typedef struct dict_s {
     int refcnt;
+    struct dict_s *shared; /**< Dictionary whose words these are, or NULL */
     bin_mdef_t *mdef;	/**< Model definition used for phone IDs; NULL if none used */
     dictword_t *word;	/**< Array of entries in dictionary */
     hash_table_t *ht;	/**< Hash table for mapping word strings to word ids */
@@ -86,6 +95,19 @@ typedef struct {
     s3wid_t finishwid;	/**< FOR INTERNAL-USE ONLY */
     s3wid_t silwid;	/**< FOR INTERNAL-USE ONLY */
     int nocase;
+    /* Binary dictionary, if the words were loaded from one.  Their
+     * strings and phones point into it rather than being allocated
+     * one by one, and they are looked up through its perfect hash
+     * index; only words added afterwards go in ht. */
+    mmio_file_t *filemap; /**< Memory map of the binary dictionary, or NULL */
+    void *bindata;      /**< Heap copy of it if not memory-mapped, or NULL */
+    size_t binsize;     /**< Size of bindata */
+    int32 n_bin_word;   /**< #Words from the binary dictionary (0 if none) */
+    int32 const *bin_slot; /**< Word id for each index slot (-1 if empty) */
+    int32 const *bin_disp; /**< Displacement for each index bucket */
+    int32 n_bin_slot;   /**< #Slots in index (a power of 2) */
+    int32 n_bin_bucket; /**< #Buckets in index */
+    uint32 bin_seed;    /**< Seed for index hash */
 } dict_t;
 
 
@@ -106,6 +128,11 @@ dict_t *dict_init(cmd_ln_t *config, /**< Configuration (-dict, -fdict, -dictcase
 
 /**
  * Write dictionary to a file.
+ *
+ * With format "bin", all words including fillers are written in a
+ * binary format, which dict_init() recognizes and memory-maps (if
+ * -mmap is set) instead of parsing.  Otherwise (format NULL) the real
+ * words are written as text.
  */
 int dict_write(dict_t *dict, char const *filename, char const *format);
 
@@ -194,11 +221,27 @@ int32 dict_word2basestr(char *word);
  */
 dict_t *dict_retain(dict_t *d);
 
+/**
+ * Create a dictionary using the words of another one.
+ *
+ * Unlike dict_retain(), this gives a separate reference count, so
+ * that the two can be retained and released from different threads.
+ * Words must not be added to either of them afterwards.
+ */
+dict_t *dict_share(dict_t *d);
+
 /**
  * Release a pointer to a dictionary.
  */
 int dict_free(dict_t *d);
 
+/**
+ * Get the number of bytes of heap memory used by a dictionary,
+ * including the words it shares with the one it was copied from (see
+ * dict_share()).
+ */
+size_t dict_mem_size(dict_t *d);
+
 /** Report a dictionary structure */
 void dict_report(dict_t *d /**< A dictionary structure */
     );
@@ -76,124 +76,197 @@ compress_table(s3ssid_t * uncomp_tab, s3ssid_t * com_tab,
     }
 }
 
-
+/**
+ * Build the fanout of a compressed table, i.e. the inverse of its
+ * cimap, so that callers can visit each ssid once along with all the
+ * context phones that share it.
+ */
 static void
-compress_right_context_tree(dict2pid_t * d2p,
-                            s3ssid_t ***rdiph_rc)
+compress_fanout(xwdssid_t *x, int32 n_ci)
 {
-    int32 n_ci;
-    int32 b, l, r;
-    s3ssid_t *rmap;
-    s3ssid_t *tmpssid;
-    s3cipid_t *tmpcimap;
-    bin_mdef_t *mdef = d2p->mdef;
-    size_t alloc;
-
-    n_ci = mdef->n_ciphone;
-
-    tmpssid = ckd_calloc(n_ci, sizeof(s3ssid_t));
-    tmpcimap = ckd_calloc(n_ci, sizeof(s3cipid_t));
-
-    d2p->rssid =
-        (xwdssid_t **) ckd_calloc(mdef->n_ciphone, sizeof(xwdssid_t *));
-    alloc = mdef->n_ciphone * sizeof(xwdssid_t *);
+    int32 i, r;
+
+    x->rcfan = ckd_calloc(n_ci, sizeof(*x->rcfan));
+    x->rcfan_start = ckd_calloc(x->n_ssid + 1, sizeof(*x->rcfan_start));
+    for (r = 0; r < n_ci; r++)
+        ++x->rcfan_start[x->cimap[r] + 1];
+    for (i = 0; i < x->n_ssid; i++)
+        x->rcfan_start[i + 1] += x->rcfan_start[i];
+    for (r = 0; r < n_ci; r++)
+        x->rcfan[x->rcfan_start[x->cimap[r]]++] = r;
+    /* The last loop shifted each start to the next one; undo that. */
+    for (i = x->n_ssid; i > 0; --i)
+        x->rcfan_start[i] = x->rcfan_start[i - 1];
+    x->rcfan_start[0] = 0;
+}
 
-    for (b = 0; b < n_ci; b++) {
-        d2p->rssid[b] =
-            (xwdssid_t *) ckd_calloc(mdef->n_ciphone, sizeof(xwdssid_t));
-        alloc += mdef->n_ciphone * sizeof(xwdssid_t);
+static uint32
+row_hash(s3ssid_t const *row, int32 n_ci)
+{
+    uint32 h = 2166136261u;
+    int32 i;
 
-        for (l = 0; l < n_ci; l++) {
-            rmap = rdiph_rc[b][l];
-            compress_table(rmap, tmpssid, tmpcimap, mdef->n_ciphone);
+    for (i = 0; i < n_ci; i++)
+        h = (h ^ (uint32)row[i]) * 16777619u;
+    return h;
+}
 
-            for (r = 0; r < mdef->n_ciphone && tmpssid[r] != BAD_S3SSID;
-                 r++);
+static void
+rehash_rows(dict2pid_t *d2p)
+{
+    int32 i, slot, mask;
+
+    ckd_free(d2p->row_hash);
+    d2p->row_hash = ckd_calloc(d2p->row_hash_size, sizeof(*d2p->row_hash));
+    mask = d2p->row_hash_size - 1;
+    for (i = 0; i < d2p->n_rows; i++) {
+        slot = row_hash(d2p->rows + i * d2p->n_ci, d2p->n_ci) & mask;
+        while (d2p->row_hash[slot])
+            slot = (slot + 1) & mask;
+        d2p->row_hash[slot] = i + 1;
+    }
+}
 
-            if (tmpssid[0] != BAD_S3SSID) {
-                d2p->rssid[b][l].ssid = ckd_calloc(r, sizeof(s3ssid_t));
-                memcpy(d2p->rssid[b][l].ssid, tmpssid,
-                       r * sizeof(s3ssid_t));
-                d2p->rssid[b][l].cimap =
-                    ckd_calloc(mdef->n_ciphone, sizeof(s3cipid_t));
-                memcpy(d2p->rssid[b][l].cimap, tmpcimap,
-                       (mdef->n_ciphone) * sizeof(s3cipid_t));
-                d2p->rssid[b][l].n_ssid = r;
-            }
-            else {
-                d2p->rssid[b][l].ssid = NULL;
-                d2p->rssid[b][l].cimap = NULL;
-                d2p->rssid[b][l].n_ssid = 0;
-            }
-        }
+/**
+ * Find or add a row of ssids in the pool.
+ *
+ * @return its offset in d2p->rows.
+ */
+static int32
+intern_row(dict2pid_t *d2p, s3ssid_t const *row)
+{
+    int32 n_ci = d2p->n_ci;
+    int32 slot, mask, i;
+
+    mask = d2p->row_hash_size - 1;
+    slot = row_hash(row, n_ci) & mask;
+    while ((i = d2p->row_hash[slot]) != 0) {
+        if (0 == memcmp(d2p->rows + (i - 1) * n_ci, row,
+                        n_ci * sizeof(*row)))
+            return (i - 1) * n_ci;
+        slot = (slot + 1) & mask;
     }
 
-    E_INFO("Allocated %d bytes (%d KiB) for word-final triphones\n",
-           (int)alloc, (int)alloc / 1024);
-    ckd_free(tmpssid);
-    ckd_free(tmpcimap);
+    if (d2p->n_rows == d2p->n_rows_alloc) {
+        d2p->n_rows_alloc *= 2;
+        d2p->rows = ckd_realloc(d2p->rows, d2p->n_rows_alloc
+                                * n_ci * sizeof(*d2p->rows));
+        d2p->row_xwd = ckd_realloc(d2p->row_xwd, d2p->n_rows_alloc
+                                   * sizeof(*d2p->row_xwd));
+    }
+    i = d2p->n_rows++;
+    memcpy(d2p->rows + i * n_ci, row, n_ci * sizeof(*row));
+    d2p->row_xwd[i] = -1;
+    /* Keep the load factor at or below one half. */
+    if (d2p->n_rows * 2 > d2p->row_hash_size) {
+        d2p->row_hash_size *= 2;
+        rehash_rows(d2p);
+    }
+    else
+        d2p->row_hash[slot] = i + 1;
+    return i * n_ci;
 }
 
-static void
-compress_left_right_context_tree(dict2pid_t * d2p)
+/**
+ * Find or create the compressed table for a row of ssids in the pool.
+ *
+ * @return its index in d2p->xwd.
+ */
+static int32
+intern_xwd(dict2pid_t *d2p, int32 off)
 {
-    int32 n_ci;
-    int32 b, l, r;
-    s3ssid_t *rmap;
+    int32 row = off / d2p->n_ci;
     s3ssid_t *tmpssid;
-    s3cipid_t *tmpcimap;
-    bin_mdef_t *mdef = d2p->mdef;
-    size_t alloc;
-
-    n_ci = mdef->n_ciphone;
-
-    tmpssid = ckd_calloc(n_ci, sizeof(s3ssid_t));
-    tmpcimap = ckd_calloc(n_ci, sizeof(s3cipid_t));
+    xwdssid_t *x;
+    int32 r;
 
-    assert(d2p->lrdiph_rc);
+    if (d2p->row_xwd[row] != -1)
+        return d2p->row_xwd[row];
 
-    d2p->lrssid =
-        (xwdssid_t **) ckd_calloc(mdef->n_ciphone, sizeof(xwdssid_t *));
-    alloc = mdef->n_ciphone * sizeof(xwdssid_t *);
+    if (d2p->n_xwd == d2p->n_xwd_alloc) {
+        d2p->n_xwd_alloc *= 2;
+        d2p->xwd = ckd_realloc(d2p->xwd, d2p->n_xwd_alloc
+                               * sizeof(*d2p->xwd));
+    }
+    x = &d2p->xwd[d2p->n_xwd];
+    tmpssid = ckd_calloc(d2p->n_ci, sizeof(*tmpssid));
+    x->cimap = ckd_calloc(d2p->n_ci, sizeof(*x->cimap));
+    compress_table(d2p->rows + off, tmpssid, x->cimap, d2p->n_ci);
+    for (r = 0; r < d2p->n_ci && tmpssid[r] != BAD_S3SSID; r++)
+        ;
+    x->ssid = ckd_realloc(tmpssid, r * sizeof(*x->ssid));
+    x->n_ssid = r;
+    compress_fanout(x, d2p->n_ci);
+
+    d2p->row_xwd[row] = d2p->n_xwd;
+    return d2p->n_xwd++;
+}
 
-    for (b = 0; b < n_ci; b++) {
+static void
+populate_ldiph(dict2pid_t *d2p, s3ssid_t *row, s3cipid_t b, s3cipid_t r)
+{
+    bin_mdef_t *mdef = d2p->mdef;
+    s3cipid_t l;
 
-        d2p->lrssid[b] =
-            (xwdssid_t *) ckd_calloc(mdef->n_ciphone, sizeof(xwdssid_t));
-        alloc += mdef->n_ciphone * sizeof(xwdssid_t);
+    /* Record all possible ssids for b(?,r) */
+    for (l = 0; l < d2p->n_ci; l++) {
+        s3pid_t p;
+        p = bin_mdef_phone_id_nearest(mdef, b, l, r, WORD_POSN_BEGIN);
+        row[l] = bin_mdef_pid2ssid(mdef, p);
+    }
+    d2p->ldiph_lc[b * d2p->n_ci + r] = intern_row(d2p, row);
+}
 
-        for (l = 0; l < n_ci; l++) {
-            rmap = d2p->lrdiph_rc[b][l];
+static int32
+populate_rdiph(dict2pid_t *d2p, s3ssid_t *row, s3cipid_t b, s3cipid_t l)
+{
+    bin_mdef_t *mdef = d2p->mdef;
+    s3cipid_t r;
 
-            compress_table(rmap, tmpssid, tmpcimap, mdef->n_ciphone);
+    /* Record all possible ssids for b(l,?) */
+    for (r = 0; r < d2p->n_ci; r++) {
+        s3pid_t p;
+        p = bin_mdef_phone_id_nearest(mdef, b, l, r, WORD_POSN_END);
+        row[r] = bin_mdef_pid2ssid(mdef, p);
+    }
+    return intern_row(d2p, row);
+}
 
-            for (r = 0; r < mdef->n_ciphone && tmpssid[r] != BAD_S3SSID;
-                 r++);
+static void
+populate_lrdiph(dict2pid_t *d2p, s3ssid_t *row, int32 *rdiph_rc, s3cipid_t b)
+{
+    bin_mdef_t *mdef = d2p->mdef;
+    s3ssid_t *silrow;
+    s3cipid_t l, r;
+    int32 n_ci = d2p->n_ci;
 
-            if (tmpssid[0] != BAD_S3SSID) {
-                d2p->lrssid[b][l].ssid = ckd_calloc(r, sizeof(s3ssid_t));
-                memcpy(d2p->lrssid[b][l].ssid, tmpssid,
-                       r * sizeof(s3ssid_t));
-                d2p->lrssid[b][l].cimap =
-                    ckd_calloc(mdef->n_ciphone, sizeof(s3cipid_t));
-                memcpy(d2p->lrssid[b][l].cimap, tmpcimap,
-                       (mdef->n_ciphone) * sizeof(s3cipid_t));
-                d2p->lrssid[b][l].n_ssid = r;
-            }
-            else {
-                d2p->lrssid[b][l].ssid = NULL;
-                d2p->lrssid[b][l].cimap = NULL;
-                d2p->lrssid[b][l].n_ssid = 0;
-            }
+    /* Single-phone words in silence left context stand in for the
+     * word-initial triphones in b(?,SIL), collected as we go. */
+    silrow = ckd_calloc(n_ci, sizeof(*silrow));
+    for (l = 0; l < n_ci; l++) {
+        for (r = 0; r < n_ci; r++) {
+            s3pid_t p;
+            p = bin_mdef_phone_id_nearest(mdef, b, l, r,
+                                          WORD_POSN_SINGLE);
+            row[r] = bin_mdef_pid2ssid(mdef, p);
+            assert(IS_S3SSID(row[r]));
+            E_DEBUG("%s(%s,%s) => %d / %d\n",
+                    bin_mdef_ciphone_str(mdef, b),
+                    bin_mdef_ciphone_str(mdef, l),
+                    bin_mdef_ciphone_str(mdef, r),
+                    p, row[r]);
         }
+        silrow[l] = row[bin_mdef_silphone(mdef)];
+        d2p->lrdiph_rc[b * n_ci + l] = intern_row(d2p, row);
+        d2p->lrssid[b * n_ci + l]
+            = intern_xwd(d2p, d2p->lrdiph_rc[b * n_ci + l]);
+        /* And the word-final ones in b(SIL,?) */
+        if (rdiph_rc && l == bin_mdef_silphone(mdef))
+            rdiph_rc[b * n_ci + l] = d2p->lrdiph_rc[b * n_ci + l];
     }
-
-    /* Try to compress lrdiph_rc into lrdiph_rc_compressed */
-    ckd_free(tmpssid);
-    ckd_free(tmpcimap);
-
-    E_INFO("Allocated %d bytes (%d KiB) for single-phone word triphones\n",
-           (int)alloc, (int)alloc / 1024);
+    d2p->ldiph_lc[b * n_ci + bin_mdef_silphone(mdef)]
+        = intern_row(d2p, silrow);
+    ckd_free(silrow);
 }
 
 /**
@@ -215,12 +288,12 @@ get_rc_nssid(dict2pid_t * d2p, s3wid_t w)
            No known left context.  But all cimaps (for any l) are identical; pick one 
         */
         /*E_INFO("Single phone word\n"); */
-        return (d2p->lrssid[b][0].n_ssid);
+        return d2p->xwd[d2p->lrssid[b * d2p->n_ci]].n_ssid;
     }
     else {
         /*    E_INFO("Multiple phone word\n"); */
         lc = dict->word[w].ciphone[pronlen - 2];
-        return (d2p->rssid[b][lc].n_ssid);
+        return dict2pid_rssid(d2p, b, lc)->n_ssid;
     }
 
 }
@@ -240,57 +313,12 @@ dict2pid_get_rcmap(dict2pid_t * d2p, s3wid_t w)
            No known left context.  But all cimaps (for any l) are identical; pick one 
         */
         /*E_INFO("Single phone word\n"); */
-        return (d2p->lrssid[b][0].cimap);
+        return d2p->xwd[d2p->lrssid[b * d2p->n_ci]].cimap;
     }
     else {
         /*    E_INFO("Multiple phone word\n"); */
         lc = dict->word[w].ciphone[pronlen - 2];
-        return (d2p->rssid[b][lc].cimap);
-    }
-}
-
-static void
-free_compress_map(xwdssid_t ** tree, int32 n_ci)
-{
-    int32 b, l;
-    for (b = 0; b < n_ci; b++) {
-        for (l = 0; l < n_ci; l++) {
-            ckd_free(tree[b][l].ssid);
-            ckd_free(tree[b][l].cimap);
-        }
-        ckd_free(tree[b]);
-    }
-    ckd_free(tree);
-}
-
-static void
-populate_lrdiph(dict2pid_t *d2p, s3ssid_t ***rdiph_rc, s3cipid_t b)
-{
-    bin_mdef_t *mdef = d2p->mdef;
-    s3cipid_t l, r;
-
-    for (l = 0; l < bin_mdef_n_ciphone(mdef); l++) {
-        for (r = 0; r < bin_mdef_n_ciphone(mdef); r++) {
-            s3pid_t p;
-            p = bin_mdef_phone_id_nearest(mdef, (s3cipid_t) b,
-                                          (s3cipid_t) l,
-                                          (s3cipid_t) r,
-                                          WORD_POSN_SINGLE);
-            d2p->lrdiph_rc[b][l][r]
-                = bin_mdef_pid2ssid(mdef, p);
-            if (r == bin_mdef_silphone(mdef))
-                d2p->ldiph_lc[b][r][l]
-                    = bin_mdef_pid2ssid(mdef, p);
-            if (rdiph_rc && l == bin_mdef_silphone(mdef))
-                rdiph_rc[b][l][r]
-                    = bin_mdef_pid2ssid(mdef, p);
-            assert(IS_S3SSID(bin_mdef_pid2ssid(mdef, p)));
-            E_DEBUG("%s(%s,%s) => %d / %d\n",
-                    bin_mdef_ciphone_str(mdef, b),
-                    bin_mdef_ciphone_str(mdef, l),
-                    bin_mdef_ciphone_str(mdef, r),
-                    p, bin_mdef_pid2ssid(mdef, p));
-        }
+        return dict2pid_rssid(d2p, b, lc)->cimap;
     }
 }
 
@@ -298,67 +326,44 @@ int
 dict2pid_add_word(dict2pid_t *d2p,
                   int32 wid)
 {
-    bin_mdef_t *mdef = d2p->mdef;
     dict_t *d = d2p->dict;
+    s3ssid_t *row;
+    int32 n_ci = d2p->n_ci;
 
+    /* Only the tables for this word's own contexts are touched, and
+     * only if no other word has already filled them in. */
+    row = ckd_calloc(n_ci, sizeof(*row));
     if (dict_pronlen(d, wid) > 1) {
-        s3cipid_t l;
+        s3cipid_t b, l;
         /* Make sure we have left and right context diphones for this
          * word. */
-        if (d2p->ldiph_lc[dict_first_phone(d, wid)][dict_second_phone(d, wid)][0]
-            == BAD_S3SSID) {
+        b = dict_first_phone(d, wid);
+        if (d2p->ldiph_lc[b * n_ci + dict_second_phone(d, wid)] == 0) {
             E_DEBUG("Filling in left-context diphones for %s(?,%s)\n",
-                   bin_mdef_ciphone_str(mdef, dict_first_phone(d, wid)),
-                   bin_mdef_ciphone_str(mdef, dict_second_phone(d, wid)));
-            for (l = 0; l < bin_mdef_n_ciphone(mdef); l++) {
-                int p
-                    = bin_mdef_phone_id_nearest(mdef,
-                                                dict_first_phone(d, wid), l,
-                                                dict_second_phone(d, wid),
-                                                WORD_POSN_BEGIN);
-                d2p->ldiph_lc[dict_first_phone(d, wid)][dict_second_phone(d, wid)][l]
-                    = bin_mdef_pid2ssid(mdef, p);
-            }
+                   bin_mdef_ciphone_str(d2p->mdef, b),
+                   bin_mdef_ciphone_str(d2p->mdef, dict_second_phone(d, wid)));
+            populate_ldiph(d2p, row, b, dict_second_phone(d, wid));
         }
-        if (d2p->rssid[dict_last_phone(d, wid)][dict_second_last_phone(d, wid)].n_ssid
-            == 0) {
-            s3ssid_t *rmap;
-            s3ssid_t *tmpssid;
-            s3cipid_t *tmpcimap;
-            s3cipid_t r;
-
+        b = dict_last_phone(d, wid);
+        l = dict_second_last_phone(d, wid);
+        if (dict2pid_rssid(d2p, b, l)->n_ssid == 0) {
             E_DEBUG("Filling in right-context diphones for %s(%s,?)\n",
-                   bin_mdef_ciphone_str(mdef, dict_last_phone(d, wid)),
-                   bin_mdef_ciphone_str(mdef, dict_second_last_phone(d, wid)));
-            rmap = ckd_calloc(bin_mdef_n_ciphone(mdef), sizeof(*rmap));
-            for (r = 0; r < bin_mdef_n_ciphone(mdef); r++) {
-                int p
-                    = bin_mdef_phone_id_nearest(mdef,
-                                                dict_last_phone(d, wid),
-                                                dict_second_last_phone(d, wid), r,
-                                                WORD_POSN_END);
-                rmap[r] = bin_mdef_pid2ssid(mdef, p);
-            }
-            tmpssid = ckd_calloc(bin_mdef_n_ciphone(mdef), sizeof(*tmpssid));
-            tmpcimap = ckd_calloc(bin_mdef_n_ciphone(mdef), sizeof(*tmpcimap));
-            compress_table(rmap, tmpssid, tmpcimap, bin_mdef_n_ciphone(mdef));
-            for (r = 0; r < mdef->n_ciphone && tmpssid[r] != BAD_S3SSID; r++)
-                ;
-            d2p->rssid[dict_last_phone(d, wid)][dict_second_last_phone(d, wid)].ssid = tmpssid;
-            d2p->rssid[dict_last_phone(d, wid)][dict_second_last_phone(d, wid)].cimap = tmpcimap;
-            d2p->rssid[dict_last_phone(d, wid)][dict_second_last_phone(d, wid)].n_ssid = r;
-            ckd_free(rmap);
+                   bin_mdef_ciphone_str(d2p->mdef, b),
+                   bin_mdef_ciphone_str(d2p->mdef, l));
+            d2p->rssid[b * n_ci + l]
+                = intern_xwd(d2p, populate_rdiph(d2p, row, b, l));
         }
     }
     else {
         /* Make sure we have a left-right context triphone entry for
          * this word. */
         E_INFO("Filling in context triphones for %s(?,?)\n",
-               bin_mdef_ciphone_str(mdef, dict_first_phone(d, wid)));
-        if (d2p->lrdiph_rc[dict_first_phone(d, wid)][0][0] == BAD_S3SSID) {
-            populate_lrdiph(d2p, NULL, dict_first_phone(d, wid));
+               bin_mdef_ciphone_str(d2p->mdef, dict_first_phone(d, wid)));
+        if (d2p->lrdiph_rc[dict_first_phone(d, wid) * n_ci] == 0) {
+            populate_lrdiph(d2p, row, NULL, dict_first_phone(d, wid));
         }
     }
+    ckd_free(row);
 
     return 0;
 }
@@ -388,10 +393,10 @@ dict2pid_t *
 dict2pid_build(bin_mdef_t * mdef, dict_t * dict)
 {
     dict2pid_t *dict2pid;
-    s3ssid_t ***rdiph_rc;
-    bitvec_t *ldiph, *rdiph, *single;
-    int32 pronlen;
-    int32 b, l, r, w, p;
+    int32 *rdiph_rc;
+    s3ssid_t *row;
+    int32 n_ci, b, l, r, w;
+    size_t alloc;
 
     E_INFO("Building PID tables for dictionary\n");
     assert(mdef);
@@ -401,96 +406,87 @@ dict2pid_build(bin_mdef_t * mdef, dict_t * dict)
     dict2pid->refcount = 1;
     dict2pid->mdef = bin_mdef_retain(mdef);
     dict2pid->dict = dict_retain(dict);
-    E_INFO("Allocating %d^3 * %d bytes (%d KiB) for word-initial triphones\n",
-           mdef->n_ciphone, sizeof(s3ssid_t),
-           mdef->n_ciphone * mdef->n_ciphone * mdef->n_ciphone * sizeof(s3ssid_t) / 1024);
-    dict2pid->ldiph_lc =
-        (s3ssid_t ***) ckd_calloc_3d(mdef->n_ciphone, mdef->n_ciphone,
-                                     mdef->n_ciphone, sizeof(s3ssid_t));
+    dict2pid->n_ci = n_ci = bin_mdef_n_ciphone(mdef);
+
+    /* Start the pool with the empty row, and the empty compressed
+     * table made from it. */
+    dict2pid->n_rows_alloc = 64;
+    dict2pid->rows = ckd_calloc(dict2pid->n_rows_alloc * n_ci,
+                                sizeof(*dict2pid->rows));
+    dict2pid->row_xwd = ckd_calloc(dict2pid->n_rows_alloc,
+                                   sizeof(*dict2pid->row_xwd));
+    dict2pid->row_hash_size = 2 * dict2pid->n_rows_alloc;
+    dict2pid->row_hash = ckd_calloc(dict2pid->row_hash_size,
+                                    sizeof(*dict2pid->row_hash));
+    row = ckd_calloc(n_ci, sizeof(*row));
+    for (r = 0; r < n_ci; ++r)
+        row[r] = BAD_S3SSID;
+    intern_row(dict2pid, row);
+    dict2pid->n_xwd_alloc = 64;
+    dict2pid->xwd = ckd_calloc(dict2pid->n_xwd_alloc, sizeof(*dict2pid->xwd));
+    dict2pid->n_xwd = 1;
+    dict2pid->row_xwd[0] = 0;
+
+    /* Everything else starts out pointing at them. */
+    dict2pid->ldiph_lc = ckd_calloc(n_ci * n_ci, sizeof(*dict2pid->ldiph_lc));
+    dict2pid->lrdiph_rc = ckd_calloc(n_ci * n_ci, sizeof(*dict2pid->lrdiph_rc));
+    dict2pid->rssid = ckd_calloc(n_ci * n_ci, sizeof(*dict2pid->rssid));
+    dict2pid->lrssid = ckd_calloc(n_ci * n_ci, sizeof(*dict2pid->lrssid));
     /* Only used internally to generate rssid */
-    rdiph_rc =
-        (s3ssid_t ***) ckd_calloc_3d(mdef->n_ciphone, mdef->n_ciphone,
-                                     mdef->n_ciphone, sizeof(s3ssid_t));
-
-    dict2pid->lrdiph_rc = (s3ssid_t ***) ckd_calloc_3d(mdef->n_ciphone,
-                                                       mdef->n_ciphone,
-                                                       mdef->n_ciphone,
-                                                       sizeof
-                                                       (s3ssid_t));
-    /* Actually could use memset for this, if BAD_S3SSID is guaranteed
-     * to be 65535... */
-    for (b = 0; b < mdef->n_ciphone; ++b) {
-        for (r = 0; r < mdef->n_ciphone; ++r) {
-            for (l = 0; l < mdef->n_ciphone; ++l) {
-                dict2pid->ldiph_lc[b][r][l] = BAD_S3SSID;
-                dict2pid->lrdiph_rc[b][l][r] = BAD_S3SSID;
-                rdiph_rc[b][l][r] = BAD_S3SSID;
-            }
-        }
-    }
-
-    /* Track which diphones / ciphones have been seen. */
-    ldiph = bitvec_alloc(mdef->n_ciphone * mdef->n_ciphone);
-    rdiph = bitvec_alloc(mdef->n_ciphone * mdef->n_ciphone);
-    single = bitvec_alloc(mdef->n_ciphone);
+    rdiph_rc = ckd_calloc(n_ci * n_ci, sizeof(*rdiph_rc));
 
     for (w = 0; w < dict_size(dict2pid->dict); w++) {
-        pronlen = dict_pronlen(dict, w);
+        int32 pronlen = dict_pronlen(dict, w);
 
         if (pronlen >= 2) {
+            /* Populate ldiph_lc */
             b = dict_first_phone(dict, w);
             r = dict_second_phone(dict, w);
-            /* Populate ldiph_lc */
-            if (bitvec_is_clear(ldiph, b * mdef->n_ciphone + r)) {
-                /* Mark this diphone as done */
-                bitvec_set(ldiph, b * mdef->n_ciphone + r);
-
-                /* Record all possible ssids for b(?,r) */
-                for (l = 0; l < bin_mdef_n_ciphone(mdef); l++) {
-                    p = bin_mdef_phone_id_nearest(mdef, (s3cipid_t) b,
-                                              (s3cipid_t) l, (s3cipid_t) r,
-                                              WORD_POSN_BEGIN);
-                    dict2pid->ldiph_lc[b][r][l] = bin_mdef_pid2ssid(mdef, p);
-                }
-            }
-
+            if (dict2pid->ldiph_lc[b * n_ci + r] == 0)
+                populate_ldiph(dict2pid, row, b, r);
 
             /* Populate rdiph_rc */
             l = dict_second_last_phone(dict, w);
             b = dict_last_phone(dict, w);
-            if (bitvec_is_clear(rdiph, b * mdef->n_ciphone + l)) {
-                /* Mark this diphone as done */
-                bitvec_set(rdiph, b * mdef->n_ciphone + l);
-
-                for (r = 0; r < bin_mdef_n_ciphone(mdef); r++) {
-                    p = bin_mdef_phone_id_nearest(mdef, (s3cipid_t) b,
-                                              (s3cipid_t) l, (s3cipid_t) r,
-                                              WORD_POSN_END);
-                    rdiph_rc[b][l][r] = bin_mdef_pid2ssid(mdef, p);
-                }
-            }
+            if (rdiph_rc[b * n_ci + l] == 0)
+                rdiph_rc[b * n_ci + l] = populate_rdiph(dict2pid, row, b, l);
         }
         else if (pronlen == 1) {
             b = dict_pron(dict, w, 0);
             E_DEBUG("Building tables for single phone word %s phone %d = %s\n",
                        dict_wordstr(dict, w), b, bin_mdef_ciphone_str(mdef, b));
             /* Populate lrdiph_rc (and also ldiph_lc, rdiph_rc if needed) */
-            if (bitvec_is_clear(single, b)) {
-                populate_lrdiph(dict2pid, rdiph_rc, b);
-                bitvec_set(single, b);
-            }
+            if (dict2pid->lrdiph_rc[b * n_ci] == 0)
+                populate_lrdiph(dict2pid, row, rdiph_rc, b);
         }
     }
 
-    bitvec_free(ldiph);
-    bitvec_free(rdiph);
-    bitvec_free(single);
-
-    /* Try to compress rdiph_rc into rdiph_rc_compressed */
-    compress_right_context_tree(dict2pid, rdiph_rc);
-    compress_left_right_context_tree(dict2pid);
-
-    ckd_free_3d(rdiph_rc);
+    /* Compress rdiph_rc into rssid */
+    for (b = 0; b < n_ci * n_ci; ++b)
+        dict2pid->rssid[b] = intern_xwd(dict2pid, rdiph_rc[b]);
+    ckd_free(rdiph_rc);
+    ckd_free(row);
+
+    /* Trim the pools, as new words rarely add much to them. */
+    dict2pid->n_rows_alloc = dict2pid->n_rows;
+    dict2pid->rows = ckd_realloc(dict2pid->rows, dict2pid->n_rows_alloc
+                                 * n_ci * sizeof(*dict2pid->rows));
+    dict2pid->row_xwd = ckd_realloc(dict2pid->row_xwd, dict2pid->n_rows_alloc
+                                    * sizeof(*dict2pid->row_xwd));
+    dict2pid->n_xwd_alloc = dict2pid->n_xwd;
+    dict2pid->xwd = ckd_realloc(dict2pid->xwd, dict2pid->n_xwd_alloc
+                                * sizeof(*dict2pid->xwd));
+
+    alloc = dict2pid->n_rows_alloc * (n_ci * sizeof(s3ssid_t) + sizeof(int32))
+        + dict2pid->row_hash_size * sizeof(int32)
+        + 4 * n_ci * n_ci * sizeof(int32)
+        + dict2pid->n_xwd_alloc * sizeof(xwdssid_t);
+    for (w = 0; w < dict2pid->n_xwd; ++w)
+        alloc += dict2pid->xwd[w].n_ssid * (sizeof(s3ssid_t) + sizeof(int16))
+            + n_ci * 2 * sizeof(s3cipid_t);
+    E_INFO("Allocated %d bytes (%d KiB) for %d distinct context rows "
+           "and %d compressed tables\n", (int)alloc, (int)alloc / 1024,
+           dict2pid->n_rows, dict2pid->n_xwd);
 
     dict2pid_report(dict2pid);
     return dict2pid;
@@ -506,22 +502,27 @@ dict2pid_retain(dict2pid_t *d2p)
 int
 dict2pid_free(dict2pid_t * d2p)
 {
+    int32 i;
+
     if (d2p == NULL)
         return 0;
     if (--d2p->refcount > 0)
         return d2p->refcount;
 
-    if (d2p->ldiph_lc)
-        ckd_free_3d((void ***) d2p->ldiph_lc);
-
-    if (d2p->lrdiph_rc)
-        ckd_free_3d((void ***) d2p->lrdiph_rc);
-
-    if (d2p->rssid)
-        free_compress_map(d2p->rssid, bin_mdef_n_ciphone(d2p->mdef));
-
-    if (d2p->lrssid)
-        free_compress_map(d2p->lrssid, bin_mdef_n_ciphone(d2p->mdef));
+    for (i = 0; i < d2p->n_xwd; ++i) {
+        ckd_free(d2p->xwd[i].ssid);
+        ckd_free(d2p->xwd[i].cimap);
+        ckd_free(d2p->xwd[i].rcfan);
+        ckd_free(d2p->xwd[i].rcfan_start);
+    }
+    ckd_free(d2p->xwd);
+    ckd_free(d2p->rssid);
+    ckd_free(d2p->lrssid);
+    ckd_free(d2p->ldiph_lc);
+    ckd_free(d2p->lrdiph_rc);
+    ckd_free(d2p->rows);
+    ckd_free(d2p->row_xwd);
+    ckd_free(d2p->row_hash);
 
     bin_mdef_free(d2p->mdef);
     dict_free(d2p->dict);
@@ -529,6 +530,30 @@ dict2pid_free(dict2pid_t * d2p)
     return 0;
 }
 
+size_t
+dict2pid_mem_size(dict2pid_t * d2p)
+{
+    size_t size;
+    int32 i;
+
+    size = sizeof(*d2p)
+        + d2p->n_rows_alloc * (d2p->n_ci * sizeof(*d2p->rows)
+                               + sizeof(*d2p->row_xwd))
+        + d2p->row_hash_size * sizeof(*d2p->row_hash)
+        + d2p->n_ci * d2p->n_ci * (sizeof(*d2p->ldiph_lc)
+                                   + sizeof(*d2p->lrdiph_rc)
+                                   + sizeof(*d2p->rssid)
+                                   + sizeof(*d2p->lrssid))
+        + d2p->n_xwd_alloc * sizeof(*d2p->xwd);
+    for (i = 0; i < d2p->n_xwd; ++i) {
+        xwdssid_t *x = &d2p->xwd[i];
+        size += x->n_ssid * sizeof(*x->ssid)
+            + d2p->n_ci * (sizeof(*x->cimap) + sizeof(*x->rcfan))
+            + (x->n_ssid + 1) * sizeof(*x->rcfan_start);
+    }
+    return size;
+}
+
 void
 dict2pid_report(dict2pid_t * d2p)
 {
@@ -557,8 +582,8 @@ dict2pid_dump(FILE * fp, dict2pid_t * d2p)
     for (b = 0; b < bin_mdef_n_ciphone(mdef); b++) {
         for (r = 0; r < bin_mdef_n_ciphone(mdef); r++) {
             for (l = 0; l < bin_mdef_n_ciphone(mdef); l++) {
-                if (IS_S3SSID(d2p->ldiph_lc[b][r][l]))
-                    fprintf(fp, "%6s %6s %6s %5d\n", bin_mdef_ciphone_str(mdef, (s3cipid_t) b), bin_mdef_ciphone_str(mdef, (s3cipid_t) r), bin_mdef_ciphone_str(mdef, (s3cipid_t) l), d2p->ldiph_lc[b][r][l]);      /* RAH, ldiph_lc is returning an int32, %d expects an int16 */
+                if (IS_S3SSID(dict2pid_ldiph_lc(d2p, b, r, l)))
+                    fprintf(fp, "%6s %6s %6s %5d\n", bin_mdef_ciphone_str(mdef, (s3cipid_t) b), bin_mdef_ciphone_str(mdef, (s3cipid_t) r), bin_mdef_ciphone_str(mdef, (s3cipid_t) l), dict2pid_ldiph_lc(d2p, b, r, l));      /* RAH, ldiph_lc is returning an int32, %d expects an int16 */
             }
         }
     }
@@ -74,6 +74,8 @@ typedef struct {
     s3ssid_t  *ssid;	/**< Senone Sequence ID list for all context ciphones */
     s3cipid_t *cimap;	/**< Index into ssid[] above for each ci phone */
     int32     n_ssid;	/**< #Unique ssid in above, compressed ssid list */
+    s3cipid_t *rcfan;	/**< Context ciphones grouped by their index in ssid[] */
+    int16     *rcfan_start; /**< Start of each group in rcfan[], n_ssid+1 entries */
 } xwdssid_t;
 
 /**
@@ -88,33 +90,44 @@ typedef struct {
                                    internal ssids on the fly. */
     dict_t *dict;               /**< Dictionary this table refers to. */
 
-    /*Notice the order of the arguments */
-    /* FIXME: This is crying out for compression - in Mandarin we have
-     * 180 context independent phones, which makes this an 11MB
-     * array. */
-    s3ssid_t ***ldiph_lc;	/**< For multi-phone words, [base][rc][lc] -> ssid; filled out for
-				   word-initial base x rc combinations in current vocabulary */
-
-
-    xwdssid_t **rssid;          /**< Right context state sequence id table 
-                                   First dimension: base phone,
-                                   Second dimension: left context. 
-                                */
+    int32 n_ci;                 /**< Number of CI phones (row length). */
 
+    /* All context tables are built from rows of n_ci ssids, one for
+     * each context phone.  Rows are hash-consed into a single pool,
+     * so that identical rows are stored once, and the first one
+     * (offset 0) is all BAD_S3SSID, standing for combinations which
+     * do not occur in the current vocabulary. */
+    s3ssid_t *rows;             /**< Pool of distinct context rows */
+    int32 n_rows;               /**< Number of rows in pool */
+    int32 n_rows_alloc;         /**< Number of rows allocated */
+    int32 *row_hash;            /**< Open-addressed index of rows (row + 1, or 0) */
+    int32 row_hash_size;        /**< Size of row_hash, a power of two */
+    int32 *row_xwd;             /**< Compressed table for each row, or -1 if none yet */
 
-    s3ssid_t ***lrdiph_rc;      /**< For single-phone words, [base][lc][rc] -> ssid; filled out for
-                                   single-phone base x lc combinations in current vocabulary */
-
-    xwdssid_t **lrssid;          /**< Left-Right context state sequence id table 
-                                    First dimension: base phone,
-                                    Second dimension: left context. 
-                                 */
+    /*Notice the order of the arguments */
+    int32 *ldiph_lc;            /**< For multi-phone words, [base][rc] -> offset of
+                                   row over lc; filled out for word-initial base x
+                                   rc combinations in current vocabulary */
+    int32 *lrdiph_rc;           /**< For single-phone words, [base][lc] -> offset of
+                                   row over rc; filled out for single-phone base x
+                                   lc combinations in current vocabulary */
+
+    xwdssid_t *xwd;             /**< Distinct compressed tables, the first one empty */
+    int32 n_xwd;                /**< Number of compressed tables */
+    int32 n_xwd_alloc;          /**< Number of compressed tables allocated */
+    int32 *rssid;               /**< Right context state sequence id table,
+                                   [base][lc] -> index in xwd */
+    int32 *lrssid;              /**< Left-Right context state sequence id table,
+                                   [base][lc] -> index in xwd */
 } dict2pid_t;
 
 /** Access macros; not designed for arbitrary use */
-#define dict2pid_rssid(d,ci,lc)  (&(d)->rssid[ci][lc])
-#define dict2pid_ldiph_lc(d,b,r,l) ((d)->ldiph_lc[b][r][l])
-#define dict2pid_lrdiph_rc(d,b,l,r) ((d)->lrdiph_rc[b][l][r])
+#define dict2pid_rssid(d,ci,lc)                                         \
+    (&(d)->xwd[(d)->rssid[(ci) * (d)->n_ci + (lc)]])
+#define dict2pid_ldiph_lc(d,b,r,l)                                      \
+    ((d)->rows[(d)->ldiph_lc[(b) * (d)->n_ci + (r)] + (l)])
+#define dict2pid_lrdiph_rc(d,b,l,r)                                     \
+    ((d)->rows[(d)->lrdiph_rc[(b) * (d)->n_ci + (l)] + (r)])
 
 /**
  * Build the dict2pid structure for the given model/dictionary
@@ -134,6 +147,12 @@ dict2pid_t *dict2pid_retain(dict2pid_t *d2p);
 int dict2pid_free(dict2pid_t *d2p /**< In: the d2p */
     );
 
+/**
+ * Get the number of bytes of heap memory used by the context tables.
+ */
+size_t dict2pid_mem_size(dict2pid_t *d2p /**< In: the d2p */
+    );
+
 /**
  * Return the senone sequence ID for the given word position.
  */
@@ -0,0 +1,355 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2017 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/* System headers */
+#include <string.h>
+#include <math.h>
+
+/* SphinxBase headers */
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+
+/* Local headers */
+#include "ext_mgau.h"
+
+static int ext_mgau_frame_eval(ps_mgau_t *ps,
+                               int16 *senscr,
+                               uint8 *senone_active,
+                               int32 n_senone_active,
+                               mfcc_t **feat,
+                               int32 frame,
+                               int32 compallsen);
+static int ext_mgau_frame_eval_batch(ps_mgau_t *ps,
+                                     int16 **senscr,
+                                     mfcc_t ***feat,
+                                     int32 frame,
+                                     int32 n_frame);
+static void ext_mgau_mem(ps_mgau_t *ps, ps_mem_t *out_mem);
+
+static ps_mgaufuncs_t ext_mgau_funcs = {
+    "external",
+    ext_mgau_frame_eval,       /* frame_eval */
+    ext_mgau_frame_eval_batch, /* frame_eval_batch */
+    NULL,                      /* transform */
+    NULL,                      /* share */
+    ext_mgau_free,             /* free */
+    PS_MGAU_NORM_BEST,         /* norm */
+    NULL,                      /* nearest */
+    ext_mgau_mem               /* mem */
+};
+
+/**
+ * Index of the last frame in the feature buffer.
+ */
+static int32
+ext_mgau_last_frame(ext_mgau_t *s)
+{
+    return s->acmod->output_frame + s->acmod->n_feat_frame - 1;
+}
+
+/**
+ * Number of frames from frame on whose right context is all there,
+ * or all frames that are left at the end of the utterance.
+ */
+static int32
+ext_mgau_n_ready(ext_mgau_t *s, int32 frame)
+{
+    int32 n;
+
+    n = ext_mgau_last_frame(s) - frame + 1;
+    if (s->acmod->state != ACMOD_ENDED)
+        n -= s->context;
+    if (n > s->batch)
+        n = s->batch;
+    return n;
+}
+
+/**
+ * Copy some frames from the feature buffer with their neighbours on
+ * either side, using the nearest frame there is for those outside it.
+ */
+static void
+ext_mgau_splice(ext_mgau_t *s, int32 frame, int32 n_frame, float32 *in)
+{
+    acmod_t *acmod = s->acmod;
+    int32 first, last, i, j, k;
+
+    first = acmod->output_frame - (acmod->n_feat_alloc - acmod->n_feat_frame);
+    if (first < 0)
+        first = 0;
+    last = ext_mgau_last_frame(s);
+    for (i = frame; i < frame + n_frame; ++i) {
+        for (j = i - s->context; j <= i + s->context; ++j) {
+            int f = j < first ? first : (j > last ? last : j);
+            /* Streams are stored one after the other in a frame. */
+            mfcc_t const *feat = acmod_get_frame(acmod, &f)[0];
+
+            for (k = 0; k < s->featlen; ++k)
+                *in++ = MFCC2FLOAT(feat[k]);
+        }
+    }
+}
+
+/**
+ * Turn log-likelihoods into senone scores relative to the best in
+ * each frame.
+ */
+static void
+ext_mgau_norm(ext_mgau_t *s, float32 const *out, int16 **senscr,
+              int32 n_frame)
+{
+    int32 i, k;
+
+    for (i = 0; i < n_frame; ++i, out += s->n_sen) {
+        float32 best = out[0];
+
+        for (k = 1; k < s->n_sen; ++k)
+            if (out[k] > best)
+                best = out[k];
+        for (k = 0; k < s->n_sen; ++k) {
+            float64 scr = (best - out[k]) * s->scale + 0.5;
+            senscr[i][k] = scr > 32767 ? 32767 : (int16)scr;
+        }
+    }
+}
+
+static int
+ext_mgau_worker_main(sbthread_t *th)
+{
+    ext_mgau_t *s = sbthread_arg(th);
+
+    while (sbevent_wait(s->start, -1, -1) == 0) {
+        if (s->exiting)
+            break;
+        s->ahead_rv = (*s->funcs->score)(s->data, s->ahead_in, s->ahead_n,
+                                         s->in_dim, s->ahead_out, s->n_sen);
+        sbevent_signal(s->done);
+    }
+    return 0;
+}
+
+/**
+ * Wait for the look-ahead job, if there is one, so the scorer can be
+ * called from this thread.
+ */
+static void
+ext_mgau_wait(ext_mgau_t *s)
+{
+    if (!s->ahead_busy)
+        return;
+    sbevent_wait(s->done, -1, -1);
+    s->ahead_busy = FALSE;
+}
+
+/**
+ * Start scoring the frames from frame on in the look-ahead thread, if
+ * any of them are ready.
+ */
+static void
+ext_mgau_ahead(ext_mgau_t *s, int32 frame)
+{
+    int32 n;
+
+    s->ahead_frame = -1;
+    if (s->thr == NULL || (n = ext_mgau_n_ready(s, frame)) < 1)
+        return;
+    ext_mgau_splice(s, frame, n, s->ahead_in);
+    s->ahead_frame = frame;
+    s->ahead_n = n;
+    s->ahead_busy = TRUE;
+    sbevent_signal(s->start);
+}
+
+static int
+ext_mgau_score(ext_mgau_t *s, int16 **senscr, int32 frame, int32 n_frame)
+{
+    ext_mgau_wait(s);
+    ext_mgau_splice(s, frame, n_frame, s->in);
+    if ((*s->funcs->score)(s->data, s->in, n_frame,
+                           s->in_dim, s->out, s->n_sen) < 0) {
+        E_ERROR("External scorer %s failed at frame %d\n",
+                s->funcs->name, frame);
+        return -1;
+    }
+    ext_mgau_norm(s, s->out, senscr, n_frame);
+    return n_frame;
+}
+
+static int
+ext_mgau_frame_eval(ps_mgau_t *ps,
+                    int16 *senscr,
+                    uint8 *senone_active,
+                    int32 n_senone_active,
+                    mfcc_t **feat,
+                    int32 frame,
+                    int32 compallsen)
+{
+    ext_mgau_t *s = (ext_mgau_t *)ps;
+    int rv;
+
+    /* The scorer gives all senones anyway.  Frames scored ahead are
+     * dropped, as this may be another utterance. */
+    rv = ext_mgau_score(s, &senscr, frame, 1);
+    s->ahead_frame = -1;
+    return rv < 0 ? -1 : 0;
+}
+
+static int
+ext_mgau_frame_eval_batch(ps_mgau_t *ps,
+                          int16 **senscr,
+                          mfcc_t ***feat,
+                          int32 frame,
+                          int32 n_frame)
+{
+    ext_mgau_t *s = (ext_mgau_t *)ps;
+    int32 n;
+
+    /* Take the frames scored ahead if they are the ones wanted. */
+    if (s->ahead_frame == frame) {
+        ext_mgau_wait(s);
+        if (s->ahead_rv >= 0) {
+            n = s->ahead_n;
+            if (n > n_frame)
+                n = n_frame;
+            ext_mgau_norm(s, s->ahead_out, senscr, n);
+            ext_mgau_ahead(s, frame + n);
+            return n;
+        }
+    }
+
+    /* Otherwise score only those with their right context, apart from
+     * the first, which the search is waiting for. */
+    n = ext_mgau_n_ready(s, frame);
+    if (n > n_frame)
+        n = n_frame;
+    if (n < 1)
+        n = 1;
+    if ((n = ext_mgau_score(s, senscr, frame, n)) < 0) {
+        s->ahead_frame = -1;
+        return -1;
+    }
+    ext_mgau_ahead(s, frame + n);
+    return n;
+}
+
+static void
+ext_mgau_mem(ps_mgau_t *ps, ps_mem_t *out_mem)
+{
+    ext_mgau_t *s = (ext_mgau_t *)ps;
+    size_t size;
+
+    /* Not counting whatever the scorer has. */
+    size = s->batch * (s->in_dim + s->n_sen) * sizeof(float32);
+    if (s->thr)
+        size *= 2;
+    out_mem->heap += sizeof(*s) + size;
+}
+
+ps_mgau_t *
+ext_mgau_init(acmod_t *acmod, ps_scorer_funcs_t const *funcs,
+              void *data, int context, int batch, int lookahead)
+{
+    ext_mgau_t *s;
+
+    if (context < 0 || batch < 1) {
+        E_ERROR("Invalid context %d or batch size %d for external scorer\n",
+                context, batch);
+        if (funcs->free)
+            (*funcs->free)(data);
+        return NULL;
+    }
+
+    s = ckd_calloc(1, sizeof(*s));
+    s->base.vt = &ext_mgau_funcs;
+    s->acmod = acmod;
+    s->funcs = funcs;
+    s->data = data;
+    s->context = context;
+    s->batch = batch;
+    s->featlen = feat_dimension(acmod->fcb);
+    s->in_dim = (2 * context + 1) * s->featlen;
+    s->n_sen = bin_mdef_n_sen(acmod->mdef);
+    /* Senone scores are in logmath units, shifted down. */
+    s->scale = 1.0 / (log(logmath_get_base(acmod->lmath))
+                      * (1 << SENSCR_SHIFT));
+    s->in = ckd_calloc(batch * s->in_dim, sizeof(*s->in));
+    s->out = ckd_calloc(batch * s->n_sen, sizeof(*s->out));
+    s->ahead_frame = -1;
+
+    if (lookahead) {
+        s->ahead_in = ckd_calloc(batch * s->in_dim, sizeof(*s->ahead_in));
+        s->ahead_out = ckd_calloc(batch * s->n_sen, sizeof(*s->ahead_out));
+        if ((s->start = sbevent_init()) == NULL
+            || (s->done = sbevent_init()) == NULL
+            || (s->thr = sbthread_start(NULL, ext_mgau_worker_main, s)) == NULL) {
+            E_ERROR("Failed to start look-ahead thread for external scorer\n");
+            ext_mgau_free(ps_mgau_base(s));
+            return NULL;
+        }
+    }
+    E_INFO("Using external scorer %s, %d frames of context, "
+           "up to %d frames at once%s\n", funcs->name, context, batch,
+           lookahead ? " with look-ahead" : "");
+
+    return ps_mgau_base(s);
+}
+
+void
+ext_mgau_free(ps_mgau_t *ps)
+{
+    ext_mgau_t *s = (ext_mgau_t *)ps;
+
+    if (s == NULL)
+        return;
+    if (s->thr) {
+        ext_mgau_wait(s);
+        s->exiting = TRUE;
+        sbevent_signal(s->start);
+        sbthread_free(s->thr);
+    }
+    if (s->start)
+        sbevent_free(s->start);
+    if (s->done)
+        sbevent_free(s->done);
+    if (s->funcs->free)
+        (*s->funcs->free)(s->data);
+    ckd_free(s->in);
+    ckd_free(s->out);
+    ckd_free(s->ahead_in);
+    ckd_free(s->ahead_out);
+    ckd_free(s);
+}
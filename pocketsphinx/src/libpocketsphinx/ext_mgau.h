@@ -0,0 +1,93 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2017 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file ext_mgau.h Senone scores from an external scorer.
+ * This wraps a ps_scorer_funcs_t given with ps_set_scorer() as an
+ * acoustic model, splicing the frames it is given with their
+ * neighbours from the feature buffer, and turning its log-likelihoods
+ * into senone scores.
+ */
+
+#ifndef __EXT_MGAU_H__
+#define __EXT_MGAU_H__
+
+/* SphinxBase headers. */
+#include <sphinxbase/sbthread.h>
+
+/* Local headers. */
+#include "acmod.h"
+
+typedef struct ext_mgau_s {
+    ps_mgau_t base;     /**< base structure. */
+    acmod_t *acmod;     /**< Acoustic model whose features are scored */
+    ps_scorer_funcs_t const *funcs; /**< Scoring functions */
+    void *data;         /**< Argument to them */
+    int32 context;      /**< Frames spliced on either side */
+    int32 batch;        /**< Most frames scored in one call */
+    int32 featlen;      /**< Length of one feature vector */
+    int32 in_dim;       /**< Length of a spliced frame */
+    int32 n_sen;        /**< Number of senones */
+    float64 scale;      /**< Senone score units per nat */
+
+    float32 *in;        /**< Spliced frames for the calling thread */
+    float32 *out;       /**< Log-likelihoods for the calling thread */
+
+    /* Look-ahead: the next frames are scored by a separate thread
+     * while the search goes through the current ones. */
+    sbthread_t *thr;    /**< Look-ahead thread, or NULL for none */
+    sbevent_t *start;   /**< Signalled when a job is ready */
+    sbevent_t *done;    /**< Signalled when a job is finished */
+    float32 *ahead_in;  /**< Spliced frames for the look-ahead job */
+    float32 *ahead_out; /**< Log-likelihoods from the look-ahead job */
+    int32 ahead_frame;  /**< First frame of the job, or -1 for none */
+    int32 ahead_n;      /**< Number of frames in the job */
+    int32 ahead_rv;     /**< Return value of the job */
+    int32 ahead_busy;   /**< Whether the job has yet to be waited for */
+    int32 exiting;      /**< Tells the thread to exit */
+} ext_mgau_t;
+
+/**
+ * Wrap an external scorer for an acoustic model.
+ *
+ * @return the new model, or NULL on failure, in which case data has
+ *         been freed.
+ */
+ps_mgau_t *ext_mgau_init(acmod_t *acmod, ps_scorer_funcs_t const *funcs,
+                         void *data, int context, int batch, int lookahead);
+void ext_mgau_free(ps_mgau_t *s);
+
+#endif /* __EXT_MGAU_H__ */
@@ -50,6 +50,7 @@
 
 /* System headers. */
 #include <assert.h>
+#include <stdlib.h>
 
 /* SphinxBase headers. */
 #include <sphinxbase/prim_type.h>
@@ -70,19 +71,7 @@ fsg_history_init(fsg_model_t * fsg, dict_t *dict)
     fsg_history_t *h;
 
     h = (fsg_history_t *) ckd_calloc(1, sizeof(fsg_history_t));
-    h->fsg = fsg;
-    h->entries = blkarray_list_init();
-
-    if (fsg && dict) {
-        h->n_ciphone = bin_mdef_n_ciphone(dict->mdef);
-        h->frame_entries =
-            (glist_t **) ckd_calloc_2d(fsg_model_n_state(fsg),
-                                       bin_mdef_n_ciphone(dict->mdef),
-                                       sizeof(**h->frame_entries));
-    }
-    else {
-        h->frame_entries = NULL;
-    }
+    fsg_history_set_fsg(h, fsg, dict);
 
     return h;
 }
@@ -90,48 +79,108 @@ fsg_history_init(fsg_model_t * fsg, dict_t *dict)
 void
 fsg_history_free(fsg_history_t *h)
 {
-    int32 s, lc, ns, np;
-    gnode_t *gn;
-
-    if (h->fsg) {
-        ns = fsg_model_n_state(h->fsg);
-        np = h->n_ciphone;
-
-        for (s = 0; s < ns; s++) {
-            for (lc = 0; lc < np; lc++) {
-                for (gn = h->frame_entries[s][lc]; gn; gn = gnode_next(gn)) {
-                    ckd_free(gnode_ptr(gn));
-                }
-                glist_free(h->frame_entries[s][lc]);
-            }
-        }
-    }
-    ckd_free_2d(h->frame_entries);
-    blkarray_list_free(h->entries);
+    int32 i;
+
+    for (i = 0; i < h->n_blocks; i++)
+        ckd_free(h->blocks[i]);
+    ckd_free(h->blocks);
+    ckd_free(h->frame_entries);
+    ckd_free(h->frame_next);
+    ckd_free(h->frame_heads);
+    ckd_free(h->active);
+    ckd_free(h->frame_keep);
     ckd_free(h);
 }
 
 
+size_t
+fsg_history_mem_size(fsg_history_t *h)
+{
+    size_t size;
+
+    size = sizeof(*h)
+        + h->n_blocks * FSG_HIST_BLKSIZE * sizeof(fsg_hist_entry_t)
+        + h->n_blocks_alloc * sizeof(*h->blocks)
+        + h->n_frame_alloc * (sizeof(*h->frame_entries)
+                              + sizeof(*h->frame_next))
+        + h->n_active_alloc * sizeof(*h->active);
+    if (h->frame_keep)
+        size += h->n_frame_alloc * sizeof(*h->frame_keep);
+    if (h->frame_heads && h->fsg)
+        size += fsg_model_n_state(h->fsg) * h->n_ciphone
+            * sizeof(*h->frame_heads);
+    return size;
+}
+
+
 void
 fsg_history_set_fsg(fsg_history_t *h, fsg_model_t *fsg, dict_t *dict)
 {
-    if (blkarray_list_n_valid(h->entries) != 0) {
+    int32 i, n;
+
+    if (h->n_entries != 0) {
         E_WARN("Switching FSG while history not empty; history cleared\n");
-        blkarray_list_reset(h->entries);
+        h->n_entries = 0;
     }
+    h->n_frame_entries = 0;
+    h->n_active = 0;
 
-    if (h->frame_entries)
-        ckd_free_2d((void **) h->frame_entries);
-    h->frame_entries = NULL;
+    ckd_free(h->frame_heads);
+    h->frame_heads = NULL;
     h->fsg = fsg;
 
     if (fsg && dict) {
         h->n_ciphone = bin_mdef_n_ciphone(dict->mdef);
-        h->frame_entries =
-            (glist_t **) ckd_calloc_2d(fsg_model_n_state(fsg),
-                                       bin_mdef_n_ciphone(dict->mdef),
-                                       sizeof(glist_t));
+        n = fsg_model_n_state(fsg) * h->n_ciphone;
+        h->frame_heads = ckd_malloc(n * sizeof(*h->frame_heads));
+        for (i = 0; i < n; i++)
+            h->frame_heads[i] = -1;
+    }
+}
+
+
+void
+fsg_history_set_max(fsg_history_t *h, int32 max_entries)
+{
+    int32 n_blocks;
+
+    h->max_entries = max_entries;
+    if (max_entries <= 0) {
+        h->max_entries = 0;
+        return;
+    }
+    n_blocks = (max_entries + FSG_HIST_BLKSIZE - 1) / FSG_HIST_BLKSIZE;
+    if (n_blocks > h->n_blocks_alloc) {
+        h->n_blocks_alloc = n_blocks;
+        h->blocks = ckd_realloc(h->blocks, h->n_blocks_alloc
+                                * sizeof(*h->blocks));
+    }
+    while (h->n_blocks < n_blocks)
+        h->blocks[h->n_blocks++] = ckd_malloc(FSG_HIST_BLKSIZE
+                                              * sizeof(**h->blocks));
+    if (h->n_frame_alloc > 0)
+        h->frame_keep = ckd_realloc(h->frame_keep, h->n_frame_alloc
+                                    * sizeof(*h->frame_keep));
+}
+
+
+/* Append an entry to the history table. */
+static void
+fsg_history_append(fsg_history_t *h, fsg_hist_entry_t const *entry)
+{
+    int32 blk = h->n_entries / FSG_HIST_BLKSIZE;
+
+    if (blk == h->n_blocks) {
+        if (h->n_blocks == h->n_blocks_alloc) {
+            h->n_blocks_alloc = h->n_blocks_alloc ? h->n_blocks_alloc * 2 : 16;
+            h->blocks = ckd_realloc(h->blocks, h->n_blocks_alloc
+                                    * sizeof(*h->blocks));
+        }
+        h->blocks[h->n_blocks++] = ckd_malloc(FSG_HIST_BLKSIZE
+                                              * sizeof(**h->blocks));
     }
+    h->blocks[blk][h->n_entries % FSG_HIST_BLKSIZE] = *entry;
+    ++h->n_entries;
 }
 
 
@@ -142,30 +191,29 @@ fsg_history_entry_add(fsg_history_t * h,
                       int32 lc, fsg_pnode_ctxt_t rc)
 {
     fsg_hist_entry_t *entry, *new_entry;
-    int32 s;
-    gnode_t *gn, *prev_gn;
+    int32 s, b, e, prev_e, new_e;
 
     /* Skip the optimization for the initial dummy entries; always enter them */
     if (frame < 0) {
-        new_entry =
-            (fsg_hist_entry_t *) ckd_calloc(1, sizeof(fsg_hist_entry_t));
-        new_entry->fsglink = link;
-        new_entry->frame = frame;
-        new_entry->score = score;
-        new_entry->pred = pred;
-        new_entry->lc = lc;
-        new_entry->rc = rc;
-
-        blkarray_list_append(h->entries, (void *) new_entry);
+        fsg_hist_entry_t root;
+
+        root.fsglink = link;
+        root.frame = frame;
+        root.score = score;
+        root.pred = pred;
+        root.lc = lc;
+        root.rc = rc;
+        fsg_history_append(h, &root);
         return;
     }
 
     s = fsg_link_to_state(link);
+    b = s * h->n_ciphone + lc;
 
-    /* Locate where this entry should be inserted in frame_entries[s][lc] */
-    prev_gn = NULL;
-    for (gn = h->frame_entries[s][lc]; gn; gn = gnode_next(gn)) {
-        entry = (fsg_hist_entry_t *) gnode_ptr(gn);
+    /* Locate where this entry should be inserted in list (s,lc) */
+    prev_e = -1;
+    for (e = h->frame_heads[b]; e != -1; e = h->frame_next[e]) {
+        entry = &h->frame_entries[e];
 
         if (score BETTER_THAN entry->score)
             break;              /* Found where to insert new entry */
@@ -174,12 +222,22 @@ fsg_history_entry_add(fsg_history_t * h,
         if (FSG_PNODE_CTXT_SUB(&rc, &(entry->rc)) == 0)
             return;             /* rc set reduced to 0; new entry can be ignored */
 
-        prev_gn = gn;
+        prev_e = e;
     }
 
-    /* Create new entry after prev_gn (if prev_gn is NULL, at head) */
-    new_entry =
-        (fsg_hist_entry_t *) ckd_calloc(1, sizeof(fsg_hist_entry_t));
+    /* Create new entry after prev_e (if prev_e is -1, at head) */
+    if (h->n_frame_entries == h->n_frame_alloc) {
+        h->n_frame_alloc = h->n_frame_alloc ? h->n_frame_alloc * 2 : 256;
+        h->frame_entries = ckd_realloc(h->frame_entries, h->n_frame_alloc
+                                       * sizeof(*h->frame_entries));
+        h->frame_next = ckd_realloc(h->frame_next, h->n_frame_alloc
+                                    * sizeof(*h->frame_next));
+        if (h->max_entries > 0)
+            h->frame_keep = ckd_realloc(h->frame_keep, h->n_frame_alloc
+                                        * sizeof(*h->frame_keep));
+    }
+    new_e = h->n_frame_entries++;
+    new_entry = &h->frame_entries[new_e];
     new_entry->fsglink = link;
     new_entry->frame = frame;
     new_entry->score = score;
@@ -187,34 +245,105 @@ fsg_history_entry_add(fsg_history_t * h,
     new_entry->lc = lc;
     new_entry->rc = rc;         /* Note: rc set must be non-empty at this point */
 
-    if (!prev_gn) {
-        h->frame_entries[s][lc] = glist_add_ptr(h->frame_entries[s][lc],
-                                                (void *) new_entry);
-        prev_gn = h->frame_entries[s][lc];
+    if (prev_e == -1) {
+        if (h->frame_heads[b] == -1) {
+            /* First use of this list in the frame. */
+            if (h->n_active == h->n_active_alloc) {
+                h->n_active_alloc = h->n_active_alloc ? h->n_active_alloc * 2 : 64;
+                h->active = ckd_realloc(h->active, h->n_active_alloc
+                                        * sizeof(*h->active));
+            }
+            h->active[h->n_active++] = b;
+        }
+        h->frame_heads[b] = new_e;
     }
     else
-        prev_gn = glist_insert_ptr(prev_gn, (void *) new_entry);
+        h->frame_next[prev_e] = new_e;
+    h->frame_next[new_e] = e;
+    prev_e = new_e;
 
     /*
      * Update the rc set of all the remaining entries in the list.  At this
-     * point, gn is the entry, if any, immediately following new entry.
+     * point, e is the entry, if any, immediately following new entry.
+     * Pruned entries are simply unlinked; their space in the pool is
+     * reclaimed at the end of the frame.
      */
-    while (gn) {
-        entry = (fsg_hist_entry_t *) gnode_ptr(gn);
+    while (e != -1) {
+        entry = &h->frame_entries[e];
 
         if (FSG_PNODE_CTXT_SUB(&(entry->rc), &rc) == 0) {
             /* rc set of entry reduced to 0; can prune this entry */
-            ckd_free((void *) entry);
-            gn = gnode_free(gn, prev_gn);
+            e = h->frame_next[prev_e] = h->frame_next[e];
         }
         else {
-            prev_gn = gn;
-            gn = gnode_next(gn);
+            prev_e = e;
+            e = h->frame_next[e];
         }
     }
 }
 
 
+static int
+cmp_bucket(const void *a, const void *b)
+{
+    return *(const int32 *)a - *(const int32 *)b;
+}
+
+static int
+cmp_score_desc(const void *a, const void *b)
+{
+    int32 sa = *(const int32 *)a, sb = *(const int32 *)b;
+
+    return (sa < sb) - (sa > sb);
+}
+
+/*
+ * Decide which of this frame's surviving entries fit in a fixed size
+ * table, setting frame_keep[e] for each entry e (whose lists must be
+ * in order already).  Returns the number which do not fit.
+ */
+static int32
+fsg_history_prune_frame(fsg_history_t *h)
+{
+    int32 i, e, n, room, thresh, n_at_thresh;
+
+    n = 0;
+    for (i = 0; i < h->n_active; i++)
+        for (e = h->frame_heads[h->active[i]]; e != -1; e = h->frame_next[e])
+            h->frame_keep[n++] = h->frame_entries[e].score;
+    room = h->max_entries - h->n_entries;
+    if (n <= room) {
+        for (i = 0; i < h->n_frame_entries; i++)
+            h->frame_keep[i] = TRUE;
+        return 0;
+    }
+
+    /* Keep the best room entries, ties going to the first ones. */
+    thresh = WORST_SCORE;
+    n_at_thresh = 0;
+    if (room > 0) {
+        qsort(h->frame_keep, n, sizeof(*h->frame_keep), cmp_score_desc);
+        thresh = h->frame_keep[room - 1];
+        for (i = room - 1; i >= 0 && h->frame_keep[i] == thresh; --i)
+            ++n_at_thresh;
+    }
+    for (i = 0; i < h->n_active; i++) {
+        for (e = h->frame_heads[h->active[i]]; e != -1; e = h->frame_next[e]) {
+            int32 score = h->frame_entries[e].score;
+
+            if (room > 0 && score BETTER_THAN thresh)
+                h->frame_keep[e] = TRUE;
+            else if (room > 0 && score == thresh && n_at_thresh > 0) {
+                h->frame_keep[e] = TRUE;
+                --n_at_thresh;
+            }
+            else
+                h->frame_keep[e] = FALSE;
+        }
+    }
+    return n - room;
+}
+
 /*
  * Transfer the surviving history entries for this frame into the permanent
  * history table.
@@ -222,63 +351,60 @@ fsg_history_entry_add(fsg_history_t * h,
 void
 fsg_history_end_frame(fsg_history_t * h)
 {
-    int32 s, lc, ns, np;
-    gnode_t *gn;
-    fsg_hist_entry_t *entry;
-
-    ns = fsg_model_n_state(h->fsg);
-    np = h->n_ciphone;
-
-    for (s = 0; s < ns; s++) {
-        for (lc = 0; lc < np; lc++) {
-            for (gn = h->frame_entries[s][lc]; gn; gn = gnode_next(gn)) {
-                entry = (fsg_hist_entry_t *) gnode_ptr(gn);
-                blkarray_list_append(h->entries, (void *) entry);
-            }
-
-            glist_free(h->frame_entries[s][lc]);
-            h->frame_entries[s][lc] = NULL;
-        }
+    int32 i, e;
+
+    /* Transfer in order of state and left context, as if all of the
+     * lists were scanned. */
+    if (h->n_active > 0)
+        qsort(h->active, h->n_active, sizeof(*h->active), cmp_bucket);
+    if (h->max_entries > 0) {
+        int32 n_pruned = fsg_history_prune_frame(h);
+
+        if (n_pruned > 0 && h->n_pruned == 0)
+            E_WARN("History table full (%d entries), pruning word exits\n",
+                   h->max_entries);
+        h->n_pruned += n_pruned;
+    }
+    for (i = 0; i < h->n_active; i++) {
+        for (e = h->frame_heads[h->active[i]]; e != -1; e = h->frame_next[e])
+            if (h->max_entries == 0 || h->frame_keep[e])
+                fsg_history_append(h, &h->frame_entries[e]);
+        h->frame_heads[h->active[i]] = -1;
     }
+    h->n_active = 0;
+    h->n_frame_entries = 0;
 }
 
 
 fsg_hist_entry_t *
 fsg_history_entry_get(fsg_history_t * h, int32 id)
 {
-    return ((fsg_hist_entry_t *) blkarray_list_get(h->entries, id));
+    if (id < 0 || id >= h->n_entries)
+        return NULL;
+    return &h->blocks[id / FSG_HIST_BLKSIZE][id % FSG_HIST_BLKSIZE];
 }
 
 
 void
 fsg_history_reset(fsg_history_t * h)
 {
-    blkarray_list_reset(h->entries);
+    h->n_entries = 0;
+    h->n_pruned = 0;
 }
 
 
 int32
 fsg_history_n_entries(fsg_history_t * h)
 {
-    return (blkarray_list_n_valid(h->entries));
+    return h->n_entries;
 }
 
 void
 fsg_history_utt_start(fsg_history_t * h)
 {
-    int32 s, lc, ns, np;
-
-    assert(blkarray_list_n_valid(h->entries) == 0);
-    assert(h->frame_entries);
-
-    ns = fsg_model_n_state(h->fsg);
-    np = h->n_ciphone;
-
-    for (s = 0; s < ns; s++) {
-        for (lc = 0; lc < np; lc++) {
-            assert(h->frame_entries[s][lc] == NULL);
-        }
-    }
+    assert(h->n_entries == 0);
+    assert(h->frame_heads);
+    assert(h->n_active == 0);
 }
 
 void
@@ -291,7 +417,7 @@ fsg_history_print(fsg_history_t *h, dict_t *dict)
 {
     int bpidx, bp;
     
-    for (bpidx = 0; bpidx < blkarray_list_n_valid(h->entries); bpidx++) {
+    for (bpidx = 0; bpidx < h->n_entries; bpidx++) {
         bp = bpidx;
         printf("History entry: ");
         while (bp > 0) {
@@ -80,7 +80,6 @@
 #include <sphinxbase/fsg_model.h>
 
 /* Local headers. */
-#include "blkarray_list.h"
 #include "fsg_lextree.h"
 #include "dict.h"
 
@@ -139,15 +138,41 @@ typedef struct fsg_hist_entry_s {
  * empty, it is also discarded.
  * As mentioned earlier, this procedure is applied in two stages, for the
  * non-null transitions, and the null transitions, separately.
+ * The lists are threaded by index through a pool of entries for the
+ * current frame, and only the (s,lc) buckets actually used in the frame are
+ * visited at its end, so the cost of a frame depends on the number of
+ * active states rather than the size of the FSG.  Neither the pool nor
+ * the permanent table is freed between utterances.
+ * The permanent table can also be given a fixed size, allocated up front,
+ * in which case only the best scoring entries of a frame which does not
+ * fit are kept.
  */
 typedef struct fsg_history_s {
     fsg_model_t *fsg;		/* The FSG for which this object applies */
-    blkarray_list_t *entries;	/* A list of history table entries; the root
-				   entry is the first element of the list */
-    glist_t **frame_entries;
+    fsg_hist_entry_t **blocks;	/* History table entries, in blocks of
+				   FSG_HIST_BLKSIZE; the root entry is the
+				   first one */
+    int32 n_blocks;		/* Blocks allocated */
+    int32 n_blocks_alloc;	/* Size of blocks[] */
+    int32 n_entries;		/* Entries in the history table */
+
+    fsg_hist_entry_t *frame_entries; /* Entries created in the current frame */
+    int32 *frame_next;		/* Next entry in the same (s,lc) list, or -1 */
+    int32 n_frame_entries;
+    int32 n_frame_alloc;
+    int32 *frame_heads;		/* First entry of each (s,lc) list, or -1 */
+    int32 *active;		/* (s,lc) lists used in the current frame */
+    int32 n_active;
+    int32 n_active_alloc;
+    int32 *frame_keep;		/* Scores (then entries) to keep at the end of
+				   a frame which does not fit, n_frame_alloc */
+    int32 max_entries;		/* Fixed size of the table, or 0 */
+    int32 n_pruned;		/* Entries which did not fit this utterance */
     int n_ciphone;
 } fsg_history_t;
 
+#define FSG_HIST_BLKSIZE	4096
+
 
 /*
  * One-time intialization: Allocate and return an initially empty history
@@ -155,6 +180,13 @@ typedef struct fsg_history_s {
  */
 fsg_history_t *fsg_history_init(fsg_model_t *fsg, dict_t *dict);
 
+/*
+ * Give the history table a fixed size of max_entries, allocated now, or
+ * let it grow as needed if max_entries is 0.  Entries which do not fit
+ * are pruned at the end of each frame, worst scoring first.
+ */
+void fsg_history_set_max(fsg_history_t *h, int32 max_entries);
+
 void fsg_history_utt_start(fsg_history_t *h);
 
 void fsg_history_utt_end(fsg_history_t *h);
@@ -186,7 +218,7 @@ void fsg_history_entry_add (fsg_history_t *h,
 void fsg_history_end_frame (fsg_history_t *h);
 
 
-/* Clear the hitory table */
+/* Clear the hitory table (keeping its memory for the next utterance) */
 void fsg_history_reset (fsg_history_t *h);
 
 
@@ -209,6 +241,9 @@ void fsg_history_set_fsg (fsg_history_t *h, fsg_model_t *fsg, dict_t *dict);
 /* Free the given Viterbi search history object */
 void fsg_history_free (fsg_history_t *h);
 
+/* Heap memory used by the given Viterbi search history object */
+size_t fsg_history_mem_size (fsg_history_t *h);
+
 /* Print the entire history */
 void fsg_history_print(fsg_history_t *h, dict_t *dict);
 				     
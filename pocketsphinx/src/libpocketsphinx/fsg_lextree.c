@@ -40,10 +40,12 @@
 
 /* System headers. */
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
 /* SphinxBase headers. */
+#include <sphinxbase/bio.h>
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/err.h>
 
@@ -290,17 +292,535 @@ fsg_lextree_free(fsg_lextree_t * lextree)
     if (lextree == NULL)
         return;
 
-    if (lextree->fsg)
+    if (lextree->pnodes) {
+        for (s = 0; s < lextree->n_pnode; s++)
+            hmm_deinit(&lextree->pnodes[s].hmm);
+        ckd_free(lextree->pnodes);
+    }
+    else if (lextree->fsg)
         for (s = 0; s < fsg_model_n_state(lextree->fsg); s++)
             fsg_psubtree_free(lextree->alloc_head[s]);
 
-    ckd_free_2d(lextree->lc);
-    ckd_free_2d(lextree->rc);
+    if (lextree->filemap || lextree->buf) {
+        ckd_free_2d_ptr(lextree->lc);
+        ckd_free_2d_ptr(lextree->rc);
+        if (lextree->filemap)
+            mmio_file_unmap(lextree->filemap);
+        ckd_free(lextree->buf);
+    }
+    else {
+        ckd_free_2d(lextree->lc);
+        ckd_free_2d(lextree->rc);
+    }
     ckd_free(lextree->root);
     ckd_free(lextree->alloc_head);
     ckd_free(lextree);
 }
 
+size_t
+fsg_lextree_mem_size(fsg_lextree_t *lextree, size_t *out_mapped)
+{
+    int32 n_state = fsg_model_n_state(lextree->fsg);
+    size_t heap, ctx;
+
+    heap = sizeof(*lextree)
+        + lextree->n_pnode * sizeof(fsg_pnode_t)
+        + 2 * n_state * sizeof(fsg_pnode_t *)
+        + 2 * n_state * sizeof(int16 *);
+    ctx = 2 * n_state * (bin_mdef_n_ciphone(lextree->mdef) + 1)
+        * sizeof(int16);
+    if (lextree->filemap)
+        *out_mapped += ctx;
+    else
+        heap += ctx;
+    return heap;
+}
+
+/***************************************
+ * Binary lextree files start here.
+ *
+ * After the header, the file contains, each aligned to
+ * FSG_LEXTREE_ALIGN bytes from the end of the header: the dimensions,
+ * the lc and rc tables as written by fsg_lextree_lc_rc(), the index
+ * of the first pnode of each state (plus one past the last), the
+ * index of the root of each state (-1 for none), and the pnodes
+ * themselves, with pointers replaced by indices.
+ ***************************************/
+
+#define FSG_LEXTREE_VERSION "1.0"
+#define FSG_LEXTREE_ALIGN 8
+#define FSG_LEXTREE_PAD(n) (((n) + FSG_LEXTREE_ALIGN - 1) \
+                            & ~(size_t)(FSG_LEXTREE_ALIGN - 1))
+#define FSG_LEXTREE_FNV_BASIS 2166136261U
+
+enum {
+    FSG_LEXTREE_N_STATE,
+    FSG_LEXTREE_N_CI,
+    FSG_LEXTREE_N_PNODE,
+    FSG_LEXTREE_N_DIMS
+};
+
+/* A pnode as stored in a file. */
+typedef struct fsg_pnode_rec_s {
+    int32 next;         /**< First successor, or destination state of a leaf. */
+    int32 sibling;      /**< Next sibling, or -1. */
+    int32 wid;          /**< FSG word ID of a leaf, or -1. */
+    int32 logs2prob;
+    int32 ssid;
+    int32 tmatid;
+    fsg_pnode_ctxt_t ctxt;
+    uint16 ci_ext;
+    uint8 ppos;
+    uint8 leaf;
+} fsg_pnode_rec_t;
+
+/* Offsets of the arrays from the dimensions, and the end of the last. */
+typedef struct fsg_lextree_layout_s {
+    size_t lc_off, rc_off, start_off, root_off, pnode_off, end;
+} fsg_lextree_layout_t;
+
+static void
+fsg_lextree_layout(int32 const *dims, fsg_lextree_layout_t *lay)
+{
+    size_t ctxsize = (size_t)dims[FSG_LEXTREE_N_STATE]
+        * (dims[FSG_LEXTREE_N_CI] + 1) * sizeof(int16);
+
+    lay->lc_off = FSG_LEXTREE_PAD(FSG_LEXTREE_N_DIMS * sizeof(int32));
+    lay->rc_off = FSG_LEXTREE_PAD(lay->lc_off + ctxsize);
+    lay->start_off = FSG_LEXTREE_PAD(lay->rc_off + ctxsize);
+    lay->root_off = FSG_LEXTREE_PAD(lay->start_off
+                                    + (dims[FSG_LEXTREE_N_STATE] + 1)
+                                    * sizeof(int32));
+    lay->pnode_off = FSG_LEXTREE_PAD(lay->root_off
+                                     + dims[FSG_LEXTREE_N_STATE]
+                                     * sizeof(int32));
+    lay->end = lay->pnode_off
+        + (size_t)dims[FSG_LEXTREE_N_PNODE] * sizeof(fsg_pnode_rec_t);
+}
+
+static uint32
+fsg_lextree_hash(uint32 h, void const *buf, size_t len)
+{
+    unsigned char const *c = buf;
+
+    while (len--) {
+        h ^= *c++;
+        h *= 16777619U;
+    }
+    return h;
+}
+
+/**
+ * Compute a checksum of everything a lextree is built from, other
+ * than the senone sequences and transition matrices of the acoustic
+ * model, for which only the counts are used.
+ */
+static uint32
+fsg_lextree_checksum(fsg_model_t *fsg, dict_t *dict, bin_mdef_t *mdef,
+                     int32 wip, int32 pip)
+{
+    int32 dims[7];
+    uint32 sum;
+    int32 s, w, p;
+
+    dims[0] = fsg_model_n_state(fsg);
+    dims[1] = fsg_model_n_word(fsg);
+    dims[2] = bin_mdef_n_ciphone(mdef);
+    dims[3] = bin_mdef_n_sseq(mdef);
+    dims[4] = bin_mdef_silphone(mdef);
+    dims[5] = wip;
+    dims[6] = pip;
+    sum = fsg_lextree_hash(FSG_LEXTREE_FNV_BASIS, dims, sizeof(dims));
+
+    /* Arcs come out of hash tables in no particular order, so their
+     * hashes are added up. */
+    for (s = 0; s < fsg_model_n_state(fsg); s++) {
+        fsg_arciter_t *itor;
+        for (itor = fsg_model_arcs(fsg, s); itor; itor = fsg_arciter_next(itor)) {
+            fsg_link_t *l = fsg_arciter_get(itor);
+            int32 arc[4];
+
+            arc[0] = fsg_link_from_state(l);
+            arc[1] = fsg_link_to_state(l);
+            arc[2] = fsg_link_logs2prob(l);
+            arc[3] = fsg_link_wid(l);
+            sum += fsg_lextree_hash(FSG_LEXTREE_FNV_BASIS, arc, sizeof(arc));
+        }
+    }
+
+    for (w = 0; w < fsg_model_n_word(fsg); w++) {
+        char const *word = fsg_model_word_str(fsg, w);
+        int32 dictwid = dict_wordid(dict, word);
+
+        sum = fsg_lextree_hash(sum, word, strlen(word) + 1);
+        if (dictwid == BAD_S3WID)
+            continue;
+        p = dict_filler_word(dict, dictwid);
+        sum = fsg_lextree_hash(sum, &p, sizeof(p));
+        for (p = 0; p < dict_pronlen(dict, dictwid); p++) {
+            int32 ci = dict_pron(dict, dictwid, p);
+            sum = fsg_lextree_hash(sum, &ci, sizeof(ci));
+        }
+    }
+    return sum;
+}
+
+static fsg_link_t *
+fsg_lextree_find_link(fsg_model_t *fsg, int32 from, int32 to, int32 wid)
+{
+    gnode_t *gn;
+
+    for (gn = fsg_model_trans(fsg, from, to); gn; gn = gnode_next(gn)) {
+        fsg_link_t *l = (fsg_link_t *)gnode_ptr(gn);
+        if (fsg_link_wid(l) == wid)
+            return l;
+    }
+    return NULL;
+}
+
+fsg_lextree_t *
+fsg_lextree_read(char const *file, int do_mmap,
+                 fsg_model_t *fsg, dict_t *dict, dict2pid_t *d2p,
+                 bin_mdef_t *mdef, hmm_context_t *ctx,
+                 int32 wip, int32 pip)
+{
+    fsg_lextree_t *lextree;
+    fsg_lextree_layout_t lay;
+    fsg_pnode_rec_t const *rec;
+    int32 const *start, *root;
+    char *data;
+    FILE *fp;
+    char **argname, **argval;
+    char checksum[16];
+    int32 dims[FSG_LEXTREE_N_DIMS];
+    int32 byteswap, i, s, n_found, n_state, n_pnode, n_leaves;
+    long pos, size;
+
+    if ((fp = fopen(file, "rb")) == NULL)
+        return NULL;
+    E_INFO("Reading FSG lextree: %s\n", file);
+    if (bio_readhdr(fp, &argname, &argval, &byteswap) < 0) {
+        E_ERROR("Failed to read header from file '%s'\n", file);
+        fclose(fp);
+        return NULL;
+    }
+
+    lextree = ckd_calloc(1, sizeof(fsg_lextree_t));
+    lextree->ctx = ctx;
+    lextree->dict = dict;
+    lextree->d2p = d2p;
+    lextree->mdef = mdef;
+    lextree->wip = wip;
+    lextree->pip = pip;
+
+    n_found = 0;
+    if (byteswap) {
+        E_WARN("%s was built on a machine with the other byte order\n", file);
+        goto error_out;
+    }
+    sprintf(checksum, "%08x",
+            fsg_lextree_checksum(fsg, dict, mdef, wip, pip));
+    for (i = 0; argname[i]; i++) {
+        if (strcmp(argname[i], "version") == 0) {
+            if (strcmp(argval[i], FSG_LEXTREE_VERSION) != 0) {
+                E_WARN("Version mismatch(%s): %s, expecting %s\n",
+                       file, argval[i], FSG_LEXTREE_VERSION);
+                goto error_out;
+            }
+        }
+        else if (strcmp(argname[i], "bvsz") == 0) {
+            if (atoi(argval[i]) != FSG_PNODE_CTXT_BVSZ) {
+                E_WARN("%s was built with FSG_PNODE_CTXT_BVSZ %s, not %d\n",
+                       file, argval[i], FSG_PNODE_CTXT_BVSZ);
+                goto error_out;
+            }
+            ++n_found;
+        }
+        else if (strcmp(argname[i], "checksum") == 0) {
+            if (strcmp(argval[i], checksum) != 0) {
+                E_WARN("%s was built from a different grammar, "
+                       "dictionary or model\n", file);
+                goto error_out;
+            }
+            ++n_found;
+        }
+    }
+    if (n_found != 2) {
+        E_ERROR("%s is missing some of its parameters\n", file);
+        goto error_out;
+    }
+    bio_hdrarg_free(argname, argval);
+    argname = argval = NULL;
+
+    pos = FSG_LEXTREE_PAD(ftell(fp));
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp) - pos;
+    if (size < (long)sizeof(dims)) {
+        E_ERROR("%s is truncated\n", file);
+        goto error_out;
+    }
+    if (do_mmap && (lextree->filemap = mmio_file_read(file)) != NULL)
+        data = (char *)mmio_file_ptr(lextree->filemap) + pos;
+    else {
+        lextree->buf = ckd_malloc(size);
+        if (fseek(fp, pos, SEEK_SET) < 0
+            || fread(lextree->buf, 1, size, fp) != (size_t)size) {
+            E_ERROR_SYSTEM("Failed to read %s", file);
+            goto error_out;
+        }
+        data = lextree->buf;
+    }
+    fclose(fp);
+    fp = NULL;
+
+    memcpy(dims, data, sizeof(dims));
+    n_state = dims[FSG_LEXTREE_N_STATE];
+    n_pnode = dims[FSG_LEXTREE_N_PNODE];
+    if (n_state != fsg_model_n_state(fsg)
+        || dims[FSG_LEXTREE_N_CI] != bin_mdef_n_ciphone(mdef)
+        || n_pnode < 0) {
+        E_ERROR("Bad dimensions in %s\n", file);
+        goto error_out;
+    }
+    fsg_lextree_layout(dims, &lay);
+    if ((long)lay.end > size) {
+        E_ERROR("%s is truncated: %ld bytes, expected %ld\n",
+                file, (long)(size + pos), (long)(lay.end + pos));
+        goto error_out;
+    }
+
+    /* The context tables are used in place. */
+    lextree->lc = ckd_alloc_2d_ptr(n_state, dims[FSG_LEXTREE_N_CI] + 1,
+                                   data + lay.lc_off, sizeof(int16));
+    lextree->rc = ckd_alloc_2d_ptr(n_state, dims[FSG_LEXTREE_N_CI] + 1,
+                                   data + lay.rc_off, sizeof(int16));
+
+    /* The pnodes have to be copied, as they hold the HMMs. */
+    start = (int32 const *)(data + lay.start_off);
+    root = (int32 const *)(data + lay.root_off);
+    rec = (fsg_pnode_rec_t const *)(data + lay.pnode_off);
+    lextree->n_pnode = n_pnode;
+    lextree->pnodes = ckd_calloc(n_pnode ? n_pnode : 1, sizeof(fsg_pnode_t));
+    lextree->root = ckd_calloc(n_state, sizeof(fsg_pnode_t *));
+    lextree->alloc_head = ckd_calloc(n_state, sizeof(fsg_pnode_t *));
+    n_leaves = 0;
+    for (s = 0; s < n_state; s++) {
+        if (start[s] < 0 || start[s] > start[s + 1] || start[s + 1] > n_pnode
+            || root[s] < -1 || root[s] >= n_pnode) {
+            E_ERROR("Bad pnode index for state %d in %s\n", s, file);
+            goto error_out;
+        }
+        if (root[s] >= 0)
+            lextree->root[s] = lextree->pnodes + root[s];
+        if (start[s] < start[s + 1])
+            lextree->alloc_head[s] = lextree->pnodes + start[s];
+        for (i = start[s]; i < start[s + 1]; i++) {
+            fsg_pnode_t *pnode = lextree->pnodes + i;
+
+            if (rec[i].sibling < -1 || rec[i].sibling >= n_pnode
+                || (!rec[i].leaf
+                    && (rec[i].next < -1 || rec[i].next >= n_pnode))) {
+                E_ERROR("Bad pnode index for state %d in %s\n", s, file);
+                goto error_out;
+            }
+            pnode->ctx = ctx;
+            pnode->logs2prob = rec[i].logs2prob;
+            pnode->ctxt = rec[i].ctxt;
+            pnode->ci_ext = rec[i].ci_ext;
+            pnode->ppos = rec[i].ppos;
+            pnode->leaf = rec[i].leaf;
+            if (rec[i].sibling >= 0)
+                pnode->sibling = lextree->pnodes + rec[i].sibling;
+            if (i + 1 < start[s + 1])
+                pnode->alloc_next = pnode + 1;
+            if (pnode->leaf) {
+                pnode->next.fsglink =
+                    fsg_lextree_find_link(fsg, s, rec[i].next, rec[i].wid);
+                if (pnode->next.fsglink == NULL) {
+                    E_ERROR("No arc for word %d from %d to %d in %s\n",
+                            rec[i].wid, s, rec[i].next, file);
+                    goto error_out;
+                }
+                ++n_leaves;
+            }
+            else if (rec[i].next >= 0)
+                pnode->next.succ = lextree->pnodes + rec[i].next;
+            hmm_init(ctx, &pnode->hmm, FALSE, rec[i].ssid, rec[i].tmatid);
+        }
+    }
+    /* Only set now so that a partly built lextree is freed correctly. */
+    lextree->fsg = fsg;
+    E_INFO("%d HMM nodes in lextree (%d leaves) %s\n",
+           lextree->n_pnode, n_leaves,
+           lextree->filemap ? "mapped" : "read");
+    return lextree;
+
+error_out:
+    if (argname)
+        bio_hdrarg_free(argname, argval);
+    if (fp)
+        fclose(fp);
+    fsg_lextree_free(lextree);
+    return NULL;
+}
+
+static int
+fsg_pnode_ptr_cmp(void const *a, void const *b)
+{
+    fsg_pnode_t const *pa = *(fsg_pnode_t * const *)a;
+    fsg_pnode_t const *pb = *(fsg_pnode_t * const *)b;
+
+    return (pa < pb) ? -1 : (pa > pb);
+}
+
+/**
+ * Find the index of a pnode in the address-ordered nodes of its state.
+ */
+static int32
+fsg_pnode_index(fsg_pnode_t **nodes, int32 start, int32 end,
+                fsg_pnode_t *pnode)
+{
+    fsg_pnode_t **found;
+
+    if (pnode == NULL)
+        return -1;
+    found = bsearch(&pnode, nodes + start, end - start,
+                    sizeof(*nodes), fsg_pnode_ptr_cmp);
+    assert(found != NULL);
+    return found - nodes;
+}
+
+/**
+ * Write zeros up to the given offset from the start of the arrays.
+ */
+static int
+fsg_lextree_pad(FILE *fp, long start, size_t off)
+{
+    long pos = ftell(fp);
+
+    while (pos < start + (long)off) {
+        if (fputc(0, fp) == EOF)
+            return -1;
+        ++pos;
+    }
+    return 0;
+}
+
+int
+fsg_lextree_write(fsg_lextree_t *lextree, char const *file)
+{
+    fsg_lextree_layout_t lay;
+    fsg_pnode_t **nodes, *pn;
+    int32 *start, *root;
+    FILE *fp;
+    char checksum[16], bvsz[16];
+    int32 dims[FSG_LEXTREE_N_DIMS];
+    int32 s, i, n_state;
+    long pos;
+
+    n_state = fsg_model_n_state(lextree->fsg);
+    dims[FSG_LEXTREE_N_STATE] = n_state;
+    dims[FSG_LEXTREE_N_CI] = bin_mdef_n_ciphone(lextree->mdef);
+    dims[FSG_LEXTREE_N_PNODE] = lextree->n_pnode;
+    fsg_lextree_layout(dims, &lay);
+
+    /* Nodes of each state are numbered in address order, so that
+     * pointers can be turned into indices by binary search. */
+    nodes = ckd_calloc(lextree->n_pnode ? lextree->n_pnode : 1,
+                       sizeof(*nodes));
+    start = ckd_calloc(n_state + 1, sizeof(*start));
+    root = ckd_calloc(n_state, sizeof(*root));
+    for (i = s = 0; s < n_state; s++) {
+        start[s] = i;
+        for (pn = lextree->alloc_head[s]; pn; pn = pn->alloc_next)
+            nodes[i++] = pn;
+        qsort(nodes + start[s], i - start[s], sizeof(*nodes),
+              fsg_pnode_ptr_cmp);
+        root[s] = fsg_pnode_index(nodes, start[s], i, lextree->root[s]);
+    }
+    start[n_state] = i;
+    assert(i == lextree->n_pnode);
+
+    if ((fp = fopen(file, "wb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open file '%s' for writing", file);
+        ckd_free(nodes);
+        ckd_free(start);
+        ckd_free(root);
+        return -1;
+    }
+    E_INFO("Writing FSG lextree: %s\n", file);
+    sprintf(checksum, "%08x",
+            fsg_lextree_checksum(lextree->fsg, lextree->dict, lextree->mdef,
+                                 lextree->wip, lextree->pip));
+    sprintf(bvsz, "%d", FSG_PNODE_CTXT_BVSZ);
+    if (bio_writehdr(fp, "version", FSG_LEXTREE_VERSION,
+                     "bvsz", bvsz,
+                     "checksum", checksum, NULL) < 0)
+        goto error_out;
+    pos = FSG_LEXTREE_PAD(ftell(fp));
+    if (fsg_lextree_pad(fp, pos, 0) < 0
+        || fwrite(dims, sizeof(int32), FSG_LEXTREE_N_DIMS, fp)
+        != FSG_LEXTREE_N_DIMS
+        || fsg_lextree_pad(fp, pos, lay.lc_off) < 0
+        || fwrite(lextree->lc[0], sizeof(int16),
+                  n_state * (dims[FSG_LEXTREE_N_CI] + 1), fp)
+        != (size_t)n_state * (dims[FSG_LEXTREE_N_CI] + 1)
+        || fsg_lextree_pad(fp, pos, lay.rc_off) < 0
+        || fwrite(lextree->rc[0], sizeof(int16),
+                  n_state * (dims[FSG_LEXTREE_N_CI] + 1), fp)
+        != (size_t)n_state * (dims[FSG_LEXTREE_N_CI] + 1)
+        || fsg_lextree_pad(fp, pos, lay.start_off) < 0
+        || fwrite(start, sizeof(int32), n_state + 1, fp)
+        != (size_t)n_state + 1
+        || fsg_lextree_pad(fp, pos, lay.root_off) < 0
+        || fwrite(root, sizeof(int32), n_state, fp) != (size_t)n_state
+        || fsg_lextree_pad(fp, pos, lay.pnode_off) < 0)
+        goto error_out;
+
+    for (s = 0; s < n_state; s++) {
+        for (i = start[s]; i < start[s + 1]; i++) {
+            fsg_pnode_rec_t rec;
+
+            pn = nodes[i];
+            memset(&rec, 0, sizeof(rec));
+            if (pn->leaf) {
+                rec.next = fsg_link_to_state(pn->next.fsglink);
+                rec.wid = fsg_link_wid(pn->next.fsglink);
+            }
+            else {
+                rec.next = fsg_pnode_index(nodes, start[s], start[s + 1],
+                                           pn->next.succ);
+                rec.wid = -1;
+            }
+            rec.sibling = fsg_pnode_index(nodes, start[s], start[s + 1],
+                                          pn->sibling);
+            rec.logs2prob = pn->logs2prob;
+            rec.ssid = hmm_nonmpx_ssid(&pn->hmm);
+            rec.tmatid = hmm_tmatid(&pn->hmm);
+            rec.ctxt = pn->ctxt;
+            rec.ci_ext = pn->ci_ext;
+            rec.ppos = pn->ppos;
+            rec.leaf = pn->leaf;
+            if (fwrite(&rec, sizeof(rec), 1, fp) != 1)
+                goto error_out;
+        }
+    }
+
+    ckd_free(nodes);
+    ckd_free(start);
+    ckd_free(root);
+    fclose(fp);
+    return 0;
+
+error_out:
+    E_ERROR_SYSTEM("Failed to write '%s'", file);
+    ckd_free(nodes);
+    ckd_free(start);
+    ckd_free(root);
+    fclose(fp);
+    return -1;
+}
+
 /******************************
  * psubtree stuff starts here *
  ******************************/
@@ -42,6 +42,7 @@
 /* SphinxBase headers. */
 #include <sphinxbase/cmd_ln.h>
 #include <sphinxbase/fsg_model.h>
+#include <sphinxbase/mmio.h>
 
 /* Local headers. */
 #include "hmm.h"
@@ -213,6 +214,15 @@ typedef struct fsg_lextree_s {
     int32 n_pnode;	/* #HMM nodes in search structure */
     int32 wip;
     int32 pip;
+
+    /*
+     * Lextrees read with fsg_lextree_read() have all their pnodes in one
+     * block, in which the alloc_head lists are laid out, and their lc and
+     * rc tables point into the file, which is kept in filemap or buf.
+     */
+    fsg_pnode_t *pnodes;
+    mmio_file_t *filemap;
+    void *buf;
 } fsg_lextree_t;
 
 /* Access macros */
@@ -227,11 +237,44 @@ fsg_lextree_t *fsg_lextree_init(fsg_model_t *fsg, dict_t *dict,
 				bin_mdef_t *mdef, hmm_context_t *ctx,
 				int32 wip, int32 pip);
 
+/**
+ * Read lextrees for an FSG from a file written by fsg_lextree_write().
+ *
+ * The file is memory-mapped if do_mmap is TRUE and this is possible.
+ * The arguments are the same as for fsg_lextree_init(), and the file
+ * is only used if it was built from the same FSG, pronunciations,
+ * phone set and insertion penalties.
+ *
+ * @return the lextrees, or NULL if the file could not be read or does
+ *         not match the arguments.
+ */
+fsg_lextree_t *fsg_lextree_read(char const *file, int do_mmap,
+                                fsg_model_t *fsg, dict_t *dict,
+                                dict2pid_t *d2p,
+                                bin_mdef_t *mdef, hmm_context_t *ctx,
+                                int32 wip, int32 pip);
+
+/**
+ * Write lextrees for an FSG to a file, in native byte order.
+ *
+ * @return 0 for success, <0 on error.
+ */
+int fsg_lextree_write(fsg_lextree_t *lextree, char const *file);
+
 /**
  * Free lextrees for an FSG.
  */
 void fsg_lextree_free(fsg_lextree_t *fsg);
 
+/**
+ * Memory used by lextrees for an FSG (not counting the FSG itself).
+ *
+ * @param out_mapped Output: bytes of context tables used in place
+ *                   from a memory-mapped file are added to this.
+ * @return bytes of heap memory.
+ */
+size_t fsg_lextree_mem_size(fsg_lextree_t *lextree, size_t *out_mapped);
+
 /**
  * Print an FSG lextree to a file for debugging.
  */
@@ -73,6 +73,9 @@
 static ps_seg_t *fsg_search_seg_iter(ps_search_t *search);
 static ps_lattice_t *fsg_search_lattice(ps_search_t *search);
 static int fsg_search_prob(ps_search_t *search);
+static ps_search_t *fsg_search_clone(ps_search_t *search, acmod_t *acmod,
+                                     dict_t *dict);
+static void fsg_search_mem(ps_search_t *search, ps_mem_t *out_mem);
 
 static ps_searchfuncs_t fsg_funcs = {
     /* start: */  fsg_search_start,
@@ -84,6 +87,8 @@ static ps_searchfuncs_t fsg_funcs = {
     /* hyp: */      fsg_search_hyp,
     /* prob: */     fsg_search_prob,
     /* seg_iter: */ fsg_search_seg_iter,
+    /* clone: */    fsg_search_clone,
+    /* mem: */      fsg_search_mem,
 };
 
 static int
@@ -196,6 +201,7 @@ fsg_search_init(const char *name,
 
     /* Intialize the search history object */
     fsgs->history = fsg_history_init(NULL, dict);
+    fsg_history_set_max(fsgs->history, cmd_ln_int32_r(config, "-maxbp"));
     fsgs->frame = -1;
 
     /* Get search pruning parameters */
@@ -209,6 +215,7 @@ fsg_search_init(const char *name,
     fsgs->wbeam = fsgs->wbeam_orig
         = (int32) logmath_log(acmod->lmath, cmd_ln_float64_r(config, "-wbeam"))
         >> SENSCR_SHIFT;
+    fsgs->maxhmmpf = cmd_ln_int32_r(config, "-maxhmmpf");
 
     /* LM related weights/penalties */
     fsgs->lw = cmd_ln_float32_r(config, "-lw");
@@ -252,6 +259,40 @@ fsg_search_init(const char *name,
     return ps_search_base(fsgs);
 }
 
+static ps_search_t *
+fsg_search_clone(ps_search_t *search, acmod_t *acmod, dict_t *dict)
+{
+    fsg_search_t *fsgs = (fsg_search_t *)search;
+
+    /* The grammar already has its silences and alternates, so it is
+     * shared as it is. */
+    return fsg_search_init(ps_search_name(search), fsgs->fsg,
+                           ps_search_config(search), acmod, dict,
+                           ps_search_dict2pid(search));
+}
+
+static void
+fsg_search_mem(ps_search_t *search, ps_mem_t *out_mem)
+{
+    fsg_search_t *fsgs = (fsg_search_t *)search;
+    ps_mem_t *mem = &out_mem[PS_MEM_SEARCH];
+
+    /* The grammar itself is not counted. */
+    mem->heap += sizeof(*fsgs);
+    if (fsgs->lextree)
+        mem->heap += fsg_lextree_mem_size(fsgs->lextree, &mem->mapped);
+    if (fsgs->history)
+        mem->heap += fsg_history_mem_size(fsgs->history);
+    if (fsgs->lextree)
+        mem->heap += 2 * fsg_lextree_n_pnode(fsgs->lextree)
+            * sizeof(*fsgs->pnode_active);
+    if (fsgs->null_start)
+        mem->heap += (fsg_model_n_state(fsgs->fsg) + 1)
+            * sizeof(*fsgs->null_start)
+            + fsgs->null_start[fsg_model_n_state(fsgs->fsg)]
+            * sizeof(*fsgs->null_links);
+}
+
 void
 fsg_search_free(ps_search_t *search)
 {
@@ -274,19 +315,67 @@ fsg_search_free(ps_search_t *search)
         fsg_history_set_fsg(fsgs->history, NULL, NULL);
         fsg_history_free(fsgs->history);
     }
+    ckd_free(fsgs->pnode_active);
+    ckd_free(fsgs->pnode_active_next);
+    ckd_free(fsgs->null_start);
+    ckd_free(fsgs->null_links);
     hmm_context_free(fsgs->hmmctx);
     fsg_model_free(fsgs->fsg);
     ckd_free(fsgs);
 }
 
+/*
+ * Gather the null transitions out of each state of the FSG, in the
+ * order fsg_model_arcs() would give them.
+ */
+static void
+fsg_search_init_null_links(fsg_search_t *fsgs)
+{
+    fsg_model_t *fsg = fsgs->fsg;
+    int32 s, n_state, n_null;
+
+    n_state = fsg_model_n_state(fsg);
+    ckd_free(fsgs->null_start);
+    ckd_free(fsgs->null_links);
+    fsgs->null_start = ckd_calloc(n_state + 1, sizeof(*fsgs->null_start));
+    n_null = 0;
+    for (s = 0; s < n_state; s++) {
+        fsg_arciter_t *itor;
+
+        for (itor = fsg_model_arcs(fsg, s); itor;
+             itor = fsg_arciter_next(itor))
+            if (fsg_link_wid(fsg_arciter_get(itor)) == -1)
+                ++n_null;
+    }
+    fsgs->null_links = ckd_calloc(n_null ? n_null : 1,
+                                  sizeof(*fsgs->null_links));
+    n_null = 0;
+    for (s = 0; s < n_state; s++) {
+        fsg_arciter_t *itor;
+
+        fsgs->null_start[s] = n_null;
+        for (itor = fsg_model_arcs(fsg, s); itor;
+             itor = fsg_arciter_next(itor)) {
+            fsg_link_t *l = fsg_arciter_get(itor);
+            if (fsg_link_wid(l) == -1)
+                fsgs->null_links[n_null++] = l;
+        }
+    }
+    fsgs->null_start[n_state] = n_null;
+}
+
 int
 fsg_search_reinit(ps_search_t *search, dict_t *dict, dict2pid_t *d2p)
 {
     fsg_search_t *fsgs = (fsg_search_t *)search;
+    cmd_ln_t *config = ps_search_config(fsgs);
+    char const *cachedir;
+    char *path = NULL;
 
     /* Free the old lextree */
     if (fsgs->lextree)
         fsg_lextree_free(fsgs->lextree);
+    fsgs->lextree = NULL;
 
     /* Free old dict2pid, dict */
     ps_search_base_reinit(search, dict, d2p);
@@ -294,10 +383,37 @@ fsg_search_reinit(ps_search_t *search, dict_t *dict, dict2pid_t *d2p)
     /* Update the number of words (not used by this module though). */
     search->n_words = dict_size(dict);
 
-    /* Allocate new lextree for the given FSG */
-    fsgs->lextree = fsg_lextree_init(fsgs->fsg, dict, d2p,
-                                     ps_search_acmod(fsgs)->mdef,
-                                     fsgs->hmmctx, fsgs->wip, fsgs->pip);
+    /* Use a precompiled lextree for the given FSG if there is one
+     * and it is up to date, otherwise build it (and save it). */
+    cachedir = cmd_ln_str_r(config, "-fsgcache");
+    if (cachedir && fsg_model_name(fsgs->fsg)) {
+        path = string_join(cachedir, "/", fsg_model_name(fsgs->fsg),
+                           ".fsgtree", NULL);
+        fsgs->lextree = fsg_lextree_read(path, cmd_ln_boolean_r(config, "-mmap"),
+                                         fsgs->fsg, dict, d2p,
+                                         ps_search_acmod(fsgs)->mdef,
+                                         fsgs->hmmctx, fsgs->wip, fsgs->pip);
+    }
+    if (fsgs->lextree == NULL) {
+        fsgs->lextree = fsg_lextree_init(fsgs->fsg, dict, d2p,
+                                         ps_search_acmod(fsgs)->mdef,
+                                         fsgs->hmmctx, fsgs->wip, fsgs->pip);
+        if (path)
+            fsg_lextree_write(fsgs->lextree, path);
+    }
+    ckd_free(path);
+
+    /* Active lists big enough for the whole lextree, and the null
+     * transitions out of each state, so that the search does not
+     * allocate anything as it goes. */
+    ckd_free(fsgs->pnode_active);
+    ckd_free(fsgs->pnode_active_next);
+    fsgs->pnode_active = ckd_calloc(fsg_lextree_n_pnode(fsgs->lextree),
+                                    sizeof(*fsgs->pnode_active));
+    fsgs->pnode_active_next = ckd_calloc(fsg_lextree_n_pnode(fsgs->lextree),
+                                         sizeof(*fsgs->pnode_active_next));
+    fsgs->n_pnode_active = fsgs->n_pnode_active_next = 0;
+    fsg_search_init_null_links(fsgs);
 
     /* Inform the history module of the new fsg */
     fsg_history_set_fsg(fsgs->history, fsgs->fsg, dict);
@@ -309,14 +425,14 @@ fsg_search_reinit(ps_search_t *search, dict_t *dict, dict2pid_t *d2p)
 static void
 fsg_search_sen_active(fsg_search_t *fsgs)
 {
-    gnode_t *gn;
     fsg_pnode_t *pnode;
     hmm_t *hmm;
+    int32 i;
 
     acmod_clear_active(ps_search_acmod(fsgs));
 
-    for (gn = fsgs->pnode_active; gn; gn = gnode_next(gn)) {
-        pnode = (fsg_pnode_t *) gnode_ptr(gn);
+    for (i = 0; i < fsgs->n_pnode_active; i++) {
+        pnode = fsgs->pnode_active[i];
         hmm = fsg_pnode_hmmptr(pnode);
         assert(hmm_frame(hmm) == fsgs->frame);
         acmod_activate_hmm(ps_search_acmod(fsgs), hmm);
@@ -331,7 +447,6 @@ fsg_search_sen_active(fsg_search_t *fsgs)
 static void
 fsg_search_hmm_eval(fsg_search_t *fsgs)
 {
-    gnode_t *gn;
     fsg_pnode_t *pnode;
     hmm_t *hmm;
     int32 bestscore;
@@ -339,15 +454,15 @@ fsg_search_hmm_eval(fsg_search_t *fsgs)
 
     bestscore = WORST_SCORE;
 
-    if (!fsgs->pnode_active) {
+    if (fsgs->n_pnode_active == 0) {
         E_ERROR("Frame %d: No active HMM!!\n", fsgs->frame);
         return;
     }
 
-    for (n = 0, gn = fsgs->pnode_active; gn; gn = gnode_next(gn), n++) {
+    for (n = 0; n < fsgs->n_pnode_active; n++) {
         int32 score;
 
-        pnode = (fsg_pnode_t *) gnode_ptr(gn);
+        pnode = fsgs->pnode_active[n];
         hmm = fsg_pnode_hmmptr(pnode);
         assert(hmm_frame(hmm) == fsgs->frame);
 
@@ -371,9 +486,10 @@ fsg_search_hmm_eval(fsg_search_t *fsgs)
     E_INFO("[%5d] %6d HMM; bestscr: %11d\n", fsgs->frame, n, bestscore);
 #endif
     fsgs->n_hmm_eval += n;
+    ps_search_acmod(fsgs)->stats.n_hmm_eval += n;
 
     /* Adjust beams if #active HMMs larger than absolute threshold */
-    maxhmmpf = cmd_ln_int32_r(ps_search_config(fsgs), "-maxhmmpf");
+    maxhmmpf = fsgs->maxhmmpf;
     if (maxhmmpf != -1 && n > maxhmmpf) {
         /*
          * Too many HMMs active; reduce the beam factor applied to the default
@@ -404,6 +520,19 @@ fsg_search_hmm_eval(fsg_search_t *fsgs)
 }
 
 
+/*
+ * Add a pnode to the active list for the next frame.  Each one is
+ * added at most once, when its HMM is first entered for that frame,
+ * so the list never holds more than all of them.
+ */
+static void
+fsg_search_activate_next(fsg_search_t *fsgs, fsg_pnode_t *pnode)
+{
+    assert(fsgs->n_pnode_active_next < fsg_lextree_n_pnode(fsgs->lextree));
+    fsgs->pnode_active_next[fsgs->n_pnode_active_next++] = pnode;
+}
+
+
 static void
 fsg_search_pnode_trans(fsg_search_t *fsgs, fsg_pnode_t * pnode)
 {
@@ -428,9 +557,7 @@ fsg_search_pnode_trans(fsg_search_t *fsgs, fsg_pnode_t * pnode)
             /* Incoming score > pruning threshold and > target's existing score */
             if (hmm_frame(&child->hmm) < nf) {
                 /* Child node not yet activated; do so */
-                fsgs->pnode_active_next =
-                    glist_add_ptr(fsgs->pnode_active_next,
-                                  (void *) child);
+                fsg_search_activate_next(fsgs, child);
             }
 
             hmm_enter(&child->hmm, newscore, hmm_out_history(hmm), nf);
@@ -505,28 +632,25 @@ fsg_search_pnode_exit(fsg_search_t *fsgs, fsg_pnode_t * pnode)
 static void
 fsg_search_hmm_prune_prop(fsg_search_t *fsgs)
 {
-    gnode_t *gn;
     fsg_pnode_t *pnode;
     hmm_t *hmm;
-    int32 thresh, word_thresh, phone_thresh;
+    int32 i, thresh, word_thresh, phone_thresh;
 
-    assert(fsgs->pnode_active_next == NULL);
+    assert(fsgs->n_pnode_active_next == 0);
 
     thresh = fsgs->bestscore + fsgs->beam;
     phone_thresh = fsgs->bestscore + fsgs->pbeam;
     word_thresh = fsgs->bestscore + fsgs->wbeam;
 
-    for (gn = fsgs->pnode_active; gn; gn = gnode_next(gn)) {
-        pnode = (fsg_pnode_t *) gnode_ptr(gn);
+    for (i = 0; i < fsgs->n_pnode_active; i++) {
+        pnode = fsgs->pnode_active[i];
         hmm = fsg_pnode_hmmptr(pnode);
 
         if (hmm_bestscore(hmm) >= thresh) {
             /* Keep this HMM active in the next frame */
             if (hmm_frame(hmm) == fsgs->frame) {
                 hmm_frame(hmm) = fsgs->frame + 1;
-                fsgs->pnode_active_next =
-                    glist_add_ptr(fsgs->pnode_active_next,
-                                  (void *) pnode);
+                fsg_search_activate_next(fsgs, pnode);
             }
             else {
                 assert(hmm_frame(hmm) == fsgs->frame + 1);
@@ -567,7 +691,8 @@ fsg_search_null_prop(fsg_search_t *fsgs)
     n_entries = fsg_history_n_entries(fsgs->history);
 
     for (bpidx = fsgs->bpidx_start; bpidx < n_entries; bpidx++) {
-        fsg_arciter_t *itor;
+        int32 i;
+
         hist_entry = fsg_history_entry_get(fsgs->history, bpidx);
 
         l = fsg_hist_entry_fsglink(hist_entry);
@@ -581,13 +706,10 @@ fsg_search_null_prop(fsg_search_t *fsgs)
          * transitions.)
          */
         /* Add all links from from_state to dst */
-        for (itor = fsg_model_arcs(fsg, s); itor;
-             itor = fsg_arciter_next(itor)) {
-            fsg_link_t *l = fsg_arciter_get(itor);
+        for (i = fsgs->null_start[s]; i < fsgs->null_start[s + 1]; i++) {
+            fsg_link_t *l = fsgs->null_links[i];
 
             /* FIXME: Need to deal with tag transitions somehow. */
-            if (fsg_link_wid(l) != -1)
-                continue;
             newscore =
                 fsg_hist_entry_score(hist_entry) +
                 (fsg_link_logs2prob(l) >> SENSCR_SHIFT);
@@ -658,9 +780,7 @@ fsg_search_word_trans(fsg_search_t *fsgs)
                     && (newscore BETTER_THAN hmm_in_score(&root->hmm))) {
                     if (hmm_frame(&root->hmm) < nf) {
                         /* Newly activated node; add to active list */
-                        fsgs->pnode_active_next =
-                            glist_add_ptr(fsgs->pnode_active_next,
-                                          (void *) root);
+                        fsg_search_activate_next(fsgs, root);
 #if __FSG_DBG__
                         E_INFO
                             ("[%5d] WordTrans bpidx[%d] -> pnode[%08x] (activated)\n",
@@ -689,9 +809,9 @@ fsg_search_step(ps_search_t *search, int frame_idx)
     fsg_search_t *fsgs = (fsg_search_t *)search;
     int16 const *senscr;
     acmod_t *acmod = search->acmod;
-    gnode_t *gn;
-    fsg_pnode_t *pnode;
+    fsg_pnode_t *pnode, **tmp;
     hmm_t *hmm;
+    int32 i;
 
     /* Activate our HMMs for the current frame if need be. */
     if (!acmod->compallsen)
@@ -705,6 +825,7 @@ fsg_search_step(ps_search_t *search, int frame_idx)
     fsgs->bpidx_start = fsg_history_n_entries(fsgs->history);
 
     /* Evaluate all active pnodes (HMMs) */
+    acmod_stage_start(acmod, PS_STAGE_HMM);
     fsg_search_hmm_eval(fsgs);
 
     /*
@@ -713,6 +834,8 @@ fsg_search_step(ps_search_t *search, int frame_idx)
      * the survivors permanent via fsg_history_end_frame().
      */
     fsg_search_hmm_prune_prop(fsgs);
+    acmod_stage_stop(acmod, PS_STAGE_HMM);
+    acmod_stage_start(acmod, PS_STAGE_WORD);
     fsg_history_end_frame(fsgs->history);
 
     /*
@@ -727,6 +850,9 @@ fsg_search_step(ps_search_t *search, int frame_idx)
      * terminating state to the root nodes of the lextree attached to the state.
      */
     fsg_search_word_trans(fsgs);
+    acmod->stats.n_bp += fsg_history_n_entries(fsgs->history)
+        - fsgs->bpidx_start;
+    acmod_stage_stop(acmod, PS_STAGE_WORD);
 
     /*
      * We've now come full circle, HMM and FSG states have been updated for
@@ -734,8 +860,8 @@ fsg_search_step(ps_search_t *search, int frame_idx)
      * Update the active lists, deactivate any currently active HMMs that
      * did not survive into the next frame
      */
-    for (gn = fsgs->pnode_active; gn; gn = gnode_next(gn)) {
-        pnode = (fsg_pnode_t *) gnode_ptr(gn);
+    for (i = 0; i < fsgs->n_pnode_active; i++) {
+        pnode = fsgs->pnode_active[i];
         hmm = fsg_pnode_hmmptr(pnode);
 
         if (hmm_frame(hmm) == fsgs->frame) {
@@ -747,12 +873,12 @@ fsg_search_step(ps_search_t *search, int frame_idx)
         }
     }
 
-    /* Free the currently active list */
-    glist_free(fsgs->pnode_active);
-
     /* Make the next-frame active list the current one */
+    tmp = fsgs->pnode_active;
     fsgs->pnode_active = fsgs->pnode_active_next;
-    fsgs->pnode_active_next = NULL;
+    fsgs->n_pnode_active = fsgs->n_pnode_active_next;
+    fsgs->pnode_active_next = tmp;
+    fsgs->n_pnode_active_next = 0;
 
     /* End of this frame; ready for the next */
     ++fsgs->frame;
@@ -770,6 +896,7 @@ int
 fsg_search_start(ps_search_t *search)
 {
     fsg_search_t *fsgs = (fsg_search_t *)search;
+    fsg_pnode_t **tmp;
     int32 silcipid;
     fsg_pnode_ctxt_t ctxt;
 
@@ -782,8 +909,8 @@ fsg_search_start(ps_search_t *search)
     silcipid = bin_mdef_ciphone_id(ps_search_acmod(fsgs)->mdef, "SIL");
 
     /* Initialize EVERYTHING to be inactive */
-    assert(fsgs->pnode_active == NULL);
-    assert(fsgs->pnode_active_next == NULL);
+    assert(fsgs->n_pnode_active == 0);
+    assert(fsgs->n_pnode_active_next == 0);
 
     fsg_history_reset(fsgs->history);
     fsg_history_utt_start(fsgs->history);
@@ -806,8 +933,11 @@ fsg_search_start(ps_search_t *search)
     fsg_search_word_trans(fsgs);
 
     /* Make the next-frame active list the current one */
+    tmp = fsgs->pnode_active;
     fsgs->pnode_active = fsgs->pnode_active_next;
-    fsgs->pnode_active_next = NULL;
+    fsgs->n_pnode_active = fsgs->n_pnode_active_next;
+    fsgs->pnode_active_next = tmp;
+    fsgs->n_pnode_active_next = 0;
 
     ++fsgs->frame;
 
@@ -827,24 +957,15 @@ int
 fsg_search_finish(ps_search_t *search)
 {
     fsg_search_t *fsgs = (fsg_search_t *)search;
-    gnode_t *gn;
-    fsg_pnode_t *pnode;
-    int32 n_hist, cf;
+    int32 i, n_hist, cf;
 
     /* Deactivate all nodes in the current and next-frame active lists */
-    for (gn = fsgs->pnode_active; gn; gn = gnode_next(gn)) {
-        pnode = (fsg_pnode_t *) gnode_ptr(gn);
-        fsg_psubtree_pnode_deactivate(pnode);
-    }
-    for (gn = fsgs->pnode_active_next; gn; gn = gnode_next(gn)) {
-        pnode = (fsg_pnode_t *) gnode_ptr(gn);
-        fsg_psubtree_pnode_deactivate(pnode);
-    }
-
-    glist_free(fsgs->pnode_active);
-    fsgs->pnode_active = NULL;
-    glist_free(fsgs->pnode_active_next);
-    fsgs->pnode_active_next = NULL;
+    for (i = 0; i < fsgs->n_pnode_active; i++)
+        fsg_psubtree_pnode_deactivate(fsgs->pnode_active[i]);
+    for (i = 0; i < fsgs->n_pnode_active_next; i++)
+        fsg_psubtree_pnode_deactivate(fsgs->pnode_active_next[i]);
+    fsgs->n_pnode_active = 0;
+    fsgs->n_pnode_active_next = 0;
 
     fsgs->final = TRUE;
 
@@ -857,6 +978,9 @@ fsg_search_finish(ps_search_t *search)
          fsgs->n_sen_eval,
          (fsgs->frame > 0) ? fsgs->n_sen_eval / fsgs->frame : 0,
          n_hist, (fsgs->frame > 0) ? n_hist / fsgs->frame : 0);
+    if (fsgs->history->n_pruned > 0)
+        E_INFO("%d history entries pruned from a full table\n",
+               fsgs->history->n_pruned);
 
     /* Print out some statistics. */
     ptmr_stop(&fsgs->perf);
@@ -1386,6 +1510,7 @@ fsg_search_lattice(ps_search_t *search)
         return search->dag;
 
     /* Nope, create a new one. */
+    acmod_stage_start(search->acmod, PS_STAGE_LATTICE);
     ps_lattice_free(search->dag);
     search->dag = NULL;
     dag = ps_lattice_init_search(search, fsgs->frame);
@@ -1548,12 +1673,14 @@ fsg_search_lattice(ps_search_t *search)
 	ps_lattice_penalize_fillers(dag, silpen, fillpen);
     }
     search->dag = dag;
+    acmod_stage_stop(search->acmod, PS_STAGE_LATTICE);
 
     return dag;
 
 
 error_out:
     ps_lattice_free(dag);
+    acmod_stage_stop(search->acmod, PS_STAGE_LATTICE);
     return NULL;
 
 }
@@ -75,8 +75,14 @@ typedef struct fsg_search_s {
 				   active FSG */
     struct fsg_history_s *history;/**< For storing the Viterbi search history */
   
-    glist_t pnode_active;	/**< Those active in this frame */
-    glist_t pnode_active_next;	/**< Those activated for the next frame */
+    fsg_pnode_t **pnode_active;	/**< Those active in this frame */
+    fsg_pnode_t **pnode_active_next;	/**< Those activated for the next frame */
+    int32 n_pnode_active;	/**< Number of entries in pnode_active */
+    int32 n_pnode_active_next;	/**< Number of entries in pnode_active_next */
+    int32 *null_start;		/**< Null transitions out of state s are
+                                   null_links[null_start[s]] up to
+                                   null_links[null_start[s+1]] */
+    fsg_link_t **null_links;	/**< Null transitions, by source state */
   
     int32 beam_orig;		/**< Global pruning threshold */
     int32 pbeam_orig;		/**< Pruning threshold for phone transition */
@@ -85,6 +91,7 @@ typedef struct fsg_search_s {
                                      beams to determine actual effective beams.
                                      For implementing absolute pruning. */
     int32 beam, pbeam, wbeam;	/**< Effective beams after applying beam_factor */
+    int32 maxhmmpf;		/**< Active HMMs allowed before narrowing beams, or -1 */
     int32 lw, pip, wip;         /**< Language weights */
   
     frame_idx_t frame;		/**< Current frame. */
@@ -806,6 +806,519 @@ hmm_vit_eval(hmm_t * hmm)
     }
 }
 
+/*
+ * Batch evaluation.  The fields of HMM_BATCH HMMs are copied into
+ * vectors with one lane per HMM, evaluated with the same arithmetic
+ * as the code above but with selects in place of branches, and
+ * copied back.  This needs the GCC vector extensions; elsewhere the
+ * HMMs are simply evaluated one at a time.
+ */
+#if defined(__GNUC__)
+#define HMM_BATCH_VEC
+#if defined(__x86_64__) || defined(__i386__)
+#define HMM_BATCH_AVX2
+#endif
+/* The kernels are inlined into a version of the code for each target. */
+#define HMM_BATCH_INLINE static __inline__ __attribute__((always_inline))
+
+typedef int32 hmm_bvec_t __attribute__((vector_size(HMM_BATCH * sizeof(int32))));
+
+typedef struct hmm_batch_s {
+    hmm_bvec_t score[HMM_MAX_NSTATE];
+    hmm_bvec_t history[HMM_MAX_NSTATE];
+    hmm_bvec_t ssid[HMM_MAX_NSTATE];   /**< MPX senone sequence IDs. */
+    hmm_bvec_t senscr[HMM_MAX_NSTATE]; /**< 0 for BAD_SSID. */
+    hmm_bvec_t tp[HMM_MAX_NSTATE][3];  /**< Transitions from i to i+k. */
+    hmm_bvec_t out_score;
+    hmm_bvec_t out_history;
+    hmm_bvec_t bestscore;
+} hmm_batch_t;
+
+/* All lanes set to x. */
+#define batch_splat(x) ((hmm_bvec_t){ 0 } + (x))
+/* Lanes of a where m is set, otherwise those of b. */
+#define batch_sel(m, a, b) (((m) & (a)) | (~(m) & (b)))
+#define batch_clamp(s) batch_sel((s) WORSE_THAN WORST_SCORE, worst, (s))
+#define batch_best(s, t) batch_sel((s) BETTER_THAN (t), (s), (t))
+#define batch_tprob(i, k) b->tp[i][k]
+#define batch_valid(st) (id##st != BAD_SSID)
+#define batch_active(s) ((s) != WORST_SCORE)
+
+/*
+ * Vectors are built from the lanes directly, rather than written one
+ * lane at a time and read back, which stalls on store forwarding.
+ */
+#if HMM_BATCH != 8
+#error "batch_lanes() assumes HMM_BATCH is 8"
+#endif
+#define batch_lanes(f) { f(0), f(1), f(2), f(3), f(4), f(5), f(6), f(7) }
+#define lane_score(j) hmm_score(hmm[j], i)
+#define lane_history(j) hmm_history(hmm[j], i)
+#define lane_ssid(j) hmm[j]->senid[i]
+#define lane_senscr(j) -senscore[hmm[j]->senid[i]]
+#define lane_mpx_senscr(j) (hmm[j]->senid[i] == BAD_SSID \
+                            ? 0 : -senscore[sseq[hmm[j]->senid[i]][i]])
+#define lane_tprob(j) -tp[j][i][i + k]
+#define lane_out_score(j) hmm_out_score(hmm[j])
+#define lane_out_history(j) hmm_out_history(hmm[j])
+
+static void
+hmm_batch_load(hmm_batch_t *b, hmm_t **hmm, int n_state, int mpx)
+{
+    int16 const *senscore = hmm[0]->ctx->senscore;
+    uint16 * const *sseq = hmm[0]->ctx->sseq;
+    uint8 * const *tp[HMM_BATCH];
+    int i, j, k;
+
+    for (j = 0; j < HMM_BATCH; ++j)
+        tp[j] = hmm[j]->ctx->tp[hmm[j]->tmatid];
+    for (i = 0; i < n_state; ++i) {
+        b->score[i] = (hmm_bvec_t)batch_lanes(lane_score);
+        b->history[i] = (hmm_bvec_t)batch_lanes(lane_history);
+        if (mpx) {
+            b->ssid[i] = (hmm_bvec_t)batch_lanes(lane_ssid);
+            b->senscr[i] = (hmm_bvec_t)batch_lanes(lane_mpx_senscr);
+        }
+        else
+            b->senscr[i] = (hmm_bvec_t)batch_lanes(lane_senscr);
+        for (k = 0; k < 3 && i + k <= n_state; ++k)
+            b->tp[i][k] = (hmm_bvec_t)batch_lanes(lane_tprob);
+    }
+    b->out_score = (hmm_bvec_t)batch_lanes(lane_out_score);
+    b->out_history = (hmm_bvec_t)batch_lanes(lane_out_history);
+}
+
+static int32
+hmm_batch_store(hmm_batch_t const *b, hmm_t **hmm, int n_state)
+{
+    int32 bestscore = WORST_SCORE;
+    int i, j;
+
+    for (j = 0; j < HMM_BATCH; ++j) {
+        hmm_t *h = hmm[j];
+
+        for (i = 0; i < n_state; ++i) {
+            hmm_score(h, i) = b->score[i][j];
+            hmm_history(h, i) = b->history[i][j];
+            if (hmm_is_mpx(h))
+                h->senid[i] = b->ssid[i][j];
+        }
+        hmm_out_score(h) = b->out_score[j];
+        hmm_out_history(h) = b->out_history[j];
+        hmm_bestscore(h) = b->bestscore[j];
+        if (b->bestscore[j] BETTER_THAN bestscore)
+            bestscore = b->bestscore[j];
+    }
+    return bestscore;
+}
+
+/* As hmm_vit_eval_3st_lr(). */
+HMM_BATCH_INLINE void
+hmm_batch_3st_lr(hmm_batch_t *b)
+{
+    hmm_bvec_t const worst = batch_splat(WORST_SCORE);
+    hmm_bvec_t s3, s2, s1, s0, t2, t1, t0, m, bs, c, c2;
+    hmm_bvec_t h3, h2, h1, h0, hm;
+
+    h2 = b->history[2];
+    h1 = b->history[1];
+    h0 = b->history[0];
+    s2 = b->score[2] + b->senscr[2];
+    s1 = b->score[1] + b->senscr[1];
+    s0 = b->score[0] + b->senscr[0];
+
+    /* Transitions into non-emitting state 3, if state 1 is active */
+    t1 = s2 + batch_tprob(2, 1);
+    t2 = batch_sel(batch_tprob(1, 2) BETTER_THAN TMAT_WORST_SCORE,
+                   s1 + batch_tprob(1, 2), batch_splat(INT_MIN));
+    c = t1 BETTER_THAN t2;
+    s3 = batch_sel(c, t1, t2);
+    s3 = batch_clamp(s3);
+    h3 = batch_sel(c, h2, h1);
+    c = s1 BETTER_THAN WORST_SCORE;
+    b->out_score = batch_sel(c, s3, b->out_score);
+    b->out_history = batch_sel(c, h3, b->out_history);
+    bs = batch_sel(c, s3, worst);
+    t2 = batch_sel(c, t2, batch_splat(INT_MIN));
+
+    /* All transitions into state 2 */
+    t0 = s2 + batch_tprob(2, 0);
+    t1 = s1 + batch_tprob(1, 1);
+    t2 = batch_sel(batch_tprob(0, 2) BETTER_THAN TMAT_WORST_SCORE,
+                   s0 + batch_tprob(0, 2), t2);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    hm = batch_sel(c, h2, h1);
+    c2 = t2 BETTER_THAN m;
+    m = batch_sel(c2, t2, m);
+    m = batch_clamp(m);
+    b->history[2] = batch_sel(c2, h0, hm);
+    b->score[2] = m;
+    bs = batch_best(m, bs);
+
+    /* All transitions into state 1 */
+    t0 = s1 + batch_tprob(1, 0);
+    t1 = s0 + batch_tprob(0, 1);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    m = batch_clamp(m);
+    b->history[1] = batch_sel(c, h1, h0);
+    b->score[1] = m;
+    bs = batch_best(m, bs);
+
+    /* All transitions into state 0 */
+    m = s0 + batch_tprob(0, 0);
+    m = batch_clamp(m);
+    b->score[0] = m;
+    b->bestscore = batch_best(m, bs);
+}
+
+/* As hmm_vit_eval_3st_lr_mpx(). */
+HMM_BATCH_INLINE void
+hmm_batch_3st_lr_mpx(hmm_batch_t *b)
+{
+    hmm_bvec_t const worst = batch_splat(WORST_SCORE);
+    hmm_bvec_t s3, s2, s1, s0, t2, t1, t0, m, bs, c, c2;
+    hmm_bvec_t h2, h1, h0, hm;
+    hmm_bvec_t id2, id1, id0, im;
+
+    h2 = b->history[2];
+    h1 = b->history[1];
+    h0 = b->history[0];
+    id2 = b->ssid[2];
+    id1 = b->ssid[1];
+    id0 = b->ssid[0];
+
+    /* Don't propagate WORST_SCORE */
+    s2 = batch_sel(batch_valid(2), b->score[2] + b->senscr[2], worst);
+    t1 = batch_sel(batch_valid(2), s2 + batch_tprob(2, 1), worst);
+    s1 = batch_sel(batch_valid(1), b->score[1] + b->senscr[1], worst);
+    t2 = batch_sel(batch_tprob(1, 2) BETTER_THAN TMAT_WORST_SCORE,
+                   s1 + batch_tprob(1, 2), batch_splat(INT_MIN));
+    t2 = batch_sel(batch_valid(1), t2, worst);
+    c = t1 BETTER_THAN t2;
+    s3 = batch_sel(c, t1, t2);
+    s3 = batch_clamp(s3);
+    b->out_score = s3;
+    b->out_history = batch_sel(c, h2, h1);
+    bs = s3;
+
+    /* State 0 is always active */
+    s0 = b->score[0] + b->senscr[0];
+
+    /* Don't propagate WORST_SCORE */
+    t0 = batch_sel(batch_active(s2), s2 + batch_tprob(2, 0), worst);
+    t1 = batch_sel(batch_active(s1), s1 + batch_tprob(1, 1), worst);
+    t2 = batch_sel(batch_tprob(0, 2) BETTER_THAN TMAT_WORST_SCORE,
+                   s0 + batch_tprob(0, 2), t2);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    hm = batch_sel(c, h2, h1);
+    im = batch_sel(c, id2, id1);
+    c2 = t2 BETTER_THAN m;
+    m = batch_sel(c2, t2, m);
+    m = batch_clamp(m);
+    b->history[2] = batch_sel(c2, h0, hm);
+    b->ssid[2] = batch_sel(c2, id0, im);
+    b->score[2] = m;
+    bs = batch_best(m, bs);
+
+    /* Don't propagate WORST_SCORE */
+    t0 = batch_sel(batch_active(s1), s1 + batch_tprob(1, 0), worst);
+    t1 = s0 + batch_tprob(0, 1);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    m = batch_clamp(m);
+    b->history[1] = batch_sel(c, h1, h0);
+    b->ssid[1] = batch_sel(c, id1, id0);
+    b->score[1] = m;
+    bs = batch_best(m, bs);
+
+    /* State 0 is always active */
+    m = s0 + batch_tprob(0, 0);
+    m = batch_clamp(m);
+    b->score[0] = m;
+    b->bestscore = batch_best(m, bs);
+}
+
+/* As hmm_vit_eval_5st_lr(). */
+HMM_BATCH_INLINE void
+hmm_batch_5st_lr(hmm_batch_t *b)
+{
+    hmm_bvec_t const worst = batch_splat(WORST_SCORE);
+    hmm_bvec_t s5, s4, s3, s2, s1, s0, t2, t1, t0, m, bs, c, c2;
+    hmm_bvec_t h5, h4, h3, h2, h1, h0, hm;
+
+    h4 = b->history[4];
+    h3 = b->history[3];
+    h2 = b->history[2];
+    h1 = b->history[1];
+    h0 = b->history[0];
+
+    s4 = b->score[4] + b->senscr[4];
+    s3 = b->score[3] + b->senscr[3];
+    /* Transitions into non-emitting state 5, if state 3 is active */
+    t1 = s4 + batch_tprob(4, 1);
+    t2 = s3 + batch_tprob(3, 2);
+    c = t1 BETTER_THAN t2;
+    s5 = batch_sel(c, t1, t2);
+    s5 = batch_clamp(s5);
+    h5 = batch_sel(c, h4, h3);
+    c = s3 BETTER_THAN WORST_SCORE;
+    b->out_score = batch_sel(c, s5, b->out_score);
+    b->out_history = batch_sel(c, h5, b->out_history);
+    bs = batch_sel(c, s5, worst);
+
+    s2 = b->score[2] + b->senscr[2];
+    /* All transitions into state 4, if state 2 is active */
+    t0 = s4 + batch_tprob(4, 0);
+    t1 = s3 + batch_tprob(3, 1);
+    t2 = s2 + batch_tprob(2, 2);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    hm = batch_sel(c, h4, h3);
+    c2 = t2 BETTER_THAN m;
+    m = batch_sel(c2, t2, m);
+    m = batch_clamp(m);
+    hm = batch_sel(c2, h2, hm);
+    c = s2 BETTER_THAN WORST_SCORE;
+    b->score[4] = batch_sel(c, m, b->score[4]);
+    b->history[4] = batch_sel(c, hm, h4);
+    bs = batch_sel(c, batch_best(m, bs), bs);
+
+    s1 = b->score[1] + b->senscr[1];
+    /* All transitions into state 3, if state 1 is active */
+    t0 = s3 + batch_tprob(3, 0);
+    t1 = s2 + batch_tprob(2, 1);
+    t2 = s1 + batch_tprob(1, 2);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    hm = batch_sel(c, h3, h2);
+    c2 = t2 BETTER_THAN m;
+    m = batch_sel(c2, t2, m);
+    m = batch_clamp(m);
+    hm = batch_sel(c2, h1, hm);
+    c = s1 BETTER_THAN WORST_SCORE;
+    b->score[3] = batch_sel(c, m, b->score[3]);
+    b->history[3] = batch_sel(c, hm, h3);
+    bs = batch_sel(c, batch_best(m, bs), bs);
+
+    s0 = b->score[0] + b->senscr[0];
+    /* All transitions into state 2 (state 0 is always active) */
+    t0 = s2 + batch_tprob(2, 0);
+    t1 = s1 + batch_tprob(1, 1);
+    t2 = s0 + batch_tprob(0, 2);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    hm = batch_sel(c, h2, h1);
+    c2 = t2 BETTER_THAN m;
+    m = batch_sel(c2, t2, m);
+    m = batch_clamp(m);
+    b->history[2] = batch_sel(c2, h0, hm);
+    b->score[2] = m;
+    bs = batch_best(m, bs);
+
+    /* All transitions into state 1 */
+    t0 = s1 + batch_tprob(1, 0);
+    t1 = s0 + batch_tprob(0, 1);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    m = batch_clamp(m);
+    b->history[1] = batch_sel(c, h1, h0);
+    b->score[1] = m;
+    bs = batch_best(m, bs);
+
+    /* All transitions into state 0 */
+    m = s0 + batch_tprob(0, 0);
+    m = batch_clamp(m);
+    b->score[0] = m;
+    b->bestscore = batch_best(m, bs);
+}
+
+/* As hmm_vit_eval_5st_lr_mpx(). */
+HMM_BATCH_INLINE void
+hmm_batch_5st_lr_mpx(hmm_batch_t *b)
+{
+    hmm_bvec_t const worst = batch_splat(WORST_SCORE);
+    hmm_bvec_t s5, s4, s3, s2, s1, s0, t2, t1, t0, m, bs, c, c2;
+    hmm_bvec_t h4, h3, h2, h1, h0, hm;
+    hmm_bvec_t id4, id3, id2, id1, id0, im;
+
+    h4 = b->history[4];
+    h3 = b->history[3];
+    h2 = b->history[2];
+    h1 = b->history[1];
+    h0 = b->history[0];
+    id4 = b->ssid[4];
+    id3 = b->ssid[3];
+    id2 = b->ssid[2];
+    id1 = b->ssid[1];
+    id0 = b->ssid[0];
+
+    /* Don't propagate WORST_SCORE */
+    s4 = batch_sel(batch_valid(4), b->score[4] + b->senscr[4], worst);
+    t1 = batch_sel(batch_valid(4), s4 + batch_tprob(4, 1), worst);
+    s3 = batch_sel(batch_valid(3), b->score[3] + b->senscr[3], worst);
+    t2 = batch_sel(batch_valid(3), s3 + batch_tprob(3, 2), worst);
+    c = t1 BETTER_THAN t2;
+    s5 = batch_sel(c, t1, t2);
+    s5 = batch_clamp(s5);
+    b->out_score = s5;
+    b->out_history = batch_sel(c, h4, h3);
+    bs = s5;
+
+    /* Don't propagate WORST_SCORE */
+    s2 = batch_sel(batch_valid(2), b->score[2] + b->senscr[2], worst);
+    t2 = batch_sel(batch_valid(2), s2 + batch_tprob(2, 2), worst);
+    t0 = batch_sel(batch_active(s4), s4 + batch_tprob(4, 0), worst);
+    t1 = batch_sel(batch_active(s3), s3 + batch_tprob(3, 1), worst);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    hm = batch_sel(c, h4, h3);
+    im = batch_sel(c, id4, id3);
+    c2 = t2 BETTER_THAN m;
+    m = batch_sel(c2, t2, m);
+    m = batch_clamp(m);
+    b->history[4] = batch_sel(c2, h2, hm);
+    b->ssid[4] = batch_sel(c2, id2, im);
+    b->score[4] = m;
+    bs = batch_best(m, bs);
+
+    /* Don't propagate WORST_SCORE */
+    s1 = batch_sel(batch_valid(1), b->score[1] + b->senscr[1], worst);
+    t2 = batch_sel(batch_valid(1), s1 + batch_tprob(1, 2), worst);
+    t0 = batch_sel(batch_active(s3), s3 + batch_tprob(3, 0), worst);
+    t1 = batch_sel(batch_active(s2), s2 + batch_tprob(2, 1), worst);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    hm = batch_sel(c, h3, h2);
+    im = batch_sel(c, id3, id2);
+    c2 = t2 BETTER_THAN m;
+    m = batch_sel(c2, t2, m);
+    m = batch_clamp(m);
+    b->history[3] = batch_sel(c2, h1, hm);
+    b->ssid[3] = batch_sel(c2, id1, im);
+    b->score[3] = m;
+    bs = batch_best(m, bs);
+
+    /* State 0 is always active */
+    s0 = b->score[0] + b->senscr[0];
+
+    /* Don't propagate WORST_SCORE */
+    t0 = batch_sel(batch_active(s2), s2 + batch_tprob(2, 0), worst);
+    t1 = batch_sel(batch_active(s1), s1 + batch_tprob(1, 1), worst);
+    t2 = s0 + batch_tprob(0, 2);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    hm = batch_sel(c, h2, h1);
+    im = batch_sel(c, id2, id1);
+    c2 = t2 BETTER_THAN m;
+    m = batch_sel(c2, t2, m);
+    m = batch_clamp(m);
+    b->history[2] = batch_sel(c2, h0, hm);
+    b->ssid[2] = batch_sel(c2, id0, im);
+    b->score[2] = m;
+    bs = batch_best(m, bs);
+
+    /* Don't propagate WORST_SCORE */
+    t0 = batch_sel(batch_active(s1), s1 + batch_tprob(1, 0), worst);
+    t1 = s0 + batch_tprob(0, 1);
+    c = t0 BETTER_THAN t1;
+    m = batch_sel(c, t0, t1);
+    m = batch_clamp(m);
+    b->history[1] = batch_sel(c, h1, h0);
+    b->ssid[1] = batch_sel(c, id1, id0);
+    b->score[1] = m;
+    bs = batch_best(m, bs);
+
+    m = s0 + batch_tprob(0, 0);
+    m = batch_clamp(m);
+    b->score[0] = m;
+    b->bestscore = batch_best(m, bs);
+}
+
+HMM_BATCH_INLINE void
+hmm_batch_eval(hmm_batch_t *b, int n_state, int mpx)
+{
+    if (mpx) {
+        if (n_state == 5)
+            hmm_batch_5st_lr_mpx(b);
+        else
+            hmm_batch_3st_lr_mpx(b);
+    }
+    else {
+        if (n_state == 5)
+            hmm_batch_5st_lr(b);
+        else
+            hmm_batch_3st_lr(b);
+    }
+}
+
+static void
+hmm_batch_eval_default(hmm_batch_t *b, int n_state, int mpx)
+{
+    hmm_batch_eval(b, n_state, mpx);
+}
+
+#ifdef HMM_BATCH_AVX2
+__attribute__((target("avx2")))
+static void
+hmm_batch_eval_avx2(hmm_batch_t *b, int n_state, int mpx)
+{
+    hmm_batch_eval(b, n_state, mpx);
+}
+#endif
+
+/* Can hmm[0] to hmm[HMM_BATCH-1] be done together? */
+static int
+hmm_batch_ok(hmm_t **hmm)
+{
+    int i;
+
+    if (hmm_n_emit_state(hmm[0]) != 3 && hmm_n_emit_state(hmm[0]) != 5)
+        return FALSE;
+    for (i = 1; i < HMM_BATCH; ++i)
+        if (hmm_n_emit_state(hmm[i]) != hmm_n_emit_state(hmm[0])
+            || hmm_is_mpx(hmm[i]) != hmm_is_mpx(hmm[0]))
+            return FALSE;
+    return TRUE;
+}
+#endif /* __GNUC__ */
+
+int32
+hmm_vit_eval_batch(hmm_t **hmm, int32 n_hmm)
+{
+#ifdef HMM_BATCH_VEC
+    void (*batch_eval)(hmm_batch_t *, int, int) = hmm_batch_eval_default;
+    hmm_batch_t b;
+#endif
+    int32 bestscore, score;
+    int32 i;
+
+#ifdef HMM_BATCH_AVX2
+    if (__builtin_cpu_supports("avx2"))
+        batch_eval = hmm_batch_eval_avx2;
+#endif
+    bestscore = WORST_SCORE;
+    for (i = 0; i < n_hmm; ) {
+#ifdef HMM_BATCH_VEC
+        if (i + HMM_BATCH <= n_hmm && hmm_batch_ok(hmm + i)) {
+            int n_state = hmm_n_emit_state(hmm[i]);
+
+            hmm_batch_load(&b, hmm + i, n_state, hmm_is_mpx(hmm[i]));
+            (*batch_eval)(&b, n_state, hmm_is_mpx(hmm[i]));
+            score = hmm_batch_store(&b, hmm + i, n_state);
+            i += HMM_BATCH;
+        }
+        else
+#endif
+            score = hmm_vit_eval(hmm[i++]);
+        if (score BETTER_THAN bestscore)
+            bestscore = score;
+    }
+    return bestscore;
+}
+
 int32
 hmm_dump_vit_eval(hmm_t * hmm, FILE * fp)
 {
@@ -281,7 +281,23 @@ void hmm_enter(hmm_t *h, int32 score,
  * well.
 */
 int32 hmm_vit_eval(hmm_t *hmm);
-  
+
+/**
+ * Number of HMMs evaluated together by hmm_vit_eval_batch().
+ */
+#define HMM_BATCH 8
+
+/**
+ * Viterbi evaluation of several HMMs at once.
+ *
+ * Runs of HMM_BATCH 3- or 5-state HMMs of the same kind are done
+ * together in branch-free code, one vector lane per HMM, and the rest
+ * one at a time.  The results are exactly those of hmm_vit_eval().
+ *
+ * @return Best score of all the HMMs.
+ */
+int32 hmm_vit_eval_batch(hmm_t **hmm, int32 n_hmm);
+
 
 /**
  * Like hmm_vit_eval, but dump HMM state and relevant senscr to fp first, for debugging;.
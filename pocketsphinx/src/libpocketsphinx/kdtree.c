@@ -0,0 +1,315 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file kdtree.c
+ * @brief kd-trees for Gaussian preselection in tied-mixture models.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* SphinxBase headers. */
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/pio.h>
+
+/* Local headers. */
+#include "kdtree.h"
+
+#define KDTREE_VERSION 1
+#define KDTREE_MAX_LEVEL 16
+
+/* State for reading one tree. */
+typedef struct kd_reader_s {
+    lineiter_t *li;
+    kd_tree_t *tree;
+    int32 n_density;
+    int32 n_comp;
+    int32 maxbbi;
+    int32 n_leaf;
+    int32 n_bbi, n_bbi_alloc;
+} kd_reader_t;
+
+static int
+read_tree_int(kd_reader_t *r, char const *name, int32 *out)
+{
+    char key[32];
+
+    if ((r->li = lineiter_next(r->li)) == NULL
+        || sscanf(r->li->buf, "%31s %d", key, out) != 2
+        || strcmp(key, name) != 0) {
+        E_ERROR("Expected '%s' in kd-tree file\n", name);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+read_tree_float(kd_reader_t *r, char const *name, float32 *out)
+{
+    char key[32];
+
+    if ((r->li = lineiter_next(r->li)) == NULL
+        || sscanf(r->li->buf, "%31s %f", key, out) != 2
+        || strcmp(key, name) != 0) {
+        E_ERROR("Expected '%s' in kd-tree file\n", name);
+        return -1;
+    }
+    return 0;
+}
+
+/* Read a BBI list, keeping it only if this is a leaf. */
+static int
+read_bbi_list(kd_reader_t *r, int is_leaf)
+{
+    char *ptr, *end;
+    int32 n;
+
+    if ((r->li = lineiter_next(r->li)) == NULL
+        || strncmp(r->li->buf, "bbi", 3) != 0
+        || (r->li->buf[3] != '\0' && r->li->buf[3] != ' ')) {
+        E_ERROR("Expected 'bbi' in kd-tree file\n");
+        return -1;
+    }
+    if (is_leaf)
+        r->tree->leaf[r->n_leaf++] = r->n_bbi;
+    for (n = 0, ptr = r->li->buf + 3;; ptr = end, ++n) {
+        long cw = strtol(ptr, &end, 10);
+
+        if (end == ptr)
+            break;
+        if (cw < 0 || cw >= r->n_density) {
+            E_ERROR("BBI Gaussian %ld out of range\n", cw);
+            return -1;
+        }
+        if (!is_leaf || (r->maxbbi >= 0 && n >= r->maxbbi))
+            continue;
+        if (r->n_bbi == r->n_bbi_alloc) {
+            r->n_bbi_alloc += 1024;
+            r->tree->bbi = ckd_realloc(r->tree->bbi, r->n_bbi_alloc
+                                       * sizeof(*r->tree->bbi));
+        }
+        r->tree->bbi[r->n_bbi++] = (uint16)cw;
+    }
+    if (*ptr != '\0') {
+        E_ERROR("Invalid BBI list: %s\n", r->li->buf);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Nodes are written depth-first, each with its level (counting the
+ * leaves as 1).  Those below the depth we are using are read and
+ * thrown away; at that depth they become leaves.
+ */
+static int
+read_kd_node(kd_reader_t *r, int32 level, int32 olevel, int32 node)
+{
+    int32 n, comp;
+    float32 plane;
+
+    if (read_tree_int(r, "NODE", &n) < 0)
+        return -1;
+    if (n != level) {
+        E_ERROR("kd-tree node at level %d, expected %d\n", n, level);
+        return -1;
+    }
+    if (read_tree_int(r, "split_comp", &comp) < 0
+        || read_tree_float(r, "split_plane", &plane) < 0)
+        return -1;
+    if (comp < 0 || comp >= r->n_comp) {
+        E_ERROR("kd-tree split component %d out of range\n", comp);
+        return -1;
+    }
+    if (olevel > 1) {
+        r->tree->split[node].comp = comp;
+        r->tree->split[node].plane = FLOAT2MFCC(plane);
+    }
+    if (read_bbi_list(r, olevel == 1) < 0)
+        return -1;
+    if (level > 1) {
+        if (read_kd_node(r, level - 1, olevel - 1, 2 * node + 1) < 0)
+            return -1;
+        if (read_kd_node(r, level - 1, olevel - 1, 2 * node + 2) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+static void
+kd_tree_free(kd_tree_t *tree)
+{
+    if (tree == NULL)
+        return;
+    ckd_free(tree->split);
+    ckd_free(tree->leaf);
+    ckd_free(tree->bbi);
+    ckd_free(tree);
+}
+
+static kd_tree_t *
+read_kd_tree(kd_reader_t *r, int32 maxdepth)
+{
+    int32 n_level, n_leaf;
+    float32 threshold;
+
+    if (read_tree_int(r, "n_density", &r->n_density) < 0
+        || read_tree_int(r, "n_comp", &r->n_comp) < 0
+        || read_tree_int(r, "n_level", &n_level) < 0
+        || read_tree_float(r, "threshold", &threshold) < 0)
+        return NULL;
+    if (n_level < 1 || n_level > KDTREE_MAX_LEVEL) {
+        E_ERROR("Depth of kd-tree (%d) must be between 1 and %d\n",
+                n_level, KDTREE_MAX_LEVEL);
+        return NULL;
+    }
+
+    r->tree = ckd_calloc(1, sizeof(*r->tree));
+    if (maxdepth <= 0 || maxdepth > n_level)
+        maxdepth = n_level;
+    r->tree->n_level = maxdepth;
+    n_leaf = 1 << (maxdepth - 1);
+    r->tree->split = ckd_calloc(n_leaf - 1 > 0 ? n_leaf - 1 : 1,
+                                sizeof(*r->tree->split));
+    r->tree->leaf = ckd_calloc(n_leaf + 1, sizeof(*r->tree->leaf));
+    r->n_leaf = r->n_bbi = r->n_bbi_alloc = 0;
+    if (read_kd_node(r, n_level, maxdepth, 0) < 0) {
+        kd_tree_free(r->tree);
+        return NULL;
+    }
+    r->tree->leaf[n_leaf] = r->n_bbi;
+    return r->tree;
+}
+
+kd_tree_t **
+kd_trees_read(char const *file, gauden_t *g, int32 maxdepth, int32 maxbbi)
+{
+    kd_reader_t r;
+    kd_tree_t **trees;
+    FILE *fp;
+    int32 version, n_trees, i;
+    double n_bbi, n_leaf;
+
+    if ((fp = fopen(file, "r")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open kd-tree file '%s'", file);
+        return NULL;
+    }
+    memset(&r, 0, sizeof(r));
+    r.maxbbi = maxbbi;
+    trees = NULL;
+    n_trees = g->n_mgau * g->n_feat;
+    if ((r.li = lineiter_start_clean(fp)) == NULL
+        || strcmp(r.li->buf, "KD-TREES") != 0) {
+        E_ERROR("%s does not appear to be a kd-tree file\n", file);
+        goto error_out;
+    }
+    if (read_tree_int(&r, "version", &version) < 0)
+        goto error_out;
+    if (version > KDTREE_VERSION) {
+        E_ERROR("Unsupported kd-tree file version %d\n", version);
+        goto error_out;
+    }
+    if (read_tree_int(&r, "n_trees", &i) < 0)
+        goto error_out;
+    if (i != n_trees) {
+        E_ERROR("Number of kd-trees (%d) does not match model (%d x %d)\n",
+                i, g->n_mgau, g->n_feat);
+        goto error_out;
+    }
+
+    trees = ckd_calloc(n_trees, sizeof(*trees));
+    n_bbi = n_leaf = 0;
+    for (i = 0; i < n_trees; ++i) {
+        int32 n;
+
+        if (read_tree_int(&r, "TREE", &n) < 0)
+            goto error_out;
+        if (n != i) {
+            E_ERROR("kd-tree %d out of sequence\n", n);
+            goto error_out;
+        }
+        if ((trees[i] = read_kd_tree(&r, maxdepth)) == NULL)
+            goto error_out;
+        if (r.n_density != g->n_density
+            || r.n_comp != g->featlen[i % g->n_feat]) {
+            E_ERROR("kd-tree %d is for %d Gaussians of dimension %d, "
+                    "model has %d of dimension %d\n",
+                    i, r.n_density, r.n_comp,
+                    g->n_density, g->featlen[i % g->n_feat]);
+            goto error_out;
+        }
+        n_bbi += r.n_bbi;
+        n_leaf += 1 << (trees[i]->n_level - 1);
+    }
+    E_INFO("Read %d kd-trees of depth %d from %s, %.1f Gaussians per leaf\n",
+           n_trees, trees[0]->n_level, file, n_bbi / n_leaf);
+    lineiter_free(r.li);
+    fclose(fp);
+    return trees;
+
+error_out:
+    lineiter_free(r.li);
+    fclose(fp);
+    kd_trees_free(trees, n_trees);
+    return NULL;
+}
+
+void
+kd_trees_free(kd_tree_t **trees, int32 n_trees)
+{
+    int32 i;
+
+    if (trees == NULL)
+        return;
+    for (i = 0; i < n_trees; ++i)
+        kd_tree_free(trees[i]);
+    ckd_free(trees);
+}
+
+uint16 const *
+kd_tree_eval(kd_tree_t const *tree, mfcc_t const *feat, int32 *out_n_bbi)
+{
+    int32 n_internal, node, leaf;
+
+    n_internal = (1 << (tree->n_level - 1)) - 1;
+    node = 0;
+    while (node < n_internal) {
+        kd_tree_split_t const *split = tree->split + node;
+        node = 2 * node + 1 + (feat[split->comp] >= split->plane);
+    }
+    leaf = node - n_internal;
+    *out_n_bbi = tree->leaf[leaf + 1] - tree->leaf[leaf];
+    return tree->bbi + tree->leaf[leaf];
+}
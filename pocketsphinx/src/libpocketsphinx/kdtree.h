@@ -0,0 +1,110 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file kdtree.h
+ * @brief kd-trees for Gaussian preselection in tied-mixture models.
+ *
+ * These implement the Bucket Box Intersection algorithm from
+ * J. Fritsch and I. Rogina, "The Bucket Box Intersection Algorithm
+ * for fast approximate evaluation of Diagonal Mixture Gaussians",
+ * Proceedings of ICASSP 1996, and read the trees written by
+ * SphinxTrain's kdtree program.  For each frame, descending the tree
+ * for a codebook gives a short list of the Gaussians likely to score
+ * well, and only those need to be evaluated.
+ *
+ * Trees are balanced, so they are stored in breadth-first order:
+ * the children of node <code>i</code> are <code>2i+1</code> and
+ * <code>2i+2</code>, and the descent walks one small array instead of
+ * chasing pointers.  The lists for all leaves are packed together in
+ * another.
+ */
+
+#ifndef __KDTREE_H__
+#define __KDTREE_H__
+
+/* SphinxBase headers. */
+#include <sphinxbase/prim_type.h>
+#include <sphinxbase/fe.h>
+
+/* Local headers. */
+#include "ms_gauden.h"
+
+/**
+ * Split made at an internal node.
+ */
+typedef struct kd_tree_split_s {
+    mfcc_t plane;       /**< Features below this go left, others right */
+    int32 comp;         /**< Feature component compared */
+} kd_tree_split_t;
+
+/**
+ * kd-tree for one stream of one codebook.
+ */
+typedef struct kd_tree_s {
+    int32 n_level;      /**< Number of levels used, including leaves */
+    kd_tree_split_t *split; /**< Internal nodes, in breadth-first order */
+    int32 *leaf;        /**< Start of each leaf's list in bbi, and the end */
+    uint16 *bbi;        /**< Gaussians intersecting each leaf, best first */
+} kd_tree_t;
+
+/**
+ * Read kd-trees for a set of codebooks.
+ *
+ * There must be one tree for each stream of each codebook in
+ * <code>g</code>, in that order, built for the same dimensions and
+ * number of Gaussians.
+ *
+ * @param maxdepth Number of levels to use, or 0 for all of them.
+ * @param maxbbi Maximum number of Gaussians to keep in each leaf,
+ *               or -1 for all of them.
+ * @return Array of <code>g->n_mgau * g->n_feat</code> trees, or NULL
+ *         on failure.
+ */
+kd_tree_t **kd_trees_read(char const *file, gauden_t *g,
+                          int32 maxdepth, int32 maxbbi);
+
+/**
+ * Free trees returned by kd_trees_read().
+ */
+void kd_trees_free(kd_tree_t **trees, int32 n_trees);
+
+/**
+ * Find the Gaussians to evaluate for a feature vector.
+ *
+ * @param out_n_bbi Output: number of Gaussians in the list.
+ * @return List of Gaussians, best first, belonging to the tree.
+ */
+uint16 const *kd_tree_eval(kd_tree_t const *tree, mfcc_t const *feat,
+                           int32 *out_n_bbi);
+
+#endif /* __KDTREE_H__ */
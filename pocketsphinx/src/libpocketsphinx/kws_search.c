@@ -51,7 +51,7 @@
 
 /** Access macros */
 #define hmm_is_active(hmm) ((hmm)->frame > 0)
-#define kws_nth_hmm(keyphrase,n) (&((keyphrase)->hmms[n]))
+#define kws_node_hmm(kwss,n) (&((kwss)->nodes[n].hmm))
 
 /* Value selected experimentally as maximum difference between triphone
 score and phone loop score, used in confidence computation to make sure
@@ -139,6 +139,10 @@ kws_search_seg_iter(ps_search_t * search)
     return (ps_seg_t *)itor;
 }
 
+static ps_search_t *kws_search_clone(ps_search_t * search, acmod_t * acmod,
+                                     dict_t * dict);
+static void kws_search_mem(ps_search_t * search, ps_mem_t * out_mem);
+
 static ps_searchfuncs_t kws_funcs = {
     /* start: */ kws_search_start,
     /* step: */ kws_search_step,
@@ -149,6 +153,8 @@ static ps_searchfuncs_t kws_funcs = {
     /* hyp: */ kws_search_hyp,
     /* prob: */ kws_search_prob,
     /* seg_iter: */ kws_search_seg_iter,
+    /* clone: */ kws_search_clone,
+    /* mem: */ kws_search_mem,
 };
 
 
@@ -157,7 +163,6 @@ static void
 kws_search_sen_active(kws_search_t * kwss)
 {
     int i;
-    gnode_t *gn;
 
     acmod_clear_active(ps_search_acmod(kwss));
 
@@ -166,12 +171,9 @@ kws_search_sen_active(kws_search_t * kwss)
         acmod_activate_hmm(ps_search_acmod(kwss), &kwss->pl_hmms[i]);
 
     /* activate hmms in active nodes */
-    for (gn = kwss->keyphrases; gn; gn = gnode_next(gn)) {
-        kws_keyphrase_t *keyphrase = gnode_ptr(gn);
-        for (i = 0; i < keyphrase->n_hmms; i++) {
-            if (hmm_is_active(kws_nth_hmm(keyphrase, i)))
-                acmod_activate_hmm(ps_search_acmod(kwss), kws_nth_hmm(keyphrase, i));
-        }
+    for (i = 0; i < kwss->n_nodes; i++) {
+        if (hmm_is_active(kws_node_hmm(kwss, i)))
+            acmod_activate_hmm(ps_search_acmod(kwss), kws_node_hmm(kwss, i));
     }
 }
 
@@ -183,7 +185,6 @@ static void
 kws_search_hmm_eval(kws_search_t * kwss, int16 const *senscr)
 {
     int32 i;
-    gnode_t *gn;
     int32 bestscore = WORST_SCORE;
 
     hmm_context_set_senscore(kwss->hmmctx, senscr);
@@ -197,18 +198,16 @@ kws_search_hmm_eval(kws_search_t * kwss, int16 const *senscr)
         if (score BETTER_THAN bestscore)
             bestscore = score;
     }
-    /* evaluate hmms for active nodes */
-    for (gn = kwss->keyphrases; gn; gn = gnode_next(gn)) {
-        kws_keyphrase_t *keyphrase = gnode_ptr(gn);
-        for (i = 0; i < keyphrase->n_hmms; i++) {
-            hmm_t *hmm = kws_nth_hmm(keyphrase, i);
-
-            if (hmm_is_active(hmm)) {
-                int32 score;
-                score = hmm_vit_eval(hmm);
-                if (score BETTER_THAN bestscore)
-                    bestscore = score;
-            }
+    /* evaluate hmms for active nodes, once for all the keyphrases
+     * that share them */
+    for (i = 0; i < kwss->n_nodes; i++) {
+        hmm_t *hmm = kws_node_hmm(kwss, i);
+
+        if (hmm_is_active(hmm)) {
+            int32 score;
+            score = hmm_vit_eval(hmm);
+            if (score BETTER_THAN bestscore)
+                bestscore = score;
         }
     }
 
@@ -223,17 +222,13 @@ static void
 kws_search_hmm_prune(kws_search_t * kwss)
 {
     int32 thresh, i;
-    gnode_t *gn;
 
     thresh = kwss->bestscore + kwss->beam;
 
-    for (gn = kwss->keyphrases; gn; gn = gnode_next(gn)) {
-        kws_keyphrase_t *keyphrase = gnode_ptr(gn);
-        for (i = 0; i < keyphrase->n_hmms; i++) {
-    	    hmm_t *hmm = kws_nth_hmm(keyphrase, i);
-            if (hmm_is_active(hmm) && hmm_bestscore(hmm) < thresh)
-                hmm_clear(hmm);
-        }
+    for (i = 0; i < kwss->n_nodes; i++) {
+        hmm_t *hmm = kws_node_hmm(kwss, i);
+        if (hmm_is_active(hmm) && hmm_bestscore(hmm) < thresh)
+            hmm_clear(hmm);
     }
 }
 
@@ -265,10 +260,10 @@ kws_search_trans(kws_search_t * kwss)
         kws_keyphrase_t *keyphrase = gnode_ptr(gn);
         hmm_t *last_hmm;
         
-        if (keyphrase->n_hmms < 1)
+        if (keyphrase->last_node < 0)
     	    continue;
         
-        last_hmm = kws_nth_hmm(keyphrase, keyphrase->n_hmms - 1);
+        last_hmm = kws_node_hmm(kwss, keyphrase->last_node);
 
         if (hmm_is_active(last_hmm)
             && hmm_out_score(pl_best_hmm) BETTER_THAN WORST_SCORE) {
@@ -295,16 +290,15 @@ kws_search_trans(kws_search_t * kwss)
         }
     }
 
-    /* Activate new keyphrase nodes, enter their hmms */
-    for (gn = kwss->keyphrases; gn; gn = gnode_next(gn)) {
-        kws_keyphrase_t *keyphrase = gnode_ptr(gn);
-        
-        if (keyphrase->n_hmms < 1)
-    	    continue;
-        
-        for (i = keyphrase->n_hmms - 1; i > 0; i--) {
-            hmm_t *pred_hmm = kws_nth_hmm(keyphrase, i - 1);
-            hmm_t *hmm = kws_nth_hmm(keyphrase, i);
+    /* Activate new keyphrase nodes, enter their hmms.  Children come
+     * after their parents, so going backwards no node is entered from
+     * one that was itself only entered in this frame. */
+    for (i = kwss->n_nodes - 1; i >= 0; i--) {
+        hmm_t *hmm = kws_node_hmm(kwss, i);
+        int32 parent = kwss->nodes[i].parent;
+
+        if (parent >= 0) {
+            hmm_t *pred_hmm = kws_node_hmm(kwss, parent);
 
             if (hmm_is_active(pred_hmm)) {    
                 if (!hmm_is_active(hmm)
@@ -314,15 +308,76 @@ kws_search_trans(kws_search_t * kwss)
                                   hmm_out_history(pred_hmm), kwss->frame + 1);
             }
         }
-
         /* Enter keyphrase start node from phone loop */
-        if (hmm_out_score(pl_best_hmm) BETTER_THAN
-            hmm_in_score(kws_nth_hmm(keyphrase, 0)))
-                hmm_enter(kws_nth_hmm(keyphrase, 0), hmm_out_score(pl_best_hmm),
+        else if (hmm_out_score(pl_best_hmm) BETTER_THAN
+                 hmm_in_score(hmm))
+                hmm_enter(hmm, hmm_out_score(pl_best_hmm),
                     kwss->frame, kwss->frame + 1);
     }
 }
 
+/* Prefix trie under construction, before its HMMs are allocated. */
+typedef struct kws_tnode_s {
+    int32 ssid, tmatid;
+    int32 parent, child, sibling;
+} kws_tnode_t;
+
+typedef struct kws_trie_s {
+    kws_tnode_t *tnodes;
+    int32 n_tnodes, n_alloc;
+    int32 roots;                /**< First root, linked through sibling. */
+} kws_trie_t;
+
+/**
+ * Find the child of a trie node (or the root, for parent -1) with the
+ * given HMM, adding it if there is none.
+ */
+static int32
+kws_trie_child(kws_trie_t *trie, int32 parent, int32 ssid, int32 tmatid)
+{
+    kws_tnode_t *tn;
+    int32 i;
+
+    i = (parent < 0) ? trie->roots : trie->tnodes[parent].child;
+    for (; i >= 0; i = trie->tnodes[i].sibling) {
+        if (trie->tnodes[i].ssid == ssid && trie->tnodes[i].tmatid == tmatid)
+            return i;
+    }
+
+    if (trie->n_tnodes == trie->n_alloc) {
+        trie->n_alloc = trie->n_alloc ? trie->n_alloc * 2 : 256;
+        trie->tnodes = ckd_realloc(trie->tnodes,
+                                   trie->n_alloc * sizeof(*trie->tnodes));
+    }
+    i = trie->n_tnodes++;
+    tn = &trie->tnodes[i];
+    tn->ssid = ssid;
+    tn->tmatid = tmatid;
+    tn->parent = parent;
+    tn->child = -1;
+    if (parent < 0) {
+        tn->sibling = trie->roots;
+        trie->roots = i;
+    }
+    else {
+        tn->sibling = trie->tnodes[parent].child;
+        trie->tnodes[parent].child = i;
+    }
+    return i;
+}
+
+static void
+kws_search_free_nodes(kws_search_t *kwss)
+{
+    int32 i;
+
+    for (i = 0; i < kwss->n_nodes; ++i)
+        hmm_deinit(kws_node_hmm(kwss, i));
+    ckd_free(kwss->nodes);
+    kwss->nodes = NULL;
+    kwss->n_nodes = 0;
+}
+
 static int
 kws_search_read_list(kws_search_t *kwss, const char* keyfile)
 {
@@ -370,12 +425,10 @@ kws_search_read_list(kws_search_t *kwss, const char* keyfile)
     return 0;
 }
 
-ps_search_t *
-kws_search_init(const char *name,
-                const char *keyphrase,
-                const char *keyfile,
-                cmd_ln_t * config,
-                acmod_t * acmod, dict_t * dict, dict2pid_t * d2p)
+/* Allocate a search with the parameters in config and no keyphrases. */
+static kws_search_t *
+kws_search_alloc(const char *name, cmd_ln_t * config,
+                 acmod_t * acmod, dict_t * dict, dict2pid_t * d2p)
 {
     kws_search_t *kwss = (kws_search_t *) ckd_calloc(1, sizeof(*kwss));
     ps_search_init(ps_search_base(kwss), &kws_funcs, PS_SEARCH_TYPE_KWS, name, config, acmod, dict,
@@ -405,6 +458,34 @@ kws_search_init(const char *name,
     E_INFO("KWS(beam: %d, plp: %d, default threshold %d, delay %d)\n",
            kwss->beam, kwss->plp, kwss->def_threshold, kwss->delay);
 
+    return kwss;
+}
+
+/* Build the search for its keyphrases, freeing it on failure. */
+static ps_search_t *
+kws_search_setup(kws_search_t * kwss)
+{
+    if (kws_search_reinit(ps_search_base(kwss),
+                          ps_search_dict(kwss),
+                          ps_search_dict2pid(kwss)) < 0) {
+        ps_search_free(ps_search_base(kwss));
+        return NULL;
+    }
+    
+    ptmr_init(&kwss->perf);
+
+    return ps_search_base(kwss);
+}
+
+ps_search_t *
+kws_search_init(const char *name,
+                const char *keyphrase,
+                const char *keyfile,
+                cmd_ln_t * config,
+                acmod_t * acmod, dict_t * dict, dict2pid_t * d2p)
+{
+    kws_search_t *kwss = kws_search_alloc(name, config, acmod, dict, d2p);
+
     if (keyfile) {
 	if (kws_search_read_list(kwss, keyfile) < 0) {
 	    E_ERROR("Failed to create kws search\n");
@@ -419,16 +500,38 @@ kws_search_init(const char *name,
     }
 
     /* Reinit for provided keyphrase */
-    if (kws_search_reinit(ps_search_base(kwss),
-                          ps_search_dict(kwss),
-                          ps_search_dict2pid(kwss)) < 0) {
-        ps_search_free(ps_search_base(kwss));
-        return NULL;
+    return kws_search_setup(kwss);
+}
+
+static ps_search_t *
+kws_search_clone(ps_search_t * search, acmod_t * acmod, dict_t * dict)
+{
+    kws_search_t *other = (kws_search_t *) search;
+    kws_search_t *kwss;
+    gnode_t *gn;
+
+    kwss = kws_search_alloc(ps_search_name(other), ps_search_config(other),
+                            acmod, dict, ps_search_dict2pid(other));
+    /* Keyphrases keep their thresholds, which may come from a file. */
+    for (gn = other->keyphrases; gn; gn = gnode_next(gn)) {
+        kws_keyphrase_t *ok = gnode_ptr(gn);
+        kws_keyphrase_t *k = ckd_calloc(1, sizeof(*k));
+        k->word = ckd_salloc(ok->word);
+        k->threshold = ok->threshold;
+        kwss->keyphrases = glist_add_ptr(kwss->keyphrases, k);
     }
-    
-    ptmr_init(&kwss->perf);
+    kwss->keyphrases = glist_reverse(kwss->keyphrases);
+    return kws_search_setup(kwss);
+}
 
-    return ps_search_base(kwss);
+static void
+kws_search_mem(ps_search_t * search, ps_mem_t * out_mem)
+{
+    kws_search_t *kwss = (kws_search_t *) search;
+
+    out_mem[PS_MEM_SEARCH].heap += sizeof(*kwss)
+        + kwss->n_nodes * sizeof(*kwss->nodes)
+        + kwss->n_pl * sizeof(*kwss->pl_hmms);
 }
 
 void
@@ -457,9 +560,9 @@ kws_search_free(ps_search_t * search)
     ckd_free(kwss->detections);
 
     ckd_free(kwss->pl_hmms);
+    kws_search_free_nodes(kwss);
     for (gn = kwss->keyphrases; gn; gn = gnode_next(gn)) {
 	kws_keyphrase_t *keyphrase = gnode_ptr(gn);
-        ckd_free(keyphrase->hmms);
         ckd_free(keyphrase->word);
         ckd_free(keyphrase);
     }
@@ -474,8 +577,9 @@ kws_search_reinit(ps_search_t * search, dict_t * dict, dict2pid_t * d2p)
     char *tmp_keyphrase;
     int32 wid, pronlen, in_dict;
     int32 n_hmms, n_wrds;
-    int32 ssid, tmatid;
-    int i, j, p;
+    int32 ssid, tmatid, node;
+    int i, p;
+    kws_trie_t trie;
     kws_search_t *kwss = (kws_search_t *) search;
     bin_mdef_t *mdef = search->acmod->mdef;
     int32 silcipid = bin_mdef_silphone(mdef);
@@ -510,27 +614,28 @@ kws_search_reinit(ps_search_t * search, dict_t * dict, dict2pid_t * d2p)
                  bin_mdef_pid2tmatid(search->acmod->mdef, i));
     }
 
+    /* Merge the keyphrases into a prefix trie of HMMs */
+    kws_search_free_nodes(kwss);
+    memset(&trie, 0, sizeof(trie));
+    trie.roots = -1;
+    n_hmms = 0;
     for (gn = kwss->keyphrases; gn; gn = gnode_next(gn)) {
         kws_keyphrase_t *keyphrase = gnode_ptr(gn);
 
-        /* Initialize keyphrase HMMs */
+        keyphrase->n_hmms = 0;
+        keyphrase->last_node = -1;
         tmp_keyphrase = (char *) ckd_salloc(keyphrase->word);
         n_wrds = str2words(tmp_keyphrase, NULL, 0);
         wrdptr = (char **) ckd_calloc(n_wrds, sizeof(*wrdptr));
         str2words(tmp_keyphrase, wrdptr, n_wrds);
 
-        /* count amount of hmms */
-        n_hmms = 0;
         in_dict = TRUE;
         for (i = 0; i < n_wrds; i++) {
-            wid = dict_wordid(dict, wrdptr[i]);
-            if (wid == BAD_S3WID) {
+            if (dict_wordid(dict, wrdptr[i]) == BAD_S3WID) {
         	E_ERROR("Word '%s' in phrase '%s' is missing in the dictionary\n", wrdptr[i], keyphrase->word);
         	in_dict = FALSE;
         	break;
             }
-            pronlen = dict_pronlen(dict, wid);
-            n_hmms += pronlen;
         }
         
         if (!in_dict) {
@@ -539,14 +644,8 @@ kws_search_reinit(ps_search_t * search, dict_t * dict, dict2pid_t * d2p)
     	    continue;
         }
 
-        /* allocate node array */
-        if (keyphrase->hmms)
-            ckd_free(keyphrase->hmms);
-        keyphrase->hmms = (hmm_t *) ckd_calloc(n_hmms, sizeof(hmm_t));
-        keyphrase->n_hmms = n_hmms;
-
-        /* fill node array */
-        j = 0;
+        /* follow or extend the trie */
+        node = -1;
         for (i = 0; i < n_wrds; i++) {
             wid = dict_wordid(dict, wrdptr[i]);
             pronlen = dict_pronlen(dict, wid);
@@ -570,17 +669,28 @@ kws_search_reinit(ps_search_t * search, dict_t * dict, dict2pid_t * d2p)
                     ssid = dict2pid_internal(d2p, wid, p);
                 }
                 tmatid = bin_mdef_pid2tmatid(mdef, ci);
-                hmm_init(kwss->hmmctx, &keyphrase->hmms[j], FALSE, ssid,
-                         tmatid);
-                j++;
+                node = kws_trie_child(&trie, node, ssid, tmatid);
+                ++keyphrase->n_hmms;
             }
         }
+        keyphrase->last_node = node;
+        n_hmms += keyphrase->n_hmms;
 
         ckd_free(wrdptr);
         ckd_free(tmp_keyphrase);
     }
 
-    
+    kwss->n_nodes = trie.n_tnodes;
+    kwss->nodes = ckd_calloc(kwss->n_nodes ? kwss->n_nodes : 1,
+                             sizeof(*kwss->nodes));
+    for (i = 0; i < kwss->n_nodes; i++) {
+        kwss->nodes[i].parent = trie.tnodes[i].parent;
+        hmm_init(kwss->hmmctx, kws_node_hmm(kwss, i), FALSE,
+                 trie.tnodes[i].ssid, trie.tnodes[i].tmatid);
+    }
+    ckd_free(trie.tnodes);
+    E_INFO("%d keyphrase HMMs merged into %d trie nodes\n",
+           n_hmms, kwss->n_nodes);
 
     return 0;
 }
@@ -60,10 +60,22 @@ typedef struct kws_seg_s {
 typedef struct kws_keyphrase_s {
     char* word;
     int32 threshold;
-    hmm_t* hmms;
     int32 n_hmms;
+    int32 last_node;     /**< Trie node of the last phone, or -1. */
 } kws_keyphrase_t;
 
+/**
+ * Node of the phonetic prefix trie of all keyphrases.
+ *
+ * Keyphrases whose phone sequences start with the same HMMs share
+ * the nodes for them.  A parent always comes before its children in
+ * kws_search_t.nodes.
+ */
+typedef struct kws_node_s {
+    hmm_t hmm;
+    int32 parent;        /**< Parent node, or -1 if entered from the phone loop. */
+} kws_node_t;
+
 /**
  * Implementation of KWS search structure.
  */
@@ -73,6 +85,8 @@ typedef struct kws_search_s {
     hmm_context_t *hmmctx;        /**< HMM context. */
 
     glist_t keyphrases;          /**< Keyphrases to spot */
+    kws_node_t *nodes;           /**< Prefix trie of the keyphrases */
+    int32 n_nodes;
 
     kws_detections_t *detections; /**< Keyword spotting history */
     frame_idx_t frame;            /**< Frame index */
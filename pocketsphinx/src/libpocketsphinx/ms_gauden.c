@@ -36,6 +36,7 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>
@@ -45,8 +46,10 @@
 #include <sphinxbase/ckd_alloc.h>
 
 #include "ms_gauden.h"
+#include "am_image.h"
 
 #define GAUDEN_PARAM_VERSION	"1.0"
+#define GAUDEN_Q8_VERSION	"1.0"
 
 #ifndef M_PI
 #define M_PI	3.1415926535897932385e0
@@ -54,6 +57,21 @@
 
 #define WORST_DIST	(int32)(0x80000000)
 
+#if !defined(FIXED_POINT)
+#if defined(__SSE2__) || defined(_M_X64)
+#define GAUDEN_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GAUDEN_SIMD_AVX
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define GAUDEN_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif /* !FIXED_POINT */
+
 void
 gauden_dump(const gauden_t * g)
 {
@@ -69,6 +87,10 @@ gauden_dump_ind(const gauden_t * g, int senidx)
 {
     int32 f, d, i;
 
+    if (g->mean == NULL) {
+        E_INFO("Codebook %d is quantized\n", senidx);
+        return;
+    }
     for (f = 0; f < g->n_feat; f++) {
         E_INFO("Codebook %d, Feature %d (%dx%d):\n",
                senidx, f, g->n_density, g->featlen[f]);
@@ -318,6 +340,7 @@ gauden_init(char const *meanfile, char const *varfile, float32 varfloor, logmath
     assert(varfloor > 0.0);
 
     g = (gauden_t *) ckd_calloc(1, sizeof(gauden_t));
+    g->refcount = 1;
     g->lmath = lmath;
 
     g->mean = (mfcc_t ****)gauden_param_read(meanfile, &g->n_mgau, &g->n_feat, &g->n_density,
@@ -354,22 +377,142 @@ gauden_init(char const *meanfile, char const *varfile, float32 varfloor, logmath
     return g;
 }
 
+/*
+ * Allocate a [codebook][feature] array of vectors of len[feature]
+ * elements each, in one block.
+ */
+static void ***
+gauden_q8_param_alloc(gauden_t *g, int32 const *len, size_t elem_size)
+{
+    void ***out;
+    char *buf;
+    size_t blk;
+    int32 m, f;
+
+    for (f = 0, blk = 0; f < g->n_feat; ++f)
+        blk += len[f];
+    out = (void ***) ckd_calloc_2d(g->n_mgau, g->n_feat, sizeof(void *));
+    buf = ckd_calloc(g->n_mgau * blk, elem_size);
+    for (m = 0; m < g->n_mgau; ++m) {
+        for (f = 0; f < g->n_feat; ++f) {
+            out[m][f] = buf;
+            buf += len[f] * elem_size;
+        }
+    }
+    return out;
+}
+
+static void
+gauden_q8_param_free(void ***p)
+{
+    if (p == NULL)
+        return;
+    ckd_free(p[0][0]);
+    ckd_free_2d(p);
+}
+
+
+gauden_t *
+gauden_retain(gauden_t *g)
+{
+    ++g->refcount;
+    return g;
+}
+
+gauden_t *
+gauden_unshare(gauden_t *g, cmd_ln_t *config)
+{
+    gauden_t *copy;
+
+    if (g->refcount == 1 || g->qmean)
+        return g;
+    if (cmd_ln_str_r(config, "_mean") == NULL
+        || cmd_ln_str_r(config, "_var") == NULL) {
+        E_ERROR("Cannot copy codebooks without their means and variances\n");
+        return NULL;
+    }
+    if ((copy = gauden_init(cmd_ln_str_r(config, "_mean"),
+                            cmd_ln_str_r(config, "_var"),
+                            cmd_ln_float32_r(config, "-varfloor"),
+                            g->lmath)) == NULL)
+        return NULL;
+    gauden_free(g);
+    return copy;
+}
+
+/**
+ * Free the means, variances and determinants, which may point into
+ * an acoustic model image.
+ */
+static void
+gauden_dist_free(gauden_t *g)
+{
+    if (g->image) {
+        /* Only the pointer tables belong to us. */
+        ckd_free_3d(g->mean);
+        ckd_free_3d(g->var);
+        ckd_free_3d_ptr(g->det);
+        am_image_free(g->image);
+        g->image = NULL;
+    }
+    else {
+        if (g->mean)
+            gauden_param_free(g->mean);
+        if (g->var)
+            gauden_param_free(g->var);
+        if (g->det)
+            ckd_free_3d(g->det);
+    }
+    g->mean = g->var = NULL;
+    g->det = NULL;
+}
+
 void
 gauden_free(gauden_t * g)
 {
     if (g == NULL)
         return;
-    if (g->mean)
-        gauden_param_free(g->mean);
-    if (g->var)
-        gauden_param_free(g->var);
-    if (g->det)
-        ckd_free_3d(g->det);
+    if (--g->refcount > 0)
+        return;
+    gauden_dist_free(g);
+    gauden_q8_param_free((void ***)g->qmean);
+    gauden_q8_param_free((void ***)g->qsdev);
+    gauden_q8_param_free((void ***)g->qmbase);
+    gauden_q8_param_free((void ***)g->qminv);
+    gauden_q8_param_free((void ***)g->qweight);
+    gauden_q8_param_free((void ***)g->qdet);
     if (g->featlen)
         ckd_free(g->featlen);
     ckd_free(g);
 }
 
+size_t
+gauden_mem_size(gauden_t *g)
+{
+    size_t size, veclen, n_pad;
+    int32 f;
+
+    size = sizeof(*g) + g->n_feat * sizeof(*g->featlen);
+    for (f = 0, veclen = 0; f < g->n_feat; ++f)
+        veclen += g->featlen[f];
+    if (g->qmean) {
+        n_pad = (g->n_density + GAUDEN_Q8_BLOCK - 1)
+            / GAUDEN_Q8_BLOCK * GAUDEN_Q8_BLOCK;
+        size += g->n_mgau * (2 * n_pad * veclen
+                             + 3 * veclen * sizeof(float32)
+                             + g->n_feat * n_pad * sizeof(float32));
+    }
+    if (g->mean) {
+        /* Pointer tables, which are all that is ours in an image. */
+        size += 2 * g->n_mgau * g->n_feat * g->n_density * sizeof(mfcc_t *)
+            + g->n_mgau * g->n_feat * sizeof(mfcc_t *);
+        if (g->image == NULL)
+            size += g->n_mgau * g->n_density
+                * (2 * veclen + g->n_feat) * sizeof(mfcc_t);
+    }
+    return size;
+}
+
 /* See compute_dist below */
 static int32
 compute_dist_all(gauden_dist_t * out_dist, mfcc_t* obs, int32 featlen,
@@ -480,6 +623,268 @@ compute_dist(gauden_dist_t * out_dist, int32 n_top,
 }
 
 
+/*
+ * Decode a quantized inverse standard deviation.
+ */
+static float32
+gauden_q8_sdev(int32 q)
+{
+    union {
+        int32 i;
+        float32 f;
+    } v;
+
+    v.i = GAUDEN_Q8_SDEV_BITS(q);
+    return v.f;
+}
+
+/*
+ * Compute distances for a block of GAUDEN_Q8_BLOCK quantized
+ * codewords.  Like compute_dist(), a codeword is abandoned as soon as
+ * its distance falls below thresh.
+ */
+static int
+gauden_q8_block(int8 const *qmean, uint8 const *qsdev, mfcc_t const *obs,
+                float32 const *mbase, float32 const *minv,
+                float32 const *weight, float32 const *det, int32 featlen,
+                float32 thresh, float32 *out)
+{
+    int32 i, j;
+    int mask = 0;
+
+    for (j = 0; j < GAUDEN_Q8_BLOCK; ++j) {
+        float32 dval = det[j];
+
+        for (i = 0; i < featlen && dval >= thresh; ++i) {
+            float32 u = (MFCC2FLOAT(obs[i]) - mbase[i]) * minv[i];
+            float32 e = (u - qmean[i * GAUDEN_Q8_BLOCK + j])
+                * gauden_q8_sdev(qsdev[i * GAUDEN_Q8_BLOCK + j]);
+            dval -= e * e * weight[i];
+        }
+        out[j] = dval;
+        if (dval >= thresh)
+            mask |= 1 << j;
+    }
+
+    return mask;
+}
+
+/*
+ * Vector versions of gauden_q8_block().  These work on all codewords
+ * of a block at once, one per lane, with the same operations in the
+ * same order, so they give the same distances.  Instead of abandoning
+ * codewords one at a time, they abandon the block when none of its
+ * codewords is left above thresh.
+ */
+#ifdef GAUDEN_SIMD_SSE2
+static int
+gauden_q8_block_sse2(int8 const *qmean, uint8 const *qsdev, mfcc_t const *obs,
+                     float32 const *mbase, float32 const *minv,
+                     float32 const *weight, float32 const *det, int32 featlen,
+                     float32 thresh, float32 *out)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i one = _mm_set1_epi32(GAUDEN_Q8_SDEV_BITS(0));
+    __m128 d0, d1, th;
+    int32 i;
+
+    d0 = _mm_loadu_ps(det);
+    d1 = _mm_loadu_ps(det + 4);
+    th = _mm_set1_ps(thresh);
+    for (i = 0; i < featlen; ++i) {
+        __m128i qm, qs;
+        __m128 u, w, e0, e1;
+
+        /* Widen the codewords to 32 bits (sign-extending the means),
+         * and decode the inverse standard deviations. */
+        qm = _mm_loadl_epi64((__m128i const *)(qmean + i * GAUDEN_Q8_BLOCK));
+        qm = _mm_srai_epi16(_mm_unpacklo_epi8(qm, qm), 8);
+        qs = _mm_loadl_epi64((__m128i const *)(qsdev + i * GAUDEN_Q8_BLOCK));
+        qs = _mm_unpacklo_epi8(qs, zero);
+
+        u = _mm_set1_ps((obs[i] - mbase[i]) * minv[i]);
+        w = _mm_set1_ps(weight[i]);
+        e0 = _mm_mul_ps(_mm_sub_ps(u, _mm_cvtepi32_ps
+                                   (_mm_srai_epi32(_mm_unpacklo_epi16(qm, qm), 16))),
+                        _mm_castsi128_ps(_mm_add_epi32
+                                         (_mm_slli_epi32(_mm_unpacklo_epi16(qs, zero), 18),
+                                          one)));
+        e1 = _mm_mul_ps(_mm_sub_ps(u, _mm_cvtepi32_ps
+                                   (_mm_srai_epi32(_mm_unpackhi_epi16(qm, qm), 16))),
+                        _mm_castsi128_ps(_mm_add_epi32
+                                         (_mm_slli_epi32(_mm_unpackhi_epi16(qs, zero), 18),
+                                          one)));
+        d0 = _mm_sub_ps(d0, _mm_mul_ps(_mm_mul_ps(e0, e0), w));
+        d1 = _mm_sub_ps(d1, _mm_mul_ps(_mm_mul_ps(e1, e1), w));
+        if ((i & 7) == 7
+            && !_mm_movemask_ps(_mm_or_ps(_mm_cmpge_ps(d0, th),
+                                          _mm_cmpge_ps(d1, th))))
+            return 0;
+    }
+    _mm_storeu_ps(out, d0);
+    _mm_storeu_ps(out + 4, d1);
+    return _mm_movemask_ps(_mm_cmpge_ps(d0, th))
+        | (_mm_movemask_ps(_mm_cmpge_ps(d1, th)) << 4);
+}
+#endif /* GAUDEN_SIMD_SSE2 */
+
+#ifdef GAUDEN_SIMD_AVX
+__attribute__((target("avx")))
+static int
+gauden_q8_block_avx(int8 const *qmean, uint8 const *qsdev, mfcc_t const *obs,
+                    float32 const *mbase, float32 const *minv,
+                    float32 const *weight, float32 const *det, int32 featlen,
+                    float32 thresh, float32 *out)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i one = _mm_set1_epi32(GAUDEN_Q8_SDEV_BITS(0));
+    __m256 d, th;
+    int32 i;
+
+    d = _mm256_loadu_ps(det);
+    th = _mm256_set1_ps(thresh);
+    for (i = 0; i < featlen; ++i) {
+        __m128i qm, qs;
+        __m256 u, e;
+
+        qm = _mm_loadl_epi64((__m128i const *)(qmean + i * GAUDEN_Q8_BLOCK));
+        qm = _mm_srai_epi16(_mm_unpacklo_epi8(qm, qm), 8);
+        qs = _mm_loadl_epi64((__m128i const *)(qsdev + i * GAUDEN_Q8_BLOCK));
+        qs = _mm_unpacklo_epi8(qs, zero);
+
+        u = _mm256_set1_ps((obs[i] - mbase[i]) * minv[i]);
+        e = _mm256_mul_ps
+            (_mm256_sub_ps(u, _mm256_cvtepi32_ps
+                           (_mm256_insertf128_si256
+                            (_mm256_castsi128_si256
+                             (_mm_srai_epi32(_mm_unpacklo_epi16(qm, qm), 16)),
+                             _mm_srai_epi32(_mm_unpackhi_epi16(qm, qm), 16), 1))),
+             _mm256_castsi256_ps
+             (_mm256_insertf128_si256
+              (_mm256_castsi128_si256
+               (_mm_add_epi32(_mm_slli_epi32(_mm_unpacklo_epi16(qs, zero), 18), one)),
+               _mm_add_epi32(_mm_slli_epi32(_mm_unpackhi_epi16(qs, zero), 18), one),
+               1)));
+        d = _mm256_sub_ps(d, _mm256_mul_ps(_mm256_mul_ps(e, e),
+                                           _mm256_set1_ps(weight[i])));
+        if ((i & 7) == 7
+            && !_mm256_movemask_ps(_mm256_cmp_ps(d, th, _CMP_GE_OQ)))
+            return 0;
+    }
+    _mm256_storeu_ps(out, d);
+    return _mm256_movemask_ps(_mm256_cmp_ps(d, th, _CMP_GE_OQ));
+}
+#endif /* GAUDEN_SIMD_AVX */
+
+#ifdef GAUDEN_SIMD_NEON
+static int
+gauden_q8_block_neon(int8 const *qmean, uint8 const *qsdev, mfcc_t const *obs,
+                     float32 const *mbase, float32 const *minv,
+                     float32 const *weight, float32 const *det, int32 featlen,
+                     float32 thresh, float32 *out)
+{
+    static const uint32_t bits[4] = { 1, 2, 4, 8 };
+    float32x4_t d0, d1, th;
+    uint32x4_t lanes, one;
+    int32 i;
+
+    one = vdupq_n_u32(GAUDEN_Q8_SDEV_BITS(0));
+    d0 = vld1q_f32(det);
+    d1 = vld1q_f32(det + 4);
+    th = vdupq_n_f32(thresh);
+    for (i = 0; i < featlen; ++i) {
+        int16x8_t qm = vmovl_s8(vld1_s8(qmean + i * GAUDEN_Q8_BLOCK));
+        uint16x8_t qs = vmovl_u8(vld1_u8(qsdev + i * GAUDEN_Q8_BLOCK));
+        float32x4_t u = vdupq_n_f32((obs[i] - mbase[i]) * minv[i]);
+        float32x4_t w = vdupq_n_f32(weight[i]);
+        float32x4_t e0, e1;
+
+        e0 = vmulq_f32(vsubq_f32(u, vcvtq_f32_s32(vmovl_s16(vget_low_s16(qm)))),
+                       vreinterpretq_f32_u32
+                       (vaddq_u32(vshlq_n_u32(vmovl_u16(vget_low_u16(qs)), 18), one)));
+        e1 = vmulq_f32(vsubq_f32(u, vcvtq_f32_s32(vmovl_high_s16(qm))),
+                       vreinterpretq_f32_u32
+                       (vaddq_u32(vshlq_n_u32(vmovl_high_u16(qs), 18), one)));
+        d0 = vsubq_f32(d0, vmulq_f32(vmulq_f32(e0, e0), w));
+        d1 = vsubq_f32(d1, vmulq_f32(vmulq_f32(e1, e1), w));
+        if ((i & 7) == 7
+            && !vmaxvq_u32(vorrq_u32(vcgeq_f32(d0, th), vcgeq_f32(d1, th))))
+            return 0;
+    }
+    vst1q_f32(out, d0);
+    vst1q_f32(out + 4, d1);
+    lanes = vld1q_u32(bits);
+    return vaddvq_u32(vandq_u32(vcgeq_f32(d0, th), lanes))
+        | (vaddvq_u32(vandq_u32(vcgeq_f32(d1, th), lanes)) << 4);
+}
+#endif /* GAUDEN_SIMD_NEON */
+
+/*
+ * Quantized version of compute_dist().
+ */
+static int32
+compute_dist_q8(gauden_t *g, int mgau, int32 f, gauden_dist_t *out_dist,
+                int32 n_top, mfcc_t *obs)
+{
+    gauden_q8_block_t block;
+    int8 const *qmean;
+    uint8 const *qsdev;
+    float32 const *det;
+    float32 dval[GAUDEN_Q8_BLOCK];
+    int32 featlen, i, j, d;
+    gauden_dist_t *worst;
+
+    block = g->q8_block ? g->q8_block : gauden_q8_block;
+    featlen = g->featlen[f];
+    qmean = g->qmean[mgau][f];
+    qsdev = g->qsdev[mgau][f];
+    det = g->qdet[mgau][f];
+
+    /* As in compute_dist_all(), no sorting when n_density <= n_top */
+    if (n_top >= g->n_density) {
+        for (d = 0; d < g->n_density; d += GAUDEN_Q8_BLOCK) {
+            (*block)(qmean, qsdev, obs, g->qmbase[mgau][f],
+                     g->qminv[mgau][f], g->qweight[mgau][f],
+                     det + d, featlen, -FLT_MAX, dval);
+            for (j = 0; j < GAUDEN_Q8_BLOCK && d + j < g->n_density; ++j) {
+                out_dist[d + j].dist = (mfcc_t)dval[j];
+                out_dist[d + j].id = d + j;
+            }
+            qmean += featlen * GAUDEN_Q8_BLOCK;
+            qsdev += featlen * GAUDEN_Q8_BLOCK;
+        }
+        return 0;
+    }
+
+    for (i = 0; i < n_top; i++)
+        out_dist[i].dist = WORST_DIST;
+    worst = &(out_dist[n_top - 1]);
+
+    for (d = 0; d < g->n_density; d += GAUDEN_Q8_BLOCK) {
+        int mask = (*block)(qmean, qsdev, obs, g->qmbase[mgau][f],
+                            g->qminv[mgau][f], g->qweight[mgau][f],
+                            det + d, featlen, (float32)worst->dist, dval);
+
+        qmean += featlen * GAUDEN_Q8_BLOCK;
+        qsdev += featlen * GAUDEN_Q8_BLOCK;
+        for (j = 0; mask && j < GAUDEN_Q8_BLOCK && d + j < g->n_density; ++j) {
+            mfcc_t dv = (mfcc_t)dval[j];
+            int32 k;
+
+            if (!(mask & (1 << j)) || dv < worst->dist)
+                continue;
+            for (i = 0; (i < n_top) && (dv < out_dist[i].dist); i++);
+            assert(i < n_top);
+            for (k = n_top - 1; k > i; --k)
+                out_dist[k] = out_dist[k - 1];
+            out_dist[i].dist = dv;
+            out_dist[i].id = d + j;
+        }
+    }
+
+    return 0;
+}
+
 /*
  * Compute distances of the input observation from the top N codewords in the given
  * codebook (g->{mean,var}[mgau]).  The input observation, obs, includes vectors for
@@ -494,10 +899,13 @@ gauden_dist(gauden_t * g,
     assert((n_top > 0) && (n_top <= g->n_density));
 
     for (f = 0; f < g->n_feat; f++) {
-        compute_dist(out_dist[f], n_top,
-                     obs[f], g->featlen[f],
-                     g->mean[mgau][f], g->var[mgau][f], g->det[mgau][f],
-                     g->n_density);
+        if (g->qmean)
+            compute_dist_q8(g, mgau, f, out_dist[f], n_top, obs[f]);
+        else
+            compute_dist(out_dist[f], n_top,
+                         obs[f], g->featlen[f],
+                         g->mean[mgau][f], g->var[mgau][f], g->det[mgau][f],
+                         g->n_density);
         E_DEBUG("Top CW(%d,%d) = %d %d\n", mgau, f, out_dist[f][0].id,
                 (int)out_dist[f][0].dist >> SENSCR_SHIFT);
     }
@@ -505,18 +913,368 @@ gauden_dist(gauden_t * g,
     return 0;
 }
 
+static void
+gauden_q8_select_backend(gauden_t *g)
+{
+    char const *backend = "reference";
+
+    g->q8_block = NULL;
+#ifdef GAUDEN_SIMD_NEON
+    g->q8_block = gauden_q8_block_neon;
+    backend = "neon";
+#endif
+#ifdef GAUDEN_SIMD_SSE2
+    g->q8_block = gauden_q8_block_sse2;
+    backend = "sse2";
+#endif
+#ifdef GAUDEN_SIMD_AVX
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx")) {
+        g->q8_block = gauden_q8_block_avx;
+        backend = "avx";
+    }
+#endif
+    E_INFO("Quantized codebook evaluation: %s\n", backend);
+}
+
+/*
+ * The file contains, after the usual header and the dimensions, for
+ * each codebook and feature: the mean offsets, mean steps and inverse
+ * standard deviation scales for each dimension (float32), then the
+ * quantized means (int8) and inverse standard deviations (uint8) for
+ * each codeword.  Inverse standard deviations are 1/sqrt(2 * var), so
+ * that they do not depend on the log base.
+ */
+gauden_t *
+gauden_init_q8(char const *file, logmath_t *lmath)
+{
+    FILE *fp;
+    char tmp;
+    char **argname, **argval;
+    int32 byteswap, chksum_present;
+    uint32 chksum;
+    gauden_t *g;
+    int32 *len, maxlen, n_pad, m, f, d, i;
+    float32 *fbuf;
+    int8 *qm;
+    uint8 *qs;
+    float64 ln_base;
+
+    E_INFO("Reading quantized mixture gaussian parameters: %s\n", file);
+
+    if ((fp = fopen(file, "rb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open file '%s' for reading", file);
+        return NULL;
+    }
+    if (bio_readhdr(fp, &argname, &argval, &byteswap) < 0) {
+        E_ERROR("Failed to read header from file '%s'\n", file);
+        fclose(fp);
+        return NULL;
+    }
+    chksum_present = 0;
+    for (i = 0; argname[i]; i++) {
+        if (strcmp(argname[i], "version") == 0) {
+            if (strcmp(argval[i], GAUDEN_Q8_VERSION) != 0)
+                E_WARN("Version mismatch(%s): %s, expecting %s\n",
+                       file, argval[i], GAUDEN_Q8_VERSION);
+        }
+        else if (strcmp(argname[i], "chksum0") == 0) {
+            chksum_present = 1;
+        }
+    }
+    bio_hdrarg_free(argname, argval);
+    chksum = 0;
+
+    g = (gauden_t *) ckd_calloc(1, sizeof(gauden_t));
+    g->refcount = 1;
+    g->lmath = lmath;
+    fbuf = NULL;
+    qm = NULL;
+    qs = NULL;
+    len = NULL;
+    if (bio_fread(&g->n_mgau, sizeof(int32), 1, fp, byteswap, &chksum) != 1
+        || bio_fread(&g->n_feat, sizeof(int32), 1, fp, byteswap, &chksum) != 1
+        || bio_fread(&g->n_density, sizeof(int32), 1, fp, byteswap, &chksum) != 1
+        || g->n_mgau <= 0 || g->n_feat <= 0 || g->n_density <= 0) {
+        E_ERROR("Failed to read dimensions from %s\n", file);
+        goto error_out;
+    }
+    g->featlen = ckd_calloc(g->n_feat, sizeof(int32));
+    if (bio_fread(g->featlen, sizeof(int32), g->n_feat, fp, byteswap, &chksum)
+        != g->n_feat) {
+        E_ERROR("fread(%s) (feature-lengths) failed\n", file);
+        goto error_out;
+    }
+
+    /* Codewords are stored in whole blocks, padded with ones that
+     * are never chosen. */
+    n_pad = (g->n_density + GAUDEN_Q8_BLOCK - 1)
+        / GAUDEN_Q8_BLOCK * GAUDEN_Q8_BLOCK;
+    len = ckd_calloc(g->n_feat, sizeof(int32));
+    for (f = 0, maxlen = 0; f < g->n_feat; ++f) {
+        if (g->featlen[f] <= 0) {
+            E_ERROR("Bad feature length %d in %s\n", g->featlen[f], file);
+            goto error_out;
+        }
+        if (g->featlen[f] > maxlen)
+            maxlen = g->featlen[f];
+        len[f] = n_pad * g->featlen[f];
+    }
+    g->qmean = (int8 ***) gauden_q8_param_alloc(g, len, sizeof(int8));
+    g->qsdev = (uint8 ***) gauden_q8_param_alloc(g, len, sizeof(uint8));
+    g->qmbase = (float32 ***)
+        gauden_q8_param_alloc(g, g->featlen, sizeof(float32));
+    g->qminv = (float32 ***)
+        gauden_q8_param_alloc(g, g->featlen, sizeof(float32));
+    g->qweight = (float32 ***)
+        gauden_q8_param_alloc(g, g->featlen, sizeof(float32));
+    for (f = 0; f < g->n_feat; ++f)
+        len[f] = n_pad;
+    g->qdet = (float32 ***) gauden_q8_param_alloc(g, len, sizeof(float32));
+
+    fbuf = ckd_calloc(3 * maxlen, sizeof(*fbuf));
+    qm = ckd_calloc(g->n_density * maxlen, sizeof(*qm));
+    qs = ckd_calloc(g->n_density * maxlen, sizeof(*qs));
+    ln_base = log(logmath_get_base(lmath));
+    for (m = 0; m < g->n_mgau; ++m) {
+        for (f = 0; f < g->n_feat; ++f) {
+            int32 flen = g->featlen[f];
+            int32 n = g->n_density * flen;
+
+            if (bio_fread(fbuf, sizeof(float32), 3 * flen, fp,
+                          byteswap, &chksum) != 3 * flen
+                || bio_fread(qm, sizeof(int8), n, fp, byteswap, &chksum) != n
+                || bio_fread(qs, sizeof(uint8), n, fp, byteswap, &chksum) != n) {
+                E_ERROR("Failed to read codebook %d from %s\n", m, file);
+                goto error_out;
+            }
+            for (i = 0; i < flen; ++i) {
+                float64 mstep = fbuf[flen + i];
+                float64 sbase = fbuf[2 * flen + i];
+
+                g->qmbase[m][f][i] = fbuf[i];
+                g->qminv[m][f][i] = (float32)(1.0 / mstep);
+                /* Precompute this part of the exponential (see
+                 * gauden_dist_precompute()). */
+                g->qweight[m][f][i] =
+                    (float32)(mstep * mstep * sbase * sbase / ln_base);
+            }
+            for (d = 0; d < g->n_density; ++d) {
+                int32 blk = d / GAUDEN_Q8_BLOCK * flen * GAUDEN_Q8_BLOCK
+                    + d % GAUDEN_Q8_BLOCK;
+                float32 det = 0;
+
+                for (i = 0; i < flen; ++i) {
+                    int32 q = qs[d * flen + i];
+
+                    g->qmean[m][f][blk + i * GAUDEN_Q8_BLOCK] = qm[d * flen + i];
+                    g->qsdev[m][f][blk + i * GAUDEN_Q8_BLOCK] = q;
+                    /* 1/sqrt(2 * pi * var) = sdev / sqrt(pi) */
+                    det += logmath_log(lmath, fbuf[2 * flen + i]
+                                       * gauden_q8_sdev(q) / sqrt(M_PI));
+                }
+                g->qdet[m][f][d] = det;
+            }
+            for (; d < n_pad; ++d)
+                g->qdet[m][f][d] = WORST_DIST;
+        }
+    }
+    ckd_free(fbuf);
+    ckd_free(qm);
+    ckd_free(qs);
+    ckd_free(len);
+    fbuf = NULL;
+    qm = NULL;
+    qs = NULL;
+    len = NULL;
+
+    if (chksum_present)
+        bio_verify_chksum(fp, byteswap, chksum);
+    if (fread(&tmp, 1, 1, fp) == 1) {
+        E_ERROR("More data than expected in %s\n", file);
+        goto error_out;
+    }
+    fclose(fp);
+
+    E_INFO("%d codebook, %d feature, size: \n", g->n_mgau, g->n_feat);
+    for (i = 0; i < g->n_feat; i++)
+        E_INFO(" %dx%d\n", g->n_density, g->featlen[i]);
+    gauden_q8_select_backend(g);
+
+    return g;
+
+error_out:
+    fclose(fp);
+    ckd_free(fbuf);
+    ckd_free(qm);
+    ckd_free(qs);
+    ckd_free(len);
+    gauden_free(g);
+    return NULL;
+}
+
+static int
+gauden_q8_cmp(const void *a, const void *b)
+{
+    float64 x = *(float64 const *)a, y = *(float64 const *)b;
+    return (x < y) ? -1 : (x > y);
+}
+
+/*
+ * Find the code for an inverse standard deviation, relative to the
+ * scale for its dimension (see GAUDEN_Q8_SDEV_BITS).
+ */
+static uint8
+gauden_q8_sdev_code(float64 sdev)
+{
+    int32 k, r;
+    float64 mant;
+
+    if (sdev <= 1.0)
+        return 0;
+    mant = frexp(sdev, &k) * 2;
+    --k;
+    r = (int32)floor((mant - 1) * 32 + 0.5);
+    if (r == 32) {
+        ++k;
+        r = 0;
+    }
+    if (k > 7)
+        return 255;
+    return (uint8)(k * 32 + r);
+}
+
+int32
+gauden_write_q8(gauden_t *g, char const *file)
+{
+    FILE *fp;
+    uint32 chksum;
+    float32 *fbuf;
+    float64 *sdev;
+    int8 *qm;
+    uint8 *qs;
+    int32 maxlen, m, f, d, i;
+    float64 ln_base;
+
+    if (g->mean == NULL) {
+        E_ERROR("Codebooks are already quantized\n");
+        return -1;
+    }
+    if ((fp = fopen(file, "wb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open file '%s' for writing", file);
+        return -1;
+    }
+    E_INFO("Writing quantized mixture gaussian parameters: %s\n", file);
+    if (bio_writehdr(fp, "version", GAUDEN_Q8_VERSION,
+                     "chksum0", "yes", NULL) < 0)
+        goto error_out;
+
+    chksum = 0;
+    if (bio_fwrite(&g->n_mgau, sizeof(int32), 1, fp, 0, &chksum) != 1
+        || bio_fwrite(&g->n_feat, sizeof(int32), 1, fp, 0, &chksum) != 1
+        || bio_fwrite(&g->n_density, sizeof(int32), 1, fp, 0, &chksum) != 1
+        || bio_fwrite(g->featlen, sizeof(int32), g->n_feat, fp, 0, &chksum)
+        != g->n_feat)
+        goto error_out;
+
+    for (f = 0, maxlen = 0; f < g->n_feat; ++f)
+        if (g->featlen[f] > maxlen)
+            maxlen = g->featlen[f];
+    fbuf = ckd_calloc(3 * maxlen, sizeof(*fbuf));
+    qm = ckd_calloc(g->n_density * maxlen, sizeof(*qm));
+    qs = ckd_calloc(g->n_density * maxlen, sizeof(*qs));
+    sdev = ckd_calloc(g->n_density, sizeof(*sdev));
+    /* Undo the precomputation of 1/(2*var) in the log domain. */
+    ln_base = log(logmath_get_base(g->lmath));
+    for (m = 0; m < g->n_mgau; ++m) {
+        for (f = 0; f < g->n_feat; ++f) {
+            int32 flen = g->featlen[f];
+            int32 n = g->n_density * flen;
+
+            for (i = 0; i < flen; ++i) {
+                float64 mmin, mmax, mstep, mbase, sbase;
+
+                mmin = mmax = MFCC2FLOAT(g->mean[m][f][0][i]);
+                for (d = 0; d < g->n_density; ++d) {
+                    float64 mean = MFCC2FLOAT(g->mean[m][f][d][i]);
+                    if (mean < mmin)
+                        mmin = mean;
+                    if (mean > mmax)
+                        mmax = mean;
+                    sdev[d] = sqrt((float64)g->var[m][f][d][i] * ln_base);
+                }
+                mstep = (float32)((mmax - mmin) / 255);
+                if (mstep <= 0)
+                    mstep = 1.0;
+                mbase = (float32)(mmin + 128 * mstep);
+                /* Center the range of inverse standard deviations
+                 * (16 times either way) on their median, so that
+                 * floored variances do not stretch it. */
+                qsort(sdev, g->n_density, sizeof(*sdev), gauden_q8_cmp);
+                sbase = (float32)(sdev[g->n_density / 2] / 16);
+                if (sbase <= 0)
+                    sbase = 1.0;
+                fbuf[i] = (float32)mbase;
+                fbuf[flen + i] = (float32)mstep;
+                fbuf[2 * flen + i] = (float32)sbase;
+
+                for (d = 0; d < g->n_density; ++d) {
+                    float64 mean = MFCC2FLOAT(g->mean[m][f][d][i]);
+                    float64 q = floor((mean - mbase) / mstep + 0.5);
+
+                    qm[d * flen + i] = (int8)(q < -128 ? -128 : q > 127 ? 127 : q);
+                    qs[d * flen + i] = gauden_q8_sdev_code
+                        (sqrt((float64)g->var[m][f][d][i] * ln_base) / sbase);
+                }
+            }
+            if (bio_fwrite(fbuf, sizeof(float32), 3 * flen, fp, 0, &chksum)
+                != 3 * flen
+                || bio_fwrite(qm, sizeof(int8), n, fp, 0, &chksum) != n
+                || bio_fwrite(qs, sizeof(uint8), n, fp, 0, &chksum) != n) {
+                ckd_free(fbuf);
+                ckd_free(sdev);
+                ckd_free(qm);
+                ckd_free(qs);
+                goto error_out;
+            }
+        }
+    }
+    ckd_free(fbuf);
+    ckd_free(sdev);
+    ckd_free(qm);
+    ckd_free(qs);
+
+    if (bio_fwrite(&chksum, sizeof(uint32), 1, fp, 0, NULL) != 1)
+        goto error_out;
+    if (fclose(fp) != 0) {
+        E_ERROR_SYSTEM("Failed to write '%s'", file);
+        return -1;
+    }
+    return 0;
+
+error_out:
+    E_ERROR_SYSTEM("Failed to write '%s'", file);
+    fclose(fp);
+    return -1;
+}
+
 int32
 gauden_mllr_transform(gauden_t *g, ps_mllr_t *mllr, cmd_ln_t *config)
 {
     int32 i, m, f, d, *flen;
 
+    if (g->qmean) {
+        E_ERROR("MLLR is not supported with quantized codebooks\n");
+        return -1;
+    }
+    if (cmd_ln_str_r(config, "_mean") == NULL
+        || cmd_ln_str_r(config, "_var") == NULL) {
+        E_ERROR("MLLR needs the means and variances of the model\n");
+        return -1;
+    }
+
     /* Free data if already here */
-    if (g->mean)
-        gauden_param_free(g->mean);
-    if (g->var)
-        gauden_param_free(g->var);
-    if (g->det)
-        ckd_free_3d(g->det);
+    gauden_dist_free(g);
     if (g->featlen)
         ckd_free(g->featlen);
     g->det = NULL;
@@ -567,3 +1325,39 @@ gauden_mllr_transform(gauden_t *g, ps_mllr_t *mllr, cmd_ln_t *config)
     gauden_dist_precompute(g, g->lmath, cmd_ln_float32_r(config, "-varfloor"));
     return 0;
 }
+
+int32
+gauden_nearest(gauden_t *g, int32 mgau, int32 feat, mfcc_t const *obs,
+               float32 *out_mean, float32 *out_ivar)
+{
+    int32 d, i, best, flen;
+    float64 bestscr, ln_base;
+
+    if (g->mean == NULL)
+        return -1;
+    flen = g->featlen[feat];
+    best = 0;
+    bestscr = -DBL_MAX;
+    for (d = 0; d < g->n_density; ++d) {
+        mfcc_t const *m = g->mean[mgau][feat][d];
+        mfcc_t const *v = g->var[mgau][feat][d];
+        float64 scr = g->det[mgau][feat][d];
+
+        for (i = 0; i < flen; ++i) {
+            float64 diff = MFCC2FLOAT(obs[i]) - MFCC2FLOAT(m[i]);
+            scr -= diff * diff * v[i];
+        }
+        if (scr > bestscr) {
+            bestscr = scr;
+            best = d;
+        }
+    }
+
+    /* The variances were turned into 1/(2*var) in the log base. */
+    ln_base = log(logmath_get_base(g->lmath));
+    for (i = 0; i < flen; ++i) {
+        out_mean[i] = MFCC2FLOAT(g->mean[mgau][feat][best][i]);
+        out_ivar[i] = (float32)(2.0 * g->var[mgau][feat][best][i] * ln_base);
+    }
+    return best;
+}
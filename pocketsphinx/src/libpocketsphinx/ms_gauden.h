@@ -75,6 +75,30 @@ typedef struct {
 
 } gauden_dist_t;
 
+/**
+ * Number of codewords interleaved together in 8-bit quantized codebooks.
+ */
+#define GAUDEN_Q8_BLOCK 8
+
+/**
+ * Scale of quantized inverse standard deviations.  These are coded
+ * logarithmically, with 32 steps per octave: code 32k + r stands for
+ * 2^k * (1 + r/32), which is just the IEEE single-precision number
+ * with exponent k and the top 5 bits of mantissa r.
+ */
+#define GAUDEN_Q8_SDEV_BITS(q) ((127 << 23) + ((int32)(q) << 18))
+
+/**
+ * Compute unnormalized densities for one block of quantized codewords.
+ * @return Bitmask of the codewords whose density is at least thresh
+ * (0 if none are, in which case out may not be written).
+ */
+typedef int (*gauden_q8_block_t)(int8 const *qmean, uint8 const *qsdev,
+                                 mfcc_t const *obs, float32 const *mbase,
+                                 float32 const *minv, float32 const *weight,
+                                 float32 const *det, int32 featlen,
+                                 float32 thresh, float32 *out);
+
 /**
  * \struct gauden_t
  * \brief Multivariate gaussian mixture density parameters
@@ -89,6 +113,24 @@ typedef struct {
     int32 n_feat;	/**< Number feature streams in each codebook */
     int32 n_density;	/**< Number gaussian densities in each codebook-feature stream */
     int32 *featlen;	/**< feature length for each feature */
+
+    /* 8-bit quantized codebooks (see gauden_init_q8()).  If these are
+     * present, mean and var are NULL.  A quantized mean is
+     * qmbase + q / qminv, and the corresponding term of the exponent
+     * is qweight * ((x - qmbase) * qminv - q)^2 * 2^(2k) * (1 + r/32)^2
+     * for quantized inverse standard deviation 32k + r (see
+     * GAUDEN_Q8_SDEV_BITS). */
+    int8 ***qmean;      /**< qmean[codebook][feature] = codewords interleaved
+                           in blocks of featlen x GAUDEN_Q8_BLOCK */
+    uint8 ***qsdev;     /**< Quantized inverse standard deviations, laid out
+                           as for qmean */
+    float32 ***qmbase;  /**< Means offset for each codebook, feature and dimension */
+    float32 ***qminv;   /**< Inverse of means step */
+    float32 ***qweight; /**< Weight of squared distance */
+    float32 ***qdet;    /**< Like det, padded to a whole number of blocks */
+    gauden_q8_block_t q8_block; /**< Vectorized block kernel (or NULL) */
+    int refcount;       /**< Reference count. */
+    struct am_image_s *image; /**< Image the parameters point into, or NULL. */
 } gauden_t;
 
 
@@ -98,6 +140,7 @@ typedef struct {
  * Return value: ptr to the model created; NULL if error.
  * (See Sphinx3 model file-format documentation.)
  */
+POCKETSPHINX_EXPORT
 gauden_t *
 gauden_init (char const *meanfile,/**< Input: File containing means of mixture gaussians */
 	     char const *varfile,/**< Input: File containing variances of mixture gaussians */
@@ -105,18 +148,83 @@ gauden_init (char const *meanfile,/**< Input: File containing means of mixture g
              logmath_t *lmath
     );
 
-/** Release memory allocated by gauden_init. */
+/**
+ * Read 8-bit quantized mixture gaussian codebooks, as written by
+ * gauden_write_q8().
+ * @return ptr to the model created; NULL if error.
+ */
+POCKETSPHINX_EXPORT
+gauden_t *gauden_init_q8(char const *file, /**< Input: File containing quantized codebooks */
+                         logmath_t *lmath
+    );
+
+/**
+ * Write mixture gaussian codebooks in 8-bit quantized form.
+ *
+ * Means are quantized uniformly over their range in each dimension of
+ * each codebook, and so are the inverse standard deviations from 0
+ * to their maximum.  This takes a quarter of the memory of the
+ * floating-point parameters.
+ *
+ * @return 0 if successful, -1 otherwise.
+ */
+POCKETSPHINX_EXPORT
+int32 gauden_write_q8(gauden_t *g, /**< In: Codebooks from gauden_init() */
+                      char const *file /**< In: File to write */
+    );
+
+/**
+ * Retain a pointer to a set of codebooks, so that it can be shared
+ * between acoustic models.
+ */
+gauden_t *gauden_retain(gauden_t *g);
+
+/**
+ * Get a private copy of a set of codebooks before modifying them.
+ *
+ * If nothing else holds a reference to g, it is returned as is.
+ * Otherwise the means and variances are reloaded from the files in
+ * config, and the reference to g is released.
+ *
+ * @return the codebooks to modify, or NULL on error (in which case
+ *         the reference to g is kept).
+ */
+gauden_t *gauden_unshare(gauden_t *g, cmd_ln_t *config);
+
+/**
+ * Release a reference to a set of codebooks, freeing it if this was
+ * the last one.
+ */
+POCKETSPHINX_EXPORT
 void gauden_free(gauden_t *g); /**< In: The gauden_t to free */
 
+/**
+ * Get the number of bytes of heap memory used by a set of codebooks,
+ * not counting an acoustic model image they point into.
+ */
+size_t gauden_mem_size(gauden_t *g);
+
 /** Transform Gaussians according to an MLLR matrix (or, eventually, more). */
 int32 gauden_mllr_transform(gauden_t *s, ps_mllr_t *mllr, cmd_ln_t *config);
 
+/**
+ * Find the density of one codebook and feature stream with the
+ * highest likelihood for an observation.
+ *
+ * @param out_mean Filled in with its mean.
+ * @param out_ivar Filled in with its inverse variance.
+ * @return Index of the density, or -1 if the codebooks are quantized.
+ */
+int32 gauden_nearest(gauden_t *g, int32 mgau, int32 feat, mfcc_t const *obs,
+                     float32 *out_mean, float32 *out_ivar);
+
 /**
  * Compute gaussian density values for the given input observation vector wrt the
  * specified mixture gaussian codebook (which may consist of several feature streams).
  * Density values are left UNnormalized.
  * @return 0 if successful, -1 otherwise.
  */
+POCKETSPHINX_EXPORT
 int32
 gauden_dist (gauden_t *g,	/**< In: handle to entire ensemble of codebooks */
 	     int mgau,		/**< In: codebook for which density values to be evaluated
@@ -74,10 +74,216 @@
 static ps_mgaufuncs_t ms_mgau_funcs = {
     "ms",
     ms_cont_mgau_frame_eval, /* frame_eval */
+    ms_cont_mgau_frame_eval_batch, /* frame_eval_batch */
     ms_mgau_mllr_transform,  /* transform */
-    ms_mgau_free             /* free */
+    ms_mgau_share,            /* share */
+    ms_mgau_free,            /* free */
+    PS_MGAU_NORM_BEST,       /* norm */
+    ms_mgau_nearest,         /* nearest */
+    ms_mgau_mem              /* mem */
 };
 
+/** Jobs run by the scoring threads. */
+enum {
+    MS_MGAU_JOB_DIST,    /**< Compute top-N densities for codebooks */
+    MS_MGAU_JOB_SENONE,  /**< Compute senone scores from densities */
+    MS_MGAU_JOB_EXIT     /**< Exit worker thread */
+};
+
+/**
+ * Scoring thread state.  Each thread handles a contiguous share of
+ * the codebooks or senones for a job.
+ */
+typedef struct ms_mgau_worker_s {
+    ms_mgau_model_t *msg;
+    int idx;            /**< Index of this thread's share */
+    sbthread_t *thr;    /**< Worker thread (NULL for the calling thread) */
+    sbevent_t *start;   /**< Signalled when a job is ready */
+    sbevent_t *done;    /**< Signalled when this share is finished */
+    int32 *best;        /**< Best senone score in each frame of the job */
+    int32 n_best;       /**< Allocated size of best */
+} ms_mgau_worker_t;
+
+static void
+ms_mgau_eval_share(ms_mgau_model_t *msg, ms_mgau_worker_t *w)
+{
+    gauden_t *g = ms_mgau_gauden(msg);
+    senone_t *sen = ms_mgau_senone(msg);
+    int32 topn = ms_mgau_topn(msg);
+    int32 lo, hi, i, k, n;
+
+    if (msg->job == MS_MGAU_JOB_DIST) {
+        lo = g->n_mgau * w->idx / msg->n_thread;
+        hi = g->n_mgau * (w->idx + 1) / msg->n_thread;
+        for (i = lo; i < hi; ++i) {
+            if (!msg->job_all && !msg->mgau_active[i])
+                continue;
+            for (k = 0; k < msg->job_nfr; ++k)
+                gauden_dist(g, i, topn, msg->job_feat[k], msg->job_dist[k][i]);
+        }
+        return;
+    }
+
+    n = msg->job_all ? sen->n_sen : msg->n_sen_active;
+    lo = n * w->idx / msg->n_thread;
+    hi = n * (w->idx + 1) / msg->n_thread;
+    for (k = 0; k < msg->job_nfr; ++k) {
+        int16 *senscr = msg->job_senscr[k];
+        gauden_dist_t ***dist = msg->job_dist[k];
+        int32 best = (int32) 0x7fffffff;
+
+        for (i = lo; i < hi; ++i) {
+            int32 s = msg->job_all ? i : msg->sen_active[i];
+            senscr[s] = senone_eval(sen, s, dist[sen->mgau[s]], topn);
+            if (best > senscr[s])
+                best = senscr[s];
+        }
+        w->best[k] = best;
+    }
+}
+
+static int
+ms_mgau_worker_main(sbthread_t *th)
+{
+    ms_mgau_worker_t *w = sbthread_arg(th);
+    ms_mgau_model_t *msg = w->msg;
+
+    while (sbevent_wait(w->start, -1, -1) == 0) {
+        if (msg->job == MS_MGAU_JOB_EXIT)
+            break;
+        ms_mgau_eval_share(msg, w);
+        sbevent_signal(w->done);
+    }
+    return 0;
+}
+
+/**
+ * Run a job on all scoring threads and wait for it to finish.
+ */
+static void
+ms_mgau_run(ms_mgau_model_t *msg, int job)
+{
+    int t;
+
+    msg->job = job;
+    for (t = 0; t < msg->n_thread; ++t) {
+        ms_mgau_worker_t *w = &msg->workers[t];
+        if (w->n_best < msg->job_nfr) {
+            ckd_free(w->best);
+            w->best = ckd_calloc(msg->job_nfr, sizeof(*w->best));
+            w->n_best = msg->job_nfr;
+        }
+        if (w->thr)
+            sbevent_signal(w->start);
+    }
+    ms_mgau_eval_share(msg, &msg->workers[0]);
+    for (t = 1; t < msg->n_thread; ++t)
+        sbevent_wait(msg->workers[t].done, -1, -1);
+}
+
+static int
+ms_mgau_start_workers(ms_mgau_model_t *msg, int n_thread)
+{
+    int t;
+
+    if (n_thread < 1)
+        n_thread = 1;
+    msg->workers = ckd_calloc(n_thread, sizeof(*msg->workers));
+    msg->n_thread = 1;
+    msg->workers[0].msg = msg;
+    for (t = 1; t < n_thread; ++t) {
+        ms_mgau_worker_t *w = &msg->workers[t];
+
+        w->msg = msg;
+        w->idx = t;
+        if ((w->start = sbevent_init()) == NULL
+            || (w->done = sbevent_init()) == NULL
+            || (w->thr = sbthread_start(NULL, ms_mgau_worker_main, w)) == NULL) {
+            E_ERROR("Failed to start scoring thread %d\n", t);
+            if (w->start)
+                sbevent_free(w->start);
+            if (w->done)
+                sbevent_free(w->done);
+            return -1;
+        }
+        msg->n_thread = t + 1;
+    }
+    if (msg->n_thread > 1)
+        E_INFO("Using %d threads for GMM computation\n", msg->n_thread);
+    return 0;
+}
+
+static void
+ms_mgau_stop_workers(ms_mgau_model_t *msg)
+{
+    int t;
+
+    if (msg->workers == NULL)
+        return;
+    msg->job = MS_MGAU_JOB_EXIT;
+    for (t = 1; t < msg->n_thread; ++t) {
+        ms_mgau_worker_t *w = &msg->workers[t];
+        sbevent_signal(w->start);
+        sbthread_free(w->thr);
+        sbevent_free(w->start);
+        sbevent_free(w->done);
+    }
+    for (t = 0; t < msg->n_thread; ++t)
+        ckd_free(msg->workers[t].best);
+    ckd_free(msg->workers);
+    msg->workers = NULL;
+    msg->n_thread = 0;
+}
+
+/**
+ * Verify the number of streams and their dimensions against acmod.
+ */
+static int
+ms_mgau_check_feat(gauden_t *g, acmod_t *acmod)
+{
+    int i;
+
+    if (g->n_feat != feat_dimension1(acmod->fcb)) {
+        E_ERROR("Number of streams does not match: %d != %d\n",
+                g->n_feat, feat_dimension1(acmod->fcb));
+        return -1;
+    }
+    for (i = 0; i < g->n_feat; ++i) {
+        if (g->featlen[i] != feat_dimension2(acmod->fcb, i)) {
+            E_ERROR("Dimension of stream %d does not match: %d != %d\n", i,
+                    g->featlen[i], feat_dimension2(acmod->fcb, i));
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Allocate the scoring state, which is separate for each decoder
+ * even when the parameters are shared.
+ */
+static int
+ms_mgau_init_state(ms_mgau_model_t *msg, cmd_ln_t *config)
+{
+    gauden_t *g = msg->g;
+
+    msg->topn = cmd_ln_int32_r(config, "-topn");
+    E_INFO("The value of topn: %d\n", msg->topn);
+    if (msg->topn == 0 || msg->topn > msg->g->n_density) {
+        E_WARN
+            ("-topn argument (%d) invalid or > #density codewords (%d); set to latter\n",
+             msg->topn, msg->g->n_density);
+        msg->topn = msg->g->n_density;
+    }
+
+    msg->dist = (gauden_dist_t ***)
+        ckd_calloc_3d(g->n_mgau, g->n_feat, msg->topn,
+                      sizeof(gauden_dist_t));
+    msg->mgau_active = ckd_calloc(g->n_mgau, sizeof(int8));
+    msg->sen_active = ckd_calloc(msg->s->n_sen, sizeof(*msg->sen_active));
+    return ms_mgau_start_workers(msg, cmd_ln_int32_r(config, "-nscorethreads"));
+}
+
 ps_mgau_t *
 ms_mgau_init(acmod_t *acmod, logmath_t *lmath, bin_mdef_t *mdef)
 {
@@ -87,16 +293,22 @@ ms_mgau_init(acmod_t *acmod, logmath_t *lmath, bin_mdef_t *mdef)
     gauden_t *g;
     senone_t *s;
     cmd_ln_t *config;
-    int i;
 
     config = acmod->config;
 
     msg = (ms_mgau_model_t *) ckd_calloc(1, sizeof(ms_mgau_model_t));
-    msg->config = config;
+    msg->config = cmd_ln_retain(config);
     msg->g = NULL;
     msg->s = NULL;
     
-    if ((g = msg->g = gauden_init(cmd_ln_str_r(config, "_mean"),
+    if (cmd_ln_str_r(config, "_gauq8")) {
+        if ((g = msg->g = gauden_init_q8(cmd_ln_str_r(config, "_gauq8"),
+                                         lmath)) == NULL) {
+            E_ERROR("Failed to read quantized means and variances\n");
+            goto error_out;
+        }
+    }
+    else if ((g = msg->g = gauden_init(cmd_ln_str_r(config, "_mean"),
                              cmd_ln_str_r(config, "_var"),
                              cmd_ln_float32_r(config, "-varfloor"),
                              lmath)) == NULL) {
@@ -104,19 +316,8 @@ ms_mgau_init(acmod_t *acmod, logmath_t *lmath, bin_mdef_t *mdef)
 	goto error_out;
     }
 
-    /* Verify n_feat and veclen, against acmod. */
-    if (g->n_feat != feat_dimension1(acmod->fcb)) {
-        E_ERROR("Number of streams does not match: %d != %d\n",
-                g->n_feat, feat_dimension1(acmod->fcb));
+    if (ms_mgau_check_feat(g, acmod) < 0)
         goto error_out;
-    }
-    for (i = 0; i < g->n_feat; ++i) {
-        if (g->featlen[i] != feat_dimension2(acmod->fcb, i)) {
-            E_ERROR("Dimension of stream %d does not match: %d != %d\n", i,
-                    g->featlen[i], feat_dimension2(acmod->fcb, i));
-            goto error_out;
-        }
-    }
 
     s = msg->s = senone_init(msg->g,
                              cmd_ln_str_r(config, "_mixw"),
@@ -140,19 +341,8 @@ ms_mgau_init(acmod_t *acmod, logmath_t *lmath, bin_mdef_t *mdef)
         E_ERROR("Senones use fewer codebooks (%d) than present (%d)\n",
                 s->n_gauden, g->n_mgau);
 
-    msg->topn = cmd_ln_int32_r(config, "-topn");
-    E_INFO("The value of topn: %d\n", msg->topn);
-    if (msg->topn == 0 || msg->topn > msg->g->n_density) {
-        E_WARN
-            ("-topn argument (%d) invalid or > #density codewords (%d); set to latter\n",
-             msg->topn, msg->g->n_density);
-        msg->topn = msg->g->n_density;
-    }
-
-    msg->dist = (gauden_dist_t ***)
-        ckd_calloc_3d(g->n_mgau, g->n_feat, msg->topn,
-                      sizeof(gauden_dist_t));
-    msg->mgau_active = ckd_calloc(g->n_mgau, sizeof(int8));
+    if (ms_mgau_init_state(msg, config) < 0)
+        goto error_out;
 
     mg = (ps_mgau_t *)msg;
     mg->vt = &ms_mgau_funcs;
@@ -162,6 +352,95 @@ error_out:
     return NULL;    
 }
 
+ps_mgau_t *
+ms_mgau_init_image(acmod_t *acmod, am_image_t *img)
+{
+    ms_mgau_model_t *msg;
+    ps_mgau_t *mg;
+
+    msg = (ms_mgau_model_t *) ckd_calloc(1, sizeof(ms_mgau_model_t));
+    msg->config = cmd_ln_retain(acmod->config);
+    msg->g = am_image_gauden(img, acmod->lmath);
+    msg->s = am_image_senone(img, acmod->lmath);
+    msg->s->aw = cmd_ln_int32_r(acmod->config, "-aw");
+
+    if (ms_mgau_check_feat(msg->g, acmod) < 0)
+        goto error_out;
+    if (msg->s->n_sen != bin_mdef_n_sen(acmod->mdef)) {
+        E_ERROR("Number of senones does not match: %d != %d\n",
+                msg->s->n_sen, bin_mdef_n_sen(acmod->mdef));
+        goto error_out;
+    }
+    if (ms_mgau_init_state(msg, acmod->config) < 0)
+        goto error_out;
+
+    mg = (ps_mgau_t *)msg;
+    mg->vt = &ms_mgau_funcs;
+    return mg;
+error_out:
+    ms_mgau_free(ps_mgau_base(msg));
+    return NULL;
+}
+
+ps_mgau_t *
+ms_mgau_share(ps_mgau_t *mg, acmod_t *acmod)
+{
+    ms_mgau_model_t *share = (ms_mgau_model_t *)mg;
+    ms_mgau_model_t *msg;
+
+    if (ms_mgau_check_feat(share->g, acmod) < 0)
+        return NULL;
+
+    msg = (ms_mgau_model_t *) ckd_calloc(1, sizeof(ms_mgau_model_t));
+    /* Keep the configuration of the model, which is needed to reload
+     * it for MLLR. */
+    msg->config = cmd_ln_retain(share->config);
+    msg->g = gauden_retain(share->g);
+    msg->s = senone_retain(share->s);
+    if (ms_mgau_init_state(msg, acmod->config) < 0) {
+        ms_mgau_free(ps_mgau_base(msg));
+        return NULL;
+    }
+    ps_mgau_base(msg)->vt = &ms_mgau_funcs;
+    return ps_mgau_base(msg);
+}
+
+void
+ms_mgau_mem(ps_mgau_t *mg, ps_mem_t *out_mem)
+{
+    ms_mgau_model_t *msg = (ms_mgau_model_t *)mg;
+    gauden_t *g = msg->g;
+    size_t dist;
+    am_image_t *img;
+
+    /* Scoring state, with densities for each frame of a batch. */
+    dist = g->n_mgau * g->n_feat * msg->topn * sizeof(gauden_dist_t);
+    out_mem->heap += sizeof(*msg) + (1 + msg->n_dist_batch) * dist
+        + g->n_mgau * sizeof(*msg->mgau_active)
+        + msg->s->n_sen * sizeof(*msg->sen_active);
+
+    /* Parameters, which may be shared, copied for adaptation, or in
+     * an image. */
+    ps_mem_add_heap(out_mem, gauden_mem_size(g), g->refcount > 1);
+    ps_mem_add_heap(out_mem, senone_mem_size(msg->s), msg->s->refcount > 1);
+    if ((img = g->image ? g->image : msg->s->image) != NULL) {
+        size_t heap = am_image_mem_size(img, &out_mem->mapped);
+        ps_mem_add_heap(out_mem, heap, msg->s->refcount > 1);
+    }
+}
+
+static void
+ms_mgau_free_dist_batch(ms_mgau_model_t *msg)
+{
+    int i;
+
+    for (i = 0; i < msg->n_dist_batch; ++i)
+        ckd_free_3d((void *) msg->dist_batch[i]);
+    ckd_free(msg->dist_batch);
+    msg->dist_batch = NULL;
+    msg->n_dist_batch = 0;
+}
+
 void
 ms_mgau_free(ps_mgau_t * mg)
 {
@@ -169,14 +448,18 @@ ms_mgau_free(ps_mgau_t * mg)
     if (msg == NULL)
         return;
 
+    ms_mgau_stop_workers(msg);
     if (msg->g)
 	gauden_free(msg->g);
     if (msg->s)
         senone_free(msg->s);
     if (msg->dist)
         ckd_free_3d((void *) msg->dist);
+    ms_mgau_free_dist_batch(msg);
     if (msg->mgau_active)
         ckd_free(msg->mgau_active);
+    ckd_free(msg->sen_active);
+    cmd_ln_free_r(msg->config);
     
     ckd_free(msg);
 }
@@ -186,9 +469,96 @@ ms_mgau_mllr_transform(ps_mgau_t *s,
 		       ps_mllr_t *mllr)
 {
     ms_mgau_model_t *msg = (ms_mgau_model_t *)s;
+    gauden_t *g;
+
+    /* Other decoders may be using the same codebooks. */
+    if ((g = gauden_unshare(msg->g, msg->config)) == NULL)
+        return -1;
+    msg->g = g;
     return gauden_mllr_transform(msg->g, mllr, msg->config);
 }
 
+int
+ms_mgau_nearest(ps_mgau_t *s, int32 senone, int32 feat,
+                mfcc_t const *obs, float32 *out_mean, float32 *out_ivar)
+{
+    ms_mgau_model_t *msg = (ms_mgau_model_t *)s;
+
+    if (gauden_nearest(msg->g, msg->s->mgau[senone], feat, obs,
+                       out_mean, out_ivar) < 0)
+        return -1;
+    return 0;
+}
+
+/**
+ * Compute and normalize senone scores for each frame of the current
+ * job, from the top-N densities already computed for it.
+ */
+static void
+ms_cont_mgau_senone_eval(ms_mgau_model_t *msg)
+{
+    senone_t *sen;
+    int32 i, k, t, n;
+
+    sen = ms_mgau_senone(msg);
+    ms_mgau_run(msg, MS_MGAU_JOB_SENONE);
+
+    n = msg->job_all ? sen->n_sen : msg->n_sen_active;
+    for (k = 0; k < msg->job_nfr; ++k) {
+        int16 *senscr = msg->job_senscr[k];
+        int32 best = (int32) 0x7fffffff;
+
+        for (t = 0; t < msg->n_thread; ++t)
+            if (best > msg->workers[t].best[k])
+                best = msg->workers[t].best[k];
+
+        /* Normalize senone scores */
+        for (i = 0; i < n; ++i) {
+            int32 s = msg->job_all ? i : msg->sen_active[i];
+            int32 bs = senscr[s] - best;
+            if (bs > 32767)
+                bs = 32767;
+            if (bs < -32768)
+                bs = -32768;
+            senscr[s] = bs;
+        }
+    }
+}
+
+int32
+ms_cont_mgau_frame_eval_batch(ps_mgau_t * mg,
+			      int16 **senscr,
+			      mfcc_t ***feat,
+			      int32 frame,
+			      int32 n_frame)
+{
+    ms_mgau_model_t *msg = (ms_mgau_model_t *)mg;
+    gauden_t *g;
+    int32 k;
+
+    g = ms_mgau_gauden(msg);
+    if (n_frame > msg->n_dist_batch) {
+        ms_mgau_free_dist_batch(msg);
+        msg->dist_batch = ckd_calloc(n_frame, sizeof(*msg->dist_batch));
+        for (k = 0; k < n_frame; ++k)
+            msg->dist_batch[k] = (gauden_dist_t ***)
+                ckd_calloc_3d(g->n_mgau, g->n_feat, msg->topn,
+                              sizeof(gauden_dist_t));
+        msg->n_dist_batch = n_frame;
+    }
+
+    /* Each codebook is evaluated for all frames while it is in cache. */
+    msg->job_all = TRUE;
+    msg->job_nfr = n_frame;
+    msg->job_feat = feat;
+    msg->job_dist = msg->dist_batch;
+    msg->job_senscr = senscr;
+    ms_mgau_run(msg, MS_MGAU_JOB_DIST);
+    ms_cont_mgau_senone_eval(msg);
+
+    return n_frame;
+}
+
 int32
 ms_cont_mgau_frame_eval(ps_mgau_t * mg,
 			int16 *senscr,
@@ -199,42 +569,14 @@ ms_cont_mgau_frame_eval(ps_mgau_t * mg,
 			int32 compallsen)
 {
     ms_mgau_model_t *msg = (ms_mgau_model_t *)mg;
-    int32 gid;
-    int32 topn;
-    int32 best;
     gauden_t *g;
     senone_t *sen;
 
-    topn = ms_mgau_topn(msg);
     g = ms_mgau_gauden(msg);
     sen = ms_mgau_senone(msg);
 
-    if (compallsen) {
-	int32 s;
-
-	for (gid = 0; gid < g->n_mgau; gid++)
-	    gauden_dist(g, gid, topn, feat, msg->dist[gid]);
-
-	best = (int32) 0x7fffffff;
-	for (s = 0; s < sen->n_sen; s++) {
-	    senscr[s] = senone_eval(sen, s, msg->dist[sen->mgau[s]], topn);
-	    if (best > senscr[s]) {
-		best = senscr[s];
-	    }
-	}
-
-	/* Normalize senone scores */
-	for (s = 0; s < sen->n_sen; s++) {
-	    int32 bs = senscr[s] - best;
-	    if (bs > 32767)
-		bs = 32767;
-	    if (bs < -32768)
-		bs = -32768;
-	    senscr[s] = bs;
-	}
-    }
-    else {
-	int32 i, n;
+    if (!compallsen) {
+	int32 gid, i, n;
 	/* Flag all active mixture-gaussian codebooks */
 	for (gid = 0; gid < g->n_mgau; gid++)
 	    msg->mgau_active[gid] = 0;
@@ -244,39 +586,20 @@ ms_cont_mgau_frame_eval(ps_mgau_t * mg,
 	    /* senone_active consists of deltas. */
 	    int32 s = senone_active[i] + n;
 	    msg->mgau_active[sen->mgau[s]] = 1;
+	    msg->sen_active[i] = s;
 	    n = s;
 	}
-
-	/* Compute topn gaussian density values (for active codebooks) */
-	for (gid = 0; gid < g->n_mgau; gid++) {
-	    if (msg->mgau_active[gid])
-		gauden_dist(g, gid, topn, feat, msg->dist[gid]);
-	}
-
-	best = (int32) 0x7fffffff;
-	n = 0;
-	for (i = 0; i < n_senone_active; i++) {
-	    int32 s = senone_active[i] + n;
-	    senscr[s] = senone_eval(sen, s, msg->dist[sen->mgau[s]], topn);
-	    if (best > senscr[s]) {
-		best = senscr[s];
-	    }
-	    n = s;
-	}
-
-	/* Normalize senone scores */
-	n = 0;
-	for (i = 0; i < n_senone_active; i++) {
-	    int32 s = senone_active[i] + n;
-	    int32 bs = senscr[s] - best;
-	    if (bs > 32767)
-		bs = 32767;
-	    if (bs < -32768)
-		bs = -32768;
-	    senscr[s] = bs;
-	    n = s;
-	}
+	msg->n_sen_active = n_senone_active;
     }
 
+    /* Compute topn gaussian density values (for active codebooks) */
+    msg->job_all = compallsen;
+    msg->job_nfr = 1;
+    msg->job_feat = &feat;
+    msg->job_dist = &msg->dist;
+    msg->job_senscr = &senscr;
+    ms_mgau_run(msg, MS_MGAU_JOB_DIST);
+    ms_cont_mgau_senone_eval(msg);
+
     return 0;
 }
@@ -100,12 +100,14 @@
 #include <sphinxbase/cmd_ln.h>
 #include <sphinxbase/logmath.h>
 #include <sphinxbase/feat.h>
+#include <sphinxbase/sbthread.h>
 
 /* Local headers. */
 #include "acmod.h"
 #include "bin_mdef.h"
 #include "ms_gauden.h"
 #include "ms_senone.h"
+#include "am_image.h"
 
 /** \struct ms_mgau_t
     \brief Multi-stream mixture gaussian. It is not necessary to be continr
@@ -119,8 +121,23 @@ typedef struct {
 
     /**< Intermediate used in computation */
     gauden_dist_t ***dist;  
+    gauden_dist_t ****dist_batch; /**< dist for each frame of a batch */
+    int n_dist_batch;             /**< Number of frames in dist_batch */
     uint8 *mgau_active;
+    int32 *sen_active;  /**< Active senone IDs (not deltas) */
+    int32 n_sen_active; /**< Number of entries in sen_active */
     cmd_ln_t *config;
+
+    /* Scoring is split between the calling thread and n_thread - 1
+     * persistent workers, which run one job at a time to completion. */
+    int n_thread;                       /**< Number of scoring threads */
+    struct ms_mgau_worker_s *workers;   /**< Per-thread state (0 is the caller) */
+    int job;                            /**< Current job type */
+    int job_all;                        /**< Score all codebooks and senones */
+    int32 job_nfr;                      /**< Number of frames in job */
+    mfcc_t ***job_feat;                 /**< Features for each frame */
+    gauden_dist_t ****job_dist;         /**< Densities for each frame */
+    int16 **job_senscr;                 /**< Senone scores for each frame */
 } ms_mgau_model_t;  
 
 #define ms_mgau_gauden(msg) (msg->g)
@@ -128,6 +145,8 @@ typedef struct {
 #define ms_mgau_topn(msg) (msg->topn)
 
 ps_mgau_t* ms_mgau_init(acmod_t *acmod, logmath_t *lmath, bin_mdef_t *mdef);
+ps_mgau_t *ms_mgau_init_image(acmod_t *acmod, am_image_t *img);
+ps_mgau_t *ms_mgau_share(ps_mgau_t *g, acmod_t *acmod);
 void ms_mgau_free(ps_mgau_t *g);
 int32 ms_cont_mgau_frame_eval(ps_mgau_t * msg,
                               int16 *senscr,
@@ -136,8 +155,17 @@ int32 ms_cont_mgau_frame_eval(ps_mgau_t * msg,
                               mfcc_t ** feat,
                               int32 frame,
                               int32 compallsen);
+int32 ms_cont_mgau_frame_eval_batch(ps_mgau_t * msg,
+                                    int16 **senscr,
+                                    mfcc_t ***feat,
+                                    int32 frame,
+                                    int32 n_frame);
 int32 ms_mgau_mllr_transform(ps_mgau_t *s,
                              ps_mllr_t *mllr);
+int ms_mgau_nearest(ps_mgau_t *s, int32 senone, int32 feat,
+                    mfcc_t const *obs, float32 *out_mean,
+                    float32 *out_ivar);
+void ms_mgau_mem(ps_mgau_t *s, ps_mem_t *out_mem);
 
 #endif /* _LIBFBS_MS_CONT_MGAU_H_*/
 
@@ -45,6 +45,7 @@
 
 /* Local headers. */
 #include "ms_senone.h"
+#include "am_image.h"
 
 #define MIXW_PARAM_VERSION	"1.0"
 #define SPDEF_PARAM_VERSION	"1.2"
@@ -279,6 +280,7 @@ senone_init(gauden_t *g, char const *mixwfile, char const *sen2mgau_map_file,
     int32 n = 0, i;
 
     s = (senone_t *) ckd_calloc(1, sizeof(senone_t));
+    s->refcount = 1;
     s->lmath = logmath_init(logmath_get_base(lmath), SENSCR_SHIFT, TRUE);
     s->mixwfloor = mixwfloor;
 
@@ -337,15 +339,52 @@ senone_init(gauden_t *g, char const *mixwfile, char const *sen2mgau_map_file,
     return s;
 }
 
+senone_t *
+senone_retain(senone_t *s)
+{
+    ++s->refcount;
+    return s;
+}
+
+size_t
+senone_mem_size(senone_t * s)
+{
+    size_t size;
+
+    size = sizeof(*s);
+    if (s->pdf) {
+        /* Pointer tables, which are all that is ours in an image. */
+        if (s->n_gauden > 1)
+            size += (size_t)s->n_sen * (s->n_feat + 1) * sizeof(void *);
+        else
+            size += (size_t)s->n_feat * (s->n_cw + 1) * sizeof(void *);
+        if (s->image == NULL)
+            size += (size_t)s->n_sen * s->n_feat * s->n_cw
+                * sizeof(senprob_t);
+    }
+    if (s->mgau && s->image == NULL)
+        size += s->n_sen * sizeof(*s->mgau);
+    return size;
+}
+
 void
 senone_free(senone_t * s)
 {
     if (s == NULL)
         return;
-    if (s->pdf)
-        ckd_free_3d((void *) s->pdf);
-    if (s->mgau)
-        ckd_free(s->mgau);
+    if (--s->refcount > 0)
+        return;
+    if (s->image) {
+        /* Only the pointer tables belong to us. */
+        ckd_free_3d_ptr((void *) s->pdf);
+        am_image_free(s->image);
+    }
+    else {
+        if (s->pdf)
+            ckd_free_3d((void *) s->pdf);
+        if (s->mgau)
+            ckd_free(s->mgau);
+    }
     if (s->featscr)
         ckd_free(s->featscr);
     logmath_free(s->lmath);
@@ -90,6 +90,8 @@ typedef struct {
     uint32 *mgau;		/**< senone-id -> mgau-id mapping for senones in this set */
     int32 *featscr;              /**< The feature score for every senone, will be initialized inside senone_eval_all */
     int32 aw;			/**< Inverse acoustic weight */
+    int refcount;               /**< Reference count. */
+    struct am_image_s *image;   /**< Image the parameters point into, or NULL. */
 } senone_t;
 
 
@@ -109,9 +111,18 @@ senone_t *senone_init (gauden_t *g,             /**< In: codebooks */
                        bin_mdef_t *mdef         /**< In: model definition */
     );
 
-/** Release memory allocated by senone_init. */
+/** Retain a pointer to a set of senones, to share it. */
+senone_t *senone_retain(senone_t *s);
+
+/** Release a reference to a set of senones, freeing it if it was the last one. */
 void senone_free(senone_t *s); /**< In: The senone_t to free */
 
+/**
+ * Get the number of bytes of heap memory used by a set of senones,
+ * not counting an acoustic model image they point into.
+ */
+size_t senone_mem_size(senone_t *s);
+
 /**
  * Evaluate the score for the given senone wrt to the given top N gaussian codewords.
  * @return senone score (in logs3 domain).
@@ -62,6 +62,17 @@ static int ngram_search_reinit(ps_search_t *search, dict_t *dict, dict2pid_t *d2
 static char const *ngram_search_hyp(ps_search_t *search, int32 *out_score);
 static int32 ngram_search_prob(ps_search_t *search);
 static ps_seg_t *ngram_search_seg_iter(ps_search_t *search);
+static ngram_search_t *ngram_search_alloc(const char *name, cmd_ln_t *config,
+                                          acmod_t *acmod, dict_t *dict,
+                                          dict2pid_t *d2p);
+static ngram_search_t *ngram_search_init_flat(ngram_search_t *tree);
+static int ngram_search_init_passes(ngram_search_t *ngs,
+                                    ngram_search_t *share);
+static ps_search_t *ngram_search_clone(ps_search_t *search, acmod_t *acmod,
+                                       dict_t *dict);
+static void ngram_search_mem(ps_search_t *search, ps_mem_t *out_mem);
+static int ngram_search_segs(ps_search_t *search, ps_seg_info_t *segs,
+                             int n_segs, int32 *out_score);
 
 static ps_searchfuncs_t ngram_funcs = {
     /* start: */  ngram_search_start,
@@ -73,6 +84,9 @@ static ps_searchfuncs_t ngram_funcs = {
     /* hyp: */      ngram_search_hyp,
     /* prob: */     ngram_search_prob,
     /* seg_iter: */ ngram_search_seg_iter,
+    /* clone: */    ngram_search_clone,
+    /* mem: */      ngram_search_mem,
+    /* segs: */     ngram_search_segs,
 };
 
 static ngram_model_t *default_lm;
@@ -93,6 +107,95 @@ ngram_search_update_widmap(ngram_search_t *ngs)
     ckd_free(words);
 }
 
+/**
+ * Right context scores to allocate for each backpointer when the
+ * table has a fixed size (somewhat more than the average number of
+ * right contexts of a word's last phone).
+ */
+#define NGRAM_BSS_PER_BP 24
+
+/**
+ * Make sure there is room for one more backpointer with rcsize right
+ * context scores, allocating new blocks as needed.
+ *
+ * @return 0, or -1 if the table has a fixed size and is full.
+ */
+static int
+grow_bptable(ngram_search_t *ngs, int32 rcsize)
+{
+    int32 blk;
+
+    if (ngs->max_bp > 0) {
+        int32 bss_head = ngs->bss_head;
+
+        if (ngs->bpidx >= ngs->max_bp)
+            return -1;
+        if (rcsize == 0)
+            return 0;
+        if ((bss_head & BP_BLOCK_MASK) + rcsize > BP_BLOCK_SIZE)
+            bss_head = (bss_head + BP_BLOCK_MASK) & ~BP_BLOCK_MASK;
+        if (bss_head + rcsize > ngs->max_bss)
+            return -1;
+        ngs->bss_head = bss_head;
+        return 0;
+    }
+
+    blk = ngs->bpidx >> BP_BLOCK_SHIFT;
+    if (blk >= ngs->n_bp_block_alloc) {
+        ngs->bp_table = ckd_realloc(ngs->bp_table,
+                                    ngs->n_bp_block_alloc * 2
+                                    * sizeof(*ngs->bp_table));
+        memset(ngs->bp_table + ngs->n_bp_block_alloc, 0,
+               ngs->n_bp_block_alloc * sizeof(*ngs->bp_table));
+        ngs->n_bp_block_alloc *= 2;
+    }
+    if (ngs->bp_table[blk] == NULL)
+        ngs->bp_table[blk] = ckd_calloc(BP_BLOCK_SIZE,
+                                        sizeof(**ngs->bp_table));
+
+    if (rcsize == 0)
+        return 0;
+    /* Don't let the right context scores straddle a block. */
+    if ((ngs->bss_head & BP_BLOCK_MASK) + rcsize > BP_BLOCK_SIZE)
+        ngs->bss_head = (ngs->bss_head + BP_BLOCK_MASK) & ~BP_BLOCK_MASK;
+    blk = ngs->bss_head >> BP_BLOCK_SHIFT;
+    if (blk >= ngs->n_bss_block_alloc) {
+        ngs->bscore_stack = ckd_realloc(ngs->bscore_stack,
+                                        ngs->n_bss_block_alloc * 2
+                                        * sizeof(*ngs->bscore_stack));
+        memset(ngs->bscore_stack + ngs->n_bss_block_alloc, 0,
+               ngs->n_bss_block_alloc * sizeof(*ngs->bscore_stack));
+        ngs->n_bss_block_alloc *= 2;
+    }
+    if (ngs->bscore_stack[blk] == NULL)
+        ngs->bscore_stack[blk] = ckd_calloc(BP_BLOCK_SIZE,
+                                            sizeof(**ngs->bscore_stack));
+    return 0;
+}
+
+/**
+ * Free the blocks of the backpointer table and score stack which are
+ * not needed to hold n_bp entries and n_bss scores.
+ */
+static void
+free_bp_blocks(ngram_search_t *ngs, int32 n_bp, int32 n_bss)
+{
+    int32 i;
+
+    if (ngs->bp_table)
+        for (i = (n_bp + BP_BLOCK_MASK) >> BP_BLOCK_SHIFT;
+             i < ngs->n_bp_block_alloc; ++i) {
+            ckd_free(ngs->bp_table[i]);
+            ngs->bp_table[i] = NULL;
+        }
+    if (ngs->bscore_stack)
+        for (i = (n_bss + BP_BLOCK_MASK) >> BP_BLOCK_SHIFT;
+             i < ngs->n_bss_block_alloc; ++i) {
+            ckd_free(ngs->bscore_stack[i]);
+            ngs->bscore_stack[i] = NULL;
+        }
+}
+
 static void
 ngram_search_calc_beams(ngram_search_t *ngs)
 {
@@ -113,7 +216,24 @@ ngram_search_calc_beams(ngram_search_t *ngs)
 
     /* Absolute pruning parameters. */
     ngs->maxwpf = cmd_ln_int32_r(config, "-maxwpf");
+    ngs->frate = cmd_ln_int32_r(config, "-frate");
     ngs->maxhmmpf = cmd_ln_int32_r(config, "-maxhmmpf");
+    ngs->targethmmpf = cmd_ln_int32_r(config, "-targethmmpf");
+    ngs->targetrtf = cmd_ln_float32_r(config, "-targetrtf");
+    ngs->adapt_hmmpf = ngs->targethmmpf;
+    if (ngs->adapt_hmmpf <= 0)
+        ngs->adapt_hmmpf = ngs->maxhmmpf;
+    if (ngs->adapt_hmmpf <= 0)
+        ngs->adapt_hmmpf = MAX_INT32;
+
+    /* Bins of the score histogram are a power of two wide, such that
+     * the beam covers between a quarter and half of them. */
+    ngs->hist_shift = -1;
+    if (ngs->maxhmmpf != -1 || ngs->targethmmpf > 0 || ngs->targetrtf > 0) {
+        ngs->hist_shift = 0;
+        while ((1 << ngs->hist_shift) * (SCORE_HIST_BINS / 4) < -ngs->beam)
+            ++ngs->hist_shift;
+    }
 
     /* Various penalties which may or may not be useful. */
     ngs->wip = logmath_log(acmod->lmath, cmd_ln_float32_r(config, "-wip")) >>SENSCR_SHIFT;
@@ -144,16 +264,230 @@ ngram_search_init(const char *name,
                   dict_t *dict,
                   dict2pid_t *d2p)
 {
-    ngram_search_t *ngs;
-    static char *lmname = "default";
+    ps_search_t *search;
+
+    if ((search = ngram_search_prepare(name, lm, config, acmod,
+                                       dict, d2p)) != NULL)
+        ngram_search_set_grow(search);
+    return search;
+}
+
+void
+ngram_search_set_grow(ps_search_t *search)
+{
+    cmd_ln_t *config = ps_search_config(search);
 
     /* Make the acmod's feature buffer growable if we are doing two-pass
      * search. */
-    acmod_set_grow(acmod, cmd_ln_boolean_r(config, "-fwdflat") &&
-                          cmd_ln_boolean_r(config, "-fwdtree"));
+    acmod_set_grow(ps_search_acmod(search),
+                   cmd_ln_boolean_r(config, "-fwdflat") &&
+                   cmd_ln_boolean_r(config, "-fwdtree"));
+}
+
+ps_search_t *
+ngram_search_prepare(const char *name,
+                     ngram_model_t *lm,
+                     cmd_ln_t *config,
+                     acmod_t *acmod,
+                     dict_t *dict,
+                     dict2pid_t *d2p)
+{
+    ngram_search_t *ngs;
+    static char *lmname = "default";
+
+    if ((ngs = ngram_search_alloc(name, config, acmod, dict, d2p)) == NULL)
+        return NULL;
+
+    ngs->lmset = ngram_model_set_init(config, &lm, &lmname, NULL, 1);
+    if (!ngs->lmset)
+        goto error_out;
+
+    if (ngram_wid(ngs->lmset, S3_FINISH_WORD) ==
+        ngram_unknown_wid(ngs->lmset))
+    {
+        E_ERROR("Language model/set does not contain </s>, "
+                "recognition will fail\n");
+        goto error_out;
+    }
+
+    /* Create word mappings. */
+    ngram_search_update_widmap(ngs);
+
+    if (ngram_search_init_passes(ngs, NULL) < 0)
+        goto error_out;
+    return (ps_search_t *)ngs;
+
+error_out:
+    ngram_search_free((ps_search_t *)ngs);
+    return NULL;
+}
+
+static ps_search_t *
+ngram_search_clone(ps_search_t *search, acmod_t *acmod, dict_t *dict)
+{
+    ngram_search_t *other = (ngram_search_t *)search;
+    ngram_search_t *ngs;
+
+    acmod_set_grow(acmod, other->fwdtree && other->fwdflat);
+    if ((ngs = ngram_search_alloc(ps_search_name(other),
+                                  ps_search_config(other), acmod, dict,
+                                  ps_search_dict2pid(other))) == NULL)
+        return NULL;
+    /* The word mappings come with the language model. */
+    if ((ngs->lmset = ngram_model_clone(other->lmset)) == NULL
+        || ngram_search_init_passes(ngs, other) < 0) {
+        ngram_search_free((ps_search_t *)ngs);
+        return NULL;
+    }
+    return (ps_search_t *)ngs;
+}
+
+/**
+ * Add up the memory used by the search tables of ngs, not counting
+ * its language model.
+ */
+static void
+ngram_search_mem_tables(ngram_search_t *ngs, ps_mem_t *mem)
+{
+    int32 n_words = ps_search_n_words(ngs);
+    lextree_t *lt = ngs->lextree;
+    size_t heap;
+    int i;
+
+    heap = sizeof(*ngs)
+        + listelem_mem_size(ngs->chan_alloc)
+        + listelem_mem_size(ngs->root_chan_alloc)
+        + listelem_mem_size(ngs->latnode_alloc)
+        + n_words * (sizeof(*ngs->word_chan) + sizeof(*ngs->word_lat_idx)
+                     + sizeof(*ngs->last_ltrans)
+                     + 2 * sizeof(**ngs->active_word_list))
+        + bitvec_size(n_words) * sizeof(bitvec_t)
+        + ngs->n_root_chan_alloc * sizeof(*ngs->root_chan)
+        + ngs->n_1ph_words * (sizeof(*ngs->rhmm_1ph)
+                              + sizeof(*ngs->single_phone_wid))
+        + ngs->n_bp_block_alloc * sizeof(*ngs->bp_table)
+        + ngs->n_bss_block_alloc * sizeof(*ngs->bscore_stack)
+        + (ngs->n_frame_alloc + 1) * sizeof(*ngs->bp_table_idx)
+        + ngs->n_gc_keep_alloc * sizeof(*ngs->gc_keep)
+        + ngs->n_gc_frame_alloc * sizeof(*ngs->gc_frame_ref);
+    for (i = 0; i < ngs->n_bp_block_alloc; ++i)
+        if (ngs->bp_table[i])
+            heap += BP_BLOCK_SIZE * sizeof(**ngs->bp_table);
+    for (i = 0; i < ngs->n_bss_block_alloc; ++i)
+        if (ngs->bscore_stack[i])
+            heap += BP_BLOCK_SIZE * sizeof(**ngs->bscore_stack);
+    if (ngs->tree_chan_alloc)
+        heap += listelem_mem_size(ngs->tree_chan_alloc);
+    if (ngs->lastphn_cand)
+        heap += n_words * sizeof(*ngs->lastphn_cand);
+    if (ngs->active_chan_list)
+        heap += 2 * ngs->max_nonroot_chan * sizeof(**ngs->active_chan_list);
+    if (ngs->lmla_score)
+        heap += ngs->n_lmla * (2 * sizeof(*ngs->lmla_hist)
+                               + (ngs->n_root_chan + ngs->n_nonroot_chan + 1)
+                               * sizeof(**ngs->lmla_score));
+    if (ngs->frm_wordlist)
+        heap += ngs->n_frame_alloc * sizeof(*ngs->frm_wordlist)
+            + 2 * (n_words + 1) * sizeof(*ngs->fwdflat_wordlist)
+            + bitvec_size(n_words) * sizeof(bitvec_t);
+    if (ngs->fwdflat_word_flag)
+        heap += bitvec_size(n_words) * sizeof(bitvec_t);
+    if (lt) {
+        heap += (lt->n_node + 1) * sizeof(*ngs->tree_chan);
+        ps_mem_add_heap(mem, sizeof(*lt)
+                        + (lt->n_root + 1) * sizeof(*lt->root)
+                        + (lt->n_node + 1) * sizeof(*lt->node)
+                        + lt->n_words * sizeof(*lt->homophone_set),
+                        lt->refcount > 1);
+    }
+    mem->heap += heap;
+    /* The pipelined search shares the language model. */
+    if (ngs->flat)
+        ngram_search_mem_tables(ngs->flat, mem);
+}
+
+static void
+ngram_search_mem(ps_search_t *search, ps_mem_t *out_mem)
+{
+    ngram_search_t *ngs = (ngram_search_t *)search;
+    ps_mem_t *lm = &out_mem[PS_MEM_LM];
+    size_t shared = 0, mapped = 0;
+
+    ngram_search_mem_tables(ngs, &out_mem[PS_MEM_SEARCH]);
+    if (ngs->lmset == NULL)
+        return;
+    lm->heap += ngram_model_mem_size(ngs->lmset, &shared, &mapped);
+    lm->shared += shared;
+    lm->mapped += mapped;
+}
+
+/**
+ * Initialize the fwdtree, fwdflat and bestpath passes which are
+ * enabled, using the search tree of share, if not NULL.
+ */
+static int
+ngram_search_init_passes(ngram_search_t *ngs, ngram_search_t *share)
+{
+    cmd_ln_t *config = ps_search_config(ngs);
+
+    /* Initialize fwdtree, fwdflat, bestpath modules if necessary. */
+    if (cmd_ln_boolean_r(config, "-fwdtree")) {
+        if (share)
+            ngram_fwdtree_clone(ngs, share);
+        else
+            ngram_fwdtree_init(ngs);
+        ngs->fwdtree = TRUE;
+        ngs->fwdtree_perf.name = "fwdtree";
+        ptmr_init(&ngs->fwdtree_perf);
+        ngs->adapt_perf.name = "adapt";
+        ptmr_init(&ngs->adapt_perf);
+    }
+    if (cmd_ln_boolean_r(config, "-fwdflat")) {
+        ngram_fwdflat_init(ngs);
+        ngs->fwdflat = TRUE;
+        ngs->fwdflat_perf.name = "fwdflat";
+        ptmr_init(&ngs->fwdflat_perf);
+    }
+    if (cmd_ln_boolean_r(config, "-bestpath")) {
+        ngs->bestpath = TRUE;
+        ngs->bestpath_perf.name = "bestpath";
+        ptmr_init(&ngs->bestpath_perf);
+    }
+    /* The second passes need the entire backpointer table. */
+    if (ngs->fwdflat || ngs->bestpath)
+        ngs->bp_gc_frames = 0;
+    /* Without them, a fixed size table is collected when it fills up. */
+    ngs->bp_gc_full = (ngs->max_bp > 0 && !ngs->fwdflat && !ngs->bestpath);
+
+    /* Run fwdflat alongside fwdtree if requested. */
+    ngs->fwdflat_lag = cmd_ln_int32_r(config, "-fwdflatlag");
+    if (ngs->fwdtree && ngs->fwdflat && ngs->fwdflat_lag > 0) {
+        if (ngs->fwdflat_lag < ngs->max_sf_win) {
+            E_WARN("-fwdflatlag %d is less than -fwdflatsfwin, using %d\n",
+                   ngs->fwdflat_lag, ngs->max_sf_win);
+            ngs->fwdflat_lag = ngs->max_sf_win;
+        }
+        if ((ngs->flat = ngram_search_init_flat(ngs)) == NULL)
+            return -1;
+    }
+    return 0;
+}
+
+/**
+ * Allocate an N-Gram search and the tables shared by all of its passes.
+ */
+static ngram_search_t *
+ngram_search_alloc(const char *name,
+                   cmd_ln_t *config,
+                   acmod_t *acmod,
+                   dict_t *dict,
+                   dict2pid_t *d2p)
+{
+    ngram_search_t *ngs;
 
     ngs = ckd_calloc(1, sizeof(*ngs));
     ps_search_init(&ngs->base, &ngram_funcs, PS_SEARCH_TYPE_NGRAM, name, config, acmod, dict, d2p);
+    ngs->n_seg_cache = -1;
 
     ngs->hmmctx = hmm_context_init(bin_mdef_n_emit_state(acmod->mdef),
                                    acmod->tmat->tp, NULL, acmod->mdef->sseq);
@@ -177,15 +511,44 @@ ngram_search_init(const char *name,
     ngs->last_ltrans = ckd_calloc(dict_size(dict),
                                   sizeof(*ngs->last_ltrans));
 
-    /* FIXME: All these structures need to be made dynamic with
-     * garbage collection. */
-    ngs->bp_table_size = cmd_ln_int32_r(config, "-latsize");
-    ngs->bp_table = ckd_calloc(ngs->bp_table_size,
-                               sizeof(*ngs->bp_table));
-    /* FIXME: This thing is frickin' huge. */
-    ngs->bscore_stack_size = ngs->bp_table_size * 20;
-    ngs->bscore_stack = ckd_calloc(ngs->bscore_stack_size,
-                                   sizeof(*ngs->bscore_stack));
+    /* The backpointer table and score stack are allocated a block at
+     * a time, so they never have to be copied when they grow, and
+     * can be compacted by ngram_search_compact_bptable().  With
+     * -maxbp they are instead allocated all at once, and the frame
+     * loop never allocates or frees any of them. */
+    if ((ngs->max_bp = cmd_ln_int32_r(config, "-maxbp")) > 0) {
+        int32 i;
+
+        ngs->n_bp_block_alloc = (ngs->max_bp + BP_BLOCK_MASK) >> BP_BLOCK_SHIFT;
+        ngs->n_bss_block_alloc = (ngs->max_bp * NGRAM_BSS_PER_BP
+                                  + BP_BLOCK_MASK) >> BP_BLOCK_SHIFT;
+        ngs->max_bss = ngs->n_bss_block_alloc << BP_BLOCK_SHIFT;
+        ngs->bp_table = ckd_calloc(ngs->n_bp_block_alloc,
+                                   sizeof(*ngs->bp_table));
+        for (i = 0; i < ngs->n_bp_block_alloc; ++i)
+            ngs->bp_table[i] = ckd_calloc(BP_BLOCK_SIZE,
+                                          sizeof(**ngs->bp_table));
+        ngs->bscore_stack = ckd_calloc(ngs->n_bss_block_alloc,
+                                       sizeof(*ngs->bscore_stack));
+        for (i = 0; i < ngs->n_bss_block_alloc; ++i)
+            ngs->bscore_stack[i] = ckd_calloc(BP_BLOCK_SIZE,
+                                              sizeof(**ngs->bscore_stack));
+        ngs->n_gc_keep_alloc = ngs->max_bp;
+        ngs->gc_keep = ckd_calloc(ngs->n_gc_keep_alloc,
+                                  sizeof(*ngs->gc_keep));
+    }
+    else {
+        ngs->n_bp_block_alloc = (cmd_ln_int32_r(config, "-latsize")
+                                 + BP_BLOCK_SIZE - 1) / BP_BLOCK_SIZE;
+        if (ngs->n_bp_block_alloc < 1)
+            ngs->n_bp_block_alloc = 1;
+        ngs->bp_table = ckd_calloc(ngs->n_bp_block_alloc,
+                                   sizeof(*ngs->bp_table));
+        ngs->n_bss_block_alloc = ngs->n_bp_block_alloc * 20;
+        ngs->bscore_stack = ckd_calloc(ngs->n_bss_block_alloc,
+                                       sizeof(*ngs->bscore_stack));
+    }
+    ngs->bp_gc_frames = cmd_ln_int32_r(config, "-bpgcfr");
     ngs->n_frame_alloc = 256;
     ngs->bp_table_idx = ckd_calloc(ngs->n_frame_alloc + 1,
                                    sizeof(*ngs->bp_table_idx));
@@ -195,45 +558,58 @@ ngram_search_init(const char *name,
     ngs->active_word_list = ckd_calloc_2d(2, dict_size(dict),
                                           sizeof(**ngs->active_word_list));
 
-    ngs->lmset = ngram_model_set_init(config, &lm, &lmname, NULL, 1);
-    if (!ngs->lmset)
-        goto error_out;
+    return ngs;
+}
 
-    if (ngram_wid(ngs->lmset, S3_FINISH_WORD) ==
-        ngram_unknown_wid(ngs->lmset))
-    {
-        E_ERROR("Language model/set does not contain </s>, "
-                "recognition will fail\n");
-        goto error_out;
-    }
+/**
+ * Create the fwdflat search which runs pipelined behind a fwdtree
+ * search, sharing its language model and acoustic model.
+ */
+static ngram_search_t *
+ngram_search_init_flat(ngram_search_t *tree)
+{
+    ngram_search_t *ngs;
 
-    /* Create word mappings. */
-    ngram_search_update_widmap(ngs);
+    if ((ngs = ngram_search_alloc(ps_search_name(tree),
+                                  ps_search_config(tree),
+                                  ps_search_acmod(tree),
+                                  ps_search_dict(tree),
+                                  ps_search_dict2pid(tree))) == NULL)
+        return NULL;
+    ngs->lmset = ngram_model_retain(tree->lmset);
+    ngs->pipelined = TRUE;
+    ngs->fwdflat_lag = tree->fwdflat_lag;
+    ngs->bp_gc_frames = 0;
+    ngram_fwdflat_init(ngs);
+    ngs->fwdflat = TRUE;
+    ngs->fwdflat_perf.name = "fwdflat";
+    ptmr_init(&ngs->fwdflat_perf);
+
+    return ngs;
+}
 
-    /* Initialize fwdtree, fwdflat, bestpath modules if necessary. */
-    if (cmd_ln_boolean_r(config, "-fwdtree")) {
-        ngram_fwdtree_init(ngs);
-        ngs->fwdtree = TRUE;
-        ngs->fwdtree_perf.name = "fwdtree";
-        ptmr_init(&ngs->fwdtree_perf);
-    }
-    if (cmd_ln_boolean_r(config, "-fwdflat")) {
-        ngram_fwdflat_init(ngs);
-        ngs->fwdflat = TRUE;
-        ngs->fwdflat_perf.name = "fwdflat";
-        ptmr_init(&ngs->fwdflat_perf);
-    }
-    if (cmd_ln_boolean_r(config, "-bestpath")) {
-        ngs->bestpath = TRUE;
-        ngs->bestpath_perf.name = "bestpath";
-        ptmr_init(&ngs->bestpath_perf);
+/**
+ * Exchange the backpointer tables of two searches.
+ */
+static void
+ngram_search_swap_bptable(ngram_search_t *a, ngram_search_t *b)
+{
+#define SWAP(type, field) {                     \
+        type tmp = a->field;                    \
+        a->field = b->field;                    \
+        b->field = tmp;                         \
     }
-
-    return (ps_search_t *)ngs;
-
-error_out:
-    ngram_search_free((ps_search_t *)ngs);
-    return NULL;
+    SWAP(bptbl_t **, bp_table);
+    SWAP(int32, bpidx);
+    SWAP(int32, n_bp_block_alloc);
+    SWAP(int32 **, bscore_stack);
+    SWAP(int32, bss_head);
+    SWAP(int32, n_bss_block_alloc);
+    /* These are allocated together. */
+    SWAP(int32 *, bp_table_idx);
+    SWAP(ps_latnode_t **, frm_wordlist);
+    SWAP(int32, n_frame_alloc);
+#undef SWAP
 }
 
 static int
@@ -281,6 +657,11 @@ ngram_search_reinit(ps_search_t *search, dict_t *dict, dict2pid_t *d2p)
         if ((rv = ngram_fwdflat_reinit(ngs)) < 0)
             return rv;
     }
+    if (ngs->flat) {
+        if ((rv = ngram_search_reinit(ps_search_base(ngs->flat),
+                                      dict, d2p)) < 0)
+            return rv;
+    }
 
     return rv;
 }
@@ -290,13 +671,15 @@ ngram_search_free(ps_search_t *search)
 {
     ngram_search_t *ngs = (ngram_search_t *)search;
     
+    if (ngs->flat)
+        ngram_search_free(ps_search_base(ngs->flat));
     if (ngs->fwdtree)
         ngram_fwdtree_deinit(ngs);
     if (ngs->fwdflat)
         ngram_fwdflat_deinit(ngs);
     if (ngs->bestpath) {
         double n_speech = (double)ngs->n_tot_frame
-            / cmd_ln_int32_r(ps_search_config(ngs), "-frate");
+            / ngs->frate;
 
         E_INFO("TOTAL bestpath %.2f CPU %.3f xRT\n",
                ngs->bestpath_perf.t_tot_cpu,
@@ -316,45 +699,123 @@ ngram_search_free(ps_search_t *search)
     ckd_free(ngs->word_chan);
     ckd_free(ngs->word_lat_idx);
     bitvec_free(ngs->word_active);
+    free_bp_blocks(ngs, 0, 0);
     ckd_free(ngs->bp_table);
     ckd_free(ngs->bscore_stack);
+    ckd_free(ngs->gc_keep);
+    ckd_free(ngs->gc_frame_ref);
     if (ngs->bp_table_idx != NULL)
         ckd_free(ngs->bp_table_idx - 1);
     ckd_free_2d(ngs->active_word_list);
     ckd_free(ngs->last_ltrans);
+    ckd_free(ngs->seg_cache);
     ckd_free(ngs);
 }
 
-int
-ngram_search_mark_bptable(ngram_search_t *ngs, int frame_idx)
+void
+ngram_search_alloc_frames(ngram_search_t *ngs, int n_frame)
 {
-    if (frame_idx >= ngs->n_frame_alloc) {
+    int32 old_n_frame_alloc;
+
+    if (n_frame <= ngs->n_frame_alloc)
+        return;
+    old_n_frame_alloc = ngs->n_frame_alloc;
+    while (n_frame > ngs->n_frame_alloc)
         ngs->n_frame_alloc *= 2;
-        ngs->bp_table_idx = ckd_realloc(ngs->bp_table_idx - 1,
-                                        (ngs->n_frame_alloc + 1)
-                                        * sizeof(*ngs->bp_table_idx));
-        if (ngs->frm_wordlist) {
-            ngs->frm_wordlist = ckd_realloc(ngs->frm_wordlist,
-                                            ngs->n_frame_alloc
-                                            * sizeof(*ngs->frm_wordlist));
-        }
-        ++ngs->bp_table_idx; /* Make bptableidx[-1] valid */
+    ngs->bp_table_idx = ckd_realloc(ngs->bp_table_idx - 1,
+                                    (ngs->n_frame_alloc + 1)
+                                    * sizeof(*ngs->bp_table_idx));
+    if (ngs->frm_wordlist) {
+        ngs->frm_wordlist = ckd_realloc(ngs->frm_wordlist,
+                                        ngs->n_frame_alloc
+                                        * sizeof(*ngs->frm_wordlist));
+        memset(ngs->frm_wordlist + old_n_frame_alloc, 0,
+               (ngs->n_frame_alloc - old_n_frame_alloc)
+               * sizeof(*ngs->frm_wordlist));
     }
+    ++ngs->bp_table_idx; /* Make bptableidx[-1] valid */
+}
+
+int
+ngram_search_mark_bptable(ngram_search_t *ngs, int frame_idx)
+{
+    ngram_search_alloc_frames(ngs, frame_idx + 1);
     ngs->bp_table_idx[frame_idx] = ngs->bpidx;
     return ngs->bpidx;
 }
 
+int32
+ngram_search_compact_bptable(ngram_search_t *ngs, int32 *keep, int n_frame)
+{
+    int32 i, j, f, bss_head, n_removed;
+
+    /* Keep all ancestors of referenced entries (a backpointer always
+     * points to an earlier entry). */
+    for (i = ngs->bpidx - 1; i >= 0; --i) {
+        bptbl_t *be = ngram_search_bp(ngs, i);
+        if (keep[i] && be->bp != NO_BP)
+            keep[be->bp] = TRUE;
+    }
+
+    /* Move the surviving entries and their right context scores
+     * down.  Since both are allocated in order, nothing moves up. */
+    j = f = bss_head = 0;
+    for (i = 0; i < ngs->bpidx; ++i) {
+        bptbl_t *be;
+
+        /* Entries are in frame order, so renumber frames as we go. */
+        while (f < n_frame && ngs->bp_table_idx[f] <= i)
+            ngs->bp_table_idx[f++] = j;
+        if (!keep[i]) {
+            keep[i] = NO_BP;
+            continue;
+        }
+        be = ngram_search_bp(ngs, i);
+        if (be->bp != NO_BP)
+            be->bp = keep[be->bp];
+        if (be->s_idx != -1) {
+            int32 rcsize, *rcss;
+
+            rcss = ngram_search_rcss(ngs, be);
+            rcsize = dict2pid_rssid(ps_search_dict2pid(ngs),
+                                    be->last_phone, be->last2_phone)->n_ssid;
+            if ((bss_head & BP_BLOCK_MASK) + rcsize > BP_BLOCK_SIZE)
+                bss_head = (bss_head + BP_BLOCK_MASK) & ~BP_BLOCK_MASK;
+            be->s_idx = bss_head;
+            memmove(ngram_search_rcss(ngs, be), rcss,
+                    rcsize * sizeof(*rcss));
+            bss_head += rcsize;
+        }
+        if (j != i)
+            *ngram_search_bp(ngs, j) = *be;
+        keep[i] = j++;
+    }
+    while (f < n_frame)
+        ngs->bp_table_idx[f++] = j;
+
+    n_removed = ngs->bpidx - j;
+    ngs->bpidx = j;
+    ngs->hyp_wid = BAD_S3WID;
+    ngs->n_seg_cache = -1;
+    ngs->bss_head = bss_head;
+    if (ngs->max_bp == 0)
+        free_bp_blocks(ngs, ngs->bpidx, ngs->bss_head);
+    ngs->st.n_bp_gc += n_removed;
+
+    return n_removed;
+}
+
 static void
 set_real_wid(ngram_search_t *ngs, int32 bp)
 {
     bptbl_t *ent, *prev;
 
     assert(bp != NO_BP);
-    ent = ngs->bp_table + bp;
+    ent = ngram_search_bp(ngs, bp);
     if (ent->bp == NO_BP)
         prev = NULL;
     else
-        prev = ngs->bp_table + ent->bp;
+        prev = ngram_search_bp(ngs, ent->bp);
 
     /* Propagate lm state for fillers, rotate it for words. */
     if (dict_filler_word(ps_search_dict(ngs), ent->wid)) {
@@ -391,31 +852,31 @@ ngram_search_save_bp(ngram_search_t *ngs, int frame_idx,
     bp = ngs->word_lat_idx[w];
     if (bp != NO_BP) {
 
-        if (frame_idx - ngs->bp_table[path].frame > NGRAM_HISTORY_LONG_WORD) {
+        if (frame_idx - ngram_search_bp(ngs, path)->frame > NGRAM_HISTORY_LONG_WORD) {
     	    E_WARN("Word '%s' survived for %d frames, potential overpruning\n", dict_wordstr(ps_search_dict(ngs), w),
-	    	    frame_idx - ngs->bp_table[path].frame);
+	    	    frame_idx - ngram_search_bp(ngs, path)->frame);
 	}
 
         /* Keep only the best scoring one, we will reconstruct the
          * others from the right context scores - usually the history
          * is not lost. */
-        if (ngs->bp_table[bp].score WORSE_THAN score) {
+        if (ngram_search_bp(ngs, bp)->score WORSE_THAN score) {
             assert(path != bp); /* Pathological. */
-            if (ngs->bp_table[bp].bp != path) {
+            if (ngram_search_bp(ngs, bp)->bp != path) {
                 int32 bplh[2], newlh[2];
                 /* But, sometimes, the history *is* lost.  If we wanted to
                  * do exact language model scoring we'd have to preserve
                  * these alternate histories. */
                 E_DEBUG("Updating path history %d => %d frame %d\n",
-                        ngs->bp_table[bp].bp, path, frame_idx);
-                bplh[0] = ngs->bp_table[bp].bp == -1
-                    ? -1 : ngs->bp_table[ngs->bp_table[bp].bp].prev_real_wid;
-                bplh[1] = ngs->bp_table[bp].bp == -1
-                    ? -1 : ngs->bp_table[ngs->bp_table[bp].bp].real_wid;
+                        ngram_search_bp(ngs, bp)->bp, path, frame_idx);
+                bplh[0] = ngram_search_bp(ngs, bp)->bp == -1
+                    ? -1 : ngram_search_bp(ngs, ngram_search_bp(ngs, bp)->bp)->prev_real_wid;
+                bplh[1] = ngram_search_bp(ngs, bp)->bp == -1
+                    ? -1 : ngram_search_bp(ngs, ngram_search_bp(ngs, bp)->bp)->real_wid;
                 newlh[0] = path == -1
-                    ? -1 : ngs->bp_table[path].prev_real_wid;
+                    ? -1 : ngram_search_bp(ngs, path)->prev_real_wid;
                 newlh[1] = path == -1
-                    ? -1 : ngs->bp_table[path].real_wid;
+                    ? -1 : ngram_search_bp(ngs, path)->real_wid;
                 /* Actually it's worth checking how often the actual
                  * language model state changes. */
                 if (bplh[0] != newlh[0] || bplh[1] != newlh[1]) {
@@ -430,15 +891,15 @@ ngram_search_save_bp(ngram_search_t *ngs, int frame_idx,
                                 frame_idx);
                     set_real_wid(ngs, bp);
                 }
-                ngs->bp_table[bp].bp = path;
+                ngram_search_bp(ngs, bp)->bp = path;
             }
-            ngs->bp_table[bp].score = score;
+            ngram_search_bp(ngs, bp)->score = score;
         }
         /* But do keep track of scores for all right contexts, since
          * we need them to determine the starting path scores for any
          * successors of this word exit. */
-        if (ngs->bp_table[bp].s_idx != -1)
-            ngs->bscore_stack[ngs->bp_table[bp].s_idx + rc] = score;
+        if (ngram_search_bp(ngs, bp)->s_idx != -1)
+            ngram_search_rcss(ngs, ngram_search_bp(ngs, bp))[rc] = score;
     }
     else {
         int32 i, rcsize;
@@ -450,25 +911,26 @@ ngram_search_save_bp(ngram_search_t *ngs, int frame_idx,
             return;
         }
 
-        /* Expand the backpointer tables if necessary. */
-        if (ngs->bpidx >= ngs->bp_table_size) {
-            ngs->bp_table_size *= 2;
-            ngs->bp_table = ckd_realloc(ngs->bp_table,
-                                        ngs->bp_table_size
-                                        * sizeof(*ngs->bp_table));
-            E_INFO("Resized backpointer table to %d entries\n", ngs->bp_table_size);
-        }
-        if (ngs->bss_head >= ngs->bscore_stack_size
-            - bin_mdef_n_ciphone(ps_search_acmod(ngs)->mdef)) {
-            ngs->bscore_stack_size *= 2;
-            ngs->bscore_stack = ckd_realloc(ngs->bscore_stack,
-                                            ngs->bscore_stack_size
-                                            * sizeof(*ngs->bscore_stack));
-            E_INFO("Resized score stack to %d entries\n", ngs->bscore_stack_size);
+        /* Get diphone ID for final phone and number of ssids
+         * corresponding to it, so we know how much score stack space
+         * this entry needs. */
+        if (dict_is_single_phone(ps_search_dict(ngs), w))
+            rcsize = 0;
+        else
+            rcsize = dict2pid_rssid(ps_search_dict2pid(ngs),
+                                    dict_last_phone(ps_search_dict(ngs), w),
+                                    dict_second_last_phone(ps_search_dict(ngs), w))->n_ssid;
+        /* Expand the backpointer tables if necessary, or prune the
+         * exit if they cannot be. */
+        if (grow_bptable(ngs, rcsize) < 0) {
+            if (ngs->st.n_bp_full++ == 0)
+                E_WARN("Backpointer table full (%d entries) at frame %d, "
+                       "pruning word exits\n", ngs->max_bp, frame_idx);
+            return;
         }
 
         ngs->word_lat_idx[w] = ngs->bpidx;
-        be = &(ngs->bp_table[ngs->bpidx]);
+        be = ngram_search_bp(ngs, ngs->bpidx);
         be->wid = w;
         be->frame = frame_idx;
         be->bp = path;
@@ -478,27 +940,26 @@ ngram_search_save_bp(ngram_search_t *ngs, int frame_idx,
         assert(path != ngs->bpidx);
 
         /* DICT2PID */
-        /* Get diphone ID for final phone and number of ssids corresponding to it. */
         be->last_phone = dict_last_phone(ps_search_dict(ngs),w);
         if (dict_is_single_phone(ps_search_dict(ngs), w)) {
             be->last2_phone = -1;
             be->s_idx = -1;
-            rcsize = 0;
         }
         else {
             be->last2_phone = dict_second_last_phone(ps_search_dict(ngs),w);
-            rcsize = dict2pid_rssid(ps_search_dict2pid(ngs),
-                                    be->last_phone, be->last2_phone)->n_ssid;
         }
         /* Allocate some space on the bscore_stack for all of these triphones. */
-        for (i = 0; i < rcsize; ++i)
-            ngs->bscore_stack[ngs->bss_head + i] = WORST_SCORE;
-        if (rcsize)
-            ngs->bscore_stack[ngs->bss_head + rc] = score;
+        if (rcsize) {
+            int32 *rcss = ngram_search_rcss(ngs, be);
+            for (i = 0; i < rcsize; ++i)
+                rcss[i] = WORST_SCORE;
+            rcss[rc] = score;
+        }
         set_real_wid(ngs, ngs->bpidx);
 
         ngs->bpidx++;
         ngs->bss_head += rcsize;
+        ++ps_search_acmod(ngs)->stats.n_bp;
     }
 }
 
@@ -529,14 +990,14 @@ ngram_search_find_exit(ngram_search_t *ngs, int frame_idx, int32 *out_best_score
         return NO_BP;
 
     /* Now find the entry for </s> OR the best scoring entry. */
-    assert(end_bpidx < ngs->bp_table_size);
+    assert(end_bpidx <= ngs->bpidx);
     for (bp = ngs->bp_table_idx[frame_idx]; bp < end_bpidx; ++bp) {
-        if (ngs->bp_table[bp].wid == ps_search_finish_wid(ngs)
-            || ngs->bp_table[bp].score BETTER_THAN best_score) {
-            best_score = ngs->bp_table[bp].score;
+        if (ngram_search_bp(ngs, bp)->wid == ps_search_finish_wid(ngs)
+            || ngram_search_bp(ngs, bp)->score BETTER_THAN best_score) {
+            best_score = ngram_search_bp(ngs, bp)->score;
             best_exit = bp;
         }
-        if (ngs->bp_table[bp].wid == ps_search_finish_wid(ngs))
+        if (ngram_search_bp(ngs, bp)->wid == ps_search_finish_wid(ngs))
             break;
     }
 
@@ -550,6 +1011,7 @@ char const *
 ngram_search_bp_hyp(ngram_search_t *ngs, int bpidx)
 {
     ps_search_t *base = ps_search_base(ngs);
+    bptbl_t *last;
     char *c;
     size_t len;
     int bp;
@@ -557,10 +1019,18 @@ ngram_search_bp_hyp(ngram_search_t *ngs, int bpidx)
     if (bpidx == NO_BP)
         return NULL;
 
+    /* Entries keep their predecessors until the table is compacted,
+     * so the words are the same if these are. */
+    last = ngram_search_bp(ngs, bpidx);
+    if (last->wid == ngs->hyp_wid && last->bp == ngs->hyp_bp)
+        return base->hyp_str;
+    ngs->hyp_wid = last->wid;
+    ngs->hyp_bp = last->bp;
+
     bp = bpidx;
     len = 0;
     while (bp != NO_BP) {
-        bptbl_t *be = &ngs->bp_table[bp];
+        bptbl_t *be = ngram_search_bp(ngs, bp);
         bp = be->bp;
         if (dict_real_word(ps_search_dict(ngs), be->wid))
             len += strlen(dict_basestr(ps_search_dict(ngs), be->wid)) + 1;
@@ -576,7 +1046,7 @@ ngram_search_bp_hyp(ngram_search_t *ngs, int bpidx)
     bp = bpidx;
     c = base->hyp_str + len - 1;
     while (bp != NO_BP) {
-        bptbl_t *be = &ngs->bp_table[bp];
+        bptbl_t *be = ngram_search_bp(ngs, bp);
         size_t len;
 
         bp = be->bp;
@@ -674,10 +1144,21 @@ ngram_search_exit_score(ngram_search_t *ngs, bptbl_t *pbe, int rcphone)
                                pbe->last_phone, pbe->last2_phone);
         /* This may be WORST_SCORE, which means that there was no exit
          * with rcphone as right context. */
-        return ngs->bscore_stack[pbe->s_idx + rssid->cimap[rcphone]];
+        return ngram_search_rcss(ngs, pbe)[rssid->cimap[rcphone]];
     }
 }
 
+void
+ngram_search_bp_lmstate(ngram_search_t *ngs, bptbl_t *pbe,
+                        ngram_state_t *out_state)
+{
+    int32 hist[2];
+
+    hist[0] = pbe->real_wid;
+    hist[1] = pbe->prev_real_wid;
+    ngram_state_init(ngs->lmset, out_state, hist, 2);
+}
+
 /*
  * Compute acoustic and LM scores for a BPTable entry (segment).
  */
@@ -696,7 +1177,7 @@ ngram_compute_seg_score(ngram_search_t *ngs, bptbl_t *be, float32 lwf,
     }
 
     /* Otherwise, calculate lscr and ascr. */
-    pbe = ngs->bp_table + be->bp;
+    pbe = ngram_search_bp(ngs, be->bp);
     start_score = ngram_search_exit_score(ngs, pbe,
                                  dict_first_phone(ps_search_dict(ngs),be->wid));
     assert(start_score BETTER_THAN WORST_SCORE);
@@ -730,8 +1211,11 @@ ngram_search_start(ps_search_t *search)
 
     ngs->done = FALSE;
     ngram_model_flush(ngs->lmset);
-    if (ngs->fwdtree)
+    if (ngs->fwdtree) {
         ngram_fwdtree_start(ngs);
+        if (ngs->flat)
+            ngram_fwdflat_start(ngs->flat);
+    }
     else if (ngs->fwdflat)
         ngram_fwdflat_start(ngs);
     else
@@ -744,8 +1228,16 @@ ngram_search_step(ps_search_t *search, int frame_idx)
 {
     ngram_search_t *ngs = (ngram_search_t *)search;
 
-    if (ngs->fwdtree)
-        return ngram_fwdtree_search(ngs, frame_idx);
+    if (ngs->fwdtree) {
+        int nfr;
+
+        nfr = ngram_fwdtree_search(ngs, frame_idx);
+        /* Keep the pipelined fwdflat search close behind. */
+        if (nfr > 0 && ngs->flat
+            && ngram_fwdflat_pipeline(ngs->flat, ngs, FALSE) < 0)
+            return -1;
+        return nfr;
+    }
     else if (ngs->fwdflat)
         return ngram_fwdflat_search(ngs, frame_idx);
     else
@@ -758,13 +1250,13 @@ dump_bptable(ngram_search_t *ngs)
     int i;
     E_INFO("Backpointer table (%d entries):\n", ngs->bpidx);
     for (i = 0; i < ngs->bpidx; ++i) {
-        bptbl_t *bpe = ngs->bp_table + i;
+        bptbl_t *bpe = ngram_search_bp(ngs, i);
         int j, rcsize;
 
         E_INFO_NOFN("%-5d %-10s start %-3d end %-3d score %-8d bp %-3d real_wid %-5d prev_real_wid %-5d",
                     i, dict_wordstr(ps_search_dict(ngs), bpe->wid),
                     (bpe->bp == -1
-                     ? 0 : ngs->bp_table[bpe->bp].frame + 1),
+                     ? 0 : ngram_search_bp(ngs, bpe->bp)->frame + 1),
                     bpe->frame, bpe->score, bpe->bp,
                     bpe->real_wid, bpe->prev_real_wid);
 
@@ -776,8 +1268,8 @@ dump_bptable(ngram_search_t *ngs)
         if (rcsize) {
             E_INFOCONT("\tbss");
             for (j = 0; j < rcsize; ++j)
-                if (ngs->bscore_stack[bpe->s_idx + j] != WORST_SCORE)
-                    E_INFOCONT(" %d", bpe->score - ngs->bscore_stack[bpe->s_idx + j]);
+                if (ngram_search_rcss(ngs, bpe)[j] != WORST_SCORE)
+                    E_INFOCONT(" %d", bpe->score - ngram_search_rcss(ngs, bpe)[j]);
         }
         E_INFOCONT("\n");
     }
@@ -793,8 +1285,18 @@ ngram_search_finish(ps_search_t *search)
         ngram_fwdtree_finish(ngs);
         /* dump_bptable(ngs); */
 
+        /* Let the pipelined fwdflat search catch up, and take its
+         * result as our own. */
+        if (ngs->flat) {
+            if (!search->discard
+                && ngram_fwdflat_pipeline(ngs->flat, ngs, TRUE) < 0)
+                return -1;
+            ngram_fwdflat_finish(ngs->flat);
+            ngs->flat->n_tot_frame += ngs->flat->n_frame;
+            ngram_search_swap_bptable(ngs, ngs->flat);
+        }
         /* Now do fwdflat search in its entirety, if requested. */
-        if (ngs->fwdflat) {
+        else if (ngs->fwdflat && !search->discard) {
             int i;
             /* Rewind the acoustic model. */
             if (acmod_rewind(ps_search_acmod(ngs)) < 0)
@@ -820,6 +1322,8 @@ ngram_search_finish(ps_search_t *search)
 
     /* Mark the current utterance as done. */
     ngs->done = TRUE;
+    ngs->hyp_wid = BAD_S3WID;
+    ngs->n_seg_cache = -1;
     return 0;
 }
 
@@ -829,16 +1333,18 @@ ngram_search_bestpath(ps_search_t *search, int32 *out_score, int backward)
     ngram_search_t *ngs = (ngram_search_t *)search;
 
     if (search->last_link == NULL) {
+        acmod_stage_start(ps_search_acmod(ngs), PS_STAGE_LATTICE);
         search->last_link = ps_lattice_bestpath(search->dag, ngs->lmset,
                                                 ngs->bestpath_fwdtree_lw_ratio,
                                                 ngs->ascale);
-        if (search->last_link == NULL)
-            return NULL;
         /* Also calculate betas so we can fill in the posterior
          * probability field in the segmentation. */
-        if (search->post == 0)
+        if (search->last_link && search->post == 0)
             search->post = ps_lattice_posterior(search->dag, ngs->lmset,
                                                 ngs->ascale);
+        acmod_stage_stop(ps_search_acmod(ngs), PS_STAGE_LATTICE);
+        if (search->last_link == NULL)
+            return NULL;
     }
     if (out_score)
         *out_score = search->last_link->path_scr + search->dag->final_node_ascr;
@@ -866,7 +1372,7 @@ ngram_search_hyp(ps_search_t *search, int32 *out_score)
         hyp = ps_lattice_hyp(dag, link);
         ptmr_stop(&ngs->bestpath_perf);
         n_speech = (double)dag->n_frames
-            / cmd_ln_int32_r(ps_search_config(ngs), "-frate");
+            / ngs->frate;
         E_INFO("bestpath %.2f CPU %.3f xRT\n",
                ngs->bestpath_perf.t_cpu,
                ngs->bestpath_perf.t_cpu / n_speech);
@@ -888,22 +1394,21 @@ ngram_search_hyp(ps_search_t *search, int32 *out_score)
 }
 
 static void
-ngram_search_bp2itor(ps_seg_t *seg, int bp)
+ngram_search_bp_seg(ngram_search_t *ngs, int bp, float32 lwf,
+                    ps_seg_info_t *info, int32 *out_lback)
 {
-    ngram_search_t *ngs = (ngram_search_t *)seg->search;
     bptbl_t *be, *pbe;
 
-    be = &ngs->bp_table[bp];
-    pbe = be->bp == -1 ? NULL : &ngs->bp_table[be->bp];
-    seg->word = dict_wordstr(ps_search_dict(ngs), be->wid);
-    seg->ef = be->frame;
-    seg->sf = pbe ? pbe->frame + 1 : 0;
-    seg->prob = 0; /* Bogus value... */
+    be = ngram_search_bp(ngs, bp);
+    pbe = be->bp == -1 ? NULL : ngram_search_bp(ngs, be->bp);
+    info->wid = be->wid;
+    info->ef = be->frame;
+    info->sf = pbe ? pbe->frame + 1 : 0;
     /* Compute acoustic and LM scores for this segment. */
     if (pbe == NULL) {
-        seg->ascr = be->score;
-        seg->lscr = 0;
-        seg->lback = 0;
+        info->ascr = be->score;
+        info->lscr = 0;
+        *out_lback = 0;
     }
     else {
         int32 start_score;
@@ -913,23 +1418,38 @@ ngram_search_bp2itor(ps_seg_t *seg, int bp)
                                      dict_first_phone(ps_search_dict(ngs), be->wid));
         assert(start_score BETTER_THAN WORST_SCORE);
         if (be->wid == ps_search_silence_wid(ngs)) {
-            seg->lscr = ngs->silpen;
+            info->lscr = ngs->silpen;
         }
         else if (dict_filler_word(ps_search_dict(ngs), be->wid)) {
-            seg->lscr = ngs->fillpen;
+            info->lscr = ngs->fillpen;
         }
         else {
-            seg->lscr = ngram_tg_score(ngs->lmset,
-                                       be->real_wid,
-                                       pbe->real_wid,
-                                       pbe->prev_real_wid,
-                                       &seg->lback)>>SENSCR_SHIFT;
-            seg->lscr = (int32)(seg->lscr * seg->lwf);
+            info->lscr = ngram_tg_score(ngs->lmset,
+                                        be->real_wid,
+                                        pbe->real_wid,
+                                        pbe->prev_real_wid,
+                                        out_lback)>>SENSCR_SHIFT;
+            info->lscr = (int32)(info->lscr * lwf);
         }
-        seg->ascr = be->score - start_score - seg->lscr;
+        info->ascr = be->score - start_score - info->lscr;
     }
 }
 
+static void
+ngram_search_bp2itor(ps_seg_t *seg, int bp)
+{
+    ngram_search_t *ngs = (ngram_search_t *)seg->search;
+    ps_seg_info_t info;
+
+    ngram_search_bp_seg(ngs, bp, seg->lwf, &info, &seg->lback);
+    seg->word = dict_wordstr(ps_search_dict(ngs), info.wid);
+    seg->sf = info.sf;
+    seg->ef = info.ef;
+    seg->ascr = info.ascr;
+    seg->lscr = info.lscr;
+    seg->prob = 0; /* Bogus value... */
+}
+
 static void
 ngram_bp_seg_free(ps_seg_t *seg)
 {
@@ -975,7 +1495,7 @@ ngram_search_bp_iter(ngram_search_t *ngs, int bpidx, float32 lwf)
     itor->n_bpidx = 0;
     bp = bpidx;
     while (bp != NO_BP) {
-        bptbl_t *be = &ngs->bp_table[bp];
+        bptbl_t *be = ngram_search_bp(ngs, bp);
         bp = be->bp;
         ++itor->n_bpidx;
     }
@@ -987,7 +1507,7 @@ ngram_search_bp_iter(ngram_search_t *ngs, int bpidx, float32 lwf)
     cur = itor->n_bpidx - 1;
     bp = bpidx;
     while (bp != NO_BP) {
-        bptbl_t *be = &ngs->bp_table[bp];
+        bptbl_t *be = ngram_search_bp(ngs, bp);
         itor->bpidx[cur] = bp;
         bp = be->bp;
         --cur;
@@ -1021,7 +1541,7 @@ ngram_search_seg_iter(ps_search_t *search)
                                    ngs->bestpath_fwdtree_lw_ratio);
         ptmr_stop(&ngs->bestpath_perf);
         n_speech = (double)dag->n_frames
-            / cmd_ln_int32_r(ps_search_config(ngs), "-frate");
+            / ngs->frate;
         E_INFO("bestpath %.2f CPU %.3f xRT\n",
                ngs->bestpath_perf.t_cpu,
                ngs->bestpath_perf.t_cpu / n_speech);
@@ -1044,6 +1564,53 @@ ngram_search_seg_iter(ps_search_t *search)
     return NULL;
 }
 
+static int
+ngram_search_segs(ps_search_t *search, ps_seg_info_t *segs, int n_segs,
+                  int32 *out_score)
+{
+    ngram_search_t *ngs = (ngram_search_t *)search;
+    float32 lwf;
+    int32 bpidx, lback;
+    int bp, n;
+
+    /* The best path through the lattice is found anew anyway. */
+    if (ngs->bestpath && ngs->done)
+        return -1;
+
+    bpidx = ngram_search_find_exit(ngs, -1, out_score);
+    if (bpidx == NO_BP)
+        return 0;
+    lwf = (ngs->done && ngs->fwdflat) ? ngs->fwdflat_fwdtree_lw_ratio : 1.0;
+
+    /* Entries keep their predecessors until the table is compacted,
+     * so only the last word has to be looked at again while its
+     * predecessor stays the same. */
+    bp = ngram_search_bp(ngs, bpidx)->bp;
+    if (ngs->n_seg_cache < 0 || bp != ngs->seg_cache_bp) {
+        ngs->seg_cache_bp = bp;
+        for (n = 0; bp != NO_BP; bp = ngram_search_bp(ngs, bp)->bp)
+            ++n;
+        if (n > ngs->n_seg_cache_alloc) {
+            ngs->n_seg_cache_alloc = n + 16;
+            ngs->seg_cache = ckd_realloc(ngs->seg_cache,
+                                         ngs->n_seg_cache_alloc
+                                         * sizeof(*ngs->seg_cache));
+        }
+        ngs->n_seg_cache = n;
+        for (bp = ngs->seg_cache_bp; bp != NO_BP;
+             bp = ngram_search_bp(ngs, bp)->bp)
+            ngram_search_bp_seg(ngs, bp, lwf, &ngs->seg_cache[--n], &lback);
+    }
+
+    n = ngs->n_seg_cache;
+    if (n > 0 && n_segs > 0)
+        memcpy(segs, ngs->seg_cache,
+               (n < n_segs ? n : n_segs) * sizeof(*segs));
+    if (n < n_segs)
+        ngram_search_bp_seg(ngs, bpidx, lwf, &segs[n], &lback);
+    return n + 1;
+}
+
 static int32
 ngram_search_prob(ps_search_t *search)
 {
@@ -1072,15 +1639,17 @@ create_dag_nodes(ngram_search_t *ngs, ps_lattice_t *dag)
     bptbl_t *bp_ptr;
     int32 i;
 
-    for (i = 0, bp_ptr = ngs->bp_table; i < ngs->bpidx; ++i, ++bp_ptr) {
+    for (i = 0; i < ngs->bpidx; ++i) {
         int32 sf, ef, wid;
         ps_latnode_t *node;
 
+        bp_ptr = ngram_search_bp(ngs, i);
+
         /* Skip invalid backpointers (these result from -maxwpf pruning) */
         if (!bp_ptr->valid)
             continue;
 
-        sf = (bp_ptr->bp < 0) ? 0 : ngs->bp_table[bp_ptr->bp].frame + 1;
+        sf = (bp_ptr->bp < 0) ? 0 : ngram_search_bp(ngs, bp_ptr->bp)->frame + 1;
         ef = bp_ptr->frame;
         wid = bp_ptr->wid;
 
@@ -1150,7 +1719,7 @@ find_end_node(ngram_search_t *ngs, ps_lattice_t *dag, float32 lwf)
 
     /* Find final node </s>.last_frame; nothing can follow this node */
     for (node = dag->nodes; node; node = node->next) {
-        int32 lef = ngs->bp_table[node->lef].frame;
+        int32 lef = ngram_search_bp(ngs, node->lef)->frame;
         if ((node->wid == ps_search_finish_wid(ngs))
             && (lef == dag->n_frames - 1))
             break;
@@ -1174,8 +1743,8 @@ find_end_node(ngram_search_t *ngs, ps_lattice_t *dag, float32 lwf)
     bestbp = NO_BP;
     for (bp = ngs->bp_table_idx[ef]; bp < ngs->bp_table_idx[ef + 1]; ++bp) {
         int32 n_used, l_scr, wid, prev_wid;
-        wid = ngs->bp_table[bp].real_wid;
-        prev_wid = ngs->bp_table[bp].prev_real_wid;
+        wid = ngram_search_bp(ngs, bp)->real_wid;
+        prev_wid = ngram_search_bp(ngs, bp)->prev_real_wid;
         /* Always prefer </s>, of which there will only be one per frame. */
         if (wid == ps_search_finish_wid(ngs)) {
             bestbp = bp;
@@ -1184,8 +1753,8 @@ find_end_node(ngram_search_t *ngs, ps_lattice_t *dag, float32 lwf)
         l_scr = ngram_tg_score(ngs->lmset, ps_search_finish_wid(ngs),
                                wid, prev_wid, &n_used) >>SENSCR_SHIFT;
         l_scr = l_scr * lwf;
-        if (ngs->bp_table[bp].score + l_scr BETTER_THAN bestscore) {
-            bestscore = ngs->bp_table[bp].score + l_scr;
+        if (ngram_search_bp(ngs, bp)->score + l_scr BETTER_THAN bestscore) {
+            bestscore = ngram_search_bp(ngs, bp)->score + l_scr;
             bestbp = bp;
         }
     }
@@ -1194,7 +1763,7 @@ find_end_node(ngram_search_t *ngs, ps_lattice_t *dag, float32 lwf)
         return NULL;
     }
     E_INFO("</s> not found in last frame, using %s.%d instead\n",
-           dict_basestr(ps_search_dict(ngs), ngs->bp_table[bestbp].wid), ef);
+           dict_basestr(ps_search_dict(ngs), ngram_search_bp(ngs, bestbp)->wid), ef);
 
     /* Now find the node that corresponds to it. */
     for (node = dag->nodes; node; node = node->next) {
@@ -1204,7 +1773,7 @@ find_end_node(ngram_search_t *ngs, ps_lattice_t *dag, float32 lwf)
 
     /* FIXME: This seems to happen a lot! */
     E_ERROR("Failed to find DAG node corresponding to %s\n",
-           dict_basestr(ps_search_dict(ngs), ngs->bp_table[bestbp].wid));
+           dict_basestr(ps_search_dict(ngs), ngram_search_bp(ngs, bestbp)->wid));
     return NULL;
 }
 
@@ -1235,6 +1804,7 @@ ngram_search_lattice(ps_search_t *search)
         return search->dag;
 
     /* Nope, create a new one. */
+    acmod_stage_start(ps_search_acmod(ngs), PS_STAGE_LATTICE);
     ps_lattice_free(search->dag);
     search->dag = NULL;
     dag = ps_lattice_init_search(search, ngs->n_frame);
@@ -1249,7 +1819,7 @@ ngram_search_lattice(ps_search_t *search)
            dict_wordstr(search->dict, dag->start->wid), dag->start->sf,
            dict_wordstr(search->dict, dag->end->wid), dag->end->sf);
 
-    ngram_compute_seg_score(ngs, ngs->bp_table + dag->end->lef, lwf,
+    ngram_compute_seg_score(ngs, ngram_search_bp(ngs, dag->end->lef), lwf,
                             &dag->final_node_ascr, &lscr);
 
     /*
@@ -1285,8 +1855,8 @@ ngram_search_lattice(ps_search_t *search)
 
         /* Prune nodes with too few endpoints - heuristic
            borrowed from Sphinx3 */
-        fef = ngs->bp_table[to->fef].frame;
-        lef = ngs->bp_table[to->lef].frame;
+        fef = ngram_search_bp(ngs, to->fef)->frame;
+        lef = ngram_search_bp(ngs, to->lef)->frame;
         if (to != dag->end && lef - fef < min_endfr) {
             to->reachable = FALSE;
             continue;
@@ -1296,8 +1866,8 @@ ngram_search_lattice(ps_search_t *search)
         for (from = to->next; from; from = from->next) {
             bptbl_t *from_bpe;
 
-            fef = ngs->bp_table[from->fef].frame;
-            lef = ngs->bp_table[from->lef].frame;
+            fef = ngram_search_bp(ngs, from->fef)->frame;
+            lef = ngram_search_bp(ngs, from->lef)->frame;
 
             if ((to->sf <= fef) || (to->sf > lef + 1))
                 continue;
@@ -1307,9 +1877,9 @@ ngram_search_lattice(ps_search_t *search)
             }
 
             /* Find bptable entry for "from" that exactly precedes "to" */
-            i = from->fef;
-            from_bpe = ngs->bp_table + i;
-            for (; i <= from->lef; i++, from_bpe++) {
+            for (i = from->fef; i <= from->lef; i++) {
+                /* Entries are stored in blocks, so look each one up. */
+                from_bpe = ngram_search_bp(ngs, i);
                 if (from_bpe->wid != from->wid)
                     continue;
                 if (from_bpe->frame >= to->sf - 1)
@@ -1360,8 +1930,8 @@ ngram_search_lattice(ps_search_t *search)
 
     for (node = dag->nodes; node; node = node->next) {
         /* Change node->{fef,lef} from bptbl indices to frames. */
-        node->fef = ngs->bp_table[node->fef].frame;
-        node->lef = ngs->bp_table[node->lef].frame;
+        node->fef = ngram_search_bp(ngs, node->fef)->frame;
+        node->lef = ngram_search_bp(ngs, node->lef)->frame;
         /* Find base wid for nodes. */
         node->basewid = dict_basewid(search->dict, node->wid);
     }
@@ -1393,10 +1963,12 @@ ngram_search_lattice(ps_search_t *search)
     ps_lattice_penalize_fillers(dag, ngs->silpen, ngs->fillpen);
 
     search->dag = dag;
+    acmod_stage_stop(ps_search_acmod(ngs), PS_STAGE_LATTICE);
     return dag;
 
 error_out:
     ps_lattice_free(dag);
+    acmod_stage_stop(ps_search_acmod(ngs), PS_STAGE_LATTICE);
     return NULL;
 }
 
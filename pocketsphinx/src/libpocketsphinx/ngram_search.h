@@ -103,6 +103,71 @@ typedef struct root_chan_s {
                                    unique right context */
 } root_chan_t;
 
+/**
+ * Interior node of the lexicon tree.
+ *
+ * This is only the topology of the tree, which does not change during
+ * the search; the HMM for a node is kept in a tree_chan_t, which
+ * exists only while the node is active.
+ */
+typedef struct lextree_node_s {
+    int32 first_child;          /**< Index of first child, the rest follow it */
+    int32 n_child;              /**< Number of children */
+    int32 penult_phn_wid;       /**< As in chan_t */
+    uint16 ssid;                /**< Senone sequence ID */
+    int16 tmatid;               /**< Transition matrix ID */
+    int16 ciphone;              /**< ciphone for this node */
+} lextree_node_t;
+
+/**
+ * Root node of the lexicon tree, one for each unique initial diphone.
+ */
+typedef struct lextree_root_s {
+    int32 first_child;          /**< Index of first child, the rest follow it */
+    int32 n_child;              /**< Number of children */
+    int32 penult_phn_wid;       /**< As in root_chan_t */
+    uint16 ssid;                /**< Senone sequence ID of the CI phone */
+    int16 tmatid;               /**< Transition matrix ID */
+    int16 ciphone;              /**< First ciphone */
+    int16 ci2phone;             /**< Second ciphone */
+} lextree_root_t;
+
+/**
+ * Lexicon tree used by fwdtree search.
+ *
+ * This depends only on the dictionary, the acoustic model and the
+ * words in the language model, and is never modified once built, so
+ * searches with the same ones can share it (see
+ * ngram_fwdtree_share()).  Children of a node are contiguous, in
+ * breadth-first order.
+ */
+typedef struct lextree_s {
+    int refcount;               /**< Reference count */
+    bin_mdef_t *mdef;           /**< Model definition for ssid (not retained) */
+    lextree_root_t *root;       /**< Root nodes */
+    int32 n_root;               /**< Number of root nodes */
+    lextree_node_t *node;       /**< Interior nodes */
+    int32 n_node;               /**< Number of interior nodes */
+    /**
+     * Each node in the tree may point to a set of words whose last
+     * phone would follow that node (but is not included in the tree,
+     * see ngram_search_t).  The node points to one word in this set
+     * of words.  The remaining words are linked through
+     * homophone_set[], where homophone_set[w] = wid of next word in
+     * the same set as w.
+     */
+    int32 *homophone_set;
+    int32 n_words;              /**< Size of homophone_set */
+} lextree_t;
+
+/**
+ * HMM for an active interior node of the lexicon tree.
+ */
+typedef struct tree_chan_s {
+    hmm_t hmm;                  /**< Basic HMM structure (must be first). */
+    int32 node;                 /**< Index of the node in lextree_t */
+} tree_chan_t;
+
 /**
  * Back pointer table (forward pass lattice; actually a tree)
  */
@@ -174,6 +239,26 @@ typedef struct bestbp_rc_s {
 
 #define NO_BP		-1
 
+/*
+ * The backpointer table and score stack are stored in fixed-size
+ * blocks, so that they can grow without being copied.  The right
+ * context scores for one backpointer never straddle a block.
+ */
+#define BP_BLOCK_SHIFT	10
+#define BP_BLOCK_SIZE	(1 << BP_BLOCK_SHIFT)
+#define BP_BLOCK_MASK	(BP_BLOCK_SIZE - 1)
+
+/**
+ * Access a backpointer table entry by index.
+ */
+#define ngram_search_bp(ngs, bp)                                \
+    (&(ngs)->bp_table[(bp) >> BP_BLOCK_SHIFT][(bp) & BP_BLOCK_MASK])
+/**
+ * Access the right context scores for a backpointer table entry.
+ */
+#define ngram_search_rcss(ngs, be)                                      \
+    (&(ngs)->bscore_stack[(be)->s_idx >> BP_BLOCK_SHIFT][(be)->s_idx & BP_BLOCK_MASK])
+
 /**
  * Various statistics for profiling.
  */
@@ -188,8 +273,20 @@ typedef struct ngram_search_stats_s {
     int32 n_fwdflat_words;
     int32 n_fwdflat_word_transition;
     int32 n_senone_active_utt;
+    int32 n_beam_narrowed;      /**< Frames pruned with less than -beam */
+    float64 beam_sum;           /**< Sum of dynamic beams over frames */
+    int32 n_lmla_hit;           /**< LM lookahead found in the cache */
+    int32 n_lmla_miss;          /**< LM lookahead computed */
+    int32 n_bp_gc;              /**< Backpointers removed by garbage collection */
+    int32 n_bp_full;            /**< Word exits dropped from a full table */
 } ngram_search_stats_t;
 
+/**
+ * Number of bins in the histogram of HMM scores used to find the beam
+ * that keeps a given number of HMMs active.
+ */
+#define SCORE_HIST_BINS 512
+
 
 /**
  * N-Gram search module structure.
@@ -203,12 +300,26 @@ struct ngram_search_s {
     uint8 fwdtree;
     uint8 fwdflat;
     uint8 bestpath;
+    uint8 pipelined; /**< fwdflat fed word by word from another search */
 
     /* State of procesing. */
     uint8 done;
 
+    /* Final backpointer entry of the last partial hypothesis, which
+     * ngram_search_bp_hyp() only rebuilds when it changes. */
+    int32 hyp_wid;   /**< Its word ID, or BAD_S3WID if none */
+    int32 hyp_bp;    /**< Its predecessor */
+
+    /* Segments of the last partial hypothesis up to its final word,
+     * which ngram_search_segs() only rebuilds when it changes. */
+    ps_seg_info_t *seg_cache;
+    int32 n_seg_cache;       /**< Number of segments, or -1 if none */
+    int32 n_seg_cache_alloc;
+    int32 seg_cache_bp;      /**< Backpointer entry of the last one */
+
     /* Allocators */
     listelem_alloc_t *chan_alloc; /**< For chan_t */
+    listelem_alloc_t *tree_chan_alloc; /**< For tree_chan_t */
     listelem_alloc_t *root_chan_alloc; /**< For root_chan_t */
     listelem_alloc_t *latnode_alloc; /**< For latnode_t */
 
@@ -218,20 +329,24 @@ struct ngram_search_s {
      * The word triphone sequences (HMM instances) are transformed
      * into tree structures, one tree per unique left triphone in the
      * entire dictionary (actually diphone, since its left context
-     * varies dyamically during the search process).  The entire set
-     * of trees of channels is allocated once and for all during
-     * initialization (since dynamic management of active CHANs is
-     * time consuming), with one exception: the last phones of words,
-     * that need multiple right context modelling, are not maintained
-     * in this static structure since there are too many of them and
-     * few are active at any time.  Instead they are maintained as
-     * linked lists of CHANs, one list per word, and each CHAN in this
-     * set is allocated only on demand and freed if inactive.
+     * varies dyamically during the search process).  The root
+     * channels are allocated once and for all during initialization.
+     * The topology of the rest of the tree is kept in lextree, which
+     * may be shared with other searches, and the HMMs of its interior
+     * nodes are allocated when they become active and freed when they
+     * are pruned.  The last phones of words, that need multiple right
+     * context modelling, are not in the tree at all.  Instead they
+     * are maintained as linked lists of CHANs, one list per word, and
+     * each CHAN in this set is allocated only on demand and freed if
+     * inactive.
      */
     root_chan_t *root_chan;  /**< Roots of search tree. */
     int32 n_root_chan_alloc; /**< Number of root_chan allocated */
     int32 n_root_chan;       /**< Number of valid root_chan */
     int32 n_nonroot_chan;    /**< Number of valid non-root channels */
+    lextree_t *lextree;      /**< Topology of the search tree. */
+    tree_chan_t **tree_chan; /**< HMM of each active interior node, or NULL */
+    int32 n_tree_chan;       /**< Number of HMMs in tree_chan */
     int32 max_nonroot_chan;  /**< Maximum possible number of non-root channels */
     root_chan_t *rhmm_1ph;   /**< Root HMMs for single-phone words */
 
@@ -246,21 +361,10 @@ struct ngram_search_s {
     chan_t **word_chan;
     bitvec_t *word_active;      /**< array of active flags for all words. */
 
-    /**
-     * Each node in the HMM tree structure may point to a set of words
-     * whose last phone would follow that node in the tree structure
-     * (but is not included in the tree structure for reasons
-     * explained above).  The channel node points to one word in this
-     * set of words.  The remaining words are linked through
-     * homophone_set[].
-     * 
+    /*
      * Single-phone words are not represented in the HMM tree; they
      * are kept in word_chan.
-     *
-     * Specifically, homophone_set[w] = wid of next word in the same
-     * set as w.
      */
-    int32 *homophone_set;
     int32 *single_phone_wid; /**< list of single-phone word ids */
     int32 n_1ph_words;       /**< Number single phone words in dict (total) */
     int32 n_1ph_LMwords;     /**< Number single phone dict words also in LM;
@@ -272,7 +376,7 @@ struct ngram_search_s {
      * active_chan_list[f mod 2] = list of nonroot channels in the HMM
      * tree active in frame f.
      */
-    chan_t ***active_chan_list;
+    tree_chan_t ***active_chan_list;
     int32 n_active_chan[2];  /**< Number entries in active_chan_list */
     /**
      * Array of active multi-phone words for current and next frame.
@@ -297,12 +401,33 @@ struct ngram_search_s {
     cand_sf_t *cand_sf;
     bestbp_rc_t *bestbp_rc;
 
-    bptbl_t *bp_table;       /* Forward pass lattice */
+    /*
+     * Language model lookahead.  Scores in the tree carry the best LM
+     * score of any word reachable from the current node, given the
+     * history of the path, which is replaced by the real LM score
+     * when the path enters the last phone of a word.  The lookahead
+     * for recent histories is kept in a direct-mapped cache.
+     */
+    int32 lmla_order;        /**< N-Gram order of lookahead, or 0 for none */
+    int32 n_lmla;            /**< Number of cache entries (a power of two) */
+    int32 *lmla_hist;        /**< Two history words per cache entry */
+    int16 **lmla_score;      /**< Lookahead for each root, then each
+                                interior node, per cache entry */
+
+    bptbl_t **bp_table;      /* Forward pass lattice, in blocks */
     int32 bpidx;             /* First free BPTable entry */
-    int32 bp_table_size;
-    int32 *bscore_stack;     /* Score stack for all possible right contexts */
+    int32 n_bp_block_alloc;  /* Number of block pointers in bp_table */
+    int32 **bscore_stack;    /* Score stack for all possible right contexts */
     int32 bss_head;          /* First free BScoreStack entry */
-    int32 bscore_stack_size;
+    int32 n_bss_block_alloc; /* Number of block pointers in bscore_stack */
+    int32 bp_gc_frames;      /* Frames between garbage collections, or 0 */
+    int32 max_bp;            /* Fixed size of bp_table, or 0 to let it grow */
+    int32 max_bss;           /* Fixed size of bscore_stack, or 0 */
+    uint8 bp_gc_full;        /* Garbage collect when the fixed table fills up */
+    int32 *gc_keep;          /* Garbage collection scratch, n_gc_keep_alloc */
+    int32 n_gc_keep_alloc;
+    uint8 *gc_frame_ref;     /* Garbage collection scratch, n_gc_frame_alloc */
+    int32 n_gc_frame_alloc;
 
     int32 n_frame_alloc; /**< Number of frames allocated in bp_table_idx and friends. */
     int32 n_frame;       /**< Number of frames actually present. */
@@ -322,6 +447,20 @@ struct ngram_search_s {
     int32 max_sf_win;
     float32 fwdflat_fwdtree_lw_ratio;
 
+    /*
+     * Pipelined fwdflat search.  The fwdtree search owns a second
+     * search which runs fwdflat alongside it, a bounded number of
+     * frames behind, and whose result replaces its own at the end of
+     * the utterance.
+     */
+    struct ngram_search_s *flat; /**< Pipelined fwdflat search, or NULL */
+    int32 fwdflat_lag;          /**< Frames fwdflat stays behind fwdtree */
+    bitvec_t *fwdflat_word_flag; /**< Words in fwdflat_wordlist */
+    int32 n_fwdflat_wordlist;   /**< Number of words in fwdflat_wordlist */
+    int32 pipe_bpidx;           /**< Next fwdtree backpointer to read */
+    int32 pipe_n_frame;         /**< Number of fwdtree frames read */
+    uint8 pipe_final;           /**< Whether fwdtree has finished */
+
     int32 best_score; /**< Best Viterbi path score. */
     int32 last_phone_best_score; /**< Best Viterbi path score for last phone. */
     int32 renormalized;
@@ -354,6 +493,23 @@ struct ngram_search_s {
     int32 pip;
     int32 maxwpf;
     int32 maxhmmpf;
+    int32 frate;             /**< Frames per second, for timing */
+
+    /*
+     * Histogram pruning and adaptive beam.  HMM scores are binned
+     * relative to the best score of the previous frame as the HMMs
+     * are evaluated, so the beam needed for a given number of active
+     * HMMs can be read off without going over them again.
+     */
+    int32 score_hist[SCORE_HIST_BINS]; /**< HMMs in each bin */
+    int32 hist_anchor;       /**< Score at the edge of the first bin */
+    int32 hist_shift;        /**< log2 of bin width, or -1 if not binning */
+    int32 targethmmpf;       /**< Active HMMs the adaptive beam aims for, or -1 */
+    float32 targetrtf;       /**< Real-time factor the adaptive beam aims for, or 0 */
+    int32 adapt_hmmpf;       /**< Current target of the adaptive beam */
+    int32 adapt_beam;        /**< Current adaptive beam */
+    int32 adapt_n_frame;     /**< Frames timed since adapt_hmmpf last changed */
+    ptmr_t adapt_perf;       /**< CPU time for those frames */
 };
 typedef struct ngram_search_s ngram_search_t;
 
@@ -367,11 +523,36 @@ ps_search_t *ngram_search_init(const char *name,
                                dict_t *dict,
                                dict2pid_t *d2p);
 
+/**
+ * Initialize the N-Gram search module without changing acmod, so that
+ * it can be done while acmod is in use by another thread.
+ *
+ * Before the search is used, acmod_set_grow() has to be called as it
+ * is by ngram_search_init(), see ngram_search_set_grow().
+ */
+ps_search_t *ngram_search_prepare(const char *name,
+                                  ngram_model_t *lm,
+                                  cmd_ln_t *config,
+                                  acmod_t *acmod,
+                                  dict_t *dict,
+                                  dict2pid_t *d2p);
+
+/**
+ * Make the feature buffer of the search's acmod growable if it does
+ * two-pass search.
+ */
+void ngram_search_set_grow(ps_search_t *search);
+
 /**
  * Finalize the N-Gram search module.
  */
 void ngram_search_free(ps_search_t *ngs);
 
+/**
+ * Make sure the per-frame arrays have room for n_frame frames.
+ */
+void ngram_search_alloc_frames(ngram_search_t *ngs, int n_frame);
+
 /**
  * Record the current frame's index in the backpointer table.
  *
@@ -379,6 +560,24 @@ void ngram_search_free(ps_search_t *ngs);
  */
 int ngram_search_mark_bptable(ngram_search_t *ngs, int frame_idx);
 
+/**
+ * Garbage collect the backpointer table.
+ *
+ * Entries which are not flagged in <code>keep</code>, and are not
+ * ancestors of flagged entries, are removed, and the remaining ones
+ * are renumbered.  Backpointer indices held outside the table must
+ * be remapped by the caller.
+ *
+ * @param keep Array of ngs->bpidx flags, non-zero for entries which
+ *             are referenced from outside the table.  On return,
+ *             contains the new index of each entry, or NO_BP if it
+ *             was removed.
+ * @param n_frame Number of frames of bp_table_idx to renumber.
+ * @return the number of entries removed.
+ */
+int32 ngram_search_compact_bptable(ngram_search_t *ngs, int32 *keep,
+                                   int n_frame);
+
 /**
  * Enter a word in the backpointer table.
  */
@@ -424,6 +623,12 @@ ps_lattice_t *ngram_search_lattice(ps_search_t *search);
  */
 int32 ngram_search_exit_score(ngram_search_t *ngs, bptbl_t *pbe, int rcphone);
 
+/**
+ * Get the language model state following a backpointer entry.
+ */
+void ngram_search_bp_lmstate(ngram_search_t *ngs, bptbl_t *pbe,
+                             ngram_state_t *out_state);
+
 /**
  * Sets the global language model.
  *
@@ -60,6 +60,12 @@
 #define chan_v_eval(chan) hmm_vit_eval(&(chan)->hmm)
 #endif
 
+/*
+ * Whether the words to search are the whole LM vocabulary, rather
+ * than those found by fwdtree search.
+ */
+#define fwdflat_static_vocab(ngs) (!(ngs)->fwdtree && !(ngs)->pipelined)
+
 static void
 ngram_fwdflat_expand_all(ngram_search_t *ngs)
 {
@@ -156,10 +162,15 @@ ngram_fwdflat_init(ngram_search_t *ngs)
     E_INFO("fwdflat: min_ef_width = %d, max_sf_win = %d\n",
            ngs->min_ef_width, ngs->max_sf_win);
 
-    /* No tree-search; pre-build the expansion list, including all LM words. */
+    /* No tree-search in this search; pre-build the expansion list,
+     * including all LM words, unless it is fed by a fwdtree search
+     * running alongside. */
     if (!ngs->fwdtree) {
-        /* Build full expansion list from LM words. */
-        ngram_fwdflat_expand_all(ngs);
+        if (ngs->pipelined)
+            ngs->fwdflat_word_flag = bitvec_alloc(n_words);
+        else
+            /* Build full expansion list from LM words. */
+            ngram_fwdflat_expand_all(ngs);
         /* Allocate single phone words. */
         ngram_fwdflat_allocate_1ph(ngs);
     }
@@ -169,7 +180,7 @@ void
 ngram_fwdflat_deinit(ngram_search_t *ngs)
 {
     double n_speech = (double)ngs->n_tot_frame
-            / cmd_ln_int32_r(ps_search_config(ngs), "-frate");
+            / ngs->frate;
 
     E_INFO("TOTAL fwdflat %.2f CPU %.3f xRT\n",
            ngs->fwdflat_perf.t_tot_cpu,
@@ -184,6 +195,7 @@ ngram_fwdflat_deinit(ngram_search_t *ngs)
     }
     ckd_free(ngs->fwdflat_wordlist);
     bitvec_free(ngs->expand_word_flag);
+    bitvec_free(ngs->fwdflat_word_flag);
     ckd_free(ngs->expand_word_list);
     ckd_free(ngs->frm_wordlist);
 }
@@ -210,8 +222,13 @@ ngram_fwdflat_reinit(ngram_search_t *ngs)
         ckd_free(ngs->word_chan);
         ngs->word_chan = ckd_calloc(dict_size(ps_search_dict(ngs)),
                                     sizeof(*ngs->word_chan));
-        /* Rebuild full expansion list from LM words. */
-        ngram_fwdflat_expand_all(ngs);
+        if (ngs->pipelined) {
+            bitvec_free(ngs->fwdflat_word_flag);
+            ngs->fwdflat_word_flag = bitvec_alloc(n_words);
+        }
+        else
+            /* Rebuild full expansion list from LM words. */
+            ngram_fwdflat_expand_all(ngs);
         /* Allocate single phone words. */
         ngram_fwdflat_allocate_1ph(ngs);
     }
@@ -231,15 +248,29 @@ build_fwdflat_wordlist(ngram_search_t *ngs)
     ps_latnode_t *node, *prevnode, *nextnode;
 
     /* No tree-search, use statically allocated wordlist. */
-    if (!ngs->fwdtree)
+    if (fwdflat_static_vocab(ngs))
+        return;
+
+    /* Pipelined search, the wordlist is built as fwdtree goes. */
+    if (ngs->pipelined) {
+        memset(ngs->frm_wordlist, 0,
+               ngs->n_frame_alloc * sizeof(*ngs->frm_wordlist));
+        bitvec_clear_all(ngs->fwdflat_word_flag, ps_search_n_words(ngs));
+        ngs->n_fwdflat_wordlist = 0;
+        ngs->fwdflat_wordlist[0] = -1;
+        ngs->pipe_bpidx = 0;
+        ngs->pipe_n_frame = 0;
+        ngs->pipe_final = FALSE;
         return;
+    }
 
     memset(ngs->frm_wordlist, 0, ngs->n_frame_alloc * sizeof(*ngs->frm_wordlist));
 
     /* Scan the backpointer table for all active words and record
      * their exit frames. */
-    for (i = 0, bp = ngs->bp_table; i < ngs->bpidx; i++, bp++) {
-        sf = (bp->bp < 0) ? 0 : ngs->bp_table[bp->bp].frame + 1;
+    for (i = 0; i < ngs->bpidx; i++) {
+        bp = ngram_search_bp(ngs, i);
+        sf = (bp->bp < 0) ? 0 : ngram_search_bp(ngs, bp->bp)->frame + 1;
         ef = bp->frame;
         wid = bp->wid;
 
@@ -303,12 +334,12 @@ build_fwdflat_wordlist(ngram_search_t *ngs)
 }
 
 /**
- * Build HMM network for one utterance of fwdflat search.
+ * Build word HMMs for one word in fwdflat search.
  */
 static void
-build_fwdflat_chan(ngram_search_t *ngs)
+build_fwdflat_word_chan(ngram_search_t *ngs, int32 wid)
 {
-    int32 i, wid, p;
+    int32 p;
     root_chan_t *rhmm;
     chan_t *hmm, *prevhmm;
     dict_t *dict;
@@ -317,57 +348,114 @@ build_fwdflat_chan(ngram_search_t *ngs)
     dict = ps_search_dict(ngs);
     d2p = ps_search_dict2pid(ngs);
 
-    /* Build word HMMs for each word in the lattice. */
-    for (i = 0; ngs->fwdflat_wordlist[i] >= 0; i++) {
-        wid = ngs->fwdflat_wordlist[i];
-
-        /* Single-phone words are permanently allocated */
-        if (dict_is_single_phone(dict, wid))
-            continue;
+    /* Single-phone words are permanently allocated */
+    if (dict_is_single_phone(dict, wid))
+        return;
 
-        assert(ngs->word_chan[wid] == NULL);
-
-        /* Multiplex root HMM for first phone (one root per word, flat
-         * lexicon).  diphone is irrelevant here, for the time being,
-         * at least. */
-        rhmm = listelem_malloc(ngs->root_chan_alloc);
-        rhmm->ci2phone = dict_second_phone(dict, wid);
-        rhmm->ciphone = dict_first_phone(dict, wid);
-        rhmm->next = NULL;
-        hmm_init(ngs->hmmctx, &rhmm->hmm, TRUE,
-                 bin_mdef_pid2ssid(ps_search_acmod(ngs)->mdef, rhmm->ciphone),
-                 bin_mdef_pid2tmatid(ps_search_acmod(ngs)->mdef, rhmm->ciphone));
-
-        /* HMMs for word-internal phones */
-        prevhmm = NULL;
-        for (p = 1; p < dict_pronlen(dict, wid) - 1; p++) {
-            hmm = listelem_malloc(ngs->chan_alloc);
-            hmm->ciphone = dict_pron(dict, wid, p);
-            hmm->info.rc_id = (p == dict_pronlen(dict, wid) - 1) ? 0 : -1;
-            hmm->next = NULL;
-            hmm_init(ngs->hmmctx, &hmm->hmm, FALSE,
-                     dict2pid_internal(d2p,wid,p), 
+    assert(ngs->word_chan[wid] == NULL);
+
+    /* Multiplex root HMM for first phone (one root per word, flat
+     * lexicon).  diphone is irrelevant here, for the time being,
+     * at least. */
+    rhmm = listelem_malloc(ngs->root_chan_alloc);
+    rhmm->ci2phone = dict_second_phone(dict, wid);
+    rhmm->ciphone = dict_first_phone(dict, wid);
+    rhmm->next = NULL;
+    hmm_init(ngs->hmmctx, &rhmm->hmm, TRUE,
+             bin_mdef_pid2ssid(ps_search_acmod(ngs)->mdef, rhmm->ciphone),
+             bin_mdef_pid2tmatid(ps_search_acmod(ngs)->mdef, rhmm->ciphone));
+
+    /* HMMs for word-internal phones */
+    prevhmm = NULL;
+    for (p = 1; p < dict_pronlen(dict, wid) - 1; p++) {
+        hmm = listelem_malloc(ngs->chan_alloc);
+        hmm->ciphone = dict_pron(dict, wid, p);
+        hmm->info.rc_id = (p == dict_pronlen(dict, wid) - 1) ? 0 : -1;
+        hmm->next = NULL;
+        hmm_init(ngs->hmmctx, &hmm->hmm, FALSE,
+                 dict2pid_internal(d2p,wid,p), 
 		     bin_mdef_pid2tmatid(ps_search_acmod(ngs)->mdef, hmm->ciphone));
 
-            if (prevhmm)
-                prevhmm->next = hmm;
-            else
-                rhmm->next = hmm;
+        if (prevhmm)
+            prevhmm->next = hmm;
+        else
+            rhmm->next = hmm;
 
-            prevhmm = hmm;
-        }
+        prevhmm = hmm;
+    }
 
-        /* Right-context phones */
-        ngram_search_alloc_all_rc(ngs, wid);
+    /* Right-context phones */
+    ngram_search_alloc_all_rc(ngs, wid);
 
-        /* Link in just allocated right-context phones */
-        if (prevhmm)
-            prevhmm->next = ngs->word_chan[wid];
-        else
-            rhmm->next = ngs->word_chan[wid];
-        ngs->word_chan[wid] = (chan_t *) rhmm;
+    /* Link in just allocated right-context phones */
+    if (prevhmm)
+        prevhmm->next = ngs->word_chan[wid];
+    else
+        rhmm->next = ngs->word_chan[wid];
+    ngs->word_chan[wid] = (chan_t *) rhmm;
+}
+
+/**
+ * Build HMM network for one utterance of fwdflat search.
+ */
+static void
+build_fwdflat_chan(ngram_search_t *ngs)
+{
+    int32 i;
+
+    /* Build word HMMs for each word in the lattice. */
+    for (i = 0; ngs->fwdflat_wordlist[i] >= 0; i++)
+        build_fwdflat_word_chan(ngs, ngs->fwdflat_wordlist[i]);
+}
+
+/**
+ * Add a word exit from fwdtree search to the word list of a
+ * pipelined fwdflat search, creating its HMMs if it is new.
+ */
+static void
+add_fwdflat_word(ngram_search_t *ngs, ngram_search_t *tree, bptbl_t *bp)
+{
+    ps_latnode_t *node;
+    int32 sf, wid;
+
+    wid = bp->wid;
+    if (!ngram_model_set_known_wid(ngs->lmset,
+                                   dict_basewid(ps_search_dict(ngs), wid)))
+        return;
+    sf = (bp->bp < 0) ? 0 : ngram_search_bp(tree, bp->bp)->frame + 1;
+
+    for (node = ngs->frm_wordlist[sf]; node && (node->wid != wid);
+         node = node->next);
+    if (node)
+        node->lef = bp->frame;
+    else {
+        node = listelem_malloc(ngs->latnode_alloc);
+        node->wid = wid;
+        node->fef = node->lef = bp->frame;
+        node->next = ngs->frm_wordlist[sf];
+        ngs->frm_wordlist[sf] = node;
     }
 
+    if (!bitvec_is_set(ngs->fwdflat_word_flag, wid)) {
+        bitvec_set(ngs->fwdflat_word_flag, wid);
+        ngs->fwdflat_wordlist[ngs->n_fwdflat_wordlist++] = wid;
+        ngs->fwdflat_wordlist[ngs->n_fwdflat_wordlist] = -1;
+        build_fwdflat_word_chan(ngs, wid);
+    }
+}
+
+/**
+ * Whether a word in a pipelined search has shown enough end points to
+ * be searched yet (see build_fwdflat_wordlist()).
+ */
+static int
+fwdflat_likely_word(ngram_search_t *ngs, ps_latnode_t *node)
+{
+    if (node->lef - node->fef < ngs->min_ef_width)
+        return FALSE;
+    if (node->wid == ps_search_finish_wid(ngs))
+        return ngs->pipe_final && node->lef == ngs->pipe_n_frame - 1;
+    return TRUE;
 }
 
 void
@@ -383,6 +471,8 @@ ngram_fwdflat_start(ngram_search_t *ngs)
 
     ngs->bpidx = 0;
     ngs->bss_head = 0;
+    ngs->hyp_wid = BAD_S3WID;
+    ngs->n_seg_cache = -1;
 
     for (i = 0; i < ps_search_n_words(ngs); i++)
         ngs->word_lat_idx[i] = NO_BP;
@@ -414,6 +504,10 @@ ngram_fwdflat_start(ngram_search_t *ngs)
     ngs->st.n_fwdflat_words = 0;
     ngs->st.n_fwdflat_word_transition = 0;
     ngs->st.n_senone_active_utt = 0;
+
+    /* A pipelined search only counts the time spent in it. */
+    if (ngs->pipelined)
+        ptmr_stop(&ngs->fwdflat_perf);
 }
 
 static void
@@ -615,7 +709,7 @@ get_expand_wordlist(ngram_search_t *ngs, int32 frm, int32 win)
     int32 f, sf, ef;
     ps_latnode_t *node;
 
-    if (!ngs->fwdtree) {
+    if (fwdflat_static_vocab(ngs)) {
         ngs->st.n_fwdflat_word_transition += ngs->n_expand_words;
         return;
     }
@@ -624,7 +718,11 @@ get_expand_wordlist(ngram_search_t *ngs, int32 frm, int32 win)
     if (sf < 0)
         sf = 0;
     ef = frm + win;
-    if (ef > ngs->n_frame)
+    if (ngs->pipelined) {
+        if (ef > ngs->pipe_n_frame)
+            ef = ngs->pipe_n_frame;
+    }
+    else if (ef > ngs->n_frame)
         ef = ngs->n_frame;
 
     bitvec_clear_all(ngs->expand_word_flag, ps_search_n_words(ngs));
@@ -632,6 +730,8 @@ get_expand_wordlist(ngram_search_t *ngs, int32 frm, int32 win)
 
     for (f = sf; f < ef; f++) {
         for (node = ngs->frm_wordlist[f]; node; node = node->next) {
+            if (ngs->pipelined && !fwdflat_likely_word(ngs, node))
+                continue;
             if (!bitvec_is_set(ngs->expand_word_flag, node->wid)) {
                 ngs->expand_word_list[ngs->n_expand_words++] = node->wid;
                 bitvec_set(ngs->expand_word_flag, node->wid);
@@ -669,9 +769,10 @@ fwdflat_word_transition(ngram_search_t *ngs, int frame_idx)
     /* Scan words exited in current frame */
     for (b = ngs->bp_table_idx[cf]; b < ngs->bpidx; b++) {
         xwdssid_t *rssid;
+        ngram_state_t lmstate;
         int32 silscore;
 
-        bp = ngs->bp_table + b;
+        bp = ngram_search_bp(ngs, b);
         ngs->word_lat_idx[bp->wid] = NO_BP;
 
         if (bp->wid == ps_search_finish_wid(ngs))
@@ -680,11 +781,12 @@ fwdflat_word_transition(ngram_search_t *ngs, int frame_idx)
         /* DICT2PID location */
         /* Get the mapping from right context phone ID to index in the
          * right context table and the bscore_stack. */
-        rcss = ngs->bscore_stack + bp->s_idx;
+        rcss = (bp->s_idx == -1) ? NULL : ngram_search_rcss(ngs, bp);
         if (bp->last2_phone == -1)
             rssid = NULL;
         else
             rssid = dict2pid_rssid(d2p, bp->last_phone, bp->last2_phone);
+        ngram_search_bp_lmstate(ngs, bp, &lmstate);
 
         /* Transition to all successor words. */
         for (i = 0; ngs->expand_word_list[i] >= 0; i++) {
@@ -702,11 +804,10 @@ fwdflat_word_transition(ngram_search_t *ngs, int frame_idx)
                 continue;
             /* FIXME: Floating point... */
             newscore += lwf
-                * (ngram_tg_score(ngs->lmset,
-                                  dict_basewid(dict, w),
-                                  bp->real_wid,
-                                  bp->prev_real_wid,
-                                  &n_used) >> SENSCR_SHIFT);
+                * (ngram_state_score(ngs->lmset, &lmstate,
+                                     dict_basewid(dict, w),
+                                     NULL, &n_used) >> SENSCR_SHIFT);
+            ++ps_search_acmod(ngs)->stats.n_lm_query;
             newscore += pip;
 
             /* Enter the next word */
@@ -815,8 +916,9 @@ fwdflat_renormalize_scores(ngram_search_t *ngs, int frame_idx, int32 norm)
 int
 ngram_fwdflat_search(ngram_search_t *ngs, int frame_idx)
 {
+    acmod_t *acmod = ps_search_acmod(ngs);
     int16 const *senscr;
-    int32 nf, i, j;
+    int32 nf, i, j, n_hmm_eval;
     int32 *nawl;
 
     /* Activate our HMMs for the current frame if need be. */
@@ -845,11 +947,17 @@ ngram_fwdflat_search(ngram_search_t *ngs, int frame_idx)
     hmm_context_set_senscore(ngs->hmmctx, senscr);
 
     /* Evaluate HMMs */
+    acmod_stage_start(acmod, PS_STAGE_HMM);
+    n_hmm_eval = ngs->st.n_fwdflat_chan;
     fwdflat_eval_chan(ngs, frame_idx);
+    acmod->stats.n_hmm_eval += ngs->st.n_fwdflat_chan - n_hmm_eval;
     /* Prune HMMs and do phone transitions. */
     fwdflat_prune_chan(ngs, frame_idx);
+    acmod_stage_stop(acmod, PS_STAGE_HMM);
     /* Do word transitions. */
+    acmod_stage_start(acmod, PS_STAGE_WORD);
     fwdflat_word_transition(ngs, frame_idx);
+    acmod_stage_stop(acmod, PS_STAGE_WORD);
 
     /* Create next active word list, skip fillers */
     nf = frame_idx + 1;
@@ -876,6 +984,40 @@ ngram_fwdflat_search(ngram_search_t *ngs, int frame_idx)
     return 1;
 }
 
+int
+ngram_fwdflat_pipeline(ngram_search_t *ngs, ngram_search_t *tree, int final)
+{
+    int32 i, end_frame;
+
+    ptmr_start(&ngs->fwdflat_perf);
+
+    /* Add the word exits in the new fwdtree frames to the word list. */
+    ngram_search_alloc_frames(ngs, tree->n_frame + 1);
+    for (i = ngs->pipe_bpidx; i < tree->bpidx; ++i)
+        add_fwdflat_word(ngs, tree, ngram_search_bp(tree, i));
+    ngs->pipe_bpidx = tree->bpidx;
+    ngs->pipe_n_frame = tree->n_frame;
+    ngs->pipe_final = final;
+
+    /* Search the frames which are far enough behind fwdtree that
+     * their successor words have been found. */
+    end_frame = final ? tree->n_frame : tree->n_frame - ngs->fwdflat_lag;
+    while (ngs->n_frame < end_frame) {
+        int nfr;
+
+        if ((nfr = ngram_fwdflat_search(ngs, ngs->n_frame)) < 0) {
+            ptmr_stop(&ngs->fwdflat_perf);
+            return nfr;
+        }
+        /* Recognition failed, nothing more to do. */
+        if (nfr == 0)
+            break;
+    }
+
+    ptmr_stop(&ngs->fwdflat_perf);
+    return 0;
+}
+
 /**
  * Destroy wordlist from the current utterance.
  */
@@ -883,12 +1025,13 @@ static void
 destroy_fwdflat_wordlist(ngram_search_t *ngs)
 {
     ps_latnode_t *node, *tnode;
-    int32 f;
+    int32 f, n_frame;
 
-    if (!ngs->fwdtree)
+    if (fwdflat_static_vocab(ngs))
         return;
 
-    for (f = 0; f < ngs->n_frame; f++) {
+    n_frame = ngs->pipelined ? ngs->pipe_n_frame : ngs->n_frame;
+    for (f = 0; f < n_frame; f++) {
         for (node = ngs->frm_wordlist[f]; node; node = tnode) {
             tnode = node->next;
             listelem_free(ngs->latnode_alloc, node);
@@ -939,11 +1082,12 @@ ngram_fwdflat_finish(ngram_search_t *ngs)
     /* Add a mark in the backpointer table for one past the final frame. */
     ngram_search_mark_bptable(ngs, cf);
 
-    ptmr_stop(&ngs->fwdflat_perf);
+    if (!ngs->pipelined)
+        ptmr_stop(&ngs->fwdflat_perf);
     /* Print out some statistics. */
     if (cf > 0) {
         double n_speech = (double)(cf + 1)
-            / cmd_ln_int32_r(ps_search_config(ngs), "-frate");
+            / ngs->frate;
         E_INFO("%8d words recognized (%d/fr)\n",
                ngs->bpidx, (ngs->bpidx + (cf >> 1)) / (cf + 1));
         E_INFO("%8d senones evaluated (%d/fr)\n", ngs->st.n_senone_active_utt,
@@ -72,6 +72,22 @@ void ngram_fwdflat_start(ngram_search_t *ngs);
  */
 int ngram_fwdflat_search(ngram_search_t *ngs, int frame_idx);
 
+/**
+ * Advance a pipelined fwdflat search.
+ *
+ * Reads the word exits which fwdtree search has added to its
+ * backpointer table since the last call, and searches the frames that
+ * are at least fwdflat_lag frames behind it.
+ *
+ * @param ngs Pipelined fwdflat search.
+ * @param tree Fwdtree search feeding it.
+ * @param final Whether fwdtree has finished the utterance, in which
+ *              case all remaining frames are searched.
+ * @return 0, or <0 for error.
+ */
+int ngram_fwdflat_pipeline(ngram_search_t *ngs, ngram_search_t *tree,
+                           int final);
+
 /**
  * Finish fwdflat decoding for an utterance.
  */
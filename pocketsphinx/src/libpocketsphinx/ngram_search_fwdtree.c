@@ -60,6 +60,134 @@
 #define chan_v_eval(chan) hmm_vit_eval(&(chan)->hmm)
 #endif
 
+/* Frames between adjustments of the adaptive beam for -targetrtf. */
+#define ADAPT_RTF_FRAMES 10
+/* Fewest HMMs the adaptive beam will aim for. */
+#define ADAPT_MIN_HMMPF 100
+
+/* Best lookahead score an interior node can have. */
+#define LMLA_WORST (-32767)
+
+/*
+ * Allocate the language model lookahead cache for the current search
+ * tree, if lookahead is enabled.
+ */
+static void
+lmla_init(ngram_search_t *ngs)
+{
+    int32 n, i;
+
+    if (ngs->lmla_order <= 0)
+        return;
+    n = cmd_ln_int32_r(ps_search_config(ngs), "-lmlacache");
+    for (ngs->n_lmla = 1; ngs->n_lmla < n; ngs->n_lmla <<= 1)
+        ;
+    ngs->lmla_hist = ckd_calloc(ngs->n_lmla * 2, sizeof(*ngs->lmla_hist));
+    /* No history is ever -2, so all entries start out invalid. */
+    for (i = 0; i < ngs->n_lmla * 2; ++i)
+        ngs->lmla_hist[i] = -2;
+    ngs->lmla_score = ckd_calloc_2d(ngs->n_lmla,
+                                    ngs->n_root_chan + ngs->n_nonroot_chan + 1,
+                                    sizeof(**ngs->lmla_score));
+    E_INFO("LM lookahead of order %d, cache of %d histories\n",
+           ngs->lmla_order, ngs->n_lmla);
+}
+
+static void
+lmla_free(ngram_search_t *ngs)
+{
+    ckd_free(ngs->lmla_hist);
+    ngs->lmla_hist = NULL;
+    if (ngs->lmla_score)
+        ckd_free_2d(ngs->lmla_score);
+    ngs->lmla_score = NULL;
+    ngs->n_lmla = 0;
+}
+
+/* Best LM score, given hist, of a word in a homophone set. */
+static int32
+lmla_best_word(ngram_search_t *ngs, int32 w, int32 *hist, int32 n_hist)
+{
+    dict_t *dict = ps_search_dict(ngs);
+    int32 best, score, n_used;
+
+    best = LMLA_WORST;
+    for (; w >= 0; w = ngs->lextree->homophone_set[w]) {
+        score = ngram_ng_score(ngs->lmset, dict_basewid(dict, w),
+                               hist, n_hist, &n_used) >> SENSCR_SHIFT;
+        ++ps_search_acmod(ngs)->stats.n_lm_query;
+        if (score > best)
+            best = score;
+    }
+    return best;
+}
+
+/*
+ * Compute the lookahead for a history: the LM score of each word at
+ * the end of the tree, then the best of them for each node, from the
+ * leaves up.  Since nodes come in breadth-first order, the children
+ * of a node are all done before the node itself.
+ */
+static void
+lmla_compute(ngram_search_t *ngs, int16 *la, int32 w1, int32 w2)
+{
+    lextree_t *lt = ngs->lextree;
+    int16 *nla = la + lt->n_root;
+    int32 hist[2], n_hist, i, c, best;
+
+    hist[0] = w1;
+    hist[1] = w2;
+    n_hist = (w1 < 0) ? 0 : (w2 < 0) ? 1 : 2;
+    for (i = lt->n_node - 1; i >= 0; --i) {
+        lextree_node_t *ln = &lt->node[i];
+
+        best = lmla_best_word(ngs, ln->penult_phn_wid, hist, n_hist);
+        for (c = ln->first_child; c < ln->first_child + ln->n_child; ++c)
+            if (nla[c] > best)
+                best = nla[c];
+        nla[i] = best;
+    }
+    for (i = 0; i < lt->n_root; ++i) {
+        lextree_root_t *lr = &lt->root[i];
+
+        best = lmla_best_word(ngs, lr->penult_phn_wid, hist, n_hist);
+        for (c = lr->first_child; c < lr->first_child + lr->n_child; ++c)
+            if (nla[c] > best)
+                best = nla[c];
+        la[i] = best;
+    }
+}
+
+/*
+ * Get the lookahead for the history of backpointer bp, indexed by
+ * root channel, then by n_root_chan + interior node.
+ */
+static int16 const *
+lmla_lookup(ngram_search_t *ngs, int32 bp)
+{
+    int32 w1, w2, slot;
+    int32 *hist;
+
+    w1 = w2 = -1;
+    if (bp != NO_BP && ngs->lmla_order >= 2) {
+        w1 = ngram_search_bp(ngs, bp)->real_wid;
+        if (ngs->lmla_order >= 3)
+            w2 = ngram_search_bp(ngs, bp)->prev_real_wid;
+    }
+    slot = ((uint32)w1 * 0x9e3779b1U + (uint32)w2) & (ngs->n_lmla - 1);
+    hist = ngs->lmla_hist + slot * 2;
+    if (hist[0] == w1 && hist[1] == w2) {
+        ++ngs->st.n_lmla_hit;
+    }
+    else {
+        lmla_compute(ngs, ngs->lmla_score[slot], w1, w2);
+        hist[0] = w1;
+        hist[1] = w2;
+        ++ngs->st.n_lmla_miss;
+    }
+    return ngs->lmla_score[slot];
+}
+
 /*
  * Allocate that part of the search channel tree structure that is independent of the
  * LM in use.
@@ -74,7 +202,6 @@ init_search_tree(ngram_search_t *ngs)
     E_INFO("Initializing search tree\n");
 
     n_words = ps_search_n_words(ngs);
-    ngs->homophone_set = ckd_calloc(n_words, sizeof(*ngs->homophone_set));
 
     /* Find #single phone words, and #unique first diphones (#root channels) in dict. */
     ndiph = 0;
@@ -161,6 +288,155 @@ init_nonroot_chan(ngram_search_t *ngs, chan_t * hmm, int32 ph, int32 ci, int32 t
     hmm_init(ngs->hmmctx, &hmm->hmm, FALSE, ph, tmatid);
 }
 
+static void
+lextree_free(lextree_t *lt)
+{
+    if (lt == NULL)
+        return;
+    if (--lt->refcount > 0)
+        return;
+    ckd_free(lt->root);
+    ckd_free(lt->node);
+    ckd_free(lt->homophone_set);
+    ckd_free(lt);
+}
+
+/*
+ * Move a list of siblings, which is freed, to lt->node + n, returning
+ * the new end.  The channels are kept in src so that their children
+ * can be found.
+ */
+static int32
+pack_siblings(ngram_search_t *ngs, chan_t *hmm, lextree_t *lt,
+              chan_t **src, int32 n)
+{
+    for (; hmm; hmm = hmm->alt, ++n) {
+        lt->node[n].ssid = hmm_nonmpx_ssid(&hmm->hmm);
+        lt->node[n].tmatid = hmm_tmatid(&hmm->hmm);
+        lt->node[n].ciphone = hmm->ciphone;
+        lt->node[n].penult_phn_wid = hmm->info.penult_phn_wid;
+        src[n] = hmm;
+    }
+    return n;
+}
+
+/*
+ * Move the search tree just built from channels into a new lexicon
+ * tree, in breadth-first order, so that siblings, which are evaluated
+ * and pruned together, are next to each other in memory.
+ */
+static lextree_t *
+pack_search_channels(ngram_search_t *ngs, int32 *homophone_set)
+{
+    lextree_t *lt;
+    chan_t **src;
+    int32 i, n;
+
+    lt = ckd_calloc(1, sizeof(*lt));
+    lt->refcount = 1;
+    lt->mdef = ps_search_acmod(ngs)->mdef;
+    lt->homophone_set = homophone_set;
+    lt->n_words = ps_search_n_words(ngs);
+    lt->n_root = ngs->n_root_chan;
+    lt->root = ckd_calloc(lt->n_root + 1, sizeof(*lt->root));
+    lt->n_node = ngs->n_nonroot_chan;
+    lt->node = ckd_calloc(lt->n_node + 1, sizeof(*lt->node));
+    src = ckd_calloc(lt->n_node + 1, sizeof(*src));
+
+    /* Children of the roots come first, then those of each packed
+     * node in turn, so the array is its own queue. */
+    n = 0;
+    for (i = 0; i < ngs->n_root_chan; ++i) {
+        root_chan_t *rhmm = &ngs->root_chan[i];
+
+        lt->root[i].ssid = hmm_mpx_ssid(&rhmm->hmm, 0);
+        lt->root[i].tmatid = hmm_tmatid(&rhmm->hmm);
+        lt->root[i].ciphone = rhmm->ciphone;
+        lt->root[i].ci2phone = rhmm->ci2phone;
+        lt->root[i].penult_phn_wid = rhmm->penult_phn_wid;
+        lt->root[i].first_child = n;
+        n = pack_siblings(ngs, rhmm->next, lt, src, n);
+        lt->root[i].n_child = n - lt->root[i].first_child;
+        rhmm->next = NULL;
+    }
+    for (i = 0; i < n; ++i) {
+        lt->node[i].first_child = n;
+        n = pack_siblings(ngs, src[i]->next, lt, src, n);
+        lt->node[i].n_child = n - lt->node[i].first_child;
+    }
+    assert(n == lt->n_node);
+
+    for (i = 0; i < n; ++i) {
+        hmm_deinit(&src[i]->hmm);
+        listelem_free(ngs->chan_alloc, src[i]);
+    }
+    ckd_free(src);
+    return lt;
+}
+
+/*
+ * Set up the root channels and the HMMs of interior nodes for the
+ * lexicon tree.
+ */
+static void
+use_search_tree(ngram_search_t *ngs, lextree_t *lt)
+{
+    int32 i;
+
+    ngs->lextree = lt;
+    ngs->n_root_chan = lt->n_root;
+    for (i = 0; i < lt->n_root; ++i) {
+        root_chan_t *rhmm = &ngs->root_chan[i];
+
+        hmm_tmatid(&rhmm->hmm) = lt->root[i].tmatid;
+        hmm_mpx_ssid(&rhmm->hmm, 0) = lt->root[i].ssid;
+        rhmm->ciphone = lt->root[i].ciphone;
+        rhmm->ci2phone = lt->root[i].ci2phone;
+        rhmm->penult_phn_wid = lt->root[i].penult_phn_wid;
+    }
+    ngs->n_nonroot_chan = lt->n_node;
+    ngs->tree_chan = ckd_calloc(lt->n_node + 1, sizeof(*ngs->tree_chan));
+    ngs->n_tree_chan = 0;
+}
+
+/* Get the HMM for an interior node, which is about to be entered. */
+static tree_chan_t *
+activate_tree_chan(ngram_search_t *ngs, int32 node)
+{
+    lextree_node_t *ln = &ngs->lextree->node[node];
+    tree_chan_t *hmm;
+
+    if ((hmm = ngs->tree_chan[node]) != NULL)
+        return hmm;
+    hmm = listelem_malloc(ngs->tree_chan_alloc);
+    hmm_init(ngs->hmmctx, &hmm->hmm, FALSE, ln->ssid, ln->tmatid);
+    hmm->node = node;
+    ngs->tree_chan[node] = hmm;
+    ++ngs->n_tree_chan;
+    return hmm;
+}
+
+/* Free the HMM for an interior node which is no longer active. */
+static void
+deactivate_tree_chan(ngram_search_t *ngs, tree_chan_t *hmm)
+{
+    ngs->tree_chan[hmm->node] = NULL;
+    hmm_deinit(&hmm->hmm);
+    listelem_free(ngs->tree_chan_alloc, hmm);
+    --ngs->n_tree_chan;
+}
+
+/* Free the HMMs of all interior nodes. */
+static void
+deactivate_tree_chans(ngram_search_t *ngs)
+{
+    int32 i;
+
+    for (i = 0; ngs->n_tree_chan > 0 && i < ngs->n_nonroot_chan; ++i)
+        if (ngs->tree_chan[i])
+            deactivate_tree_chan(ngs, ngs->tree_chan[i]);
+}
+
 /*
  * Allocate and initialize search channel-tree structure.
  * At this point, all the root-channels have been allocated and partly initialized
@@ -177,7 +453,7 @@ create_search_channels(ngram_search_t *ngs)
     chan_t *hmm;
     root_chan_t *rhmm;
     int32 w, i, j, p, ph, tmatid;
-    int32 n_words;
+    int32 n_words, *homophone_set;
     dict_t *dict = ps_search_dict(ngs);
     dict2pid_t *d2p = ps_search_dict2pid(ngs);
 
@@ -185,8 +461,9 @@ create_search_channels(ngram_search_t *ngs)
 
     E_INFO("Creating search channels\n");
 
+    homophone_set = ckd_calloc(n_words, sizeof(*homophone_set));
     for (w = 0; w < n_words; w++)
-        ngs->homophone_set[w] = -1;
+        homophone_set[w] = -1;
 
     ngs->n_1ph_LMwords = 0;
     ngs->n_root_chan = 0;
@@ -236,8 +513,8 @@ create_search_channels(ngram_search_t *ngs)
             if ((j = rhmm->penult_phn_wid) < 0)
                 rhmm->penult_phn_wid = w;
             else {
-                for (; ngs->homophone_set[j] >= 0; j = ngs->homophone_set[j]);
-                ngs->homophone_set[j] = w;
+                for (; homophone_set[j] >= 0; j = homophone_set[j]);
+                homophone_set[j] = w;
             }
         }
         else {
@@ -294,8 +571,8 @@ create_search_channels(ngram_search_t *ngs)
             if ((j = hmm->info.penult_phn_wid) < 0)
                 hmm->info.penult_phn_wid = w;
             else {
-                for (; ngs->homophone_set[j] >= 0; j = ngs->homophone_set[j]);
-                ngs->homophone_set[j] = w;
+                for (; homophone_set[j] >= 0; j = homophone_set[j]);
+                homophone_set[j] = w;
             }
         }
     }
@@ -317,6 +594,8 @@ create_search_channels(ngram_search_t *ngs)
         ngs->single_phone_wid[ngs->n_1ph_words++] = w;
     }
 
+    use_search_tree(ngs, pack_search_channels(ngs, homophone_set));
+
     if (ngs->n_nonroot_chan >= ngs->max_nonroot_chan) {
         /* Give some room for channels for new words added dynamically at run time */
         ngs->max_nonroot_chan = ngs->n_nonroot_chan + 128;
@@ -336,41 +615,22 @@ create_search_channels(ngram_search_t *ngs)
 	E_ERROR("No word from the language model has pronunciation in the dictionary\n");
 }
 
-static void
-reinit_search_subtree(ngram_search_t *ngs, chan_t * hmm)
-{
-    chan_t *child, *sibling;
-
-    /* First free all children under hmm */
-    for (child = hmm->next; child; child = sibling) {
-        sibling = child->alt;
-        reinit_search_subtree(ngs, child);
-    }
-
-    /* Now free hmm */
-    hmm_deinit(&hmm->hmm);
-    listelem_free(ngs->chan_alloc, hmm);
-}
-
 /*
- * Delete search tree by freeing all interior channels within search tree and
- * restoring root channel state to the init state (i.e., just after init_search_tree()).
+ * Release the search tree and the HMMs of its interior nodes, leaving
+ * the root channels as they were after init_search_tree().
  */
 static void
 reinit_search_tree(ngram_search_t *ngs)
 {
     int32 i;
-    chan_t *hmm, *sibling;
 
+    if (ngs->tree_chan)
+        deactivate_tree_chans(ngs);
+    ckd_free(ngs->tree_chan);
+    ngs->tree_chan = NULL;
+    lextree_free(ngs->lextree);
+    ngs->lextree = NULL;
     for (i = 0; i < ngs->n_root_chan; i++) {
-        hmm = ngs->root_chan[i].next;
-
-        while (hmm) {
-            sibling = hmm->alt;
-            reinit_search_subtree(ngs, hmm);
-            hmm = sibling;
-        }
-
         ngs->root_chan[i].penult_phn_wid = -1;
         ngs->root_chan[i].next = NULL;
     }
@@ -385,8 +645,81 @@ ngram_fwdtree_init(ngram_search_t *ngs)
                                 sizeof(*ngs->bestbp_rc));
     ngs->lastphn_cand = ckd_calloc(ps_search_n_words(ngs),
                                    sizeof(*ngs->lastphn_cand));
+    ngs->tree_chan_alloc = listelem_alloc_init(sizeof(tree_chan_t));
+    ngs->lmla_order = cmd_ln_int32_r(ps_search_config(ngs), "-lmla");
     init_search_tree(ngs);
     create_search_channels(ngs);
+    lmla_init(ngs);
+}
+
+void
+ngram_fwdtree_clone(ngram_search_t *ngs, ngram_search_t *other)
+{
+    ngs->bestbp_rc = ckd_calloc(bin_mdef_n_ciphone(ps_search_acmod(ngs)->mdef),
+                                sizeof(*ngs->bestbp_rc));
+    ngs->lastphn_cand = ckd_calloc(ps_search_n_words(ngs),
+                                   sizeof(*ngs->lastphn_cand));
+    ngs->tree_chan_alloc = listelem_alloc_init(sizeof(tree_chan_t));
+    ngs->lmla_order = other->lmla_order;
+    init_search_tree(ngs);
+    /* What create_search_channels() found out about the words. */
+    ngs->n_1ph_LMwords = other->n_1ph_LMwords;
+    ngs->n_1ph_words = other->n_1ph_words;
+    memcpy(ngs->single_phone_wid, other->single_phone_wid,
+           ngs->n_1ph_words * sizeof(*ngs->single_phone_wid));
+    ++other->lextree->refcount;
+    use_search_tree(ngs, other->lextree);
+    ngs->max_nonroot_chan = other->max_nonroot_chan;
+    ngs->active_chan_list = ckd_calloc_2d(2, ngs->max_nonroot_chan,
+                                          sizeof(**ngs->active_chan_list));
+    lmla_init(ngs);
+}
+
+int
+ngram_fwdtree_share(ngram_search_t *ngs, ngram_search_t *other)
+{
+    lextree_t *lt = ngs->lextree, *olt = other->lextree;
+    int32 i;
+
+    if (lt == NULL || olt == NULL)
+        return FALSE;
+    if (lt == olt)
+        return TRUE;
+    /* The tree was built from the same kind of inputs, so just
+     * compare the results. */
+    if (lt->mdef != olt->mdef
+        || lt->n_root != olt->n_root
+        || lt->n_node != olt->n_node
+        || lt->n_words != olt->n_words
+        || memcmp(lt->homophone_set, olt->homophone_set,
+                  lt->n_words * sizeof(*lt->homophone_set)))
+        return FALSE;
+    for (i = 0; i < lt->n_root; ++i) {
+        lextree_root_t *r = &lt->root[i], *or = &olt->root[i];
+        if (r->first_child != or->first_child
+            || r->n_child != or->n_child
+            || r->penult_phn_wid != or->penult_phn_wid
+            || r->ssid != or->ssid
+            || r->tmatid != or->tmatid
+            || r->ciphone != or->ciphone
+            || r->ci2phone != or->ci2phone)
+            return FALSE;
+    }
+    for (i = 0; i < lt->n_node; ++i) {
+        lextree_node_t *n = &lt->node[i], *on = &olt->node[i];
+        if (n->first_child != on->first_child
+            || n->n_child != on->n_child
+            || n->penult_phn_wid != on->penult_phn_wid
+            || n->ssid != on->ssid
+            || n->tmatid != on->tmatid
+            || n->ciphone != on->ciphone)
+            return FALSE;
+    }
+    E_INFO("Sharing search tree of %d nodes\n", lt->n_node);
+    lextree_free(lt);
+    ++olt->refcount;
+    ngs->lextree = olt;
+    return TRUE;
 }
 
 static void
@@ -414,15 +747,13 @@ deinit_search_tree(ngram_search_t *ngs)
     ngs->root_chan = NULL;
     ckd_free(ngs->single_phone_wid);
     ngs->single_phone_wid = NULL;
-    ckd_free(ngs->homophone_set);
-    ngs->homophone_set = NULL;
 }
 
 void
 ngram_fwdtree_deinit(ngram_search_t *ngs)
 {
     double n_speech = (double)ngs->n_tot_frame
-            / cmd_ln_int32_r(ps_search_config(ngs), "-frate");
+            / ngs->frate;
 
     E_INFO("TOTAL fwdtree %.2f CPU %.3f xRT\n",
            ngs->fwdtree_perf.t_tot_cpu,
@@ -445,6 +776,9 @@ ngram_fwdtree_deinit(ngram_search_t *ngs)
     ngs->bestbp_rc = NULL;
     ckd_free(ngs->lastphn_cand);
     ngs->lastphn_cand = NULL;
+    listelem_alloc_free(ngs->tree_chan_alloc);
+    ngs->tree_chan_alloc = NULL;
+    lmla_free(ngs);
 }
 
 int
@@ -461,9 +795,11 @@ ngram_fwdtree_reinit(ngram_search_t *ngs)
     ckd_free(ngs->word_chan);
     ngs->word_chan = ckd_calloc(ps_search_n_words(ngs),
                                 sizeof(*ngs->word_chan));
-    /* Rebuild the search tree. */
+    /* Rebuild the search tree, which the LM lookahead depends on. */
     init_search_tree(ngs);
     create_search_channels(ngs);
+    lmla_free(ngs);
+    lmla_init(ngs);
     return 0;
 }
 
@@ -484,12 +820,16 @@ ngram_fwdtree_start(ngram_search_t *ngs)
     /* Reset backpointer table. */
     ngs->bpidx = 0;
     ngs->bss_head = 0;
+    ngs->hyp_wid = BAD_S3WID;
+    ngs->n_seg_cache = -1;
 
     /* Reset word lattice. */
     for (i = 0; i < n_words; ++i)
         ngs->word_lat_idx[i] = NO_BP;
 
-    /* Reset active HMM and word lists. */
+    /* Reset active HMM and word lists, and free any tree HMMs left
+     * over from an unfinished utterance. */
+    deactivate_tree_chans(ngs);
     ngs->n_active_chan[0] = ngs->n_active_chan[1] = 0;
     ngs->n_active_word[0] = ngs->n_active_word[1] = 0;
 
@@ -497,6 +837,12 @@ ngram_fwdtree_start(ngram_search_t *ngs)
     ngs->best_score = 0;
     ngs->renormalized = 0;
 
+    /* The adaptive beam starts wide, but its HMM target carries over
+     * from the last utterance. */
+    ngs->adapt_beam = ngs->beam;
+    ngs->adapt_n_frame = 0;
+    ptmr_reset(&ngs->adapt_perf);
+
     /* Reset other stuff. */
     for (i = 0; i < n_words; i++)
         ngs->last_ltrans[i].sf = -1;
@@ -528,7 +874,8 @@ static void
 compute_sen_active(ngram_search_t *ngs, int frame_idx)
 {
     root_chan_t *rhmm;
-    chan_t *hmm, **acl;
+    tree_chan_t *thmm, **acl;
+    chan_t *hmm;
     int32 i, w, *awl;
 
     acmod_clear_active(ps_search_acmod(ngs));
@@ -542,8 +889,8 @@ compute_sen_active(ngram_search_t *ngs, int frame_idx)
     /* Flag active senones for nonroot channels in HMM tree */
     i = ngs->n_active_chan[frame_idx & 0x1];
     acl = ngs->active_chan_list[frame_idx & 0x1];
-    for (hmm = *(acl++); i > 0; --i, hmm = *(acl++)) {
-        acmod_activate_hmm(ps_search_acmod(ngs), &hmm->hmm);
+    for (thmm = *(acl++); i > 0; --i, thmm = *(acl++)) {
+        acmod_activate_hmm(ps_search_acmod(ngs), &thmm->hmm);
     }
 
     /* Flag active senones for individual word channels */
@@ -567,7 +914,8 @@ static void
 renormalize_scores(ngram_search_t *ngs, int frame_idx, int32 norm)
 {
     root_chan_t *rhmm;
-    chan_t *hmm, **acl;
+    tree_chan_t *thmm, **acl;
+    chan_t *hmm;
     int32 i, w, *awl;
 
     /* Renormalize root channels */
@@ -580,8 +928,8 @@ renormalize_scores(ngram_search_t *ngs, int frame_idx, int32 norm)
     /* Renormalize nonroot channels in HMM tree */
     i = ngs->n_active_chan[frame_idx & 0x1];
     acl = ngs->active_chan_list[frame_idx & 0x1];
-    for (hmm = *(acl++); i > 0; --i, hmm = *(acl++)) {
-        hmm_normalize(&hmm->hmm, norm);
+    for (thmm = *(acl++); i > 0; --i, thmm = *(acl++)) {
+        hmm_normalize(&thmm->hmm, norm);
     }
 
     /* Renormalize individual word channels */
@@ -600,46 +948,117 @@ renormalize_scores(ngram_search_t *ngs, int frame_idx, int32 norm)
         }
     }
 
+    ngs->best_score -= norm;
     ngs->renormalized = TRUE;
 }
 
+/*
+ * Channels to be evaluated are collected in batches of HMM_BATCH,
+ * which hmm_vit_eval_batch() does together.  Their scores are then
+ * added to the score histogram while they are still in cache.
+ */
+typedef struct chan_batch_s {
+    hmm_t *hmm[HMM_BATCH];
+    int32 n_hmm;
+    int32 bestscore;
+    int32 *hist;                /**< Score histogram, or NULL */
+    int32 anchor;               /**< Score at the edge of hist[0] */
+    int32 shift;                /**< log2 of the bin width */
+} chan_batch_t;
+
+static void
+chan_batch_init(ngram_search_t *ngs, chan_batch_t *cb)
+{
+    cb->n_hmm = 0;
+    cb->bestscore = WORST_SCORE;
+    cb->hist = (ngs->hist_shift < 0) ? NULL : ngs->score_hist;
+    cb->anchor = ngs->hist_anchor;
+    cb->shift = ngs->hist_shift;
+}
+
+static void
+chan_batch_bin(chan_batch_t *cb, hmm_t *hmm)
+{
+    int32 b;
+
+    b = (cb->anchor - hmm_bestscore(hmm)) >> cb->shift;
+    if (b < 0)
+        b = 0;
+    else if (b >= SCORE_HIST_BINS)
+        b = SCORE_HIST_BINS - 1;
+    ++cb->hist[b];
+}
+
+static void
+chan_batch_flush(chan_batch_t *cb)
+{
+    int32 score, i;
+
+    if (cb->n_hmm == 0)
+        return;
+    score = hmm_vit_eval_batch(cb->hmm, cb->n_hmm);
+    if (score BETTER_THAN cb->bestscore)
+        cb->bestscore = score;
+    if (cb->hist) {
+        for (i = 0; i < cb->n_hmm; ++i)
+            chan_batch_bin(cb, cb->hmm[i]);
+    }
+    cb->n_hmm = 0;
+}
+
+static void
+chan_batch_add(chan_batch_t *cb, hmm_t *hmm)
+{
+#if __CHAN_DUMP__
+    int32 score = hmm_dump_vit_eval(hmm, stderr);
+    if (score BETTER_THAN cb->bestscore)
+        cb->bestscore = score;
+    if (cb->hist)
+        chan_batch_bin(cb, hmm);
+#else
+    cb->hmm[cb->n_hmm++] = hmm;
+    if (cb->n_hmm == HMM_BATCH)
+        chan_batch_flush(cb);
+#endif
+}
+
 static int32
 eval_root_chan(ngram_search_t *ngs, int frame_idx)
 {
     root_chan_t *rhmm;
-    int32 i, bestscore;
+    chan_batch_t cb;
+    int32 i;
 
-    bestscore = WORST_SCORE;
+    chan_batch_init(ngs, &cb);
     for (i = ngs->n_root_chan, rhmm = ngs->root_chan; i > 0; --i, rhmm++) {
         if (hmm_frame(&rhmm->hmm) == frame_idx) {
-            int32 score = chan_v_eval(rhmm);
-            if (score BETTER_THAN bestscore)
-                bestscore = score;
+            chan_batch_add(&cb, &rhmm->hmm);
             ++ngs->st.n_root_chan_eval;
         }
     }
-    return (bestscore);
+    chan_batch_flush(&cb);
+    return cb.bestscore;
 }
 
 static int32
 eval_nonroot_chan(ngram_search_t *ngs, int frame_idx)
 {
-    chan_t *hmm, **acl;
-    int32 i, bestscore;
+    tree_chan_t *hmm, **acl;
+    chan_batch_t cb;
+    int32 i;
 
     i = ngs->n_active_chan[frame_idx & 0x1];
     acl = ngs->active_chan_list[frame_idx & 0x1];
-    bestscore = WORST_SCORE;
+    chan_batch_init(ngs, &cb);
     ngs->st.n_nonroot_chan_eval += i;
 
     for (hmm = *(acl++); i > 0; --i, hmm = *(acl++)) {
-        int32 score = chan_v_eval(hmm);
         assert(hmm_frame(&hmm->hmm) == frame_idx);
-        if (score BETTER_THAN bestscore)
-            bestscore = score;
+        chan_batch_add(&cb, &hmm->hmm);
     }
+    chan_batch_flush(&cb);
 
-    return bestscore;
+    return cb.bestscore;
 }
 
 static int32
@@ -647,10 +1066,11 @@ eval_word_chan(ngram_search_t *ngs, int frame_idx)
 {
     root_chan_t *rhmm;
     chan_t *hmm;
-    int32 i, w, bestscore, *awl, j, k;
+    chan_batch_t cb;
+    int32 i, w, *awl, j, k;
 
     k = 0;
-    bestscore = WORST_SCORE;
+    chan_batch_init(ngs, &cb);
     awl = ngs->active_word_list[frame_idx & 0x1];
 
     i = ngs->n_active_word[frame_idx & 0x1];
@@ -660,43 +1080,35 @@ eval_word_chan(ngram_search_t *ngs, int frame_idx)
         assert(ngs->word_chan[w] != NULL);
 
         for (hmm = ngs->word_chan[w]; hmm; hmm = hmm->next) {
-            int32 score;
-
             assert(hmm_frame(&hmm->hmm) == frame_idx);
-            score = chan_v_eval(hmm);
-            /*printf("eval word chan %d score %d\n", w, score); */
-
-            if (score BETTER_THAN bestscore)
-                bestscore = score;
-
+            chan_batch_add(&cb, &hmm->hmm);
             k++;
         }
     }
 
-    /* Similarly for statically allocated single-phone words */
+    /* Similarly for statically allocated single-phone words; the
+     * finish word does not count towards the best score. */
     j = 0;
     for (i = 0; i < ngs->n_1ph_words; i++) {
-        int32 score;
-
         w = ngs->single_phone_wid[i];
         rhmm = (root_chan_t *) ngs->word_chan[w];
         if (hmm_frame(&rhmm->hmm) < frame_idx)
             continue;
 
-        score = chan_v_eval(rhmm);
-        /* printf("eval 1ph word chan %d score %d\n", w, score); */
-        if (score BETTER_THAN bestscore && w != ps_search_finish_wid(ngs))
-            bestscore = score;
-
+        if (w == ps_search_finish_wid(ngs))
+            chan_v_eval(rhmm);
+        else
+            chan_batch_add(&cb, &rhmm->hmm);
         j++;
     }
+    chan_batch_flush(&cb);
 
     ngs->st.n_last_chan_eval += k + j;
     ngs->st.n_nonroot_chan_eval += k + j;
     ngs->st.n_word_lastchan_eval +=
         ngs->n_active_word[frame_idx & 0x1] + j;
 
-    return bestscore;
+    return cb.bestscore;
 }
 
 static int32
@@ -705,6 +1117,12 @@ evaluate_channels(ngram_search_t *ngs, int16 const *senone_scores, int frame_idx
     int32 bs;
 
     hmm_context_set_senscore(ngs->hmmctx, senone_scores);
+    /* Scores can only get worse from one frame to the next, so bin
+     * them relative to the previous best score. */
+    if (ngs->hist_shift >= 0) {
+        memset(ngs->score_hist, 0, sizeof(ngs->score_hist));
+        ngs->hist_anchor = ngs->best_score;
+    }
     ngs->best_score = eval_root_chan(ngs, frame_idx);
     if ((bs = eval_nonroot_chan(ngs, frame_idx)) BETTER_THAN ngs->best_score)
         ngs->best_score = bs;
@@ -724,10 +1142,12 @@ static void
 prune_root_chan(ngram_search_t *ngs, int frame_idx)
 {
     root_chan_t *rhmm;
-    chan_t *hmm;
-    int32 i, nf, w;
+    lextree_t *lt = ngs->lextree;
+    tree_chan_t *hmm;
+    int32 i, c, nf, w, la_node;
     int32 thresh, newphone_thresh, lastphn_thresh, newphone_score;
-    chan_t **nacl;              /* next active list */
+    int16 const *la;
+    tree_chan_t **nacl;         /* next active list */
     lastphn_cand_t *candp;
     phone_loop_search_t *pls;
 
@@ -751,14 +1171,29 @@ prune_root_chan(ngram_search_t *ngs, int frame_idx)
             /* transitions out of this root channel */
             /* transition to all next-level channels in the HMM tree */
             newphone_score = hmm_out_score(&rhmm->hmm) + ngs->pip;
+            /* Lookahead for this node is in the score already, and is
+             * replaced by that of the next one. */
+            la = NULL;
+            la_node = 0;
+            if (ngs->lmla_order > 0) {
+                la = lmla_lookup(ngs, hmm_out_history(&rhmm->hmm));
+                la_node = la[i];
+                la += lt->n_root;
+            }
             if (pls != NULL || newphone_score BETTER_THAN newphone_thresh) {
-                for (hmm = rhmm->next; hmm; hmm = hmm->alt) {
-                    int32 pl_newphone_score = newphone_score
-                        + phone_loop_search_score(pls, hmm->ciphone);
+                for (c = lt->root[i].first_child;
+                     c < lt->root[i].first_child + lt->root[i].n_child; ++c) {
+                    int32 child_score = la
+                        ? newphone_score + la[c] - la_node : newphone_score;
+                    int32 pl_newphone_score = child_score
+                        + phone_loop_search_score(pls, lt->node[c].ciphone);
                     if (pl_newphone_score BETTER_THAN newphone_thresh) {
-                        if ((hmm_frame(&hmm->hmm) < frame_idx)
-                            || (newphone_score BETTER_THAN hmm_in_score(&hmm->hmm))) {
-                            hmm_enter(&hmm->hmm, newphone_score,
+                        hmm = ngs->tree_chan[c];
+                        if (hmm == NULL
+                            || (hmm_frame(&hmm->hmm) < frame_idx)
+                            || (child_score BETTER_THAN hmm_in_score(&hmm->hmm))) {
+                            hmm = activate_tree_chan(ngs, c);
+                            hmm_enter(&hmm->hmm, child_score,
                                       hmm_out_history(&rhmm->hmm), nf);
                             *(nacl++) = hmm;
                         }
@@ -773,7 +1208,7 @@ prune_root_chan(ngram_search_t *ngs, int frame_idx)
              */
             if (pls != NULL || newphone_score BETTER_THAN lastphn_thresh) {
                 for (w = rhmm->penult_phn_wid; w >= 0;
-                     w = ngs->homophone_set[w]) {
+                     w = lt->homophone_set[w]) {
                     int32 pl_newphone_score = newphone_score
                         + phone_loop_search_score
                         (pls, dict_last_phone(ps_search_dict(ngs),w));
@@ -783,7 +1218,7 @@ prune_root_chan(ngram_search_t *ngs, int frame_idx)
                         ngs->n_lastphn_cand++;
                         candp->wid = w;
                         candp->score =
-                            newphone_score - ngs->nwpen;
+                            newphone_score - ngs->nwpen - la_node;
                         candp->bp = hmm_out_history(&rhmm->hmm);
                     }
                 }
@@ -800,10 +1235,13 @@ prune_root_chan(ngram_search_t *ngs, int frame_idx)
 static void
 prune_nonroot_chan(ngram_search_t *ngs, int frame_idx)
 {
-    chan_t *hmm, *nexthmm;
-    int32 nf, w, i;
+    lextree_t *lt = ngs->lextree;
+    lextree_node_t *ln;
+    tree_chan_t *hmm, *nexthmm;
+    int32 nf, w, i, c, la_node;
     int32 thresh, newphone_thresh, lastphn_thresh, newphone_score;
-    chan_t **acl, **nacl;       /* active list, next active list */
+    int16 const *la;
+    tree_chan_t **acl, **nacl;  /* active list, next active list */
     lastphn_cand_t *candp;
     phone_loop_search_t *pls;
 
@@ -821,6 +1259,7 @@ prune_nonroot_chan(ngram_search_t *ngs, int frame_idx)
          --i, hmm = *(acl++)) {
         assert(hmm_frame(&hmm->hmm) >= frame_idx);
 
+        ln = &lt->node[hmm->node];
         if (hmm_bestscore(&hmm->hmm) BETTER_THAN thresh) {
             /* retain this channel in next frame */
             if (hmm_frame(&hmm->hmm) != nf) {
@@ -830,19 +1269,32 @@ prune_nonroot_chan(ngram_search_t *ngs, int frame_idx)
 
             /* transition to all next-level channel in the HMM tree */
             newphone_score = hmm_out_score(&hmm->hmm) + ngs->pip;
+            la = NULL;
+            la_node = 0;
+            if (ngs->lmla_order > 0) {
+                la = lmla_lookup(ngs, hmm_out_history(&hmm->hmm))
+                    + lt->n_root;
+                la_node = la[hmm->node];
+            }
             if (pls != NULL || newphone_score BETTER_THAN newphone_thresh) {
-                for (nexthmm = hmm->next; nexthmm; nexthmm = nexthmm->alt) {
-                    int32 pl_newphone_score = newphone_score
-                        + phone_loop_search_score(pls, nexthmm->ciphone);
+                for (c = ln->first_child;
+                     c < ln->first_child + ln->n_child; ++c) {
+                    int32 child_score = la
+                        ? newphone_score + la[c] - la_node : newphone_score;
+                    int32 pl_newphone_score = child_score
+                        + phone_loop_search_score(pls, lt->node[c].ciphone);
+                    nexthmm = ngs->tree_chan[c];
                     if ((pl_newphone_score BETTER_THAN newphone_thresh)
-                        && ((hmm_frame(&nexthmm->hmm) < frame_idx)
-                            || (newphone_score
+                        && (nexthmm == NULL
+                            || (hmm_frame(&nexthmm->hmm) < frame_idx)
+                            || (child_score
                                 BETTER_THAN hmm_in_score(&nexthmm->hmm)))) {
+                        nexthmm = activate_tree_chan(ngs, c);
                         if (hmm_frame(&nexthmm->hmm) != nf) {
                             /* Keep this HMM on the active list */
                             *(nacl++) = nexthmm;
                         }
-                        hmm_enter(&nexthmm->hmm, newphone_score,
+                        hmm_enter(&nexthmm->hmm, child_score,
                                   hmm_out_history(&hmm->hmm), nf);
                     }
                 }
@@ -854,8 +1306,8 @@ prune_nonroot_chan(ngram_search_t *ngs, int frame_idx)
              * Remember to remove the temporary newword_penalty.
              */
             if (pls != NULL || newphone_score BETTER_THAN lastphn_thresh) {
-                for (w = hmm->info.penult_phn_wid; w >= 0;
-                     w = ngs->homophone_set[w]) {
+                for (w = ln->penult_phn_wid; w >= 0;
+                     w = lt->homophone_set[w]) {
                     int32 pl_newphone_score = newphone_score
                         + phone_loop_search_score
                         (pls, dict_last_phone(ps_search_dict(ngs),w));
@@ -864,14 +1316,14 @@ prune_nonroot_chan(ngram_search_t *ngs, int frame_idx)
                         ngs->n_lastphn_cand++;
                         candp->wid = w;
                         candp->score =
-                            newphone_score - ngs->nwpen;
+                            newphone_score - ngs->nwpen - la_node;
                         candp->bp = hmm_out_history(&hmm->hmm);
                     }
                 }
             }
         }
         else if (hmm_frame(&hmm->hmm) != nf) {
-            hmm_clear(&hmm->hmm);
+            deactivate_tree_chan(ngs, hmm);
         }
     }
     ngs->n_active_chan[nf & 0x1] = (int)(nacl - ngs->active_chan_list[nf & 0x1]);
@@ -907,7 +1359,7 @@ last_phone_transition(ngram_search_t *ngs, int frame_idx)
         if (candp->bp == -1)
             continue;
         /* Backpointer entry for it. */
-        bpe = &(ngs->bp_table[candp->bp]);
+        bpe = ngram_search_bp(ngs, candp->bp);
 
         /* Subtract starting score for candidate, leave it with only word score */
         start_score = ngram_search_exit_score
@@ -968,9 +1420,13 @@ last_phone_transition(ngram_search_t *ngs, int frame_idx)
         /* For the i-th unique end frame... */
         bp = ngs->bp_table_idx[ngs->cand_sf[i].bp_ef];
         bpend = ngs->bp_table_idx[ngs->cand_sf[i].bp_ef + 1];
-        for (bpe = &(ngs->bp_table[bp]); bp < bpend; bp++, bpe++) {
+        for (; bp < bpend; bp++) {
+            ngram_state_t lmstate;
+
+            bpe = ngram_search_bp(ngs, bp);
             if (!bpe->valid)
                 continue;
+            ngram_search_bp_lmstate(ngs, bpe, &lmstate);
             /* For each candidate at the start frame find bp->cand transition-score */
             for (j = ngs->cand_sf[i].cand; j >= 0; j = candp->next) {
                 int32 n_used;
@@ -980,11 +1436,10 @@ last_phone_transition(ngram_search_t *ngs, int frame_idx)
                     (ngs, bpe, dict_first_phone(ps_search_dict(ngs), candp->wid));
                 if (dscr BETTER_THAN WORST_SCORE) {
                     assert(!dict_filler_word(ps_search_dict(ngs), candp->wid));
-                    dscr += ngram_tg_score(ngs->lmset,
-                                           dict_basewid(ps_search_dict(ngs), candp->wid),
-                                           bpe->real_wid,
-                                           bpe->prev_real_wid,
-                                           &n_used)>>SENSCR_SHIFT;
+                    dscr += ngram_state_score(ngs->lmset, &lmstate,
+                                              dict_basewid(ps_search_dict(ngs), candp->wid),
+                                              NULL, &n_used)>>SENSCR_SHIFT;
+                    ++ps_search_acmod(ngs)->stats.n_lm_query;
                 }
 
                 if (dscr BETTER_THAN ngs->last_ltrans[candp->wid].dscr) {
@@ -1127,53 +1582,97 @@ prune_word_chan(ngram_search_t *ngs, int frame_idx)
     }
 }
 
+/*
+ * Find the beam which keeps at most max_hmm of the HMMs evaluated in
+ * this frame, or -beam if that keeps no more than this anyway.
+ */
+static int32
+hist_beam(ngram_search_t *ngs, int32 max_hmm)
+{
+    int32 i, n, beam;
+
+    for (i = n = 0; i < SCORE_HIST_BINS; ++i) {
+        n += ngs->score_hist[i];
+        if (n > max_hmm)
+            break;
+    }
+    if (i == SCORE_HIST_BINS)
+        return ngs->beam;
+    /* Bins are relative to the anchor, not to the best score. */
+    beam = ngs->hist_anchor - (i << ngs->hist_shift) - ngs->best_score;
+    if (beam > 0)
+        beam = 0;
+    if (beam < ngs->beam)
+        beam = ngs->beam;
+    return beam;
+}
+
+/*
+ * Adjust the number of HMMs the adaptive beam aims for, to bring the
+ * CPU time spent per second of speech close to -targetrtf.
+ */
+static void
+adapt_target_rtf(ngram_search_t *ngs)
+{
+    double rtf;
+    int32 max_hmmpf;
+
+    if (++ngs->adapt_n_frame < ADAPT_RTF_FRAMES)
+        return;
+    rtf = ngs->adapt_perf.t_cpu * ngs->frate
+        / ngs->adapt_n_frame;
+    max_hmmpf = ngs->targethmmpf > 0 ? ngs->targethmmpf : ngs->maxhmmpf;
+    if (max_hmmpf <= 0)
+        max_hmmpf = MAX_INT32;
+    if (rtf > ngs->targetrtf) {
+        ngs->adapt_hmmpf -= ngs->adapt_hmmpf / 8;
+        if (ngs->adapt_hmmpf < ADAPT_MIN_HMMPF)
+            ngs->adapt_hmmpf = ADAPT_MIN_HMMPF;
+    }
+    else if (rtf < ngs->targetrtf * 0.8) {
+        /* Don't run away from a target that is never reached. */
+        if (ngs->adapt_hmmpf > ngs->n_root_chan + ngs->n_nonroot_chan)
+            ngs->adapt_hmmpf = ngs->n_root_chan + ngs->n_nonroot_chan;
+        ngs->adapt_hmmpf += ngs->adapt_hmmpf / 16 + 1;
+        if (ngs->adapt_hmmpf > max_hmmpf)
+            ngs->adapt_hmmpf = max_hmmpf;
+    }
+    E_DEBUG("fwdtree %.3f xRT over %d frames, now aiming for %d HMMs\n",
+            rtf, ngs->adapt_n_frame, ngs->adapt_hmmpf);
+    ngs->adapt_n_frame = 0;
+    ptmr_reset(&ngs->adapt_perf);
+}
+
 static void
 prune_channels(ngram_search_t *ngs, int frame_idx)
 {
     /* Clear last phone candidate list. */
     ngs->n_lastphn_cand = 0;
-    /* Set the dynamic beam based on maxhmmpf here. */
+    /* Set the dynamic beam from the score histogram. */
     ngs->dynamic_beam = ngs->beam;
-    if (ngs->maxhmmpf != -1
-        && ngs->st.n_root_chan_eval + ngs->st.n_nonroot_chan_eval > ngs->maxhmmpf) {
-        /* Build a histogram to approximately prune them. */
-        int32 bins[256], bw, nhmms, i;
-        root_chan_t *rhmm;
-        chan_t **acl, *hmm;
-
-        /* Bins go from zero (best score) to edge of beam. */
-        bw = -ngs->beam / 256;
-        memset(bins, 0, sizeof(bins));
-        /* For each active root channel. */
-        for (i = 0, rhmm = ngs->root_chan; i < ngs->n_root_chan; i++, rhmm++) {
-            int32 b;
-
-            /* Put it in a bin according to its bestscore. */
-            b = (ngs->best_score - hmm_bestscore(&rhmm->hmm)) / bw;
-            if (b >= 256)
-                b = 255;
-            ++bins[b];
-        }
-        /* For each active non-root channel. */
-        acl = ngs->active_chan_list[frame_idx & 0x1];       /* currently active HMMs in tree */
-        for (i = ngs->n_active_chan[frame_idx & 0x1], hmm = *(acl++);
-             i > 0; --i, hmm = *(acl++)) {
-            int32 b;
-
-            /* Put it in a bin according to its bestscore. */
-            b = (ngs->best_score - hmm_bestscore(&hmm->hmm)) / bw;
-            if (b >= 256)
-                b = 255;
-            ++bins[b];
+    if (ngs->hist_shift >= 0) {
+        if (ngs->maxhmmpf != -1)
+            ngs->dynamic_beam = hist_beam(ngs, ngs->maxhmmpf);
+        if (ngs->targethmmpf > 0 || ngs->targetrtf > 0) {
+            int32 beam = hist_beam(ngs, ngs->adapt_hmmpf);
+
+            /* Narrow the beam at once, but widen it gradually, so
+             * that a few frames with fewer HMMs don't let a burst of
+             * them in. */
+            if (beam > ngs->adapt_beam)
+                ngs->adapt_beam = beam;
+            else
+                ngs->adapt_beam += (beam - ngs->adapt_beam) / 8;
+            if (ngs->adapt_beam > ngs->dynamic_beam)
+                ngs->dynamic_beam = ngs->adapt_beam;
         }
-        /* Walk down the bins to find the new beam. */
-        for (i = nhmms = 0; i < 256; ++i) {
-            nhmms += bins[i];
-            if (nhmms > ngs->maxhmmpf)
-                break;
-        }
-        ngs->dynamic_beam = -(i * bw);
     }
+    if (ngs->dynamic_beam != ngs->beam)
+        ++ngs->st.n_beam_narrowed;
+    ngs->st.beam_sum += ngs->dynamic_beam;
+    E_DEBUG("Frame %d: best %d, beam %d of %d, adaptive target %d HMMs\n",
+            frame_idx, ngs->best_score, ngs->dynamic_beam, ngs->beam,
+            ngs->adapt_hmmpf);
 
     prune_root_chan(ngs, frame_idx);
     prune_nonroot_chan(ngs, frame_idx);
@@ -1201,7 +1700,7 @@ bptable_maxwpf(ngram_search_t *ngs, int frame_idx)
     bestbpe = NULL;
     n = 0;
     for (bp = ngs->bp_table_idx[frame_idx]; bp < ngs->bpidx; bp++) {
-        bpe = &(ngs->bp_table[bp]);
+        bpe = ngram_search_bp(ngs, bp);
         if (dict_filler_word(ps_search_dict(ngs), bpe->wid)) {
             if (bpe->score BETTER_THAN bestscr) {
                 bestscr = bpe->score;
@@ -1225,7 +1724,7 @@ bptable_maxwpf(ngram_search_t *ngs, int frame_idx)
         worstscr = (int32) 0x7fffffff;
         worstbpe = NULL;
         for (bp = ngs->bp_table_idx[frame_idx]; (bp < ngs->bpidx); bp++) {
-            bpe = &(ngs->bp_table[bp]);
+            bpe = ngram_search_bp(ngs, bp);
             if (bpe->valid && (bpe->score WORSE_THAN worstscr)) {
                 worstscr = bpe->score;
                 worstbpe = bpe;
@@ -1241,8 +1740,8 @@ bptable_maxwpf(ngram_search_t *ngs, int frame_idx)
 static void
 word_transition(ngram_search_t *ngs, int frame_idx)
 {
-    int32 i, k, bp, w, nf;
-    int32 rc;
+    int32 i, j, k, bp, w, nf;
+    int32 rc, n_ci, best1ph;
     int32 thresh, newscore, pl_newscore;
     bptbl_t *bpe;
     root_chan_t *rhmm;
@@ -1256,14 +1755,16 @@ word_transition(ngram_search_t *ngs, int frame_idx)
      * other than </s> finished here.
      * But, first, find the best starting score for each possible right context phone.
      */
-    for (i = bin_mdef_n_ciphone(ps_search_acmod(ngs)->mdef) - 1; i >= 0; --i)
+    n_ci = bin_mdef_n_ciphone(ps_search_acmod(ngs)->mdef);
+    for (i = n_ci - 1; i >= 0; --i)
         ngs->bestbp_rc[i].score = WORST_SCORE;
+    best1ph = NO_BP;
     k = 0;
     pls = (phone_loop_search_t *)ps_search_lookahead(ngs);
     /* Ugh, this is complicated.  Scan all word exits for this frame
      * (they have already been created by prune_word_chan()). */
     for (bp = ngs->bp_table_idx[frame_idx]; bp < ngs->bpidx; bp++) {
-        bpe = &(ngs->bp_table[bp]);
+        bpe = ngram_search_bp(ngs, bp);
         ngs->word_lat_idx[bpe->wid] = NO_BP;
 
         if (bpe->wid == ps_search_finish_wid(ngs))
@@ -1275,33 +1776,54 @@ word_transition(ngram_search_t *ngs, int frame_idx)
          * context expansions of the final phone.  It's likely that a
          * lot of these are going to be missing, actually. */
         if (bpe->last2_phone == -1) { /* implies s_idx == -1 */
-            /* No right context expansion. */
-            for (rc = 0; rc < bin_mdef_n_ciphone(ps_search_acmod(ngs)->mdef); ++rc) {
-                if (bpe->score BETTER_THAN ngs->bestbp_rc[rc].score) {
-                    E_DEBUG("bestbp_rc[0] = %d lc %d\n",
-                            bpe->score, bpe->last_phone);
-                    ngs->bestbp_rc[rc].score = bpe->score;
-                    ngs->bestbp_rc[rc].path = bp;
-                    ngs->bestbp_rc[rc].lc = bpe->last_phone;
-                }
-            }
+            /* No right context expansion, so the same score goes to
+             * every right context.  Only the best (earliest among
+             * equals) of these can matter, so merge it in below. */
+            if (best1ph == NO_BP
+                || bpe->score BETTER_THAN ngram_search_bp(ngs, best1ph)->score)
+                best1ph = bp;
         }
         else {
+            /* Visit each distinct right context ssid once, along
+             * with all the right context phones that share it. */
             xwdssid_t *rssid = dict2pid_rssid(d2p, bpe->last_phone, bpe->last2_phone);
-            int32 *rcss = &(ngs->bscore_stack[bpe->s_idx]);
-            for (rc = 0; rc < bin_mdef_n_ciphone(ps_search_acmod(ngs)->mdef); ++rc) {
-                if (rcss[rssid->cimap[rc]] BETTER_THAN ngs->bestbp_rc[rc].score) {
-                    E_DEBUG("bestbp_rc[%d] = %d lc %d\n",
-                            rc, rcss[rssid->cimap[rc]], bpe->last_phone);
-                    ngs->bestbp_rc[rc].score = rcss[rssid->cimap[rc]];
-                    ngs->bestbp_rc[rc].path = bp;
-                    ngs->bestbp_rc[rc].lc = bpe->last_phone;
+            int32 *rcss = ngram_search_rcss(ngs, bpe);
+            for (j = 0; j < rssid->n_ssid; ++j) {
+                int32 score = rcss[j];
+                if (score == WORST_SCORE)
+                    continue;
+                for (i = rssid->rcfan_start[j]; i < rssid->rcfan_start[j + 1]; ++i) {
+                    rc = rssid->rcfan[i];
+                    if (score BETTER_THAN ngs->bestbp_rc[rc].score) {
+                        E_DEBUG("bestbp_rc[%d] = %d lc %d\n",
+                                rc, score, bpe->last_phone);
+                        ngs->bestbp_rc[rc].score = score;
+                        ngs->bestbp_rc[rc].path = bp;
+                        ngs->bestbp_rc[rc].lc = bpe->last_phone;
+                    }
                 }
             }
         }
     }
     if (k == 0)
         return;
+    if (best1ph != NO_BP
+        && ngram_search_bp(ngs, best1ph)->score BETTER_THAN WORST_SCORE) {
+        /* Ties go to the earlier entry, as if it had been visited in
+         * order with the others. */
+        bpe = ngram_search_bp(ngs, best1ph);
+        for (rc = 0; rc < n_ci; ++rc) {
+            if (bpe->score BETTER_THAN ngs->bestbp_rc[rc].score
+                || (bpe->score == ngs->bestbp_rc[rc].score
+                    && best1ph < ngs->bestbp_rc[rc].path)) {
+                E_DEBUG("bestbp_rc[%d] = %d lc %d\n",
+                        rc, bpe->score, bpe->last_phone);
+                ngs->bestbp_rc[rc].score = bpe->score;
+                ngs->bestbp_rc[rc].path = best1ph;
+                ngs->bestbp_rc[rc].lc = bpe->last_phone;
+            }
+        }
+    }
 
     nf = frame_idx + 1;
     thresh = ngs->best_score + ngs->dynamic_beam;
@@ -1309,10 +1831,12 @@ word_transition(ngram_search_t *ngs, int frame_idx)
      * Hypothesize successors to words finished in this frame.
      * Main dictionary, multi-phone words transition to HMM-trees roots.
      */
-    for (i = ngs->n_root_chan, rhmm = ngs->root_chan; i > 0; --i, rhmm++) {
+    for (i = 0, rhmm = ngs->root_chan; i < ngs->n_root_chan; i++, rhmm++) {
         bestbp_rc_ptr = &(ngs->bestbp_rc[rhmm->ciphone]);
 
         newscore = bestbp_rc_ptr->score + ngs->nwpen + ngs->pip;
+        if (ngs->lmla_order > 0 && bestbp_rc_ptr->score BETTER_THAN WORST_SCORE)
+            newscore += lmla_lookup(ngs, bestbp_rc_ptr->path)[i];
         pl_newscore = newscore
             + phone_loop_search_score(pls, rhmm->ciphone);
         if (pl_newscore BETTER_THAN thresh) {
@@ -1338,10 +1862,13 @@ word_transition(ngram_search_t *ngs, int frame_idx)
         ngs->last_ltrans[w].dscr = (int32) 0x80000000;
     }
     for (bp = ngs->bp_table_idx[frame_idx]; bp < ngs->bpidx; bp++) {
-        bpe = &(ngs->bp_table[bp]);
+        ngram_state_t lmstate;
+
+        bpe = ngram_search_bp(ngs, bp);
         if (!bpe->valid)
             continue;
 
+        ngram_search_bp_lmstate(ngs, bpe, &lmstate);
         for (i = 0; i < ngs->n_1ph_LMwords; i++) {
             int32 n_used;
             w = ngs->single_phone_wid[i];
@@ -1349,12 +1876,12 @@ word_transition(ngram_search_t *ngs, int frame_idx)
                 (ngs, bpe, dict_first_phone(dict, w));
             E_DEBUG("initial newscore for %s: %d\n",
                     dict_wordstr(dict, w), newscore);
-            if (newscore != WORST_SCORE)
-                newscore += ngram_tg_score(ngs->lmset,
-                                           dict_basewid(dict, w),
-                                           bpe->real_wid,
-                                           bpe->prev_real_wid,
-                                           &n_used)>>SENSCR_SHIFT;
+            if (newscore != WORST_SCORE) {
+                newscore += ngram_state_score(ngs->lmset, &lmstate,
+                                              dict_basewid(dict, w),
+                                              NULL, &n_used)>>SENSCR_SHIFT;
+                ++ps_search_acmod(ngs)->stats.n_lm_query;
+            }
 
             /* FIXME: Not sure how WORST_SCORE could be better, but it
              * apparently happens. */
@@ -1376,7 +1903,7 @@ word_transition(ngram_search_t *ngs, int frame_idx)
         newscore = ngs->last_ltrans[w].dscr + ngs->pip;
 	pl_newscore = newscore + phone_loop_search_score(pls, rhmm->ciphone);
         if (pl_newscore BETTER_THAN thresh) {
-            bpe = ngs->bp_table + ngs->last_ltrans[w].bp;
+            bpe = ngram_search_bp(ngs, ngs->last_ltrans[w].bp);
             if ((hmm_frame(&rhmm->hmm) < frame_idx)
                 || (newscore BETTER_THAN hmm_in_score(&rhmm->hmm))) {
                 hmm_enter(&rhmm->hmm,
@@ -1451,18 +1978,154 @@ deactivate_channels(ngram_search_t *ngs, int frame_idx)
     }
 }
 
+/*
+ * Flag the backpointers referenced by an HMM in keep[], or, if remap
+ * is TRUE, replace them with their new indices from keep[].
+ */
+static void
+gc_hmm_history(hmm_t *hmm, int32 *keep, int remap)
+{
+    int32 i;
+
+    for (i = 0; i < hmm_n_emit_state(hmm); ++i) {
+        if (hmm_history(hmm, i) == NO_BP)
+            continue;
+        if (remap)
+            hmm_history(hmm, i) = keep[hmm_history(hmm, i)];
+        else
+            keep[hmm_history(hmm, i)] = TRUE;
+    }
+    if (hmm_out_history(hmm) != NO_BP) {
+        if (remap)
+            hmm_out_history(hmm) = keep[hmm_out_history(hmm)];
+        else
+            keep[hmm_out_history(hmm)] = TRUE;
+    }
+}
+
+/*
+ * Visit the histories of all HMMs which are active in frame nf.
+ * Inactive ones have been cleared and carry no history.
+ */
+static void
+gc_channels(ngram_search_t *ngs, int nf, int32 *keep, int remap)
+{
+    root_chan_t *rhmm;
+    tree_chan_t *thmm, **acl;
+    chan_t *hmm;
+    int32 i, w, *awl;
+
+    for (i = ngs->n_root_chan, rhmm = ngs->root_chan; i > 0; --i, rhmm++)
+        gc_hmm_history(&rhmm->hmm, keep, remap);
+
+    i = ngs->n_active_chan[nf & 0x1];
+    acl = ngs->active_chan_list[nf & 0x1];
+    for (thmm = *(acl++); i > 0; --i, thmm = *(acl++))
+        gc_hmm_history(&thmm->hmm, keep, remap);
+
+    i = ngs->n_active_word[nf & 0x1];
+    awl = ngs->active_word_list[nf & 0x1];
+    for (w = *(awl++); i > 0; --i, w = *(awl++)) {
+        for (hmm = ngs->word_chan[w]; hmm; hmm = hmm->next)
+            gc_hmm_history(&hmm->hmm, keep, remap);
+    }
+    for (i = 0; i < ngs->n_1ph_words; i++) {
+        w = ngs->single_phone_wid[i];
+        rhmm = (root_chan_t *) ngs->word_chan[w];
+        gc_hmm_history(&rhmm->hmm, keep, remap);
+    }
+}
+
+/*
+ * Remove the backpointers which can no longer be reached from the
+ * active HMMs.  Only used when there is no second pass.
+ */
+static void
+gc_bptable(ngram_search_t *ngs, int frame_idx)
+{
+    int32 *keep, i, w, bp, n_bp;
+    uint8 *frame_ref;
+
+    if ((n_bp = ngs->bpidx) == 0)
+        return;
+    /* The scratch tables are kept from one collection to the next. */
+    if (n_bp > ngs->n_gc_keep_alloc) {
+        ckd_free(ngs->gc_keep);
+        ngs->n_gc_keep_alloc = n_bp * 2;
+        ngs->gc_keep = ckd_calloc(ngs->n_gc_keep_alloc, sizeof(*keep));
+    }
+    if (frame_idx + 1 > ngs->n_gc_frame_alloc) {
+        ckd_free(ngs->gc_frame_ref);
+        ngs->n_gc_frame_alloc = (frame_idx + 1) * 2;
+        ngs->gc_frame_ref = ckd_calloc(ngs->n_gc_frame_alloc,
+                                       sizeof(*frame_ref));
+    }
+    keep = ngs->gc_keep;
+    frame_ref = ngs->gc_frame_ref;
+    memset(keep, 0, n_bp * sizeof(*keep));
+    gc_channels(ngs, frame_idx + 1, keep, FALSE);
+
+    /* last_phone_transition() searches all the exits in the frame of
+     * a predecessor, and word_transition() those in the current
+     * frame, so they are kept whole. */
+    memset(frame_ref, 0, (frame_idx + 1) * sizeof(*frame_ref));
+    frame_ref[frame_idx] = TRUE;
+    for (i = 0; i < n_bp; ++i)
+        if (keep[i])
+            frame_ref[ngram_search_bp(ngs, i)->frame] = TRUE;
+    for (i = 0; i < n_bp; ++i)
+        if (frame_ref[ngram_search_bp(ngs, i)->frame])
+            keep[i] = TRUE;
+
+    if (ngram_search_compact_bptable(ngs, keep, frame_idx + 1) > 0) {
+        gc_channels(ngs, frame_idx + 1, keep, TRUE);
+        /* Cached last phone transitions into removed entries are
+         * simply forgotten. */
+        for (w = 0; w < ps_search_n_words(ngs); ++w) {
+            if (ngs->last_ltrans[w].sf == -1)
+                continue;
+            bp = ngs->last_ltrans[w].bp;
+            if (bp < 0 || bp >= n_bp || keep[bp] == NO_BP)
+                ngs->last_ltrans[w].sf = -1;
+            else
+                ngs->last_ltrans[w].bp = keep[bp];
+        }
+    }
+    E_DEBUG("Backpointer table %d => %d entries at frame %d\n",
+            n_bp, ngs->bpidx, frame_idx);
+}
+
+/*
+ * Whether less than an eighth of a fixed size backpointer table or
+ * score stack is left.
+ */
+static int
+bptable_nearly_full(ngram_search_t *ngs)
+{
+    return (ngs->bpidx > ngs->max_bp - (ngs->max_bp >> 3)
+            || ngs->bss_head > ngs->max_bss - (ngs->max_bss >> 3));
+}
+
 int
 ngram_fwdtree_search(ngram_search_t *ngs, int frame_idx)
 {
+    acmod_t *acmod = ps_search_acmod(ngs);
     int16 const *senscr;
+    int32 n_hmm_eval;
+
+    if (ngs->targetrtf > 0)
+        ptmr_start(&ngs->adapt_perf);
 
     /* Activate our HMMs for the current frame if need be. */
     if (!ps_search_acmod(ngs)->compallsen)
         compute_sen_active(ngs, frame_idx);
 
     /* Compute GMM scores for the current frame. */
-    if ((senscr = acmod_score(ps_search_acmod(ngs), &frame_idx)) == NULL)
+    if ((senscr = acmod_score(ps_search_acmod(ngs), &frame_idx)) == NULL) {
+        if (ngs->targetrtf > 0)
+            ptmr_stop(&ngs->adapt_perf);
         return 0;
+    }
     ngs->st.n_senone_active_utt += ps_search_acmod(ngs)->n_senone_active;
 
     /* Mark backpointer table for current frame. */
@@ -1470,8 +2133,11 @@ ngram_fwdtree_search(ngram_search_t *ngs, int frame_idx)
 
     /* If the best score is equal to or worse than WORST_SCORE,
      * recognition has failed, don't bother to keep trying. */
-    if (ngs->best_score == WORST_SCORE || ngs->best_score WORSE_THAN WORST_SCORE)
+    if (ngs->best_score == WORST_SCORE || ngs->best_score WORSE_THAN WORST_SCORE) {
+        if (ngs->targetrtf > 0)
+            ptmr_stop(&ngs->adapt_perf);
         return 0;
+    }
     /* Renormalize if necessary */
     if (ngs->best_score + (2 * ngs->beam) WORSE_THAN WORST_SCORE) {
         E_INFO("Renormalizing Scores at frame %d, best score %d\n",
@@ -1480,15 +2146,33 @@ ngram_fwdtree_search(ngram_search_t *ngs, int frame_idx)
     }
 
     /* Evaluate HMMs */
+    acmod_stage_start(acmod, PS_STAGE_HMM);
+    n_hmm_eval = ngs->st.n_root_chan_eval + ngs->st.n_nonroot_chan_eval;
     evaluate_channels(ngs, senscr, frame_idx);
+    acmod->stats.n_hmm_eval += ngs->st.n_root_chan_eval
+        + ngs->st.n_nonroot_chan_eval - n_hmm_eval;
     /* Prune HMMs and do phone transitions. */
     prune_channels(ngs, frame_idx);
+    acmod_stage_stop(acmod, PS_STAGE_HMM);
     /* Do absolute pruning on word exits. */
+    acmod_stage_start(acmod, PS_STAGE_WORD);
     bptable_maxwpf(ngs, frame_idx);
     /* Do word transitions. */
     word_transition(ngs, frame_idx);
+    acmod_stage_stop(acmod, PS_STAGE_WORD);
     /* Deactivate pruned HMMs. */
+    acmod_stage_start(acmod, PS_STAGE_HMM);
     deactivate_channels(ngs, frame_idx);
+    acmod_stage_stop(acmod, PS_STAGE_HMM);
+    /* Garbage collect the backpointer table if need be. */
+    if ((ngs->bp_gc_frames > 0 && (frame_idx + 1) % ngs->bp_gc_frames == 0)
+        || (ngs->bp_gc_full && bptable_nearly_full(ngs)))
+        gc_bptable(ngs, frame_idx);
+
+    if (ngs->targetrtf > 0) {
+        ptmr_stop(&ngs->adapt_perf);
+        adapt_target_rtf(ngs);
+    }
 
     ++ngs->n_frame;
     /* Return the number of frames processed. */
@@ -1500,7 +2184,6 @@ ngram_fwdtree_finish(ngram_search_t *ngs)
 {
     int32 i, w, cf, *awl;
     root_chan_t *rhmm;
-    chan_t *hmm, **acl;
 
     /* This is the number of frames processed. */
     cf = ps_search_acmod(ngs)->output_frame;
@@ -1513,12 +2196,9 @@ ngram_fwdtree_finish(ngram_search_t *ngs)
         hmm_clear(&rhmm->hmm);
     }
 
-    /* nonroot channels of HMM tree */
-    i = ngs->n_active_chan[cf & 0x1];
-    acl = ngs->active_chan_list[cf & 0x1];
-    for (hmm = *(acl++); i > 0; --i, hmm = *(acl++)) {
-        hmm_clear(&hmm->hmm);
-    }
+    /* nonroot channels of HMM tree (not necessarily all in the
+     * active list for cf if recognition failed) */
+    deactivate_tree_chans(ngs);
 
     /* word channels */
     i = ngs->n_active_word[cf & 0x1];
@@ -1545,7 +2225,7 @@ ngram_fwdtree_finish(ngram_search_t *ngs)
     /* Print out some statistics. */
     if (cf > 0) {
         double n_speech = (double)(cf + 1)
-            / cmd_ln_int32_r(ps_search_config(ngs), "-frate");
+            / ngs->frate;
         E_INFO("%8d words recognized (%d/fr)\n",
                ngs->bpidx, (ngs->bpidx + (cf >> 1)) / (cf + 1));
         E_INFO("%8d senones evaluated (%d/fr)\n", ngs->st.n_senone_active_utt,
@@ -1559,6 +2239,22 @@ ngram_fwdtree_finish(ngram_search_t *ngs)
                ngs->st.n_word_lastchan_eval / (cf + 1));
         E_INFO("%8d candidate words for entering last phone (%d/fr)\n",
                ngs->st.n_lastphn_cand_utt, ngs->st.n_lastphn_cand_utt / (cf + 1));
+        if (ngs->lmla_order > 0)
+            E_INFO("%8d LM lookahead histories computed, %d found in cache\n",
+                   ngs->st.n_lmla_miss, ngs->st.n_lmla_hit);
+        if (ngs->bp_gc_frames > 0 || ngs->bp_gc_full)
+            E_INFO("%8d backpointers garbage collected, %d remain\n",
+                   ngs->st.n_bp_gc, ngs->bpidx);
+        if (ngs->st.n_bp_full > 0)
+            E_INFO("%8d word exits pruned from a full backpointer table\n",
+                   ngs->st.n_bp_full);
+        if (ngs->hist_shift >= 0)
+            E_INFO("%8d frames with narrowed beam, average beam %d of %d\n",
+                   ngs->st.n_beam_narrowed,
+                   (int32)(ngs->st.beam_sum / (cf + 1)), ngs->beam);
+        if (ngs->targethmmpf > 0 || ngs->targetrtf > 0)
+            E_INFO("%8d HMMs per frame targeted by adaptive beam\n",
+                   ngs->adapt_hmmpf);
         E_INFO("fwdtree %.2f CPU %.3f xRT\n",
                ngs->fwdtree_perf.t_cpu,
                ngs->fwdtree_perf.t_cpu / n_speech);
@@ -52,6 +52,13 @@
  */
 void ngram_fwdtree_init(ngram_search_t *ngs);
 
+/**
+ * Initialize N-Gram search for fwdtree decoding with the search tree
+ * of another search with the same dictionary and language model,
+ * rather than building it.
+ */
+void ngram_fwdtree_clone(ngram_search_t *ngs, ngram_search_t *other);
+
 /**
  * Release memory associated with fwdtree decoding.
  */
@@ -62,6 +69,18 @@ void ngram_fwdtree_deinit(ngram_search_t *ngs);
  */
 int ngram_fwdtree_reinit(ngram_search_t *ngs);
 
+/**
+ * Use the search tree of another search if it is the same as ours.
+ *
+ * This is the case when both were built from the same dictionary,
+ * acoustic model and language model words, and saves the memory for
+ * the tree, which is not modified by the search.  Rebuilding the
+ * tree, after adding a word for instance, stops sharing it.
+ *
+ * @return TRUE if the tree is shared, FALSE otherwise.
+ */
+int ngram_fwdtree_share(ngram_search_t *ngs, ngram_search_t *other);
+
 /**
  * Start fwdtree decoding for an utterance.
  */
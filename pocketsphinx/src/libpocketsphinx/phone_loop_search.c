@@ -51,6 +51,9 @@ static void phone_loop_search_free(ps_search_t *search);
 static char const *phone_loop_search_hyp(ps_search_t *search, int32 *out_score);
 static int32 phone_loop_search_prob(ps_search_t *search);
 static ps_seg_t *phone_loop_search_seg_iter(ps_search_t *search);
+static ps_search_t *phone_loop_search_clone(ps_search_t *search,
+                                            acmod_t *acmod, dict_t *dict);
+static void phone_loop_search_mem(ps_search_t *search, ps_mem_t *out_mem);
 
 static ps_searchfuncs_t phone_loop_search_funcs = {
     /* start: */  phone_loop_search_start,
@@ -62,6 +65,8 @@ static ps_searchfuncs_t phone_loop_search_funcs = {
     /* hyp: */      phone_loop_search_hyp,
     /* prob: */     phone_loop_search_prob,
     /* seg_iter: */ phone_loop_search_seg_iter,
+    /* clone: */    phone_loop_search_clone,
+    /* mem: */      phone_loop_search_mem,
 };
 
 static int
@@ -100,6 +105,8 @@ phone_loop_search_reinit(ps_search_t *search, dict_t *dict, dict2pid_t *d2p)
         ckd_free(pls->hmms);
     }
     pls->hmms = (hmm_t *)ckd_calloc(pls->n_phones, sizeof(*pls->hmms));
+    ckd_free(pls->active);
+    pls->active = (hmm_t **)ckd_calloc(pls->n_phones, sizeof(*pls->active));
     for (i = 0; i < pls->n_phones; ++i) {
         hmm_init(pls->hmmctx, (hmm_t *)&pls->hmms[i],
                  FALSE,
@@ -134,6 +141,24 @@ phone_loop_search_init(cmd_ln_t *config,
     return ps_search_base(pls);
 }
 
+static ps_search_t *
+phone_loop_search_clone(ps_search_t *search, acmod_t *acmod, dict_t *dict)
+{
+    return phone_loop_search_init(ps_search_config(search), acmod, dict);
+}
+
+static void
+phone_loop_search_mem(ps_search_t *search, ps_mem_t *out_mem)
+{
+    phone_loop_search_t *pls = (phone_loop_search_t *)search;
+
+    out_mem[PS_MEM_SEARCH].heap += sizeof(*pls)
+        + pls->n_phones * (sizeof(*pls->hmms) + sizeof(*pls->active)
+                           + sizeof(*pls->penalties))
+        + pls->window * (pls->n_phones * sizeof(**pls->pen_buf)
+                         + sizeof(*pls->pen_buf));
+}
+
 static void
 phone_loop_search_free_renorm(phone_loop_search_t *pls)
 {
@@ -156,6 +181,7 @@ phone_loop_search_free(ps_search_t *search)
     phone_loop_search_free_renorm(pls);
     ckd_free_2d(pls->pen_buf);
     ckd_free(pls->hmms);
+    ckd_free(pls->active);
     ckd_free(pls->penalties);
     hmm_context_free(pls->hmmctx);
     ckd_free(pls);
@@ -201,23 +227,20 @@ renormalize_hmms(phone_loop_search_t *pls, int frame_idx, int32 norm)
 static void
 evaluate_hmms(phone_loop_search_t *pls, int16 const *senscr, int frame_idx)
 {
-    int32 bs = WORST_SCORE;
     int i;
 
     hmm_context_set_senscore(pls->hmmctx, senscr);
 
+    /* Collect the active phones and evaluate them in batches. */
+    pls->n_active = 0;
     for (i = 0; i < pls->n_phones; ++i) {
         hmm_t *hmm = (hmm_t *)&pls->hmms[i];
-        int32 score;
 
         if (hmm_frame(hmm) < frame_idx)
             continue;
-        score = hmm_vit_eval(hmm);
-        if (score BETTER_THAN bs) {
-            bs = score;
-        }
+        pls->active[pls->n_active++] = hmm;
     }
-    pls->best_score = bs;
+    pls->best_score = hmm_vit_eval_batch(pls->active, pls->n_active);
 }
 
 static void
@@ -250,12 +273,11 @@ prune_hmms(phone_loop_search_t *pls, int frame_idx)
     int nf = frame_idx + 1;
     int i;
 
-    /* Check all phones to see if they remain active in the next frame. */
-    for (i = 0; i < pls->n_phones; ++i) {
-        hmm_t *hmm = (hmm_t *)&pls->hmms[i];
+    /* Check the evaluated phones to see if they remain active in
+     * the next frame. */
+    for (i = 0; i < pls->n_active; ++i) {
+        hmm_t *hmm = pls->active[i];
 
-        if (hmm_frame(hmm) < frame_idx)
-            continue;
         /* Retain if score better than threshold. */
         if (hmm_bestscore(hmm) BETTER_THAN thresh) {
             hmm_frame(hmm) = nf;
@@ -72,6 +72,8 @@ typedef struct phone_loop_renorm_s phone_loop_renorm_t;
 struct phone_loop_search_s {
     ps_search_t base;                  /**< Base search structure. */
     hmm_t *hmms;                       /**< Basic HMM structures for CI phones. */
+    hmm_t **active;                    /**< Phones evaluated in current frame. */
+    int n_active;                      /**< Number of entries in active. */
     hmm_context_t *hmmctx;             /**< HMM context structure. */
     int16 frame;                       /**< Current frame being searched. */
     int16 n_phones;                    /**< Size of phone array. */
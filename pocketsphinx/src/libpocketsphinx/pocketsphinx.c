@@ -50,6 +50,7 @@
 #include <sphinxbase/pio.h>
 #include <sphinxbase/jsgf.h>
 #include <sphinxbase/hash_table.h>
+#include <sphinxbase/sbthread.h>
 
 /* Local headers. */
 #include "cmdln_macro.h"
@@ -63,6 +64,7 @@
 #include "ngram_search_fwdtree.h"
 #include "ngram_search_fwdflat.h"
 #include "allphone_search.h"
+#include "state_align_search.h"
 
 static const arg_t ps_args_def[] = {
     POCKETSPHINX_OPTIONS,
@@ -136,6 +138,8 @@ ps_expand_model_config(ps_decoder_t *ps)
     ps_expand_file_config(ps, "-mdef", "_mdef", hmmdir, "mdef");
     ps_expand_file_config(ps, "-mean", "_mean", hmmdir, "means");
     ps_expand_file_config(ps, "-var", "_var", hmmdir, "variances");
+    ps_expand_file_config(ps, "-gauq8", "_gauq8", hmmdir, "gaussians_q8");
+    ps_expand_file_config(ps, "-amimage", "_amimage", hmmdir, "am_image");
     ps_expand_file_config(ps, "-tmat", "_tmat", hmmdir, "transition_matrices");
     ps_expand_file_config(ps, "-mixw", "_mixw", hmmdir, "mixture_weights");
     ps_expand_file_config(ps, "-sendump", "_sendump", hmmdir, "sendump");
@@ -143,6 +147,7 @@ ps_expand_model_config(ps_decoder_t *ps)
     ps_expand_file_config(ps, "-lda", "_lda", hmmdir, "feature_transform");
     ps_expand_file_config(ps, "-featparams", "_featparams", hmmdir, "feat.params");
     ps_expand_file_config(ps, "-senmgau", "_senmgau", hmmdir, "senmgau");
+    ps_expand_file_config(ps, "-kdtree", "_kdtree", hmmdir, "kdtrees");
 
     /* Look for feat.params in acoustic model dir. */
     if ((featparams = cmd_ln_str_r(ps->config, "_featparams"))) {
@@ -172,6 +177,25 @@ ps_free_searches(ps_decoder_t *ps)
 
     ps->searches = NULL;
     ps->search = NULL;
+    ckd_free(ps->concurrent);
+    ps->concurrent = NULL;
+    ps->n_concurrent = 0;
+}
+
+static void
+ps_free_fsg_cache(ps_decoder_t *ps)
+{
+    hash_iter_t *itor;
+
+    if (ps->fsg_cache == NULL)
+        return;
+    for (itor = hash_table_iter(ps->fsg_cache); itor;
+         itor = hash_table_iter_next(itor)) {
+        ckd_free((char *)hash_entry_key(itor->ent));
+        fsg_model_free(hash_entry_val(itor->ent));
+    }
+    hash_table_free(ps->fsg_cache);
+    ps->fsg_cache = NULL;
 }
 
 static ps_search_t *
@@ -214,8 +238,10 @@ ps_default_search_args(cmd_ln_t *config)
 #endif
 }
 
-int
-ps_reinit(ps_decoder_t *ps, cmd_ln_t *config)
+/* Initialize or reinitialize ps, using the acoustic model of share
+ * if it is not NULL. */
+static int
+ps_reinit_shared(ps_decoder_t *ps, cmd_ln_t *config, ps_decoder_t *share)
 {
     const char *path;
     const char *keyphrase;
@@ -226,6 +252,13 @@ ps_reinit(ps_decoder_t *ps, cmd_ln_t *config)
         ps->config = cmd_ln_retain(config);
     }
 
+    /* A clone which is reinitialized no longer shares anything. */
+    if (ps->shared) {
+        --ps->shared->n_clones;
+        ps_free(ps->shared);
+        ps->shared = NULL;
+    }
+
     /* Set up logging. We need to do this earlier because we want to dump
      * the information to the configured log, not to the stderr. */
     if (config && cmd_ln_str_r(ps->config, "-logfn")) {
@@ -239,14 +272,26 @@ ps_reinit(ps_decoder_t *ps, cmd_ln_t *config)
     ps->rawlogdir = cmd_ln_str_r(ps->config, "-rawlogdir");
     ps->senlogdir = cmd_ln_str_r(ps->config, "-senlogdir");
 
+    /* Take the feature parameters from the shared model by default. */
+    if (share && cmd_ln_str_r(ps->config, "-hmm") == NULL)
+        cmd_ln_set_str_r(ps->config, "-hmm",
+                         cmd_ln_str_r(share->config, "-hmm"));
+
     /* Fill in some default arguments. */
     ps_expand_model_config(ps);
 
     /* Free old searches (do this before other reinit) */
+    /* Reloads not yet applied are for the old models. */
+    ps_spec_free(ps->spec);
+    ps->spec = NULL;
+    ps_reload_free_all(ps);
     ps_free_searches(ps);
+    ps_free_fsg_cache(ps);
     ps->searches = hash_table_new(3, HASH_CASE_YES);
 
     /* Free old acmod. */
+    ps_pipeline_free(ps->pipeline);
+    ps->pipeline = NULL;
     acmod_free(ps->acmod);
     ps->acmod = NULL;
 
@@ -258,8 +303,19 @@ ps_reinit(ps_decoder_t *ps, cmd_ln_t *config)
     dict2pid_free(ps->d2p);
     ps->d2p = NULL;
 
-    /* Logmath computation (used in acmod and search) */
-    if (ps->lmath == NULL
+    /* Logmath computation (used in acmod and search), which has to
+     * be the same as that of a shared acoustic model.  It is a copy
+     * rather than a reference, since lattices retain and release it
+     * while decoding, and the decoders may be in different threads. */
+    if (share) {
+        if (ps->lmath)
+            logmath_free(ps->lmath);
+        ps->lmath = logmath_init
+            (logmath_get_base(share->lmath),
+             logmath_get_shift(share->lmath),
+             logmath_get_table_shape(share->lmath, NULL, NULL, NULL) > 0);
+    }
+    else if (ps->lmath == NULL
         || (logmath_get_base(ps->lmath) !=
             (float64)cmd_ln_float32_r(ps->config, "-logbase"))) {
         if (ps->lmath)
@@ -271,8 +327,15 @@ ps_reinit(ps_decoder_t *ps, cmd_ln_t *config)
 
     /* Acoustic model (this is basically everything that
      * uttproc.c, senscr.c, and others used to do) */
-    if ((ps->acmod = acmod_init(ps->config, ps->lmath, NULL, NULL)) == NULL)
+    if ((ps->acmod = acmod_init_shared(ps->config, ps->lmath, NULL, NULL,
+                                       share ? share->acmod : NULL)) == NULL)
         return -1;
+    if (cmd_ln_int32_r(ps->config, "-pipeline") > 0)
+        ps->pipeline = ps_pipeline_init(ps, cmd_ln_int32_r(ps->config,
+                                                           "-pipeline"));
+    if (cmd_ln_int32_r(ps->config, "-specfinal") > 0)
+        ps->spec = ps_spec_init(ps, cmd_ln_int32_r(ps->config,
+                                                   "-specfinal"));
 
 
 
@@ -376,6 +439,28 @@ ps_reinit(ps_decoder_t *ps, cmd_ln_t *config)
         }
     }
 
+    /* N-Gram searches built from the same dictionary and language
+     * model as those of the shared decoder can use their search
+     * trees. */
+    if (share) {
+        hash_iter_t *search_it;
+        for (search_it = hash_table_iter(ps->searches); search_it;
+             search_it = hash_table_iter_next(search_it)) {
+            ps_search_t *search = hash_entry_val(search_it->ent);
+            void *other;
+
+            if (strcmp(PS_SEARCH_TYPE_NGRAM, ps_search_type(search)) != 0)
+                continue;
+            if (hash_table_lookup(share->searches,
+                                  ps_search_name(search), &other) < 0)
+                continue;
+            if (strcmp(PS_SEARCH_TYPE_NGRAM, ps_search_type(other)) != 0)
+                continue;
+            ngram_fwdtree_share((ngram_search_t *)search,
+                                (ngram_search_t *)other);
+        }
+    }
+
     /* Initialize performance timer. */
     ps->perf.name = "decode";
     ptmr_init(&ps->perf);
@@ -383,6 +468,126 @@ ps_reinit(ps_decoder_t *ps, cmd_ln_t *config)
     return 0;
 }
 
+int
+ps_reinit(ps_decoder_t *ps, cmd_ln_t *config)
+{
+    cmd_ln_t *c = config ? config : ps->config;
+    int interleave, rv;
+
+    /* Spread the models over all nodes while loading them, so that
+     * threads on every node can share them without any one node's
+     * memory being the bottleneck. */
+    interleave = cmd_ln_exists_r(c, "-numa")
+        && 0 == strcmp(cmd_ln_str_r(c, "-numa"), "interleave")
+        && sbthread_interleave(TRUE) == 0;
+    rv = ps_reinit_shared(ps, config, NULL);
+    if (interleave)
+        sbthread_interleave(FALSE);
+    return rv;
+}
+
+ps_decoder_t *
+ps_init_shared(cmd_ln_t *config, ps_decoder_t *share)
+{
+    ps_decoder_t *ps;
+
+    if (!config) {
+	E_ERROR("No configuration specified");
+	return NULL;
+    }
+    if (!share || !share->acmod) {
+	E_ERROR("No decoder to share the acoustic model with");
+	return NULL;
+    }
+
+    ps = ckd_calloc(1, sizeof(*ps));
+    ps->refcount = 1;
+    if (ps_reinit_shared(ps, config, share) < 0) {
+        ps_free(ps);
+        return NULL;
+    }
+    return ps;
+}
+
+ps_decoder_t *
+ps_clone(ps_decoder_t *ps)
+{
+    ps_decoder_t *clone;
+    hash_iter_t *search_it;
+    int i;
+
+    /* Clones of clones share the original directly. */
+    if (ps->shared)
+        ps = ps->shared;
+    if (ps->acmod == NULL || ps->dict == NULL) {
+        E_ERROR("Cannot clone a decoder which is not initialized\n");
+        return NULL;
+    }
+
+    clone = ckd_calloc(1, sizeof(*clone));
+    clone->refcount = 1;
+    clone->shared = ps_retain(ps);
+    ++ps->n_clones;
+    clone->config = cmd_ln_clone(ps->config);
+    clone->mfclogdir = ps->mfclogdir;
+    clone->rawlogdir = ps->rawlogdir;
+    clone->senlogdir = ps->senlogdir;
+    /* See ps_reinit_shared() for why the log-math is a copy. */
+    clone->lmath = logmath_init
+        (logmath_get_base(ps->lmath), logmath_get_shift(ps->lmath),
+         logmath_get_table_shape(ps->lmath, NULL, NULL, NULL) > 0);
+    if ((clone->acmod = acmod_init_shared(clone->config, clone->lmath,
+                                          NULL, NULL, ps->acmod)) == NULL)
+        goto error_out;
+    if (cmd_ln_int32_r(clone->config, "-pipeline") > 0)
+        clone->pipeline = ps_pipeline_init(clone,
+                                           cmd_ln_int32_r(clone->config,
+                                                          "-pipeline"));
+    clone->dict = dict_share(ps->dict);
+    clone->d2p = dict2pid_retain(ps->d2p);
+
+    /* Each search is cloned in its own way, the phone loop first
+     * since the others use it for lookahead. */
+    clone->searches = hash_table_new(3, HASH_CASE_YES);
+    if (ps->phone_loop) {
+        if ((clone->phone_loop = ps_search_clone(ps->phone_loop, clone->acmod,
+                                                 clone->dict)) == NULL)
+            goto error_out;
+        hash_table_enter(clone->searches, ps_search_name(clone->phone_loop),
+                         clone->phone_loop);
+    }
+    for (search_it = hash_table_iter(ps->searches); search_it;
+         search_it = hash_table_iter_next(search_it)) {
+        ps_search_t *search = hash_entry_val(search_it->ent);
+        ps_search_t *copy;
+
+        if (search == ps->phone_loop)
+            continue;
+        if (search->vt->clone == NULL
+            || (copy = ps_search_clone(search, clone->acmod,
+                                       clone->dict)) == NULL) {
+            E_ERROR("Failed to clone search %s\n", ps_search_name(search));
+            hash_table_iter_free(search_it);
+            goto error_out;
+        }
+        copy->pls = clone->phone_loop;
+        hash_table_enter(clone->searches, ps_search_name(copy), copy);
+        if (search == ps->search)
+            clone->search = copy;
+    }
+    clone->pl_window = ps->pl_window;
+    for (i = 0; i < ps->n_concurrent; ++i)
+        ps_add_concurrent_search(clone, ps_search_name(ps->concurrent[i]));
+
+    clone->perf.name = "decode";
+    ptmr_init(&clone->perf);
+    return clone;
+
+error_out:
+    ps_free(clone);
+    return NULL;
+}
+
 ps_decoder_t *
 ps_init(cmd_ln_t *config)
 {
@@ -422,12 +627,21 @@ ps_free(ps_decoder_t *ps)
         return 0;
     if (--ps->refcount > 0)
         return ps->refcount;
+    ps_spec_free(ps->spec);
+    ps_reload_free_all(ps);
     ps_free_searches(ps);
+    ps_free_fsg_cache(ps);
     dict_free(ps->dict);
     dict2pid_free(ps->d2p);
+    ps_pipeline_free(ps->pipeline);
     acmod_free(ps->acmod);
     logmath_free(ps->lmath);
     cmd_ln_free_r(ps->config);
+    if (ps->shared) {
+        --ps->shared->n_clones;
+        ps_free(ps->shared);
+    }
+    ckd_free(ps->hyp_cb_last);
     ckd_free(ps);
     return 0;
 }
@@ -459,9 +673,137 @@ ps_get_feat(ps_decoder_t *ps)
 ps_mllr_t *
 ps_update_mllr(ps_decoder_t *ps, ps_mllr_t *mllr)
 {
+    ps_spec_reset(ps->spec);
     return acmod_update_mllr(ps->acmod, mllr);
 }
 
+int
+ps_set_scorer(ps_decoder_t *ps, ps_scorer_funcs_t const *funcs,
+              void *data, int context, int batch, int lookahead)
+{
+    ps_spec_reset(ps->spec);
+    return acmod_set_scorer(ps->acmod, funcs, data, context,
+                            batch, lookahead);
+}
+
+ps_fmllr_t *
+ps_fmllr_init(ps_decoder_t *ps)
+{
+    return ps_fmllr_init_feat(ps->acmod->fcb);
+}
+
+ps_fmllr_t *
+ps_set_fmllr(ps_decoder_t *ps, ps_fmllr_t *fmllr)
+{
+    ps_spec_reset(ps->spec);
+    return acmod_set_fmllr(ps->acmod, fmllr);
+}
+
+int
+ps_accum_fmllr(ps_decoder_t *ps, ps_fmllr_t *fmllr)
+{
+    acmod_t *acmod = ps->acmod;
+    ps_alignment_t *al;
+    ps_alignment_iter_t *itor;
+    ps_search_t *search;
+    ps_seg_t *seg;
+    ps_stats_t stats;
+    float64 *post;
+    int32 n_words, n_frames, i;
+    int rv;
+
+    if (acmod->state != ACMOD_ENDED) {
+        E_ERROR("Utterance has not been ended\n");
+        return -1;
+    }
+    if (acmod_rewind(acmod) < 0)
+        return -1;
+    if ((n_frames = acmod->n_feat_frame) > MAX_INT16) {
+        E_ERROR("Utterance of %d frames is too long to align\n", n_frames);
+        acmod->output_frame = n_frames;
+        acmod->n_feat_frame = 0;
+        return -1;
+    }
+
+    /* Align the hypothesis, keeping the posterior of each word. */
+    al = ps_alignment_init(ps->d2p);
+    n_words = 0;
+    post = NULL;
+    for (seg = ps_seg_iter(ps); seg; seg = ps_seg_next(seg)) {
+        int32 wid = dict_wordid(ps->dict, seg->word);
+
+        ps_alignment_add_word(al, wid, seg->ef - seg->sf + 1);
+        post = ckd_realloc(post, (n_words + 1) * sizeof(*post));
+        post[n_words++] = dict_filler_word(ps->dict, wid)
+            ? 0.0 : logmath_exp(ps->lmath, seg->prob);
+    }
+    rv = -1;
+    ps_alignment_populate(al);
+    if (n_words == 0 || ps_alignment_n_states(al) > n_frames) {
+        E_ERROR("Cannot align hypothesis of %d words to %d frames\n",
+                n_words, n_frames);
+        search = NULL;
+    }
+    else if ((search = state_align_search_init("fmllr", ps->config,
+                                               acmod, al)) != NULL) {
+        /* This is not part of decoding, so it does not count. */
+        stats = acmod->stats;
+        ps_search_start(search);
+        while (acmod->n_feat_frame > 0) {
+            ps_search_step(search, acmod->output_frame);
+            acmod_advance(acmod);
+        }
+        rv = ps_search_finish(search);
+        acmod->stats = stats;
+    }
+    if (rv < 0) {
+        acmod->output_frame = n_frames;
+        acmod->n_feat_frame = 0;
+    }
+    else {
+        int32 n_accum = 0;
+
+        itor = ps_alignment_states(al);
+        while (itor && rv == 0) {
+            ps_alignment_entry_t *ent = ps_alignment_iter_get(itor);
+            int32 w = al->sseq.seq[ent->parent].parent;
+
+            for (i = ent->start; i < ent->start + ent->duration
+                     && post[w] > 0.0 && rv == 0; ++i) {
+                rv = acmod_fmllr_accum(acmod, fmllr, i,
+                                       ent->id.senid, post[w]);
+                ++n_accum;
+            }
+            itor = ps_alignment_iter_next(itor);
+        }
+        ps_alignment_iter_free(itor);
+        if (rv == 0)
+            rv = n_accum;
+    }
+    if (search)
+        ps_search_free(search);
+    ps_alignment_free(al);
+    ckd_free(post);
+
+    return rv;
+}
+
+/* Stop running a search alongside the active one, if it was. */
+static void
+ps_drop_concurrent(ps_decoder_t *ps, ps_search_t *search)
+{
+    int i;
+
+    for (i = 0; i < ps->n_concurrent; ++i) {
+        if (ps->concurrent[i] == search) {
+            memmove(ps->concurrent + i, ps->concurrent + i + 1,
+                    (ps->n_concurrent - i - 1) * sizeof(*ps->concurrent));
+            --ps->n_concurrent;
+            return;
+        }
+    }
+}
+
 int
 ps_set_search(ps_decoder_t *ps, const char *name)
 {
@@ -476,6 +818,8 @@ ps_set_search(ps_decoder_t *ps, const char *name)
         return -1;
     }
 
+    /* It no longer runs alongside itself. */
+    ps_drop_concurrent(ps, search);
     ps->search = search;
     /* Set pl window depending on the search */
     if (!strcmp(PS_SEARCH_TYPE_NGRAM, ps_search_type(search))) {
@@ -496,6 +840,7 @@ ps_get_search(ps_decoder_t *ps)
         search_it = hash_table_iter_next(search_it)) {
         if (hash_entry_val(search_it->ent) == ps->search) {
             name = hash_entry_key(search_it->ent);
+            hash_table_iter_free(search_it);
             break;
         }
     }
@@ -508,12 +853,68 @@ ps_unset_search(ps_decoder_t *ps, const char *name)
     ps_search_t *search = hash_table_delete(ps->searches, name);
     if (!search)
         return -1;
+    ps_spec_reset(ps->spec);
     if (ps->search == search)
         ps->search = NULL;
+    ps_drop_concurrent(ps, search);
     ps_search_free(search);
     return 0;
 }
 
+int
+ps_add_concurrent_search(ps_decoder_t *ps, const char *name)
+{
+    ps_search_t *search;
+    int i;
+
+    if (ps->acmod->state != ACMOD_ENDED && ps->acmod->state != ACMOD_IDLE) {
+        E_ERROR("Cannot change search while decoding, end utterance first\n");
+        return -1;
+    }
+    if (!(search = ps_find_search(ps, name)))
+        return -1;
+    if (search == ps->search || search == ps->phone_loop) {
+        E_ERROR("Search %s is already running\n", name);
+        return -1;
+    }
+    for (i = 0; i < ps->n_concurrent; ++i)
+        if (ps->concurrent[i] == search)
+            return 0;
+    ps->concurrent = ckd_realloc(ps->concurrent, (ps->n_concurrent + 1)
+                                 * sizeof(*ps->concurrent));
+    ps->concurrent[ps->n_concurrent++] = search;
+    return 0;
+}
+
+int
+ps_clear_concurrent_searches(ps_decoder_t *ps)
+{
+    if (ps->acmod->state != ACMOD_ENDED && ps->acmod->state != ACMOD_IDLE) {
+        E_ERROR("Cannot change search while decoding, end utterance first\n");
+        return -1;
+    }
+    ps->n_concurrent = 0;
+    return 0;
+}
+
+void
+ps_replace_search(ps_decoder_t *ps, ps_search_t *search)
+{
+    ps_search_t *old;
+    int i;
+
+    search->pls = ps->phone_loop;
+    old = hash_table_replace(ps->searches, ps_search_name(search), search);
+    if (old == search)
+        return;
+    if (ps->search == old)
+        ps->search = search;
+    for (i = 0; i < ps->n_concurrent; ++i)
+        if (ps->concurrent[i] == old)
+            ps->concurrent[i] = search;
+    ps_search_free(old);
+}
+
 ps_search_iter_t *
 ps_search_iter(ps_decoder_t *ps)
 {
@@ -568,15 +969,11 @@ ps_get_kws(ps_decoder_t *ps, const char* name)
 static int
 set_search_internal(ps_decoder_t *ps, ps_search_t *search)
 {
-    ps_search_t *old_search;
-    
     if (!search)
 	return -1;
 
-    search->pls = ps->phone_loop;
-    old_search = (ps_search_t *) hash_table_replace(ps->searches, ps_search_name(search), search);
-    if (old_search != search)
-        ps_search_free(old_search);
+    ps_spec_reset(ps->spec);
+    ps_replace_search(ps, search);
 
     return 0;
 }
@@ -651,18 +1048,14 @@ ps_set_fsg(ps_decoder_t *ps, const char *name, fsg_model_t *fsg)
     return set_search_internal(ps, search);
 }
 
-int 
-ps_set_jsgf_file(ps_decoder_t *ps, const char *name, const char *path)
+/* Compile the top rule of a JSGF grammar (-toprule, or the first
+ * public one) to an optimized FSG. */
+static fsg_model_t *
+ps_build_jsgf(ps_decoder_t *ps, jsgf_t *jsgf, char const *source)
 {
-  fsg_model_t *fsg;
+  fsg_model_t *fsg, *opt;
   jsgf_rule_t *rule;
   char const *toprule;
-  jsgf_t *jsgf = jsgf_parse_file(path, NULL);
-  float lw;
-  int result;
-
-  if (!jsgf)
-      return -1;
 
   rule = NULL;
   /* Take the -toprule if specified. */
@@ -670,65 +1063,81 @@ ps_set_jsgf_file(ps_decoder_t *ps, const char *name, const char *path)
       rule = jsgf_get_rule(jsgf, toprule);
       if (rule == NULL) {
           E_ERROR("Start rule %s not found\n", toprule);
-          jsgf_grammar_free(jsgf);
-          return -1;
+          return NULL;
       }
   } else {
       rule = jsgf_get_public_rule(jsgf);
       if (rule == NULL) {
-          E_ERROR("No public rules found in %s\n", path);
-          jsgf_grammar_free(jsgf);
-          return -1;
+          E_ERROR("No public rules found in %s\n", source);
+          return NULL;
       }
   }
 
-  lw = cmd_ln_float32_r(ps->config, "-lw");
-  fsg = jsgf_build_fsg(jsgf, rule, ps->lmath, lw);
-  result = ps_set_fsg(ps, name, fsg);
+  fsg = jsgf_build_fsg(jsgf, rule, ps->lmath,
+                       cmd_ln_float32_r(ps->config, "-lw"));
+  opt = fsg_model_optimize(fsg);
   fsg_model_free(fsg);
-  jsgf_grammar_free(jsgf);
-  return result;
+  return opt;
 }
 
 int 
-ps_set_jsgf_string(ps_decoder_t *ps, const char *name, const char *jsgf_string)
+ps_set_jsgf_file(ps_decoder_t *ps, const char *name, const char *path)
 {
   fsg_model_t *fsg;
-  jsgf_rule_t *rule;
-  char const *toprule;
-  jsgf_t *jsgf = jsgf_parse_string(jsgf_string, NULL);
-  float lw;
+  jsgf_t *jsgf = jsgf_parse_file(path, NULL);
   int result;
 
   if (!jsgf)
       return -1;
-
-  rule = NULL;
-  /* Take the -toprule if specified. */
-  if ((toprule = cmd_ln_str_r(ps->config, "-toprule"))) {
-      rule = jsgf_get_rule(jsgf, toprule);
-      if (rule == NULL) {
-          E_ERROR("Start rule %s not found\n", toprule);
-          jsgf_grammar_free(jsgf);
-          return -1;
-      }
-  } else {
-      rule = jsgf_get_public_rule(jsgf);
-      if (rule == NULL) {
-          E_ERROR("No public rules found in input string\n");
-          jsgf_grammar_free(jsgf);
-          return -1;
-      }
-  }
-
-  lw = cmd_ln_float32_r(ps->config, "-lw");
-  fsg = jsgf_build_fsg(jsgf, rule, ps->lmath, lw);
+  fsg = ps_build_jsgf(ps, jsgf, path);
+  jsgf_grammar_free(jsgf);
+  if (fsg == NULL)
+      return -1;
   result = ps_set_fsg(ps, name, fsg);
   fsg_model_free(fsg);
-  jsgf_grammar_free(jsgf);
   return result;
 }
 
+int 
+ps_set_jsgf_string(ps_decoder_t *ps, const char *name, const char *jsgf_string)
+{
+  fsg_model_t *fsg;
+  jsgf_t *jsgf;
+  char const *toprule;
+  char *key;
+  void *val;
+  size_t len;
+
+  /* Applications often switch back and forth between the same few
+   * grammars, so keep each compiled one, keyed by its text and the
+   * parameters it was compiled with. */
+  toprule = cmd_ln_str_r(ps->config, "-toprule");
+  len = strlen(jsgf_string) + (toprule ? strlen(toprule) : 0) + 32;
+  key = ckd_malloc(len);
+  sprintf(key, "%g\n%s\n%s", cmd_ln_float32_r(ps->config, "-lw"),
+          toprule ? toprule : "", jsgf_string);
+  if (ps->fsg_cache == NULL)
+      ps->fsg_cache = hash_table_new(8, HASH_CASE_YES);
+  if (hash_table_lookup(ps->fsg_cache, key, &val) == 0) {
+      E_INFO("Using cached FSG for grammar %s\n", fsg_model_name((fsg_model_t *)val));
+      ckd_free(key);
+      return ps_set_fsg(ps, name, val);
+  }
+
+  if ((jsgf = jsgf_parse_string(jsgf_string, NULL)) == NULL) {
+      ckd_free(key);
+      return -1;
+  }
+  fsg = ps_build_jsgf(ps, jsgf, "input string");
+  jsgf_grammar_free(jsgf);
+  if (fsg == NULL) {
+      ckd_free(key);
+      return -1;
+  }
+  /* The cache keeps the reference we got. */
+  hash_table_enter(ps->fsg_cache, key, fsg);
+  return ps_set_fsg(ps, name, fsg);
+}
 
 int
 ps_load_dict(ps_decoder_t *ps, char const *dictfile,
@@ -736,9 +1145,13 @@ ps_load_dict(ps_decoder_t *ps, char const *dictfile,
 {
     dict2pid_t *d2p;
     dict_t *dict;
-    hash_iter_t *search_it;
     cmd_ln_t *newconfig;
+    int rv;
 
+    if (ps->shared || ps->n_clones) {
+        E_ERROR("Cannot change the dictionary of a cloned decoder\n");
+        return -1;
+    }
     /* Create a new scratch config to load this dict (so existing one
      * won't be affected if it fails) */
     newconfig = cmd_ln_init(NULL, ps_args(), TRUE, NULL);
@@ -766,15 +1179,31 @@ ps_load_dict(ps_decoder_t *ps, char const *dictfile,
     /* Success!  Update the existing config to reflect new dicts and
      * drop everything into place. */
     cmd_ln_free_r(newconfig);
+    rv = ps_replace_dict(ps, dict, d2p);
+    dict_free(dict);
+    dict2pid_free(d2p);
+    return rv;
+}
+
+int
+ps_replace_dict(ps_decoder_t *ps, dict_t *dict, dict2pid_t *d2p)
+{
+    hash_iter_t *search_it;
+
+    ps_spec_reset(ps->spec);
+    ps_free_fsg_cache(ps);
     dict_free(ps->dict);
-    ps->dict = dict;
+    ps->dict = dict_retain(dict);
     dict2pid_free(ps->d2p);
-    ps->d2p = d2p;
+    ps->d2p = dict2pid_retain(d2p);
 
     /* And tell all searches to reconfigure themselves. */
     for (search_it = hash_table_iter(ps->searches); search_it;
        search_it = hash_table_iter_next(search_it)) {
-        if (ps_search_reinit(hash_entry_val(search_it->ent), dict, d2p) < 0) {
+        ps_search_t *search = hash_entry_val(search_it->ent);
+        if (ps_search_dict(search) == dict)
+            continue;
+        if (ps_search_reinit(search, dict, d2p) < 0) {
             hash_table_iter_free(search_it);
             return -1;
         }
@@ -802,6 +1231,10 @@ ps_add_word(ps_decoder_t *ps,
     char **phonestr, *tmp;
     int np, i, rv;
 
+    if (ps->shared || ps->n_clones) {
+        E_ERROR("Cannot add words to a cloned decoder\n");
+        return -1;
+    }
     /* Parse phones into an array of phone IDs. */
     tmp = ckd_salloc(phones);
     np = str2words(tmp, NULL, 0);
@@ -824,6 +1257,7 @@ ps_add_word(ps_decoder_t *ps,
     ckd_free(tmp);
 
     /* Add it to the dictionary. */
+    ps_spec_reset(ps->spec);
     if ((wid = dict_add_word(ps->dict, word, pron, np)) == -1) {
         ckd_free(pron);
         return -1;
@@ -833,6 +1267,8 @@ ps_add_word(ps_decoder_t *ps,
 
     /* Now we also have to add it to dict2pid. */
     dict2pid_add_word(ps->d2p, wid);
+    /* Cached grammars may be missing its alternate pronunciations. */
+    ps_free_fsg_cache(ps);
 
     /* TODO: we definitely need to refactor this */
     for (search_it = hash_table_iter(ps->searches); search_it;
@@ -934,7 +1370,7 @@ ps_start_stream(ps_decoder_t *ps)
 int
 ps_start_utt(ps_decoder_t *ps)
 {
-    int rv;
+    int rv, i;
     char uttid[16];
     
     if (ps->acmod->state == ACMOD_STARTED || ps->acmod->state == ACMOD_PROCESSING) {
@@ -942,6 +1378,10 @@ ps_start_utt(ps_decoder_t *ps)
 	return -1;
     }
 
+    /* Language models and dictionaries prepared in the meantime go
+     * in between utterances. */
+    ps_reload_apply(ps);
+
     if (ps->search == NULL) {
         E_ERROR("No search module is selected, did you forget to "
                 "specify a language model or grammar?\n");
@@ -957,12 +1397,23 @@ ps_start_utt(ps_decoder_t *ps)
     /* Remove any residual word lattice and hypothesis. */
     ps_lattice_free(ps->search->dag);
     ps->search->dag = NULL;
+    for (i = 0; i < ps->n_concurrent; ++i) {
+        ps_lattice_free(ps->concurrent[i]->dag);
+        ps->concurrent[i]->dag = NULL;
+    }
     ps->search->last_link = NULL;
     ps->search->post = 0;
     ckd_free(ps->search->hyp_str);
     ps->search->hyp_str = NULL;
+    ckd_free(ps->hyp_cb_last);
+    ps->hyp_cb_last = NULL;
+    ps->hyp_cb_next = ps->n_frame + ps->hyp_cb_frames;
+    if (ps->spec)
+        ps_spec_start_utt(ps->spec);
     if ((rv = acmod_start_utt(ps->acmod)) < 0)
         return rv;
+    if (ps->pipeline)
+        ps_pipeline_start_utt(ps->pipeline);
 
     /* Start logging features and audio if requested. */
     if (ps->mfclogdir) {
@@ -1009,9 +1460,57 @@ ps_start_utt(ps_decoder_t *ps)
     if (ps->phone_loop)
         ps_search_start(ps->phone_loop);
 
+    /* Searches running alongside share the scores of the senones
+     * they have in common with this one in each frame. */
+    if (ps->n_concurrent > 0)
+        acmod_set_senscr_cache(ps->acmod, 1);
+    for (i = 0; i < ps->n_concurrent; ++i)
+        if ((rv = ps_search_start(ps->concurrent[i])) < 0)
+            return rv;
+
     return ps_search_start(ps->search);
 }
 
+/* Pass the partial hypothesis to the callback if it has changed. */
+static void
+ps_report_hyp(ps_decoder_t *ps)
+{
+    char const *hyp;
+    int32 score;
+
+    ps->hyp_cb_next = ps->n_frame + ps->hyp_cb_frames;
+    hyp = ps_search_hyp(ps->search, &score);
+    if (hyp == NULL
+        || (ps->hyp_cb_last && 0 == strcmp(hyp, ps->hyp_cb_last)))
+        return;
+    ckd_free(ps->hyp_cb_last);
+    ps->hyp_cb_last = ckd_salloc(hyp);
+    (*ps->hyp_cb)(ps->hyp_cb_data, hyp, score);
+}
+
+int
+ps_search_frame(ps_decoder_t *ps, int frame_idx)
+{
+    int k, i;
+
+    if (ps->pl_window > 0)
+        if ((k = ps_search_step(ps->phone_loop, frame_idx)) < 0)
+            return k;
+    if (frame_idx >= ps->pl_window) {
+        if ((k = ps_search_step(ps->search,
+                                frame_idx - ps->pl_window)) < 0)
+            return k;
+        for (i = 0; i < ps->n_concurrent; ++i)
+            if ((k = ps_search_step(ps->concurrent[i],
+                                    frame_idx - ps->pl_window)) < 0)
+                return k;
+    }
+    ++ps->n_frame;
+    if (ps->hyp_cb && ps->n_frame >= ps->hyp_cb_next)
+        ps_report_hyp(ps);
+    return 0;
+}
+
 static int
 ps_search_forward(ps_decoder_t *ps)
 {
@@ -1020,15 +1519,9 @@ ps_search_forward(ps_decoder_t *ps)
     nfr = 0;
     while (ps->acmod->n_feat_frame > 0) {
         int k;
-        if (ps->pl_window > 0)
-            if ((k = ps_search_step(ps->phone_loop, ps->acmod->output_frame)) < 0)
-                return k;
-        if (ps->acmod->output_frame >= ps->pl_window)
-            if ((k = ps_search_step(ps->search,
-                                    ps->acmod->output_frame - ps->pl_window)) < 0)
-                return k;
+        if ((k = ps_search_frame(ps, ps->acmod->output_frame)) < 0)
+            return k;
         acmod_advance(ps->acmod);
-        ++ps->n_frame;
         ++nfr;
     }
     return nfr;
@@ -1071,6 +1564,12 @@ ps_process_raw(ps_decoder_t *ps,
 
     if (no_search)
         acmod_set_grow(ps->acmod, TRUE);
+    else if (ps->pipeline && !ps->acmod->senfh) {
+        if ((n_searchfr = ps_pipeline_process_raw(ps->pipeline, data,
+                                                  n_samples, full_utt)) < 0)
+            return n_searchfr;
+        n_samples = 0;
+    }
 
     while (n_samples) {
         int nfr;
@@ -1088,6 +1587,10 @@ ps_process_raw(ps_decoder_t *ps,
         n_searchfr += nfr;
     }
 
+    /* See if the speech has ended, or come back. */
+    if (ps->spec && !no_search)
+        ps_spec_update(ps->spec);
+
     return n_searchfr;
 }
 
@@ -1102,6 +1605,9 @@ ps_process_cep(ps_decoder_t *ps,
 
     if (no_search)
         acmod_set_grow(ps->acmod, TRUE);
+    else if (ps->pipeline && !ps->acmod->senfh)
+        return ps_pipeline_process_cep(ps->pipeline, data,
+                                       n_frames, full_utt);
 
     while (n_frames) {
         int nfr;
@@ -1131,13 +1637,21 @@ ps_end_utt(ps_decoder_t *ps)
 	E_ERROR("Utterance is not started\n");
 	return -1;
     }
-    acmod_end_utt(ps->acmod);
-
     /* Search any remaining frames. */
-    if ((rv = ps_search_forward(ps)) < 0) {
+    if (ps->pipeline && !ps->acmod->senfh)
+        rv = ps_pipeline_end_utt(ps->pipeline);
+    else {
+        acmod_end_utt(ps->acmod);
+        rv = ps_search_forward(ps);
+    }
+    if (rv < 0) {
         ptmr_stop(&ps->perf);
         return rv;
     }
+    /* If the speech had ended when a clone started searching, its
+     * result is the same, and there is only cleaning up to do. */
+    if (ps->spec && ps_spec_end_utt(ps->spec))
+        ps->search->discard = TRUE;
     /* Finish phone loop search. */
     if (ps->phone_loop) {
         if ((rv = ps_search_finish(ps->phone_loop)) < 0) {
@@ -1148,14 +1662,28 @@ ps_end_utt(ps_decoder_t *ps)
     /* Search any frames remaining in the lookahead window. */
     if (ps->acmod->output_frame >= ps->pl_window) {
         for (i = ps->acmod->output_frame - ps->pl_window;
-             i < ps->acmod->output_frame; ++i)
+             i < ps->acmod->output_frame; ++i) {
+            int j;
+
             ps_search_step(ps->search, i);
+            for (j = 0; j < ps->n_concurrent; ++j)
+                ps_search_step(ps->concurrent[j], i);
+        }
     }
     /* Finish main search. */
-    if ((rv = ps_search_finish(ps->search)) < 0) {
+    rv = ps_search_finish(ps->search);
+    ps->search->discard = FALSE;
+    if (rv < 0) {
         ptmr_stop(&ps->perf);
         return rv;
     }
+    /* And the ones alongside it. */
+    for (i = 0; i < ps->n_concurrent; ++i) {
+        if ((rv = ps_search_finish(ps->concurrent[i])) < 0) {
+            ptmr_stop(&ps->perf);
+            return rv;
+        }
+    }
     ptmr_stop(&ps->perf);
 
     /* Log a backtrace if requested. */
@@ -1188,22 +1716,75 @@ ps_end_utt(ps_decoder_t *ps)
     return rv;
 }
 
+/* Get the decoder with the result of the last utterance, which is a
+ * clone of ps if it was finished speculatively. */
+static ps_decoder_t *
+ps_result(ps_decoder_t *ps)
+{
+    ps_decoder_t *clone;
+
+    if (ps->spec && (clone = ps_spec_result(ps->spec)) != NULL)
+        return clone;
+    return ps;
+}
+
 char const *
 ps_get_hyp(ps_decoder_t *ps, int32 *out_best_score)
 {
     char const *hyp;
 
+    ps = ps_result(ps);
     ptmr_start(&ps->perf);
     hyp = ps_search_hyp(ps->search, out_best_score);
     ptmr_stop(&ps->perf);
     return hyp;
 }
 
+char const *
+ps_get_search_hyp(ps_decoder_t *ps, const char *name, int32 *out_best_score)
+{
+    ps_search_t *search;
+    char const *hyp;
+    int i;
+
+    if (!(search = ps_find_search(ps, name)))
+        return NULL;
+    if (search == ps->search)
+        return ps_get_hyp(ps, out_best_score);
+    for (i = 0; i < ps->n_concurrent; ++i)
+        if (ps->concurrent[i] == search)
+            break;
+    if (i == ps->n_concurrent) {
+        E_ERROR("Search %s is not running\n", name);
+        return NULL;
+    }
+    ptmr_start(&ps->perf);
+    hyp = ps_search_hyp(search, out_best_score);
+    ptmr_stop(&ps->perf);
+    return hyp;
+}
+
+int
+ps_set_hyp_callback(ps_decoder_t *ps, ps_hyp_cb_f callback,
+                    void *user_data, int min_frames)
+{
+    if (min_frames < 1) {
+        E_ERROR("Partial hypotheses must be checked at least every frame\n");
+        return -1;
+    }
+    ps->hyp_cb = callback;
+    ps->hyp_cb_data = user_data;
+    ps->hyp_cb_frames = min_frames;
+    ps->hyp_cb_next = ps->n_frame + min_frames;
+    return 0;
+}
+
 int32
 ps_get_prob(ps_decoder_t *ps)
 {
     int32 prob;
 
+    ps = ps_result(ps);
     ptmr_start(&ps->perf);
     prob = ps_search_prob(ps->search);
     ptmr_stop(&ps->perf);
@@ -1215,6 +1796,7 @@ ps_seg_iter(ps_decoder_t *ps)
 {
     ps_seg_t *itor;
 
+    ps = ps_result(ps);
     ptmr_start(&ps->perf);
     itor = ps_search_seg_iter(ps->search);
     ptmr_stop(&ps->perf);
@@ -1257,9 +1839,76 @@ ps_seg_free(ps_seg_t *seg)
     ps_search_seg_free(seg);
 }
 
+int
+ps_get_segs(ps_decoder_t *ps, ps_seg_info_t *segs, int n_segs,
+            char *hyp, size_t hyp_size, int32 *out_best_score)
+{
+    ps_search_t *search;
+    char const *str;
+    int n, i, uf, have_str;
+
+    ps = ps_result(ps);
+    search = ps->search;
+    if (search == NULL || search->vt->seg_iter == NULL)
+        return 0;
+    ptmr_start(&ps->perf);
+    n = -1;
+    str = NULL;
+    have_str = FALSE;
+    if (search->vt->segs)
+        n = (*search->vt->segs)(search, segs, n_segs, out_best_score);
+    if (n < 0) {
+        ps_seg_t *itor;
+
+        /* Get the string now too, as this may be what searches the
+         * lattice for the best path. */
+        str = ps_search_hyp(search, out_best_score);
+        have_str = TRUE;
+        n = 0;
+        for (itor = ps_search_seg_iter(search); itor;
+             itor = ps_search_seg_next(itor), ++n) {
+            if (n >= n_segs)
+                continue;
+            segs[n].wid = dict_wordid(search->dict, itor->word);
+            segs[n].sf = itor->sf;
+            segs[n].ef = itor->ef;
+            segs[n].ascr = itor->ascr;
+            segs[n].lscr = itor->lscr;
+        }
+    }
+    uf = acmod_stream_offset(search->acmod);
+    for (i = 0; i < n && i < n_segs; ++i) {
+        segs[i].sf += uf;
+        segs[i].ef += uf;
+    }
+    if (hyp && hyp_size > 0) {
+        size_t len;
+
+        if (!have_str && n > 0)
+            str = ps_search_hyp(search, NULL);
+        len = str ? strlen(str) : 0;
+        if (len >= hyp_size)
+            len = hyp_size - 1;
+        if (len > 0)
+            memcpy(hyp, str, len);
+        hyp[len] = '\0';
+    }
+    ptmr_stop(&ps->perf);
+    return n;
+}
+
+char const *
+ps_word_str(ps_decoder_t *ps, int32 wid)
+{
+    if (wid < 0 || wid >= dict_size(ps->dict))
+        return NULL;
+    return dict_wordstr(ps->dict, wid);
+}
+
 ps_lattice_t *
 ps_get_lattice(ps_decoder_t *ps)
 {
+    ps = ps_result(ps);
     return ps_search_lattice(ps->search);
 }
 
@@ -1271,6 +1920,7 @@ ps_nbest(ps_decoder_t *ps)
     ps_astar_t *nbest;
     float32 lwf;
 
+    ps = ps_result(ps);
     if (ps->search == NULL)
         return NULL;
     if ((dag = ps_get_lattice(ps)) == NULL)
@@ -1287,7 +1937,9 @@ ps_nbest(ps_decoder_t *ps)
         lwf = ((ngram_search_t *)ps->search)->bestpath_fwdtree_lw_ratio;
     }
 
-    nbest = ps_astar_start(dag, lmset, lwf, 0, -1, -1, -1);
+    nbest = ps_astar_start(dag, lmset, lwf, 0, -1, -1, -1,
+                           cmd_ln_int32_r(ps->config, "-nbestpaths"),
+                           cmd_ln_int32_r(ps->config, "-nbeststack"));
 
     nbest = ps_nbest_next(nbest);
 
@@ -1333,6 +1985,45 @@ ps_nbest_seg(ps_nbest_t *nbest)
     return ps_astar_seg_iter(nbest, nbest->top, 1.0);
 }
 
+ps_cn_t *
+ps_get_cn(ps_decoder_t *ps)
+{
+    ps_lattice_t *dag;
+    ps_cn_t *cn;
+
+    ps = ps_result(ps);
+    if (ps->search == NULL)
+        return NULL;
+    if ((dag = ps_get_lattice(ps)) == NULL)
+        return NULL;
+
+    ptmr_start(&ps->perf);
+    /* Posteriors are computed along with the best path, but only if
+     * -bestpath is enabled, otherwise do it here. */
+    ps_search_prob(ps->search);
+    if (ps->search->last_link == NULL) {
+        ngram_model_t *lmset;
+        float32 lwf, ascale;
+
+        if (0 != strcmp(ps_search_type(ps->search), PS_SEARCH_TYPE_NGRAM)) {
+            lmset = NULL;
+            lwf = 1.0f;
+        } else {
+            lmset = ((ngram_search_t *)ps->search)->lmset;
+            lwf = ((ngram_search_t *)ps->search)->bestpath_fwdtree_lw_ratio;
+        }
+        ascale = 1.0f / cmd_ln_float32_r(ps->config, "-ascale");
+        if (ps_lattice_bestpath(dag, lmset, lwf, ascale) == NULL) {
+            ptmr_stop(&ps->perf);
+            return NULL;
+        }
+        ps_lattice_posterior(dag, lmset, ascale);
+    }
+    cn = ps_lattice_cn(dag, logmath_log(ps->lmath, 1e-4));
+    ptmr_stop(&ps->perf);
+    return cn;
+}
+
 int
 ps_get_n_frames(ps_decoder_t *ps)
 {
@@ -1363,6 +2054,41 @@ ps_get_all_time(ps_decoder_t *ps, double *out_nspeech,
     *out_nwall = ps->perf.t_tot_elapsed;
 }
 
+void
+ps_get_stats(ps_decoder_t *ps, ps_stats_t *out_utt, ps_stats_t *out_all)
+{
+    acmod_get_stats(ps->acmod, out_utt, out_all);
+}
+
+void
+ps_get_memory_report(ps_decoder_t *ps, ps_mem_t *out_mem)
+{
+    /* Clones share the dictionary and model definition with the
+     * decoder they came from. */
+    int shared = ps->shared || ps->n_clones > 0;
+    hash_iter_t *itor;
+
+    memset(out_mem, 0, PS_N_MEM_PARTS * sizeof(*out_mem));
+    acmod_get_memory(ps->acmod, shared,
+                     &out_mem[PS_MEM_ACMOD], &out_mem[PS_MEM_MGAU]);
+    out_mem[PS_MEM_DICT].heap += sizeof(dict_t);
+    ps_mem_add_heap(&out_mem[PS_MEM_DICT],
+                    dict_mem_size(ps->dict) - sizeof(dict_t), shared);
+    ps_mem_add_heap(&out_mem[PS_MEM_DICT2PID],
+                    dict2pid_mem_size(ps->d2p), shared);
+    if (ps->searches == NULL)
+        return;
+    for (itor = hash_table_iter(ps->searches); itor;
+         itor = hash_table_iter_next(itor)) {
+        ps_search_t *search = hash_entry_val(itor->ent);
+        if (search->vt->mem)
+            (*search->vt->mem)(search, out_mem);
+        if (ps_search_dag(search))
+            out_mem[PS_MEM_LATTICE].heap
+                += ps_lattice_mem_size(ps_search_dag(search));
+    }
+}
+
 uint8 
 ps_get_in_speech(ps_decoder_t *ps)
 {
@@ -1449,3 +2175,10 @@ ps_get_rawdata(ps_decoder_t *ps, int16 **buffer, int32 *size)
 {
     acmod_get_rawdata(ps->acmod, buffer, size);
 }
+
+int
+ps_get_rawdata_parts(ps_decoder_t *ps, int16 const *out_parts[2],
+                     int32 out_sizes[2])
+{
+    return acmod_get_rawdata_parts(ps->acmod, out_parts, out_sizes);
+}
@@ -51,6 +51,8 @@
 #include <sphinxbase/hash_table.h>
 #include <sphinxbase/logmath.h>
 #include <sphinxbase/profile.h>
+#include <sphinxbase/glist.h>
+#include <sphinxbase/sbthread.h>
 
 /* Local headers. */
 #include "pocketsphinx.h"
@@ -63,6 +65,16 @@
  */
 typedef struct ps_search_s ps_search_t;
 
+/**
+ * Thread computing senone scores ahead of the search.
+ */
+typedef struct ps_pipeline_s ps_pipeline_t;
+
+/**
+ * Thread finishing utterances speculatively.
+ */
+typedef struct ps_spec_s ps_spec_t;
+
 
 /* Search names*/
 #define PS_DEFAULT_SEARCH  "_default"
@@ -90,6 +102,26 @@ typedef struct ps_searchfuncs_s {
     char const *(*hyp)(ps_search_t *search, int32 *out_score);
     int32 (*prob)(ps_search_t *search);
     ps_seg_t *(*seg_iter)(ps_search_t *search);
+    /**
+     * Create a search like this one for another decoder (optional),
+     * sharing whatever it can, see ps_clone().
+     */
+    ps_search_t *(*clone)(ps_search_t *search, acmod_t *acmod, dict_t *dict);
+
+    /**
+     * Add up the memory used by the search (optional), into
+     * out_mem[PS_MEM_SEARCH] and, for language models,
+     * out_mem[PS_MEM_LM].
+     */
+    void (*mem)(ps_search_t *search, ps_mem_t *out_mem);
+
+    /**
+     * Fill in the segments of the best hypothesis without allocating
+     * (optional), see ps_get_segs().  Frames are relative to the
+     * utterance.  Returns <0 if seg_iter() has to be used instead.
+     */
+    int (*segs)(ps_search_t *search, ps_seg_info_t *segs, int n_segs,
+                int32 *out_score);
 } ps_searchfuncs_t;
 
 /**
@@ -112,6 +144,8 @@ struct ps_search_s {
     int32 post;            /**< Utterance posterior probability. */
     int32 n_words;         /**< Number of words known to search (may
                               be less than in the dictionary) */
+    uint8 discard;         /**< Whether finish() only has to clean up,
+                              since the result is not wanted. */
 
     /* Magical word IDs that must exist in the dictionary: */
     int32 start_wid;       /**< Start word ID. */
@@ -141,6 +175,7 @@ struct ps_search_s {
 #define ps_search_hyp(s,sc) (*(ps_search_base(s)->vt->hyp))(s,sc)
 #define ps_search_prob(s) (*(ps_search_base(s)->vt->prob))(s)
 #define ps_search_seg_iter(s) (*(ps_search_base(s)->vt->seg_iter))(s)
+#define ps_search_clone(s,a,d) (*(ps_search_base(s)->vt->clone))(s,a,d)
 
 /* For convenience... */
 #define ps_search_silence_wid(s) ps_search_base(s)->silence_wid
@@ -202,6 +237,8 @@ struct ps_decoder_s {
     /* Model parameters and such. */
     cmd_ln_t *config;  /**< Configuration. */
     int refcount;      /**< Reference count. */
+    ps_decoder_t *shared; /**< Decoder this is a clone of, or NULL. */
+    int n_clones;      /**< Number of clones of this decoder. */
 
     /* Basic units of computation. */
     acmod_t *acmod;    /**< Acoustic model. */
@@ -211,11 +248,14 @@ struct ps_decoder_s {
 
     /* Search modules. */
     hash_table_t *searches;        /**< Set of search modules. */
+    hash_table_t *fsg_cache;       /**< Compiled JSGF grammars by text. */
     /* TODO: Convert this to a stack of searches each with their own
      * lookahead value. */
     ps_search_t *search;     /**< Currently active search module. */
     ps_search_t *phone_loop; /**< Phone loop search for lookahead. */
     int pl_window;           /**< Window size for phoneme lookahead. */
+    ps_search_t **concurrent; /**< Searches run alongside the active one. */
+    int n_concurrent;        /**< Number of searches in concurrent. */
 
     /* Utterance-processing related stuff. */
     uint32 uttno;       /**< Utterance counter. */
@@ -224,8 +264,128 @@ struct ps_decoder_s {
     char const *mfclogdir; /**< Log directory for MFCC files. */
     char const *rawlogdir; /**< Log directory for audio files. */
     char const *senlogdir; /**< Log directory for senone score files. */
+
+    /* Partial hypothesis reporting. */
+    ps_hyp_cb_f hyp_cb;    /**< Callback for partial hypotheses, or NULL. */
+    void *hyp_cb_data;     /**< Data to pass to hyp_cb. */
+    int hyp_cb_frames;     /**< Frames between checks for hyp_cb. */
+    uint32 hyp_cb_next;    /**< Value of n_frame at next check. */
+    char *hyp_cb_last;     /**< Last hypothesis passed to hyp_cb. */
+
+    /* Reloads, see ps_reload.h. */
+    sbmtx_t *reload_mtx;   /**< Held while preparing or applying a reload. */
+    glist_t reloads;       /**< Committed reloads, most recent first. */
+
+    ps_pipeline_t *pipeline; /**< Scoring thread for -pipeline, or NULL. */
+    ps_spec_t *spec;         /**< Speculative search for -specfinal, or NULL. */
 };
 
+/**
+ * Put a new dictionary in place of the decoder's, and update the
+ * searches which do not already use it.
+ */
+int ps_replace_dict(ps_decoder_t *ps, dict_t *dict, dict2pid_t *d2p);
+
+/**
+ * Put a search in place of another one of the same name, wherever the
+ * decoder runs it, and free the old one.
+ */
+void ps_replace_search(ps_decoder_t *ps, ps_search_t *search);
+
+/**
+ * Put committed reloads in place, unless another is being prepared.
+ */
+void ps_reload_apply(ps_decoder_t *ps);
+
+/**
+ * Free committed reloads and the lock on them.
+ */
+void ps_reload_free_all(ps_decoder_t *ps);
+
+/**
+ * Search one frame whose senone scores are ready (the phone loop
+ * search with it, and the main search the frame -pl_window before).
+ */
+int ps_search_frame(ps_decoder_t *ps, int frame_idx);
+
+/**
+ * Start a thread to compute features and senone scores, up to n_queue
+ * frames ahead of the search, which stays in the calling thread.
+ *
+ * @return NULL if the acoustic model cannot do this or the thread
+ *         cannot be started.
+ */
+ps_pipeline_t *ps_pipeline_init(ps_decoder_t *ps, int n_queue);
+
+/**
+ * Stop the scoring thread.
+ */
+void ps_pipeline_free(ps_pipeline_t *pipe);
+
+/**
+ * Forget the frames of the last utterance, after acmod_start_utt().
+ */
+void ps_pipeline_start_utt(ps_pipeline_t *pipe);
+
+/**
+ * Process audio in the scoring thread and search it as it is scored.
+ * These are as ps_process_raw(), ps_process_cep() and the first part
+ * of ps_end_utt().
+ *
+ * @return number of frames searched, or <0 on error.
+ */
+int ps_pipeline_process_raw(ps_pipeline_t *pipe, int16 const *data,
+                            size_t n_samples, int full_utt);
+int ps_pipeline_process_cep(ps_pipeline_t *pipe, mfcc_t **data,
+                            int32 n_frames, int full_utt);
+int ps_pipeline_end_utt(ps_pipeline_t *pipe);
+
+/**
+ * Start a thread to search the utterance so far in a clone of the
+ * decoder, once there have been n_silence frames of silence after the
+ * speech.
+ *
+ * @return NULL if the thread cannot be started.
+ */
+ps_spec_t *ps_spec_init(ps_decoder_t *ps, int n_silence);
+
+/**
+ * Stop the thread and free the clone.
+ */
+void ps_spec_free(ps_spec_t *spec);
+
+/**
+ * Stop any search and free the clone, before the decoder changes in
+ * a way it cannot follow.
+ */
+void ps_spec_reset(ps_spec_t *spec);
+
+/**
+ * Forget the last utterance, before acmod_start_utt().
+ */
+void ps_spec_start_utt(ps_spec_t *spec);
+
+/**
+ * Start or stop searching in the clone, after audio has been
+ * processed and searched.
+ */
+void ps_spec_update(ps_spec_t *spec);
+
+/**
+ * Wait for the search in the clone to finish, if no speech has come
+ * since it started.
+ *
+ * @return TRUE if it has the result of the utterance.
+ */
+int ps_spec_end_utt(ps_spec_t *spec);
+
+/**
+ * Get the clone with the result of the last utterance.
+ *
+ * @return NULL if the decoder has it.
+ */
+ps_decoder_t *ps_spec_result(ps_spec_t *spec);
+
 
 struct ps_search_iter_s {
     hash_iter_t itor;
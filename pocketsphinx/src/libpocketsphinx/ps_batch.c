@@ -0,0 +1,497 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_batch.c Decoding many utterances in parallel.
+ *
+ * Utterances are sorted by length and dealt out to the threads in
+ * turn, so that each one starts with the longest of its share.  Each
+ * thread takes work from the front of its own queue, and when that
+ * is empty, from the back of the fullest other queue.  The long
+ * utterances are thus started early, and the short ones at the end
+ * fill in the gaps, without any single queue being a bottleneck.
+ *
+ * To replicate the models over NUMA nodes, the first thread on each
+ * node loads a copy of them while bound to it, so that their memory
+ * is placed there on first touch, and the others on that node share
+ * it.  The caller's decoder serves the first node.
+ */
+
+/* System headers. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* SphinxBase headers. */
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/sbthread.h>
+
+/* Local headers. */
+#include "pocketsphinx_internal.h"
+
+/**
+ * Utterance in a batch.
+ */
+typedef struct batch_utt_s {
+    char *uttid;          /**< Name of utterance, or NULL. */
+    char *file;           /**< Audio file, or NULL if in data. */
+    int16 const *data;    /**< Audio, if not in a file. */
+    size_t n_samples;     /**< Length of audio. */
+    char *hyp;            /**< Best hypothesis, or NULL. */
+    int32 score;          /**< Path score of best hypothesis. */
+    double nspeech;       /**< Seconds of speech. */
+    double ncpu;          /**< Seconds of CPU time. */
+    double nwall;         /**< Seconds of wall time. */
+    int status;           /**< 0 if not decoded, 1 if decoded, <0 on error. */
+} batch_utt_t;
+
+/**
+ * Thread in a batch, with its own decoder and queue of utterances.
+ */
+typedef struct batch_worker_s {
+    ps_batch_t *batch;
+    ps_decoder_t *ps;
+    sbthread_t *thr;      /**< Thread (NULL for the calling thread). */
+    int node;             /**< NUMA node to run on, or -1 for any. */
+    sbmtx_t *mtx;         /**< Lock on the queue. */
+    int32 *queue;         /**< Utterances to decode, longest first. */
+    int32 head;           /**< Next utterance to decode. */
+    int32 tail;           /**< One past the last utterance to decode. */
+    mfcc_t *cmn_mean;     /**< Initial live CMN state. */
+    mfcc_t *cmn_var;
+    mfcc_t *cmn_sum;
+    mfcc_t *cmn_sumsq;
+    int32 cmn_nframe;
+} batch_worker_t;
+
+struct ps_batch_s {
+    batch_worker_t *workers;
+    int32 n_workers;
+    batch_utt_t *utts;
+    int32 n_utts;
+    int32 n_alloc_utts;
+};
+
+/* Save the live CMN state of a fresh decoder. */
+static void
+batch_cmn_save(batch_worker_t *w)
+{
+    cmn_t *cmn = ps_get_feat(w->ps)->cmn_struct;
+
+    if (cmn == NULL)
+        return;
+    w->cmn_mean = ckd_calloc(cmn->veclen, sizeof(*w->cmn_mean));
+    w->cmn_var = ckd_calloc(cmn->veclen, sizeof(*w->cmn_var));
+    w->cmn_sum = ckd_calloc(cmn->veclen, sizeof(*w->cmn_sum));
+    w->cmn_sumsq = ckd_calloc(cmn->veclen, sizeof(*w->cmn_sumsq));
+    memcpy(w->cmn_mean, cmn->cmn_mean, cmn->veclen * sizeof(*w->cmn_mean));
+    memcpy(w->cmn_var, cmn->cmn_var, cmn->veclen * sizeof(*w->cmn_var));
+    memcpy(w->cmn_sum, cmn->sum, cmn->veclen * sizeof(*w->cmn_sum));
+    memcpy(w->cmn_sumsq, cmn->sumsq, cmn->veclen * sizeof(*w->cmn_sumsq));
+    w->cmn_nframe = cmn->nframe;
+}
+
+/* Undo the adaptation of live CMN to previous utterances. */
+static void
+batch_cmn_restore(batch_worker_t *w)
+{
+    cmn_t *cmn = ps_get_feat(w->ps)->cmn_struct;
+
+    if (cmn == NULL)
+        return;
+    memcpy(cmn->cmn_mean, w->cmn_mean, cmn->veclen * sizeof(*w->cmn_mean));
+    memcpy(cmn->cmn_var, w->cmn_var, cmn->veclen * sizeof(*w->cmn_var));
+    memcpy(cmn->sum, w->cmn_sum, cmn->veclen * sizeof(*w->cmn_sum));
+    memcpy(cmn->sumsq, w->cmn_sumsq, cmn->veclen * sizeof(*w->cmn_sumsq));
+    cmn->nframe = w->cmn_nframe;
+}
+
+ps_batch_t *
+ps_batch_init(ps_decoder_t *ps, int nthreads)
+{
+    ps_batch_t *batch;
+    cmd_ln_t *config;
+    int32 i, n_nodes;
+
+    if (ps == NULL) {
+        E_ERROR("No decoder to decode batch with\n");
+        return NULL;
+    }
+    if (nthreads < 1)
+        nthreads = 1;
+    config = ps_get_config(ps);
+    n_nodes = 1;
+    if (cmd_ln_exists_r(config, "-numa")
+        && 0 == strcmp(cmd_ln_str_r(config, "-numa"), "replicate"))
+        n_nodes = sbthread_n_nodes();
+    if (n_nodes > nthreads)
+        n_nodes = nthreads;
+    if (n_nodes > 1)
+        E_INFO("Replicating models on %d NUMA nodes\n", n_nodes);
+
+    batch = ckd_calloc(1, sizeof(*batch));
+    batch->workers = ckd_calloc(nthreads, sizeof(*batch->workers));
+    for (i = 0; i < nthreads; ++i) {
+        batch_worker_t *w = &batch->workers[i];
+
+        w->batch = batch;
+        w->node = -1;
+        if (n_nodes > 1 && sbthread_bind_node(i % n_nodes) == 0)
+            w->node = i % n_nodes;
+        if (i == 0)
+            w->ps = ps_retain(ps);
+        else if (i < n_nodes)
+            w->ps = ps_init(config);
+        else
+            w->ps = ps_init_shared(config, batch->workers[i % n_nodes].ps);
+        if (w->ps == NULL)
+            goto error_out;
+        if ((w->mtx = sbmtx_init()) == NULL) {
+            ps_free(w->ps);
+            goto error_out;
+        }
+        batch_cmn_save(w);
+        ++batch->n_workers;
+    }
+    if (n_nodes > 1)
+        sbthread_bind_node(-1);
+    return batch;
+
+error_out:
+    if (n_nodes > 1)
+        sbthread_bind_node(-1);
+    ps_batch_free(batch);
+    return NULL;
+}
+
+void
+ps_batch_free(ps_batch_t *batch)
+{
+    int32 i;
+
+    if (batch == NULL)
+        return;
+    for (i = 0; i < batch->n_workers; ++i) {
+        batch_worker_t *w = &batch->workers[i];
+
+        ps_free(w->ps);
+        sbmtx_free(w->mtx);
+        ckd_free(w->queue);
+        ckd_free(w->cmn_mean);
+        ckd_free(w->cmn_var);
+        ckd_free(w->cmn_sum);
+        ckd_free(w->cmn_sumsq);
+    }
+    ckd_free(batch->workers);
+    for (i = 0; i < batch->n_utts; ++i) {
+        ckd_free(batch->utts[i].uttid);
+        ckd_free(batch->utts[i].file);
+        ckd_free(batch->utts[i].hyp);
+    }
+    ckd_free(batch->utts);
+    ckd_free(batch);
+}
+
+static batch_utt_t *
+batch_add_utt(ps_batch_t *batch, char const *uttid)
+{
+    batch_utt_t *utt;
+
+    if (batch->n_utts == batch->n_alloc_utts) {
+        batch->n_alloc_utts = batch->n_alloc_utts ? batch->n_alloc_utts * 2 : 16;
+        batch->utts = ckd_realloc(batch->utts,
+                                  batch->n_alloc_utts * sizeof(*batch->utts));
+    }
+    utt = &batch->utts[batch->n_utts++];
+    memset(utt, 0, sizeof(*utt));
+    if (uttid)
+        utt->uttid = ckd_salloc(uttid);
+    return utt;
+}
+
+int
+ps_batch_add_file(ps_batch_t *batch, char const *uttid, char const *file)
+{
+    batch_utt_t *utt;
+    FILE *fh;
+    long size;
+
+    /* Only the length is needed for now, to schedule it. */
+    if ((fh = fopen(file, "rb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open %s", file);
+        return -1;
+    }
+    if (fseek(fh, 0, SEEK_END) < 0 || (size = ftell(fh)) < 0) {
+        E_ERROR_SYSTEM("Failed to find length of %s", file);
+        fclose(fh);
+        return -1;
+    }
+    fclose(fh);
+
+    utt = batch_add_utt(batch, uttid);
+    utt->file = ckd_salloc(file);
+    utt->n_samples = size / sizeof(int16);
+    return batch->n_utts - 1;
+}
+
+int
+ps_batch_add_raw(ps_batch_t *batch, char const *uttid,
+                 int16 const *data, size_t n_samples)
+{
+    batch_utt_t *utt;
+
+    utt = batch_add_utt(batch, uttid);
+    utt->data = data;
+    utt->n_samples = n_samples;
+    return batch->n_utts - 1;
+}
+
+static void
+batch_decode(batch_worker_t *w, batch_utt_t *utt)
+{
+    ps_decoder_t *ps = w->ps;
+    char const *hyp;
+
+    batch_cmn_restore(w);
+    if (utt->file) {
+        FILE *fh;
+
+        if ((fh = fopen(utt->file, "rb")) == NULL) {
+            E_ERROR_SYSTEM("Failed to open %s", utt->file);
+            utt->status = -1;
+            return;
+        }
+        ps_decode_raw(ps, fh, -1);
+        fclose(fh);
+    }
+    else {
+        ps_start_stream(ps);
+        if (ps_start_utt(ps) < 0) {
+            utt->status = -1;
+            return;
+        }
+        ps_process_raw(ps, utt->data, utt->n_samples, FALSE, TRUE);
+        ps_end_utt(ps);
+    }
+
+    if ((hyp = ps_get_hyp(ps, &utt->score)) != NULL)
+        utt->hyp = ckd_salloc(hyp);
+    ps_get_utt_time(ps, &utt->nspeech, &utt->ncpu, &utt->nwall);
+    utt->status = 1;
+}
+
+/* Take the next utterance from the front of this worker's queue. */
+static int32
+batch_pop(batch_worker_t *w)
+{
+    int32 idx = -1;
+
+    sbmtx_lock(w->mtx);
+    if (w->head < w->tail)
+        idx = w->queue[w->head++];
+    sbmtx_unlock(w->mtx);
+    return idx;
+}
+
+/* Take an utterance from the back of the fullest other queue. */
+static int32
+batch_steal(batch_worker_t *w)
+{
+    ps_batch_t *batch = w->batch;
+
+    for (;;) {
+        batch_worker_t *victim = NULL;
+        int32 i, most = 0, idx = -1;
+
+        for (i = 0; i < batch->n_workers; ++i) {
+            batch_worker_t *v = &batch->workers[i];
+            int32 n;
+
+            if (v == w)
+                continue;
+            sbmtx_lock(v->mtx);
+            n = v->tail - v->head;
+            sbmtx_unlock(v->mtx);
+            if (n > most) {
+                most = n;
+                victim = v;
+            }
+        }
+        if (victim == NULL)
+            return -1;
+
+        /* Somebody else may have emptied it in the meantime. */
+        sbmtx_lock(victim->mtx);
+        if (victim->head < victim->tail)
+            idx = victim->queue[--victim->tail];
+        sbmtx_unlock(victim->mtx);
+        if (idx >= 0)
+            return idx;
+    }
+}
+
+static int
+batch_worker_main(sbthread_t *th)
+{
+    batch_worker_t *w = sbthread_arg(th);
+    int32 idx;
+
+    if (w->node >= 0)
+        sbthread_bind_node(w->node);
+    while ((idx = batch_pop(w)) >= 0 || (idx = batch_steal(w)) >= 0)
+        batch_decode(w, &w->batch->utts[idx]);
+    return 0;
+}
+
+typedef struct batch_len_s {
+    size_t n_samples;
+    int32 idx;
+} batch_len_t;
+
+static int
+batch_len_cmp(void const *a, void const *b)
+{
+    batch_len_t const *la = a;
+    batch_len_t const *lb = b;
+
+    /* Longest first, otherwise in the order they were added. */
+    if (la->n_samples != lb->n_samples)
+        return (la->n_samples < lb->n_samples) ? 1 : -1;
+    return la->idx - lb->idx;
+}
+
+int
+ps_batch_run(ps_batch_t *batch)
+{
+    batch_len_t *lens;
+    int32 i, n, n_failed;
+
+    /* Sort what is left to do by length. */
+    lens = ckd_calloc(batch->n_utts, sizeof(*lens));
+    for (n = i = 0; i < batch->n_utts; ++i) {
+        if (batch->utts[i].status != 0)
+            continue;
+        lens[n].n_samples = batch->utts[i].n_samples;
+        lens[n].idx = i;
+        ++n;
+    }
+    qsort(lens, n, sizeof(*lens), batch_len_cmp);
+
+    /* Deal it out to the workers in turn. */
+    for (i = 0; i < batch->n_workers; ++i) {
+        batch_worker_t *w = &batch->workers[i];
+
+        ckd_free(w->queue);
+        w->queue = ckd_calloc(n / batch->n_workers + 1, sizeof(*w->queue));
+        w->head = w->tail = 0;
+    }
+    for (i = 0; i < n; ++i) {
+        batch_worker_t *w = &batch->workers[i % batch->n_workers];
+        w->queue[w->tail++] = lens[i].idx;
+    }
+    ckd_free(lens);
+
+    /* The calling thread is the first worker. */
+    for (i = 1; i < batch->n_workers; ++i) {
+        batch_worker_t *w = &batch->workers[i];
+
+        if (w->head < w->tail
+            && (w->thr = sbthread_start(NULL, batch_worker_main, w)) == NULL)
+            E_WARN("Failed to start thread %d, its work will be stolen\n", i);
+    }
+    if (batch->workers[0].node >= 0)
+        sbthread_bind_node(batch->workers[0].node);
+    while ((i = batch_pop(&batch->workers[0])) >= 0
+           || (i = batch_steal(&batch->workers[0])) >= 0)
+        batch_decode(&batch->workers[0], &batch->utts[i]);
+    if (batch->workers[0].node >= 0)
+        sbthread_bind_node(-1);
+    for (i = 1; i < batch->n_workers; ++i) {
+        batch_worker_t *w = &batch->workers[i];
+
+        if (w->thr) {
+            sbthread_free(w->thr);
+            w->thr = NULL;
+        }
+    }
+
+    n_failed = 0;
+    for (i = 0; i < batch->n_utts; ++i)
+        if (batch->utts[i].status < 0)
+            ++n_failed;
+    if (n_failed)
+        E_ERROR("Failed to decode %d utterances\n", n_failed);
+    return n_failed ? -1 : 0;
+}
+
+int
+ps_batch_n_utts(ps_batch_t *batch)
+{
+    return batch->n_utts;
+}
+
+char const *
+ps_batch_uttid(ps_batch_t *batch, int idx)
+{
+    if (idx < 0 || idx >= batch->n_utts)
+        return NULL;
+    return batch->utts[idx].uttid;
+}
+
+char const *
+ps_batch_hyp(ps_batch_t *batch, int idx, int32 *out_best_score)
+{
+    if (idx < 0 || idx >= batch->n_utts)
+        return NULL;
+    if (out_best_score)
+        *out_best_score = batch->utts[idx].score;
+    return batch->utts[idx].hyp;
+}
+
+int
+ps_batch_utt_time(ps_batch_t *batch, int idx, double *out_nspeech,
+                  double *out_ncpu, double *out_nwall)
+{
+    batch_utt_t *utt;
+
+    if (idx < 0 || idx >= batch->n_utts)
+        return -1;
+    utt = &batch->utts[idx];
+    if (utt->status <= 0)
+        return -1;
+    *out_nspeech = utt->nspeech;
+    *out_ncpu = utt->ncpu;
+    *out_nwall = utt->nwall;
+    return 0;
+}
@@ -0,0 +1,505 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_cn.c Word confusion networks.
+ *
+ * Word hypotheses in the lattice are clustered by time rather than
+ * by the usual pairwise merging of link equivalence classes, which is
+ * cubic in the size of the lattice.  Hypotheses are taken in order
+ * of decreasing posterior probability, and each one which overlaps
+ * no slot so far starts a new slot.  Every other hypothesis then
+ * joins the slot it overlaps most.  A map from frames to slots makes
+ * both steps linear in the total duration of the hypotheses.
+ */
+
+/* System headers. */
+#include <stdlib.h>
+#include <string.h>
+
+/* SphinxBase headers. */
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+
+/* Local headers. */
+#include "pocketsphinx_internal.h"
+#include "ps_lattice_internal.h"
+#include "dict.h"
+
+/**
+ * Word hypothesis, all instances of a base word with the same times.
+ */
+typedef struct cn_hyp_s {
+    int32 wid;      /**< Base word ID. */
+    int32 sf;       /**< Start frame. */
+    int32 ef;       /**< End frame. */
+    int32 post;     /**< Log posterior probability. */
+    int32 slot;     /**< Slot to which it belongs. */
+    int32 pivot;    /**< Did it start its slot? */
+} cn_hyp_t;
+
+/**
+ * Word in a slot of a confusion network.
+ */
+typedef struct ps_cn_word_s {
+    int32 wid;      /**< Base word ID. */
+    int32 post;     /**< Log posterior probability. */
+} ps_cn_word_t;
+
+/**
+ * Slot in a confusion network.
+ */
+typedef struct ps_cn_slot_s {
+    int32 sf;       /**< Start frame of the word that started it. */
+    int32 ef;       /**< End frame of the word that started it. */
+    int32 del_post; /**< Log posterior probability of no word. */
+    int32 n_words;
+    ps_cn_word_t *words; /**< Words, most likely first. */
+} ps_cn_slot_t;
+
+struct ps_cn_s {
+    int refcount;
+    ps_lattice_t *dag;     /**< Lattice, for its dictionary and log-math. */
+    ps_cn_slot_t *slots;   /**< Slots in time order. */
+    int32 n_slots;
+    ps_cn_word_t *words;   /**< Storage for words of all slots. */
+    char *hyp_str;         /**< Consensus hypothesis. */
+};
+
+struct ps_cn_iter_s {
+    ps_cn_t *cn;
+    int32 cur;
+};
+
+static int
+hyp_cmp_word(void const *a, void const *b)
+{
+    cn_hyp_t const *ha = a, *hb = b;
+
+    if (ha->wid != hb->wid)
+        return ha->wid < hb->wid ? -1 : 1;
+    if (ha->sf != hb->sf)
+        return ha->sf < hb->sf ? -1 : 1;
+    if (ha->ef != hb->ef)
+        return ha->ef < hb->ef ? -1 : 1;
+    return 0;
+}
+
+static int
+hyp_cmp_post(void const *a, void const *b)
+{
+    cn_hyp_t const *ha = a, *hb = b;
+
+    if (ha->post != hb->post)
+        return ha->post > hb->post ? -1 : 1;
+    /* Keep the order stable for equal posteriors. */
+    return hyp_cmp_word(a, b);
+}
+
+static int
+hyp_cmp_slot(void const *a, void const *b)
+{
+    cn_hyp_t const *ha = a, *hb = b;
+
+    if (ha->slot != hb->slot)
+        return ha->slot < hb->slot ? -1 : 1;
+    if (ha->post != hb->post)
+        return ha->post > hb->post ? -1 : 1;
+    return ha->wid < hb->wid ? -1 : ha->wid > hb->wid;
+}
+
+static int
+hyp_cmp_time(void const *a, void const *b)
+{
+    cn_hyp_t const *ha = *(cn_hyp_t * const *)a, *hb = *(cn_hyp_t * const *)b;
+
+    return ha->sf < hb->sf ? -1 : ha->sf > hb->sf;
+}
+
+/* Gather hypotheses from lattice links, merging pronunciations. */
+static cn_hyp_t *
+cn_gather(ps_lattice_t *dag, int32 beam, int32 *out_n_hyps)
+{
+    ps_latnode_t *node;
+    cn_hyp_t *hyps;
+    int32 n_hyps, n_alloc, i, j;
+
+    n_alloc = 1;
+    for (node = dag->nodes; node; node = node->next) {
+        latlink_list_t *x;
+        for (x = node->exits; x; x = x->next)
+            ++n_alloc;
+    }
+    hyps = ckd_calloc(n_alloc, sizeof(*hyps));
+    n_hyps = 0;
+    for (node = dag->nodes; node; node = node->next) {
+        latlink_list_t *x;
+
+        if (!dict_real_word(dag->dict, node->basewid))
+            continue;
+        for (x = node->exits; x; x = x->next) {
+            ps_latlink_t *link = x->link;
+            int32 post = link->alpha + link->beta - dag->norm;
+
+            if (post < beam)
+                continue;
+            hyps[n_hyps].wid = node->basewid;
+            hyps[n_hyps].sf = node->sf;
+            hyps[n_hyps].ef = link->ef;
+            hyps[n_hyps].post = post;
+            ++n_hyps;
+        }
+    }
+    /* The final word has no exits, but is on every path. */
+    node = dag->end;
+    if (dict_real_word(dag->dict, node->basewid)) {
+        hyps[n_hyps].wid = node->basewid;
+        hyps[n_hyps].sf = node->sf;
+        hyps[n_hyps].ef = dag->n_frames - 1;
+        hyps[n_hyps].post = 0;
+        ++n_hyps;
+    }
+
+    /* Merge instances of the same word with the same times. */
+    qsort(hyps, n_hyps, sizeof(*hyps), hyp_cmp_word);
+    for (i = j = 0; i < n_hyps; ++i) {
+        if (j > 0 && hyp_cmp_word(hyps + j - 1, hyps + i) == 0)
+            hyps[j - 1].post = logmath_add(dag->lmath,
+                                           hyps[j - 1].post, hyps[i].post);
+        else
+            hyps[j++] = hyps[i];
+    }
+    n_hyps = j;
+    for (i = 0; i < n_hyps; ++i) {
+        /* Rounding can push posteriors slightly above one. */
+        if (hyps[i].post > 0)
+            hyps[i].post = 0;
+        if (hyps[i].ef < hyps[i].sf)
+            hyps[i].ef = hyps[i].sf;
+    }
+    *out_n_hyps = n_hyps;
+    return hyps;
+}
+
+/* Assign hypotheses to slots, returning the number of slots. */
+static int32
+cn_cluster(cn_hyp_t *hyps, int32 n_hyps, int32 n_frames)
+{
+    cn_hyp_t **pivots;
+    int32 *frame_slot, *overlap, *slot_order;
+    int32 n_slots, i, f;
+
+    frame_slot = ckd_calloc(n_frames, sizeof(*frame_slot));
+    for (f = 0; f < n_frames; ++f)
+        frame_slot[f] = -1;
+    pivots = ckd_calloc(n_hyps, sizeof(*pivots));
+
+    /* Hypotheses which overlap no slot start new ones, most likely first. */
+    qsort(hyps, n_hyps, sizeof(*hyps), hyp_cmp_post);
+    n_slots = 0;
+    for (i = 0; i < n_hyps; ++i) {
+        cn_hyp_t *h = hyps + i;
+
+        h->slot = -1;
+        if (h->sf < 0 || h->ef >= n_frames)
+            continue;
+        for (f = h->sf; f <= h->ef; ++f)
+            if (frame_slot[f] != -1)
+                break;
+        if (f <= h->ef)
+            continue;
+        for (f = h->sf; f <= h->ef; ++f)
+            frame_slot[f] = n_slots;
+        h->slot = n_slots;
+        h->pivot = TRUE;
+        pivots[n_slots++] = h;
+    }
+
+    /* Renumber slots in time order. */
+    qsort(pivots, n_slots, sizeof(*pivots), hyp_cmp_time);
+    slot_order = ckd_calloc(n_slots, sizeof(*slot_order));
+    for (i = 0; i < n_slots; ++i)
+        slot_order[pivots[i]->slot] = i;
+    for (f = 0; f < n_frames; ++f)
+        if (frame_slot[f] != -1)
+            frame_slot[f] = slot_order[frame_slot[f]];
+    for (i = 0; i < n_slots; ++i)
+        pivots[i]->slot = i;
+
+    /* Everything else joins the slot it overlaps most. */
+    overlap = ckd_calloc(n_slots, sizeof(*overlap));
+    for (i = 0; i < n_hyps; ++i) {
+        cn_hyp_t *h = hyps + i;
+        int32 best, best_overlap, first, last, s;
+
+        if (h->pivot)
+            continue;
+        first = n_slots;
+        last = -1;
+        for (f = h->sf < 0 ? 0 : h->sf;
+             f <= h->ef && f < n_frames; ++f) {
+            if ((s = frame_slot[f]) == -1)
+                continue;
+            ++overlap[s];
+            if (s < first) first = s;
+            if (s > last) last = s;
+        }
+        best = -1;
+        best_overlap = 0;
+        for (s = first; s <= last; ++s) {
+            if (overlap[s] > best_overlap) {
+                best = s;
+                best_overlap = overlap[s];
+            }
+            overlap[s] = 0;
+        }
+        h->slot = best;
+    }
+
+    ckd_free(overlap);
+    ckd_free(slot_order);
+    ckd_free(pivots);
+    ckd_free(frame_slot);
+    return n_slots;
+}
+
+ps_cn_t *
+ps_lattice_cn(ps_lattice_t *dag, int32 beam)
+{
+    ps_cn_t *cn;
+    cn_hyp_t *hyps;
+    int32 n_hyps, i, j;
+
+    hyps = cn_gather(dag, beam, &n_hyps);
+
+    cn = ckd_calloc(1, sizeof(*cn));
+    cn->refcount = 1;
+    cn->dag = ps_lattice_retain(dag);
+    cn->n_slots = cn_cluster(hyps, n_hyps, dag->n_frames);
+    cn->slots = ckd_calloc(cn->n_slots, sizeof(*cn->slots));
+    for (i = 0; i < n_hyps; ++i) {
+        cn_hyp_t *h = hyps + i;
+        if (h->pivot) {
+            cn->slots[h->slot].sf = h->sf;
+            cn->slots[h->slot].ef = h->ef;
+        }
+    }
+
+    /* Sort words by slot, merging repeats of each word. */
+    qsort(hyps, n_hyps, sizeof(*hyps), hyp_cmp_slot);
+    cn->words = ckd_calloc(n_hyps + 1, sizeof(*cn->words));
+    for (i = j = 0; i < n_hyps; ++i) {
+        cn_hyp_t *h = hyps + i;
+        ps_cn_slot_t *slot;
+        int32 k;
+
+        if (h->slot == -1)
+            continue;
+        slot = cn->slots + h->slot;
+        if (slot->words == NULL)
+            slot->words = cn->words + j;
+        for (k = 0; k < slot->n_words; ++k)
+            if (slot->words[k].wid == h->wid)
+                break;
+        if (k < slot->n_words) {
+            slot->words[k].post = logmath_add(dag->lmath,
+                                              slot->words[k].post, h->post);
+            if (slot->words[k].post > 0)
+                slot->words[k].post = 0;
+            /* Keep words in order of probability. */
+            while (k > 0 && slot->words[k].post > slot->words[k - 1].post) {
+                ps_cn_word_t tmp = slot->words[k];
+                slot->words[k] = slot->words[k - 1];
+                slot->words[k - 1] = tmp;
+                --k;
+            }
+        }
+        else {
+            slot->words[k].wid = h->wid;
+            slot->words[k].post = h->post;
+            ++slot->n_words;
+            ++j;
+        }
+    }
+    ckd_free(hyps);
+
+    /* Whatever probability is left over goes to deleting the slot. */
+    for (i = 0; i < cn->n_slots; ++i) {
+        ps_cn_slot_t *slot = cn->slots + i;
+        float64 sum = 0.0;
+
+        for (j = 0; j < slot->n_words; ++j)
+            sum += logmath_exp(dag->lmath, slot->words[j].post);
+        if (sum >= 1.0)
+            slot->del_post = logmath_get_zero(dag->lmath);
+        else
+            slot->del_post = logmath_log(dag->lmath, 1.0 - sum);
+    }
+    E_INFO("Confusion network has %d slots for %d word hypotheses\n",
+           cn->n_slots, n_hyps);
+
+    return cn;
+}
+
+ps_cn_t *
+ps_cn_retain(ps_cn_t *cn)
+{
+    ++cn->refcount;
+    return cn;
+}
+
+int
+ps_cn_free(ps_cn_t *cn)
+{
+    if (cn == NULL)
+        return 0;
+    if (--cn->refcount > 0)
+        return cn->refcount;
+    ps_lattice_free(cn->dag);
+    ckd_free(cn->slots);
+    ckd_free(cn->words);
+    ckd_free(cn->hyp_str);
+    ckd_free(cn);
+    return 0;
+}
+
+int32
+ps_cn_n_slots(ps_cn_t *cn)
+{
+    return cn->n_slots;
+}
+
+char const *
+ps_cn_hyp(ps_cn_t *cn, int32 *out_post)
+{
+    dict_t *dict = cn->dag->dict;
+    char const **wstrs;
+    size_t len;
+    int32 i, post;
+    char *c;
+
+    /* Take the best word in each slot, unless no word is better. */
+    wstrs = ckd_calloc(cn->n_slots > 0 ? cn->n_slots : 1, sizeof(*wstrs));
+    len = 0;
+    post = 0;
+    for (i = 0; i < cn->n_slots; ++i) {
+        ps_cn_slot_t *slot = cn->slots + i;
+
+        if (slot->n_words == 0 || slot->words[0].post <= slot->del_post) {
+            post += slot->del_post;
+            continue;
+        }
+        post += slot->words[0].post;
+        if (!dict_real_word(dict, slot->words[0].wid))
+            continue;
+        if ((wstrs[i] = dict_wordstr(dict, slot->words[0].wid)) != NULL)
+            len += strlen(wstrs[i]) + 1;
+    }
+    ckd_free(cn->hyp_str);
+    cn->hyp_str = ckd_calloc(1, len + 1);
+    c = cn->hyp_str;
+    for (i = 0; i < cn->n_slots; ++i) {
+        if (wstrs[i] == NULL)
+            continue;
+        if (c > cn->hyp_str)
+            *c++ = ' ';
+        strcpy(c, wstrs[i]);
+        c += strlen(wstrs[i]);
+    }
+    ckd_free(wstrs);
+    if (out_post)
+        *out_post = post;
+    return cn->hyp_str;
+}
+
+ps_cn_iter_t *
+ps_cn_iter(ps_cn_t *cn)
+{
+    ps_cn_iter_t *itor;
+
+    if (cn->n_slots == 0)
+        return NULL;
+    itor = ckd_calloc(1, sizeof(*itor));
+    itor->cn = cn;
+    itor->cur = 0;
+    return itor;
+}
+
+ps_cn_iter_t *
+ps_cn_iter_next(ps_cn_iter_t *itor)
+{
+    if (++itor->cur >= itor->cn->n_slots) {
+        ps_cn_iter_free(itor);
+        return NULL;
+    }
+    return itor;
+}
+
+void
+ps_cn_iter_free(ps_cn_iter_t *itor)
+{
+    ckd_free(itor);
+}
+
+void
+ps_cn_iter_frames(ps_cn_iter_t *itor, int *out_sf, int *out_ef)
+{
+    ps_cn_slot_t *slot = itor->cn->slots + itor->cur;
+
+    if (out_sf) *out_sf = slot->sf;
+    if (out_ef) *out_ef = slot->ef;
+}
+
+int32
+ps_cn_iter_n_words(ps_cn_iter_t *itor)
+{
+    return itor->cn->slots[itor->cur].n_words;
+}
+
+char const *
+ps_cn_iter_word(ps_cn_iter_t *itor, int32 i, int32 *out_post)
+{
+    ps_cn_slot_t *slot = itor->cn->slots + itor->cur;
+
+    if (i < 0 || i >= slot->n_words)
+        return NULL;
+    if (out_post)
+        *out_post = slot->words[i].post;
+    return dict_wordstr(itor->cn->dag->dict, slot->words[i].wid);
+}
+
+int32
+ps_cn_iter_del_prob(ps_cn_iter_t *itor)
+{
+    return itor->cn->slots[itor->cur].del_post;
+}
@@ -116,6 +116,31 @@ ps_lattice_penalize_fillers(ps_lattice_t *dag, int32 silpen, int32 fillpen)
     }
 }
 
+/*
+ * Nodes, links and list elements of a packed lattice are freed along
+ * with it, so these only release those allocated individually.
+ */
+static void
+latnode_free(ps_lattice_t *dag, ps_latnode_t *node)
+{
+    if (node < dag->node_pool || node >= dag->node_pool + dag->n_pool_nodes)
+        listelem_free(dag->latnode_alloc, node);
+}
+
+static void
+latlink_free(ps_lattice_t *dag, ps_latlink_t *link)
+{
+    if (link < dag->link_pool || link >= dag->link_pool + dag->n_pool_links)
+        listelem_free(dag->latlink_alloc, link);
+}
+
+static void
+latlink_list_free(ps_lattice_t *dag, latlink_list_t *x)
+{
+    if (x < dag->list_pool || x >= dag->list_pool + 2 * dag->n_pool_links)
+        listelem_free(dag->latlink_list_alloc, x);
+}
+
 static void
 delete_node(ps_lattice_t *dag, ps_latnode_t *node)
 {
@@ -124,14 +149,14 @@ delete_node(ps_lattice_t *dag, ps_latnode_t *node)
     for (x = node->exits; x; x = next_x) {
         next_x = x->next;
         x->link->from = NULL;
-        listelem_free(dag->latlink_list_alloc, x);
+        latlink_list_free(dag, x);
     }
     for (x = node->entries; x; x = next_x) {
         next_x = x->next;
         x->link->to = NULL;
-        listelem_free(dag->latlink_list_alloc, x);
+        latlink_list_free(dag, x);
     }
-    listelem_free(dag->latnode_alloc, node);
+    latnode_free(dag, node);
 }
 
 
@@ -148,8 +173,8 @@ remove_dangling_links(ps_lattice_t *dag, ps_latnode_t *node)
                 prev_x->next = next_x;
             else
                 node->exits = next_x;
-            listelem_free(dag->latlink_alloc, x->link);
-            listelem_free(dag->latlink_list_alloc, x);
+            latlink_free(dag, x->link);
+            latlink_list_free(dag, x);
         }
         else
             prev_x = x;
@@ -162,14 +187,97 @@ remove_dangling_links(ps_lattice_t *dag, ps_latnode_t *node)
                 prev_x->next = next_x;
             else
                 node->entries = next_x;
-            listelem_free(dag->latlink_alloc, x->link);
-            listelem_free(dag->latlink_list_alloc, x);
+            latlink_free(dag, x->link);
+            latlink_list_free(dag, x);
         }
         else
             prev_x = x;
     }
 }
 
+/*
+ * Move the nodes and links of a finished lattice into contiguous
+ * arrays.  Links are stored in order of their source node, and the
+ * exits and entries of each node are consecutive, so traversals walk
+ * through memory in order rather than following wherever the
+ * allocators put things while the lattice was being built.  Node IDs
+ * must already be their positions in the list of nodes.
+ */
+static void
+lattice_pack(ps_lattice_t *dag)
+{
+    ps_latnode_t *node, *pnode, *start, *end;
+    latlink_list_t *x, **pnext;
+    int32 n_nodes, n_links, i;
+
+    n_nodes = n_links = 0;
+    for (node = dag->nodes; node; node = node->next) {
+        ++n_nodes;
+        for (x = node->exits; x; x = x->next)
+            ++n_links;
+    }
+    if (n_links == 0)
+        return;
+    dag->node_pool = ckd_calloc(n_nodes, sizeof(*dag->node_pool));
+    dag->link_pool = ckd_calloc(n_links, sizeof(*dag->link_pool));
+    dag->list_pool = ckd_calloc(2 * n_links, sizeof(*dag->list_pool));
+
+    /* Copy nodes and their exits, in the same order as before. */
+    start = end = NULL;
+    pnode = dag->node_pool;
+    i = 0;
+    for (node = dag->nodes; node; node = node->next, ++pnode) {
+        *pnode = *node;
+        /* Alternate pronunciations are only linked while building. */
+        pnode->alt = NULL;
+        pnode->next = node->next ? pnode + 1 : NULL;
+        if (node == dag->start)
+            start = pnode;
+        if (node == dag->end)
+            end = pnode;
+        pnext = &pnode->exits;
+        for (x = node->exits; x; x = x->next, ++i) {
+            ps_latlink_t *link = dag->link_pool + i;
+            *link = *x->link;
+            link->from = pnode;
+            link->to = dag->node_pool + x->link->to->id;
+            link->best_prev = NULL;
+            /* The old link is discarded below, so use it to
+             * remember where it went for the entries. */
+            x->link->alpha = i;
+            dag->list_pool[i].link = link;
+            *pnext = dag->list_pool + i;
+            pnext = &dag->list_pool[i].next;
+        }
+        *pnext = NULL;
+    }
+    /* Now the entries, which point to the same links. */
+    pnode = dag->node_pool;
+    for (node = dag->nodes; node; node = node->next, ++pnode) {
+        pnext = &pnode->entries;
+        for (x = node->entries; x; x = x->next, ++i) {
+            dag->list_pool[i].link = dag->link_pool + x->link->alpha;
+            *pnext = dag->list_pool + i;
+            pnext = &dag->list_pool[i].next;
+        }
+        *pnext = NULL;
+    }
+    assert(i == 2 * n_links);
+
+    /* Release everything used while building it. */
+    listelem_alloc_free(dag->latnode_alloc);
+    listelem_alloc_free(dag->latlink_alloc);
+    listelem_alloc_free(dag->latlink_list_alloc);
+    dag->latnode_alloc = listelem_alloc_init(sizeof(ps_latnode_t));
+    dag->latlink_alloc = listelem_alloc_init(sizeof(ps_latlink_t));
+    dag->latlink_list_alloc = listelem_alloc_init(sizeof(latlink_list_t));
+    dag->n_pool_nodes = n_nodes;
+    dag->n_pool_links = n_links;
+    dag->nodes = dag->node_pool;
+    dag->start = start;
+    dag->end = end;
+}
+
 void
 ps_lattice_delete_unreachable(ps_lattice_t *dag)
 {
@@ -204,6 +312,9 @@ ps_lattice_delete_unreachable(ps_lattice_t *dag)
         /* Remove all links that go nowhere. */
         remove_dangling_links(dag, node);
     }
+
+    if (dag->node_pool == NULL)
+        lattice_pack(dag);
 }
 
 int32
@@ -384,18 +495,9 @@ dag_mark_reachable(ps_latnode_t * d)
 }
 
 ps_lattice_t *
-ps_lattice_read(ps_decoder_t *ps,
-                char const *file)
+ps_lattice_init_read(ps_decoder_t *ps)
 {
-    FILE *fp;
-    int32 ispipe;
-    lineiter_t *line;
-    float64 lb;
-    float32 logratio;
-    ps_latnode_t **darray;
     ps_lattice_t *dag;
-    int i, k, n_nodes;
-    int32 pip, silpen, fillpen;
 
     dag = ckd_calloc(1, sizeof(*dag));
 
@@ -415,14 +517,97 @@ ps_lattice_read(ps_decoder_t *ps,
     dag->latlink_alloc = listelem_alloc_init(sizeof(ps_latlink_t));
     dag->latlink_list_alloc = listelem_alloc_init(sizeof(latlink_list_t));
     dag->refcount = 1;
+    return dag;
+}
 
-    darray = NULL;
+float32
+ps_lattice_read_logratio(ps_lattice_t *dag, float64 lb)
+{
+    float32 pb = logmath_get_base(dag->lmath);
+    float32 logratio = 1.0f;
+
+    if (fabs(lb - pb) >= 0.0001) {
+        E_WARN("Inconsistent logbases: %f vs %f: will compensate\n", lb, pb);
+        logratio = (float32)(log(lb) / log(pb));
+        E_INFO("Lattice log ratio: %f\n", logratio);
+    }
+    return logratio;
+}
+
+int32
+ps_lattice_read_word(ps_lattice_t *dag, char const *wd)
+{
+    int32 w;
+
+    w = dict_wordid(dag->dict, wd);
+    if (w < 0 && dag->search == NULL) {
+        char *ww = ckd_salloc(wd);
+        if (dict_word2basestr(ww) != -1) {
+            if (dict_wordid(dag->dict, ww) == BAD_S3WID)
+                dict_add_word(dag->dict, ww, NULL, 0);
+        }
+        ckd_free(ww);
+        w = dict_add_word(dag->dict, wd, NULL, 0);
+    }
+    return w;
+}
+
+void
+ps_lattice_finish_read(ps_lattice_t *dag, ps_decoder_t *ps)
+{
+    int32 pip, silpen, fillpen;
+
+    /* Minor hack: If the final node is a filler word and not </s>,
+     * then set its base word ID to </s>, so that the language model
+     * scores won't be screwed up. */
+    if (dict_filler_word(dag->dict, dag->end->wid))
+        dag->end->basewid = dag->search
+            ? ps_search_finish_wid(dag->search)
+            : dict_wordid(dag->dict, S3_FINISH_WORD);
+
+    /* Mark reachable from dag->end */
+    dag_mark_reachable(dag->end);
+
+    /* Free nodes unreachable from dag->end and their links */
+    ps_lattice_delete_unreachable(dag);
+
+    if (ps) {
+        /* Build links around silence and filler words, since they do
+         * not exist in the language model.  FIXME: This is
+         * potentially buggy, as we already do this before outputing
+         * lattices. */
+        pip = logmath_log(dag->lmath, cmd_ln_float32_r(ps->config, "-pip"));
+        silpen = pip + logmath_log(dag->lmath,
+                                   cmd_ln_float32_r(ps->config, "-silprob"));
+        fillpen = pip + logmath_log(dag->lmath,
+                                    cmd_ln_float32_r(ps->config, "-fillprob"));
+        ps_lattice_penalize_fillers(dag, silpen, fillpen);
+    }
+}
+
+ps_lattice_t *
+ps_lattice_read(ps_decoder_t *ps,
+                char const *file)
+{
+    FILE *fp;
+    int32 ispipe;
+    lineiter_t *line;
+    float64 lb;
+    float32 logratio;
+    ps_latnode_t **darray;
+    ps_lattice_t *dag;
+    int i, k, n_nodes;
+
+    if (ps_lattice_is_bin(file))
+        return ps_lattice_read_bin(ps, file);
 
     E_INFO("Reading DAG file: %s\n", file);
     if ((fp = fopen_compchk(file, &ispipe)) == NULL) {
         E_ERROR_SYSTEM("Failed to open DAG file '%s' for reading", file);
         return NULL;
     }
+    dag = ps_lattice_init_read(ps);
+    darray = NULL;
     line = lineiter_start(fp);
 
     /* Read and verify logbase (ONE BIG HACK!!) */
@@ -443,17 +628,7 @@ ps_lattice_read(ps_decoder_t *ps,
         E_WARN("%s: Cannot find -logbase in header\n", file);
         lb = 1.0001;
     }
-    logratio = 1.0f;
-    if (dag->lmath == NULL)
-        dag->lmath = logmath_init(lb, 0, TRUE);
-    else {
-        float32 pb = logmath_get_base(dag->lmath);
-        if (fabs(lb - pb) >= 0.0001) {
-            E_WARN("Inconsistent logbases: %f vs %f: will compensate\n", lb, pb);
-            logratio = (float32)(log(lb) / log(pb));
-            E_INFO("Lattice log ratio: %f\n", logratio);
-        }
-    }
+    logratio = ps_lattice_read_logratio(dag, lb);
     /* Read Frames parameter */
     dag->n_frames = dag_param_read(line, "Frames");
     if (dag->n_frames <= 0) {
@@ -487,21 +662,9 @@ ps_lattice_read(ps_decoder_t *ps,
             goto load_error;
         }
 
-        w = dict_wordid(dag->dict, wd);
-        if (w < 0) {
-            if (dag->search == NULL) {
-                char *ww = ckd_salloc(wd);
-                if (dict_word2basestr(ww) != -1) {
-                    if (dict_wordid(dag->dict, ww) == BAD_S3WID)
-                        dict_add_word(dag->dict, ww, NULL, 0);
-                }
-                ckd_free(ww);
-                w = dict_add_word(dag->dict, wd, NULL, 0);
-            }
-            if (w < 0) {
-                E_ERROR("Unknown word in line: %s\n", line->buf);
-                goto load_error;
-            }
+        if ((w = ps_lattice_read_word(dag, wd)) < 0) {
+            E_ERROR("Unknown word in line: %s\n", line->buf);
+            goto load_error;
         }
 
         if (seqid != i) {
@@ -572,6 +735,10 @@ ps_lattice_read(ps_decoder_t *ps,
             break;
         if (ascr WORSE_THAN WORST_SCORE)
             continue;
+        if (from < 0 || from >= n_nodes || to < 0 || to >= n_nodes) {
+            E_ERROR("Invalid edge: %s\n", line->buf);
+            goto load_error;
+        }
         pd = darray[from];
         d = darray[to];
         if (logratio != 1.0f)
@@ -586,40 +753,216 @@ ps_lattice_read(ps_decoder_t *ps,
     fclose_comp(fp, ispipe);
     ckd_free(darray);
 
-    /* Minor hack: If the final node is a filler word and not </s>,
-     * then set its base word ID to </s>, so that the language model
-     * scores won't be screwed up. */
-    if (dict_filler_word(dag->dict, dag->end->wid))
-        dag->end->basewid = dag->search
-            ? ps_search_finish_wid(dag->search)
-            : dict_wordid(dag->dict, S3_FINISH_WORD);
+    ps_lattice_finish_read(dag, ps);
+    return dag;
 
-    /* Mark reachable from dag->end */
-    dag_mark_reachable(dag->end);
+  load_error:
+    E_ERROR("Failed to load %s\n", file);
+    lineiter_free(line);
+    fclose_comp(fp, ispipe);
+    ckd_free(darray);
+    ps_lattice_free(dag);
+    return NULL;
+}
 
-    /* Free nodes unreachable from dag->end and their links */
-    ps_lattice_delete_unreachable(dag);
+/* Find the value of a field in an HTK lattice line. */
+static char const *
+htk_field(char **fields, int32 n_fields, char const *name, char const *longname)
+{
+    int32 i;
 
-    if (ps) {
-        /* Build links around silence and filler words, since they do
-         * not exist in the language model.  FIXME: This is
-         * potentially buggy, as we already do this before outputing
-         * lattices. */
-        pip = logmath_log(dag->lmath, cmd_ln_float32_r(ps->config, "-pip"));
-        silpen = pip + logmath_log(dag->lmath,
-                                   cmd_ln_float32_r(ps->config, "-silprob"));
-        fillpen = pip + logmath_log(dag->lmath,
-                                    cmd_ln_float32_r(ps->config, "-fillprob"));
-        ps_lattice_penalize_fillers(dag, silpen, fillpen);
+    for (i = 0; i < n_fields; ++i) {
+        char const *eq = strchr(fields[i], '=');
+        size_t len;
+
+        if (eq == NULL)
+            continue;
+        len = eq - fields[i];
+        if ((len == strlen(name) && 0 == strncmp(fields[i], name, len))
+            || (longname && len == strlen(longname)
+                && 0 == strncmp(fields[i], longname, len)))
+            return eq + 1;
     }
+    return NULL;
+}
 
+ps_lattice_t *
+ps_lattice_read_htk(ps_decoder_t *ps, char const *file)
+{
+    FILE *fp;
+    int32 ispipe;
+    lineiter_t *line;
+    ps_latnode_t **darray, *d;
+    ps_lattice_t *dag;
+    char **fields;
+    char const *val;
+    float64 lnbase;
+    int32 n_fields, n_nodes, start, end, i;
+
+    E_INFO("Reading HTK lattice file: %s\n", file);
+    if ((fp = fopen_compchk(file, &ispipe)) == NULL) {
+        E_ERROR_SYSTEM("Failed to open HTK lattice file '%s' for reading", file);
+        return NULL;
+    }
+    dag = ps_lattice_init_read(ps);
+    darray = NULL;
+    fields = NULL;
+    lnbase = 1.0;
+    n_nodes = 0;
+    start = end = -1;
+
+    for (line = lineiter_start_clean(fp); line; line = lineiter_next(line)) {
+        ckd_free(fields);
+        if ((n_fields = str2words(line->buf, NULL, 0)) <= 0) {
+            fields = NULL;
+            continue;
+        }
+        fields = ckd_calloc(n_fields, sizeof(*fields));
+        str2words(line->buf, fields, n_fields);
+
+        if ((val = htk_field(fields, n_fields, "I", NULL)) != NULL) {
+            char const *word, *time, *var;
+            char *wd;
+            int32 id, w;
+
+            id = atoi(val);
+            if (darray == NULL || id < 0 || id >= n_nodes || darray[id]) {
+                E_ERROR("Invalid node %s\n", val);
+                goto load_error;
+            }
+            if ((word = htk_field(fields, n_fields, "W", "WORD")) == NULL
+                || (time = htk_field(fields, n_fields, "t", "time")) == NULL) {
+                E_ERROR("Node %d has no word or time (words on links "
+                        "are not supported)\n", id);
+                goto load_error;
+            }
+            if (0 == strcmp(word, "!SENT_START"))
+                word = S3_START_WORD;
+            else if (0 == strcmp(word, "!SENT_END"))
+                word = S3_FINISH_WORD;
+            else if (0 == strcmp(word, "!NULL"))
+                word = S3_SILENCE_WORD;
+            var = htk_field(fields, n_fields, "v", "var");
+            if (var && atoi(var) > 1)
+                wd = string_join(word, "(", var, ")", NULL);
+            else
+                wd = ckd_salloc(word);
+            w = ps_lattice_read_word(dag, wd);
+            if (w < 0) {
+                E_ERROR("Unknown word %s\n", wd);
+                ckd_free(wd);
+                goto load_error;
+            }
+            ckd_free(wd);
+
+            d = darray[id] = listelem_malloc(dag->latnode_alloc);
+            memset(d, 0, sizeof(*d));
+            d->id = id;
+            d->wid = w;
+            d->basewid = dict_basewid(dag->dict, w);
+            d->sf = (int32)(atof_c(time) * dag->frate + 0.5);
+            d->fef = d->lef = -1;
+        }
+        else if ((val = htk_field(fields, n_fields, "J", NULL)) != NULL) {
+            char const *s, *e, *a;
+            ps_latnode_t *from, *to;
+            int32 ascr;
+
+            s = htk_field(fields, n_fields, "S", "START");
+            e = htk_field(fields, n_fields, "E", "END");
+            a = htk_field(fields, n_fields, "a", "acoustic");
+            if (s == NULL || e == NULL || darray == NULL
+                || atoi(s) < 0 || atoi(s) >= n_nodes
+                || atoi(e) < 0 || atoi(e) >= n_nodes
+                || (from = darray[atoi(s)]) == NULL
+                || (to = darray[atoi(e)]) == NULL) {
+                E_ERROR("Invalid link %s\n", val);
+                goto load_error;
+            }
+            if (htk_field(fields, n_fields, "W", "WORD")) {
+                E_ERROR("Words on links are not supported\n");
+                goto load_error;
+            }
+            ascr = a ? logmath_ln_to_log(dag->lmath, atof_c(a) * lnbase) : 0;
+            ps_lattice_link(dag, from, to, ascr >> SENSCR_SHIFT, to->sf - 1);
+            if (from->fef == -1 || to->sf - 1 < from->fef)
+                from->fef = to->sf - 1;
+            if (to->sf - 1 > from->lef)
+                from->lef = to->sf - 1;
+        }
+        else {
+            /* Header fields. */
+            if ((val = htk_field(fields, n_fields, "base", NULL)) != NULL) {
+                if (atof_c(val) <= 0.0) {
+                    E_ERROR("Linear scores (base=%s) are not supported\n", val);
+                    goto load_error;
+                }
+                lnbase = log(atof_c(val));
+            }
+            if ((val = htk_field(fields, n_fields, "start", NULL)) != NULL)
+                start = atoi(val);
+            if ((val = htk_field(fields, n_fields, "end", NULL)) != NULL)
+                end = atoi(val);
+            if ((val = htk_field(fields, n_fields, "N", "NODES")) != NULL) {
+                if (darray != NULL || (n_nodes = atoi(val)) <= 0) {
+                    E_ERROR("Invalid node count %s\n", val);
+                    goto load_error;
+                }
+                darray = ckd_calloc(n_nodes, sizeof(*darray));
+            }
+        }
+    }
+    ckd_free(fields);
+    fields = NULL;
+    fclose_comp(fp, ispipe);
+    fp = NULL;
+
+    if (darray == NULL) {
+        E_ERROR("Node count missing\n");
+        goto load_error;
+    }
+    /* Without start= and end=, use the nodes with no entries or exits. */
+    for (i = 0; i < n_nodes; ++i) {
+        if (darray[i] == NULL) {
+            E_ERROR("Node %d missing\n", i);
+            goto load_error;
+        }
+        if (start == -1 && darray[i]->entries == NULL)
+            start = i;
+        if (end == -1 && darray[i]->exits == NULL)
+            end = i;
+    }
+    if (start < 0 || start >= n_nodes || end < 0 || end >= n_nodes) {
+        E_ERROR("Start or end node missing or invalid\n");
+        goto load_error;
+    }
+    dag->start = darray[start];
+    dag->end = darray[end];
+
+    /* Node times only give start frames, so the last frame is the
+     * start of the end node. */
+    dag->n_frames = dag->end->sf + 1;
+    for (i = n_nodes - 1; i >= 0; --i) {
+        d = darray[i];
+        if (d->fef == -1)
+            d->fef = d->lef = dag->n_frames - 1;
+        d->next = dag->nodes;
+        dag->nodes = d;
+    }
+    ckd_free(darray);
+
+    ps_lattice_finish_read(dag, ps);
     return dag;
 
   load_error:
     E_ERROR("Failed to load %s\n", file);
-    lineiter_free(line);
-    fclose_comp(fp, ispipe);
+    ckd_free(fields);
+    if (fp) {
+        lineiter_free(line);
+        fclose_comp(fp, ispipe);
+    }
     ckd_free(darray);
+    ps_lattice_free(dag);
     return NULL;
 }
 
@@ -667,11 +1010,31 @@ ps_lattice_free(ps_lattice_t *dag)
     listelem_alloc_free(dag->latnode_alloc);
     listelem_alloc_free(dag->latlink_alloc);
     listelem_alloc_free(dag->latlink_list_alloc);    
+    ckd_free(dag->node_pool);
+    ckd_free(dag->link_pool);
+    ckd_free(dag->list_pool);
     ckd_free(dag->hyp_str);
     ckd_free(dag);
     return 0;
 }
 
+size_t
+ps_lattice_mem_size(ps_lattice_t *dag)
+{
+    size_t size;
+
+    size = sizeof(*dag)
+        + listelem_mem_size(dag->latnode_alloc)
+        + listelem_mem_size(dag->latlink_alloc)
+        + listelem_mem_size(dag->latlink_list_alloc)
+        + dag->n_pool_nodes * sizeof(*dag->node_pool)
+        + dag->n_pool_links * (sizeof(*dag->link_pool)
+                               + 2 * sizeof(*dag->list_pool));
+    if (dag->hyp_str)
+        size += strlen(dag->hyp_str) + 1;
+    return size;
+}
+
 logmath_t *
 ps_lattice_get_logmath(ps_lattice_t *dag)
 {
@@ -1436,79 +1799,112 @@ ps_lattice_joint(ps_lattice_t *dag, ps_latlink_t *link, float32 ascale)
     return jprob;
 }
 
+/* Unscaled bigram probability of the words on either side of a link. */
+static int32
+ps_lattice_link_lmprob(ps_lattice_t *dag, ngram_model_t *lmset,
+                       ps_latlink_t *link)
+{
+    int32 n_used;
+    int32 from_wid, to_wid;
+    int16 from_is_fil, to_is_fil;
+
+    if (lmset == NULL)
+        return 0;
+
+    from_wid = link->from->basewid;
+    to_wid = link->to->basewid;
+    from_is_fil = dict_filler_word(dag->dict, from_wid) && link->from != dag->start;
+    to_is_fil = dict_filler_word(dag->dict, to_wid) && link->to != dag->end;
+
+    /* Find word predecessor if from-word is filler */
+    if (!to_is_fil && from_is_fil) {
+        ps_latlink_t *prev_link = link;
+        while (prev_link->best_prev != NULL) {
+            prev_link = prev_link->best_prev;
+            from_wid = prev_link->from->basewid;
+            if (!dict_filler_word(dag->dict, from_wid) || prev_link->from == dag->start) {
+                from_is_fil = FALSE;
+                break;
+            }
+        }
+    }
+
+    if (from_is_fil || to_is_fil)
+        return 0;
+    return ngram_ng_prob(lmset, to_wid, &from_wid, 1, &n_used);
+}
+
 int32
 ps_lattice_posterior(ps_lattice_t *dag, ngram_model_t *lmset,
                      float32 ascale)
 {
     logmath_t *lmath;
-    ps_latnode_t *node;
-    ps_latlink_t *link;
+    ps_latnode_t *node, **order;
     latlink_list_t *x;
     ps_latlink_t *bestend;
-    int32 bestescr;
+    int32 bestescr, n_nodes, n_order, i;
 
     lmath = dag->lmath;
 
-    /* Reset all betas to zero. */
+    /* Order the nodes so that each comes after all of its successors,
+     * using info.fanin to count the exits not yet seen.  This visits
+     * every node and link once, unlike traversing links in reverse. */
+    for (n_nodes = 0, node = dag->nodes; node; node = node->next)
+        ++n_nodes;
+    order = ckd_calloc(n_nodes, sizeof(*order));
+    n_order = 0;
     for (node = dag->nodes; node; node = node->next) {
-        for (x = node->exits; x; x = x->next) {
-            x->link->beta = logmath_get_zero(lmath);
-        }
+        node->info.fanin = 0;
+        for (x = node->exits; x; x = x->next)
+            ++node->info.fanin;
+        if (node->info.fanin == 0)
+            order[n_order++] = node;
     }
+    for (i = 0; i < n_order; ++i)
+        for (x = order[i]->entries; x; x = x->next)
+            if (--x->link->from->info.fanin == 0)
+                order[n_order++] = x->link->from;
 
     bestend = NULL;
     bestescr = MAX_NEG_INT32;
-    /* Accumulate backward probabilities for all links. */
-    for (link = ps_lattice_reverse_edges(dag, NULL, NULL);
-         link; link = ps_lattice_reverse_next(dag, NULL)) {
-        int32 bprob, n_used;
-        int32 from_wid, to_wid;
-        int16 from_is_fil, to_is_fil;
-
-        from_wid = link->from->basewid;
-        to_wid = link->to->basewid;
-        from_is_fil = dict_filler_word(dag->dict, from_wid) && link->from != dag->start;
-        to_is_fil = dict_filler_word(dag->dict, to_wid) && link->to != dag->end;
-
-        /* Find word predecessor if from-word is filler */
-        if (!to_is_fil && from_is_fil) {
-            ps_latlink_t *prev_link = link;
-            while (prev_link->best_prev != NULL) {
-                prev_link = prev_link->best_prev;
-                from_wid = prev_link->from->basewid;
-                if (!dict_filler_word(dag->dict, from_wid) || prev_link->from == dag->start) {
-                    from_is_fil = FALSE;
-                    break;
-                }
-            }
-        }
-
-        /* Calculate LM probability. */
-        if (lmset && !from_is_fil && !to_is_fil)
-            bprob = ngram_ng_prob(lmset, to_wid, &from_wid, 1, &n_used);
-        else
-            bprob = 0;
-
-        if (link->to == dag->end) {
-            /* Track the best path - we will backtrace in order to
-               calculate the unscaled joint probability for sentence
-               posterior. */
-            if (link->path_scr BETTER_THAN bestescr) {
-                bestescr = link->path_scr;
-                bestend = link;
-            }
+    /* Accumulate backward probabilities for all links.  The sum over
+     * the exits of a node is the same for every link entering it, so
+     * it is computed once per node. */
+    for (i = 0; i < n_order; ++i) {
+        int32 exit_beta;
+
+        node = order[i];
+        if (node == dag->end) {
             /* Imaginary exit link from final node has beta = 1.0 */
-            link->beta = bprob + (dag->final_node_ascr << SENSCR_SHIFT) * ascale;
+            exit_beta = (dag->final_node_ascr << SENSCR_SHIFT) * ascale;
         }
         else {
-            /* Update beta from all outgoing betas. */
-            for (x = link->to->exits; x; x = x->next) {
-                link->beta = logmath_add(lmath, link->beta,
-                                         x->link->beta + bprob
-                                         + (x->link->ascr << SENSCR_SHIFT) * ascale);
+            exit_beta = logmath_get_zero(lmath);
+            for (x = node->exits; x; x = x->next)
+                exit_beta = logmath_add(lmath, exit_beta,
+                                        x->link->beta
+                                        + (x->link->ascr << SENSCR_SHIFT) * ascale);
+        }
+        for (x = node->entries; x; x = x->next) {
+            ps_latlink_t *link = x->link;
+
+            if (node == dag->end) {
+                /* Track the best path - we will backtrace in order to
+                   calculate the unscaled joint probability for sentence
+                   posterior. */
+                if (link->path_scr BETTER_THAN bestescr) {
+                    bestescr = link->path_scr;
+                    bestend = link;
+                }
             }
+            /* Links which lead nowhere have zero probability. */
+            if (exit_beta <= logmath_get_zero(lmath))
+                link->beta = logmath_get_zero(lmath);
+            else
+                link->beta = exit_beta + ps_lattice_link_lmprob(dag, lmset, link);
         }
     }
+    ckd_free(order);
 
     /* Return P(S|O) = P(O,S)/P(O) */
     return ps_lattice_joint(dag, bestend, ascale) - dag->norm;
@@ -1517,39 +1913,34 @@ ps_lattice_posterior(ps_lattice_t *dag, ngram_model_t *lmset,
 int32
 ps_lattice_posterior_prune(ps_lattice_t *dag, int32 beam)
 {
-    ps_latlink_t *link;
+    ps_latnode_t *node;
     int npruned = 0;
 
-    for (link = ps_lattice_traverse_edges(dag, dag->start, dag->end);
-         link; link = ps_lattice_traverse_next(dag, dag->end)) {
-        link->from->reachable = FALSE;
-        if (link->alpha + link->beta - dag->norm < beam) {
-            latlink_list_t *x, *tmp, *next;
-            tmp = NULL;
-            for (x = link->from->exits; x; x = next) {
-                next = x->next;
-                if (x->link == link) {
-                    listelem_free(dag->latlink_list_alloc, x);
-                }
-                else {
-                    x->next = tmp;
-                    tmp = x;
-                }
+    /* Posteriors do not depend on the order of links, so just sweep
+     * through the exits of every node. */
+    for (node = dag->nodes; node; node = node->next)
+        node->reachable = FALSE;
+    for (node = dag->nodes; node; node = node->next) {
+        latlink_list_t *x, **px;
+
+        for (px = &node->exits; (x = *px) != NULL;) {
+            ps_latlink_t *link = x->link;
+            latlink_list_t *y, **py;
+
+            if (link->alpha + link->beta - dag->norm >= beam) {
+                px = &x->next;
+                continue;
             }
-            link->from->exits = tmp;
-            tmp = NULL;
-            for (x = link->to->entries; x; x = next) {
-                next = x->next;
-                if (x->link == link) {
-                    listelem_free(dag->latlink_list_alloc, x);
-                }
-                else {
-                    x->next = tmp;
-                    tmp = x;
+            *px = x->next;
+            latlink_list_free(dag, x);
+            for (py = &link->to->entries; (y = *py) != NULL; py = &y->next) {
+                if (y->link == link) {
+                    *py = y->next;
+                    latlink_list_free(dag, y);
+                    break;
                 }
             }
-            link->to->entries = tmp;
-            listelem_free(dag->latlink_alloc, link);
+            latlink_free(dag, link);
             ++npruned;
         }
     }
@@ -1560,9 +1951,12 @@ ps_lattice_posterior_prune(ps_lattice_t *dag, int32 beam)
 
 
 /* Parameters to prune n-best alternatives search */
-#define MAX_PATHS	500     /* Max allowed active paths at any time */
 #define MAX_HYP_TRIES	10000
 
+/* Hashing of word sequences in N-best search (64-bit FNV-1a over word IDs) */
+#define LATPATH_HASH_INIT	0xcbf29ce484222325ULL
+#define LATPATH_HASH_PRIME	0x100000001b3ULL
+
 /*
  * For each node in any path between from and end of utt, find the
  * best score from "from".sf to end of utt.  (NOTE: Uses bigram probs;
@@ -1597,53 +1991,199 @@ best_rem_score(ps_astar_t *nbest, ps_latnode_t * from)
     return bestscore;
 }
 
+/* Score of path plus the A* heuristic for the rest of it. */
+static int32
+latpath_total(ps_latpath_t *path)
+{
+    return path->score + path->node->info.rem_score;
+}
+
 /*
- * Insert newpath in sorted (by path score) list of paths.  But if newpath is
- * too far down the list, drop it (FIXME: necessary?)
- * total_score = path score (newpath) + rem_score to end of utt.
+ * Create a path extending parent (or starting anew if it is NULL) by node.
+ */
+static ps_latpath_t *
+latpath_new(ps_astar_t *nbest, ps_latnode_t *node,
+            ps_latpath_t *parent, int32 score)
+{
+    ps_latpath_t *path;
+
+    path = listelem_malloc(nbest->latpath_alloc);
+    path->node = node;
+    path->parent = parent;
+    path->score = score;
+    path->refcount = 1;
+    path->hash = parent ? parent->hash : LATPATH_HASH_INIT;
+    if (dict_real_word(nbest->dag->dict, node->basewid))
+        path->hash = (path->hash ^ (uint64)node->basewid) * LATPATH_HASH_PRIME;
+    if (parent)
+        ++parent->refcount;
+    return path;
+}
+
+/*
+ * Release a reference to path, freeing it along with any part of its
+ * prefix that no other path shares.
  */
 static void
-path_insert(ps_astar_t *nbest, ps_latpath_t *newpath, int32 total_score)
+latpath_free(ps_astar_t *nbest, ps_latpath_t *path)
 {
-    ps_latpath_t *prev, *p;
-    int32 i;
+    while (path && --path->refcount == 0) {
+        ps_latpath_t *parent = path->parent;
+        listelem_free(nbest->latpath_alloc, path);
+        path = parent;
+    }
+}
 
-    prev = NULL;
-    for (i = 0, p = nbest->path_list; (i < MAX_PATHS) && p; p = p->next, i++) {
-        if ((p->score + p->node->info.rem_score) < total_score)
+/*
+ * Key identifying the word sequence of path.  Partial paths must also
+ * agree on the last node and the LM history used to extend it, since
+ * only then are their possible extensions the same.
+ */
+static uint64
+latpath_key(ps_latpath_t *path, int complete)
+{
+    uint64 key = path->hash;
+
+    if (!complete) {
+        key = (key ^ (uint64)(path->node->id + 1)) * LATPATH_HASH_PRIME;
+        key = (key ^ (uint64)(path->parent
+                              ? path->parent->node->basewid + 1 : 0))
+            * LATPATH_HASH_PRIME;
+    }
+    return key ? key : 1; /* 0 marks an empty slot */
+}
+
+/*
+ * Record key as seen, returning TRUE if it already was.
+ */
+static int
+path_seen(ps_astar_t *nbest, uint64 key)
+{
+    int32 i, mask;
+
+    if (2 * (nbest->n_seen + 1) > nbest->seen_size) {
+        uint64 *old = nbest->seen;
+        int32 old_size = nbest->seen_size;
+
+        nbest->seen_size = old_size ? old_size * 2 : 256;
+        nbest->seen = ckd_calloc(nbest->seen_size, sizeof(*nbest->seen));
+        mask = nbest->seen_size - 1;
+        for (i = 0; i < old_size; ++i) {
+            int32 j;
+
+            if (old[i] == 0)
+                continue;
+            for (j = (int32)((old[i] ^ (old[i] >> 32)) & mask);
+                 nbest->seen[j]; j = (j + 1) & mask)
+                ;
+            nbest->seen[j] = old[i];
+        }
+        ckd_free(old);
+    }
+
+    mask = nbest->seen_size - 1;
+    for (i = (int32)((key ^ (key >> 32)) & mask);
+         nbest->seen[i]; i = (i + 1) & mask)
+        if (nbest->seen[i] == key)
+            return TRUE;
+    nbest->seen[i] = key;
+    ++nbest->n_seen;
+    return FALSE;
+}
+
+static void
+heap_up(ps_astar_t *nbest, int32 i)
+{
+    ps_latpath_t **heap = nbest->heap;
+    ps_latpath_t *path = heap[i];
+    int32 total = latpath_total(path);
+
+    while (i > 0) {
+        int32 parent = (i - 1) / 2;
+
+        if (latpath_total(heap[parent]) >= total)
             break;
-        prev = p;
+        heap[i] = heap[parent];
+        i = parent;
     }
+    heap[i] = path;
+}
 
-    /* newpath should be inserted between prev and p */
-    if (i < MAX_PATHS) {
-        /* Insert new partial hyp */
-        newpath->next = p;
-        if (!prev)
-            nbest->path_list = newpath;
-        else
-            prev->next = newpath;
-        if (!p)
-            nbest->path_tail = newpath;
+static void
+heap_down(ps_astar_t *nbest, int32 i)
+{
+    ps_latpath_t **heap = nbest->heap;
+    ps_latpath_t *path = heap[i];
+    int32 total = latpath_total(path);
+
+    for (;;) {
+        int32 child = 2 * i + 1;
 
-        nbest->n_path++;
-        nbest->n_hyp_insert++;
-        nbest->insert_depth += i;
+        if (child >= nbest->n_path)
+            break;
+        if (child + 1 < nbest->n_path
+            && latpath_total(heap[child + 1]) > latpath_total(heap[child]))
+            ++child;
+        if (latpath_total(heap[child]) <= total)
+            break;
+        heap[i] = heap[child];
+        i = child;
     }
-    else {
-        /* newpath score too low; reject it and also prune paths beyond MAX_PATHS */
-        nbest->path_tail = prev;
-        prev->next = NULL;
-        nbest->n_path = MAX_PATHS;
-        listelem_free(nbest->latpath_alloc, newpath);
+    heap[i] = path;
+}
+
+/*
+ * Insert newpath in the frontier of partial paths.  If it is full,
+ * newpath replaces the worst path in it, or is dropped if it is no
+ * better than that.
+ */
+static void
+path_insert(ps_astar_t *nbest, ps_latpath_t *newpath)
+{
+    int32 i;
 
+    if (nbest->n_path < nbest->max_paths) {
+        i = nbest->n_path++;
+    }
+    else {
+        /* The worst path is a leaf, so only the second half of the
+         * heap needs to be searched, and only after it changes. */
+        if (nbest->worst < 0) {
+            nbest->worst = nbest->n_path / 2;
+            for (i = nbest->worst + 1; i < nbest->n_path; ++i)
+                if (latpath_total(nbest->heap[i])
+                    < latpath_total(nbest->heap[nbest->worst]))
+                    nbest->worst = i;
+        }
+        i = nbest->worst;
         nbest->n_hyp_reject++;
-        for (; p; p = newpath) {
-            newpath = p->next;
-            listelem_free(nbest->latpath_alloc, p);
-            nbest->n_hyp_reject++;
+        if (latpath_total(newpath) <= latpath_total(nbest->heap[i])) {
+            latpath_free(nbest, newpath);
+            return;
         }
+        latpath_free(nbest, nbest->heap[i]);
     }
+    nbest->heap[i] = newpath;
+    heap_up(nbest, i);
+    nbest->worst = -1;
+    nbest->n_hyp_insert++;
+}
+
+/* Remove the best path from the frontier. */
+static ps_latpath_t *
+path_pop(ps_astar_t *nbest)
+{
+    ps_latpath_t *top;
+
+    if (nbest->n_path == 0)
+        return NULL;
+    top = nbest->heap[0];
+    if (--nbest->n_path > 0) {
+        nbest->heap[0] = nbest->heap[nbest->n_path];
+        heap_down(nbest, 0);
+    }
+    nbest->worst = -1;
+    return top;
 }
 
 /* Find all possible extensions to given partial path */
@@ -1651,54 +2191,35 @@ static void
 path_extend(ps_astar_t *nbest, ps_latpath_t * path)
 {
     latlink_list_t *x;
-    ps_latpath_t *newpath;
-    int32 total_score, tail_score;
 
     /* Consider all successors of path->node */
     for (x = path->node->exits; x; x = x->next) {
-        int32 n_used;
+        int32 n_used, score;
 
         /* Skip successor if no path from it reaches the final node */
         if (x->link->to->info.rem_score <= WORST_SCORE)
             continue;
 
-        /* Create path extension and compute exact score for this extension */
-        newpath = listelem_malloc(nbest->latpath_alloc);
-        newpath->node = x->link->to;
-        newpath->parent = path;
-        newpath->score = path->score + x->link->ascr;
+        /* Compute exact score for this extension */
+        score = path->score + x->link->ascr;
         if (nbest->lmset) {
             if (path->parent) {
-                newpath->score += nbest->lwf
-                    * (ngram_tg_score(nbest->lmset, newpath->node->basewid,
+                score += nbest->lwf
+                    * (ngram_tg_score(nbest->lmset, x->link->to->basewid,
                                       path->node->basewid,
                                       path->parent->node->basewid, &n_used)
                        >> SENSCR_SHIFT);
             }
             else 
-                newpath->score += nbest->lwf
-                    * (ngram_bg_score(nbest->lmset, newpath->node->basewid,
+                score += nbest->lwf
+                    * (ngram_bg_score(nbest->lmset, x->link->to->basewid,
                                       path->node->basewid, &n_used)
                        >> SENSCR_SHIFT);
         }
 
-        /* Insert new partial path hypothesis into sorted path_list */
+        /* Insert new partial path hypothesis into the frontier */
         nbest->n_hyp_tried++;
-        total_score = newpath->score + newpath->node->info.rem_score;
-
-        /* First see if hyp would be worse than the worst */
-        if (nbest->n_path >= MAX_PATHS) {
-            tail_score =
-                nbest->path_tail->score
-                + nbest->path_tail->node->info.rem_score;
-            if (total_score < tail_score) {
-                listelem_free(nbest->latpath_alloc, newpath);
-                nbest->n_hyp_reject++;
-                continue;
-            }
-        }
-
-        path_insert(nbest, newpath, total_score);
+        path_insert(nbest, latpath_new(nbest, x->link->to, path, score));
     }
 }
 
@@ -1707,7 +2228,9 @@ ps_astar_start(ps_lattice_t *dag,
                   ngram_model_t *lmset,
                   float32 lwf,
                   int sf, int ef,
-                  int w1, int w2)
+                  int w1, int w2,
+                  int32 max_paths,
+                  int32 max_per_frame)
 {
     ps_astar_t *nbest;
     ps_latnode_t *node;
@@ -1724,6 +2247,15 @@ ps_astar_start(ps_lattice_t *dag,
     nbest->w1 = w1;
     nbest->w2 = w2;
     nbest->latpath_alloc = listelem_alloc_init(sizeof(ps_latpath_t));
+    nbest->hyps = ckd_arena_init(4096);
+    nbest->max_paths = (max_paths < 1) ? 1 : max_paths;
+    nbest->heap = ckd_calloc(nbest->max_paths, sizeof(*nbest->heap));
+    nbest->worst = -1;
+    if (max_per_frame > 0) {
+        nbest->max_per_frame = max_per_frame;
+        nbest->n_frame_paths = ckd_calloc(dag->n_frames + 2,
+                                          sizeof(*nbest->n_frame_paths));
+    }
 
     /* Initialize rem_score (A* heuristic) to default values */
     for (node = dag->nodes; node; node = node->next) {
@@ -1735,26 +2267,21 @@ ps_astar_start(ps_lattice_t *dag,
             node->info.rem_score = 1;   /* +ve => unknown value */
     }
 
-    /* Create initial partial hypotheses list consisting of nodes starting at sf */
-    nbest->path_list = nbest->path_tail = NULL;
+    /* Create initial partial hypotheses consisting of nodes starting at sf */
     for (node = dag->nodes; node; node = node->next) {
         if (node->sf == sf) {
-            ps_latpath_t *path;
-            int32 n_used;
+            int32 n_used, score;
 
             best_rem_score(nbest, node);
-            path = listelem_malloc(nbest->latpath_alloc);
-            path->node = node;
-            path->parent = NULL;
             if (nbest->lmset)
-                path->score = nbest->lwf *
+                score = nbest->lwf *
                     ((w1 < 0)
                     ? ngram_bg_score(nbest->lmset, node->basewid, w2, &n_used)
                     : ngram_tg_score(nbest->lmset, node->basewid, w2, w1, &n_used));
             else
-                path->score = 0;
-            path->score >>= SENSCR_SHIFT;
-            path_insert(nbest, path, path->score + node->info.rem_score);
+                score = 0;
+            score >>= SENSCR_SHIFT;
+            path_insert(nbest, latpath_new(nbest, node, NULL, score));
         }
     }
 
@@ -1765,29 +2292,43 @@ ps_latpath_t *
 ps_astar_next(ps_astar_t *nbest)
 {
     ps_lattice_t *dag;
+    ps_latpath_t *path;
 
     dag = nbest->dag;
 
-    /* Pop the top (best) partial hypothesis */
-    while ((nbest->top = nbest->path_list) != NULL) {
-        nbest->path_list = nbest->path_list->next;
-        if (nbest->top == nbest->path_tail)
-            nbest->path_tail = NULL;
-        nbest->n_path--;
+    /* The previous hypothesis is no longer needed. */
+    latpath_free(nbest, nbest->top);
+    nbest->top = NULL;
 
+    /* Pop the top (best) partial hypothesis */
+    while ((path = path_pop(nbest)) != NULL) {
         /* Complete hypothesis? */
-        if ((nbest->top->node->sf >= nbest->ef)
-            || ((nbest->top->node == dag->end) &&
+        if ((path->node->sf >= nbest->ef)
+            || ((path->node == dag->end) &&
                 (nbest->ef > dag->end->sf))) {
-            /* FIXME: Verify that it is non-empty.  Also we may want
-             * to verify that it is actually distinct from other
-             * paths, since often this is not the case*/
-            return nbest->top;
-        }
-        else {
-            if (nbest->top->node->fef < nbest->ef)
-                path_extend(nbest, nbest->top);
+            /* Paths come out best first, so any later one with the
+             * same words is not worth returning. */
+            if (path_seen(nbest, latpath_key(path, TRUE))) {
+                nbest->n_hyp_dup++;
+                latpath_free(nbest, path);
+                continue;
+            }
+            /* FIXME: Verify that it is non-empty. */
+            nbest->top = path;
+            return path;
         }
+
+        /* Likewise, a path with the same words and LM history as one
+         * already extended could only lead to duplicates. */
+        if (path_seen(nbest, latpath_key(path, FALSE)))
+            nbest->n_hyp_dup++;
+        else if (path->node->fef < nbest->ef
+                 && (nbest->max_per_frame == 0
+                     || (nbest->n_frame_paths[path->node->sf]++
+                         < nbest->max_per_frame)))
+            path_extend(nbest, path);
+        /* Its extensions keep it alive if they need it. */
+        latpath_free(nbest, path);
     }
 
     /* Did not find any more paths to extend. */
@@ -1820,7 +2361,7 @@ ps_astar_hyp(ps_astar_t *nbest, ps_latpath_t *path)
     }
 
     /* Backtrace again to construct hypothesis string. */
-    hyp = ckd_calloc(1, len);
+    hyp = ckd_arena_calloc(nbest->hyps, 1, len);
     c = hyp + len - 1;
     for (p = path; p; p = p->parent) {
         if (dict_real_word(ps_search_dict(search), p->node->basewid)) {
@@ -1837,7 +2378,6 @@ ps_astar_hyp(ps_astar_t *nbest, ps_latpath_t *path)
         }
     }
 
-    nbest->hyps = glist_add_ptr(nbest->hyps, hyp);
     return hyp;
 }
 
@@ -1918,15 +2458,13 @@ ps_astar_seg_iter(ps_astar_t *astar, ps_latpath_t *path, float32 lwf)
 void
 ps_astar_finish(ps_astar_t *nbest)
 {
-    gnode_t *gn;
-
     /* Free all hyps. */
-    for (gn = nbest->hyps; gn; gn = gnode_next(gn)) {
-        ckd_free(gnode_ptr(gn));
-    }
-    glist_free(nbest->hyps);
+    ckd_arena_free(nbest->hyps);
     /* Free all paths. */
     listelem_alloc_free(nbest->latpath_alloc);
+    ckd_free(nbest->heap);
+    ckd_free(nbest->seen);
+    ckd_free(nbest->n_frame_paths);
     /* Free the Henge. */
     ckd_free(nbest);
 }
@@ -0,0 +1,653 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file ps_lattice_bin.c
+ * @brief Compact binary lattice files.
+ *
+ * The file starts with a fixed header of little-endian 32-bit fields:
+ *
+ *   magic ("PSLATBIN"), version, frame rate, frames, nodes, links,
+ *   start node, end node, words, nodes per block, blocks, score shift,
+ *   log base (64-bit IEEE), size of word table, size of block data
+ *
+ * followed by the word table (NUL-terminated strings, padded to four
+ * bytes), the block index (byte offset and first link of each block)
+ * and the blocks.  Each block holds a fixed number of nodes, each one
+ * followed by its exits, all as variable-length integers:
+ *
+ *   word, start frame, first end frame, last end frame, exits,
+ *   { destination node, acoustic score } ...
+ *
+ * Frames are coded as differences from the previous frame in the
+ * block (start frame) or in the node, and destinations as differences
+ * from the source node, so nearly everything fits in one or two
+ * bytes.  Since each block starts afresh, a reader can map the file
+ * and decode any part of it without reading the rest.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/mmio.h>
+
+#include "pocketsphinx_internal.h"
+#include "ps_lattice_internal.h"
+#include "dict.h"
+
+#define LATBIN_MAGIC "PSLATBIN"
+#define LATBIN_VERSION 1
+#define LATBIN_BLOCK_NODES 256
+#define LATBIN_HEADER_SIZE 68
+
+struct ps_latbin_s {
+    mmio_file_t *mf;     /**< Memory-mapped file, or NULL if read. */
+    uint8 *buf;          /**< File contents, if not memory-mapped. */
+    uint8 const *data;   /**< Start of file. */
+
+    float64 logbase;
+    int32 frate;
+    int32 n_frames;
+    int32 n_nodes;
+    int32 n_links;
+    int32 start;
+    int32 end;
+    int32 n_words;
+    int32 block_nodes;
+    int32 n_blocks;
+    int32 shift;         /**< Scores are stored shifted right by this. */
+
+    char const **words;  /**< Word strings, pointing into the file. */
+    uint8 const *index;  /**< Block index. */
+    uint8 const *blocks; /**< Start of block data. */
+    uint8 const *blocks_end; /**< End of block data. */
+
+    /* Decoding position. */
+    uint8 const *ptr;
+    int32 node;          /**< Next node to be read. */
+    int32 cur;           /**< Node whose exits are being read. */
+    int32 prev_sf;       /**< Start frame of previous node in block. */
+    int32 links_left;    /**< Exits of cur not yet read. */
+};
+
+/**
+ * Growable byte buffer for writing.
+ */
+typedef struct latbin_buf_s {
+    uint8 *buf;
+    size_t len;
+    size_t alloc;
+} latbin_buf_t;
+
+static void
+buf_put(latbin_buf_t *b, void const *data, size_t n)
+{
+    if (b->len + n > b->alloc) {
+        b->alloc = (b->len + n) * 2;
+        b->buf = ckd_realloc(b->buf, b->alloc);
+    }
+    memcpy(b->buf + b->len, data, n);
+    b->len += n;
+}
+
+static void
+buf_put_u32(latbin_buf_t *b, uint32 v)
+{
+    uint8 le[4];
+
+    le[0] = v & 0xff;
+    le[1] = (v >> 8) & 0xff;
+    le[2] = (v >> 16) & 0xff;
+    le[3] = (v >> 24) & 0xff;
+    buf_put(b, le, 4);
+}
+
+static void
+buf_put_varint(latbin_buf_t *b, uint64 v)
+{
+    uint8 bytes[10];
+    int n = 0;
+
+    while (v >= 0x80) {
+        bytes[n++] = (uint8)(v | 0x80);
+        v >>= 7;
+    }
+    bytes[n++] = (uint8)v;
+    buf_put(b, bytes, n);
+}
+
+/* Signed values are zig-zag coded so that small negative ones are short. */
+static void
+buf_put_svarint(latbin_buf_t *b, int64 v)
+{
+    buf_put_varint(b, ((uint64)v << 1) ^ (uint64)(v >> 63));
+}
+
+static uint32
+get_u32(uint8 const *p)
+{
+    return (uint32)p[0] | ((uint32)p[1] << 8)
+        | ((uint32)p[2] << 16) | ((uint32)p[3] << 24);
+}
+
+static int
+get_varint(ps_latbin_t *lb, uint64 *out_v)
+{
+    uint64 v = 0;
+    int shift;
+
+    for (shift = 0; shift < 64; shift += 7) {
+        uint8 c;
+        if (lb->ptr >= lb->blocks_end)
+            return -1;
+        c = *lb->ptr++;
+        v |= (uint64)(c & 0x7f) << shift;
+        if ((c & 0x80) == 0) {
+            *out_v = v;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static int
+get_svarint(ps_latbin_t *lb, int64 *out_v)
+{
+    uint64 v;
+
+    if (get_varint(lb, &v) < 0)
+        return -1;
+    *out_v = (int64)(v >> 1) ^ -(int64)(v & 1);
+    return 0;
+}
+
+static int
+lattice_score_ok(int32 ascr)
+{
+    /* ps_lattice_write() skips the same links. */
+    return !(ascr WORSE_THAN WORST_SCORE || ascr BETTER_THAN 0);
+}
+
+int
+ps_lattice_write_bin(ps_lattice_t *dag, char const *filename)
+{
+    latbin_buf_t header, words, index, blocks;
+    ps_latnode_t *d;
+    int32 *wordmap, n_words, n_nodes, n_links, n_blocks, prev_sf, i;
+    uint64 lbbits;
+    float64 logbase;
+    FILE *fp;
+    int rv;
+
+    E_INFO("Writing lattice file: %s\n", filename);
+    if ((fp = fopen(filename, "wb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open lattice file '%s' for writing", filename);
+        return -1;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memset(&words, 0, sizeof(words));
+    memset(&index, 0, sizeof(index));
+    memset(&blocks, 0, sizeof(blocks));
+
+    /* Only the words in the lattice go in the word table. */
+    wordmap = ckd_calloc(dict_size(dag->dict), sizeof(*wordmap));
+    for (i = 0; i < dict_size(dag->dict); ++i)
+        wordmap[i] = -1;
+    n_words = n_nodes = n_links = n_blocks = 0;
+    for (d = dag->nodes; d; d = d->next) {
+        latlink_list_t *l;
+        int32 n_exits;
+
+        d->id = n_nodes;
+        if (wordmap[d->wid] == -1) {
+            char const *word = dict_wordstr(dag->dict, d->wid);
+            wordmap[d->wid] = n_words++;
+            buf_put(&words, word, strlen(word) + 1);
+        }
+        if (n_nodes % LATBIN_BLOCK_NODES == 0) {
+            buf_put_u32(&index, blocks.len);
+            buf_put_u32(&index, n_links);
+            ++n_blocks;
+        }
+        ++n_nodes;
+        n_exits = 0;
+        for (l = d->exits; l; l = l->next)
+            if (lattice_score_ok(l->link->ascr))
+                ++n_exits;
+        n_links += n_exits;
+    }
+    while (words.len % 4)
+        buf_put(&words, "", 1);
+
+    /* Node IDs are all known now, so the blocks can be written. */
+    prev_sf = 0;
+    for (i = 0, d = dag->nodes; d; d = d->next, ++i) {
+        latlink_list_t *l;
+        int32 n_exits;
+
+        if (i % LATBIN_BLOCK_NODES == 0)
+            prev_sf = 0;
+        buf_put_varint(&blocks, wordmap[d->wid]);
+        buf_put_svarint(&blocks, d->sf - prev_sf);
+        buf_put_svarint(&blocks, d->fef - d->sf);
+        buf_put_svarint(&blocks, d->lef - d->fef);
+        prev_sf = d->sf;
+        n_exits = 0;
+        for (l = d->exits; l; l = l->next)
+            if (lattice_score_ok(l->link->ascr))
+                ++n_exits;
+        buf_put_varint(&blocks, n_exits);
+        for (l = d->exits; l; l = l->next) {
+            if (!lattice_score_ok(l->link->ascr))
+                continue;
+            buf_put_svarint(&blocks, l->link->to->id - d->id);
+            buf_put_svarint(&blocks, l->link->ascr);
+        }
+    }
+    ckd_free(wordmap);
+
+    buf_put(&header, LATBIN_MAGIC, 8);
+    buf_put_u32(&header, LATBIN_VERSION);
+    buf_put_u32(&header, dag->frate);
+    buf_put_u32(&header, dag->n_frames);
+    buf_put_u32(&header, n_nodes);
+    buf_put_u32(&header, n_links);
+    buf_put_u32(&header, dag->start->id);
+    buf_put_u32(&header, dag->end->id);
+    buf_put_u32(&header, n_words);
+    buf_put_u32(&header, LATBIN_BLOCK_NODES);
+    buf_put_u32(&header, n_blocks);
+    buf_put_u32(&header, SENSCR_SHIFT);
+    logbase = logmath_get_base(dag->lmath);
+    memcpy(&lbbits, &logbase, sizeof(lbbits));
+    buf_put_u32(&header, (uint32)(lbbits & 0xffffffff));
+    buf_put_u32(&header, (uint32)(lbbits >> 32));
+    buf_put_u32(&header, words.len);
+    buf_put_u32(&header, blocks.len);
+    assert(header.len == LATBIN_HEADER_SIZE);
+
+    rv = 0;
+    if (fwrite(header.buf, 1, header.len, fp) != header.len
+        || fwrite(words.buf, 1, words.len, fp) != words.len
+        || fwrite(index.buf, 1, index.len, fp) != index.len
+        || fwrite(blocks.buf, 1, blocks.len, fp) != blocks.len) {
+        E_ERROR_SYSTEM("Failed to write lattice file '%s'", filename);
+        rv = -1;
+    }
+    if (fclose(fp) != 0 && rv == 0) {
+        E_ERROR_SYSTEM("Failed to write lattice file '%s'", filename);
+        rv = -1;
+    }
+    ckd_free(header.buf);
+    ckd_free(words.buf);
+    ckd_free(index.buf);
+    ckd_free(blocks.buf);
+    return rv;
+}
+
+int
+ps_lattice_is_bin(char const *file)
+{
+    FILE *fp;
+    char magic[8];
+    int rv;
+
+    if ((fp = fopen(file, "rb")) == NULL)
+        return FALSE;
+    rv = (fread(magic, 1, 8, fp) == 8
+          && 0 == memcmp(magic, LATBIN_MAGIC, 8));
+    fclose(fp);
+    return rv;
+}
+
+static uint8 *
+read_file(char const *file, size_t *out_size)
+{
+    FILE *fp;
+    uint8 *buf;
+    long size;
+
+    if ((fp = fopen(file, "rb")) == NULL)
+        return NULL;
+    if (fseek(fp, 0, SEEK_END) < 0 || (size = ftell(fp)) < 0) {
+        fclose(fp);
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_SET);
+    buf = ckd_malloc(size + 1);
+    if (fread(buf, 1, size, fp) != (size_t)size) {
+        ckd_free(buf);
+        fclose(fp);
+        return NULL;
+    }
+    fclose(fp);
+    *out_size = size;
+    return buf;
+}
+
+ps_latbin_t *
+ps_latbin_open(char const *file)
+{
+    ps_latbin_t *lb;
+    uint8 const *p, *end;
+    size_t size, words_size, blocks_size;
+    uint64 lbbits;
+    FILE *fp;
+    int32 i;
+
+    lb = ckd_calloc(1, sizeof(*lb));
+
+    /* Map the file if possible, otherwise just read it. */
+    if ((fp = fopen(file, "rb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open lattice file '%s'", file);
+        goto error_out;
+    }
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fclose(fp);
+    if ((lb->mf = mmio_file_read(file)) != NULL)
+        lb->data = mmio_file_ptr(lb->mf);
+    else if ((lb->data = lb->buf = read_file(file, &size)) == NULL) {
+        E_ERROR_SYSTEM("Failed to read lattice file '%s'", file);
+        goto error_out;
+    }
+    end = lb->data + size;
+
+    p = lb->data;
+    if (size < LATBIN_HEADER_SIZE || memcmp(p, LATBIN_MAGIC, 8) != 0) {
+        E_ERROR("%s is not a binary lattice file\n", file);
+        goto error_out;
+    }
+    if (get_u32(p + 8) != LATBIN_VERSION) {
+        E_ERROR("%s has unknown binary lattice version %u\n",
+                file, get_u32(p + 8));
+        goto error_out;
+    }
+    lb->frate = get_u32(p + 12);
+    lb->n_frames = get_u32(p + 16);
+    lb->n_nodes = get_u32(p + 20);
+    lb->n_links = get_u32(p + 24);
+    lb->start = get_u32(p + 28);
+    lb->end = get_u32(p + 32);
+    lb->n_words = get_u32(p + 36);
+    lb->block_nodes = get_u32(p + 40);
+    lb->n_blocks = get_u32(p + 44);
+    lb->shift = get_u32(p + 48);
+    lbbits = get_u32(p + 52) | ((uint64)get_u32(p + 56) << 32);
+    memcpy(&lb->logbase, &lbbits, sizeof(lb->logbase));
+    words_size = get_u32(p + 60);
+    blocks_size = get_u32(p + 64);
+    p += LATBIN_HEADER_SIZE;
+
+    if (lb->n_nodes < 1 || lb->block_nodes < 1
+        || lb->n_blocks != (lb->n_nodes + lb->block_nodes - 1) / lb->block_nodes
+        || lb->start < 0 || lb->start >= lb->n_nodes
+        || lb->end < 0 || lb->end >= lb->n_nodes
+        || lb->n_words < 1 || lb->shift < 0 || lb->shift > 31
+        || (size_t)(end - p) < words_size + (size_t)lb->n_blocks * 8 + blocks_size) {
+        E_ERROR("%s: Invalid binary lattice header\n", file);
+        goto error_out;
+    }
+
+    /* Find the words, making sure they are all terminated. */
+    lb->words = ckd_calloc(lb->n_words, sizeof(*lb->words));
+    for (i = 0; i < lb->n_words; ++i) {
+        uint8 const *nul = memchr(p, 0, words_size - (p - (lb->data + LATBIN_HEADER_SIZE)));
+        if (nul == NULL) {
+            E_ERROR("%s: Invalid binary lattice word table\n", file);
+            goto error_out;
+        }
+        lb->words[i] = (char const *)p;
+        p = nul + 1;
+    }
+    p = lb->data + LATBIN_HEADER_SIZE + words_size;
+    lb->index = p;
+    lb->blocks = p + lb->n_blocks * 8;
+    lb->blocks_end = lb->blocks + blocks_size;
+    for (i = 0; i < lb->n_blocks; ++i) {
+        if (get_u32(lb->index + i * 8) > blocks_size) {
+            E_ERROR("%s: Invalid binary lattice block index\n", file);
+            goto error_out;
+        }
+    }
+    ps_latbin_seek(lb, 0);
+    return lb;
+
+error_out:
+    ps_latbin_free(lb);
+    return NULL;
+}
+
+void
+ps_latbin_free(ps_latbin_t *lb)
+{
+    if (lb == NULL)
+        return;
+    if (lb->mf)
+        mmio_file_unmap(lb->mf);
+    ckd_free(lb->buf);
+    ckd_free(lb->words);
+    ckd_free(lb);
+}
+
+float64
+ps_latbin_logbase(ps_latbin_t *lb)
+{
+    return lb->logbase;
+}
+
+int32
+ps_latbin_n_frames(ps_latbin_t *lb)
+{
+    return lb->n_frames;
+}
+
+int32
+ps_latbin_n_nodes(ps_latbin_t *lb)
+{
+    return lb->n_nodes;
+}
+
+int32
+ps_latbin_n_links(ps_latbin_t *lb)
+{
+    return lb->n_links;
+}
+
+int32
+ps_latbin_start(ps_latbin_t *lb)
+{
+    return lb->start;
+}
+
+int32
+ps_latbin_end(ps_latbin_t *lb)
+{
+    return lb->end;
+}
+
+int32
+ps_latbin_next_link(ps_latbin_t *lb, int32 *out_ascr)
+{
+    int64 to, ascr;
+
+    if (lb->links_left <= 0)
+        return -1;
+    if (get_svarint(lb, &to) < 0 || get_svarint(lb, &ascr) < 0)
+        goto error_out;
+    to += lb->cur;
+    if (to < 0 || to >= lb->n_nodes)
+        goto error_out;
+    --lb->links_left;
+    if (out_ascr)
+        *out_ascr = (int32)(ascr << lb->shift);
+    return (int32)to;
+
+error_out:
+    E_ERROR("Corrupt link in binary lattice at node %d\n", lb->cur);
+    lb->links_left = 0;
+    lb->node = lb->n_nodes;
+    return -1;
+}
+
+int32
+ps_latbin_next_node(ps_latbin_t *lb, char const **out_word,
+                    int32 *out_sf, int32 *out_fef, int32 *out_lef)
+{
+    uint64 wid, n_exits;
+    int64 sf, fef, lef;
+
+    /* Skip any exits of the previous node which were not read. */
+    while (lb->links_left > 0)
+        if (ps_latbin_next_link(lb, NULL) < 0)
+            return -1;
+    if (lb->node >= lb->n_nodes)
+        return -1;
+    if (lb->node % lb->block_nodes == 0)
+        lb->prev_sf = 0;
+    if (get_varint(lb, &wid) < 0 || get_svarint(lb, &sf) < 0
+        || get_svarint(lb, &fef) < 0 || get_svarint(lb, &lef) < 0
+        || get_varint(lb, &n_exits) < 0
+        || wid >= (uint64)lb->n_words || n_exits > (uint64)lb->n_links) {
+        E_ERROR("Corrupt node %d in binary lattice\n", lb->node);
+        lb->node = lb->n_nodes;
+        return -1;
+    }
+    sf += lb->prev_sf;
+    fef += sf;
+    lef += fef;
+    lb->prev_sf = (int32)sf;
+    lb->cur = lb->node++;
+    lb->links_left = (int32)n_exits;
+
+    if (out_word) *out_word = lb->words[wid];
+    if (out_sf) *out_sf = (int32)sf;
+    if (out_fef) *out_fef = (int32)fef;
+    if (out_lef) *out_lef = (int32)lef;
+    return lb->cur;
+}
+
+int
+ps_latbin_seek(ps_latbin_t *lb, int32 node)
+{
+    int32 block;
+
+    if (node < 0 || node >= lb->n_nodes)
+        return -1;
+    block = node / lb->block_nodes;
+    lb->ptr = lb->blocks + get_u32(lb->index + block * 8);
+    lb->node = block * lb->block_nodes;
+    lb->links_left = 0;
+    while (lb->node < node)
+        if (ps_latbin_next_node(lb, NULL, NULL, NULL, NULL) < 0)
+            return -1;
+    return 0;
+}
+
+ps_lattice_t *
+ps_lattice_read_bin(ps_decoder_t *ps, char const *file)
+{
+    ps_latbin_t *lb;
+    ps_lattice_t *dag;
+    ps_latnode_t **darray, **pnodes;
+    float32 logratio;
+    int32 i;
+
+    E_INFO("Reading DAG file: %s\n", file);
+    if ((lb = ps_latbin_open(file)) == NULL)
+        return NULL;
+    dag = ps_lattice_init_read(ps);
+    logratio = ps_lattice_read_logratio(dag, lb->logbase);
+    dag->n_frames = lb->n_frames;
+    darray = ckd_calloc(lb->n_nodes, sizeof(*darray));
+
+    /* First the nodes, so that exits can refer to later ones. */
+    pnodes = &dag->nodes;
+    for (i = 0; i < lb->n_nodes; ++i) {
+        ps_latnode_t *node;
+        char const *word;
+        int32 w, sf, fef, lef;
+
+        if (ps_latbin_next_node(lb, &word, &sf, &fef, &lef) != i)
+            goto load_error;
+        if ((w = ps_lattice_read_word(dag, word)) < 0) {
+            E_ERROR("Unknown word %s in %s\n", word, file);
+            goto load_error;
+        }
+        node = *pnodes = listelem_malloc(dag->latnode_alloc);
+        memset(node, 0, sizeof(*node));
+        node->wid = w;
+        node->basewid = dict_basewid(dag->dict, w);
+        node->id = i;
+        node->sf = sf;
+        node->fef = fef;
+        node->lef = lef;
+        darray[i] = node;
+        pnodes = &node->next;
+    }
+    dag->start = darray[lb->start];
+    dag->end = darray[lb->end];
+
+    /* Then the links, in their original units. */
+    ps_latbin_seek(lb, 0);
+    for (i = 0; i < lb->n_nodes; ++i) {
+        int32 to, ascr;
+
+        if (ps_latbin_next_node(lb, NULL, NULL, NULL, NULL) != i)
+            goto load_error;
+        while ((to = ps_latbin_next_link(lb, &ascr)) >= 0) {
+            ascr >>= lb->shift;
+            if (logratio != 1.0f)
+                ascr = (int32)(ascr * logratio);
+            ps_lattice_link(dag, darray[i], darray[to],
+                            ascr, darray[to]->sf - 1);
+        }
+        if (lb->node == lb->n_nodes && i < lb->n_nodes - 1)
+            goto load_error;
+    }
+    ckd_free(darray);
+    ps_latbin_free(lb);
+
+    ps_lattice_finish_read(dag, ps);
+    return dag;
+
+load_error:
+    E_ERROR("Failed to load %s\n", file);
+    ckd_free(darray);
+    ps_latbin_free(lb);
+    ps_lattice_free(dag);
+    return NULL;
+}
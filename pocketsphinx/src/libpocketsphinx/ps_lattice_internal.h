@@ -81,6 +81,14 @@ struct ps_lattice_s {
     listelem_alloc_t *latlink_alloc;     /**< Link allocator for this DAG. */
     listelem_alloc_t *latlink_list_alloc; /**< List element allocator for this DAG. */
 
+    /* Once built, the lattice is packed into these arrays, see
+     * ps_lattice_delete_unreachable(). */
+    ps_latnode_t *node_pool;    /**< All nodes, in list order. */
+    ps_latlink_t *link_pool;    /**< All links, grouped by source node. */
+    latlink_list_t *list_pool;  /**< Exits of each node, then entries. */
+    int32 n_pool_nodes;         /**< Number of nodes in node_pool. */
+    int32 n_pool_links;         /**< Number of links in link_pool. */
+
     /* This will probably be replaced with a heap. */
     latlink_list_t *q_head; /**< Queue of links for traversal. */
     latlink_list_t *q_tail; /**< Queue of links for traversal. */
@@ -148,13 +156,16 @@ typedef struct dag_seg_s {
  * Partial path structure used in N-best (A*) search.
  *
  * Each partial path (latpath_t) is constructed by extending another
- * partial path--parent--by one node.
+ * partial path--parent--by one node.  Paths with a common prefix
+ * share it, and a path is freed once neither the frontier nor any of
+ * its extensions refer to it.
  */
 typedef struct ps_latpath_s {
     ps_latnode_t *node;            /**< Node ending this path. */
     struct ps_latpath_s *parent;   /**< Previous element in this path. */
-    struct ps_latpath_s *next;     /**< Pointer to next path in list of paths. */
+    uint64 hash;                   /**< Hash of the real words in this path. */
     int32 score;                  /**< Exact score from start node up to node->sf. */
+    int32 refcount;               /**< Frontier, extensions and top referring to this. */
 } ps_latpath_t;
 
 /**
@@ -173,14 +184,21 @@ typedef struct ps_astar_s {
     int32 n_hyp_tried;
     int32 n_hyp_insert;
     int32 n_hyp_reject;
-    int32 insert_depth;
-    int32 n_path;
+    int32 n_hyp_dup;
+
+    ps_latpath_t **heap;  /**< Frontier of partial paths, best first. */
+    int32 n_path;         /**< Number of paths in heap. */
+    int32 max_paths;      /**< Size of heap; worse paths are dropped. */
+    int32 worst;          /**< Index of worst path in heap, or -1 if unknown. */
+    int32 max_per_frame;  /**< Paths extended from each frame, or 0 for all. */
+    int32 *n_frame_paths; /**< Paths extended so far from each frame. */
+    uint64 *seen;         /**< Open hash of word sequences already expanded. */
+    int32 n_seen;
+    int32 seen_size;
 
-    ps_latpath_t *path_list;
-    ps_latpath_t *path_tail;
     ps_latpath_t *top;
 
-    glist_t hyps;	             /**< List of hypothesis strings. */
+    arena_t *hyps;	             /**< Hypothesis strings. */
     listelem_alloc_t *latpath_alloc; /**< Path allocator for N-best search. */
 } ps_astar_t;
 
@@ -206,9 +224,54 @@ void ps_lattice_penalize_fillers(ps_lattice_t *dag, int32 silpen, int32 fillpen)
 
 /**
  * Remove nodes marked as unreachable.
+ *
+ * The first time this is called on a lattice, the remaining nodes and
+ * links are also packed into contiguous arrays, in which the exits
+ * and entries of each node are stored consecutively.  Nodes and links
+ * which existed before this call are no longer valid after it.
  */
 void ps_lattice_delete_unreachable(ps_lattice_t *dag);
 
+/**
+ * Heap memory used by a word graph, not counting its dictionary.
+ */
+size_t ps_lattice_mem_size(ps_lattice_t *dag);
+
+/**
+ * Construct an empty word graph to be read from a file.
+ */
+ps_lattice_t *ps_lattice_init_read(ps_decoder_t *ps);
+
+/**
+ * Get the factor to scale scores in a lattice file with log base lb.
+ */
+float32 ps_lattice_read_logratio(ps_lattice_t *dag, float64 lb);
+
+/**
+ * Look up a word read from a lattice file.
+ *
+ * Without a decoder, unknown words are added to the dictionary.
+ *
+ * @return word ID, or <0 if not found.
+ */
+int32 ps_lattice_read_word(ps_lattice_t *dag, char const *wd);
+
+/**
+ * Finish reading a lattice, removing unreachable nodes and
+ * penalizing fillers.
+ */
+void ps_lattice_finish_read(ps_lattice_t *dag, ps_decoder_t *ps);
+
+/**
+ * Is this a binary lattice file?
+ */
+int ps_lattice_is_bin(char const *file);
+
+/**
+ * Read a binary lattice file.
+ */
+ps_lattice_t *ps_lattice_read_bin(ps_decoder_t *ps, char const *file);
+
 /**
  * Add an edge to the traversal queue.
  */
@@ -248,17 +311,25 @@ ps_seg_t *ps_lattice_seg_iter(ps_lattice_t *dag, ps_latlink_t *link,
  * @param ef Ending frame for N-best search, or -1 for last frame.
  * @param w1 First context word, or -1 for none.
  * @param w2 Second context word, or -1 for none.
+ * @param max_paths Maximum number of partial paths to keep.
+ * @param max_per_frame Maximum number of partial paths to extend
+ *                      from each frame, or 0 for no limit.
  * @return 0 for success, <0 on error.
  */
 ps_astar_t *ps_astar_start(ps_lattice_t *dag,
                            ngram_model_t *lmset,
                            float32 lwf,
                            int sf, int ef,
-                           int w1, int w2);
+                           int w1, int w2,
+                           int32 max_paths,
+                           int32 max_per_frame);
 
 /**
  * Find next best hypothesis of A* on a word graph.
  *
+ * Each word sequence is returned only once, for its best path.  The
+ * previous path returned is no longer valid after this is called.
+ *
  * @return a complete path, or NULL if no more hypotheses exist.
  */
 ps_latpath_t *ps_astar_next(ps_astar_t *nbest);
@@ -0,0 +1,485 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file ps_lattice_rescore.c
+ * @brief Best-path search of a lattice with another language model.
+ *
+ * Each node is given the language model states of the best paths
+ * reaching it, as many as the model distinguishes up to a limit, so
+ * that a model of any order is applied exactly rather than through
+ * the single best predecessor as in ps_lattice_bestpath().
+ *
+ * Nodes are visited by level, a node's level being one more than the
+ * highest of its predecessors, so that all the nodes of a level can be
+ * done at once.  Each node takes its states from its predecessors and
+ * then scores, once for each of its states, every word which follows
+ * it, so that the many exits to the same word at different times
+ * share the lookups.  A node writes only its own states and scores,
+ * and the levels are done in several threads if asked.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/sbthread.h>
+
+#include "pocketsphinx_internal.h"
+#include "ps_lattice_internal.h"
+#include "dict.h"
+#include "hmm.h"
+
+/* Levels with fewer nodes than this are not worth a thread each. */
+#define RESCORE_MIN_THREAD_NODES 8
+
+/**
+ * Language model state at the start of a node, and the best path
+ * which reaches it.
+ */
+typedef struct rescore_tok_s {
+    ngram_state_t state;  /**< State including the node's word. */
+    int32 score;          /**< Best path score up to the node. */
+    int32 prev;           /**< Token at link->from which it follows. */
+    ps_latlink_t *link;   /**< Link by which the path enters, or NULL. */
+} rescore_tok_t;
+
+/**
+ * Language model scores of a word following a node, for each of the
+ * node's tokens.
+ */
+typedef struct rescore_next_s {
+    int32 basewid;        /**< Dictionary base word ID. */
+    int32 *lscr;          /**< Weighted score from each token. */
+    ngram_state_t *state; /**< State following each token. */
+} rescore_next_t;
+
+typedef struct rescore_node_s {
+    rescore_tok_t *tok;
+    int32 n_tok;
+    rescore_next_t *next;
+    int32 n_next;
+    int32 lmwid;          /**< Model's ID for the node's word. */
+    int32 level;          /**< Level, see above. */
+    int32 last_level;     /**< Highest level of the following nodes. */
+} rescore_node_t;
+
+/**
+ * Candidate for a node's tokens, as sorted.
+ */
+typedef struct rescore_cand_s {
+    int32 score;
+    int32 idx;
+} rescore_cand_t;
+
+typedef struct rescore_s rescore_t;
+
+/**
+ * Thread doing nodes of a level.
+ */
+typedef struct rescore_worker_s {
+    rescore_t *rs;
+    sbthread_t *thr;        /**< Thread (NULL for the calling thread). */
+    rescore_tok_t *tok;     /**< Candidate tokens for a node. */
+    rescore_cand_t *cand;   /**< Candidates by score. */
+    int32 n_alloc;
+} rescore_worker_t;
+
+struct rescore_s {
+    ps_lattice_t *dag;
+    ngram_model_t *lm;
+    float32 lwf;
+    int32 max_states;
+    rescore_node_t *nodes;      /**< Indexed by node ID. */
+    ps_latnode_t **by_level;    /**< Nodes ordered by level. */
+    int32 *level_start;         /**< Start of each level in by_level. */
+    int32 n_levels;
+    rescore_worker_t *workers;
+    int32 n_workers;
+    sbmtx_t *mtx;               /**< Lock on next_node. */
+    int32 next_node;            /**< Next node of the level to be done. */
+    int32 end_node;             /**< End of the level in by_level. */
+};
+
+/* Fillers other than the end leave the language model state as it is. */
+static int
+rescore_is_filler(rescore_t *rs, ps_latnode_t *node)
+{
+    return node != rs->dag->end
+        && dict_filler_word(rs->dag->dict, node->basewid);
+}
+
+static int
+rescore_cmp_cand(void const *a, void const *b)
+{
+    rescore_cand_t const *ca = a, *cb = b;
+
+    if (ca->score != cb->score)
+        return ca->score BETTER_THAN cb->score ? -1 : 1;
+    /* Ties go to the first found, so that the result does not depend
+     * on the sort. */
+    return ca->idx - cb->idx;
+}
+
+/* Gather the best paths into a node from its predecessors' scores. */
+static void
+rescore_node_tokens(rescore_worker_t *w, ps_latnode_t *node)
+{
+    rescore_t *rs = w->rs;
+    rescore_node_t *rn = &rs->nodes[node->id];
+    latlink_list_t *x;
+    int32 n_cand, i, j;
+
+    if (node == rs->dag->start) {
+        int32 wid = rn->lmwid;
+
+        rn->tok = ckd_calloc(1, sizeof(*rn->tok));
+        ngram_state_init(rs->lm, &rn->tok[0].state, &wid, 1);
+        rn->tok[0].prev = -1;
+        rn->n_tok = 1;
+        return;
+    }
+
+    n_cand = 0;
+    for (x = node->entries; x; x = x->next) {
+        ps_latlink_t *link = x->link;
+        rescore_node_t *prev = &rs->nodes[link->from->id];
+        rescore_next_t *next;
+
+        for (i = 0; i < prev->n_next; ++i)
+            if (prev->next[i].basewid == node->basewid)
+                break;
+        if (i == prev->n_next)
+            continue;
+        next = &prev->next[i];
+        if (n_cand + prev->n_tok > w->n_alloc) {
+            w->n_alloc = (n_cand + prev->n_tok) * 2;
+            w->tok = ckd_realloc(w->tok, w->n_alloc * sizeof(*w->tok));
+            w->cand = ckd_realloc(w->cand, w->n_alloc * sizeof(*w->cand));
+        }
+        for (i = 0; i < prev->n_tok; ++i) {
+            rescore_tok_t *tok = &w->tok[n_cand];
+
+            tok->state = next->state[i];
+            tok->score = prev->tok[i].score + link->ascr + next->lscr[i];
+            tok->prev = i;
+            tok->link = link;
+            w->cand[n_cand].score = tok->score;
+            w->cand[n_cand].idx = n_cand;
+            ++n_cand;
+        }
+    }
+    if (n_cand == 0)
+        return;
+
+    /* Keep the best path for each state, and the best states. */
+    qsort(w->cand, n_cand, sizeof(*w->cand), rescore_cmp_cand);
+    rn->tok = ckd_calloc(n_cand < rs->max_states ? n_cand : rs->max_states,
+                         sizeof(*rn->tok));
+    for (i = 0; i < n_cand && rn->n_tok < rs->max_states; ++i) {
+        rescore_tok_t *tok = &w->tok[w->cand[i].idx];
+
+        for (j = 0; j < rn->n_tok; ++j)
+            if (ngram_state_equal(&rn->tok[j].state, &tok->state))
+                break;
+        if (j == rn->n_tok)
+            rn->tok[rn->n_tok++] = *tok;
+    }
+}
+
+/* Score the words following a node from each of its states. */
+static void
+rescore_node_next(rescore_worker_t *w, ps_latnode_t *node)
+{
+    rescore_t *rs = w->rs;
+    rescore_node_t *rn = &rs->nodes[node->id];
+    latlink_list_t *x;
+    int32 n_alloc, i;
+
+    n_alloc = 0;
+    for (x = node->exits; x; x = x->next)
+        ++n_alloc;
+    rn->next = ckd_calloc(n_alloc, sizeof(*rn->next));
+    for (x = node->exits; x; x = x->next) {
+        ps_latnode_t *to = x->link->to;
+        rescore_next_t *next;
+
+        for (i = 0; i < rn->n_next; ++i)
+            if (rn->next[i].basewid == to->basewid)
+                break;
+        if (i < rn->n_next)
+            continue;
+        next = &rn->next[rn->n_next++];
+        next->basewid = to->basewid;
+        next->lscr = ckd_calloc(rn->n_tok, sizeof(*next->lscr));
+        next->state = ckd_calloc(rn->n_tok, sizeof(*next->state));
+        for (i = 0; i < rn->n_tok; ++i) {
+            int32 n_used;
+
+            if (rescore_is_filler(rs, to)) {
+                next->state[i] = rn->tok[i].state;
+                continue;
+            }
+            next->lscr[i] = (ngram_state_score(rs->lm, &rn->tok[i].state,
+                                               rs->nodes[to->id].lmwid,
+                                               &next->state[i], &n_used)
+                             >> SENSCR_SHIFT) * rs->lwf;
+        }
+    }
+}
+
+static void
+rescore_node_free_next(rescore_node_t *rn)
+{
+    int32 i;
+
+    for (i = 0; i < rn->n_next; ++i) {
+        ckd_free(rn->next[i].lscr);
+        ckd_free(rn->next[i].state);
+    }
+    ckd_free(rn->next);
+    rn->next = NULL;
+    rn->n_next = 0;
+}
+
+/* Take nodes of the current level until there are none left. */
+static void
+rescore_work(rescore_worker_t *w)
+{
+    rescore_t *rs = w->rs;
+
+    for (;;) {
+        ps_latnode_t *node = NULL;
+
+        sbmtx_lock(rs->mtx);
+        if (rs->next_node < rs->end_node)
+            node = rs->by_level[rs->next_node++];
+        sbmtx_unlock(rs->mtx);
+        if (node == NULL)
+            break;
+        rescore_node_tokens(w, node);
+        if (rs->nodes[node->id].n_tok > 0 && node != rs->dag->end)
+            rescore_node_next(w, node);
+    }
+}
+
+static int
+rescore_worker_main(sbthread_t *th)
+{
+    rescore_work(sbthread_arg(th));
+    return 0;
+}
+
+/* Do a level, the calling thread being the first worker. */
+static void
+rescore_run_level(rescore_t *rs, int32 level)
+{
+    int32 i, n_workers;
+
+    rs->next_node = rs->level_start[level];
+    rs->end_node = rs->level_start[level + 1];
+    n_workers = (rs->end_node - rs->next_node) / RESCORE_MIN_THREAD_NODES;
+    if (n_workers > rs->n_workers)
+        n_workers = rs->n_workers;
+    for (i = 1; i < n_workers; ++i) {
+        rescore_worker_t *w = &rs->workers[i];
+
+        if ((w->thr = sbthread_start(NULL, rescore_worker_main, w)) == NULL)
+            E_WARN("Failed to start thread %d, its work will be done by others\n", i);
+    }
+    rescore_work(&rs->workers[0]);
+    for (i = 1; i < n_workers; ++i) {
+        rescore_worker_t *w = &rs->workers[i];
+
+        if (w->thr) {
+            sbthread_free(w->thr);
+            w->thr = NULL;
+        }
+    }
+}
+
+/* Number the nodes and put them in order of level. */
+static int
+rescore_set_levels(rescore_t *rs)
+{
+    ps_lattice_t *dag = rs->dag;
+    ps_latnode_t *node, **queue;
+    latlink_list_t *x;
+    int32 *n_entries, *count;
+    int32 n_nodes, head, tail, i;
+
+    n_nodes = 0;
+    for (node = dag->nodes; node; node = node->next)
+        node->id = n_nodes++;
+    rs->nodes = ckd_calloc(n_nodes, sizeof(*rs->nodes));
+    n_entries = ckd_calloc(n_nodes, sizeof(*n_entries));
+    queue = ckd_calloc(n_nodes, sizeof(*queue));
+    tail = 0;
+    for (node = dag->nodes; node; node = node->next) {
+        for (x = node->entries; x; x = x->next)
+            ++n_entries[node->id];
+        if (n_entries[node->id] == 0)
+            queue[tail++] = node;
+    }
+    rs->n_levels = 0;
+    for (head = 0; head < tail; ++head) {
+        rescore_node_t *rn = &rs->nodes[queue[head]->id];
+
+        if (rn->level >= rs->n_levels)
+            rs->n_levels = rn->level + 1;
+        for (x = queue[head]->exits; x; x = x->next) {
+            ps_latnode_t *to = x->link->to;
+
+            if (rs->nodes[to->id].level <= rn->level)
+                rs->nodes[to->id].level = rn->level + 1;
+            if (--n_entries[to->id] == 0)
+                queue[tail++] = to;
+        }
+    }
+    ckd_free(n_entries);
+    if (tail < n_nodes) {
+        E_ERROR("Lattice has a cycle\n");
+        ckd_free(queue);
+        return -1;
+    }
+
+    /* Sort them stably by level. */
+    count = ckd_calloc(rs->n_levels + 1, sizeof(*count));
+    for (i = 0; i < n_nodes; ++i)
+        ++count[rs->nodes[i].level + 1];
+    for (i = 0; i < rs->n_levels; ++i)
+        count[i + 1] += count[i];
+    rs->level_start = ckd_calloc(rs->n_levels + 1, sizeof(*rs->level_start));
+    memcpy(rs->level_start, count, (rs->n_levels + 1) * sizeof(*count));
+    rs->by_level = ckd_calloc(n_nodes, sizeof(*rs->by_level));
+    for (node = dag->nodes; node; node = node->next)
+        rs->by_level[count[rs->nodes[node->id].level]++] = node;
+    ckd_free(count);
+    ckd_free(queue);
+
+    /* Find when each node's scores are no longer needed. */
+    for (node = dag->nodes; node; node = node->next) {
+        rescore_node_t *rn = &rs->nodes[node->id];
+
+        rn->last_level = rn->level;
+        for (x = node->exits; x; x = x->next)
+            if (rs->nodes[x->link->to->id].level > rn->last_level)
+                rn->last_level = rs->nodes[x->link->to->id].level;
+    }
+    return 0;
+}
+
+ps_latlink_t *
+ps_lattice_rescore(ps_lattice_t *dag, ngram_model_t *lm,
+                   float32 lwf, int32 max_states, int nthreads)
+{
+    rescore_t rs;
+    rescore_node_t *rn;
+    ps_latnode_t *node;
+    ps_latlink_t *bestend, *link;
+    int32 level, n_nodes, i, best;
+
+    if (max_states < 1)
+        max_states = 1;
+    if (nthreads < 1)
+        nthreads = 1;
+    memset(&rs, 0, sizeof(rs));
+    rs.dag = dag;
+    rs.lm = lm;
+    rs.lwf = lwf;
+    rs.max_states = max_states;
+    if (rescore_set_levels(&rs) < 0) {
+        ckd_free(rs.nodes);
+        return NULL;
+    }
+    n_nodes = rs.level_start[rs.n_levels];
+    E_INFO("Rescoring %d nodes in %d levels\n", n_nodes, rs.n_levels);
+    for (node = dag->nodes; node; node = node->next)
+        rs.nodes[node->id].lmwid =
+            ngram_wid(lm, dict_wordstr(dag->dict, node->basewid));
+    rs.mtx = sbmtx_init();
+    rs.n_workers = nthreads;
+    rs.workers = ckd_calloc(nthreads, sizeof(*rs.workers));
+    for (i = 0; i < nthreads; ++i)
+        rs.workers[i].rs = &rs;
+
+    /* Scores after a node go once all the nodes following it are
+     * done, by_level being in order of level. */
+    for (level = 0; level < rs.n_levels; ++level) {
+        rescore_run_level(&rs, level);
+        for (i = 0; i < n_nodes; ++i) {
+            rn = &rs.nodes[i];
+            if (rn->next && rn->last_level <= level)
+                rescore_node_free_next(rn);
+        }
+    }
+
+    /* Leave the best path in the links. */
+    bestend = NULL;
+    rn = &rs.nodes[dag->end->id];
+    best = 0;
+    for (i = 1; i < rn->n_tok; ++i)
+        if (rn->tok[i].score BETTER_THAN rn->tok[best].score)
+            best = i;
+    if (rn->n_tok > 0) {
+        rescore_tok_t *tok = &rn->tok[best];
+
+        bestend = tok->link;
+        E_INFO("Rescored bestpath score: %d\n", tok->score);
+        for (link = bestend; link; link = link->best_prev) {
+            rescore_tok_t *prev = &rs.nodes[link->from->id].tok[tok->prev];
+
+            link->path_scr = tok->score;
+            link->best_prev = prev->link;
+            tok = prev;
+        }
+    }
+    else
+        E_ERROR("End node is not reachable from the start node\n");
+
+    for (i = 0; i < n_nodes; ++i) {
+        rescore_node_free_next(&rs.nodes[i]);
+        ckd_free(rs.nodes[i].tok);
+    }
+    for (i = 0; i < nthreads; ++i) {
+        ckd_free(rs.workers[i].tok);
+        ckd_free(rs.workers[i].cand);
+    }
+    ckd_free(rs.workers);
+    sbmtx_free(rs.mtx);
+    ckd_free(rs.by_level);
+    ckd_free(rs.level_start);
+    ckd_free(rs.nodes);
+    return bestend;
+}
@@ -0,0 +1,652 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_longalign.c Aligning long recordings to their transcripts.
+ *
+ * This works in two passes, each of which is a list of tasks taken in
+ * turn by the threads.  The first recognizes fixed-length chunks of
+ * the audio.  The recognized words are then matched to the transcript
+ * by looking for runs of them found exactly once in it, and the
+ * longest chain of such runs which goes forward in both the audio and
+ * the transcript is kept as anchors.  The second pass force-aligns
+ * each stretch of the transcript between anchors to the audio between
+ * them, which is short enough for state_align_search.
+ */
+
+/* System headers. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* SphinxBase headers. */
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/hash_table.h>
+#include <sphinxbase/sbthread.h>
+#include <sphinxbase/strfuncs.h>
+
+/* Local headers. */
+#include "pocketsphinx_internal.h"
+#include "ps_alignment.h"
+#include "state_align_search.h"
+
+/** Number of consecutive recognized words which make an anchor. */
+#define LONGALIGN_ANCHOR_LEN 3
+/** Longest stretch of audio, in frames, which can be force-aligned. */
+#define LONGALIGN_MAX_GAP 32000
+
+/**
+ * Word of the transcript.
+ */
+typedef struct longalign_word_s {
+    int32 wid;            /**< Dictionary ID of the word. */
+    int32 sf, ef;         /**< First and last frame, or -1 if not aligned. */
+    int anchor;           /**< Whether the time came from recognition. */
+} longalign_word_t;
+
+/**
+ * Word recognized in a chunk.
+ */
+typedef struct longalign_hyp_s {
+    int32 wid;            /**< Dictionary ID of its base word. */
+    int32 sf, ef;         /**< First and last frame in the recording. */
+} longalign_hyp_t;
+
+/**
+ * Chunk of audio to recognize, or stretch of transcript to align.
+ */
+typedef struct longalign_task_s {
+    int32 sf, ef;         /**< Frames covered (ef is not included). */
+    int32 first, last;    /**< Words to align (last is not included),
+                             or -1 to recognize. */
+    longalign_hyp_t *hyp; /**< Words recognized. */
+    int32 n_hyp;
+} longalign_task_t;
+
+/**
+ * Thread with its own decoder.
+ */
+typedef struct longalign_worker_s {
+    ps_longalign_t *la;
+    ps_decoder_t *ps;
+    sbthread_t *thr;      /**< Thread (NULL for the calling thread). */
+} longalign_worker_t;
+
+struct ps_longalign_s {
+    longalign_worker_t *workers;
+    int32 n_workers;
+    sbmtx_t *mtx;         /**< Lock on next_task. */
+    longalign_task_t *tasks;
+    int32 n_tasks;
+    int32 next_task;
+
+    longalign_word_t *words;
+    int32 n_words;
+    double chunk_size;    /**< Seconds of audio in each chunk. */
+    mfcc_t *cmn_mean;     /**< Live CMN state to start each task with. */
+    mfcc_t *cmn_var;
+    mfcc_t *cmn_sum;
+    mfcc_t *cmn_sumsq;
+    int32 cmn_nframe;
+
+    int16 const *data;    /**< Audio being aligned. */
+    size_t n_samples;
+    int frame_shift;      /**< Samples per frame. */
+    int frame_size;       /**< Samples in each frame's window. */
+};
+
+ps_longalign_t *
+ps_longalign_init(ps_decoder_t *ps, int nthreads)
+{
+    ps_longalign_t *la;
+    cmn_t *cmn;
+    int32 i;
+
+    if (ps == NULL) {
+        E_ERROR("No decoder to align with\n");
+        return NULL;
+    }
+    if (nthreads < 1)
+        nthreads = 1;
+
+    la = ckd_calloc(1, sizeof(*la));
+    la->chunk_size = 30.0;
+    la->mtx = sbmtx_init();
+    la->workers = ckd_calloc(nthreads, sizeof(*la->workers));
+    for (i = 0; i < nthreads; ++i) {
+        longalign_worker_t *w = &la->workers[i];
+        acmod_t *acmod;
+
+        w->la = la;
+        if ((w->ps = ps_clone(ps)) == NULL) {
+            ps_longalign_free(la);
+            return NULL;
+        }
+        ++la->n_workers;
+        /* Frames have to map to time, so none may be dropped as
+         * silence. */
+        acmod = w->ps->acmod;
+        cmd_ln_set_boolean_r(w->ps->config, "-remove_silence", FALSE);
+        fe_free(acmod->fe);
+        if ((acmod->fe = fe_init_auto_r(w->ps->config)) == NULL) {
+            ps_longalign_free(la);
+            return NULL;
+        }
+    }
+    fe_get_input_size(ps->acmod->fe, &la->frame_shift, &la->frame_size);
+    if ((cmn = ps_get_feat(la->workers[0].ps)->cmn_struct) != NULL) {
+        la->cmn_mean = ckd_calloc(cmn->veclen, sizeof(*la->cmn_mean));
+        la->cmn_var = ckd_calloc(cmn->veclen, sizeof(*la->cmn_var));
+        la->cmn_sum = ckd_calloc(cmn->veclen, sizeof(*la->cmn_sum));
+        la->cmn_sumsq = ckd_calloc(cmn->veclen, sizeof(*la->cmn_sumsq));
+        memcpy(la->cmn_mean, cmn->cmn_mean, cmn->veclen * sizeof(*la->cmn_mean));
+        memcpy(la->cmn_var, cmn->cmn_var, cmn->veclen * sizeof(*la->cmn_var));
+        memcpy(la->cmn_sum, cmn->sum, cmn->veclen * sizeof(*la->cmn_sum));
+        memcpy(la->cmn_sumsq, cmn->sumsq, cmn->veclen * sizeof(*la->cmn_sumsq));
+        la->cmn_nframe = cmn->nframe;
+    }
+    return la;
+}
+
+static void
+longalign_reset(ps_longalign_t *la)
+{
+    int32 i;
+
+    for (i = 0; i < la->n_tasks; ++i)
+        ckd_free(la->tasks[i].hyp);
+    ckd_free(la->tasks);
+    la->tasks = NULL;
+    la->n_tasks = la->next_task = 0;
+}
+
+void
+ps_longalign_free(ps_longalign_t *la)
+{
+    int32 i;
+
+    if (la == NULL)
+        return;
+    for (i = 0; i < la->n_workers; ++i)
+        ps_free(la->workers[i].ps);
+    ckd_free(la->workers);
+    longalign_reset(la);
+    ckd_free(la->words);
+    ckd_free(la->cmn_mean);
+    ckd_free(la->cmn_var);
+    ckd_free(la->cmn_sum);
+    ckd_free(la->cmn_sumsq);
+    sbmtx_free(la->mtx);
+    ckd_free(la);
+}
+
+void
+ps_longalign_set_chunk_size(ps_longalign_t *la, double seconds)
+{
+    la->chunk_size = seconds;
+}
+
+static longalign_task_t *
+longalign_add_task(ps_longalign_t *la, int32 sf, int32 ef,
+                   int32 first, int32 last)
+{
+    longalign_task_t *task;
+
+    la->tasks = ckd_realloc(la->tasks, (la->n_tasks + 1) * sizeof(*la->tasks));
+    task = &la->tasks[la->n_tasks++];
+    memset(task, 0, sizeof(*task));
+    task->sf = sf;
+    task->ef = ef;
+    task->first = first;
+    task->last = last;
+    return task;
+}
+
+/* Find the audio for some frames. */
+static int16 const *
+longalign_samples(ps_longalign_t *la, int32 sf, int32 ef, size_t *out_n_samples)
+{
+    size_t start, end;
+
+    start = (size_t)sf * la->frame_shift;
+    end = (size_t)ef * la->frame_shift + la->frame_size - la->frame_shift;
+    if (start > la->n_samples)
+        start = la->n_samples;
+    if (end > la->n_samples)
+        end = la->n_samples;
+    *out_n_samples = end - start;
+    return la->data + start;
+}
+
+static void
+longalign_recognize(longalign_worker_t *w, longalign_task_t *task)
+{
+    ps_decoder_t *ps = w->ps;
+    int16 const *data;
+    size_t n_samples;
+    ps_seg_t *seg;
+    int32 n_alloc;
+
+    data = longalign_samples(w->la, task->sf, task->ef, &n_samples);
+    if (ps_start_utt(ps) < 0)
+        return;
+    ps_process_raw(ps, data, n_samples, FALSE, TRUE);
+    ps_end_utt(ps);
+
+    n_alloc = 0;
+    for (seg = ps_seg_iter(ps); seg; seg = ps_seg_next(seg)) {
+        int32 wid = dict_wordid(ps->dict, ps_seg_word(seg));
+        int sf, ef;
+
+        if (wid == BAD_S3WID || dict_filler_word(ps->dict, wid))
+            continue;
+        if (task->n_hyp == n_alloc) {
+            n_alloc = n_alloc ? n_alloc * 2 : 16;
+            task->hyp = ckd_realloc(task->hyp, n_alloc * sizeof(*task->hyp));
+        }
+        ps_seg_frames(seg, &sf, &ef);
+        task->hyp[task->n_hyp].wid = dict_basewid(ps->dict, wid);
+        task->hyp[task->n_hyp].sf = task->sf + sf;
+        task->hyp[task->n_hyp].ef = task->sf + ef;
+        ++task->n_hyp;
+    }
+}
+
+/* Force-align some words to some audio, optionally with silence
+ * around them. */
+static int
+longalign_force(longalign_worker_t *w, longalign_task_t *task, int sil)
+{
+    ps_longalign_t *la = w->la;
+    ps_decoder_t *ps = w->ps;
+    acmod_t *acmod = ps->acmod;
+    ps_alignment_t *al;
+    ps_alignment_iter_t *itor;
+    ps_search_t *search;
+    int16 const *data;
+    size_t n_samples;
+    int32 i;
+    int rv;
+
+    al = ps_alignment_init(ps->d2p);
+    if (sil)
+        ps_alignment_add_word(al, dict_startwid(ps->dict), 0);
+    for (i = task->first; i < task->last; ++i)
+        ps_alignment_add_word(al, la->words[i].wid, 0);
+    if (sil)
+        ps_alignment_add_word(al, dict_finishwid(ps->dict), 0);
+    ps_alignment_populate(al);
+    if (ps_alignment_n_states(al) > task->ef - task->sf) {
+        ps_alignment_free(al);
+        return -1;
+    }
+    search = state_align_search_init("longalign", ps->config, acmod, al);
+    if (search == NULL) {
+        ps_alignment_free(al);
+        return -1;
+    }
+
+    data = longalign_samples(la, task->sf, task->ef, &n_samples);
+    acmod_start_utt(acmod);
+    ps_search_start(search);
+    acmod_process_raw(acmod, &data, &n_samples, TRUE);
+    acmod_end_utt(acmod);
+    while (acmod->n_feat_frame > 0) {
+        ps_search_step(search, acmod->output_frame);
+        acmod_advance(acmod);
+    }
+    if ((rv = ps_search_finish(search)) == 0) {
+        itor = ps_alignment_words(al);
+        if (sil)
+            itor = ps_alignment_iter_next(itor);
+        for (i = task->first; i < task->last; ++i) {
+            ps_alignment_entry_t *ent = ps_alignment_iter_get(itor);
+
+            la->words[i].sf = task->sf + ent->start;
+            la->words[i].ef = task->sf + ent->start + ent->duration - 1;
+            itor = ps_alignment_iter_next(itor);
+        }
+        ps_alignment_iter_free(itor);
+    }
+    ps_search_free(search);
+    ps_alignment_free(al);
+    return rv;
+}
+
+static void
+longalign_align(longalign_worker_t *w, longalign_task_t *task)
+{
+    if (task->ef - task->sf > LONGALIGN_MAX_GAP) {
+        E_WARN("Not aligning words %d to %d, as there are no anchors "
+               "in %d frames\n", task->first, task->last - 1,
+               task->ef - task->sf);
+        return;
+    }
+    /* Leave out the silence if it does not fit. */
+    if (longalign_force(w, task, TRUE) < 0
+        && longalign_force(w, task, FALSE) < 0)
+        E_WARN("Failed to align words %d to %d to frames %d to %d\n",
+               task->first, task->last - 1, task->sf, task->ef - 1);
+}
+
+/* Take tasks until there are none left. */
+static void
+longalign_work(longalign_worker_t *w)
+{
+    ps_longalign_t *la = w->la;
+
+    for (;;) {
+        longalign_task_t *task = NULL;
+        cmn_t *cmn;
+
+        sbmtx_lock(la->mtx);
+        if (la->next_task < la->n_tasks)
+            task = &la->tasks[la->next_task++];
+        sbmtx_unlock(la->mtx);
+        if (task == NULL)
+            break;
+
+        /* Start from scratch, so that results do not depend on
+         * which thread did what before. */
+        if ((cmn = ps_get_feat(w->ps)->cmn_struct) != NULL) {
+            memcpy(cmn->cmn_mean, la->cmn_mean,
+                   cmn->veclen * sizeof(*la->cmn_mean));
+            memcpy(cmn->cmn_var, la->cmn_var,
+                   cmn->veclen * sizeof(*la->cmn_var));
+            memcpy(cmn->sum, la->cmn_sum, cmn->veclen * sizeof(*la->cmn_sum));
+            memcpy(cmn->sumsq, la->cmn_sumsq,
+                   cmn->veclen * sizeof(*la->cmn_sumsq));
+            cmn->nframe = la->cmn_nframe;
+        }
+        ps_start_stream(w->ps);
+        if (task->first < 0)
+            longalign_recognize(w, task);
+        else
+            longalign_align(w, task);
+    }
+}
+
+static int
+longalign_worker_main(sbthread_t *th)
+{
+    longalign_work(sbthread_arg(th));
+    return 0;
+}
+
+/* Run all the tasks, the calling thread being the first worker. */
+static void
+longalign_run_tasks(ps_longalign_t *la)
+{
+    int32 i;
+
+    la->next_task = 0;
+    for (i = 1; i < la->n_workers && i < la->n_tasks; ++i) {
+        longalign_worker_t *w = &la->workers[i];
+
+        if ((w->thr = sbthread_start(NULL, longalign_worker_main, w)) == NULL)
+            E_WARN("Failed to start thread %d, its work will be done by others\n", i);
+    }
+    longalign_work(&la->workers[0]);
+    for (i = 1; i < la->n_workers; ++i) {
+        longalign_worker_t *w = &la->workers[i];
+
+        if (w->thr) {
+            sbthread_free(w->thr);
+            w->thr = NULL;
+        }
+    }
+}
+
+/* Split a transcript into words from the dictionary. */
+static int
+longalign_set_text(ps_longalign_t *la, dict_t *dict, char const *text)
+{
+    char *tmp, **wptr;
+    int32 i, n;
+
+    tmp = ckd_salloc(text);
+    n = str2words(tmp, NULL, 0);
+    wptr = ckd_calloc(n, sizeof(*wptr));
+    str2words(tmp, wptr, n);
+    ckd_free(la->words);
+    la->words = ckd_calloc(n, sizeof(*la->words));
+    la->n_words = n;
+    for (i = 0; i < n; ++i) {
+        la->words[i].wid = dict_wordid(dict, wptr[i]);
+        la->words[i].sf = la->words[i].ef = -1;
+        if (la->words[i].wid == BAD_S3WID) {
+            E_ERROR("Word %s is not in the dictionary\n", wptr[i]);
+            la->n_words = 0;
+            break;
+        }
+    }
+    ckd_free(wptr);
+    ckd_free(tmp);
+    return la->n_words == n ? 0 : -1;
+}
+
+/**
+ * Run of recognized words which matches the transcript.
+ */
+typedef struct longalign_match_s {
+    int32 hyp;            /**< Index of the first recognized word. */
+    int32 pos;            /**< Index of the first word of the transcript. */
+} longalign_match_t;
+
+/* Give times to the words of the transcript which can be matched
+ * with certainty to those recognized. */
+static int32
+longalign_anchor(ps_longalign_t *la, dict_t *dict,
+                 longalign_hyp_t *hyp, int32 n_hyp)
+{
+    hash_table_t *ngrams;
+    longalign_match_t *match;
+    int32 *text, *hwid, *tail, *prev;
+    int32 i, j, k, n_match, n_chain, last_pos, last_hyp, n_anchor;
+
+    if (la->n_words < LONGALIGN_ANCHOR_LEN || n_hyp < LONGALIGN_ANCHOR_LEN)
+        return 0;
+
+    /* Index the runs of words which occur only once in the text. */
+    text = ckd_calloc(la->n_words, sizeof(*text));
+    for (i = 0; i < la->n_words; ++i)
+        text[i] = dict_basewid(dict, la->words[i].wid);
+    ngrams = hash_table_new(la->n_words, HASH_CASE_YES);
+    for (i = 0; i + LONGALIGN_ANCHOR_LEN <= la->n_words; ++i) {
+        void *val;
+        if (hash_table_lookup_bkey(ngrams, (char const *)(text + i),
+                                   LONGALIGN_ANCHOR_LEN * sizeof(*text),
+                                   &val) == 0)
+            hash_table_replace_bkey(ngrams, (char const *)(text + i),
+                                    LONGALIGN_ANCHOR_LEN * sizeof(*text),
+                                    (void *)-1L);
+        else
+            hash_table_enter_bkey(ngrams, (char const *)(text + i),
+                                  LONGALIGN_ANCHOR_LEN * sizeof(*text),
+                                  (void *)(long)i);
+    }
+
+    /* Find them among the recognized words. */
+    hwid = ckd_calloc(n_hyp, sizeof(*hwid));
+    for (j = 0; j < n_hyp; ++j)
+        hwid[j] = hyp[j].wid;
+    match = ckd_calloc(n_hyp, sizeof(*match));
+    n_match = 0;
+    for (j = 0; j + LONGALIGN_ANCHOR_LEN <= n_hyp; ++j) {
+        void *val;
+        if (hash_table_lookup_bkey(ngrams, (char const *)(hwid + j),
+                                   LONGALIGN_ANCHOR_LEN * sizeof(*hwid),
+                                   &val) == 0 && (long)val >= 0) {
+            match[n_match].hyp = j;
+            match[n_match].pos = (int32)(long)val;
+            ++n_match;
+        }
+    }
+
+    /* Keep the longest chain of them in order in the transcript (they
+     * are already in order in the audio). */
+    tail = ckd_calloc(n_match + 1, sizeof(*tail));
+    prev = ckd_calloc(n_match + 1, sizeof(*prev));
+    n_chain = 0;
+    for (k = 0; k < n_match; ++k) {
+        int32 lo = 0, hi = n_chain;
+        /* Find the longest chain it can follow. */
+        while (lo < hi) {
+            int32 mid = (lo + hi) / 2;
+            if (match[tail[mid]].pos < match[k].pos)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        prev[k] = lo > 0 ? tail[lo - 1] : -1;
+        tail[lo] = k;
+        if (lo == n_chain)
+            ++n_chain;
+    }
+    /* Reverse it into tail. */
+    for (i = n_chain - 1, k = n_chain ? tail[n_chain - 1] : -1;
+         i >= 0; --i, k = prev[k])
+        tail[i] = k;
+
+    /* Overlapping runs may disagree, so only ever move forward. */
+    last_pos = last_hyp = -1;
+    n_anchor = 0;
+    for (i = 0; i < n_chain; ++i) {
+        longalign_match_t *m = &match[tail[i]];
+        for (k = 0; k < LONGALIGN_ANCHOR_LEN; ++k) {
+            longalign_word_t *word = &la->words[m->pos + k];
+
+            if (m->pos + k <= last_pos || m->hyp + k <= last_hyp)
+                continue;
+            word->sf = hyp[m->hyp + k].sf;
+            word->ef = hyp[m->hyp + k].ef;
+            word->anchor = TRUE;
+            last_pos = m->pos + k;
+            last_hyp = m->hyp + k;
+            ++n_anchor;
+        }
+    }
+
+    hash_table_free(ngrams);
+    ckd_free(text);
+    ckd_free(hwid);
+    ckd_free(match);
+    ckd_free(tail);
+    ckd_free(prev);
+    return n_anchor;
+}
+
+int
+ps_longalign_run(ps_longalign_t *la, char const *text,
+                 int16 const *data, size_t n_samples)
+{
+    ps_decoder_t *ps = la->workers[0].ps;
+    longalign_hyp_t *hyp;
+    int32 i, n_frames, chunk_frames, n_hyp, n_anchor, n_aligned, sf;
+
+    if (longalign_set_text(la, ps->dict, text) < 0)
+        return -1;
+    la->data = data;
+    la->n_samples = n_samples;
+    n_frames = 0;
+    if (n_samples >= (size_t)la->frame_size)
+        n_frames = (n_samples - la->frame_size) / la->frame_shift + 1;
+
+    /* Recognize the chunks. */
+    chunk_frames = (int32)(la->chunk_size * cmd_ln_int32_r(ps->config, "-frate"));
+    if (chunk_frames < 1)
+        chunk_frames = 1;
+    longalign_reset(la);
+    for (sf = 0; sf < n_frames; sf += chunk_frames)
+        longalign_add_task(la, sf, sf + chunk_frames < n_frames
+                           ? sf + chunk_frames : n_frames, -1, -1);
+    longalign_run_tasks(la);
+
+    /* Anchor the transcript to what was recognized. */
+    for (n_hyp = i = 0; i < la->n_tasks; ++i)
+        n_hyp += la->tasks[i].n_hyp;
+    hyp = ckd_calloc(n_hyp ? n_hyp : 1, sizeof(*hyp));
+    for (n_hyp = i = 0; i < la->n_tasks; ++i) {
+        memcpy(hyp + n_hyp, la->tasks[i].hyp,
+               la->tasks[i].n_hyp * sizeof(*hyp));
+        n_hyp += la->tasks[i].n_hyp;
+    }
+    n_anchor = longalign_anchor(la, ps->dict, hyp, n_hyp);
+    ckd_free(hyp);
+    E_INFO("Anchored %d of %d words to %d recognized in %d chunks\n",
+           n_anchor, la->n_words, n_hyp, la->n_tasks);
+
+    /* Align what is left between the anchors. */
+    longalign_reset(la);
+    for (sf = 0, i = 0; i <= la->n_words; ++i) {
+        int32 first = i, ef;
+
+        while (i < la->n_words && !la->words[i].anchor)
+            ++i;
+        ef = (i < la->n_words) ? la->words[i].sf : n_frames;
+        if (i > first && ef > sf)
+            longalign_add_task(la, sf, ef, first, i);
+        if (i < la->n_words)
+            sf = la->words[i].ef + 1;
+    }
+    longalign_run_tasks(la);
+
+    for (n_aligned = i = 0; i < la->n_words; ++i)
+        if (la->words[i].sf >= 0)
+            ++n_aligned;
+    E_INFO("Aligned %d of %d words\n", n_aligned, la->n_words);
+    return n_aligned;
+}
+
+int
+ps_longalign_n_words(ps_longalign_t *la)
+{
+    return la->n_words;
+}
+
+char const *
+ps_longalign_word(ps_longalign_t *la, int idx,
+                  int *out_sf, int *out_ef, int *out_anchor)
+{
+    longalign_word_t *word;
+
+    if (idx < 0 || idx >= la->n_words)
+        return NULL;
+    word = &la->words[idx];
+    *out_sf = word->sf;
+    *out_ef = word->ef;
+    if (out_anchor)
+        *out_anchor = word->anchor;
+    return dict_wordstr(la->workers[0].ps->dict, word->wid);
+}
@@ -36,11 +36,13 @@
  */
 
 /**
- * @file ps_mllr.c Model-space linear transforms for speaker adaptation
+ * @file ps_mllr.c Linear transforms for speaker adaptation
  */
 
 /* System headers. */
 #include <stdio.h>
+#include <math.h>
+#include <string.h>
 
 /* SphinxBase headers. */
 #include <sphinxbase/ckd_alloc.h>
@@ -167,3 +169,126 @@ ps_mllr_free(ps_mllr_t *mllr)
 
     return 0;
 }
+
+ps_fmllr_t *
+ps_fmllr_init_feat(feat_t *fcb)
+{
+    ps_fmllr_t *fmllr;
+    int i;
+
+    fmllr = ckd_calloc(1, sizeof(*fmllr));
+    fmllr->refcnt = 1;
+    fmllr->n_feat = feat_dimension1(fcb);
+    fmllr->veclen = ckd_calloc(fmllr->n_feat, sizeof(*fmllr->veclen));
+    fmllr->a = ckd_calloc(fmllr->n_feat, sizeof(*fmllr->a));
+    fmllr->b = ckd_calloc(fmllr->n_feat, sizeof(*fmllr->b));
+    fmllr->stats = ckd_calloc(fmllr->n_feat, sizeof(*fmllr->stats));
+    for (i = 0; i < fmllr->n_feat; ++i) {
+        fmllr->veclen[i] = feat_dimension2(fcb, i);
+        fmllr->a[i] = ckd_calloc(fmllr->veclen[i], sizeof(**fmllr->a));
+        fmllr->b[i] = ckd_calloc(fmllr->veclen[i], sizeof(**fmllr->b));
+        fmllr->stats[i] = (float64 **)ckd_calloc_2d(fmllr->veclen[i],
+                                                    PS_FMLLR_N_STATS,
+                                                    sizeof(***fmllr->stats));
+    }
+    ps_fmllr_reset(fmllr);
+
+    return fmllr;
+}
+
+ps_fmllr_t *
+ps_fmllr_retain(ps_fmllr_t *fmllr)
+{
+    ++fmllr->refcnt;
+    return fmllr;
+}
+
+int
+ps_fmllr_free(ps_fmllr_t *fmllr)
+{
+    int i;
+
+    if (fmllr == NULL)
+        return 0;
+    if (--fmllr->refcnt > 0)
+        return fmllr->refcnt;
+
+    for (i = 0; i < fmllr->n_feat; ++i) {
+        ckd_free(fmllr->a[i]);
+        ckd_free(fmllr->b[i]);
+        ckd_free_2d(fmllr->stats[i]);
+    }
+    ckd_free(fmllr->veclen);
+    ckd_free(fmllr->a);
+    ckd_free(fmllr->b);
+    ckd_free(fmllr->stats);
+    ckd_free(fmllr);
+
+    return 0;
+}
+
+void
+ps_fmllr_reset(ps_fmllr_t *fmllr)
+{
+    int i, j;
+
+    for (i = 0; i < fmllr->n_feat; ++i) {
+        for (j = 0; j < fmllr->veclen[i]; ++j) {
+            fmllr->a[i][j] = 1.0f;
+            fmllr->b[i][j] = 0.0f;
+        }
+        memset(fmllr->stats[i][0], 0, fmllr->veclen[i] * PS_FMLLR_N_STATS
+               * sizeof(***fmllr->stats));
+    }
+    fmllr->count = 0;
+}
+
+/*
+ * Each dimension x of the features is transformed to a * x + b.  With
+ * the inverse variance p and mean m of the density aligned to each
+ * frame, weighted by its posterior g, the statistics are
+ *
+ *   s0 = sum g p x^2, s1 = sum g p x, s2 = sum g p,
+ *   s3 = sum g p m x, s4 = sum g p m,
+ *
+ * and, with the total weight n, the likelihood to be maximized is
+ *
+ *   n log a - (a^2 s0 + 2 a b s1 + b^2 s2) / 2 + a s3 + b s4.
+ *
+ * Setting its derivative by b to zero gives b = (s4 - a s1) / s2, and
+ * putting this in the derivative by a gives a quadratic in a, whose
+ * positive root is the answer.
+ */
+int
+ps_fmllr_update(ps_fmllr_t *fmllr, float32 prior)
+{
+    float64 n, w;
+    int i, j;
+
+    if ((n = fmllr->count) <= 0) {
+        E_ERROR("No statistics accumulated for feature space transform\n");
+        return -1;
+    }
+    w = n / (n + prior);
+    for (i = 0; i < fmllr->n_feat; ++i) {
+        for (j = 0; j < fmllr->veclen[i]; ++j) {
+            float64 const *s = fmllr->stats[i][j];
+            float64 c1, c2, a, b;
+
+            fmllr->a[i][j] = 1.0f;
+            fmllr->b[i][j] = 0.0f;
+            if (s[2] <= 0)
+                continue;
+            c2 = s[0] - s[1] * s[1] / s[2];
+            c1 = s[3] - s[1] * s[4] / s[2];
+            if (c2 <= 0)
+                continue;
+            a = (c1 + sqrt(c1 * c1 + 4 * c2 * n)) / (2 * c2);
+            b = (s[4] - a * s[1]) / s[2];
+            fmllr->a[i][j] = (float32)(w * a + (1 - w));
+            fmllr->b[i][j] = (float32)(w * b);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,346 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2017 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_pipeline.c Computing features and senone scores in a
+ * separate thread from the search.
+ *
+ * The scoring thread does everything that acmod does with the input:
+ * the front end, dynamic features, senone scores, and moving on from
+ * frames that have been searched.  The calling thread only searches
+ * frames whose scores are ready, which the acoustic model keeps in
+ * its batch score rows (see acmod_set_pipeline()), and tells the
+ * scoring thread how far it has got.  Only those two counts are
+ * shared, under a lock.
+ *
+ * Each call does not return until all of its input has been searched,
+ * as it would without a pipeline, so the results are the same.
+ */
+
+/* SphinxBase headers. */
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/sbthread.h>
+
+/* Local headers. */
+#include "pocketsphinx_internal.h"
+
+/** Work for the scoring thread. */
+enum {
+    PIPE_JOB_RAW,     /**< Process audio */
+    PIPE_JOB_CEP,     /**< Process cepstra */
+    PIPE_JOB_END,     /**< End the utterance */
+    PIPE_JOB_EXIT     /**< Exit the thread */
+};
+
+struct ps_pipeline_s {
+    ps_decoder_t *ps;
+    acmod_t *acmod;
+    int n_queue;          /**< Most frames scored ahead of the search. */
+    sbthread_t *thr;      /**< Scoring thread. */
+    sbevent_t *start;     /**< Signalled when a job is ready. */
+    sbevent_t *scored;    /**< Signalled when frames are scored or the job is done. */
+    sbevent_t *searched;  /**< Signalled when frames are searched. */
+
+    /* The job, which only the scoring thread touches while it runs. */
+    int job;
+    int16 const *raw;
+    size_t n_samples;
+    mfcc_t **cep;
+    int32 n_cep;
+    int full_utt;
+
+    /* Shared between the threads, under mtx. */
+    sbmtx_t *mtx;
+    int n_scored;         /**< Frames scored so far. */
+    int n_searched;       /**< Frames searched so far. */
+    int done;             /**< Whether the job is done. */
+    int rv;               /**< Job status, <0 on error. */
+    int cancel;           /**< Whether the search has stopped. */
+};
+
+/**
+ * Move the acoustic model on past the frames that have been searched.
+ *
+ * @return FALSE if the search has stopped.
+ */
+static int
+pipe_advance(ps_pipeline_t *pipe)
+{
+    int n_searched, cancel;
+
+    sbmtx_lock(pipe->mtx);
+    n_searched = pipe->n_searched;
+    cancel = pipe->cancel;
+    sbmtx_unlock(pipe->mtx);
+    while (pipe->acmod->output_frame < n_searched)
+        acmod_advance(pipe->acmod);
+    return !cancel;
+}
+
+/**
+ * Score all frames in the feature buffer, as far as the search has
+ * room for them.
+ */
+static int
+pipe_score(ps_pipeline_t *pipe)
+{
+    acmod_t *acmod = pipe->acmod;
+
+    while (pipe_advance(pipe)) {
+        int n_scored, n;
+
+        sbmtx_lock(pipe->mtx);
+        n_scored = pipe->n_scored;
+        sbmtx_unlock(pipe->mtx);
+        n = acmod->output_frame + acmod->n_feat_frame - n_scored;
+        if (n == 0)
+            return 0;
+        if (n > acmod->output_frame + pipe->n_queue - n_scored)
+            n = acmod->output_frame + pipe->n_queue - n_scored;
+        if (n == 0) {
+            /* Wait for the search to make room. */
+            sbevent_wait(pipe->searched, -1, -1);
+            continue;
+        }
+        if (acmod_score_ahead(acmod, n_scored, n) < 0)
+            return -1;
+        sbmtx_lock(pipe->mtx);
+        pipe->n_scored += n;
+        sbmtx_unlock(pipe->mtx);
+        sbevent_signal(pipe->scored);
+    }
+    return 0;
+}
+
+static int
+pipe_run(ps_pipeline_t *pipe)
+{
+    acmod_t *acmod = pipe->acmod;
+    int nfr;
+
+    if (pipe->job == PIPE_JOB_END) {
+        pipe_advance(pipe);
+        acmod_end_utt(acmod);
+        return pipe_score(pipe);
+    }
+    while (pipe->job == PIPE_JOB_RAW ? pipe->n_samples > 0 : pipe->n_cep > 0) {
+        size_t n_samples = pipe->n_samples;
+        int32 n_cep = pipe->n_cep;
+
+        if (!pipe_advance(pipe))
+            return 0;
+        /* The feature buffer is full, so wait for the search to
+         * free some of it. */
+        if (acmod->n_feat_frame == acmod->n_feat_alloc) {
+            sbevent_wait(pipe->searched, -1, -1);
+            continue;
+        }
+        if (pipe->job == PIPE_JOB_RAW)
+            nfr = acmod_process_raw(acmod, &pipe->raw, &pipe->n_samples,
+                                    pipe->full_utt);
+        else
+            nfr = acmod_process_cep(acmod, &pipe->cep, &pipe->n_cep,
+                                    pipe->full_utt);
+        if (nfr < 0)
+            return nfr;
+        if (pipe_score(pipe) < 0)
+            return -1;
+        /* Nothing could be processed until more frames are searched. */
+        if (nfr == 0 && n_samples == pipe->n_samples && n_cep == pipe->n_cep)
+            sbevent_wait(pipe->searched, -1, -1);
+    }
+    return 0;
+}
+
+static int
+pipe_main(sbthread_t *th)
+{
+    ps_pipeline_t *pipe = sbthread_arg(th);
+
+    while (sbevent_wait(pipe->start, -1, -1) == 0) {
+        int rv;
+
+        if (pipe->job == PIPE_JOB_EXIT)
+            break;
+        rv = pipe_run(pipe);
+        sbmtx_lock(pipe->mtx);
+        pipe->rv = rv;
+        pipe->done = TRUE;
+        sbmtx_unlock(pipe->mtx);
+        sbevent_signal(pipe->scored);
+    }
+    return 0;
+}
+
+/**
+ * Start the job set up in pipe, search frames as they are scored, and
+ * wait for it to finish.
+ *
+ * @return number of frames searched, or <0 on error.
+ */
+static int
+pipe_search(ps_pipeline_t *pipe, int job)
+{
+    ps_decoder_t *ps = pipe->ps;
+    int n_searched, nfr, rv;
+
+    /* Frames may have been searched without the pipeline. */
+    n_searched = pipe->acmod->output_frame;
+    pipe->n_searched = n_searched;
+    if (pipe->n_scored < n_searched)
+        pipe->n_scored = n_searched;
+    pipe->done = FALSE;
+    pipe->cancel = FALSE;
+    pipe->rv = 0;
+    pipe->job = job;
+    sbevent_signal(pipe->start);
+
+    nfr = rv = 0;
+    for (;;) {
+        int n_scored, done;
+
+        sbmtx_lock(pipe->mtx);
+        n_scored = pipe->n_scored;
+        done = pipe->done;
+        sbmtx_unlock(pipe->mtx);
+        while (rv >= 0 && n_searched < n_scored) {
+            if ((rv = ps_search_frame(ps, n_searched)) < 0) {
+                sbmtx_lock(pipe->mtx);
+                pipe->cancel = TRUE;
+                sbmtx_unlock(pipe->mtx);
+            }
+            else {
+                ++n_searched;
+                ++nfr;
+                sbmtx_lock(pipe->mtx);
+                pipe->n_searched = n_searched;
+                sbmtx_unlock(pipe->mtx);
+            }
+            sbevent_signal(pipe->searched);
+        }
+        if (done)
+            break;
+        sbevent_wait(pipe->scored, -1, -1);
+    }
+
+    /* The scoring thread is waiting for the next job, so the rest of
+     * the frames can be moved past here. */
+    while (pipe->acmod->output_frame < n_searched)
+        acmod_advance(pipe->acmod);
+    if (rv < 0)
+        return rv;
+    if (pipe->rv < 0)
+        return pipe->rv;
+    return nfr;
+}
+
+ps_pipeline_t *
+ps_pipeline_init(ps_decoder_t *ps, int n_queue)
+{
+    ps_pipeline_t *pipe;
+
+    if (acmod_set_pipeline(ps->acmod, n_queue) < 0)
+        return NULL;
+    pipe = ckd_calloc(1, sizeof(*pipe));
+    pipe->ps = ps;
+    pipe->acmod = ps->acmod;
+    pipe->n_queue = n_queue;
+    if ((pipe->mtx = sbmtx_init()) == NULL
+        || (pipe->start = sbevent_init()) == NULL
+        || (pipe->scored = sbevent_init()) == NULL
+        || (pipe->searched = sbevent_init()) == NULL
+        || (pipe->thr = sbthread_start(NULL, pipe_main, pipe)) == NULL) {
+        E_ERROR("Failed to start scoring thread\n");
+        ps_pipeline_free(pipe);
+        return NULL;
+    }
+    E_INFO("Scoring up to %d frames ahead of the search in a separate thread\n",
+           n_queue);
+    return pipe;
+}
+
+void
+ps_pipeline_free(ps_pipeline_t *pipe)
+{
+    if (pipe == NULL)
+        return;
+    if (pipe->thr) {
+        pipe->job = PIPE_JOB_EXIT;
+        sbevent_signal(pipe->start);
+        sbthread_free(pipe->thr);
+    }
+    if (pipe->start)
+        sbevent_free(pipe->start);
+    if (pipe->scored)
+        sbevent_free(pipe->scored);
+    if (pipe->searched)
+        sbevent_free(pipe->searched);
+    if (pipe->mtx)
+        sbmtx_free(pipe->mtx);
+    acmod_set_pipeline(pipe->acmod, 0);
+    ckd_free(pipe);
+}
+
+void
+ps_pipeline_start_utt(ps_pipeline_t *pipe)
+{
+    pipe->n_scored = 0;
+    pipe->n_searched = 0;
+}
+
+int
+ps_pipeline_process_raw(ps_pipeline_t *pipe, int16 const *data,
+                        size_t n_samples, int full_utt)
+{
+    pipe->raw = data;
+    pipe->n_samples = n_samples;
+    pipe->full_utt = full_utt;
+    return pipe_search(pipe, PIPE_JOB_RAW);
+}
+
+int
+ps_pipeline_process_cep(ps_pipeline_t *pipe, mfcc_t **data,
+                        int32 n_frames, int full_utt)
+{
+    pipe->cep = data;
+    pipe->n_cep = n_frames;
+    pipe->full_utt = full_utt;
+    return pipe_search(pipe, PIPE_JOB_CEP);
+}
+
+int
+ps_pipeline_end_utt(ps_pipeline_t *pipe)
+{
+    return pipe_search(pipe, PIPE_JOB_END);
+}
@@ -0,0 +1,289 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2017 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_reload.c Replacing language models and dictionaries while decoding.
+ *
+ * The thread preparing a reload works only on objects of its own,
+ * besides reading the decoder's models.  Its dictionary is a copy
+ * made with dict_share(), since the decoder retains and releases its
+ * own dictionary in lattices as it decodes, and the decoder takes the
+ * same lock as the preparing thread before it frees or replaces any
+ * of the models they share.
+ */
+
+/* System headers. */
+#include <string.h>
+
+/* SphinxBase headers. */
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/glist.h>
+#include <sphinxbase/sbthread.h>
+
+/* Local headers. */
+#include "pocketsphinx_internal.h"
+#include "ngram_search.h"
+
+struct ps_reload_s {
+    ps_decoder_t *ps;     /**< Decoder to be reloaded. */
+    dict_t *share;        /**< Copy of its dictionary. */
+    dict2pid_t *share_d2p; /**< Its dictionary to senone mapping. */
+    dict_t *dict;         /**< New dictionary, or share. */
+    dict2pid_t *d2p;      /**< Mapping for dict. */
+    glist_t searches;     /**< New searches, most recent first. */
+    int failed;           /**< Whether preparing anything failed. */
+};
+
+ps_reload_t *
+ps_reload_init(ps_decoder_t *ps)
+{
+    ps_reload_t *reload;
+
+    if (ps->acmod == NULL || ps->dict == NULL) {
+        E_ERROR("Cannot reload a decoder which is not initialized\n");
+        return NULL;
+    }
+    if (ps->reload_mtx == NULL
+        && (ps->reload_mtx = sbmtx_init()) == NULL)
+        return NULL;
+
+    reload = ckd_calloc(1, sizeof(*reload));
+    reload->ps = ps;
+    reload->share = dict_share(ps->dict);
+    reload->share_d2p = dict2pid_retain(ps->d2p);
+    reload->dict = reload->share;
+    reload->d2p = reload->share_d2p;
+    return reload;
+}
+
+int
+ps_reload_load_dict(ps_reload_t *reload, char const *dictfile,
+                    char const *fdictfile, char const *format)
+{
+    ps_decoder_t *ps = reload->ps;
+    cmd_ln_t *newconfig;
+    dict2pid_t *d2p;
+    dict_t *dict;
+
+    if (ps->shared || ps->n_clones) {
+        E_ERROR("Cannot change the dictionary of a cloned decoder\n");
+        reload->failed = TRUE;
+        return -1;
+    }
+    if (reload->searches) {
+        E_ERROR("Dictionary must be loaded before language models\n");
+        reload->failed = TRUE;
+        return -1;
+    }
+
+    /* As in ps_load_dict(). */
+    newconfig = cmd_ln_init(NULL, ps_args(), TRUE, NULL);
+    cmd_ln_set_boolean_r(newconfig, "-dictcase",
+                         cmd_ln_boolean_r(ps->config, "-dictcase"));
+    cmd_ln_set_str_r(newconfig, "-dict", dictfile);
+    if (fdictfile)
+        cmd_ln_set_str_extra_r(newconfig, "_fdict", fdictfile);
+    else
+        cmd_ln_set_str_extra_r(newconfig, "_fdict",
+                               cmd_ln_str_r(ps->config, "_fdict"));
+
+    sbmtx_lock(ps->reload_mtx);
+    dict = dict_init(newconfig, ps->acmod->mdef);
+    d2p = dict ? dict2pid_build(ps->acmod->mdef, dict) : NULL;
+    cmd_ln_free_r(newconfig);
+    if (d2p == NULL) {
+        dict_free(dict);
+        sbmtx_unlock(ps->reload_mtx);
+        reload->failed = TRUE;
+        return -1;
+    }
+    if (reload->dict != reload->share) {
+        dict_free(reload->dict);
+        dict2pid_free(reload->d2p);
+    }
+    reload->dict = dict;
+    reload->d2p = d2p;
+    sbmtx_unlock(ps->reload_mtx);
+
+    return 0;
+}
+
+int
+ps_reload_set_lm(ps_reload_t *reload, const char *name, ngram_model_t *lm)
+{
+    ps_decoder_t *ps = reload->ps;
+    ps_search_t *search;
+
+    sbmtx_lock(ps->reload_mtx);
+    search = ngram_search_prepare(name, lm, ps->config, ps->acmod,
+                                  reload->dict, reload->d2p);
+    sbmtx_unlock(ps->reload_mtx);
+    if (search == NULL) {
+        reload->failed = TRUE;
+        return -1;
+    }
+    reload->searches = glist_add_ptr(reload->searches, search);
+
+    return 0;
+}
+
+int
+ps_reload_set_lm_file(ps_reload_t *reload, const char *name,
+                      const char *path)
+{
+    ps_decoder_t *ps = reload->ps;
+    ngram_model_t *lm;
+    int rv;
+
+    if ((lm = ngram_model_read(ps->config, path, NGRAM_AUTO,
+                               ps->lmath)) == NULL) {
+        reload->failed = TRUE;
+        return -1;
+    }
+    rv = ps_reload_set_lm(reload, name, lm);
+    ngram_model_free(lm);
+
+    return rv;
+}
+
+int
+ps_reload_commit(ps_reload_t *reload)
+{
+    ps_decoder_t *ps = reload->ps;
+    /* It belongs to the decoder as soon as it is in the list. */
+    int rv = reload->failed ? -1 : 0;
+
+    sbmtx_lock(ps->reload_mtx);
+    ps->reloads = glist_add_ptr(ps->reloads, reload);
+    sbmtx_unlock(ps->reload_mtx);
+
+    return rv;
+}
+
+void
+ps_reload_free(ps_reload_t *reload)
+{
+    gnode_t *gn;
+
+    if (reload == NULL)
+        return;
+    /* Those which were put in place are NULL. */
+    for (gn = reload->searches; gn; gn = gnode_next(gn))
+        if (gnode_ptr(gn))
+            ps_search_free(gnode_ptr(gn));
+    glist_free(reload->searches);
+    if (reload->dict != reload->share) {
+        dict_free(reload->dict);
+        dict2pid_free(reload->d2p);
+    }
+    dict_free(reload->share);
+    dict2pid_free(reload->share_d2p);
+    ckd_free(reload);
+}
+
+/* Put one reload in place, with the lock held. */
+static int
+ps_reload_apply_one(ps_decoder_t *ps, ps_reload_t *reload)
+{
+    gnode_t *gn;
+
+    if (reload->failed) {
+        E_ERROR("Discarding a reload which failed\n");
+        return -1;
+    }
+    if (reload->dict != reload->share && (ps->shared || ps->n_clones)) {
+        E_ERROR("Cannot change the dictionary of a cloned decoder\n");
+        return -1;
+    }
+
+    /* Searches are added in the order they were set. */
+    reload->searches = glist_reverse(reload->searches);
+    for (gn = reload->searches; gn; gn = gnode_next(gn)) {
+        ps_search_t *search = gnode_ptr(gn);
+
+        /* A search built with the copy of the dictionary uses the
+         * decoder's own, unless that has changed since, in which
+         * case it has to be built again. */
+        if (reload->dict == reload->share) {
+            if (reload->share->shared == (ps->dict->shared
+                                          ? ps->dict->shared : ps->dict)
+                && reload->d2p == ps->d2p)
+                ps_search_base_reinit(search, ps->dict, ps->d2p);
+            else if (ps_search_reinit(search, ps->dict, ps->d2p) < 0)
+                return -1;
+        }
+        ngram_search_set_grow(search);
+        ps_replace_search(ps, search);
+        gnode_ptr(gn) = NULL;
+    }
+
+    /* The other searches are updated for a new dictionary now. */
+    if (reload->dict != reload->share)
+        return ps_replace_dict(ps, reload->dict, reload->d2p);
+    return 0;
+}
+
+void
+ps_reload_apply(ps_decoder_t *ps)
+{
+    glist_t reloads;
+    gnode_t *gn;
+
+    if (ps->reload_mtx == NULL || sbmtx_trylock(ps->reload_mtx) != 0)
+        return;
+    reloads = glist_reverse(ps->reloads);
+    ps->reloads = NULL;
+    for (gn = reloads; gn; gn = gnode_next(gn)) {
+        ps_reload_t *reload = gnode_ptr(gn);
+        if (ps_reload_apply_one(ps, reload) < 0)
+            E_ERROR("Failed to reload decoder\n");
+        ps_reload_free(reload);
+    }
+    glist_free(reloads);
+    sbmtx_unlock(ps->reload_mtx);
+}
+
+void
+ps_reload_free_all(ps_decoder_t *ps)
+{
+    gnode_t *gn;
+
+    for (gn = ps->reloads; gn; gn = gnode_next(gn))
+        ps_reload_free(gnode_ptr(gn));
+    glist_free(ps->reloads);
+    ps->reloads = NULL;
+    if (ps->reload_mtx)
+        sbmtx_free(ps->reload_mtx);
+    ps->reload_mtx = NULL;
+}
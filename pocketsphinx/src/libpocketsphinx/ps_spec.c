@@ -0,0 +1,399 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2017 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/**
+ * @file ps_spec.c Finishing utterances speculatively once the speech
+ * seems to have ended.
+ *
+ * When the voice activity detector has seen -specfinal frames of
+ * silence after the speech, a clone of the decoder searches a copy of
+ * all the features so far, through all of its passes, in a separate
+ * thread.  If no more speech comes before ps_end_utt(), the clone's
+ * result is taken as that of the utterance, and the decoder only
+ * cleans up after its own search.  If it does, the clone is stopped,
+ * and another one may start at the next pause.
+ */
+
+#include <string.h>
+
+/* SphinxBase headers. */
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/sbthread.h>
+
+/* Local headers. */
+#include "pocketsphinx_internal.h"
+
+struct ps_spec_s {
+    ps_decoder_t *ps;
+    int n_silence;        /**< Frames of silence to start after. */
+
+    /* The clone, and what it was made from, since it has to be made
+     * again if the decoder's search or dictionary change. */
+    ps_decoder_t *clone;
+    ps_search_t *search;
+    dict_t *dict;
+    int32 n_words;
+
+    sbthread_t *thr;      /**< Thread searching in the clone. */
+    sbevent_t *start;     /**< Signalled when a search is ready. */
+    sbevent_t *done;      /**< Signalled when it is done. */
+    int exit;             /**< Whether the thread should exit. */
+
+    /* The search, which only the thread touches while it runs. */
+    mfcc_t ***feat;       /**< Copy of the utterance's features. */
+    int n_feat_alloc;
+    int n_frame;          /**< Frames in feat. */
+    frame_idx_t utt_start;/**< Stream offset of the utterance. */
+    int rv;
+
+    /* Kept by the calling thread. */
+    int busy;             /**< Whether the thread has not been waited for. */
+    int valid;            /**< Whether no speech has come since. */
+    int taken;            /**< Whether the clone has the result. */
+    int32 silence;        /**< Frames of silence at the last check. */
+    int frame;            /**< Frames searched at the last check. */
+
+    /* Shared between the threads, under mtx. */
+    sbmtx_t *mtx;
+    int cancel;           /**< Whether to stop searching. */
+    int finished;         /**< Whether the search is done. */
+};
+
+static int
+spec_cancelled(ps_spec_t *spec)
+{
+    int cancel;
+
+    sbmtx_lock(spec->mtx);
+    cancel = spec->cancel;
+    sbmtx_unlock(spec->mtx);
+    return cancel;
+}
+
+/**
+ * Search the copied features from the start of the utterance to the
+ * end, including the best path through the lattice.
+ */
+static int
+spec_search(ps_spec_t *spec)
+{
+    ps_decoder_t *clone = spec->clone;
+    acmod_t *acmod = clone->acmod;
+    int i, rv;
+
+    if ((rv = ps_start_utt(clone)) < 0)
+        return rv;
+    acmod->utt_start_frame = spec->utt_start;
+    for (i = 0; i < spec->n_frame && !spec_cancelled(spec); ++i) {
+        acmod_process_feat(acmod, spec->feat[i]);
+        while (acmod->n_feat_frame > 0) {
+            if ((rv = ps_search_frame(clone, acmod->output_frame)) < 0) {
+                ps_end_utt(clone);
+                return rv;
+            }
+            acmod_advance(acmod);
+        }
+    }
+    /* Nobody wants the result of a search which was stopped. */
+    if (spec_cancelled(spec)) {
+        clone->search->discard = TRUE;
+        rv = ps_end_utt(clone);
+        clone->search->discard = FALSE;
+        return rv;
+    }
+    if ((rv = ps_end_utt(clone)) < 0)
+        return rv;
+    ps_get_hyp(clone, NULL);
+    return 0;
+}
+
+static int
+spec_main(sbthread_t *th)
+{
+    ps_spec_t *spec = sbthread_arg(th);
+
+    while (sbevent_wait(spec->start, -1, -1) == 0) {
+        int rv;
+
+        if (spec->exit)
+            break;
+        rv = spec_search(spec);
+        sbmtx_lock(spec->mtx);
+        spec->rv = rv;
+        spec->finished = TRUE;
+        sbmtx_unlock(spec->mtx);
+        sbevent_signal(spec->done);
+    }
+    return 0;
+}
+
+/**
+ * Wait for the search in the clone to finish, stopping it first if
+ * cancel is TRUE.
+ */
+static void
+spec_wait(ps_spec_t *spec, int cancel)
+{
+    if (!spec->busy)
+        return;
+    if (cancel) {
+        sbmtx_lock(spec->mtx);
+        spec->cancel = TRUE;
+        sbmtx_unlock(spec->mtx);
+    }
+    sbevent_wait(spec->done, -1, -1);
+    spec->busy = FALSE;
+}
+
+static void
+spec_free_clone(ps_spec_t *spec)
+{
+    if (spec->clone == NULL)
+        return;
+    ps_free(spec->clone);
+    spec->clone = NULL;
+    spec->taken = FALSE;
+}
+
+/**
+ * Make a clone for the decoder's current search and dictionary, if
+ * the one there is was made for others.
+ */
+static int
+spec_clone(ps_spec_t *spec)
+{
+    ps_decoder_t *ps = spec->ps;
+    ps_decoder_t *clone;
+
+    if (spec->clone && spec->search == ps->search && spec->dict == ps->dict
+        && spec->n_words == dict_size(ps->dict))
+        return 0;
+    spec_free_clone(spec);
+    if ((clone = ps_clone(ps)) == NULL)
+        return -1;
+    /* It belongs to the decoder, so it neither keeps it alive nor
+     * stops its dictionary from changing, see ps_spec_reset(). */
+    clone->shared = NULL;
+    --ps->refcount;
+    --ps->n_clones;
+    /* Nor does it log anything an utterance of the decoder would. */
+    clone->mfclogdir = clone->rawlogdir = clone->senlogdir = NULL;
+    cmd_ln_set_boolean_r(clone->config, "-backtrace", FALSE);
+    /* It searches the features it is given as they come, and only
+     * for the result of the active search. */
+    ps_pipeline_free(clone->pipeline);
+    clone->pipeline = NULL;
+    ps_clear_concurrent_searches(clone);
+
+    spec->clone = clone;
+    spec->search = ps->search;
+    spec->dict = ps->dict;
+    spec->n_words = dict_size(ps->dict);
+    return 0;
+}
+
+/**
+ * Copy the features searched so far and start searching them in the
+ * clone.
+ */
+static void
+spec_start(ps_spec_t *spec)
+{
+    acmod_t *acmod = spec->ps->acmod;
+    int i, j;
+
+    if (spec_clone(spec) < 0) {
+        E_ERROR("Failed to clone decoder, not finishing utterances "
+                "speculatively\n");
+        spec->n_silence = 0;
+        return;
+    }
+    if (acmod->output_frame > spec->n_feat_alloc) {
+        int n = acmod->output_frame + acmod->output_frame / 2;
+
+        if (spec->feat)
+            spec->feat = feat_array_realloc(acmod->fcb, spec->feat,
+                                            spec->n_feat_alloc, n);
+        else
+            spec->feat = feat_array_alloc(acmod->fcb, n);
+        spec->n_feat_alloc = n;
+    }
+    for (i = 0; i < acmod->output_frame; ++i) {
+        int frame_idx = i;
+        mfcc_t **feat;
+
+        /* Only if the buffer grows are all the frames still there. */
+        if ((feat = acmod_get_frame(acmod, &frame_idx)) == NULL)
+            return;
+        for (j = 0; j < feat_dimension1(acmod->fcb); ++j)
+            memcpy(spec->feat[i][j], feat[j],
+                   feat_dimension2(acmod->fcb, j) * sizeof(***spec->feat));
+    }
+    spec->n_frame = acmod->output_frame;
+    spec->utt_start = acmod_stream_offset(acmod);
+
+    spec->cancel = FALSE;
+    spec->finished = FALSE;
+    spec->busy = TRUE;
+    spec->valid = TRUE;
+    sbevent_signal(spec->start);
+}
+
+ps_spec_t *
+ps_spec_init(ps_decoder_t *ps, int n_silence)
+{
+    ps_spec_t *spec;
+
+    spec = ckd_calloc(1, sizeof(*spec));
+    spec->ps = ps;
+    spec->n_silence = n_silence;
+    if ((spec->mtx = sbmtx_init()) == NULL
+        || (spec->start = sbevent_init()) == NULL
+        || (spec->done = sbevent_init()) == NULL
+        || (spec->thr = sbthread_start(NULL, spec_main, spec)) == NULL) {
+        E_ERROR("Failed to start speculative search thread\n");
+        ps_spec_free(spec);
+        return NULL;
+    }
+    E_INFO("Finishing utterances in a separate thread after %d frames "
+           "of silence\n", n_silence);
+    return spec;
+}
+
+void
+ps_spec_free(ps_spec_t *spec)
+{
+    if (spec == NULL)
+        return;
+    if (spec->thr) {
+        spec_wait(spec, TRUE);
+        spec->exit = TRUE;
+        sbevent_signal(spec->start);
+        sbthread_free(spec->thr);
+    }
+    spec_free_clone(spec);
+    if (spec->feat)
+        feat_array_free(spec->feat);
+    if (spec->start)
+        sbevent_free(spec->start);
+    if (spec->done)
+        sbevent_free(spec->done);
+    if (spec->mtx)
+        sbmtx_free(spec->mtx);
+    ckd_free(spec);
+}
+
+void
+ps_spec_reset(ps_spec_t *spec)
+{
+    if (spec == NULL)
+        return;
+    spec_wait(spec, TRUE);
+    spec->valid = FALSE;
+    spec_free_clone(spec);
+}
+
+void
+ps_spec_start_utt(ps_spec_t *spec)
+{
+    spec_wait(spec, TRUE);
+    spec->valid = FALSE;
+    spec->taken = FALSE;
+    /* All of the features are copied to start a search. */
+    acmod_set_grow(spec->ps->acmod, TRUE);
+}
+
+void
+ps_spec_update(ps_spec_t *spec)
+{
+    acmod_t *acmod = spec->ps->acmod;
+    int in_speech, finished;
+    int32 silence;
+
+    in_speech = fe_get_vad_state(acmod->fe);
+    silence = fe_get_vad_silence(acmod->fe);
+    if (spec->valid) {
+        /* Speech has come back if the silence is shorter than all the
+         * frames since the last check.  Some of those may have been
+         * computed before it, and some after, but no more than fit in
+         * the cepstrum buffer. */
+        if (in_speech && silence + acmod->n_mfc_alloc
+            < spec->silence + acmod->output_frame - spec->frame) {
+            sbmtx_lock(spec->mtx);
+            spec->cancel = TRUE;
+            sbmtx_unlock(spec->mtx);
+            spec->valid = FALSE;
+        }
+        spec->silence = silence;
+        spec->frame = acmod->output_frame;
+        return;
+    }
+    if (spec->n_silence <= 0 || !in_speech || silence < spec->n_silence
+        || acmod->output_frame == 0)
+        return;
+    /* Only start again once the last one has stopped. */
+    if (spec->busy) {
+        sbmtx_lock(spec->mtx);
+        finished = spec->finished;
+        sbmtx_unlock(spec->mtx);
+        if (!finished)
+            return;
+        spec_wait(spec, FALSE);
+    }
+    spec->silence = silence;
+    spec->frame = acmod->output_frame;
+    spec_start(spec);
+}
+
+int
+ps_spec_end_utt(ps_spec_t *spec)
+{
+    /* One which was stopped is waited for at the next utterance. */
+    if (!spec->valid)
+        return FALSE;
+    spec->valid = FALSE;
+    spec_wait(spec, FALSE);
+    if (spec->rv < 0) {
+        E_WARN("Speculative search failed, finishing the utterance\n");
+        return FALSE;
+    }
+    spec->taken = TRUE;
+    return TRUE;
+}
+
+ps_decoder_t *
+ps_spec_result(ps_spec_t *spec)
+{
+    return spec->taken ? spec->clone : NULL;
+}
@@ -60,11 +60,50 @@
 #include "tied_mgau_common.h"
 #include "ptm_mgau.h"
 
+#if !defined(FIXED_POINT)
+#if defined(__SSE2__) || defined(_M_X64)
+#define PTM_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PTM_SIMD_AVX
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define PTM_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+/* Fixed-point models are for ARM, 32-bit ones included. */
+#define PTM_SIMD_NEON_FIXED
+#include <arm_neon.h>
+#endif /* !FIXED_POINT */
+
+#if defined(PTM_SIMD_SSE2) || defined(PTM_SIMD_AVX) || defined(PTM_SIMD_NEON) \
+    || defined(PTM_SIMD_NEON_FIXED)
+#define PTM_SIMD
+#endif
+
+/* Senones are scored in runs of whole blocks of this many with any
+ * active ones (see ptm_mgau_senone_eval()). */
+#define PTM_SEN_CHUNK 8
+
+/* Number of codewords evaluated at once by the vector kernels. */
+#define PTM_BLOCK 8
+/* Size of a block of interleaved codewords (determinants, then mean
+ * and variance of each dimension). */
+#define PTM_BLOCK_SIZE(ceplen) (PTM_BLOCK * (1 + 2 * (ceplen)))
+
 static ps_mgaufuncs_t ptm_mgau_funcs = {
     "ptm",
     ptm_mgau_frame_eval,      /* frame_eval */
+    ptm_mgau_frame_eval_batch, /* frame_eval_batch */
     ptm_mgau_mllr_transform,  /* transform */
-    ptm_mgau_free             /* free */
+    ptm_mgau_share,           /* share */
+    ptm_mgau_free,            /* free */
+    PS_MGAU_NORM_ACTIVE,      /* norm */
+    ptm_mgau_nearest,         /* nearest */
+    ptm_mgau_mem              /* mem */
 };
 
 #define COMPUTE_GMM_MAP(_idx)                           \
@@ -225,6 +264,364 @@ eval_cb(ptm_mgau_t *s, int cb, int feat, mfcc_t *z)
     return best->score;
 }
 
+#ifdef PTM_SIMD
+/*
+ * Vector kernels for eval_cb().  These compute the distances for a
+ * block of PTM_BLOCK codewords from ptm_mgau_pack_codebooks(), one
+ * codeword per lane, with the same operations in the same order as
+ * the scalar code, so they give the same scores.  Since distances
+ * only decrease, the block is abandoned once none of them is above
+ * thresh.  They return a bitmask of the codewords which are.
+ */
+#ifdef PTM_SIMD_SSE2
+static int
+ptm_dist_block_sse2(mfcc_t const *blk, mfcc_t const *obs, int ceplen,
+                    mfcc_t thresh, mfcc_t *out)
+{
+    __m128 d0, d1, th;
+    int j;
+
+    d0 = _mm_loadu_ps(blk);
+    d1 = _mm_loadu_ps(blk + 4);
+    th = _mm_set1_ps(thresh);
+    blk += PTM_BLOCK;
+    for (j = 0; j < ceplen; ++j) {
+        __m128 o = _mm_set1_ps(obs[j]);
+        __m128 diff0 = _mm_sub_ps(o, _mm_loadu_ps(blk));
+        __m128 diff1 = _mm_sub_ps(o, _mm_loadu_ps(blk + 4));
+        d0 = _mm_sub_ps(d0, _mm_mul_ps(_mm_mul_ps(diff0, diff0),
+                                       _mm_loadu_ps(blk + 8)));
+        d1 = _mm_sub_ps(d1, _mm_mul_ps(_mm_mul_ps(diff1, diff1),
+                                       _mm_loadu_ps(blk + 12)));
+        blk += 2 * PTM_BLOCK;
+        if ((j & 7) == 7
+            && !_mm_movemask_ps(_mm_or_ps(_mm_cmpge_ps(d0, th),
+                                          _mm_cmpge_ps(d1, th))))
+            return 0;
+    }
+    _mm_storeu_ps(out, d0);
+    _mm_storeu_ps(out + 4, d1);
+    return _mm_movemask_ps(_mm_cmpge_ps(d0, th))
+        | (_mm_movemask_ps(_mm_cmpge_ps(d1, th)) << 4);
+}
+#endif /* PTM_SIMD_SSE2 */
+
+#ifdef PTM_SIMD_AVX
+__attribute__((target("avx")))
+static int
+ptm_dist_block_avx(mfcc_t const *blk, mfcc_t const *obs, int ceplen,
+                   mfcc_t thresh, mfcc_t *out)
+{
+    __m256 d, th;
+    int j;
+
+    d = _mm256_loadu_ps(blk);
+    th = _mm256_set1_ps(thresh);
+    blk += PTM_BLOCK;
+    for (j = 0; j < ceplen; ++j) {
+        __m256 diff = _mm256_sub_ps(_mm256_set1_ps(obs[j]),
+                                    _mm256_loadu_ps(blk));
+        d = _mm256_sub_ps(d, _mm256_mul_ps(_mm256_mul_ps(diff, diff),
+                                           _mm256_loadu_ps(blk + 8)));
+        blk += 2 * PTM_BLOCK;
+        if ((j & 7) == 7
+            && !_mm256_movemask_ps(_mm256_cmp_ps(d, th, _CMP_GE_OQ)))
+            return 0;
+    }
+    _mm256_storeu_ps(out, d);
+    return _mm256_movemask_ps(_mm256_cmp_ps(d, th, _CMP_GE_OQ));
+}
+#endif /* PTM_SIMD_AVX */
+
+#ifdef PTM_SIMD_NEON
+static int
+ptm_dist_block_neon(mfcc_t const *blk, mfcc_t const *obs, int ceplen,
+                    mfcc_t thresh, mfcc_t *out)
+{
+    static const uint32_t bits[4] = { 1, 2, 4, 8 };
+    float32x4_t d0, d1, th;
+    uint32x4_t lanes;
+    int j;
+
+    d0 = vld1q_f32(blk);
+    d1 = vld1q_f32(blk + 4);
+    th = vdupq_n_f32(thresh);
+    blk += PTM_BLOCK;
+    for (j = 0; j < ceplen; ++j) {
+        float32x4_t o = vdupq_n_f32(obs[j]);
+        float32x4_t diff0 = vsubq_f32(o, vld1q_f32(blk));
+        float32x4_t diff1 = vsubq_f32(o, vld1q_f32(blk + 4));
+        d0 = vsubq_f32(d0, vmulq_f32(vmulq_f32(diff0, diff0),
+                                     vld1q_f32(blk + 8)));
+        d1 = vsubq_f32(d1, vmulq_f32(vmulq_f32(diff1, diff1),
+                                     vld1q_f32(blk + 12)));
+        blk += 2 * PTM_BLOCK;
+        if ((j & 7) == 7
+            && !vmaxvq_u32(vorrq_u32(vcgeq_f32(d0, th), vcgeq_f32(d1, th))))
+            return 0;
+    }
+    vst1q_f32(out, d0);
+    vst1q_f32(out + 4, d1);
+    lanes = vld1q_u32(bits);
+    return vaddvq_u32(vandq_u32(vcgeq_f32(d0, th), lanes))
+        | (vaddvq_u32(vandq_u32(vcgeq_f32(d1, th), lanes)) << 4);
+}
+#endif /* PTM_SIMD_NEON */
+
+#ifdef PTM_SIMD_NEON_FIXED
+/* MFCCMUL() of each lane: the 64-bit product shifted down and
+ * truncated. */
+static inline int32x4_t
+ptm_neon_fixmul(int32x4_t a, int32x4_t b)
+{
+    int64x2_t lo = vmull_s32(vget_low_s32(a), vget_low_s32(b));
+    int64x2_t hi = vmull_s32(vget_high_s32(a), vget_high_s32(b));
+
+    return vcombine_s32(vmovn_s64(vshrq_n_s64(lo, DEFAULT_RADIX)),
+                        vmovn_s64(vshrq_n_s64(hi, DEFAULT_RADIX)));
+}
+
+/* GMMSUB() of each lane, which wraps around to INT_MIN. */
+static inline int32x4_t
+ptm_neon_gmmsub(int32x4_t d, int32x4_t o, mfcc_t const *mean,
+                mfcc_t const *var)
+{
+    int32x4_t diff, r;
+
+    diff = vsubq_s32(o, vld1q_s32(mean));
+    r = vsubq_s32(d, ptm_neon_fixmul(ptm_neon_fixmul(diff, diff),
+                                     vld1q_s32(var)));
+    return vbslq_s32(vcgtq_s32(r, d), vdupq_n_s32(INT_MIN), r);
+}
+
+static inline int
+ptm_neon_any(uint32x4_t v)
+{
+    uint32x2_t h = vorr_u32(vget_low_u32(v), vget_high_u32(v));
+
+    return (vget_lane_u32(h, 0) | vget_lane_u32(h, 1)) != 0;
+}
+
+static int
+ptm_dist_block_neon_fixed(mfcc_t const *blk, mfcc_t const *obs, int ceplen,
+                          mfcc_t thresh, mfcc_t *out)
+{
+    int32x4_t d0, d1, th;
+    uint32_t ge[PTM_BLOCK];
+    int j, mask;
+
+    d0 = vld1q_s32(blk);
+    d1 = vld1q_s32(blk + 4);
+    th = vdupq_n_s32(thresh);
+    blk += PTM_BLOCK;
+    for (j = 0; j < ceplen; ++j) {
+        int32x4_t o = vdupq_n_s32(obs[j]);
+
+        d0 = ptm_neon_gmmsub(d0, o, blk, blk + 8);
+        d1 = ptm_neon_gmmsub(d1, o, blk + 4, blk + 12);
+        blk += 2 * PTM_BLOCK;
+        if ((j & 7) == 7
+            && !ptm_neon_any(vorrq_u32(vcgeq_s32(d0, th),
+                                       vcgeq_s32(d1, th))))
+            return 0;
+    }
+    vst1q_s32(out, d0);
+    vst1q_s32(out + 4, d1);
+    vst1q_u32(ge, vcgeq_s32(d0, th));
+    vst1q_u32(ge + 4, vcgeq_s32(d1, th));
+    for (j = mask = 0; j < PTM_BLOCK; ++j)
+        if (ge[j])
+            mask |= 1 << j;
+    return mask;
+}
+#endif /* PTM_SIMD_NEON_FIXED */
+
+/**
+ * Vectorized version of eval_cb().
+ */
+static int
+eval_cb_blocks(ptm_mgau_t *s, int cb, int feat, mfcc_t *z)
+{
+    ptm_topn_t *worst, *best, *topn;
+    mfcc_t const *blk;
+    mfcc_t d[PTM_BLOCK];
+    int32 i, b, l, ceplen, n_density;
+
+    best = topn = s->f->topn[cb][feat];
+    worst = topn + (s->max_topn - 1);
+    ceplen = s->g->featlen[feat];
+    n_density = s->g->n_density;
+    blk = s->cb_blocks[cb][feat];
+
+    for (b = 0; b < n_density; b += PTM_BLOCK, blk += PTM_BLOCK_SIZE(ceplen)) {
+        int mask;
+
+        mask = s->dist_block(blk, z, ceplen, (mfcc_t) worst->score, d);
+        /* Insert the survivors in order, as eval_cb() would have. */
+        for (l = 0; mask && b + l < n_density; ++l, mask >>= 1) {
+            ptm_topn_t *cur;
+            int32 cw = b + l;
+
+            if (!(mask & 1))
+                continue;
+            /* The threshold may have gone up since the block started. */
+            if (d[l] < (mfcc_t) worst->score)
+                continue;
+            for (i = 0; i < s->max_topn; i++) {
+                if (topn[i].cw == cw)
+                    break;
+            }
+            if (i < s->max_topn)
+                continue;       /* already there.  Don't insert */
+            insertion_sort_cb(&cur, worst, best, cw, (int32)d[l]);
+        }
+    }
+
+    return best->score;
+}
+
+/**
+ * Interleave the codebooks in blocks of PTM_BLOCK codewords for the
+ * vector kernels.  This has to be redone if the means and variances
+ * change.
+ */
+static void
+ptm_mgau_pack_codebooks(ptm_mgau_t *s)
+{
+    mfcc_t *data;
+    int32 i, j, k, cw, n_blocks, total;
+
+    if (s->cb_blocks) {
+        ckd_free(s->cb_blocks[0][0]);
+        ckd_free_2d(s->cb_blocks);
+    }
+    n_blocks = (s->g->n_density + PTM_BLOCK - 1) / PTM_BLOCK;
+    total = 0;
+    for (j = 0; j < s->g->n_feat; ++j)
+        total += n_blocks * PTM_BLOCK_SIZE(s->g->featlen[j]);
+    s->cb_blocks = ckd_calloc_2d(s->g->n_mgau, s->g->n_feat,
+                                 sizeof(**s->cb_blocks));
+    data = ckd_calloc(s->g->n_mgau * total, sizeof(*data));
+    for (i = 0; i < s->g->n_mgau; ++i) {
+        for (j = 0; j < s->g->n_feat; ++j) {
+            int32 ceplen = s->g->featlen[j];
+
+            s->cb_blocks[i][j] = data;
+            for (cw = 0; cw < s->g->n_density; ++cw) {
+                mfcc_t *blk = data + cw / PTM_BLOCK * PTM_BLOCK_SIZE(ceplen)
+                    + cw % PTM_BLOCK;
+                mfcc_t const *mean = s->g->mean[i][j][0] + cw * ceplen;
+                mfcc_t const *var = s->g->var[i][j][0] + cw * ceplen;
+
+                blk[0] = s->g->det[i][j][cw];
+                for (k = 0; k < ceplen; ++k) {
+                    blk[PTM_BLOCK * (1 + 2 * k)] = mean[k];
+                    blk[PTM_BLOCK * (2 + 2 * k)] = var[k];
+                }
+            }
+            data += n_blocks * PTM_BLOCK_SIZE(ceplen);
+        }
+    }
+}
+#endif /* PTM_SIMD */
+
+/**
+ * Choose the codebook evaluation code for this machine.
+ */
+static void
+ptm_mgau_select_backend(ptm_mgau_t *s)
+{
+    s->dist_block = NULL;
+    s->eval_backend = "reference";
+#ifdef PTM_SIMD_NEON
+    s->dist_block = ptm_dist_block_neon;
+    s->eval_backend = "neon";
+#endif
+#ifdef PTM_SIMD_NEON_FIXED
+    s->dist_block = ptm_dist_block_neon_fixed;
+    s->eval_backend = "neon-fixed";
+#endif
+#ifdef PTM_SIMD_SSE2
+    s->dist_block = ptm_dist_block_sse2;
+    s->eval_backend = "sse2";
+#endif
+#ifdef PTM_SIMD_AVX
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx")) {
+        s->dist_block = ptm_dist_block_avx;
+        s->eval_backend = "avx";
+    }
+#endif
+#ifdef PTM_SIMD
+    ptm_mgau_pack_codebooks(s);
+#endif
+}
+
+/**
+ * Same as eval_cb(), but only for the codewords in the kd-tree leaf.
+ */
+static int
+eval_cb_kdtree(ptm_mgau_t *s, int cb, int feat, mfcc_t *z)
+{
+    ptm_topn_t *worst, *best, *topn;
+    uint16 const *bbi;
+    int32 i, n_bbi, ceplen;
+
+    best = topn = s->f->topn[cb][feat];
+    worst = topn + (s->max_topn - 1);
+    ceplen = s->g->featlen[feat];
+    bbi = kd_tree_eval(s->kdtrees[cb * s->g->n_feat + feat], z, &n_bbi);
+
+    for (i = 0; i < n_bbi; ++i) {
+        mfcc_t diff, sqdiff, compl; /* diff, diff^2, component likelihood */
+        mfcc_t *mean, *var, d, thresh;
+        mfcc_t *obs;
+        ptm_topn_t *cur;
+        int32 cw, j, k;
+
+        cw = bbi[i];
+        mean = s->g->mean[cb][feat][0] + cw * ceplen;
+        var = s->g->var[cb][feat][0] + cw * ceplen;
+        d = s->g->det[cb][feat][cw];
+        thresh = (mfcc_t) worst->score; /* Avoid int-to-float conversions */
+        obs = z;
+        for (j = 0; (j < ceplen) && (d >= thresh); ++j) {
+            diff = *obs++ - *mean++;
+            sqdiff = MFCCMUL(diff, diff);
+            compl = MFCCMUL(sqdiff, *var++);
+            d = GMMSUB(d, compl);
+        }
+        if (j < ceplen || d < thresh)
+            continue;
+        for (k = 0; k < s->max_topn; k++) {
+            /* already there, so don't need to insert */
+            if (topn[k].cw == cw)
+                break;
+        }
+        if (k < s->max_topn)
+            continue;       /* already there.  Don't insert */
+        insertion_sort_cb(&cur, worst, best, cw, (int32)d);
+    }
+
+    return best->score;
+}
+
+/**
+ * Evaluate all codewords in a codebook (or those selected by its
+ * kd-tree), with the best available code.
+ */
+static int
+ptm_mgau_eval_cb(ptm_mgau_t *s, int cb, int feat, mfcc_t *z)
+{
+    if (s->kdtrees)
+        return eval_cb_kdtree(s, cb, feat, z);
+#ifdef PTM_SIMD
+    if (s->dist_block)
+        return eval_cb_blocks(s, cb, feat, z);
+#endif
+    return eval_cb(s, cb, feat, z);
+}
+
 /**
  * Compute top-N densities for active codebooks (and prune)
  */
@@ -239,7 +636,7 @@ ptm_mgau_codebook_eval(ptm_mgau_t *s, mfcc_t **z, int frame)
             eval_topn(s, i, j, z[j]);
 
     /* If frame downsampling is in effect, possibly do nothing else. */
-    if (frame % s->ds_ratio)
+    if (tied_ds_skip(&s->ds, z[0], frame))
         return 0;
 
     /* Evaluate remaining codebooks. */
@@ -247,7 +644,7 @@ ptm_mgau_codebook_eval(ptm_mgau_t *s, mfcc_t **z, int frame)
         if (bitvec_is_clear(s->f->mgau_active, i))
             continue;
         for (j = 0; j < s->g->n_feat; ++j) {
-            eval_cb(s, i, j, z[j]);
+            ptm_mgau_eval_cb(s, i, j, z[j]);
         }
     }
     return 0;
@@ -321,81 +718,105 @@ ptm_mgau_calc_cb_active(ptm_mgau_t *s, uint8 *senone_active,
 
 /**
  * Compute senone scores from top-N densities for active codebooks.
+ *
+ * This is done one codebook at a time, for runs of its senones, which
+ * share the same top-N codewords and are together in sen_mixw, so that
+ * tied_senone_sum() can do several of them at once.  Unless all
+ * senones are wanted, the runs only cover blocks of PTM_SEN_CHUNK
+ * with active senones in them.  The others get meaningless scores,
+ * which is fine because the search does not look at them.
  */
 static int
 ptm_mgau_senone_eval(ptm_mgau_t *s, int16 *senone_scores,
                      uint8 *senone_active, int32 n_senone_active,
                      int compall)
 {
-    int i, lastsen, bestscore;
-
-    memset(senone_scores, 0, s->n_sen * sizeof(*senone_scores));
-    /* FIXME: This is the non-cache-efficient way to do this.  We want
-     * to evaluate one codeword at a time but this requires us to have
-     * a reverse codebook to senone mapping, which we don't have
-     * (yet), since different codebooks have different top-N
-     * codewords. */
-    if (compall)
-        n_senone_active = s->n_sen;
-    bestscore = 0x7fffffff;
-    for (lastsen = i = 0; i < n_senone_active; ++i) {
-        int sen, f, cb;
-        int ascore;
+    int16 *scores;
+    int i, cb, lastsen, bestscore;
+
+    scores = s->sen_order ? s->sorted_scores : senone_scores;
+    memset(scores, 0, s->n_sen * sizeof(*scores));
+    if (!compall) {
+        memset(s->chunk_active, 0,
+               (s->n_sen + PTM_SEN_CHUNK - 1) / PTM_SEN_CHUNK);
+        for (lastsen = i = 0; i < n_senone_active; ++i) {
+            int sen = senone_active[i] + lastsen;
+            int pos = s->sen_pos ? s->sen_pos[sen] : sen;
+            s->chunk_active[pos / PTM_SEN_CHUNK] = TRUE;
+            lastsen = sen;
+        }
+    }
 
-        if (compall)
-            sen = i;
-        else
-            sen = senone_active[i] + lastsen;
-        lastsen = sen;
-        cb = s->sen2cb[sen];
-
-        if (bitvec_is_clear(s->f->mgau_active, cb)) {
-            int j;
-            /* Because senone_active is deltas we can't really "knock
-             * out" senones from pruned codebooks, and in any case,
-             * it wouldn't make any difference to the search code,
-             * which doesn't expect senone_active to change. */
-            for (f = 0; f < s->g->n_feat; ++f) {
-                for (j = 0; j < s->max_topn; ++j) {
-                    s->f->topn[cb][f][j].score = MAX_NEG_ASCR;
-                }
+    for (cb = 0; cb < s->g->n_mgau; ++cb) {
+        int start = s->cb_sen[cb], end = s->cb_sen[cb + 1];
+        int run, run_end, f, j;
+
+        for (run = start; run < end; run = run_end) {
+            /* Find the next run of active blocks. */
+            if (!compall) {
+                while (run < end && !s->chunk_active[run / PTM_SEN_CHUNK])
+                    run = (run / PTM_SEN_CHUNK + 1) * PTM_SEN_CHUNK;
+                if (run >= end)
+                    break;
+                run_end = run;
+                while (run_end < end && s->chunk_active[run_end / PTM_SEN_CHUNK])
+                    run_end = (run_end / PTM_SEN_CHUNK + 1) * PTM_SEN_CHUNK;
+                if (run_end > end)
+                    run_end = end;
             }
-        }
-        /* For each feature, log-sum codeword scores + mixw to get
-         * feature density, then sum (multiply) to get ascore */
-        ascore = 0;
-        for (f = 0; f < s->g->n_feat; ++f) {
-            ptm_topn_t *topn;
-            int j, fden = 0;
-            topn = s->f->topn[cb][f];
-            for (j = 0; j < s->max_topn; ++j) {
-                int mixw;
-                /* Find mixture weight for this codeword. */
-                if (s->mixw_cb) {
-                    int dcw = s->mixw[f][topn[j].cw][sen/2];
-                    dcw = (dcw & 1) ? dcw >> 4 : dcw & 0x0f;
-                    mixw = s->mixw_cb[dcw];
+            else
+                run_end = end;
+
+            if (bitvec_is_clear(s->f->mgau_active, cb)) {
+                /* Because senone_active is deltas we can't really
+                 * "knock out" senones from pruned codebooks, and in
+                 * any case, it wouldn't make any difference to the
+                 * search code, which doesn't expect senone_active to
+                 * change. */
+                for (f = 0; f < s->g->n_feat; ++f) {
+                    for (j = 0; j < s->max_topn; ++j) {
+                        s->f->topn[cb][f][j].score = MAX_NEG_ASCR;
+                    }
                 }
-                else {
-                    mixw = s->mixw[f][topn[j].cw][sen];
+            }
+            /* For each feature, log-sum codeword scores + mixw to get
+             * feature density, then sum (multiply) to get ascore */
+            for (f = 0; f < s->g->n_feat; ++f) {
+                ptm_topn_t *topn = s->f->topn[cb][f];
+                for (j = 0; j < s->max_topn; ++j) {
+                    s->sum_mixw[j] = s->sen_mixw[f][topn[j].cw] + run;
+                    s->sum_ascr[j] = topn[j].score;
                 }
-                if (j == 0)
-                    fden = mixw + topn[j].score;
-                else
-                    fden = fast_logmath_add(s->lmath_8b, fden,
-                                       mixw + topn[j].score);
-                E_DEBUG("fden[%d][%d] l+= %d + %d = %d\n",
-                        sen, f, mixw, topn[j].score, fden);
+                tied_senone_sum(&s->logadd, s->sum_mixw, s->sum_ascr,
+                                s->max_topn, scores + run, run_end - run);
             }
-            ascore += fden;
         }
-        if (ascore < bestscore) bestscore = ascore;
-        senone_scores[sen] = ascore;
     }
+
     /* Normalize the scores again (finishing the job we started above
      * in ptm_mgau_codebook_eval...) */
-    for (i = 0; i < s->n_sen; ++i) {
-        senone_scores[i] -= bestscore;
+    bestscore = 0x7fffffff;
+    if (compall) {
+        for (i = 0; i < s->n_sen; ++i)
+            if (scores[i] < bestscore)
+                bestscore = scores[i];
+    }
+    else {
+        for (lastsen = i = 0; i < n_senone_active; ++i) {
+            int sen = senone_active[i] + lastsen;
+            int pos = s->sen_pos ? s->sen_pos[sen] : sen;
+            if (scores[pos] < bestscore)
+                bestscore = scores[pos];
+            lastsen = sen;
+        }
+    }
+    if (s->sen_order) {
+        for (i = 0; i < s->n_sen; ++i)
+            senone_scores[s->sen_order[i]] = scores[i] - bestscore;
+    }
+    else {
+        for (i = 0; i < s->n_sen; ++i)
+            senone_scores[i] -= bestscore;
     }
 
     return 0;
@@ -424,9 +845,9 @@ ptm_mgau_frame_eval(ps_mgau_t *ps,
     fast_eval_idx = frame % s->n_fast_hist;
     s->f = s->hist + fast_eval_idx;
     /* Compute the top-N codewords for every codebook, unless this
-     * is a past frame, in which case we already have them (we
-     * hope!) */
-    if (frame >= ps_mgau_base(ps)->frame_idx) {
+     * is a past frame which is still in the history, in which case
+     * we already have them. */
+    if (frame >= ps_mgau_base(ps)->frame_idx || s->f->frame != frame) {
         ptm_fast_eval_t *lastf;
         /* Get the previous frame's top-N information (on the
          * first frame of the input this is just all WORST_DIST,
@@ -444,6 +865,7 @@ ptm_mgau_frame_eval(ps_mgau_t *ps,
         /* Now evaluate top-N, prune, and evaluate remaining codebooks. */
         ptm_mgau_codebook_eval(s, featbuf, frame);
         ptm_mgau_codebook_norm(s, featbuf, frame);
+        s->f->frame = frame;
     }
     /* Evaluate intersection of active senones and active codebooks. */
     ptm_mgau_senone_eval(s, senone_scores, senone_active,
@@ -452,6 +874,57 @@ ptm_mgau_frame_eval(ps_mgau_t *ps,
     return 0;
 }
 
+int
+ptm_mgau_frame_eval_batch(ps_mgau_t *ps,
+                          int16 **senone_scores,
+                          mfcc_t ***featbuf,
+                          int32 frame,
+                          int32 n_frame)
+{
+    ptm_mgau_t *s = (ptm_mgau_t *)ps;
+    int i, j, k;
+
+    /* Each frame needs its own place in the history, and the frame
+     * before the first one has to be kept for the first one to start
+     * from. */
+    if (n_frame > s->n_fast_hist - 1)
+        n_frame = s->n_fast_hist - 1;
+    for (k = 0; k < n_frame; ++k) {
+        bitvec_set_all(s->hist[(frame + k) % s->n_fast_hist].mgau_active,
+                       s->g->n_mgau);
+        s->ds_skip[k] = tied_ds_skip(&s->ds, featbuf[k][0], frame + k);
+    }
+
+    /* This is the same as ptm_mgau_codebook_eval() for each frame in
+     * turn, except that each codebook is done for all frames at once.
+     * Each frame's top-N for a codebook only depends on the previous
+     * frame's for the same codebook, so the results are the same. */
+    for (i = 0; i < s->g->n_mgau; ++i) {
+        for (j = 0; j < s->g->n_feat; ++j) {
+            for (k = 0; k < n_frame; ++k) {
+                ptm_fast_eval_t *lastf;
+
+                lastf = s->hist + (frame + k + s->n_fast_hist - 1) % s->n_fast_hist;
+                s->f = s->hist + (frame + k) % s->n_fast_hist;
+                memcpy(s->f->topn[i][j], lastf->topn[i][j],
+                       s->max_topn * sizeof(ptm_topn_t));
+                eval_topn(s, i, j, featbuf[k][j]);
+                if (!s->ds_skip[k])
+                    ptm_mgau_eval_cb(s, i, j, featbuf[k][j]);
+            }
+        }
+    }
+
+    for (k = 0; k < n_frame; ++k) {
+        s->f = s->hist + (frame + k) % s->n_fast_hist;
+        s->f->frame = frame + k;
+        ptm_mgau_codebook_norm(s, featbuf[k], frame + k);
+        ptm_mgau_senone_eval(s, senone_scores[k], NULL, 0, TRUE);
+    }
+
+    return n_frame;
+}
+
 static int32
 read_sendump(ptm_mgau_t *s, bin_mdef_t *mdef, char const *file)
 {
@@ -765,6 +1238,140 @@ read_mixw(ptm_mgau_t * s, char const *file_name, double SmoothMin)
     return n_sen;
 }
 
+/**
+ * Arrange the mixture weights so that the senones of each codebook
+ * are together, for tied_senone_sum().  Usually they already are, in
+ * which case the mixture weights are used as they are, unless they
+ * are 4-bit ones, which are expanded.
+ */
+static void
+ptm_mgau_sort_senones(ptm_mgau_t *s)
+{
+    int32 *next;
+    int n_mgau = s->g->n_mgau;
+    int sorted, i, f, d;
+
+    s->cb_sen = ckd_calloc(n_mgau + 1, sizeof(*s->cb_sen));
+    for (i = 0; i < s->n_sen; ++i)
+        ++s->cb_sen[s->sen2cb[i] + 1];
+    for (i = 0; i < n_mgau; ++i)
+        s->cb_sen[i + 1] += s->cb_sen[i];
+    for (sorted = TRUE, i = 1; i < s->n_sen; ++i)
+        if (s->sen2cb[i] < s->sen2cb[i - 1])
+            sorted = FALSE;
+    if (sorted && s->mixw_cb == NULL) {
+        s->sen_mixw = s->mixw;
+        return;
+    }
+
+    if (!sorted) {
+        E_INFO("Sorting senones by codebook\n");
+        next = ckd_calloc(n_mgau, sizeof(*next));
+        memcpy(next, s->cb_sen, n_mgau * sizeof(*next));
+        s->sen_order = ckd_calloc(s->n_sen, sizeof(*s->sen_order));
+        s->sen_pos = ckd_calloc(s->n_sen, sizeof(*s->sen_pos));
+        for (i = 0; i < s->n_sen; ++i) {
+            int pos = next[s->sen2cb[i]]++;
+            s->sen_order[pos] = i;
+            s->sen_pos[i] = pos;
+        }
+        ckd_free(next);
+    }
+    s->sen_mixw = ckd_calloc_3d(s->g->n_feat, s->g->n_density, s->n_sen,
+                                sizeof(***s->sen_mixw));
+    for (f = 0; f < s->g->n_feat; ++f) {
+        for (d = 0; d < s->g->n_density; ++d) {
+            for (i = 0; i < s->n_sen; ++i) {
+                int w;
+                if (s->mixw_cb) {
+                    w = s->mixw[f][d][i / 2];
+                    w = s->mixw_cb[(i & 1) ? w >> 4 : w & 0x0f];
+                }
+                else
+                    w = s->mixw[f][d][i];
+                s->sen_mixw[f][d][s->sen_pos ? s->sen_pos[i] : i] = w;
+            }
+        }
+    }
+}
+
+/**
+ * Verify n_feat and veclen against acmod.
+ */
+static int
+ptm_mgau_check_feat(gauden_t *g, acmod_t *acmod)
+{
+    int i;
+
+    if (g->n_feat != feat_dimension1(acmod->fcb)) {
+        E_ERROR("Number of streams does not match: %d != %d\n",
+                g->n_feat, feat_dimension1(acmod->fcb));
+        return -1;
+    }
+    for (i = 0; i < g->n_feat; ++i) {
+        if (g->featlen[i] != feat_dimension2(acmod->fcb, i)) {
+            E_ERROR("Dimension of stream %d does not match: %d != %d\n",
+                    i, g->featlen[i], feat_dimension2(acmod->fcb, i));
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Set up the scoring state, which is separate for each decoder even
+ * when the parameters are shared.
+ */
+static void
+ptm_mgau_init_state(ptm_mgau_t *s, cmd_ln_t *config)
+{
+    int i;
+
+    tied_ds_init(&s->ds, config, s->g->featlen[0]);
+    s->max_topn = cmd_ln_int32_r(config, "-topn");
+    E_INFO("Maximum top-N: %d\n", s->max_topn);
+    ptm_mgau_select_backend(s);
+    E_INFO("Codebook evaluation: %s\n", s->eval_backend);
+    tied_logadd_init(&s->logadd, s->lmath_8b);
+    E_INFO("Senone scoring: %s\n", s->logadd.backend);
+    if (s->sen_order)
+        s->sorted_scores = ckd_calloc(s->n_sen, sizeof(*s->sorted_scores));
+    s->chunk_active = ckd_calloc((s->n_sen + PTM_SEN_CHUNK - 1) / PTM_SEN_CHUNK,
+                                 sizeof(*s->chunk_active));
+    s->sum_mixw = ckd_calloc(s->max_topn, sizeof(*s->sum_mixw));
+    s->sum_ascr = ckd_calloc(s->max_topn, sizeof(*s->sum_ascr));
+
+    /* Allocate fast-match history buffers.  We need enough for the
+     * phoneme lookahead window, plus the current frame, plus one for
+     * good measure? (FIXME: I don't remember why) */
+    s->n_fast_hist = cmd_ln_int32_r(config, "-pl_window") + 2;
+    s->hist = ckd_calloc(s->n_fast_hist, sizeof(*s->hist));
+    s->ds_skip = ckd_calloc(s->n_fast_hist, sizeof(*s->ds_skip));
+    /* s->f will be a rotating pointer into s->hist. */
+    s->f = s->hist;
+    for (i = 0; i < s->n_fast_hist; ++i) {
+        int j, k, m;
+        /* Top-N codewords for every codebook and feature. */
+        s->hist[i].topn = ckd_calloc_3d(s->g->n_mgau, s->g->n_feat,
+                                        s->max_topn, sizeof(ptm_topn_t));
+        /* Initialize them to sane (yet arbitrary) defaults. */
+        for (j = 0; j < s->g->n_mgau; ++j) {
+            for (k = 0; k < s->g->n_feat; ++k) {
+                for (m = 0; m < s->max_topn; ++m) {
+                    s->hist[i].topn[j][k][m].cw = m;
+                    s->hist[i].topn[j][k][m].score = WORST_DIST;
+                }
+            }
+        }
+        /* Active codebook mapping (just codebook, not features,
+           at least not yet) */
+        s->hist[i].mgau_active = bitvec_alloc(s->g->n_mgau);
+        /* Start with them all on, prune them later. */
+        bitvec_set_all(s->hist[i].mgau_active, s->g->n_mgau);
+        s->hist[i].frame = -1;
+    }
+}
+
 ps_mgau_t *
 ptm_mgau_init(acmod_t *acmod, bin_mdef_t *mdef)
 {
@@ -774,7 +1381,8 @@ ptm_mgau_init(acmod_t *acmod, bin_mdef_t *mdef)
     int i;
 
     s = ckd_calloc(1, sizeof(*s));
-    s->config = acmod->config;
+    s->refcount = 1;
+    s->config = cmd_ln_retain(acmod->config);
 
     s->lmath = logmath_retain(acmod->lmath);
     /* Log-add table. */
@@ -807,19 +1415,8 @@ ptm_mgau_init(acmod_t *acmod, bin_mdef_t *mdef)
         E_INFO("Number of codebooks doesn't match number of ciphones, doesn't look like PTM: %d != %d\n", s->g->n_mgau, bin_mdef_n_ciphone(mdef));
         goto error_out;
     }
-    /* Verify n_feat and veclen, against acmod. */
-    if (s->g->n_feat != feat_dimension1(acmod->fcb)) {
-        E_ERROR("Number of streams does not match: %d != %d\n",
-                s->g->n_feat, feat_dimension1(acmod->fcb));
+    if (ptm_mgau_check_feat(s->g, acmod) < 0)
         goto error_out;
-    }
-    for (i = 0; i < s->g->n_feat; ++i) {
-        if (s->g->featlen[i] != feat_dimension2(acmod->fcb, i)) {
-            E_ERROR("Dimension of stream %d does not match: %d != %d\n",
-                    s->g->featlen[i], feat_dimension2(acmod->fcb, i));
-            goto error_out;
-        }
-    }
     /* Read mixture weights. */
     if ((sendump_path = cmd_ln_str_r(s->config, "_sendump"))) {
         if (read_sendump(s, acmod->mdef, sendump_path) < 0) {
@@ -832,43 +1429,24 @@ ptm_mgau_init(acmod_t *acmod, bin_mdef_t *mdef)
             goto error_out;
         }
     }
-    s->ds_ratio = cmd_ln_int32_r(s->config, "-ds");
-    s->max_topn = cmd_ln_int32_r(s->config, "-topn");
-    E_INFO("Maximum top-N: %d\n", s->max_topn);
+    /* Read kd-trees for Gaussian preselection, if any. */
+    if (cmd_ln_str_r(s->config, "_kdtree")) {
+        if ((s->kdtrees = kd_trees_read(cmd_ln_str_r(s->config, "_kdtree"),
+                                        s->g,
+                                        cmd_ln_int32_r(s->config, "-kdmaxdepth"),
+                                        cmd_ln_int32_r(s->config, "-kdmaxbbi")))
+            == NULL)
+            goto error_out;
+    }
 
     /* Assume mapping of senones to their base phones, though this
      * will become more flexible in the future. */
     s->sen2cb = ckd_calloc(s->n_sen, sizeof(*s->sen2cb));
     for (i = 0; i < s->n_sen; ++i)
         s->sen2cb[i] = bin_mdef_sen2cimap(acmod->mdef, i);
+    ptm_mgau_sort_senones(s);
 
-    /* Allocate fast-match history buffers.  We need enough for the
-     * phoneme lookahead window, plus the current frame, plus one for
-     * good measure? (FIXME: I don't remember why) */
-    s->n_fast_hist = cmd_ln_int32_r(s->config, "-pl_window") + 2;
-    s->hist = ckd_calloc(s->n_fast_hist, sizeof(*s->hist));
-    /* s->f will be a rotating pointer into s->hist. */
-    s->f = s->hist;
-    for (i = 0; i < s->n_fast_hist; ++i) {
-        int j, k, m;
-        /* Top-N codewords for every codebook and feature. */
-        s->hist[i].topn = ckd_calloc_3d(s->g->n_mgau, s->g->n_feat,
-                                        s->max_topn, sizeof(ptm_topn_t));
-        /* Initialize them to sane (yet arbitrary) defaults. */
-        for (j = 0; j < s->g->n_mgau; ++j) {
-            for (k = 0; k < s->g->n_feat; ++k) {
-                for (m = 0; m < s->max_topn; ++m) {
-                    s->hist[i].topn[j][k][m].cw = m;
-                    s->hist[i].topn[j][k][m].score = WORST_DIST;
-                }
-            }
-        }
-        /* Active codebook mapping (just codebook, not features,
-           at least not yet) */
-        s->hist[i].mgau_active = bitvec_alloc(s->g->n_mgau);
-        /* Start with them all on, prune them later. */
-        bitvec_set_all(s->hist[i].mgau_active, s->g->n_mgau);
-    }
+    ptm_mgau_init_state(s, s->config);
 
     ps = (ps_mgau_t *)s;
     ps->vt = &ptm_mgau_funcs;
@@ -878,37 +1456,184 @@ error_out:
     return NULL;
 }
 
+ps_mgau_t *
+ptm_mgau_share(ps_mgau_t *ps, acmod_t *acmod)
+{
+    ptm_mgau_t *from = (ptm_mgau_t *)ps;
+    ptm_mgau_t *share, *s;
+
+    if (ptm_mgau_check_feat(from->g, acmod) < 0)
+        return NULL;
+    /* Always refer to the original, which owns the mixture weights. */
+    share = from->share ? from->share : from;
+
+    s = ckd_calloc(1, sizeof(*s));
+    s->share = share;
+    ++share->refcount;
+    s->config = cmd_ln_retain(share->config);
+    s->lmath = logmath_retain(share->lmath);
+    s->lmath_8b = logmath_retain(share->lmath_8b);
+    s->g = gauden_retain(from->g);
+    s->n_sen = share->n_sen;
+    s->sen2cb = share->sen2cb;
+    s->mixw = share->mixw;
+    s->mixw_cb = share->mixw_cb;
+    s->sen_mixw = share->sen_mixw;
+    s->cb_sen = share->cb_sen;
+    s->sen_order = share->sen_order;
+    s->sen_pos = share->sen_pos;
+    s->kdtrees = share->kdtrees;
+    ptm_mgau_init_state(s, acmod->config);
+
+    ps = (ps_mgau_t *)s;
+    ps->vt = &ptm_mgau_funcs;
+    return ps;
+}
+
 int
 ptm_mgau_mllr_transform(ps_mgau_t *ps,
                             ps_mllr_t *mllr)
 {
     ptm_mgau_t *s = (ptm_mgau_t *)ps;
-    return gauden_mllr_transform(s->g, mllr, s->config);
+    gauden_t *g;
+    int rv;
+
+    /* Other decoders may be using the same codebooks. */
+    if ((g = gauden_unshare(s->g, s->config)) == NULL)
+        return -1;
+    s->g = g;
+    rv = gauden_mllr_transform(s->g, mllr, s->config);
+#ifdef PTM_SIMD
+    if (s->cb_blocks)
+        ptm_mgau_pack_codebooks(s);
+#endif
+    return rv;
+}
+
+int
+ptm_mgau_nearest(ps_mgau_t *ps, int32 senone, int32 feat,
+                 mfcc_t const *obs, float32 *out_mean, float32 *out_ivar)
+{
+    ptm_mgau_t *s = (ptm_mgau_t *)ps;
+
+    if (gauden_nearest(s->g, s->sen2cb[senone], feat, obs,
+                       out_mean, out_ivar) < 0)
+        return -1;
+    return 0;
 }
 
 void
-ptm_mgau_free(ps_mgau_t *ps)
+ptm_mgau_mem(ps_mgau_t *ps, ps_mem_t *out_mem)
 {
-    int i;
     ptm_mgau_t *s = (ptm_mgau_t *)ps;
+    ptm_mgau_t *owner = s->share ? s->share : s;
+    size_t mixw, params, veclen;
+    int i;
 
-    logmath_free(s->lmath);
-    logmath_free(s->lmath_8b);
+    /* Scoring state. */
+    out_mem->heap += sizeof(*s)
+        + s->n_fast_hist * (sizeof(*s->hist)
+                            + s->g->n_mgau * s->g->n_feat * s->max_topn
+                            * sizeof(ptm_topn_t)
+                            + bitvec_size(s->g->n_mgau) * sizeof(bitvec_t))
+        + (s->n_sen + PTM_SEN_CHUNK - 1) / PTM_SEN_CHUNK
+        * sizeof(*s->chunk_active)
+        + s->max_topn * (sizeof(*s->sum_mixw) + sizeof(*s->sum_ascr));
+    if (s->sorted_scores)
+        out_mem->heap += s->n_sen * sizeof(*s->sorted_scores);
+    if (s->cb_blocks) {
+        for (i = 0, veclen = 0; i < s->g->n_feat; ++i)
+            veclen += PTM_BLOCK_SIZE(s->g->featlen[i]);
+        out_mem->heap += s->g->n_mgau * veclen
+            * ((s->g->n_density + PTM_BLOCK - 1) / PTM_BLOCK)
+            * sizeof(mfcc_t);
+    }
+
+    /* Codebooks may be shared, or copied for adaptation. */
+    ps_mem_add_heap(out_mem, gauden_mem_size(s->g), s->g->refcount > 1);
+
+    /* Mixture weights and senone mappings belong to the original. */
+    mixw = (size_t)s->g->n_feat * s->g->n_density * s->n_sen;
+    params = s->n_sen * sizeof(*s->sen2cb)
+        + (s->g->n_mgau + 1) * sizeof(*owner->cb_sen);
+    if (owner->sen_order)
+        params += 2 * s->n_sen * sizeof(*owner->sen_order);
+    if (owner->sen_mixw && owner->sen_mixw != owner->mixw)
+        params += mixw;
+    if (owner->sendump_mmap) {
+        /* 4-bit weights are packed two to a byte in the file. */
+        out_mem->mapped += owner->mixw_cb ? (mixw + 1) / 2 : mixw;
+        params += s->g->n_feat * s->g->n_density * sizeof(uint8 *);
+    }
+    else
+        params += mixw;
+    ps_mem_add_heap(out_mem, params, s->share || s->refcount > 1);
+}
+
+/**
+ * Release a reference to the parameters owned by s, freeing them and
+ * s itself if it was the last one.
+ */
+static void
+ptm_mgau_release(ptm_mgau_t *s)
+{
+    if (--s->refcount > 0)
+        return;
+    if (s->sen_mixw && s->sen_mixw != s->mixw)
+        ckd_free_3d(s->sen_mixw);
     if (s->sendump_mmap) {
         ckd_free_2d(s->mixw); 
         mmio_file_unmap(s->sendump_mmap);
     }
     else {
         ckd_free_3d(s->mixw);
+        ckd_free(s->mixw_cb);
     }
+    ckd_free(s->cb_sen);
+    ckd_free(s->sen_order);
+    ckd_free(s->sen_pos);
     ckd_free(s->sen2cb);
-    
+    if (s->kdtrees)
+        kd_trees_free(s->kdtrees, s->g->n_mgau * s->g->n_feat);
+    gauden_free(s->g);
+    cmd_ln_free_r(s->config);
+    ckd_free(s);
+}
+
+void
+ptm_mgau_free(ps_mgau_t *ps)
+{
+    int i;
+    ptm_mgau_t *s = (ptm_mgau_t *)ps;
+
+    logmath_free(s->lmath);
+    logmath_free(s->lmath_8b);
     for (i = 0; i < s->n_fast_hist; i++) {
 	ckd_free_3d(s->hist[i].topn);
 	bitvec_free(s->hist[i].mgau_active);
     }
     ckd_free(s->hist);
-    
-    gauden_free(s->g);
-    ckd_free(s);
+    s->hist = NULL;
+    s->n_fast_hist = 0;
+    ckd_free(s->ds_skip);
+    tied_ds_free(&s->ds);
+    ckd_free(s->sorted_scores);
+    ckd_free(s->chunk_active);
+    ckd_free(s->sum_mixw);
+    ckd_free(s->sum_ascr);
+    if (s->cb_blocks) {
+        ckd_free(s->cb_blocks[0][0]);
+        ckd_free_2d(s->cb_blocks);
+        s->cb_blocks = NULL;
+    }
+
+    /* The original keeps its parameters until the last copy is gone. */
+    if (s->share) {
+        gauden_free(s->g);
+        cmd_ln_free_r(s->config);
+        ptm_mgau_release(s->share);
+        ckd_free(s);
+    }
+    else
+        ptm_mgau_release(s);
 }
@@ -52,6 +52,8 @@
 #include "hmm.h"
 #include "bin_mdef.h"
 #include "ms_gauden.h"
+#include "kdtree.h"
+#include "tied_mgau_common.h"
 
 typedef struct ptm_mgau_s ptm_mgau_t;
 
@@ -63,6 +65,7 @@ typedef struct ptm_topn_s {
 typedef struct ptm_fast_eval_s {
     ptm_topn_t ***topn;     /**< Top-N for each codebook (mgau x feature x topn) */
     bitvec_t *mgau_active; /**< Set of active codebooks */
+    int32 frame;            /**< Frame this was computed for, or -1 */
 } ptm_fast_eval_t;
 
 struct ptm_mgau_s {
@@ -75,19 +78,48 @@ struct ptm_mgau_s {
     mmio_file_t *sendump_mmap;/* Memory map for mixw (or NULL if not mmap) */
     uint8 *mixw_cb;    /* Mixture weight codebook, if any (assume it contains 16 values) */
     int16 max_topn;
-    int16 ds_ratio;
+    tied_ds_t ds;       /**< Frame downsampling of codebook evaluation. */
+    uint8 *ds_skip;     /**< Downsampling decision for each batch frame. */
 
     ptm_fast_eval_t *hist;   /**< Fast evaluation info for past frames. */
     ptm_fast_eval_t *f;      /**< Fast eval info for current frame. */
     int n_fast_hist;         /**< Number of past frames tracked. */
 
+    /* Codebooks interleaved for vectorized evaluation (see
+     * ptm_mgau_pack_codebooks()), or NULL. */
+    mfcc_t ***cb_blocks;
+    /* Distance kernel for a block of codewords, or NULL for scalar code. */
+    int (*dist_block)(mfcc_t const *blk, mfcc_t const *obs, int ceplen,
+                      mfcc_t thresh, mfcc_t *out);
+    char const *eval_backend; /**< Name of the codebook evaluation code. */
+    kd_tree_t **kdtrees;      /**< kd-trees for Gaussian preselection, or NULL. */
+
+    /* Mixture weights with the senones of each codebook together, for
+     * tied_senone_sum() (see ptm_mgau_sort_senones()). */
+    uint8 ***sen_mixw;  /**< By feature, codeword, sorted senone (may be mixw). */
+    int32 *cb_sen;      /**< First sorted senone of each codebook, and the end. */
+    int32 *sen_order;   /**< Senone at each sorted position, or NULL if in order. */
+    int32 *sen_pos;     /**< Sorted position of each senone, or NULL if in order. */
+    tied_logadd_t logadd;     /**< Senone scoring code and table. */
+    int16 *sorted_scores;     /**< Scores in sorted order, if not in order. */
+    uint8 *chunk_active;      /**< Blocks of sorted senones with active ones. */
+    uint8 const **sum_mixw;   /**< Mixture weights for each top-N codeword. */
+    int32 *sum_ascr;          /**< Scores of each top-N codeword. */
+
     /* Log-add table for compressed values. */
     logmath_t *lmath_8b;
     /* Log-add object for reloading means/variances. */
     logmath_t *lmath;
+
+    /* Copies made with ptm_mgau_share() point to the original, which
+     * owns sen2cb, mixw, sen_mixw and its mappings, and kdtrees, and
+     * stays allocated until it and all of its copies have been freed. */
+    ptm_mgau_t *share;       /**< Original model, or NULL if this is one. */
+    int refcount;            /**< References to the original's parameters. */
 };
 
 ps_mgau_t *ptm_mgau_init(acmod_t *acmod, bin_mdef_t *mdef);
+ps_mgau_t *ptm_mgau_share(ps_mgau_t *s, acmod_t *acmod);
 void ptm_mgau_free(ps_mgau_t *s);
 int ptm_mgau_frame_eval(ps_mgau_t *s,
                         int16 *senone_scores,
@@ -96,8 +128,17 @@ int ptm_mgau_frame_eval(ps_mgau_t *s,
                         mfcc_t **featbuf,
                         int32 frame,
                         int32 compallsen);
+int ptm_mgau_frame_eval_batch(ps_mgau_t *s,
+                              int16 **senone_scores,
+                              mfcc_t ***featbuf,
+                              int32 frame,
+                              int32 n_frame);
 int ptm_mgau_mllr_transform(ps_mgau_t *s,
                             ps_mllr_t *mllr);
+int ptm_mgau_nearest(ps_mgau_t *s, int32 senone, int32 feat,
+                     mfcc_t const *obs, float32 *out_mean,
+                     float32 *out_ivar);
+void ptm_mgau_mem(ps_mgau_t *s, ps_mem_t *out_mem);
 
 
 #endif /*  __PTM_MGAU_H__ */
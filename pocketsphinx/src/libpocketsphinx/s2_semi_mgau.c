@@ -60,11 +60,19 @@
 #include "s2_semi_mgau.h"
 #include "tied_mgau_common.h"
 
+/* Senones are scored in blocks of this many, see get_scores_8b_feat(). */
+#define S2_SEN_CHUNK 8
+
 static ps_mgaufuncs_t s2_semi_mgau_funcs = {
     "s2_semi",
     s2_semi_mgau_frame_eval,      /* frame_eval */
+    s2_semi_mgau_frame_eval_batch, /* frame_eval_batch */
     s2_semi_mgau_mllr_transform,  /* transform */
-    s2_semi_mgau_free             /* free */
+    s2_semi_mgau_share,           /* share */
+    s2_semi_mgau_free,            /* free */
+    PS_MGAU_NORM_NONE,            /* norm */
+    NULL,                         /* nearest */
+    s2_semi_mgau_mem              /* mem */
 };
 
 struct vqFeature_s {
@@ -168,17 +176,164 @@ eval_cb(s2_semi_mgau_t *s, int32 feat, mfcc_t *z)
     }
 }
 
+/* Same as eval_cb(), but only for the Gaussians in the kd-tree leaf. */
+static void
+eval_cb_kdtree(s2_semi_mgau_t *s, int32 feat, mfcc_t *z)
+{
+    vqFeature_t *worst, *best, *topn;
+    uint16 const *bbi;
+    int32 i, n_bbi, ceplen;
+
+    best = topn = s->f[feat];
+    worst = topn + (s->max_topn - 1);
+    ceplen = s->g->featlen[feat];
+    bbi = kd_tree_eval(s->kdtrees[feat], z, &n_bbi);
+
+    for (i = 0; i < n_bbi; ++i) {
+        mfcc_t *mean, diff, sqdiff, compl; /* diff, diff^2, component likelihood */
+        mfcc_t *var, d;
+        mfcc_t *obs;
+        vqFeature_t *cur;
+        int32 cw, j, k;
+
+        cw = bbi[i];
+        mean = s->g->mean[0][feat][0] + cw * ceplen;
+        var = s->g->var[0][feat][0] + cw * ceplen;
+        d = s->g->det[0][feat][cw];
+        obs = z;
+        for (j = 0; (j < ceplen) && (d >= worst->score); ++j) {
+            diff = *obs++ - *mean++;
+            sqdiff = MFCCMUL(diff, diff);
+            compl = MFCCMUL(sqdiff, *var);
+            d = GMMSUB(d, compl);
+            ++var;
+        }
+        if (j < ceplen)
+            continue;
+        if ((int32)d < worst->score)
+            continue;
+        for (k = 0; k < s->max_topn; k++) {
+            /* already there, so don't need to insert */
+            if (topn[k].codeword == cw)
+                break;
+        }
+        if (k < s->max_topn)
+            continue;       /* already there.  Don't insert */
+        /* remaining code inserts codeword and dist in correct spot */
+        for (cur = worst - 1; cur >= best && (int32)d >= cur->score; --cur)
+            memcpy(cur + 1, cur, sizeof(vqFeature_t));
+        ++cur;
+        cur->codeword = cw;
+        cur->score = (int32)d;
+    }
+}
+
+/*
+ * Evaluate one codeword, and insert it in the top-N if it belongs
+ * there.  It must not be there already.
+ *
+ * Returns TRUE if it was inserted.
+ */
+static int
+eval_cw(s2_semi_mgau_t *s, int32 feat, mfcc_t *z, int32 cw)
+{
+    vqFeature_t *worst, *best, *cur;
+    mfcc_t *mean, *var, *obs, diff, sqdiff, compl, d;
+    int32 j, ceplen;
+
+    best = s->f[feat];
+    worst = best + (s->max_topn - 1);
+    ceplen = s->g->featlen[feat];
+    mean = s->g->mean[0][feat][0] + cw * ceplen;
+    var = s->g->var[0][feat][0] + cw * ceplen;
+    d = s->g->det[0][feat][cw];
+    obs = z;
+    for (j = 0; (j < ceplen) && (d >= worst->score); ++j) {
+        diff = *obs++ - *mean++;
+        sqdiff = MFCCMUL(diff, diff);
+        compl = MFCCMUL(sqdiff, *var);
+        d = GMMSUB(d, compl);
+        ++var;
+    }
+    if (j < ceplen || (int32)d < worst->score)
+        return FALSE;
+    for (cur = worst - 1; cur >= best && (int32)d >= cur->score; --cur)
+        memcpy(cur + 1, cur, sizeof(vqFeature_t));
+    ++cur;
+    cur->codeword = cw;
+    cur->score = (int32)d;
+    return TRUE;
+}
+
+/*
+ * Same as eval_cb(), but only for the nearest codewords to those in
+ * the top-N, and to the ones which get into it in turn, until it stops
+ * changing.
+ *
+ * Returns FALSE if this would evaluate most of the codebook anyway,
+ * in which case the rest of it should be.
+ */
+static int
+eval_cb_nbr(s2_semi_mgau_t *s, int32 feat, mfcc_t *z)
+{
+    vqFeature_t *topn = s->f[feat];
+    int32 i, k, n_eval, changed;
+
+    /* Start a new search, clearing the marks when they wrap around. */
+    if (++s->cb_search == 0) {
+        memset(s->cb_seen, 0, s->g->n_density * sizeof(*s->cb_seen));
+        memset(s->cb_expanded, 0, s->g->n_density * sizeof(*s->cb_expanded));
+        s->cb_search = 1;
+    }
+    /* eval_topn() has already done the previous frame's top-N. */
+    for (i = 0; i < s->max_topn; ++i)
+        s->cb_seen[topn[i].codeword] = s->cb_search;
+
+    n_eval = 0;
+    do {
+        changed = FALSE;
+        for (i = 0; i < s->max_topn; ++i) {
+            uint16 const *nbr;
+            int32 cw = topn[i].codeword;
+
+            if (s->cb_expanded[cw] == s->cb_search)
+                continue;
+            s->cb_expanded[cw] = s->cb_search;
+            nbr = s->cb_nbr[feat] + cw * s->n_cb_nbr;
+            for (k = 0; k < s->n_cb_nbr; ++k) {
+                if (s->cb_seen[nbr[k]] == s->cb_search)
+                    continue;
+                s->cb_seen[nbr[k]] = s->cb_search;
+                if (++n_eval > s->g->n_density / 2)
+                    return FALSE;
+                if (eval_cw(s, feat, z, nbr[k]))
+                    changed = TRUE;
+            }
+        }
+    } while (changed);
+    s->n_cb_nbr_eval += n_eval;
+    return TRUE;
+}
+
 static void
-mgau_dist(s2_semi_mgau_t * s, int32 frame, int32 feat, mfcc_t * z)
+mgau_dist(s2_semi_mgau_t * s, int skip, int seeded, int32 feat, mfcc_t * z)
 {
     eval_topn(s, feat, z);
 
     /* If this frame is skipped, do nothing else. */
-    if (frame % s->ds_ratio)
+    if (skip)
         return;
 
     /* Evaluate the rest of the codebook (or subset thereof). */
-    eval_cb(s, feat, z);
+    if (s->kdtrees)
+        eval_cb_kdtree(s, feat, z);
+    else if (s->cb_nbr && seeded && eval_cb_nbr(s, feat, z))
+        ++s->n_cb_nbr_search;
+    else {
+        if (s->cb_nbr)
+            ++s->n_cb_full_search;
+        eval_cb(s, feat, z);
+    }
 }
 
 static int
@@ -201,244 +356,59 @@ mgau_norm(s2_semi_mgau_t *s, int feat)
     return j;
 }
 
-static int32
-get_scores_8b_feat_6(s2_semi_mgau_t * s, int i,
-                     int16 *senone_scores, uint8 *senone_active,
-                     int32 n_senone_active)
-{
-    int32 j, l;
-    uint8 *pid_cw0, *pid_cw1, *pid_cw2, *pid_cw3, *pid_cw4, *pid_cw5;
-
-    pid_cw0 = s->mixw[i][s->f[i][0].codeword];
-    pid_cw1 = s->mixw[i][s->f[i][1].codeword];
-    pid_cw2 = s->mixw[i][s->f[i][2].codeword];
-    pid_cw3 = s->mixw[i][s->f[i][3].codeword];
-    pid_cw4 = s->mixw[i][s->f[i][4].codeword];
-    pid_cw5 = s->mixw[i][s->f[i][5].codeword];
-
-    for (l = j = 0; j < n_senone_active; j++) {
-        int sen = senone_active[j] + l;
-        int32 tmp = pid_cw0[sen] + s->f[i][0].score;
-
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw1[sen] + s->f[i][1].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw2[sen] + s->f[i][2].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw3[sen] + s->f[i][3].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw4[sen] + s->f[i][4].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw5[sen] + s->f[i][5].score);
-
-        senone_scores[sen] += tmp;
-        l = sen;
-    }
-    return 0;
-}
-
-static int32
-get_scores_8b_feat_5(s2_semi_mgau_t * s, int i,
-                     int16 *senone_scores, uint8 *senone_active,
-                     int32 n_senone_active)
-{
-    int32 j, l;
-    uint8 *pid_cw0, *pid_cw1, *pid_cw2, *pid_cw3, *pid_cw4;
-
-    pid_cw0 = s->mixw[i][s->f[i][0].codeword];
-    pid_cw1 = s->mixw[i][s->f[i][1].codeword];
-    pid_cw2 = s->mixw[i][s->f[i][2].codeword];
-    pid_cw3 = s->mixw[i][s->f[i][3].codeword];
-    pid_cw4 = s->mixw[i][s->f[i][4].codeword];
-
-    for (l = j = 0; j < n_senone_active; j++) {
-        int sen = senone_active[j] + l;
-        int32 tmp = pid_cw0[sen] + s->f[i][0].score;
-
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw1[sen] + s->f[i][1].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw2[sen] + s->f[i][2].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw3[sen] + s->f[i][3].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw4[sen] + s->f[i][4].score);
-
-        senone_scores[sen] += tmp;
-        l = sen;
-    }
-    return 0;
-}
-
-static int32
-get_scores_8b_feat_4(s2_semi_mgau_t * s, int i,
-                     int16 *senone_scores, uint8 *senone_active,
-                     int32 n_senone_active)
-{
-    int32 j, l;
-    uint8 *pid_cw0, *pid_cw1, *pid_cw2, *pid_cw3;
-
-    pid_cw0 = s->mixw[i][s->f[i][0].codeword];
-    pid_cw1 = s->mixw[i][s->f[i][1].codeword];
-    pid_cw2 = s->mixw[i][s->f[i][2].codeword];
-    pid_cw3 = s->mixw[i][s->f[i][3].codeword];
-
-    for (l = j = 0; j < n_senone_active; j++) {
-        int sen = senone_active[j] + l;
-        int32 tmp = pid_cw0[sen] + s->f[i][0].score;
-
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw1[sen] + s->f[i][1].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw2[sen] + s->f[i][2].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw3[sen] + s->f[i][3].score);
-
-        senone_scores[sen] += tmp;
-        l = sen;
-    }
-    return 0;
-}
-
-static int32
-get_scores_8b_feat_3(s2_semi_mgau_t * s, int i,
-                     int16 *senone_scores, uint8 *senone_active,
-                     int32 n_senone_active)
+/* Score the senones from start to end with tied_senone_sum(). */
+static void
+get_scores_8b_run(s2_semi_mgau_t * s, int i, int topn,
+                  int16 *senone_scores, int start, int end)
 {
-    int32 j, l;
-    uint8 *pid_cw0, *pid_cw1, *pid_cw2;
-
-    pid_cw0 = s->mixw[i][s->f[i][0].codeword];
-    pid_cw1 = s->mixw[i][s->f[i][1].codeword];
-    pid_cw2 = s->mixw[i][s->f[i][2].codeword];
+    int k;
 
-    for (l = j = 0; j < n_senone_active; j++) {
-        int sen = senone_active[j] + l;
-        int32 tmp = pid_cw0[sen] + s->f[i][0].score;
-
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw1[sen] + s->f[i][1].score);
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw2[sen] + s->f[i][2].score);
-
-        senone_scores[sen] += tmp;
-        l = sen;
+    for (k = 0; k < topn; ++k) {
+        s->sum_mixw[k] = s->mixw[i][s->f[i][k].codeword] + start;
+        s->sum_ascr[k] = s->f[i][k].score;
     }
-    return 0;
+    tied_senone_sum(&s->logadd, s->sum_mixw, s->sum_ascr, topn,
+                    senone_scores + start, end - start);
 }
 
+/*
+ * Compute scores for the active senones.  These are done in runs of
+ * whole blocks of S2_SEN_CHUNK senones with active ones in them, so
+ * that tied_senone_sum() can do several at once.  The inactive ones
+ * in these blocks get scores too, which the search never looks at.
+ */
 static int32
-get_scores_8b_feat_2(s2_semi_mgau_t * s, int i,
-                     int16 *senone_scores, uint8 *senone_active,
-                     int32 n_senone_active)
+get_scores_8b_feat(s2_semi_mgau_t * s, int i, int topn,
+                   int16 *senone_scores, uint8 *senone_active, int32 n_senone_active)
 {
-    int32 j, l;
-    uint8 *pid_cw0, *pid_cw1;
-
-    pid_cw0 = s->mixw[i][s->f[i][0].codeword];
-    pid_cw1 = s->mixw[i][s->f[i][1].codeword];
+    int32 j, l, start, end;
 
+    start = end = 0;
     for (l = j = 0; j < n_senone_active; j++) {
         int sen = senone_active[j] + l;
-        int32 tmp = pid_cw0[sen] + s->f[i][0].score;
-
-        tmp = fast_logmath_add(s->lmath_8b, tmp,
-                               pid_cw1[sen] + s->f[i][1].score);
+        int block = sen / S2_SEN_CHUNK * S2_SEN_CHUNK;
 
-        senone_scores[sen] += tmp;
         l = sen;
-    }
-    return 0;
-}
-
-static int32
-get_scores_8b_feat_1(s2_semi_mgau_t * s, int i,
-                     int16 *senone_scores, uint8 *senone_active,
-                     int32 n_senone_active)
-{
-    int32 j, l;
-    uint8 *pid_cw0;
-
-    pid_cw0 = s->mixw[i][s->f[i][0].codeword];
-    for (l = j = 0; j < n_senone_active; j++) {
-        int sen = senone_active[j] + l;
-        int32 tmp = pid_cw0[sen] + s->f[i][0].score;
-        senone_scores[sen] += tmp;
-        l = sen;
-    }
-    return 0;
-}
-
-static int32
-get_scores_8b_feat_any(s2_semi_mgau_t * s, int i, int topn,
-                       int16 *senone_scores, uint8 *senone_active,
-                       int32 n_senone_active)
-{
-    int32 j, k, l;
-
-    for (l = j = 0; j < n_senone_active; j++) {
-        int sen = senone_active[j] + l;
-        uint8 *pid_cw;
-        int32 tmp;
-        pid_cw = s->mixw[i][s->f[i][0].codeword];
-        tmp = pid_cw[sen] + s->f[i][0].score;
-        for (k = 1; k < topn; ++k) {
-            pid_cw = s->mixw[i][s->f[i][k].codeword];
-            tmp = fast_logmath_add(s->lmath_8b, tmp,
-                                   pid_cw[sen] + s->f[i][k].score);
+        if (sen < end)
+            continue;
+        if (block != end) {
+            if (end > start)
+                get_scores_8b_run(s, i, topn, senone_scores, start, end);
+            start = block;
         }
-        senone_scores[sen] += tmp;
-        l = sen;
+        end = block + S2_SEN_CHUNK;
+        if (end > s->n_sen)
+            end = s->n_sen;
     }
+    if (end > start)
+        get_scores_8b_run(s, i, topn, senone_scores, start, end);
     return 0;
 }
 
-static int32
-get_scores_8b_feat(s2_semi_mgau_t * s, int i, int topn,
-                   int16 *senone_scores, uint8 *senone_active, int32 n_senone_active)
-{
-    switch (topn) {
-    case 6:
-        return get_scores_8b_feat_6(s, i, senone_scores,
-                                    senone_active, n_senone_active);
-    case 5:
-        return get_scores_8b_feat_5(s, i, senone_scores,
-                                    senone_active, n_senone_active);
-    case 4:
-        return get_scores_8b_feat_4(s, i, senone_scores,
-                                    senone_active, n_senone_active);
-    case 3:
-        return get_scores_8b_feat_3(s, i, senone_scores,
-                                    senone_active, n_senone_active);
-    case 2:
-        return get_scores_8b_feat_2(s, i, senone_scores,
-                                    senone_active, n_senone_active);
-    case 1:
-        return get_scores_8b_feat_1(s, i, senone_scores,
-                                    senone_active, n_senone_active);
-    default:
-        return get_scores_8b_feat_any(s, i, topn, senone_scores,
-                                      senone_active, n_senone_active);
-    }
-}
-
 static int32
 get_scores_8b_feat_all(s2_semi_mgau_t * s, int i, int topn, int16 *senone_scores)
 {
-    int32 j, k;
-
-    for (j = 0; j < s->n_sen; j++) {
-        uint8 *pid_cw;
-        int32 tmp;
-        pid_cw = s->mixw[i][s->f[i][0].codeword];
-        tmp = pid_cw[j] + s->f[i][0].score;
-        for (k = 1; k < topn; ++k) {
-            pid_cw = s->mixw[i][s->f[i][k].codeword];
-            tmp = fast_logmath_add(s->lmath_8b, tmp,
-                                   pid_cw[j] + s->f[i][k].score);
-        }
-        senone_scores[j] += tmp;
-    }
+    get_scores_8b_run(s, i, topn, senone_scores, 0, s->n_sen);
     return 0;
 }
 
@@ -841,25 +811,30 @@ s2_semi_mgau_frame_eval(ps_mgau_t *ps,
 			int32 compallsen)
 {
     s2_semi_mgau_t *s = (s2_semi_mgau_t *)ps;
-    int i, topn_idx;
+    int i, topn_idx, last_idx, recompute, seeded;
     int n_feat = s->g->n_feat;
 
     memset(senone_scores, 0, s->n_sen * sizeof(*senone_scores));
     /* No bounds checking is done here, which just means you'll get
-     * semi-random crap if you request a frame in the future or one
-     * that's too far in the past. */
+     * semi-random crap if you request a frame in the future.  Frames
+     * too far in the past to be in the history are recomputed. */
     topn_idx = frame % s->n_topn_hist;
+    last_idx = (topn_idx + s->n_topn_hist - 1) % s->n_topn_hist;
     s->f = s->topn_hist[topn_idx];
+    recompute = (frame >= ps_mgau_base(ps)->frame_idx
+                 || s->topn_hist_frame[topn_idx] != frame);
+    /* The previous top-N is only a good place to start searching the
+     * codebooks from if it is for the previous frame. */
+    seeded = (frame > 0 && s->topn_hist_frame[last_idx] == frame - 1);
+    s->topn_hist_frame[topn_idx] = frame;
+    if (recompute)
+        s->ds_skip[0] = tied_ds_skip(&s->ds, featbuf[0], frame);
     for (i = 0; i < n_feat; ++i) {
         /* For past frames this will already be computed. */
-        if (frame >= ps_mgau_base(ps)->frame_idx) {
-            vqFeature_t **lastf;
-            if (topn_idx == 0)
-                lastf = s->topn_hist[s->n_topn_hist-1];
-            else
-                lastf = s->topn_hist[topn_idx-1];
+        if (recompute) {
+            vqFeature_t **lastf = s->topn_hist[last_idx];
             memcpy(s->f[i], lastf[i], sizeof(vqFeature_t) * s->max_topn);
-            mgau_dist(s, frame, i, featbuf[i]);
+            mgau_dist(s, s->ds_skip[0], seeded, i, featbuf[i]);
             s->topn_hist_n[topn_idx][i] = mgau_norm(s, i);
         }
         if (s->mixw_cb) {
@@ -881,6 +856,63 @@ s2_semi_mgau_frame_eval(ps_mgau_t *ps,
     return 0;
 }
 
+int32
+s2_semi_mgau_frame_eval_batch(ps_mgau_t *ps,
+                              int16 **senone_scores,
+                              mfcc_t ***featbuf,
+                              int32 frame,
+                              int32 n_frame)
+{
+    s2_semi_mgau_t *s = (s2_semi_mgau_t *)ps;
+    int i, k, topn_idx, seeded;
+    int n_feat = s->g->n_feat;
+
+    /* Each frame needs its own place in the history, and the frame
+     * before the first one has to be kept for the first one to start
+     * from. */
+    if (n_frame > s->n_topn_hist - 1)
+        n_frame = s->n_topn_hist - 1;
+    for (k = 0; k < n_frame; ++k)
+        s->ds_skip[k] = tied_ds_skip(&s->ds, featbuf[k][0], frame + k);
+    seeded = (frame > 0
+              && s->topn_hist_frame[(frame + s->n_topn_hist - 1)
+                                    % s->n_topn_hist] == frame - 1);
+
+    /* Do the top-N for each codebook for all frames at once.  This
+     * only depends on the previous frame's top-N for the same
+     * codebook, so it is the same as s2_semi_mgau_frame_eval(). */
+    for (i = 0; i < n_feat; ++i) {
+        for (k = 0; k < n_frame; ++k) {
+            vqFeature_t **lastf;
+
+            topn_idx = (frame + k) % s->n_topn_hist;
+            lastf = s->topn_hist[(frame + k + s->n_topn_hist - 1) % s->n_topn_hist];
+            s->f = s->topn_hist[topn_idx];
+            memcpy(s->f[i], lastf[i], sizeof(vqFeature_t) * s->max_topn);
+            /* Later frames start from ones in this batch. */
+            mgau_dist(s, s->ds_skip[k], seeded || k > 0, i, featbuf[k][i]);
+            s->topn_hist_n[topn_idx][i] = mgau_norm(s, i);
+        }
+    }
+
+    for (k = 0; k < n_frame; ++k) {
+        memset(senone_scores[k], 0, s->n_sen * sizeof(*senone_scores[k]));
+        topn_idx = (frame + k) % s->n_topn_hist;
+        s->topn_hist_frame[topn_idx] = frame + k;
+        s->f = s->topn_hist[topn_idx];
+        for (i = 0; i < n_feat; ++i) {
+            if (s->mixw_cb)
+                get_scores_4b_feat_all(s, i, s->topn_hist_n[topn_idx][i],
+                                       senone_scores[k]);
+            else
+                get_scores_8b_feat_all(s, i, s->topn_hist_n[topn_idx][i],
+                                       senone_scores[k]);
+        }
+    }
+
+    return n_frame;
+}
+
 static int32
 read_sendump(s2_semi_mgau_t *s, bin_mdef_t *mdef, char const *file)
 {
@@ -1224,17 +1256,146 @@ split_topn(char const *str, uint8 *out, int nfeat)
 }
 
 
+/**
+ * Verify n_feat and veclen against acmod.
+ */
+static int
+s2_semi_mgau_check_feat(gauden_t *g, acmod_t *acmod)
+{
+    int i;
+
+    if (g->n_feat != feat_dimension1(acmod->fcb)) {
+        E_ERROR("Number of streams does not match: %d != %d\n",
+                g->n_feat, feat_dimension1(acmod->fcb));
+        return -1;
+    }
+    for (i = 0; i < g->n_feat; ++i) {
+        if (g->featlen[i] != feat_dimension2(acmod->fcb, i)) {
+            E_ERROR("Dimension of stream %d does not match: %d != %d\n",
+                    i, g->featlen[i], feat_dimension2(acmod->fcb, i));
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Find the nearest codewords to each one in each codebook, by the
+ * distance between their means weighted by both of their precisions.
+ */
+static uint16 **
+cb_nbr_init(gauden_t *g, int32 n_nbr)
+{
+    uint16 **cb_nbr;
+    float64 *nbr_dist;
+    int32 f, a, b, i, j, n = g->n_density;
+
+    E_INFO("Finding %d nearest codewords to each of %d\n", n_nbr, n);
+    cb_nbr = (uint16 **)ckd_calloc_2d(g->n_feat, n * n_nbr, sizeof(**cb_nbr));
+    nbr_dist = ckd_calloc(n_nbr, sizeof(*nbr_dist));
+    for (f = 0; f < g->n_feat; ++f) {
+        int32 ceplen = g->featlen[f];
+
+        for (a = 0; a < n; ++a) {
+            uint16 *nbr = cb_nbr[f] + a * n_nbr;
+            mfcc_t const *ma = g->mean[0][f][a];
+            mfcc_t const *va = g->var[0][f][a];
+            int32 n_found = 0;
+
+            for (b = 0; b < n; ++b) {
+                mfcc_t const *mb = g->mean[0][f][b];
+                mfcc_t const *vb = g->var[0][f][b];
+                float64 d = 0;
+
+                if (b == a)
+                    continue;
+                for (j = 0; j < ceplen; ++j) {
+                    float64 diff = MFCC2FLOAT(ma[j]) - MFCC2FLOAT(mb[j]);
+                    d += diff * diff * ((float64)va[j] + vb[j]);
+                }
+                /* Insert it in the sorted list, if it is near enough. */
+                if (n_found == n_nbr && d >= nbr_dist[n_nbr - 1])
+                    continue;
+                if (n_found < n_nbr)
+                    ++n_found;
+                for (i = n_found - 1; i > 0 && nbr_dist[i - 1] > d; --i) {
+                    nbr_dist[i] = nbr_dist[i - 1];
+                    nbr[i] = nbr[i - 1];
+                }
+                nbr_dist[i] = d;
+                nbr[i] = b;
+            }
+        }
+    }
+    ckd_free(nbr_dist);
+    return cb_nbr;
+}
+
+/**
+ * Set up the scoring state, which is separate for each decoder even
+ * when the parameters are shared.
+ */
+static void
+s2_semi_mgau_init_state(s2_semi_mgau_t *s, cmd_ln_t *config)
+{
+    int i;
+
+    tied_ds_init(&s->ds, config, s->g->featlen[0]);
+    tied_logadd_init(&s->logadd, s->lmath_8b);
+    if (s->mixw_cb == NULL)
+        E_INFO("Senone scoring: %s\n", s->logadd.backend);
+
+    /* Determine top-N for each feature */
+    s->topn_beam = ckd_calloc(s->g->n_feat, sizeof(*s->topn_beam));
+    s->max_topn = cmd_ln_int32_r(config, "-topn");
+    split_topn(cmd_ln_str_r(config, "-topn_beam"), s->topn_beam, s->g->n_feat);
+    E_INFO("Maximum top-N: %d ", s->max_topn);
+    E_INFOCONT("Top-N beams:");
+    for (i = 0; i < s->g->n_feat; ++i) {
+        E_INFOCONT(" %d", s->topn_beam[i]);
+    }
+    E_INFOCONT("\n");
+
+    /* Top-N scores from recent frames */
+    s->n_topn_hist = cmd_ln_int32_r(config, "-pl_window") + 2;
+    s->topn_hist = (vqFeature_t ***)
+        ckd_calloc_3d(s->n_topn_hist, s->g->n_feat, s->max_topn,
+                      sizeof(***s->topn_hist));
+    s->topn_hist_n = ckd_calloc_2d(s->n_topn_hist, s->g->n_feat,
+                                   sizeof(**s->topn_hist_n));
+    s->topn_hist_frame = ckd_calloc(s->n_topn_hist,
+                                    sizeof(*s->topn_hist_frame));
+    s->ds_skip = ckd_calloc(s->n_topn_hist, sizeof(*s->ds_skip));
+    for (i = 0; i < s->n_topn_hist; ++i)
+        s->topn_hist_frame[i] = -1;
+    s->sum_mixw = ckd_calloc(s->max_topn, sizeof(*s->sum_mixw));
+    s->sum_ascr = ckd_calloc(s->max_topn, sizeof(*s->sum_ascr));
+    if (s->cb_nbr) {
+        s->cb_seen = ckd_calloc(s->g->n_density, sizeof(*s->cb_seen));
+        s->cb_expanded = ckd_calloc(s->g->n_density, sizeof(*s->cb_expanded));
+    }
+    for (i = 0; i < s->n_topn_hist; ++i) {
+        int j;
+        for (j = 0; j < s->g->n_feat; ++j) {
+            int k;
+            for (k = 0; k < s->max_topn; ++k) {
+                s->topn_hist[i][j][k].score = WORST_DIST;
+                s->topn_hist[i][j][k].codeword = k;
+            }
+        }
+    }
+}
+
 ps_mgau_t *
 s2_semi_mgau_init(acmod_t *acmod)
 {
     s2_semi_mgau_t *s;
     ps_mgau_t *ps;
     char const *sendump_path;
-    int i;
-    int n_feat;
 
     s = ckd_calloc(1, sizeof(*s));
-    s->config = acmod->config;
+    s->refcount = 1;
+    s->config = cmd_ln_retain(acmod->config);
 
     s->lmath = logmath_retain(acmod->lmath);
     /* Log-add table. */
@@ -1261,21 +1422,9 @@ s2_semi_mgau_init(acmod_t *acmod)
     if (s->g->n_mgau != 1)
         goto error_out;
 
-    n_feat = s->g->n_feat;
-
-    /* Verify n_feat and veclen, against acmod. */
-    if (n_feat != feat_dimension1(acmod->fcb)) {
-        E_ERROR("Number of streams does not match: %d != %d\n",
-                n_feat, feat_dimension1(acmod->fcb));
+    if (s2_semi_mgau_check_feat(s->g, acmod) < 0)
         goto error_out;
-    }
-    for (i = 0; i < n_feat; ++i) {
-        if (s->g->featlen[i] != feat_dimension2(acmod->fcb, i)) {
-            E_ERROR("Dimension of stream %d does not match: %d != %d\n",
-                    i, s->g->featlen[i], feat_dimension2(acmod->fcb, i));
-            goto error_out;
-        }
-    }
+
     /* Read mixture weights */
     if ((sendump_path = cmd_ln_str_r(s->config, "_sendump"))) {
         if (read_sendump(s, acmod->mdef, sendump_path) < 0) {
@@ -1288,37 +1437,24 @@ s2_semi_mgau_init(acmod_t *acmod)
             goto error_out;
         }
     }
-    s->ds_ratio = cmd_ln_int32_r(s->config, "-ds");
-
-    /* Determine top-N for each feature */
-    s->topn_beam = ckd_calloc(n_feat, sizeof(*s->topn_beam));
-    s->max_topn = cmd_ln_int32_r(s->config, "-topn");
-    split_topn(cmd_ln_str_r(s->config, "-topn_beam"), s->topn_beam, n_feat);
-    E_INFO("Maximum top-N: %d ", s->max_topn);
-    E_INFOCONT("Top-N beams:");
-    for (i = 0; i < n_feat; ++i) {
-        E_INFOCONT(" %d", s->topn_beam[i]);
+    /* Read kd-trees for Gaussian preselection, if any. */
+    if (cmd_ln_str_r(s->config, "_kdtree")) {
+        if ((s->kdtrees = kd_trees_read(cmd_ln_str_r(s->config, "_kdtree"),
+                                        s->g,
+                                        cmd_ln_int32_r(s->config, "-kdmaxdepth"),
+                                        cmd_ln_int32_r(s->config, "-kdmaxbbi")))
+            == NULL)
+            goto error_out;
     }
-    E_INFOCONT("\n");
-
-    /* Top-N scores from recent frames */
-    s->n_topn_hist = cmd_ln_int32_r(s->config, "-pl_window") + 2;
-    s->topn_hist = (vqFeature_t ***)
-        ckd_calloc_3d(s->n_topn_hist, n_feat, s->max_topn,
-                      sizeof(***s->topn_hist));
-    s->topn_hist_n = ckd_calloc_2d(s->n_topn_hist, n_feat,
-                                   sizeof(**s->topn_hist_n));
-    for (i = 0; i < s->n_topn_hist; ++i) {
-        int j;
-        for (j = 0; j < n_feat; ++j) {
-            int k;
-            for (k = 0; k < s->max_topn; ++k) {
-                s->topn_hist[i][j][k].score = WORST_DIST;
-                s->topn_hist[i][j][k].codeword = k;
-            }
-        }
+    /* Or nearest codewords to search the codebooks from the last top-N. */
+    else if ((s->n_cb_nbr = cmd_ln_int32_r(s->config, "-topn_nbr")) > 0) {
+        if (s->n_cb_nbr > s->g->n_density - 1)
+            s->n_cb_nbr = s->g->n_density - 1;
+        s->cb_nbr = cb_nbr_init(s->g, s->n_cb_nbr);
     }
 
+    s2_semi_mgau_init_state(s, s->config);
+
     ps = (ps_mgau_t *)s;
     ps->vt = &s2_semi_mgau_funcs;
     return ps;
@@ -1327,21 +1463,97 @@ error_out:
     return NULL;
 }
 
+ps_mgau_t *
+s2_semi_mgau_share(ps_mgau_t *ps, acmod_t *acmod)
+{
+    s2_semi_mgau_t *from = (s2_semi_mgau_t *)ps;
+    s2_semi_mgau_t *share, *s;
+
+    if (s2_semi_mgau_check_feat(from->g, acmod) < 0)
+        return NULL;
+    /* Always refer to the original, which owns the mixture weights. */
+    share = from->share ? from->share : from;
+
+    s = ckd_calloc(1, sizeof(*s));
+    s->share = share;
+    ++share->refcount;
+    s->config = cmd_ln_retain(share->config);
+    s->lmath = logmath_retain(share->lmath);
+    s->lmath_8b = logmath_retain(share->lmath_8b);
+    s->g = gauden_retain(from->g);
+    s->n_sen = share->n_sen;
+    s->mixw = share->mixw;
+    s->mixw_cb = share->mixw_cb;
+    s->kdtrees = share->kdtrees;
+    s->cb_nbr = share->cb_nbr;
+    s->n_cb_nbr = share->n_cb_nbr;
+    s2_semi_mgau_init_state(s, acmod->config);
+
+    ps = (ps_mgau_t *)s;
+    ps->vt = &s2_semi_mgau_funcs;
+    return ps;
+}
+
 int
 s2_semi_mgau_mllr_transform(ps_mgau_t *ps,
                             ps_mllr_t *mllr)
 {
     s2_semi_mgau_t *s = (s2_semi_mgau_t *)ps;
+    gauden_t *g;
+
+    /* Other decoders may be using the same codebooks. */
+    if ((g = gauden_unshare(s->g, s->config)) == NULL)
+        return -1;
+    s->g = g;
     return gauden_mllr_transform(s->g, mllr, s->config);
 }
 
 void
-s2_semi_mgau_free(ps_mgau_t *ps)
+s2_semi_mgau_mem(ps_mgau_t *ps, ps_mem_t *out_mem)
 {
     s2_semi_mgau_t *s = (s2_semi_mgau_t *)ps;
+    s2_semi_mgau_t *owner = s->share ? s->share : s;
+    size_t mixw, params;
+
+    /* Scoring state. */
+    out_mem->heap += sizeof(*s)
+        + s->g->n_feat * sizeof(*s->topn_beam)
+        + s->n_topn_hist * (s->g->n_feat * s->max_topn * sizeof(vqFeature_t)
+                            + s->g->n_feat * sizeof(**s->topn_hist_n)
+                            + sizeof(*s->topn_hist_frame))
+        + s->max_topn * (sizeof(*s->sum_mixw) + sizeof(*s->sum_ascr));
+    if (s->cb_nbr) {
+        out_mem->heap += s->g->n_density
+            * (sizeof(*s->cb_seen) + sizeof(*s->cb_expanded));
+        ps_mem_add_heap(out_mem, s->g->n_feat * s->g->n_density
+                        * s->n_cb_nbr * sizeof(**s->cb_nbr),
+                        s->share || s->refcount > 1);
+    }
 
-    logmath_free(s->lmath);
-    logmath_free(s->lmath_8b);
+    /* Codebooks may be shared, or copied for adaptation. */
+    ps_mem_add_heap(out_mem, gauden_mem_size(s->g), s->g->refcount > 1);
+
+    /* Mixture weights belong to the original. */
+    mixw = (size_t)s->g->n_feat * s->g->n_density * s->n_sen;
+    if (owner->sendump_mmap) {
+        /* 4-bit weights are packed two to a byte in the file. */
+        out_mem->mapped += owner->mixw_cb ? (mixw + 1) / 2 : mixw;
+        params = s->g->n_feat * s->g->n_density * sizeof(uint8 *);
+    }
+    else
+        params = mixw;
+    ps_mem_add_heap(out_mem, params, s->share || s->refcount > 1);
+}
+
+/**
+ * Release a reference to the parameters owned by s, freeing them and
+ * s itself if it was the last one.
+ */
+static void
+s2_semi_mgau_release(s2_semi_mgau_t *s)
+{
+    if (--s->refcount > 0)
+        return;
     if (s->sendump_mmap) {
         ckd_free_2d(s->mixw); 
         mmio_file_unmap(s->sendump_mmap);
@@ -1351,9 +1563,42 @@ s2_semi_mgau_free(ps_mgau_t *ps)
         if (s->mixw_cb)
             ckd_free(s->mixw_cb);
     }
+    if (s->kdtrees)
+        kd_trees_free(s->kdtrees, s->g->n_mgau * s->g->n_feat);
+    ckd_free_2d(s->cb_nbr);
     gauden_free(s->g);
+    cmd_ln_free_r(s->config);
+    ckd_free(s);
+}
+
+void
+s2_semi_mgau_free(ps_mgau_t *ps)
+{
+    s2_semi_mgau_t *s = (s2_semi_mgau_t *)ps;
+
+    logmath_free(s->lmath);
+    logmath_free(s->lmath_8b);
     ckd_free(s->topn_beam);
+    ckd_free(s->ds_skip);
+    tied_ds_free(&s->ds);
     ckd_free_2d(s->topn_hist_n);
+    ckd_free(s->topn_hist_frame);
     ckd_free_3d((void **)s->topn_hist);
-    ckd_free(s);
+    ckd_free(s->sum_mixw);
+    ckd_free(s->sum_ascr);
+    ckd_free(s->cb_seen);
+    ckd_free(s->cb_expanded);
+    s->topn_beam = NULL;
+    s->topn_hist_n = NULL;
+    s->topn_hist = NULL;
+
+    /* The original keeps its parameters until the last copy is gone. */
+    if (s->share) {
+        gauden_free(s->g);
+        cmd_ln_free_r(s->config);
+        s2_semi_mgau_release(s->share);
+        ckd_free(s);
+    }
+    else
+        s2_semi_mgau_release(s);
 }
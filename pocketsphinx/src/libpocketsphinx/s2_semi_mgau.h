@@ -52,6 +52,8 @@
 #include "hmm.h"
 #include "bin_mdef.h"
 #include "ms_gauden.h"
+#include "kdtree.h"
+#include "tied_mgau_common.h"
 
 typedef struct vqFeature_s vqFeature_t;
 
@@ -69,21 +71,47 @@ struct s2_semi_mgau_s {
     int32 n_sen;	/* Number of senones */
     uint8 *topn_beam;   /* Beam for determining per-frame top-N densities */
     int16 max_topn;
-    int16 ds_ratio;
+    tied_ds_t ds;       /**< Frame downsampling of codebook evaluation. */
+    uint8 *ds_skip;     /**< Downsampling decision for each batch frame. */
 
     vqFeature_t ***topn_hist; /**< Top-N scores and codewords for past frames. */
     uint8 **topn_hist_n;      /**< Variable top-N for past frames. */
+    int32 *topn_hist_frame;   /**< Frame in each entry of topn_hist, or -1. */
     vqFeature_t **f;          /**< Topn-N for currently scoring frame. */
     int n_topn_hist;          /**< Number of past frames tracked. */
 
+    kd_tree_t **kdtrees;      /**< kd-trees for Gaussian preselection, or NULL. */
+
+    /* Codebook search from the previous frame's top-N (-topn_nbr). */
+    uint16 **cb_nbr;          /**< Nearest codewords to each codeword, for each feature, or NULL. */
+    int32 n_cb_nbr;           /**< Number of nearest codewords kept for each one. */
+    uint32 *cb_seen;          /**< Search in which each codeword was last evaluated. */
+    uint32 *cb_expanded;      /**< Search in which each codeword's neighbours were last evaluated. */
+    uint32 cb_search;         /**< Current search. */
+    int32 n_cb_nbr_search;    /**< Searches that only evaluated neighbours. */
+    int32 n_cb_full_search;   /**< Searches that fell back to the whole codebook. */
+    int32 n_cb_nbr_eval;      /**< Codewords evaluated in neighbour searches. */
+
+    tied_logadd_t logadd;     /**< Senone scoring code and table. */
+    uint8 const **sum_mixw;   /**< Mixture weights for each top-N codeword. */
+    int32 *sum_ascr;          /**< Scores of each top-N codeword. */
+
     /* Log-add table for compressed values. */
     logmath_t *lmath_8b;
     /* Log-add object for reloading means/variances. */
     logmath_t *lmath;
+
+    /* Copies made with s2_semi_mgau_share() point to the original,
+     * which owns mixw and kdtrees, and stays allocated until it and
+     * all of its copies have been freed. */
+    s2_semi_mgau_t *share;   /**< Original model, or NULL if this is one. */
+    int refcount;            /**< References to the original's parameters. */
 };
 
 ps_mgau_t *s2_semi_mgau_init(acmod_t *acmod);
+ps_mgau_t *s2_semi_mgau_share(ps_mgau_t *s, acmod_t *acmod);
 void s2_semi_mgau_free(ps_mgau_t *s);
+void s2_semi_mgau_mem(ps_mgau_t *s, ps_mem_t *out_mem);
 int s2_semi_mgau_frame_eval(ps_mgau_t *s,
                             int16 *senone_scores,
                             uint8 *senone_active,
@@ -91,6 +119,11 @@ int s2_semi_mgau_frame_eval(ps_mgau_t *s,
                             mfcc_t **featbuf,
                             int32 frame,
                             int32 compallsen);
+int s2_semi_mgau_frame_eval_batch(ps_mgau_t *s,
+                                  int16 **senone_scores,
+                                  mfcc_t ***featbuf,
+                                  int32 frame,
+                                  int32 n_frame);
 int s2_semi_mgau_mllr_transform(ps_mgau_t *s,
                                 ps_mllr_t *mllr);
 
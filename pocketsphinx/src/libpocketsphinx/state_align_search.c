@@ -45,6 +45,14 @@ static int
 state_align_search_start(ps_search_t *search)
 {
     state_align_search_t *sas = (state_align_search_t *)search;
+    int i;
+
+    for (i = 0; i < sas->n_phones; ++i)
+        hmm_clear(sas->hmms + i);
+    sas->lo = 0;
+    sas->hi = 1;
+    sas->n_tokens = 0;
+    sas->best_score = 0;
 
     /* Activate the initial state. */
     hmm_enter(sas->hmms, 0, 0, 0);
@@ -56,7 +64,7 @@ static void
 renormalize_hmms(state_align_search_t *sas, int frame_idx, int32 norm)
 {
     int i;
-    for (i = 0; i < sas->n_phones; ++i)
+    for (i = sas->lo; i < sas->hi; ++i)
         hmm_normalize(sas->hmms + i, norm);
 }
 
@@ -68,7 +76,7 @@ evaluate_hmms(state_align_search_t *sas, int16 const *senscr, int frame_idx)
 
     hmm_context_set_senscore(sas->hmmctx, senscr);
 
-    for (i = 0; i < sas->n_phones; ++i) {
+    for (i = sas->lo; i < sas->hi; ++i) {
         hmm_t *hmm = sas->hmms + i;
         int32 score;
 
@@ -85,15 +93,19 @@ evaluate_hmms(state_align_search_t *sas, int16 const *senscr, int frame_idx)
 static void
 prune_hmms(state_align_search_t *sas, int frame_idx)
 {
+    int32 thresh = sas->best_score + sas->beam;
     int nf = frame_idx + 1;
     int i;
 
     /* Check all phones to see if they remain active in the next frame. */
-    for (i = 0; i < sas->n_phones; ++i) {
+    for (i = sas->lo; i < sas->hi; ++i) {
         hmm_t *hmm = sas->hmms + i;
         if (hmm_frame(hmm) < frame_idx)
             continue;
-        hmm_frame(hmm) = nf;
+        if (hmm_bestscore(hmm) BETTER_THAN thresh)
+            hmm_frame(hmm) = nf;
+        else
+            hmm_clear(hmm);
     }
 }
 
@@ -101,9 +113,10 @@ static void
 phone_transition(state_align_search_t *sas, int frame_idx)
 {
     int nf = frame_idx + 1;
-    int i;
+    int i, hi;
 
-    for (i = 0; i < sas->n_phones - 1; ++i) {
+    hi = sas->hi;
+    for (i = sas->lo; i < hi && i < sas->n_phones - 1; ++i) {
         hmm_t *hmm, *nhmm;
         int32 newphone_score;
 
@@ -117,22 +130,59 @@ phone_transition(state_align_search_t *sas, int frame_idx)
         if (hmm_frame(nhmm) < frame_idx
             || newphone_score BETTER_THAN hmm_in_score(nhmm)) {
             hmm_enter(nhmm, newphone_score, hmm_out_history(hmm), nf);
+            if (i + 2 > sas->hi)
+                sas->hi = i + 2;
         }
     }
+
+    /* Since phones are only entered in order, the active ones stay
+     * within a band which moves forward through the alignment. */
+    while (sas->lo < sas->hi - 1 && hmm_frame(sas->hmms + sas->lo) != nf)
+        ++sas->lo;
+    while (sas->hi > sas->lo + 1 && hmm_frame(sas->hmms + sas->hi - 1) != nf)
+        --sas->hi;
 }
 
 #define TOKEN_STEP 20
-static void
+static state_align_hist_t *
 extend_tokenstack(state_align_search_t *sas, int frame_idx)
 {
+    int32 n_tokens = (sas->hi - sas->lo) * sas->hmmctx->n_emit_state;
+
     if (frame_idx >= sas->n_fr_alloc) {
         sas->n_fr_alloc = frame_idx + TOKEN_STEP + 1;
-        sas->tokens = ckd_realloc(sas->tokens,
-                                  sas->n_emit_state * sas->n_fr_alloc
+        sas->tok_start = ckd_realloc(sas->tok_start, (sas->n_fr_alloc + 1)
+                                     * sizeof(*sas->tok_start));
+        sas->tok_first = ckd_realloc(sas->tok_first, sas->n_fr_alloc
+                                     * sizeof(*sas->tok_first));
+    }
+    if (sas->n_tokens + n_tokens > sas->n_tokens_alloc) {
+        sas->n_tokens_alloc = (sas->n_tokens + n_tokens) * 2;
+        sas->tokens = ckd_realloc(sas->tokens, sas->n_tokens_alloc
                                   * sizeof(*sas->tokens));
     }
-    memset(sas->tokens + frame_idx * sas->n_emit_state, 0xff,
-           sas->n_emit_state * sizeof(*sas->tokens));
+    sas->tok_start[frame_idx] = sas->n_tokens;
+    sas->tok_first[frame_idx] = sas->lo * sas->hmmctx->n_emit_state;
+    memset(sas->tokens + sas->n_tokens, 0xff,
+           n_tokens * sizeof(*sas->tokens));
+    sas->n_tokens += n_tokens;
+    sas->tok_start[frame_idx + 1] = sas->n_tokens;
+
+    /* Index it by state like a full frame of tokens. */
+    return sas->tokens + sas->tok_start[frame_idx] - sas->tok_first[frame_idx];
+}
+
+/* Token for a state in a frame, or NULL if it was not active. */
+static state_align_hist_t *
+get_token(state_align_search_t *sas, int frame_idx, int32 state_idx)
+{
+    int32 idx = sas->tok_start[frame_idx] + state_idx
+        - sas->tok_first[frame_idx];
+
+    if (state_idx < 0 || idx < sas->tok_start[frame_idx]
+        || idx >= sas->tok_start[frame_idx + 1])
+        return NULL;
+    return sas->tokens + idx;
 }
 
 static void
@@ -141,12 +191,11 @@ record_transitions(state_align_search_t *sas, int frame_idx)
     state_align_hist_t *tokens;
     int i;
 
-    /* Push another frame of tokens on the stack. */
-    extend_tokenstack(sas, frame_idx);
-    tokens = sas->tokens + frame_idx * sas->n_emit_state;
+    /* Push another frame of tokens on the stack, for active phones only. */
+    tokens = extend_tokenstack(sas, frame_idx);
 
     /* Scan all active HMMs */
-    for (i = 0; i < sas->n_phones; ++i) {
+    for (i = sas->lo; i < sas->hi; ++i) {
         hmm_t *hmm = sas->hmms + i;
         int j;
 
@@ -172,7 +221,7 @@ state_align_search_step(ps_search_t *search, int frame_idx)
     int i;
 
     /* Calculate senone scores. */
-    for (i = 0; i < sas->n_phones; ++i)
+    for (i = sas->lo; i < sas->hi; ++i)
         acmod_activate_hmm(acmod, sas->hmms + i);
     senscr = acmod_score(acmod, &frame_idx);
 
@@ -209,19 +258,25 @@ state_align_search_finish(ps_search_t *search)
     ps_alignment_entry_t *ent;
 
     int last_frame, cur_frame;
-    state_align_hist_t last, cur;
+    state_align_hist_t last, cur, *tok;
 
     /* Best state exiting the last cur_frame. */
     last.id = cur.id = hmm_out_history(final_phone);
     last.score = hmm_out_score(final_phone);
-    if (last.id == 0xffff) {
+    if (last.id == -1) {
         E_ERROR("Failed to reach final state in alignment\n");
         return -1;
     }
     itor = ps_alignment_states(sas->al);
     last_frame = sas->frame + 1;
     for (cur_frame = sas->frame - 1; cur_frame >= 0; --cur_frame) {
-	cur = sas->tokens[cur_frame * sas->n_emit_state + cur.id];
+        if ((tok = get_token(sas, cur_frame, cur.id)) == NULL) {
+            E_ERROR("State %d not active in frame %d of alignment\n",
+                    cur.id, cur_frame);
+            ps_alignment_iter_free(itor);
+            return -1;
+        }
+        cur = *tok;
         /* State boundary, update alignment entry for next state. */
         if (cur.id != last.id) {
             itor = ps_alignment_iter_goto(itor, last.id);
@@ -264,6 +319,8 @@ state_align_search_free(ps_search_t *search)
     ps_search_base_free(search);
     ckd_free(sas->hmms);
     ckd_free(sas->tokens);
+    ckd_free(sas->tok_start);
+    ckd_free(sas->tok_first);
     hmm_context_free(sas->hmmctx);
     ckd_free(sas);
 }
@@ -278,6 +335,8 @@ static ps_searchfuncs_t state_align_search_funcs = {
     /* hyp: */      NULL,
     /* prob: */     NULL,
     /* seg_iter: */ NULL,
+    /* clone: */    NULL,
+    /* mem: */      NULL,
 };
 
 ps_search_t *
@@ -301,6 +360,8 @@ state_align_search_init(const char *name,
         return NULL;
     }
     sas->al = al;
+    sas->beam = logmath_log(acmod->lmath, cmd_ln_float64_r(config, "-beam"))
+        >> SENSCR_SHIFT;
 
     /* Generate HMM vector from phone level of alignment. */
     sas->n_phones = ps_alignment_n_phones(al);
@@ -55,7 +55,7 @@
  * History structure
  */
 struct state_align_hist_s {
-    uint16 id;
+    int32 id;
     int32 score;
 };
 typedef struct state_align_hist_s state_align_hist_t;
@@ -73,8 +73,15 @@ struct state_align_search_s {
     int frame;              /**< Current frame being processed. */
     int32 best_score;       /**< Best score in current frame. */
 
-    int n_emit_state;       /**< Number of emitting states (tokens per frame) */
+    int32 beam;             /**< Pruning beam width. */
+    int lo, hi;             /**< Range of phones which may be active. */
+
+    int n_emit_state;       /**< Number of emitting states in the alignment */
     state_align_hist_t *tokens;         /**< Tokens (backpointers) for state alignment. */
+    int32 n_tokens;         /**< Number of tokens in use. */
+    int32 n_tokens_alloc;   /**< Number of tokens allocated. */
+    int32 *tok_start;       /**< Index of each frame's first token. */
+    int32 *tok_first;       /**< State index of each frame's first token. */
     int n_fr_alloc;         /**< Number of frames of tokens allocated. */
 };
 typedef struct state_align_search_s state_align_search_t;
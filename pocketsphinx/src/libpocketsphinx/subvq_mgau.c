@@ -0,0 +1,675 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+
+/* System headers */
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/* SphinxBase headers */
+#include <sphinx_config.h>
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/fixpoint.h>
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/pio.h>
+#include <sphinxbase/err.h>
+
+/* Local headers */
+#include "ms_mgau.h"
+#include "subvq_mgau.h"
+
+#if !defined(FIXED_POINT)
+#if defined(__SSE2__) || defined(_M_X64)
+#define SUBVQ_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SUBVQ_SIMD_AVX
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define SUBVQ_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif /* !FIXED_POINT */
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static ps_mgaufuncs_t subvq_mgau_funcs = {
+    "subvq",
+    subvq_mgau_frame_eval,      /* frame_eval */
+    NULL,                       /* frame_eval_batch */
+    subvq_mgau_mllr_transform,  /* transform */
+    NULL,                       /* share */
+    subvq_mgau_free,            /* free */
+    PS_MGAU_NORM_BEST,          /* norm */
+    NULL,                       /* nearest */
+    subvq_mgau_mem              /* mem */
+};
+
+/**
+ * Compute the scores of a block of sub-vector codewords.
+ */
+static void
+subvq_block_eval(mfcc_t const *blk, mfcc_t const *subvec, int veclen,
+                 mfcc_t *out)
+{
+    int i, l;
+
+    for (l = 0; l < SUBVQ_BLOCK; ++l) {
+        mfcc_t const *b = blk + l;
+        mfcc_t d = b[0];
+
+        for (i = 0; i < veclen; ++i) {
+            mfcc_t diff = subvec[i] - b[SUBVQ_BLOCK * (1 + 2 * i)];
+#ifdef FIXED_POINT
+            /* Have to check for underflows here. */
+            mfcc_t pd = d;
+            d -= MFCCMUL(MFCCMUL(diff, diff), b[SUBVQ_BLOCK * (2 + 2 * i)]);
+            if (d > pd) {
+                d = WORST_SCORE;
+                break;
+            }
+#else
+            d -= diff * diff * b[SUBVQ_BLOCK * (2 + 2 * i)];
+#endif
+        }
+        out[l] = d;
+    }
+}
+
+/*
+ * Vector kernels for subvq_block_eval(), one codeword per lane, with
+ * the same operations in the same order as the scalar code, so they
+ * give the same scores.
+ */
+#ifdef SUBVQ_SIMD_SSE2
+static void
+subvq_block_sse2(mfcc_t const *blk, mfcc_t const *subvec, int veclen,
+                 mfcc_t *out)
+{
+    __m128 d0, d1;
+    int j;
+
+    d0 = _mm_loadu_ps(blk);
+    d1 = _mm_loadu_ps(blk + 4);
+    blk += SUBVQ_BLOCK;
+    for (j = 0; j < veclen; ++j) {
+        __m128 o = _mm_set1_ps(subvec[j]);
+        __m128 diff0 = _mm_sub_ps(o, _mm_loadu_ps(blk));
+        __m128 diff1 = _mm_sub_ps(o, _mm_loadu_ps(blk + 4));
+        d0 = _mm_sub_ps(d0, _mm_mul_ps(_mm_mul_ps(diff0, diff0),
+                                       _mm_loadu_ps(blk + 8)));
+        d1 = _mm_sub_ps(d1, _mm_mul_ps(_mm_mul_ps(diff1, diff1),
+                                       _mm_loadu_ps(blk + 12)));
+        blk += 2 * SUBVQ_BLOCK;
+    }
+    _mm_storeu_ps(out, d0);
+    _mm_storeu_ps(out + 4, d1);
+}
+#endif /* SUBVQ_SIMD_SSE2 */
+
+#ifdef SUBVQ_SIMD_AVX
+__attribute__((target("avx")))
+static void
+subvq_block_avx(mfcc_t const *blk, mfcc_t const *subvec, int veclen,
+                mfcc_t *out)
+{
+    __m256 d;
+    int j;
+
+    d = _mm256_loadu_ps(blk);
+    blk += SUBVQ_BLOCK;
+    for (j = 0; j < veclen; ++j) {
+        __m256 diff = _mm256_sub_ps(_mm256_set1_ps(subvec[j]),
+                                    _mm256_loadu_ps(blk));
+        d = _mm256_sub_ps(d, _mm256_mul_ps(_mm256_mul_ps(diff, diff),
+                                           _mm256_loadu_ps(blk + 8)));
+        blk += 2 * SUBVQ_BLOCK;
+    }
+    _mm256_storeu_ps(out, d);
+}
+#endif /* SUBVQ_SIMD_AVX */
+
+#ifdef SUBVQ_SIMD_NEON
+static void
+subvq_block_neon(mfcc_t const *blk, mfcc_t const *subvec, int veclen,
+                 mfcc_t *out)
+{
+    float32x4_t d0, d1;
+    int j;
+
+    d0 = vld1q_f32(blk);
+    d1 = vld1q_f32(blk + 4);
+    blk += SUBVQ_BLOCK;
+    for (j = 0; j < veclen; ++j) {
+        float32x4_t o = vdupq_n_f32(subvec[j]);
+        float32x4_t diff0 = vsubq_f32(o, vld1q_f32(blk));
+        float32x4_t diff1 = vsubq_f32(o, vld1q_f32(blk + 4));
+        d0 = vsubq_f32(d0, vmulq_f32(vmulq_f32(diff0, diff0),
+                                     vld1q_f32(blk + 8)));
+        d1 = vsubq_f32(d1, vmulq_f32(vmulq_f32(diff1, diff1),
+                                     vld1q_f32(blk + 12)));
+        blk += 2 * SUBVQ_BLOCK;
+    }
+    vst1q_f32(out, d0);
+    vst1q_f32(out + 4, d1);
+}
+#endif /* SUBVQ_SIMD_NEON */
+
+/**
+ * Choose the codeword evaluation code for this machine.
+ */
+static void
+subvq_mgau_select_backend(subvq_mgau_t *s)
+{
+    s->vq_block = NULL;
+    s->eval_backend = "reference";
+#ifdef SUBVQ_SIMD_NEON
+    s->vq_block = subvq_block_neon;
+    s->eval_backend = "neon";
+#endif
+#ifdef SUBVQ_SIMD_SSE2
+    s->vq_block = subvq_block_sse2;
+    s->eval_backend = "sse2";
+#endif
+#ifdef SUBVQ_SIMD_AVX
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx")) {
+        s->vq_block = subvq_block_avx;
+        s->eval_backend = "avx";
+    }
+#endif
+    E_INFO("Sub-vector codeword evaluation: %s\n", s->eval_backend);
+}
+
+/**
+ * Read the sub-vector quantized model, in the format written by
+ * sphinx3_gausubvq:
+ *
+ *   VQParam <#mixtures> <#Gaussians> -> <#sub-vectors> <#codewords>
+ *   Subvector 0 length <length> <feature-dim> <feature-dim> ...
+ *   ...
+ *   Codebook 0
+ *   <mean> <variance> ... for each dimension of codeword 0
+ *   ...
+ *   Map 0
+ *   <codeword> for each Gaussian of mixture 0
+ *   ...
+ *   (repeated for each sub-vector)
+ *   End
+ */
+static int
+subvq_mgau_read(subvq_mgau_t *s, char const *file, float32 varfloor,
+                logmath_t *lmath)
+{
+    gauden_t *g = s->g;
+    lineiter_t *li;
+    FILE *fp;
+    char *ptr;
+    int32 n_mgau, n_density, n_stride;
+    int32 sv, cw, i, j, k, n;
+
+    E_INFO("Reading sub-vector quantized model from %s\n", file);
+    if ((fp = fopen(file, "r")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open sub-vector quantized model '%s'", file);
+        return -1;
+    }
+
+    for (li = lineiter_start_clean(fp); li; li = lineiter_next(li)) {
+        if (sscanf(li->buf, "VQParam %d %d -> %d %d",
+                   &n_mgau, &n_density, &s->n_sv, &s->vqsize) == 4)
+            break;
+    }
+    if (li == NULL) {
+        E_ERROR("Failed to read VQParam header\n");
+        goto error_out;
+    }
+    if (n_mgau != g->n_mgau || n_density != g->n_density) {
+        E_ERROR("Model size conflict: %d x %d (SubVQ) vs %d x %d (Original)\n",
+                n_mgau, n_density, g->n_mgau, g->n_density);
+        goto error_out;
+    }
+    if (s->n_sv < 1 || s->vqsize < 1) {
+        E_ERROR("Invalid sub-vector quantizer size: %d x %d\n",
+                s->n_sv, s->vqsize);
+        goto error_out;
+    }
+    s->n_vqblock = (s->vqsize + SUBVQ_BLOCK - 1) / SUBVQ_BLOCK;
+    n_stride = s->n_vqblock * SUBVQ_BLOCK;
+    E_INFO("Sub-vectors: %d, codewords: %d\n", s->n_sv, s->vqsize);
+
+    /* Sub-vector lengths and feature dimensions. */
+    s->veclen = ckd_calloc(s->n_sv, sizeof(*s->veclen));
+    s->featdim = ckd_calloc(s->n_sv, sizeof(*s->featdim));
+    s->cb = ckd_calloc(s->n_sv, sizeof(*s->cb));
+    for (sv = 0; sv < s->n_sv; ++sv) {
+        if ((li = lineiter_next(li)) == NULL
+            || sscanf(li->buf, "Subvector %d length %d%n", &k, &s->veclen[sv],
+                      &n) != 2
+            || k != sv || s->veclen[sv] < 1) {
+            E_ERROR("Error reading length of sub-vector %d\n", sv);
+            goto error_out;
+        }
+        s->featdim[sv] = ckd_calloc(s->veclen[sv], sizeof(**s->featdim));
+        for (ptr = li->buf + n, i = 0; i < s->veclen[sv]; ++i, ptr += n) {
+            if (sscanf(ptr, "%d%n", &s->featdim[sv][i], &n) != 1
+                || s->featdim[sv][i] < 0
+                || s->featdim[sv][i] >= g->featlen[0]) {
+                E_ERROR("Error reading dimension %d of sub-vector %d\n", i, sv);
+                goto error_out;
+            }
+        }
+    }
+
+    /* Codebook and map for each sub-vector. */
+    s->map = ckd_calloc(n_mgau * n_density * s->n_sv, sizeof(*s->map));
+    for (sv = 0; sv < s->n_sv; ++sv) {
+        int32 veclen = s->veclen[sv];
+
+        if ((li = lineiter_next(li)) == NULL
+            || sscanf(li->buf, "Codebook %d", &k) != 1 || k != sv) {
+            E_ERROR("Error reading codebook header for sub-vector %d\n", sv);
+            goto error_out;
+        }
+        s->cb[sv] = ckd_calloc(s->n_vqblock * SUBVQ_BLOCK_SIZE(veclen),
+                               sizeof(**s->cb));
+        for (cw = 0; cw < s->vqsize; ++cw) {
+            mfcc_t *blk = s->cb[sv] + cw / SUBVQ_BLOCK * SUBVQ_BLOCK_SIZE(veclen)
+                + cw % SUBVQ_BLOCK;
+
+            if ((li = lineiter_next(li)) == NULL) {
+                E_ERROR("Error reading codeword %d of sub-vector %d\n", cw, sv);
+                goto error_out;
+            }
+            blk[0] = 0;
+            for (ptr = li->buf, i = 0; i < veclen; ++i, ptr += n) {
+                float32 mean, var;
+
+                if (sscanf(ptr, "%f %f%n", &mean, &var, &n) != 2) {
+                    E_ERROR("Error reading codeword %d of sub-vector %d\n",
+                            cw, sv);
+                    goto error_out;
+                }
+                /* Same precomputation as for the full Gaussians. */
+                if (var < varfloor)
+                    var = varfloor;
+                blk[0] += (mfcc_t)logmath_log(lmath,
+                                              1.0 / sqrt(var * 2.0 * M_PI));
+                blk[SUBVQ_BLOCK * (1 + 2 * i)] = FLOAT2MFCC(mean);
+                blk[SUBVQ_BLOCK * (2 + 2 * i)] =
+                    (mfcc_t)logmath_ln_to_log(lmath, 1.0 / (var * 2.0));
+            }
+        }
+
+        if ((li = lineiter_next(li)) == NULL
+            || sscanf(li->buf, "Map %d", &k) != 1 || k != sv) {
+            E_ERROR("Error reading map header for sub-vector %d\n", sv);
+            goto error_out;
+        }
+        /* Map entries index vqdist directly, to save a lookup. */
+        for (i = 0; i < n_mgau; ++i) {
+            if ((li = lineiter_next(li)) == NULL) {
+                E_ERROR("Error reading map for mixture %d\n", i);
+                goto error_out;
+            }
+            for (ptr = li->buf, j = 0; j < n_density; ++j, ptr += n) {
+                int32 *map = s->map + (i * n_density + j) * s->n_sv;
+
+                if (sscanf(ptr, "%d%n", &cw, &n) != 1 || cw >= s->vqsize) {
+                    E_ERROR("Invalid map entry for Gaussian %d of mixture %d\n",
+                            j, i);
+                    goto error_out;
+                }
+                /* Gaussians missing from the subvq model (usually
+                 * because they are unused) are marked with -1 for
+                 * every sub-vector. */
+                if (sv > 0 && (cw < 0) != (map[0] < 0)) {
+                    E_ERROR("Partially undefined map for Gaussian %d of mixture %d\n",
+                            j, i);
+                    goto error_out;
+                }
+                map[sv] = (cw < 0) ? -1 : sv * n_stride + cw;
+            }
+        }
+    }
+
+    if ((li = lineiter_next(li)) == NULL || strcmp(li->buf, "End") != 0) {
+        E_ERROR("Error reading 'End' token\n");
+        goto error_out;
+    }
+    lineiter_free(li);
+    fclose(fp);
+    return 0;
+
+error_out:
+    lineiter_free(li);
+    fclose(fp);
+    return -1;
+}
+
+ps_mgau_t *
+subvq_mgau_init(acmod_t *acmod, logmath_t *lmath, bin_mdef_t *mdef)
+{
+    subvq_mgau_t *s;
+    ms_mgau_model_t *msg;
+    cmd_ln_t *config;
+    float64 beam;
+    int32 i, maxlen;
+
+    config = acmod->config;
+    s = ckd_calloc(1, sizeof(*s));
+    s->base.vt = &subvq_mgau_funcs;
+
+    /* The full model does the exact evaluation. */
+    if ((s->ms = ms_mgau_init(acmod, lmath, mdef)) == NULL)
+        goto error_out;
+    msg = (ms_mgau_model_t *)s->ms;
+    s->g = ms_mgau_gauden(msg);
+    s->sen = ms_mgau_senone(msg);
+    s->topn = ms_mgau_topn(msg);
+    if (s->g->mean == NULL) {
+        E_ERROR("Sub-vector quantization requires unquantized Gaussians\n");
+        goto error_out;
+    }
+    if (s->g->n_feat != 1) {
+        E_ERROR("Sub-vector quantization requires a single-stream model "
+                "(this one has %d streams)\n", s->g->n_feat);
+        goto error_out;
+    }
+
+    if (subvq_mgau_read(s, cmd_ln_str_r(config, "-subvq"),
+                        cmd_ln_float32_r(config, "-varfloor"), lmath) < 0)
+        goto error_out;
+    beam = cmd_ln_float64_r(config, "-subvqbeam");
+    s->beam = (mfcc_t)logmath_log(lmath, beam);
+    E_INFO("Sub-vector quantization beam: %e (%d)\n", beam, (int)s->beam);
+
+    maxlen = 0;
+    for (i = 0; i < s->n_sv; ++i)
+        if (s->veclen[i] > maxlen)
+            maxlen = s->veclen[i];
+    s->subvec = ckd_calloc(maxlen, sizeof(*s->subvec));
+    s->vqdist = ckd_calloc(s->n_sv * s->n_vqblock * SUBVQ_BLOCK,
+                           sizeof(*s->vqdist));
+    s->gauscore = ckd_calloc(s->g->n_density, sizeof(*s->gauscore));
+    s->shortlist = ckd_calloc(s->g->n_density, sizeof(*s->shortlist));
+    s->dist = (gauden_dist_t ***)
+        ckd_calloc_3d(s->g->n_mgau, 1, s->topn, sizeof(gauden_dist_t));
+    s->n_dist = ckd_calloc(s->g->n_mgau, sizeof(*s->n_dist));
+    s->mgau_active = ckd_calloc(s->g->n_mgau, sizeof(*s->mgau_active));
+    subvq_mgau_select_backend(s);
+
+    return ps_mgau_base(s);
+error_out:
+    subvq_mgau_free(ps_mgau_base(s));
+    return NULL;
+}
+
+void
+subvq_mgau_mem(ps_mgau_t *ps, ps_mem_t *out_mem)
+{
+    subvq_mgau_t *s = (subvq_mgau_t *)ps;
+    size_t size;
+    int32 sv;
+
+    /* The full model, then the codebooks, map and working space. */
+    if (s->ms->vt->mem)
+        (*s->ms->vt->mem)(s->ms, out_mem);
+    size = sizeof(*s)
+        + s->n_sv * (sizeof(*s->veclen) + sizeof(*s->featdim)
+                     + sizeof(*s->cb))
+        + (size_t)s->g->n_mgau * s->g->n_density * s->n_sv * sizeof(*s->map)
+        + s->n_sv * s->n_vqblock * SUBVQ_BLOCK * sizeof(*s->vqdist)
+        + s->g->n_density * (sizeof(*s->gauscore) + sizeof(*s->shortlist))
+        + s->g->n_mgau * (s->topn * sizeof(gauden_dist_t)
+                          + sizeof(*s->n_dist) + sizeof(*s->mgau_active));
+    for (sv = 0; sv < s->n_sv; ++sv)
+        size += s->veclen[sv] * sizeof(**s->featdim)
+            + s->n_vqblock * SUBVQ_BLOCK_SIZE(s->veclen[sv]) * sizeof(**s->cb);
+    out_mem->heap += size;
+}
+
+void
+subvq_mgau_free(ps_mgau_t *ps)
+{
+    subvq_mgau_t *s = (subvq_mgau_t *)ps;
+    int32 i;
+
+    if (s == NULL)
+        return;
+    if (s->ms)
+        ms_mgau_free(s->ms);
+    if (s->cb) {
+        for (i = 0; i < s->n_sv; ++i)
+            ckd_free(s->cb[i]);
+        ckd_free(s->cb);
+    }
+    if (s->featdim) {
+        for (i = 0; i < s->n_sv; ++i)
+            ckd_free(s->featdim[i]);
+        ckd_free(s->featdim);
+    }
+    ckd_free(s->veclen);
+    ckd_free(s->map);
+    ckd_free(s->subvec);
+    ckd_free(s->vqdist);
+    ckd_free(s->gauscore);
+    ckd_free(s->shortlist);
+    if (s->dist)
+        ckd_free_3d(s->dist);
+    ckd_free(s->n_dist);
+    ckd_free(s->mgau_active);
+    ckd_free(s);
+}
+
+int
+subvq_mgau_mllr_transform(ps_mgau_t *ps, ps_mllr_t *mllr)
+{
+    subvq_mgau_t *s = (subvq_mgau_t *)ps;
+
+    /* Only the full Gaussians are adapted, so the selection is done
+     * with the speaker-independent codewords. */
+    return ms_mgau_mllr_transform(s->ms, mllr);
+}
+
+void
+subvq_mgau_vq_eval(subvq_mgau_t *s, mfcc_t *feat)
+{
+    int32 sv, b, i;
+
+    for (sv = 0; sv < s->n_sv; ++sv) {
+        int32 veclen = s->veclen[sv];
+        mfcc_t const *blk = s->cb[sv];
+        mfcc_t *out = s->vqdist + sv * s->n_vqblock * SUBVQ_BLOCK;
+
+        for (i = 0; i < veclen; ++i)
+            s->subvec[i] = feat[s->featdim[sv][i]];
+        for (b = 0; b < s->n_vqblock; ++b) {
+            if (s->vq_block)
+                s->vq_block(blk, s->subvec, veclen, out);
+            else
+                subvq_block_eval(blk, s->subvec, veclen, out);
+            blk += SUBVQ_BLOCK_SIZE(veclen);
+            out += SUBVQ_BLOCK;
+        }
+    }
+}
+
+/**
+ * Find the top-N Gaussians in one mixture, evaluating only those
+ * whose approximate score is within the beam of the best.
+ */
+static void
+subvq_mgau_eval_mgau(subvq_mgau_t *s, int32 m, mfcc_t *obs)
+{
+    gauden_t *g = s->g;
+    gauden_dist_t *out = s->dist[m][0];
+    int32 const *map = s->map + m * g->n_density * s->n_sv;
+    int32 featlen = g->featlen[0];
+    int32 d, i, j, k, n, n_sl;
+    mfcc_t best, th;
+
+    best = WORST_SCORE;
+    for (d = 0, n = 0; d < g->n_density; ++d, map += s->n_sv) {
+        mfcc_t v = 0;
+
+        if (map[0] < 0) {
+            s->gauscore[d] = WORST_SCORE;
+            continue;
+        }
+        for (i = 0; i < s->n_sv; ++i)
+            v += s->vqdist[map[i]];
+        s->gauscore[d] = v;
+        if (n++ == 0 || v > best)
+            best = v;
+    }
+    /* If the subvq model does not cover this mixture, evaluate it all. */
+    th = n ? best + s->beam : WORST_SCORE;
+
+    /* Shortlist the Gaussians best first, so that the exact
+     * evaluation below can give up on the rest as early as possible. */
+    for (n_sl = d = 0; d < g->n_density; ++d) {
+        if (s->gauscore[d] < th)
+            continue;
+        for (i = n_sl++; i > 0 && s->gauscore[s->shortlist[i - 1]] < s->gauscore[d]; --i)
+            s->shortlist[i] = s->shortlist[i - 1];
+        s->shortlist[i] = d;
+    }
+    s->n_gau_eval += n_sl;
+
+    n = 0;
+    for (k = 0; k < n_sl; ++k) {
+        mfcc_t const *mean, *var;
+        mfcc_t dval;
+
+        d = s->shortlist[k];
+        mean = g->mean[m][0][d];
+        var = g->var[m][0][d];
+        dval = g->det[m][0][d];
+        for (i = 0; i < featlen && (n < s->topn || dval >= out[n - 1].dist); ++i) {
+            mfcc_t diff;
+#ifdef FIXED_POINT
+            /* Have to check for underflows here. */
+            mfcc_t pdval = dval;
+            diff = obs[i] - mean[i];
+            dval -= MFCCMUL(MFCCMUL(diff, diff), var[i]);
+            if (dval > pdval) {
+                dval = WORST_SCORE;
+                break;
+            }
+#else
+            diff = obs[i] - mean[i];
+            dval -= diff * diff * var[i];
+#endif
+        }
+        if (i < featlen || (n == s->topn && dval < out[n - 1].dist))
+            continue;
+
+        /* Insert in the ordered list, as gauden_dist() does. */
+        for (i = 0; i < n && dval < out[i].dist; ++i)
+            ;
+        if (n < s->topn)
+            ++n;
+        for (j = n - 1; j > i; --j)
+            out[j] = out[j - 1];
+        out[i].dist = dval;
+        out[i].id = d;
+    }
+    s->n_dist[m] = n;
+}
+
+int
+subvq_mgau_frame_eval(ps_mgau_t *ps,
+                      int16 *senscr,
+                      uint8 *senone_active,
+                      int32 n_senone_active,
+                      mfcc_t **featbuf,
+                      int32 frame,
+                      int32 compallsen)
+{
+    subvq_mgau_t *s = (subvq_mgau_t *)ps;
+    senone_t *sen = s->sen;
+    int32 best, i, m, n, sid;
+
+    if (compallsen)
+        n_senone_active = sen->n_sen;
+    else {
+        /* Flag all active mixture-gaussian codebooks */
+        memset(s->mgau_active, 0, s->g->n_mgau);
+        for (n = i = 0; i < n_senone_active; i++) {
+            /* senone_active consists of deltas. */
+            sid = senone_active[i] + n;
+            s->mgau_active[sen->mgau[sid]] = 1;
+            n = sid;
+        }
+    }
+
+    subvq_mgau_vq_eval(s, featbuf[0]);
+    for (m = 0; m < s->g->n_mgau; ++m) {
+        if (compallsen || s->mgau_active[m])
+            subvq_mgau_eval_mgau(s, m, featbuf[0]);
+    }
+
+    best = (int32) 0x7fffffff;
+    for (n = i = 0; i < n_senone_active; ++i) {
+        sid = compallsen ? i : senone_active[i] + n;
+        m = sen->mgau[sid];
+        senscr[sid] = senone_eval(sen, sid, s->dist[m], s->n_dist[m]);
+        if (best > senscr[sid])
+            best = senscr[sid];
+        n = sid;
+    }
+
+    /* Normalize senone scores */
+    for (n = i = 0; i < n_senone_active; ++i) {
+        int32 bs;
+
+        sid = compallsen ? i : senone_active[i] + n;
+        bs = senscr[sid] - best;
+        if (bs > 32767)
+            bs = 32767;
+        if (bs < -32768)
+            bs = -32768;
+        senscr[sid] = bs;
+        n = sid;
+    }
+
+    return 0;
+}
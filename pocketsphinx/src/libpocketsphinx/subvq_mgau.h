@@ -0,0 +1,129 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file subvq_mgau.h Sub-vector quantized Gaussian selection for
+ * continuous models.
+ *
+ * Each Gaussian in the model is approximated by a codeword from a
+ * small codebook for each sub-vector of the feature vector, as
+ * computed by sphinx3_gausubvq.  Scoring these codebooks is cheap,
+ * and gives an approximate score for every Gaussian in the model; in
+ * each mixture, only those within a beam of the best approximate
+ * score are then evaluated exactly.
+ */
+
+#ifndef __SUBVQ_MGAU_H__
+#define __SUBVQ_MGAU_H__
+
+/* SphinxBase headers. */
+#include <sphinxbase/logmath.h>
+
+/* Local headers. */
+#include "acmod.h"
+#include "bin_mdef.h"
+#include "ms_gauden.h"
+#include "ms_senone.h"
+
+/** Number of sub-vector codewords evaluated at once. */
+#define SUBVQ_BLOCK 8
+/** Size of a block of interleaved codewords (determinants, then mean
+ * and inverse variance of each dimension). */
+#define SUBVQ_BLOCK_SIZE(veclen) (SUBVQ_BLOCK * (1 + 2 * (veclen)))
+
+/**
+ * Compute the scores of a block of sub-vector codewords.
+ */
+typedef void (*subvq_block_t)(mfcc_t const *blk, mfcc_t const *subvec,
+                              int veclen, mfcc_t *out);
+
+typedef struct subvq_mgau_s {
+    ps_mgau_t base;     /**< base structure. */
+    ps_mgau_t *ms;      /**< Full model, used for exact evaluation */
+    gauden_t *g;        /**< Gaussians (belonging to ms) */
+    senone_t *sen;      /**< Senones (belonging to ms) */
+    int32 topn;         /**< Number of Gaussians used for each senone */
+    mfcc_t beam;        /**< Beam for selecting Gaussians */
+
+    int32 n_sv;         /**< Number of sub-vectors */
+    int32 vqsize;       /**< Number of codewords for each sub-vector */
+    int32 n_vqblock;    /**< Number of blocks of codewords */
+    int32 *veclen;      /**< Length of each sub-vector */
+    int32 **featdim;    /**< Feature dimensions in each sub-vector */
+    mfcc_t **cb;        /**< Codewords for each sub-vector, interleaved
+                           in blocks of SUBVQ_BLOCK */
+    int32 *map;         /**< Codeword for each sub-vector of each Gaussian,
+                           as an index into vqdist */
+    subvq_block_t vq_block; /**< Vectorized block kernel (or NULL) */
+    char const *eval_backend; /**< Name of the codeword evaluation code. */
+
+    /* Working space for evaluation. */
+    mfcc_t *subvec;     /**< Features of one sub-vector */
+    mfcc_t *vqdist;     /**< Score of each codeword of each sub-vector */
+    mfcc_t *gauscore;   /**< Approximate Gaussian scores for one mixture */
+    int32 *shortlist;   /**< Gaussians to evaluate in one mixture, best first */
+    gauden_dist_t ***dist; /**< Top-N Gaussians of each mixture */
+    int32 *n_dist;      /**< Number of entries in dist for each mixture */
+    uint8 *mgau_active; /**< Active mixtures */
+    int32 n_gau_eval;   /**< Number of Gaussians evaluated exactly */
+} subvq_mgau_t;
+
+/**
+ * Initialize sub-vector quantized Gaussian selection.
+ *
+ * This reads the full model as ms_mgau_init() does, and the
+ * sub-vector quantized model from -subvq, which must have been built
+ * from it.  Only single-stream models are supported.
+ */
+ps_mgau_t *subvq_mgau_init(acmod_t *acmod, logmath_t *lmath, bin_mdef_t *mdef);
+void subvq_mgau_free(ps_mgau_t *s);
+void subvq_mgau_mem(ps_mgau_t *s, ps_mem_t *out_mem);
+int subvq_mgau_frame_eval(ps_mgau_t *s,
+                          int16 *senone_scores,
+                          uint8 *senone_active,
+                          int32 n_senone_active,
+                          mfcc_t **featbuf,
+                          int32 frame,
+                          int32 compallsen);
+int subvq_mgau_mllr_transform(ps_mgau_t *s,
+                              ps_mllr_t *mllr);
+
+/**
+ * Compute the scores of all sub-vector codewords for a feature vector.
+ */
+void subvq_mgau_vq_eval(subvq_mgau_t *s, mfcc_t *feat);
+
+#endif /* __SUBVQ_MGAU_H__ */
@@ -0,0 +1,293 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file tied_mgau_common.c
+ * @brief Senone scoring shared between SC and PTM (tied-state) models.
+ */
+
+#include <string.h>
+
+#include <sphinxbase/err.h>
+#include <sphinxbase/prim_type.h>
+#include <sphinxbase/ckd_alloc.h>
+
+#include "tied_mgau_common.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define TIED_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TIED_SIMD_AVX2
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define TIED_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/* Scalar scoring of senones from start to n. */
+static void
+tied_senone_sum_tail(tied_logadd_t const *la,
+                     uint8 const **mixw, int32 const *ascr,
+                     int topn, int16 *senone_scores, int start, int n)
+{
+    int i, k;
+
+    for (i = start; i < n; ++i) {
+        int32 tmp = mixw[0][i] + ascr[0];
+        for (k = 1; k < topn; ++k)
+            tmp = fast_logmath_add(la->lmath, tmp, mixw[k][i] + ascr[k]);
+        senone_scores[i] += tmp;
+    }
+}
+
+void
+tied_senone_sum_ref(tied_logadd_t const *la,
+                    uint8 const **mixw, int32 const *ascr,
+                    int topn, int16 *senone_scores, int n)
+{
+    tied_senone_sum_tail(la, mixw, ascr, topn, senone_scores, 0, n);
+}
+
+/*
+ * Vector versions of tied_senone_sum_ref(), which do fast_logmath_add()
+ * for several senones at once in 16-bit lanes.  The table lookup is
+ * replaced by counting the thresholds greater than the difference, so
+ * the results are exactly the same.  The last few senones of a run
+ * are done with the scalar code.
+ */
+#ifdef TIED_SIMD_SSE2
+static void
+tied_senone_sum_sse2(tied_logadd_t const *la,
+                     uint8 const **mixw, int32 const *ascr,
+                     int topn, int16 *senone_scores, int n)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i thresh[TIED_LOGADD_MAX_THRESH];
+    int i, k, t;
+
+    for (t = 0; t < la->n_thresh; ++t)
+        thresh[t] = _mm_set1_epi16(la->thresh[t]);
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m128i acc;
+
+        acc = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i const *)(mixw[0] + i)), zero);
+        acc = _mm_add_epi16(acc, _mm_set1_epi16(ascr[0]));
+        for (k = 1; k < topn; ++k) {
+            __m128i w, r, d, sub;
+
+            w = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i const *)(mixw[k] + i)), zero);
+            w = _mm_add_epi16(w, _mm_set1_epi16(ascr[k]));
+            r = _mm_min_epi16(acc, w);
+            d = _mm_sub_epi16(_mm_max_epi16(acc, w), r);
+            sub = zero;
+            for (t = 0; t < la->n_thresh; ++t)
+                sub = _mm_sub_epi16(sub, _mm_cmpgt_epi16(thresh[t], d));
+            acc = _mm_sub_epi16(r, sub);
+        }
+        _mm_storeu_si128((__m128i *)(senone_scores + i),
+                         _mm_add_epi16(acc, _mm_loadu_si128((__m128i *)(senone_scores + i))));
+    }
+    tied_senone_sum_tail(la, mixw, ascr, topn, senone_scores, i, n);
+}
+#endif /* TIED_SIMD_SSE2 */
+
+#ifdef TIED_SIMD_AVX2
+__attribute__((target("avx2")))
+static void
+tied_senone_sum_avx2(tied_logadd_t const *la,
+                     uint8 const **mixw, int32 const *ascr,
+                     int topn, int16 *senone_scores, int n)
+{
+    __m256i thresh[TIED_LOGADD_MAX_THRESH];
+    int i, k, t;
+
+    for (t = 0; t < la->n_thresh; ++t)
+        thresh[t] = _mm256_set1_epi16(la->thresh[t]);
+    for (i = 0; i + 16 <= n; i += 16) {
+        __m256i acc;
+
+        acc = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i const *)(mixw[0] + i)));
+        acc = _mm256_add_epi16(acc, _mm256_set1_epi16(ascr[0]));
+        for (k = 1; k < topn; ++k) {
+            __m256i w, r, d, sub;
+
+            w = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i const *)(mixw[k] + i)));
+            w = _mm256_add_epi16(w, _mm256_set1_epi16(ascr[k]));
+            r = _mm256_min_epi16(acc, w);
+            d = _mm256_sub_epi16(_mm256_max_epi16(acc, w), r);
+            sub = _mm256_setzero_si256();
+            for (t = 0; t < la->n_thresh; ++t)
+                sub = _mm256_sub_epi16(sub, _mm256_cmpgt_epi16(thresh[t], d));
+            acc = _mm256_sub_epi16(r, sub);
+        }
+        _mm256_storeu_si256((__m256i *)(senone_scores + i),
+                            _mm256_add_epi16(acc, _mm256_loadu_si256((__m256i *)(senone_scores + i))));
+    }
+    tied_senone_sum_tail(la, mixw, ascr, topn, senone_scores, i, n);
+}
+#endif /* TIED_SIMD_AVX2 */
+
+#ifdef TIED_SIMD_NEON
+static void
+tied_senone_sum_neon(tied_logadd_t const *la,
+                     uint8 const **mixw, int32 const *ascr,
+                     int topn, int16 *senone_scores, int n)
+{
+    int16x8_t thresh[TIED_LOGADD_MAX_THRESH];
+    int i, k, t;
+
+    for (t = 0; t < la->n_thresh; ++t)
+        thresh[t] = vdupq_n_s16(la->thresh[t]);
+    for (i = 0; i + 8 <= n; i += 8) {
+        int16x8_t acc;
+
+        acc = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(mixw[0] + i)));
+        acc = vaddq_s16(acc, vdupq_n_s16(ascr[0]));
+        for (k = 1; k < topn; ++k) {
+            int16x8_t w, r, d, sub;
+
+            w = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(mixw[k] + i)));
+            w = vaddq_s16(w, vdupq_n_s16(ascr[k]));
+            r = vminq_s16(acc, w);
+            d = vsubq_s16(vmaxq_s16(acc, w), r);
+            sub = vdupq_n_s16(0);
+            for (t = 0; t < la->n_thresh; ++t)
+                sub = vsubq_s16(sub, vreinterpretq_s16_u16(vcgtq_s16(thresh[t], d)));
+            acc = vsubq_s16(r, sub);
+        }
+        vst1q_s16(senone_scores + i, vaddq_s16(acc, vld1q_s16(senone_scores + i)));
+    }
+    tied_senone_sum_tail(la, mixw, ascr, topn, senone_scores, i, n);
+}
+#endif /* TIED_SIMD_NEON */
+
+void
+tied_logadd_init(tied_logadd_t *la, logmath_t *lmath_8b)
+{
+    logadd_t *t = LOGMATH_TABLE(lmath_8b);
+    uint8 const *table = (uint8 const *)t->table;
+    uint32 d;
+
+    memset(la, 0, sizeof(*la));
+    la->lmath = lmath_8b;
+    la->sum = tied_senone_sum_ref;
+    la->backend = "reference";
+
+    /* Find where the table drops below each value it takes.  It has
+     * to reach zero in the end, as scores further apart than its
+     * size add nothing. */
+    if (t->width != 1 || table[0] > TIED_LOGADD_MAX_THRESH
+        || table[t->table_size - 1] != 0) {
+        E_INFO("Log-add table is not suitable for vectorized senone scoring\n");
+        return;
+    }
+    la->n_thresh = table[0];
+    for (d = 1; d < t->table_size; ++d) {
+        int v;
+        if (table[d] > table[d - 1]) {
+            E_INFO("Log-add table is not monotonic, "
+                   "not using vectorized senone scoring\n");
+            la->n_thresh = 0;
+            return;
+        }
+        for (v = table[d]; v < table[d - 1]; ++v)
+            la->thresh[v] = d;
+    }
+#ifdef TIED_SIMD_NEON
+    la->sum = tied_senone_sum_neon;
+    la->backend = "neon";
+#endif
+#ifdef TIED_SIMD_SSE2
+    la->sum = tied_senone_sum_sse2;
+    la->backend = "sse2";
+#endif
+#ifdef TIED_SIMD_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        la->sum = tied_senone_sum_avx2;
+        la->backend = "avx2";
+    }
+#endif
+}
+
+void
+tied_ds_init(tied_ds_t *ds, cmd_ln_t *config, int32 veclen)
+{
+    ds->ratio = cmd_ln_int32_r(config, "-ds");
+    ds->thresh = cmd_ln_float32_r(config, "-ds_thresh");
+    if (ds->ratio < 1)
+        ds->ratio = 1;
+    ds->veclen = veclen;
+    ds->ref = NULL;
+    ds->n_skip = 0;
+    if (ds->thresh > 0) {
+        ds->ref = ckd_calloc(veclen, sizeof(*ds->ref));
+        E_INFO("Adaptive downsampling: change threshold %g, up to %d frames\n",
+               ds->thresh, ds->ratio - 1);
+    }
+}
+
+int
+tied_ds_skip(tied_ds_t *ds, mfcc_t const *feat, int32 frame)
+{
+    float32 change;
+    int32 i;
+
+    if (ds->ref == NULL)
+        return frame % ds->ratio != 0;
+
+    if (frame > 0 && ds->n_skip < ds->ratio - 1) {
+        change = 0;
+        for (i = 0; i < ds->veclen; ++i) {
+            float32 d = MFCC2FLOAT(feat[i]) - ds->ref[i];
+            change += d * d;
+        }
+        if (change < ds->thresh * ds->veclen) {
+            ++ds->n_skip;
+            return TRUE;
+        }
+    }
+    for (i = 0; i < ds->veclen; ++i)
+        ds->ref[i] = MFCC2FLOAT(feat[i]);
+    ds->n_skip = 0;
+    return FALSE;
+}
+
+void
+tied_ds_free(tied_ds_t *ds)
+{
+    ckd_free(ds->ref);
+    ds->ref = NULL;
+}
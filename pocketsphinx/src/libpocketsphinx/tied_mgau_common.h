@@ -45,6 +45,8 @@
 
 #include <sphinxbase/logmath.h>
 #include <sphinxbase/fixpoint.h>
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/fe.h>
 
 #define MGAU_MIXW_VERSION	"1.0"   /* Sphinx-3 file format version for mixw */
 #define MGAU_PARAM_VERSION	"1.0"   /* Sphinx-3 file format version for mean/var */
@@ -118,4 +120,95 @@ fast_logmath_add(logmath_t *lmath, int mlx, int mly)
     return r - (((uint8 *)t->table)[d]);
 }
 
+/** Maximum number of thresholds in a tied_logadd_t. */
+#define TIED_LOGADD_MAX_THRESH 16
+
+typedef struct tied_logadd_s tied_logadd_t;
+
+/**
+ * Function computing senone scores for a run of senones, see
+ * tied_senone_sum().
+ */
+typedef void (*tied_senone_sum_f)(tied_logadd_t const *la,
+                                  uint8 const **mixw, int32 const *ascr,
+                                  int topn, int16 *senone_scores, int n);
+
+/**
+ * Log-add table in the form used by the vectorized senone scoring.
+ *
+ * The values in the 8-bit table used by fast_logmath_add() only ever
+ * decrease, so table[d] is the number of thresholds greater than d,
+ * which can be computed for several senones at once with a few
+ * comparisons instead of a table lookup.
+ */
+struct tied_logadd_s {
+    logmath_t *lmath;       /**< Log-add table (not retained). */
+    int16 thresh[TIED_LOGADD_MAX_THRESH]; /**< First d where table[d] < i + 1. */
+    int n_thresh;           /**< Number of thresholds, or 0 if not usable. */
+    tied_senone_sum_f sum;  /**< Best senone scoring code for this machine. */
+    char const *backend;    /**< Name of the senone scoring code. */
+};
+
+/**
+ * Set up vectorized senone scoring for an 8-bit log-add table.
+ *
+ * If the table is too large or not suitable, this falls back to the
+ * scalar code, which always gives the same results.
+ */
+void tied_logadd_init(tied_logadd_t *la, logmath_t *lmath_8b);
+
+/**
+ * Add the log-sum of mixture weights and top-N scores for a run of
+ * senones to their scores.
+ *
+ * @param mixw Negated mixture weights for each top-N codeword,
+ *             pointing at the first senone of the run, which are
+ *             contiguous.
+ * @param ascr Negated normalized scores for each top-N codeword.
+ * @param topn Number of top-N codewords (at least 1).
+ * @param senone_scores Scores for the senones of the run, which
+ *                      are added to.
+ * @param n Number of senones in the run.
+ */
+#define tied_senone_sum(la, mixw, ascr, topn, senone_scores, n) \
+    (*(la)->sum)(la, mixw, ascr, topn, senone_scores, n)
+
+/**
+ * Scalar version of tied_senone_sum(), for reference.
+ */
+void tied_senone_sum_ref(tied_logadd_t const *la,
+                         uint8 const **mixw, int32 const *ascr,
+                         int topn, int16 *senone_scores, int n);
+
+/**
+ * Frame downsampling of codebook evaluation.  On skipped frames only
+ * the previous frame's top-N codewords are rescored.  Frames are
+ * either skipped on a fixed schedule (every one but each -ds'th), or,
+ * with -ds_thresh, whenever the features have changed little since
+ * the last fully evaluated frame, so that transients are still fully
+ * evaluated and steady segments can be skipped longer.
+ */
+typedef struct tied_ds_s {
+    int32 ratio;        /**< Downsampling ratio, or longest stride if adaptive. */
+    float32 thresh;     /**< Mean squared change threshold, 0 if fixed. */
+    int32 veclen;       /**< Length of the feature stream compared. */
+    float32 *ref;       /**< Features of the last fully evaluated frame. */
+    int32 n_skip;       /**< Frames skipped since then. */
+} tied_ds_t;
+
+/**
+ * Set up downsampling from -ds and -ds_thresh, comparing the first
+ * veclen values of the first feature stream.
+ */
+void tied_ds_init(tied_ds_t *ds, cmd_ln_t *config, int32 veclen);
+
+/**
+ * Decide whether codebook evaluation can be skipped for a frame.
+ * Frames must be passed in order, starting from 0 for each utterance.
+ * @return TRUE to skip, FALSE to evaluate the full codebooks.
+ */
+int tied_ds_skip(tied_ds_t *ds, mfcc_t const *feat, int32 frame);
+
+void tied_ds_free(tied_ds_t *ds);
+
 #endif /* __TIED_MGAU_COMMON_H__ */
@@ -46,6 +46,7 @@
 
 /* Local headers. */
 #include "tmat.h"
+#include "am_image.h"
 #include "hmm.h"
 #include "vector.h"
 
@@ -150,6 +151,7 @@ tmat_init(char const *file_name, logmath_t *lmath, float64 tpfloor, int32 brepor
     }
 
     t = (tmat_t *) ckd_calloc(1, sizeof(tmat_t));
+    t->refcount = 1;
 
     if ((fp = fopen(file_name, "rb")) == NULL)
         E_FATAL_SYSTEM("Failed to open transition file '%s' for reading", file_name);
@@ -271,12 +273,34 @@ tmat_report(tmat_t * t)
 /* 
  *  RAH, Free memory allocated in tmat_init ()
  */
+tmat_t *
+tmat_retain(tmat_t *t)
+{
+    ++t->refcount;
+    return t;
+}
+
 void
 tmat_free(tmat_t * t)
 {
-    if (t) {
-        if (t->tp)
+    if (t && --t->refcount == 0) {
+        if (t->image) {
+            ckd_free_3d_ptr(t->tp);
+            am_image_free(t->image);
+        }
+        else if (t->tp)
             ckd_free_3d(t->tp);
         ckd_free(t);
     }
 }
+
+size_t
+tmat_mem_size(tmat_t * t)
+{
+    size_t size;
+
+    size = sizeof(*t) + t->n_tmat * (t->n_state + 1) * sizeof(uint8 *);
+    if (t->image == NULL)
+        size += t->n_tmat * t->n_state * (t->n_state + 1) * sizeof(uint8);
+    return size;
+}
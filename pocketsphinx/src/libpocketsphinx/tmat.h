@@ -58,6 +58,8 @@ typedef struct {
     int16 n_tmat;	/**< Number matrices */
     int16 n_state;	/**< Number source states in matrix (only the emitting states);
 			   Number destination states = n_state+1, it includes the exit state */
+    int refcount;       /**< Reference count. */
+    struct am_image_s *image; /**< Image the parameters point into, or NULL. */
 } tmat_t;
 
 
@@ -78,13 +80,27 @@ void tmat_dump (tmat_t *tmat,  /**< In: transition matrix */
     );	
 
 
+/**
+ * Retain a pointer to a set of transition matrices, to share it.
+ */
+tmat_t *tmat_retain(tmat_t *t /**< In: transition matrix */
+    );
+
 /**
  * RAH, add code to remove memory allocated by tmat_init
+ * (releases a reference, freeing it if this was the last one)
  */
 
 void tmat_free (tmat_t *t /**< In: transition matrix */
     );
 
+/**
+ * Get the number of bytes of heap memory used by a set of transition
+ * matrices, not counting an acoustic model image they point into.
+ */
+size_t tmat_mem_size(tmat_t *t /**< In: transition matrix */
+    );
+
 /**
  * Report the detail of the transition matrix structure. 
  */
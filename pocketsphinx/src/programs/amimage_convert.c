@@ -0,0 +1,203 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * amimage_convert.c - compile acoustic model parameters into an image
+ *
+ * The image holds the transition matrices, the Gaussians with their
+ * precomputed variances and determinants, and the quantized mixture
+ * weights, already in the form used by the decoder, so that it can
+ * map them into memory instead of reading and converting them.
+ **/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/strfuncs.h>
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+
+#include <pocketsphinx.h>
+
+#include "am_image.h"
+#include "bin_mdef.h"
+
+static const arg_t defn[] = {
+    { "-hmm",
+      ARG_STRING,
+      NULL,
+      "Directory containing acoustic model files." },
+    { "-mdef",
+      ARG_STRING,
+      NULL,
+      "Model definition input file (default: mdef in -hmm)" },
+    { "-mean",
+      ARG_STRING,
+      NULL,
+      "Mixture gaussian means input file (default: means in -hmm)" },
+    { "-var",
+      ARG_STRING,
+      NULL,
+      "Mixture gaussian variances input file (default: variances in -hmm)" },
+    { "-mixw",
+      ARG_STRING,
+      NULL,
+      "Senone mixture weights input file (default: mixture_weights in -hmm)" },
+    { "-tmat",
+      ARG_STRING,
+      NULL,
+      "HMM state transition matrix input file (default: transition_matrices in -hmm)" },
+    { "-senmgau",
+      ARG_STRING,
+      NULL,
+      "Senone to codebook mapping input file (default: senmgau in -hmm, if present)" },
+    { "-varfloor",
+      ARG_FLOAT32,
+      "0.0001",
+      "Mixture gaussian variance floor (applied to data from -var file)" },
+    { "-mixwfloor",
+      ARG_FLOAT32,
+      "0.0000001",
+      "Senone mixture weights floor (applied to data from -mixw file)" },
+    { "-tmatfloor",
+      ARG_FLOAT32,
+      "0.0001",
+      "HMM state transition probability floor (applied to -tmat file)" },
+    { "-logbase",
+      ARG_FLOAT32,
+      "1.0001",
+      "Base in which all log-likelihoods calculated" },
+    { "-amimage",
+      ARG_STRING,
+      NULL,
+      "Image output file (default: am_image in -hmm)" },
+    CMDLN_EMPTY_OPTION
+};
+
+static int
+file_exists(const char *path)
+{
+    FILE *tmp;
+
+    tmp = fopen(path, "rb");
+    if (tmp) fclose(tmp);
+    return (tmp != NULL);
+}
+
+static char *
+model_file(cmd_ln_t *config, char const *arg, char const *file)
+{
+    char const *hmmdir;
+
+    if (cmd_ln_str_r(config, arg))
+        return ckd_salloc(cmd_ln_str_r(config, arg));
+    if ((hmmdir = cmd_ln_str_r(config, "-hmm")) == NULL)
+        return NULL;
+    return string_join(hmmdir, "/", file, NULL);
+}
+
+int
+main(int argc, char *argv[])
+{
+    cmd_ln_t *config;
+    logmath_t *lmath;
+    bin_mdef_t *mdef;
+    gauden_t *g;
+    senone_t *s;
+    tmat_t *t;
+    char *mdeffn, *meanfn, *varfn, *mixwfn, *tmatfn, *senmgaufn, *outfn;
+    int32 rv;
+
+    if ((config = cmd_ln_parse_r(NULL, defn, argc, argv, TRUE)) == NULL)
+        return 1;
+
+    mdeffn = model_file(config, "-mdef", "mdef");
+    meanfn = model_file(config, "-mean", "means");
+    varfn = model_file(config, "-var", "variances");
+    mixwfn = model_file(config, "-mixw", "mixture_weights");
+    tmatfn = model_file(config, "-tmat", "transition_matrices");
+    senmgaufn = model_file(config, "-senmgau", "senmgau");
+    outfn = model_file(config, "-amimage", "am_image");
+    if (senmgaufn && cmd_ln_str_r(config, "-senmgau") == NULL
+        && !file_exists(senmgaufn)) {
+        ckd_free(senmgaufn);
+        senmgaufn = NULL;
+    }
+
+    rv = 1;
+    lmath = NULL;
+    mdef = NULL;
+    g = NULL;
+    s = NULL;
+    t = NULL;
+    if (mdeffn == NULL || meanfn == NULL || varfn == NULL
+        || mixwfn == NULL || tmatfn == NULL || outfn == NULL) {
+        E_ERROR("Need either -hmm or all of -mdef, -mean, -var, -mixw, "
+                "-tmat and -amimage\n");
+        goto error_out;
+    }
+
+    lmath = logmath_init(cmd_ln_float32_r(config, "-logbase"), 0, 0);
+    if ((mdef = bin_mdef_read(NULL, mdeffn)) == NULL)
+        goto error_out;
+    if ((g = gauden_init(meanfn, varfn, cmd_ln_float32_r(config, "-varfloor"),
+                         lmath)) == NULL)
+        goto error_out;
+    if ((s = senone_init(g, mixwfn, senmgaufn,
+                         cmd_ln_float32_r(config, "-mixwfloor"),
+                         lmath, mdef)) == NULL)
+        goto error_out;
+    if ((t = tmat_init(tmatfn, lmath, cmd_ln_float32_r(config, "-tmatfloor"),
+                       TRUE)) == NULL)
+        goto error_out;
+    if (am_image_write(outfn, g, s, t, config) < 0)
+        goto error_out;
+    rv = 0;
+
+error_out:
+    tmat_free(t);
+    senone_free(s);
+    gauden_free(g);
+    bin_mdef_free(mdef);
+    logmath_free(lmath);
+    ckd_free(mdeffn);
+    ckd_free(meanfn);
+    ckd_free(varfn);
+    ckd_free(mixwfn);
+    ckd_free(tmatfn);
+    ckd_free(senmgaufn);
+    ckd_free(outfn);
+    cmd_ln_free_r(config);
+    return rv;
+}
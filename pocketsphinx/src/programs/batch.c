@@ -37,6 +37,11 @@
 
 /* System headers. */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
 
 /* SphinxBase headers. */
 #include <sphinxbase/pio.h>
@@ -44,6 +49,7 @@
 #include <sphinxbase/strfuncs.h>
 #include <sphinxbase/filename.h>
 #include <sphinxbase/byteorder.h>
+#include <sphinxbase/profile.h>
 
 /* PocketSphinx headers. */
 #include <pocketsphinx.h>
@@ -179,9 +185,41 @@ static const arg_t ps_args_def[] = {
       "0",
       "Number of N-best hypotheses to write to -nbestdir (0 for no N-best)" },
 
+    /* Benchmarking. */
+    { "-ref",
+      ARG_STRING,
+      NULL,
+      "Reference transcripts, one per line of the control file, for word error rate" },
+    { "-livesim",
+      ARG_INT32,
+      "0",
+      "Feed raw audio to the decoder in blocks of this many samples, as it would arrive live, and time each block (0 to decode whole files)" },
+    { "-benchout",
+      ARG_STRING,
+      NULL,
+      "File to append one line of benchmark results to (JSON)" },
+    { "-benchname",
+      ARG_STRING,
+      NULL,
+      "Name of this configuration in benchmark results" },
+
     CMDLN_EMPTY_OPTION
 };
 
+/**
+ * Statistics for benchmark results.
+ */
+typedef struct batch_stats_s {
+    int32 n_utt;        /**< Utterances decoded. */
+    int32 n_ref_words;  /**< Words in reference transcripts. */
+    int32 n_errors;     /**< Word errors against reference transcripts. */
+    float64 *block_lat; /**< Time taken to process each block of live input. */
+    int32 n_block;      /**< Number of entries in block_lat. */
+    int32 n_block_alloc;/**< Allocated entries in block_lat. */
+    float64 end_lat;    /**< Total time taken to end utterances of live input. */
+    float64 max_end_lat;/**< Longest time taken to end an utterance. */
+} batch_stats_t;
+
 static mfcc_t **
 read_mfc_file(FILE *infh, int sf, int ef, int *out_nfr, int ceplen)
 {
@@ -363,9 +401,60 @@ build_outdirs(cmd_ln_t *config, char const *uttid)
     return 0;
 }
 
+/**
+ * Decode raw audio a block at a time, timing each block.
+ */
+static void
+decode_raw_live(ps_decoder_t *ps, FILE *infh, int32 maxsamps,
+                int32 blocksize, batch_stats_t *stats)
+{
+    int16 *data;
+    ptmr_t tm;
+    size_t nread;
+    int32 total;
+
+    data = ckd_calloc(blocksize, sizeof(*data));
+    ptmr_init(&tm);
+    ps_start_stream(ps);
+    ps_start_utt(ps);
+    total = 0;
+    while (maxsamps == -1 || total < maxsamps) {
+        int32 n = blocksize;
+
+        if (maxsamps != -1 && maxsamps - total < n)
+            n = maxsamps - total;
+        if ((nread = fread(data, sizeof(*data), n, infh)) == 0)
+            break;
+        total += nread;
+
+        ptmr_reset(&tm);
+        ptmr_start(&tm);
+        ps_process_raw(ps, data, nread, FALSE, FALSE);
+        ptmr_stop(&tm);
+        if (stats->n_block == stats->n_block_alloc) {
+            stats->n_block_alloc = stats->n_block_alloc * 2 + 256;
+            stats->block_lat = ckd_realloc(stats->block_lat,
+                                           stats->n_block_alloc
+                                           * sizeof(*stats->block_lat));
+        }
+        stats->block_lat[stats->n_block++] = tm.t_elapsed;
+    }
+    /* The time taken to finish up once the input ends is what a user
+     * waits for, so it is recorded separately. */
+    ptmr_reset(&tm);
+    ptmr_start(&tm);
+    ps_end_utt(ps);
+    ptmr_stop(&tm);
+    stats->end_lat += tm.t_elapsed;
+    if (tm.t_elapsed > stats->max_end_lat)
+        stats->max_end_lat = tm.t_elapsed;
+    ckd_free(data);
+}
+
 static int
 process_ctl_line(ps_decoder_t *ps, cmd_ln_t *config,
-                 char const *file, char const *uttid, int32 sf, int32 ef)
+                 char const *file, char const *uttid, int32 sf, int32 ef,
+                 batch_stats_t *stats)
 {
     FILE *infh;
     char const *cepdir, *cepext;
@@ -411,7 +500,11 @@ process_ctl_line(ps_decoder_t *ps, cmd_ln_t *config,
                      * (cmd_ln_float32_r(config, "-samprate")
                         / cmd_ln_int32_r(config, "-frate")));
         fseek(infh, cmd_ln_int32_r(config, "-adchdr") + sf * sizeof(int16), SEEK_SET);
-        ps_decode_raw(ps, infh, ef);
+        if (cmd_ln_int32_r(config, "-livesim") > 0)
+            decode_raw_live(ps, infh, ef, cmd_ln_int32_r(config, "-livesim"),
+                            stats);
+        else
+            ps_decode_raw(ps, infh, ef);
     }
     else {
         mfcc_t **mfcs;
@@ -589,6 +682,141 @@ write_ctm(FILE *fh, ps_decoder_t *ps, ps_seg_t *itor, char const *uttid, int32 f
     return 0;
 }
 
+/**
+ * Count word errors (substitutions, insertions, deletions) in a hypothesis.
+ */
+static int32
+count_word_errors(char const *hyp, char const *ref, int32 *out_n_ref)
+{
+    char *hypstr, *refstr, **hypw, **refw;
+    int32 *prev, *cur, n_hyp, n_ref, i, j, n_err;
+
+    hypstr = ckd_salloc(hyp ? hyp : "");
+    refstr = ckd_salloc(ref);
+    n_hyp = str2words(hypstr, NULL, 0);
+    n_ref = str2words(refstr, NULL, 0);
+    hypw = ckd_calloc(n_hyp + 1, sizeof(*hypw));
+    refw = ckd_calloc(n_ref + 1, sizeof(*refw));
+    str2words(hypstr, hypw, n_hyp);
+    str2words(refstr, refw, n_ref);
+    /* References may end with the utterance ID in parentheses, and
+     * contain sentence markers and silences which are not scored. */
+    if (n_ref > 0 && refw[n_ref - 1][0] == '('
+        && refw[n_ref - 1][strlen(refw[n_ref - 1]) - 1] == ')')
+        --n_ref;
+    for (i = j = 0; i < n_ref; ++i) {
+        if (0 == strcmp(refw[i], "<s>") || 0 == strcmp(refw[i], "</s>")
+            || 0 == strcmp(refw[i], "<sil>"))
+            continue;
+        refw[j++] = refw[i];
+    }
+    n_ref = j;
+
+    /* Edit distance, keeping one row at a time. */
+    prev = ckd_calloc(n_hyp + 1, sizeof(*prev));
+    cur = ckd_calloc(n_hyp + 1, sizeof(*cur));
+    for (j = 0; j <= n_hyp; ++j)
+        prev[j] = j;
+    for (i = 1; i <= n_ref; ++i) {
+        int32 *tmp;
+        cur[0] = i;
+        for (j = 1; j <= n_hyp; ++j) {
+            int32 best = prev[j - 1]
+                + (strcmp(refw[i - 1], hypw[j - 1]) != 0);
+            if (prev[j] + 1 < best)
+                best = prev[j] + 1;
+            if (cur[j - 1] + 1 < best)
+                best = cur[j - 1] + 1;
+            cur[j] = best;
+        }
+        tmp = prev;
+        prev = cur;
+        cur = tmp;
+    }
+    n_err = prev[n_hyp];
+
+    ckd_free(prev);
+    ckd_free(cur);
+    ckd_free(hypw);
+    ckd_free(refw);
+    ckd_free(hypstr);
+    ckd_free(refstr);
+    *out_n_ref = n_ref;
+    return n_err;
+}
+
+static int
+cmp_float64(const void *a, const void *b)
+{
+    float64 x = *(float64 const *)a, y = *(float64 const *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Write one line of benchmark results in JSON.
+ */
+static void
+write_bench(FILE *fh, ps_decoder_t *ps, cmd_ln_t *config,
+            batch_stats_t *stats)
+{
+    static const char *stage_names[PS_N_STAGES] = {
+        "fe", "feat", "gmm", "hmm", "word", "lattice"
+    };
+    ps_stats_t all;
+    double n_speech, n_cpu, n_wall;
+    char const *name;
+    int i;
+
+    ps_get_all_time(ps, &n_speech, &n_cpu, &n_wall);
+    ps_get_stats(ps, NULL, &all);
+    if ((name = cmd_ln_str_r(config, "-benchname")) == NULL)
+        name = ps_get_search(ps) ? ps_get_search(ps) : "";
+    fprintf(fh, "{\"name\": \"%s\", \"utts\": %d, \"frames\": %d, "
+            "\"audio_sec\": %.2f, \"cpu_sec\": %.3f, \"wall_sec\": %.3f, "
+            "\"cpu_xrt\": %.4f, \"wall_xrt\": %.4f, "
+            "\"hmm_per_frame\": %.1f, \"lm_per_frame\": %.1f",
+            name, stats->n_utt, all.n_frame, n_speech, n_cpu, n_wall,
+            n_speech > 0 ? n_cpu / n_speech : 0.0,
+            n_speech > 0 ? n_wall / n_speech : 0.0,
+            all.n_frame > 0 ? (double)all.n_hmm_eval / all.n_frame : 0.0,
+            all.n_frame > 0 ? (double)all.n_lm_query / all.n_frame : 0.0);
+    if (cmd_ln_boolean_r(config, "-stagetime")) {
+        for (i = 0; i < PS_N_STAGES; ++i)
+            fprintf(fh, ", \"%s_xrt\": %.4f", stage_names[i],
+                    n_speech > 0 ? all.cpu[i] / n_speech : 0.0);
+    }
+    if (stats->n_block > 0) {
+        float64 *lat = stats->block_lat;
+        int32 n = stats->n_block;
+
+        qsort(lat, n, sizeof(*lat), cmp_float64);
+        fprintf(fh, ", \"block_ms\": %.1f, \"lat_p50_ms\": %.3f, "
+                "\"lat_p90_ms\": %.3f, \"lat_p99_ms\": %.3f, "
+                "\"lat_max_ms\": %.3f, \"end_mean_ms\": %.3f, "
+                "\"end_max_ms\": %.3f",
+                cmd_ln_int32_r(config, "-livesim") * 1000.0
+                / cmd_ln_float32_r(config, "-samprate"),
+                lat[n / 2] * 1000, lat[n * 9 / 10] * 1000,
+                lat[n * 99 / 100] * 1000, lat[n - 1] * 1000,
+                stats->n_utt > 0 ? stats->end_lat * 1000 / stats->n_utt : 0.0,
+                stats->max_end_lat * 1000);
+    }
+    if (stats->n_ref_words > 0)
+        fprintf(fh, ", \"ref_words\": %d, \"errors\": %d, \"wer\": %.4f",
+                stats->n_ref_words, stats->n_errors,
+                (double)stats->n_errors / stats->n_ref_words);
+#if !defined(_WIN32)
+    {
+        struct rusage ru;
+
+        getrusage(RUSAGE_SELF, &ru);
+        fprintf(fh, ", \"peak_rss_kb\": %ld", (long)ru.ru_maxrss);
+    }
+#endif
+    fprintf(fh, "}\n");
+    fflush(fh);
+}
+
 static void
 process_ctl(ps_decoder_t *ps, cmd_ln_t *config, FILE *ctlfh)
 {
@@ -598,6 +826,8 @@ process_ctl(ps_decoder_t *ps, cmd_ln_t *config, FILE *ctlfh)
     size_t len;
     FILE *hypfh = NULL, *hypsegfh = NULL, *ctmfh = NULL;
     FILE *mllrfh = NULL, *lmfh = NULL, *fsgfh = NULL;
+    FILE *reffh = NULL, *benchfh = NULL;
+    batch_stats_t stats;
     double n_speech, n_cpu, n_wall;
     char const *outlatdir;
     char const *nbestdir;
@@ -610,6 +840,7 @@ process_ctl(ps_decoder_t *ps, cmd_ln_t *config, FILE *ctlfh)
     outlatdir = cmd_ln_str_r(config, "-outlatdir");
     nbestdir = cmd_ln_str_r(config, "-nbestdir");
     frate = cmd_ln_int32_r(config, "-frate");
+    memset(&stats, 0, sizeof(stats));
 
     if ((str = cmd_ln_str_r(config, "-mllrctl"))) {
         mllrfh = fopen(str, "r");
@@ -632,6 +863,20 @@ process_ctl(ps_decoder_t *ps, cmd_ln_t *config, FILE *ctlfh)
             goto done;
         }
     }
+    if ((str = cmd_ln_str_r(config, "-ref"))) {
+        reffh = fopen(str, "r");
+        if (reffh == NULL) {
+            E_ERROR_SYSTEM("Failed to open reference file %s", str);
+            goto done;
+        }
+    }
+    if ((str = cmd_ln_str_r(config, "-benchout"))) {
+        benchfh = fopen(str, "a");
+        if (benchfh == NULL) {
+            E_ERROR_SYSTEM("Failed to open benchmark output %s", str);
+            goto done;
+        }
+    }
     if ((str = cmd_ln_str_r(config, "-hyp"))) {
         hypfh = fopen(str, "w");
         if (hypfh == NULL) {
@@ -662,6 +907,7 @@ process_ctl(ps_decoder_t *ps, cmd_ln_t *config, FILE *ctlfh)
         char *wptr[4];
         int32 nf, sf, ef;
         char *mllrline = NULL, *lmline = NULL, *fsgline = NULL;
+        char *refline = NULL;
         char *fsgfile = NULL, *lmname = NULL, *mllrfile = NULL;
 
         if (mllrfh) {
@@ -694,6 +940,14 @@ process_ctl(ps_decoder_t *ps, cmd_ln_t *config, FILE *ctlfh)
             }
             fsgfile = string_trim(fsgline, STRING_BOTH);
         }
+        if (reffh) {
+            refline = fread_line(reffh, &len);
+            if (refline == NULL) {
+                E_ERROR("File size mismatch between control and reference file\n");
+                ckd_free(line);
+                goto done;
+            }
+        }
 
         if (i < ctloffset) {
             i += ctlincr;
@@ -730,14 +984,20 @@ process_ctl(ps_decoder_t *ps, cmd_ln_t *config, FILE *ctlfh)
 
             /* Do actual decoding. */
             if(process_mllrctl_line(ps, config, mllrfile) < 0)
-                continue;
+                goto nextline;
             if(process_lmnamectl_line(ps, config, lmname) < 0)
-                continue;
+                goto nextline;
             if(process_fsgctl_line(ps, config, fsgfile) < 0)
-                continue;
-            if(process_ctl_line(ps, config, file, uttid, sf, ef) < 0)
-                continue;
+                goto nextline;
+            if(process_ctl_line(ps, config, file, uttid, sf, ef, &stats) < 0)
+                goto nextline;
             hyp = ps_get_hyp(ps, &score);
+            ++stats.n_utt;
+            if (refline) {
+                int32 n_ref;
+                stats.n_errors += count_word_errors(hyp, refline, &n_ref);
+                stats.n_ref_words += n_ref;
+            }
             
             /* Write out results and such. */
             if (hypfh) {
@@ -770,6 +1030,7 @@ process_ctl(ps_decoder_t *ps, cmd_ln_t *config, FILE *ctlfh)
         ckd_free(mllrline);
         ckd_free(fsgline);
         ckd_free(lmline);
+        ckd_free(refline);
         ckd_free(line);
     }
 
@@ -778,8 +1039,19 @@ process_ctl(ps_decoder_t *ps, cmd_ln_t *config, FILE *ctlfh)
            n_speech, n_cpu, n_wall);
     E_INFO("AVERAGE %.2f xRT (CPU), %.2f xRT (elapsed)\n",
            n_cpu / n_speech, n_wall / n_speech);
+    if (stats.n_ref_words > 0)
+        E_INFO("WER %.2f%% (%d errors, %d words)\n",
+               100.0 * stats.n_errors / stats.n_ref_words,
+               stats.n_errors, stats.n_ref_words);
+    if (benchfh)
+        write_bench(benchfh, ps, config, &stats);
 
 done:
+    ckd_free(stats.block_lat);
+    if (reffh)
+        fclose(reffh);
+    if (benchfh)
+        fclose(benchfh);
     if (hypfh)
         fclose(hypfh);
     if (hypsegfh)
@@ -95,6 +95,7 @@ static const arg_t cont_args_def[] = {
 static ps_decoder_t *ps;
 static cmd_ln_t *config;
 static FILE *rawfd;
+static uint8 utt_started;
 
 static void
 print_word_times()
@@ -230,50 +231,72 @@ sleep_msec(int32 ms)
  *        print utterance result;
  *     }
  */
+static void
+process_mic_audio(int16 const *buf, int32 n)
+{
+    uint8 in_speech;
+    char const *hyp;
+
+    /* Silence is dropped by the front end, so this costs little
+     * more than voice activity detection until speech starts. */
+    ps_process_raw(ps, buf, n, FALSE, FALSE);
+    in_speech = ps_get_in_speech(ps);
+    if (in_speech && !utt_started) {
+        utt_started = TRUE;
+        E_INFO("Listening...\n");
+    }
+    if (!in_speech && utt_started) {
+        /* speech -> silence transition, time to start new utterance  */
+        ps_end_utt(ps);
+        hyp = ps_get_hyp(ps, NULL );
+        if (hyp != NULL) {
+            printf("%s\n", hyp);
+            fflush(stdout);
+        }
+
+        if (ps_start_utt(ps) < 0)
+            E_FATAL("Failed to start utterance\n");
+        utt_started = FALSE;
+        E_INFO("Ready....\n");
+    }
+}
+
+static void
+mic_callback(ad_rec_t *ad, int16 const *buf, int32 n, void *data)
+{
+    process_mic_audio(buf, n);
+}
+
 static void
 recognize_from_microphone()
 {
     ad_rec_t *ad;
     int16 adbuf[2048];
-    uint8 utt_started, in_speech;
     int32 k;
-    char const *hyp;
 
     if ((ad = ad_open_dev(cmd_ln_str_r(config, "-adcdev"),
                           (int) cmd_ln_float32_r(config,
                                                  "-samprate"))) == NULL)
         E_FATAL("Failed to open audio device\n");
-    if (ad_start_rec(ad) < 0)
-        E_FATAL("Failed to start recording\n");
 
     if (ps_start_utt(ps) < 0)
         E_FATAL("Failed to start utterance\n");
     utt_started = FALSE;
     E_INFO("Ready....\n");
 
+    /* Where the device can deliver audio as it is captured, decode it
+     * right there instead of polling for it. */
+    if (ad_start_callback(ad, mic_callback, NULL) == 0) {
+        for (;;)
+            sleep_msec(1000);
+    }
+
+    if (ad_start_rec(ad) < 0)
+        E_FATAL("Failed to start recording\n");
     for (;;) {
         if ((k = ad_read(ad, adbuf, 2048)) < 0)
             E_FATAL("Failed to read audio\n");
-        ps_process_raw(ps, adbuf, k, FALSE, FALSE);
-        in_speech = ps_get_in_speech(ps);
-        if (in_speech && !utt_started) {
-            utt_started = TRUE;
-            E_INFO("Listening...\n");
-        }
-        if (!in_speech && utt_started) {
-            /* speech -> silence transition, time to start new utterance  */
-            ps_end_utt(ps);
-            hyp = ps_get_hyp(ps, NULL );
-            if (hyp != NULL) {
-                printf("%s\n", hyp);
-                fflush(stdout);
-            }
-
-            if (ps_start_utt(ps) < 0)
-                E_FATAL("Failed to start utterance\n");
-            utt_started = FALSE;
-            E_INFO("Ready....\n");
-        }
+        process_mic_audio(adbuf, k);
         sleep_msec(100);
     }
     ad_close(ad);
@@ -0,0 +1,326 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * gauden_convert.c - convert Gaussian codebooks to 8-bit quantized form
+ *
+ * Optionally, this also measures how much the quantization changes
+ * the Gaussian densities computed for a set of feature files.
+ **/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/feat.h>
+#include <sphinxbase/filename.h>
+#include <sphinxbase/pio.h>
+#include <sphinxbase/strfuncs.h>
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+
+#include <pocketsphinx.h>
+
+#include "ms_gauden.h"
+
+static const arg_t defn[] = {
+    { "-hmm",
+      ARG_STRING,
+      NULL,
+      "Directory containing acoustic model files." },
+    { "-mean",
+      ARG_STRING,
+      NULL,
+      "Mixture gaussian means input file (default: means in -hmm)" },
+    { "-var",
+      ARG_STRING,
+      NULL,
+      "Mixture gaussian variances input file (default: variances in -hmm)" },
+    { "-varfloor",
+      ARG_FLOAT32,
+      "0.0001",
+      "Mixture gaussian variance floor (applied to data from -var file)" },
+    { "-gauq8",
+      ARG_STRING,
+      NULL,
+      "Quantized codebook output file (default: gaussians_q8 in -hmm)" },
+    { "-ctl",
+      ARG_STRING,
+      NULL,
+      "Control file listing feature files to measure quantization error on" },
+    { "-cepdir",
+      ARG_STRING,
+      NULL,
+      "Directory for feature files in -ctl" },
+    { "-cepext",
+      ARG_STRING,
+      ".mfc",
+      "Extension for feature files in -ctl" },
+    { "-topn",
+      ARG_INT32,
+      "4",
+      "Number of top Gaussians to compare" },
+    { "-featparams",
+      ARG_STRING,
+      NULL,
+      "File containing feature extraction parameters (default: feat.params in -hmm)" },
+    { "-logbase",
+      ARG_FLOAT32,
+      "1.0001",
+      "Base in which all log-likelihoods calculated" },
+    waveform_to_cepstral_command_line_macro(),
+    cepstral_to_feature_command_line_macro(),
+    CMDLN_EMPTY_OPTION
+};
+
+static int
+file_exists(const char *path)
+{
+    FILE *tmp;
+
+    tmp = fopen(path, "rb");
+    if (tmp) fclose(tmp);
+    return (tmp != NULL);
+}
+
+static char *
+model_file(cmd_ln_t *config, char const *arg, char const *file)
+{
+    char const *hmmdir;
+
+    if (cmd_ln_str_r(config, arg))
+        return ckd_salloc(cmd_ln_str_r(config, arg));
+    if ((hmmdir = cmd_ln_str_r(config, "-hmm")) == NULL)
+        return NULL;
+    return string_join(hmmdir, "/", file, NULL);
+}
+
+/* Index of the best density in a list from gauden_dist(). */
+static int
+best_dist(gauden_dist_t const *dist, int n)
+{
+    int i, best = 0;
+
+    for (i = 1; i < n; ++i)
+        if (dist[i].dist > dist[best].dist)
+            best = i;
+    return best;
+}
+
+/*
+ * Compare the top-N densities from the original and the quantized
+ * codebooks for every frame of every file in the control file.
+ */
+static int
+measure_error(cmd_ln_t *config, gauden_t *g, gauden_t *gq)
+{
+    feat_t *fcb;
+    FILE *ctlfh;
+    lineiter_t *li;
+    gauden_dist_t **dist, **qdist;
+    int32 topn, nfr, m, f, i, j;
+    int64 n_eval, n_top1, n_topn;
+    float64 err, maxerr;
+    char *lda;
+
+    if ((fcb = feat_init(cmd_ln_str_r(config, "-feat"),
+                         cmn_type_from_str(cmd_ln_str_r(config, "-cmn")),
+                         cmd_ln_boolean_r(config, "-varnorm"),
+                         agc_type_from_str(cmd_ln_str_r(config, "-agc")),
+                         1, cmd_ln_int32_r(config, "-ceplen"))) == NULL)
+        return -1;
+    lda = model_file(config, "-lda", "feature_transform");
+    if (lda && cmd_ln_str_r(config, "-lda") == NULL && !file_exists(lda)) {
+        ckd_free(lda);
+        lda = NULL;
+    }
+    if (lda && feat_read_lda(fcb, lda, cmd_ln_int32_r(config, "-ldadim")) < 0) {
+        ckd_free(lda);
+        feat_free(fcb);
+        return -1;
+    }
+    ckd_free(lda);
+    if (cmd_ln_str_r(config, "-svspec")) {
+        int32 **subvecs;
+        if ((subvecs = parse_subvecs(cmd_ln_str_r(config, "-svspec"))) == NULL
+            || feat_set_subvecs(fcb, subvecs) < 0) {
+            feat_free(fcb);
+            return -1;
+        }
+    }
+    if (feat_dimension1(fcb) != g->n_feat) {
+        E_ERROR("Number of streams does not match: %d != %d\n",
+                g->n_feat, feat_dimension1(fcb));
+        feat_free(fcb);
+        return -1;
+    }
+    for (f = 0; f < g->n_feat; ++f) {
+        if (feat_dimension2(fcb, f) != g->featlen[f]) {
+            E_ERROR("Dimension of stream %d does not match: %d != %d\n", f,
+                    g->featlen[f], feat_dimension2(fcb, f));
+            feat_free(fcb);
+            return -1;
+        }
+    }
+
+    if ((ctlfh = fopen(cmd_ln_str_r(config, "-ctl"), "r")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open control file '%s'",
+                       cmd_ln_str_r(config, "-ctl"));
+        feat_free(fcb);
+        return -1;
+    }
+    topn = cmd_ln_int32_r(config, "-topn");
+    if (topn <= 0 || topn > g->n_density)
+        topn = g->n_density;
+    dist = (gauden_dist_t **)ckd_calloc_2d(g->n_feat, topn, sizeof(**dist));
+    qdist = (gauden_dist_t **)ckd_calloc_2d(g->n_feat, topn, sizeof(**qdist));
+
+    n_eval = n_top1 = n_topn = 0;
+    err = maxerr = 0;
+    for (li = lineiter_start_clean(ctlfh); li; li = lineiter_next(li)) {
+        char *wptr[1];
+        mfcc_t ***feat;
+        int32 t;
+
+        if (str2words(li->buf, wptr, 1) != 1)
+            continue;
+        nfr = feat_s2mfc2feat(fcb, wptr[0], cmd_ln_str_r(config, "-cepdir"),
+                              cmd_ln_str_r(config, "-cepext"), 0, -1, NULL, -1);
+        if (nfr <= 0) {
+            E_ERROR("Failed to read features from %s\n", wptr[0]);
+            continue;
+        }
+        feat = feat_array_alloc(fcb, nfr);
+        nfr = feat_s2mfc2feat(fcb, wptr[0], cmd_ln_str_r(config, "-cepdir"),
+                              cmd_ln_str_r(config, "-cepext"), 0, -1, feat, nfr);
+        for (t = 0; t < nfr; ++t) {
+            for (m = 0; m < g->n_mgau; ++m) {
+                gauden_dist(g, m, topn, feat[t], dist);
+                gauden_dist(gq, m, topn, feat[t], qdist);
+                for (f = 0; f < g->n_feat; ++f) {
+                    int b = best_dist(dist[f], topn);
+                    int qb = best_dist(qdist[f], topn);
+                    float64 e;
+
+                    if (dist[f][b].id == qdist[f][qb].id)
+                        ++n_top1;
+                    for (i = 0; i < topn; ++i)
+                        for (j = 0; j < topn; ++j)
+                            if (dist[f][i].id == qdist[f][j].id)
+                                ++n_topn;
+                    e = ((float64)dist[f][b].dist - qdist[f][qb].dist)
+                        / (1 << SENSCR_SHIFT);
+                    if (e < 0)
+                        e = -e;
+                    err += e;
+                    if (e > maxerr)
+                        maxerr = e;
+                    ++n_eval;
+                }
+            }
+        }
+        feat_array_free(feat);
+    }
+    fclose(ctlfh);
+
+    if (n_eval > 0) {
+        printf("Codebook evaluations: %ld\n", (long)n_eval);
+        printf("Same top-1 Gaussian: %.2f%%\n", 100.0 * n_top1 / n_eval);
+        printf("Same top-%d Gaussians: %.2f%%\n", topn,
+               100.0 * n_topn / n_eval / topn);
+        printf("Top-1 score error: %.2f mean, %.2f max\n",
+               err / n_eval, maxerr);
+    }
+
+    ckd_free_2d(dist);
+    ckd_free_2d(qdist);
+    feat_free(fcb);
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    cmd_ln_t *config;
+    logmath_t *lmath;
+    gauden_t *g, *gq;
+    char *meanfn, *varfn, *outfn, *featparams;
+    size_t nparam;
+    int32 f, rv;
+
+    if ((config = cmd_ln_parse_r(NULL, defn, argc, argv, TRUE)) == NULL)
+        return 1;
+    featparams = model_file(config, "-featparams", "feat.params");
+    if (featparams && file_exists(featparams))
+        cmd_ln_parse_file_r(config, defn, featparams, FALSE);
+    ckd_free(featparams);
+
+    meanfn = model_file(config, "-mean", "means");
+    varfn = model_file(config, "-var", "variances");
+    outfn = model_file(config, "-gauq8", "gaussians_q8");
+    if (meanfn == NULL || varfn == NULL || outfn == NULL) {
+        E_ERROR("Need either -hmm or all of -mean, -var and -gauq8\n");
+        return 1;
+    }
+
+    lmath = logmath_init(cmd_ln_float32_r(config, "-logbase"), 0, 0);
+    rv = 1;
+    gq = NULL;
+    if ((g = gauden_init(meanfn, varfn, cmd_ln_float32_r(config, "-varfloor"),
+                         lmath)) == NULL)
+        goto error_out;
+    if (gauden_write_q8(g, outfn) < 0)
+        goto error_out;
+    if ((gq = gauden_init_q8(outfn, lmath)) == NULL)
+        goto error_out;
+
+    for (f = 0, nparam = 0; f < g->n_feat; ++f)
+        nparam += g->featlen[f];
+    E_INFO("Codebook size: %ld bytes, quantized %ld bytes\n",
+           (long)(nparam * g->n_mgau * g->n_density * 2 * sizeof(mfcc_t)),
+           (long)(nparam * g->n_mgau * (g->n_density * 2 + 3 * sizeof(float32))));
+
+    if (cmd_ln_str_r(config, "-ctl") && measure_error(config, g, gq) < 0)
+        goto error_out;
+    rv = 0;
+
+error_out:
+    gauden_free(gq);
+    gauden_free(g);
+    logmath_free(lmath);
+    ckd_free(meanfn);
+    ckd_free(varfn);
+    ckd_free(outfn);
+    cmd_ln_free_r(config);
+    return rv;
+}
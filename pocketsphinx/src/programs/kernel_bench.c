@@ -0,0 +1,482 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2026 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * kernel_bench.c - time the inner loops of the decoder
+ *
+ * This runs each of the kernels that decoding spends its time in
+ * (the front end, dynamic features, Gaussian evaluation, HMM
+ * evaluation, language model and dictionary lookups, and lattice
+ * posteriors) over the same piece of audio several times, and
+ * writes one line of JSON per kernel with the time and cycles it
+ * took per call and per frame of input.  The numbers can be
+ * compared between builds to catch regressions.
+ **/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/fe.h>
+#include <sphinxbase/feat.h>
+#include <sphinxbase/hash_table.h>
+#include <sphinxbase/ngram_model.h>
+#include <sphinxbase/profile.h>
+#include <sphinxbase/strfuncs.h>
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+
+#include <pocketsphinx.h>
+
+#include "pocketsphinx_internal.h"
+#include "hmm.h"
+
+static const arg_t bench_args[] = {
+    POCKETSPHINX_OPTIONS,
+    { "-infile",
+      ARG_STRING,
+      NULL,
+      "Audio file to run the kernels on (raw 16-bit PCM)" },
+    { "-iter",
+      ARG_INT32,
+      "10",
+      "Number of times to run each kernel over the input" },
+    { "-mhz",
+      ARG_FLOAT32,
+      "0",
+      "Clock rate used to convert time to cycles where there is no cycle counter" },
+    { "-benchout",
+      ARG_STRING,
+      NULL,
+      "File to append one line of results per kernel to (JSON), default standard output" },
+    CMDLN_EMPTY_OPTION
+};
+
+/**
+ * Number of N-grams scored in each run of the language model.
+ */
+#define BENCH_N_NGRAM 10000
+
+/**
+ * Timer for one kernel.
+ */
+typedef struct bench_s {
+    ptmr_t tm;          /**< Elapsed and CPU time. */
+    uint64 cycles;      /**< Cycles counted, if there is a counter. */
+    uint64 start;       /**< Cycle count at bench_start(). */
+    int64 n_call;       /**< Number of calls to the kernel. */
+    int64 n_frame;      /**< Number of frames of input processed. */
+} bench_t;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_CYCLE_COUNTER 1
+#define bench_cycles() __builtin_ia32_rdtsc()
+#else
+#define HAVE_CYCLE_COUNTER 0
+#define bench_cycles() 0
+#endif
+
+static void
+bench_init(bench_t *b)
+{
+    memset(b, 0, sizeof(*b));
+    ptmr_init(&b->tm);
+}
+
+static void
+bench_start(bench_t *b)
+{
+    ptmr_start(&b->tm);
+    b->start = bench_cycles();
+}
+
+static void
+bench_stop(bench_t *b)
+{
+    b->cycles += bench_cycles() - b->start;
+    ptmr_stop(&b->tm);
+}
+
+static void
+bench_report(FILE *fh, cmd_ln_t *config, char const *kernel, bench_t *b)
+{
+    float64 cycles;
+
+    if (b->n_call == 0)
+        return;
+    if (HAVE_CYCLE_COUNTER)
+        cycles = (float64)b->cycles;
+    else
+        cycles = b->tm.t_elapsed * cmd_ln_float32_r(config, "-mhz") * 1e6;
+    fprintf(fh, "{\"kernel\":\"%s\",\"calls\":%ld,\"frames\":%ld,"
+            "\"sec\":%.6f,\"cpu\":%.6f,\"ns_per_call\":%.1f",
+            kernel, (long)b->n_call, (long)b->n_frame,
+            b->tm.t_elapsed, b->tm.t_cpu,
+            b->tm.t_elapsed * 1e9 / b->n_call);
+    if (cycles > 0) {
+        fprintf(fh, ",\"cycles_per_call\":%.1f", cycles / b->n_call);
+        if (b->n_frame > 0)
+            fprintf(fh, ",\"cycles_per_frame\":%.1f", cycles / b->n_frame);
+    }
+    fprintf(fh, "}\n");
+    fflush(fh);
+}
+
+static int16 *
+read_audio(char const *file, size_t *out_nsamp)
+{
+    FILE *fh;
+    int16 *data;
+    long flen;
+
+    if ((fh = fopen(file, "rb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open %s", file);
+        return NULL;
+    }
+    fseek(fh, 0, SEEK_END);
+    flen = ftell(fh);
+    fseek(fh, 0, SEEK_SET);
+    data = ckd_calloc(flen / 2 + 1, sizeof(*data));
+    *out_nsamp = fread(data, 2, flen / 2, fh);
+    fclose(fh);
+    if (*out_nsamp == 0) {
+        E_ERROR("No audio in %s\n", file);
+        ckd_free(data);
+        return NULL;
+    }
+    return data;
+}
+
+/**
+ * Front end: audio to cepstra.  Returns the cepstra of the last run.
+ */
+static mfcc_t **
+bench_fe(FILE *fh, cmd_ln_t *config, acmod_t *acmod,
+         int16 const *audio, size_t nsamp, int iter, int32 *out_nfr)
+{
+    bench_t b;
+    mfcc_t **cep;
+    int16 const *ptr;
+    size_t n;
+    int32 nfr, maxfr, i;
+
+    ptr = audio;
+    n = nsamp;
+    fe_process_frames(acmod->fe, &ptr, &n, NULL, &maxfr, NULL);
+    cep = ckd_calloc_2d(maxfr + 1, fe_get_output_size(acmod->fe),
+                        sizeof(**cep));
+    bench_init(&b);
+    for (i = 0; i < iter; ++i) {
+        int32 nlast;
+
+        ptr = audio;
+        n = nsamp;
+        nfr = maxfr;
+        bench_start(&b);
+        fe_start_utt(acmod->fe);
+        fe_process_frames(acmod->fe, &ptr, &n, cep, &nfr, NULL);
+        fe_end_utt(acmod->fe, cep[nfr], &nlast);
+        bench_stop(&b);
+        nfr += nlast;
+        ++b.n_call;
+        b.n_frame += nfr;
+    }
+    bench_report(fh, config, "fe_process_frames", &b);
+    *out_nfr = nfr;
+    return cep;
+}
+
+/**
+ * Dynamic features, for a whole utterance at once.
+ */
+static mfcc_t ***
+bench_feat(FILE *fh, cmd_ln_t *config, acmod_t *acmod,
+           mfcc_t **cep, int32 ncep, int iter, int32 *out_nfr)
+{
+    bench_t b;
+    mfcc_t **tmp;
+    mfcc_t ***feat;
+    int32 ceplen, nfr, i;
+
+    /* Normalization works in place, so it gets a fresh copy each time. */
+    ceplen = fe_get_output_size(acmod->fe);
+    tmp = ckd_calloc_2d(ncep, ceplen, sizeof(**tmp));
+    feat = feat_array_alloc(acmod->fcb, ncep);
+    bench_init(&b);
+    for (i = 0; i < iter; ++i) {
+        memcpy(tmp[0], cep[0], ncep * ceplen * sizeof(**tmp));
+        nfr = ncep;
+        bench_start(&b);
+        nfr = feat_s2mfc2feat_live(acmod->fcb, tmp, &nfr, TRUE, TRUE, feat);
+        bench_stop(&b);
+        ++b.n_call;
+        b.n_frame += nfr;
+    }
+    bench_report(fh, config, "feat_s2mfc2feat_live", &b);
+    ckd_free_2d(tmp);
+    *out_nfr = nfr;
+    return feat;
+}
+
+/**
+ * Scoring of all senones, returning the scores of the last run.
+ */
+static int16 **
+bench_mgau(FILE *fh, cmd_ln_t *config, acmod_t *acmod,
+           mfcc_t ***feat, int32 nfr, int iter)
+{
+    bench_t b;
+    char *kernel;
+    int16 **senscr;
+    int32 i, t;
+
+    senscr = ckd_calloc_2d(nfr, bin_mdef_n_sen(acmod->mdef), sizeof(**senscr));
+    bench_init(&b);
+    for (i = 0; i < iter; ++i) {
+        for (t = 0; t < nfr; ++t) {
+            bench_start(&b);
+            ps_mgau_frame_eval(acmod->mgau, senscr[t], NULL, 0,
+                               feat[t], t, TRUE);
+            bench_stop(&b);
+        }
+        b.n_call += nfr;
+        b.n_frame += nfr;
+    }
+    kernel = string_join("frame_eval.", ps_mgau_base(acmod->mgau)->vt->name,
+                         NULL);
+    bench_report(fh, config, kernel, &b);
+    ckd_free(kernel);
+    return senscr;
+}
+
+/**
+ * Viterbi evaluation of one HMM for every phone in the model, one at
+ * a time and in batches.
+ */
+static void
+bench_hmm(FILE *fh, cmd_ln_t *config, acmod_t *acmod,
+          int16 **senscr, int32 nfr, int iter)
+{
+    bin_mdef_t *mdef = acmod->mdef;
+    hmm_context_t *ctx;
+    hmm_t *hmm, **hmmp;
+    bench_t b, bb;
+    int32 n_hmm, i, j, t;
+
+    ctx = hmm_context_init(bin_mdef_n_emit_state(mdef),
+                           acmod->tmat->tp, NULL, mdef->sseq);
+    if (ctx == NULL)
+        return;
+    n_hmm = bin_mdef_n_phone(mdef);
+    hmm = ckd_calloc(n_hmm, sizeof(*hmm));
+    hmmp = ckd_calloc(n_hmm, sizeof(*hmmp));
+    for (j = 0; j < n_hmm; ++j) {
+        hmm_init(ctx, &hmm[j], FALSE, bin_mdef_pid2ssid(mdef, j),
+                 bin_mdef_pid2tmatid(mdef, j));
+        hmmp[j] = &hmm[j];
+    }
+
+    bench_init(&b);
+    bench_init(&bb);
+    for (i = 0; i < iter * 2; ++i) {
+        bench_t *bp = (i & 1) ? &bb : &b;
+
+        for (j = 0; j < n_hmm; ++j) {
+            hmm_clear(&hmm[j]);
+            hmm_enter(&hmm[j], 0, -1, 0);
+        }
+        for (t = 0; t < nfr; ++t) {
+            int32 best;
+
+            hmm_context_set_senscore(ctx, senscr[t]);
+            if (i & 1) {
+                bench_start(bp);
+                best = hmm_vit_eval_batch(hmmp, n_hmm);
+                bench_stop(bp);
+            }
+            else {
+                best = WORST_SCORE;
+                bench_start(bp);
+                for (j = 0; j < n_hmm; ++j) {
+                    int32 score = hmm_vit_eval(&hmm[j]);
+                    if (score > best)
+                        best = score;
+                }
+                bench_stop(bp);
+            }
+            /* Keep scores from underflowing, as the search does. */
+            for (j = 0; j < n_hmm; ++j)
+                hmm_normalize(&hmm[j], best);
+        }
+        bp->n_call += (int64)nfr * n_hmm;
+        bp->n_frame += nfr;
+    }
+    bench_report(fh, config, "hmm_vit_eval", &b);
+    bench_report(fh, config, "hmm_vit_eval_batch", &bb);
+
+    ckd_free(hmmp);
+    ckd_free(hmm);
+    hmm_context_free(ctx);
+}
+
+/**
+ * Language model scores for random trigrams of words in the
+ * vocabulary.  Most of them back off, as most of those looked up in
+ * the search do.
+ */
+static void
+bench_lm(FILE *fh, cmd_ln_t *config, ngram_model_t *lm, int iter)
+{
+    bench_t b;
+    int32 *wids, n_vocab, n_used, i, j;
+
+    n_vocab = ngram_model_get_counts(lm)[0];
+    wids = ckd_calloc(BENCH_N_NGRAM * 3, sizeof(*wids));
+    srand(42);
+    for (j = 0; j < BENCH_N_NGRAM * 3; ++j)
+        wids[j] = rand() % n_vocab;
+    bench_init(&b);
+    for (i = 0; i < iter; ++i) {
+        bench_start(&b);
+        for (j = 0; j < BENCH_N_NGRAM; ++j)
+            ngram_tg_score(lm, wids[j * 3], wids[j * 3 + 1],
+                           wids[j * 3 + 2], &n_used);
+        bench_stop(&b);
+        b.n_call += BENCH_N_NGRAM;
+    }
+    bench_report(fh, config, "ngram_tg_score", &b);
+    ckd_free(wids);
+}
+
+/**
+ * Lookup of every word in the dictionary by its string.
+ */
+static void
+bench_hash(FILE *fh, cmd_ln_t *config, dict_t *dict, int iter)
+{
+    bench_t b;
+    void *val;
+    int32 n_word, i, j;
+
+    n_word = dict_size(dict);
+    bench_init(&b);
+    for (i = 0; i < iter; ++i) {
+        bench_start(&b);
+        for (j = 0; j < n_word; ++j)
+            hash_table_lookup(dict->ht, dict_wordstr(dict, j), &val);
+        bench_stop(&b);
+        b.n_call += n_word;
+    }
+    bench_report(fh, config, "hash_table_lookup", &b);
+}
+
+/**
+ * Posterior probabilities in the lattice of the whole utterance.
+ */
+static void
+bench_lattice(FILE *fh, cmd_ln_t *config, ps_decoder_t *ps,
+              int16 const *audio, size_t nsamp, int iter)
+{
+    ps_lattice_t *dag;
+    ngram_model_t *lm;
+    bench_t b;
+    float32 ascale;
+    int32 i;
+
+    ps_start_utt(ps);
+    ps_process_raw(ps, audio, nsamp, FALSE, TRUE);
+    ps_end_utt(ps);
+    if ((dag = ps_get_lattice(ps)) == NULL)
+        return;
+    lm = ps_get_lm(ps, ps_get_search(ps));
+    ascale = 1.0f / cmd_ln_float32_r(config, "-ascale");
+    bench_init(&b);
+    for (i = 0; i < iter; ++i) {
+        bench_start(&b);
+        ps_lattice_posterior(dag, lm, ascale);
+        bench_stop(&b);
+        ++b.n_call;
+        b.n_frame += ps_lattice_n_frames(dag);
+    }
+    bench_report(fh, config, "ps_lattice_posterior", &b);
+}
+
+int
+main(int argc, char *argv[])
+{
+    cmd_ln_t *config;
+    ps_decoder_t *ps;
+    acmod_t *acmod;
+    FILE *fh;
+    int16 *audio;
+    size_t nsamp;
+    mfcc_t **cep;
+    mfcc_t ***feat;
+    int16 **senscr;
+    ngram_model_t *lm;
+    int32 ncep, nfr, iter;
+
+    if ((config = cmd_ln_parse_r(NULL, bench_args, argc, argv, TRUE)) == NULL)
+        return 1;
+    if (cmd_ln_str_r(config, "-infile") == NULL)
+        E_FATAL("-infile is required\n");
+    if ((ps = ps_init(config)) == NULL)
+        E_FATAL("PocketSphinx decoder init failed\n");
+    if ((audio = read_audio(cmd_ln_str_r(config, "-infile"), &nsamp)) == NULL)
+        return 1;
+    fh = stdout;
+    if (cmd_ln_str_r(config, "-benchout")
+        && (fh = fopen(cmd_ln_str_r(config, "-benchout"), "a")) == NULL)
+        E_FATAL_SYSTEM("Failed to open benchmark output '%s'",
+                       cmd_ln_str_r(config, "-benchout"));
+    acmod = ps->acmod;
+    iter = cmd_ln_int32_r(config, "-iter");
+
+    cep = bench_fe(fh, config, acmod, audio, nsamp, iter, &ncep);
+    feat = bench_feat(fh, config, acmod, cep, ncep, iter, &nfr);
+    senscr = bench_mgau(fh, config, acmod, feat, nfr, iter);
+    bench_hmm(fh, config, acmod, senscr, nfr, iter);
+    if ((lm = ps_get_lm(ps, ps_get_search(ps))) != NULL)
+        bench_lm(fh, config, lm, iter);
+    bench_hash(fh, config, ps->dict, iter * 10);
+    bench_lattice(fh, config, ps, audio, nsamp, iter);
+
+    if (fh != stdout)
+        fclose(fh);
+    ckd_free_2d(senscr);
+    feat_array_free(feat);
+    ckd_free_2d(cep);
+    ckd_free(audio);
+    ps_free(ps);
+    cmd_ln_free_r(config);
+    return 0;
+}
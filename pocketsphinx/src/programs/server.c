@@ -0,0 +1,927 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2026 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * server.c - streaming recognition server
+ *
+ * Each TCP connection is one utterance.  The client sends raw 16-bit
+ * mono PCM in host byte order at the decoder's sampling rate, and
+ * shuts down its side of the connection when it has finished.  The
+ * server sends back lines of text: "PARTIAL <hyp>" whenever the best
+ * hypothesis changes, and "FINAL <hyp>" at the end, after which it
+ * closes the connection.
+ *
+ * One thread does all of the network I/O, with epoll (or poll()
+ * where there is no epoll), so that many thousands of connections
+ * cost little more than their buffers.  Decoding is done by a pool of
+ * worker threads with a pool of decoders copied from one with
+ * ps_clone().  A connection holds a decoder from its first audio to
+ * the end of its utterance, and waits in line for one if there are
+ * none free, its audio being buffered meanwhile (up to -maxbuf, after
+ * which it is no longer read, so TCP slows the client down).  Workers
+ * take connections with audio waiting from a queue and decode all of
+ * it at once, so audio which arrives while a connection waits its
+ * turn is batched into fewer, larger calls to the front end and
+ * acoustic model, and partial results are only sent for the latest
+ * hypothesis.
+ **/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <sphinxbase/err.h>
+
+int
+main(int argc, char *argv[])
+{
+    E_ERROR("%s is not supported on Windows\n", argv[0]);
+    return 1;
+}
+#else /* !_WIN32 */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#define SERVER_EPOLL
+#else
+#include <poll.h>
+#endif
+
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/sbthread.h>
+
+#include <pocketsphinx.h>
+
+static const arg_t server_args_def[] = {
+    POCKETSPHINX_OPTIONS,
+    /* Argument file. */
+    { "-argfile",
+      ARG_STRING,
+      NULL,
+      "Argument file giving extra arguments." },
+    { "-port",
+      ARG_INT32,
+      "8086",
+      "TCP port to listen on" },
+    { "-nworkers",
+      ARG_INT32,
+      "4",
+      "Number of decoding threads" },
+    { "-ndecoders",
+      ARG_INT32,
+      "64",
+      "Number of decoders, hence of utterances decoded at once" },
+    { "-maxconn",
+      ARG_INT32,
+      "10000",
+      "Maximum number of connections" },
+    { "-maxbuf",
+      ARG_INT32,
+      "1048576",
+      "Bytes of audio to buffer for a connection before no longer reading it" },
+    { "-partial",
+      ARG_INT32,
+      "10",
+      "Frames between checks for a new partial result (0 for none)" },
+    CMDLN_EMPTY_OPTION
+};
+
+/* Events to wait for on a connection. */
+#define EV_IN 1
+#define EV_OUT 2
+
+typedef struct conn_s conn_t;
+typedef struct server_s server_t;
+
+/**
+ * Decoder in the pool.
+ */
+typedef struct srv_dec_s {
+    ps_decoder_t *ps;
+    char *partial;              /**< Last partial result, not yet sent. */
+    struct srv_dec_s *next;     /**< Next idle decoder. */
+} srv_dec_t;
+
+/**
+ * Connection, and the utterance it sends.
+ *
+ * Everything but fd and the poll state is protected by the server's
+ * lock, though while busy is set the decoder belongs to the worker.
+ */
+struct conn_s {
+    int fd;
+    uint8 *in;              /**< Audio not yet decoded. */
+    size_t n_in, n_in_alloc;
+    char *out;              /**< Results not yet sent. */
+    size_t n_out, n_out_alloc;
+    srv_dec_t *dec;         /**< Decoder, once one is free. */
+    int events;             /**< Events waited for (EV_IN, EV_OUT). */
+    uint8 polled;           /**< Registered for events. */
+    uint8 eof;              /**< Client has sent everything. */
+    uint8 dead;             /**< Client has gone, nothing to send. */
+    uint8 queued;           /**< In the ready or waiting queue. */
+    uint8 busy;             /**< Being decoded. */
+    uint8 started;          /**< Utterance started. */
+    uint8 done;             /**< Final result is in out. */
+    uint8 notified;         /**< In the list to look at. */
+    uint8 closing;          /**< In the list to free. */
+    conn_t *next_queued;
+    conn_t *next_notify;
+    conn_t *next_closing;
+    conn_t *prev, *next;    /**< List of all connections. */
+};
+
+typedef struct conn_queue_s {
+    conn_t *head, *tail;
+} conn_queue_t;
+
+struct server_s {
+    cmd_ln_t *config;
+    sbmtx_t *mtx;
+    sbevent_t *work;        /**< Signalled when there may be work. */
+    conn_queue_t ready;     /**< Connections with audio to decode. */
+    conn_queue_t waiting;   /**< Connections waiting for a decoder. */
+    conn_t *notify;         /**< Connections for the I/O thread to look at. */
+    srv_dec_t *decs;
+    int n_decs;
+    srv_dec_t *idle;
+    sbthread_t **workers;
+    int n_workers;
+    int quit;
+    int wake[2];            /**< Pipe to wake the I/O thread. */
+    int listen_fd;
+#ifdef SERVER_EPOLL
+    int epoll_fd;
+#endif
+    conn_t *conns;
+    conn_t *closing;        /**< Connections to free. */
+    int n_conns;
+    int max_conns;
+    size_t max_in;
+    int32 n_utts;
+};
+
+static volatile sig_atomic_t interrupted;
+static int interrupt_fd = -1;
+
+static void
+server_interrupt(int sig)
+{
+    char c = 0;
+
+    (void)sig;
+    interrupted = 1;
+    if (write(interrupt_fd, &c, 1) < 0)
+        return;
+}
+
+static void
+conn_queue_push(conn_queue_t *q, conn_t *conn)
+{
+    conn->next_queued = NULL;
+    if (q->tail)
+        q->tail->next_queued = conn;
+    else
+        q->head = conn;
+    q->tail = conn;
+    conn->queued = TRUE;
+}
+
+static conn_t *
+conn_queue_pop(conn_queue_t *q)
+{
+    conn_t *conn;
+
+    if ((conn = q->head) == NULL)
+        return NULL;
+    if ((q->head = conn->next_queued) == NULL)
+        q->tail = NULL;
+    conn->queued = FALSE;
+    return conn;
+}
+
+static void
+buf_append(void *pbuf, size_t *n, size_t *n_alloc,
+           void const *data, size_t len)
+{
+    char **buf = pbuf;
+
+    if (*n + len > *n_alloc) {
+        *n_alloc = *n_alloc ? *n_alloc : 4096;
+        while (*n + len > *n_alloc)
+            *n_alloc *= 2;
+        *buf = ckd_realloc(*buf, *n_alloc);
+    }
+    memcpy(*buf + *n, data, len);
+    *n += len;
+}
+
+static void
+conn_send(conn_t *conn, char const *tag, char const *hyp)
+{
+    if (conn->dead)
+        return;
+    buf_append(&conn->out, &conn->n_out, &conn->n_out_alloc,
+               tag, strlen(tag));
+    buf_append(&conn->out, &conn->n_out, &conn->n_out_alloc, " ", 1);
+    if (hyp)
+        buf_append(&conn->out, &conn->n_out, &conn->n_out_alloc,
+                   hyp, strlen(hyp));
+    buf_append(&conn->out, &conn->n_out, &conn->n_out_alloc, "\n", 1);
+}
+
+/* Have the I/O thread look at a connection (with the lock held). */
+static void
+server_notify(server_t *srv, conn_t *conn)
+{
+    char c = 0;
+
+    if (conn->notified)
+        return;
+    conn->notified = TRUE;
+    conn->next_notify = srv->notify;
+    srv->notify = conn;
+    if (write(srv->wake[1], &c, 1) < 0 && errno != EAGAIN)
+        E_ERROR_SYSTEM("Failed to wake I/O thread");
+}
+
+/* Queue a connection for decoding if it has something to decode
+ * (with the lock held). */
+static void
+server_schedule(server_t *srv, conn_t *conn)
+{
+    if (conn->queued || conn->busy || conn->done)
+        return;
+    if (conn->n_in < sizeof(int16) && !conn->eof)
+        return;
+    if (conn->dec == NULL) {
+        if (srv->idle == NULL) {
+            conn_queue_push(&srv->waiting, conn);
+            return;
+        }
+        conn->dec = srv->idle;
+        srv->idle = srv->idle->next;
+    }
+    conn_queue_push(&srv->ready, conn);
+    sbevent_signal(srv->work);
+}
+
+static void
+server_hyp_cb(void *user_data, char const *hyp, int32 score)
+{
+    srv_dec_t *dec = user_data;
+
+    (void)score;
+    ckd_free(dec->partial);
+    dec->partial = ckd_salloc(hyp);
+}
+
+/* Decode what a connection has sent so far. */
+static void
+server_decode(server_t *srv, conn_t *conn, uint8 *buf, size_t n, int eof)
+{
+    ps_decoder_t *ps = conn->dec->ps;
+    char const *hyp = NULL;
+    int32 score;
+
+    if (!conn->started) {
+        ps_start_stream(ps);
+        ps_start_utt(ps);
+        conn->started = TRUE;
+    }
+    if (n > 0)
+        ps_process_raw(ps, (int16 *)buf, n / sizeof(int16), FALSE, FALSE);
+    if (eof) {
+        ps_end_utt(ps);
+        hyp = ps_get_hyp(ps, &score);
+    }
+
+    sbmtx_lock(srv->mtx);
+    if (eof) {
+        conn_send(conn, "FINAL", hyp ? hyp : "");
+        conn->done = TRUE;
+        ++srv->n_utts;
+        /* Hand the decoder on to the next in line. */
+        ckd_free(conn->dec->partial);
+        conn->dec->partial = NULL;
+        conn->dec->next = srv->idle;
+        srv->idle = conn->dec;
+        conn->dec = NULL;
+        while (srv->idle && srv->waiting.head) {
+            conn_t *next = conn_queue_pop(&srv->waiting);
+            server_schedule(srv, next);
+        }
+    }
+    else if (conn->dec->partial) {
+        conn_send(conn, "PARTIAL", conn->dec->partial);
+        ckd_free(conn->dec->partial);
+        conn->dec->partial = NULL;
+    }
+    conn->busy = FALSE;
+    server_schedule(srv, conn);
+    server_notify(srv, conn);
+    sbmtx_unlock(srv->mtx);
+}
+
+static int
+server_worker_main(sbthread_t *th)
+{
+    server_t *srv = sbthread_arg(th);
+    uint8 *buf = NULL;
+    size_t n_alloc = 0;
+
+    for (;;) {
+        conn_t *conn;
+        size_t n;
+        int eof;
+
+        sbmtx_lock(srv->mtx);
+        if (srv->quit) {
+            sbmtx_unlock(srv->mtx);
+            /* Pass it on to the others. */
+            sbevent_signal(srv->work);
+            break;
+        }
+        if ((conn = conn_queue_pop(&srv->ready)) == NULL) {
+            sbmtx_unlock(srv->mtx);
+            sbevent_wait(srv->work, -1, -1);
+            continue;
+        }
+        /* There may be more for somebody else. */
+        if (srv->ready.head)
+            sbevent_signal(srv->work);
+        conn->busy = TRUE;
+        /* Take whole samples, leaving any odd byte for later. */
+        n = conn->n_in & ~(sizeof(int16) - 1);
+        if (n > n_alloc) {
+            n_alloc = conn->n_in_alloc;
+            buf = ckd_realloc(buf, n_alloc);
+        }
+        memcpy(buf, conn->in, n);
+        memmove(conn->in, conn->in + n, conn->n_in - n);
+        conn->n_in -= n;
+        eof = conn->eof;
+        /* There may be room to read more now. */
+        if (n > 0)
+            server_notify(srv, conn);
+        sbmtx_unlock(srv->mtx);
+
+        server_decode(srv, conn, buf, n, eof);
+    }
+    ckd_free(buf);
+    return 0;
+}
+
+static int
+set_nonblocking(int fd)
+{
+    int flags;
+
+    if ((flags = fcntl(fd, F_GETFL, 0)) < 0)
+        return -1;
+    return fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+#ifdef SERVER_EPOLL
+static int
+server_poll_ctl(server_t *srv, int op, int fd, void *ptr, int events)
+{
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = ((events & EV_IN) ? EPOLLIN : 0)
+        | ((events & EV_OUT) ? EPOLLOUT : 0);
+    ev.data.ptr = ptr;
+    return epoll_ctl(srv->epoll_fd, op, fd, &ev);
+}
+#endif
+
+/* Wait for the events a connection needs next. */
+static void
+conn_update_events(server_t *srv, conn_t *conn)
+{
+    int events = 0;
+
+    sbmtx_lock(srv->mtx);
+    if (!conn->eof && conn->n_in < srv->max_in)
+        events |= EV_IN;
+    if (conn->n_out > 0)
+        events |= EV_OUT;
+    sbmtx_unlock(srv->mtx);
+#ifdef SERVER_EPOLL
+    /* Hangups are reported even for no events, so a connection which
+     * is only waiting to be decoded is taken out altogether. */
+    if (events == 0) {
+        if (conn->polled)
+            epoll_ctl(srv->epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL);
+        conn->polled = FALSE;
+    }
+    else if (!conn->polled || events != conn->events) {
+        if (server_poll_ctl(srv, conn->polled ? EPOLL_CTL_MOD : EPOLL_CTL_ADD,
+                            conn->fd, conn, events) < 0)
+            E_ERROR_SYSTEM("Failed to update events for connection");
+        conn->polled = TRUE;
+    }
+#endif
+    conn->events = events;
+}
+
+static void
+conn_free(server_t *srv, conn_t *conn)
+{
+#ifdef SERVER_EPOLL
+    if (conn->polled)
+        epoll_ctl(srv->epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL);
+#endif
+    close(conn->fd);
+    if (conn->prev)
+        conn->prev->next = conn->next;
+    else
+        srv->conns = conn->next;
+    if (conn->next)
+        conn->next->prev = conn->prev;
+    --srv->n_conns;
+    ckd_free(conn->in);
+    ckd_free(conn->out);
+    ckd_free(conn);
+}
+
+static void
+server_accept(server_t *srv)
+{
+    int fd;
+
+    while ((fd = accept(srv->listen_fd, NULL, NULL)) >= 0) {
+        conn_t *conn;
+        int one = 1;
+
+        if (srv->n_conns >= srv->max_conns) {
+            E_WARN("Too many connections, refusing one\n");
+            close(fd);
+            continue;
+        }
+        set_nonblocking(fd);
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        conn = ckd_calloc(1, sizeof(*conn));
+        conn->fd = fd;
+        conn->events = EV_IN;
+#ifdef SERVER_EPOLL
+        if (server_poll_ctl(srv, EPOLL_CTL_ADD, fd, conn, EV_IN) < 0) {
+            E_ERROR_SYSTEM("Failed to add connection");
+            close(fd);
+            ckd_free(conn);
+            continue;
+        }
+        conn->polled = TRUE;
+#endif
+        conn->next = srv->conns;
+        if (srv->conns)
+            srv->conns->prev = conn;
+        srv->conns = conn;
+        ++srv->n_conns;
+    }
+    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        E_ERROR_SYSTEM("Failed to accept connection");
+}
+
+static void
+conn_read(server_t *srv, conn_t *conn)
+{
+    uint8 buf[65536];
+    ssize_t n;
+    int eof = FALSE, dead = FALSE;
+
+    if ((n = read(conn->fd, buf, sizeof(buf))) < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            return;
+        eof = dead = TRUE;
+    }
+    else if (n == 0)
+        eof = TRUE;
+
+    sbmtx_lock(srv->mtx);
+    if (n > 0)
+        buf_append(&conn->in, &conn->n_in, &conn->n_in_alloc, buf, n);
+    if (eof)
+        conn->eof = TRUE;
+    /* It still has to be decoded to the end to give back the
+     * decoder, but there is no use in sending anything. */
+    if (dead) {
+        conn->dead = TRUE;
+        conn->n_out = 0;
+    }
+    server_schedule(srv, conn);
+    sbmtx_unlock(srv->mtx);
+}
+
+/* Send what can be sent, returning TRUE if the connection is
+ * finished with. */
+static int
+conn_write(server_t *srv, conn_t *conn)
+{
+    int finished;
+
+    sbmtx_lock(srv->mtx);
+    if (conn->n_out > 0) {
+        ssize_t n = write(conn->fd, conn->out, conn->n_out);
+
+        if (n > 0) {
+            memmove(conn->out, conn->out + n, conn->n_out - n);
+            conn->n_out -= n;
+        }
+        else if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK
+                 && errno != EINTR) {
+            conn->dead = TRUE;
+            conn->n_out = 0;
+        }
+    }
+    finished = conn->done && conn->n_out == 0;
+    sbmtx_unlock(srv->mtx);
+    return finished;
+}
+
+/* Free a connection once this round of events is dealt with. */
+static void
+conn_close(server_t *srv, conn_t *conn)
+{
+    if (conn->closing)
+        return;
+    conn->closing = TRUE;
+    conn->next_closing = srv->closing;
+    srv->closing = conn;
+}
+
+/* Free the connections which are finished with.  Once one is done, no
+ * worker touches it, but it may still be in the list to look at, in
+ * which case it waits for the next round. */
+static void
+server_reap(server_t *srv)
+{
+    conn_t *conn, *next, *keep = NULL;
+
+    for (conn = srv->closing; conn; conn = next) {
+        int notified;
+
+        next = conn->next_closing;
+        sbmtx_lock(srv->mtx);
+        notified = conn->notified;
+        sbmtx_unlock(srv->mtx);
+        if (notified) {
+            conn->next_closing = keep;
+            keep = conn;
+        }
+        else
+            conn_free(srv, conn);
+    }
+    srv->closing = keep;
+}
+
+/* Deal with connections the workers have done something to. */
+static void
+server_wake(server_t *srv)
+{
+    char buf[256];
+    conn_t *conn, *next;
+
+    while (read(srv->wake[0], buf, sizeof(buf)) > 0)
+        ;
+    sbmtx_lock(srv->mtx);
+    conn = srv->notify;
+    srv->notify = NULL;
+    for (next = conn; next; next = next->next_notify)
+        next->notified = FALSE;
+    sbmtx_unlock(srv->mtx);
+
+    for (; conn; conn = next) {
+        next = conn->next_notify;
+        if (conn->closing)
+            continue;
+        if (conn_write(srv, conn))
+            conn_close(srv, conn);
+        else
+            conn_update_events(srv, conn);
+    }
+}
+
+static void
+conn_event(server_t *srv, conn_t *conn, int events)
+{
+    if (conn->closing)
+        return;
+    if (events & EV_IN)
+        conn_read(srv, conn);
+    if (conn_write(srv, conn))
+        conn_close(srv, conn);
+    else
+        conn_update_events(srv, conn);
+}
+
+#ifdef SERVER_EPOLL
+static void
+server_loop(server_t *srv)
+{
+    struct epoll_event events[256];
+    int i, n;
+
+    while (!interrupted) {
+        if ((n = epoll_wait(srv->epoll_fd, events, 256, -1)) < 0) {
+            if (errno == EINTR)
+                continue;
+            E_ERROR_SYSTEM("Failed to wait for events");
+            break;
+        }
+        for (i = 0; i < n; ++i) {
+            void *ptr = events[i].data.ptr;
+            int ev = 0;
+
+            if (ptr == &srv->listen_fd) {
+                server_accept(srv);
+                continue;
+            }
+            if (ptr == &srv->wake[0]) {
+                server_wake(srv);
+                continue;
+            }
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                ev |= EV_IN;
+            if (events[i].events & EPOLLOUT)
+                ev |= EV_OUT;
+            conn_event(srv, ptr, ev);
+        }
+        server_reap(srv);
+    }
+}
+#else /* !SERVER_EPOLL */
+static void
+server_loop(server_t *srv)
+{
+    struct pollfd *pfds = NULL;
+    conn_t **pconns = NULL;
+    int n_alloc = 0;
+
+    while (!interrupted) {
+        conn_t *conn;
+        int i, n;
+
+        if (srv->n_conns + 2 > n_alloc) {
+            n_alloc = srv->n_conns + 256;
+            pfds = ckd_realloc(pfds, n_alloc * sizeof(*pfds));
+            pconns = ckd_realloc(pconns, n_alloc * sizeof(*pconns));
+        }
+        pfds[0].fd = srv->listen_fd;
+        pfds[0].events = POLLIN;
+        pfds[1].fd = srv->wake[0];
+        pfds[1].events = POLLIN;
+        for (n = 2, conn = srv->conns; conn; conn = conn->next, ++n) {
+            pfds[n].fd = conn->fd;
+            pfds[n].events = ((conn->events & EV_IN) ? POLLIN : 0)
+                | ((conn->events & EV_OUT) ? POLLOUT : 0);
+            pconns[n] = conn;
+        }
+        if (poll(pfds, n, -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            E_ERROR_SYSTEM("Failed to wait for events");
+            break;
+        }
+        if (pfds[0].revents & POLLIN)
+            server_accept(srv);
+        if (pfds[1].revents & POLLIN)
+            server_wake(srv);
+        for (i = 2; i < n; ++i) {
+            int ev = 0;
+
+            if (pfds[i].revents == 0)
+                continue;
+            if (pfds[i].revents & (POLLIN | POLLHUP | POLLERR))
+                ev |= EV_IN;
+            if (pfds[i].revents & POLLOUT)
+                ev |= EV_OUT;
+            conn_event(srv, pconns[i], ev);
+        }
+        server_reap(srv);
+    }
+    ckd_free(pfds);
+    ckd_free(pconns);
+}
+#endif /* !SERVER_EPOLL */
+
+static int
+server_listen(server_t *srv, int port)
+{
+    struct sockaddr_in addr;
+    int one = 1;
+
+    if ((srv->listen_fd = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+        E_ERROR_SYSTEM("Failed to create socket");
+        return -1;
+    }
+    setsockopt(srv->listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(srv->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        E_ERROR_SYSTEM("Failed to bind to port %d", port);
+        return -1;
+    }
+    if (listen(srv->listen_fd, 1024) < 0) {
+        E_ERROR_SYSTEM("Failed to listen on port %d", port);
+        return -1;
+    }
+    set_nonblocking(srv->listen_fd);
+    E_INFO("Listening on port %d\n", port);
+    return 0;
+}
+
+static server_t *
+server_init(cmd_ln_t *config, ps_decoder_t *ps)
+{
+    server_t *srv;
+    int i, partial;
+
+    srv = ckd_calloc(1, sizeof(*srv));
+    srv->config = config;
+    srv->listen_fd = srv->wake[0] = srv->wake[1] = -1;
+#ifdef SERVER_EPOLL
+    srv->epoll_fd = -1;
+#endif
+    srv->max_conns = cmd_ln_int32_r(config, "-maxconn");
+    srv->max_in = cmd_ln_int32_r(config, "-maxbuf");
+    srv->mtx = sbmtx_init();
+    srv->work = sbevent_init();
+    if (pipe(srv->wake) < 0) {
+        E_ERROR_SYSTEM("Failed to create pipe");
+        return srv;
+    }
+    set_nonblocking(srv->wake[0]);
+    set_nonblocking(srv->wake[1]);
+    interrupt_fd = srv->wake[1];
+
+    /* Copies are made and freed in this thread only. */
+    srv->n_decs = cmd_ln_int32_r(config, "-ndecoders");
+    if (srv->n_decs < 1)
+        srv->n_decs = 1;
+    srv->decs = ckd_calloc(srv->n_decs, sizeof(*srv->decs));
+    partial = cmd_ln_int32_r(config, "-partial");
+    for (i = 0; i < srv->n_decs; ++i) {
+        srv_dec_t *dec = &srv->decs[i];
+
+        if ((dec->ps = ps_clone(ps)) == NULL) {
+            E_ERROR("Failed to copy decoder %d\n", i);
+            srv->n_decs = i;
+            return srv;
+        }
+        if (partial > 0)
+            ps_set_hyp_callback(dec->ps, server_hyp_cb, dec, partial);
+        dec->next = srv->idle;
+        srv->idle = dec;
+    }
+    E_INFO("%d decoders\n", srv->n_decs);
+    return srv;
+}
+
+static int
+server_run(server_t *srv)
+{
+    int i;
+
+    if (srv->idle == NULL || srv->wake[0] < 0)
+        return -1;
+    if (server_listen(srv, cmd_ln_int32_r(srv->config, "-port")) < 0)
+        return -1;
+#ifdef SERVER_EPOLL
+    if ((srv->epoll_fd = epoll_create(1024)) < 0) {
+        E_ERROR_SYSTEM("Failed to create epoll instance");
+        return -1;
+    }
+    server_poll_ctl(srv, EPOLL_CTL_ADD, srv->listen_fd, &srv->listen_fd, EV_IN);
+    server_poll_ctl(srv, EPOLL_CTL_ADD, srv->wake[0], &srv->wake[0], EV_IN);
+#endif
+
+    srv->n_workers = cmd_ln_int32_r(srv->config, "-nworkers");
+    if (srv->n_workers < 1)
+        srv->n_workers = 1;
+    srv->workers = ckd_calloc(srv->n_workers, sizeof(*srv->workers));
+    for (i = 0; i < srv->n_workers; ++i) {
+        if ((srv->workers[i] = sbthread_start(NULL, server_worker_main,
+                                              srv)) == NULL) {
+            E_ERROR("Failed to start worker %d\n", i);
+            break;
+        }
+    }
+    E_INFO("%d workers\n", i);
+    if (i > 0)
+        server_loop(srv);
+
+    /* Stop the workers, which do not wait for the queue to empty. */
+    sbmtx_lock(srv->mtx);
+    srv->quit = TRUE;
+    sbmtx_unlock(srv->mtx);
+    sbevent_signal(srv->work);
+    for (i = 0; i < srv->n_workers; ++i)
+        sbthread_free(srv->workers[i]);
+    E_INFO("Decoded %d utterances\n", srv->n_utts);
+    return 0;
+}
+
+static void
+server_free(server_t *srv)
+{
+    int i;
+
+    while (srv->conns)
+        conn_free(srv, srv->conns);
+    for (i = 0; i < srv->n_decs; ++i) {
+        ps_free(srv->decs[i].ps);
+        ckd_free(srv->decs[i].partial);
+    }
+    ckd_free(srv->decs);
+    ckd_free(srv->workers);
+    if (srv->listen_fd >= 0)
+        close(srv->listen_fd);
+#ifdef SERVER_EPOLL
+    if (srv->epoll_fd >= 0)
+        close(srv->epoll_fd);
+#endif
+    if (srv->wake[0] >= 0) {
+        close(srv->wake[0]);
+        close(srv->wake[1]);
+    }
+    sbevent_free(srv->work);
+    sbmtx_free(srv->mtx);
+    ckd_free(srv);
+}
+
+int
+main(int argc, char *argv[])
+{
+    cmd_ln_t *config;
+    ps_decoder_t *ps;
+    server_t *srv;
+    char const *cfg;
+    int rv;
+
+    config = cmd_ln_parse_r(NULL, server_args_def, argc, argv, TRUE);
+    /* Handle argument file as -argfile. */
+    if (config && (cfg = cmd_ln_str_r(config, "-argfile")) != NULL)
+        config = cmd_ln_parse_file_r(config, server_args_def, cfg, FALSE);
+    if (config == NULL)
+        return 1;
+    ps_default_search_args(config);
+    if ((ps = ps_init(config)) == NULL) {
+        cmd_ln_free_r(config);
+        return 1;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    srv = server_init(config, ps);
+    signal(SIGINT, server_interrupt);
+    signal(SIGTERM, server_interrupt);
+    rv = server_run(srv);
+    server_free(srv);
+    ps_free(ps);
+    cmd_ln_free_r(config);
+    return rv < 0 ? 1 : 0;
+}
+#endif /* !_WIN32 */
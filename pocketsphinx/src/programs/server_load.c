@@ -0,0 +1,431 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2026 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * server_load.c - load test for pocketsphinx_server
+ *
+ * This sends the same recording over many connections at once, at
+ * each of a list of levels of concurrency, pacing it like live audio
+ * (or faster), and writes a line per level with the throughput and
+ * the latency of the final results, that is the time from the end of
+ * the audio to the result, along with that of the first partial
+ * result.
+ **/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <sphinxbase/err.h>
+
+int
+main(int argc, char *argv[])
+{
+    E_ERROR("%s is not supported on Windows\n", argv[0]);
+    return 1;
+}
+#else /* !_WIN32 */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+
+static const arg_t load_args_def[] = {
+    { "-host",
+      ARG_STRING,
+      "127.0.0.1",
+      "Address of the server" },
+    { "-port",
+      ARG_INT32,
+      "8086",
+      "Port of the server" },
+    { "-infile",
+      ARG_STRING,
+      NULL,
+      "Audio to send (raw 16-bit PCM at the server's sampling rate)" },
+    { "-samprate",
+      ARG_INT32,
+      "16000",
+      "Sampling rate of the audio" },
+    { "-conc",
+      ARG_STRING,
+      "1,10,100",
+      "Comma-separated numbers of connections at once to test" },
+    { "-nutt",
+      ARG_INT32,
+      "0",
+      "Utterances to send at each level (0 for three times the concurrency)" },
+    { "-speed",
+      ARG_FLOAT32,
+      "1.0",
+      "Speed of sending relative to real time (0 for as fast as possible)" },
+    { "-chunk",
+      ARG_INT32,
+      "100",
+      "Milliseconds of audio to send at once" },
+    { NULL, 0, NULL, NULL }
+};
+
+/**
+ * Connection sending one utterance.
+ */
+typedef struct client_s {
+    int fd;
+    size_t sent;          /**< Bytes sent so far. */
+    double start;         /**< Time of connection. */
+    double end_sent;      /**< Time the audio was all sent, or 0. */
+    double partial;       /**< Time of first partial result, or 0. */
+    double final;         /**< Time of final result, or 0. */
+    char line[1024];      /**< Start of a line of results. */
+    size_t n_line;
+} client_t;
+
+/**
+ * Test at one level of concurrency.
+ */
+typedef struct load_s {
+    struct sockaddr_in addr;
+    uint8 const *audio;
+    size_t n_audio;
+    double bytes_per_sec;   /**< Rate to send at, or 0. */
+    size_t chunk;           /**< Bytes to send at once. */
+    client_t *clients;
+    int n_clients;
+    int n_started, n_utt;
+    double *latency;        /**< Final result latencies. */
+    double *partial;        /**< First partial result latencies. */
+    int n_latency, n_partial, n_errors;
+} load_t;
+
+static double
+now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static int
+client_start(load_t *load, client_t *cl)
+{
+    memset(cl, 0, sizeof(*cl));
+    cl->fd = -1;
+    /* A failure counts against the utterance, not the connection. */
+    while (load->n_started < load->n_utt) {
+        ++load->n_started;
+        if ((cl->fd = socket(AF_INET, SOCK_STREAM, 0)) >= 0
+            && connect(cl->fd, (struct sockaddr *)&load->addr,
+                       sizeof(load->addr)) == 0) {
+            fcntl(cl->fd, F_SETFL, fcntl(cl->fd, F_GETFL, 0) | O_NONBLOCK);
+            cl->start = now();
+            return 0;
+        }
+        E_ERROR_SYSTEM("Failed to connect");
+        if (cl->fd >= 0)
+            close(cl->fd);
+        cl->fd = -1;
+        ++load->n_errors;
+    }
+    return -1;
+}
+
+/* Bytes which should have been sent by time t. */
+static size_t
+client_due(load_t *load, client_t *cl, double t)
+{
+    size_t due;
+
+    if (load->bytes_per_sec <= 0)
+        return load->n_audio;
+    due = (size_t)((t - cl->start) * load->bytes_per_sec / load->chunk + 1)
+        * load->chunk;
+    return due < load->n_audio ? due : load->n_audio;
+}
+
+static void
+client_send(load_t *load, client_t *cl, double t)
+{
+    size_t due = client_due(load, cl, t);
+
+    while (cl->sent < due) {
+        ssize_t n = write(cl->fd, load->audio + cl->sent, due - cl->sent);
+
+        if (n <= 0)
+            break;
+        cl->sent += n;
+    }
+    if (cl->sent == load->n_audio && cl->end_sent == 0) {
+        cl->end_sent = now();
+        shutdown(cl->fd, SHUT_WR);
+    }
+}
+
+/* Read results, returning TRUE when the connection is closed. */
+static int
+client_recv(load_t *load, client_t *cl, double t)
+{
+    char buf[4096];
+    ssize_t n;
+    int i;
+
+    if ((n = read(cl->fd, buf, sizeof(buf))) < 0)
+        return (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+    if (n == 0)
+        return TRUE;
+    for (i = 0; i < n; ++i) {
+        if (buf[i] != '\n') {
+            if (cl->n_line < sizeof(cl->line) - 1)
+                cl->line[cl->n_line++] = buf[i];
+            continue;
+        }
+        cl->line[cl->n_line] = '\0';
+        if (0 == strncmp(cl->line, "PARTIAL", 7) && cl->partial == 0)
+            cl->partial = t;
+        else if (0 == strncmp(cl->line, "FINAL", 5))
+            cl->final = t;
+        cl->n_line = 0;
+    }
+    return FALSE;
+}
+
+static void
+client_finish(load_t *load, client_t *cl)
+{
+    close(cl->fd);
+    cl->fd = -1;
+    if (cl->final == 0 || cl->end_sent == 0) {
+        ++load->n_errors;
+        return;
+    }
+    load->latency[load->n_latency++] = cl->final - cl->end_sent;
+    if (cl->partial)
+        load->partial[load->n_partial++] = cl->partial - cl->start;
+}
+
+static int
+cmp_double(void const *a, void const *b)
+{
+    double da = *(double const *)a, db = *(double const *)b;
+
+    return (da > db) - (da < db);
+}
+
+/* Value below which a fraction of the (sorted) values fall. */
+static double
+percentile(double const *x, int n, double p)
+{
+    int i;
+
+    if (n == 0)
+        return 0;
+    i = (int)(p * n);
+    return x[i < n ? i : n - 1];
+}
+
+static void
+load_run(load_t *load, int conc, int n_utt)
+{
+    struct pollfd *pfds;
+    double start, elapsed, mean;
+    int i, n_active;
+
+    load->clients = ckd_calloc(conc, sizeof(*load->clients));
+    load->n_clients = conc;
+    load->n_started = 0;
+    load->n_utt = n_utt;
+    load->latency = ckd_calloc(n_utt, sizeof(*load->latency));
+    load->partial = ckd_calloc(n_utt, sizeof(*load->partial));
+    load->n_latency = load->n_partial = load->n_errors = 0;
+    pfds = ckd_calloc(conc, sizeof(*pfds));
+
+    start = now();
+    for (i = 0; i < conc; ++i)
+        client_start(load, &load->clients[i]);
+    for (;;) {
+        double t = now(), next = 0;
+        int timeout;
+
+        n_active = 0;
+        for (i = 0; i < conc; ++i) {
+            client_t *cl = &load->clients[i];
+
+            pfds[i].fd = cl->fd;
+            pfds[i].events = 0;
+            pfds[i].revents = 0;
+            if (cl->fd < 0)
+                continue;
+            ++n_active;
+            pfds[i].events = POLLIN;
+            if (cl->sent < load->n_audio) {
+                if (cl->sent < client_due(load, cl, t))
+                    pfds[i].events |= POLLOUT;
+                else {
+                    /* When the next chunk is due. */
+                    double due = cl->start
+                        + (double)cl->sent / load->bytes_per_sec;
+                    if (next == 0 || due < next)
+                        next = due;
+                }
+            }
+        }
+        if (n_active == 0)
+            break;
+        timeout = -1;
+        if (next > 0)
+            timeout = next > t ? (int)((next - t) * 1000) + 1 : 0;
+        if (poll(pfds, conc, timeout) < 0 && errno != EINTR) {
+            E_ERROR_SYSTEM("Failed to wait for events");
+            break;
+        }
+        t = now();
+        for (i = 0; i < conc; ++i) {
+            client_t *cl = &load->clients[i];
+
+            if (cl->fd < 0)
+                continue;
+            if (cl->sent < load->n_audio)
+                client_send(load, cl, t);
+            if ((pfds[i].revents & (POLLIN | POLLHUP | POLLERR))
+                && client_recv(load, cl, t)) {
+                client_finish(load, cl);
+                client_start(load, cl);
+            }
+        }
+    }
+    elapsed = now() - start;
+
+    qsort(load->latency, load->n_latency, sizeof(*load->latency), cmp_double);
+    qsort(load->partial, load->n_partial, sizeof(*load->partial), cmp_double);
+    for (mean = 0, i = 0; i < load->n_latency; ++i)
+        mean += load->latency[i];
+    if (load->n_latency)
+        mean /= load->n_latency;
+    printf("%6d %6d %6d %8.2f %8.2f %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f\n",
+           conc, load->n_latency, load->n_errors,
+           load->n_latency / elapsed,
+           load->n_latency * load->n_audio / 2.0
+           / cmd_ln_int32("-samprate") / elapsed,
+           mean,
+           percentile(load->latency, load->n_latency, 0.5),
+           percentile(load->latency, load->n_latency, 0.9),
+           percentile(load->latency, load->n_latency, 0.99),
+           load->n_latency ? load->latency[load->n_latency - 1] : 0,
+           percentile(load->partial, load->n_partial, 0.5));
+    fflush(stdout);
+
+    ckd_free(pfds);
+    ckd_free(load->clients);
+    ckd_free(load->latency);
+    ckd_free(load->partial);
+}
+
+int
+main(int argc, char *argv[])
+{
+    load_t load;
+    FILE *fh;
+    uint8 *audio;
+    long size;
+    char *conc, *c, *next;
+    float32 speed;
+
+    if (cmd_ln_parse(load_args_def, argc, argv, TRUE) < 0)
+        return 1;
+    if (cmd_ln_str("-infile") == NULL) {
+        E_ERROR("Specify '-infile <file.raw>' to send\n");
+        return 1;
+    }
+    if ((fh = fopen(cmd_ln_str("-infile"), "rb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open %s", cmd_ln_str("-infile"));
+        return 1;
+    }
+    fseek(fh, 0, SEEK_END);
+    size = ftell(fh) & ~1;
+    fseek(fh, 0, SEEK_SET);
+    audio = ckd_malloc(size > 0 ? size : 1);
+    if (fread(audio, 1, size, fh) != (size_t)size) {
+        E_ERROR_SYSTEM("Failed to read %s", cmd_ln_str("-infile"));
+        fclose(fh);
+        return 1;
+    }
+    fclose(fh);
+
+    memset(&load, 0, sizeof(load));
+    load.addr.sin_family = AF_INET;
+    load.addr.sin_port = htons(cmd_ln_int32("-port"));
+    if (inet_pton(AF_INET, cmd_ln_str("-host"), &load.addr.sin_addr) != 1) {
+        E_ERROR("Invalid address %s\n", cmd_ln_str("-host"));
+        return 1;
+    }
+    load.audio = audio;
+    load.n_audio = size;
+    speed = cmd_ln_float32("-speed");
+    load.bytes_per_sec = speed * cmd_ln_int32("-samprate") * 2;
+    load.chunk = (size_t)(cmd_ln_int32("-chunk") / 1000.0
+                          * cmd_ln_int32("-samprate")) * 2;
+    if (load.chunk == 0)
+        load.chunk = 2;
+
+    printf("%6s %6s %6s %8s %8s %8s %8s %8s %8s %8s %8s\n",
+           "conc", "utts", "errors", "utt/s", "xRT", "mean",
+           "p50", "p90", "p99", "max", "partial");
+    conc = ckd_salloc(cmd_ln_str("-conc"));
+    for (c = conc; c && *c; c = next) {
+        int n, n_utt;
+
+        if ((next = strchr(c, ',')) != NULL)
+            *next++ = '\0';
+        if ((n = atoi(c)) <= 0)
+            continue;
+        n_utt = cmd_ln_int32("-nutt");
+        if (n_utt <= 0)
+            n_utt = 3 * n;
+        load_run(&load, n, n_utt);
+    }
+    ckd_free(conc);
+    ckd_free(audio);
+    cmd_ln_free();
+    return 0;
+}
+#endif /* !_WIN32 */
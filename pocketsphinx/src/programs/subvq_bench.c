@@ -0,0 +1,299 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * subvq_bench.c - compare sub-vector quantized Gaussian selection
+ * with full evaluation of continuous models
+ *
+ * This scores every senone in every frame of a set of feature files,
+ * once with -subvq and once without, and reports how long each took
+ * and how much the selection changed the scores.  If a language
+ * model or grammar is given, it also decodes each file both ways and
+ * compares the results.
+ **/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/feat.h>
+#include <sphinxbase/pio.h>
+#include <sphinxbase/profile.h>
+#include <sphinxbase/strfuncs.h>
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/byteorder.h>
+
+#include <pocketsphinx.h>
+
+#include "pocketsphinx_internal.h"
+#include "subvq_mgau.h"
+
+static const arg_t bench_args[] = {
+    POCKETSPHINX_OPTIONS,
+    { "-ctl",
+      ARG_STRING,
+      NULL,
+      "Control file listing feature files to score" },
+    { "-cepdir",
+      ARG_STRING,
+      NULL,
+      "Input files directory (prefixed to filespecs in control file)" },
+    { "-cepext",
+      ARG_STRING,
+      ".mfc",
+      "Input files extension (suffixed to filespecs in control file)" },
+    CMDLN_EMPTY_OPTION
+};
+
+static mfcc_t **
+read_mfc_file(char const *file, int *out_nfr, int ceplen)
+{
+    FILE *infh;
+    long flen;
+    int32 nmfc, nfr;
+    float32 *floats;
+    mfcc_t **mfcs;
+    int swap, i;
+
+    if ((infh = fopen(file, "rb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open %s", file);
+        return NULL;
+    }
+    fseek(infh, 0, SEEK_END);
+    flen = ftell(infh);
+    fseek(infh, 0, SEEK_SET);
+    if (fread(&nmfc, 4, 1, infh) != 1) {
+        E_ERROR_SYSTEM("Failed to read 4 bytes from MFCC file");
+        fclose(infh);
+        return NULL;
+    }
+    swap = 0;
+    if (nmfc != flen / 4 - 1) {
+        SWAP_INT32(&nmfc);
+        swap = 1;
+    }
+    if (nmfc != flen / 4 - 1 || nmfc < ceplen) {
+        E_ERROR("Bad MFCC file %s\n", file);
+        fclose(infh);
+        return NULL;
+    }
+    nfr = nmfc / ceplen;
+    mfcs = ckd_calloc_2d(nfr, ceplen, sizeof(**mfcs));
+    floats = (float32 *)mfcs[0];
+    if (fread(floats, 4, nfr * ceplen, infh) != nfr * ceplen) {
+        E_ERROR_SYSTEM("Failed to read %d items from mfcfile", nfr * ceplen);
+        ckd_free_2d(mfcs);
+        fclose(infh);
+        return NULL;
+    }
+    fclose(infh);
+    if (swap) {
+        for (i = 0; i < nfr * ceplen; ++i)
+            SWAP_FLOAT32(&floats[i]);
+    }
+#ifdef FIXED_POINT
+    for (i = 0; i < nfr * ceplen; ++i)
+        mfcs[0][i] = FLOAT2MFCC(floats[i]);
+#endif
+    *out_nfr = nfr;
+    return mfcs;
+}
+
+/**
+ * Decode an utterance and return its hypothesis and CPU time.
+ */
+static char *
+decode(ps_decoder_t *ps, mfcc_t **mfcs, int nfr, double *out_cpu)
+{
+    double nspeech, nwall;
+    char const *hyp;
+
+    ps_start_stream(ps);
+    ps_start_utt(ps);
+    ps_process_cep(ps, mfcs, nfr, FALSE, TRUE);
+    ps_end_utt(ps);
+    ps_get_utt_time(ps, &nspeech, out_cpu, &nwall);
+    hyp = ps_get_hyp(ps, NULL);
+    return ckd_salloc(hyp ? hyp : "");
+}
+
+int
+main(int argc, char *argv[])
+{
+    cmd_ln_t *config, *msconfig;
+    ps_decoder_t *ps, *msps;
+    acmod_t *acmod, *msacmod;
+    subvq_mgau_t *svq;
+    ptmr_t tm, mstm;
+    lineiter_t *li;
+    FILE *ctlfh;
+    int16 *senscr, *msscr;
+    int32 n_sen, n_frame, n_top1, n_utt, n_hyp, t, i;
+    float64 n_gau, err, maxerr, dec_cpu, msdec_cpu;
+
+    config = cmd_ln_parse_r(NULL, bench_args, argc, argv, TRUE);
+    msconfig = cmd_ln_parse_r(NULL, bench_args, argc, argv, FALSE);
+    if (config == NULL || msconfig == NULL)
+        return 1;
+    if (cmd_ln_str_r(config, "-subvq") == NULL
+        || cmd_ln_str_r(config, "-ctl") == NULL)
+        E_FATAL("Both -subvq and -ctl are required\n");
+    if ((ctlfh = fopen(cmd_ln_str_r(config, "-ctl"), "r")) == NULL)
+        E_FATAL_SYSTEM("Failed to open control file '%s'",
+                       cmd_ln_str_r(config, "-ctl"));
+
+    /* The reference decoder uses the full model. */
+    cmd_ln_set_str_r(msconfig, "-subvq", NULL);
+    if ((ps = ps_init(config)) == NULL || (msps = ps_init(msconfig)) == NULL)
+        E_FATAL("PocketSphinx decoder init failed\n");
+    acmod = ps->acmod;
+    msacmod = msps->acmod;
+    if (strcmp(acmod->mgau->vt->name, "subvq") != 0)
+        E_FATAL("Sub-vector quantized Gaussian selection is not in use\n");
+    svq = (subvq_mgau_t *)acmod->mgau;
+    n_sen = bin_mdef_n_sen(acmod->mdef);
+    senscr = ckd_calloc(n_sen, sizeof(*senscr));
+    msscr = ckd_calloc(n_sen, sizeof(*msscr));
+
+    ptmr_init(&tm);
+    ptmr_init(&mstm);
+    n_frame = n_top1 = n_utt = n_hyp = 0;
+    n_gau = err = maxerr = dec_cpu = msdec_cpu = 0;
+    for (li = lineiter_start_clean(ctlfh); li; li = lineiter_next(li)) {
+        char *wptr[1];
+        mfcc_t ***feat;
+        int32 nfr;
+
+        if (str2words(li->buf, wptr, 1) != 1)
+            continue;
+        nfr = feat_s2mfc2feat(acmod->fcb, wptr[0],
+                              cmd_ln_str_r(config, "-cepdir"),
+                              cmd_ln_str_r(config, "-cepext"),
+                              0, -1, NULL, -1);
+        if (nfr <= 0) {
+            E_ERROR("Failed to read features from %s\n", wptr[0]);
+            continue;
+        }
+        feat = feat_array_alloc(acmod->fcb, nfr);
+        nfr = feat_s2mfc2feat(acmod->fcb, wptr[0],
+                              cmd_ln_str_r(config, "-cepdir"),
+                              cmd_ln_str_r(config, "-cepext"),
+                              0, -1, feat, nfr);
+        for (t = 0; t < nfr; ++t) {
+            int32 best, msbest;
+
+            svq->n_gau_eval = 0;
+            ptmr_start(&tm);
+            ps_mgau_frame_eval(acmod->mgau, senscr, NULL, 0, feat[t], t, TRUE);
+            ptmr_stop(&tm);
+            n_gau += svq->n_gau_eval;
+            ptmr_start(&mstm);
+            ps_mgau_frame_eval(msacmod->mgau, msscr, NULL, 0, feat[t], t, TRUE);
+            ptmr_stop(&mstm);
+
+            /* Scores are normalized to the best senone, which is 0. */
+            best = msbest = 0;
+            for (i = 0; i < n_sen; ++i) {
+                float64 e = (float64)senscr[i] - msscr[i];
+
+                if (e < 0)
+                    e = -e;
+                err += e;
+                if (e > maxerr)
+                    maxerr = e;
+                if (senscr[i] < senscr[best])
+                    best = i;
+                if (msscr[i] < msscr[msbest])
+                    msbest = i;
+            }
+            if (best == msbest)
+                ++n_top1;
+        }
+        n_frame += nfr;
+        feat_array_free(feat);
+
+        if (ps_get_search(ps)) {
+            mfcc_t **mfcs;
+            char *file, *hyp, *mshyp;
+            double cpu, mscpu;
+
+            file = string_join(cmd_ln_str_r(config, "-cepdir")
+                               ? cmd_ln_str_r(config, "-cepdir") : "",
+                               cmd_ln_str_r(config, "-cepdir") ? "/" : "",
+                               wptr[0], cmd_ln_str_r(config, "-cepext"), NULL);
+            mfcs = read_mfc_file(file, &nfr, cmd_ln_int32_r(config, "-ceplen"));
+            ckd_free(file);
+            if (mfcs == NULL)
+                continue;
+            hyp = decode(ps, mfcs, nfr, &cpu);
+            mshyp = decode(msps, mfcs, nfr, &mscpu);
+            printf("%s: %s\n", wptr[0], hyp);
+            if (strcmp(hyp, mshyp) == 0)
+                ++n_hyp;
+            else
+                printf("%s: %s (full)\n", wptr[0], mshyp);
+            dec_cpu += cpu;
+            msdec_cpu += mscpu;
+            ++n_utt;
+            ckd_free(hyp);
+            ckd_free(mshyp);
+            ckd_free_2d(mfcs);
+        }
+    }
+    fclose(ctlfh);
+
+    if (n_frame > 0) {
+        printf("Frames: %d\n", n_frame);
+        printf("Gaussians evaluated: %.2f%%\n", 100.0 * n_gau / n_frame
+               / svq->g->n_mgau / svq->g->n_density);
+        printf("Same best senone: %.2f%%\n", 100.0 * n_top1 / n_frame);
+        printf("Senone score error: %.2f mean, %.0f max\n",
+               err / n_frame / n_sen, maxerr);
+        printf("CPU time: %.3f sec subvq, %.3f sec full (%.2fx)\n",
+               tm.t_cpu, mstm.t_cpu,
+               tm.t_cpu > 0 ? mstm.t_cpu / tm.t_cpu : 0.0);
+    }
+    if (n_utt > 0) {
+        printf("Same hypothesis: %d of %d utterances\n", n_hyp, n_utt);
+        printf("Decoding CPU time: %.3f sec subvq, %.3f sec full (%.2fx)\n",
+               dec_cpu, msdec_cpu, dec_cpu > 0 ? msdec_cpu / dec_cpu : 0.0);
+    }
+
+    ckd_free(senscr);
+    ckd_free(msscr);
+    ps_free(ps);
+    ps_free(msps);
+    cmd_ln_free_r(config);
+    cmd_ln_free_r(msconfig);
+    return 0;
+}
@@ -252,6 +252,21 @@
         return ps_get_search($self);
     }
 
+    void add_concurrent_search(const char *search_name, int *errcode) {
+      *errcode = ps_add_concurrent_search($self, search_name);
+    }
+
+    void clear_concurrent_searches(int *errcode) {
+      *errcode = ps_clear_concurrent_searches($self);
+    }
+
+    Hypothesis * search_hyp(const char *search_name) {
+        char const *hyp;
+        int best_score;
+        hyp = ps_get_search_hyp($self, search_name, &best_score);
+        return hyp ? new_Hypothesis(hyp, best_score, 0) : NULL;
+    }
+
     int n_frames() {
         return ps_get_n_frames($self);
     }
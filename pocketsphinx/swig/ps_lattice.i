@@ -56,4 +56,8 @@
     void write_htk(char const *path, int *errcode) {
         *errcode = ps_lattice_write_htk($self, path);
     }
+
+    void write_bin(char const *path, int *errcode) {
+        *errcode = ps_lattice_write_bin($self, path);
+    }
 }
@@ -0,0 +1,61 @@
+#!/bin/sh
+# Decode the test data with a range of models and search
+# configurations, appending one line of JSON per configuration with
+# its speed, live latency, memory use and word error rate to the file
+# given as the first argument (default benchmark.json).  Compare the
+# output from two builds to find performance regressions.  This is not
+# run by "make check".
+
+. ../testfuncs.sh
+
+out=${1:-benchmark.json}
+bn=`basename $0 .sh`
+
+echo "Benchmark: $bn"
+
+# A block of 100ms at 16kHz, as pocketsphinx_continuous would read it.
+livesim=1600
+
+bench() {
+    name="$1"
+    shift
+    run_program pocketsphinx_batch -benchname $name -benchout $out \
+        -stagetime yes "$@" >> $bn.log 2>&1
+    if [ $? = 0 ]; then
+        pass "$name"
+    else
+        fail "$name"
+    fi
+}
+
+ptm="-hmm $model/en-us/en-us -dict $model/en-us/cmudict-en-us.dict"
+librivox="-ctl $data/librivox/fileids -cepdir $data/librivox -cepext .wav
+    -adcin yes -ref $data/librivox/transcription"
+bench ptm-fwdtree $ptm $librivox -lm $model/en-us/en-us.lm.bin \
+    -fwdflat no -bestpath no
+bench ptm-fwdflat-bestpath $ptm $librivox -lm $model/en-us/en-us.lm.bin
+bench ptm-live $ptm $librivox -lm $model/en-us/en-us.lm.bin \
+    -livesim $livesim
+
+semi="-hmm $data/tidigits/hmm -dict $data/tidigits/lm/tidigits.dic"
+tidigits="-ctl $data/tidigits/tidigits.ctl -cepdir $data/tidigits
+    -ref $data/tidigits/tidigits.lsn"
+bench semi-fwdtree $semi $tidigits -lm $data/tidigits/lm/tidigits.lm.bin \
+    -fwdflat no -bestpath no
+bench semi-fwdflat-bestpath $semi $tidigits \
+    -lm $data/tidigits/lm/tidigits.lm.bin
+bench semi-fsg $semi $tidigits -fsg $data/tidigits/lm/tidigits.fsg \
+    -wbeam 1e-48
+
+echo goforward > $bn.ctl
+echo "go forward ten meters (goforward)" > $bn.ref
+cont="-hmm $data/an4_ci_cont -dict $data/turtle.dic -samprate 16000
+    -ctl $bn.ctl -cepdir $data -cepext .raw -adcin yes -ref $bn.ref"
+bench cont-fwdtree $cont -lm $data/turtle.lm.bin -fwdflat no -bestpath no
+bench cont-fwdflat-bestpath $cont -lm $data/turtle.lm.bin
+bench cont-live $cont -lm $data/turtle.lm.bin -livesim $livesim
+bench cont-fsg $cont -fsg $data/goforward.fsg
+bench ptm-kws $ptm -ctl $bn.ctl -cepdir $data -cepext .raw -adcin yes \
+    -kws $data/goforward.kws
+
+cat $out
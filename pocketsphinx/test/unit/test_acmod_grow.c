@@ -59,6 +59,8 @@ main(int argc, char *argv[])
     cmd_ln_set_str_extra_r(config, "_mixw", NULL);
     cmd_ln_set_str_extra_r(config, "_lda", NULL);
     cmd_ln_set_str_extra_r(config, "_senmgau", NULL);
+    cmd_ln_set_str_extra_r(config, "_gauq8", NULL);
+    cmd_ln_set_str_extra_r(config, "_kdtree", NULL);
 
     TEST_ASSERT(acmod = acmod_init(config, lmath, NULL, NULL));
     cmn_live_set(acmod->fcb->cmn_struct, cmninit);
@@ -0,0 +1,132 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ms_mgau.h"
+#include "am_image.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+/* Compile an image of an4_ci_cont with the decoder's default floors. */
+static void
+write_image(char const *file, char const *logbase)
+{
+	cmd_ln_t *config;
+	logmath_t *lmath;
+	bin_mdef_t *mdef;
+	gauden_t *g;
+	senone_t *s;
+	tmat_t *t;
+
+	TEST_ASSERT(config = cmd_ln_init(NULL, ps_args(), TRUE,
+					 "-logbase", logbase, NULL));
+	lmath = logmath_init(cmd_ln_float32_r(config, "-logbase"), 0, 0);
+	TEST_ASSERT(mdef = bin_mdef_read(NULL, DATADIR "/an4_ci_cont/mdef"));
+	TEST_ASSERT(g = gauden_init(DATADIR "/an4_ci_cont/means",
+				    DATADIR "/an4_ci_cont/variances",
+				    cmd_ln_float32_r(config, "-varfloor"), lmath));
+	TEST_ASSERT(s = senone_init(g, DATADIR "/an4_ci_cont/mixture_weights",
+				    NULL, cmd_ln_float32_r(config, "-mixwfloor"),
+				    lmath, mdef));
+	TEST_ASSERT(t = tmat_init(DATADIR "/an4_ci_cont/transition_matrices",
+				  lmath, cmd_ln_float32_r(config, "-tmatfloor"),
+				  TRUE));
+	TEST_EQUAL(0, am_image_write(file, g, s, t, config));
+	tmat_free(t);
+	senone_free(s);
+	gauden_free(g);
+	bin_mdef_free(mdef);
+	logmath_free(lmath);
+	cmd_ln_free_r(config);
+}
+
+static void
+truncate_file(char const *file, size_t size)
+{
+	FILE *fh;
+	char *buf;
+
+	buf = ckd_calloc(size, 1);
+	TEST_ASSERT(fh = fopen(file, "rb"));
+	TEST_EQUAL(size, fread(buf, 1, size, fh));
+	fclose(fh);
+	TEST_ASSERT(fh = fopen(file, "wb"));
+	TEST_EQUAL(size, fwrite(buf, 1, size, fh));
+	fclose(fh);
+	ckd_free(buf);
+}
+
+/* Decode with or without the image, checking what came from it. */
+static char *
+decode(char const *image, char const *mmap, char const *mllr,
+       int image_used, int32 *out_score)
+{
+	ps_decoder_t *ps;
+	ms_mgau_model_t *msg;
+	char *hyp;
+
+	ps = ps_test_init(DATADIR "/an4_ci_cont", DATADIR "/turtle.dic",
+			  "-lm", DATADIR "/turtle.lm.bin",
+			  "-amimage", image,
+			  "-mllr", mllr,
+			  "-mmap", mmap,
+			  "-samprate", "16000", NULL);
+	TEST_EQUAL(0, strcmp(ps->acmod->mgau->vt->name, "ms"));
+	msg = (ms_mgau_model_t *)ps->acmod->mgau;
+	TEST_EQUAL(image_used, msg->s->image != NULL);
+	TEST_EQUAL(image_used, ps->acmod->tmat->image != NULL);
+	/* Adapted codebooks no longer come from the image. */
+	TEST_EQUAL(image_used && !mllr, msg->g->image != NULL);
+	printf("image %s, mmap %s, mllr %s\n",
+	       image ? image : "none", mmap, mllr ? mllr : "none");
+	hyp = ps_test_decode(ps, DATADIR "/goforward.raw", out_score);
+	ps_free(ps);
+	return hyp;
+}
+
+int
+main(int argc, char *argv[])
+{
+	char *hyp, *hyp2;
+	int32 score, score2;
+
+	/* The image has exactly the parameters read from the model. */
+	write_image("test_am_image.img", "1.0001");
+	hyp = decode(NULL, "yes", NULL, FALSE, &score);
+	hyp2 = decode("test_am_image.img", "yes", NULL, TRUE, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	hyp2 = decode("test_am_image.img", "no", NULL, TRUE, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	ckd_free(hyp);
+
+	/* MLLR reloads the codebooks from the model files. */
+	hyp = decode(NULL, "yes", DATADIR "/mllr_matrices", FALSE, &score);
+	hyp2 = decode("test_am_image.img", "yes", DATADIR "/mllr_matrices",
+		      TRUE, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	ckd_free(hyp);
+
+	/* An image built for another log base is not used. */
+	write_image("test_am_image.img", "1.0003");
+	hyp = decode(NULL, "yes", NULL, FALSE, &score);
+	hyp2 = decode("test_am_image.img", "yes", NULL, FALSE, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	ckd_free(hyp);
+
+	/* Nor is a truncated one. */
+	truncate_file("test_am_image.img", 4096);
+	hyp2 = decode("test_am_image.img", "no", NULL, FALSE, &score2);
+	TEST_ASSERT(hyp2 != NULL);
+	ckd_free(hyp2);
+
+	return 0;
+}
@@ -0,0 +1,118 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+static char const *files[] = {
+	DATADIR "/goforward.raw",
+	DATADIR "/numbers.raw",
+	DATADIR "/something.raw",
+	DATADIR "/goforward.raw"
+};
+#define N_FILES (sizeof(files) / sizeof(files[0]))
+
+/* Results are the same whichever thread decodes an utterance. */
+static void
+test_same(ps_batch_t *batch, int idx, ps_batch_t *ref, int ref_idx)
+{
+	char const *hyp, *ref_hyp;
+	int32 score, ref_score;
+
+	hyp = ps_batch_hyp(batch, idx, &score);
+	ref_hyp = ps_batch_hyp(ref, ref_idx, &ref_score);
+	printf("%s: %s (%d)\n", ps_batch_uttid(batch, idx), hyp, score);
+	TEST_ASSERT(hyp && ref_hyp);
+	TEST_EQUAL(0, strcmp(hyp, ref_hyp));
+	TEST_EQUAL(score, ref_score);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	ps_batch_t *ref, *batch;
+	cmd_ln_t *config;
+	FILE *rawfh;
+	int16 *buf;
+	size_t n_samples;
+	double nspeech, ncpu, nwall;
+	int i, j;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	fseek(rawfh, 0, SEEK_END);
+	n_samples = ftell(rawfh) / sizeof(*buf);
+	fseek(rawfh, 0, SEEK_SET);
+	buf = ckd_calloc(n_samples, sizeof(*buf));
+	TEST_EQUAL(n_samples, fread(buf, sizeof(*buf), n_samples, rawfh));
+	fclose(rawfh);
+
+	/* One thread, one utterance after the other. */
+	TEST_ASSERT(ref = ps_batch_init(ps, 1));
+	for (i = 0; i < N_FILES; ++i)
+		TEST_EQUAL(i, ps_batch_add_file(ref, files[i], files[i]));
+	TEST_EQUAL(N_FILES, ps_batch_add_raw(ref, "buffer", buf, n_samples));
+	TEST_ASSERT(ps_batch_add_file(ref, "missing", "nonexistent.raw") < 0);
+	TEST_EQUAL(N_FILES + 1, ps_batch_n_utts(ref));
+	TEST_ASSERT(ps_batch_hyp(ref, 0, NULL) == NULL);
+	TEST_ASSERT(ps_batch_utt_time(ref, 0, &nspeech, &ncpu, &nwall) < 0);
+	TEST_EQUAL(0, ps_batch_run(ref));
+	TEST_EQUAL(0, strcmp(ps_batch_hyp(ref, 0, NULL), "go forward ten meters"));
+	/* Live CMN starts over for each utterance. */
+	test_same(ref, N_FILES - 1, ref, 0);
+	test_same(ref, N_FILES, ref, 0);
+	for (i = 0; i <= N_FILES; ++i) {
+		TEST_EQUAL(0, ps_batch_utt_time(ref, i, &nspeech, &ncpu, &nwall));
+		TEST_ASSERT(nspeech > 0);
+	}
+
+	/* Several threads, stealing each other's work. */
+	TEST_ASSERT(batch = ps_batch_init(ps, 3));
+	for (j = 0; j < 3; ++j)
+		for (i = 0; i < N_FILES; ++i)
+			TEST_EQUAL(j * N_FILES + i,
+				   ps_batch_add_file(batch, files[i], files[i]));
+	TEST_EQUAL(0, ps_batch_run(batch));
+	for (j = 0; j < 3; ++j)
+		for (i = 0; i < N_FILES; ++i)
+			test_same(batch, j * N_FILES + i, ref, i);
+
+	/* Utterances added later are decoded by the next run. */
+	TEST_EQUAL(3 * N_FILES, ps_batch_add_raw(batch, "buffer", buf, n_samples));
+	TEST_EQUAL(0, ps_batch_run(batch));
+	test_same(batch, 3 * N_FILES, ref, N_FILES);
+	ps_batch_free(batch);
+	ps_free(ps);
+	cmd_ln_free_r(config);
+
+	/* Copies of the models on each NUMA node decode the same way. */
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-numa", "replicate", "-mmap", "no",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(batch = ps_batch_init(ps, 4));
+	for (i = 0; i < N_FILES; ++i)
+		TEST_EQUAL(i, ps_batch_add_file(batch, files[i], files[i]));
+	TEST_EQUAL(0, ps_batch_run(batch));
+	for (i = 0; i < N_FILES; ++i)
+		test_same(batch, i, ref, i);
+
+	ps_batch_free(batch);
+	ps_batch_free(ref);
+	ckd_free(buf);
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return 0;
+}
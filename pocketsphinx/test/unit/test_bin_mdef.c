@@ -0,0 +1,62 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <pocketsphinx.h>
+#include <bin_mdef.h>
+
+#include "test_macros.h"
+
+/* Look up every context in the table and in the tree. */
+static void
+check_pid_map(bin_mdef_t *mdef)
+{
+	int32 *pid_map = mdef->pid_map;
+	int n_ci = bin_mdef_n_ciphone(mdef);
+	int wpos, b, l, r, n_exact = 0;
+
+	TEST_ASSERT(pid_map);
+	for (wpos = 0; wpos < N_WORD_POSN; ++wpos) {
+		for (b = 0; b < n_ci; ++b) {
+			for (l = 0; l < n_ci; ++l) {
+				for (r = 0; r < n_ci; ++r) {
+					int p, pn, ref, ref_n;
+
+					p = bin_mdef_phone_id(mdef, b, l, r, wpos);
+					pn = bin_mdef_phone_id_nearest(mdef, b, l, r, wpos);
+					mdef->pid_map = NULL;
+					ref = bin_mdef_phone_id(mdef, b, l, r, wpos);
+					ref_n = bin_mdef_phone_id_nearest(mdef, b, l, r, wpos);
+					mdef->pid_map = pid_map;
+					TEST_EQUAL(ref, p);
+					TEST_EQUAL(ref_n, pn);
+					if (p >= 0)
+						++n_exact;
+				}
+			}
+		}
+	}
+	printf("%d of %d contexts are in the model\n",
+	       n_exact, N_WORD_POSN * n_ci * n_ci * n_ci);
+	/* Missing contexts are still the CI phone. */
+	TEST_EQUAL(3, bin_mdef_phone_id(mdef, 3, -1, 5, WORD_POSN_INTERNAL));
+	TEST_EQUAL(3, bin_mdef_phone_id_nearest(mdef, 3, 5, -1,
+						WORD_POSN_INTERNAL));
+}
+
+int
+main(int argc, char *argv[])
+{
+	bin_mdef_t *mdef;
+
+	TEST_ASSERT(mdef = bin_mdef_read(NULL, MODELDIR "/en-us/en-us/mdef"));
+	check_pid_map(mdef);
+	bin_mdef_free(mdef);
+
+	/* Models with only CI phones, from text. */
+	TEST_ASSERT(mdef = bin_mdef_read(NULL, DATADIR "/an4_ci_cont/mdef"));
+	TEST_EQUAL(BIN_MDEF_FROM_TEXT, mdef->alloc_mode);
+	check_pid_map(mdef);
+	bin_mdef_free(mdef);
+
+	return 0;
+}
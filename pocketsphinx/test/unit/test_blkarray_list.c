@@ -0,0 +1,80 @@
+#include <stdio.h>
+
+#include <pocketsphinx.h>
+#include "blkarray_list.h"
+
+#include "test_macros.h"
+
+/* Append n entries, each holding its own index. */
+static void
+fill(blkarray_list_t *bl, int n)
+{
+	int i;
+
+	for (i = 0; i < n; ++i) {
+		int32 *data = ckd_malloc(sizeof(*data));
+		*data = i;
+		TEST_EQUAL(i, blkarray_list_append(bl, data));
+	}
+}
+
+static void
+check(blkarray_list_t *bl, int n)
+{
+	int i;
+
+	TEST_EQUAL(n, blkarray_list_n_valid(bl));
+	for (i = 0; i < n; ++i)
+		TEST_EQUAL(i, *(int32 *)blkarray_list_get(bl, i));
+	TEST_ASSERT(blkarray_list_get(bl, n) == NULL);
+	TEST_ASSERT(blkarray_list_get(bl, -1) == NULL);
+}
+
+int
+main(int argc, char *argv[])
+{
+	blkarray_list_t *bl;
+	int32 *data;
+
+	/* Blocks are a power of two in size. */
+	TEST_ASSERT(bl = _blkarray_list_init(100, 1000));
+	TEST_EQUAL(1024, blkarray_list_blksize(bl));
+	fill(bl, 3000);
+	check(bl, 3000);
+	TEST_EQUAL(3, blkarray_list_n_blks(bl));
+
+	/* They are kept when the list is reset, and filled again. */
+	blkarray_list_reset(bl);
+	check(bl, 0);
+	TEST_EQUAL(3, blkarray_list_n_blks(bl));
+	fill(bl, 2500);
+	check(bl, 2500);
+	TEST_EQUAL(3, blkarray_list_n_blks(bl));
+
+	/* With a limit, spare ones are freed, and the list stops growing. */
+	blkarray_list_reset(bl);
+	blkarray_list_set_max(bl, 1500);
+	TEST_EQUAL(2, blkarray_list_n_blks(bl));
+	fill(bl, 1500);
+	data = ckd_malloc(sizeof(*data));
+	TEST_EQUAL(-1, blkarray_list_append(bl, data));
+	ckd_free(data);
+	check(bl, 1500);
+	TEST_EQUAL(2, blkarray_list_n_blks(bl));
+
+	/* Not beyond the ones in use, though. */
+	blkarray_list_set_max(bl, 100);
+	TEST_EQUAL(2, blkarray_list_n_blks(bl));
+	blkarray_list_reset(bl);
+	blkarray_list_set_max(bl, 100);
+	TEST_EQUAL(1, blkarray_list_n_blks(bl));
+
+	/* And none without one. */
+	blkarray_list_set_max(bl, 0);
+	fill(bl, 3000);
+	check(bl, 3000);
+	TEST_EQUAL(3, blkarray_list_n_blks(bl));
+
+	blkarray_list_free(bl);
+	return 0;
+}
@@ -0,0 +1,62 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ngram_search.h"
+#include "test_macros.h"
+
+/* Decode an utterance with fwdtree alone, returning the hypothesis. */
+static char *
+decode(char const *bpgcfr, int32 *out_score, int32 *out_n_bp)
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps;
+	ngram_search_t *ngs;
+	FILE *rawfh;
+	char *hyp;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", DATADIR "/turtle.lm.bin",
+				"-dict", DATADIR "/turtle.dic",
+				"-fwdflat", "no",
+				"-bestpath", "no",
+				"-latsize", "100",
+				"-bpgcfr", bpgcfr,
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	hyp = ckd_salloc(ps_get_hyp(ps, out_score));
+	ngs = (ngram_search_t *)ps->search;
+	printf("bpgcfr %s: %s (%d), %d backpointers, %d collected\n",
+	       bpgcfr, hyp, *out_score, ngs->bpidx, ngs->st.n_bp_gc);
+	*out_n_bp = ngs->bpidx;
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return hyp;
+}
+
+/* Collecting unreachable backpointers must not change the result. */
+int
+main(int argc, char *argv[])
+{
+	char *hyp, *hyp2;
+	int32 score, score2, n_bp, n_bp2;
+
+	hyp = decode("0", &score, &n_bp);
+	hyp2 = decode("10", &score2, &n_bp2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	TEST_ASSERT(n_bp2 < n_bp);
+	ckd_free(hyp2);
+	hyp2 = decode("1", &score2, &n_bp2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	ckd_free(hyp);
+	return 0;
+}
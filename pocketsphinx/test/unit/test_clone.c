@@ -0,0 +1,119 @@
+#include <pocketsphinx.h>
+#include <sphinxbase/sbthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ngram_search.h"
+#include "test_macros.h"
+
+static int32 ref_score;
+
+static void
+decode(ps_decoder_t *ps, char const *file, int32 *out_score)
+{
+	FILE *rawfh;
+	char const *hyp;
+
+	TEST_ASSERT(rawfh = fopen(file, "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	hyp = ps_get_hyp(ps, out_score);
+	printf("%s (%d)\n", hyp, *out_score);
+	TEST_ASSERT(hyp);
+	TEST_EQUAL(0, strcmp(hyp, "go forward ten meters"));
+}
+
+static int
+decode_thread(sbthread_t *th)
+{
+	ps_decoder_t *ps = sbthread_arg(th);
+	int32 score;
+	int i;
+
+	for (i = 0; i < 2; ++i) {
+		decode(ps, DATADIR "/goforward.raw", &score);
+		TEST_EQUAL(ref_score, score);
+	}
+	return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps, *clone, *clone2;
+	sbthread_t *th[2];
+	cmd_ln_t *config;
+	int32 score;
+	char *kws;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_EQUAL(0, ps_set_keyphrase(ps, "kws", "forward"));
+	TEST_EQUAL(0, ps_set_jsgf_file(ps, "jsgf", DATADIR "/goforward.gram"));
+	decode(ps, DATADIR "/goforward.raw", &ref_score);
+
+	/* A clone decodes exactly like the original, with the same
+	 * language model and search tree. */
+	TEST_ASSERT(clone = ps_clone(ps));
+	TEST_EQUAL(0, strcmp(ps_get_search(clone), PS_DEFAULT_SEARCH));
+	TEST_ASSERT(ps_get_lm(clone, PS_DEFAULT_SEARCH)
+		    != ps_get_lm(ps, PS_DEFAULT_SEARCH));
+	TEST_ASSERT(((ngram_search_t *)clone->search)->lextree
+		    == ((ngram_search_t *)ps->search)->lextree);
+	decode(clone, DATADIR "/goforward.raw", &score);
+	TEST_EQUAL(ref_score, score);
+
+	/* Its configuration starts out the same, but is its own. */
+	TEST_ASSERT(ps_get_config(clone) != ps_get_config(ps));
+	TEST_ASSERT(cmd_ln_str_r(ps_get_config(clone), "-hmm")
+		    == cmd_ln_str_r(ps_get_config(ps), "-hmm"));
+	cmd_ln_set_boolean_r(ps_get_config(clone), "-backtrace", TRUE);
+	TEST_ASSERT(!cmd_ln_boolean_r(ps_get_config(ps), "-backtrace"));
+
+	/* So do its other searches. */
+	kws = (char *)ps_get_kws(clone, "kws");
+	TEST_EQUAL(0, strcmp(kws, "forward"));
+	ckd_free(kws);
+	TEST_ASSERT(ps_get_fsg(clone, "jsgf") == ps_get_fsg(ps, "jsgf"));
+	TEST_EQUAL(0, ps_set_search(clone, "jsgf"));
+	decode(clone, DATADIR "/goforward.raw", &score);
+	TEST_EQUAL(0, ps_set_search(clone, PS_DEFAULT_SEARCH));
+
+	/* Clones may decode in separate threads. */
+	TEST_ASSERT(clone2 = ps_clone(clone));
+	TEST_ASSERT(th[0] = sbthread_start(NULL, decode_thread, clone));
+	TEST_ASSERT(th[1] = sbthread_start(NULL, decode_thread, clone2));
+	sbthread_wait(th[0]);
+	sbthread_wait(th[1]);
+	sbthread_free(th[0]);
+	sbthread_free(th[1]);
+
+	/* Nobody can change the shared dictionary. */
+	TEST_EQUAL(-1, ps_add_word(clone, "foobie", "F UW B IY", TRUE));
+	TEST_EQUAL(-1, ps_add_word(ps, "foobie", "F UW B IY", TRUE));
+	TEST_EQUAL(-1, ps_load_dict(ps, MODELDIR "/en-us/cmudict-en-us.dict",
+				    NULL, NULL));
+
+	/* The original can go first. */
+	ps_free(ps);
+	ps_free(clone);
+	decode(clone2, DATADIR "/goforward.raw", &score);
+	TEST_EQUAL(ref_score, score);
+	ps_free(clone2);
+
+	/* And once the clones are gone, it can be changed again. */
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(clone = ps_clone(ps));
+	ps_free(clone);
+	TEST_ASSERT(ps_add_word(ps, "foobie", "F UW B IY", TRUE) >= 0);
+	ps_free(ps);
+
+	cmd_ln_free_r(config);
+	return 0;
+}
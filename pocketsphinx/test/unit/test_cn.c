@@ -0,0 +1,96 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+static void
+test_cn(ps_decoder_t *ps)
+{
+	ps_cn_t *cn;
+	ps_cn_iter_t *itor;
+	logmath_t *lmath = ps_get_logmath(ps);
+	char const *hyp;
+	int32 post, n_slots;
+	int last_ef;
+
+	TEST_ASSERT(cn = ps_get_cn(ps));
+	hyp = ps_cn_hyp(cn, &post);
+	printf("CONSENSUS: %s (%d)\n", hyp, post);
+	/* The third word is closer than the best path makes it seem. */
+	TEST_EQUAL(0, strncmp(hyp, "go forward ", 11));
+	TEST_EQUAL(0, strcmp(hyp + strlen(hyp) - 7, " meters"));
+	TEST_ASSERT(post <= 0);
+
+	n_slots = 0;
+	last_ef = -1;
+	for (itor = ps_cn_iter(cn); itor; itor = ps_cn_iter_next(itor)) {
+		float64 sum;
+		int sf, ef;
+		int32 i, wpost, prev_post;
+
+		/* Slots are in time order and do not overlap. */
+		ps_cn_iter_frames(itor, &sf, &ef);
+		TEST_ASSERT(sf > last_ef);
+		TEST_ASSERT(ef >= sf);
+		last_ef = ef;
+
+		/* Words are most likely first, and probabilities sum to one. */
+		sum = logmath_exp(lmath, ps_cn_iter_del_prob(itor));
+		prev_post = 0;
+		printf("%d:%d", sf, ef);
+		for (i = 0; i < ps_cn_iter_n_words(itor); ++i) {
+			char const *word = ps_cn_iter_word(itor, i, &wpost);
+			TEST_ASSERT(word);
+			TEST_ASSERT(wpost <= prev_post);
+			prev_post = wpost;
+			sum += logmath_exp(lmath, wpost);
+			printf(" %s %.3f", word, logmath_exp(lmath, wpost));
+		}
+		printf(" (none %.3f)\n",
+		       logmath_exp(lmath, ps_cn_iter_del_prob(itor)));
+		TEST_ASSERT(ps_cn_iter_word(itor, i, NULL) == NULL);
+		TEST_ASSERT(sum > 0.99 && sum < 1.01);
+		++n_slots;
+	}
+	TEST_EQUAL(n_slots, ps_cn_n_slots(cn));
+	TEST_ASSERT(ps_cn_retain(cn) == cn);
+	TEST_EQUAL(1, ps_cn_free(cn));
+	TEST_EQUAL(0, ps_cn_free(cn));
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	cmd_ln_t *config;
+	FILE *rawfh;
+	char const *bestpath;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	bestpath = ps_get_hyp(ps, NULL);
+	printf("BESTPATH: %s\n", bestpath);
+	TEST_EQUAL(0, strcmp(bestpath, "go forward ten meters"));
+	test_cn(ps);
+
+	/* Posteriors are computed even without -bestpath. */
+	cmd_ln_set_boolean_r(config, "-bestpath", FALSE);
+	ps_reinit(ps, NULL);
+	fseek(rawfh, 0, SEEK_SET);
+	ps_decode_raw(ps, rawfh, -1);
+	test_cn(ps);
+	fclose(rawfh);
+
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return 0;
+}
@@ -0,0 +1,112 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+static char const *names[] = { PS_DEFAULT_SEARCH, "grammar", "keyphrase" };
+#define N_SEARCH (sizeof(names) / sizeof(names[0]))
+
+static void
+decode(ps_decoder_t *ps)
+{
+	FILE *rawfh;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	TEST_ASSERT(ps_decode_raw(ps, rawfh, -1) > 0);
+	fclose(rawfh);
+}
+
+int
+main(int argc, char *argv[])
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps, *clone;
+	char *ref_hyp[N_SEARCH];
+	int32 ref_score[N_SEARCH], score;
+	char const *hyp;
+	int i;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_EQUAL(0, ps_set_jsgf_file(ps, "grammar", DATADIR "/goforward.gram"));
+	TEST_EQUAL(0, ps_set_keyphrase(ps, "keyphrase", "forward"));
+
+	/* Each search on its own. */
+	for (i = 0; i < N_SEARCH; ++i) {
+		TEST_EQUAL(0, ps_set_search(ps, names[i]));
+		decode(ps);
+		TEST_ASSERT(hyp = ps_get_hyp(ps, &ref_score[i]));
+		printf("%s: %s (%d)\n", names[i], hyp, ref_score[i]);
+		ref_hyp[i] = ckd_salloc(hyp);
+		/* The others did not run. */
+		TEST_ASSERT(ps_get_search_hyp(ps, names[(i + 1) % N_SEARCH],
+					      &score) == NULL);
+	}
+
+	/* All at once find the same, scoring the senones they have in
+	 * common once. */
+	TEST_EQUAL(0, ps_set_search(ps, PS_DEFAULT_SEARCH));
+	TEST_EQUAL(0, ps_add_concurrent_search(ps, "grammar"));
+	TEST_EQUAL(0, ps_add_concurrent_search(ps, "keyphrase"));
+	TEST_EQUAL(0, ps_add_concurrent_search(ps, "keyphrase"));
+	TEST_EQUAL(2, ps->n_concurrent);
+	TEST_ASSERT(ps_add_concurrent_search(ps, PS_DEFAULT_SEARCH) < 0);
+	TEST_ASSERT(ps_add_concurrent_search(ps, "nonexistent") < 0);
+	for (i = 0; i < 2; ++i) {
+		int j;
+
+		decode(ps);
+		TEST_ASSERT(ps->acmod->n_senscr_cache > 0);
+		for (j = 0; j < N_SEARCH; ++j) {
+			TEST_ASSERT(hyp = ps_get_search_hyp(ps, names[j], &score));
+			printf("%s alongside: %s (%d)\n", names[j], hyp, score);
+			TEST_EQUAL(0, strcmp(ref_hyp[j], hyp));
+			TEST_EQUAL(ref_score[j], score);
+		}
+		TEST_EQUAL(0, strcmp(ref_hyp[0], ps_get_hyp(ps, &score)));
+	}
+
+	/* Clones run them too. */
+	TEST_ASSERT(clone = ps_clone(ps));
+	TEST_EQUAL(2, clone->n_concurrent);
+	decode(clone);
+	for (i = 0; i < N_SEARCH; ++i) {
+		TEST_ASSERT(hyp = ps_get_search_hyp(clone, names[i], &score));
+		TEST_EQUAL(0, strcmp(ref_hyp[i], hyp));
+	}
+	ps_free(clone);
+
+	/* A search replaced by another of the same name keeps running. */
+	TEST_EQUAL(0, ps_set_keyphrase(ps, "keyphrase", "meters"));
+	decode(ps);
+	TEST_ASSERT(hyp = ps_get_search_hyp(ps, "keyphrase", &score));
+	TEST_EQUAL(0, strcmp("meters", hyp));
+
+	/* One which is activated no longer runs alongside. */
+	TEST_EQUAL(0, ps_set_search(ps, "grammar"));
+	TEST_EQUAL(1, ps->n_concurrent);
+	TEST_EQUAL(0, ps_unset_search(ps, "keyphrase"));
+	TEST_EQUAL(0, ps->n_concurrent);
+	decode(ps);
+	TEST_ASSERT(ps_get_search_hyp(ps, PS_DEFAULT_SEARCH, &score) == NULL);
+	TEST_ASSERT(hyp = ps_get_search_hyp(ps, "grammar", &score));
+	TEST_EQUAL(0, strcmp(ref_hyp[1], hyp));
+
+	/* Nor after they are cleared. */
+	TEST_EQUAL(0, ps_add_concurrent_search(ps, PS_DEFAULT_SEARCH));
+	TEST_EQUAL(0, ps_clear_concurrent_searches(ps));
+	TEST_EQUAL(0, ps->n_concurrent);
+
+	for (i = 0; i < N_SEARCH; ++i)
+		ckd_free(ref_hyp[i]);
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return 0;
+}
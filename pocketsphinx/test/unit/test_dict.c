@@ -11,7 +11,7 @@ int
 main(int argc, char *argv[])
 {
 	bin_mdef_t *mdef;
-	dict_t *dict;
+	dict_t *dict, *bdict;
 	cmd_ln_t *config;
 
 	int i;
@@ -34,6 +34,57 @@ main(int argc, char *argv[])
 	TEST_EQUAL(0, dict_write(dict, "_cmu07a.dic", NULL));
 	TEST_EQUAL(0, system("diff -uw " MODELDIR "/en-us/cmudict-en-us.dict _cmu07a.dic"));
 
+	/* Binary dictionary has the same words with the same ids. */
+	TEST_EQUAL(0, dict_write(dict, "_cmu07a.bdic", "bin"));
+	cmd_ln_set_str_r(config, "-dict", "_cmu07a.bdic");
+	TEST_ASSERT(bdict = dict_init(config, mdef));
+	TEST_ASSERT(bdict->filemap != NULL);
+	TEST_EQUAL(dict_size(dict), dict_size(bdict));
+	TEST_EQUAL(dict_filler_start(dict), dict_filler_start(bdict));
+	TEST_EQUAL(dict_filler_end(dict), dict_filler_end(bdict));
+	TEST_EQUAL(dict_silwid(dict), dict_silwid(bdict));
+	for (i = 0; i < dict_size(dict); ++i) {
+		int j;
+		TEST_EQUAL(i, dict_wordid(bdict, dict_wordstr(dict, i)));
+		TEST_EQUAL(0, strcmp(dict_wordstr(dict, i), dict_wordstr(bdict, i)));
+		TEST_EQUAL(dict_basewid(dict, i), dict_basewid(bdict, i));
+		TEST_EQUAL(dict_nextalt(dict, i), dict_nextalt(bdict, i));
+		TEST_EQUAL(dict_pronlen(dict, i), dict_pronlen(bdict, i));
+		for (j = 0; j < dict_pronlen(dict, i); ++j)
+			TEST_EQUAL(dict_pron(dict, i, j), dict_pron(bdict, i, j));
+	}
+	TEST_EQUAL(BAD_S3WID, dict_wordid(bdict, "ASDFASFASSD"));
+	TEST_ASSERT(dict_filler_word(bdict, dict_wordid(bdict, "<sil>")));
+	TEST_EQUAL(0, dict_write(bdict, "_cmu07a.dic", NULL));
+	TEST_EQUAL(0, system("diff -uw " MODELDIR "/en-us/cmudict-en-us.dict _cmu07a.dic"));
+
+	/* Words and alternates can still be added to it. */
+	{
+		s3cipid_t p[2] = { 1, 2 };
+		s3wid_t w = dict_wordid(bdict, "carnegie");
+		s3wid_t w2 = dict_add_word(bdict, "carnegie(9)", p, 2);
+		TEST_ASSERT(BAD_S3WID != w2);
+		TEST_EQUAL(w2, dict_wordid(bdict, "carnegie(9)"));
+		TEST_EQUAL(w, dict_basewid(bdict, w2));
+		TEST_EQUAL(w2, dict_nextalt(bdict, w));
+		TEST_EQUAL(BAD_S3WID, dict_add_word(bdict, "carnegie", p, 2));
+		TEST_ASSERT(BAD_S3WID != dict_add_word(bdict, "FOOBIE", p, 1));
+		TEST_ASSERT(dict_real_word(bdict, dict_wordid(bdict, "FOOBIE")));
+	}
+	dict_free(bdict);
+
+	/* And it can be read into memory instead. */
+	cmd_ln_free_r(config);
+	TEST_ASSERT(config = cmd_ln_init(NULL, ps_args(), TRUE,
+					 "-dict", "_cmu07a.bdic",
+					 "-mmap", "no",
+					 NULL));
+	TEST_ASSERT(bdict = dict_init(config, mdef));
+	TEST_ASSERT(bdict->filemap == NULL);
+	TEST_EQUAL(dict_size(dict), dict_size(bdict));
+	TEST_EQUAL(dict_wordid(dict, "carnegie"), dict_wordid(bdict, "carnegie"));
+	dict_free(bdict);
+
 	dict_free(dict);
 	bin_mdef_free(mdef);
 
@@ -8,6 +8,47 @@
 #include "dict2pid.h"
 #include "test_macros.h"
 
+/* Check the cross-word tables for a word against the model definition. */
+static void
+check_word(dict2pid_t *d2p, bin_mdef_t *mdef, dict_t *dict, char const *word)
+{
+	s3wid_t w = dict_wordid(dict, word);
+	xwdssid_t *rssid;
+	int b, c, x;
+
+	TEST_ASSERT(w != BAD_S3WID);
+	if (dict_pronlen(dict, w) == 1) {
+		b = dict_first_phone(dict, w);
+		for (c = 0; c < bin_mdef_n_ciphone(mdef); ++c) {
+			for (x = 0; x < bin_mdef_n_ciphone(mdef); ++x) {
+				TEST_EQUAL(bin_mdef_pid2ssid(mdef,
+					   bin_mdef_phone_id_nearest(mdef, b, c, x,
+								     WORD_POSN_SINGLE)),
+					   dict2pid_lrdiph_rc(d2p, b, c, x));
+			}
+		}
+		return;
+	}
+	b = dict_first_phone(dict, w);
+	x = dict_second_phone(dict, w);
+	for (c = 0; c < bin_mdef_n_ciphone(mdef); ++c) {
+		TEST_EQUAL(bin_mdef_pid2ssid(mdef,
+			   bin_mdef_phone_id_nearest(mdef, b, c, x,
+						     WORD_POSN_BEGIN)),
+			   dict2pid_ldiph_lc(d2p, b, x, c));
+	}
+	b = dict_last_phone(dict, w);
+	x = dict_second_last_phone(dict, w);
+	rssid = dict2pid_rssid(d2p, b, x);
+	TEST_ASSERT(rssid->n_ssid > 0);
+	for (c = 0; c < bin_mdef_n_ciphone(mdef); ++c) {
+		TEST_EQUAL(bin_mdef_pid2ssid(mdef,
+			   bin_mdef_phone_id_nearest(mdef, b, x, c,
+						     WORD_POSN_END)),
+			   rssid->ssid[rssid->cimap[c]]);
+	}
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -15,6 +56,8 @@ main(int argc, char *argv[])
 	dict_t *dict;
 	dict2pid_t *d2p;
 	cmd_ln_t *config;
+	int32 n_rows;
+	s3cipid_t ph[2];
 
 	TEST_ASSERT(config = cmd_ln_init(NULL, NULL, FALSE,
 						   "-dict", MODELDIR "/en-us/cmudict-en-us.dict",
@@ -24,6 +67,34 @@ main(int argc, char *argv[])
 	TEST_ASSERT(dict = dict_init(config, mdef));
 	TEST_ASSERT(d2p = dict2pid_build(mdef, dict));
 
+	check_word(d2p, mdef, dict, "hello");
+	check_word(d2p, mdef, dict, "forward");
+	check_word(d2p, mdef, dict, "a");
+
+	/* Unused combinations all share the empty row. */
+	ph[0] = bin_mdef_ciphone_id(mdef, "ZH");
+	ph[1] = bin_mdef_ciphone_id(mdef, "NG");
+	TEST_EQUAL(BAD_S3SSID, dict2pid_ldiph_lc(d2p, ph[0], ph[1], 0));
+	TEST_EQUAL(0, dict2pid_rssid(d2p, ph[1], ph[0])->n_ssid);
+	TEST_ASSERT(d2p->n_rows < 3 * bin_mdef_n_ciphone(mdef)
+		    * bin_mdef_n_ciphone(mdef));
+
+	/* Adding a word fills in only what it needs. */
+	n_rows = d2p->n_rows;
+	TEST_ASSERT(dict_add_word(dict, "zhng", ph, 2) != BAD_S3WID);
+	TEST_EQUAL(0, dict2pid_add_word(d2p, dict_wordid(dict, "zhng")));
+	check_word(d2p, mdef, dict, "zhng");
+	TEST_ASSERT(d2p->n_rows <= n_rows + 2);
+	/* And nothing new for a word whose contexts are known. */
+	n_rows = d2p->n_rows;
+	ph[0] = bin_mdef_ciphone_id(mdef, "HH");
+	ph[1] = bin_mdef_ciphone_id(mdef, "OW");
+	TEST_ASSERT(dict_add_word(dict, "hhow", ph, 2) != BAD_S3WID);
+	TEST_EQUAL(0, dict2pid_add_word(d2p, dict_wordid(dict, "hhow")));
+	TEST_EQUAL(n_rows, d2p->n_rows);
+	check_word(d2p, mdef, dict, "hhow");
+	check_word(d2p, mdef, dict, "hello");
+
 	dict_free(dict);
 	dict2pid_free(d2p);
 	bin_mdef_free(mdef);
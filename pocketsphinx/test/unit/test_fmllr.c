@@ -0,0 +1,120 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+static int32
+decode(ps_decoder_t *ps)
+{
+	FILE *rawfh;
+	char const *hyp;
+	int32 score;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	hyp = ps_get_hyp(ps, &score);
+	printf("%s (%d)\n", hyp, score);
+	TEST_ASSERT(hyp);
+	TEST_EQUAL(0, strcmp(hyp, "go forward ten meters"));
+	return score;
+}
+
+static void
+test_model(cmd_ln_t *config)
+{
+	ps_decoder_t *ps, *clone;
+	ps_fmllr_t *fmllr, *fmllr2;
+	int32 score, n_frames;
+	double dist, dist2;
+	int i, j;
+
+	TEST_ASSERT(ps = ps_init(config));
+	score = decode(ps);
+
+	/* Statistics come from the words of the hypothesis. */
+	TEST_ASSERT(fmllr = ps_fmllr_init(ps));
+	TEST_EQUAL(-1, ps_fmllr_update(fmllr, 0));
+	n_frames = ps_accum_fmllr(ps, fmllr);
+	printf("Accumulated %d of %d frames\n", n_frames, ps_get_n_frames(ps));
+	TEST_ASSERT(n_frames > 0);
+	TEST_ASSERT(n_frames < ps_get_n_frames(ps));
+	TEST_EQUAL(0, ps_fmllr_update(fmllr, 100));
+	for (i = 0; i < fmllr->n_feat; ++i) {
+		for (j = 0; j < fmllr->veclen[i]; ++j) {
+			printf("%.3f %.3f\n", fmllr->a[i][j], fmllr->b[i][j]);
+			TEST_ASSERT(fmllr->a[i][j] > 0.5 && fmllr->a[i][j] < 2);
+			TEST_ASSERT(fabs(fmllr->b[i][j]) < 10);
+		}
+	}
+
+	/* A clone adapted to the speaker still decodes correctly, while
+	 * the decoder it shares the model with is unchanged. */
+	TEST_ASSERT(clone = ps_clone(ps));
+	TEST_EQUAL(fmllr, ps_set_fmllr(clone, fmllr));
+	decode(clone);
+	TEST_EQUAL(score, decode(ps));
+
+	/* Statistics do not depend on the transform already applied, so
+	 * estimating it again from the adapted features (with a slightly
+	 * different alignment) gives much the same thing. */
+	TEST_ASSERT(fmllr2 = ps_fmllr_init(clone));
+	TEST_ASSERT(ps_accum_fmllr(clone, fmllr2) > 0);
+	TEST_EQUAL(0, ps_fmllr_update(fmllr2, 100));
+	dist = dist2 = 0;
+	for (i = 0; i < fmllr->n_feat; ++i) {
+		for (j = 0; j < fmllr->veclen[i]; ++j) {
+			dist += fabs(fmllr->a[i][j] - 1) + fabs(fmllr->b[i][j]);
+			dist2 += fabs(fmllr->a[i][j] - fmllr2->a[i][j])
+				+ fabs(fmllr->b[i][j] - fmllr2->b[i][j]);
+		}
+	}
+	printf("Distance from identity %f, from re-estimate %f\n", dist, dist2);
+	TEST_ASSERT(dist2 < dist / 2);
+
+	/* Transforms can be dropped and reset. */
+	TEST_ASSERT(ps_set_fmllr(clone, NULL) == NULL);
+	ps_fmllr_reset(fmllr2);
+	TEST_EQUAL(-1, ps_fmllr_update(fmllr2, 100));
+	TEST_EQUAL(1.0, fmllr2->a[0][0]);
+	TEST_EQUAL(0, ps_fmllr_free(fmllr2));
+
+	/* The decoder keeps its own reference. */
+	TEST_EQUAL(fmllr, ps_set_fmllr(ps, fmllr));
+	TEST_EQUAL(1, ps_fmllr_free(fmllr));
+	decode(ps);
+
+	ps_free(clone);
+	ps_free(ps);
+}
+
+int
+main(int argc, char *argv[])
+{
+	cmd_ln_t *config;
+
+	/* Phonetically-tied model. */
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	test_model(config);
+	cmd_ln_free_r(config);
+
+	/* Continuous model. */
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", DATADIR "/an4_ci_cont",
+				"-lm", DATADIR "/turtle.lm.bin",
+				"-dict", DATADIR "/turtle.dic",
+				"-samprate", "16000", NULL));
+	test_model(config);
+	cmd_ln_free_r(config);
+
+	return 0;
+}
@@ -16,7 +16,7 @@ main(int argc, char *argv[])
     ps_lattice_t *dag;
     const char *hyp;
     ps_seg_t *seg;
-    int32 score, prob;
+    int32 score, score2, prob, n_hist;
     FILE *rawfh;
 
     TEST_ASSERT(config =
@@ -57,6 +57,16 @@ main(int argc, char *argv[])
     printf("BESTPATH: %s\n",
            ps_lattice_hyp(dag, ps_lattice_bestpath(dag, NULL, 1.0, 15.0)));
     ps_lattice_posterior(dag, NULL, 15.0);
+
+    /* The history table is reused by the next utterance. */
+    TEST_ASSERT(n_hist = fsg_history_n_entries(((fsg_search_t *)ps->search)->history));
+    rewind(rawfh);
+    ps_decode_raw(ps, rawfh, -1);
+    fclose(rawfh);
+    hyp = ps_get_hyp(ps, &score2);
+    TEST_EQUAL(0, strcmp("go forward ten meters", hyp));
+    TEST_EQUAL(score, score2);
+    TEST_EQUAL(n_hist, fsg_history_n_entries(((fsg_search_t *)ps->search)->history));
     ps_free(ps);
     cmd_ln_free_r(config);
 
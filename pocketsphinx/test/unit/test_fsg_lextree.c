@@ -0,0 +1,102 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "fsg_search_internal.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+/* Where the lextree for the "turtle" grammar goes with -fsgcache . */
+#define TREEFILE "./turtle.fsgtree"
+
+static void
+truncate_file(char const *file, size_t size)
+{
+	FILE *fh;
+	char *buf;
+
+	buf = ckd_calloc(size, 1);
+	TEST_ASSERT(fh = fopen(file, "rb"));
+	TEST_EQUAL(size, fread(buf, 1, size, fh));
+	fclose(fh);
+	TEST_ASSERT(fh = fopen(file, "wb"));
+	TEST_EQUAL(size, fwrite(buf, 1, size, fh));
+	fclose(fh);
+	ckd_free(buf);
+}
+
+/* Decode with or without the tree cache, checking whether it was read. */
+static char *
+decode(char const *cache, char const *mmap, char const *wip,
+       int tree_read, int32 *out_score)
+{
+	ps_decoder_t *ps;
+	fsg_search_t *fsgs;
+	char *hyp;
+
+	ps = ps_test_init(MODELDIR "/en-us/en-us", DATADIR "/turtle.dic",
+			  "-fsg", DATADIR "/goforward.fsg",
+			  "-fsgcache", cache,
+			  "-bestpath", "no",
+			  "-mmap", mmap,
+			  "-wip", wip,
+			  "-samprate", "16000", NULL);
+	fsgs = (fsg_search_t *)ps->search;
+	TEST_EQUAL(tree_read, fsgs->lextree->pnodes != NULL);
+	printf("cache %s, mmap %s, wip %s\n", cache ? cache : "none", mmap, wip);
+	hyp = ps_test_decode(ps, DATADIR "/goforward.raw", out_score);
+	ps_free(ps);
+	return hyp;
+}
+
+int
+main(int argc, char *argv[])
+{
+	char *hyp, *hyp2;
+	int32 score, score2;
+	FILE *fh;
+
+	remove(TREEFILE);
+	hyp = decode(NULL, "yes", "0.65", FALSE, &score);
+	TEST_ASSERT(fopen(TREEFILE, "rb") == NULL);
+
+	/* The first decoder builds and writes the lextree, the next
+	 * ones read it and decode exactly the same way. */
+	hyp2 = decode(".", "yes", "0.65", FALSE, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	TEST_ASSERT(fh = fopen(TREEFILE, "rb"));
+	fclose(fh);
+	hyp2 = decode(".", "yes", "0.65", TRUE, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	hyp2 = decode(".", "no", "0.65", TRUE, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	ckd_free(hyp);
+
+	/* A lextree built with other penalties is rebuilt, and replaced. */
+	hyp = decode(NULL, "yes", "0.5", FALSE, &score);
+	hyp2 = decode(".", "yes", "0.5", FALSE, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	hyp2 = decode(".", "yes", "0.5", TRUE, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	ckd_free(hyp);
+
+	/* So is a truncated one. */
+	truncate_file(TREEFILE, 256);
+	hyp2 = decode(".", "no", "0.5", FALSE, &score2);
+	TEST_ASSERT(hyp2 != NULL);
+	ckd_free(hyp2);
+	remove(TREEFILE);
+
+	return 0;
+}
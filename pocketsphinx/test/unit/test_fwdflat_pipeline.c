@@ -0,0 +1,66 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ngram_search.h"
+#include "test_macros.h"
+
+/* Decode an utterance with fwdtree and fwdflat, returning the hypothesis. */
+static char *
+decode(char const *lag)
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps;
+	ngram_search_t *ngs;
+	FILE *rawfh;
+	int16 buf[2048];
+	size_t nread;
+	char *hyp;
+	int32 score;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", DATADIR "/turtle.lm.bin",
+				"-dict", DATADIR "/turtle.dic",
+				"-fwdflat", "yes",
+				"-bestpath", "no",
+				"-fwdflatlag", lag,
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	ngs = (ngram_search_t *)ps->search;
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	TEST_EQUAL(0, ps_start_utt(ps));
+	while (!feof(rawfh)) {
+		nread = fread(buf, sizeof(*buf), 2048, rawfh);
+		ps_process_raw(ps, buf, nread, FALSE, FALSE);
+	}
+	fclose(rawfh);
+	/* The pipelined search is running, but behind fwdtree. */
+	if (ngs->flat) {
+		printf("fwdtree %d frames, fwdflat %d frames\n",
+		       ngs->n_frame, ngs->flat->n_frame);
+		TEST_ASSERT(ngs->flat->n_frame > 0);
+		TEST_ASSERT(ngs->flat->n_frame <= ngs->n_frame - ngs->fwdflat_lag);
+	}
+	TEST_EQUAL(0, ps_end_utt(ps));
+	hyp = ckd_salloc(ps_get_hyp(ps, &score));
+	printf("fwdflatlag %s: %s (%d)\n", lag, hyp, score);
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return hyp;
+}
+
+int
+main(int argc, char *argv[])
+{
+	char *hyp, *hyp2;
+
+	hyp = decode("0");
+	hyp2 = decode("50");
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	ckd_free(hyp2);
+	ckd_free(hyp);
+	return 0;
+}
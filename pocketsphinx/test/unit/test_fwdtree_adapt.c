@@ -0,0 +1,47 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ngram_search.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+int
+main(int argc, char *argv[])
+{
+    cmd_ln_t *config;
+    ps_decoder_t *ps;
+    ngram_search_t *ngs;
+    FILE *rawfh;
+
+    TEST_ASSERT(config =
+            cmd_ln_init(NULL, ps_args(), TRUE,
+                "-hmm", MODELDIR "/en-us/en-us",
+                "-lm", MODELDIR "/en-us/en-us.lm.bin",
+                "-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+                "-fwdtree", "yes",
+                "-fwdflat", "no",
+                "-bestpath", "no",
+                "-targethmmpf", "10000",
+                "-samprate", "16000", NULL));
+
+    /* An unreachable real-time factor drives the HMM target, and
+     * with it the beam, down. */
+    cmd_ln_set_float32_r(config, "-targetrtf", 1e-6);
+    TEST_ASSERT(ps = ps_init(config));
+    ngs = (ngram_search_t *)ps->search;
+    TEST_EQUAL(10000, ngs->adapt_hmmpf);
+    TEST_ASSERT(ngs->hist_shift >= 0);
+    TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+    ps_decode_raw(ps, rawfh, -1);
+    fclose(rawfh);
+    TEST_ASSERT(ngs->adapt_hmmpf < 10000);
+    TEST_ASSERT(ngs->st.n_beam_narrowed > 0);
+    ps_free(ps);
+
+    /* A target on the number of HMMs alone does not change the
+     * result. */
+    cmd_ln_set_float32_r(config, "-targetrtf", 0);
+    return ps_decoder_test(config, "FWDTREE", "go forward ten meters");
+}
@@ -0,0 +1,113 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+/* Check buffered results against the iterator and ps_get_hyp(). */
+static int
+check_segs(ps_decoder_t *ps)
+{
+	ps_seg_info_t segs[64];
+	char hyp[256], shorthyp[4];
+	char const *ref;
+	int32 score, ref_score;
+	ps_seg_t *itor;
+	int n, i;
+
+	n = ps_get_segs(ps, segs, 64, hyp, sizeof(hyp), &score);
+	ref = ps_get_hyp(ps, &ref_score);
+	if (ref == NULL) {
+		TEST_EQUAL(0, strcmp(hyp, ""));
+	}
+	else {
+		TEST_EQUAL(0, strcmp(hyp, ref));
+		TEST_EQUAL(score, ref_score);
+	}
+	TEST_ASSERT(n < 64);
+	for (i = 0, itor = ps_seg_iter(ps); itor;
+	     itor = ps_seg_next(itor), ++i) {
+		int sf, ef;
+		int32 ascr, lscr;
+
+		TEST_ASSERT(i < n);
+		ps_seg_frames(itor, &sf, &ef);
+		ps_seg_prob(itor, &ascr, &lscr, NULL);
+		TEST_EQUAL(0, strcmp(ps_seg_word(itor),
+				     ps_word_str(ps, segs[i].wid)));
+		TEST_EQUAL(sf, segs[i].sf);
+		TEST_EQUAL(ef, segs[i].ef);
+		TEST_EQUAL(ascr, segs[i].ascr);
+		TEST_EQUAL(lscr, segs[i].lscr);
+	}
+	TEST_EQUAL(i, n);
+
+	/* Small buffers get as much as fits. */
+	if (n > 1) {
+		TEST_EQUAL(n, ps_get_segs(ps, segs, 1, shorthyp,
+					  sizeof(shorthyp), NULL));
+		TEST_EQUAL(strlen(shorthyp), strlen(hyp) < 3 ? strlen(hyp) : 3);
+		TEST_EQUAL(0, strncmp(shorthyp, hyp, strlen(shorthyp)));
+		TEST_EQUAL(n, ps_get_segs(ps, NULL, 0, NULL, 0, NULL));
+	}
+	return n;
+}
+
+static void
+decode(ps_decoder_t *ps)
+{
+	FILE *rawfh;
+	int16 buf[1024];
+	size_t nread;
+	int n_partial;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	TEST_EQUAL(0, ps_start_utt(ps));
+	TEST_EQUAL(0, check_segs(ps));
+	n_partial = 0;
+	while ((nread = fread(buf, sizeof(*buf), 1024, rawfh)) > 0) {
+		TEST_ASSERT(ps_process_raw(ps, buf, nread, FALSE, FALSE) >= 0);
+		/* Twice, to go through the cached backtrace. */
+		if (check_segs(ps) > 0)
+			++n_partial;
+		check_segs(ps);
+	}
+	TEST_ASSERT(n_partial > 0);
+	TEST_EQUAL(0, ps_end_utt(ps));
+	fclose(rawfh);
+	TEST_ASSERT(check_segs(ps) > 0);
+	TEST_EQUAL(0, strcmp(ps_get_hyp(ps, NULL), "go forward ten meters"));
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	cmd_ln_t *config;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(ps_word_str(ps, -1) == NULL);
+	TEST_EQUAL(0, strcmp("<s>", ps_word_str(ps, ps->search->start_wid)));
+
+	/* The final result comes from the lattice. */
+	decode(ps);
+	/* Times are stream-wide in the next utterance as well. */
+	decode(ps);
+	ps_free(ps);
+
+	/* And from the backpointer table without -bestpath. */
+	cmd_ln_set_boolean_r(config, "-bestpath", FALSE);
+	TEST_ASSERT(ps = ps_init(config));
+	decode(ps);
+	ps_free(ps);
+
+	cmd_ln_free_r(config);
+	return 0;
+}
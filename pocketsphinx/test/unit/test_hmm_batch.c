@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <sphinxbase/ckd_alloc.h>
+
+#include "hmm.h"
+#include "test_macros.h"
+
+#define N_TMAT 5
+#define N_SEN 100
+#define N_SSEQ 20
+#define N_HMM 37
+
+static uint32 rnd = 42;
+
+static int
+randi(int n)
+{
+	rnd = rnd * 1103515245 + 12345;
+	return (rnd >> 16) % n;
+}
+
+/* Run HMMs through some frames, evaluating one copy of them one at a
+ * time and the other in batches, which must give the same result. */
+static void
+test_batch(int n_state, int mpx)
+{
+	uint8 ***tp;
+	uint16 **sseq;
+	int16 *senscr;
+	hmm_context_t *ctx;
+	hmm_t *hmm, *ref, **batch;
+	int32 i, j, t, best, best_ref;
+
+	tp = (uint8 ***)ckd_calloc_3d(N_TMAT, n_state, n_state + 1, 1);
+	for (i = 0; i < N_TMAT; ++i)
+		for (j = 0; j < n_state; ++j) {
+			tp[i][j][j] = randi(100);
+			tp[i][j][j + 1] = randi(100);
+			/* Some skips are not allowed. */
+			if (j + 2 <= n_state)
+				tp[i][j][j + 2] = randi(3) ? randi(255) : 255;
+		}
+	sseq = (uint16 **)ckd_calloc_2d(N_SSEQ, n_state, sizeof(**sseq));
+	for (i = 0; i < N_SSEQ; ++i)
+		for (j = 0; j < n_state; ++j)
+			sseq[i][j] = randi(N_SEN);
+	senscr = ckd_calloc(N_SEN, sizeof(*senscr));
+	TEST_ASSERT(ctx = hmm_context_init(n_state, (uint8 ** const *)tp,
+					   senscr, sseq));
+
+	hmm = ckd_calloc(N_HMM, sizeof(*hmm));
+	ref = ckd_calloc(N_HMM, sizeof(*ref));
+	batch = ckd_calloc(N_HMM, sizeof(*batch));
+	for (i = 0; i < N_HMM; ++i) {
+		hmm_init(ctx, &ref[i], mpx, randi(N_SSEQ), randi(N_TMAT));
+		batch[i] = &hmm[i];
+	}
+	for (t = 0; t < 200; ++t) {
+		for (i = 0; i < N_SEN; ++i)
+			senscr[i] = randi(2000);
+		for (i = 0; i < N_HMM; ++i) {
+			if (randi(4) == 0) {
+				hmm_enter(&ref[i], -randi(20000), t * 100 + i, t);
+				if (mpx)
+					hmm_mpx_ssid(&ref[i], 0) = randi(N_SSEQ);
+			}
+			else if (randi(50) == 0)
+				hmm_clear(&ref[i]);
+			hmm[i] = ref[i];
+		}
+		best_ref = WORST_SCORE;
+		for (i = 0; i < N_HMM; ++i) {
+			int32 score = hmm_vit_eval(&ref[i]);
+			if (score BETTER_THAN best_ref)
+				best_ref = score;
+		}
+		/* Odd-sized runs, so some are done one at a time. */
+		best = hmm_vit_eval_batch(batch, 20);
+		i = hmm_vit_eval_batch(batch + 20, N_HMM - 20);
+		if (i BETTER_THAN best)
+			best = i;
+		TEST_EQUAL(best_ref, best);
+		for (i = 0; i < N_HMM; ++i) {
+			TEST_EQUAL(hmm_out_score(&ref[i]), hmm_out_score(&hmm[i]));
+			TEST_EQUAL(hmm_out_history(&ref[i]), hmm_out_history(&hmm[i]));
+			TEST_EQUAL(hmm_bestscore(&ref[i]), hmm_bestscore(&hmm[i]));
+			for (j = 0; j < n_state; ++j) {
+				TEST_EQUAL(hmm_score(&ref[i], j), hmm_score(&hmm[i], j));
+				TEST_EQUAL(hmm_history(&ref[i], j), hmm_history(&hmm[i], j));
+				TEST_EQUAL(ref[i].senid[j], hmm[i].senid[j]);
+			}
+		}
+	}
+	printf("%d states, %s: best %d\n", n_state, mpx ? "mpx" : "non-mpx", best);
+
+	ckd_free(batch);
+	ckd_free(ref);
+	ckd_free(hmm);
+	hmm_context_free(ctx);
+	ckd_free(senscr);
+	ckd_free_2d(sseq);
+	ckd_free_3d(tp);
+}
+
+int
+main(int argc, char *argv[])
+{
+	test_batch(3, FALSE);
+	test_batch(3, TRUE);
+	test_batch(5, FALSE);
+	test_batch(5, TRUE);
+	return 0;
+}
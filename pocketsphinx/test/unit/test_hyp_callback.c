@@ -0,0 +1,96 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+typedef struct report_s {
+	ps_decoder_t *ps;
+	int n_reports;
+	uint32 last_frame;
+	char hyps[64][256];
+} report_t;
+
+static void
+hyp_cb(void *user_data, char const *hyp, int32 score)
+{
+	report_t *r = user_data;
+	char const *polled;
+	int32 polled_score;
+
+	printf("%d: %s (%d)\n", r->ps->n_frame, hyp, score);
+	/* Reports are what polling would have found, but spaced out
+	 * and only when something changed. */
+	polled = ps_get_hyp(r->ps, &polled_score);
+	TEST_EQUAL(0, strcmp(hyp, polled));
+	TEST_EQUAL(score, polled_score);
+	TEST_ASSERT(r->n_reports == 0
+		    || r->ps->n_frame >= r->last_frame + 10);
+	TEST_ASSERT(r->n_reports == 0
+		    || strcmp(hyp, r->hyps[r->n_reports - 1]) != 0);
+	TEST_ASSERT(r->n_reports < 64);
+	strncpy(r->hyps[r->n_reports++], hyp, 255);
+	r->last_frame = r->ps->n_frame;
+}
+
+static void
+decode(ps_decoder_t *ps, size_t chunk)
+{
+	FILE *rawfh;
+	int16 buf[4096];
+	size_t nread;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	TEST_EQUAL(0, ps_start_utt(ps));
+	while ((nread = fread(buf, sizeof(*buf), chunk, rawfh)) > 0)
+		TEST_ASSERT(ps_process_raw(ps, buf, nread, FALSE, FALSE) >= 0);
+	TEST_EQUAL(0, ps_end_utt(ps));
+	fclose(rawfh);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	cmd_ln_t *config;
+	report_t r1, r2;
+	int i;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(ps_set_hyp_callback(ps, hyp_cb, &r1, 0) < 0);
+
+	/* Reports do not depend on how audio is pushed (start each
+	 * decoder afresh since CMN adapts between utterances). */
+	memset(&r1, 0, sizeof(r1));
+	r1.ps = ps;
+	TEST_EQUAL(0, ps_set_hyp_callback(ps, hyp_cb, &r1, 10));
+	decode(ps, 256);
+	TEST_ASSERT(r1.n_reports > 1);
+	TEST_EQUAL(0, strcmp(ps_get_hyp(ps, NULL), "go forward ten meters"));
+
+	ps_free(ps);
+	TEST_ASSERT(ps = ps_init(config));
+	memset(&r2, 0, sizeof(r2));
+	r2.ps = ps;
+	TEST_EQUAL(0, ps_set_hyp_callback(ps, hyp_cb, &r2, 10));
+	decode(ps, 4096);
+	TEST_EQUAL(r1.n_reports, r2.n_reports);
+	for (i = 0; i < r1.n_reports; ++i)
+		TEST_EQUAL(0, strcmp(r1.hyps[i], r2.hyps[i]));
+
+	/* And stop when asked. */
+	TEST_EQUAL(0, ps_set_hyp_callback(ps, NULL, NULL, 1));
+	decode(ps, 256);
+	TEST_EQUAL(r1.n_reports, r2.n_reports);
+
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return 0;
+}
@@ -84,6 +84,32 @@ main(int argc, char *argv[])
     cmd_ln_free_r(config);
     fclose(rawfh);
 
+    /* Grammars given as strings are compiled once and reused. */
+    TEST_ASSERT(config =
+            cmd_ln_init(NULL, ps_args(), TRUE,
+                "-hmm", MODELDIR "/en-us/en-us",
+                "-dict", DATADIR "/turtle.dic",
+                "-samprate", "16000", NULL));
+    TEST_ASSERT(ps = ps_init(config));
+    TEST_EQUAL(0, ps_set_jsgf_string(ps, "move",
+                                     "#JSGF V1.0; grammar goforward; "
+                                     "public <move> = go <direction> ten meters; "
+                                     "<direction> = forward | backward;"));
+    TEST_EQUAL(0, ps_set_jsgf_string(ps, "move.again",
+                                     "#JSGF V1.0; grammar goforward; "
+                                     "public <move> = go <direction> ten meters; "
+                                     "<direction> = forward | backward;"));
+    TEST_ASSERT(ps_get_fsg(ps, "move") == ps_get_fsg(ps, "move.again"));
+    ps_set_search(ps, "move.again");
+    TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+    ps_decode_raw(ps, rawfh, -1);
+    hyp = ps_get_hyp(ps, &score);
+    printf("%s (%d)\n", hyp, score);
+    TEST_EQUAL(0, strcmp("go forward ten meters", hyp));
+    ps_free(ps);
+    cmd_ln_free_r(config);
+    fclose(rawfh);
+
     TEST_ASSERT(config =
             cmd_ln_init(NULL, ps_args(), TRUE,
                 "-hmm", MODELDIR "/en-us/en-us",
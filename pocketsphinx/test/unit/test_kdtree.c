@@ -0,0 +1,160 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sphinxbase/strfuncs.h>
+
+#include "pocketsphinx_internal.h"
+#include "kdtree.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+/* Write the nodes of a tree depth-first, as SphinxTrain does.  Node
+ * p of the L nodes at a level lists the codewords equal to p modulo
+ * L, or all of them if full is set. */
+static void
+write_nodes(FILE *fh, int level, int n_level, int p,
+	    int n_comp, int n_density, int full)
+{
+	int L = 1 << (n_level - level);
+	int cw;
+
+	fprintf(fh, "NODE %d\nsplit_comp %d\nsplit_plane %f\nbbi",
+		level, (n_level - level) % n_comp, 0.0);
+	for (cw = 0; cw < n_density; ++cw)
+		if (full || cw % L == p)
+			fprintf(fh, " %d", cw);
+	fprintf(fh, "\n\n");
+	if (level > 1) {
+		write_nodes(fh, level - 1, n_level, 2 * p, n_comp, n_density, full);
+		write_nodes(fh, level - 1, n_level, 2 * p + 1, n_comp, n_density, full);
+	}
+}
+
+static gauden_t *
+write_trees(char const *file, char const *hmmdir, int n_level, int full)
+{
+	logmath_t *lmath;
+	gauden_t *g;
+	char *mean, *var;
+	FILE *fh;
+	int i;
+
+	lmath = logmath_init(1.0001, 0, 0);
+	mean = string_join(hmmdir, "/means", NULL);
+	var = string_join(hmmdir, "/variances", NULL);
+	TEST_ASSERT(g = gauden_init(mean, var, 0.0001, lmath));
+	ckd_free(mean);
+	ckd_free(var);
+	logmath_free(lmath);
+
+	TEST_ASSERT(fh = fopen(file, "w"));
+	fprintf(fh, "KD-TREES\nversion 1\nn_trees %d\n", g->n_mgau * g->n_feat);
+	for (i = 0; i < g->n_mgau * g->n_feat; ++i) {
+		int n_comp = g->featlen[i % g->n_feat];
+		fprintf(fh, "TREE %d\nn_density %d\nn_comp %d\nn_level %d\n"
+			"threshold 0.6\n", i, g->n_density, n_comp, n_level);
+		write_nodes(fh, n_level, n_level, 0, n_comp, g->n_density, full);
+		fprintf(fh, "\n");
+	}
+	fclose(fh);
+	return g;
+}
+
+/* Check the leaf found for all-negative and all-positive features. */
+static void
+test_eval(gauden_t *g, int32 maxdepth, int32 maxbbi, int n_leaf, int n_bbi)
+{
+	kd_tree_t **trees;
+	mfcc_t *feat;
+	uint16 const *bbi;
+	int32 n, i;
+
+	TEST_ASSERT(trees = kd_trees_read("test_kdtree.kdtree", g,
+					  maxdepth, maxbbi));
+	feat = ckd_calloc(g->featlen[0], sizeof(*feat));
+	for (i = 0; i < g->featlen[0]; ++i)
+		feat[i] = FLOAT2MFCC(-1.0);
+	bbi = kd_tree_eval(trees[0], feat, &n);
+	TEST_EQUAL(n_bbi, n);
+	TEST_EQUAL(0, bbi[0]);
+	for (i = 0; i < g->featlen[0]; ++i)
+		feat[i] = FLOAT2MFCC(1.0);
+	bbi = kd_tree_eval(trees[0], feat, &n);
+	TEST_EQUAL(n_bbi, n);
+	TEST_EQUAL(n_leaf - 1, bbi[0]);
+	TEST_EQUAL(2 * n_leaf - 1, bbi[1]);
+	ckd_free(feat);
+	kd_trees_free(trees, g->n_mgau * g->n_feat);
+}
+
+/* Decode with or without kd-trees, checking which model was loaded. */
+static char *
+decode(char const *hmmdir, char const *lm, char const *dict,
+       char const *raw, char const *samprate, char const *kdtree,
+       char const *mgau, int32 *out_score)
+{
+	ps_decoder_t *ps;
+	char *hyp;
+
+	ps = ps_test_init(hmmdir, dict,
+			  "-lm", lm,
+			  "-kdtree", kdtree,
+			  "-samprate", samprate, NULL);
+	TEST_EQUAL(0, strcmp(ps->acmod->mgau->vt->name, mgau));
+	printf("kd-tree %s\n", kdtree ? kdtree : "none");
+	hyp = ps_test_decode(ps, raw, out_score);
+	ps_free(ps);
+	return hyp;
+}
+
+/* Trees that list every codeword in every leaf must not change the
+ * result, and partial ones should still give one. */
+static void
+test_decode(char const *hmmdir, char const *lm, char const *dict,
+	    char const *raw, char const *samprate, char const *mgau)
+{
+	char *hyp, *hyp2;
+	int32 score, score2;
+
+	hyp = decode(hmmdir, lm, dict, raw, samprate, NULL, mgau, &score);
+	gauden_free(write_trees("test_kdtree.kdtree", hmmdir, 4, TRUE));
+	hyp2 = decode(hmmdir, lm, dict, raw, samprate,
+		      "test_kdtree.kdtree", mgau, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+
+	gauden_free(write_trees("test_kdtree.kdtree", hmmdir, 3, FALSE));
+	hyp2 = decode(hmmdir, lm, dict, raw, samprate,
+		      "test_kdtree.kdtree", mgau, &score2);
+	TEST_ASSERT(hyp2 != NULL);
+	ckd_free(hyp);
+	ckd_free(hyp2);
+}
+
+int
+main(int argc, char *argv[])
+{
+	gauden_t *g;
+
+	/* 256 codewords, so 64 in each of 4 leaves. */
+	g = write_trees("test_kdtree.kdtree", DATADIR "/tidigits/hmm", 3, FALSE);
+	test_eval(g, 0, -1, 4, 64);
+	test_eval(g, 2, -1, 2, 128);
+	test_eval(g, 1, -1, 1, 256);
+	test_eval(g, 0, 5, 4, 5);
+	gauden_free(g);
+
+	test_decode(DATADIR "/tidigits/hmm",
+		    DATADIR "/tidigits/lm/tidigits.lm.bin",
+		    DATADIR "/tidigits/lm/tidigits.dic",
+		    DATADIR "/tidigits/dhd.2934z.raw", "8000", "s2_semi");
+	test_decode(MODELDIR "/en-us/en-us",
+		    DATADIR "/turtle.lm.bin",
+		    DATADIR "/turtle.dic",
+		    DATADIR "/goforward.raw", "16000", "ptm");
+
+	return 0;
+}
@@ -0,0 +1,95 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "kws_search.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+#define KWSFILE "test_kws_trie.kws"
+
+/* Decode with one keyword argument, returning the segment for "forward". */
+static void
+decode(char const *arg, char const *val, int *sf, int *ef, int32 *prob)
+{
+	ps_decoder_t *ps;
+	ps_seg_t *seg;
+	int32 ascr, lscr, lback, score;
+
+	ps = ps_test_init(MODELDIR "/en-us/en-us",
+			  MODELDIR "/en-us/cmudict-en-us.dict",
+			  arg, val, NULL);
+	ckd_free(ps_test_decode(ps, DATADIR "/goforward.raw", &score));
+	*sf = *ef = -1;
+	for (seg = ps_seg_iter(ps); seg; seg = ps_seg_next(seg)) {
+		printf("%s %d %d\n", ps_seg_word(seg), seg->sf, seg->ef);
+		if (0 == strcmp(ps_seg_word(seg), "forward")) {
+			ps_seg_frames(seg, sf, ef);
+			*prob = ps_seg_prob(seg, &ascr, &lscr, &lback);
+		}
+	}
+	ps_free(ps);
+}
+
+int
+main(int argc, char *argv[])
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps;
+	kws_search_t *kwss;
+	kws_keyphrase_t *kp[4];
+	gnode_t *gn;
+	FILE *fh;
+	int32 node, n_hmms, prob, prob2;
+	int sf, ef, sf2, ef2, i;
+
+	TEST_ASSERT(fh = fopen(KWSFILE, "w"));
+	fprintf(fh, "forward\nforward ten\nforward ten meters /1e-40/\n"
+		"go forward\n");
+	fclose(fh);
+
+	/* Phrases with common prefixes share trie nodes. */
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-kws", KWSFILE, NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	kwss = (kws_search_t *)ps->search;
+	/* The list is built backwards. */
+	for (i = 3, gn = kwss->keyphrases; gn; gn = gnode_next(gn), --i)
+		kp[i] = gnode_ptr(gn);
+	TEST_EQUAL(-1, i);
+	TEST_EQUAL(0, strcmp(kp[0]->word, "forward"));
+	for (n_hmms = i = 0; i < 4; ++i) {
+		TEST_ASSERT(kp[i]->last_node >= 0);
+		n_hmms += kp[i]->n_hmms;
+	}
+	/* "forward" is a prefix of the next two, "go forward" has no
+	 * prefix in common with them. */
+	TEST_EQUAL(kp[2]->n_hmms + kp[3]->n_hmms, kwss->n_nodes);
+	TEST_ASSERT(kwss->n_nodes < n_hmms);
+	for (node = kp[2]->last_node, i = 0; node >= 0;
+	     node = kwss->nodes[node].parent, ++i) {
+		if (node == kp[1]->last_node)
+			TEST_EQUAL(kp[2]->n_hmms - kp[1]->n_hmms, i);
+		if (node == kp[0]->last_node)
+			TEST_EQUAL(kp[2]->n_hmms - kp[0]->n_hmms, i);
+	}
+	TEST_EQUAL(kp[2]->n_hmms, i);
+	ps_free(ps);
+	cmd_ln_free_r(config);
+
+	/* A phrase is still detected when it ends inside the trie. */
+	decode("-keyphrase", "forward", &sf, &ef, &prob);
+	decode("-kws", KWSFILE, &sf2, &ef2, &prob2);
+	TEST_ASSERT(sf >= 0);
+	TEST_ASSERT(sf2 >= 0);
+	TEST_ASSERT(prob2 <= 0);
+	printf("forward alone: %d:%d %d, in trie: %d:%d %d\n",
+	       sf, ef, prob, sf2, ef2, prob2);
+	remove(KWSFILE);
+
+	return 0;
+}
@@ -0,0 +1,185 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ps_lattice_internal.h"
+#include "test_macros.h"
+
+/* Reading a lattice may reorder the exits of a node. */
+static ps_latlink_t *
+find_exit(ps_latnode_t *d, int32 to)
+{
+	latlink_list_t *l;
+
+	for (l = d->exits; l; l = l->next)
+		if (l->link->to->id == to)
+			return l->link;
+	return NULL;
+}
+
+/* The streaming reader sees exactly what was written. */
+static void
+test_stream(ps_lattice_t *dag, char const *file)
+{
+	ps_latbin_t *lb;
+	ps_latnode_t *d;
+	int32 i, n_links;
+
+	TEST_ASSERT(lb = ps_latbin_open(file));
+	TEST_EQUAL(dag->n_frames, ps_latbin_n_frames(lb));
+	TEST_EQUAL(logmath_get_base(dag->lmath), ps_latbin_logbase(lb));
+	n_links = 0;
+	for (i = 0, d = dag->nodes; d; d = d->next, ++i) {
+		latlink_list_t *l;
+		ps_latlink_t *link;
+		char const *word;
+		int32 sf, fef, lef, to, ascr, n_exits;
+
+		TEST_EQUAL(i, ps_latbin_next_node(lb, &word, &sf, &fef, &lef));
+		TEST_EQUAL(0, strcmp(word, dict_wordstr(dag->dict, d->wid)));
+		TEST_EQUAL(d->sf, sf);
+		TEST_EQUAL(d->fef, fef);
+		TEST_EQUAL(d->lef, lef);
+		if (d == dag->start)
+			TEST_EQUAL(i, ps_latbin_start(lb));
+		if (d == dag->end)
+			TEST_EQUAL(i, ps_latbin_end(lb));
+		n_exits = 0;
+		for (l = d->exits; l; l = l->next)
+			if (!(l->link->ascr WORSE_THAN WORST_SCORE
+			      || l->link->ascr BETTER_THAN 0))
+				++n_exits;
+		while ((to = ps_latbin_next_link(lb, &ascr)) >= 0) {
+			TEST_ASSERT(link = find_exit(d, to));
+			TEST_EQUAL(link->ascr << SENSCR_SHIFT, ascr);
+			--n_exits;
+			++n_links;
+		}
+		TEST_EQUAL(0, n_exits);
+	}
+	TEST_EQUAL(i, ps_latbin_n_nodes(lb));
+	TEST_EQUAL(n_links, ps_latbin_n_links(lb));
+	TEST_ASSERT(ps_latbin_next_node(lb, NULL, NULL, NULL, NULL) < 0);
+	printf("%s: %d nodes %d links\n", file, i, n_links);
+
+	/* Seek to the last node, skipping its predecessors' links. */
+	TEST_EQUAL(0, ps_latbin_seek(lb, i - 1));
+	TEST_EQUAL(i - 1, ps_latbin_next_node(lb, NULL, NULL, NULL, NULL));
+	TEST_ASSERT(ps_latbin_seek(lb, i) < 0);
+	ps_latbin_free(lb);
+}
+
+/* Compare two lattices read from files, node by node and link by link. */
+static void
+test_same(ps_lattice_t *dag, ps_lattice_t *dag2, int htk)
+{
+	ps_latnode_t *d, *d2;
+
+	TEST_EQUAL(dag->start->id, dag2->start->id);
+	TEST_EQUAL(dag->end->id, dag2->end->id);
+	for (d = dag->nodes, d2 = dag2->nodes; d && d2;
+	     d = d->next, d2 = d2->next) {
+		latlink_list_t *l, *l2;
+
+		TEST_EQUAL(d->id, d2->id);
+		TEST_EQUAL(d->sf, d2->sf);
+		/* HTK has neither end frames nor filler words. */
+		if (!htk) {
+			TEST_EQUAL(d->wid, d2->wid);
+			TEST_EQUAL(d->fef, d2->fef);
+			TEST_EQUAL(d->lef, d2->lef);
+		}
+		else if (!dict_filler_word(dag->dict, d->wid))
+			TEST_EQUAL(d->wid, d2->wid);
+		for (l = d->exits, l2 = d2->exits; l && l2;
+		     l = l->next, l2 = l2->next) {
+			ps_latlink_t *link;
+			int32 diff;
+
+			TEST_ASSERT(link = find_exit(d2, l->link->to->id));
+			/* Fillers are penalized as silence in HTK lattices. */
+			if (htk && dict_filler_word(dag->dict, l->link->to->wid))
+				continue;
+			diff = l->link->ascr - link->ascr;
+			TEST_ASSERT(diff >= -1 && diff <= 1);
+		}
+		TEST_ASSERT(l == NULL && l2 == NULL);
+	}
+	TEST_ASSERT(d == NULL && d2 == NULL);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	ps_lattice_t *dag, *dag2;
+	ps_latlink_t *link;
+	cmd_ln_t *config;
+	FILE *rawfh;
+	char *hyp;
+	int32 score;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-fwdtree", "yes",
+				"-fwdflat", "no",
+				"-bestpath", "no",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	TEST_ASSERT(dag = ps_get_lattice(ps));
+	TEST_EQUAL(0, ps_lattice_write_bin(dag, "goforward.latbin"));
+	TEST_EQUAL(0, ps_lattice_write_htk(dag, "goforward.slf"));
+	test_stream(dag, "goforward.latbin");
+
+	/* Reading it back gives the same lattice, and the same best path. */
+	TEST_ASSERT(link = ps_lattice_bestpath(dag, ps_get_lm(ps, PS_DEFAULT_SEARCH),
+					       1.0, 1.0/15.0));
+	hyp = ckd_salloc(ps_lattice_hyp(dag, link));
+	TEST_ASSERT(dag = ps_lattice_read(ps, "goforward.latbin"));
+	TEST_ASSERT(link = ps_lattice_bestpath(dag, ps_get_lm(ps, PS_DEFAULT_SEARCH),
+					       1.0, 1.0/15.0));
+	printf("%s\n%s\n", hyp, ps_lattice_hyp(dag, link));
+	TEST_EQUAL(0, strcmp(hyp, ps_lattice_hyp(dag, link)));
+	ckd_free(hyp);
+
+	/* Which can be written again. */
+	TEST_EQUAL(0, ps_lattice_write_bin(dag, "goforward2.latbin"));
+	test_stream(dag, "goforward2.latbin");
+
+	/* HTK and binary lattices convert both ways. */
+	TEST_ASSERT(dag2 = ps_lattice_read_htk(ps, "goforward.slf"));
+	test_same(dag, dag2, TRUE);
+	TEST_EQUAL(0, ps_lattice_write_bin(dag2, "goforward3.latbin"));
+	ps_lattice_free(dag2);
+	TEST_ASSERT(dag2 = ps_lattice_read(ps, "goforward3.latbin"));
+	test_same(dag, dag2, TRUE);
+	TEST_EQUAL(0, ps_lattice_write_htk(dag2, "goforward3.slf"));
+	ps_lattice_free(dag2);
+	TEST_ASSERT(dag2 = ps_lattice_read_htk(ps, "goforward3.slf"));
+	test_same(dag, dag2, TRUE);
+	ps_lattice_free(dag2);
+	ps_lattice_free(dag);
+
+	/* Standalone lattices get their words from the file. */
+	TEST_ASSERT(dag = ps_lattice_read(NULL, "goforward.latbin"));
+	TEST_EQUAL(0, ps_lattice_write_bin(dag, "goforward4.latbin"));
+	TEST_ASSERT(dag2 = ps_lattice_read(NULL, "goforward4.latbin"));
+	test_same(dag, dag2, FALSE);
+	ps_lattice_free(dag2);
+	ps_lattice_free(dag);
+
+	/* Other files are not binary lattices. */
+	TEST_ASSERT(ps_latbin_open("goforward.slf") == NULL);
+	TEST_ASSERT(ps_lattice_read_htk(ps, DATADIR "/goforward.raw") == NULL);
+
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return 0;
+}
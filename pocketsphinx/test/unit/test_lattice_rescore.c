@@ -0,0 +1,90 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ps_lattice_internal.h"
+#include "test_macros.h"
+
+/* Rescore, returning the best path's words and score. */
+static char *
+rescore(ps_lattice_t *dag, ngram_model_t *lm, int32 max_states,
+	int nthreads, int32 *out_score)
+{
+	ps_latlink_t *link;
+	char const *hyp;
+
+	TEST_ASSERT(link = ps_lattice_rescore(dag, lm, 1.0, max_states,
+					      nthreads));
+	*out_score = link->path_scr;
+	TEST_ASSERT(hyp = ps_lattice_hyp(dag, link));
+	printf("%d states, %d threads: %s (%d)\n",
+	       max_states, nthreads, hyp, *out_score);
+	return ckd_salloc(hyp);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	ps_lattice_t *dag;
+	ps_latlink_t *link;
+	ngram_model_t *lm;
+	cmd_ln_t *config;
+	FILE *rawfh;
+	char *ref_hyp, *hyp;
+	int32 ref_score, bp_score, score;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-fwdflat", "no",
+				"-bestpath", "no",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	TEST_ASSERT(dag = ps_get_lattice(ps));
+
+	/* With all the states, the best path is at least as good as
+	 * the one through the best predecessors. */
+	TEST_ASSERT(link = ps_lattice_bestpath(dag, ps_get_lm(ps, PS_DEFAULT_SEARCH),
+					       1.0, 1.0/15.0));
+	bp_score = link->path_scr;
+	printf("Bestpath: %s (%d)\n", ps_lattice_hyp(dag, link), bp_score);
+	ref_hyp = rescore(dag, ps_get_lm(ps, PS_DEFAULT_SEARCH), 1000, 1,
+			  &ref_score);
+	TEST_EQUAL(0, strcmp("go forward ten meters", ref_hyp));
+	TEST_ASSERT(ref_score >= bp_score);
+
+	/* Threads find the same. */
+	hyp = rescore(dag, ps_get_lm(ps, PS_DEFAULT_SEARCH), 1000, 4, &score);
+	TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+	TEST_EQUAL(ref_score, score);
+	ckd_free(hyp);
+
+	/* Fewer states can only do worse. */
+	hyp = rescore(dag, ps_get_lm(ps, PS_DEFAULT_SEARCH), 1, 4, &score);
+	TEST_ASSERT(score <= ref_score);
+	ckd_free(hyp);
+
+	/* As does a model which is not the decoder's, once it is
+	 * weighted the same. */
+	TEST_ASSERT(lm = ngram_model_read(config, MODELDIR "/en-us/en-us.lm.bin",
+					  NGRAM_AUTO, ps_get_logmath(ps)));
+	ngram_model_apply_weights(lm, cmd_ln_float32_r(config, "-lw"),
+				  cmd_ln_float32_r(config, "-wip"));
+	hyp = rescore(dag, lm, 1000, 4, &score);
+	TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+	TEST_EQUAL(ref_score, score);
+	ckd_free(hyp);
+	ngram_model_free(lm);
+
+	ckd_free(ref_hyp);
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return 0;
+}
@@ -0,0 +1,68 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ngram_search.h"
+#include "test_macros.h"
+
+/* Decode an utterance with fwdtree alone, returning the hypothesis. */
+static char *
+decode(char const *lmla, char const *lmlacache)
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps;
+	ngram_search_t *ngs;
+	FILE *rawfh;
+	char *hyp;
+	int32 score;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", DATADIR "/turtle.lm.bin",
+				"-dict", DATADIR "/turtle.dic",
+				"-fwdflat", "no",
+				"-bestpath", "no",
+				"-lmla", lmla,
+				"-lmlacache", lmlacache,
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	hyp = ckd_salloc(ps_get_hyp(ps, &score));
+	ngs = (ngram_search_t *)ps->search;
+	printf("lmla %s cache %s: %s (%d), %d computed, %d cached\n",
+	       lmla, lmlacache, hyp, score,
+	       ngs->st.n_lmla_miss, ngs->st.n_lmla_hit);
+	if (ngs->lmla_order > 0) {
+		TEST_ASSERT(ngs->st.n_lmla_miss > 0);
+		TEST_ASSERT(ngs->st.n_lmla_hit > 0);
+	}
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return hyp;
+}
+
+/* Lookahead of any order only changes what is pruned, which with the
+ * default beams is not the best path. */
+int
+main(int argc, char *argv[])
+{
+	char *hyp, *hyp2;
+
+	hyp = decode("0", "64");
+	hyp2 = decode("1", "64");
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	ckd_free(hyp2);
+	hyp2 = decode("3", "64");
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	ckd_free(hyp2);
+	/* A tiny cache just computes more often. */
+	hyp2 = decode("3", "2");
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	ckd_free(hyp2);
+	ckd_free(hyp);
+	return 0;
+}
@@ -0,0 +1,118 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+static char const *files[] = {
+	DATADIR "/something.raw",
+	DATADIR "/goforward.raw",
+	DATADIR "/numbers.raw"
+};
+#define N_FILES (sizeof(files) / sizeof(files[0]))
+
+static char const *text =
+	"go somewhere and do something "
+	"go forward ten meters "
+	"thirty three four or six ninety two";
+
+/* Every word has a time, and they come one after the other. */
+static int
+test_times(ps_longalign_t *la, int n_frames)
+{
+	int i, sf, ef, anchor, last_ef = -1, n_anchor = 0;
+
+	for (i = 0; i < ps_longalign_n_words(la); ++i) {
+		char const *word = ps_longalign_word(la, i, &sf, &ef, &anchor);
+		printf("%s %d %d%s\n", word, sf, ef, anchor ? " (anchor)" : "");
+		TEST_ASSERT(sf > last_ef);
+		TEST_ASSERT(ef >= sf);
+		last_ef = ef;
+		n_anchor += anchor;
+	}
+	TEST_ASSERT(last_ef < n_frames);
+	return n_anchor;
+}
+
+/* Results do not depend on the number of threads. */
+static void
+test_same(ps_longalign_t *la, ps_longalign_t *ref)
+{
+	int i, sf, ef, anchor, ref_sf, ref_ef, ref_anchor;
+
+	TEST_EQUAL(ps_longalign_n_words(ref), ps_longalign_n_words(la));
+	for (i = 0; i < ps_longalign_n_words(la); ++i) {
+		ps_longalign_word(la, i, &sf, &ef, &anchor);
+		ps_longalign_word(ref, i, &ref_sf, &ref_ef, &ref_anchor);
+		TEST_EQUAL(ref_sf, sf);
+		TEST_EQUAL(ref_ef, ef);
+		TEST_EQUAL(ref_anchor, anchor);
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	ps_longalign_t *ref, *la;
+	cmd_ln_t *config;
+	int16 *buf;
+	size_t n_samples;
+	int i, n_frames;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+
+	/* Make a longer recording out of several. */
+	buf = NULL;
+	n_samples = 0;
+	for (i = 0; i < N_FILES; ++i) {
+		FILE *rawfh;
+		long size;
+
+		TEST_ASSERT(rawfh = fopen(files[i], "rb"));
+		fseek(rawfh, 0, SEEK_END);
+		size = ftell(rawfh) / sizeof(*buf);
+		fseek(rawfh, 0, SEEK_SET);
+		buf = ckd_realloc(buf, (n_samples + size) * sizeof(*buf));
+		TEST_EQUAL(size, fread(buf + n_samples, sizeof(*buf), size, rawfh));
+		n_samples += size;
+		fclose(rawfh);
+	}
+	n_frames = n_samples / 160;
+
+	/* Recognized in one piece, most of it is anchored. */
+	TEST_ASSERT(ref = ps_longalign_init(ps, 1));
+	TEST_EQUAL(16, ps_longalign_run(ref, text, buf, n_samples));
+	TEST_EQUAL(16, ps_longalign_n_words(ref));
+	TEST_ASSERT(test_times(ref, n_frames) >= 8);
+	ps_longalign_free(ref);
+
+	/* In short chunks, cut up among several threads, less of it
+	 * is, but it is still all aligned. */
+	TEST_ASSERT(ref = ps_longalign_init(ps, 1));
+	ps_longalign_set_chunk_size(ref, 1.5);
+	TEST_EQUAL(16, ps_longalign_run(ref, text, buf, n_samples));
+	test_times(ref, n_frames);
+	TEST_ASSERT(la = ps_longalign_init(ps, 3));
+	ps_longalign_set_chunk_size(la, 1.5);
+	TEST_EQUAL(16, ps_longalign_run(la, text, buf, n_samples));
+	test_same(la, ref);
+
+	/* Words must be in the dictionary. */
+	TEST_ASSERT(ps_longalign_run(la, "go frobnicate", buf, n_samples) < 0);
+	TEST_EQUAL(0, ps_longalign_n_words(la));
+	ps_longalign_free(la);
+	ps_longalign_free(ref);
+
+	ckd_free(buf);
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	return 0;
+}
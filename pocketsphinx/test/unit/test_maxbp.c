@@ -0,0 +1,147 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ngram_search.h"
+#include "fsg_search_internal.h"
+#include "fsg_history.h"
+#include "test_macros.h"
+
+static ps_decoder_t *
+init_decoder(char const *search, char const *arg, char const *passes,
+	     char const *maxbp)
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				search, arg,
+				"-dict", DATADIR "/turtle.dic",
+				"-fwdflat", passes,
+				"-bestpath", passes,
+				"-maxbp", maxbp,
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	cmd_ln_free_r(config);
+	return ps;
+}
+
+static char *
+decode(ps_decoder_t *ps, int32 *out_score)
+{
+	FILE *rawfh;
+	char const *hyp;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	hyp = ps_get_hyp(ps, out_score);
+	return ckd_salloc(hyp ? hyp : "");
+}
+
+/* Decode twice with an N-Gram search, checking that the backpointer
+ * table stays where it was put. */
+static char *
+decode_ngram(char const *passes, char const *maxbp, int32 *out_score,
+	     int32 *out_n_full)
+{
+	ps_decoder_t *ps;
+	ngram_search_t *ngs;
+	bptbl_t **bp_table;
+	int32 n_bp_block_alloc, n_bss_block_alloc;
+	char *hyp = NULL;
+	int i;
+
+	ps = init_decoder("-lm", DATADIR "/turtle.lm.bin", passes, maxbp);
+	ngs = (ngram_search_t *)ps->search;
+	bp_table = ngs->bp_table;
+	n_bp_block_alloc = ngs->n_bp_block_alloc;
+	n_bss_block_alloc = ngs->n_bss_block_alloc;
+	for (i = 0; i < 2; ++i) {
+		ckd_free(hyp);
+		hyp = decode(ps, out_score);
+		printf("maxbp %s passes %s: %s (%d), %d backpointers, "
+		       "%d collected, %d pruned\n", maxbp, passes, hyp,
+		       *out_score, ngs->bpidx, ngs->st.n_bp_gc,
+		       ngs->st.n_bp_full);
+		if (ngs->max_bp == 0)
+			continue;
+		TEST_ASSERT(ngs->bpidx <= ngs->max_bp);
+		TEST_ASSERT(ngs->bss_head <= ngs->max_bss);
+		TEST_EQUAL(bp_table, ngs->bp_table);
+		TEST_EQUAL(n_bp_block_alloc, ngs->n_bp_block_alloc);
+		TEST_EQUAL(n_bss_block_alloc, ngs->n_bss_block_alloc);
+	}
+	*out_n_full = ngs->st.n_bp_full;
+	ps_free(ps);
+	return hyp;
+}
+
+static char *
+decode_fsg(char const *maxbp, int32 *out_score, int32 *out_n_pruned)
+{
+	ps_decoder_t *ps;
+	fsg_search_t *fsgs;
+	char *hyp;
+
+	ps = init_decoder("-fsg", DATADIR "/goforward.fsg", "no", maxbp);
+	fsgs = (fsg_search_t *)ps->search;
+	hyp = decode(ps, out_score);
+	printf("maxbp %s fsg: %s (%d), %d history entries, %d pruned\n",
+	       maxbp, hyp, *out_score, fsg_history_n_entries(fsgs->history),
+	       fsgs->history->n_pruned);
+	if (fsgs->history->max_entries > 0)
+		TEST_ASSERT(fsg_history_n_entries(fsgs->history)
+			    <= fsgs->history->max_entries);
+	*out_n_pruned = fsgs->history->n_pruned;
+	ps_free(ps);
+	return hyp;
+}
+
+int
+main(int argc, char *argv[])
+{
+	char *ref_hyp, *hyp;
+	int32 ref_score, score, n_full;
+
+	/* A table big enough for the utterance finds the same result. */
+	ref_hyp = decode_ngram("yes", "0", &ref_score, &n_full);
+	hyp = decode_ngram("yes", "5000", &score, &n_full);
+	TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+	TEST_EQUAL(ref_score, score);
+	TEST_EQUAL(0, n_full);
+	ckd_free(hyp);
+	ckd_free(ref_hyp);
+
+	/* Without a second pass, it is garbage collected as it fills up,
+	 * which does not change the result either. */
+	ref_hyp = decode_ngram("no", "0", &ref_score, &n_full);
+	hyp = decode_ngram("no", "300", &score, &n_full);
+	TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+	TEST_EQUAL(ref_score, score);
+	TEST_EQUAL(0, n_full);
+	ckd_free(hyp);
+	ckd_free(ref_hyp);
+
+	/* One which is too small loses word exits, but nothing else. */
+	hyp = decode_ngram("yes", "200", &score, &n_full);
+	TEST_ASSERT(n_full > 0);
+	ckd_free(hyp);
+
+	/* Likewise for the FSG search's history. */
+	ref_hyp = decode_fsg("0", &ref_score, &n_full);
+	hyp = decode_fsg("5000", &score, &n_full);
+	TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+	TEST_EQUAL(ref_score, score);
+	TEST_EQUAL(0, n_full);
+	ckd_free(hyp);
+	hyp = decode_fsg("500", &score, &n_full);
+	TEST_ASSERT(n_full > 0);
+	ckd_free(hyp);
+	ckd_free(ref_hyp);
+
+	return 0;
+}
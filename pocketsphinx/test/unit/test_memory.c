@@ -0,0 +1,92 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+static char const *part_names[PS_N_MEM_PARTS] = {
+	"acmod", "mgau", "dict", "dict2pid", "lm", "search", "lattice"
+};
+
+static void
+decode(ps_decoder_t *ps)
+{
+	FILE *rawfh;
+	char const *hyp;
+	int32 score;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	hyp = ps_get_hyp(ps, &score);
+	printf("%s (%d)\n", hyp, score);
+	TEST_ASSERT(hyp);
+	TEST_EQUAL(0, strcmp(hyp, "go forward ten meters"));
+}
+
+static void
+report(ps_decoder_t *ps, ps_mem_t *mem)
+{
+	int i;
+
+	ps_get_memory_report(ps, mem);
+	for (i = 0; i < PS_N_MEM_PARTS; ++i)
+		printf("%-8s heap %9ld shared %9ld mapped %9ld\n", part_names[i],
+		       (long)mem[i].heap, (long)mem[i].shared,
+		       (long)mem[i].mapped);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps, *clone;
+	ps_mem_t mem[PS_N_MEM_PARTS], mem2[PS_N_MEM_PARTS];
+	ps_mem_t mem3[PS_N_MEM_PARTS];
+	cmd_ln_t *config;
+	int i;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-bestpath", "yes",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	decode(ps);
+
+	/* Every part of a decoder on its own is private. */
+	report(ps, mem);
+	for (i = 0; i < PS_N_MEM_PARTS; ++i) {
+		TEST_ASSERT(mem[i].heap + mem[i].mapped > 0);
+		TEST_EQUAL(0, mem[i].shared);
+	}
+	/* The large parts are large. */
+	TEST_ASSERT(mem[PS_MEM_MGAU].heap + mem[PS_MEM_MGAU].mapped > 1000000);
+	TEST_ASSERT(mem[PS_MEM_LM].heap + mem[PS_MEM_LM].mapped > 1000000);
+	TEST_ASSERT(mem[PS_MEM_DICT].heap > 1000000);
+
+	/* Once cloned, the models are shared and the clone only has
+	 * a little of its own. */
+	TEST_ASSERT(clone = ps_clone(ps));
+	decode(clone);
+	report(ps, mem2);
+	report(clone, mem3);
+	for (i = 0; i < PS_N_MEM_PARTS; ++i) {
+		TEST_EQUAL(mem[i].mapped, mem2[i].mapped);
+		if (i == PS_MEM_SEARCH || i == PS_MEM_LATTICE)
+			continue;
+		TEST_ASSERT(mem2[i].shared > 0);
+		TEST_ASSERT(mem2[i].heap < mem[i].heap);
+	}
+	TEST_ASSERT(mem3[PS_MEM_MGAU].heap < mem3[PS_MEM_MGAU].shared);
+	TEST_ASSERT(mem3[PS_MEM_LM].heap < mem3[PS_MEM_LM].shared / 10);
+	TEST_ASSERT(mem3[PS_MEM_DICT].heap < mem3[PS_MEM_DICT].shared / 10);
+
+	ps_free(clone);
+	ps_free(ps);
+	cmd_ln_free_r(config);
+
+	return 0;
+}
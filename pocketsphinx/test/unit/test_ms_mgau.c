@@ -0,0 +1,131 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ms_mgau.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+/* The vectorized quantized codebook evaluation must give exactly
+ * the same densities as the reference code. */
+static void
+test_q8_kernels(void)
+{
+	logmath_t *lmath;
+	gauden_t *g, *gq, *gref;
+	gauden_dist_t **dist, **ref;
+	mfcc_t **obs;
+	uint32 rnd = 42;
+	int m, f, i, t, n_top;
+
+	lmath = logmath_init(1.0001, 0, 0);
+	TEST_ASSERT(g = gauden_init(MODELDIR "/en-us/en-us/means",
+				    MODELDIR "/en-us/en-us/variances",
+				    0.0001, lmath));
+	TEST_EQUAL(0, gauden_write_q8(g, "test_ms_mgau.gauq8"));
+	TEST_ASSERT(gq = gauden_init_q8("test_ms_mgau.gauq8", lmath));
+	TEST_ASSERT(gref = gauden_init_q8("test_ms_mgau.gauq8", lmath));
+	gref->q8_block = NULL;
+	TEST_EQUAL(g->n_mgau, gq->n_mgau);
+	TEST_EQUAL(g->n_density, gq->n_density);
+
+	obs = (mfcc_t **)ckd_calloc_2d(g->n_feat, g->featlen[0], sizeof(**obs));
+	dist = (gauden_dist_t **)ckd_calloc_2d(g->n_feat, g->n_density,
+					       sizeof(**dist));
+	ref = (gauden_dist_t **)ckd_calloc_2d(g->n_feat, g->n_density,
+					      sizeof(**ref));
+	for (t = 0; t < 20; ++t) {
+		for (f = 0; f < g->n_feat; ++f) {
+			for (i = 0; i < g->featlen[f]; ++i) {
+				rnd = rnd * 1103515245 + 12345;
+				obs[f][i] = FLOAT2MFCC(((rnd >> 16) % 2000) / 100.0 - 10.0);
+			}
+		}
+		for (n_top = 4; n_top <= g->n_density; n_top *= 32) {
+			for (m = 0; m < g->n_mgau; ++m) {
+				gauden_dist(gq, m, n_top, obs, dist);
+				gauden_dist(gref, m, n_top, obs, ref);
+				for (f = 0; f < g->n_feat; ++f) {
+					for (i = 0; i < n_top; ++i) {
+						TEST_EQUAL(ref[f][i].id, dist[f][i].id);
+						TEST_EQUAL(ref[f][i].dist, dist[f][i].dist);
+					}
+				}
+			}
+		}
+	}
+	ckd_free_2d(obs);
+	ckd_free_2d(dist);
+	ckd_free_2d(ref);
+	gauden_free(gref);
+	gauden_free(gq);
+	gauden_free(g);
+	logmath_free(lmath);
+}
+
+/* Decode with the given scoring options, checking the thread count. */
+static char *
+decode(char const *compallsen, char const *nthreads, char const *gauq8,
+       int32 *out_score)
+{
+	ps_decoder_t *ps;
+	char *hyp;
+
+	ps = ps_test_init(DATADIR "/an4_ci_cont", DATADIR "/turtle.dic",
+			  "-lm", DATADIR "/turtle.lm.bin",
+			  "-compallsen", compallsen,
+			  "-nscorethreads", nthreads,
+			  "-gauq8", gauq8,
+			  "-samprate", "16000", NULL);
+	TEST_EQUAL(0, strcmp(ps->acmod->mgau->vt->name, "ms"));
+	TEST_EQUAL(atoi(nthreads),
+		   ((ms_mgau_model_t *)ps->acmod->mgau)->n_thread);
+	printf("compallsen %s, %s threads\n", compallsen, nthreads);
+	hyp = ps_test_decode(ps, DATADIR "/goforward.raw", out_score);
+	ps_free(ps);
+	return hyp;
+}
+
+/* Scoring in several threads must give exactly the same result. */
+int
+main(int argc, char *argv[])
+{
+	char *hyp, *hyp2;
+	int32 score, score2;
+
+	test_q8_kernels();
+
+	hyp = decode("no", "1", NULL, &score);
+	hyp2 = decode("no", "3", NULL, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+
+	hyp2 = decode("yes", "1", NULL, &score2);
+	ckd_free(hyp);
+	hyp = decode("yes", "4", NULL, &score);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+
+	/* Quantized codebooks should not change the result. */
+	{
+		logmath_t *lmath = logmath_init(1.0001, 0, 0);
+		gauden_t *g;
+
+		TEST_ASSERT(g = gauden_init(DATADIR "/an4_ci_cont/means",
+					    DATADIR "/an4_ci_cont/variances",
+					    0.0001, lmath));
+		TEST_EQUAL(0, gauden_write_q8(g, "test_ms_mgau_an4.gauq8"));
+		gauden_free(g);
+		logmath_free(lmath);
+	}
+	hyp2 = decode("no", "2", "test_ms_mgau_an4.gauq8", &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	ckd_free(hyp);
+	ckd_free(hyp2);
+
+	return 0;
+}
@@ -6,6 +6,33 @@
 #include "test_macros.h"
 #include "test_ps.c"
 
+/* Hypotheses are distinct, and the best one comes first. */
+static int
+test_distinct(ps_decoder_t *ps, int max_n)
+{
+	ps_nbest_t *nbest;
+	char *hyps[100];
+	int32 score;
+	int i, n;
+
+	for (n = 0, nbest = ps_nbest(ps); nbest && n < max_n;
+	     nbest = ps_nbest_next(nbest), n++) {
+		char const *hyp = ps_nbest_hyp(nbest, &score);
+
+		TEST_ASSERT(hyp);
+		for (i = 0; i < n; ++i)
+			TEST_ASSERT(0 != strcmp(hyps[i], hyp));
+		hyps[n] = ckd_salloc(hyp);
+	}
+	if (nbest)
+		ps_nbest_free(nbest);
+	TEST_ASSERT(n > 0);
+	TEST_EQUAL(0, strcmp(hyps[0], "go forward ten meters"));
+	for (i = 0; i < n; ++i)
+		ckd_free(hyps[i]);
+	return n;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -48,6 +75,16 @@ main(int argc, char *argv[])
 	}
 	if (nbest)
 	    ps_nbest_free(nbest);
+	printf("%d distinct hypotheses\n", test_distinct(ps, 100));
+
+	/* A small frontier and stack still find the best ones. */
+	cmd_ln_set_int32_r(config, "-nbestpaths", 20);
+	cmd_ln_set_int32_r(config, "-nbeststack", 2);
+	n = test_distinct(ps, 100);
+	printf("%d distinct hypotheses with 20 paths, 2 per frame\n", n);
+	cmd_ln_set_int32_r(config, "-nbestpaths", 1);
+	cmd_ln_set_int32_r(config, "-nbeststack", 1);
+	TEST_EQUAL(1, test_distinct(ps, 100));
 	ps_free(ps);
 	cmd_ln_free_r(config);
 	return 0;
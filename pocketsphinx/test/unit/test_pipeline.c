@@ -0,0 +1,147 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+#define MAX_SEG 64
+
+/* What a decoder found for an utterance. */
+typedef struct result_s {
+	char hyp[256];
+	int32 score;
+	int n_seg;
+	int sf[MAX_SEG], ef[MAX_SEG];
+	int n_cb;
+} result_t;
+
+static void
+hyp_cb(void *user_data, char const *hyp, int32 score)
+{
+	result_t *res = user_data;
+	++res->n_cb;
+}
+
+static ps_decoder_t *
+init_decoder(char const *pipeline, char const *search, char const *arg,
+	     char const *pl_window)
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps;
+
+	/* The pipeline scores all senones, so the reference does too,
+	 * otherwise the path scores would be normalized differently. */
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				search, arg,
+				"-pl_window", pl_window,
+				"-pipeline", pipeline,
+				"-compallsen", "yes",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	cmd_ln_free_r(config);
+	TEST_EQUAL(atoi(pipeline) > 0, ps->pipeline != NULL);
+	return ps;
+}
+
+/* Decode in chunks of the given number of samples. */
+static void
+decode(ps_decoder_t *ps, size_t chunk, result_t *res)
+{
+	FILE *rawfh;
+	int16 buf[4096];
+	char const *hyp;
+	ps_seg_t *seg;
+	size_t n;
+
+	memset(res, 0, sizeof(*res));
+	TEST_EQUAL(0, ps_set_hyp_callback(ps, hyp_cb, res, 10));
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	TEST_EQUAL(0, ps_start_utt(ps));
+	while ((n = fread(buf, sizeof(*buf), chunk, rawfh)) > 0)
+		TEST_ASSERT(ps_process_raw(ps, buf, n, FALSE, FALSE) >= 0);
+	TEST_EQUAL(0, ps_end_utt(ps));
+	fclose(rawfh);
+	hyp = ps_get_hyp(ps, &res->score);
+	TEST_ASSERT(hyp);
+	strncpy(res->hyp, hyp, sizeof(res->hyp) - 1);
+	for (seg = ps_seg_iter(ps); seg && res->n_seg < MAX_SEG;
+	     seg = ps_seg_next(seg)) {
+		ps_seg_frames(seg, &res->sf[res->n_seg], &res->ef[res->n_seg]);
+		++res->n_seg;
+	}
+	if (seg)
+		ps_seg_free(seg);
+	printf("%s (%d) %d segments, %d callbacks\n",
+	       res->hyp, res->score, res->n_seg, res->n_cb);
+}
+
+static void
+test_same(char const *search, char const *arg, char const *pl_window)
+{
+	ps_decoder_t *ps, *ref;
+	result_t r1, r2;
+	size_t chunks[] = { 4096, 256, 1000 };
+	int i, j;
+
+	ref = init_decoder("0", search, arg, pl_window);
+	ps = init_decoder("20", search, arg, pl_window);
+	for (i = 0; i < 3; ++i) {
+		decode(ref, chunks[i], &r1);
+		decode(ps, chunks[i], &r2);
+		TEST_EQUAL(0, strcmp(r1.hyp, r2.hyp));
+		TEST_EQUAL(r1.score, r2.score);
+		TEST_EQUAL(r1.n_seg, r2.n_seg);
+		for (j = 0; j < r1.n_seg; ++j) {
+			TEST_EQUAL(r1.sf[j], r2.sf[j]);
+			TEST_EQUAL(r1.ef[j], r2.ef[j]);
+		}
+		/* The search is not behind the input when each call
+		 * returns, so partial results come at the same time. */
+		TEST_EQUAL(r1.n_cb, r2.n_cb);
+		TEST_EQUAL(ps_get_n_frames(ref), ps_get_n_frames(ps));
+	}
+	ps_free(ref);
+	ps_free(ps);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	FILE *rawfh;
+	char const *hyp;
+	int32 score;
+
+	/* Scores computed ahead give the same results for all the
+	 * passes of the N-Gram search. */
+	test_same("-lm", MODELDIR "/en-us/en-us.lm.bin", "0");
+	/* With phone lookahead, which reads scores from further back. */
+	test_same("-lm", MODELDIR "/en-us/en-us.lm.bin", "5");
+	/* And for finite-state grammars. */
+	test_same("-fsg", DATADIR "/goforward.fsg", "0");
+
+	/* Whole utterances are decoded the usual way too, and the
+	 * decoder can be used more than once. */
+	ps = init_decoder("4", "-fsg", DATADIR "/goforward.fsg", "0");
+	TEST_ASSERT(ps->acmod->compallsen);
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	TEST_ASSERT(ps_decode_raw(ps, rawfh, -1) > 0);
+	hyp = ps_get_hyp(ps, &score);
+	TEST_ASSERT(hyp);
+	printf("%s (%d)\n", hyp, score);
+	TEST_EQUAL(0, strcmp(hyp, "go forward ten meters"));
+	fseek(rawfh, 0, SEEK_SET);
+	TEST_ASSERT(ps_decode_raw(ps, rawfh, -1) > 0);
+	hyp = ps_get_hyp(ps, &score);
+	TEST_ASSERT(hyp);
+	TEST_EQUAL(0, strcmp(hyp, "go forward ten meters"));
+	fclose(rawfh);
+	ps_free(ps);
+
+	return 0;
+}
@@ -1,4 +1,5 @@
 #include <pocketsphinx.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -6,6 +7,60 @@
 
 #include "test_macros.h"
 
+/* Initialize a decoder with an acoustic model and dictionary, plus a
+ * NULL-terminated list of further argument names and values.  Those
+ * with a NULL value are left out, so optional ones can be passed
+ * through as they are. */
+ps_decoder_t *
+ps_test_init(char const *hmmdir, char const *dict, ...)
+{
+    char const *argv[64];
+    char const *name, *val;
+    cmd_ln_t *config;
+    ps_decoder_t *ps;
+    va_list args;
+    int argc;
+
+    argc = 0;
+    argv[argc++] = "-hmm";
+    argv[argc++] = hmmdir;
+    argv[argc++] = "-dict";
+    argv[argc++] = dict;
+    va_start(args, dict);
+    while ((name = va_arg(args, char const *)) != NULL) {
+        val = va_arg(args, char const *);
+        if (val == NULL)
+            continue;
+        TEST_ASSERT(argc + 2 <= sizeof(argv) / sizeof(argv[0]));
+        argv[argc++] = name;
+        argv[argc++] = val;
+    }
+    va_end(args);
+    TEST_ASSERT(config = cmd_ln_parse_r(NULL, ps_args(), argc,
+                                        (char **)argv, TRUE));
+    TEST_ASSERT(ps = ps_init(config));
+    cmd_ln_free_r(config);
+    return ps;
+}
+
+/* Decode a raw file, returning a copy of the hypothesis and its score. */
+char *
+ps_test_decode(ps_decoder_t *ps, char const *raw, int32 *out_score)
+{
+    FILE *rawfh;
+    char const *hyp;
+    int32 score;
+
+    TEST_ASSERT(rawfh = fopen(raw, "rb"));
+    ps_decode_raw(ps, rawfh, -1);
+    fclose(rawfh);
+    TEST_ASSERT(hyp = ps_get_hyp(ps, &score));
+    printf("%s: %s (%d)\n", ps->acmod->mgau->vt->name, hyp, score);
+    if (out_score)
+        *out_score = score;
+    return ckd_salloc(hyp);
+}
+
 int
 ps_decoder_test(cmd_ln_t *config, char const *sname, char const *expected)
 {
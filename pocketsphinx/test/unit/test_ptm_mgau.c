@@ -24,7 +24,19 @@ static const mfcc_t cmninit[13] = {
 	FLOAT2MFCC(1.17)
 };
 
-void
+static uint32
+score_checksum(acmod_t *acmod, uint32 chksum, int16 const *senscr)
+{
+	int i;
+
+	for (i = 0; i < bin_mdef_n_sen(acmod->mdef); ++i)
+		chksum = chksum * 31 + (uint16)senscr[i];
+	return chksum;
+}
+
+/* Run the test utterance through acmod, and return a checksum of
+ * all of the senone scores. */
+static uint32
 run_acmod_test(acmod_t *acmod)
 {
 	FILE *rawfh;
@@ -33,6 +45,7 @@ run_acmod_test(acmod_t *acmod)
 	size_t nread, nsamps;
 	int nfr;
 	int frame_counter;
+	uint32 chksum = 0;
 
 	cmn_live_set(acmod->fcb->cmn_struct, cmninit);
 	nsamps = 2048;
@@ -48,7 +61,8 @@ run_acmod_test(acmod_t *acmod)
 			int16 best_score;
 			int frame_idx = -1, best_senid;
 			while (acmod->n_feat_frame > 0) {
-				acmod_score(acmod, &frame_idx);
+				chksum = score_checksum(acmod, chksum,
+							acmod_score(acmod, &frame_idx));
 				acmod_advance(acmod);
 				best_score = acmod_best_score(acmod, &best_senid);
 				printf("Frame %d best senone %d score %d\n",
@@ -65,7 +79,8 @@ run_acmod_test(acmod_t *acmod)
 		int16 best_score;
 		int frame_idx = -1, best_senid;
 		while (acmod->n_feat_frame > 0) {
-			acmod_score(acmod, &frame_idx);
+			chksum = score_checksum(acmod, chksum,
+						acmod_score(acmod, &frame_idx));
 			acmod_advance(acmod);
 			best_score = acmod_best_score(acmod, &best_senid);
 			printf("Frame %d best senone %d score %d\n",
@@ -76,6 +91,8 @@ run_acmod_test(acmod_t *acmod)
 		}
 	}
 	fclose(rawfh);
+	ckd_free(buf);
+	return chksum;
 }
 
 int
@@ -83,10 +100,11 @@ main(int argc, char *argv[])
 {
 	logmath_t *lmath;
 	cmd_ln_t *config;
-	acmod_t *acmod;
+	acmod_t *acmod, *acmod2;
 	ps_mgau_t *ps;
 	ptm_mgau_t *s;
 	int i, lastcb;
+	uint32 chksum;
 
 	lmath = logmath_init(1.0001, 0, 0);
 	config = cmd_ln_init(NULL, ps_args(), TRUE,
@@ -102,6 +120,8 @@ main(int argc, char *argv[])
 	cmd_ln_set_str_extra_r(config, "_mixw", NULL);
 	cmd_ln_set_str_extra_r(config, "_lda", NULL);
 	cmd_ln_set_str_extra_r(config, "_senmgau", NULL);	
+	cmd_ln_set_str_extra_r(config, "_gauq8", NULL);
+	cmd_ln_set_str_extra_r(config, "_kdtree", NULL);
 	
 	TEST_ASSERT(config);
 	TEST_ASSERT((acmod = acmod_init(config, lmath, NULL, NULL)));
@@ -121,7 +141,51 @@ main(int argc, char *argv[])
 		}
 	}
 	E_INFOCONT("-%d\n", i-1);
-	run_acmod_test(acmod);
+	chksum = run_acmod_test(acmod);
+
+	/* The vectorized codebook evaluation must give exactly the same
+	 * scores as the reference code. */
+	printf("Codebook evaluation: %s\n", s->eval_backend);
+	TEST_ASSERT((acmod2 = acmod_init(config, lmath, NULL, NULL)));
+	s = (ptm_mgau_t *)acmod2->mgau;
+	s->dist_block = NULL;
+	TEST_EQUAL(chksum, run_acmod_test(acmod2));
+	acmod_free(acmod2);
+
+	/* Scoring frames in batches must not change the scores either. */
+	cmd_ln_set_int32_r(config, "-scorebatch", 1);
+	TEST_ASSERT((acmod2 = acmod_init(config, lmath, NULL, NULL)));
+	TEST_ASSERT(acmod2->senscr_batch == NULL);
+	TEST_ASSERT(acmod->senscr_batch != NULL);
+	TEST_EQUAL(chksum, run_acmod_test(acmod2));
+	acmod_free(acmod2);
+
+	/* Adaptive downsampling with a threshold nothing gets under
+	 * evaluates every frame, and with one everything does, it
+	 * follows the fixed schedule. */
+	cmd_ln_set_int32_r(config, "-scorebatch", 0);
+	cmd_ln_set_float32_r(config, "-ds_thresh", 1e-12);
+	TEST_ASSERT((acmod2 = acmod_init(config, lmath, NULL, NULL)));
+	TEST_EQUAL(chksum, run_acmod_test(acmod2));
+	acmod_free(acmod2);
+	cmd_ln_set_int32_r(config, "-ds", 3);
+	cmd_ln_set_float32_r(config, "-ds_thresh", 0);
+	TEST_ASSERT((acmod2 = acmod_init(config, lmath, NULL, NULL)));
+	chksum = run_acmod_test(acmod2);
+	acmod_free(acmod2);
+	cmd_ln_set_float32_r(config, "-ds_thresh", 1e12);
+	TEST_ASSERT((acmod2 = acmod_init(config, lmath, NULL, NULL)));
+	TEST_EQUAL(chksum, run_acmod_test(acmod2));
+	acmod_free(acmod2);
+	/* In between, it is the same in batches. */
+	cmd_ln_set_float32_r(config, "-ds_thresh", 0.5);
+	TEST_ASSERT((acmod2 = acmod_init(config, lmath, NULL, NULL)));
+	chksum = run_acmod_test(acmod2);
+	acmod_free(acmod2);
+	cmd_ln_set_int32_r(config, "-scorebatch", 1);
+	TEST_ASSERT((acmod2 = acmod_init(config, lmath, NULL, NULL)));
+	TEST_EQUAL(chksum, run_acmod_test(acmod2));
+	acmod_free(acmod2);
 
 #if 0
 	/* Replace it with ms_mgau. */
@@ -0,0 +1,103 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_macros.h"
+
+static int16 *audio;
+static size_t n_audio;
+
+static void
+decode(ps_decoder_t *ps, size_t chunk)
+{
+	size_t pos;
+
+	TEST_EQUAL(0, ps_start_utt(ps));
+	for (pos = 0; pos < n_audio; pos += chunk) {
+		size_t n = (pos + chunk > n_audio) ? n_audio - pos : chunk;
+		TEST_ASSERT(ps_process_raw(ps, audio + pos, n, FALSE, FALSE) >= 0);
+	}
+	TEST_EQUAL(0, ps_end_utt(ps));
+}
+
+/* The decoder has kept the last size samples of audio. */
+static void
+check_rawdata(ps_decoder_t *ps, size_t size)
+{
+	int16 const *parts[2];
+	int32 sizes[2], total;
+	int16 *buf;
+	int i, n_parts;
+
+	if (size > n_audio)
+		size = n_audio;
+	n_parts = ps_get_rawdata_parts(ps, parts, sizes);
+	total = 0;
+	for (i = 0; i < n_parts; ++i) {
+		TEST_EQUAL(0, memcmp(audio + n_audio - size + total,
+				     parts[i], sizes[i] * sizeof(int16)));
+		total += sizes[i];
+	}
+	TEST_EQUAL(size, total);
+
+	ps_get_rawdata(ps, &buf, &total);
+	TEST_EQUAL(size, total);
+	TEST_EQUAL(0, memcmp(audio + n_audio - size, buf,
+			     size * sizeof(int16)));
+	/* Now it is in one part. */
+	TEST_EQUAL(1, ps_get_rawdata_parts(ps, parts, sizes));
+	TEST_ASSERT(parts[0] == buf);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	cmd_ln_t *config;
+	FILE *rawfh;
+	int16 const *parts[2];
+	int32 sizes[2];
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	fseek(rawfh, 0, SEEK_END);
+	n_audio = ftell(rawfh) / sizeof(int16);
+	fseek(rawfh, 0, SEEK_SET);
+	audio = ckd_calloc(n_audio, sizeof(int16));
+	TEST_EQUAL(n_audio, fread(audio, sizeof(int16), n_audio, rawfh));
+	fclose(rawfh);
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	decode(ps, 777);
+	TEST_EQUAL(0, ps_get_rawdata_parts(ps, parts, sizes));
+
+	/* Everything fits. */
+	ps_set_rawdata_size(ps, n_audio * 2);
+	decode(ps, 777);
+	check_rawdata(ps, n_audio * 2);
+
+	/* Only the end fits, whether it comes in small pieces... */
+	ps_set_rawdata_size(ps, 10000);
+	decode(ps, 777);
+	check_rawdata(ps, 10000);
+	/* ...or large ones. */
+	decode(ps, 25000);
+	check_rawdata(ps, 10000);
+	decode(ps, n_audio);
+	check_rawdata(ps, 10000);
+
+	/* Nothing is kept once turned off. */
+	ps_set_rawdata_size(ps, 0);
+	decode(ps, 777);
+	TEST_EQUAL(0, ps_get_rawdata_parts(ps, parts, sizes));
+
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	ckd_free(audio);
+	return 0;
+}
@@ -0,0 +1,127 @@
+#include <pocketsphinx.h>
+#include <sphinxbase/sbthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+static int32
+decode(ps_decoder_t *ps, char const *ref)
+{
+	FILE *rawfh;
+	char const *hyp;
+	int32 score;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	hyp = ps_get_hyp(ps, &score);
+	printf("%s (%d)\n", hyp, score);
+	TEST_ASSERT(hyp);
+	TEST_EQUAL(0, strcmp(hyp, ref));
+	return score;
+}
+
+/* Prepare a reload of the same language model on another thread. */
+static int
+prepare_thread(sbthread_t *th)
+{
+	ps_reload_t *reload = sbthread_arg(th);
+
+	TEST_EQUAL(0, ps_reload_set_lm_file(reload, PS_DEFAULT_SEARCH,
+					    MODELDIR "/en-us/en-us.lm.bin"));
+	TEST_EQUAL(0, ps_reload_commit(reload));
+	return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	ps_reload_t *reload;
+	ngram_model_t *lm;
+	sbthread_t *th;
+	cmd_ln_t *config;
+	int32 score;
+	int i, n_words;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_EQUAL(0, ps_set_jsgf_file(ps, "jsgf", DATADIR "/goforward.gram"));
+	score = decode(ps, "go forward ten meters");
+	lm = ps_get_lm(ps, PS_DEFAULT_SEARCH);
+
+	/* The decoder keeps going while a reload is prepared, and the
+	 * new language model is used from the next utterance on. */
+	TEST_ASSERT(reload = ps_reload_init(ps));
+	TEST_ASSERT(th = sbthread_start(NULL, prepare_thread, reload));
+	for (i = 0; i < 2; ++i)
+		decode(ps, "go forward ten meters");
+	TEST_EQUAL(0, sbthread_wait(th));
+	sbthread_free(th);
+	TEST_EQUAL(score, decode(ps, "go forward ten meters"));
+	TEST_ASSERT(ps_get_lm(ps, PS_DEFAULT_SEARCH) != lm);
+	TEST_EQUAL(0, strcmp(ps_get_search(ps), PS_DEFAULT_SEARCH));
+	TEST_ASSERT(ps_search_dict(ps->search) == ps->dict);
+
+	/* A reload is not put in place while another is prepared. */
+	lm = ps_get_lm(ps, PS_DEFAULT_SEARCH);
+	TEST_ASSERT(reload = ps_reload_init(ps));
+	TEST_EQUAL(0, ps_reload_set_lm_file(reload, PS_DEFAULT_SEARCH,
+					    MODELDIR "/en-us/en-us.lm.bin"));
+	TEST_EQUAL(0, ps_reload_commit(reload));
+	sbmtx_lock(ps->reload_mtx);
+	decode(ps, "go forward ten meters");
+	TEST_ASSERT(ps_get_lm(ps, PS_DEFAULT_SEARCH) == lm);
+	sbmtx_unlock(ps->reload_mtx);
+	decode(ps, "go forward ten meters");
+	TEST_ASSERT(ps_get_lm(ps, PS_DEFAULT_SEARCH) != lm);
+
+	/* One which fails is discarded. */
+	lm = ps_get_lm(ps, PS_DEFAULT_SEARCH);
+	TEST_ASSERT(reload = ps_reload_init(ps));
+	TEST_ASSERT(ps_reload_set_lm_file(reload, PS_DEFAULT_SEARCH,
+					  DATADIR "/nosuchfile.lm") < 0);
+	TEST_ASSERT(ps_reload_commit(reload) < 0);
+	decode(ps, "go forward ten meters");
+	TEST_ASSERT(ps_get_lm(ps, PS_DEFAULT_SEARCH) == lm);
+
+	/* A new dictionary comes with its own language model, and the
+	 * other searches are updated for it. */
+	n_words = dict_size(ps->dict);
+	TEST_ASSERT(reload = ps_reload_init(ps));
+	TEST_EQUAL(0, ps_reload_load_dict(reload, DATADIR "/turtle.dic",
+					  NULL, NULL));
+	TEST_EQUAL(0, ps_reload_set_lm_file(reload, "turtle",
+					    DATADIR "/turtle.lm.bin"));
+	TEST_EQUAL(0, ps_reload_commit(reload));
+	decode(ps, "go forward ten meters");
+	printf("%d words, was %d\n", dict_size(ps->dict), n_words);
+	TEST_ASSERT(dict_size(ps->dict) < n_words);
+	TEST_EQUAL(0, ps_set_search(ps, "turtle"));
+	decode(ps, "go forward ten meters");
+	TEST_EQUAL(0, ps_set_search(ps, "jsgf"));
+	decode(ps, "go forward ten meters");
+
+	/* Uncommitted reloads can be freed, committed ones are freed
+	 * with the decoder. */
+	TEST_ASSERT(reload = ps_reload_init(ps));
+	TEST_EQUAL(0, ps_reload_set_lm_file(reload, "turtle",
+					    DATADIR "/turtle.lm.bin"));
+	ps_reload_free(reload);
+	TEST_ASSERT(reload = ps_reload_init(ps));
+	TEST_EQUAL(0, ps_reload_set_lm_file(reload, "turtle",
+					    DATADIR "/turtle.lm.bin"));
+	TEST_EQUAL(0, ps_reload_commit(reload));
+
+	ps_free(ps);
+	cmd_ln_free_r(config);
+
+	return 0;
+}
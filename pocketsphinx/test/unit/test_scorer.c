@@ -0,0 +1,240 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "acmod.h"
+#include "ext_mgau.h"
+#include "test_macros.h"
+
+#define CONTEXT 1
+#define N_HID 16
+
+/* A small neural network: one hidden layer of rectified units. */
+typedef struct toy_mlp_s {
+	int in_dim, n_sen;
+	float32 *w1, *w2, *hid;
+	int n_call, n_frame;
+} toy_mlp_t;
+
+static float32
+weight(uint32 *seed)
+{
+	*seed = *seed * 1103515245 + 12345;
+	return ((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+static toy_mlp_t *
+toy_mlp_init(int in_dim, int n_sen)
+{
+	toy_mlp_t *mlp = ckd_calloc(1, sizeof(*mlp));
+	uint32 seed = 42;
+	int i;
+
+	mlp->in_dim = in_dim;
+	mlp->n_sen = n_sen;
+	mlp->w1 = ckd_calloc(N_HID * in_dim, sizeof(*mlp->w1));
+	mlp->w2 = ckd_calloc(n_sen * N_HID, sizeof(*mlp->w2));
+	for (i = 0; i < N_HID * in_dim; ++i)
+		mlp->w1[i] = weight(&seed) * 0.05;
+	for (i = 0; i < n_sen * N_HID; ++i)
+		mlp->w2[i] = weight(&seed);
+	return mlp;
+}
+
+/* Each layer is a product of the frames by the weights. */
+static int
+toy_mlp_score(void *data, float32 const *in, int n_frame, int in_dim,
+	      float32 *out, int n_sen)
+{
+	toy_mlp_t *mlp = data;
+	int i, j, k;
+
+	TEST_EQUAL(mlp->in_dim, in_dim);
+	TEST_EQUAL(mlp->n_sen, n_sen);
+	mlp->hid = ckd_realloc(mlp->hid, n_frame * N_HID * sizeof(*mlp->hid));
+	for (i = 0; i < n_frame; ++i) {
+		for (j = 0; j < N_HID; ++j) {
+			float32 h = 0;
+			for (k = 0; k < in_dim; ++k)
+				h += in[i * in_dim + k] * mlp->w1[j * in_dim + k];
+			mlp->hid[i * N_HID + j] = h > 0 ? h : 0;
+		}
+		for (j = 0; j < n_sen; ++j) {
+			float32 o = 0;
+			for (k = 0; k < N_HID; ++k)
+				o += mlp->hid[i * N_HID + k] * mlp->w2[j * N_HID + k];
+			out[i * n_sen + j] = o;
+		}
+	}
+	++mlp->n_call;
+	mlp->n_frame += n_frame;
+	return 0;
+}
+
+static void
+toy_mlp_free(void *data)
+{
+	toy_mlp_t *mlp = data;
+
+	ckd_free(mlp->w1);
+	ckd_free(mlp->w2);
+	ckd_free(mlp->hid);
+	ckd_free(mlp);
+}
+
+static ps_scorer_funcs_t toy_mlp_funcs = {
+	"toy_mlp",
+	toy_mlp_score,
+	toy_mlp_free
+};
+
+static ps_decoder_t *
+init_decoder(int batch, int lookahead, toy_mlp_t **out_mlp)
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps;
+	toy_mlp_t *mlp;
+	int featlen;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-fsg", DATADIR "/goforward.fsg",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	cmd_ln_free_r(config);
+	featlen = feat_dimension(ps_get_feat(ps));
+	mlp = toy_mlp_init((2 * CONTEXT + 1) * featlen,
+			   bin_mdef_n_sen(ps->acmod->mdef));
+	TEST_EQUAL(0, ps_set_scorer(ps, &toy_mlp_funcs, mlp,
+				    CONTEXT, batch, lookahead));
+	TEST_EQUAL(0, strcmp(ps->acmod->mgau->vt->name, "external"));
+	*out_mlp = mlp;
+	return ps;
+}
+
+static char *
+decode(ps_decoder_t *ps, int32 *out_score)
+{
+	FILE *rawfh;
+	char const *hyp;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	TEST_ASSERT(ps_decode_raw(ps, rawfh, -1) > 0);
+	fclose(rawfh);
+	hyp = ps_get_hyp(ps, out_score);
+	printf("%s (%d)\n", hyp ? hyp : "(null)", *out_score);
+	return ckd_salloc(hyp ? hyp : "");
+}
+
+/* Score one frame the slow way, from the features in the buffer. */
+static void
+ref_score(acmod_t *acmod, toy_mlp_t *mlp, int frame, int16 *senscr)
+{
+	ext_mgau_t *s = (ext_mgau_t *)acmod->mgau;
+	int n_frame = acmod->output_frame + acmod->n_feat_frame;
+	float32 *in, *out, best;
+	int j, k, f;
+
+	in = ckd_calloc(mlp->in_dim, sizeof(*in));
+	out = ckd_calloc(mlp->n_sen, sizeof(*out));
+	for (j = 0; j < 2 * CONTEXT + 1; ++j) {
+		mfcc_t **feat;
+
+		f = frame + j - CONTEXT;
+		if (f < 0)
+			f = 0;
+		if (f >= n_frame)
+			f = n_frame - 1;
+		TEST_ASSERT(feat = acmod_get_frame(acmod, &f));
+		for (k = 0; k < s->featlen; ++k)
+			in[j * s->featlen + k] = MFCC2FLOAT(feat[0][k]);
+	}
+	toy_mlp_score(mlp, in, 1, mlp->in_dim, out, mlp->n_sen);
+	best = out[0];
+	for (k = 1; k < mlp->n_sen; ++k)
+		if (out[k] > best)
+			best = out[k];
+	for (k = 0; k < mlp->n_sen; ++k) {
+		float64 scr = (best - out[k]) * s->scale + 0.5;
+		senscr[k] = scr > 32767 ? 32767 : (int16)scr;
+	}
+	ckd_free(in);
+	ckd_free(out);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	toy_mlp_t *mlp;
+	char *hyp, *ref_hyp;
+	int32 score, ref_path;
+	int16 *senscr, *ref;
+	int n_sen, n_frame, i, k;
+
+	/* One frame at a time. */
+	ps = init_decoder(1, FALSE, &mlp);
+	ref_hyp = decode(ps, &ref_path);
+	TEST_EQUAL(mlp->n_call, mlp->n_frame);
+	n_frame = mlp->n_frame;
+	TEST_ASSERT(n_frame > 0);
+
+	/* Each frame is spliced with its neighbours and scored relative
+	 * to the best senone. */
+	n_sen = bin_mdef_n_sen(ps->acmod->mdef);
+	senscr = ckd_calloc(n_sen, sizeof(*senscr));
+	ref = ckd_calloc(n_sen, sizeof(*ref));
+	for (i = 0; i < n_frame; i += 37) {
+		int best = n_sen;
+		TEST_EQUAL(0, ps_mgau_frame_eval(ps->acmod->mgau, senscr,
+						 NULL, 0, NULL, i, TRUE));
+		ref_score(ps->acmod, mlp, i, ref);
+		for (k = 0; k < n_sen; ++k) {
+			TEST_EQUAL(ref[k], senscr[k]);
+			if (senscr[k] == 0)
+				best = k;
+		}
+		TEST_ASSERT(best < n_sen);
+	}
+	ckd_free(senscr);
+	ckd_free(ref);
+	ps_free(ps);
+
+	/* In batches, the scores, and so the result, are the same. */
+	ps = init_decoder(8, FALSE, &mlp);
+	hyp = decode(ps, &score);
+	TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+	TEST_EQUAL(ref_path, score);
+	TEST_EQUAL(n_frame, mlp->n_frame);
+	printf("%d frames in %d calls\n", mlp->n_frame, mlp->n_call);
+	TEST_ASSERT(mlp->n_call < n_frame / 2);
+	ckd_free(hyp);
+
+	/* As they are for a second utterance. */
+	mlp->n_frame = 0;
+	hyp = decode(ps, &score);
+	TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+	TEST_EQUAL(ref_path, score);
+	TEST_EQUAL(n_frame, mlp->n_frame);
+	ckd_free(hyp);
+	ps_free(ps);
+
+	/* And with the next batch scored in another thread. */
+	ps = init_decoder(8, TRUE, &mlp);
+	for (i = 0; i < 2; ++i) {
+		mlp->n_frame = 0;
+		hyp = decode(ps, &score);
+		TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+		TEST_EQUAL(ref_path, score);
+		/* Frames scored ahead are not thrown away. */
+		TEST_EQUAL(n_frame, mlp->n_frame);
+		ckd_free(hyp);
+	}
+	ps_free(ps);
+
+	ckd_free(ref_hyp);
+	return 0;
+}
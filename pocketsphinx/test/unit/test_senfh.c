@@ -83,6 +83,62 @@ main(int argc, char *argv[])
                              ngram_search_find_exit(ngs, -1, NULL))));
         fclose(senfh);
     }
+    {
+        /* Scores come back within half a quantization step of the
+         * best one, for all senones or just the active ones. */
+        int n_sen = bin_mdef_n_sen(acmod->mdef);
+        int16 *scores = ckd_calloc(n_sen, sizeof(*scores));
+        uint8 *active = ckd_calloc(n_sen, sizeof(*active));
+        FILE *senfh;
+        int i, n_active, last;
+
+        for (i = 0; i < n_sen; ++i)
+            scores[i] = -20 + (i * 37) % 700;
+        scores[n_sen - 1] = 30000;
+        /* Every third senone, then one far enough away to need a
+         * bridging entry. */
+        for (n_active = 0; n_active * 3 < n_sen - 600; ++n_active)
+            active[n_active] = n_active ? 3 : 0;
+        last = (n_active - 1) * 3;
+        active[n_active++] = 255;
+        active[n_active++] = 255;
+        active[n_active++] = 0;
+
+        TEST_ASSERT(senfh = tmpfile());
+        TEST_EQUAL(0, acmod_write_senfh_header(acmod, senfh));
+        TEST_EQUAL(0, acmod_write_scores(acmod, n_sen, NULL, scores, senfh));
+        TEST_EQUAL(0, acmod_write_scores(acmod, n_active, active,
+                                         scores, senfh));
+        rewind(senfh);
+        TEST_EQUAL(0, acmod_start_utt(acmod));
+        TEST_EQUAL(0, acmod_set_insenfh(acmod, senfh));
+        TEST_EQUAL(1, acmod_read_scores(acmod));
+        TEST_EQUAL(n_sen, acmod->n_senone_active);
+        for (i = 0; i < n_sen - 1; ++i)
+            TEST_ASSERT(abs(acmod->senone_scores[i] - scores[i]) <= 2);
+        /* Far off the best, scores saturate. */
+        TEST_ASSERT(acmod->senone_scores[n_sen - 1] < scores[n_sen - 1]);
+        TEST_ASSERT(acmod->senone_scores[n_sen - 1] >= 1000);
+
+        TEST_EQUAL(1, acmod_read_scores(acmod));
+        TEST_EQUAL(n_active, acmod->n_senone_active);
+        TEST_EQUAL(0, memcmp(active, acmod->senone_active, n_active));
+        for (i = 0; i < n_sen; ++i) {
+            if ((i % 3 == 0 && i <= last)
+                || i == last + 255 || i == last + 510) {
+                TEST_ASSERT(abs(acmod->senone_scores[i] - scores[i]) <= 2);
+            }
+            else {
+                TEST_EQUAL(SENSCR_DUMMY, acmod->senone_scores[i]);
+            }
+        }
+        TEST_EQUAL(0, acmod_read_scores(acmod));
+        TEST_ASSERT(acmod_end_utt(acmod) >= 0);
+        TEST_EQUAL(0, acmod_set_insenfh(acmod, NULL));
+        fclose(senfh);
+        ckd_free(scores);
+        ckd_free(active);
+    }
     ps_free(ps);
     cmd_ln_free_r(config);
 
@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <sphinxbase/logmath.h>
+#include <sphinxbase/ckd_alloc.h>
+
+#include "hmm.h"
+#include "tied_mgau_common.h"
+#include "test_macros.h"
+
+#define MAX_TOPN 8
+#define MAX_RUN 70
+
+static uint32 rnd = 42;
+
+static int
+randi(int n)
+{
+	rnd = rnd * 1103515245 + 12345;
+	return (rnd >> 16) % n;
+}
+
+/* The vectorized senone scoring must give exactly the same scores as
+ * the reference code, for any number of codewords and senones. */
+static void
+test_sum(float64 base)
+{
+	logmath_t *lmath;
+	tied_logadd_t la;
+	uint8 *mixw[MAX_TOPN];
+	int32 ascr[MAX_TOPN];
+	int16 ref[MAX_RUN], out[MAX_RUN];
+	int topn, n, t, i, k;
+
+	TEST_ASSERT(lmath = logmath_init(base, SENSCR_SHIFT, TRUE));
+	tied_logadd_init(&la, lmath);
+	printf("base %f: %s, %d thresholds\n", base, la.backend, la.n_thresh);
+	for (k = 0; k < MAX_TOPN; ++k)
+		mixw[k] = ckd_calloc(MAX_RUN, sizeof(**mixw));
+	for (t = 0; t < 200; ++t) {
+		topn = 1 + randi(MAX_TOPN);
+		n = 1 + randi(MAX_RUN);
+		for (k = 0; k < topn; ++k) {
+			/* Scores close together exercise the log-add.  They
+			 * are kept far enough inside the table that the
+			 * reference code never looks past its end. */
+			ascr[k] = randi(t % 2 ? 20 : 50);
+			for (i = 0; i < n; ++i)
+				mixw[k][i] = randi(MAX_NEG_MIXW - 9);
+		}
+		for (i = 0; i < n; ++i)
+			ref[i] = out[i] = randi(1000);
+		tied_senone_sum_ref(&la, (uint8 const **)mixw, ascr, topn, ref, n);
+		tied_senone_sum(&la, (uint8 const **)mixw, ascr, topn, out, n);
+		for (i = 0; i < n; ++i)
+			TEST_EQUAL(ref[i], out[i]);
+	}
+	for (k = 0; k < MAX_TOPN; ++k)
+		ckd_free(mixw[k]);
+	logmath_free(lmath);
+}
+
+int
+main(int argc, char *argv[])
+{
+	test_sum(1.0001);
+	test_sum(1.0003);
+	test_sum(1.001);
+	return 0;
+}
@@ -0,0 +1,68 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+/* Decode with a score cache of the given size. */
+static char *
+decode(char const *hmmdir, char const *lm, char const *dict,
+       char const *raw, char const *samprate, char const *cache,
+       int32 *out_score)
+{
+	ps_decoder_t *ps;
+	char *hyp;
+
+	ps = ps_test_init(hmmdir, dict,
+			  "-lm", lm,
+			  "-senscrcache", cache,
+			  "-samprate", samprate, NULL);
+	TEST_EQUAL(atoi(cache), ps->acmod->n_senscr_cache);
+	printf("cache %s\n", cache);
+	hyp = ps_test_decode(ps, raw, out_score);
+	ps_free(ps);
+	return hyp;
+}
+
+/* Scores from the cache are normalized as the model would have done,
+ * so the results are the same as without it, whether it holds all the
+ * frames that are scored again or only a few. */
+static void
+test_decode(char const *hmmdir, char const *lm, char const *dict,
+	    char const *raw, char const *samprate)
+{
+	char *hyp, *hyp2;
+	int32 score, score2;
+
+	hyp = decode(hmmdir, lm, dict, raw, samprate, "0", &score);
+	hyp2 = decode(hmmdir, lm, dict, raw, samprate, "3", &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	hyp2 = decode(hmmdir, lm, dict, raw, samprate, "1000", &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+	ckd_free(hyp);
+}
+
+int
+main(int argc, char *argv[])
+{
+	test_decode(DATADIR "/an4_ci_cont",
+		    DATADIR "/turtle.lm.bin",
+		    DATADIR "/turtle.dic",
+		    DATADIR "/goforward.raw", "16000");
+	test_decode(DATADIR "/tidigits/hmm",
+		    DATADIR "/tidigits/lm/tidigits.lm.bin",
+		    DATADIR "/tidigits/lm/tidigits.dic",
+		    DATADIR "/tidigits/dhd.2934z.raw", "8000");
+	test_decode(MODELDIR "/en-us/en-us",
+		    DATADIR "/turtle.lm.bin",
+		    DATADIR "/turtle.dic",
+		    DATADIR "/goforward.raw", "16000");
+	return 0;
+}
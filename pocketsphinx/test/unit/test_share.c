@@ -0,0 +1,155 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "ms_mgau.h"
+#include "ngram_search.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+static cmd_ln_t *
+config_init(char const *hmmdir, char const *lm, char const *dict,
+	    char const *samprate, char const *mllr)
+{
+	cmd_ln_t *config;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-lm", lm,
+				"-dict", dict,
+				"-samprate", samprate, NULL));
+	if (hmmdir)
+		cmd_ln_set_str_r(config, "-hmm", hmmdir);
+	if (mllr)
+		cmd_ln_set_str_r(config, "-mllr", mllr);
+	return config;
+}
+
+/* A decoder sharing the acoustic model of another must give the same
+ * results, and keep working once the other one is gone.  Live CMN
+ * carries over from one utterance to the next, so the second one is
+ * compared separately. */
+static void
+test_share(char const *hmmdir, char const *lm, char const *dict,
+	   char const *raw, char const *samprate, char const *mgau)
+{
+	cmd_ln_t *config, *config2;
+	ps_decoder_t *ps, *ps2;
+	char *hyp, *hyp2, *hyp_next;
+	int32 score, score2, score_next;
+
+	config = config_init(hmmdir, lm, dict, samprate, NULL);
+	TEST_ASSERT(ps = ps_init(config));
+	TEST_EQUAL(0, strcmp(ps->acmod->mgau->vt->name, mgau));
+	hyp = ps_test_decode(ps, raw, &score);
+	hyp_next = ps_test_decode(ps, raw, &score_next);
+
+	/* The acoustic model directory comes from the shared decoder. */
+	config2 = config_init(NULL, lm, dict, samprate, NULL);
+	TEST_ASSERT(ps2 = ps_init_shared(config2, ps));
+	TEST_EQUAL(0, strcmp(ps2->acmod->mgau->vt->name, mgau));
+	TEST_ASSERT(ps2->acmod->mdef == ps->acmod->mdef);
+	TEST_ASSERT(ps2->acmod->tmat == ps->acmod->tmat);
+	TEST_ASSERT(ps2->acmod->mgau != ps->acmod->mgau);
+	/* Each has its own log-math, since lattices retain it. */
+	TEST_ASSERT(ps2->lmath != ps->lmath);
+	TEST_EQUAL(logmath_get_base(ps2->lmath), logmath_get_base(ps->lmath));
+	TEST_EQUAL(logmath_get_shift(ps2->lmath), logmath_get_shift(ps->lmath));
+	/* So does the search tree, since the dictionary and LM are the same. */
+	TEST_ASSERT(((ngram_search_t *)ps2->search)->lextree
+		    == ((ngram_search_t *)ps->search)->lextree);
+	hyp2 = ps_test_decode(ps2, raw, &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+
+	ps_free(ps);
+	cmd_ln_free_r(config);
+	hyp2 = ps_test_decode(ps2, raw, &score2);
+	TEST_EQUAL(0, strcmp(hyp_next, hyp2));
+	TEST_EQUAL(score_next, score2);
+	ckd_free(hyp2);
+	ckd_free(hyp_next);
+	ckd_free(hyp);
+	ps_free(ps2);
+	cmd_ln_free_r(config2);
+}
+
+/* Decode with a new decoder loaded from config. */
+static char *
+decode_ref(cmd_ln_t *config, int32 *out_score)
+{
+	ps_decoder_t *ps;
+	char *hyp;
+
+	TEST_ASSERT(ps = ps_init(config));
+	hyp = ps_test_decode(ps, DATADIR "/goforward.raw", out_score);
+	ps_free(ps);
+	return hyp;
+}
+
+/* Adapting one decoder must not affect the one it shares with. */
+static void
+test_mllr(void)
+{
+	cmd_ln_t *config, *config2, *config3;
+	ps_decoder_t *ps, *ps2;
+	char *hyp, *hyp2;
+	int32 score, score2;
+
+	config = config_init(DATADIR "/an4_ci_cont", DATADIR "/turtle.lm.bin",
+			     DATADIR "/turtle.dic", "16000", NULL);
+	TEST_ASSERT(ps = ps_init(config));
+	config2 = config_init(NULL, DATADIR "/turtle.lm.bin",
+			      DATADIR "/turtle.dic", "16000", NULL);
+	TEST_ASSERT(ps2 = ps_init_shared(config2, ps));
+	TEST_ASSERT(((ms_mgau_model_t *)ps->acmod->mgau)->g
+		    == ((ms_mgau_model_t *)ps2->acmod->mgau)->g);
+
+	TEST_ASSERT(ps_update_mllr(ps2, ps_mllr_read(DATADIR "/mllr_matrices")));
+	TEST_ASSERT(((ms_mgau_model_t *)ps->acmod->mgau)->g
+		    != ((ms_mgau_model_t *)ps2->acmod->mgau)->g);
+	hyp = decode_ref(config, &score);
+	hyp2 = ps_test_decode(ps, DATADIR "/goforward.raw", &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp);
+	ckd_free(hyp2);
+
+	/* The adapted one is the same as one loaded with -mllr. */
+	config3 = config_init(DATADIR "/an4_ci_cont", DATADIR "/turtle.lm.bin",
+			      DATADIR "/turtle.dic", "16000",
+			      DATADIR "/mllr_matrices");
+	hyp = decode_ref(config3, &score);
+	hyp2 = ps_test_decode(ps2, DATADIR "/goforward.raw", &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp);
+	ckd_free(hyp2);
+
+	ps_free(ps2);
+	ps_free(ps);
+	cmd_ln_free_r(config3);
+	cmd_ln_free_r(config2);
+	cmd_ln_free_r(config);
+}
+
+int
+main(int argc, char *argv[])
+{
+	test_share(DATADIR "/an4_ci_cont",
+		   DATADIR "/turtle.lm.bin",
+		   DATADIR "/turtle.dic",
+		   DATADIR "/goforward.raw", "16000", "ms");
+	test_share(DATADIR "/tidigits/hmm",
+		   DATADIR "/tidigits/lm/tidigits.lm.bin",
+		   DATADIR "/tidigits/lm/tidigits.dic",
+		   DATADIR "/tidigits/dhd.2934z.raw", "8000", "s2_semi");
+	test_share(MODELDIR "/en-us/en-us",
+		   DATADIR "/turtle.lm.bin",
+		   DATADIR "/turtle.dic",
+		   DATADIR "/goforward.raw", "16000", "ptm");
+	test_mllr();
+	return 0;
+}
@@ -0,0 +1,168 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "test_macros.h"
+
+/* Quiet noise, which the voice activity detector takes as silence. */
+static size_t
+add_silence(int16 *buf, size_t n, size_t n_samples)
+{
+	size_t i;
+
+	for (i = 0; i < n_samples; ++i)
+		buf[n + i] = rand() % 5 - 2;
+	return n + n_samples;
+}
+
+/* The recording up to its end, or to max_samples. */
+static size_t
+add_speech(int16 *buf, size_t n, size_t max_samples)
+{
+	FILE *rawfh;
+	size_t nread;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	nread = fread(buf + n, sizeof(*buf), max_samples, rawfh);
+	fclose(rawfh);
+	return n + nread;
+}
+
+static ps_decoder_t *
+init_decoder(char const *specfinal, char const *search, char const *arg,
+	     char const *pipeline)
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				search, arg,
+				"-specfinal", specfinal,
+				"-pipeline", pipeline,
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	cmd_ln_free_r(config);
+	TEST_EQUAL(atoi(specfinal) > 0, ps->spec != NULL);
+	return ps;
+}
+
+/* Decode like pocketsphinx_continuous, ending the utterance when the
+ * speech ends. */
+static char *
+decode(ps_decoder_t *ps, int16 const *buf, size_t n, int *out_n_frames,
+       int *out_sf)
+{
+	char const *hyp;
+	ps_seg_t *seg;
+	size_t i;
+	int in_speech = FALSE;
+	int32 score;
+
+	TEST_EQUAL(0, ps_start_utt(ps));
+	for (i = 0; i < n; i += 512) {
+		TEST_ASSERT(ps_process_raw(ps, buf + i, n - i < 512 ? n - i : 512,
+					   FALSE, FALSE) >= 0);
+		if (ps_get_in_speech(ps))
+			in_speech = TRUE;
+		else if (in_speech)
+			break;
+	}
+	TEST_ASSERT(i < n);
+	TEST_EQUAL(0, ps_end_utt(ps));
+	*out_n_frames = ps_get_n_frames(ps);
+	hyp = ps_get_hyp(ps, &score);
+	TEST_ASSERT(hyp);
+	printf("%s (%d) %d frames:", hyp, score, *out_n_frames);
+	*out_sf = -1;
+	for (seg = ps_seg_iter(ps); seg; seg = ps_seg_next(seg)) {
+		int sf, ef;
+		ps_seg_frames(seg, &sf, &ef);
+		if (*out_sf == -1)
+			*out_sf = sf;
+		printf(" %s %d-%d", ps_seg_word(seg), sf, ef);
+	}
+	printf("\n");
+	return ckd_salloc(hyp);
+}
+
+static void
+test_same(char const *search, char const *arg, char const *pipeline,
+	  int16 const *buf, size_t n)
+{
+	ps_decoder_t *ref, *ps;
+	char *ref_hyp, *hyp;
+	int ref_n_frames, n_frames, ref_sf, sf, i;
+
+	ref = init_decoder("0", search, arg, pipeline);
+	ps = init_decoder("20", search, arg, pipeline);
+	/* More than once, with the clone made for the first.  The stream
+	 * goes on from one utterance to the next, so the reference does
+	 * the same. */
+	for (i = 0; i < 2; ++i) {
+		ref_hyp = decode(ref, buf, n, &ref_n_frames, &ref_sf);
+		hyp = decode(ps, buf, n, &n_frames, &sf);
+		TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+		/* In the same place in the stream. */
+		TEST_EQUAL(ref_sf, sf);
+		/* The result was found in the silence. */
+		TEST_ASSERT(ps_spec_result(ps->spec) != NULL);
+		/* All of which is still counted. */
+		TEST_EQUAL(ref_n_frames, n_frames);
+		ckd_free(ref_hyp);
+		ckd_free(hyp);
+	}
+	ps_free(ref);
+	ps_free(ps);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	int16 *buf;
+	size_t n;
+	char *hyp;
+	int n_frames, sf;
+
+	buf = ckd_calloc(500000, sizeof(*buf));
+	n = add_silence(buf, 0, 8000);
+	n = add_speech(buf, n, 200000);
+	n = add_silence(buf, n, 32000);
+
+	/* The search in the silence finds the same words. */
+	test_same("-lm", MODELDIR "/en-us/en-us.lm.bin", "0", buf, n);
+	test_same("-fsg", DATADIR "/goforward.fsg", "0", buf, n);
+	/* As it does from scores computed in another thread. */
+	test_same("-lm", MODELDIR "/en-us/en-us.lm.bin", "4", buf, n);
+
+	/* When speech comes back after a pause, too short for the voice
+	 * activity detector to end the utterance, the search started in
+	 * it is not used. */
+	n = add_silence(buf, 0, 8000);
+	n = add_speech(buf, n, 33600);
+	n = add_silence(buf, n, 3200);
+	n = add_speech(buf, n, 200000);
+	n = add_silence(buf, n, 32000);
+	test_same("-lm", MODELDIR "/en-us/en-us.lm.bin", "0", buf, n);
+
+	/* Nor after the decoder changes. */
+	ps = init_decoder("20", "-lm", MODELDIR "/en-us/en-us.lm.bin", "0");
+	hyp = decode(ps, buf, n, &n_frames, &sf);
+	ckd_free(hyp);
+	TEST_ASSERT(ps_spec_result(ps->spec) != NULL);
+	TEST_ASSERT(ps_add_word(ps, "foobie", "F UW B IY", TRUE) >= 0);
+	TEST_ASSERT(ps_spec_result(ps->spec) == NULL);
+	hyp = decode(ps, buf, n, &n_frames, &sf);
+	TEST_EQUAL(0, strcmp("go forward ten meters go forward ten meters", hyp));
+	TEST_ASSERT(ps_spec_result(ps->spec) != NULL);
+	ckd_free(hyp);
+	ps_free(ps);
+
+	ckd_free(buf);
+	return 0;
+}
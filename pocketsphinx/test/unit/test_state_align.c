@@ -70,6 +70,14 @@ main(int argc, char *argv[])
     for (i = 0; i < 5; i++)
         do_search(search, acmod);
 
+    /* Only states near the best path keep backpointers. */
+    {
+        state_align_search_t *sas = (state_align_search_t *)search;
+        printf("%d tokens for %d frames of %d states\n", sas->n_tokens,
+               sas->frame + 1, sas->n_emit_state);
+        TEST_ASSERT(sas->n_tokens < (sas->frame + 1) * sas->n_emit_state / 2);
+    }
+
     itor = ps_alignment_words(al);
     TEST_EQUAL(ps_alignment_iter_get(itor)->start, 0);
     TEST_EQUAL(ps_alignment_iter_get(itor)->duration, 8);
@@ -0,0 +1,82 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_macros.h"
+
+static void
+decode(ps_decoder_t *ps, ps_stats_t *utt, ps_stats_t *all)
+{
+	FILE *rawfh;
+	int i;
+
+	TEST_ASSERT(rawfh = fopen(DATADIR "/goforward.raw", "rb"));
+	ps_decode_raw(ps, rawfh, -1);
+	fclose(rawfh);
+	TEST_EQUAL(0, strcmp(ps_get_hyp(ps, NULL), "go forward ten meters"));
+	ps_get_stats(ps, utt, all);
+	printf("%d frames %d senones %d hmms %d lm %d bp\n",
+	       utt->n_frame, utt->n_senone_active, utt->n_hmm_eval,
+	       utt->n_lm_query, utt->n_bp);
+	for (i = 0; i < PS_N_STAGES; ++i)
+		printf("stage %d: %.3f CPU %.3f wall\n", i,
+		       utt->cpu[i], utt->wall[i]);
+	TEST_ASSERT(utt->n_frame > 0);
+	TEST_ASSERT(utt->n_senone_active > 0);
+	TEST_ASSERT(utt->n_hmm_eval > 0);
+	TEST_ASSERT(utt->n_lm_query > 0);
+	TEST_ASSERT(utt->n_bp > 0);
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	cmd_ln_t *config;
+	ps_stats_t utt, utt2, all;
+	int i;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", MODELDIR "/en-us/en-us",
+				"-lm", MODELDIR "/en-us/en-us.lm.bin",
+				"-dict", MODELDIR "/en-us/cmudict-en-us.dict",
+				"-cmninit", "41.00,-5.29,-0.12,5.09,2.48,-4.07,-1.37,-1.78,-5.08,-2.05,-6.45,-1.42,1.17",
+				"-cmn", "batch",
+				"-samprate", "16000", NULL));
+
+	/* Without -stagetime there are counts but no times. */
+	TEST_ASSERT(ps = ps_init(config));
+	decode(ps, &utt, &all);
+	TEST_EQUAL(0, memcmp(&utt, &all, sizeof(utt)));
+	for (i = 0; i < PS_N_STAGES; ++i) {
+		TEST_EQUAL(0.0, utt.cpu[i]);
+		TEST_EQUAL(0.0, utt.wall[i]);
+	}
+	ps_free(ps);
+
+	/* With it, the same counts, and times for every stage. */
+	cmd_ln_set_boolean_r(config, "-stagetime", TRUE);
+	TEST_ASSERT(ps = ps_init(config));
+	decode(ps, &utt2, &all);
+	TEST_EQUAL(utt.n_frame, utt2.n_frame);
+	TEST_EQUAL(utt.n_senone_active, utt2.n_senone_active);
+	TEST_EQUAL(utt.n_hmm_eval, utt2.n_hmm_eval);
+	TEST_EQUAL(utt.n_lm_query, utt2.n_lm_query);
+	TEST_EQUAL(utt.n_bp, utt2.n_bp);
+	for (i = 0; i < PS_N_STAGES; ++i)
+		TEST_ASSERT(utt2.wall[i] > 0.0);
+
+	/* Totals accumulate over utterances. */
+	decode(ps, &utt, &all);
+	TEST_EQUAL(utt.n_frame + utt2.n_frame, all.n_frame);
+	TEST_EQUAL(utt.n_senone_active + utt2.n_senone_active,
+		   all.n_senone_active);
+	TEST_EQUAL(utt.n_bp + utt2.n_bp, all.n_bp);
+	for (i = 0; i < PS_N_STAGES; ++i)
+		TEST_ASSERT(all.wall[i] >= utt.wall[i] + utt2.wall[i] - 1e-6);
+	ps_free(ps);
+
+	cmd_ln_free_r(config);
+	return 0;
+}
@@ -0,0 +1,156 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "subvq_mgau.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+#define VQSIZE 20
+
+static uint32 rnd = 42;
+
+static double
+randf(double lo, double hi)
+{
+	rnd = rnd * 1103515245 + 12345;
+	return lo + (hi - lo) * ((rnd >> 16) % 10000) / 10000.0;
+}
+
+/* Write a sub-vector quantized model for an4_ci_cont, in the format
+ * of sphinx3_gausubvq, with made-up codewords. */
+static void
+write_subvq(char const *file)
+{
+	static const int svlen[] = { 13, 13, 13 };
+	logmath_t *lmath;
+	gauden_t *g;
+	FILE *fh;
+	int sv, cw, i, m, d, dim;
+
+	lmath = logmath_init(1.0001, 0, 0);
+	TEST_ASSERT(g = gauden_init(DATADIR "/an4_ci_cont/means",
+				    DATADIR "/an4_ci_cont/variances",
+				    0.0001, lmath));
+	TEST_ASSERT(fh = fopen(file, "w"));
+	fprintf(fh, "VQParam %d %d -> %d %d\n",
+		g->n_mgau, g->n_density, 3, VQSIZE);
+	for (dim = sv = 0; sv < 3; ++sv) {
+		fprintf(fh, "Subvector %d length %d ", sv, svlen[sv]);
+		for (i = 0; i < svlen[sv]; ++i)
+			fprintf(fh, " %d", dim++);
+		fprintf(fh, "\n");
+	}
+	for (sv = 0; sv < 3; ++sv) {
+		fprintf(fh, "Codebook %d Sqerr 0.0\n", sv);
+		for (cw = 0; cw < VQSIZE; ++cw) {
+			for (i = 0; i < svlen[sv]; ++i)
+				fprintf(fh, " %.4e %.4e", randf(-3, 3), randf(0.05, 2));
+			fprintf(fh, "\n");
+		}
+		fprintf(fh, "Map %d\n", sv);
+		for (m = 0; m < g->n_mgau; ++m) {
+			for (d = 0; d < g->n_density; ++d)
+				fprintf(fh, " %d", (m * g->n_density + d + sv) % VQSIZE);
+			fprintf(fh, "\n");
+		}
+	}
+	fprintf(fh, "End\n");
+	fclose(fh);
+	gauden_free(g);
+	logmath_free(lmath);
+}
+
+/* Decode with or without sub-vector quantization, checking which
+ * model was loaded. */
+static char *
+decode(char const *subvq, char const *beam, int32 *out_score)
+{
+	ps_decoder_t *ps;
+	char *hyp;
+
+	ps = ps_test_init(DATADIR "/an4_ci_cont", DATADIR "/turtle.dic",
+			  "-lm", DATADIR "/turtle.lm.bin",
+			  "-subvq", subvq,
+			  "-subvqbeam", beam,
+			  "-samprate", "16000", NULL);
+	TEST_EQUAL(0, strcmp(ps->acmod->mgau->vt->name, subvq ? "subvq" : "ms"));
+	printf("subvq %s, beam %s\n", subvq ? subvq : "none", beam);
+	hyp = ps_test_decode(ps, DATADIR "/goforward.raw", out_score);
+	ps_free(ps);
+	return hyp;
+}
+
+/* The vectorized codeword evaluation must give exactly the same
+ * scores as the reference code. */
+static void
+test_vq_kernels(char const *subvq)
+{
+	cmd_ln_t *config;
+	ps_decoder_t *ps;
+	subvq_mgau_t *s;
+	mfcc_t *feat, *ref;
+	int t, i, n;
+
+	TEST_ASSERT(config =
+		    cmd_ln_init(NULL, ps_args(), TRUE,
+				"-hmm", DATADIR "/an4_ci_cont",
+				"-lm", DATADIR "/turtle.lm.bin",
+				"-dict", DATADIR "/turtle.dic",
+				"-subvq", subvq,
+				"-samprate", "16000", NULL));
+	TEST_ASSERT(ps = ps_init(config));
+	s = (subvq_mgau_t *)ps->acmod->mgau;
+	printf("Backend: %s\n", s->eval_backend);
+	n = s->n_sv * s->n_vqblock * SUBVQ_BLOCK;
+	feat = ckd_calloc(39, sizeof(*feat));
+	ref = ckd_calloc(n, sizeof(*ref));
+	for (t = 0; t < 20; ++t) {
+		subvq_block_t vq_block = s->vq_block;
+
+		for (i = 0; i < 39; ++i)
+			feat[i] = FLOAT2MFCC(randf(-10, 10));
+		s->vq_block = NULL;
+		subvq_mgau_vq_eval(s, feat);
+		memcpy(ref, s->vqdist, n * sizeof(*ref));
+		s->vq_block = vq_block;
+		subvq_mgau_vq_eval(s, feat);
+		for (i = 0; i < n; ++i)
+			TEST_EQUAL(ref[i], s->vqdist[i]);
+	}
+	ckd_free(feat);
+	ckd_free(ref);
+	ps_free(ps);
+	cmd_ln_free_r(config);
+}
+
+int
+main(int argc, char *argv[])
+{
+	char *hyp, *hyp2;
+	int32 score, score2;
+
+	write_subvq("test_subvq_mgau.subvq");
+	test_vq_kernels("test_subvq_mgau.subvq");
+
+	/* With a wide enough beam, every Gaussian is evaluated, so
+	 * the result is the same as without selection. */
+	hyp = decode(NULL, "1e-300", &score);
+	hyp2 = decode("test_subvq_mgau.subvq", "1e-300", &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp2);
+
+	/* There is only one Gaussian per mixture in this model, and the
+	 * best one is always kept, so a narrow beam gives the same
+	 * result too. */
+	hyp2 = decode("test_subvq_mgau.subvq", "0.5", &score2);
+	TEST_EQUAL(0, strcmp(hyp, hyp2));
+	TEST_EQUAL(score, score2);
+	ckd_free(hyp);
+	ckd_free(hyp2);
+
+	return 0;
+}
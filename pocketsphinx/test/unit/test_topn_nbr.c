@@ -0,0 +1,109 @@
+#include <pocketsphinx.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pocketsphinx_internal.h"
+#include "s2_semi_mgau.h"
+#include "test_macros.h"
+#include "test_ps.c"
+
+#define RAWFILE DATADIR "/tidigits/dhd.2934z.raw"
+
+static ps_decoder_t *
+init_decoder(char const *topn_nbr)
+{
+	ps_decoder_t *ps;
+
+	ps = ps_test_init(DATADIR "/tidigits/hmm",
+			  DATADIR "/tidigits/lm/tidigits.dic",
+			  "-lm", DATADIR "/tidigits/lm/tidigits.lm.bin",
+			  "-topn_nbr", topn_nbr,
+			  "-samprate", "8000", NULL);
+	TEST_EQUAL(0, strcmp(ps->acmod->mgau->vt->name, "s2_semi"));
+	return ps;
+}
+
+/* Weighted distance between two codewords' means. */
+static float64
+cw_dist(gauden_t *g, int f, int a, int b)
+{
+	float64 d = 0;
+	int j;
+
+	for (j = 0; j < g->featlen[f]; ++j) {
+		float64 diff = MFCC2FLOAT(g->mean[0][f][a][j])
+			- MFCC2FLOAT(g->mean[0][f][b][j]);
+		d += diff * diff * ((float64)g->var[0][f][a][j]
+				    + g->var[0][f][b][j]);
+	}
+	return d;
+}
+
+int
+main(int argc, char *argv[])
+{
+	ps_decoder_t *ps;
+	s2_semi_mgau_t *s;
+	char *ref_hyp, *hyp;
+	int32 ref_score, score;
+	int f, a, b, k;
+
+	ps = init_decoder("0");
+	ref_hyp = ps_test_decode(ps, RAWFILE, &ref_score);
+	printf("Whole codebook: %s (%d)\n", ref_hyp, ref_score);
+	s = (s2_semi_mgau_t *)ps->acmod->mgau;
+	TEST_ASSERT(s->cb_nbr == NULL);
+	TEST_EQUAL(0, s->n_cb_full_search);
+	ps_free(ps);
+
+	/* Neighbours are the nearest codewords, nearest first. */
+	ps = init_decoder("32");
+	s = (s2_semi_mgau_t *)ps->acmod->mgau;
+	TEST_EQUAL(32, s->n_cb_nbr);
+	for (f = 0; f < s->g->n_feat; ++f) {
+		for (a = 0; a < s->g->n_density; a += 37) {
+			uint16 const *nbr = s->cb_nbr[f] + a * s->n_cb_nbr;
+			float64 last = cw_dist(s->g, f, a, nbr[s->n_cb_nbr - 1]);
+
+			for (k = 1; k < s->n_cb_nbr; ++k)
+				TEST_ASSERT(cw_dist(s->g, f, a, nbr[k - 1])
+					    <= cw_dist(s->g, f, a, nbr[k]));
+			for (b = 0; b < s->g->n_density; ++b) {
+				for (k = 0; k < s->n_cb_nbr; ++k)
+					if (nbr[k] == b)
+						break;
+				TEST_ASSERT(b != a || k == s->n_cb_nbr);
+				if (k == s->n_cb_nbr && b != a)
+					TEST_ASSERT(cw_dist(s->g, f, a, b) >= last);
+			}
+		}
+	}
+
+	/* Searching from them finds the same result, looking at a small
+	 * part of the codebook on most frames. */
+	hyp = ps_test_decode(ps, RAWFILE, &score);
+	printf("Neighbours: %s (%d)\n", hyp, score);
+	TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+	printf("%d neighbour searches of %d codewords on average, %d full\n",
+	       s->n_cb_nbr_search, s->n_cb_nbr_eval / s->n_cb_nbr_search,
+	       s->n_cb_full_search);
+	TEST_ASSERT(s->n_cb_nbr_search > 4 * s->n_cb_full_search);
+	TEST_ASSERT(s->n_cb_nbr_eval / s->n_cb_nbr_search < s->g->n_density / 3);
+	ckd_free(hyp);
+	ps_free(ps);
+
+	/* With so many that the search would cover most of the codebook,
+	 * it is all scanned, as without them. */
+	ps = init_decoder("1000");
+	s = (s2_semi_mgau_t *)ps->acmod->mgau;
+	TEST_EQUAL(s->g->n_density - 1, s->n_cb_nbr);
+	hyp = ps_test_decode(ps, RAWFILE, &score);
+	TEST_EQUAL(0, strcmp(ref_hyp, hyp));
+	TEST_EQUAL(ref_score, score);
+	TEST_EQUAL(0, s->n_cb_nbr_search);
+	ckd_free(hyp);
+	ps_free(ps);
+
+	ckd_free(ref_hyp);
+	return 0;
+}
@@ -57,9 +57,19 @@
 
 #include <math.h>
 
+/*
+ * LOG(1 + EXP(-d)) rounds to 0 from ADD_TABLE_SIZE on; below that,
+ * Addition_Table has one entry per 1 << ADD_TABLE_SHIFT values of d.
+ * add_table_init() must be called before ADD() or FAST_ADD() is used.
+ */
+#define ADD_TABLE_SIZE	99042
+#define ADD_TABLE_SHIFT	4
+
 extern int16 Addition_Table[];
 extern int32 Table_Size;
 
+void add_table_init (void);
+
 #define BASE		1.0001
 #define LOG_BASE	9.9995e-5
 #define MIN_LOG		-690810000
@@ -78,10 +88,10 @@ extern int32 Table_Size;
 /* tkharris++ for additional overflow check */
 #define ADD(x,y) ((x) > (y) ? \
                   (((y) <= MIN_LOG ||(x)-(y)>=Table_Size ||(x) - +(y)<0) ? \
-		           (x) : Addition_Table[(x) - (y)] + (x))	\
+		           (x) : Addition_Table[((x) - (y)) >> ADD_TABLE_SHIFT] + (x)) \
 		   : \
 		  (((x) <= MIN_LOG ||(y)-(x)>=Table_Size ||(y) - +(x)<0) ? \
-		          (y) : Addition_Table[(y) - (x)] + (y)))
+		          (y) : Addition_Table[((y) - (x)) >> ADD_TABLE_SHIFT] + (y)))
 
 #define FAST_ADD(res, x, y, table, table_size)		\
 {							\
@@ -90,12 +100,12 @@ extern int32 Table_Size;
 		if (_d >= (table_size))			\
 			res = (x);			\
 		else					\
-			res = (table)[_d] + (x);	\
+			res = (table)[_d >> ADD_TABLE_SHIFT] + (x); \
 	} else { /* x < y */				\
 		if (-_d >= (table_size))		\
 			res = (y);			\
 		else					\
-			res = (table)[-_d] + (y);	\
+			res = (table)[-_d >> ADD_TABLE_SHIFT] + (y); \
 	}						\
 }
 
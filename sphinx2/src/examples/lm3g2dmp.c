@@ -1633,6 +1633,7 @@ static void lm_set_param (lm_t *model, double lw, double uw, double wip, int32 w
     int16 *at = Addition_Table;
     int32 ts = Table_Size;
 
+    add_table_init ();
     model->lw = lw;
     model->invlw = 1.0/lw;
     model->uw = uw;
@@ -48,99049 +48,34 @@
  * 		Created from Fil Alleva's original.
  */
 
+
+#include <math.h>
+
 #include <s2types.h>
+#include "log.h"
+
+/*
+ * Addition_Table[d >> ADD_TABLE_SHIFT] = LOG(1 + EXP(-d)), for
+ * 0 <= d < Table_Size, beyond which it rounds to 0.  It used to be
+ * stored here in full (one int16 for every d); it is now computed by
+ * add_table_init(), with each entry covering 1 << ADD_TABLE_SHIFT values
+ * of d.  Entries are taken at the middle of their range, and the slope
+ * of LOG(1 + EXP(-d)) is at most 1/2, so lookups are within
+ * 1 << (ADD_TABLE_SHIFT-2) (plus rounding) of the exact value.
+ */
+int16 Addition_Table[(ADD_TABLE_SIZE >> ADD_TABLE_SHIFT) + 1];
+int32 Table_Size = ADD_TABLE_SIZE;
+
+void add_table_init (void)
+{
+    int32 i, n = (ADD_TABLE_SIZE >> ADD_TABLE_SHIFT) + 1;
+    double d;
 
-short Addition_Table[99042] = { 
-6932,
-6931,
-6931,
-6930,
-6930,
-6929,
-6929,
-6928,
-6928,
-6927,
-6927,
-6926,
-6926,
-6925,
-6925,
-6924,
-6924,
-6923,
-6923,
-6922,
-6922,
-6921,
-6921,
-6920,
-6920,
-6919,
-6919,
-6918,
-6918,
-6917,
-6917,
-6916,
-6916,
-6915,
-6915,
-6914,
-6914,
-6913,
-6913,
-6912,
-6912,
-6911,
-6911,
-6910,
-6910,
-6909,
-6909,
-6908,
-6908,
-6907,
-6907,
-6906,
-6906,
-6905,
-6905,
-6904,
-6904,
-6903,
-6903,
-6902,
-6902,
-6901,
-6901,
-6900,
-6900,
-6899,
-6899,
-6898,
-6898,
-6897,
-6897,
-6896,
-6896,
-6895,
-6895,
-6894,
-6894,
-6893,
-6893,
-6892,
-6892,
-6891,
-6891,
-6890,
-6890,
-6889,
-6889,
-6888,
-6888,
-6887,
-6887,
-6886,
-6886,
-6885,
-6885,
-6884,
-6884,
-6883,
-6883,
-6882,
-6882,
-6881,
-6881,
-6880,
-6880,
-6879,
-6879,
-6878,
-6878,
-6877,
-6877,
-6876,
-6876,
-6875,
-6875,
-6874,
-6874,
-6873,
-6873,
-6872,
-6872,
-6872,
-6871,
-6871,
-6870,
-6870,
-6869,
-6869,
-6868,
-6868,
-6867,
-6867,
-6866,
-6866,
-6865,
-6865,
-6864,
-6864,
-6863,
-6863,
-6862,
-6862,
-6861,
-6861,
-6860,
-6860,
-6859,
-6859,
-6858,
-6858,
-6857,
-6857,
-6856,
-6856,
-6855,
-6855,
-6854,
-6854,
-6853,
-6853,
-6852,
-6852,
-6851,
-6851,
-6850,
-6850,
-6849,
-6849,
-6848,
-6848,
-6847,
-6847,
-6846,
-6846,
-6845,
-6845,
-6844,
-6844,
-6843,
-6843,
-6842,
-6842,
-6841,
-6841,
-6840,
-6840,
-6839,
-6839,
-6838,
-6838,
-6837,
-6837,
-6836,
-6836,
-6835,
-6835,
-6834,
-6834,
-6833,
-6833,
-6832,
-6832,
-6831,
-6831,
-6830,
-6830,
-6829,
-6829,
-6828,
-6828,
-6827,
-6827,
-6826,
-6826,
-6825,
-6825,
-6824,
-6824,
-6823,
-6823,
-6822,
-6822,
-6821,
-6821,
-6820,
-6820,
-6819,
-6819,
-6818,
-6818,
-6817,
-6817,
-6816,
-6816,
-6816,
-6815,
-6815,
-6814,
-6814,
-6813,
-6813,
-6812,
-6812,
-6811,
-6811,
-6810,
-6810,
-6809,
-6809,
-6808,
-6808,
-6807,
-6807,
-6806,
-6806,
-6805,
-6805,
-6804,
-6804,
-6803,
-6803,
-6802,
-6802,
-6801,
-6801,
-6800,
-6800,
-6799,
-6799,
-6798,
-6798,
-6797,
-6797,
-6796,
-6796,
-6795,
-6795,
-6794,
-6794,
-6793,
-6793,
-6792,
-6792,
-6791,
-6791,
-6790,
-6790,
-6789,
-6789,
-6788,
-6788,
-6787,
-6787,
-6786,
-6786,
-6785,
-6785,
-6784,
-6784,
-6783,
-6783,
-6782,
-6782,
-6781,
-6781,
-6780,
-6780,
-6779,
-6779,
-6779,
-6778,
-6778,
-6777,
-6777,
-6776,
-6776,
-6775,
-6775,
-6774,
-6774,
-6773,
-6773,
-6772,
-6772,
-6771,
-6771,
-6770,
-6770,
-6769,
-6769,
-6768,
-6768,
-6767,
-6767,
-6766,
-6766,
-6765,
-6765,
-6764,
-6764,
-6763,
-6763,
-6762,
-6762,
-6761,
-6761,
-6760,
-6760,
-6759,
-6759,
-6758,
-6758,
-6757,
-6757,
-6756,
-6756,
-6755,
-6755,
-6754,
-6754,
-6753,
-6753,
-6752,
-6752,
-6751,
-6751,
-6750,
-6750,
-6750,
-6749,
-6749,
-6748,
-6748,
-6747,
-6747,
-6746,
-6746,
-6745,
-6745,
-6744,
-6744,
-6743,
-6743,
-6742,
-6742,
-6741,
-6741,
-6740,
-6740,
-6739,
-6739,
-6738,
-6738,
-6737,
-6737,
-6736,
-6736,
-6735,
-6735,
-6734,
-6734,
-6733,
-6733,
-6732,
-6732,
-6731,
-6731,
-6730,
-6730,
-6729,
-6729,
-6728,
-6728,
-6727,
-6727,
-6726,
-6726,
-6725,
-6725,
-6725,
-6724,
-6724,
-6723,
-6723,
-6722,
-6722,
-6721,
-6721,
-6720,
-6720,
-6719,
-6719,
-6718,
-6718,
-6717,
-6717,
-6716,
-6716,
-6715,
-6715,
-6714,
-6714,
-6713,
-6713,
-6712,
-6712,
-6711,
-6711,
-6710,
-6710,
-6709,
-6709,
-6708,
-6708,
-6707,
-6707,
-6706,
-6706,
-6705,
-6705,
-6704,
-6704,
-6703,
-6703,
-6703,
-6702,
-6702,
-6701,
-6701,
-6700,
-6700,
-6699,
-6699,
-6698,
-6698,
-6697,
-6697,
-6696,
-6696,
-6695,
-6695,
-6694,
-6694,
-6693,
-6693,
-6692,
-6692,
-6691,
-6691,
-6690,
-6690,
-6689,
-6689,
-6688,
-6688,
-6687,
-6687,
-6686,
-6686,
-6685,
-6685,
-6684,
-6684,
-6683,
-6683,
-6683,
-6682,
-6682,
-6681,
-6681,
-6680,
-6680,
-6679,
-6679,
-6678,
-6678,
-6677,
-6677,
-6676,
-6676,
-6675,
-6675,
-6674,
-6674,
-6673,
-6673,
-6672,
-6672,
-6671,
-6671,
-6670,
-6670,
-6669,
-6669,
-6668,
-6668,
-6667,
-6667,
-6666,
-6666,
-6665,
-6665,
-6664,
-6664,
-6664,
-6663,
-6663,
-6662,
-6662,
-6661,
-6661,
-6660,
-6660,
-6659,
-6659,
-6658,
-6658,
-6657,
-6657,
-6656,
-6656,
-6655,
-6655,
-6654,
-6654,
-6653,
-6653,
-6652,
-6652,
-6651,
-6651,
-6650,
-6650,
-6649,
-6649,
-6648,
-6648,
-6647,
-6647,
-6647,
-6646,
-6646,
-6645,
-6645,
-6644,
-6644,
-6643,
-6643,
-6642,
-6642,
-6641,
-6641,
-6640,
-6640,
-6639,
-6639,
-6638,
-6638,
-6637,
-6637,
-6636,
-6636,
-6635,
-6635,
-6634,
-6634,
-6633,
-6633,
-6632,
-6632,
-6631,
-6631,
-6630,
-6630,
-6630,
-6629,
-6629,
-6628,
-6628,
-6627,
-6627,
-6626,
-6626,
-6625,
-6625,
-6624,
-6624,
-6623,
-6623,
-6622,
-6622,
-6621,
-6621,
-6620,
-6620,
-6619,
-6619,
-6618,
-6618,
-6617,
-6617,
-6616,
-6616,
-6615,
-6615,
-6615,
-6614,
-6614,
-6613,
-6613,
-6612,
-6612,
-6611,
-6611,
-6610,
-6610,
-6609,
-6609,
-6608,
-6608,
-6607,
-6607,
-6606,
-6606,
-6605,
-6605,
-6604,
-6604,
-6603,
-6603,
-6602,
-6602,
-6601,
-6601,
-6600,
-6600,
-6600,
-6599,
-6599,
-6598,
-6598,
-6597,
-6597,
-6596,
-6596,
-6595,
-6595,
-6594,
-6594,
-6593,
-6593,
-6592,
-6592,
-6591,
-6591,
-6590,
-6590,
-6589,
-6589,
-6588,
-6588,
-6587,
-6587,
-6586,
-6586,
-6586,
-6585,
-6585,
-6584,
-6584,
-6583,
-6583,
-6582,
-6582,
-6581,
-6581,
-6580,
-6580,
-6579,
-6579,
-6578,
-6578,
-6577,
-6577,
-6576,
-6576,
-6575,
-6575,
-6574,
-6574,
-6573,
-6573,
-6573,
-6572,
-6572,
-6571,
-6571,
-6570,
-6570,
-6569,
-6569,
-6568,
-6568,
-6567,
-6567,
-6566,
-6566,
-6565,
-6565,
-6564,
-6564,
-6563,
-6563,
-6562,
-6562,
-6561,
-6561,
-6560,
-6560,
-6560,
-6559,
-6559,
-6558,
-6558,
-6557,
-6557,
-6556,
-6556,
-6555,
-6555,
-6554,
-6554,
-6553,
-6553,
-6552,
-6552,
-6551,
-6551,
-6550,
-6550,
-6549,
-6549,
-6548,
-6548,
-6547,
-6547,
-6547,
-6546,
-6546,
-6545,
-6545,
-6544,
-6544,
-6543,
-6543,
-6542,
-6542,
-6541,
-6541,
-6540,
-6540,
-6539,
-6539,
-6538,
-6538,
-6537,
-6537,
-6536,
-6536,
-6535,
-6535,
-6535,
-6534,
-6534,
-6533,
-6533,
-6532,
-6532,
-6531,
-6531,
-6530,
-6530,
-6529,
-6529,
-6528,
-6528,
-6527,
-6527,
-6526,
-6526,
-6525,
-6525,
-6524,
-6524,
-6524,
-6523,
-6523,
-6522,
-6522,
-6521,
-6521,
-6520,
-6520,
-6519,
-6519,
-6518,
-6518,
-6517,
-6517,
-6516,
-6516,
-6515,
-6515,
-6514,
-6514,
-6513,
-6513,
-6512,
-6512,
-6512,
-6511,
-6511,
-6510,
-6510,
-6509,
-6509,
-6508,
-6508,
-6507,
-6507,
-6506,
-6506,
-6505,
-6505,
-6504,
-6504,
-6503,
-6503,
-6502,
-6502,
-6501,
-6501,
-6501,
-6500,
-6500,
-6499,
-6499,
-6498,
-6498,
-6497,
-6497,
-6496,
-6496,
-6495,
-6495,
-6494,
-6494,
-6493,
-6493,
-6492,
-6492,
-6491,
-6491,
-6491,
-6490,
-6490,
-6489,
-6489,
-6488,
-6488,
-6487,
-6487,
-6486,
-6486,
-6485,
-6485,
-6484,
-6484,
-6483,
-6483,
-6482,
-6482,
-6481,
-6481,
-6480,
-6480,
-6480,
-6479,
-6479,
-6478,
-6478,
-6477,
-6477,
-6476,
-6476,
-6475,
-6475,
-6474,
-6474,
-6473,
-6473,
-6472,
-6472,
-6471,
-6471,
-6470,
-6470,
-6470,
-6469,
-6469,
-6468,
-6468,
-6467,
-6467,
-6466,
-6466,
-6465,
-6465,
-6464,
-6464,
-6463,
-6463,
-6462,
-6462,
-6461,
-6461,
-6460,
-6460,
-6460,
-6459,
-6459,
-6458,
-6458,
-6457,
-6457,
-6456,
-6456,
-6455,
-6455,
-6454,
-6454,
-6453,
-6453,
-6452,
-6452,
-6451,
-6451,
-6450,
-6450,
-6450,
-6449,
-6449,
-6448,
-6448,
-6447,
-6447,
-6446,
-6446,
-6445,
-6445,
-6444,
-6444,
-6443,
-6443,
-6442,
-6442,
-6441,
-6441,
-6441,
-6440,
-6440,
-6439,
-6439,
-6438,
-6438,
-6437,
-6437,
-6436,
-6436,
-6435,
-6435,
-6434,
-6434,
-6433,
-6433,
-6432,
-6432,
-6431,
-6431,
-6431,
-6430,
-6430,
-6429,
-6429,
-6428,
-6428,
-6427,
-6427,
-6426,
-6426,
-6425,
-6425,
-6424,
-6424,
-6423,
-6423,
-6422,
-6422,
-6422,
-6421,
-6421,
-6420,
-6420,
-6419,
-6419,
-6418,
-6418,
-6417,
-6417,
-6416,
-6416,
-6415,
-6415,
-6414,
-6414,
-6413,
-6413,
-6413,
-6412,
-6412,
-6411,
-6411,
-6410,
-6410,
-6409,
-6409,
-6408,
-6408,
-6407,
-6407,
-6406,
-6406,
-6405,
-6405,
-6404,
-6404,
-6404,
-6403,
-6403,
-6402,
-6402,
-6401,
-6401,
-6400,
-6400,
-6399,
-6399,
-6398,
-6398,
-6397,
-6397,
-6396,
-6396,
-6396,
-6395,
-6395,
-6394,
-6394,
-6393,
-6393,
-6392,
-6392,
-6391,
-6391,
-6390,
-6390,
-6389,
-6389,
-6388,
-6388,
-6387,
-6387,
-6387,
-6386,
-6386,
-6385,
-6385,
-6384,
-6384,
-6383,
-6383,
-6382,
-6382,
-6381,
-6381,
-6380,
-6380,
-6379,
-6379,
-6379,
-6378,
-6378,
-6377,
-6377,
-6376,
-6376,
-6375,
-6375,
-6374,
-6374,
-6373,
-6373,
-6372,
-6372,
-6371,
-6371,
-6371,
-6370,
-6370,
-6369,
-6369,
-6368,
-6368,
-6367,
-6367,
-6366,
-6366,
-6365,
-6365,
-6364,
-6364,
-6363,
-6363,
-6363,
-6362,
-6362,
-6361,
-6361,
-6360,
-6360,
-6359,
-6359,
-6358,
-6358,
-6357,
-6357,
-6356,
-6356,
-6355,
-6355,
-6355,
-6354,
-6354,
-6353,
-6353,
-6352,
-6352,
-6351,
-6351,
-6350,
-6350,
-6349,
-6349,
-6348,
-6348,
-6347,
-6347,
-6347,
-6346,
-6346,
-6345,
-6345,
-6344,
-6344,
-6343,
-6343,
-6342,
-6342,
-6341,
-6341,
-6340,
-6340,
-6339,
-6339,
-6339,
-6338,
-6338,
-6337,
-6337,
-6336,
-6336,
-6335,
-6335,
-6334,
-6334,
-6333,
-6333,
-6332,
-6332,
-6331,
-6331,
-6331,
-6330,
-6330,
-6329,
-6329,
-6328,
-6328,
-6327,
-6327,
-6326,
-6326,
-6325,
-6325,
-6324,
-6324,
-6324,
-6323,
-6323,
-6322,
-6322,
-6321,
-6321,
-6320,
-6320,
-6319,
-6319,
-6318,
-6318,
-6317,
-6317,
-6316,
-6316,
-6316,
-6315,
-6315,
-6314,
-6314,
-6313,
-6313,
-6312,
-6312,
-6311,
-6311,
-6310,
-6310,
-6309,
-6309,
-6309,
-6308,
-6308,
-6307,
-6307,
-6306,
-6306,
-6305,
-6305,
-6304,
-6304,
-6303,
-6303,
-6302,
-6302,
-6302,
-6301,
-6301,
-6300,
-6300,
-6299,
-6299,
-6298,
-6298,
-6297,
-6297,
-6296,
-6296,
-6295,
-6295,
-6295,
-6294,
-6294,
-6293,
-6293,
-6292,
-6292,
-6291,
-6291,
-6290,
-6290,
-6289,
-6289,
-6288,
-6288,
-6288,
-6287,
-6287,
-6286,
-6286,
-6285,
-6285,
-6284,
-6284,
-6283,
-6283,
-6282,
-6282,
-6281,
-6281,
-6281,
-6280,
-6280,
-6279,
-6279,
-6278,
-6278,
-6277,
-6277,
-6276,
-6276,
-6275,
-6275,
-6274,
-6274,
-6274,
-6273,
-6273,
-6272,
-6272,
-6271,
-6271,
-6270,
-6270,
-6269,
-6269,
-6268,
-6268,
-6267,
-6267,
-6267,
-6266,
-6266,
-6265,
-6265,
-6264,
-6264,
-6263,
-6263,
-6262,
-6262,
-6261,
-6261,
-6260,
-6260,
-6260,
-6259,
-6259,
-6258,
-6258,
-6257,
-6257,
-6256,
-6256,
-6255,
-6255,
-6254,
-6254,
-6254,
-6253,
-6253,
-6252,
-6252,
-6251,
-6251,
-6250,
-6250,
-6249,
-6249,
-6248,
-6248,
-6247,
-6247,
-6247,
-6246,
-6246,
-6245,
-6245,
-6244,
-6244,
-6243,
-6243,
-6242,
-6242,
-6241,
-6241,
-6240,
-6240,
-6240,
-6239,
-6239,
-6238,
-6238,
-6237,
-6237,
-6236,
-6236,
-6235,
-6235,
-6234,
-6234,
-6234,
-6233,
-6233,
-6232,
-6232,
-6231,
-6231,
-6230,
-6230,
-6229,
-6229,
-6228,
-6228,
-6228,
-6227,
-6227,
-6226,
-6226,
-6225,
-6225,
-6224,
-6224,
-6223,
-6223,
-6222,
-6222,
-6221,
-6221,
-6221,
-6220,
-6220,
-6219,
-6219,
-6218,
-6218,
-6217,
-6217,
-6216,
-6216,
-6215,
-6215,
-6215,
-6214,
-6214,
-6213,
-6213,
-6212,
-6212,
-6211,
-6211,
-6210,
-6210,
-6209,
-6209,
-6209,
-6208,
-6208,
-6207,
-6207,
-6206,
-6206,
-6205,
-6205,
-6204,
-6204,
-6203,
-6203,
-6203,
-6202,
-6202,
-6201,
-6201,
-6200,
-6200,
-6199,
-6199,
-6198,
-6198,
-6197,
-6197,
-6197,
-6196,
-6196,
-6195,
-6195,
-6194,
-6194,
-6193,
-6193,
-6192,
-6192,
-6191,
-6191,
-6191,
-6190,
-6190,
-6189,
-6189,
-6188,
-6188,
-6187,
-6187,
-6186,
-6186,
-6185,
-6185,
-6185,
-6184,
-6184,
-6183,
-6183,
-6182,
-6182,
-6181,
-6181,
-6180,
-6180,
-6179,
-6179,
-6179,
-6178,
-6178,
-6177,
-6177,
-6176,
-6176,
-6175,
-6175,
-6174,
-6174,
-6173,
-6173,
-6173,
-6172,
-6172,
-6171,
-6171,
-6170,
-6170,
-6169,
-6169,
-6168,
-6168,
-6167,
-6167,
-6167,
-6166,
-6166,
-6165,
-6165,
-6164,
-6164,
-6163,
-6163,
-6162,
-6162,
-6161,
-6161,
-6161,
-6160,
-6160,
-6159,
-6159,
-6158,
-6158,
-6157,
-6157,
-6156,
-6156,
-6156,
-6155,
-6155,
-6154,
-6154,
-6153,
-6153,
-6152,
-6152,
-6151,
-6151,
-6150,
-6150,
-6150,
-6149,
-6149,
-6148,
-6148,
-6147,
-6147,
-6146,
-6146,
-6145,
-6145,
-6144,
-6144,
-6144,
-6143,
-6143,
-6142,
-6142,
-6141,
-6141,
-6140,
-6140,
-6139,
-6139,
-6139,
-6138,
-6138,
-6137,
-6137,
-6136,
-6136,
-6135,
-6135,
-6134,
-6134,
-6133,
-6133,
-6133,
-6132,
-6132,
-6131,
-6131,
-6130,
-6130,
-6129,
-6129,
-6128,
-6128,
-6128,
-6127,
-6127,
-6126,
-6126,
-6125,
-6125,
-6124,
-6124,
-6123,
-6123,
-6122,
-6122,
-6122,
-6121,
-6121,
-6120,
-6120,
-6119,
-6119,
-6118,
-6118,
-6117,
-6117,
-6117,
-6116,
-6116,
-6115,
-6115,
-6114,
-6114,
-6113,
-6113,
-6112,
-6112,
-6111,
-6111,
-6111,
-6110,
-6110,
-6109,
-6109,
-6108,
-6108,
-6107,
-6107,
-6106,
-6106,
-6106,
-6105,
-6105,
-6104,
-6104,
-6103,
-6103,
-6102,
-6102,
-6101,
-6101,
-6101,
-6100,
-6100,
-6099,
-6099,
-6098,
-6098,
-6097,
-6097,
-6096,
-6096,
-6096,
-6095,
-6095,
-6094,
-6094,
-6093,
-6093,
-6092,
-6092,
-6091,
-6091,
-6090,
-6090,
-6090,
-6089,
-6089,
-6088,
-6088,
-6087,
-6087,
-6086,
-6086,
-6085,
-6085,
-6085,
-6084,
-6084,
-6083,
-6083,
-6082,
-6082,
-6081,
-6081,
-6080,
-6080,
-6080,
-6079,
-6079,
-6078,
-6078,
-6077,
-6077,
-6076,
-6076,
-6075,
-6075,
-6075,
-6074,
-6074,
-6073,
-6073,
-6072,
-6072,
-6071,
-6071,
-6070,
-6070,
-6070,
-6069,
-6069,
-6068,
-6068,
-6067,
-6067,
-6066,
-6066,
-6065,
-6065,
-6065,
-6064,
-6064,
-6063,
-6063,
-6062,
-6062,
-6061,
-6061,
-6060,
-6060,
-6060,
-6059,
-6059,
-6058,
-6058,
-6057,
-6057,
-6056,
-6056,
-6055,
-6055,
-6055,
-6054,
-6054,
-6053,
-6053,
-6052,
-6052,
-6051,
-6051,
-6050,
-6050,
-6050,
-6049,
-6049,
-6048,
-6048,
-6047,
-6047,
-6046,
-6046,
-6045,
-6045,
-6045,
-6044,
-6044,
-6043,
-6043,
-6042,
-6042,
-6041,
-6041,
-6040,
-6040,
-6040,
-6039,
-6039,
-6038,
-6038,
-6037,
-6037,
-6036,
-6036,
-6035,
-6035,
-6035,
-6034,
-6034,
-6033,
-6033,
-6032,
-6032,
-6031,
-6031,
-6030,
-6030,
-6030,
-6029,
-6029,
-6028,
-6028,
-6027,
-6027,
-6026,
-6026,
-6026,
-6025,
-6025,
-6024,
-6024,
-6023,
-6023,
-6022,
-6022,
-6021,
-6021,
-6021,
-6020,
-6020,
-6019,
-6019,
-6018,
-6018,
-6017,
-6017,
-6016,
-6016,
-6016,
-6015,
-6015,
-6014,
-6014,
-6013,
-6013,
-6012,
-6012,
-6011,
-6011,
-6011,
-6010,
-6010,
-6009,
-6009,
-6008,
-6008,
-6007,
-6007,
-6007,
-6006,
-6006,
-6005,
-6005,
-6004,
-6004,
-6003,
-6003,
-6002,
-6002,
-6002,
-6001,
-6001,
-6000,
-6000,
-5999,
-5999,
-5998,
-5998,
-5998,
-5997,
-5997,
-5996,
-5996,
-5995,
-5995,
-5994,
-5994,
-5993,
-5993,
-5993,
-5992,
-5992,
-5991,
-5991,
-5990,
-5990,
-5989,
-5989,
-5988,
-5988,
-5988,
-5987,
-5987,
-5986,
-5986,
-5985,
-5985,
-5984,
-5984,
-5984,
-5983,
-5983,
-5982,
-5982,
-5981,
-5981,
-5980,
-5980,
-5979,
-5979,
-5979,
-5978,
-5978,
-5977,
-5977,
-5976,
-5976,
-5975,
-5975,
-5975,
-5974,
-5974,
-5973,
-5973,
-5972,
-5972,
-5971,
-5971,
-5970,
-5970,
-5970,
-5969,
-5969,
-5968,
-5968,
-5967,
-5967,
-5966,
-5966,
-5966,
-5965,
-5965,
-5964,
-5964,
-5963,
-5963,
-5962,
-5962,
-5962,
-5961,
-5961,
-5960,
-5960,
-5959,
-5959,
-5958,
-5958,
-5957,
-5957,
-5957,
-5956,
-5956,
-5955,
-5955,
-5954,
-5954,
-5953,
-5953,
-5953,
-5952,
-5952,
-5951,
-5951,
-5950,
-5950,
-5949,
-5949,
-5948,
-5948,
-5948,
-5947,
-5947,
-5946,
-5946,
-5945,
-5945,
-5944,
-5944,
-5944,
-5943,
-5943,
-5942,
-5942,
-5941,
-5941,
-5940,
-5940,
-5940,
-5939,
-5939,
-5938,
-5938,
-5937,
-5937,
-5936,
-5936,
-5935,
-5935,
-5935,
-5934,
-5934,
-5933,
-5933,
-5932,
-5932,
-5931,
-5931,
-5931,
-5930,
-5930,
-5929,
-5929,
-5928,
-5928,
-5927,
-5927,
-5927,
-5926,
-5926,
-5925,
-5925,
-5924,
-5924,
-5923,
-5923,
-5923,
-5922,
-5922,
-5921,
-5921,
-5920,
-5920,
-5919,
-5919,
-5919,
-5918,
-5918,
-5917,
-5917,
-5916,
-5916,
-5915,
-5915,
-5914,
-5914,
-5914,
-5913,
-5913,
-5912,
-5912,
-5911,
-5911,
-5910,
-5910,
-5910,
-5909,
-5909,
-5908,
-5908,
-5907,
-5907,
-5906,
-5906,
-5906,
-5905,
-5905,
-5904,
-5904,
-5903,
-5903,
-5902,
-5902,
-5902,
-5901,
-5901,
-5900,
-5900,
-5899,
-5899,
-5898,
-5898,
-5898,
-5897,
-5897,
-5896,
-5896,
-5895,
-5895,
-5894,
-5894,
-5894,
-5893,
-5893,
-5892,
-5892,
-5891,
-5891,
-5890,
-5890,
-5890,
-5889,
-5889,
-5888,
-5888,
-5887,
-5887,
-5886,
-5886,
-5886,
-5885,
-5885,
-5884,
-5884,
-5883,
-5883,
-5882,
-5882,
-5882,
-5881,
-5881,
-5880,
-5880,
-5879,
-5879,
-5878,
-5878,
-5878,
-5877,
-5877,
-5876,
-5876,
-5875,
-5875,
-5874,
-5874,
-5874,
-5873,
-5873,
-5872,
-5872,
-5871,
-5871,
-5870,
-5870,
-5870,
-5869,
-5869,
-5868,
-5868,
-5867,
-5867,
-5866,
-5866,
-5866,
-5865,
-5865,
-5864,
-5864,
-5863,
-5863,
-5862,
-5862,
-5862,
-5861,
-5861,
-5860,
-5860,
-5859,
-5859,
-5858,
-5858,
-5858,
-5857,
-5857,
-5856,
-5856,
-5855,
-5855,
-5854,
-5854,
-5854,
-5853,
-5853,
-5852,
-5852,
-5851,
-5851,
-5850,
-5850,
-5850,
-5849,
-5849,
-5848,
-5848,
-5847,
-5847,
-5846,
-5846,
-5846,
-5845,
-5845,
-5844,
-5844,
-5843,
-5843,
-5842,
-5842,
-5842,
-5841,
-5841,
-5840,
-5840,
-5839,
-5839,
-5839,
-5838,
-5838,
-5837,
-5837,
-5836,
-5836,
-5835,
-5835,
-5835,
-5834,
-5834,
-5833,
-5833,
-5832,
-5832,
-5831,
-5831,
-5831,
-5830,
-5830,
-5829,
-5829,
-5828,
-5828,
-5827,
-5827,
-5827,
-5826,
-5826,
-5825,
-5825,
-5824,
-5824,
-5823,
-5823,
-5823,
-5822,
-5822,
-5821,
-5821,
-5820,
-5820,
-5820,
-5819,
-5819,
-5818,
-5818,
-5817,
-5817,
-5816,
-5816,
-5816,
-5815,
-5815,
-5814,
-5814,
-5813,
-5813,
-5812,
-5812,
-5812,
-5811,
-5811,
-5810,
-5810,
-5809,
-5809,
-5808,
-5808,
-5808,
-5807,
-5807,
-5806,
-5806,
-5805,
-5805,
-5805,
-5804,
-5804,
-5803,
-5803,
-5802,
-5802,
-5801,
-5801,
-5801,
-5800,
-5800,
-5799,
-5799,
-5798,
-5798,
-5797,
-5797,
-5797,
-5796,
-5796,
-5795,
-5795,
-5794,
-5794,
-5794,
-5793,
-5793,
-5792,
-5792,
-5791,
-5791,
-5790,
-5790,
-5790,
-5789,
-5789,
-5788,
-5788,
-5787,
-5787,
-5786,
-5786,
-5786,
-5785,
-5785,
-5784,
-5784,
-5783,
-5783,
-5783,
-5782,
-5782,
-5781,
-5781,
-5780,
-5780,
-5779,
-5779,
-5779,
-5778,
-5778,
-5777,
-5777,
-5776,
-5776,
-5776,
-5775,
-5775,
-5774,
-5774,
-5773,
-5773,
-5772,
-5772,
-5772,
-5771,
-5771,
-5770,
-5770,
-5769,
-5769,
-5768,
-5768,
-5768,
-5767,
-5767,
-5766,
-5766,
-5765,
-5765,
-5765,
-5764,
-5764,
-5763,
-5763,
-5762,
-5762,
-5761,
-5761,
-5761,
-5760,
-5760,
-5759,
-5759,
-5758,
-5758,
-5758,
-5757,
-5757,
-5756,
-5756,
-5755,
-5755,
-5754,
-5754,
-5754,
-5753,
-5753,
-5752,
-5752,
-5751,
-5751,
-5751,
-5750,
-5750,
-5749,
-5749,
-5748,
-5748,
-5747,
-5747,
-5747,
-5746,
-5746,
-5745,
-5745,
-5744,
-5744,
-5744,
-5743,
-5743,
-5742,
-5742,
-5741,
-5741,
-5740,
-5740,
-5740,
-5739,
-5739,
-5738,
-5738,
-5737,
-5737,
-5737,
-5736,
-5736,
-5735,
-5735,
-5734,
-5734,
-5734,
-5733,
-5733,
-5732,
-5732,
-5731,
-5731,
-5730,
-5730,
-5730,
-5729,
-5729,
-5728,
-5728,
-5727,
-5727,
-5727,
-5726,
-5726,
-5725,
-5725,
-5724,
-5724,
-5723,
-5723,
-5723,
-5722,
-5722,
-5721,
-5721,
-5720,
-5720,
-5720,
-5719,
-5719,
-5718,
-5718,
-5717,
-5717,
-5717,
-5716,
-5716,
-5715,
-5715,
-5714,
-5714,
-5713,
-5713,
-5713,
-5712,
-5712,
-5711,
-5711,
-5710,
-5710,
-5710,
-5709,
-5709,
-5708,
-5708,
-5707,
-5707,
-5707,
-5706,
-5706,
-5705,
-5705,
-5704,
-5704,
-5703,
-5703,
-5703,
-5702,
-5702,
-5701,
-5701,
-5700,
-5700,
-5700,
-5699,
-5699,
-5698,
-5698,
-5697,
-5697,
-5697,
-5696,
-5696,
-5695,
-5695,
-5694,
-5694,
-5693,
-5693,
-5693,
-5692,
-5692,
-5691,
-5691,
-5690,
-5690,
-5690,
-5689,
-5689,
-5688,
-5688,
-5687,
-5687,
-5687,
-5686,
-5686,
-5685,
-5685,
-5684,
-5684,
-5683,
-5683,
-5683,
-5682,
-5682,
-5681,
-5681,
-5680,
-5680,
-5680,
-5679,
-5679,
-5678,
-5678,
-5677,
-5677,
-5677,
-5676,
-5676,
-5675,
-5675,
-5674,
-5674,
-5674,
-5673,
-5673,
-5672,
-5672,
-5671,
-5671,
-5670,
-5670,
-5670,
-5669,
-5669,
-5668,
-5668,
-5667,
-5667,
-5667,
-5666,
-5666,
-5665,
-5665,
-5664,
-5664,
-5664,
-5663,
-5663,
-5662,
-5662,
-5661,
-5661,
-5661,
-5660,
-5660,
-5659,
-5659,
-5658,
-5658,
-5658,
-5657,
-5657,
-5656,
-5656,
-5655,
-5655,
-5655,
-5654,
-5654,
-5653,
-5653,
-5652,
-5652,
-5651,
-5651,
-5651,
-5650,
-5650,
-5649,
-5649,
-5648,
-5648,
-5648,
-5647,
-5647,
-5646,
-5646,
-5645,
-5645,
-5645,
-5644,
-5644,
-5643,
-5643,
-5642,
-5642,
-5642,
-5641,
-5641,
-5640,
-5640,
-5639,
-5639,
-5639,
-5638,
-5638,
-5637,
-5637,
-5636,
-5636,
-5636,
-5635,
-5635,
-5634,
-5634,
-5633,
-5633,
-5633,
-5632,
-5632,
-5631,
-5631,
-5630,
-5630,
-5629,
-5629,
-5629,
-5628,
-5628,
-5627,
-5627,
-5626,
-5626,
-5626,
-5625,
-5625,
-5624,
-5624,
-5623,
-5623,
-5623,
-5622,
-5622,
-5621,
-5621,
-5620,
-5620,
-5620,
-5619,
-5619,
-5618,
-5618,
-5617,
-5617,
-5617,
-5616,
-5616,
-5615,
-5615,
-5614,
-5614,
-5614,
-5613,
-5613,
-5612,
-5612,
-5611,
-5611,
-5611,
-5610,
-5610,
-5609,
-5609,
-5608,
-5608,
-5608,
-5607,
-5607,
-5606,
-5606,
-5605,
-5605,
-5605,
-5604,
-5604,
-5603,
-5603,
-5602,
-5602,
-5602,
-5601,
-5601,
-5600,
-5600,
-5599,
-5599,
-5599,
-5598,
-5598,
-5597,
-5597,
-5596,
-5596,
-5596,
-5595,
-5595,
-5594,
-5594,
-5593,
-5593,
-5593,
-5592,
-5592,
-5591,
-5591,
-5590,
-5590,
-5590,
-5589,
-5589,
-5588,
-5588,
-5587,
-5587,
-5587,
-5586,
-5586,
-5585,
-5585,
-5584,
-5584,
-5584,
-5583,
-5583,
-5582,
-5582,
-5581,
-5581,
-5581,
-5580,
-5580,
-5579,
-5579,
-5578,
-5578,
-5578,
-5577,
-5577,
-5576,
-5576,
-5575,
-5575,
-5575,
-5574,
-5574,
-5573,
-5573,
-5572,
-5572,
-5572,
-5571,
-5571,
-5570,
-5570,
-5569,
-5569,
-5569,
-5568,
-5568,
-5567,
-5567,
-5566,
-5566,
-5566,
-5565,
-5565,
-5564,
-5564,
-5563,
-5563,
-5563,
-5562,
-5562,
-5561,
-5561,
-5561,
-5560,
-5560,
-5559,
-5559,
-5558,
-5558,
-5558,
-5557,
-5557,
-5556,
-5556,
-5555,
-5555,
-5555,
-5554,
-5554,
-5553,
-5553,
-5552,
-5552,
-5552,
-5551,
-5551,
-5550,
-5550,
-5549,
-5549,
-5549,
-5548,
-5548,
-5547,
-5547,
-5546,
-5546,
-5546,
-5545,
-5545,
-5544,
-5544,
-5543,
-5543,
-5543,
-5542,
-5542,
-5541,
-5541,
-5540,
-5540,
-5540,
-5539,
-5539,
-5538,
-5538,
-5538,
-5537,
-5537,
-5536,
-5536,
-5535,
-5535,
-5535,
-5534,
-5534,
-5533,
-5533,
-5532,
-5532,
-5532,
-5531,
-5531,
-5530,
-5530,
-5529,
-5529,
-5529,
-5528,
-5528,
-5527,
-5527,
-5526,
-5526,
-5526,
-5525,
-5525,
-5524,
-5524,
-5523,
-5523,
-5523,
-5522,
-5522,
-5521,
-5521,
-5521,
-5520,
-5520,
-5519,
-5519,
-5518,
-5518,
-5518,
-5517,
-5517,
-5516,
-5516,
-5515,
-5515,
-5515,
-5514,
-5514,
-5513,
-5513,
-5512,
-5512,
-5512,
-5511,
-5511,
-5510,
-5510,
-5510,
-5509,
-5509,
-5508,
-5508,
-5507,
-5507,
-5507,
-5506,
-5506,
-5505,
-5505,
-5504,
-5504,
-5504,
-5503,
-5503,
-5502,
-5502,
-5501,
-5501,
-5501,
-5500,
-5500,
-5499,
-5499,
-5498,
-5498,
-5498,
-5497,
-5497,
-5496,
-5496,
-5496,
-5495,
-5495,
-5494,
-5494,
-5493,
-5493,
-5493,
-5492,
-5492,
-5491,
-5491,
-5490,
-5490,
-5490,
-5489,
-5489,
-5488,
-5488,
-5488,
-5487,
-5487,
-5486,
-5486,
-5485,
-5485,
-5485,
-5484,
-5484,
-5483,
-5483,
-5482,
-5482,
-5482,
-5481,
-5481,
-5480,
-5480,
-5479,
-5479,
-5479,
-5478,
-5478,
-5477,
-5477,
-5477,
-5476,
-5476,
-5475,
-5475,
-5474,
-5474,
-5474,
-5473,
-5473,
-5472,
-5472,
-5471,
-5471,
-5471,
-5470,
-5470,
-5469,
-5469,
-5469,
-5468,
-5468,
-5467,
-5467,
-5466,
-5466,
-5466,
-5465,
-5465,
-5464,
-5464,
-5463,
-5463,
-5463,
-5462,
-5462,
-5461,
-5461,
-5461,
-5460,
-5460,
-5459,
-5459,
-5458,
-5458,
-5458,
-5457,
-5457,
-5456,
-5456,
-5455,
-5455,
-5455,
-5454,
-5454,
-5453,
-5453,
-5453,
-5452,
-5452,
-5451,
-5451,
-5450,
-5450,
-5450,
-5449,
-5449,
-5448,
-5448,
-5448,
-5447,
-5447,
-5446,
-5446,
-5445,
-5445,
-5445,
-5444,
-5444,
-5443,
-5443,
-5442,
-5442,
-5442,
-5441,
-5441,
-5440,
-5440,
-5440,
-5439,
-5439,
-5438,
-5438,
-5437,
-5437,
-5437,
-5436,
-5436,
-5435,
-5435,
-5434,
-5434,
-5434,
-5433,
-5433,
-5432,
-5432,
-5432,
-5431,
-5431,
-5430,
-5430,
-5429,
-5429,
-5429,
-5428,
-5428,
-5427,
-5427,
-5427,
-5426,
-5426,
-5425,
-5425,
-5424,
-5424,
-5424,
-5423,
-5423,
-5422,
-5422,
-5422,
-5421,
-5421,
-5420,
-5420,
-5419,
-5419,
-5419,
-5418,
-5418,
-5417,
-5417,
-5416,
-5416,
-5416,
-5415,
-5415,
-5414,
-5414,
-5414,
-5413,
-5413,
-5412,
-5412,
-5411,
-5411,
-5411,
-5410,
-5410,
-5409,
-5409,
-5409,
-5408,
-5408,
-5407,
-5407,
-5406,
-5406,
-5406,
-5405,
-5405,
-5404,
-5404,
-5404,
-5403,
-5403,
-5402,
-5402,
-5401,
-5401,
-5401,
-5400,
-5400,
-5399,
-5399,
-5399,
-5398,
-5398,
-5397,
-5397,
-5396,
-5396,
-5396,
-5395,
-5395,
-5394,
-5394,
-5394,
-5393,
-5393,
-5392,
-5392,
-5391,
-5391,
-5391,
-5390,
-5390,
-5389,
-5389,
-5389,
-5388,
-5388,
-5387,
-5387,
-5386,
-5386,
-5386,
-5385,
-5385,
-5384,
-5384,
-5384,
-5383,
-5383,
-5382,
-5382,
-5381,
-5381,
-5381,
-5380,
-5380,
-5379,
-5379,
-5379,
-5378,
-5378,
-5377,
-5377,
-5376,
-5376,
-5376,
-5375,
-5375,
-5374,
-5374,
-5374,
-5373,
-5373,
-5372,
-5372,
-5371,
-5371,
-5371,
-5370,
-5370,
-5369,
-5369,
-5369,
-5368,
-5368,
-5367,
-5367,
-5366,
-5366,
-5366,
-5365,
-5365,
-5364,
-5364,
-5364,
-5363,
-5363,
-5362,
-5362,
-5361,
-5361,
-5361,
-5360,
-5360,
-5359,
-5359,
-5359,
-5358,
-5358,
-5357,
-5357,
-5357,
-5356,
-5356,
-5355,
-5355,
-5354,
-5354,
-5354,
-5353,
-5353,
-5352,
-5352,
-5352,
-5351,
-5351,
-5350,
-5350,
-5349,
-5349,
-5349,
-5348,
-5348,
-5347,
-5347,
-5347,
-5346,
-5346,
-5345,
-5345,
-5345,
-5344,
-5344,
-5343,
-5343,
-5342,
-5342,
-5342,
-5341,
-5341,
-5340,
-5340,
-5340,
-5339,
-5339,
-5338,
-5338,
-5337,
-5337,
-5337,
-5336,
-5336,
-5335,
-5335,
-5335,
-5334,
-5334,
-5333,
-5333,
-5333,
-5332,
-5332,
-5331,
-5331,
-5330,
-5330,
-5330,
-5329,
-5329,
-5328,
-5328,
-5328,
-5327,
-5327,
-5326,
-5326,
-5325,
-5325,
-5325,
-5324,
-5324,
-5323,
-5323,
-5323,
-5322,
-5322,
-5321,
-5321,
-5321,
-5320,
-5320,
-5319,
-5319,
-5318,
-5318,
-5318,
-5317,
-5317,
-5316,
-5316,
-5316,
-5315,
-5315,
-5314,
-5314,
-5314,
-5313,
-5313,
-5312,
-5312,
-5311,
-5311,
-5311,
-5310,
-5310,
-5309,
-5309,
-5309,
-5308,
-5308,
-5307,
-5307,
-5307,
-5306,
-5306,
-5305,
-5305,
-5304,
-5304,
-5304,
-5303,
-5303,
-5302,
-5302,
-5302,
-5301,
-5301,
-5300,
-5300,
-5300,
-5299,
-5299,
-5298,
-5298,
-5297,
-5297,
-5297,
-5296,
-5296,
-5295,
-5295,
-5295,
-5294,
-5294,
-5293,
-5293,
-5293,
-5292,
-5292,
-5291,
-5291,
-5290,
-5290,
-5290,
-5289,
-5289,
-5288,
-5288,
-5288,
-5287,
-5287,
-5286,
-5286,
-5286,
-5285,
-5285,
-5284,
-5284,
-5283,
-5283,
-5283,
-5282,
-5282,
-5281,
-5281,
-5281,
-5280,
-5280,
-5279,
-5279,
-5279,
-5278,
-5278,
-5277,
-5277,
-5277,
-5276,
-5276,
-5275,
-5275,
-5274,
-5274,
-5274,
-5273,
-5273,
-5272,
-5272,
-5272,
-5271,
-5271,
-5270,
-5270,
-5270,
-5269,
-5269,
-5268,
-5268,
-5268,
-5267,
-5267,
-5266,
-5266,
-5265,
-5265,
-5265,
-5264,
-5264,
-5263,
-5263,
-5263,
-5262,
-5262,
-5261,
-5261,
-5261,
-5260,
-5260,
-5259,
-5259,
-5259,
-5258,
-5258,
-5257,
-5257,
-5256,
-5256,
-5256,
-5255,
-5255,
-5254,
-5254,
-5254,
-5253,
-5253,
-5252,
-5252,
-5252,
-5251,
-5251,
-5250,
-5250,
-5250,
-5249,
-5249,
-5248,
-5248,
-5247,
-5247,
-5247,
-5246,
-5246,
-5245,
-5245,
-5245,
-5244,
-5244,
-5243,
-5243,
-5243,
-5242,
-5242,
-5241,
-5241,
-5241,
-5240,
-5240,
-5239,
-5239,
-5238,
-5238,
-5238,
-5237,
-5237,
-5236,
-5236,
-5236,
-5235,
-5235,
-5234,
-5234,
-5234,
-5233,
-5233,
-5232,
-5232,
-5232,
-5231,
-5231,
-5230,
-5230,
-5230,
-5229,
-5229,
-5228,
-5228,
-5227,
-5227,
-5227,
-5226,
-5226,
-5225,
-5225,
-5225,
-5224,
-5224,
-5223,
-5223,
-5223,
-5222,
-5222,
-5221,
-5221,
-5221,
-5220,
-5220,
-5219,
-5219,
-5219,
-5218,
-5218,
-5217,
-5217,
-5217,
-5216,
-5216,
-5215,
-5215,
-5214,
-5214,
-5214,
-5213,
-5213,
-5212,
-5212,
-5212,
-5211,
-5211,
-5210,
-5210,
-5210,
-5209,
-5209,
-5208,
-5208,
-5208,
-5207,
-5207,
-5206,
-5206,
-5206,
-5205,
-5205,
-5204,
-5204,
-5204,
-5203,
-5203,
-5202,
-5202,
-5201,
-5201,
-5201,
-5200,
-5200,
-5199,
-5199,
-5199,
-5198,
-5198,
-5197,
-5197,
-5197,
-5196,
-5196,
-5195,
-5195,
-5195,
-5194,
-5194,
-5193,
-5193,
-5193,
-5192,
-5192,
-5191,
-5191,
-5191,
-5190,
-5190,
-5189,
-5189,
-5189,
-5188,
-5188,
-5187,
-5187,
-5187,
-5186,
-5186,
-5185,
-5185,
-5184,
-5184,
-5184,
-5183,
-5183,
-5182,
-5182,
-5182,
-5181,
-5181,
-5180,
-5180,
-5180,
-5179,
-5179,
-5178,
-5178,
-5178,
-5177,
-5177,
-5176,
-5176,
-5176,
-5175,
-5175,
-5174,
-5174,
-5174,
-5173,
-5173,
-5172,
-5172,
-5172,
-5171,
-5171,
-5170,
-5170,
-5170,
-5169,
-5169,
-5168,
-5168,
-5168,
-5167,
-5167,
-5166,
-5166,
-5165,
-5165,
-5165,
-5164,
-5164,
-5163,
-5163,
-5163,
-5162,
-5162,
-5161,
-5161,
-5161,
-5160,
-5160,
-5159,
-5159,
-5159,
-5158,
-5158,
-5157,
-5157,
-5157,
-5156,
-5156,
-5155,
-5155,
-5155,
-5154,
-5154,
-5153,
-5153,
-5153,
-5152,
-5152,
-5151,
-5151,
-5151,
-5150,
-5150,
-5149,
-5149,
-5149,
-5148,
-5148,
-5147,
-5147,
-5147,
-5146,
-5146,
-5145,
-5145,
-5145,
-5144,
-5144,
-5143,
-5143,
-5143,
-5142,
-5142,
-5141,
-5141,
-5141,
-5140,
-5140,
-5139,
-5139,
-5139,
-5138,
-5138,
-5137,
-5137,
-5137,
-5136,
-5136,
-5135,
-5135,
-5135,
-5134,
-5134,
-5133,
-5133,
-5132,
-5132,
-5132,
-5131,
-5131,
-5130,
-5130,
-5130,
-5129,
-5129,
-5128,
-5128,
-5128,
-5127,
-5127,
-5126,
-5126,
-5126,
-5125,
-5125,
-5124,
-5124,
-5124,
-5123,
-5123,
-5122,
-5122,
-5122,
-5121,
-5121,
-5120,
-5120,
-5120,
-5119,
-5119,
-5118,
-5118,
-5118,
-5117,
-5117,
-5116,
-5116,
-5116,
-5115,
-5115,
-5114,
-5114,
-5114,
-5113,
-5113,
-5112,
-5112,
-5112,
-5111,
-5111,
-5110,
-5110,
-5110,
-5109,
-5109,
-5108,
-5108,
-5108,
-5107,
-5107,
-5106,
-5106,
-5106,
-5105,
-5105,
-5104,
-5104,
-5104,
-5103,
-5103,
-5102,
-5102,
-5102,
-5101,
-5101,
-5100,
-5100,
-5100,
-5099,
-5099,
-5098,
-5098,
-5098,
-5097,
-5097,
-5096,
-5096,
-5096,
-5095,
-5095,
-5094,
-5094,
-5094,
-5093,
-5093,
-5092,
-5092,
-5092,
-5091,
-5091,
-5090,
-5090,
-5090,
-5089,
-5089,
-5088,
-5088,
-5088,
-5087,
-5087,
-5086,
-5086,
-5086,
-5085,
-5085,
-5084,
-5084,
-5084,
-5083,
-5083,
-5083,
-5082,
-5082,
-5081,
-5081,
-5081,
-5080,
-5080,
-5079,
-5079,
-5079,
-5078,
-5078,
-5077,
-5077,
-5077,
-5076,
-5076,
-5075,
-5075,
-5075,
-5074,
-5074,
-5073,
-5073,
-5073,
-5072,
-5072,
-5071,
-5071,
-5071,
-5070,
-5070,
-5069,
-5069,
-5069,
-5068,
-5068,
-5067,
-5067,
-5067,
-5066,
-5066,
-5065,
-5065,
-5065,
-5064,
-5064,
-5063,
-5063,
-5063,
-5062,
-5062,
-5061,
-5061,
-5061,
-5060,
-5060,
-5059,
-5059,
-5059,
-5058,
-5058,
-5057,
-5057,
-5057,
-5056,
-5056,
-5055,
-5055,
-5055,
-5054,
-5054,
-5053,
-5053,
-5053,
-5052,
-5052,
-5051,
-5051,
-5051,
-5050,
-5050,
-5050,
-5049,
-5049,
-5048,
-5048,
-5048,
-5047,
-5047,
-5046,
-5046,
-5046,
-5045,
-5045,
-5044,
-5044,
-5044,
-5043,
-5043,
-5042,
-5042,
-5042,
-5041,
-5041,
-5040,
-5040,
-5040,
-5039,
-5039,
-5038,
-5038,
-5038,
-5037,
-5037,
-5036,
-5036,
-5036,
-5035,
-5035,
-5034,
-5034,
-5034,
-5033,
-5033,
-5032,
-5032,
-5032,
-5031,
-5031,
-5031,
-5030,
-5030,
-5029,
-5029,
-5029,
-5028,
-5028,
-5027,
-5027,
-5027,
-5026,
-5026,
-5025,
-5025,
-5025,
-5024,
-5024,
-5023,
-5023,
-5023,
-5022,
-5022,
-5021,
-5021,
-5021,
-5020,
-5020,
-5019,
-5019,
-5019,
-5018,
-5018,
-5017,
-5017,
-5017,
-5016,
-5016,
-5016,
-5015,
-5015,
-5014,
-5014,
-5014,
-5013,
-5013,
-5012,
-5012,
-5012,
-5011,
-5011,
-5010,
-5010,
-5010,
-5009,
-5009,
-5008,
-5008,
-5008,
-5007,
-5007,
-5006,
-5006,
-5006,
-5005,
-5005,
-5004,
-5004,
-5004,
-5003,
-5003,
-5003,
-5002,
-5002,
-5001,
-5001,
-5001,
-5000,
-5000,
-4999,
-4999,
-4999,
-4998,
-4998,
-4997,
-4997,
-4997,
-4996,
-4996,
-4995,
-4995,
-4995,
-4994,
-4994,
-4993,
-4993,
-4993,
-4992,
-4992,
-4991,
-4991,
-4991,
-4990,
-4990,
-4990,
-4989,
-4989,
-4988,
-4988,
-4988,
-4987,
-4987,
-4986,
-4986,
-4986,
-4985,
-4985,
-4984,
-4984,
-4984,
-4983,
-4983,
-4982,
-4982,
-4982,
-4981,
-4981,
-4981,
-4980,
-4980,
-4979,
-4979,
-4979,
-4978,
-4978,
-4977,
-4977,
-4977,
-4976,
-4976,
-4975,
-4975,
-4975,
-4974,
-4974,
-4973,
-4973,
-4973,
-4972,
-4972,
-4971,
-4971,
-4971,
-4970,
-4970,
-4970,
-4969,
-4969,
-4968,
-4968,
-4968,
-4967,
-4967,
-4966,
-4966,
-4966,
-4965,
-4965,
-4964,
-4964,
-4964,
-4963,
-4963,
-4962,
-4962,
-4962,
-4961,
-4961,
-4961,
-4960,
-4960,
-4959,
-4959,
-4959,
-4958,
-4958,
-4957,
-4957,
-4957,
-4956,
-4956,
-4955,
-4955,
-4955,
-4954,
-4954,
-4953,
-4953,
-4953,
-4952,
-4952,
-4952,
-4951,
-4951,
-4950,
-4950,
-4950,
-4949,
-4949,
-4948,
-4948,
-4948,
-4947,
-4947,
-4946,
-4946,
-4946,
-4945,
-4945,
-4945,
-4944,
-4944,
-4943,
-4943,
-4943,
-4942,
-4942,
-4941,
-4941,
-4941,
-4940,
-4940,
-4939,
-4939,
-4939,
-4938,
-4938,
-4937,
-4937,
-4937,
-4936,
-4936,
-4936,
-4935,
-4935,
-4934,
-4934,
-4934,
-4933,
-4933,
-4932,
-4932,
-4932,
-4931,
-4931,
-4930,
-4930,
-4930,
-4929,
-4929,
-4929,
-4928,
-4928,
-4927,
-4927,
-4927,
-4926,
-4926,
-4925,
-4925,
-4925,
-4924,
-4924,
-4923,
-4923,
-4923,
-4922,
-4922,
-4922,
-4921,
-4921,
-4920,
-4920,
-4920,
-4919,
-4919,
-4918,
-4918,
-4918,
-4917,
-4917,
-4916,
-4916,
-4916,
-4915,
-4915,
-4915,
-4914,
-4914,
-4913,
-4913,
-4913,
-4912,
-4912,
-4911,
-4911,
-4911,
-4910,
-4910,
-4910,
-4909,
-4909,
-4908,
-4908,
-4908,
-4907,
-4907,
-4906,
-4906,
-4906,
-4905,
-4905,
-4904,
-4904,
-4904,
-4903,
-4903,
-4903,
-4902,
-4902,
-4901,
-4901,
-4901,
-4900,
-4900,
-4899,
-4899,
-4899,
-4898,
-4898,
-4897,
-4897,
-4897,
-4896,
-4896,
-4896,
-4895,
-4895,
-4894,
-4894,
-4894,
-4893,
-4893,
-4892,
-4892,
-4892,
-4891,
-4891,
-4891,
-4890,
-4890,
-4889,
-4889,
-4889,
-4888,
-4888,
-4887,
-4887,
-4887,
-4886,
-4886,
-4885,
-4885,
-4885,
-4884,
-4884,
-4884,
-4883,
-4883,
-4882,
-4882,
-4882,
-4881,
-4881,
-4880,
-4880,
-4880,
-4879,
-4879,
-4879,
-4878,
-4878,
-4877,
-4877,
-4877,
-4876,
-4876,
-4875,
-4875,
-4875,
-4874,
-4874,
-4874,
-4873,
-4873,
-4872,
-4872,
-4872,
-4871,
-4871,
-4870,
-4870,
-4870,
-4869,
-4869,
-4869,
-4868,
-4868,
-4867,
-4867,
-4867,
-4866,
-4866,
-4865,
-4865,
-4865,
-4864,
-4864,
-4864,
-4863,
-4863,
-4862,
-4862,
-4862,
-4861,
-4861,
-4860,
-4860,
-4860,
-4859,
-4859,
-4859,
-4858,
-4858,
-4857,
-4857,
-4857,
-4856,
-4856,
-4855,
-4855,
-4855,
-4854,
-4854,
-4854,
-4853,
-4853,
-4852,
-4852,
-4852,
-4851,
-4851,
-4850,
-4850,
-4850,
-4849,
-4849,
-4849,
-4848,
-4848,
-4847,
-4847,
-4847,
-4846,
-4846,
-4845,
-4845,
-4845,
-4844,
-4844,
-4844,
-4843,
-4843,
-4842,
-4842,
-4842,
-4841,
-4841,
-4840,
-4840,
-4840,
-4839,
-4839,
-4839,
-4838,
-4838,
-4837,
-4837,
-4837,
-4836,
-4836,
-4835,
-4835,
-4835,
-4834,
-4834,
-4834,
-4833,
-4833,
-4832,
-4832,
-4832,
-4831,
-4831,
-4830,
-4830,
-4830,
-4829,
-4829,
-4829,
-4828,
-4828,
-4827,
-4827,
-4827,
-4826,
-4826,
-4825,
-4825,
-4825,
-4824,
-4824,
-4824,
-4823,
-4823,
-4822,
-4822,
-4822,
-4821,
-4821,
-4821,
-4820,
-4820,
-4819,
-4819,
-4819,
-4818,
-4818,
-4817,
-4817,
-4817,
-4816,
-4816,
-4816,
-4815,
-4815,
-4814,
-4814,
-4814,
-4813,
-4813,
-4812,
-4812,
-4812,
-4811,
-4811,
-4811,
-4810,
-4810,
-4809,
-4809,
-4809,
-4808,
-4808,
-4808,
-4807,
-4807,
-4806,
-4806,
-4806,
-4805,
-4805,
-4804,
-4804,
-4804,
-4803,
-4803,
-4803,
-4802,
-4802,
-4801,
-4801,
-4801,
-4800,
-4800,
-4800,
-4799,
-4799,
-4798,
-4798,
-4798,
-4797,
-4797,
-4796,
-4796,
-4796,
-4795,
-4795,
-4795,
-4794,
-4794,
-4793,
-4793,
-4793,
-4792,
-4792,
-4792,
-4791,
-4791,
-4790,
-4790,
-4790,
-4789,
-4789,
-4788,
-4788,
-4788,
-4787,
-4787,
-4787,
-4786,
-4786,
-4785,
-4785,
-4785,
-4784,
-4784,
-4784,
-4783,
-4783,
-4782,
-4782,
-4782,
-4781,
-4781,
-4780,
-4780,
-4780,
-4779,
-4779,
-4779,
-4778,
-4778,
-4777,
-4777,
-4777,
-4776,
-4776,
-4776,
-4775,
-4775,
-4774,
-4774,
-4774,
-4773,
-4773,
-4773,
-4772,
-4772,
-4771,
-4771,
-4771,
-4770,
-4770,
-4769,
-4769,
-4769,
-4768,
-4768,
-4768,
-4767,
-4767,
-4766,
-4766,
-4766,
-4765,
-4765,
-4765,
-4764,
-4764,
-4763,
-4763,
-4763,
-4762,
-4762,
-4762,
-4761,
-4761,
-4760,
-4760,
-4760,
-4759,
-4759,
-4758,
-4758,
-4758,
-4757,
-4757,
-4757,
-4756,
-4756,
-4755,
-4755,
-4755,
-4754,
-4754,
-4754,
-4753,
-4753,
-4752,
-4752,
-4752,
-4751,
-4751,
-4751,
-4750,
-4750,
-4749,
-4749,
-4749,
-4748,
-4748,
-4748,
-4747,
-4747,
-4746,
-4746,
-4746,
-4745,
-4745,
-4745,
-4744,
-4744,
-4743,
-4743,
-4743,
-4742,
-4742,
-4741,
-4741,
-4741,
-4740,
-4740,
-4740,
-4739,
-4739,
-4738,
-4738,
-4738,
-4737,
-4737,
-4737,
-4736,
-4736,
-4735,
-4735,
-4735,
-4734,
-4734,
-4734,
-4733,
-4733,
-4732,
-4732,
-4732,
-4731,
-4731,
-4731,
-4730,
-4730,
-4729,
-4729,
-4729,
-4728,
-4728,
-4728,
-4727,
-4727,
-4726,
-4726,
-4726,
-4725,
-4725,
-4725,
-4724,
-4724,
-4723,
-4723,
-4723,
-4722,
-4722,
-4722,
-4721,
-4721,
-4720,
-4720,
-4720,
-4719,
-4719,
-4718,
-4718,
-4718,
-4717,
-4717,
-4717,
-4716,
-4716,
-4715,
-4715,
-4715,
-4714,
-4714,
-4714,
-4713,
-4713,
-4712,
-4712,
-4712,
-4711,
-4711,
-4711,
-4710,
-4710,
-4709,
-4709,
-4709,
-4708,
-4708,
-4708,
-4707,
-4707,
-4706,
-4706,
-4706,
-4705,
-4705,
-4705,
-4704,
-4704,
-4703,
-4703,
-4703,
-4702,
-4702,
-4702,
-4701,
-4701,
-4700,
-4700,
-4700,
-4699,
-4699,
-4699,
-4698,
-4698,
-4697,
-4697,
-4697,
-4696,
-4696,
-4696,
-4695,
-4695,
-4694,
-4694,
-4694,
-4693,
-4693,
-4693,
-4692,
-4692,
-4691,
-4691,
-4691,
-4690,
-4690,
-4690,
-4689,
-4689,
-4688,
-4688,
-4688,
-4687,
-4687,
-4687,
-4686,
-4686,
-4685,
-4685,
-4685,
-4684,
-4684,
-4684,
-4683,
-4683,
-4682,
-4682,
-4682,
-4681,
-4681,
-4681,
-4680,
-4680,
-4679,
-4679,
-4679,
-4678,
-4678,
-4678,
-4677,
-4677,
-4677,
-4676,
-4676,
-4675,
-4675,
-4675,
-4674,
-4674,
-4674,
-4673,
-4673,
-4672,
-4672,
-4672,
-4671,
-4671,
-4671,
-4670,
-4670,
-4669,
-4669,
-4669,
-4668,
-4668,
-4668,
-4667,
-4667,
-4666,
-4666,
-4666,
-4665,
-4665,
-4665,
-4664,
-4664,
-4663,
-4663,
-4663,
-4662,
-4662,
-4662,
-4661,
-4661,
-4660,
-4660,
-4660,
-4659,
-4659,
-4659,
-4658,
-4658,
-4657,
-4657,
-4657,
-4656,
-4656,
-4656,
-4655,
-4655,
-4655,
-4654,
-4654,
-4653,
-4653,
-4653,
-4652,
-4652,
-4652,
-4651,
-4651,
-4650,
-4650,
-4650,
-4649,
-4649,
-4649,
-4648,
-4648,
-4647,
-4647,
-4647,
-4646,
-4646,
-4646,
-4645,
-4645,
-4644,
-4644,
-4644,
-4643,
-4643,
-4643,
-4642,
-4642,
-4642,
-4641,
-4641,
-4640,
-4640,
-4640,
-4639,
-4639,
-4639,
-4638,
-4638,
-4637,
-4637,
-4637,
-4636,
-4636,
-4636,
-4635,
-4635,
-4634,
-4634,
-4634,
-4633,
-4633,
-4633,
-4632,
-4632,
-4631,
-4631,
-4631,
-4630,
-4630,
-4630,
-4629,
-4629,
-4629,
-4628,
-4628,
-4627,
-4627,
-4627,
-4626,
-4626,
-4626,
-4625,
-4625,
-4624,
-4624,
-4624,
-4623,
-4623,
-4623,
-4622,
-4622,
-4621,
-4621,
-4621,
-4620,
-4620,
-4620,
-4619,
-4619,
-4619,
-4618,
-4618,
-4617,
-4617,
-4617,
-4616,
-4616,
-4616,
-4615,
-4615,
-4614,
-4614,
-4614,
-4613,
-4613,
-4613,
-4612,
-4612,
-4612,
-4611,
-4611,
-4610,
-4610,
-4610,
-4609,
-4609,
-4609,
-4608,
-4608,
-4607,
-4607,
-4607,
-4606,
-4606,
-4606,
-4605,
-4605,
-4604,
-4604,
-4604,
-4603,
-4603,
-4603,
-4602,
-4602,
-4602,
-4601,
-4601,
-4600,
-4600,
-4600,
-4599,
-4599,
-4599,
-4598,
-4598,
-4597,
-4597,
-4597,
-4596,
-4596,
-4596,
-4595,
-4595,
-4595,
-4594,
-4594,
-4593,
-4593,
-4593,
-4592,
-4592,
-4592,
-4591,
-4591,
-4590,
-4590,
-4590,
-4589,
-4589,
-4589,
-4588,
-4588,
-4588,
-4587,
-4587,
-4586,
-4586,
-4586,
-4585,
-4585,
-4585,
-4584,
-4584,
-4583,
-4583,
-4583,
-4582,
-4582,
-4582,
-4581,
-4581,
-4581,
-4580,
-4580,
-4579,
-4579,
-4579,
-4578,
-4578,
-4578,
-4577,
-4577,
-4577,
-4576,
-4576,
-4575,
-4575,
-4575,
-4574,
-4574,
-4574,
-4573,
-4573,
-4572,
-4572,
-4572,
-4571,
-4571,
-4571,
-4570,
-4570,
-4570,
-4569,
-4569,
-4568,
-4568,
-4568,
-4567,
-4567,
-4567,
-4566,
-4566,
-4566,
-4565,
-4565,
-4564,
-4564,
-4564,
-4563,
-4563,
-4563,
-4562,
-4562,
-4561,
-4561,
-4561,
-4560,
-4560,
-4560,
-4559,
-4559,
-4559,
-4558,
-4558,
-4557,
-4557,
-4557,
-4556,
-4556,
-4556,
-4555,
-4555,
-4555,
-4554,
-4554,
-4553,
-4553,
-4553,
-4552,
-4552,
-4552,
-4551,
-4551,
-4550,
-4550,
-4550,
-4549,
-4549,
-4549,
-4548,
-4548,
-4548,
-4547,
-4547,
-4546,
-4546,
-4546,
-4545,
-4545,
-4545,
-4544,
-4544,
-4544,
-4543,
-4543,
-4542,
-4542,
-4542,
-4541,
-4541,
-4541,
-4540,
-4540,
-4540,
-4539,
-4539,
-4538,
-4538,
-4538,
-4537,
-4537,
-4537,
-4536,
-4536,
-4536,
-4535,
-4535,
-4534,
-4534,
-4534,
-4533,
-4533,
-4533,
-4532,
-4532,
-4532,
-4531,
-4531,
-4530,
-4530,
-4530,
-4529,
-4529,
-4529,
-4528,
-4528,
-4528,
-4527,
-4527,
-4526,
-4526,
-4526,
-4525,
-4525,
-4525,
-4524,
-4524,
-4524,
-4523,
-4523,
-4522,
-4522,
-4522,
-4521,
-4521,
-4521,
-4520,
-4520,
-4520,
-4519,
-4519,
-4518,
-4518,
-4518,
-4517,
-4517,
-4517,
-4516,
-4516,
-4516,
-4515,
-4515,
-4514,
-4514,
-4514,
-4513,
-4513,
-4513,
-4512,
-4512,
-4512,
-4511,
-4511,
-4510,
-4510,
-4510,
-4509,
-4509,
-4509,
-4508,
-4508,
-4508,
-4507,
-4507,
-4506,
-4506,
-4506,
-4505,
-4505,
-4505,
-4504,
-4504,
-4504,
-4503,
-4503,
-4502,
-4502,
-4502,
-4501,
-4501,
-4501,
-4500,
-4500,
-4500,
-4499,
-4499,
-4498,
-4498,
-4498,
-4497,
-4497,
-4497,
-4496,
-4496,
-4496,
-4495,
-4495,
-4494,
-4494,
-4494,
-4493,
-4493,
-4493,
-4492,
-4492,
-4492,
-4491,
-4491,
-4490,
-4490,
-4490,
-4489,
-4489,
-4489,
-4488,
-4488,
-4488,
-4487,
-4487,
-4487,
-4486,
-4486,
-4485,
-4485,
-4485,
-4484,
-4484,
-4484,
-4483,
-4483,
-4483,
-4482,
-4482,
-4481,
-4481,
-4481,
-4480,
-4480,
-4480,
-4479,
-4479,
-4479,
-4478,
-4478,
-4477,
-4477,
-4477,
-4476,
-4476,
-4476,
-4475,
-4475,
-4475,
-4474,
-4474,
-4474,
-4473,
-4473,
-4472,
-4472,
-4472,
-4471,
-4471,
-4471,
-4470,
-4470,
-4470,
-4469,
-4469,
-4468,
-4468,
-4468,
-4467,
-4467,
-4467,
-4466,
-4466,
-4466,
-4465,
-4465,
-4465,
-4464,
-4464,
-4463,
-4463,
-4463,
-4462,
-4462,
-4462,
-4461,
-4461,
-4461,
-4460,
-4460,
-4459,
-4459,
-4459,
-4458,
-4458,
-4458,
-4457,
-4457,
-4457,
-4456,
-4456,
-4456,
-4455,
-4455,
-4454,
-4454,
-4454,
-4453,
-4453,
-4453,
-4452,
-4452,
-4452,
-4451,
-4451,
-4450,
-4450,
-4450,
-4449,
-4449,
-4449,
-4448,
-4448,
-4448,
-4447,
-4447,
-4447,
-4446,
-4446,
-4445,
-4445,
-4445,
-4444,
-4444,
-4444,
-4443,
-4443,
-4443,
-4442,
-4442,
-4442,
-4441,
-4441,
-4440,
-4440,
-4440,
-4439,
-4439,
-4439,
-4438,
-4438,
-4438,
-4437,
-4437,
-4436,
-4436,
-4436,
-4435,
-4435,
-4435,
-4434,
-4434,
-4434,
-4433,
-4433,
-4433,
-4432,
-4432,
-4431,
-4431,
-4431,
-4430,
-4430,
-4430,
-4429,
-4429,
-4429,
-4428,
-4428,
-4428,
-4427,
-4427,
-4426,
-4426,
-4426,
-4425,
-4425,
-4425,
-4424,
-4424,
-4424,
-4423,
-4423,
-4423,
-4422,
-4422,
-4421,
-4421,
-4421,
-4420,
-4420,
-4420,
-4419,
-4419,
-4419,
-4418,
-4418,
-4418,
-4417,
-4417,
-4416,
-4416,
-4416,
-4415,
-4415,
-4415,
-4414,
-4414,
-4414,
-4413,
-4413,
-4413,
-4412,
-4412,
-4411,
-4411,
-4411,
-4410,
-4410,
-4410,
-4409,
-4409,
-4409,
-4408,
-4408,
-4408,
-4407,
-4407,
-4406,
-4406,
-4406,
-4405,
-4405,
-4405,
-4404,
-4404,
-4404,
-4403,
-4403,
-4403,
-4402,
-4402,
-4401,
-4401,
-4401,
-4400,
-4400,
-4400,
-4399,
-4399,
-4399,
-4398,
-4398,
-4398,
-4397,
-4397,
-4397,
-4396,
-4396,
-4395,
-4395,
-4395,
-4394,
-4394,
-4394,
-4393,
-4393,
-4393,
-4392,
-4392,
-4392,
-4391,
-4391,
-4390,
-4390,
-4390,
-4389,
-4389,
-4389,
-4388,
-4388,
-4388,
-4387,
-4387,
-4387,
-4386,
-4386,
-4385,
-4385,
-4385,
-4384,
-4384,
-4384,
-4383,
-4383,
-4383,
-4382,
-4382,
-4382,
-4381,
-4381,
-4381,
-4380,
-4380,
-4379,
-4379,
-4379,
-4378,
-4378,
-4378,
-4377,
-4377,
-4377,
-4376,
-4376,
-4376,
-4375,
-4375,
-4374,
-4374,
-4374,
-4373,
-4373,
-4373,
-4372,
-4372,
-4372,
-4371,
-4371,
-4371,
-4370,
-4370,
-4370,
-4369,
-4369,
-4368,
-4368,
-4368,
-4367,
-4367,
-4367,
-4366,
-4366,
-4366,
-4365,
-4365,
-4365,
-4364,
-4364,
-4364,
-4363,
-4363,
-4362,
-4362,
-4362,
-4361,
-4361,
-4361,
-4360,
-4360,
-4360,
-4359,
-4359,
-4359,
-4358,
-4358,
-4358,
-4357,
-4357,
-4356,
-4356,
-4356,
-4355,
-4355,
-4355,
-4354,
-4354,
-4354,
-4353,
-4353,
-4353,
-4352,
-4352,
-4352,
-4351,
-4351,
-4350,
-4350,
-4350,
-4349,
-4349,
-4349,
-4348,
-4348,
-4348,
-4347,
-4347,
-4347,
-4346,
-4346,
-4346,
-4345,
-4345,
-4344,
-4344,
-4344,
-4343,
-4343,
-4343,
-4342,
-4342,
-4342,
-4341,
-4341,
-4341,
-4340,
-4340,
-4340,
-4339,
-4339,
-4338,
-4338,
-4338,
-4337,
-4337,
-4337,
-4336,
-4336,
-4336,
-4335,
-4335,
-4335,
-4334,
-4334,
-4334,
-4333,
-4333,
-4332,
-4332,
-4332,
-4331,
-4331,
-4331,
-4330,
-4330,
-4330,
-4329,
-4329,
-4329,
-4328,
-4328,
-4328,
-4327,
-4327,
-4327,
-4326,
-4326,
-4325,
-4325,
-4325,
-4324,
-4324,
-4324,
-4323,
-4323,
-4323,
-4322,
-4322,
-4322,
-4321,
-4321,
-4321,
-4320,
-4320,
-4320,
-4319,
-4319,
-4318,
-4318,
-4318,
-4317,
-4317,
-4317,
-4316,
-4316,
-4316,
-4315,
-4315,
-4315,
-4314,
-4314,
-4314,
-4313,
-4313,
-4312,
-4312,
-4312,
-4311,
-4311,
-4311,
-4310,
-4310,
-4310,
-4309,
-4309,
-4309,
-4308,
-4308,
-4308,
-4307,
-4307,
-4307,
-4306,
-4306,
-4305,
-4305,
-4305,
-4304,
-4304,
-4304,
-4303,
-4303,
-4303,
-4302,
-4302,
-4302,
-4301,
-4301,
-4301,
-4300,
-4300,
-4300,
-4299,
-4299,
-4298,
-4298,
-4298,
-4297,
-4297,
-4297,
-4296,
-4296,
-4296,
-4295,
-4295,
-4295,
-4294,
-4294,
-4294,
-4293,
-4293,
-4293,
-4292,
-4292,
-4292,
-4291,
-4291,
-4290,
-4290,
-4290,
-4289,
-4289,
-4289,
-4288,
-4288,
-4288,
-4287,
-4287,
-4287,
-4286,
-4286,
-4286,
-4285,
-4285,
-4285,
-4284,
-4284,
-4283,
-4283,
-4283,
-4282,
-4282,
-4282,
-4281,
-4281,
-4281,
-4280,
-4280,
-4280,
-4279,
-4279,
-4279,
-4278,
-4278,
-4278,
-4277,
-4277,
-4277,
-4276,
-4276,
-4275,
-4275,
-4275,
-4274,
-4274,
-4274,
-4273,
-4273,
-4273,
-4272,
-4272,
-4272,
-4271,
-4271,
-4271,
-4270,
-4270,
-4270,
-4269,
-4269,
-4269,
-4268,
-4268,
-4267,
-4267,
-4267,
-4266,
-4266,
-4266,
-4265,
-4265,
-4265,
-4264,
-4264,
-4264,
-4263,
-4263,
-4263,
-4262,
-4262,
-4262,
-4261,
-4261,
-4261,
-4260,
-4260,
-4260,
-4259,
-4259,
-4258,
-4258,
-4258,
-4257,
-4257,
-4257,
-4256,
-4256,
-4256,
-4255,
-4255,
-4255,
-4254,
-4254,
-4254,
-4253,
-4253,
-4253,
-4252,
-4252,
-4252,
-4251,
-4251,
-4251,
-4250,
-4250,
-4249,
-4249,
-4249,
-4248,
-4248,
-4248,
-4247,
-4247,
-4247,
-4246,
-4246,
-4246,
-4245,
-4245,
-4245,
-4244,
-4244,
-4244,
-4243,
-4243,
-4243,
-4242,
-4242,
-4242,
-4241,
-4241,
-4240,
-4240,
-4240,
-4239,
-4239,
-4239,
-4238,
-4238,
-4238,
-4237,
-4237,
-4237,
-4236,
-4236,
-4236,
-4235,
-4235,
-4235,
-4234,
-4234,
-4234,
-4233,
-4233,
-4233,
-4232,
-4232,
-4231,
-4231,
-4231,
-4230,
-4230,
-4230,
-4229,
-4229,
-4229,
-4228,
-4228,
-4228,
-4227,
-4227,
-4227,
-4226,
-4226,
-4226,
-4225,
-4225,
-4225,
-4224,
-4224,
-4224,
-4223,
-4223,
-4223,
-4222,
-4222,
-4221,
-4221,
-4221,
-4220,
-4220,
-4220,
-4219,
-4219,
-4219,
-4218,
-4218,
-4218,
-4217,
-4217,
-4217,
-4216,
-4216,
-4216,
-4215,
-4215,
-4215,
-4214,
-4214,
-4214,
-4213,
-4213,
-4213,
-4212,
-4212,
-4212,
-4211,
-4211,
-4210,
-4210,
-4210,
-4209,
-4209,
-4209,
-4208,
-4208,
-4208,
-4207,
-4207,
-4207,
-4206,
-4206,
-4206,
-4205,
-4205,
-4205,
-4204,
-4204,
-4204,
-4203,
-4203,
-4203,
-4202,
-4202,
-4202,
-4201,
-4201,
-4201,
-4200,
-4200,
-4200,
-4199,
-4199,
-4198,
-4198,
-4198,
-4197,
-4197,
-4197,
-4196,
-4196,
-4196,
-4195,
-4195,
-4195,
-4194,
-4194,
-4194,
-4193,
-4193,
-4193,
-4192,
-4192,
-4192,
-4191,
-4191,
-4191,
-4190,
-4190,
-4190,
-4189,
-4189,
-4189,
-4188,
-4188,
-4188,
-4187,
-4187,
-4186,
-4186,
-4186,
-4185,
-4185,
-4185,
-4184,
-4184,
-4184,
-4183,
-4183,
-4183,
-4182,
-4182,
-4182,
-4181,
-4181,
-4181,
-4180,
-4180,
-4180,
-4179,
-4179,
-4179,
-4178,
-4178,
-4178,
-4177,
-4177,
-4177,
-4176,
-4176,
-4176,
-4175,
-4175,
-4175,
-4174,
-4174,
-4174,
-4173,
-4173,
-4172,
-4172,
-4172,
-4171,
-4171,
-4171,
-4170,
-4170,
-4170,
-4169,
-4169,
-4169,
-4168,
-4168,
-4168,
-4167,
-4167,
-4167,
-4166,
-4166,
-4166,
-4165,
-4165,
-4165,
-4164,
-4164,
-4164,
-4163,
-4163,
-4163,
-4162,
-4162,
-4162,
-4161,
-4161,
-4161,
-4160,
-4160,
-4160,
-4159,
-4159,
-4159,
-4158,
-4158,
-4157,
-4157,
-4157,
-4156,
-4156,
-4156,
-4155,
-4155,
-4155,
-4154,
-4154,
-4154,
-4153,
-4153,
-4153,
-4152,
-4152,
-4152,
-4151,
-4151,
-4151,
-4150,
-4150,
-4150,
-4149,
-4149,
-4149,
-4148,
-4148,
-4148,
-4147,
-4147,
-4147,
-4146,
-4146,
-4146,
-4145,
-4145,
-4145,
-4144,
-4144,
-4144,
-4143,
-4143,
-4143,
-4142,
-4142,
-4142,
-4141,
-4141,
-4141,
-4140,
-4140,
-4139,
-4139,
-4139,
-4138,
-4138,
-4138,
-4137,
-4137,
-4137,
-4136,
-4136,
-4136,
-4135,
-4135,
-4135,
-4134,
-4134,
-4134,
-4133,
-4133,
-4133,
-4132,
-4132,
-4132,
-4131,
-4131,
-4131,
-4130,
-4130,
-4130,
-4129,
-4129,
-4129,
-4128,
-4128,
-4128,
-4127,
-4127,
-4127,
-4126,
-4126,
-4126,
-4125,
-4125,
-4125,
-4124,
-4124,
-4124,
-4123,
-4123,
-4123,
-4122,
-4122,
-4122,
-4121,
-4121,
-4121,
-4120,
-4120,
-4120,
-4119,
-4119,
-4119,
-4118,
-4118,
-4118,
-4117,
-4117,
-4117,
-4116,
-4116,
-4115,
-4115,
-4115,
-4114,
-4114,
-4114,
-4113,
-4113,
-4113,
-4112,
-4112,
-4112,
-4111,
-4111,
-4111,
-4110,
-4110,
-4110,
-4109,
-4109,
-4109,
-4108,
-4108,
-4108,
-4107,
-4107,
-4107,
-4106,
-4106,
-4106,
-4105,
-4105,
-4105,
-4104,
-4104,
-4104,
-4103,
-4103,
-4103,
-4102,
-4102,
-4102,
-4101,
-4101,
-4101,
-4100,
-4100,
-4100,
-4099,
-4099,
-4099,
-4098,
-4098,
-4098,
-4097,
-4097,
-4097,
-4096,
-4096,
-4096,
-4095,
-4095,
-4095,
-4094,
-4094,
-4094,
-4093,
-4093,
-4093,
-4092,
-4092,
-4092,
-4091,
-4091,
-4091,
-4090,
-4090,
-4090,
-4089,
-4089,
-4089,
-4088,
-4088,
-4088,
-4087,
-4087,
-4087,
-4086,
-4086,
-4086,
-4085,
-4085,
-4085,
-4084,
-4084,
-4084,
-4083,
-4083,
-4083,
-4082,
-4082,
-4082,
-4081,
-4081,
-4081,
-4080,
-4080,
-4080,
-4079,
-4079,
-4079,
-4078,
-4078,
-4078,
-4077,
-4077,
-4077,
-4076,
-4076,
-4076,
-4075,
-4075,
-4074,
-4074,
-4074,
-4073,
-4073,
-4073,
-4072,
-4072,
-4072,
-4071,
-4071,
-4071,
-4070,
-4070,
-4070,
-4069,
-4069,
-4069,
-4068,
-4068,
-4068,
-4067,
-4067,
-4067,
-4066,
-4066,
-4066,
-4065,
-4065,
-4065,
-4064,
-4064,
-4064,
-4063,
-4063,
-4063,
-4062,
-4062,
-4062,
-4061,
-4061,
-4061,
-4060,
-4060,
-4060,
-4059,
-4059,
-4059,
-4058,
-4058,
-4058,
-4057,
-4057,
-4057,
-4056,
-4056,
-4056,
-4055,
-4055,
-4055,
-4054,
-4054,
-4054,
-4053,
-4053,
-4053,
-4052,
-4052,
-4052,
-4051,
-4051,
-4051,
-4050,
-4050,
-4050,
-4049,
-4049,
-4049,
-4048,
-4048,
-4048,
-4047,
-4047,
-4047,
-4046,
-4046,
-4046,
-4045,
-4045,
-4045,
-4044,
-4044,
-4044,
-4043,
-4043,
-4043,
-4042,
-4042,
-4042,
-4041,
-4041,
-4041,
-4040,
-4040,
-4040,
-4039,
-4039,
-4039,
-4038,
-4038,
-4038,
-4037,
-4037,
-4037,
-4036,
-4036,
-4036,
-4035,
-4035,
-4035,
-4035,
-4034,
-4034,
-4034,
-4033,
-4033,
-4033,
-4032,
-4032,
-4032,
-4031,
-4031,
-4031,
-4030,
-4030,
-4030,
-4029,
-4029,
-4029,
-4028,
-4028,
-4028,
-4027,
-4027,
-4027,
-4026,
-4026,
-4026,
-4025,
-4025,
-4025,
-4024,
-4024,
-4024,
-4023,
-4023,
-4023,
-4022,
-4022,
-4022,
-4021,
-4021,
-4021,
-4020,
-4020,
-4020,
-4019,
-4019,
-4019,
-4018,
-4018,
-4018,
-4017,
-4017,
-4017,
-4016,
-4016,
-4016,
-4015,
-4015,
-4015,
-4014,
-4014,
-4014,
-4013,
-4013,
-4013,
-4012,
-4012,
-4012,
-4011,
-4011,
-4011,
-4010,
-4010,
-4010,
-4009,
-4009,
-4009,
-4008,
-4008,
-4008,
-4007,
-4007,
-4007,
-4006,
-4006,
-4006,
-4005,
-4005,
-4005,
-4004,
-4004,
-4004,
-4003,
-4003,
-4003,
-4002,
-4002,
-4002,
-4001,
-4001,
-4001,
-4000,
-4000,
-4000,
-3999,
-3999,
-3999,
-3998,
-3998,
-3998,
-3997,
-3997,
-3997,
-3996,
-3996,
-3996,
-3995,
-3995,
-3995,
-3994,
-3994,
-3994,
-3994,
-3993,
-3993,
-3993,
-3992,
-3992,
-3992,
-3991,
-3991,
-3991,
-3990,
-3990,
-3990,
-3989,
-3989,
-3989,
-3988,
-3988,
-3988,
-3987,
-3987,
-3987,
-3986,
-3986,
-3986,
-3985,
-3985,
-3985,
-3984,
-3984,
-3984,
-3983,
-3983,
-3983,
-3982,
-3982,
-3982,
-3981,
-3981,
-3981,
-3980,
-3980,
-3980,
-3979,
-3979,
-3979,
-3978,
-3978,
-3978,
-3977,
-3977,
-3977,
-3976,
-3976,
-3976,
-3975,
-3975,
-3975,
-3974,
-3974,
-3974,
-3973,
-3973,
-3973,
-3972,
-3972,
-3972,
-3971,
-3971,
-3971,
-3971,
-3970,
-3970,
-3970,
-3969,
-3969,
-3969,
-3968,
-3968,
-3968,
-3967,
-3967,
-3967,
-3966,
-3966,
-3966,
-3965,
-3965,
-3965,
-3964,
-3964,
-3964,
-3963,
-3963,
-3963,
-3962,
-3962,
-3962,
-3961,
-3961,
-3961,
-3960,
-3960,
-3960,
-3959,
-3959,
-3959,
-3958,
-3958,
-3958,
-3957,
-3957,
-3957,
-3956,
-3956,
-3956,
-3955,
-3955,
-3955,
-3954,
-3954,
-3954,
-3954,
-3953,
-3953,
-3953,
-3952,
-3952,
-3952,
-3951,
-3951,
-3951,
-3950,
-3950,
-3950,
-3949,
-3949,
-3949,
-3948,
-3948,
-3948,
-3947,
-3947,
-3947,
-3946,
-3946,
-3946,
-3945,
-3945,
-3945,
-3944,
-3944,
-3944,
-3943,
-3943,
-3943,
-3942,
-3942,
-3942,
-3941,
-3941,
-3941,
-3940,
-3940,
-3940,
-3939,
-3939,
-3939,
-3939,
-3938,
-3938,
-3938,
-3937,
-3937,
-3937,
-3936,
-3936,
-3936,
-3935,
-3935,
-3935,
-3934,
-3934,
-3934,
-3933,
-3933,
-3933,
-3932,
-3932,
-3932,
-3931,
-3931,
-3931,
-3930,
-3930,
-3930,
-3929,
-3929,
-3929,
-3928,
-3928,
-3928,
-3927,
-3927,
-3927,
-3926,
-3926,
-3926,
-3926,
-3925,
-3925,
-3925,
-3924,
-3924,
-3924,
-3923,
-3923,
-3923,
-3922,
-3922,
-3922,
-3921,
-3921,
-3921,
-3920,
-3920,
-3920,
-3919,
-3919,
-3919,
-3918,
-3918,
-3918,
-3917,
-3917,
-3917,
-3916,
-3916,
-3916,
-3915,
-3915,
-3915,
-3914,
-3914,
-3914,
-3914,
-3913,
-3913,
-3913,
-3912,
-3912,
-3912,
-3911,
-3911,
-3911,
-3910,
-3910,
-3910,
-3909,
-3909,
-3909,
-3908,
-3908,
-3908,
-3907,
-3907,
-3907,
-3906,
-3906,
-3906,
-3905,
-3905,
-3905,
-3904,
-3904,
-3904,
-3903,
-3903,
-3903,
-3903,
-3902,
-3902,
-3902,
-3901,
-3901,
-3901,
-3900,
-3900,
-3900,
-3899,
-3899,
-3899,
-3898,
-3898,
-3898,
-3897,
-3897,
-3897,
-3896,
-3896,
-3896,
-3895,
-3895,
-3895,
-3894,
-3894,
-3894,
-3893,
-3893,
-3893,
-3893,
-3892,
-3892,
-3892,
-3891,
-3891,
-3891,
-3890,
-3890,
-3890,
-3889,
-3889,
-3889,
-3888,
-3888,
-3888,
-3887,
-3887,
-3887,
-3886,
-3886,
-3886,
-3885,
-3885,
-3885,
-3884,
-3884,
-3884,
-3883,
-3883,
-3883,
-3883,
-3882,
-3882,
-3882,
-3881,
-3881,
-3881,
-3880,
-3880,
-3880,
-3879,
-3879,
-3879,
-3878,
-3878,
-3878,
-3877,
-3877,
-3877,
-3876,
-3876,
-3876,
-3875,
-3875,
-3875,
-3874,
-3874,
-3874,
-3874,
-3873,
-3873,
-3873,
-3872,
-3872,
-3872,
-3871,
-3871,
-3871,
-3870,
-3870,
-3870,
-3869,
-3869,
-3869,
-3868,
-3868,
-3868,
-3867,
-3867,
-3867,
-3866,
-3866,
-3866,
-3865,
-3865,
-3865,
-3865,
-3864,
-3864,
-3864,
-3863,
-3863,
-3863,
-3862,
-3862,
-3862,
-3861,
-3861,
-3861,
-3860,
-3860,
-3860,
-3859,
-3859,
-3859,
-3858,
-3858,
-3858,
-3857,
-3857,
-3857,
-3857,
-3856,
-3856,
-3856,
-3855,
-3855,
-3855,
-3854,
-3854,
-3854,
-3853,
-3853,
-3853,
-3852,
-3852,
-3852,
-3851,
-3851,
-3851,
-3850,
-3850,
-3850,
-3849,
-3849,
-3849,
-3849,
-3848,
-3848,
-3848,
-3847,
-3847,
-3847,
-3846,
-3846,
-3846,
-3845,
-3845,
-3845,
-3844,
-3844,
-3844,
-3843,
-3843,
-3843,
-3842,
-3842,
-3842,
-3842,
-3841,
-3841,
-3841,
-3840,
-3840,
-3840,
-3839,
-3839,
-3839,
-3838,
-3838,
-3838,
-3837,
-3837,
-3837,
-3836,
-3836,
-3836,
-3835,
-3835,
-3835,
-3835,
-3834,
-3834,
-3834,
-3833,
-3833,
-3833,
-3832,
-3832,
-3832,
-3831,
-3831,
-3831,
-3830,
-3830,
-3830,
-3829,
-3829,
-3829,
-3828,
-3828,
-3828,
-3827,
-3827,
-3827,
-3827,
-3826,
-3826,
-3826,
-3825,
-3825,
-3825,
-3824,
-3824,
-3824,
-3823,
-3823,
-3823,
-3822,
-3822,
-3822,
-3821,
-3821,
-3821,
-3821,
-3820,
-3820,
-3820,
-3819,
-3819,
-3819,
-3818,
-3818,
-3818,
-3817,
-3817,
-3817,
-3816,
-3816,
-3816,
-3815,
-3815,
-3815,
-3814,
-3814,
-3814,
-3814,
-3813,
-3813,
-3813,
-3812,
-3812,
-3812,
-3811,
-3811,
-3811,
-3810,
-3810,
-3810,
-3809,
-3809,
-3809,
-3808,
-3808,
-3808,
-3808,
-3807,
-3807,
-3807,
-3806,
-3806,
-3806,
-3805,
-3805,
-3805,
-3804,
-3804,
-3804,
-3803,
-3803,
-3803,
-3802,
-3802,
-3802,
-3801,
-3801,
-3801,
-3801,
-3800,
-3800,
-3800,
-3799,
-3799,
-3799,
-3798,
-3798,
-3798,
-3797,
-3797,
-3797,
-3796,
-3796,
-3796,
-3795,
-3795,
-3795,
-3795,
-3794,
-3794,
-3794,
-3793,
-3793,
-3793,
-3792,
-3792,
-3792,
-3791,
-3791,
-3791,
-3790,
-3790,
-3790,
-3789,
-3789,
-3789,
-3789,
-3788,
-3788,
-3788,
-3787,
-3787,
-3787,
-3786,
-3786,
-3786,
-3785,
-3785,
-3785,
-3784,
-3784,
-3784,
-3784,
-3783,
-3783,
-3783,
-3782,
-3782,
-3782,
-3781,
-3781,
-3781,
-3780,
-3780,
-3780,
-3779,
-3779,
-3779,
-3778,
-3778,
-3778,
-3778,
-3777,
-3777,
-3777,
-3776,
-3776,
-3776,
-3775,
-3775,
-3775,
-3774,
-3774,
-3774,
-3773,
-3773,
-3773,
-3772,
-3772,
-3772,
-3772,
-3771,
-3771,
-3771,
-3770,
-3770,
-3770,
-3769,
-3769,
-3769,
-3768,
-3768,
-3768,
-3767,
-3767,
-3767,
-3767,
-3766,
-3766,
-3766,
-3765,
-3765,
-3765,
-3764,
-3764,
-3764,
-3763,
-3763,
-3763,
-3762,
-3762,
-3762,
-3762,
-3761,
-3761,
-3761,
-3760,
-3760,
-3760,
-3759,
-3759,
-3759,
-3758,
-3758,
-3758,
-3757,
-3757,
-3757,
-3756,
-3756,
-3756,
-3756,
-3755,
-3755,
-3755,
-3754,
-3754,
-3754,
-3753,
-3753,
-3753,
-3752,
-3752,
-3752,
-3751,
-3751,
-3751,
-3751,
-3750,
-3750,
-3750,
-3749,
-3749,
-3749,
-3748,
-3748,
-3748,
-3747,
-3747,
-3747,
-3746,
-3746,
-3746,
-3746,
-3745,
-3745,
-3745,
-3744,
-3744,
-3744,
-3743,
-3743,
-3743,
-3742,
-3742,
-3742,
-3741,
-3741,
-3741,
-3741,
-3740,
-3740,
-3740,
-3739,
-3739,
-3739,
-3738,
-3738,
-3738,
-3737,
-3737,
-3737,
-3736,
-3736,
-3736,
-3736,
-3735,
-3735,
-3735,
-3734,
-3734,
-3734,
-3733,
-3733,
-3733,
-3732,
-3732,
-3732,
-3732,
-3731,
-3731,
-3731,
-3730,
-3730,
-3730,
-3729,
-3729,
-3729,
-3728,
-3728,
-3728,
-3727,
-3727,
-3727,
-3727,
-3726,
-3726,
-3726,
-3725,
-3725,
-3725,
-3724,
-3724,
-3724,
-3723,
-3723,
-3723,
-3722,
-3722,
-3722,
-3722,
-3721,
-3721,
-3721,
-3720,
-3720,
-3720,
-3719,
-3719,
-3719,
-3718,
-3718,
-3718,
-3718,
-3717,
-3717,
-3717,
-3716,
-3716,
-3716,
-3715,
-3715,
-3715,
-3714,
-3714,
-3714,
-3713,
-3713,
-3713,
-3713,
-3712,
-3712,
-3712,
-3711,
-3711,
-3711,
-3710,
-3710,
-3710,
-3709,
-3709,
-3709,
-3709,
-3708,
-3708,
-3708,
-3707,
-3707,
-3707,
-3706,
-3706,
-3706,
-3705,
-3705,
-3705,
-3705,
-3704,
-3704,
-3704,
-3703,
-3703,
-3703,
-3702,
-3702,
-3702,
-3701,
-3701,
-3701,
-3700,
-3700,
-3700,
-3700,
-3699,
-3699,
-3699,
-3698,
-3698,
-3698,
-3697,
-3697,
-3697,
-3696,
-3696,
-3696,
-3696,
-3695,
-3695,
-3695,
-3694,
-3694,
-3694,
-3693,
-3693,
-3693,
-3692,
-3692,
-3692,
-3692,
-3691,
-3691,
-3691,
-3690,
-3690,
-3690,
-3689,
-3689,
-3689,
-3688,
-3688,
-3688,
-3688,
-3687,
-3687,
-3687,
-3686,
-3686,
-3686,
-3685,
-3685,
-3685,
-3684,
-3684,
-3684,
-3683,
-3683,
-3683,
-3683,
-3682,
-3682,
-3682,
-3681,
-3681,
-3681,
-3680,
-3680,
-3680,
-3679,
-3679,
-3679,
-3679,
-3678,
-3678,
-3678,
-3677,
-3677,
-3677,
-3676,
-3676,
-3676,
-3675,
-3675,
-3675,
-3675,
-3674,
-3674,
-3674,
-3673,
-3673,
-3673,
-3672,
-3672,
-3672,
-3671,
-3671,
-3671,
-3671,
-3670,
-3670,
-3670,
-3669,
-3669,
-3669,
-3668,
-3668,
-3668,
-3668,
-3667,
-3667,
-3667,
-3666,
-3666,
-3666,
-3665,
-3665,
-3665,
-3664,
-3664,
-3664,
-3664,
-3663,
-3663,
-3663,
-3662,
-3662,
-3662,
-3661,
-3661,
-3661,
-3660,
-3660,
-3660,
-3660,
-3659,
-3659,
-3659,
-3658,
-3658,
-3658,
-3657,
-3657,
-3657,
-3656,
-3656,
-3656,
-3656,
-3655,
-3655,
-3655,
-3654,
-3654,
-3654,
-3653,
-3653,
-3653,
-3652,
-3652,
-3652,
-3652,
-3651,
-3651,
-3651,
-3650,
-3650,
-3650,
-3649,
-3649,
-3649,
-3649,
-3648,
-3648,
-3648,
-3647,
-3647,
-3647,
-3646,
-3646,
-3646,
-3645,
-3645,
-3645,
-3645,
-3644,
-3644,
-3644,
-3643,
-3643,
-3643,
-3642,
-3642,
-3642,
-3641,
-3641,
-3641,
-3641,
-3640,
-3640,
-3640,
-3639,
-3639,
-3639,
-3638,
-3638,
-3638,
-3638,
-3637,
-3637,
-3637,
-3636,
-3636,
-3636,
-3635,
-3635,
-3635,
-3634,
-3634,
-3634,
-3634,
-3633,
-3633,
-3633,
-3632,
-3632,
-3632,
-3631,
-3631,
-3631,
-3631,
-3630,
-3630,
-3630,
-3629,
-3629,
-3629,
-3628,
-3628,
-3628,
-3627,
-3627,
-3627,
-3627,
-3626,
-3626,
-3626,
-3625,
-3625,
-3625,
-3624,
-3624,
-3624,
-3624,
-3623,
-3623,
-3623,
-3622,
-3622,
-3622,
-3621,
-3621,
-3621,
-3620,
-3620,
-3620,
-3620,
-3619,
-3619,
-3619,
-3618,
-3618,
-3618,
-3617,
-3617,
-3617,
-3617,
-3616,
-3616,
-3616,
-3615,
-3615,
-3615,
-3614,
-3614,
-3614,
-3613,
-3613,
-3613,
-3613,
-3612,
-3612,
-3612,
-3611,
-3611,
-3611,
-3610,
-3610,
-3610,
-3610,
-3609,
-3609,
-3609,
-3608,
-3608,
-3608,
-3607,
-3607,
-3607,
-3607,
-3606,
-3606,
-3606,
-3605,
-3605,
-3605,
-3604,
-3604,
-3604,
-3604,
-3603,
-3603,
-3603,
-3602,
-3602,
-3602,
-3601,
-3601,
-3601,
-3600,
-3600,
-3600,
-3600,
-3599,
-3599,
-3599,
-3598,
-3598,
-3598,
-3597,
-3597,
-3597,
-3597,
-3596,
-3596,
-3596,
-3595,
-3595,
-3595,
-3594,
-3594,
-3594,
-3594,
-3593,
-3593,
-3593,
-3592,
-3592,
-3592,
-3591,
-3591,
-3591,
-3591,
-3590,
-3590,
-3590,
-3589,
-3589,
-3589,
-3588,
-3588,
-3588,
-3587,
-3587,
-3587,
-3587,
-3586,
-3586,
-3586,
-3585,
-3585,
-3585,
-3584,
-3584,
-3584,
-3584,
-3583,
-3583,
-3583,
-3582,
-3582,
-3582,
-3581,
-3581,
-3581,
-3581,
-3580,
-3580,
-3580,
-3579,
-3579,
-3579,
-3578,
-3578,
-3578,
-3578,
-3577,
-3577,
-3577,
-3576,
-3576,
-3576,
-3575,
-3575,
-3575,
-3575,
-3574,
-3574,
-3574,
-3573,
-3573,
-3573,
-3572,
-3572,
-3572,
-3572,
-3571,
-3571,
-3571,
-3570,
-3570,
-3570,
-3569,
-3569,
-3569,
-3569,
-3568,
-3568,
-3568,
-3567,
-3567,
-3567,
-3566,
-3566,
-3566,
-3566,
-3565,
-3565,
-3565,
-3564,
-3564,
-3564,
-3563,
-3563,
-3563,
-3563,
-3562,
-3562,
-3562,
-3561,
-3561,
-3561,
-3560,
-3560,
-3560,
-3560,
-3559,
-3559,
-3559,
-3558,
-3558,
-3558,
-3557,
-3557,
-3557,
-3557,
-3556,
-3556,
-3556,
-3555,
-3555,
-3555,
-3554,
-3554,
-3554,
-3554,
-3553,
-3553,
-3553,
-3552,
-3552,
-3552,
-3551,
-3551,
-3551,
-3551,
-3550,
-3550,
-3550,
-3549,
-3549,
-3549,
-3548,
-3548,
-3548,
-3548,
-3547,
-3547,
-3547,
-3546,
-3546,
-3546,
-3546,
-3545,
-3545,
-3545,
-3544,
-3544,
-3544,
-3543,
-3543,
-3543,
-3543,
-3542,
-3542,
-3542,
-3541,
-3541,
-3541,
-3540,
-3540,
-3540,
-3540,
-3539,
-3539,
-3539,
-3538,
-3538,
-3538,
-3537,
-3537,
-3537,
-3537,
-3536,
-3536,
-3536,
-3535,
-3535,
-3535,
-3534,
-3534,
-3534,
-3534,
-3533,
-3533,
-3533,
-3532,
-3532,
-3532,
-3531,
-3531,
-3531,
-3531,
-3530,
-3530,
-3530,
-3529,
-3529,
-3529,
-3529,
-3528,
-3528,
-3528,
-3527,
-3527,
-3527,
-3526,
-3526,
-3526,
-3526,
-3525,
-3525,
-3525,
-3524,
-3524,
-3524,
-3523,
-3523,
-3523,
-3523,
-3522,
-3522,
-3522,
-3521,
-3521,
-3521,
-3521,
-3520,
-3520,
-3520,
-3519,
-3519,
-3519,
-3518,
-3518,
-3518,
-3518,
-3517,
-3517,
-3517,
-3516,
-3516,
-3516,
-3515,
-3515,
-3515,
-3515,
-3514,
-3514,
-3514,
-3513,
-3513,
-3513,
-3512,
-3512,
-3512,
-3512,
-3511,
-3511,
-3511,
-3510,
-3510,
-3510,
-3510,
-3509,
-3509,
-3509,
-3508,
-3508,
-3508,
-3507,
-3507,
-3507,
-3507,
-3506,
-3506,
-3506,
-3505,
-3505,
-3505,
-3505,
-3504,
-3504,
-3504,
-3503,
-3503,
-3503,
-3502,
-3502,
-3502,
-3502,
-3501,
-3501,
-3501,
-3500,
-3500,
-3500,
-3499,
-3499,
-3499,
-3499,
-3498,
-3498,
-3498,
-3497,
-3497,
-3497,
-3497,
-3496,
-3496,
-3496,
-3495,
-3495,
-3495,
-3494,
-3494,
-3494,
-3494,
-3493,
-3493,
-3493,
-3492,
-3492,
-3492,
-3492,
-3491,
-3491,
-3491,
-3490,
-3490,
-3490,
-3489,
-3489,
-3489,
-3489,
-3488,
-3488,
-3488,
-3487,
-3487,
-3487,
-3487,
-3486,
-3486,
-3486,
-3485,
-3485,
-3485,
-3484,
-3484,
-3484,
-3484,
-3483,
-3483,
-3483,
-3482,
-3482,
-3482,
-3482,
-3481,
-3481,
-3481,
-3480,
-3480,
-3480,
-3479,
-3479,
-3479,
-3479,
-3478,
-3478,
-3478,
-3477,
-3477,
-3477,
-3477,
-3476,
-3476,
-3476,
-3475,
-3475,
-3475,
-3474,
-3474,
-3474,
-3474,
-3473,
-3473,
-3473,
-3472,
-3472,
-3472,
-3472,
-3471,
-3471,
-3471,
-3470,
-3470,
-3470,
-3469,
-3469,
-3469,
-3469,
-3468,
-3468,
-3468,
-3467,
-3467,
-3467,
-3467,
-3466,
-3466,
-3466,
-3465,
-3465,
-3465,
-3464,
-3464,
-3464,
-3464,
-3463,
-3463,
-3463,
-3462,
-3462,
-3462,
-3462,
-3461,
-3461,
-3461,
-3460,
-3460,
-3460,
-3460,
-3459,
-3459,
-3459,
-3458,
-3458,
-3458,
-3457,
-3457,
-3457,
-3457,
-3456,
-3456,
-3456,
-3455,
-3455,
-3455,
-3455,
-3454,
-3454,
-3454,
-3453,
-3453,
-3453,
-3453,
-3452,
-3452,
-3452,
-3451,
-3451,
-3451,
-3450,
-3450,
-3450,
-3450,
-3449,
-3449,
-3449,
-3448,
-3448,
-3448,
-3448,
-3447,
-3447,
-3447,
-3446,
-3446,
-3446,
-3446,
-3445,
-3445,
-3445,
-3444,
-3444,
-3444,
-3443,
-3443,
-3443,
-3443,
-3442,
-3442,
-3442,
-3441,
-3441,
-3441,
-3441,
-3440,
-3440,
-3440,
-3439,
-3439,
-3439,
-3439,
-3438,
-3438,
-3438,
-3437,
-3437,
-3437,
-3436,
-3436,
-3436,
-3436,
-3435,
-3435,
-3435,
-3434,
-3434,
-3434,
-3434,
-3433,
-3433,
-3433,
-3432,
-3432,
-3432,
-3432,
-3431,
-3431,
-3431,
-3430,
-3430,
-3430,
-3430,
-3429,
-3429,
-3429,
-3428,
-3428,
-3428,
-3427,
-3427,
-3427,
-3427,
-3426,
-3426,
-3426,
-3425,
-3425,
-3425,
-3425,
-3424,
-3424,
-3424,
-3423,
-3423,
-3423,
-3423,
-3422,
-3422,
-3422,
-3421,
-3421,
-3421,
-3421,
-3420,
-3420,
-3420,
-3419,
-3419,
-3419,
-3418,
-3418,
-3418,
-3418,
-3417,
-3417,
-3417,
-3416,
-3416,
-3416,
-3416,
-3415,
-3415,
-3415,
-3414,
-3414,
-3414,
-3414,
-3413,
-3413,
-3413,
-3412,
-3412,
-3412,
-3412,
-3411,
-3411,
-3411,
-3410,
-3410,
-3410,
-3410,
-3409,
-3409,
-3409,
-3408,
-3408,
-3408,
-3408,
-3407,
-3407,
-3407,
-3406,
-3406,
-3406,
-3405,
-3405,
-3405,
-3405,
-3404,
-3404,
-3404,
-3403,
-3403,
-3403,
-3403,
-3402,
-3402,
-3402,
-3401,
-3401,
-3401,
-3401,
-3400,
-3400,
-3400,
-3399,
-3399,
-3399,
-3399,
-3398,
-3398,
-3398,
-3397,
-3397,
-3397,
-3397,
-3396,
-3396,
-3396,
-3395,
-3395,
-3395,
-3395,
-3394,
-3394,
-3394,
-3393,
-3393,
-3393,
-3393,
-3392,
-3392,
-3392,
-3391,
-3391,
-3391,
-3391,
-3390,
-3390,
-3390,
-3389,
-3389,
-3389,
-3388,
-3388,
-3388,
-3388,
-3387,
-3387,
-3387,
-3386,
-3386,
-3386,
-3386,
-3385,
-3385,
-3385,
-3384,
-3384,
-3384,
-3384,
-3383,
-3383,
-3383,
-3382,
-3382,
-3382,
-3382,
-3381,
-3381,
-3381,
-3380,
-3380,
-3380,
-3380,
-3379,
-3379,
-3379,
-3378,
-3378,
-3378,
-3378,
-3377,
-3377,
-3377,
-3376,
-3376,
-3376,
-3376,
-3375,
-3375,
-3375,
-3374,
-3374,
-3374,
-3374,
-3373,
-3373,
-3373,
-3372,
-3372,
-3372,
-3372,
-3371,
-3371,
-3371,
-3370,
-3370,
-3370,
-3370,
-3369,
-3369,
-3369,
-3368,
-3368,
-3368,
-3368,
-3367,
-3367,
-3367,
-3366,
-3366,
-3366,
-3366,
-3365,
-3365,
-3365,
-3364,
-3364,
-3364,
-3364,
-3363,
-3363,
-3363,
-3362,
-3362,
-3362,
-3362,
-3361,
-3361,
-3361,
-3360,
-3360,
-3360,
-3360,
-3359,
-3359,
-3359,
-3358,
-3358,
-3358,
-3358,
-3357,
-3357,
-3357,
-3356,
-3356,
-3356,
-3356,
-3355,
-3355,
-3355,
-3354,
-3354,
-3354,
-3354,
-3353,
-3353,
-3353,
-3352,
-3352,
-3352,
-3352,
-3351,
-3351,
-3351,
-3350,
-3350,
-3350,
-3350,
-3349,
-3349,
-3349,
-3348,
-3348,
-3348,
-3348,
-3347,
-3347,
-3347,
-3346,
-3346,
-3346,
-3346,
-3345,
-3345,
-3345,
-3344,
-3344,
-3344,
-3344,
-3343,
-3343,
-3343,
-3342,
-3342,
-3342,
-3342,
-3341,
-3341,
-3341,
-3340,
-3340,
-3340,
-3340,
-3339,
-3339,
-3339,
-3339,
-3338,
-3338,
-3338,
-3337,
-3337,
-3337,
-3337,
-3336,
-3336,
-3336,
-3335,
-3335,
-3335,
-3335,
-3334,
-3334,
-3334,
-3333,
-3333,
-3333,
-3333,
-3332,
-3332,
-3332,
-3331,
-3331,
-3331,
-3331,
-3330,
-3330,
-3330,
-3329,
-3329,
-3329,
-3329,
-3328,
-3328,
-3328,
-3327,
-3327,
-3327,
-3327,
-3326,
-3326,
-3326,
-3325,
-3325,
-3325,
-3325,
-3324,
-3324,
-3324,
-3323,
-3323,
-3323,
-3323,
-3322,
-3322,
-3322,
-3322,
-3321,
-3321,
-3321,
-3320,
-3320,
-3320,
-3320,
-3319,
-3319,
-3319,
-3318,
-3318,
-3318,
-3318,
-3317,
-3317,
-3317,
-3316,
-3316,
-3316,
-3316,
-3315,
-3315,
-3315,
-3314,
-3314,
-3314,
-3314,
-3313,
-3313,
-3313,
-3312,
-3312,
-3312,
-3312,
-3311,
-3311,
-3311,
-3311,
-3310,
-3310,
-3310,
-3309,
-3309,
-3309,
-3309,
-3308,
-3308,
-3308,
-3307,
-3307,
-3307,
-3307,
-3306,
-3306,
-3306,
-3305,
-3305,
-3305,
-3305,
-3304,
-3304,
-3304,
-3303,
-3303,
-3303,
-3303,
-3302,
-3302,
-3302,
-3302,
-3301,
-3301,
-3301,
-3300,
-3300,
-3300,
-3300,
-3299,
-3299,
-3299,
-3298,
-3298,
-3298,
-3298,
-3297,
-3297,
-3297,
-3296,
-3296,
-3296,
-3296,
-3295,
-3295,
-3295,
-3294,
-3294,
-3294,
-3294,
-3293,
-3293,
-3293,
-3293,
-3292,
-3292,
-3292,
-3291,
-3291,
-3291,
-3291,
-3290,
-3290,
-3290,
-3289,
-3289,
-3289,
-3289,
-3288,
-3288,
-3288,
-3287,
-3287,
-3287,
-3287,
-3286,
-3286,
-3286,
-3286,
-3285,
-3285,
-3285,
-3284,
-3284,
-3284,
-3284,
-3283,
-3283,
-3283,
-3282,
-3282,
-3282,
-3282,
-3281,
-3281,
-3281,
-3280,
-3280,
-3280,
-3280,
-3279,
-3279,
-3279,
-3279,
-3278,
-3278,
-3278,
-3277,
-3277,
-3277,
-3277,
-3276,
-3276,
-3276,
-3275,
-3275,
-3275,
-3275,
-3274,
-3274,
-3274,
-3273,
-3273,
-3273,
-3273,
-3272,
-3272,
-3272,
-3272,
-3271,
-3271,
-3271,
-3270,
-3270,
-3270,
-3270,
-3269,
-3269,
-3269,
-3268,
-3268,
-3268,
-3268,
-3267,
-3267,
-3267,
-3267,
-3266,
-3266,
-3266,
-3265,
-3265,
-3265,
-3265,
-3264,
-3264,
-3264,
-3263,
-3263,
-3263,
-3263,
-3262,
-3262,
-3262,
-3262,
-3261,
-3261,
-3261,
-3260,
-3260,
-3260,
-3260,
-3259,
-3259,
-3259,
-3258,
-3258,
-3258,
-3258,
-3257,
-3257,
-3257,
-3256,
-3256,
-3256,
-3256,
-3255,
-3255,
-3255,
-3255,
-3254,
-3254,
-3254,
-3253,
-3253,
-3253,
-3253,
-3252,
-3252,
-3252,
-3251,
-3251,
-3251,
-3251,
-3250,
-3250,
-3250,
-3250,
-3249,
-3249,
-3249,
-3248,
-3248,
-3248,
-3248,
-3247,
-3247,
-3247,
-3247,
-3246,
-3246,
-3246,
-3245,
-3245,
-3245,
-3245,
-3244,
-3244,
-3244,
-3243,
-3243,
-3243,
-3243,
-3242,
-3242,
-3242,
-3242,
-3241,
-3241,
-3241,
-3240,
-3240,
-3240,
-3240,
-3239,
-3239,
-3239,
-3238,
-3238,
-3238,
-3238,
-3237,
-3237,
-3237,
-3237,
-3236,
-3236,
-3236,
-3235,
-3235,
-3235,
-3235,
-3234,
-3234,
-3234,
-3233,
-3233,
-3233,
-3233,
-3232,
-3232,
-3232,
-3232,
-3231,
-3231,
-3231,
-3230,
-3230,
-3230,
-3230,
-3229,
-3229,
-3229,
-3229,
-3228,
-3228,
-3228,
-3227,
-3227,
-3227,
-3227,
-3226,
-3226,
-3226,
-3225,
-3225,
-3225,
-3225,
-3224,
-3224,
-3224,
-3224,
-3223,
-3223,
-3223,
-3222,
-3222,
-3222,
-3222,
-3221,
-3221,
-3221,
-3221,
-3220,
-3220,
-3220,
-3219,
-3219,
-3219,
-3219,
-3218,
-3218,
-3218,
-3218,
-3217,
-3217,
-3217,
-3216,
-3216,
-3216,
-3216,
-3215,
-3215,
-3215,
-3214,
-3214,
-3214,
-3214,
-3213,
-3213,
-3213,
-3213,
-3212,
-3212,
-3212,
-3211,
-3211,
-3211,
-3211,
-3210,
-3210,
-3210,
-3210,
-3209,
-3209,
-3209,
-3208,
-3208,
-3208,
-3208,
-3207,
-3207,
-3207,
-3207,
-3206,
-3206,
-3206,
-3205,
-3205,
-3205,
-3205,
-3204,
-3204,
-3204,
-3204,
-3203,
-3203,
-3203,
-3202,
-3202,
-3202,
-3202,
-3201,
-3201,
-3201,
-3200,
-3200,
-3200,
-3200,
-3199,
-3199,
-3199,
-3199,
-3198,
-3198,
-3198,
-3197,
-3197,
-3197,
-3197,
-3196,
-3196,
-3196,
-3196,
-3195,
-3195,
-3195,
-3194,
-3194,
-3194,
-3194,
-3193,
-3193,
-3193,
-3193,
-3192,
-3192,
-3192,
-3191,
-3191,
-3191,
-3191,
-3190,
-3190,
-3190,
-3190,
-3189,
-3189,
-3189,
-3188,
-3188,
-3188,
-3188,
-3187,
-3187,
-3187,
-3187,
-3186,
-3186,
-3186,
-3185,
-3185,
-3185,
-3185,
-3184,
-3184,
-3184,
-3184,
-3183,
-3183,
-3183,
-3182,
-3182,
-3182,
-3182,
-3181,
-3181,
-3181,
-3181,
-3180,
-3180,
-3180,
-3179,
-3179,
-3179,
-3179,
-3178,
-3178,
-3178,
-3178,
-3177,
-3177,
-3177,
-3176,
-3176,
-3176,
-3176,
-3175,
-3175,
-3175,
-3175,
-3174,
-3174,
-3174,
-3173,
-3173,
-3173,
-3173,
-3172,
-3172,
-3172,
-3172,
-3171,
-3171,
-3171,
-3170,
-3170,
-3170,
-3170,
-3169,
-3169,
-3169,
-3169,
-3168,
-3168,
-3168,
-3167,
-3167,
-3167,
-3167,
-3166,
-3166,
-3166,
-3166,
-3165,
-3165,
-3165,
-3165,
-3164,
-3164,
-3164,
-3163,
-3163,
-3163,
-3163,
-3162,
-3162,
-3162,
-3162,
-3161,
-3161,
-3161,
-3160,
-3160,
-3160,
-3160,
-3159,
-3159,
-3159,
-3159,
-3158,
-3158,
-3158,
-3157,
-3157,
-3157,
-3157,
-3156,
-3156,
-3156,
-3156,
-3155,
-3155,
-3155,
-3154,
-3154,
-3154,
-3154,
-3153,
-3153,
-3153,
-3153,
-3152,
-3152,
-3152,
-3152,
-3151,
-3151,
-3151,
-3150,
-3150,
-3150,
-3150,
-3149,
-3149,
-3149,
-3149,
-3148,
-3148,
-3148,
-3147,
-3147,
-3147,
-3147,
-3146,
-3146,
-3146,
-3146,
-3145,
-3145,
-3145,
-3144,
-3144,
-3144,
-3144,
-3143,
-3143,
-3143,
-3143,
-3142,
-3142,
-3142,
-3142,
-3141,
-3141,
-3141,
-3140,
-3140,
-3140,
-3140,
-3139,
-3139,
-3139,
-3139,
-3138,
-3138,
-3138,
-3137,
-3137,
-3137,
-3137,
-3136,
-3136,
-3136,
-3136,
-3135,
-3135,
-3135,
-3135,
-3134,
-3134,
-3134,
-3133,
-3133,
-3133,
-3133,
-3132,
-3132,
-3132,
-3132,
-3131,
-3131,
-3131,
-3130,
-3130,
-3130,
-3130,
-3129,
-3129,
-3129,
-3129,
-3128,
-3128,
-3128,
-3128,
-3127,
-3127,
-3127,
-3126,
-3126,
-3126,
-3126,
-3125,
-3125,
-3125,
-3125,
-3124,
-3124,
-3124,
-3124,
-3123,
-3123,
-3123,
-3122,
-3122,
-3122,
-3122,
-3121,
-3121,
-3121,
-3121,
-3120,
-3120,
-3120,
-3119,
-3119,
-3119,
-3119,
-3118,
-3118,
-3118,
-3118,
-3117,
-3117,
-3117,
-3117,
-3116,
-3116,
-3116,
-3115,
-3115,
-3115,
-3115,
-3114,
-3114,
-3114,
-3114,
-3113,
-3113,
-3113,
-3113,
-3112,
-3112,
-3112,
-3111,
-3111,
-3111,
-3111,
-3110,
-3110,
-3110,
-3110,
-3109,
-3109,
-3109,
-3109,
-3108,
-3108,
-3108,
-3107,
-3107,
-3107,
-3107,
-3106,
-3106,
-3106,
-3106,
-3105,
-3105,
-3105,
-3105,
-3104,
-3104,
-3104,
-3103,
-3103,
-3103,
-3103,
-3102,
-3102,
-3102,
-3102,
-3101,
-3101,
-3101,
-3101,
-3100,
-3100,
-3100,
-3099,
-3099,
-3099,
-3099,
-3098,
-3098,
-3098,
-3098,
-3097,
-3097,
-3097,
-3097,
-3096,
-3096,
-3096,
-3095,
-3095,
-3095,
-3095,
-3094,
-3094,
-3094,
-3094,
-3093,
-3093,
-3093,
-3093,
-3092,
-3092,
-3092,
-3091,
-3091,
-3091,
-3091,
-3090,
-3090,
-3090,
-3090,
-3089,
-3089,
-3089,
-3089,
-3088,
-3088,
-3088,
-3087,
-3087,
-3087,
-3087,
-3086,
-3086,
-3086,
-3086,
-3085,
-3085,
-3085,
-3085,
-3084,
-3084,
-3084,
-3083,
-3083,
-3083,
-3083,
-3082,
-3082,
-3082,
-3082,
-3081,
-3081,
-3081,
-3081,
-3080,
-3080,
-3080,
-3080,
-3079,
-3079,
-3079,
-3078,
-3078,
-3078,
-3078,
-3077,
-3077,
-3077,
-3077,
-3076,
-3076,
-3076,
-3076,
-3075,
-3075,
-3075,
-3074,
-3074,
-3074,
-3074,
-3073,
-3073,
-3073,
-3073,
-3072,
-3072,
-3072,
-3072,
-3071,
-3071,
-3071,
-3071,
-3070,
-3070,
-3070,
-3069,
-3069,
-3069,
-3069,
-3068,
-3068,
-3068,
-3068,
-3067,
-3067,
-3067,
-3067,
-3066,
-3066,
-3066,
-3065,
-3065,
-3065,
-3065,
-3064,
-3064,
-3064,
-3064,
-3063,
-3063,
-3063,
-3063,
-3062,
-3062,
-3062,
-3062,
-3061,
-3061,
-3061,
-3060,
-3060,
-3060,
-3060,
-3059,
-3059,
-3059,
-3059,
-3058,
-3058,
-3058,
-3058,
-3057,
-3057,
-3057,
-3057,
-3056,
-3056,
-3056,
-3055,
-3055,
-3055,
-3055,
-3054,
-3054,
-3054,
-3054,
-3053,
-3053,
-3053,
-3053,
-3052,
-3052,
-3052,
-3052,
-3051,
-3051,
-3051,
-3050,
-3050,
-3050,
-3050,
-3049,
-3049,
-3049,
-3049,
-3048,
-3048,
-3048,
-3048,
-3047,
-3047,
-3047,
-3047,
-3046,
-3046,
-3046,
-3045,
-3045,
-3045,
-3045,
-3044,
-3044,
-3044,
-3044,
-3043,
-3043,
-3043,
-3043,
-3042,
-3042,
-3042,
-3042,
-3041,
-3041,
-3041,
-3040,
-3040,
-3040,
-3040,
-3039,
-3039,
-3039,
-3039,
-3038,
-3038,
-3038,
-3038,
-3037,
-3037,
-3037,
-3037,
-3036,
-3036,
-3036,
-3036,
-3035,
-3035,
-3035,
-3034,
-3034,
-3034,
-3034,
-3033,
-3033,
-3033,
-3033,
-3032,
-3032,
-3032,
-3032,
-3031,
-3031,
-3031,
-3031,
-3030,
-3030,
-3030,
-3030,
-3029,
-3029,
-3029,
-3028,
-3028,
-3028,
-3028,
-3027,
-3027,
-3027,
-3027,
-3026,
-3026,
-3026,
-3026,
-3025,
-3025,
-3025,
-3025,
-3024,
-3024,
-3024,
-3023,
-3023,
-3023,
-3023,
-3022,
-3022,
-3022,
-3022,
-3021,
-3021,
-3021,
-3021,
-3020,
-3020,
-3020,
-3020,
-3019,
-3019,
-3019,
-3019,
-3018,
-3018,
-3018,
-3018,
-3017,
-3017,
-3017,
-3016,
-3016,
-3016,
-3016,
-3015,
-3015,
-3015,
-3015,
-3014,
-3014,
-3014,
-3014,
-3013,
-3013,
-3013,
-3013,
-3012,
-3012,
-3012,
-3012,
-3011,
-3011,
-3011,
-3010,
-3010,
-3010,
-3010,
-3009,
-3009,
-3009,
-3009,
-3008,
-3008,
-3008,
-3008,
-3007,
-3007,
-3007,
-3007,
-3006,
-3006,
-3006,
-3006,
-3005,
-3005,
-3005,
-3005,
-3004,
-3004,
-3004,
-3003,
-3003,
-3003,
-3003,
-3002,
-3002,
-3002,
-3002,
-3001,
-3001,
-3001,
-3001,
-3000,
-3000,
-3000,
-3000,
-2999,
-2999,
-2999,
-2999,
-2998,
-2998,
-2998,
-2998,
-2997,
-2997,
-2997,
-2996,
-2996,
-2996,
-2996,
-2995,
-2995,
-2995,
-2995,
-2994,
-2994,
-2994,
-2994,
-2993,
-2993,
-2993,
-2993,
-2992,
-2992,
-2992,
-2992,
-2991,
-2991,
-2991,
-2991,
-2990,
-2990,
-2990,
-2989,
-2989,
-2989,
-2989,
-2988,
-2988,
-2988,
-2988,
-2987,
-2987,
-2987,
-2987,
-2986,
-2986,
-2986,
-2986,
-2985,
-2985,
-2985,
-2985,
-2984,
-2984,
-2984,
-2984,
-2983,
-2983,
-2983,
-2983,
-2982,
-2982,
-2982,
-2981,
-2981,
-2981,
-2981,
-2980,
-2980,
-2980,
-2980,
-2979,
-2979,
-2979,
-2979,
-2978,
-2978,
-2978,
-2978,
-2977,
-2977,
-2977,
-2977,
-2976,
-2976,
-2976,
-2976,
-2975,
-2975,
-2975,
-2975,
-2974,
-2974,
-2974,
-2973,
-2973,
-2973,
-2973,
-2972,
-2972,
-2972,
-2972,
-2971,
-2971,
-2971,
-2971,
-2970,
-2970,
-2970,
-2970,
-2969,
-2969,
-2969,
-2969,
-2968,
-2968,
-2968,
-2968,
-2967,
-2967,
-2967,
-2967,
-2966,
-2966,
-2966,
-2966,
-2965,
-2965,
-2965,
-2965,
-2964,
-2964,
-2964,
-2963,
-2963,
-2963,
-2963,
-2962,
-2962,
-2962,
-2962,
-2961,
-2961,
-2961,
-2961,
-2960,
-2960,
-2960,
-2960,
-2959,
-2959,
-2959,
-2959,
-2958,
-2958,
-2958,
-2958,
-2957,
-2957,
-2957,
-2957,
-2956,
-2956,
-2956,
-2956,
-2955,
-2955,
-2955,
-2955,
-2954,
-2954,
-2954,
-2953,
-2953,
-2953,
-2953,
-2952,
-2952,
-2952,
-2952,
-2951,
-2951,
-2951,
-2951,
-2950,
-2950,
-2950,
-2950,
-2949,
-2949,
-2949,
-2949,
-2948,
-2948,
-2948,
-2948,
-2947,
-2947,
-2947,
-2947,
-2946,
-2946,
-2946,
-2946,
-2945,
-2945,
-2945,
-2945,
-2944,
-2944,
-2944,
-2944,
-2943,
-2943,
-2943,
-2943,
-2942,
-2942,
-2942,
-2941,
-2941,
-2941,
-2941,
-2940,
-2940,
-2940,
-2940,
-2939,
-2939,
-2939,
-2939,
-2938,
-2938,
-2938,
-2938,
-2937,
-2937,
-2937,
-2937,
-2936,
-2936,
-2936,
-2936,
-2935,
-2935,
-2935,
-2935,
-2934,
-2934,
-2934,
-2934,
-2933,
-2933,
-2933,
-2933,
-2932,
-2932,
-2932,
-2932,
-2931,
-2931,
-2931,
-2931,
-2930,
-2930,
-2930,
-2930,
-2929,
-2929,
-2929,
-2929,
-2928,
-2928,
-2928,
-2928,
-2927,
-2927,
-2927,
-2926,
-2926,
-2926,
-2926,
-2925,
-2925,
-2925,
-2925,
-2924,
-2924,
-2924,
-2924,
-2923,
-2923,
-2923,
-2923,
-2922,
-2922,
-2922,
-2922,
-2921,
-2921,
-2921,
-2921,
-2920,
-2920,
-2920,
-2920,
-2919,
-2919,
-2919,
-2919,
-2918,
-2918,
-2918,
-2918,
-2917,
-2917,
-2917,
-2917,
-2916,
-2916,
-2916,
-2916,
-2915,
-2915,
-2915,
-2915,
-2914,
-2914,
-2914,
-2914,
-2913,
-2913,
-2913,
-2913,
-2912,
-2912,
-2912,
-2912,
-2911,
-2911,
-2911,
-2911,
-2910,
-2910,
-2910,
-2910,
-2909,
-2909,
-2909,
-2909,
-2908,
-2908,
-2908,
-2908,
-2907,
-2907,
-2907,
-2907,
-2906,
-2906,
-2906,
-2906,
-2905,
-2905,
-2905,
-2904,
-2904,
-2904,
-2904,
-2903,
-2903,
-2903,
-2903,
-2902,
-2902,
-2902,
-2902,
-2901,
-2901,
-2901,
-2901,
-2900,
-2900,
-2900,
-2900,
-2899,
-2899,
-2899,
-2899,
-2898,
-2898,
-2898,
-2898,
-2897,
-2897,
-2897,
-2897,
-2896,
-2896,
-2896,
-2896,
-2895,
-2895,
-2895,
-2895,
-2894,
-2894,
-2894,
-2894,
-2893,
-2893,
-2893,
-2893,
-2892,
-2892,
-2892,
-2892,
-2891,
-2891,
-2891,
-2891,
-2890,
-2890,
-2890,
-2890,
-2889,
-2889,
-2889,
-2889,
-2888,
-2888,
-2888,
-2888,
-2887,
-2887,
-2887,
-2887,
-2886,
-2886,
-2886,
-2886,
-2885,
-2885,
-2885,
-2885,
-2884,
-2884,
-2884,
-2884,
-2883,
-2883,
-2883,
-2883,
-2882,
-2882,
-2882,
-2882,
-2881,
-2881,
-2881,
-2881,
-2880,
-2880,
-2880,
-2880,
-2879,
-2879,
-2879,
-2879,
-2878,
-2878,
-2878,
-2878,
-2877,
-2877,
-2877,
-2877,
-2876,
-2876,
-2876,
-2876,
-2875,
-2875,
-2875,
-2875,
-2874,
-2874,
-2874,
-2874,
-2873,
-2873,
-2873,
-2873,
-2872,
-2872,
-2872,
-2872,
-2871,
-2871,
-2871,
-2871,
-2870,
-2870,
-2870,
-2870,
-2869,
-2869,
-2869,
-2869,
-2868,
-2868,
-2868,
-2868,
-2867,
-2867,
-2867,
-2867,
-2866,
-2866,
-2866,
-2866,
-2865,
-2865,
-2865,
-2865,
-2864,
-2864,
-2864,
-2864,
-2863,
-2863,
-2863,
-2863,
-2862,
-2862,
-2862,
-2862,
-2861,
-2861,
-2861,
-2861,
-2860,
-2860,
-2860,
-2860,
-2859,
-2859,
-2859,
-2859,
-2858,
-2858,
-2858,
-2858,
-2857,
-2857,
-2857,
-2857,
-2856,
-2856,
-2856,
-2856,
-2855,
-2855,
-2855,
-2855,
-2854,
-2854,
-2854,
-2854,
-2853,
-2853,
-2853,
-2853,
-2852,
-2852,
-2852,
-2852,
-2851,
-2851,
-2851,
-2851,
-2850,
-2850,
-2850,
-2850,
-2849,
-2849,
-2849,
-2849,
-2849,
-2848,
-2848,
-2848,
-2848,
-2847,
-2847,
-2847,
-2847,
-2846,
-2846,
-2846,
-2846,
-2845,
-2845,
-2845,
-2845,
-2844,
-2844,
-2844,
-2844,
-2843,
-2843,
-2843,
-2843,
-2842,
-2842,
-2842,
-2842,
-2841,
-2841,
-2841,
-2841,
-2840,
-2840,
-2840,
-2840,
-2839,
-2839,
-2839,
-2839,
-2838,
-2838,
-2838,
-2838,
-2837,
-2837,
-2837,
-2837,
-2836,
-2836,
-2836,
-2836,
-2835,
-2835,
-2835,
-2835,
-2834,
-2834,
-2834,
-2834,
-2833,
-2833,
-2833,
-2833,
-2832,
-2832,
-2832,
-2832,
-2831,
-2831,
-2831,
-2831,
-2830,
-2830,
-2830,
-2830,
-2829,
-2829,
-2829,
-2829,
-2828,
-2828,
-2828,
-2828,
-2828,
-2827,
-2827,
-2827,
-2827,
-2826,
-2826,
-2826,
-2826,
-2825,
-2825,
-2825,
-2825,
-2824,
-2824,
-2824,
-2824,
-2823,
-2823,
-2823,
-2823,
-2822,
-2822,
-2822,
-2822,
-2821,
-2821,
-2821,
-2821,
-2820,
-2820,
-2820,
-2820,
-2819,
-2819,
-2819,
-2819,
-2818,
-2818,
-2818,
-2818,
-2817,
-2817,
-2817,
-2817,
-2816,
-2816,
-2816,
-2816,
-2815,
-2815,
-2815,
-2815,
-2814,
-2814,
-2814,
-2814,
-2813,
-2813,
-2813,
-2813,
-2813,
-2812,
-2812,
-2812,
-2812,
-2811,
-2811,
-2811,
-2811,
-2810,
-2810,
-2810,
-2810,
-2809,
-2809,
-2809,
-2809,
-2808,
-2808,
-2808,
-2808,
-2807,
-2807,
-2807,
-2807,
-2806,
-2806,
-2806,
-2806,
-2805,
-2805,
-2805,
-2805,
-2804,
-2804,
-2804,
-2804,
-2803,
-2803,
-2803,
-2803,
-2802,
-2802,
-2802,
-2802,
-2802,
-2801,
-2801,
-2801,
-2801,
-2800,
-2800,
-2800,
-2800,
-2799,
-2799,
-2799,
-2799,
-2798,
-2798,
-2798,
-2798,
-2797,
-2797,
-2797,
-2797,
-2796,
-2796,
-2796,
-2796,
-2795,
-2795,
-2795,
-2795,
-2794,
-2794,
-2794,
-2794,
-2793,
-2793,
-2793,
-2793,
-2792,
-2792,
-2792,
-2792,
-2792,
-2791,
-2791,
-2791,
-2791,
-2790,
-2790,
-2790,
-2790,
-2789,
-2789,
-2789,
-2789,
-2788,
-2788,
-2788,
-2788,
-2787,
-2787,
-2787,
-2787,
-2786,
-2786,
-2786,
-2786,
-2785,
-2785,
-2785,
-2785,
-2784,
-2784,
-2784,
-2784,
-2783,
-2783,
-2783,
-2783,
-2783,
-2782,
-2782,
-2782,
-2782,
-2781,
-2781,
-2781,
-2781,
-2780,
-2780,
-2780,
-2780,
-2779,
-2779,
-2779,
-2779,
-2778,
-2778,
-2778,
-2778,
-2777,
-2777,
-2777,
-2777,
-2776,
-2776,
-2776,
-2776,
-2775,
-2775,
-2775,
-2775,
-2774,
-2774,
-2774,
-2774,
-2774,
-2773,
-2773,
-2773,
-2773,
-2772,
-2772,
-2772,
-2772,
-2771,
-2771,
-2771,
-2771,
-2770,
-2770,
-2770,
-2770,
-2769,
-2769,
-2769,
-2769,
-2768,
-2768,
-2768,
-2768,
-2767,
-2767,
-2767,
-2767,
-2767,
-2766,
-2766,
-2766,
-2766,
-2765,
-2765,
-2765,
-2765,
-2764,
-2764,
-2764,
-2764,
-2763,
-2763,
-2763,
-2763,
-2762,
-2762,
-2762,
-2762,
-2761,
-2761,
-2761,
-2761,
-2760,
-2760,
-2760,
-2760,
-2760,
-2759,
-2759,
-2759,
-2759,
-2758,
-2758,
-2758,
-2758,
-2757,
-2757,
-2757,
-2757,
-2756,
-2756,
-2756,
-2756,
-2755,
-2755,
-2755,
-2755,
-2754,
-2754,
-2754,
-2754,
-2753,
-2753,
-2753,
-2753,
-2753,
-2752,
-2752,
-2752,
-2752,
-2751,
-2751,
-2751,
-2751,
-2750,
-2750,
-2750,
-2750,
-2749,
-2749,
-2749,
-2749,
-2748,
-2748,
-2748,
-2748,
-2747,
-2747,
-2747,
-2747,
-2747,
-2746,
-2746,
-2746,
-2746,
-2745,
-2745,
-2745,
-2745,
-2744,
-2744,
-2744,
-2744,
-2743,
-2743,
-2743,
-2743,
-2742,
-2742,
-2742,
-2742,
-2741,
-2741,
-2741,
-2741,
-2741,
-2740,
-2740,
-2740,
-2740,
-2739,
-2739,
-2739,
-2739,
-2738,
-2738,
-2738,
-2738,
-2737,
-2737,
-2737,
-2737,
-2736,
-2736,
-2736,
-2736,
-2735,
-2735,
-2735,
-2735,
-2735,
-2734,
-2734,
-2734,
-2734,
-2733,
-2733,
-2733,
-2733,
-2732,
-2732,
-2732,
-2732,
-2731,
-2731,
-2731,
-2731,
-2730,
-2730,
-2730,
-2730,
-2730,
-2729,
-2729,
-2729,
-2729,
-2728,
-2728,
-2728,
-2728,
-2727,
-2727,
-2727,
-2727,
-2726,
-2726,
-2726,
-2726,
-2725,
-2725,
-2725,
-2725,
-2724,
-2724,
-2724,
-2724,
-2724,
-2723,
-2723,
-2723,
-2723,
-2722,
-2722,
-2722,
-2722,
-2721,
-2721,
-2721,
-2721,
-2720,
-2720,
-2720,
-2720,
-2719,
-2719,
-2719,
-2719,
-2719,
-2718,
-2718,
-2718,
-2718,
-2717,
-2717,
-2717,
-2717,
-2716,
-2716,
-2716,
-2716,
-2715,
-2715,
-2715,
-2715,
-2714,
-2714,
-2714,
-2714,
-2714,
-2713,
-2713,
-2713,
-2713,
-2712,
-2712,
-2712,
-2712,
-2711,
-2711,
-2711,
-2711,
-2710,
-2710,
-2710,
-2710,
-2710,
-2709,
-2709,
-2709,
-2709,
-2708,
-2708,
-2708,
-2708,
-2707,
-2707,
-2707,
-2707,
-2706,
-2706,
-2706,
-2706,
-2705,
-2705,
-2705,
-2705,
-2705,
-2704,
-2704,
-2704,
-2704,
-2703,
-2703,
-2703,
-2703,
-2702,
-2702,
-2702,
-2702,
-2701,
-2701,
-2701,
-2701,
-2701,
-2700,
-2700,
-2700,
-2700,
-2699,
-2699,
-2699,
-2699,
-2698,
-2698,
-2698,
-2698,
-2697,
-2697,
-2697,
-2697,
-2696,
-2696,
-2696,
-2696,
-2696,
-2695,
-2695,
-2695,
-2695,
-2694,
-2694,
-2694,
-2694,
-2693,
-2693,
-2693,
-2693,
-2692,
-2692,
-2692,
-2692,
-2692,
-2691,
-2691,
-2691,
-2691,
-2690,
-2690,
-2690,
-2690,
-2689,
-2689,
-2689,
-2689,
-2688,
-2688,
-2688,
-2688,
-2688,
-2687,
-2687,
-2687,
-2687,
-2686,
-2686,
-2686,
-2686,
-2685,
-2685,
-2685,
-2685,
-2684,
-2684,
-2684,
-2684,
-2684,
-2683,
-2683,
-2683,
-2683,
-2682,
-2682,
-2682,
-2682,
-2681,
-2681,
-2681,
-2681,
-2680,
-2680,
-2680,
-2680,
-2680,
-2679,
-2679,
-2679,
-2679,
-2678,
-2678,
-2678,
-2678,
-2677,
-2677,
-2677,
-2677,
-2676,
-2676,
-2676,
-2676,
-2676,
-2675,
-2675,
-2675,
-2675,
-2674,
-2674,
-2674,
-2674,
-2673,
-2673,
-2673,
-2673,
-2672,
-2672,
-2672,
-2672,
-2672,
-2671,
-2671,
-2671,
-2671,
-2670,
-2670,
-2670,
-2670,
-2669,
-2669,
-2669,
-2669,
-2668,
-2668,
-2668,
-2668,
-2668,
-2667,
-2667,
-2667,
-2667,
-2666,
-2666,
-2666,
-2666,
-2665,
-2665,
-2665,
-2665,
-2665,
-2664,
-2664,
-2664,
-2664,
-2663,
-2663,
-2663,
-2663,
-2662,
-2662,
-2662,
-2662,
-2661,
-2661,
-2661,
-2661,
-2661,
-2660,
-2660,
-2660,
-2660,
-2659,
-2659,
-2659,
-2659,
-2658,
-2658,
-2658,
-2658,
-2657,
-2657,
-2657,
-2657,
-2657,
-2656,
-2656,
-2656,
-2656,
-2655,
-2655,
-2655,
-2655,
-2654,
-2654,
-2654,
-2654,
-2654,
-2653,
-2653,
-2653,
-2653,
-2652,
-2652,
-2652,
-2652,
-2651,
-2651,
-2651,
-2651,
-2651,
-2650,
-2650,
-2650,
-2650,
-2649,
-2649,
-2649,
-2649,
-2648,
-2648,
-2648,
-2648,
-2647,
-2647,
-2647,
-2647,
-2647,
-2646,
-2646,
-2646,
-2646,
-2645,
-2645,
-2645,
-2645,
-2644,
-2644,
-2644,
-2644,
-2644,
-2643,
-2643,
-2643,
-2643,
-2642,
-2642,
-2642,
-2642,
-2641,
-2641,
-2641,
-2641,
-2641,
-2640,
-2640,
-2640,
-2640,
-2639,
-2639,
-2639,
-2639,
-2638,
-2638,
-2638,
-2638,
-2637,
-2637,
-2637,
-2637,
-2637,
-2636,
-2636,
-2636,
-2636,
-2635,
-2635,
-2635,
-2635,
-2634,
-2634,
-2634,
-2634,
-2634,
-2633,
-2633,
-2633,
-2633,
-2632,
-2632,
-2632,
-2632,
-2631,
-2631,
-2631,
-2631,
-2631,
-2630,
-2630,
-2630,
-2630,
-2629,
-2629,
-2629,
-2629,
-2628,
-2628,
-2628,
-2628,
-2628,
-2627,
-2627,
-2627,
-2627,
-2626,
-2626,
-2626,
-2626,
-2625,
-2625,
-2625,
-2625,
-2625,
-2624,
-2624,
-2624,
-2624,
-2623,
-2623,
-2623,
-2623,
-2622,
-2622,
-2622,
-2622,
-2622,
-2621,
-2621,
-2621,
-2621,
-2620,
-2620,
-2620,
-2620,
-2619,
-2619,
-2619,
-2619,
-2619,
-2618,
-2618,
-2618,
-2618,
-2617,
-2617,
-2617,
-2617,
-2616,
-2616,
-2616,
-2616,
-2616,
-2615,
-2615,
-2615,
-2615,
-2614,
-2614,
-2614,
-2614,
-2613,
-2613,
-2613,
-2613,
-2613,
-2612,
-2612,
-2612,
-2612,
-2611,
-2611,
-2611,
-2611,
-2610,
-2610,
-2610,
-2610,
-2610,
-2609,
-2609,
-2609,
-2609,
-2608,
-2608,
-2608,
-2608,
-2608,
-2607,
-2607,
-2607,
-2607,
-2606,
-2606,
-2606,
-2606,
-2605,
-2605,
-2605,
-2605,
-2605,
-2604,
-2604,
-2604,
-2604,
-2603,
-2603,
-2603,
-2603,
-2602,
-2602,
-2602,
-2602,
-2602,
-2601,
-2601,
-2601,
-2601,
-2600,
-2600,
-2600,
-2600,
-2599,
-2599,
-2599,
-2599,
-2599,
-2598,
-2598,
-2598,
-2598,
-2597,
-2597,
-2597,
-2597,
-2597,
-2596,
-2596,
-2596,
-2596,
-2595,
-2595,
-2595,
-2595,
-2594,
-2594,
-2594,
-2594,
-2594,
-2593,
-2593,
-2593,
-2593,
-2592,
-2592,
-2592,
-2592,
-2591,
-2591,
-2591,
-2591,
-2591,
-2590,
-2590,
-2590,
-2590,
-2589,
-2589,
-2589,
-2589,
-2589,
-2588,
-2588,
-2588,
-2588,
-2587,
-2587,
-2587,
-2587,
-2586,
-2586,
-2586,
-2586,
-2586,
-2585,
-2585,
-2585,
-2585,
-2584,
-2584,
-2584,
-2584,
-2584,
-2583,
-2583,
-2583,
-2583,
-2582,
-2582,
-2582,
-2582,
-2581,
-2581,
-2581,
-2581,
-2581,
-2580,
-2580,
-2580,
-2580,
-2579,
-2579,
-2579,
-2579,
-2579,
-2578,
-2578,
-2578,
-2578,
-2577,
-2577,
-2577,
-2577,
-2576,
-2576,
-2576,
-2576,
-2576,
-2575,
-2575,
-2575,
-2575,
-2574,
-2574,
-2574,
-2574,
-2574,
-2573,
-2573,
-2573,
-2573,
-2572,
-2572,
-2572,
-2572,
-2571,
-2571,
-2571,
-2571,
-2571,
-2570,
-2570,
-2570,
-2570,
-2569,
-2569,
-2569,
-2569,
-2569,
-2568,
-2568,
-2568,
-2568,
-2567,
-2567,
-2567,
-2567,
-2566,
-2566,
-2566,
-2566,
-2566,
-2565,
-2565,
-2565,
-2565,
-2564,
-2564,
-2564,
-2564,
-2564,
-2563,
-2563,
-2563,
-2563,
-2562,
-2562,
-2562,
-2562,
-2562,
-2561,
-2561,
-2561,
-2561,
-2560,
-2560,
-2560,
-2560,
-2559,
-2559,
-2559,
-2559,
-2559,
-2558,
-2558,
-2558,
-2558,
-2557,
-2557,
-2557,
-2557,
-2557,
-2556,
-2556,
-2556,
-2556,
-2555,
-2555,
-2555,
-2555,
-2555,
-2554,
-2554,
-2554,
-2554,
-2553,
-2553,
-2553,
-2553,
-2552,
-2552,
-2552,
-2552,
-2552,
-2551,
-2551,
-2551,
-2551,
-2550,
-2550,
-2550,
-2550,
-2550,
-2549,
-2549,
-2549,
-2549,
-2548,
-2548,
-2548,
-2548,
-2548,
-2547,
-2547,
-2547,
-2547,
-2546,
-2546,
-2546,
-2546,
-2546,
-2545,
-2545,
-2545,
-2545,
-2544,
-2544,
-2544,
-2544,
-2543,
-2543,
-2543,
-2543,
-2543,
-2542,
-2542,
-2542,
-2542,
-2541,
-2541,
-2541,
-2541,
-2541,
-2540,
-2540,
-2540,
-2540,
-2539,
-2539,
-2539,
-2539,
-2539,
-2538,
-2538,
-2538,
-2538,
-2537,
-2537,
-2537,
-2537,
-2537,
-2536,
-2536,
-2536,
-2536,
-2535,
-2535,
-2535,
-2535,
-2535,
-2534,
-2534,
-2534,
-2534,
-2533,
-2533,
-2533,
-2533,
-2533,
-2532,
-2532,
-2532,
-2532,
-2531,
-2531,
-2531,
-2531,
-2530,
-2530,
-2530,
-2530,
-2530,
-2529,
-2529,
-2529,
-2529,
-2528,
-2528,
-2528,
-2528,
-2528,
-2527,
-2527,
-2527,
-2527,
-2526,
-2526,
-2526,
-2526,
-2526,
-2525,
-2525,
-2525,
-2525,
-2524,
-2524,
-2524,
-2524,
-2524,
-2523,
-2523,
-2523,
-2523,
-2522,
-2522,
-2522,
-2522,
-2522,
-2521,
-2521,
-2521,
-2521,
-2520,
-2520,
-2520,
-2520,
-2520,
-2519,
-2519,
-2519,
-2519,
-2518,
-2518,
-2518,
-2518,
-2518,
-2517,
-2517,
-2517,
-2517,
-2516,
-2516,
-2516,
-2516,
-2516,
-2515,
-2515,
-2515,
-2515,
-2514,
-2514,
-2514,
-2514,
-2514,
-2513,
-2513,
-2513,
-2513,
-2512,
-2512,
-2512,
-2512,
-2512,
-2511,
-2511,
-2511,
-2511,
-2510,
-2510,
-2510,
-2510,
-2510,
-2509,
-2509,
-2509,
-2509,
-2508,
-2508,
-2508,
-2508,
-2508,
-2507,
-2507,
-2507,
-2507,
-2506,
-2506,
-2506,
-2506,
-2506,
-2505,
-2505,
-2505,
-2505,
-2504,
-2504,
-2504,
-2504,
-2504,
-2503,
-2503,
-2503,
-2503,
-2502,
-2502,
-2502,
-2502,
-2502,
-2501,
-2501,
-2501,
-2501,
-2500,
-2500,
-2500,
-2500,
-2500,
-2499,
-2499,
-2499,
-2499,
-2498,
-2498,
-2498,
-2498,
-2498,
-2497,
-2497,
-2497,
-2497,
-2496,
-2496,
-2496,
-2496,
-2496,
-2495,
-2495,
-2495,
-2495,
-2494,
-2494,
-2494,
-2494,
-2494,
-2493,
-2493,
-2493,
-2493,
-2493,
-2492,
-2492,
-2492,
-2492,
-2491,
-2491,
-2491,
-2491,
-2491,
-2490,
-2490,
-2490,
-2490,
-2489,
-2489,
-2489,
-2489,
-2489,
-2488,
-2488,
-2488,
-2488,
-2487,
-2487,
-2487,
-2487,
-2487,
-2486,
-2486,
-2486,
-2486,
-2485,
-2485,
-2485,
-2485,
-2485,
-2484,
-2484,
-2484,
-2484,
-2483,
-2483,
-2483,
-2483,
-2483,
-2482,
-2482,
-2482,
-2482,
-2482,
-2481,
-2481,
-2481,
-2481,
-2480,
-2480,
-2480,
-2480,
-2480,
-2479,
-2479,
-2479,
-2479,
-2478,
-2478,
-2478,
-2478,
-2478,
-2477,
-2477,
-2477,
-2477,
-2476,
-2476,
-2476,
-2476,
-2476,
-2475,
-2475,
-2475,
-2475,
-2474,
-2474,
-2474,
-2474,
-2474,
-2473,
-2473,
-2473,
-2473,
-2473,
-2472,
-2472,
-2472,
-2472,
-2471,
-2471,
-2471,
-2471,
-2471,
-2470,
-2470,
-2470,
-2470,
-2469,
-2469,
-2469,
-2469,
-2469,
-2468,
-2468,
-2468,
-2468,
-2467,
-2467,
-2467,
-2467,
-2467,
-2466,
-2466,
-2466,
-2466,
-2466,
-2465,
-2465,
-2465,
-2465,
-2464,
-2464,
-2464,
-2464,
-2464,
-2463,
-2463,
-2463,
-2463,
-2462,
-2462,
-2462,
-2462,
-2462,
-2461,
-2461,
-2461,
-2461,
-2460,
-2460,
-2460,
-2460,
-2460,
-2459,
-2459,
-2459,
-2459,
-2459,
-2458,
-2458,
-2458,
-2458,
-2457,
-2457,
-2457,
-2457,
-2457,
-2456,
-2456,
-2456,
-2456,
-2455,
-2455,
-2455,
-2455,
-2455,
-2454,
-2454,
-2454,
-2454,
-2454,
-2453,
-2453,
-2453,
-2453,
-2452,
-2452,
-2452,
-2452,
-2452,
-2451,
-2451,
-2451,
-2451,
-2450,
-2450,
-2450,
-2450,
-2450,
-2449,
-2449,
-2449,
-2449,
-2449,
-2448,
-2448,
-2448,
-2448,
-2447,
-2447,
-2447,
-2447,
-2447,
-2446,
-2446,
-2446,
-2446,
-2445,
-2445,
-2445,
-2445,
-2445,
-2444,
-2444,
-2444,
-2444,
-2444,
-2443,
-2443,
-2443,
-2443,
-2442,
-2442,
-2442,
-2442,
-2442,
-2441,
-2441,
-2441,
-2441,
-2440,
-2440,
-2440,
-2440,
-2440,
-2439,
-2439,
-2439,
-2439,
-2439,
-2438,
-2438,
-2438,
-2438,
-2437,
-2437,
-2437,
-2437,
-2437,
-2436,
-2436,
-2436,
-2436,
-2436,
-2435,
-2435,
-2435,
-2435,
-2434,
-2434,
-2434,
-2434,
-2434,
-2433,
-2433,
-2433,
-2433,
-2432,
-2432,
-2432,
-2432,
-2432,
-2431,
-2431,
-2431,
-2431,
-2431,
-2430,
-2430,
-2430,
-2430,
-2429,
-2429,
-2429,
-2429,
-2429,
-2428,
-2428,
-2428,
-2428,
-2428,
-2427,
-2427,
-2427,
-2427,
-2426,
-2426,
-2426,
-2426,
-2426,
-2425,
-2425,
-2425,
-2425,
-2425,
-2424,
-2424,
-2424,
-2424,
-2423,
-2423,
-2423,
-2423,
-2423,
-2422,
-2422,
-2422,
-2422,
-2422,
-2421,
-2421,
-2421,
-2421,
-2420,
-2420,
-2420,
-2420,
-2420,
-2419,
-2419,
-2419,
-2419,
-2418,
-2418,
-2418,
-2418,
-2418,
-2417,
-2417,
-2417,
-2417,
-2417,
-2416,
-2416,
-2416,
-2416,
-2415,
-2415,
-2415,
-2415,
-2415,
-2414,
-2414,
-2414,
-2414,
-2414,
-2413,
-2413,
-2413,
-2413,
-2412,
-2412,
-2412,
-2412,
-2412,
-2411,
-2411,
-2411,
-2411,
-2411,
-2410,
-2410,
-2410,
-2410,
-2409,
-2409,
-2409,
-2409,
-2409,
-2408,
-2408,
-2408,
-2408,
-2408,
-2407,
-2407,
-2407,
-2407,
-2406,
-2406,
-2406,
-2406,
-2406,
-2405,
-2405,
-2405,
-2405,
-2405,
-2404,
-2404,
-2404,
-2404,
-2403,
-2403,
-2403,
-2403,
-2403,
-2402,
-2402,
-2402,
-2402,
-2402,
-2401,
-2401,
-2401,
-2401,
-2401,
-2400,
-2400,
-2400,
-2400,
-2399,
-2399,
-2399,
-2399,
-2399,
-2398,
-2398,
-2398,
-2398,
-2398,
-2397,
-2397,
-2397,
-2397,
-2396,
-2396,
-2396,
-2396,
-2396,
-2395,
-2395,
-2395,
-2395,
-2395,
-2394,
-2394,
-2394,
-2394,
-2393,
-2393,
-2393,
-2393,
-2393,
-2392,
-2392,
-2392,
-2392,
-2392,
-2391,
-2391,
-2391,
-2391,
-2390,
-2390,
-2390,
-2390,
-2390,
-2389,
-2389,
-2389,
-2389,
-2389,
-2388,
-2388,
-2388,
-2388,
-2388,
-2387,
-2387,
-2387,
-2387,
-2386,
-2386,
-2386,
-2386,
-2386,
-2385,
-2385,
-2385,
-2385,
-2385,
-2384,
-2384,
-2384,
-2384,
-2383,
-2383,
-2383,
-2383,
-2383,
-2382,
-2382,
-2382,
-2382,
-2382,
-2381,
-2381,
-2381,
-2381,
-2381,
-2380,
-2380,
-2380,
-2380,
-2379,
-2379,
-2379,
-2379,
-2379,
-2378,
-2378,
-2378,
-2378,
-2378,
-2377,
-2377,
-2377,
-2377,
-2377,
-2376,
-2376,
-2376,
-2376,
-2375,
-2375,
-2375,
-2375,
-2375,
-2374,
-2374,
-2374,
-2374,
-2374,
-2373,
-2373,
-2373,
-2373,
-2372,
-2372,
-2372,
-2372,
-2372,
-2371,
-2371,
-2371,
-2371,
-2371,
-2370,
-2370,
-2370,
-2370,
-2370,
-2369,
-2369,
-2369,
-2369,
-2368,
-2368,
-2368,
-2368,
-2368,
-2367,
-2367,
-2367,
-2367,
-2367,
-2366,
-2366,
-2366,
-2366,
-2366,
-2365,
-2365,
-2365,
-2365,
-2364,
-2364,
-2364,
-2364,
-2364,
-2363,
-2363,
-2363,
-2363,
-2363,
-2362,
-2362,
-2362,
-2362,
-2362,
-2361,
-2361,
-2361,
-2361,
-2360,
-2360,
-2360,
-2360,
-2360,
-2359,
-2359,
-2359,
-2359,
-2359,
-2358,
-2358,
-2358,
-2358,
-2358,
-2357,
-2357,
-2357,
-2357,
-2356,
-2356,
-2356,
-2356,
-2356,
-2355,
-2355,
-2355,
-2355,
-2355,
-2354,
-2354,
-2354,
-2354,
-2354,
-2353,
-2353,
-2353,
-2353,
-2352,
-2352,
-2352,
-2352,
-2352,
-2351,
-2351,
-2351,
-2351,
-2351,
-2350,
-2350,
-2350,
-2350,
-2350,
-2349,
-2349,
-2349,
-2349,
-2349,
-2348,
-2348,
-2348,
-2348,
-2347,
-2347,
-2347,
-2347,
-2347,
-2346,
-2346,
-2346,
-2346,
-2346,
-2345,
-2345,
-2345,
-2345,
-2345,
-2344,
-2344,
-2344,
-2344,
-2343,
-2343,
-2343,
-2343,
-2343,
-2342,
-2342,
-2342,
-2342,
-2342,
-2341,
-2341,
-2341,
-2341,
-2341,
-2340,
-2340,
-2340,
-2340,
-2340,
-2339,
-2339,
-2339,
-2339,
-2338,
-2338,
-2338,
-2338,
-2338,
-2337,
-2337,
-2337,
-2337,
-2337,
-2336,
-2336,
-2336,
-2336,
-2336,
-2335,
-2335,
-2335,
-2335,
-2335,
-2334,
-2334,
-2334,
-2334,
-2333,
-2333,
-2333,
-2333,
-2333,
-2332,
-2332,
-2332,
-2332,
-2332,
-2331,
-2331,
-2331,
-2331,
-2331,
-2330,
-2330,
-2330,
-2330,
-2330,
-2329,
-2329,
-2329,
-2329,
-2329,
-2328,
-2328,
-2328,
-2328,
-2327,
-2327,
-2327,
-2327,
-2327,
-2326,
-2326,
-2326,
-2326,
-2326,
-2325,
-2325,
-2325,
-2325,
-2325,
-2324,
-2324,
-2324,
-2324,
-2324,
-2323,
-2323,
-2323,
-2323,
-2322,
-2322,
-2322,
-2322,
-2322,
-2321,
-2321,
-2321,
-2321,
-2321,
-2320,
-2320,
-2320,
-2320,
-2320,
-2319,
-2319,
-2319,
-2319,
-2319,
-2318,
-2318,
-2318,
-2318,
-2318,
-2317,
-2317,
-2317,
-2317,
-2316,
-2316,
-2316,
-2316,
-2316,
-2315,
-2315,
-2315,
-2315,
-2315,
-2314,
-2314,
-2314,
-2314,
-2314,
-2313,
-2313,
-2313,
-2313,
-2313,
-2312,
-2312,
-2312,
-2312,
-2312,
-2311,
-2311,
-2311,
-2311,
-2310,
-2310,
-2310,
-2310,
-2310,
-2309,
-2309,
-2309,
-2309,
-2309,
-2308,
-2308,
-2308,
-2308,
-2308,
-2307,
-2307,
-2307,
-2307,
-2307,
-2306,
-2306,
-2306,
-2306,
-2306,
-2305,
-2305,
-2305,
-2305,
-2305,
-2304,
-2304,
-2304,
-2304,
-2303,
-2303,
-2303,
-2303,
-2303,
-2302,
-2302,
-2302,
-2302,
-2302,
-2301,
-2301,
-2301,
-2301,
-2301,
-2300,
-2300,
-2300,
-2300,
-2300,
-2299,
-2299,
-2299,
-2299,
-2299,
-2298,
-2298,
-2298,
-2298,
-2298,
-2297,
-2297,
-2297,
-2297,
-2297,
-2296,
-2296,
-2296,
-2296,
-2295,
-2295,
-2295,
-2295,
-2295,
-2294,
-2294,
-2294,
-2294,
-2294,
-2293,
-2293,
-2293,
-2293,
-2293,
-2292,
-2292,
-2292,
-2292,
-2292,
-2291,
-2291,
-2291,
-2291,
-2291,
-2290,
-2290,
-2290,
-2290,
-2290,
-2289,
-2289,
-2289,
-2289,
-2289,
-2288,
-2288,
-2288,
-2288,
-2287,
-2287,
-2287,
-2287,
-2287,
-2286,
-2286,
-2286,
-2286,
-2286,
-2285,
-2285,
-2285,
-2285,
-2285,
-2284,
-2284,
-2284,
-2284,
-2284,
-2283,
-2283,
-2283,
-2283,
-2283,
-2282,
-2282,
-2282,
-2282,
-2282,
-2281,
-2281,
-2281,
-2281,
-2281,
-2280,
-2280,
-2280,
-2280,
-2280,
-2279,
-2279,
-2279,
-2279,
-2279,
-2278,
-2278,
-2278,
-2278,
-2277,
-2277,
-2277,
-2277,
-2277,
-2276,
-2276,
-2276,
-2276,
-2276,
-2275,
-2275,
-2275,
-2275,
-2275,
-2274,
-2274,
-2274,
-2274,
-2274,
-2273,
-2273,
-2273,
-2273,
-2273,
-2272,
-2272,
-2272,
-2272,
-2272,
-2271,
-2271,
-2271,
-2271,
-2271,
-2270,
-2270,
-2270,
-2270,
-2270,
-2269,
-2269,
-2269,
-2269,
-2269,
-2268,
-2268,
-2268,
-2268,
-2268,
-2267,
-2267,
-2267,
-2267,
-2267,
-2266,
-2266,
-2266,
-2266,
-2266,
-2265,
-2265,
-2265,
-2265,
-2264,
-2264,
-2264,
-2264,
-2264,
-2263,
-2263,
-2263,
-2263,
-2263,
-2262,
-2262,
-2262,
-2262,
-2262,
-2261,
-2261,
-2261,
-2261,
-2261,
-2260,
-2260,
-2260,
-2260,
-2260,
-2259,
-2259,
-2259,
-2259,
-2259,
-2258,
-2258,
-2258,
-2258,
-2258,
-2257,
-2257,
-2257,
-2257,
-2257,
-2256,
-2256,
-2256,
-2256,
-2256,
-2255,
-2255,
-2255,
-2255,
-2255,
-2254,
-2254,
-2254,
-2254,
-2254,
-2253,
-2253,
-2253,
-2253,
-2253,
-2252,
-2252,
-2252,
-2252,
-2252,
-2251,
-2251,
-2251,
-2251,
-2251,
-2250,
-2250,
-2250,
-2250,
-2250,
-2249,
-2249,
-2249,
-2249,
-2249,
-2248,
-2248,
-2248,
-2248,
-2248,
-2247,
-2247,
-2247,
-2247,
-2247,
-2246,
-2246,
-2246,
-2246,
-2246,
-2245,
-2245,
-2245,
-2245,
-2245,
-2244,
-2244,
-2244,
-2244,
-2244,
-2243,
-2243,
-2243,
-2243,
-2242,
-2242,
-2242,
-2242,
-2242,
-2241,
-2241,
-2241,
-2241,
-2241,
-2240,
-2240,
-2240,
-2240,
-2240,
-2239,
-2239,
-2239,
-2239,
-2239,
-2238,
-2238,
-2238,
-2238,
-2238,
-2237,
-2237,
-2237,
-2237,
-2237,
-2236,
-2236,
-2236,
-2236,
-2236,
-2235,
-2235,
-2235,
-2235,
-2235,
-2234,
-2234,
-2234,
-2234,
-2234,
-2233,
-2233,
-2233,
-2233,
-2233,
-2232,
-2232,
-2232,
-2232,
-2232,
-2231,
-2231,
-2231,
-2231,
-2231,
-2230,
-2230,
-2230,
-2230,
-2230,
-2229,
-2229,
-2229,
-2229,
-2229,
-2228,
-2228,
-2228,
-2228,
-2228,
-2227,
-2227,
-2227,
-2227,
-2227,
-2226,
-2226,
-2226,
-2226,
-2226,
-2225,
-2225,
-2225,
-2225,
-2225,
-2224,
-2224,
-2224,
-2224,
-2224,
-2223,
-2223,
-2223,
-2223,
-2223,
-2222,
-2222,
-2222,
-2222,
-2222,
-2221,
-2221,
-2221,
-2221,
-2221,
-2220,
-2220,
-2220,
-2220,
-2220,
-2220,
-2219,
-2219,
-2219,
-2219,
-2219,
-2218,
-2218,
-2218,
-2218,
-2218,
-2217,
-2217,
-2217,
-2217,
-2217,
-2216,
-2216,
-2216,
-2216,
-2216,
-2215,
-2215,
-2215,
-2215,
-2215,
-2214,
-2214,
-2214,
-2214,
-2214,
-2213,
-2213,
-2213,
-2213,
-2213,
-2212,
-2212,
-2212,
-2212,
-2212,
-2211,
-2211,
-2211,
-2211,
-2211,
-2210,
-2210,
-2210,
-2210,
-2210,
-2209,
-2209,
-2209,
-2209,
-2209,
-2208,
-2208,
-2208,
-2208,
-2208,
-2207,
-2207,
-2207,
-2207,
-2207,
-2206,
-2206,
-2206,
-2206,
-2206,
-2205,
-2205,
-2205,
-2205,
-2205,
-2204,
-2204,
-2204,
-2204,
-2204,
-2203,
-2203,
-2203,
-2203,
-2203,
-2202,
-2202,
-2202,
-2202,
-2202,
-2201,
-2201,
-2201,
-2201,
-2201,
-2200,
-2200,
-2200,
-2200,
-2200,
-2199,
-2199,
-2199,
-2199,
-2199,
-2198,
-2198,
-2198,
-2198,
-2198,
-2198,
-2197,
-2197,
-2197,
-2197,
-2197,
-2196,
-2196,
-2196,
-2196,
-2196,
-2195,
-2195,
-2195,
-2195,
-2195,
-2194,
-2194,
-2194,
-2194,
-2194,
-2193,
-2193,
-2193,
-2193,
-2193,
-2192,
-2192,
-2192,
-2192,
-2192,
-2191,
-2191,
-2191,
-2191,
-2191,
-2190,
-2190,
-2190,
-2190,
-2190,
-2189,
-2189,
-2189,
-2189,
-2189,
-2188,
-2188,
-2188,
-2188,
-2188,
-2187,
-2187,
-2187,
-2187,
-2187,
-2186,
-2186,
-2186,
-2186,
-2186,
-2186,
-2185,
-2185,
-2185,
-2185,
-2185,
-2184,
-2184,
-2184,
-2184,
-2184,
-2183,
-2183,
-2183,
-2183,
-2183,
-2182,
-2182,
-2182,
-2182,
-2182,
-2181,
-2181,
-2181,
-2181,
-2181,
-2180,
-2180,
-2180,
-2180,
-2180,
-2179,
-2179,
-2179,
-2179,
-2179,
-2178,
-2178,
-2178,
-2178,
-2178,
-2177,
-2177,
-2177,
-2177,
-2177,
-2176,
-2176,
-2176,
-2176,
-2176,
-2176,
-2175,
-2175,
-2175,
-2175,
-2175,
-2174,
-2174,
-2174,
-2174,
-2174,
-2173,
-2173,
-2173,
-2173,
-2173,
-2172,
-2172,
-2172,
-2172,
-2172,
-2171,
-2171,
-2171,
-2171,
-2171,
-2170,
-2170,
-2170,
-2170,
-2170,
-2169,
-2169,
-2169,
-2169,
-2169,
-2168,
-2168,
-2168,
-2168,
-2168,
-2168,
-2167,
-2167,
-2167,
-2167,
-2167,
-2166,
-2166,
-2166,
-2166,
-2166,
-2165,
-2165,
-2165,
-2165,
-2165,
-2164,
-2164,
-2164,
-2164,
-2164,
-2163,
-2163,
-2163,
-2163,
-2163,
-2162,
-2162,
-2162,
-2162,
-2162,
-2161,
-2161,
-2161,
-2161,
-2161,
-2161,
-2160,
-2160,
-2160,
-2160,
-2160,
-2159,
-2159,
-2159,
-2159,
-2159,
-2158,
-2158,
-2158,
-2158,
-2158,
-2157,
-2157,
-2157,
-2157,
-2157,
-2156,
-2156,
-2156,
-2156,
-2156,
-2155,
-2155,
-2155,
-2155,
-2155,
-2154,
-2154,
-2154,
-2154,
-2154,
-2154,
-2153,
-2153,
-2153,
-2153,
-2153,
-2152,
-2152,
-2152,
-2152,
-2152,
-2151,
-2151,
-2151,
-2151,
-2151,
-2150,
-2150,
-2150,
-2150,
-2150,
-2149,
-2149,
-2149,
-2149,
-2149,
-2148,
-2148,
-2148,
-2148,
-2148,
-2148,
-2147,
-2147,
-2147,
-2147,
-2147,
-2146,
-2146,
-2146,
-2146,
-2146,
-2145,
-2145,
-2145,
-2145,
-2145,
-2144,
-2144,
-2144,
-2144,
-2144,
-2143,
-2143,
-2143,
-2143,
-2143,
-2143,
-2142,
-2142,
-2142,
-2142,
-2142,
-2141,
-2141,
-2141,
-2141,
-2141,
-2140,
-2140,
-2140,
-2140,
-2140,
-2139,
-2139,
-2139,
-2139,
-2139,
-2138,
-2138,
-2138,
-2138,
-2138,
-2137,
-2137,
-2137,
-2137,
-2137,
-2137,
-2136,
-2136,
-2136,
-2136,
-2136,
-2135,
-2135,
-2135,
-2135,
-2135,
-2134,
-2134,
-2134,
-2134,
-2134,
-2133,
-2133,
-2133,
-2133,
-2133,
-2132,
-2132,
-2132,
-2132,
-2132,
-2132,
-2131,
-2131,
-2131,
-2131,
-2131,
-2130,
-2130,
-2130,
-2130,
-2130,
-2129,
-2129,
-2129,
-2129,
-2129,
-2128,
-2128,
-2128,
-2128,
-2128,
-2128,
-2127,
-2127,
-2127,
-2127,
-2127,
-2126,
-2126,
-2126,
-2126,
-2126,
-2125,
-2125,
-2125,
-2125,
-2125,
-2124,
-2124,
-2124,
-2124,
-2124,
-2123,
-2123,
-2123,
-2123,
-2123,
-2123,
-2122,
-2122,
-2122,
-2122,
-2122,
-2121,
-2121,
-2121,
-2121,
-2121,
-2120,
-2120,
-2120,
-2120,
-2120,
-2119,
-2119,
-2119,
-2119,
-2119,
-2119,
-2118,
-2118,
-2118,
-2118,
-2118,
-2117,
-2117,
-2117,
-2117,
-2117,
-2116,
-2116,
-2116,
-2116,
-2116,
-2115,
-2115,
-2115,
-2115,
-2115,
-2115,
-2114,
-2114,
-2114,
-2114,
-2114,
-2113,
-2113,
-2113,
-2113,
-2113,
-2112,
-2112,
-2112,
-2112,
-2112,
-2111,
-2111,
-2111,
-2111,
-2111,
-2111,
-2110,
-2110,
-2110,
-2110,
-2110,
-2109,
-2109,
-2109,
-2109,
-2109,
-2108,
-2108,
-2108,
-2108,
-2108,
-2107,
-2107,
-2107,
-2107,
-2107,
-2107,
-2106,
-2106,
-2106,
-2106,
-2106,
-2105,
-2105,
-2105,
-2105,
-2105,
-2104,
-2104,
-2104,
-2104,
-2104,
-2103,
-2103,
-2103,
-2103,
-2103,
-2103,
-2102,
-2102,
-2102,
-2102,
-2102,
-2101,
-2101,
-2101,
-2101,
-2101,
-2100,
-2100,
-2100,
-2100,
-2100,
-2100,
-2099,
-2099,
-2099,
-2099,
-2099,
-2098,
-2098,
-2098,
-2098,
-2098,
-2097,
-2097,
-2097,
-2097,
-2097,
-2096,
-2096,
-2096,
-2096,
-2096,
-2096,
-2095,
-2095,
-2095,
-2095,
-2095,
-2094,
-2094,
-2094,
-2094,
-2094,
-2093,
-2093,
-2093,
-2093,
-2093,
-2093,
-2092,
-2092,
-2092,
-2092,
-2092,
-2091,
-2091,
-2091,
-2091,
-2091,
-2090,
-2090,
-2090,
-2090,
-2090,
-2089,
-2089,
-2089,
-2089,
-2089,
-2089,
-2088,
-2088,
-2088,
-2088,
-2088,
-2087,
-2087,
-2087,
-2087,
-2087,
-2086,
-2086,
-2086,
-2086,
-2086,
-2086,
-2085,
-2085,
-2085,
-2085,
-2085,
-2084,
-2084,
-2084,
-2084,
-2084,
-2083,
-2083,
-2083,
-2083,
-2083,
-2083,
-2082,
-2082,
-2082,
-2082,
-2082,
-2081,
-2081,
-2081,
-2081,
-2081,
-2080,
-2080,
-2080,
-2080,
-2080,
-2080,
-2079,
-2079,
-2079,
-2079,
-2079,
-2078,
-2078,
-2078,
-2078,
-2078,
-2077,
-2077,
-2077,
-2077,
-2077,
-2077,
-2076,
-2076,
-2076,
-2076,
-2076,
-2075,
-2075,
-2075,
-2075,
-2075,
-2074,
-2074,
-2074,
-2074,
-2074,
-2074,
-2073,
-2073,
-2073,
-2073,
-2073,
-2072,
-2072,
-2072,
-2072,
-2072,
-2071,
-2071,
-2071,
-2071,
-2071,
-2071,
-2070,
-2070,
-2070,
-2070,
-2070,
-2069,
-2069,
-2069,
-2069,
-2069,
-2068,
-2068,
-2068,
-2068,
-2068,
-2068,
-2067,
-2067,
-2067,
-2067,
-2067,
-2066,
-2066,
-2066,
-2066,
-2066,
-2065,
-2065,
-2065,
-2065,
-2065,
-2065,
-2064,
-2064,
-2064,
-2064,
-2064,
-2063,
-2063,
-2063,
-2063,
-2063,
-2062,
-2062,
-2062,
-2062,
-2062,
-2062,
-2061,
-2061,
-2061,
-2061,
-2061,
-2060,
-2060,
-2060,
-2060,
-2060,
-2060,
-2059,
-2059,
-2059,
-2059,
-2059,
-2058,
-2058,
-2058,
-2058,
-2058,
-2057,
-2057,
-2057,
-2057,
-2057,
-2057,
-2056,
-2056,
-2056,
-2056,
-2056,
-2055,
-2055,
-2055,
-2055,
-2055,
-2054,
-2054,
-2054,
-2054,
-2054,
-2054,
-2053,
-2053,
-2053,
-2053,
-2053,
-2052,
-2052,
-2052,
-2052,
-2052,
-2052,
-2051,
-2051,
-2051,
-2051,
-2051,
-2050,
-2050,
-2050,
-2050,
-2050,
-2049,
-2049,
-2049,
-2049,
-2049,
-2049,
-2048,
-2048,
-2048,
-2048,
-2048,
-2047,
-2047,
-2047,
-2047,
-2047,
-2047,
-2046,
-2046,
-2046,
-2046,
-2046,
-2045,
-2045,
-2045,
-2045,
-2045,
-2044,
-2044,
-2044,
-2044,
-2044,
-2044,
-2043,
-2043,
-2043,
-2043,
-2043,
-2042,
-2042,
-2042,
-2042,
-2042,
-2042,
-2041,
-2041,
-2041,
-2041,
-2041,
-2040,
-2040,
-2040,
-2040,
-2040,
-2040,
-2039,
-2039,
-2039,
-2039,
-2039,
-2038,
-2038,
-2038,
-2038,
-2038,
-2037,
-2037,
-2037,
-2037,
-2037,
-2037,
-2036,
-2036,
-2036,
-2036,
-2036,
-2035,
-2035,
-2035,
-2035,
-2035,
-2035,
-2034,
-2034,
-2034,
-2034,
-2034,
-2033,
-2033,
-2033,
-2033,
-2033,
-2033,
-2032,
-2032,
-2032,
-2032,
-2032,
-2031,
-2031,
-2031,
-2031,
-2031,
-2030,
-2030,
-2030,
-2030,
-2030,
-2030,
-2029,
-2029,
-2029,
-2029,
-2029,
-2028,
-2028,
-2028,
-2028,
-2028,
-2028,
-2027,
-2027,
-2027,
-2027,
-2027,
-2026,
-2026,
-2026,
-2026,
-2026,
-2026,
-2025,
-2025,
-2025,
-2025,
-2025,
-2024,
-2024,
-2024,
-2024,
-2024,
-2024,
-2023,
-2023,
-2023,
-2023,
-2023,
-2022,
-2022,
-2022,
-2022,
-2022,
-2021,
-2021,
-2021,
-2021,
-2021,
-2021,
-2020,
-2020,
-2020,
-2020,
-2020,
-2019,
-2019,
-2019,
-2019,
-2019,
-2019,
-2018,
-2018,
-2018,
-2018,
-2018,
-2017,
-2017,
-2017,
-2017,
-2017,
-2017,
-2016,
-2016,
-2016,
-2016,
-2016,
-2015,
-2015,
-2015,
-2015,
-2015,
-2015,
-2014,
-2014,
-2014,
-2014,
-2014,
-2013,
-2013,
-2013,
-2013,
-2013,
-2013,
-2012,
-2012,
-2012,
-2012,
-2012,
-2011,
-2011,
-2011,
-2011,
-2011,
-2011,
-2010,
-2010,
-2010,
-2010,
-2010,
-2009,
-2009,
-2009,
-2009,
-2009,
-2009,
-2008,
-2008,
-2008,
-2008,
-2008,
-2007,
-2007,
-2007,
-2007,
-2007,
-2007,
-2006,
-2006,
-2006,
-2006,
-2006,
-2005,
-2005,
-2005,
-2005,
-2005,
-2005,
-2004,
-2004,
-2004,
-2004,
-2004,
-2003,
-2003,
-2003,
-2003,
-2003,
-2003,
-2002,
-2002,
-2002,
-2002,
-2002,
-2001,
-2001,
-2001,
-2001,
-2001,
-2001,
-2000,
-2000,
-2000,
-2000,
-2000,
-1999,
-1999,
-1999,
-1999,
-1999,
-1999,
-1998,
-1998,
-1998,
-1998,
-1998,
-1997,
-1997,
-1997,
-1997,
-1997,
-1997,
-1996,
-1996,
-1996,
-1996,
-1996,
-1995,
-1995,
-1995,
-1995,
-1995,
-1995,
-1994,
-1994,
-1994,
-1994,
-1994,
-1993,
-1993,
-1993,
-1993,
-1993,
-1993,
-1992,
-1992,
-1992,
-1992,
-1992,
-1992,
-1991,
-1991,
-1991,
-1991,
-1991,
-1990,
-1990,
-1990,
-1990,
-1990,
-1990,
-1989,
-1989,
-1989,
-1989,
-1989,
-1988,
-1988,
-1988,
-1988,
-1988,
-1988,
-1987,
-1987,
-1987,
-1987,
-1987,
-1986,
-1986,
-1986,
-1986,
-1986,
-1986,
-1985,
-1985,
-1985,
-1985,
-1985,
-1984,
-1984,
-1984,
-1984,
-1984,
-1984,
-1983,
-1983,
-1983,
-1983,
-1983,
-1982,
-1982,
-1982,
-1982,
-1982,
-1982,
-1981,
-1981,
-1981,
-1981,
-1981,
-1981,
-1980,
-1980,
-1980,
-1980,
-1980,
-1979,
-1979,
-1979,
-1979,
-1979,
-1979,
-1978,
-1978,
-1978,
-1978,
-1978,
-1977,
-1977,
-1977,
-1977,
-1977,
-1977,
-1976,
-1976,
-1976,
-1976,
-1976,
-1975,
-1975,
-1975,
-1975,
-1975,
-1975,
-1974,
-1974,
-1974,
-1974,
-1974,
-1974,
-1973,
-1973,
-1973,
-1973,
-1973,
-1972,
-1972,
-1972,
-1972,
-1972,
-1972,
-1971,
-1971,
-1971,
-1971,
-1971,
-1970,
-1970,
-1970,
-1970,
-1970,
-1970,
-1969,
-1969,
-1969,
-1969,
-1969,
-1969,
-1968,
-1968,
-1968,
-1968,
-1968,
-1967,
-1967,
-1967,
-1967,
-1967,
-1967,
-1966,
-1966,
-1966,
-1966,
-1966,
-1965,
-1965,
-1965,
-1965,
-1965,
-1965,
-1964,
-1964,
-1964,
-1964,
-1964,
-1964,
-1963,
-1963,
-1963,
-1963,
-1963,
-1962,
-1962,
-1962,
-1962,
-1962,
-1962,
-1961,
-1961,
-1961,
-1961,
-1961,
-1960,
-1960,
-1960,
-1960,
-1960,
-1960,
-1959,
-1959,
-1959,
-1959,
-1959,
-1959,
-1958,
-1958,
-1958,
-1958,
-1958,
-1957,
-1957,
-1957,
-1957,
-1957,
-1957,
-1956,
-1956,
-1956,
-1956,
-1956,
-1956,
-1955,
-1955,
-1955,
-1955,
-1955,
-1954,
-1954,
-1954,
-1954,
-1954,
-1954,
-1953,
-1953,
-1953,
-1953,
-1953,
-1952,
-1952,
-1952,
-1952,
-1952,
-1952,
-1951,
-1951,
-1951,
-1951,
-1951,
-1951,
-1950,
-1950,
-1950,
-1950,
-1950,
-1949,
-1949,
-1949,
-1949,
-1949,
-1949,
-1948,
-1948,
-1948,
-1948,
-1948,
-1948,
-1947,
-1947,
-1947,
-1947,
-1947,
-1946,
-1946,
-1946,
-1946,
-1946,
-1946,
-1945,
-1945,
-1945,
-1945,
-1945,
-1945,
-1944,
-1944,
-1944,
-1944,
-1944,
-1943,
-1943,
-1943,
-1943,
-1943,
-1943,
-1942,
-1942,
-1942,
-1942,
-1942,
-1942,
-1941,
-1941,
-1941,
-1941,
-1941,
-1940,
-1940,
-1940,
-1940,
-1940,
-1940,
-1939,
-1939,
-1939,
-1939,
-1939,
-1939,
-1938,
-1938,
-1938,
-1938,
-1938,
-1937,
-1937,
-1937,
-1937,
-1937,
-1937,
-1936,
-1936,
-1936,
-1936,
-1936,
-1936,
-1935,
-1935,
-1935,
-1935,
-1935,
-1934,
-1934,
-1934,
-1934,
-1934,
-1934,
-1933,
-1933,
-1933,
-1933,
-1933,
-1933,
-1932,
-1932,
-1932,
-1932,
-1932,
-1931,
-1931,
-1931,
-1931,
-1931,
-1931,
-1930,
-1930,
-1930,
-1930,
-1930,
-1930,
-1929,
-1929,
-1929,
-1929,
-1929,
-1929,
-1928,
-1928,
-1928,
-1928,
-1928,
-1927,
-1927,
-1927,
-1927,
-1927,
-1927,
-1926,
-1926,
-1926,
-1926,
-1926,
-1926,
-1925,
-1925,
-1925,
-1925,
-1925,
-1924,
-1924,
-1924,
-1924,
-1924,
-1924,
-1923,
-1923,
-1923,
-1923,
-1923,
-1923,
-1922,
-1922,
-1922,
-1922,
-1922,
-1921,
-1921,
-1921,
-1921,
-1921,
-1921,
-1920,
-1920,
-1920,
-1920,
-1920,
-1920,
-1919,
-1919,
-1919,
-1919,
-1919,
-1919,
-1918,
-1918,
-1918,
-1918,
-1918,
-1917,
-1917,
-1917,
-1917,
-1917,
-1917,
-1916,
-1916,
-1916,
-1916,
-1916,
-1916,
-1915,
-1915,
-1915,
-1915,
-1915,
-1915,
-1914,
-1914,
-1914,
-1914,
-1914,
-1913,
-1913,
-1913,
-1913,
-1913,
-1913,
-1912,
-1912,
-1912,
-1912,
-1912,
-1912,
-1911,
-1911,
-1911,
-1911,
-1911,
-1911,
-1910,
-1910,
-1910,
-1910,
-1910,
-1909,
-1909,
-1909,
-1909,
-1909,
-1909,
-1908,
-1908,
-1908,
-1908,
-1908,
-1908,
-1907,
-1907,
-1907,
-1907,
-1907,
-1907,
-1906,
-1906,
-1906,
-1906,
-1906,
-1905,
-1905,
-1905,
-1905,
-1905,
-1905,
-1904,
-1904,
-1904,
-1904,
-1904,
-1904,
-1903,
-1903,
-1903,
-1903,
-1903,
-1903,
-1902,
-1902,
-1902,
-1902,
-1902,
-1901,
-1901,
-1901,
-1901,
-1901,
-1901,
-1900,
-1900,
-1900,
-1900,
-1900,
-1900,
-1899,
-1899,
-1899,
-1899,
-1899,
-1899,
-1898,
-1898,
-1898,
-1898,
-1898,
-1898,
-1897,
-1897,
-1897,
-1897,
-1897,
-1896,
-1896,
-1896,
-1896,
-1896,
-1896,
-1895,
-1895,
-1895,
-1895,
-1895,
-1895,
-1894,
-1894,
-1894,
-1894,
-1894,
-1894,
-1893,
-1893,
-1893,
-1893,
-1893,
-1893,
-1892,
-1892,
-1892,
-1892,
-1892,
-1891,
-1891,
-1891,
-1891,
-1891,
-1891,
-1890,
-1890,
-1890,
-1890,
-1890,
-1890,
-1889,
-1889,
-1889,
-1889,
-1889,
-1889,
-1888,
-1888,
-1888,
-1888,
-1888,
-1888,
-1887,
-1887,
-1887,
-1887,
-1887,
-1886,
-1886,
-1886,
-1886,
-1886,
-1886,
-1885,
-1885,
-1885,
-1885,
-1885,
-1885,
-1884,
-1884,
-1884,
-1884,
-1884,
-1884,
-1883,
-1883,
-1883,
-1883,
-1883,
-1883,
-1882,
-1882,
-1882,
-1882,
-1882,
-1881,
-1881,
-1881,
-1881,
-1881,
-1881,
-1880,
-1880,
-1880,
-1880,
-1880,
-1880,
-1879,
-1879,
-1879,
-1879,
-1879,
-1879,
-1878,
-1878,
-1878,
-1878,
-1878,
-1878,
-1877,
-1877,
-1877,
-1877,
-1877,
-1877,
-1876,
-1876,
-1876,
-1876,
-1876,
-1876,
-1875,
-1875,
-1875,
-1875,
-1875,
-1874,
-1874,
-1874,
-1874,
-1874,
-1874,
-1873,
-1873,
-1873,
-1873,
-1873,
-1873,
-1872,
-1872,
-1872,
-1872,
-1872,
-1872,
-1871,
-1871,
-1871,
-1871,
-1871,
-1871,
-1870,
-1870,
-1870,
-1870,
-1870,
-1870,
-1869,
-1869,
-1869,
-1869,
-1869,
-1869,
-1868,
-1868,
-1868,
-1868,
-1868,
-1867,
-1867,
-1867,
-1867,
-1867,
-1867,
-1866,
-1866,
-1866,
-1866,
-1866,
-1866,
-1865,
-1865,
-1865,
-1865,
-1865,
-1865,
-1864,
-1864,
-1864,
-1864,
-1864,
-1864,
-1863,
-1863,
-1863,
-1863,
-1863,
-1863,
-1862,
-1862,
-1862,
-1862,
-1862,
-1862,
-1861,
-1861,
-1861,
-1861,
-1861,
-1861,
-1860,
-1860,
-1860,
-1860,
-1860,
-1859,
-1859,
-1859,
-1859,
-1859,
-1859,
-1858,
-1858,
-1858,
-1858,
-1858,
-1858,
-1857,
-1857,
-1857,
-1857,
-1857,
-1857,
-1856,
-1856,
-1856,
-1856,
-1856,
-1856,
-1855,
-1855,
-1855,
-1855,
-1855,
-1855,
-1854,
-1854,
-1854,
-1854,
-1854,
-1854,
-1853,
-1853,
-1853,
-1853,
-1853,
-1853,
-1852,
-1852,
-1852,
-1852,
-1852,
-1852,
-1851,
-1851,
-1851,
-1851,
-1851,
-1851,
-1850,
-1850,
-1850,
-1850,
-1850,
-1850,
-1849,
-1849,
-1849,
-1849,
-1849,
-1848,
-1848,
-1848,
-1848,
-1848,
-1848,
-1847,
-1847,
-1847,
-1847,
-1847,
-1847,
-1846,
-1846,
-1846,
-1846,
-1846,
-1846,
-1845,
-1845,
-1845,
-1845,
-1845,
-1845,
-1844,
-1844,
-1844,
-1844,
-1844,
-1844,
-1843,
-1843,
-1843,
-1843,
-1843,
-1843,
-1842,
-1842,
-1842,
-1842,
-1842,
-1842,
-1841,
-1841,
-1841,
-1841,
-1841,
-1841,
-1840,
-1840,
-1840,
-1840,
-1840,
-1840,
-1839,
-1839,
-1839,
-1839,
-1839,
-1839,
-1838,
-1838,
-1838,
-1838,
-1838,
-1838,
-1837,
-1837,
-1837,
-1837,
-1837,
-1837,
-1836,
-1836,
-1836,
-1836,
-1836,
-1836,
-1835,
-1835,
-1835,
-1835,
-1835,
-1835,
-1834,
-1834,
-1834,
-1834,
-1834,
-1834,
-1833,
-1833,
-1833,
-1833,
-1833,
-1833,
-1832,
-1832,
-1832,
-1832,
-1832,
-1832,
-1831,
-1831,
-1831,
-1831,
-1831,
-1831,
-1830,
-1830,
-1830,
-1830,
-1830,
-1830,
-1829,
-1829,
-1829,
-1829,
-1829,
-1829,
-1828,
-1828,
-1828,
-1828,
-1828,
-1828,
-1827,
-1827,
-1827,
-1827,
-1827,
-1827,
-1826,
-1826,
-1826,
-1826,
-1826,
-1826,
-1825,
-1825,
-1825,
-1825,
-1825,
-1825,
-1824,
-1824,
-1824,
-1824,
-1824,
-1824,
-1823,
-1823,
-1823,
-1823,
-1823,
-1823,
-1822,
-1822,
-1822,
-1822,
-1822,
-1822,
-1821,
-1821,
-1821,
-1821,
-1821,
-1821,
-1820,
-1820,
-1820,
-1820,
-1820,
-1820,
-1819,
-1819,
-1819,
-1819,
-1819,
-1819,
-1818,
-1818,
-1818,
-1818,
-1818,
-1818,
-1817,
-1817,
-1817,
-1817,
-1817,
-1817,
-1816,
-1816,
-1816,
-1816,
-1816,
-1816,
-1815,
-1815,
-1815,
-1815,
-1815,
-1815,
-1814,
-1814,
-1814,
-1814,
-1814,
-1814,
-1813,
-1813,
-1813,
-1813,
-1813,
-1813,
-1812,
-1812,
-1812,
-1812,
-1812,
-1812,
-1811,
-1811,
-1811,
-1811,
-1811,
-1811,
-1810,
-1810,
-1810,
-1810,
-1810,
-1810,
-1809,
-1809,
-1809,
-1809,
-1809,
-1809,
-1808,
-1808,
-1808,
-1808,
-1808,
-1808,
-1807,
-1807,
-1807,
-1807,
-1807,
-1807,
-1806,
-1806,
-1806,
-1806,
-1806,
-1806,
-1805,
-1805,
-1805,
-1805,
-1805,
-1805,
-1804,
-1804,
-1804,
-1804,
-1804,
-1804,
-1803,
-1803,
-1803,
-1803,
-1803,
-1803,
-1802,
-1802,
-1802,
-1802,
-1802,
-1802,
-1801,
-1801,
-1801,
-1801,
-1801,
-1801,
-1800,
-1800,
-1800,
-1800,
-1800,
-1800,
-1799,
-1799,
-1799,
-1799,
-1799,
-1799,
-1798,
-1798,
-1798,
-1798,
-1798,
-1798,
-1798,
-1797,
-1797,
-1797,
-1797,
-1797,
-1797,
-1796,
-1796,
-1796,
-1796,
-1796,
-1796,
-1795,
-1795,
-1795,
-1795,
-1795,
-1795,
-1794,
-1794,
-1794,
-1794,
-1794,
-1794,
-1793,
-1793,
-1793,
-1793,
-1793,
-1793,
-1792,
-1792,
-1792,
-1792,
-1792,
-1792,
-1791,
-1791,
-1791,
-1791,
-1791,
-1791,
-1790,
-1790,
-1790,
-1790,
-1790,
-1790,
-1789,
-1789,
-1789,
-1789,
-1789,
-1789,
-1788,
-1788,
-1788,
-1788,
-1788,
-1788,
-1787,
-1787,
-1787,
-1787,
-1787,
-1787,
-1787,
-1786,
-1786,
-1786,
-1786,
-1786,
-1786,
-1785,
-1785,
-1785,
-1785,
-1785,
-1785,
-1784,
-1784,
-1784,
-1784,
-1784,
-1784,
-1783,
-1783,
-1783,
-1783,
-1783,
-1783,
-1782,
-1782,
-1782,
-1782,
-1782,
-1782,
-1781,
-1781,
-1781,
-1781,
-1781,
-1781,
-1780,
-1780,
-1780,
-1780,
-1780,
-1780,
-1779,
-1779,
-1779,
-1779,
-1779,
-1779,
-1779,
-1778,
-1778,
-1778,
-1778,
-1778,
-1778,
-1777,
-1777,
-1777,
-1777,
-1777,
-1777,
-1776,
-1776,
-1776,
-1776,
-1776,
-1776,
-1775,
-1775,
-1775,
-1775,
-1775,
-1775,
-1774,
-1774,
-1774,
-1774,
-1774,
-1774,
-1773,
-1773,
-1773,
-1773,
-1773,
-1773,
-1772,
-1772,
-1772,
-1772,
-1772,
-1772,
-1772,
-1771,
-1771,
-1771,
-1771,
-1771,
-1771,
-1770,
-1770,
-1770,
-1770,
-1770,
-1770,
-1769,
-1769,
-1769,
-1769,
-1769,
-1769,
-1768,
-1768,
-1768,
-1768,
-1768,
-1768,
-1767,
-1767,
-1767,
-1767,
-1767,
-1767,
-1766,
-1766,
-1766,
-1766,
-1766,
-1766,
-1766,
-1765,
-1765,
-1765,
-1765,
-1765,
-1765,
-1764,
-1764,
-1764,
-1764,
-1764,
-1764,
-1763,
-1763,
-1763,
-1763,
-1763,
-1763,
-1762,
-1762,
-1762,
-1762,
-1762,
-1762,
-1761,
-1761,
-1761,
-1761,
-1761,
-1761,
-1761,
-1760,
-1760,
-1760,
-1760,
-1760,
-1760,
-1759,
-1759,
-1759,
-1759,
-1759,
-1759,
-1758,
-1758,
-1758,
-1758,
-1758,
-1758,
-1757,
-1757,
-1757,
-1757,
-1757,
-1757,
-1756,
-1756,
-1756,
-1756,
-1756,
-1756,
-1756,
-1755,
-1755,
-1755,
-1755,
-1755,
-1755,
-1754,
-1754,
-1754,
-1754,
-1754,
-1754,
-1753,
-1753,
-1753,
-1753,
-1753,
-1753,
-1752,
-1752,
-1752,
-1752,
-1752,
-1752,
-1751,
-1751,
-1751,
-1751,
-1751,
-1751,
-1751,
-1750,
-1750,
-1750,
-1750,
-1750,
-1750,
-1749,
-1749,
-1749,
-1749,
-1749,
-1749,
-1748,
-1748,
-1748,
-1748,
-1748,
-1748,
-1747,
-1747,
-1747,
-1747,
-1747,
-1747,
-1747,
-1746,
-1746,
-1746,
-1746,
-1746,
-1746,
-1745,
-1745,
-1745,
-1745,
-1745,
-1745,
-1744,
-1744,
-1744,
-1744,
-1744,
-1744,
-1743,
-1743,
-1743,
-1743,
-1743,
-1743,
-1743,
-1742,
-1742,
-1742,
-1742,
-1742,
-1742,
-1741,
-1741,
-1741,
-1741,
-1741,
-1741,
-1740,
-1740,
-1740,
-1740,
-1740,
-1740,
-1739,
-1739,
-1739,
-1739,
-1739,
-1739,
-1739,
-1738,
-1738,
-1738,
-1738,
-1738,
-1738,
-1737,
-1737,
-1737,
-1737,
-1737,
-1737,
-1736,
-1736,
-1736,
-1736,
-1736,
-1736,
-1735,
-1735,
-1735,
-1735,
-1735,
-1735,
-1735,
-1734,
-1734,
-1734,
-1734,
-1734,
-1734,
-1733,
-1733,
-1733,
-1733,
-1733,
-1733,
-1732,
-1732,
-1732,
-1732,
-1732,
-1732,
-1732,
-1731,
-1731,
-1731,
-1731,
-1731,
-1731,
-1730,
-1730,
-1730,
-1730,
-1730,
-1730,
-1729,
-1729,
-1729,
-1729,
-1729,
-1729,
-1728,
-1728,
-1728,
-1728,
-1728,
-1728,
-1728,
-1727,
-1727,
-1727,
-1727,
-1727,
-1727,
-1726,
-1726,
-1726,
-1726,
-1726,
-1726,
-1725,
-1725,
-1725,
-1725,
-1725,
-1725,
-1725,
-1724,
-1724,
-1724,
-1724,
-1724,
-1724,
-1723,
-1723,
-1723,
-1723,
-1723,
-1723,
-1722,
-1722,
-1722,
-1722,
-1722,
-1722,
-1722,
-1721,
-1721,
-1721,
-1721,
-1721,
-1721,
-1720,
-1720,
-1720,
-1720,
-1720,
-1720,
-1719,
-1719,
-1719,
-1719,
-1719,
-1719,
-1719,
-1718,
-1718,
-1718,
-1718,
-1718,
-1718,
-1717,
-1717,
-1717,
-1717,
-1717,
-1717,
-1716,
-1716,
-1716,
-1716,
-1716,
-1716,
-1716,
-1715,
-1715,
-1715,
-1715,
-1715,
-1715,
-1714,
-1714,
-1714,
-1714,
-1714,
-1714,
-1713,
-1713,
-1713,
-1713,
-1713,
-1713,
-1713,
-1712,
-1712,
-1712,
-1712,
-1712,
-1712,
-1711,
-1711,
-1711,
-1711,
-1711,
-1711,
-1710,
-1710,
-1710,
-1710,
-1710,
-1710,
-1710,
-1709,
-1709,
-1709,
-1709,
-1709,
-1709,
-1708,
-1708,
-1708,
-1708,
-1708,
-1708,
-1708,
-1707,
-1707,
-1707,
-1707,
-1707,
-1707,
-1706,
-1706,
-1706,
-1706,
-1706,
-1706,
-1705,
-1705,
-1705,
-1705,
-1705,
-1705,
-1705,
-1704,
-1704,
-1704,
-1704,
-1704,
-1704,
-1703,
-1703,
-1703,
-1703,
-1703,
-1703,
-1702,
-1702,
-1702,
-1702,
-1702,
-1702,
-1702,
-1701,
-1701,
-1701,
-1701,
-1701,
-1701,
-1700,
-1700,
-1700,
-1700,
-1700,
-1700,
-1700,
-1699,
-1699,
-1699,
-1699,
-1699,
-1699,
-1698,
-1698,
-1698,
-1698,
-1698,
-1698,
-1697,
-1697,
-1697,
-1697,
-1697,
-1697,
-1697,
-1696,
-1696,
-1696,
-1696,
-1696,
-1696,
-1695,
-1695,
-1695,
-1695,
-1695,
-1695,
-1695,
-1694,
-1694,
-1694,
-1694,
-1694,
-1694,
-1693,
-1693,
-1693,
-1693,
-1693,
-1693,
-1692,
-1692,
-1692,
-1692,
-1692,
-1692,
-1692,
-1691,
-1691,
-1691,
-1691,
-1691,
-1691,
-1690,
-1690,
-1690,
-1690,
-1690,
-1690,
-1690,
-1689,
-1689,
-1689,
-1689,
-1689,
-1689,
-1688,
-1688,
-1688,
-1688,
-1688,
-1688,
-1688,
-1687,
-1687,
-1687,
-1687,
-1687,
-1687,
-1686,
-1686,
-1686,
-1686,
-1686,
-1686,
-1686,
-1685,
-1685,
-1685,
-1685,
-1685,
-1685,
-1684,
-1684,
-1684,
-1684,
-1684,
-1684,
-1683,
-1683,
-1683,
-1683,
-1683,
-1683,
-1683,
-1682,
-1682,
-1682,
-1682,
-1682,
-1682,
-1681,
-1681,
-1681,
-1681,
-1681,
-1681,
-1681,
-1680,
-1680,
-1680,
-1680,
-1680,
-1680,
-1679,
-1679,
-1679,
-1679,
-1679,
-1679,
-1679,
-1678,
-1678,
-1678,
-1678,
-1678,
-1678,
-1677,
-1677,
-1677,
-1677,
-1677,
-1677,
-1677,
-1676,
-1676,
-1676,
-1676,
-1676,
-1676,
-1675,
-1675,
-1675,
-1675,
-1675,
-1675,
-1675,
-1674,
-1674,
-1674,
-1674,
-1674,
-1674,
-1673,
-1673,
-1673,
-1673,
-1673,
-1673,
-1673,
-1672,
-1672,
-1672,
-1672,
-1672,
-1672,
-1671,
-1671,
-1671,
-1671,
-1671,
-1671,
-1671,
-1670,
-1670,
-1670,
-1670,
-1670,
-1670,
-1669,
-1669,
-1669,
-1669,
-1669,
-1669,
-1669,
-1668,
-1668,
-1668,
-1668,
-1668,
-1668,
-1667,
-1667,
-1667,
-1667,
-1667,
-1667,
-1667,
-1666,
-1666,
-1666,
-1666,
-1666,
-1666,
-1665,
-1665,
-1665,
-1665,
-1665,
-1665,
-1665,
-1664,
-1664,
-1664,
-1664,
-1664,
-1664,
-1663,
-1663,
-1663,
-1663,
-1663,
-1663,
-1663,
-1662,
-1662,
-1662,
-1662,
-1662,
-1662,
-1661,
-1661,
-1661,
-1661,
-1661,
-1661,
-1661,
-1660,
-1660,
-1660,
-1660,
-1660,
-1660,
-1659,
-1659,
-1659,
-1659,
-1659,
-1659,
-1659,
-1658,
-1658,
-1658,
-1658,
-1658,
-1658,
-1657,
-1657,
-1657,
-1657,
-1657,
-1657,
-1657,
-1656,
-1656,
-1656,
-1656,
-1656,
-1656,
-1656,
-1655,
-1655,
-1655,
-1655,
-1655,
-1655,
-1654,
-1654,
-1654,
-1654,
-1654,
-1654,
-1654,
-1653,
-1653,
-1653,
-1653,
-1653,
-1653,
-1652,
-1652,
-1652,
-1652,
-1652,
-1652,
-1652,
-1651,
-1651,
-1651,
-1651,
-1651,
-1651,
-1650,
-1650,
-1650,
-1650,
-1650,
-1650,
-1650,
-1649,
-1649,
-1649,
-1649,
-1649,
-1649,
-1649,
-1648,
-1648,
-1648,
-1648,
-1648,
-1648,
-1647,
-1647,
-1647,
-1647,
-1647,
-1647,
-1647,
-1646,
-1646,
-1646,
-1646,
-1646,
-1646,
-1645,
-1645,
-1645,
-1645,
-1645,
-1645,
-1645,
-1644,
-1644,
-1644,
-1644,
-1644,
-1644,
-1643,
-1643,
-1643,
-1643,
-1643,
-1643,
-1643,
-1642,
-1642,
-1642,
-1642,
-1642,
-1642,
-1642,
-1641,
-1641,
-1641,
-1641,
-1641,
-1641,
-1640,
-1640,
-1640,
-1640,
-1640,
-1640,
-1640,
-1639,
-1639,
-1639,
-1639,
-1639,
-1639,
-1639,
-1638,
-1638,
-1638,
-1638,
-1638,
-1638,
-1637,
-1637,
-1637,
-1637,
-1637,
-1637,
-1637,
-1636,
-1636,
-1636,
-1636,
-1636,
-1636,
-1635,
-1635,
-1635,
-1635,
-1635,
-1635,
-1635,
-1634,
-1634,
-1634,
-1634,
-1634,
-1634,
-1634,
-1633,
-1633,
-1633,
-1633,
-1633,
-1633,
-1632,
-1632,
-1632,
-1632,
-1632,
-1632,
-1632,
-1631,
-1631,
-1631,
-1631,
-1631,
-1631,
-1631,
-1630,
-1630,
-1630,
-1630,
-1630,
-1630,
-1629,
-1629,
-1629,
-1629,
-1629,
-1629,
-1629,
-1628,
-1628,
-1628,
-1628,
-1628,
-1628,
-1628,
-1627,
-1627,
-1627,
-1627,
-1627,
-1627,
-1626,
-1626,
-1626,
-1626,
-1626,
-1626,
-1626,
-1625,
-1625,
-1625,
-1625,
-1625,
-1625,
-1625,
-1624,
-1624,
-1624,
-1624,
-1624,
-1624,
-1623,
-1623,
-1623,
-1623,
-1623,
-1623,
-1623,
-1622,
-1622,
-1622,
-1622,
-1622,
-1622,
-1622,
-1621,
-1621,
-1621,
-1621,
-1621,
-1621,
-1620,
-1620,
-1620,
-1620,
-1620,
-1620,
-1620,
-1619,
-1619,
-1619,
-1619,
-1619,
-1619,
-1619,
-1618,
-1618,
-1618,
-1618,
-1618,
-1618,
-1617,
-1617,
-1617,
-1617,
-1617,
-1617,
-1617,
-1616,
-1616,
-1616,
-1616,
-1616,
-1616,
-1616,
-1615,
-1615,
-1615,
-1615,
-1615,
-1615,
-1614,
-1614,
-1614,
-1614,
-1614,
-1614,
-1614,
-1613,
-1613,
-1613,
-1613,
-1613,
-1613,
-1613,
-1612,
-1612,
-1612,
-1612,
-1612,
-1612,
-1612,
-1611,
-1611,
-1611,
-1611,
-1611,
-1611,
-1610,
-1610,
-1610,
-1610,
-1610,
-1610,
-1610,
-1609,
-1609,
-1609,
-1609,
-1609,
-1609,
-1609,
-1608,
-1608,
-1608,
-1608,
-1608,
-1608,
-1607,
-1607,
-1607,
-1607,
-1607,
-1607,
-1607,
-1606,
-1606,
-1606,
-1606,
-1606,
-1606,
-1606,
-1605,
-1605,
-1605,
-1605,
-1605,
-1605,
-1605,
-1604,
-1604,
-1604,
-1604,
-1604,
-1604,
-1603,
-1603,
-1603,
-1603,
-1603,
-1603,
-1603,
-1602,
-1602,
-1602,
-1602,
-1602,
-1602,
-1602,
-1601,
-1601,
-1601,
-1601,
-1601,
-1601,
-1601,
-1600,
-1600,
-1600,
-1600,
-1600,
-1600,
-1599,
-1599,
-1599,
-1599,
-1599,
-1599,
-1599,
-1598,
-1598,
-1598,
-1598,
-1598,
-1598,
-1598,
-1597,
-1597,
-1597,
-1597,
-1597,
-1597,
-1597,
-1596,
-1596,
-1596,
-1596,
-1596,
-1596,
-1596,
-1595,
-1595,
-1595,
-1595,
-1595,
-1595,
-1594,
-1594,
-1594,
-1594,
-1594,
-1594,
-1594,
-1593,
-1593,
-1593,
-1593,
-1593,
-1593,
-1593,
-1592,
-1592,
-1592,
-1592,
-1592,
-1592,
-1592,
-1591,
-1591,
-1591,
-1591,
-1591,
-1591,
-1590,
-1590,
-1590,
-1590,
-1590,
-1590,
-1590,
-1589,
-1589,
-1589,
-1589,
-1589,
-1589,
-1589,
-1588,
-1588,
-1588,
-1588,
-1588,
-1588,
-1588,
-1587,
-1587,
-1587,
-1587,
-1587,
-1587,
-1587,
-1586,
-1586,
-1586,
-1586,
-1586,
-1586,
-1586,
-1585,
-1585,
-1585,
-1585,
-1585,
-1585,
-1584,
-1584,
-1584,
-1584,
-1584,
-1584,
-1584,
-1583,
-1583,
-1583,
-1583,
-1583,
-1583,
-1583,
-1582,
-1582,
-1582,
-1582,
-1582,
-1582,
-1582,
-1581,
-1581,
-1581,
-1581,
-1581,
-1581,
-1581,
-1580,
-1580,
-1580,
-1580,
-1580,
-1580,
-1580,
-1579,
-1579,
-1579,
-1579,
-1579,
-1579,
-1578,
-1578,
-1578,
-1578,
-1578,
-1578,
-1578,
-1577,
-1577,
-1577,
-1577,
-1577,
-1577,
-1577,
-1576,
-1576,
-1576,
-1576,
-1576,
-1576,
-1576,
-1575,
-1575,
-1575,
-1575,
-1575,
-1575,
-1575,
-1574,
-1574,
-1574,
-1574,
-1574,
-1574,
-1574,
-1573,
-1573,
-1573,
-1573,
-1573,
-1573,
-1573,
-1572,
-1572,
-1572,
-1572,
-1572,
-1572,
-1571,
-1571,
-1571,
-1571,
-1571,
-1571,
-1571,
-1570,
-1570,
-1570,
-1570,
-1570,
-1570,
-1570,
-1569,
-1569,
-1569,
-1569,
-1569,
-1569,
-1569,
-1568,
-1568,
-1568,
-1568,
-1568,
-1568,
-1568,
-1567,
-1567,
-1567,
-1567,
-1567,
-1567,
-1567,
-1566,
-1566,
-1566,
-1566,
-1566,
-1566,
-1566,
-1565,
-1565,
-1565,
-1565,
-1565,
-1565,
-1565,
-1564,
-1564,
-1564,
-1564,
-1564,
-1564,
-1564,
-1563,
-1563,
-1563,
-1563,
-1563,
-1563,
-1562,
-1562,
-1562,
-1562,
-1562,
-1562,
-1562,
-1561,
-1561,
-1561,
-1561,
-1561,
-1561,
-1561,
-1560,
-1560,
-1560,
-1560,
-1560,
-1560,
-1560,
-1559,
-1559,
-1559,
-1559,
-1559,
-1559,
-1559,
-1558,
-1558,
-1558,
-1558,
-1558,
-1558,
-1558,
-1557,
-1557,
-1557,
-1557,
-1557,
-1557,
-1557,
-1556,
-1556,
-1556,
-1556,
-1556,
-1556,
-1556,
-1555,
-1555,
-1555,
-1555,
-1555,
-1555,
-1555,
-1554,
-1554,
-1554,
-1554,
-1554,
-1554,
-1554,
-1553,
-1553,
-1553,
-1553,
-1553,
-1553,
-1553,
-1552,
-1552,
-1552,
-1552,
-1552,
-1552,
-1552,
-1551,
-1551,
-1551,
-1551,
-1551,
-1551,
-1551,
-1550,
-1550,
-1550,
-1550,
-1550,
-1550,
-1550,
-1549,
-1549,
-1549,
-1549,
-1549,
-1549,
-1549,
-1548,
-1548,
-1548,
-1548,
-1548,
-1548,
-1548,
-1547,
-1547,
-1547,
-1547,
-1547,
-1547,
-1547,
-1546,
-1546,
-1546,
-1546,
-1546,
-1546,
-1546,
-1545,
-1545,
-1545,
-1545,
-1545,
-1545,
-1545,
-1544,
-1544,
-1544,
-1544,
-1544,
-1544,
-1544,
-1543,
-1543,
-1543,
-1543,
-1543,
-1543,
-1543,
-1542,
-1542,
-1542,
-1542,
-1542,
-1542,
-1542,
-1541,
-1541,
-1541,
-1541,
-1541,
-1541,
-1541,
-1540,
-1540,
-1540,
-1540,
-1540,
-1540,
-1540,
-1539,
-1539,
-1539,
-1539,
-1539,
-1539,
-1539,
-1538,
-1538,
-1538,
-1538,
-1538,
-1538,
-1538,
-1537,
-1537,
-1537,
-1537,
-1537,
-1537,
-1537,
-1536,
-1536,
-1536,
-1536,
-1536,
-1536,
-1536,
-1535,
-1535,
-1535,
-1535,
-1535,
-1535,
-1535,
-1534,
-1534,
-1534,
-1534,
-1534,
-1534,
-1534,
-1533,
-1533,
-1533,
-1533,
-1533,
-1533,
-1533,
-1532,
-1532,
-1532,
-1532,
-1532,
-1532,
-1532,
-1531,
-1531,
-1531,
-1531,
-1531,
-1531,
-1531,
-1530,
-1530,
-1530,
-1530,
-1530,
-1530,
-1530,
-1529,
-1529,
-1529,
-1529,
-1529,
-1529,
-1529,
-1528,
-1528,
-1528,
-1528,
-1528,
-1528,
-1528,
-1527,
-1527,
-1527,
-1527,
-1527,
-1527,
-1527,
-1526,
-1526,
-1526,
-1526,
-1526,
-1526,
-1526,
-1525,
-1525,
-1525,
-1525,
-1525,
-1525,
-1525,
-1524,
-1524,
-1524,
-1524,
-1524,
-1524,
-1524,
-1523,
-1523,
-1523,
-1523,
-1523,
-1523,
-1523,
-1522,
-1522,
-1522,
-1522,
-1522,
-1522,
-1522,
-1521,
-1521,
-1521,
-1521,
-1521,
-1521,
-1521,
-1521,
-1520,
-1520,
-1520,
-1520,
-1520,
-1520,
-1520,
-1519,
-1519,
-1519,
-1519,
-1519,
-1519,
-1519,
-1518,
-1518,
-1518,
-1518,
-1518,
-1518,
-1518,
-1517,
-1517,
-1517,
-1517,
-1517,
-1517,
-1517,
-1516,
-1516,
-1516,
-1516,
-1516,
-1516,
-1516,
-1515,
-1515,
-1515,
-1515,
-1515,
-1515,
-1515,
-1514,
-1514,
-1514,
-1514,
-1514,
-1514,
-1514,
-1513,
-1513,
-1513,
-1513,
-1513,
-1513,
-1513,
-1512,
-1512,
-1512,
-1512,
-1512,
-1512,
-1512,
-1512,
-1511,
-1511,
-1511,
-1511,
-1511,
-1511,
-1511,
-1510,
-1510,
-1510,
-1510,
-1510,
-1510,
-1510,
-1509,
-1509,
-1509,
-1509,
-1509,
-1509,
-1509,
-1508,
-1508,
-1508,
-1508,
-1508,
-1508,
-1508,
-1507,
-1507,
-1507,
-1507,
-1507,
-1507,
-1507,
-1506,
-1506,
-1506,
-1506,
-1506,
-1506,
-1506,
-1505,
-1505,
-1505,
-1505,
-1505,
-1505,
-1505,
-1505,
-1504,
-1504,
-1504,
-1504,
-1504,
-1504,
-1504,
-1503,
-1503,
-1503,
-1503,
-1503,
-1503,
-1503,
-1502,
-1502,
-1502,
-1502,
-1502,
-1502,
-1502,
-1501,
-1501,
-1501,
-1501,
-1501,
-1501,
-1501,
-1500,
-1500,
-1500,
-1500,
-1500,
-1500,
-1500,
-1499,
-1499,
-1499,
-1499,
-1499,
-1499,
-1499,
-1499,
-1498,
-1498,
-1498,
-1498,
-1498,
-1498,
-1498,
-1497,
-1497,
-1497,
-1497,
-1497,
-1497,
-1497,
-1496,
-1496,
-1496,
-1496,
-1496,
-1496,
-1496,
-1495,
-1495,
-1495,
-1495,
-1495,
-1495,
-1495,
-1494,
-1494,
-1494,
-1494,
-1494,
-1494,
-1494,
-1494,
-1493,
-1493,
-1493,
-1493,
-1493,
-1493,
-1493,
-1492,
-1492,
-1492,
-1492,
-1492,
-1492,
-1492,
-1491,
-1491,
-1491,
-1491,
-1491,
-1491,
-1491,
-1490,
-1490,
-1490,
-1490,
-1490,
-1490,
-1490,
-1489,
-1489,
-1489,
-1489,
-1489,
-1489,
-1489,
-1489,
-1488,
-1488,
-1488,
-1488,
-1488,
-1488,
-1488,
-1487,
-1487,
-1487,
-1487,
-1487,
-1487,
-1487,
-1486,
-1486,
-1486,
-1486,
-1486,
-1486,
-1486,
-1485,
-1485,
-1485,
-1485,
-1485,
-1485,
-1485,
-1485,
-1484,
-1484,
-1484,
-1484,
-1484,
-1484,
-1484,
-1483,
-1483,
-1483,
-1483,
-1483,
-1483,
-1483,
-1482,
-1482,
-1482,
-1482,
-1482,
-1482,
-1482,
-1481,
-1481,
-1481,
-1481,
-1481,
-1481,
-1481,
-1481,
-1480,
-1480,
-1480,
-1480,
-1480,
-1480,
-1480,
-1479,
-1479,
-1479,
-1479,
-1479,
-1479,
-1479,
-1478,
-1478,
-1478,
-1478,
-1478,
-1478,
-1478,
-1477,
-1477,
-1477,
-1477,
-1477,
-1477,
-1477,
-1477,
-1476,
-1476,
-1476,
-1476,
-1476,
-1476,
-1476,
-1475,
-1475,
-1475,
-1475,
-1475,
-1475,
-1475,
-1474,
-1474,
-1474,
-1474,
-1474,
-1474,
-1474,
-1474,
-1473,
-1473,
-1473,
-1473,
-1473,
-1473,
-1473,
-1472,
-1472,
-1472,
-1472,
-1472,
-1472,
-1472,
-1471,
-1471,
-1471,
-1471,
-1471,
-1471,
-1471,
-1471,
-1470,
-1470,
-1470,
-1470,
-1470,
-1470,
-1470,
-1469,
-1469,
-1469,
-1469,
-1469,
-1469,
-1469,
-1468,
-1468,
-1468,
-1468,
-1468,
-1468,
-1468,
-1467,
-1467,
-1467,
-1467,
-1467,
-1467,
-1467,
-1467,
-1466,
-1466,
-1466,
-1466,
-1466,
-1466,
-1466,
-1465,
-1465,
-1465,
-1465,
-1465,
-1465,
-1465,
-1464,
-1464,
-1464,
-1464,
-1464,
-1464,
-1464,
-1464,
-1463,
-1463,
-1463,
-1463,
-1463,
-1463,
-1463,
-1462,
-1462,
-1462,
-1462,
-1462,
-1462,
-1462,
-1462,
-1461,
-1461,
-1461,
-1461,
-1461,
-1461,
-1461,
-1460,
-1460,
-1460,
-1460,
-1460,
-1460,
-1460,
-1459,
-1459,
-1459,
-1459,
-1459,
-1459,
-1459,
-1459,
-1458,
-1458,
-1458,
-1458,
-1458,
-1458,
-1458,
-1457,
-1457,
-1457,
-1457,
-1457,
-1457,
-1457,
-1456,
-1456,
-1456,
-1456,
-1456,
-1456,
-1456,
-1456,
-1455,
-1455,
-1455,
-1455,
-1455,
-1455,
-1455,
-1454,
-1454,
-1454,
-1454,
-1454,
-1454,
-1454,
-1454,
-1453,
-1453,
-1453,
-1453,
-1453,
-1453,
-1453,
-1452,
-1452,
-1452,
-1452,
-1452,
-1452,
-1452,
-1451,
-1451,
-1451,
-1451,
-1451,
-1451,
-1451,
-1451,
-1450,
-1450,
-1450,
-1450,
-1450,
-1450,
-1450,
-1449,
-1449,
-1449,
-1449,
-1449,
-1449,
-1449,
-1449,
-1448,
-1448,
-1448,
-1448,
-1448,
-1448,
-1448,
-1447,
-1447,
-1447,
-1447,
-1447,
-1447,
-1447,
-1446,
-1446,
-1446,
-1446,
-1446,
-1446,
-1446,
-1446,
-1445,
-1445,
-1445,
-1445,
-1445,
-1445,
-1445,
-1444,
-1444,
-1444,
-1444,
-1444,
-1444,
-1444,
-1444,
-1443,
-1443,
-1443,
-1443,
-1443,
-1443,
-1443,
-1442,
-1442,
-1442,
-1442,
-1442,
-1442,
-1442,
-1442,
-1441,
-1441,
-1441,
-1441,
-1441,
-1441,
-1441,
-1440,
-1440,
-1440,
-1440,
-1440,
-1440,
-1440,
-1439,
-1439,
-1439,
-1439,
-1439,
-1439,
-1439,
-1439,
-1438,
-1438,
-1438,
-1438,
-1438,
-1438,
-1438,
-1437,
-1437,
-1437,
-1437,
-1437,
-1437,
-1437,
-1437,
-1436,
-1436,
-1436,
-1436,
-1436,
-1436,
-1436,
-1435,
-1435,
-1435,
-1435,
-1435,
-1435,
-1435,
-1435,
-1434,
-1434,
-1434,
-1434,
-1434,
-1434,
-1434,
-1433,
-1433,
-1433,
-1433,
-1433,
-1433,
-1433,
-1433,
-1432,
-1432,
-1432,
-1432,
-1432,
-1432,
-1432,
-1431,
-1431,
-1431,
-1431,
-1431,
-1431,
-1431,
-1431,
-1430,
-1430,
-1430,
-1430,
-1430,
-1430,
-1430,
-1429,
-1429,
-1429,
-1429,
-1429,
-1429,
-1429,
-1429,
-1428,
-1428,
-1428,
-1428,
-1428,
-1428,
-1428,
-1427,
-1427,
-1427,
-1427,
-1427,
-1427,
-1427,
-1427,
-1426,
-1426,
-1426,
-1426,
-1426,
-1426,
-1426,
-1425,
-1425,
-1425,
-1425,
-1425,
-1425,
-1425,
-1425,
-1424,
-1424,
-1424,
-1424,
-1424,
-1424,
-1424,
-1423,
-1423,
-1423,
-1423,
-1423,
-1423,
-1423,
-1423,
-1422,
-1422,
-1422,
-1422,
-1422,
-1422,
-1422,
-1422,
-1421,
-1421,
-1421,
-1421,
-1421,
-1421,
-1421,
-1420,
-1420,
-1420,
-1420,
-1420,
-1420,
-1420,
-1420,
-1419,
-1419,
-1419,
-1419,
-1419,
-1419,
-1419,
-1418,
-1418,
-1418,
-1418,
-1418,
-1418,
-1418,
-1418,
-1417,
-1417,
-1417,
-1417,
-1417,
-1417,
-1417,
-1416,
-1416,
-1416,
-1416,
-1416,
-1416,
-1416,
-1416,
-1415,
-1415,
-1415,
-1415,
-1415,
-1415,
-1415,
-1414,
-1414,
-1414,
-1414,
-1414,
-1414,
-1414,
-1414,
-1413,
-1413,
-1413,
-1413,
-1413,
-1413,
-1413,
-1413,
-1412,
-1412,
-1412,
-1412,
-1412,
-1412,
-1412,
-1411,
-1411,
-1411,
-1411,
-1411,
-1411,
-1411,
-1411,
-1410,
-1410,
-1410,
-1410,
-1410,
-1410,
-1410,
-1409,
-1409,
-1409,
-1409,
-1409,
-1409,
-1409,
-1409,
-1408,
-1408,
-1408,
-1408,
-1408,
-1408,
-1408,
-1408,
-1407,
-1407,
-1407,
-1407,
-1407,
-1407,
-1407,
-1406,
-1406,
-1406,
-1406,
-1406,
-1406,
-1406,
-1406,
-1405,
-1405,
-1405,
-1405,
-1405,
-1405,
-1405,
-1405,
-1404,
-1404,
-1404,
-1404,
-1404,
-1404,
-1404,
-1403,
-1403,
-1403,
-1403,
-1403,
-1403,
-1403,
-1403,
-1402,
-1402,
-1402,
-1402,
-1402,
-1402,
-1402,
-1401,
-1401,
-1401,
-1401,
-1401,
-1401,
-1401,
-1401,
-1400,
-1400,
-1400,
-1400,
-1400,
-1400,
-1400,
-1400,
-1399,
-1399,
-1399,
-1399,
-1399,
-1399,
-1399,
-1398,
-1398,
-1398,
-1398,
-1398,
-1398,
-1398,
-1398,
-1397,
-1397,
-1397,
-1397,
-1397,
-1397,
-1397,
-1397,
-1396,
-1396,
-1396,
-1396,
-1396,
-1396,
-1396,
-1395,
-1395,
-1395,
-1395,
-1395,
-1395,
-1395,
-1395,
-1394,
-1394,
-1394,
-1394,
-1394,
-1394,
-1394,
-1394,
-1393,
-1393,
-1393,
-1393,
-1393,
-1393,
-1393,
-1393,
-1392,
-1392,
-1392,
-1392,
-1392,
-1392,
-1392,
-1391,
-1391,
-1391,
-1391,
-1391,
-1391,
-1391,
-1391,
-1390,
-1390,
-1390,
-1390,
-1390,
-1390,
-1390,
-1390,
-1389,
-1389,
-1389,
-1389,
-1389,
-1389,
-1389,
-1388,
-1388,
-1388,
-1388,
-1388,
-1388,
-1388,
-1388,
-1387,
-1387,
-1387,
-1387,
-1387,
-1387,
-1387,
-1387,
-1386,
-1386,
-1386,
-1386,
-1386,
-1386,
-1386,
-1385,
-1385,
-1385,
-1385,
-1385,
-1385,
-1385,
-1385,
-1384,
-1384,
-1384,
-1384,
-1384,
-1384,
-1384,
-1384,
-1383,
-1383,
-1383,
-1383,
-1383,
-1383,
-1383,
-1383,
-1382,
-1382,
-1382,
-1382,
-1382,
-1382,
-1382,
-1381,
-1381,
-1381,
-1381,
-1381,
-1381,
-1381,
-1381,
-1380,
-1380,
-1380,
-1380,
-1380,
-1380,
-1380,
-1380,
-1379,
-1379,
-1379,
-1379,
-1379,
-1379,
-1379,
-1379,
-1378,
-1378,
-1378,
-1378,
-1378,
-1378,
-1378,
-1377,
-1377,
-1377,
-1377,
-1377,
-1377,
-1377,
-1377,
-1376,
-1376,
-1376,
-1376,
-1376,
-1376,
-1376,
-1376,
-1375,
-1375,
-1375,
-1375,
-1375,
-1375,
-1375,
-1375,
-1374,
-1374,
-1374,
-1374,
-1374,
-1374,
-1374,
-1374,
-1373,
-1373,
-1373,
-1373,
-1373,
-1373,
-1373,
-1372,
-1372,
-1372,
-1372,
-1372,
-1372,
-1372,
-1372,
-1371,
-1371,
-1371,
-1371,
-1371,
-1371,
-1371,
-1371,
-1370,
-1370,
-1370,
-1370,
-1370,
-1370,
-1370,
-1370,
-1369,
-1369,
-1369,
-1369,
-1369,
-1369,
-1369,
-1369,
-1368,
-1368,
-1368,
-1368,
-1368,
-1368,
-1368,
-1367,
-1367,
-1367,
-1367,
-1367,
-1367,
-1367,
-1367,
-1366,
-1366,
-1366,
-1366,
-1366,
-1366,
-1366,
-1366,
-1365,
-1365,
-1365,
-1365,
-1365,
-1365,
-1365,
-1365,
-1364,
-1364,
-1364,
-1364,
-1364,
-1364,
-1364,
-1364,
-1363,
-1363,
-1363,
-1363,
-1363,
-1363,
-1363,
-1363,
-1362,
-1362,
-1362,
-1362,
-1362,
-1362,
-1362,
-1362,
-1361,
-1361,
-1361,
-1361,
-1361,
-1361,
-1361,
-1360,
-1360,
-1360,
-1360,
-1360,
-1360,
-1360,
-1360,
-1359,
-1359,
-1359,
-1359,
-1359,
-1359,
-1359,
-1359,
-1358,
-1358,
-1358,
-1358,
-1358,
-1358,
-1358,
-1358,
-1357,
-1357,
-1357,
-1357,
-1357,
-1357,
-1357,
-1357,
-1356,
-1356,
-1356,
-1356,
-1356,
-1356,
-1356,
-1356,
-1355,
-1355,
-1355,
-1355,
-1355,
-1355,
-1355,
-1355,
-1354,
-1354,
-1354,
-1354,
-1354,
-1354,
-1354,
-1354,
-1353,
-1353,
-1353,
-1353,
-1353,
-1353,
-1353,
-1352,
-1352,
-1352,
-1352,
-1352,
-1352,
-1352,
-1352,
-1351,
-1351,
-1351,
-1351,
-1351,
-1351,
-1351,
-1351,
-1350,
-1350,
-1350,
-1350,
-1350,
-1350,
-1350,
-1350,
-1349,
-1349,
-1349,
-1349,
-1349,
-1349,
-1349,
-1349,
-1348,
-1348,
-1348,
-1348,
-1348,
-1348,
-1348,
-1348,
-1347,
-1347,
-1347,
-1347,
-1347,
-1347,
-1347,
-1347,
-1346,
-1346,
-1346,
-1346,
-1346,
-1346,
-1346,
-1346,
-1345,
-1345,
-1345,
-1345,
-1345,
-1345,
-1345,
-1345,
-1344,
-1344,
-1344,
-1344,
-1344,
-1344,
-1344,
-1344,
-1343,
-1343,
-1343,
-1343,
-1343,
-1343,
-1343,
-1343,
-1342,
-1342,
-1342,
-1342,
-1342,
-1342,
-1342,
-1342,
-1341,
-1341,
-1341,
-1341,
-1341,
-1341,
-1341,
-1341,
-1340,
-1340,
-1340,
-1340,
-1340,
-1340,
-1340,
-1340,
-1339,
-1339,
-1339,
-1339,
-1339,
-1339,
-1339,
-1339,
-1338,
-1338,
-1338,
-1338,
-1338,
-1338,
-1338,
-1338,
-1337,
-1337,
-1337,
-1337,
-1337,
-1337,
-1337,
-1337,
-1336,
-1336,
-1336,
-1336,
-1336,
-1336,
-1336,
-1336,
-1335,
-1335,
-1335,
-1335,
-1335,
-1335,
-1335,
-1335,
-1334,
-1334,
-1334,
-1334,
-1334,
-1334,
-1334,
-1334,
-1333,
-1333,
-1333,
-1333,
-1333,
-1333,
-1333,
-1333,
-1332,
-1332,
-1332,
-1332,
-1332,
-1332,
-1332,
-1332,
-1331,
-1331,
-1331,
-1331,
-1331,
-1331,
-1331,
-1331,
-1330,
-1330,
-1330,
-1330,
-1330,
-1330,
-1330,
-1330,
-1329,
-1329,
-1329,
-1329,
-1329,
-1329,
-1329,
-1329,
-1328,
-1328,
-1328,
-1328,
-1328,
-1328,
-1328,
-1328,
-1327,
-1327,
-1327,
-1327,
-1327,
-1327,
-1327,
-1327,
-1326,
-1326,
-1326,
-1326,
-1326,
-1326,
-1326,
-1326,
-1325,
-1325,
-1325,
-1325,
-1325,
-1325,
-1325,
-1325,
-1324,
-1324,
-1324,
-1324,
-1324,
-1324,
-1324,
-1324,
-1323,
-1323,
-1323,
-1323,
-1323,
-1323,
-1323,
-1323,
-1322,
-1322,
-1322,
-1322,
-1322,
-1322,
-1322,
-1322,
-1321,
-1321,
-1321,
-1321,
-1321,
-1321,
-1321,
-1321,
-1320,
-1320,
-1320,
-1320,
-1320,
-1320,
-1320,
-1320,
-1319,
-1319,
-1319,
-1319,
-1319,
-1319,
-1319,
-1319,
-1318,
-1318,
-1318,
-1318,
-1318,
-1318,
-1318,
-1318,
-1318,
-1317,
-1317,
-1317,
-1317,
-1317,
-1317,
-1317,
-1317,
-1316,
-1316,
-1316,
-1316,
-1316,
-1316,
-1316,
-1316,
-1315,
-1315,
-1315,
-1315,
-1315,
-1315,
-1315,
-1315,
-1314,
-1314,
-1314,
-1314,
-1314,
-1314,
-1314,
-1314,
-1313,
-1313,
-1313,
-1313,
-1313,
-1313,
-1313,
-1313,
-1312,
-1312,
-1312,
-1312,
-1312,
-1312,
-1312,
-1312,
-1311,
-1311,
-1311,
-1311,
-1311,
-1311,
-1311,
-1311,
-1310,
-1310,
-1310,
-1310,
-1310,
-1310,
-1310,
-1310,
-1310,
-1309,
-1309,
-1309,
-1309,
-1309,
-1309,
-1309,
-1309,
-1308,
-1308,
-1308,
-1308,
-1308,
-1308,
-1308,
-1308,
-1307,
-1307,
-1307,
-1307,
-1307,
-1307,
-1307,
-1307,
-1306,
-1306,
-1306,
-1306,
-1306,
-1306,
-1306,
-1306,
-1305,
-1305,
-1305,
-1305,
-1305,
-1305,
-1305,
-1305,
-1304,
-1304,
-1304,
-1304,
-1304,
-1304,
-1304,
-1304,
-1304,
-1303,
-1303,
-1303,
-1303,
-1303,
-1303,
-1303,
-1303,
-1302,
-1302,
-1302,
-1302,
-1302,
-1302,
-1302,
-1302,
-1301,
-1301,
-1301,
-1301,
-1301,
-1301,
-1301,
-1301,
-1300,
-1300,
-1300,
-1300,
-1300,
-1300,
-1300,
-1300,
-1299,
-1299,
-1299,
-1299,
-1299,
-1299,
-1299,
-1299,
-1298,
-1298,
-1298,
-1298,
-1298,
-1298,
-1298,
-1298,
-1298,
-1297,
-1297,
-1297,
-1297,
-1297,
-1297,
-1297,
-1297,
-1296,
-1296,
-1296,
-1296,
-1296,
-1296,
-1296,
-1296,
-1295,
-1295,
-1295,
-1295,
-1295,
-1295,
-1295,
-1295,
-1294,
-1294,
-1294,
-1294,
-1294,
-1294,
-1294,
-1294,
-1294,
-1293,
-1293,
-1293,
-1293,
-1293,
-1293,
-1293,
-1293,
-1292,
-1292,
-1292,
-1292,
-1292,
-1292,
-1292,
-1292,
-1291,
-1291,
-1291,
-1291,
-1291,
-1291,
-1291,
-1291,
-1290,
-1290,
-1290,
-1290,
-1290,
-1290,
-1290,
-1290,
-1290,
-1289,
-1289,
-1289,
-1289,
-1289,
-1289,
-1289,
-1289,
-1288,
-1288,
-1288,
-1288,
-1288,
-1288,
-1288,
-1288,
-1287,
-1287,
-1287,
-1287,
-1287,
-1287,
-1287,
-1287,
-1286,
-1286,
-1286,
-1286,
-1286,
-1286,
-1286,
-1286,
-1286,
-1285,
-1285,
-1285,
-1285,
-1285,
-1285,
-1285,
-1285,
-1284,
-1284,
-1284,
-1284,
-1284,
-1284,
-1284,
-1284,
-1283,
-1283,
-1283,
-1283,
-1283,
-1283,
-1283,
-1283,
-1283,
-1282,
-1282,
-1282,
-1282,
-1282,
-1282,
-1282,
-1282,
-1281,
-1281,
-1281,
-1281,
-1281,
-1281,
-1281,
-1281,
-1280,
-1280,
-1280,
-1280,
-1280,
-1280,
-1280,
-1280,
-1280,
-1279,
-1279,
-1279,
-1279,
-1279,
-1279,
-1279,
-1279,
-1278,
-1278,
-1278,
-1278,
-1278,
-1278,
-1278,
-1278,
-1277,
-1277,
-1277,
-1277,
-1277,
-1277,
-1277,
-1277,
-1277,
-1276,
-1276,
-1276,
-1276,
-1276,
-1276,
-1276,
-1276,
-1275,
-1275,
-1275,
-1275,
-1275,
-1275,
-1275,
-1275,
-1274,
-1274,
-1274,
-1274,
-1274,
-1274,
-1274,
-1274,
-1274,
-1273,
-1273,
-1273,
-1273,
-1273,
-1273,
-1273,
-1273,
-1272,
-1272,
-1272,
-1272,
-1272,
-1272,
-1272,
-1272,
-1271,
-1271,
-1271,
-1271,
-1271,
-1271,
-1271,
-1271,
-1271,
-1270,
-1270,
-1270,
-1270,
-1270,
-1270,
-1270,
-1270,
-1269,
-1269,
-1269,
-1269,
-1269,
-1269,
-1269,
-1269,
-1269,
-1268,
-1268,
-1268,
-1268,
-1268,
-1268,
-1268,
-1268,
-1267,
-1267,
-1267,
-1267,
-1267,
-1267,
-1267,
-1267,
-1266,
-1266,
-1266,
-1266,
-1266,
-1266,
-1266,
-1266,
-1266,
-1265,
-1265,
-1265,
-1265,
-1265,
-1265,
-1265,
-1265,
-1264,
-1264,
-1264,
-1264,
-1264,
-1264,
-1264,
-1264,
-1264,
-1263,
-1263,
-1263,
-1263,
-1263,
-1263,
-1263,
-1263,
-1262,
-1262,
-1262,
-1262,
-1262,
-1262,
-1262,
-1262,
-1261,
-1261,
-1261,
-1261,
-1261,
-1261,
-1261,
-1261,
-1261,
-1260,
-1260,
-1260,
-1260,
-1260,
-1260,
-1260,
-1260,
-1259,
-1259,
-1259,
-1259,
-1259,
-1259,
-1259,
-1259,
-1259,
-1258,
-1258,
-1258,
-1258,
-1258,
-1258,
-1258,
-1258,
-1257,
-1257,
-1257,
-1257,
-1257,
-1257,
-1257,
-1257,
-1257,
-1256,
-1256,
-1256,
-1256,
-1256,
-1256,
-1256,
-1256,
-1255,
-1255,
-1255,
-1255,
-1255,
-1255,
-1255,
-1255,
-1255,
-1254,
-1254,
-1254,
-1254,
-1254,
-1254,
-1254,
-1254,
-1253,
-1253,
-1253,
-1253,
-1253,
-1253,
-1253,
-1253,
-1253,
-1252,
-1252,
-1252,
-1252,
-1252,
-1252,
-1252,
-1252,
-1251,
-1251,
-1251,
-1251,
-1251,
-1251,
-1251,
-1251,
-1251,
-1250,
-1250,
-1250,
-1250,
-1250,
-1250,
-1250,
-1250,
-1249,
-1249,
-1249,
-1249,
-1249,
-1249,
-1249,
-1249,
-1249,
-1248,
-1248,
-1248,
-1248,
-1248,
-1248,
-1248,
-1248,
-1247,
-1247,
-1247,
-1247,
-1247,
-1247,
-1247,
-1247,
-1247,
-1246,
-1246,
-1246,
-1246,
-1246,
-1246,
-1246,
-1246,
-1245,
-1245,
-1245,
-1245,
-1245,
-1245,
-1245,
-1245,
-1245,
-1244,
-1244,
-1244,
-1244,
-1244,
-1244,
-1244,
-1244,
-1243,
-1243,
-1243,
-1243,
-1243,
-1243,
-1243,
-1243,
-1243,
-1242,
-1242,
-1242,
-1242,
-1242,
-1242,
-1242,
-1242,
-1242,
-1241,
-1241,
-1241,
-1241,
-1241,
-1241,
-1241,
-1241,
-1240,
-1240,
-1240,
-1240,
-1240,
-1240,
-1240,
-1240,
-1240,
-1239,
-1239,
-1239,
-1239,
-1239,
-1239,
-1239,
-1239,
-1238,
-1238,
-1238,
-1238,
-1238,
-1238,
-1238,
-1238,
-1238,
-1237,
-1237,
-1237,
-1237,
-1237,
-1237,
-1237,
-1237,
-1236,
-1236,
-1236,
-1236,
-1236,
-1236,
-1236,
-1236,
-1236,
-1235,
-1235,
-1235,
-1235,
-1235,
-1235,
-1235,
-1235,
-1235,
-1234,
-1234,
-1234,
-1234,
-1234,
-1234,
-1234,
-1234,
-1233,
-1233,
-1233,
-1233,
-1233,
-1233,
-1233,
-1233,
-1233,
-1232,
-1232,
-1232,
-1232,
-1232,
-1232,
-1232,
-1232,
-1232,
-1231,
-1231,
-1231,
-1231,
-1231,
-1231,
-1231,
-1231,
-1230,
-1230,
-1230,
-1230,
-1230,
-1230,
-1230,
-1230,
-1230,
-1229,
-1229,
-1229,
-1229,
-1229,
-1229,
-1229,
-1229,
-1228,
-1228,
-1228,
-1228,
-1228,
-1228,
-1228,
-1228,
-1228,
-1227,
-1227,
-1227,
-1227,
-1227,
-1227,
-1227,
-1227,
-1227,
-1226,
-1226,
-1226,
-1226,
-1226,
-1226,
-1226,
-1226,
-1225,
-1225,
-1225,
-1225,
-1225,
-1225,
-1225,
-1225,
-1225,
-1224,
-1224,
-1224,
-1224,
-1224,
-1224,
-1224,
-1224,
-1224,
-1223,
-1223,
-1223,
-1223,
-1223,
-1223,
-1223,
-1223,
-1222,
-1222,
-1222,
-1222,
-1222,
-1222,
-1222,
-1222,
-1222,
-1221,
-1221,
-1221,
-1221,
-1221,
-1221,
-1221,
-1221,
-1221,
-1220,
-1220,
-1220,
-1220,
-1220,
-1220,
-1220,
-1220,
-1220,
-1219,
-1219,
-1219,
-1219,
-1219,
-1219,
-1219,
-1219,
-1218,
-1218,
-1218,
-1218,
-1218,
-1218,
-1218,
-1218,
-1218,
-1217,
-1217,
-1217,
-1217,
-1217,
-1217,
-1217,
-1217,
-1217,
-1216,
-1216,
-1216,
-1216,
-1216,
-1216,
-1216,
-1216,
-1215,
-1215,
-1215,
-1215,
-1215,
-1215,
-1215,
-1215,
-1215,
-1214,
-1214,
-1214,
-1214,
-1214,
-1214,
-1214,
-1214,
-1214,
-1213,
-1213,
-1213,
-1213,
-1213,
-1213,
-1213,
-1213,
-1213,
-1212,
-1212,
-1212,
-1212,
-1212,
-1212,
-1212,
-1212,
-1211,
-1211,
-1211,
-1211,
-1211,
-1211,
-1211,
-1211,
-1211,
-1210,
-1210,
-1210,
-1210,
-1210,
-1210,
-1210,
-1210,
-1210,
-1209,
-1209,
-1209,
-1209,
-1209,
-1209,
-1209,
-1209,
-1209,
-1208,
-1208,
-1208,
-1208,
-1208,
-1208,
-1208,
-1208,
-1208,
-1207,
-1207,
-1207,
-1207,
-1207,
-1207,
-1207,
-1207,
-1206,
-1206,
-1206,
-1206,
-1206,
-1206,
-1206,
-1206,
-1206,
-1205,
-1205,
-1205,
-1205,
-1205,
-1205,
-1205,
-1205,
-1205,
-1204,
-1204,
-1204,
-1204,
-1204,
-1204,
-1204,
-1204,
-1204,
-1203,
-1203,
-1203,
-1203,
-1203,
-1203,
-1203,
-1203,
-1203,
-1202,
-1202,
-1202,
-1202,
-1202,
-1202,
-1202,
-1202,
-1201,
-1201,
-1201,
-1201,
-1201,
-1201,
-1201,
-1201,
-1201,
-1200,
-1200,
-1200,
-1200,
-1200,
-1200,
-1200,
-1200,
-1200,
-1199,
-1199,
-1199,
-1199,
-1199,
-1199,
-1199,
-1199,
-1199,
-1198,
-1198,
-1198,
-1198,
-1198,
-1198,
-1198,
-1198,
-1198,
-1197,
-1197,
-1197,
-1197,
-1197,
-1197,
-1197,
-1197,
-1197,
-1196,
-1196,
-1196,
-1196,
-1196,
-1196,
-1196,
-1196,
-1196,
-1195,
-1195,
-1195,
-1195,
-1195,
-1195,
-1195,
-1195,
-1194,
-1194,
-1194,
-1194,
-1194,
-1194,
-1194,
-1194,
-1194,
-1193,
-1193,
-1193,
-1193,
-1193,
-1193,
-1193,
-1193,
-1193,
-1192,
-1192,
-1192,
-1192,
-1192,
-1192,
-1192,
-1192,
-1192,
-1191,
-1191,
-1191,
-1191,
-1191,
-1191,
-1191,
-1191,
-1191,
-1190,
-1190,
-1190,
-1190,
-1190,
-1190,
-1190,
-1190,
-1190,
-1189,
-1189,
-1189,
-1189,
-1189,
-1189,
-1189,
-1189,
-1189,
-1188,
-1188,
-1188,
-1188,
-1188,
-1188,
-1188,
-1188,
-1188,
-1187,
-1187,
-1187,
-1187,
-1187,
-1187,
-1187,
-1187,
-1187,
-1186,
-1186,
-1186,
-1186,
-1186,
-1186,
-1186,
-1186,
-1186,
-1185,
-1185,
-1185,
-1185,
-1185,
-1185,
-1185,
-1185,
-1185,
-1184,
-1184,
-1184,
-1184,
-1184,
-1184,
-1184,
-1184,
-1184,
-1183,
-1183,
-1183,
-1183,
-1183,
-1183,
-1183,
-1183,
-1183,
-1182,
-1182,
-1182,
-1182,
-1182,
-1182,
-1182,
-1182,
-1182,
-1181,
-1181,
-1181,
-1181,
-1181,
-1181,
-1181,
-1181,
-1180,
-1180,
-1180,
-1180,
-1180,
-1180,
-1180,
-1180,
-1180,
-1179,
-1179,
-1179,
-1179,
-1179,
-1179,
-1179,
-1179,
-1179,
-1178,
-1178,
-1178,
-1178,
-1178,
-1178,
-1178,
-1178,
-1178,
-1177,
-1177,
-1177,
-1177,
-1177,
-1177,
-1177,
-1177,
-1177,
-1176,
-1176,
-1176,
-1176,
-1176,
-1176,
-1176,
-1176,
-1176,
-1175,
-1175,
-1175,
-1175,
-1175,
-1175,
-1175,
-1175,
-1175,
-1174,
-1174,
-1174,
-1174,
-1174,
-1174,
-1174,
-1174,
-1174,
-1174,
-1173,
-1173,
-1173,
-1173,
-1173,
-1173,
-1173,
-1173,
-1173,
-1172,
-1172,
-1172,
-1172,
-1172,
-1172,
-1172,
-1172,
-1172,
-1171,
-1171,
-1171,
-1171,
-1171,
-1171,
-1171,
-1171,
-1171,
-1170,
-1170,
-1170,
-1170,
-1170,
-1170,
-1170,
-1170,
-1170,
-1169,
-1169,
-1169,
-1169,
-1169,
-1169,
-1169,
-1169,
-1169,
-1168,
-1168,
-1168,
-1168,
-1168,
-1168,
-1168,
-1168,
-1168,
-1167,
-1167,
-1167,
-1167,
-1167,
-1167,
-1167,
-1167,
-1167,
-1166,
-1166,
-1166,
-1166,
-1166,
-1166,
-1166,
-1166,
-1166,
-1165,
-1165,
-1165,
-1165,
-1165,
-1165,
-1165,
-1165,
-1165,
-1164,
-1164,
-1164,
-1164,
-1164,
-1164,
-1164,
-1164,
-1164,
-1163,
-1163,
-1163,
-1163,
-1163,
-1163,
-1163,
-1163,
-1163,
-1162,
-1162,
-1162,
-1162,
-1162,
-1162,
-1162,
-1162,
-1162,
-1161,
-1161,
-1161,
-1161,
-1161,
-1161,
-1161,
-1161,
-1161,
-1161,
-1160,
-1160,
-1160,
-1160,
-1160,
-1160,
-1160,
-1160,
-1160,
-1159,
-1159,
-1159,
-1159,
-1159,
-1159,
-1159,
-1159,
-1159,
-1158,
-1158,
-1158,
-1158,
-1158,
-1158,
-1158,
-1158,
-1158,
-1157,
-1157,
-1157,
-1157,
-1157,
-1157,
-1157,
-1157,
-1157,
-1156,
-1156,
-1156,
-1156,
-1156,
-1156,
-1156,
-1156,
-1156,
-1155,
-1155,
-1155,
-1155,
-1155,
-1155,
-1155,
-1155,
-1155,
-1154,
-1154,
-1154,
-1154,
-1154,
-1154,
-1154,
-1154,
-1154,
-1154,
-1153,
-1153,
-1153,
-1153,
-1153,
-1153,
-1153,
-1153,
-1153,
-1152,
-1152,
-1152,
-1152,
-1152,
-1152,
-1152,
-1152,
-1152,
-1151,
-1151,
-1151,
-1151,
-1151,
-1151,
-1151,
-1151,
-1151,
-1150,
-1150,
-1150,
-1150,
-1150,
-1150,
-1150,
-1150,
-1150,
-1149,
-1149,
-1149,
-1149,
-1149,
-1149,
-1149,
-1149,
-1149,
-1149,
-1148,
-1148,
-1148,
-1148,
-1148,
-1148,
-1148,
-1148,
-1148,
-1147,
-1147,
-1147,
-1147,
-1147,
-1147,
-1147,
-1147,
-1147,
-1146,
-1146,
-1146,
-1146,
-1146,
-1146,
-1146,
-1146,
-1146,
-1145,
-1145,
-1145,
-1145,
-1145,
-1145,
-1145,
-1145,
-1145,
-1145,
-1144,
-1144,
-1144,
-1144,
-1144,
-1144,
-1144,
-1144,
-1144,
-1143,
-1143,
-1143,
-1143,
-1143,
-1143,
-1143,
-1143,
-1143,
-1142,
-1142,
-1142,
-1142,
-1142,
-1142,
-1142,
-1142,
-1142,
-1141,
-1141,
-1141,
-1141,
-1141,
-1141,
-1141,
-1141,
-1141,
-1141,
-1140,
-1140,
-1140,
-1140,
-1140,
-1140,
-1140,
-1140,
-1140,
-1139,
-1139,
-1139,
-1139,
-1139,
-1139,
-1139,
-1139,
-1139,
-1138,
-1138,
-1138,
-1138,
-1138,
-1138,
-1138,
-1138,
-1138,
-1137,
-1137,
-1137,
-1137,
-1137,
-1137,
-1137,
-1137,
-1137,
-1137,
-1136,
-1136,
-1136,
-1136,
-1136,
-1136,
-1136,
-1136,
-1136,
-1135,
-1135,
-1135,
-1135,
-1135,
-1135,
-1135,
-1135,
-1135,
-1134,
-1134,
-1134,
-1134,
-1134,
-1134,
-1134,
-1134,
-1134,
-1134,
-1133,
-1133,
-1133,
-1133,
-1133,
-1133,
-1133,
-1133,
-1133,
-1132,
-1132,
-1132,
-1132,
-1132,
-1132,
-1132,
-1132,
-1132,
-1131,
-1131,
-1131,
-1131,
-1131,
-1131,
-1131,
-1131,
-1131,
-1131,
-1130,
-1130,
-1130,
-1130,
-1130,
-1130,
-1130,
-1130,
-1130,
-1129,
-1129,
-1129,
-1129,
-1129,
-1129,
-1129,
-1129,
-1129,
-1128,
-1128,
-1128,
-1128,
-1128,
-1128,
-1128,
-1128,
-1128,
-1128,
-1127,
-1127,
-1127,
-1127,
-1127,
-1127,
-1127,
-1127,
-1127,
-1126,
-1126,
-1126,
-1126,
-1126,
-1126,
-1126,
-1126,
-1126,
-1126,
-1125,
-1125,
-1125,
-1125,
-1125,
-1125,
-1125,
-1125,
-1125,
-1124,
-1124,
-1124,
-1124,
-1124,
-1124,
-1124,
-1124,
-1124,
-1123,
-1123,
-1123,
-1123,
-1123,
-1123,
-1123,
-1123,
-1123,
-1123,
-1122,
-1122,
-1122,
-1122,
-1122,
-1122,
-1122,
-1122,
-1122,
-1121,
-1121,
-1121,
-1121,
-1121,
-1121,
-1121,
-1121,
-1121,
-1121,
-1120,
-1120,
-1120,
-1120,
-1120,
-1120,
-1120,
-1120,
-1120,
-1119,
-1119,
-1119,
-1119,
-1119,
-1119,
-1119,
-1119,
-1119,
-1119,
-1118,
-1118,
-1118,
-1118,
-1118,
-1118,
-1118,
-1118,
-1118,
-1117,
-1117,
-1117,
-1117,
-1117,
-1117,
-1117,
-1117,
-1117,
-1117,
-1116,
-1116,
-1116,
-1116,
-1116,
-1116,
-1116,
-1116,
-1116,
-1115,
-1115,
-1115,
-1115,
-1115,
-1115,
-1115,
-1115,
-1115,
-1114,
-1114,
-1114,
-1114,
-1114,
-1114,
-1114,
-1114,
-1114,
-1114,
-1113,
-1113,
-1113,
-1113,
-1113,
-1113,
-1113,
-1113,
-1113,
-1112,
-1112,
-1112,
-1112,
-1112,
-1112,
-1112,
-1112,
-1112,
-1112,
-1111,
-1111,
-1111,
-1111,
-1111,
-1111,
-1111,
-1111,
-1111,
-1110,
-1110,
-1110,
-1110,
-1110,
-1110,
-1110,
-1110,
-1110,
-1110,
-1109,
-1109,
-1109,
-1109,
-1109,
-1109,
-1109,
-1109,
-1109,
-1109,
-1108,
-1108,
-1108,
-1108,
-1108,
-1108,
-1108,
-1108,
-1108,
-1107,
-1107,
-1107,
-1107,
-1107,
-1107,
-1107,
-1107,
-1107,
-1107,
-1106,
-1106,
-1106,
-1106,
-1106,
-1106,
-1106,
-1106,
-1106,
-1105,
-1105,
-1105,
-1105,
-1105,
-1105,
-1105,
-1105,
-1105,
-1105,
-1104,
-1104,
-1104,
-1104,
-1104,
-1104,
-1104,
-1104,
-1104,
-1103,
-1103,
-1103,
-1103,
-1103,
-1103,
-1103,
-1103,
-1103,
-1103,
-1102,
-1102,
-1102,
-1102,
-1102,
-1102,
-1102,
-1102,
-1102,
-1101,
-1101,
-1101,
-1101,
-1101,
-1101,
-1101,
-1101,
-1101,
-1101,
-1100,
-1100,
-1100,
-1100,
-1100,
-1100,
-1100,
-1100,
-1100,
-1100,
-1099,
-1099,
-1099,
-1099,
-1099,
-1099,
-1099,
-1099,
-1099,
-1098,
-1098,
-1098,
-1098,
-1098,
-1098,
-1098,
-1098,
-1098,
-1098,
-1097,
-1097,
-1097,
-1097,
-1097,
-1097,
-1097,
-1097,
-1097,
-1096,
-1096,
-1096,
-1096,
-1096,
-1096,
-1096,
-1096,
-1096,
-1096,
-1095,
-1095,
-1095,
-1095,
-1095,
-1095,
-1095,
-1095,
-1095,
-1095,
-1094,
-1094,
-1094,
-1094,
-1094,
-1094,
-1094,
-1094,
-1094,
-1093,
-1093,
-1093,
-1093,
-1093,
-1093,
-1093,
-1093,
-1093,
-1093,
-1092,
-1092,
-1092,
-1092,
-1092,
-1092,
-1092,
-1092,
-1092,
-1092,
-1091,
-1091,
-1091,
-1091,
-1091,
-1091,
-1091,
-1091,
-1091,
-1090,
-1090,
-1090,
-1090,
-1090,
-1090,
-1090,
-1090,
-1090,
-1090,
-1089,
-1089,
-1089,
-1089,
-1089,
-1089,
-1089,
-1089,
-1089,
-1089,
-1088,
-1088,
-1088,
-1088,
-1088,
-1088,
-1088,
-1088,
-1088,
-1087,
-1087,
-1087,
-1087,
-1087,
-1087,
-1087,
-1087,
-1087,
-1087,
-1086,
-1086,
-1086,
-1086,
-1086,
-1086,
-1086,
-1086,
-1086,
-1086,
-1085,
-1085,
-1085,
-1085,
-1085,
-1085,
-1085,
-1085,
-1085,
-1085,
-1084,
-1084,
-1084,
-1084,
-1084,
-1084,
-1084,
-1084,
-1084,
-1083,
-1083,
-1083,
-1083,
-1083,
-1083,
-1083,
-1083,
-1083,
-1083,
-1082,
-1082,
-1082,
-1082,
-1082,
-1082,
-1082,
-1082,
-1082,
-1082,
-1081,
-1081,
-1081,
-1081,
-1081,
-1081,
-1081,
-1081,
-1081,
-1081,
-1080,
-1080,
-1080,
-1080,
-1080,
-1080,
-1080,
-1080,
-1080,
-1079,
-1079,
-1079,
-1079,
-1079,
-1079,
-1079,
-1079,
-1079,
-1079,
-1078,
-1078,
-1078,
-1078,
-1078,
-1078,
-1078,
-1078,
-1078,
-1078,
-1077,
-1077,
-1077,
-1077,
-1077,
-1077,
-1077,
-1077,
-1077,
-1077,
-1076,
-1076,
-1076,
-1076,
-1076,
-1076,
-1076,
-1076,
-1076,
-1076,
-1075,
-1075,
-1075,
-1075,
-1075,
-1075,
-1075,
-1075,
-1075,
-1074,
-1074,
-1074,
-1074,
-1074,
-1074,
-1074,
-1074,
-1074,
-1074,
-1073,
-1073,
-1073,
-1073,
-1073,
-1073,
-1073,
-1073,
-1073,
-1073,
-1072,
-1072,
-1072,
-1072,
-1072,
-1072,
-1072,
-1072,
-1072,
-1072,
-1071,
-1071,
-1071,
-1071,
-1071,
-1071,
-1071,
-1071,
-1071,
-1071,
-1070,
-1070,
-1070,
-1070,
-1070,
-1070,
-1070,
-1070,
-1070,
-1070,
-1069,
-1069,
-1069,
-1069,
-1069,
-1069,
-1069,
-1069,
-1069,
-1068,
-1068,
-1068,
-1068,
-1068,
-1068,
-1068,
-1068,
-1068,
-1068,
-1067,
-1067,
-1067,
-1067,
-1067,
-1067,
-1067,
-1067,
-1067,
-1067,
-1066,
-1066,
-1066,
-1066,
-1066,
-1066,
-1066,
-1066,
-1066,
-1066,
-1065,
-1065,
-1065,
-1065,
-1065,
-1065,
-1065,
-1065,
-1065,
-1065,
-1064,
-1064,
-1064,
-1064,
-1064,
-1064,
-1064,
-1064,
-1064,
-1064,
-1063,
-1063,
-1063,
-1063,
-1063,
-1063,
-1063,
-1063,
-1063,
-1063,
-1062,
-1062,
-1062,
-1062,
-1062,
-1062,
-1062,
-1062,
-1062,
-1062,
-1061,
-1061,
-1061,
-1061,
-1061,
-1061,
-1061,
-1061,
-1061,
-1061,
-1060,
-1060,
-1060,
-1060,
-1060,
-1060,
-1060,
-1060,
-1060,
-1060,
-1059,
-1059,
-1059,
-1059,
-1059,
-1059,
-1059,
-1059,
-1059,
-1059,
-1058,
-1058,
-1058,
-1058,
-1058,
-1058,
-1058,
-1058,
-1058,
-1057,
-1057,
-1057,
-1057,
-1057,
-1057,
-1057,
-1057,
-1057,
-1057,
-1056,
-1056,
-1056,
-1056,
-1056,
-1056,
-1056,
-1056,
-1056,
-1056,
-1055,
-1055,
-1055,
-1055,
-1055,
-1055,
-1055,
-1055,
-1055,
-1055,
-1054,
-1054,
-1054,
-1054,
-1054,
-1054,
-1054,
-1054,
-1054,
-1054,
-1053,
-1053,
-1053,
-1053,
-1053,
-1053,
-1053,
-1053,
-1053,
-1053,
-1052,
-1052,
-1052,
-1052,
-1052,
-1052,
-1052,
-1052,
-1052,
-1052,
-1051,
-1051,
-1051,
-1051,
-1051,
-1051,
-1051,
-1051,
-1051,
-1051,
-1050,
-1050,
-1050,
-1050,
-1050,
-1050,
-1050,
-1050,
-1050,
-1050,
-1050,
-1049,
-1049,
-1049,
-1049,
-1049,
-1049,
-1049,
-1049,
-1049,
-1049,
-1048,
-1048,
-1048,
-1048,
-1048,
-1048,
-1048,
-1048,
-1048,
-1048,
-1047,
-1047,
-1047,
-1047,
-1047,
-1047,
-1047,
-1047,
-1047,
-1047,
-1046,
-1046,
-1046,
-1046,
-1046,
-1046,
-1046,
-1046,
-1046,
-1046,
-1045,
-1045,
-1045,
-1045,
-1045,
-1045,
-1045,
-1045,
-1045,
-1045,
-1044,
-1044,
-1044,
-1044,
-1044,
-1044,
-1044,
-1044,
-1044,
-1044,
-1043,
-1043,
-1043,
-1043,
-1043,
-1043,
-1043,
-1043,
-1043,
-1043,
-1042,
-1042,
-1042,
-1042,
-1042,
-1042,
-1042,
-1042,
-1042,
-1042,
-1041,
-1041,
-1041,
-1041,
-1041,
-1041,
-1041,
-1041,
-1041,
-1041,
-1040,
-1040,
-1040,
-1040,
-1040,
-1040,
-1040,
-1040,
-1040,
-1040,
-1039,
-1039,
-1039,
-1039,
-1039,
-1039,
-1039,
-1039,
-1039,
-1039,
-1038,
-1038,
-1038,
-1038,
-1038,
-1038,
-1038,
-1038,
-1038,
-1038,
-1038,
-1037,
-1037,
-1037,
-1037,
-1037,
-1037,
-1037,
-1037,
-1037,
-1037,
-1036,
-1036,
-1036,
-1036,
-1036,
-1036,
-1036,
-1036,
-1036,
-1036,
-1035,
-1035,
-1035,
-1035,
-1035,
-1035,
-1035,
-1035,
-1035,
-1035,
-1034,
-1034,
-1034,
-1034,
-1034,
-1034,
-1034,
-1034,
-1034,
-1034,
-1033,
-1033,
-1033,
-1033,
-1033,
-1033,
-1033,
-1033,
-1033,
-1033,
-1032,
-1032,
-1032,
-1032,
-1032,
-1032,
-1032,
-1032,
-1032,
-1032,
-1032,
-1031,
-1031,
-1031,
-1031,
-1031,
-1031,
-1031,
-1031,
-1031,
-1031,
-1030,
-1030,
-1030,
-1030,
-1030,
-1030,
-1030,
-1030,
-1030,
-1030,
-1029,
-1029,
-1029,
-1029,
-1029,
-1029,
-1029,
-1029,
-1029,
-1029,
-1028,
-1028,
-1028,
-1028,
-1028,
-1028,
-1028,
-1028,
-1028,
-1028,
-1028,
-1027,
-1027,
-1027,
-1027,
-1027,
-1027,
-1027,
-1027,
-1027,
-1027,
-1026,
-1026,
-1026,
-1026,
-1026,
-1026,
-1026,
-1026,
-1026,
-1026,
-1025,
-1025,
-1025,
-1025,
-1025,
-1025,
-1025,
-1025,
-1025,
-1025,
-1024,
-1024,
-1024,
-1024,
-1024,
-1024,
-1024,
-1024,
-1024,
-1024,
-1024,
-1023,
-1023,
-1023,
-1023,
-1023,
-1023,
-1023,
-1023,
-1023,
-1023,
-1022,
-1022,
-1022,
-1022,
-1022,
-1022,
-1022,
-1022,
-1022,
-1022,
-1021,
-1021,
-1021,
-1021,
-1021,
-1021,
-1021,
-1021,
-1021,
-1021,
-1020,
-1020,
-1020,
-1020,
-1020,
-1020,
-1020,
-1020,
-1020,
-1020,
-1020,
-1019,
-1019,
-1019,
-1019,
-1019,
-1019,
-1019,
-1019,
-1019,
-1019,
-1018,
-1018,
-1018,
-1018,
-1018,
-1018,
-1018,
-1018,
-1018,
-1018,
-1017,
-1017,
-1017,
-1017,
-1017,
-1017,
-1017,
-1017,
-1017,
-1017,
-1017,
-1016,
-1016,
-1016,
-1016,
-1016,
-1016,
-1016,
-1016,
-1016,
-1016,
-1015,
-1015,
-1015,
-1015,
-1015,
-1015,
-1015,
-1015,
-1015,
-1015,
-1014,
-1014,
-1014,
-1014,
-1014,
-1014,
-1014,
-1014,
-1014,
-1014,
-1014,
-1013,
-1013,
-1013,
-1013,
-1013,
-1013,
-1013,
-1013,
-1013,
-1013,
-1012,
-1012,
-1012,
-1012,
-1012,
-1012,
-1012,
-1012,
-1012,
-1012,
-1012,
-1011,
-1011,
-1011,
-1011,
-1011,
-1011,
-1011,
-1011,
-1011,
-1011,
-1010,
-1010,
-1010,
-1010,
-1010,
-1010,
-1010,
-1010,
-1010,
-1010,
-1009,
-1009,
-1009,
-1009,
-1009,
-1009,
-1009,
-1009,
-1009,
-1009,
-1009,
-1008,
-1008,
-1008,
-1008,
-1008,
-1008,
-1008,
-1008,
-1008,
-1008,
-1007,
-1007,
-1007,
-1007,
-1007,
-1007,
-1007,
-1007,
-1007,
-1007,
-1007,
-1006,
-1006,
-1006,
-1006,
-1006,
-1006,
-1006,
-1006,
-1006,
-1006,
-1005,
-1005,
-1005,
-1005,
-1005,
-1005,
-1005,
-1005,
-1005,
-1005,
-1005,
-1004,
-1004,
-1004,
-1004,
-1004,
-1004,
-1004,
-1004,
-1004,
-1004,
-1003,
-1003,
-1003,
-1003,
-1003,
-1003,
-1003,
-1003,
-1003,
-1003,
-1003,
-1002,
-1002,
-1002,
-1002,
-1002,
-1002,
-1002,
-1002,
-1002,
-1002,
-1001,
-1001,
-1001,
-1001,
-1001,
-1001,
-1001,
-1001,
-1001,
-1001,
-1001,
-1000,
-1000,
-1000,
-1000,
-1000,
-1000,
-1000,
-1000,
-1000,
-1000,
-999,
-999,
-999,
-999,
-999,
-999,
-999,
-999,
-999,
-999,
-999,
-998,
-998,
-998,
-998,
-998,
-998,
-998,
-998,
-998,
-998,
-997,
-997,
-997,
-997,
-997,
-997,
-997,
-997,
-997,
-997,
-997,
-996,
-996,
-996,
-996,
-996,
-996,
-996,
-996,
-996,
-996,
-995,
-995,
-995,
-995,
-995,
-995,
-995,
-995,
-995,
-995,
-995,
-994,
-994,
-994,
-994,
-994,
-994,
-994,
-994,
-994,
-994,
-993,
-993,
-993,
-993,
-993,
-993,
-993,
-993,
-993,
-993,
-993,
-992,
-992,
-992,
-992,
-992,
-992,
-992,
-992,
-992,
-992,
-992,
-991,
-991,
-991,
-991,
-991,
-991,
-991,
-991,
-991,
-991,
-990,
-990,
-990,
-990,
-990,
-990,
-990,
-990,
-990,
-990,
-990,
-989,
-989,
-989,
-989,
-989,
-989,
-989,
-989,
-989,
-989,
-988,
-988,
-988,
-988,
-988,
-988,
-988,
-988,
-988,
-988,
-988,
-987,
-987,
-987,
-987,
-987,
-987,
-987,
-987,
-987,
-987,
-987,
-986,
-986,
-986,
-986,
-986,
-986,
-986,
-986,
-986,
-986,
-985,
-985,
-985,
-985,
-985,
-985,
-985,
-985,
-985,
-985,
-985,
-984,
-984,
-984,
-984,
-984,
-984,
-984,
-984,
-984,
-984,
-984,
-983,
-983,
-983,
-983,
-983,
-983,
-983,
-983,
-983,
-983,
-982,
-982,
-982,
-982,
-982,
-982,
-982,
-982,
-982,
-982,
-982,
-981,
-981,
-981,
-981,
-981,
-981,
-981,
-981,
-981,
-981,
-981,
-980,
-980,
-980,
-980,
-980,
-980,
-980,
-980,
-980,
-980,
-979,
-979,
-979,
-979,
-979,
-979,
-979,
-979,
-979,
-979,
-979,
-978,
-978,
-978,
-978,
-978,
-978,
-978,
-978,
-978,
-978,
-978,
-977,
-977,
-977,
-977,
-977,
-977,
-977,
-977,
-977,
-977,
-977,
-976,
-976,
-976,
-976,
-976,
-976,
-976,
-976,
-976,
-976,
-975,
-975,
-975,
-975,
-975,
-975,
-975,
-975,
-975,
-975,
-975,
-974,
-974,
-974,
-974,
-974,
-974,
-974,
-974,
-974,
-974,
-974,
-973,
-973,
-973,
-973,
-973,
-973,
-973,
-973,
-973,
-973,
-973,
-972,
-972,
-972,
-972,
-972,
-972,
-972,
-972,
-972,
-972,
-971,
-971,
-971,
-971,
-971,
-971,
-971,
-971,
-971,
-971,
-971,
-970,
-970,
-970,
-970,
-970,
-970,
-970,
-970,
-970,
-970,
-970,
-969,
-969,
-969,
-969,
-969,
-969,
-969,
-969,
-969,
-969,
-969,
-968,
-968,
-968,
-968,
-968,
-968,
-968,
-968,
-968,
-968,
-968,
-967,
-967,
-967,
-967,
-967,
-967,
-967,
-967,
-967,
-967,
-967,
-966,
-966,
-966,
-966,
-966,
-966,
-966,
-966,
-966,
-966,
-965,
-965,
-965,
-965,
-965,
-965,
-965,
-965,
-965,
-965,
-965,
-964,
-964,
-964,
-964,
-964,
-964,
-964,
-964,
-964,
-964,
-964,
-963,
-963,
-963,
-963,
-963,
-963,
-963,
-963,
-963,
-963,
-963,
-962,
-962,
-962,
-962,
-962,
-962,
-962,
-962,
-962,
-962,
-962,
-961,
-961,
-961,
-961,
-961,
-961,
-961,
-961,
-961,
-961,
-961,
-960,
-960,
-960,
-960,
-960,
-960,
-960,
-960,
-960,
-960,
-960,
-959,
-959,
-959,
-959,
-959,
-959,
-959,
-959,
-959,
-959,
-959,
-958,
-958,
-958,
-958,
-958,
-958,
-958,
-958,
-958,
-958,
-958,
-957,
-957,
-957,
-957,
-957,
-957,
-957,
-957,
-957,
-957,
-957,
-956,
-956,
-956,
-956,
-956,
-956,
-956,
-956,
-956,
-956,
-956,
-955,
-955,
-955,
-955,
-955,
-955,
-955,
-955,
-955,
-955,
-955,
-954,
-954,
-954,
-954,
-954,
-954,
-954,
-954,
-954,
-954,
-954,
-953,
-953,
-953,
-953,
-953,
-953,
-953,
-953,
-953,
-953,
-953,
-952,
-952,
-952,
-952,
-952,
-952,
-952,
-952,
-952,
-952,
-952,
-951,
-951,
-951,
-951,
-951,
-951,
-951,
-951,
-951,
-951,
-951,
-950,
-950,
-950,
-950,
-950,
-950,
-950,
-950,
-950,
-950,
-950,
-949,
-949,
-949,
-949,
-949,
-949,
-949,
-949,
-949,
-949,
-949,
-948,
-948,
-948,
-948,
-948,
-948,
-948,
-948,
-948,
-948,
-948,
-947,
-947,
-947,
-947,
-947,
-947,
-947,
-947,
-947,
-947,
-947,
-946,
-946,
-946,
-946,
-946,
-946,
-946,
-946,
-946,
-946,
-946,
-945,
-945,
-945,
-945,
-945,
-945,
-945,
-945,
-945,
-945,
-945,
-944,
-944,
-944,
-944,
-944,
-944,
-944,
-944,
-944,
-944,
-944,
-943,
-943,
-943,
-943,
-943,
-943,
-943,
-943,
-943,
-943,
-943,
-942,
-942,
-942,
-942,
-942,
-942,
-942,
-942,
-942,
-942,
-942,
-941,
-941,
-941,
-941,
-941,
-941,
-941,
-941,
-941,
-941,
-941,
-941,
-940,
-940,
-940,
-940,
-940,
-940,
-940,
-940,
-940,
-940,
-940,
-939,
-939,
-939,
-939,
-939,
-939,
-939,
-939,
-939,
-939,
-939,
-938,
-938,
-938,
-938,
-938,
-938,
-938,
-938,
-938,
-938,
-938,
-937,
-937,
-937,
-937,
-937,
-937,
-937,
-937,
-937,
-937,
-937,
-936,
-936,
-936,
-936,
-936,
-936,
-936,
-936,
-936,
-936,
-936,
-935,
-935,
-935,
-935,
-935,
-935,
-935,
-935,
-935,
-935,
-935,
-935,
-934,
-934,
-934,
-934,
-934,
-934,
-934,
-934,
-934,
-934,
-934,
-933,
-933,
-933,
-933,
-933,
-933,
-933,
-933,
-933,
-933,
-933,
-932,
-932,
-932,
-932,
-932,
-932,
-932,
-932,
-932,
-932,
-932,
-931,
-931,
-931,
-931,
-931,
-931,
-931,
-931,
-931,
-931,
-931,
-931,
-930,
-930,
-930,
-930,
-930,
-930,
-930,
-930,
-930,
-930,
-930,
-929,
-929,
-929,
-929,
-929,
-929,
-929,
-929,
-929,
-929,
-929,
-928,
-928,
-928,
-928,
-928,
-928,
-928,
-928,
-928,
-928,
-928,
-927,
-927,
-927,
-927,
-927,
-927,
-927,
-927,
-927,
-927,
-927,
-927,
-926,
-926,
-926,
-926,
-926,
-926,
-926,
-926,
-926,
-926,
-926,
-925,
-925,
-925,
-925,
-925,
-925,
-925,
-925,
-925,
-925,
-925,
-924,
-924,
-924,
-924,
-924,
-924,
-924,
-924,
-924,
-924,
-924,
-924,
-923,
-923,
-923,
-923,
-923,
-923,
-923,
-923,
-923,
-923,
-923,
-922,
-922,
-922,
-922,
-922,
-922,
-922,
-922,
-922,
-922,
-922,
-921,
-921,
-921,
-921,
-921,
-921,
-921,
-921,
-921,
-921,
-921,
-921,
-920,
-920,
-920,
-920,
-920,
-920,
-920,
-920,
-920,
-920,
-920,
-919,
-919,
-919,
-919,
-919,
-919,
-919,
-919,
-919,
-919,
-919,
-918,
-918,
-918,
-918,
-918,
-918,
-918,
-918,
-918,
-918,
-918,
-918,
-917,
-917,
-917,
-917,
-917,
-917,
-917,
-917,
-917,
-917,
-917,
-916,
-916,
-916,
-916,
-916,
-916,
-916,
-916,
-916,
-916,
-916,
-916,
-915,
-915,
-915,
-915,
-915,
-915,
-915,
-915,
-915,
-915,
-915,
-914,
-914,
-914,
-914,
-914,
-914,
-914,
-914,
-914,
-914,
-914,
-914,
-913,
-913,
-913,
-913,
-913,
-913,
-913,
-913,
-913,
-913,
-913,
-912,
-912,
-912,
-912,
-912,
-912,
-912,
-912,
-912,
-912,
-912,
-911,
-911,
-911,
-911,
-911,
-911,
-911,
-911,
-911,
-911,
-911,
-911,
-910,
-910,
-910,
-910,
-910,
-910,
-910,
-910,
-910,
-910,
-910,
-909,
-909,
-909,
-909,
-909,
-909,
-909,
-909,
-909,
-909,
-909,
-909,
-908,
-908,
-908,
-908,
-908,
-908,
-908,
-908,
-908,
-908,
-908,
-907,
-907,
-907,
-907,
-907,
-907,
-907,
-907,
-907,
-907,
-907,
-907,
-906,
-906,
-906,
-906,
-906,
-906,
-906,
-906,
-906,
-906,
-906,
-906,
-905,
-905,
-905,
-905,
-905,
-905,
-905,
-905,
-905,
-905,
-905,
-904,
-904,
-904,
-904,
-904,
-904,
-904,
-904,
-904,
-904,
-904,
-904,
-903,
-903,
-903,
-903,
-903,
-903,
-903,
-903,
-903,
-903,
-903,
-902,
-902,
-902,
-902,
-902,
-902,
-902,
-902,
-902,
-902,
-902,
-902,
-901,
-901,
-901,
-901,
-901,
-901,
-901,
-901,
-901,
-901,
-901,
-900,
-900,
-900,
-900,
-900,
-900,
-900,
-900,
-900,
-900,
-900,
-900,
-899,
-899,
-899,
-899,
-899,
-899,
-899,
-899,
-899,
-899,
-899,
-899,
-898,
-898,
-898,
-898,
-898,
-898,
-898,
-898,
-898,
-898,
-898,
-897,
-897,
-897,
-897,
-897,
-897,
-897,
-897,
-897,
-897,
-897,
-897,
-896,
-896,
-896,
-896,
-896,
-896,
-896,
-896,
-896,
-896,
-896,
-896,
-895,
-895,
-895,
-895,
-895,
-895,
-895,
-895,
-895,
-895,
-895,
-894,
-894,
-894,
-894,
-894,
-894,
-894,
-894,
-894,
-894,
-894,
-894,
-893,
-893,
-893,
-893,
-893,
-893,
-893,
-893,
-893,
-893,
-893,
-893,
-892,
-892,
-892,
-892,
-892,
-892,
-892,
-892,
-892,
-892,
-892,
-891,
-891,
-891,
-891,
-891,
-891,
-891,
-891,
-891,
-891,
-891,
-891,
-890,
-890,
-890,
-890,
-890,
-890,
-890,
-890,
-890,
-890,
-890,
-890,
-889,
-889,
-889,
-889,
-889,
-889,
-889,
-889,
-889,
-889,
-889,
-889,
-888,
-888,
-888,
-888,
-888,
-888,
-888,
-888,
-888,
-888,
-888,
-887,
-887,
-887,
-887,
-887,
-887,
-887,
-887,
-887,
-887,
-887,
-887,
-886,
-886,
-886,
-886,
-886,
-886,
-886,
-886,
-886,
-886,
-886,
-886,
-885,
-885,
-885,
-885,
-885,
-885,
-885,
-885,
-885,
-885,
-885,
-885,
-884,
-884,
-884,
-884,
-884,
-884,
-884,
-884,
-884,
-884,
-884,
-884,
-883,
-883,
-883,
-883,
-883,
-883,
-883,
-883,
-883,
-883,
-883,
-883,
-882,
-882,
-882,
-882,
-882,
-882,
-882,
-882,
-882,
-882,
-882,
-881,
-881,
-881,
-881,
-881,
-881,
-881,
-881,
-881,
-881,
-881,
-881,
-880,
-880,
-880,
-880,
-880,
-880,
-880,
-880,
-880,
-880,
-880,
-880,
-879,
-879,
-879,
-879,
-879,
-879,
-879,
-879,
-879,
-879,
-879,
-879,
-878,
-878,
-878,
-878,
-878,
-878,
-878,
-878,
-878,
-878,
-878,
-878,
-877,
-877,
-877,
-877,
-877,
-877,
-877,
-877,
-877,
-877,
-877,
-877,
-876,
-876,
-876,
-876,
-876,
-876,
-876,
-876,
-876,
-876,
-876,
-876,
-875,
-875,
-875,
-875,
-875,
-875,
-875,
-875,
-875,
-875,
-875,
-875,
-874,
-874,
-874,
-874,
-874,
-874,
-874,
-874,
-874,
-874,
-874,
-874,
-873,
-873,
-873,
-873,
-873,
-873,
-873,
-873,
-873,
-873,
-873,
-873,
-872,
-872,
-872,
-872,
-872,
-872,
-872,
-872,
-872,
-872,
-872,
-872,
-871,
-871,
-871,
-871,
-871,
-871,
-871,
-871,
-871,
-871,
-871,
-871,
-870,
-870,
-870,
-870,
-870,
-870,
-870,
-870,
-870,
-870,
-870,
-870,
-869,
-869,
-869,
-869,
-869,
-869,
-869,
-869,
-869,
-869,
-869,
-869,
-868,
-868,
-868,
-868,
-868,
-868,
-868,
-868,
-868,
-868,
-868,
-868,
-867,
-867,
-867,
-867,
-867,
-867,
-867,
-867,
-867,
-867,
-867,
-867,
-866,
-866,
-866,
-866,
-866,
-866,
-866,
-866,
-866,
-866,
-866,
-866,
-865,
-865,
-865,
-865,
-865,
-865,
-865,
-865,
-865,
-865,
-865,
-865,
-864,
-864,
-864,
-864,
-864,
-864,
-864,
-864,
-864,
-864,
-864,
-864,
-863,
-863,
-863,
-863,
-863,
-863,
-863,
-863,
-863,
-863,
-863,
-863,
-862,
-862,
-862,
-862,
-862,
-862,
-862,
-862,
-862,
-862,
-862,
-862,
-861,
-861,
-861,
-861,
-861,
-861,
-861,
-861,
-861,
-861,
-861,
-861,
-860,
-860,
-860,
-860,
-860,
-860,
-860,
-860,
-860,
-860,
-860,
-860,
-859,
-859,
-859,
-859,
-859,
-859,
-859,
-859,
-859,
-859,
-859,
-859,
-858,
-858,
-858,
-858,
-858,
-858,
-858,
-858,
-858,
-858,
-858,
-858,
-858,
-857,
-857,
-857,
-857,
-857,
-857,
-857,
-857,
-857,
-857,
-857,
-857,
-856,
-856,
-856,
-856,
-856,
-856,
-856,
-856,
-856,
-856,
-856,
-856,
-855,
-855,
-855,
-855,
-855,
-855,
-855,
-855,
-855,
-855,
-855,
-855,
-854,
-854,
-854,
-854,
-854,
-854,
-854,
-854,
-854,
-854,
-854,
-854,
-853,
-853,
-853,
-853,
-853,
-853,
-853,
-853,
-853,
-853,
-853,
-853,
-853,
-852,
-852,
-852,
-852,
-852,
-852,
-852,
-852,
-852,
-852,
-852,
-852,
-851,
-851,
-851,
-851,
-851,
-851,
-851,
-851,
-851,
-851,
-851,
-851,
-850,
-850,
-850,
-850,
-850,
-850,
-850,
-850,
-850,
-850,
-850,
-850,
-849,
-849,
-849,
-849,
-849,
-849,
-849,
-849,
-849,
-849,
-849,
-849,
-849,
-848,
-848,
-848,
-848,
-848,
-848,
-848,
-848,
-848,
-848,
-848,
-848,
-847,
-847,
-847,
-847,
-847,
-847,
-847,
-847,
-847,
-847,
-847,
-847,
-846,
-846,
-846,
-846,
-846,
-846,
-846,
-846,
-846,
-846,
-846,
-846,
-846,
-845,
-845,
-845,
-845,
-845,
-845,
-845,
-845,
-845,
-845,
-845,
-845,
-844,
-844,
-844,
-844,
-844,
-844,
-844,
-844,
-844,
-844,
-844,
-844,
-843,
-843,
-843,
-843,
-843,
-843,
-843,
-843,
-843,
-843,
-843,
-843,
-843,
-842,
-842,
-842,
-842,
-842,
-842,
-842,
-842,
-842,
-842,
-842,
-842,
-841,
-841,
-841,
-841,
-841,
-841,
-841,
-841,
-841,
-841,
-841,
-841,
-840,
-840,
-840,
-840,
-840,
-840,
-840,
-840,
-840,
-840,
-840,
-840,
-840,
-839,
-839,
-839,
-839,
-839,
-839,
-839,
-839,
-839,
-839,
-839,
-839,
-838,
-838,
-838,
-838,
-838,
-838,
-838,
-838,
-838,
-838,
-838,
-838,
-838,
-837,
-837,
-837,
-837,
-837,
-837,
-837,
-837,
-837,
-837,
-837,
-837,
-836,
-836,
-836,
-836,
-836,
-836,
-836,
-836,
-836,
-836,
-836,
-836,
-836,
-835,
-835,
-835,
-835,
-835,
-835,
-835,
-835,
-835,
-835,
-835,
-835,
-834,
-834,
-834,
-834,
-834,
-834,
-834,
-834,
-834,
-834,
-834,
-834,
-834,
-833,
-833,
-833,
-833,
-833,
-833,
-833,
-833,
-833,
-833,
-833,
-833,
-832,
-832,
-832,
-832,
-832,
-832,
-832,
-832,
-832,
-832,
-832,
-832,
-832,
-831,
-831,
-831,
-831,
-831,
-831,
-831,
-831,
-831,
-831,
-831,
-831,
-830,
-830,
-830,
-830,
-830,
-830,
-830,
-830,
-830,
-830,
-830,
-830,
-830,
-829,
-829,
-829,
-829,
-829,
-829,
-829,
-829,
-829,
-829,
-829,
-829,
-828,
-828,
-828,
-828,
-828,
-828,
-828,
-828,
-828,
-828,
-828,
-828,
-828,
-827,
-827,
-827,
-827,
-827,
-827,
-827,
-827,
-827,
-827,
-827,
-827,
-827,
-826,
-826,
-826,
-826,
-826,
-826,
-826,
-826,
-826,
-826,
-826,
-826,
-825,
-825,
-825,
-825,
-825,
-825,
-825,
-825,
-825,
-825,
-825,
-825,
-825,
-824,
-824,
-824,
-824,
-824,
-824,
-824,
-824,
-824,
-824,
-824,
-824,
-823,
-823,
-823,
-823,
-823,
-823,
-823,
-823,
-823,
-823,
-823,
-823,
-823,
-822,
-822,
-822,
-822,
-822,
-822,
-822,
-822,
-822,
-822,
-822,
-822,
-822,
-821,
-821,
-821,
-821,
-821,
-821,
-821,
-821,
-821,
-821,
-821,
-821,
-820,
-820,
-820,
-820,
-820,
-820,
-820,
-820,
-820,
-820,
-820,
-820,
-820,
-819,
-819,
-819,
-819,
-819,
-819,
-819,
-819,
-819,
-819,
-819,
-819,
-819,
-818,
-818,
-818,
-818,
-818,
-818,
-818,
-818,
-818,
-818,
-818,
-818,
-818,
-817,
-817,
-817,
-817,
-817,
-817,
-817,
-817,
-817,
-817,
-817,
-817,
-816,
-816,
-816,
-816,
-816,
-816,
-816,
-816,
-816,
-816,
-816,
-816,
-816,
-815,
-815,
-815,
-815,
-815,
-815,
-815,
-815,
-815,
-815,
-815,
-815,
-815,
-814,
-814,
-814,
-814,
-814,
-814,
-814,
-814,
-814,
-814,
-814,
-814,
-814,
-813,
-813,
-813,
-813,
-813,
-813,
-813,
-813,
-813,
-813,
-813,
-813,
-812,
-812,
-812,
-812,
-812,
-812,
-812,
-812,
-812,
-812,
-812,
-812,
-812,
-811,
-811,
-811,
-811,
-811,
-811,
-811,
-811,
-811,
-811,
-811,
-811,
-811,
-810,
-810,
-810,
-810,
-810,
-810,
-810,
-810,
-810,
-810,
-810,
-810,
-810,
-809,
-809,
-809,
-809,
-809,
-809,
-809,
-809,
-809,
-809,
-809,
-809,
-809,
-808,
-808,
-808,
-808,
-808,
-808,
-808,
-808,
-808,
-808,
-808,
-808,
-808,
-807,
-807,
-807,
-807,
-807,
-807,
-807,
-807,
-807,
-807,
-807,
-807,
-807,
-806,
-806,
-806,
-806,
-806,
-806,
-806,
-806,
-806,
-806,
-806,
-806,
-806,
-805,
-805,
-805,
-805,
-805,
-805,
-805,
-805,
-805,
-805,
-805,
-805,
-805,
-804,
-804,
-804,
-804,
-804,
-804,
-804,
-804,
-804,
-804,
-804,
-804,
-803,
-803,
-803,
-803,
-803,
-803,
-803,
-803,
-803,
-803,
-803,
-803,
-803,
-802,
-802,
-802,
-802,
-802,
-802,
-802,
-802,
-802,
-802,
-802,
-802,
-802,
-801,
-801,
-801,
-801,
-801,
-801,
-801,
-801,
-801,
-801,
-801,
-801,
-801,
-800,
-800,
-800,
-800,
-800,
-800,
-800,
-800,
-800,
-800,
-800,
-800,
-800,
-799,
-799,
-799,
-799,
-799,
-799,
-799,
-799,
-799,
-799,
-799,
-799,
-799,
-798,
-798,
-798,
-798,
-798,
-798,
-798,
-798,
-798,
-798,
-798,
-798,
-798,
-797,
-797,
-797,
-797,
-797,
-797,
-797,
-797,
-797,
-797,
-797,
-797,
-797,
-797,
-796,
-796,
-796,
-796,
-796,
-796,
-796,
-796,
-796,
-796,
-796,
-796,
-796,
-795,
-795,
-795,
-795,
-795,
-795,
-795,
-795,
-795,
-795,
-795,
-795,
-795,
-794,
-794,
-794,
-794,
-794,
-794,
-794,
-794,
-794,
-794,
-794,
-794,
-794,
-793,
-793,
-793,
-793,
-793,
-793,
-793,
-793,
-793,
-793,
-793,
-793,
-793,
-792,
-792,
-792,
-792,
-792,
-792,
-792,
-792,
-792,
-792,
-792,
-792,
-792,
-791,
-791,
-791,
-791,
-791,
-791,
-791,
-791,
-791,
-791,
-791,
-791,
-791,
-790,
-790,
-790,
-790,
-790,
-790,
-790,
-790,
-790,
-790,
-790,
-790,
-790,
-789,
-789,
-789,
-789,
-789,
-789,
-789,
-789,
-789,
-789,
-789,
-789,
-789,
-789,
-788,
-788,
-788,
-788,
-788,
-788,
-788,
-788,
-788,
-788,
-788,
-788,
-788,
-787,
-787,
-787,
-787,
-787,
-787,
-787,
-787,
-787,
-787,
-787,
-787,
-787,
-786,
-786,
-786,
-786,
-786,
-786,
-786,
-786,
-786,
-786,
-786,
-786,
-786,
-785,
-785,
-785,
-785,
-785,
-785,
-785,
-785,
-785,
-785,
-785,
-785,
-785,
-784,
-784,
-784,
-784,
-784,
-784,
-784,
-784,
-784,
-784,
-784,
-784,
-784,
-784,
-783,
-783,
-783,
-783,
-783,
-783,
-783,
-783,
-783,
-783,
-783,
-783,
-783,
-782,
-782,
-782,
-782,
-782,
-782,
-782,
-782,
-782,
-782,
-782,
-782,
-782,
-781,
-781,
-781,
-781,
-781,
-781,
-781,
-781,
-781,
-781,
-781,
-781,
-781,
-781,
-780,
-780,
-780,
-780,
-780,
-780,
-780,
-780,
-780,
-780,
-780,
-780,
-780,
-779,
-779,
-779,
-779,
-779,
-779,
-779,
-779,
-779,
-779,
-779,
-779,
-779,
-778,
-778,
-778,
-778,
-778,
-778,
-778,
-778,
-778,
-778,
-778,
-778,
-778,
-778,
-777,
-777,
-777,
-777,
-777,
-777,
-777,
-777,
-777,
-777,
-777,
-777,
-777,
-776,
-776,
-776,
-776,
-776,
-776,
-776,
-776,
-776,
-776,
-776,
-776,
-776,
-775,
-775,
-775,
-775,
-775,
-775,
-775,
-775,
-775,
-775,
-775,
-775,
-775,
-775,
-774,
-774,
-774,
-774,
-774,
-774,
-774,
-774,
-774,
-774,
-774,
-774,
-774,
-773,
-773,
-773,
-773,
-773,
-773,
-773,
-773,
-773,
-773,
-773,
-773,
-773,
-773,
-772,
-772,
-772,
-772,
-772,
-772,
-772,
-772,
-772,
-772,
-772,
-772,
-772,
-771,
-771,
-771,
-771,
-771,
-771,
-771,
-771,
-771,
-771,
-771,
-771,
-771,
-771,
-770,
-770,
-770,
-770,
-770,
-770,
-770,
-770,
-770,
-770,
-770,
-770,
-770,
-769,
-769,
-769,
-769,
-769,
-769,
-769,
-769,
-769,
-769,
-769,
-769,
-769,
-769,
-768,
-768,
-768,
-768,
-768,
-768,
-768,
-768,
-768,
-768,
-768,
-768,
-768,
-767,
-767,
-767,
-767,
-767,
-767,
-767,
-767,
-767,
-767,
-767,
-767,
-767,
-767,
-766,
-766,
-766,
-766,
-766,
-766,
-766,
-766,
-766,
-766,
-766,
-766,
-766,
-765,
-765,
-765,
-765,
-765,
-765,
-765,
-765,
-765,
-765,
-765,
-765,
-765,
-765,
-764,
-764,
-764,
-764,
-764,
-764,
-764,
-764,
-764,
-764,
-764,
-764,
-764,
-763,
-763,
-763,
-763,
-763,
-763,
-763,
-763,
-763,
-763,
-763,
-763,
-763,
-763,
-762,
-762,
-762,
-762,
-762,
-762,
-762,
-762,
-762,
-762,
-762,
-762,
-762,
-762,
-761,
-761,
-761,
-761,
-761,
-761,
-761,
-761,
-761,
-761,
-761,
-761,
-761,
-760,
-760,
-760,
-760,
-760,
-760,
-760,
-760,
-760,
-760,
-760,
-760,
-760,
-760,
-759,
-759,
-759,
-759,
-759,
-759,
-759,
-759,
-759,
-759,
-759,
-759,
-759,
-759,
-758,
-758,
-758,
-758,
-758,
-758,
-758,
-758,
-758,
-758,
-758,
-758,
-758,
-757,
-757,
-757,
-757,
-757,
-757,
-757,
-757,
-757,
-757,
-757,
-757,
-757,
-757,
-756,
-756,
-756,
-756,
-756,
-756,
-756,
-756,
-756,
-756,
-756,
-756,
-756,
-756,
-755,
-755,
-755,
-755,
-755,
-755,
-755,
-755,
-755,
-755,
-755,
-755,
-755,
-755,
-754,
-754,
-754,
-754,
-754,
-754,
-754,
-754,
-754,
-754,
-754,
-754,
-754,
-753,
-753,
-753,
-753,
-753,
-753,
-753,
-753,
-753,
-753,
-753,
-753,
-753,
-753,
-752,
-752,
-752,
-752,
-752,
-752,
-752,
-752,
-752,
-752,
-752,
-752,
-752,
-752,
-751,
-751,
-751,
-751,
-751,
-751,
-751,
-751,
-751,
-751,
-751,
-751,
-751,
-751,
-750,
-750,
-750,
-750,
-750,
-750,
-750,
-750,
-750,
-750,
-750,
-750,
-750,
-750,
-749,
-749,
-749,
-749,
-749,
-749,
-749,
-749,
-749,
-749,
-749,
-749,
-749,
-748,
-748,
-748,
-748,
-748,
-748,
-748,
-748,
-748,
-748,
-748,
-748,
-748,
-748,
-747,
-747,
-747,
-747,
-747,
-747,
-747,
-747,
-747,
-747,
-747,
-747,
-747,
-747,
-746,
-746,
-746,
-746,
-746,
-746,
-746,
-746,
-746,
-746,
-746,
-746,
-746,
-746,
-745,
-745,
-745,
-745,
-745,
-745,
-745,
-745,
-745,
-745,
-745,
-745,
-745,
-745,
-744,
-744,
-744,
-744,
-744,
-744,
-744,
-744,
-744,
-744,
-744,
-744,
-744,
-744,
-743,
-743,
-743,
-743,
-743,
-743,
-743,
-743,
-743,
-743,
-743,
-743,
-743,
-743,
-742,
-742,
-742,
-742,
-742,
-742,
-742,
-742,
-742,
-742,
-742,
-742,
-742,
-742,
-741,
-741,
-741,
-741,
-741,
-741,
-741,
-741,
-741,
-741,
-741,
-741,
-741,
-741,
-740,
-740,
-740,
-740,
-740,
-740,
-740,
-740,
-740,
-740,
-740,
-740,
-740,
-740,
-739,
-739,
-739,
-739,
-739,
-739,
-739,
-739,
-739,
-739,
-739,
-739,
-739,
-739,
-738,
-738,
-738,
-738,
-738,
-738,
-738,
-738,
-738,
-738,
-738,
-738,
-738,
-738,
-737,
-737,
-737,
-737,
-737,
-737,
-737,
-737,
-737,
-737,
-737,
-737,
-737,
-737,
-736,
-736,
-736,
-736,
-736,
-736,
-736,
-736,
-736,
-736,
-736,
-736,
-736,
-736,
-735,
-735,
-735,
-735,
-735,
-735,
-735,
-735,
-735,
-735,
-735,
-735,
-735,
-735,
-734,
-734,
-734,
-734,
-734,
-734,
-734,
-734,
-734,
-734,
-734,
-734,
-734,
-734,
-733,
-733,
-733,
-733,
-733,
-733,
-733,
-733,
-733,
-733,
-733,
-733,
-733,
-733,
-733,
-732,
-732,
-732,
-732,
-732,
-732,
-732,
-732,
-732,
-732,
-732,
-732,
-732,
-732,
-731,
-731,
-731,
-731,
-731,
-731,
-731,
-731,
-731,
-731,
-731,
-731,
-731,
-731,
-730,
-730,
-730,
-730,
-730,
-730,
-730,
-730,
-730,
-730,
-730,
-730,
-730,
-730,
-729,
-729,
-729,
-729,
-729,
-729,
-729,
-729,
-729,
-729,
-729,
-729,
-729,
-729,
-728,
-728,
-728,
-728,
-728,
-728,
-728,
-728,
-728,
-728,
-728,
-728,
-728,
-728,
-728,
-727,
-727,
-727,
-727,
-727,
-727,
-727,
-727,
-727,
-727,
-727,
-727,
-727,
-727,
-726,
-726,
-726,
-726,
-726,
-726,
-726,
-726,
-726,
-726,
-726,
-726,
-726,
-726,
-725,
-725,
-725,
-725,
-725,
-725,
-725,
-725,
-725,
-725,
-725,
-725,
-725,
-725,
-724,
-724,
-724,
-724,
-724,
-724,
-724,
-724,
-724,
-724,
-724,
-724,
-724,
-724,
-724,
-723,
-723,
-723,
-723,
-723,
-723,
-723,
-723,
-723,
-723,
-723,
-723,
-723,
-723,
-722,
-722,
-722,
-722,
-722,
-722,
-722,
-722,
-722,
-722,
-722,
-722,
-722,
-722,
-721,
-721,
-721,
-721,
-721,
-721,
-721,
-721,
-721,
-721,
-721,
-721,
-721,
-721,
-721,
-720,
-720,
-720,
-720,
-720,
-720,
-720,
-720,
-720,
-720,
-720,
-720,
-720,
-720,
-719,
-719,
-719,
-719,
-719,
-719,
-719,
-719,
-719,
-719,
-719,
-719,
-719,
-719,
-719,
-718,
-718,
-718,
-718,
-718,
-718,
-718,
-718,
-718,
-718,
-718,
-718,
-718,
-718,
-717,
-717,
-717,
-717,
-717,
-717,
-717,
-717,
-717,
-717,
-717,
-717,
-717,
-717,
-717,
-716,
-716,
-716,
-716,
-716,
-716,
-716,
-716,
-716,
-716,
-716,
-716,
-716,
-716,
-715,
-715,
-715,
-715,
-715,
-715,
-715,
-715,
-715,
-715,
-715,
-715,
-715,
-715,
-715,
-714,
-714,
-714,
-714,
-714,
-714,
-714,
-714,
-714,
-714,
-714,
-714,
-714,
-714,
-713,
-713,
-713,
-713,
-713,
-713,
-713,
-713,
-713,
-713,
-713,
-713,
-713,
-713,
-713,
-712,
-712,
-712,
-712,
-712,
-712,
-712,
-712,
-712,
-712,
-712,
-712,
-712,
-712,
-711,
-711,
-711,
-711,
-711,
-711,
-711,
-711,
-711,
-711,
-711,
-711,
-711,
-711,
-711,
-710,
-710,
-710,
-710,
-710,
-710,
-710,
-710,
-710,
-710,
-710,
-710,
-710,
-710,
-709,
-709,
-709,
-709,
-709,
-709,
-709,
-709,
-709,
-709,
-709,
-709,
-709,
-709,
-709,
-708,
-708,
-708,
-708,
-708,
-708,
-708,
-708,
-708,
-708,
-708,
-708,
-708,
-708,
-708,
-707,
-707,
-707,
-707,
-707,
-707,
-707,
-707,
-707,
-707,
-707,
-707,
-707,
-707,
-706,
-706,
-706,
-706,
-706,
-706,
-706,
-706,
-706,
-706,
-706,
-706,
-706,
-706,
-706,
-705,
-705,
-705,
-705,
-705,
-705,
-705,
-705,
-705,
-705,
-705,
-705,
-705,
-705,
-705,
-704,
-704,
-704,
-704,
-704,
-704,
-704,
-704,
-704,
-704,
-704,
-704,
-704,
-704,
-703,
-703,
-703,
-703,
-703,
-703,
-703,
-703,
-703,
-703,
-703,
-703,
-703,
-703,
-703,
-702,
-702,
-702,
-702,
-702,
-702,
-702,
-702,
-702,
-702,
-702,
-702,
-702,
-702,
-702,
-701,
-701,
-701,
-701,
-701,
-701,
-701,
-701,
-701,
-701,
-701,
-701,
-701,
-701,
-700,
-700,
-700,
-700,
-700,
-700,
-700,
-700,
-700,
-700,
-700,
-700,
-700,
-700,
-700,
-699,
-699,
-699,
-699,
-699,
-699,
-699,
-699,
-699,
-699,
-699,
-699,
-699,
-699,
-699,
-698,
-698,
-698,
-698,
-698,
-698,
-698,
-698,
-698,
-698,
-698,
-698,
-698,
-698,
-698,
-697,
-697,
-697,
-697,
-697,
-697,
-697,
-697,
-697,
-697,
-697,
-697,
-697,
-697,
-697,
-696,
-696,
-696,
-696,
-696,
-696,
-696,
-696,
-696,
-696,
-696,
-696,
-696,
-696,
-696,
-695,
-695,
-695,
-695,
-695,
-695,
-695,
-695,
-695,
-695,
-695,
-695,
-695,
-695,
-695,
-694,
-694,
-694,
-694,
-694,
-694,
-694,
-694,
-694,
-694,
-694,
-694,
-694,
-694,
-693,
-693,
-693,
-693,
-693,
-693,
-693,
-693,
-693,
-693,
-693,
-693,
-693,
-693,
-693,
-692,
-692,
-692,
-692,
-692,
-692,
-692,
-692,
-692,
-692,
-692,
-692,
-692,
-692,
-692,
-691,
-691,
-691,
-691,
-691,
-691,
-691,
-691,
-691,
-691,
-691,
-691,
-691,
-691,
-691,
-690,
-690,
-690,
-690,
-690,
-690,
-690,
-690,
-690,
-690,
-690,
-690,
-690,
-690,
-690,
-689,
-689,
-689,
-689,
-689,
-689,
-689,
-689,
-689,
-689,
-689,
-689,
-689,
-689,
-689,
-688,
-688,
-688,
-688,
-688,
-688,
-688,
-688,
-688,
-688,
-688,
-688,
-688,
-688,
-688,
-687,
-687,
-687,
-687,
-687,
-687,
-687,
-687,
-687,
-687,
-687,
-687,
-687,
-687,
-687,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-686,
-685,
-685,
-685,
-685,
-685,
-685,
-685,
-685,
-685,
-685,
-685,
-685,
-685,
-685,
-685,
-684,
-684,
-684,
-684,
-684,
-684,
-684,
-684,
-684,
-684,
-684,
-684,
-684,
-684,
-684,
-683,
-683,
-683,
-683,
-683,
-683,
-683,
-683,
-683,
-683,
-683,
-683,
-683,
-683,
-683,
-682,
-682,
-682,
-682,
-682,
-682,
-682,
-682,
-682,
-682,
-682,
-682,
-682,
-682,
-682,
-681,
-681,
-681,
-681,
-681,
-681,
-681,
-681,
-681,
-681,
-681,
-681,
-681,
-681,
-681,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-680,
-679,
-679,
-679,
-679,
-679,
-679,
-679,
-679,
-679,
-679,
-679,
-679,
-679,
-679,
-679,
-678,
-678,
-678,
-678,
-678,
-678,
-678,
-678,
-678,
-678,
-678,
-678,
-678,
-678,
-678,
-677,
-677,
-677,
-677,
-677,
-677,
-677,
-677,
-677,
-677,
-677,
-677,
-677,
-677,
-677,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-676,
-675,
-675,
-675,
-675,
-675,
-675,
-675,
-675,
-675,
-675,
-675,
-675,
-675,
-675,
-675,
-674,
-674,
-674,
-674,
-674,
-674,
-674,
-674,
-674,
-674,
-674,
-674,
-674,
-674,
-674,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-673,
-672,
-672,
-672,
-672,
-672,
-672,
-672,
-672,
-672,
-672,
-672,
-672,
-672,
-672,
-672,
-671,
-671,
-671,
-671,
-671,
-671,
-671,
-671,
-671,
-671,
-671,
-671,
-671,
-671,
-671,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-670,
-669,
-669,
-669,
-669,
-669,
-669,
-669,
-669,
-669,
-669,
-669,
-669,
-669,
-669,
-669,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-668,
-667,
-667,
-667,
-667,
-667,
-667,
-667,
-667,
-667,
-667,
-667,
-667,
-667,
-667,
-667,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-666,
-665,
-665,
-665,
-665,
-665,
-665,
-665,
-665,
-665,
-665,
-665,
-665,
-665,
-665,
-665,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-664,
-663,
-663,
-663,
-663,
-663,
-663,
-663,
-663,
-663,
-663,
-663,
-663,
-663,
-663,
-663,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-662,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-661,
-660,
-660,
-660,
-660,
-660,
-660,
-660,
-660,
-660,
-660,
-660,
-660,
-660,
-660,
-660,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-659,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-658,
-657,
-657,
-657,
-657,
-657,
-657,
-657,
-657,
-657,
-657,
-657,
-657,
-657,
-657,
-657,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-656,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-655,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-654,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-653,
-652,
-652,
-652,
-652,
-652,
-652,
-652,
-652,
-652,
-652,
-652,
-652,
-652,
-652,
-652,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-651,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-650,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-649,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-648,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-647,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-646,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-645,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-644,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-643,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-642,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-641,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-640,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-639,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-638,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-637,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-636,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-635,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-634,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-633,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-632,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-631,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-630,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-629,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-628,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-627,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-626,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-625,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-624,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-623,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-622,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-621,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-620,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-619,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-618,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-617,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-616,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-615,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-614,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-613,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-612,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-611,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-610,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-609,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-608,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-607,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-606,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-605,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-604,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-603,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-602,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-601,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-600,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-599,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-598,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-597,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-596,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-595,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-594,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-593,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-592,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-591,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-590,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-589,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-588,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-587,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-586,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-585,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-584,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-583,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-582,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-581,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-580,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-579,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-578,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-577,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-576,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-575,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-574,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-573,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-572,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-571,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-570,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-569,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-568,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-567,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-566,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-565,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-564,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-563,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-562,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-561,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-560,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-559,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-558,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-557,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-556,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-555,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-554,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-553,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-552,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-551,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-550,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-549,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-548,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-547,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-546,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-545,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-544,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-543,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-542,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-541,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-540,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-539,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-538,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-537,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-536,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-535,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-534,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-533,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-532,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-531,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-530,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-529,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-528,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-527,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-526,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-525,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-524,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-523,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-522,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-521,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-520,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-519,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-518,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-517,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-516,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-515,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-514,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-513,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-512,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-511,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-510,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-509,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-508,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-507,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-506,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-505,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-504,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-503,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-502,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-501,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-500,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-499,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-498,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-497,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-496,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-495,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-494,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-493,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-492,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-491,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-490,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-489,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-488,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-487,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-486,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-485,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-484,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-483,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-482,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-481,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-480,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-479,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-478,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-477,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-476,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-475,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-474,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-473,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-472,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-471,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-470,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-469,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-468,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-467,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-466,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-465,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-464,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-463,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-462,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-461,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-460,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-459,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-458,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-457,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-456,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-455,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-454,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-453,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-452,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-451,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-450,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-449,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-448,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-447,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-446,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-445,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-444,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-443,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-442,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-441,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-440,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-439,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-438,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-437,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-436,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-435,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-434,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-433,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-432,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-431,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-430,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-429,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-428,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-427,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-426,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-425,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-424,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-423,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-422,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-421,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-420,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-419,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-418,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-417,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-416,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-415,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-414,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-413,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-412,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-411,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-410,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-409,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-408,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-407,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-406,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-405,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-404,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-403,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-402,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-401,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-400,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-399,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-398,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-397,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-396,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-395,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-394,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-393,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-392,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-391,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-390,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-389,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-388,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-387,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-386,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-385,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-384,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-383,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-382,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-381,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-380,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-379,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-378,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-377,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-376,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-375,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-374,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-373,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-372,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-371,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-370,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-369,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-368,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-367,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-366,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-365,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-364,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-363,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-362,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-361,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-360,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-359,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-358,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-357,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-356,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-355,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-354,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-353,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-352,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-351,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-350,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-349,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-348,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-347,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-346,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-345,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-344,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-343,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-342,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-341,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-340,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-339,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-338,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-337,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-336,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-335,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-334,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-333,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-332,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-331,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-330,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-329,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-328,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-327,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-326,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-325,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-324,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-323,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-322,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-321,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-320,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-319,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-318,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-317,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-316,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-315,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-314,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-313,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-312,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-311,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-310,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-309,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-308,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-307,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-306,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-305,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-304,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-303,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-302,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-301,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-300,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-299,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-298,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-297,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-296,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-295,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-294,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-293,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-292,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-291,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-290,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-289,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-288,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-287,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-286,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-285,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-284,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-283,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-282,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-281,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-280,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-279,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-278,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-277,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-276,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-275,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-274,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-273,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-272,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-271,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-270,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-269,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-268,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-267,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-266,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-265,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-264,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-263,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-262,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-261,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-260,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-259,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-258,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-257,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-256,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-255,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-254,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-253,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-252,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-251,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-250,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-249,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-248,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-247,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-246,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-245,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-244,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-243,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-242,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-241,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-240,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-239,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-238,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-237,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-236,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-235,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-234,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-233,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-232,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-231,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-230,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-229,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-228,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-227,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-226,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-225,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-224,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-223,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-222,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-221,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-220,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-219,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-218,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-217,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-216,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-215,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-214,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-213,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-212,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-211,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-210,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-209,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-208,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-207,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-206,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-205,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-204,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-203,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-202,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-201,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-200,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-199,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-198,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-197,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-196,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-195,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-194,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-193,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-192,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-191,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-190,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-189,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-188,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-187,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-186,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-185,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-184,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-183,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-182,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-181,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-180,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-179,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-178,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-177,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-176,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-175,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-174,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-173,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-172,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-171,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-170,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-169,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-168,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-167,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-166,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-165,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-164,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-163,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-162,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-161,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-160,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-159,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-158,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-157,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-156,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-155,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-154,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-153,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-152,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-151,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-150,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-149,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-148,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-147,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-146,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-145,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-144,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-143,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-142,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-141,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-140,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-139,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-138,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-137,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-136,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-135,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-134,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-133,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-132,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-131,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-130,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-129,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-128,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-127,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-126,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-125,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-124,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-123,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-122,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-121,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-120,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-119,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-118,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-117,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-116,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-115,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-114,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-113,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-112,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-111,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-110,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-109,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-108,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-107,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-106,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-105,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-104,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-103,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-102,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-101,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-100,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-99,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-98,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-97,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-96,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-95,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-94,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-93,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-92,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-91,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-90,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-89,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-88,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-87,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-86,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-85,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-84,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-83,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-82,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-81,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-80,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-79,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-78,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-77,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-76,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-75,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-74,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-73,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-72,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-71,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-70,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-69,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-68,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-67,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-66,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-65,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-64,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-63,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-62,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-61,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-60,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-59,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-58,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-57,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-56,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-55,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-54,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-53,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-52,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-51,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-50,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-49,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-48,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-47,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-46,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-45,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-44,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-43,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-42,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-41,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-40,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-39,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-38,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-37,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-36,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-35,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-34,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-33,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-32,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-31,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-30,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-29,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-28,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-27,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-26,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-25,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-24,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-23,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-22,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-21,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-20,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-19,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-18,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-17,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-16,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-15,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-14,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-13,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-12,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-11,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-10,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-9,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-8,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-7,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-6,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-5,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-4,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-3,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-2,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-1,
-0, };
-int32 Table_Size = 99042;
+    /* The first entry is never 0, so it shows if this was done already */
+    if (Addition_Table[0] != 0)
+	return;
+    for (i = 0; i < n; i++) {
+	d = (i << ADD_TABLE_SHIFT) + (1 << ADD_TABLE_SHIFT) / 2;
+	Addition_Table[i] = (int16) (log (1.0 + pow (BASE, -d)) / log (BASE) + 0.5);
+    }
+}
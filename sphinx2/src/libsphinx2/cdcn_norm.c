@@ -69,9 +69,17 @@ actual_cdcn_norm(float **variance, /* Speech cepstral variances of modes */
 		k;              /* Index codewords in codebook */
 
 	float *x;
+	float xk_buf[NUM_COEFF], x_buf[NUM_COEFF];
 
-	xk = (float *) ckd_calloc(Ndim, sizeof(float));
-	x = (float *) ckd_calloc(Ndim, sizeof(float));
+	/* This runs on every frame, so avoid the heap when we can. */
+	if (Ndim <= NUM_COEFF) {
+		xk = xk_buf;
+		x = x_buf;
+	}
+	else {
+		xk = (float *) ckd_calloc(Ndim, sizeof(float));
+		x = (float *) ckd_calloc(Ndim, sizeof(float));
+	}
 
 	/* Initialize cleaned vector x */
 	for (j = 0; j < Ndim; j++)
@@ -108,8 +116,10 @@ actual_cdcn_norm(float **variance, /* Speech cepstral variances of modes */
 	 * z[] itself carries the cleaned speech now
 	 */
 
-	ckd_free(x);
-	ckd_free(xk);
+	if (x != x_buf) {
+		ckd_free(x);
+		ckd_free(xk);
+	}
 }
 
 /************************************************************************
@@ -41,16 +41,47 @@
  *     Distance scaled by variance, as required by the mahalanobis         *
  *     metric                                                              *
  *                                                                         *
+ *  The terms are summed four at a time with SSE2 or NEON, which           *
+ *  changes the result only by rounding.                                   *
+ *                                                                         *
  ***************************************************************************/
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define CDCN_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define CDCN_NEON
+#include <arm_neon.h>
+#endif
+
 float dist(float *x, float *y, float *variance, int Ndim)
 {
-	register int j;
+	register int j = 0;
 	register float distance, difference;
+#if defined(CDCN_SSE2)
+	__m128 acc = _mm_setzero_ps();
+	float part[4];
 
-	difference = x[0] - y[0];
-	distance = difference * difference / variance[0];
-	for (j = 1; j < Ndim; j++) {
+	for (; j + 4 <= Ndim; j += 4) {
+		__m128 d = _mm_sub_ps(_mm_loadu_ps(x + j), _mm_loadu_ps(y + j));
+		acc = _mm_add_ps(acc, _mm_div_ps(_mm_mul_ps(d, d),
+						 _mm_loadu_ps(variance + j)));
+	}
+	_mm_storeu_ps(part, acc);
+	distance = (part[0] + part[1]) + (part[2] + part[3]);
+#elif defined(CDCN_NEON)
+	float32x4_t acc = vdupq_n_f32(0);
+
+	for (; j + 4 <= Ndim; j += 4) {
+		float32x4_t d = vsubq_f32(vld1q_f32(x + j), vld1q_f32(y + j));
+		acc = vaddq_f32(acc, vdivq_f32(vmulq_f32(d, d),
+					       vld1q_f32(variance + j)));
+	}
+	distance = vaddvq_f32(acc);
+#else
+	distance = 0;
+#endif
+	for (; j < Ndim; j++) {
 		difference = x[j] - y[j];
 		distance += difference * difference / variance[j];
 	}
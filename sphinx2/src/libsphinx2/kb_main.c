@@ -520,6 +520,7 @@ void kb (int argc, char *argv[],
     /* FIXME: This is evil.  But if we do it, let's prototype it
        somewhere, OK? */
     unlimit ();		/* Remove memory size limits */
+    add_table_init ();
     
     language_weight = lw;
     insertion_penalty = ip;
@@ -1720,6 +1720,7 @@ static void lm_set_param (lm_t *model, double lw, double uw,
     int16 *at = Addition_Table;
     int32 ts = Table_Size;
 
+    add_table_init ();
     model->lw = lw;
     model->invlw = 1.0/lw;
     model->uw = uw;
@@ -94,6 +94,18 @@
 #include "log_add.h"
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define SCVQ_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define SCVQ_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#if defined(SCVQ_SIMD_SSE2) || defined(SCVQ_SIMD_NEON)
+#define SCVQ_SIMD
+#endif
+
 
 #define RPCC(x) asm ("rpcc %t0;" "stq %t0,(%0)",&x)
 
@@ -119,6 +131,30 @@ static vqFeature_t ldfrm[MAX_TOPN];
 static vqFeature_t lxfrm[MAX_TOPN];
 static vqFeature_t vtmp;
 
+#ifdef SCVQ_SIMD
+/*
+ * Codebooks with dimensions 1 and up (in the order cepDist0() and
+ * friends use them) transposed to [dimension][codeword], so that
+ * distances to four codewords can be computed at once.
+ */
+static float *meansT[NUM_FEATURES];
+static float *varsT[NUM_FEATURES];
+
+/*
+ * The vector distances only pick out the codewords that may belong in
+ * the top N, whose distances are then computed again by the scalar
+ * code.  The slack allows for the compiler fusing the scalar
+ * multiplies and adds where the vector code does not.
+ */
+#define VQ_SLACK	1.0
+#endif
+
+static const double unitWeight[CEP_VECLEN-1] = {
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+};
+
+typedef void (*vqInsert_t)(vqFeature_t *topn, float *z, float *z2, int32 cw);
+
 #ifdef WIN32
 static HANDLE pid;
 static FILETIME t_create, t_exit, kst, ket, ust, uet;
@@ -127,21 +163,197 @@ static double scr_time;
 extern double win32_cputime();
 #endif
 
+#ifdef SCVQ_SIMD_SSE2
+/*
+ * Distances from obs to codewords cw..cw+3, with mean and var pointing
+ * to codeword cw of the transposed codebook.  The arithmetic is the
+ * same as the scalar code: single precision differences, accumulated
+ * in double precision.
+ */
+static void vqDist4(double *dist, float const *obs, double const *wt,
+		    float const *mean, float const *var, int32 const *det,
+		    int32 n)
+{
+    __m128d d0, d1;
+    int32 k;
+
+    d0 = _mm_cvtepi32_pd(_mm_loadl_epi64((__m128i const *)det));
+    d1 = _mm_cvtepi32_pd(_mm_loadl_epi64((__m128i const *)(det + 2)));
+    for (k = 0; k < n; k++, mean += NUM_ALPHABET, var += NUM_ALPHABET) {
+	__m128 diff = _mm_sub_ps(_mm_set1_ps(obs[k]), _mm_loadu_ps(mean));
+	__m128 v = _mm_loadu_ps(var);
+	__m128d w = _mm_set1_pd(wt[k]);
+	__m128d x0 = _mm_mul_pd(_mm_cvtps_pd(diff), w);
+	__m128d x1 = _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(diff, diff)), w);
+
+	d0 = _mm_sub_pd(d0, _mm_mul_pd(_mm_mul_pd(x0, x0), _mm_cvtps_pd(v)));
+	d1 = _mm_sub_pd(d1, _mm_mul_pd(_mm_mul_pd(x1, x1),
+				       _mm_cvtps_pd(_mm_movehl_ps(v, v))));
+    }
+    _mm_storeu_pd(dist, d0);
+    _mm_storeu_pd(dist + 2, d1);
+}
+
+/* Index of the first of the largest of NUM_ALPHABET distances. */
+static int32 vqArgmax(float const *dist)
+{
+    __m128 m, best;
+    int32 i, mask;
+
+    m = _mm_loadu_ps(dist);
+    for (i = 4; i < NUM_ALPHABET; i += 4)
+	m = _mm_max_ps(m, _mm_loadu_ps(dist + i));
+    m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+    best = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+    for (i = 0; i < NUM_ALPHABET; i += 4) {
+	mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(dist + i), best));
+	if (mask)
+	    break;
+    }
+    while (!(mask & 1)) {
+	mask >>= 1;
+	i++;
+    }
+    return i;
+}
+#endif /* SCVQ_SIMD_SSE2 */
+
+#ifdef SCVQ_SIMD_NEON
+static void vqDist4(double *dist, float const *obs, double const *wt,
+		    float const *mean, float const *var, int32 const *det,
+		    int32 n)
+{
+    float64x2_t d0, d1;
+    int32 k;
+
+    d0 = vcvtq_f64_s64(vmovl_s32(vld1_s32(det)));
+    d1 = vcvtq_f64_s64(vmovl_s32(vld1_s32(det + 2)));
+    for (k = 0; k < n; k++, mean += NUM_ALPHABET, var += NUM_ALPHABET) {
+	float32x4_t diff = vsubq_f32(vdupq_n_f32(obs[k]), vld1q_f32(mean));
+	float32x4_t v = vld1q_f32(var);
+	float64x2_t w = vdupq_n_f64(wt[k]);
+	float64x2_t x0 = vmulq_f64(vcvt_f64_f32(vget_low_f32(diff)), w);
+	float64x2_t x1 = vmulq_f64(vcvt_high_f64_f32(diff), w);
+
+	d0 = vsubq_f64(d0, vmulq_f64(vmulq_f64(x0, x0),
+				     vcvt_f64_f32(vget_low_f32(v))));
+	d1 = vsubq_f64(d1, vmulq_f64(vmulq_f64(x1, x1), vcvt_high_f64_f32(v)));
+    }
+    vst1q_f64(dist, d0);
+    vst1q_f64(dist + 2, d1);
+}
+
+static int32 vqArgmax(float const *dist)
+{
+    float32x4_t m;
+    float best;
+    int32 i;
+
+    m = vld1q_f32(dist);
+    for (i = 4; i < NUM_ALPHABET; i += 4)
+	m = vmaxq_f32(m, vld1q_f32(dist + i));
+    best = vmaxvq_f32(m);
+    for (i = 0; i < NUM_ALPHABET; i += 4) {
+	if (vmaxvq_u32(vceqq_f32(vld1q_f32(dist + i), vdupq_n_f32(best))))
+	    break;
+    }
+    while (dist[i] != best)
+	i++;
+    return i;
+}
+#endif /* SCVQ_SIMD_NEON */
+
+#ifndef SCVQ_SIMD
+static int32 vqArgmax(float const *dist)
+{
+    float const *dP, *dE = dist + NUM_ALPHABET;
+    float nextBest;
+    int32 cw;
+
+    dP = dist;
+    nextBest = *dP++; cw = 0;
+    for (; dP < dE; dP++) {
+	if (*dP NEARER nextBest) {
+	    nextBest = *dP;
+	    cw = dP - dist;	/* use address arith to compute cw */
+	}
+    }
+    return cw;
+}
+#endif
+
+/*
+ * Offer every codeword of a feature's codebook to insert(), which
+ * does the exact distance computation and top N insertion.  With
+ * vector code, only the codewords that can get into the top N are
+ * offered.
+ */
+static void vqScan(vqFeature_t *topn, int32 feat, float const *obs,
+		   double const *wt, int32 n, vqInsert_t insert,
+		   float *z, float *z2)
+{
+    int32 cw;
+#ifdef SCVQ_SIMD
+    vqFeature_t *worst = topn + (topN-1);
+    int32 *det = dets[feat];
+    double dist[4];
+    int32 i;
+
+    for (cw = 0; cw < NUM_ALPHABET; cw += 4) {
+	vqDist4(dist, obs, wt, meansT[feat] + cw, varsT[feat] + cw,
+		det + cw, n);
+	for (i = 0; i < 4; i++) {
+	    if (dist[i] + VQ_SLACK >= worst->val.dist)
+		insert(topn, z, z2, cw + i);
+	}
+    }
+#else
+    for (cw = 0; cw < NUM_ALPHABET; cw++)
+	insert(topn, z, z2, cw);
+#endif
+}
+
+static void cepInsert(vqFeature_t *topn, float *z, float *z2, int32 cw)
+{
+    register int32	i, j;
+    vqFeature_t		*worst = topn + (topN-1), *best = topn, *cur;
+    double		diff, d;
+    float		*obs  =  z+1;
+    float		*mean =  means[(int32)CEP_FEAT] + cw*CEP_VECLEN + 1;
+    float		*var  =  vars[(int32)CEP_FEAT] + cw*CEP_VECLEN + 1;
+
+    d = dets[(int32)CEP_FEAT][cw];
+    for (j = 1; (j < CEP_VECLEN) && (d >= worst->val.dist); j++) {
+	diff = *obs++ - *mean++;
+	d -= diff * diff * (*var++);
+    }
+    if (j < CEP_VECLEN)
+	return;		/* terminated early, so not in topn */
+    if (d < worst->val.dist) return;
+    for (i = 0; i < topN; i++) {
+	/* already there, so don't need to insert */
+	if (topn[i].codeword == cw) return;
+    }
+    /* remaining code inserts codeword and dist in correct spot */
+    for (cur = worst-1; cur >= best && d >= cur->val.dist; --cur)
+	memcpy (cur+1, cur, sizeof(vqFeature_t));
+    ++cur;
+    cur->codeword = cw;
+    cur->val.dist = (int32)d;
+}
+
 static void cepDist0(vqFeature_t *topn, float *z)
 {
     register int32	i, j, cw;
-    vqFeature_t		*worst, *best = topn, *cur; /*, *src; */
     double		diff, d;
     float		*obs;
     float		*mean;
-    float		*var  =  vars[(int32)CEP_FEAT];
-    int32			*det  =  dets[(int32)CEP_FEAT], *detP;
-    int32			*detE = det + NUM_ALPHABET;
+    float		*var;
+    int32			*det  =  dets[(int32)CEP_FEAT];
 
     assert(z    != NULL);
     assert(topn != NULL);
     memcpy (topn, lcfrm, sizeof(vqFeature_t)*topN);
-    worst = topn + (topN-1);
     /* initialize topn codewords to topn codewords from previous frame */
     for (i = 0; i < topN; i++) {
 	cw = topn[i].codeword;
@@ -161,34 +373,8 @@ static void cepDist0(vqFeature_t *topn, float *z)
 	}
 	topn[j+1] = vtmp;
     }
-    mean = means[(int32)CEP_FEAT];
-    var = vars[(int32)CEP_FEAT];
-    for (detP = det, ++mean, ++var; detP < detE; detP++, ++mean, ++var) {
-	d = *detP; obs = z+1;
-	for (j = 1; (j < CEP_VECLEN) && (d >= worst->val.dist); j++) {
-	    diff = *obs++ - *mean++;
-	    d -= diff * diff * (*var++);
-	}
-	if (j < CEP_VECLEN) {
-	    /* terminated early, so not in topn */
-	    mean += (CEP_VECLEN - j);
-	    var  += (CEP_VECLEN - j);
-	    continue;
-	}
-	if (d < worst->val.dist) continue;
-	cw = detP - det;
-	for (i = 0; i < topN; i++) {
-	    /* already there, so don't need to insert */
-	    if (topn[i].codeword == cw) break;
-	}
-	if (i < topN) continue;	/* already there.  Don't insert */
-	/* remaining code inserts codeword and dist in correct spot */
-	for (cur = worst-1; cur >= best && d >= cur->val.dist; --cur)
-	    memcpy (cur+1, cur, sizeof(vqFeature_t));
-	++cur;
-	cur->codeword = cw;
-	cur->val.dist = (int32)d;
-    }
+    vqScan(topn, (int32)CEP_FEAT, z+1, unitWeight, CEP_VECLEN-1,
+	   cepInsert, z, NULL);
 
     memcpy(lcfrm, topn, sizeof(vqFeature_t)*topN);
 }
@@ -332,23 +518,56 @@ static void cepDist3(vqFeature_t *topn, float *z)
 }
 #endif
 
+static void dcepInsert(vqFeature_t *topn, float *dzs, float *dzl, int32 cw)
+{
+    register int32	i, j;
+    vqFeature_t		*worst = topn + (topN-1), *best = topn, *cur;
+    double		diff, d;
+    float		*obs1 = dzs+1, *obs2 = dzl+1;
+    float		*mean = means[(int32)DCEP_FEAT] + cw*DCEP_VECLEN + 1;
+    float		*var  =  vars[(int32)DCEP_FEAT] + cw*DCEP_VECLEN + 1;
+
+    d = dets[(int32)DCEP_FEAT][cw];
+    for (j = 1;
+	 (j < CEP_VECLEN) && (d NEARER worst->val.dist);
+	 j++, obs1++, obs2++, mean++, var++) {
+	diff = *obs1 - *mean;
+	d -= diff * diff * *var;
+	diff = (*obs2 - mean[CEP_VECLEN-1]) * dcep80msWeight;
+	d -= diff * diff * var[CEP_VECLEN-1];
+    }
+    if (j < CEP_VECLEN)
+	return;
+    if (d < worst->val.dist) return;
+    for (i = 0; i < topN; i++) {
+	/* already there, so don't need to insert */
+	if (topn[i].codeword == cw) return;
+    }
+    /* remaining code inserts codeword and dist in correct spot */
+    for (cur = worst-1; cur >= best && (int32)d >= cur->val.dist; --cur)
+	memcpy(cur+1, cur, sizeof(vqFeature_t));
+    ++cur;
+    cur->codeword = cw;
+    cur->val.dist = (int32)d;
+}
+
 static void dcepDist0(vqFeature_t *topn, float *dzs, float *dzl)
 {
     register int32	i, j, cw;
-    vqFeature_t		*worst, *best = topn, *cur; /* , *src; */
     double		diff, d;
     float		*obs1, *obs2;
     float		*mean;
     float		*var;
-    int32			*det  =  dets[(int32)DCEP_FEAT], *detP;
-    int32			*detE = det + NUM_ALPHABET; /*, tmp; */
+    int32			*det  =  dets[(int32)DCEP_FEAT];
+    /* short and long differences interleaved, as in meansT */
+    float		obs[DCEP_VECLEN-1];
+    double		wt[DCEP_VECLEN-1];
 
     assert(dzs != NULL);
     assert(dzl != NULL);
     assert(topn != NULL);
 
     memcpy (topn, ldfrm, sizeof(vqFeature_t)*topN);
-    worst = topn + (topN-1);
     /* initialize topn codewords to topn codewords from previous frame */
     for (i = 0; i < topN; i++) {
 	cw = topn[i].codeword;
@@ -371,62 +590,59 @@ static void dcepDist0(vqFeature_t *topn, float *dzs, float *dzl)
 	}
 	topn[j+1] = vtmp;
     }
-    mean = means[(int32)DCEP_FEAT];
-    var = vars[(int32)DCEP_FEAT];
-    /* one distance value for each codeword */
-    for (detP = det; detP < detE; detP++) {
-	d = *detP;
-	obs1 = dzs+1;		/* reset observed */
-	obs2 = dzl+1;		/* reset observed */
-	for (j = 1, ++mean, ++var;
-	     (j < CEP_VECLEN) && (d NEARER worst->val.dist);
-	     j++, obs1++, obs2++, mean++, var++) {
-	    diff = *obs1 - *mean;
-	    d -= diff * diff * *var;
- 	    diff = (*obs2 - mean[CEP_VECLEN-1]) * dcep80msWeight;
-	    d -= diff * diff * var[CEP_VECLEN-1];
-	}
-	mean += CEP_VECLEN-1;
-	var += CEP_VECLEN-1;
-	if (j < CEP_VECLEN) {
-	    mean += (CEP_VECLEN-j);	
-	    var  += (CEP_VECLEN-j);
-	    continue;
-	}
-	if (d < worst->val.dist) continue;
-	cw = detP - det;
-	for (i = 0; i < topN; i++) {
-	    /* already there, so don't need to insert */
-	    if (topn[i].codeword == cw) break;
-	}
-	if (i < topN) continue;	/* already there.  Don't insert */
-	/* remaining code inserts codeword and dist in correct spot */
-	for (cur = worst-1; cur >= best && (int32)d >= cur->val.dist; --cur)
-	    memcpy(cur+1, cur, sizeof(vqFeature_t));
-	++cur;
-	cur->codeword = cw;
-	cur->val.dist = (int32)d;
+    for (j = 1; j < CEP_VECLEN; j++) {
+	obs[2*j-2] = dzs[j];
+	wt[2*j-2] = 1.0;
+	obs[2*j-1] = dzl[j];
+	wt[2*j-1] = dcep80msWeight;
     }
+    vqScan(topn, (int32)DCEP_FEAT, obs, wt, DCEP_VECLEN-1,
+	   dcepInsert, dzs, dzl);
 
     memcpy (ldfrm, topn, sizeof(vqFeature_t)*topN);
 }
 
+static void ddcepInsert(vqFeature_t *topn, float *z, float *z2, int32 cw)
+{
+    register int32	i, j;
+    vqFeature_t		*worst = topn + (topN-1), *best = topn, *cur;
+    double		diff, d;
+    float		*obs  =  z+1;
+    float		*mean =  means[(int32)DDCEP_FEAT] + cw*CEP_VECLEN + 1;
+    float		*var  =  vars[(int32)DDCEP_FEAT] + cw*CEP_VECLEN + 1;
+
+    d = dets[(int32)DDCEP_FEAT][cw];
+    for (j = 1; (j < CEP_VECLEN) && (d >= worst->val.dist); j++) {
+	diff = *obs++ - *mean++;
+	d -= diff * diff * (*var++);
+    }
+    if (j < CEP_VECLEN)
+	return;		/* terminated early, so not in topn */
+    if (d < worst->val.dist) return;
+    for (i = 0; i < topN; i++) {
+	/* already there, so don't need to insert */
+	if (topn[i].codeword == cw) return;
+    }
+    /* remaining code inserts codeword and dist in correct spot */
+    for (cur = worst-1; cur >= best && (int32)d >= cur->val.dist; --cur)
+	memcpy(cur+1, cur, sizeof(vqFeature_t));
+    ++cur;
+    cur->codeword = cw;
+    cur->val.dist = (int32)d;
+}
+
 static void ddcepDist0(vqFeature_t *topn, float *z)
 {
     register int32 i, j, cw;
-    vqFeature_t		*worst, *best = topn, *cur; /*, *src; */
     double	diff, d;
     float	*obs;
     float	*mean;
     float	*var;
     int32		*det  =  dets[(int32)DDCEP_FEAT];
-    int32		*detE = det + NUM_ALPHABET;
-    int32		*detP; /*, tmp; */
 
     assert(z    != NULL);
     assert(topn != NULL);
     memcpy (topn, lxfrm, sizeof(vqFeature_t)*topN);
-    worst = topn + (topN-1);
     /* initialize topn codewords to topn codewords from previous frame */
     for (i = 0; i < topN; i++) {
 	cw = topn[i].codeword;
@@ -446,34 +662,8 @@ static void ddcepDist0(vqFeature_t *topn, float *z)
 	}
 	topn[j+1] = vtmp;
     }
-    mean = means[(int32)DDCEP_FEAT];
-    var = vars[(int32)DDCEP_FEAT];
-    for (detP = det, ++mean, ++var; detP < detE; detP++, ++mean, ++var) {
-	d = *detP; obs = z+1;
-	for (j = 1; (j < CEP_VECLEN) && (d >= worst->val.dist); j++) {
-	    diff = *obs++ - *mean++;
-	    d -= diff * diff * (*var++);
-	}
-	if (j < CEP_VECLEN) {
-	    /* terminated early, so not in topn */
-	    mean += (CEP_VECLEN - j);
-	    var  += (CEP_VECLEN - j);
-	    continue;
-	}
-	if (d < worst->val.dist) continue;
-	cw = detP - det;
-	for (i = 0; i < topN; i++) {
-	    /* already there, so don't need to insert */
-	    if (topn[i].codeword == cw) break;
-	}
-	if (i < topN) continue;	/* already there.  Don't insert */
-	/* remaining code inserts codeword and dist in correct spot */
-	for (cur = worst-1; cur >= best && (int32)d >= cur->val.dist; --cur)
-	    memcpy(cur+1, cur, sizeof(vqFeature_t));
-	++cur;
-	cur->codeword = cw;
-	cur->val.dist = (int32)d;
-    }
+    vqScan(topn, (int32)DDCEP_FEAT, z+1, unitWeight, CEP_VECLEN-1,
+	   ddcepInsert, z, NULL);
 
     memcpy(lxfrm, topn, sizeof(vqFeature_t)*topN);
 }
@@ -481,7 +671,6 @@ static void ddcepDist0(vqFeature_t *topn, float *z)
 static void powDist(vqFeature_t *topn, float *pz)
 {
   register int32	i, j, cw;
-  float		nextBest;
   float		dist[NUM_ALPHABET];
   double	diff, d;
   float		*dP, *dE = dist + NUM_ALPHABET;
@@ -503,16 +692,9 @@ static void powDist(vqFeature_t *topn, float *pz)
   }
   /* compute top N codewords */
   for (i = 0; i < topN; i++) {
-    dP = dist;
-    nextBest = *dP++; cw = 0;
-    for (; dP < dE; dP++) {
-      if (*dP NEARER nextBest) {
-	nextBest = *dP;
-	cw = dP - dist;	/* use address arith to compute cw */
-      }
-    }
+    cw = vqArgmax(dist);
     topn[i].codeword = cw;
-    topn[i].val.dist = (int32)nextBest;
+    topn[i].val.dist = (int32)dist[cw];
 
     dist[cw] = WORST_DIST;
   }
@@ -1148,208 +1330,90 @@ static void get_scores4_8b_all (int32 *scores, vqFeature_t frm[][MAX_TOPN])
 
 #else
 
+/*
+ * Pointers to the 8-bit senone prob ids of the top 4 codewords of each
+ * codebook, and their quantized weights.
+ */
+static void get_top4_8b (unsigned char *pid[][4], int32 w[][4],
+			 vqFeature_t frm[][MAX_TOPN])
+{
+    int32 i, j;
+
+    for (j = 0; j < NUM_FEATURES; j++) {
+	for (i = 0; i < 4; i++) {
+	    pid[j][i] = OPDF_8B[j]->id[frm[j][i].codeword];
+	    w[j][i] = frm[j][i].val.score;
+
+	    /* Floor so that when added to senone prob, will not exceed 255<<10 */
+	    if (w[j][i] < -99000) w[j][i] = -99000;
+	    /* Quantize */
+	    w[j][i] = (511-w[j][i]) >> 10;
+	}
+    }
+}
+
 /*
  * Like get_scores4, but uses OPDF_8B:
  *     LogProb(feature f, codeword c, senone s) =
  *         OPDF_8B[f]->prob[c][OPDF_8B[f]->id[c][s]]
  * Also, uses true 8-bit probs, so addition in logspace is an easy lookup.
+ * All codebooks are done in one pass over the senones, reading the
+ * packed ids of their top codewords side by side.
  */
 static void get_scores4_8b(int32 *scores, vqFeature_t frm[][MAX_TOPN])
 {
-    register int32 i, j, k, n;
-    int32 tmp1, tmp2;
-    unsigned char *pid_cw0, *pid_cw1, *pid_cw2, *pid_cw3;
-    int32 *scr;
-    int32 w0, w1, w2, w3;			/* weights */
-    /* register int32   ts = Table_Size;
-       register int16 *at = Addition_Table;
-       int32 ff, tt, ii; */
-
-    /* ptrs to senone prob ids */
-    pid_cw0 = OPDF_8B[0]->id[frm[0][0].codeword];
-    pid_cw1 = OPDF_8B[0]->id[frm[0][1].codeword];
-    pid_cw2 = OPDF_8B[0]->id[frm[0][2].codeword];
-    pid_cw3 = OPDF_8B[0]->id[frm[0][3].codeword];
+    register int32 i, j, k;
+    int32 tmp1, tmp2, sum;
+    unsigned char *pid[NUM_FEATURES][4];
+    int32 w[NUM_FEATURES][4];			/* weights */
 
-    w0 = frm[0][0].val.score;
-    w1 = frm[0][1].val.score;
-    w2 = frm[0][2].val.score;
-    w3 = frm[0][3].val.score;
-
-    /* Floor w0..w3 so that when added to senone prob, will not exceed 255<<10 */
-    if (w3 < -99000) w3 = -99000;
-    if (w2 < -99000) w2 = -99000;
-    if (w1 < -99000) w1 = -99000;
-    if (w0 < -99000) w0 = -99000;	/* Condition should never be TRUE */
+    get_top4_8b (pid, w, frm);
 
-    /* Quantize */
-    w3 = (511-w3) >> 10;
-    w2 = (511-w2) >> 10;
-    w1 = (511-w1) >> 10;
-    w0 = (511-w0) >> 10;
-    
-    scr = scores;
-    
     for (i = 0; i < n_senone_active; i++) {
 	k = senone_active[i];
 
-	tmp1 = pid_cw0[k] + w0;
-	tmp2 = pid_cw1[k] + w1;
-	tmp1 = LOG_ADD(tmp1, tmp2);
-	tmp2 = pid_cw2[k] + w2;
-	tmp1 = LOG_ADD(tmp1, tmp2);
-	tmp2 = pid_cw3[k] + w3;
-	tmp1 = LOG_ADD(tmp1, tmp2);
-	
-	scr[k] = -(tmp1 << 10);
-    }
-    
-    for (j = 1; j < NUM_FEATURES; j++) {
-	/* ptrs to senone prob ids */
-	pid_cw0 = OPDF_8B[j]->id[frm[j][0].codeword];
-	pid_cw1 = OPDF_8B[j]->id[frm[j][1].codeword];
-	pid_cw2 = OPDF_8B[j]->id[frm[j][2].codeword];
-	pid_cw3 = OPDF_8B[j]->id[frm[j][3].codeword];
-
-	w0 = frm[j][0].val.score;
-	w1 = frm[j][1].val.score;
-	w2 = frm[j][2].val.score;
-	w3 = frm[j][3].val.score;
-
-	/* Floor w0..w3 to 256<<10 - 162k */
-	if (w3 < -99000) w3 = -99000;
-	if (w2 < -99000) w2 = -99000;
-	if (w1 < -99000) w1 = -99000;
-	if (w0 < -99000) w0 = -99000;	/* Condition should never be TRUE */
-
-	/* Quantize */
-	w3 = (511-w3) >> 10;
-	w2 = (511-w2) >> 10;
-	w1 = (511-w1) >> 10;
-	w0 = (511-w0) >> 10;
-
-        scr = scores;
-	for (k = 0; k < n_senone_active; k++) {
-	    n = senone_active[k];
-
-	    tmp1 = pid_cw0[n] + w0;
-	    tmp2 = pid_cw1[n] + w1;
+	sum = 0;
+	for (j = 0; j < NUM_FEATURES; j++) {
+	    tmp1 = pid[j][0][k] + w[j][0];
+	    tmp2 = pid[j][1][k] + w[j][1];
 	    tmp1 = LOG_ADD(tmp1, tmp2);
-	    tmp2 = pid_cw2[n] + w2;
+	    tmp2 = pid[j][2][k] + w[j][2];
 	    tmp1 = LOG_ADD(tmp1, tmp2);
-	    tmp2 = pid_cw3[n] + w3;
+	    tmp2 = pid[j][3][k] + w[j][3];
 	    tmp1 = LOG_ADD(tmp1, tmp2);
-
-	    scr[n] -= tmp1 << 10;
+	    sum += tmp1;
 	}
+	scores[k] = -(sum << 10);
     }
 }
 
 /*
- * Like get_scores4, but uses OPDF_8B:
- *     LogProb(feature f, codeword c, senone s) =
- *         OPDF_8B[f]->prob[c][OPDF_8B[f]->id[c][s]]
- * Compute all senone scores.
+ * Like get_scores4_8b, but computes all senone scores.
  */
 static void get_scores4_8b_all (int32 *scores, vqFeature_t frm[][MAX_TOPN])
 {
     register int32 j, k;
-    int32 tmp1, tmp2;
-    unsigned char *pid_cw0, *pid_cw1, *pid_cw2, *pid_cw3;
-    int32 *scr;
-    int32 w0, w1, w2, w3;			/* weights */
-    /* register int32   ts = Table_Size;
-       register int16 *at = Addition_Table;
-       int32 ff, tt, ii; */
+    int32 tmp1, tmp2, sum;
+    unsigned char *pid[NUM_FEATURES][4];
+    int32 w[NUM_FEATURES][4];			/* weights */
 
     n_senone_active = CdWdPDFMod;
-    
-    /* ptrs to senone prob ids */
-    pid_cw0 = OPDF_8B[0]->id[frm[0][0].codeword];
-    pid_cw1 = OPDF_8B[0]->id[frm[0][1].codeword];
-    pid_cw2 = OPDF_8B[0]->id[frm[0][2].codeword];
-    pid_cw3 = OPDF_8B[0]->id[frm[0][3].codeword];
-
-    w0 = frm[0][0].val.score;
-    w1 = frm[0][1].val.score;
-    w2 = frm[0][2].val.score;
-    w3 = frm[0][3].val.score;
 
-    /* Floor w0..w3 so that when added to senone prob, will not exceed 255<<10 */
-    if (w3 < -99000) w3 = -99000;
-    if (w2 < -99000) w2 = -99000;
-    if (w1 < -99000) w1 = -99000;
-    if (w0 < -99000) w0 = -99000;	/* Condition should never be TRUE */
+    get_top4_8b (pid, w, frm);
 
-    /* Quantize */
-    w3 = (511-w3) >> 10;
-    w2 = (511-w2) >> 10;
-    w1 = (511-w1) >> 10;
-    w0 = (511-w0) >> 10;
-    
-    scr = scores;
     for (k = 0; k < CdWdPDFMod; k++) {
-	tmp1 = pid_cw0[k] + w0;
-	tmp2 = pid_cw1[k] + w1;
-	tmp1 = LOG_ADD(tmp1, tmp2);
-	tmp2 = pid_cw2[k] + w2;
-	tmp1 = LOG_ADD(tmp1, tmp2);
-	tmp2 = pid_cw3[k] + w3;
-	tmp1 = LOG_ADD(tmp1, tmp2);
-	
-	scr[k] = -(tmp1 << 10);
-    }
-    
-    for (j = 1; j < NUM_FEATURES; j++) {
-	/* ptrs to senone prob ids */
-	pid_cw0 = OPDF_8B[j]->id[frm[j][0].codeword];
-	pid_cw1 = OPDF_8B[j]->id[frm[j][1].codeword];
-	pid_cw2 = OPDF_8B[j]->id[frm[j][2].codeword];
-	pid_cw3 = OPDF_8B[j]->id[frm[j][3].codeword];
-
-	w0 = frm[j][0].val.score;
-	w1 = frm[j][1].val.score;
-	w2 = frm[j][2].val.score;
-	w3 = frm[j][3].val.score;
-
-	/* Floor w0..w3 to 256<<10 - 162k */
-	if (w3 < -99000) w3 = -99000;
-	if (w2 < -99000) w2 = -99000;
-	if (w1 < -99000) w1 = -99000;
-	if (w0 < -99000) w0 = -99000;	/* Condition should never be TRUE */
-
-	/* Quantize */
-	w3 = (511-w3) >> 10;
-	w2 = (511-w2) >> 10;
-	w1 = (511-w1) >> 10;
-	w0 = (511-w0) >> 10;
-
-        scr = scores;
-	if (j < NUM_FEATURES-1) {
-	    for (k = 0; k < CdWdPDFMod; k++) {
-		tmp1 = pid_cw0[k] + w0;
-		tmp2 = pid_cw1[k] + w1;
-		tmp1 = LOG_ADD(tmp1, tmp2);
-		tmp2 = pid_cw2[k] + w2;
-		tmp1 = LOG_ADD(tmp1, tmp2);
-		tmp2 = pid_cw3[k] + w3;
-		tmp1 = LOG_ADD(tmp1, tmp2);
-		
-		scr[k] -= tmp1 << 10;
-	    }
-	} else {
-	    for (k = 0; k < CdWdPDFMod; k++) {
-		tmp1 = pid_cw0[k] + w0;
-		tmp2 = pid_cw1[k] + w1;
-		tmp1 = LOG_ADD(tmp1, tmp2);
-		tmp2 = pid_cw2[k] + w2;
-		tmp1 = LOG_ADD(tmp1, tmp2);
-		tmp2 = pid_cw3[k] + w3;
-		tmp1 = LOG_ADD(tmp1, tmp2);
-		
-		scr[k] -= tmp1 << 10;
-	    }
+	sum = 0;
+	for (j = 0; j < NUM_FEATURES; j++) {
+	    tmp1 = pid[j][0][k] + w[j][0];
+	    tmp2 = pid[j][1][k] + w[j][1];
+	    tmp1 = LOG_ADD(tmp1, tmp2);
+	    tmp2 = pid[j][2][k] + w[j][2];
+	    tmp1 = LOG_ADD(tmp1, tmp2);
+	    tmp2 = pid[j][3][k] + w[j][3];
+	    tmp1 = LOG_ADD(tmp1, tmp2);
+	    sum += tmp1;
 	}
+	scores[k] = -(sum << 10);
     }
 }
 
@@ -1527,6 +1591,37 @@ static void quantize_pdfs (int32 f)
 
 #endif
 
+#ifdef SCVQ_SIMD
+/*
+ * Make the transposed copy of a codebook used by vqScan().
+ */
+static void transposeCB (int32 f)
+{
+    int32 veclen = (f == (int32)DCEP_FEAT) ? DCEP_VECLEN : CEP_VECLEN;
+    int32 k, cw, src;
+
+    free(meansT[f]);
+    free(varsT[f]);
+    meansT[f] = (float *) malloc((veclen-1) * NUM_ALPHABET * sizeof(float));
+    varsT[f] = (float *) malloc((veclen-1) * NUM_ALPHABET * sizeof(float));
+    if ((meansT[f] == NULL) || (varsT[f] == NULL))
+	E_FATAL("malloc(%d) failed\n", (veclen-1) * NUM_ALPHABET * sizeof(float));
+
+    for (k = 0; k < veclen-1; k++) {
+	/* short and long differences are interleaved, as dcepDist0()
+	 * uses them */
+	if (f == (int32)DCEP_FEAT)
+	    src = (k & 1) ? k/2 + CEP_VECLEN : k/2 + 1;
+	else
+	    src = k + 1;
+	for (cw = 0; cw < NUM_ALPHABET; cw++) {
+	    meansT[f][k*NUM_ALPHABET + cw] = means[f][cw*veclen + src];
+	    varsT[f][k*NUM_ALPHABET + cw] = vars[f][cw*veclen + src];
+	}
+    }
+}
+#endif
+
 /*
  * Read & initialize SC codebooks & output pdfs
  */
@@ -1553,6 +1648,10 @@ int32 SCVQInitFeat(feat_t feat, char *meanPath, char *varPath, int32 *opdf)
 		return -1;
 	}
     }
+#ifdef SCVQ_SIMD
+    if (feat != POW_FEAT)
+	transposeCB ((int32)feat);
+#endif
     
     if (prob_size == 32)
 	OPDF[(int32)feat] = opdf;
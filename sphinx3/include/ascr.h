@@ -104,6 +104,8 @@ typedef struct {
     uint8 *comssid_active;        /**< TEMPORARY VARIABLES:  Composite senone active */
     uint8 *sen_active;            /**< TEMPORARY VARIABLES: Structure that record whether the current state is active. */
     uint8 *rec_sen_active;        /**< TEMPORARY VARIABLES: Most recent senone active state */
+    int32 *sen_active_list;       /**< TEMPORARY VARIABLES: Active senones in increasing order, from ascr_flags2list() */
+    int32 n_sen_active;           /**< TEMPORARY VARIABLES: No. of entries in sen_active_list */
     int32 **cache_ci_senscr;      /**< TEMPORARY VARIABLES: Cache of ci senscr in the next pl_windows frames, include this frame.*/
     int32 *cache_best_list;       /**< TEMPORARY VARIABLES: Cache of best the ci sensr the next pl_windows, include this frame*/
 
@@ -163,6 +165,15 @@ void ascr_clear_sen_active(ascr_t *a /**<Input, an initialized ascr
 					data structure */
     );
 
+/**
+   Build sen_active_list from the sen_active array.  Runs of inactive
+   senones are skipped a machine word at a time.
+   @return the number of active senones.
+*/
+int32 ascr_flags2list(ascr_t *a /**<Input, an initialized ascr
+				   data structure */
+    );
+
 /** 
     Clear senone sequence ID active array. 
 */
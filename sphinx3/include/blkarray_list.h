@@ -85,15 +85,20 @@ extern "C" {
  * The application is responsible for knowing the true data type.
  * Use an array instead of a true list for efficiency (both memory and
  * speed).  But use a blocked (2-D) array to allow dynamic resizing at a
- * coarse grain.  An entire block is allocated or freed, as appropriate.
+ * coarse grain.  Blocks are allocated as the list grows, and kept when
+ * it is reset, to be filled again by the next use of the list.
  */
 typedef struct blkarray_list_s {
     void ***ptr;		/* ptr[][] is the user-supplied ptr */
     int32 maxblks;	/* size of ptr (#rows) */
-    int32 blksize;	/* size of ptr[] (#cols, ie, size of each row) */
+    int32 blksize;	/* size of ptr[] (#cols, ie, size of each row);
+			   a power of two */
+    int32 blkshift;	/* log2(blksize) */
     int32 n_valid;	/* # entries actually stored in the list */
     int32 cur_row;	/* The current row being that has empty entry */
     int32 cur_row_free;	/* First entry valid within the current row */
+    int32 n_blks;	/* # rows allocated, in use or kept for reuse */
+    int32 max_valid;	/* Most entries the list may hold; 0 if no limit */
 } blkarray_list_t;
 
 /* Access macros */
@@ -103,11 +108,13 @@ typedef struct blkarray_list_s {
 #define blkarray_list_n_valid(l)	((l)->n_valid)
 #define blkarray_list_cur_row(l)	((l)->cur_row)
 #define blkarray_list_cur_row_free(l)	((l)->cur_row_free)
+#define blkarray_list_n_blks(l)		((l)->n_blks)
 
 
 /*
  * Initialize and return a new blkarray_list containing an empty list
- * (i.e., 0 length).  Sized for the given values of maxblks and blksize.
+ * (i.e., 0 length).  Sized for the given values of maxblks and blksize,
+ * the latter rounded up to a power of two.
  * NOTE: (maxblks * blksize) should not overflow int32, but this is not
  * checked.
  * Return the allocated entry if successful, NULL if any error.
@@ -134,10 +141,23 @@ int32 blkarray_list_append (blkarray_list_t *, void *data);
 
 /*
  * Free all the entries in the list (using ckd_free) and reset the
- * list length to 0.
+ * list length to 0.  The blocks are kept to be reused.
  */
 void blkarray_list_reset (blkarray_list_t *);
 
+
+/*
+ * Limit the list to at most max_valid entries (no limit if 0), after
+ * which blkarray_list_append() fails.  Blocks kept for reuse beyond
+ * those needed for max_valid entries are freed, so that the memory
+ * held by the list stays bounded however long it is used.
+ */
+void blkarray_list_set_max(blkarray_list_t *bl, int32 max_valid);
+
+
+/* Gets n-th element of the array list, or NULL if there is none */
+void *blkarray_list_get(blkarray_list_t *, int32 n);
+
 /**
  * Completely free the list and all entries in it.
  **/
@@ -239,7 +239,11 @@ us a better architecture.
     { "-fsgusefiller", \
       ARG_BOOLEAN, \
       "yes", \
-      "(FSG Mode (Mode 2) only) Insert filler words at each state."}
+      "(FSG Mode (Mode 2) only) Insert filler words at each state."}, \
+    { "-fsghistmax", \
+      ARG_INT32, \
+      "0", \
+      "(FSG Mode (Mode 2) only) Maximum number of word history entries in an utterance, 0 for no limit; beyond it, each frame keeps only its best word exits"}
 
 
 #define log_table_command_line_macro() \
@@ -672,7 +676,15 @@ us a better architecture.
     { "-epl", \
       ARG_INT32, \
       "3", \
-      "(Mode 4 only) Entries Per Lextree; #successive entries into one lextree before lextree-entries shifted to the next" }
+      "(Mode 4 only) Entries Per Lextree; #successive entries into one lextree before lextree-entries shifted to the next" }, \
+    { "-srchthreads", \
+      ARG_INT32, \
+      "1", \
+      "(Mode 4 only) No. of threads evaluating and propagating lextrees within each frame" }, \
+    { "-lextreemem", \
+      ARG_INT32, \
+      "0", \
+      "(Mode 4 only) Megabytes of lextrees to keep for LMs other than the current one; the least recently used are freed and rebuilt when switched back to.  0 builds and keeps the lextrees of all LMs" }
 
 /* mode WST or mode 5*/
 #define search_modeWST_specific_command_line_macro() \
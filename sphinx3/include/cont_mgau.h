@@ -185,6 +185,7 @@ typedef struct {
     float32 ***fullvar;   /* The n_comp (full) variances of the Gaussians. */
     /* A full co-variance matrix for a single mixture-Gaussian model for one senone */
     /* Dimension: n_comp * dimension * dimension */
+    /* After mgau_precomp(), the upper triangular U with U^T U = variance^-1 */
 
     /* Definition for the log reciprocal terms */
     float32 *lrd;	        /**< Log(Reciprocal(Determinant (variance))).  (Then there is also a
@@ -223,6 +224,9 @@ typedef struct {
                        gau_type=SEMIHMM if it is semi continous HMM. Currently SEMIHMM is not supported. */
 
     logmath_t *logmath;		/**< The logmath_t structure */
+
+    float32 *fulldiff;		/**< Scratch space of veclen floats for full covariance
+                                   evaluation */
 } mgau_model_t;
 
 
@@ -336,6 +340,20 @@ int32 mgau_comp_eval (mgau_model_t *g,	/**< In: Set of mixture Gaussians */
 		      int32 *score	/**< Out: Array of scores for each component */
     );
 
+/**
+ * Like mgau_eval() with no short list, but for a block of frames at
+ * once.  Each component is compared with all of the frames before the
+ * next is loaded, and the scores are the same as mgau_eval() would
+ * give for each frame.  The best component is not updated.
+ */
+S3DECODER_EXPORT
+void mgau_eval_frames (mgau_model_t *g,	/**< In: The entire mixture Gaussian model */
+		       int32 m,		/**< In: The chosen mixture in the model */
+		       float32 **x,	/**< In: n_frames input vectors */
+		       int32 n_frames,	/**< In: Number of frames in x */
+		       int32 *score	/**< Out: Senone score for each frame */
+    );
+
 /**
  * A routine that dump all mean and variance parameters of a set of gaussian distribution.   
  * @return always 0
@@ -135,6 +135,10 @@ typedef struct
 
     char* cb2mllrname; /**< The code book to regression matrix file name for this utterance 
                         */
+
+    void* data; /**< Application data for this utterance, which the
+                   prefetch function of ctl_process_mt() may set for
+                   func to use (and free) */
 } utt_res_t;
 
 #define utt_res_set_uttfile(ur,name) ur->uttfile=name
@@ -259,6 +263,51 @@ ptmr_t ctl_process (const char *ctlfile,	/**< In: Control file to read; use stdi
 					   the first argument to func above */
     );
 
+/**
+ * Like ctl_process, but process the entries in several threads.
+ *
+ * The calling thread reads the control file ahead of the others, up
+ * to a few entries per thread, and calls prefetch (if not NULL) on
+ * each entry as it is queued, so that its input can be read in while
+ * earlier ones are processed.  Each thread calls func with its own
+ * element of wdata, and a temporary stream for each of the n_out
+ * files in outfp, to which it writes what it has to say about the
+ * entry.  These are copied to outfp in control file order, so the
+ * output is the same as with a single thread.
+ *
+ * MLLR control files are not supported, since adaptation would change
+ * models shared by all the threads.
+ *
+ * Return value: ptmr_t structure containing elapsed time stats for the run.
+ */
+S3DECODER_EXPORT
+ptmr_t ctl_process_mt (const char *ctlfile,	/**< In: Control file to read; use stdin if NULL */
+		       const char *ctllmfile,	/**< In: Control file that specify the lm used for the corresponding utterance */
+		       int32 nskip,	/**< In: No. of entries to skip at the head */
+		       int32 count,	/**< In: No. of entries to process after nskip */
+		       int32 n_thread,	/**< In: No. of threads to process them with */
+		       void (*func) (void *wdata, utt_res_t *ur, int32 sf, int32 ef, char *uttid, FILE **out),
+		       /**< In: Function to be invoked in some thread for
+			  each of the count entries processed. */
+		       void **wdata,	/**< In: n_thread data pointers, one passed to
+					   func in each thread */
+		       void (*prefetch) (void *pdata, utt_res_t *ur, char *uttid),
+		       /**< In: Function to be invoked in the calling thread
+			  as each entry is queued, or NULL */
+		       void *pdata,	/**< In: Data pointer passed to prefetch */
+		       FILE **outfp,	/**< In: Files to write output to in order */
+		       int32 n_out	/**< In: No. of files in outfp */
+    );
+
+/**
+ * Hint that a file will be read soon, so that the system can start
+ * reading it in the background.  Suitable for the prefetch function
+ * of ctl_process_mt.  Does nothing where this is not supported.
+ */
+S3DECODER_EXPORT
+void ctl_prefetch_file(const char *file /**< In: File to read ahead */
+    );
+
 
 /**
  * Like ctl_process, but process the single filename given (uttfile), count times.  After each
@@ -285,7 +285,8 @@ int32 dag_param_read (FILE *fp, /** file pointer */
 
 
 /**
- * Recursive step in dag_search:  best backward path from src to root beginning with l.
+ * Step in dag_search:  best backward path from src to root beginning with l.
+ * Walks the lattice depth-first with an explicit stack rather than recursion.
  * @return 0 if successful, -1 otherwise.
  */
 int32 dag_bestpath (
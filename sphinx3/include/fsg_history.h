@@ -175,6 +175,12 @@ typedef struct fsg_history_s {
 
     /*Added by Arthur at 20050627*/
     int32 n_ciphone;
+
+    int32 *frame_scores;	/* Scores of the entries in a frame, when
+                                   entries has a size limit */
+    int32 n_frame_scores_alloc;
+    int32 n_pruned;		/* Entries dropped in this utterance for
+                                   lack of room */
 } fsg_history_t;
 
 
@@ -222,6 +228,14 @@ void fsg_history_end_frame (fsg_history_t *);
 void fsg_history_reset (fsg_history_t *);
 
 
+/*
+ * Limit the history table to max_entries entries (no limit if 0).  Once
+ * it is full, each frame keeps only its best scoring entries that still
+ * fit, so that the memory used by long utterances stays bounded.
+ */
+void fsg_history_set_max (fsg_history_t *h, int32 max_entries);
+
+
 /* Return the number of valid entries in the given history table */
 int32 fsg_history_n_entries (fsg_history_t *h);
 
@@ -299,6 +299,18 @@ void hmm_enter_obj(hmm_t *h, int32 score,
  * update the exit state as well.)
 */
 int32 hmm_vit_eval(hmm_t *hmm);
+
+/** Number of HMMs evaluated together by hmm_vit_eval_batch(). */
+#define HMM_BATCH 8
+
+/**
+ * Viterbi evaluation of n_hmm HMMs, as by hmm_vit_eval() on each.
+ * Runs of HMM_BATCH HMMs with the same topology and multiplexing are
+ * evaluated together in vector registers where the compiler allows,
+ * so callers should group HMMs of each kind together.
+ * @return The best state score among all of them.
+ */
+int32 hmm_vit_eval_batch(hmm_t **hmm, int32 n_hmm);
   
 
 /**
@@ -151,9 +151,6 @@ typedef struct {
     gs_t *gs; /**< Gaussian Selector */
     tmat_t *tmat; /**< Transition Matrix. */
 
-    int32 maxNewHeurScore; /**< Temporary variables for phoneme lookahead. This stores the heuristic score */
-    int32 lastfrm; /**, Temporary variables, should be removed */
-
     s3lmwid32_t startwid;
     s3lmwid32_t finishwid;
     logmath_t *logmath;
@@ -248,6 +248,7 @@ typedef struct {
     lextree_node_t **active;		/**< Nodes active in any frame */
     lextree_node_t **next_active;	/**< Like active, but temporary space for constructing the
 					   active list for the next frame using the current */
+    int32 n_alloc_active;	/**< Allocated size of active and next_active */
     int32 n_active;		/**< No. of nodes active in current frame */
     int32 n_next_active;	/**< No. of nodes active in current frame */
     
@@ -459,6 +460,13 @@ void lextree_dump (lextree_t *lextree,  /**< In: A lexical tree*/
 /** Utility function that count the number of links */
 int32 num_lextree_links(lextree_t *ltree /**< In: A lexical tree */
     );
+
+/**
+ * Estimate the memory used by a lexical tree, in bytes, including the
+ * right context nodes it has grown during search so far.
+ */
+size_t lextree_mem_size(lextree_t *ltree /**< In: A lexical tree */
+    );
 #if 0
 { /* Stop indent from complaining */
 #endif
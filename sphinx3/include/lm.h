@@ -143,6 +143,7 @@
 #include <sphinxbase/logmath.h>
 #include <sphinxbase/hash_table.h>
 #include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/mmio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -473,22 +474,13 @@ typedef struct tginfo32_s {
 
 /*
  * \struct lm_tgcache_entry_t
- * Entries in a fast and dirty cache for trigram lookups.  See lm_t.tgcache.
- */
-typedef struct {
-    s3lmwid_t lwid[3];		/**< 0 = oldest, 2 = newest (i.e., P(2|0,1)) */
-    int32 lscr;			/**< LM score for above trigram */
-} lm_tgcache_entry_t;
-
-
-/*
- * \struct lm_tgcache_entry32_t
- * \brief 32 bit version of lm_tg_cache_entry
+ * Entries in the cache for trigram lookups, for both 16 and 32 bit
+ * LMs.  See lm_t.tgcache.
  */
 typedef struct {
     s3lmwid32_t lwid[3];		/**< 0 = oldest, 2 = newest (i.e., P(2|0,1)) */
     int32 lscr;			/**< LM score for above trigram */
-} lm_tgcache_entry32_t;
+} lm_tgcache_entry_t;
 
 
 
@@ -547,9 +539,12 @@ typedef struct {
 /* Default values for lm_t.log_bg_seg.sz */
 #define LOG2_BG_SEG_SZ  9	
 #define BG_SEG_SZ       (1 << (LOG2_BG_SEG_SZ))
-#define LM_TGCACHE_SIZE		100003	/* A prime no. (hopefully it IS one!) */
 
-/* 20040211 ARCHAN: Yes! Indeed it is a prime */
+/* The trigram cache has LM_TGCACHE_N_SET sets of LM_TGCACHE_WAYS entries */
+#define LM_TGCACHE_LOG_N_SET	15
+#define LM_TGCACHE_N_SET	(1 << LM_TGCACHE_LOG_N_SET)
+#define LM_TGCACHE_WAYS		4
+#define LM_TGCACHE_SIZE		(LM_TGCACHE_N_SET * LM_TGCACHE_WAYS)
 
 /** \struct lm_t
  * \brief The language model.
@@ -586,11 +581,13 @@ typedef struct lm_s {
     tginfo_t **tginfo;	/**< tginfo[w2] = fast trigram access info for bigrams (*,w2) */
 
 
-    lm_tgcache_entry_t *tgcache; /**< <w0,w1,w2> hashed to an entry into
-                                    this array.  Only the last trigram
-                                    mapping to any * given hash entry is
-                                    kept in that entry.  (The cache
-                                    doesn't have to be super-efficient.)
+    lm_tgcache_entry_t *tgcache; /**< <w0,w1,w2> hashed to a set of
+                                    LM_TGCACHE_WAYS entries in this
+                                    array, most recently used first.
+                                    The least recently used entry of a
+                                    set is replaced on a miss.  Kept
+                                    across utterances; flushed when the
+                                    scores change.
                                  */
 
 
@@ -602,8 +599,6 @@ typedef struct lm_s {
     membg32_t *membg32;	/**< membg 32bits membg[w1] = bigrams for lm wid w1 (used iff disk-based) */
     tginfo32_t **tginfo32;	/**< tginfo 32bits tginfo[w2] = fast trigram access info for bigrams (*,w2) */
 
-    lm_tgcache_entry32_t *tgcache32; /** tgcache 32 bits */
-
     /**************************/
 
     /* the following variables are used for MMIE training
@@ -622,6 +617,7 @@ typedef struct lm_s {
     int32 n_tgbowt;
 
     FILE *fp;
+    char *file;         /**< File that fp reads, if disk-based */
     int32 byteswap;     /**< Whether this file is in the WRONG byte order */
     int32 bgoff;        /**< BG offsets into DMP file (used iff disk-based) */
     int32 tgoff;        /**< TG offsets into DMP file (used iff disk-based) */
@@ -639,7 +635,8 @@ typedef struct lm_s {
     int32 n_tg_inmem;   /**< \#tg in memory */
     int32 n_tg_score;   /**< \#tg_score operations */
     int32 n_tg_bo;      /**< \#tg_score ops backed off to bg */
-    int32 n_tgcache_hit;  /**< \# of trigram cache hit ops backed off to bg */
+    int32 n_tgcache_hit;  /**< \# of tg_score ops found in the trigram cache */
+    int32 n_tgcache_miss; /**< \# of tg_score ops not found in the trigram cache */
     
     int32 access_type;	/**< Updated on every lm_{tg,bg,ug}_score call to reflect the kind of
                            n-gram accessed: 3 for 3-gram, 2 for 2-gram and 1 for 1-gram */
@@ -647,6 +644,7 @@ typedef struct lm_s {
 
     int32 isLM_IN_MEMORY;  /**< Whether LM in in memory, it is a property, potentially it means
                               the code could allow you some model to be disk-based, some are not. */
+    mmio_file_t *mmf;      /**< Memory-mapped DMP32 file that bg32 and tg32 point into, or NULL */
 
     int32 dict_size;  /**< Only used in class-based LM, because class-based LM is addressed in 
                          the dictionary space. */
@@ -1196,6 +1194,27 @@ S3DECODER_EXPORT
 void lm_free (lm_t *lm /**< In: a LM structure */
     );
 
+/**
+   Make a copy of an LM which can be used in another thread.
+
+   Scoring an LM fills in its trigram caches and statistics, so two
+   threads cannot use the same one.  The copy shares the n-gram tables
+   of lm, which must outlive it and not have words added meanwhile,
+   but has caches of its own.  A copy of a disk-based LM reads the
+   n-grams it needs from its own handle on the file.
+   @return the copy, or NULL if the file cannot be opened.
+*/
+S3DECODER_EXPORT
+lm_t *lm_share(lm_t *lm /**< In: a LM structure */
+    );
+
+/**
+   Free a copy of an LM made with lm_share().
+*/
+S3DECODER_EXPORT
+void lm_share_free(lm_t *lm /**< In: a copy of an LM structure */
+    );
+
 /**
    Add word list to the LM 
    For each word in the file, call lm_add_wordlist. 
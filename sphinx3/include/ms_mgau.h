@@ -163,6 +163,25 @@ ms_mgau_model_t* ms_mgau_init (const char *meanfile,	/**< In: File containing me
 void ms_mgau_free(ms_mgau_model_t *g /**< In: A set of models to free */
     );
 
+/**
+   Make a copy of a model which can be evaluated in another thread.
+
+   The copy shares the codebooks, senones and interpolation weights
+   of msg, which must outlive it and not be adapted (e.g. by
+   model_set_mllr()) meanwhile, but has its own scratch space for
+   density values.
+*/
+S3DECODER_EXPORT
+ms_mgau_model_t *ms_mgau_share(ms_mgau_model_t *msg /**< In: A set of models */
+    );
+
+/**
+   Free a copy of a model made with ms_mgau_share().
+*/
+S3DECODER_EXPORT
+void ms_mgau_share_free(ms_mgau_model_t *msg /**< In: A copy of a set of models */
+    );
+
 S3DECODER_EXPORT
 int32 ms_cont_mgau_frame_eval (ascr_t *ascr,   /**< In: An ascr object*/
 			       ms_mgau_model_t *msg, /**< In: A multi-stream mgau mode */
@@ -155,6 +155,7 @@ typedef struct {
     int32 shift;		/**< LSB bits truncated from original logs3 value */
     s3mgauid_t *mgau;		/**< senone-id -> mgau-id mapping for senones in this set */
     int32* featscr;              /**< The feature score for every senone, will be initialized inside senone_eval_all */
+    int32* cwscr;                /**< The score of one codeword for every senone, will be initialized inside senone_eval_all */
 } senone_t;
 
 
@@ -202,6 +202,28 @@ typedef struct
      */
     hyp_t **hyp_segs;
 
+    /**
+     * Number of word segments in hyp_segs.
+     */
+    int32 hyp_seglen;
+
+    /**
+     * Allocated length of hyp_segs and hyp_stroff.
+     */
+    int32 hyp_segs_alloc;
+
+    /**
+     * Offset in hyp_str at which the text for each word segment begins.
+     * Lets a partial hypothesis be rewritten from the first segment that
+     * changed instead of from scratch.
+     */
+    int32 *hyp_stroff;
+
+    /**
+     * Allocated length of hyp_str.
+     */
+    int32 hyp_str_alloc;
+
     /**
      * Boolean indicates whether we will internally swap the samples. 
      */
@@ -343,7 +365,11 @@ int s3_decode_process(s3_decode_t *_decode,
     @param _hyp_str Return pointer to a READ-ONLY string.  If <I>null</I>,
     the string is not returned.
     @param _hyp_segs Return pointer to a null-terminated array of word
-    segments.  If <I>null</I>, the array is not returned.
+    segments.  If <I>null</I>, the array is not returned.  Each segment
+    carries its start and end frames.  Both the string and the array are
+    only valid until the next call to this function or to
+    <I>s3_decode_end_utt()</I>; segments that did not change since the
+    previous partial hypothesis are reused rather than rebuilt.
     @return 0 for success.  -1 for failure.
 */
 S3DECODER_EXPORT
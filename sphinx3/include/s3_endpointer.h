@@ -1,4 +1,6 @@
 
+#include <sphinxbase/fe.h>
+
 #include "cont_mgau.h"
 
 #ifndef __SPHINX3_ENDPOINTER_H
@@ -17,6 +19,7 @@ typedef struct {
     float32 **frames;
     int *classes;
     int n_frames;
+    int max_frames;     /* Frames and classes allocated */
     int offset;
     int count;
     int eof;
@@ -39,6 +42,9 @@ typedef struct {
     int end_window;
     int end_threshold;
     int frames_required;
+
+    mfcc_t **cep;       /* Front end output for s3_endpointer_feed_raw() */
+    int max_cep;
 } s3_endpointer_t;
 
 S3DECODER_EXPORT
@@ -66,6 +72,22 @@ void s3_endpointer_feed_frames(s3_endpointer_t *_ep,
 			       float32 **_frames,
 			       int _n_frames,
 			       int _eof);
+/**
+ * Feed a block of raw audio, of any length, through a front end.
+ *
+ * The front end, which must give as many cepstra as the classifier
+ * expects, belongs to the caller, who starts it with fe_start_utt()
+ * at the beginning of the stream.  At the end of the stream (_eof) the
+ * last partial frame is flushed with fe_end_utt().
+ *
+ * @return the number of frames fed, or -1 on error.
+ */
+S3DECODER_EXPORT
+int s3_endpointer_feed_raw(s3_endpointer_t *_ep,
+			   fe_t *_fe,
+			   int16 const *_raw,
+			   size_t _n_samples,
+			   int _eof);
 S3DECODER_EXPORT
 int s3_endpointer_read_utt(s3_endpointer_t *_ep,
 			   float32 **_frames,
@@ -253,12 +253,15 @@ float64 vector_vqgen (float32 **data,	/**< In: Input Data to be quantized */
 					   quantized vector corresponding to the input vector
 					   data[i].  Caller must allocate this array */
 
-		      int32 seed      /**< In : The seed for a random generator
+		      int32 seed,     /**< In : The seed for a random generator
 					 if it is smaller than 0, use the internal
 					 mechanism to generate seed. 
 					 else use the seed to seed the random
 					 generator.
 				      */
+		      int32 n_thread  /**< In: Number of threads used to label the
+					 data in each iteration.  The result does
+					 not depend on it. */
     );
 
 /**
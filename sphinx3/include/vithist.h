@@ -173,7 +173,9 @@ typedef struct backpointer_s {
 } backpointer_t;
 
 /**
- * Viterbi history entry.
+ * Viterbi history entry.  Entries are fixed-size and hold only the
+ * best exit over all right contexts of the word, so they can be
+ * moved by plain structure copies.
  */
 typedef struct {
     backpointer_t path;         /**< Predecessor word and best path score including it */
@@ -184,8 +186,6 @@ typedef struct {
     int32 lscr;			/**< LM score for this node, given its Viterbi history */
     int16 type;			/**< >=0: regular n-gram word; <0: filler word entry */
     int16 valid;		/**< Whether it should be a valid history for LM rescoring */
-    backpointer_t *rc;          /**< Individual score/history for different right contexts */
-    int32 n_rc;                 /**< Number of right contexts */
 } vithist_entry_t;
 
 /** Return the word ID of an entry */
@@ -350,7 +350,7 @@ glist_t vithist_backtrace (vithist_t *vh,       /**< In: a Viterbi history data
 void vithist_enter(vithist_t * vh,              /**< The history table */
                    kbcore_t * kbc,              /**< a KB core */
                    vithist_entry_t * tve,       /**< an input vithist element */
-                   int32 comp_rc                /**< a compressed rc. If it is the actual rc, it won't work. FIXME: WHAT DOES THIS MEAN?!!?!? */
+                   int32 comp_rc                /**< a compressed rc (not recorded in the entry) */
     );
 
 /**
@@ -367,7 +367,7 @@ void vithist_rescore (vithist_t *vh,    /**< In: a Viterbi history data structur
 		      int32 score,	/**< In: Does not include LM score for this entry */
 		      int32 pred,	/**< In: Tentative predecessor */
 		      int32 type,       /**< In: Type of lexical tree */
-		      int32 rc          /**< In: The compressed rc. So if you use the actual rc, it doesn't work.  */
+		      int32 rc          /**< In: The compressed rc (not recorded in the entry) */
     );
 
 
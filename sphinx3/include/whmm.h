@@ -129,12 +129,32 @@ typedef struct whmm_s {
 } whmm_t;
 
 
-/** Free a whmm */
-void whmm_free (whmm_t *h /**< a whmm */
+/**
+ * \struct whmm_pool_t
+ * \brief Freed whmm_t kept for reuse.
+ * The search enters and leaves thousands of phones every frame, so
+ * rather than going back to the heap each time, freed instances are
+ * kept here, multiplex ones with their senone sequence ID arrays.
+ */
+typedef struct whmm_pool_s {
+    whmm_t *free_mpx;    /**< Free multiplex whmm, linked through next */
+    whmm_t *free_nonmpx; /**< Free non-multiplex whmm, linked through next */
+} whmm_pool_t;
+
+/** Create an empty pool */
+whmm_pool_t *whmm_pool_init(void);
+
+/** Free a pool and all the whmm in it */
+void whmm_pool_free(whmm_pool_t *pool /**< a pool */
+    );
+
+/** Return a whmm to the pool it came from */
+void whmm_free (whmm_pool_t *pool, /**< a pool */
+                whmm_t *h /**< a whmm */
     );
 
-/** Allocate a whmm (mostly a wrapper around hmm_init()) */
-whmm_t *whmm_alloc(hmm_context_t *ctx, int32 pos, int mpx,
+/** Allocate a whmm from a pool (mostly a wrapper around hmm_init()) */
+whmm_t *whmm_alloc(whmm_pool_t *pool, hmm_context_t *ctx, int32 pos, int mpx,
                    s3ssid_t ssid, s3tmatid_t tmatid);
 
 
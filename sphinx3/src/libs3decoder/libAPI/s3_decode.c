@@ -250,6 +250,10 @@ s3_decode_init(s3_decode_t * _decode, cmd_ln_t *_config)
     _decode->state = S3_DECODE_STATE_IDLE;
     _decode->hyp_str = NULL;
     _decode->hyp_segs = NULL;
+    _decode->hyp_stroff = NULL;
+    _decode->hyp_seglen = 0;
+    _decode->hyp_segs_alloc = 0;
+    _decode->hyp_str_alloc = 0;
 
     _decode->swap =
             strcmp(cmd_ln_str_r(_config,"-machine_endian"),
@@ -509,113 +513,124 @@ s3_decode_set_uttid(s3_decode_t * _decode, char *_uttid)
     return S3_DECODE_SUCCESS;
 }
 
+/**
+ * Returns TRUE if two word segments come from the same Viterbi history
+ * entry, i.e. the word and its timing are unchanged.
+ */
+static int
+s3_decode_same_seg(srch_hyp_t * a, srch_hyp_t * b)
+{
+    return (a->id == b->id && a->vhid == b->vhid
+            && a->sf == b->sf && a->ef == b->ef
+            && a->ascr == b->ascr && a->lscr == b->lscr
+            && a->type == b->type);
+}
+
+/**
+ * Record the current (partial or final) hypothesis.  Successive partial
+ * hypotheses mostly share their leading words, so the segments and
+ * string of the previous one are kept up to the first word that differs
+ * and only the rest is rebuilt.
+ */
 int
 s3_decode_record_hyps(s3_decode_t * _decode, int _end_utt)
 {
-    int32 i = 0;
+    int32 i, n_keep, len;
     glist_t hyp_list;
     gnode_t *node;
     srch_hyp_t *hyp;
-    char *hyp_strptr = 0;
-    char *hyp_str = 0;
     srch_t *srch;
-    srch_hyp_t **hyp_segs = 0;
-    int hyp_seglen = 0;
-    int hyp_strlen = 0;
     int finish_wid = 0;
-    kb_t *kb = 0;
     dict_t *dict;
-    int rv;
+    char *word;
 
     if (_decode == NULL)
         return S3_DECODE_ERROR_NULL_POINTER;
 
-    s3_decode_free_hyps(_decode);
-
-    kb = &_decode->kb;
     dict = kbcore_dict(_decode->kbcore);
     srch = (srch_t *) _decode->kb.srch;
     hyp_list = srch_get_hyp(srch);
     if (hyp_list == NULL) {
+        s3_decode_free_hyps(_decode);
         E_WARN("Failed to retrieve viterbi history.\n");
         return S3_DECODE_ERROR_INTERNAL;
     }
 
-    /** record the segment length and the overall string length */
+    /* Keep the segments shared with the previous hypothesis. */
+    n_keep = 0;
+    node = hyp_list;
+    while (node != NULL && n_keep < _decode->hyp_seglen
+           && s3_decode_same_seg(_decode->hyp_segs[n_keep],
+                                 (srch_hyp_t *) gnode_ptr(node))) {
+        ckd_free(gnode_ptr(node));
+        node = gnode_next(node);
+        ++n_keep;
+    }
+    len = _decode->hyp_str ? strlen(_decode->hyp_str) : 0;
+    if (n_keep < _decode->hyp_seglen) {
+        len = _decode->hyp_stroff[n_keep];
+        _decode->hyp_str[len] = '\0';
+    }
+    for (i = n_keep; i < _decode->hyp_seglen; i++)
+        ckd_free(_decode->hyp_segs[i]);
+    _decode->hyp_seglen = n_keep;
+
+    /* Append the rest. */
     finish_wid = dict_finishwid(dict);
-    for (node = hyp_list; node != NULL; node = gnode_next(node)) {
+    for (; node != NULL; node = gnode_next(node)) {
         hyp = (srch_hyp_t *) gnode_ptr(node);
-        hyp_seglen++;
-        if (!dict_filler_word(dict, hyp->id) && hyp->id != finish_wid) {
-            hyp_strlen +=
-                strlen(dict_wordstr(dict, dict_basewid(dict, hyp->id))) +
-                1;
+        if (_decode->hyp_seglen + 1 >= _decode->hyp_segs_alloc) {
+            _decode->hyp_segs_alloc = _decode->hyp_segs_alloc * 2 + 16;
+            _decode->hyp_segs = ckd_realloc(_decode->hyp_segs,
+                                            _decode->hyp_segs_alloc *
+                                            sizeof(*_decode->hyp_segs));
+            _decode->hyp_stroff = ckd_realloc(_decode->hyp_stroff,
+                                              _decode->hyp_segs_alloc *
+                                              sizeof(*_decode->hyp_stroff));
         }
-    }
 
-    if (hyp_strlen == 0) {
-        hyp_strlen = 1;
-    }
+        _decode->hyp_stroff[_decode->hyp_seglen] = len;
+        _decode->hyp_segs[_decode->hyp_seglen++] = hyp;
 
-  /** allocate array to hold the segments and/or decoded string */
-    hyp_str = (char *) ckd_calloc(hyp_strlen, sizeof(char));
-    hyp_segs =
-        (srch_hyp_t **) ckd_calloc(hyp_seglen + 1, sizeof(srch_hyp_t *));
-    if (hyp_segs == NULL || hyp_str == NULL) {
-        E_WARN("Failed to allocate storage for hypothesis.\n");
-        rv = S3_DECODE_ERROR_OUT_OF_MEMORY;
-        goto s3_decode_record_hyps_cleanup;
-    }
+        word = dict_wordstr(dict, dict_basewid(dict, hyp->id));
+        hyp->word = word;
+        if (dict_filler_word(dict, hyp->id) || hyp->id == finish_wid)
+            continue;
 
-  /** iterate thru to fill in the array of segments and/or decoded string */
-    i = 0;
-    hyp_strptr = hyp_str;
-    for (node = hyp_list; node != NULL; node = gnode_next(node), i++) {
-        hyp = (srch_hyp_t *) gnode_ptr(node);
-        hyp_segs[i] = hyp;
-
-        hyp->word = dict_wordstr(dict, dict_basewid(dict, hyp->id));
-        if (!dict_filler_word(dict, hyp->id) && hyp->id != finish_wid) {
-            strcat(hyp_strptr,
-                   dict_wordstr(dict, dict_basewid(dict, hyp->id)));
-            hyp_strptr += strlen(hyp_strptr);
-            *hyp_strptr = ' ';
-            hyp_strptr += 1;
+        /* Words are separated by single spaces. */
+        if (len + strlen(word) + 2 > _decode->hyp_str_alloc) {
+            _decode->hyp_str_alloc = (len + strlen(word) + 2) * 2;
+            _decode->hyp_str = ckd_realloc(_decode->hyp_str,
+                                           _decode->hyp_str_alloc);
         }
+        if (len > 0)
+            _decode->hyp_str[len++] = ' ';
+        strcpy(_decode->hyp_str + len, word);
+        len += strlen(word);
     }
     glist_free(hyp_list);
 
-    hyp_str[hyp_strlen - 1] = '\0';
-    hyp_segs[hyp_seglen] = 0;
-    _decode->hyp_frame_num = _decode->num_frames_decoded;
-    _decode->hyp_segs = hyp_segs;
-    _decode->hyp_str = hyp_str;
-
-    return S3_DECODE_SUCCESS;
-
-  s3_decode_record_hyps_cleanup:
-    if (hyp_segs != NULL) {
-        ckd_free(hyp_segs);
+    if (_decode->hyp_str == NULL) {
+        _decode->hyp_str_alloc = 16;
+        _decode->hyp_str = ckd_calloc(_decode->hyp_str_alloc, 1);
     }
-    if (hyp_str != NULL) {
-        ckd_free(hyp_str);
-    }
-    if (hyp_list != NULL) {
-        for (node = hyp_list; node != NULL; node = gnode_next(node)) {
-            if ((hyp = (srch_hyp_t *) gnode_ptr(node)) != NULL) {
-                ckd_free(hyp);
-            }
-        }
-        glist_free(hyp_list);
+    if (_decode->hyp_segs == NULL) {
+        _decode->hyp_segs_alloc = 16;
+        _decode->hyp_segs = ckd_calloc(_decode->hyp_segs_alloc,
+                                       sizeof(*_decode->hyp_segs));
+        _decode->hyp_stroff = ckd_calloc(_decode->hyp_segs_alloc,
+                                         sizeof(*_decode->hyp_stroff));
     }
+    _decode->hyp_segs[_decode->hyp_seglen] = 0;
+    _decode->hyp_frame_num = _decode->num_frames_decoded;
 
-    return rv;
+    return S3_DECODE_SUCCESS;
 }
 
 void
 s3_decode_free_hyps(s3_decode_t * _decode)
 {
-    srch_hyp_t **h;
+    int32 i;
 
     if (_decode == NULL)
         return;
@@ -624,17 +639,17 @@ s3_decode_free_hyps(s3_decode_t * _decode)
     _decode->hyp_frame_num = -1;
 
   /** free and reset the hypothesis string */
-    if (_decode->hyp_str) {
-        ckd_free(_decode->hyp_str);
-        _decode->hyp_str = 0;
-    }
+    ckd_free(_decode->hyp_str);
+    _decode->hyp_str = NULL;
+    _decode->hyp_str_alloc = 0;
 
   /** free and reset the hypothesis word segments */
-    if (_decode->hyp_segs) {
-        for (h = _decode->hyp_segs; *h; h++) {
-            ckd_free(*h);
-        }
-        ckd_free(_decode->hyp_segs);
-        _decode->hyp_segs = 0;
-    }
+    for (i = 0; i < _decode->hyp_seglen; i++)
+        ckd_free(_decode->hyp_segs[i]);
+    ckd_free(_decode->hyp_segs);
+    ckd_free(_decode->hyp_stroff);
+    _decode->hyp_segs = NULL;
+    _decode->hyp_stroff = NULL;
+    _decode->hyp_seglen = 0;
+    _decode->hyp_segs_alloc = 0;
 }
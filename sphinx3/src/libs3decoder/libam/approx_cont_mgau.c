@@ -283,18 +283,14 @@ approx_mgau_eval(gs_t * gs,       /**< In: The Gaussian Selector. If Null, Gauss
     return ng;
 }
 
-int32 *ci;
-
-static int
-intcmp(const void *v1, const void *v2)
-{
-    return (ci[*(int32 *) v2] - ci[*(int32 *) v1]);
-}
-
-
 /** This function compute the dynamic beam using histogram-based CI
     senone evaluation. This will probably be another paper on speed
     up.
+
+    CI senones occupy the first mdef->n_ci_sen senone ids, and only
+    those within ci_pbeam of the best one can ever narrow the beam, so
+    only they are ranked.  They are usually a handful, which an
+    insertion sort handles faster than sorting the whole CI set.
     @see approx_cont_mgau_frame_eval
     @see approx_cont_mgau_ci_eval
   */
@@ -309,46 +305,44 @@ approx_compute_dyn_ci_pbeam(mdef_t * mdef,      /**< In: model definition */
                             s3senid_t * cd2cisen      /** In: a mapping from CD senone to CI senone */
     )
 {
-    int s;
+    int s, i, n_idx;
     int32 *idx;
-    int32 pbest;
+    int32 pbest, thres, scr;
     int32 total;
-    int32 is_ciphone;
-
-    ci = cache_ci_senscr;
 
     idx = fastgmm->gmms->idx;
 
-    for (s = 0; s < g->n_mgau; s++) {
-        is_ciphone = mdef_is_cisenone(mdef, s);
-        if (is_ciphone) {       /*Initialize the ci_occ in the fast_gmm_struct */
-            ci_occ[s] = 0;
-        }
-        else {
-            if (!sen_active || sen_active[s]) {
-                ci_occ[cd2cisen[s]]++;
-            }
-        }
-    }
     for (s = 0; s < mdef->n_ci_sen; s++)
-        idx[s] = s;
-    /* ARCHAN: we only have around 200 ci phones so it should be fine
-       for sorting. How about Chinese then? Hmm. We'll think about that
-       later...... */
+        ci_occ[s] = 0;
+    for (; s < g->n_mgau; s++) {
+        if (!sen_active || sen_active[s])
+            ci_occ[cd2cisen[s]]++;
+    }
 
-    /* FIXME : sorting is too slow */
-    qsort(idx, mdef->n_ci_sen, sizeof(int32), intcmp);
+    pbest = MAX_NEG_INT32;
+    for (s = 0; s < mdef->n_ci_sen; s++) {
+        if (cache_ci_senscr[s] > pbest)
+            pbest = cache_ci_senscr[s];
+    }
+
+    /* Rank the CI senones within the beam, best first. */
+    thres = pbest + fastgmm->gmms->ci_pbeam;
+    n_idx = 0;
+    for (s = 0; s < mdef->n_ci_sen; s++) {
+        scr = cache_ci_senscr[s];
+        if (scr <= thres)
+            continue;
+        for (i = n_idx++; i > 0 && cache_ci_senscr[idx[i - 1]] < scr; --i)
+            idx[i] = idx[i - 1];
+        idx[i] = s;
+    }
 
     total = 0;
-    pbest = cache_ci_senscr[idx[0]];
     fastgmm->gmms->dyn_ci_pbeam = fastgmm->gmms->ci_pbeam;
-    for (s = 0;
-         s < mdef->n_ci_sen
-         && cache_ci_senscr[idx[s]] > pbest + fastgmm->gmms->ci_pbeam;
-         s++) {
-        total += ci_occ[idx[s]];
+    for (i = 0; i < n_idx; i++) {
+        total += ci_occ[idx[i]];
         if (total > fastgmm->gmms->max_cd) {
-            fastgmm->gmms->dyn_ci_pbeam = cache_ci_senscr[idx[s]] - pbest;
+            fastgmm->gmms->dyn_ci_pbeam = cache_ci_senscr[idx[i]] - pbest;
             break;
         }
     }
@@ -448,8 +442,7 @@ approx_cont_mgau_frame_eval(mdef_t * mdef,
     int32 best_cid;
     int32 is_skip;
     int32 is_compute;
-    int32 pbest;
-    int32 is_ciphone;
+    int32 pbest, ci_thres;
     int32 svq_beam;
     int32 *ci_occ;
     s3senid_t *cd2cisen;
@@ -512,9 +505,22 @@ approx_cont_mgau_frame_eval(mdef_t * mdef,
         dyn_ci_pbeam = (int32) ((float32) dyn_ci_pbeam * tighten_factor);
     }
 
-    for (s = 0; s < g->n_mgau; s++) {
+    /* CI senones come first.  Their scores are always used, even if they
+     * are not active, so the CI beam threshold is fixed before any CD
+     * senone is looked at. */
+    for (s = 0; s < mdef->n_ci_sen; s++) {
+        /*Just copied from the cache, we just do accouting here */
+        senscr[s] = cache_ci_senscr[s];
+        if (pbest < senscr[s])
+            pbest = senscr[s];
+        sen_active[s] = 1;
+        rec_sen_active[s] = 1;
+    }
+    best = pbest;
+    ci_thres = pbest + dyn_ci_pbeam;
+
+    for (; s < g->n_mgau; s++) {
         is_compute = !sen_active || sen_active[s];
-        is_ciphone = mdef_is_cisenone(mdef, s);
 
 #if 0
         if (sen_active[s])
@@ -524,71 +530,58 @@ approx_cont_mgau_frame_eval(mdef_t * mdef,
                  g->mgau[s].bstidx, g->mgau[s].updatetime);
 #endif
 
-        /* Compute the score of the CI phone even if it is not active. */
-        if (is_ciphone) {
-            /*Just copied from the cache, we just do accouting here */
-            /*E_INFO("At senone %d, CI phoneme score %d \n",s,cache_ci_senscr[s]); */
-            senscr[s] = cache_ci_senscr[s];
-            if (pbest < senscr[s])
-                pbest = senscr[s];
-            if (best < senscr[s])
-                best = senscr[s];
-            sen_active[s] = 1;
-        }
-        else {
-            if (is_compute) {
-                if ((senscr[cd2cisen[s]] >= pbest + dyn_ci_pbeam)) {
-                    ng +=
-                        approx_mgau_eval(gs, svq, g, fastgmm, s, senscr,
-                                         feat, best_cid, svq_beam, frame);
-                    ns++;
-                }
-                else {
+        if (is_compute) {
+            if (senscr[cd2cisen[s]] >= ci_thres) {
+                ng +=
+                    approx_mgau_eval(gs, svq, g, fastgmm, s, senscr,
+                                     feat, best_cid, svq_beam, frame);
+                ns++;
+            }
+            else {
 
-                    /* 3.6 logic: 
-                       Whenever it is possible, CD senone score is backed off to the
-                       score computed by the best matching index. Otherwise, CI
-                       scores will be used.
-                     */
-                    if (g->mgau[s].bstidx == NO_BSTIDX ||       /* If the gaussian was not computed before. or */
-                        g->mgau[s].updatetime != frame - 1      /* It the gaussian was not updated in last frame */
-                        ) {
-                        /*Previous frames, senone s is not computed. 
-                           or the best index is not trusted. 
-                           Use CI score in these cases. */
+                /* 3.6 logic: 
+                   Whenever it is possible, CD senone score is backed off to the
+                   score computed by the best matching index. Otherwise, CI
+                   scores will be used.
+                 */
+                if (g->mgau[s].bstidx == NO_BSTIDX ||       /* If the gaussian was not computed before. or */
+                    g->mgau[s].updatetime != frame - 1      /* It the gaussian was not updated in last frame */
+                    ) {
+                    /*Previous frames, senone s is not computed. 
+                       or the best index is not trusted. 
+                       Use CI score in these cases. */
 #ifdef GAUDEBUG
-                        E_INFO
-                            ("USE CI SENONE SCORE at senone %d time %d\n",
-                             s, frame);
+                    E_INFO
+                        ("USE CI SENONE SCORE at senone %d time %d\n",
+                         s, frame);
 #endif
 
-                        senscr[s] = senscr[cd2cisen[s]];
+                    senscr[s] = senscr[cd2cisen[s]];
 
-                    }
-                    else {
-                        /*Don't change the bstidx and updatetime */
-                        single_el_list[0] = g->mgau[s].bstidx;
+                }
+                else {
+                    /*Don't change the bstidx and updatetime */
+                    single_el_list[0] = g->mgau[s].bstidx;
 
-                        /*ARCHAN: Please don't rewrite this two lines. I want to make a contrast between the two situations. */
-                        if (is_skip)
-                            senscr[s] = mgau_eval(g, s, single_el_list, feat, frame, 1);        /*Update the best idx, such that next frames can use it */
-                        else
-                            senscr[s] = mgau_eval(g, s, single_el_list, feat, frame, 0);        /*Not update the best index in a Gaussian */
+                    /*ARCHAN: Please don't rewrite this two lines. I want to make a contrast between the two situations. */
+                    if (is_skip)
+                        senscr[s] = mgau_eval(g, s, single_el_list, feat, frame, 1);        /*Update the best idx, such that next frames can use it */
+                    else
+                        senscr[s] = mgau_eval(g, s, single_el_list, feat, frame, 0);        /*Not update the best index in a Gaussian */
 
-                        ng++;   /* But don't increase the number of senone compute. It doesn't count. */
+                    ng++;   /* But don't increase the number of senone compute. It doesn't count. */
 
 #ifdef GAUDEBUG
-                        E_INFO
-                            ("RECOMPUTE for senone %d USING BEST INDEX %d time %d, single Gauss score %d, ci score %d, last ci score %d. \n",
-                             s, g->mgau[s].bstidx, frame, senscr[s],
-                             senscr[cd2cisen[s]], g->mgau[s].bstscr);
+                    E_INFO
+                        ("RECOMPUTE for senone %d USING BEST INDEX %d time %d, single Gauss score %d, ci score %d, last ci score %d. \n",
+                         s, g->mgau[s].bstidx, frame, senscr[s],
+                         senscr[cd2cisen[s]], g->mgau[s].bstscr);
 #endif
 
-                    }
                 }
-                if (best < senscr[s])
-                    best = senscr[s];
             }
+            if (best < senscr[s])
+                best = senscr[s];
         }
         /*Make a copy to the most recent active list */
         rec_sen_active[s] = sen_active[s];
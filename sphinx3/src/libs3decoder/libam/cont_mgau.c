@@ -129,6 +129,14 @@
 #include "logs3.h"
 #include "cont_mgau.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define CONT_MGAU_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define CONT_MGAU_NEON
+#include <arm_neon.h>
+#endif
+
 #ifndef M_PI
 #define M_PI	3.1415926535897932385e0
 #endif
@@ -852,6 +860,43 @@ mgau_var_nzvec_floor(mgau_model_t * g, float64 floor)
     return n;
 }
 
+/**
+ * Replace the n x n symmetric matrix a by the upper triangular U with
+ * U^T U = a, and zero below the diagonal.  Returns the number of
+ * pivots that were not positive and had to be floored.
+ */
+static int32
+cholesky_upper(float32 ** a, int32 n)
+{
+    float64 **u, s;
+    int32 i, j, k, n_bad;
+
+    u = (float64 **) ckd_calloc_2d(n, n, sizeof(float64));
+    n_bad = 0;
+    for (i = 0; i < n; i++) {
+        s = a[i][i];
+        for (k = 0; k < i; k++)
+            s -= u[k][i] * u[k][i];
+        if (s <= 0.0) {
+            s = 1e-10;
+            ++n_bad;
+        }
+        u[i][i] = sqrt(s);
+        for (j = i + 1; j < n; j++) {
+            s = a[i][j];
+            for (k = 0; k < i; k++)
+                s -= u[k][i] * u[k][j];
+            u[i][j] = s / u[i][i];
+        }
+    }
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            a[i][j] = (float32) u[i][j];
+    ckd_free_2d((void **) u);
+
+    return n_bad;
+}
+
 /**
  * Some of the Mahalanobis distance computation (between Gaussian density means and given
  * vectors) can be carried out in advance.  (See comment in .h file.)
@@ -876,7 +921,11 @@ mgau_precomp(mgau_model_t * g)
                 lrd = log(lrd);
                 invert(g->mgau[m].fullvar[c], g->mgau[m].fullvar[c],
                        mgau_veclen(g));
-                /* Not doubling it here. */
+                /* Not doubling it here.  Factor the inverse so that
+                 * densities cost a triangular product each. */
+                if (cholesky_upper(g->mgau[m].fullvar[c], mgau_veclen(g)) > 0)
+                    E_WARN("Inverse covariance of mgau %d comp %d is not "
+                           "positive definite\n", m, c);
             }
             else {
                 lrd = 0.0;
@@ -892,6 +941,8 @@ mgau_precomp(mgau_model_t * g)
             mgau_lrd(g, m, c) = (float32) (-0.5 * lrd); /* Reciprocal, sqrt */
         }
     }
+    if (g->mgau[0].fullvar && g->fulldiff == NULL)
+        g->fulldiff = ckd_calloc(mgau_veclen(g), sizeof(float32));
 
     return 0;
 }
@@ -958,15 +1009,120 @@ mgau_init(const char *meanfile,
     return g;
 }
 
+/*
+ * Sum of v[i] * (x[i] - m[i])^2 over veclen dimensions, the scaled
+ * Mahalanobis distance of a diagonal density once mgau_precomp() has
+ * turned its variances into 1/(2 var).  Like the scalar loop,
+ * differences are taken in float32 and the terms summed in float64,
+ * but four dimensions at a time in two pairs of lanes, so the result
+ * differs from a sequential sum only by rounding.
+ */
+static float64
+diag_dist(float32 * x, float32 * m, float32 * v, int32 veclen)
+{
+    float64 d = 0.0, diff;
+    int32 i = 0;
+
+#if defined(CONT_MGAU_SSE2)
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+
+    for (; i + 4 <= veclen; i += 4) {
+        __m128 df = _mm_sub_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(m + i));
+        __m128 vv = _mm_loadu_ps(v + i);
+        __m128d d0 = _mm_cvtps_pd(df);
+        __m128d d1 = _mm_cvtps_pd(_mm_movehl_ps(df, df));
+
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_mul_pd(d0, d0),
+                                           _mm_cvtps_pd(vv)));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_mul_pd(d1, d1),
+                                           _mm_cvtps_pd(_mm_movehl_ps(vv, vv))));
+    }
+    acc0 = _mm_add_pd(acc0, acc1);
+    acc0 = _mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0));
+    d = _mm_cvtsd_f64(acc0);
+#elif defined(CONT_MGAU_NEON)
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = vdupq_n_f64(0.0);
+
+    for (; i + 4 <= veclen; i += 4) {
+        float32x4_t df = vsubq_f32(vld1q_f32(x + i), vld1q_f32(m + i));
+        float32x4_t vv = vld1q_f32(v + i);
+        float64x2_t d0 = vcvt_f64_f32(vget_low_f32(df));
+        float64x2_t d1 = vcvt_high_f64_f32(df);
+
+        acc0 = vaddq_f64(acc0, vmulq_f64(vmulq_f64(d0, d0),
+                                         vcvt_f64_f32(vget_low_f32(vv))));
+        acc1 = vaddq_f64(acc1, vmulq_f64(vmulq_f64(d1, d1),
+                                         vcvt_high_f64_f32(vv)));
+    }
+    d = vaddvq_f64(vaddq_f64(acc0, acc1));
+#endif
+
+    for (; i < veclen; i++) {
+        diff = x[i] - m[i];
+        d += diff * diff * v[i];
+    }
+
+    return d;
+}
+
+/*
+ * Sum of a[i] * b[i] over n elements, in float64, four at a time
+ * where SSE2 or NEON is available.
+ */
+static float64
+dot_f32(float32 * a, float32 * b, int32 n)
+{
+    float64 d = 0.0;
+    int32 i = 0;
+
+#if defined(CONT_MGAU_SSE2)
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+
+    for (; i + 4 <= n; i += 4) {
+        __m128 aa = _mm_loadu_ps(a + i);
+        __m128 bb = _mm_loadu_ps(b + i);
+
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_cvtps_pd(aa),
+                                           _mm_cvtps_pd(bb)));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(aa, aa)),
+                                           _mm_cvtps_pd(_mm_movehl_ps(bb, bb))));
+    }
+    acc0 = _mm_add_pd(acc0, acc1);
+    acc0 = _mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0));
+    d = _mm_cvtsd_f64(acc0);
+#elif defined(CONT_MGAU_NEON)
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = vdupq_n_f64(0.0);
+
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t aa = vld1q_f32(a + i);
+        float32x4_t bb = vld1q_f32(b + i);
+
+        acc0 = vaddq_f64(acc0, vmulq_f64(vcvt_f64_f32(vget_low_f32(aa)),
+                                         vcvt_f64_f32(vget_low_f32(bb))));
+        acc1 = vaddq_f64(acc1, vmulq_f64(vcvt_high_f64_f32(aa),
+                                         vcvt_high_f64_f32(bb)));
+    }
+    d = vaddvq_f64(vaddq_f64(acc0, acc1));
+#endif
+
+    for (; i < n; i++)
+        d += (float64) a[i] * b[i];
+
+    return d;
+}
+
 int32
 mgau_comp_eval(mgau_model_t * g, int32 s, float32 * x, int32 * score)
 {
     mgau_t *mgau;
     int32 veclen;
-    float32 *m, *v;
-    float64 dval, diff, f;
+    float64 dval, f;
     int32 bs;
-    int32 i, c;
+    int32 c;
 
     veclen = mgau_veclen(g);
     mgau = &(g->mgau[s]);
@@ -974,14 +1130,7 @@ mgau_comp_eval(mgau_model_t * g, int32 s, float32 * x, int32 * score)
 
     bs = MAX_NEG_INT32;
     for (c = 0; c < mgau->n_comp; c++) {
-        m = mgau->mean[c];
-        v = mgau->var[c];
-        dval = mgau->lrd[c];
-
-        for (i = 0; i < veclen; i++) {
-            diff = x[i] - m[i];
-            dval -= diff * diff * v[i];
-        }
+        dval = mgau->lrd[c] - diag_dist(x, mgau->mean[c], mgau->var[c], veclen);
 
         if (dval < g->distfloor)
             dval = g->distfloor;
@@ -994,131 +1143,64 @@ mgau_comp_eval(mgau_model_t * g, int32 s, float32 * x, int32 * score)
     return bs;
 }
 
+/*
+ * Full covariance density.  mgau_precomp() has replaced the covariance
+ * by the upper triangular U with U^T U = sigma^-1, so the Mahalanobis
+ * distance (x-m) sigma^-1 (x-m)^T is the squared length of U (x-m)^T.
+ * Row i of U is zero before column i, so it takes a dot product of
+ * veclen - i elements.  diff is scratch space for veclen floats.
+ */
 static float64
-mgau_density_full(mgau_t * mgau, int32 veclen, int32 c, float32 * x)
+mgau_density_full(mgau_t * mgau, int32 veclen, int32 c, float32 * x,
+                  float32 * diff)
 {
-    float32 *mean, **var_inv;
-    float64 *diff, *vtmp, d;
-    uint32 i, j;
+    float32 *mean, **chol;
+    float64 d, y;
+    int32 i;
 
     mean = mgau->mean[c];
-    var_inv = mgau->fullvar[c];
+    chol = mgau->fullvar[c];
 
-    /* Precompute x-m */
-    diff = ckd_malloc(veclen * sizeof(float64));
     for (i = 0; i < veclen; i++)
         diff[i] = x[i] - mean[i];
 
-    /* Compute -0.5 * (x-m) * sigma^-1 * (x-m)^T */
-    /* FIXME: We could probably use BLAS for this, though it is
-     * unclear if that would actually be faster (particularly with
-     * refblas) */
-    vtmp = ckd_calloc(veclen, sizeof(float64));
-    for (i = 0; i < veclen; ++i)
-        for (j = 0; j < veclen; ++j)
-            vtmp[j] += var_inv[i][j] * diff[i];
     d = 0.0;
-    for (i = 0; i < veclen; ++i)
-        d += diff[i] * vtmp[i];
-    ckd_free(vtmp);
-    ckd_free(diff);
-
-    /* If it's negative, the covariance was probably singular (but
-     * still appeared positive-definite due to imprecision). */
-    if (d < 0.0) {
-        /* E_WARN("Bad Mahalanobis distance %g\n", d); */
-        /* Give it some very small likelihood. */
-        d = -d;
+    for (i = 0; i < veclen; ++i) {
+        y = dot_f32(chol[i] + i, diff + i, veclen - i);
+        d += y * y;
     }
+
     return mgau->lrd[c] - 0.5 * d;
 }
 
 static int32
 mgau_eval_all(mgau_t * mgau, float32 * x, int32 veclen, float64 distfloor,
-              int32 update_best_id, logmath_t * logmath)
+              int32 update_best_id, logmath_t * logmath, float32 * diff)
 {
-    float32 *m1, *m2, *v1, *v2;
-    float64 dval1, dval2, diff1, diff2, f;
+    float64 dval1, f;
     int32 gauscr;               /* This equals to (1.0 / log(logmath_get_base())) * dval1 + the mixture weight */
-    int32 score, i, c;
+    int32 score, c;
 
     f = 1.0 / log(logmath_get_base(logmath));
     score = S3_LOGPROB_ZERO;
 
-    for (c = 0; c < mgau->n_comp - 1; c += 2) { /* Interleave 2 components for speed */
-        if (mgau->fullvar) {
-            dval1 = mgau_density_full(mgau, veclen, c, x);
-            dval2 = mgau_density_full(mgau, veclen, c + 1, x);
-        }
-        else {
-            m1 = mgau->mean[c];
-            m2 = mgau->mean[c + 1];
-            v1 = mgau->var[c];
-            v2 = mgau->var[c + 1];
-            dval1 = mgau->lrd[c];
-            dval2 = mgau->lrd[c + 1];
-
-            for (i = 0; i < veclen; i++) {
-                diff1 = x[i] - m1[i];
-                dval1 -= diff1 * diff1 * v1[i];
-                diff2 = x[i] - m2[i];
-                dval2 -= diff2 * diff2 * v2[i];
-            }
-        }
+    for (c = 0; c < mgau->n_comp; c++) {
+        if (mgau->fullvar)
+            dval1 = mgau_density_full(mgau, veclen, c, x, diff);
+        else
+            dval1 = mgau->lrd[c]
+                - diag_dist(x, mgau->mean[c], mgau->var[c], veclen);
 
         if (dval1 < distfloor)  /* Floor */
             dval1 = distfloor;
-        if (dval2 < distfloor)
-            dval2 = distfloor;
 
-        /*          E_INFO("Score %f, Index %d\n",dval1, c);
-           E_INFO("Score %f, Index %d\n",dval2, c+1); */
         gauscr = (int32) (f * dval1) + mgau->mixw[c];
 
         score = logmath_add(logmath, score, gauscr);
-        if (gauscr > mgau->bstscr) {
-            mgau->bstidx = c;
-            mgau->bstscr = gauscr;
-        }
-
-        gauscr = (int32) (f * dval2) + mgau->mixw[c + 1];
-
-        score = logmath_add(logmath, score, gauscr);
-        if (update_best_id && gauscr > mgau->bstscr) {
-            mgau->bstidx = c + 1;
-            mgau->bstscr = gauscr;
-        }
-    }
-
-    /* Remaining iteration if n_mean odd */
-    if (c < mgau->n_comp) {
-        if (mgau->fullvar) {
-            dval1 = mgau_density_full(mgau, veclen, c, x);
-        }
-        else {
-            m1 = mgau->mean[c];
-            v1 = mgau->var[c];
-            dval1 = mgau->lrd[c];
-
-            for (i = 0; i < veclen; i++) {
-                diff1 = x[i] - m1[i];
-                dval1 -= diff1 * diff1 * v1[i];
-            }
-        }
-
-        if (dval1 < distfloor)
-            dval1 = distfloor;
-
-        /*E_INFO("Score %f, Index %d\n",dval1, c); */
-
-        gauscr = (int32) (f * dval1) + mgau->mixw[c];
-        score = logmath_add(logmath, score, gauscr);
-
         if (update_best_id && gauscr > mgau->bstscr) {
             mgau->bstidx = c;
             mgau->bstscr = gauscr;
         }
-
     }
     /*E_INFO("No Short List m %d, Best Index %d, Best Score %d, Total Score %d\n",m,mgau->bstidx,mgau->bstscr,score); */
     return score;
@@ -1126,12 +1208,12 @@ mgau_eval_all(mgau_t * mgau, float32 * x, int32 veclen, float64 distfloor,
 
 static int32
 mgau_eval_active(mgau_t * mgau, float32 * x, int32 veclen,
-                 float64 distfloor, int32 * active, int32 update_best_id, logmath_t * logmath)
+                 float64 distfloor, int32 * active, int32 update_best_id,
+                 logmath_t * logmath, float32 * diff)
 {
-    float32 *m1, *v1;
-    float64 dval1, diff1, f;
+    float64 dval1, f;
     int32 gauscr;               /* This equals to (1.0 / log(logmath_get_base())) * dval1 + the mixture weight */
-    int32 score, i, j, c;
+    int32 score, j, c;
 
     f = 1.0 / log(logmath_get_base(logmath));
     score = S3_LOGPROB_ZERO;
@@ -1139,16 +1221,10 @@ mgau_eval_active(mgau_t * mgau, float32 * x, int32 veclen,
         c = active[j];
 
         if (mgau->fullvar)
-            dval1 = mgau_density_full(mgau, veclen, c, x);
+            dval1 = mgau_density_full(mgau, veclen, c, x, diff);
         else {
-            m1 = mgau->mean[c];
-            v1 = mgau->var[c];
-            dval1 = mgau->lrd[c];
-
-            for (i = 0; i < veclen; i++) {
-                diff1 = x[i] - m1[i];
-                dval1 -= diff1 * diff1 * v1[i];
-            }
+            dval1 = mgau->lrd[c]
+                - diag_dist(x, mgau->mean[c], mgau->var[c], veclen);
 
             if (dval1 < distfloor)
                 dval1 = distfloor;
@@ -1192,12 +1268,13 @@ mgau_eval(mgau_model_t * g, int32 m, int32 * active, float32 * x, int32 fr,
 
     if (!active) {              /* No short list; use all */
         score =
-            mgau_eval_all(mgau, x, veclen, g->distfloor, update_best_id, g->logmath);
+            mgau_eval_all(mgau, x, veclen, g->distfloor, update_best_id,
+                          g->logmath, g->fulldiff);
     }
     else {
         score =
             mgau_eval_active(mgau, x, veclen, g->distfloor, active,
-                             update_best_id, g->logmath);
+                             update_best_id, g->logmath, g->fulldiff);
     }
 
     if (score <= S3_LOGPROB_ZERO) {
@@ -1207,6 +1284,45 @@ mgau_eval(mgau_model_t * g, int32 m, int32 * active, float32 * x, int32 fr,
     return score;
 }
 
+void
+mgau_eval_frames(mgau_model_t * g, int32 m, float32 ** x, int32 n_frames,
+                 int32 * score)
+{
+    mgau_t *mgau;
+    int32 veclen, c, fr, gauscr;
+    float64 dval, f;
+
+    veclen = mgau_veclen(g);
+    mgau = &(g->mgau[m]);
+    assert(g->comp_type == MIX_INT_FLOAT_COMP);
+    f = 1.0 / log(logmath_get_base(g->logmath));
+
+    for (fr = 0; fr < n_frames; fr++)
+        score[fr] = S3_LOGPROB_ZERO;
+
+    /* Same sums in the same order as mgau_eval_all(), with the loops
+     * turned around so that one mean and variance serve the block. */
+    for (c = 0; c < mgau->n_comp; c++) {
+        for (fr = 0; fr < n_frames; fr++) {
+            if (mgau->fullvar)
+                dval = mgau_density_full(mgau, veclen, c, x[fr], g->fulldiff);
+            else
+                dval = mgau->lrd[c]
+                    - diag_dist(x[fr], mgau->mean[c], mgau->var[c], veclen);
+
+            if (dval < g->distfloor)
+                dval = g->distfloor;
+
+            gauscr = (int32) (f * dval) + mgau->mixw[c];
+            score[fr] = logmath_add(g->logmath, score[fr], gauscr);
+        }
+    }
+
+    for (fr = 0; fr < n_frames; fr++)
+        if (score[fr] <= S3_LOGPROB_ZERO)
+            score[fr] = S3_LOGPROB_ZERO;
+}
+
 /* RAH, free memory allocated in mgau_init
    I've not verified that this function catches all of the leaks, just most of them.
  */
@@ -1245,6 +1361,8 @@ mgau_free(mgau_model_t * g)
         if (g->mgau[0].lrd)
             ckd_free((void *) g->mgau[0].lrd);
 
+        ckd_free(g->fulldiff);
+
         /* Free memory allocated for the mixture weights */
 
         if (g->mgau[0].mixw)
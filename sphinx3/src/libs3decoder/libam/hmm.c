@@ -876,6 +876,439 @@ hmm_vit_eval(hmm_t * hmm)
     }
 }
 
+/*
+ * Batch evaluation.  The fields of HMM_BATCH HMMs are copied into
+ * vectors with one lane per HMM, evaluated with the same arithmetic
+ * as the code above but with selects in place of branches, and
+ * copied back.  Histories are a whole union, too wide to share a
+ * vector with the scores, so the lanes instead carry the state each
+ * new score came from, and histories (and multiplex senone sequence
+ * IDs) are moved accordingly on the way out.  This needs the GCC
+ * vector extensions; elsewhere the HMMs are simply evaluated one at
+ * a time.
+ */
+#if defined(__GNUC__)
+#define HMM_BATCH_VEC
+#if defined(__x86_64__) || defined(__i386__)
+#define HMM_BATCH_AVX2
+#endif
+/* The kernels are inlined into a version of the code for each target. */
+#define HMM_BATCH_INLINE static __inline__ __attribute__((always_inline))
+
+typedef int32 hmm_bvec_t __attribute__((vector_size(HMM_BATCH * sizeof(int32))));
+
+typedef struct hmm_batch_s {
+    hmm_bvec_t score[MAX_HMM_NSTATE];
+    hmm_bvec_t senscr[MAX_HMM_NSTATE]; /**< 0 where the state has no senone. */
+    hmm_bvec_t valid[MAX_HMM_NSTATE];  /**< MPX: all ones where ssid != -1. */
+    hmm_bvec_t tp[MAX_HMM_NSTATE][3];  /**< Transitions from i to i+k. */
+    hmm_bvec_t from[MAX_HMM_NSTATE];   /**< State each new score came from. */
+    hmm_bvec_t out_score;
+    hmm_bvec_t out_from;               /**< -1 if the exit state is unchanged. */
+    hmm_bvec_t bestscore;
+} hmm_batch_t;
+
+/* All lanes set to x. */
+#define batch_splat(x) ((hmm_bvec_t){ 0 } + (x))
+/* Lanes of a where m is set, otherwise those of b. */
+#define batch_sel(m, a, b) (((m) & (a)) | (~(m) & (b)))
+#define batch_clamp(s) batch_sel((s) < worst, worst, (s))
+#define batch_best(s, t) batch_sel((s) > (t), (s), (t))
+#define batch_tprob(i, k) b->tp[i][k]
+#define batch_active(s) ((s) != worst)
+/* Best of t0, t1 and t2 (from states a, b and c) as the nested
+ * comparisons above choose it, into m and hm. */
+#define batch_best3(t0, a, t1, b, t2, c) do {           \
+        hmm_bvec_t c1_ = (t0) > (t1), c2_;              \
+        m = batch_sel(c1_, t0, t1);                     \
+        hm = batch_sel(c1_, batch_splat(a), batch_splat(b));    \
+        c2_ = (t2) > m;                                 \
+        m = batch_sel(c2_, t2, m);                      \
+        hm = batch_sel(c2_, batch_splat(c), hm);        \
+    } while (0)
+
+static void
+hmm_batch_load(hmm_batch_t *b, hmm_t **hmm, int n_state, int mpx)
+{
+    const int32 *senscore = hmm[0]->ctx->senscore;
+    const s3senid_t **sseq = hmm[0]->ctx->sseq;
+    int i, j, k;
+
+    for (j = 0; j < HMM_BATCH; ++j) {
+        hmm_t *h = hmm[j];
+        const int32 *tp = h->ctx->tp[h->tmatid][0];
+
+        for (i = 0; i < n_state; ++i) {
+            b->score[i][j] = hmm_score(h, i);
+            if (mpx) {
+                int32 ssid = h->s.mpx_ssid[i];
+
+                b->valid[i][j] = (ssid == -1) ? 0 : -1;
+                b->senscr[i][j] = (ssid == -1)
+                    ? 0 : senscore[sseq[ssid][i]];
+            }
+            else
+                b->senscr[i][j] = senscore[sseq[h->s.ssid][i]];
+            for (k = 0; k < 3 && i + k <= n_state; ++k)
+                b->tp[i][k][j] = tp[i * (n_state + 1) + i + k];
+        }
+        b->out_score[j] = hmm_out_score(h);
+    }
+    for (i = 0; i < n_state; ++i)
+        b->from[i] = batch_splat(i);
+}
+
+static int32
+hmm_batch_store(hmm_batch_t const *b, hmm_t **hmm, int n_state)
+{
+    int32 bestscore = WORST_SCORE;
+    int i, j;
+
+    for (j = 0; j < HMM_BATCH; ++j) {
+        hmm_t *h = hmm[j];
+        hmm_state_t old[MAX_HMM_NSTATE];
+        int32 old_ssid[MAX_HMM_NSTATE];
+
+        memcpy(old, h->state, n_state * sizeof(*old));
+        if (hmm_is_mpx(h))
+            memcpy(old_ssid, h->s.mpx_ssid, n_state * sizeof(*old_ssid));
+        for (i = 0; i < n_state; ++i) {
+            int32 from = b->from[i][j];
+
+            hmm_score(h, i) = b->score[i][j];
+            hmm_history(h, i) = old[from].history;
+            if (hmm_is_mpx(h))
+                h->s.mpx_ssid[i] = old_ssid[from];
+        }
+        hmm_out_score(h) = b->out_score[j];
+        if (b->out_from[j] >= 0)
+            hmm_out_history(h) = old[b->out_from[j]].history;
+        hmm_bestscore(h) = b->bestscore[j];
+        if (b->bestscore[j] > bestscore)
+            bestscore = b->bestscore[j];
+    }
+    return bestscore;
+}
+
+/* As hmm_vit_eval_5st_lr(). */
+HMM_BATCH_INLINE void
+hmm_batch_5st_lr(hmm_batch_t *b)
+{
+    hmm_bvec_t const worst = batch_splat(WORST_SCORE);
+    hmm_bvec_t s5, s4, s3, s2, s1, s0, t2, t1, t0, m, hm, bs, c;
+
+    s4 = b->score[4] + b->senscr[4];
+    s3 = b->score[3] + b->senscr[3];
+    /* Avoid wraparound */
+    s4 = batch_clamp(s4);
+
+    /* Transitions into non-emitting state 5, if state 3 is active */
+    t1 = s4 + batch_tprob(4, 1);
+    t2 = s3 + batch_tprob(3, 2);
+    c = t1 > t2;
+    s5 = batch_clamp(batch_sel(c, t1, t2));
+    hm = batch_sel(c, batch_splat(4), batch_splat(3));
+    c = s3 > worst;
+    b->out_score = batch_sel(c, s5, b->out_score);
+    b->out_from = batch_sel(c, hm, batch_splat(-1));
+    bs = batch_sel(c, s5, worst);
+
+    s2 = b->score[2] + b->senscr[2];
+    /* All transitions into state 4, if state 2 is active */
+    t0 = s4 + batch_tprob(4, 0);
+    t1 = s3 + batch_tprob(3, 1);
+    t2 = s2 + batch_tprob(2, 2);
+    batch_best3(t0, 4, t1, 3, t2, 2);
+    m = batch_clamp(m);
+    c = s2 > worst;
+    b->score[4] = batch_sel(c, m, b->score[4]);
+    b->from[4] = batch_sel(c, hm, b->from[4]);
+    bs = batch_sel(c, batch_best(m, bs), bs);
+
+    s1 = b->score[1] + b->senscr[1];
+    /* All transitions into state 3, if state 1 is active */
+    t0 = s3 + batch_tprob(3, 0);
+    t1 = s2 + batch_tprob(2, 1);
+    t2 = s1 + batch_tprob(1, 2);
+    batch_best3(t0, 3, t1, 2, t2, 1);
+    m = batch_clamp(m);
+    c = s1 > worst;
+    b->score[3] = batch_sel(c, m, b->score[3]);
+    b->from[3] = batch_sel(c, hm, b->from[3]);
+    bs = batch_sel(c, batch_best(m, bs), bs);
+
+    s0 = b->score[0] + b->senscr[0];
+    /* All transitions into state 2 (state 0 is always active) */
+    t0 = s2 + batch_tprob(2, 0);
+    t1 = s1 + batch_tprob(1, 1);
+    t2 = s0 + batch_tprob(0, 2);
+    batch_best3(t0, 2, t1, 1, t2, 0);
+    m = batch_clamp(m);
+    b->score[2] = m;
+    b->from[2] = hm;
+    bs = batch_best(m, bs);
+
+    /* All transitions into state 1 */
+    t0 = s1 + batch_tprob(1, 0);
+    t1 = s0 + batch_tprob(0, 1);
+    c = t0 > t1;
+    m = batch_clamp(batch_sel(c, t0, t1));
+    b->score[1] = m;
+    b->from[1] = batch_sel(c, batch_splat(1), batch_splat(0));
+    bs = batch_best(m, bs);
+
+    /* All transitions into state 0 */
+    m = batch_clamp(s0 + batch_tprob(0, 0));
+    b->score[0] = m;
+    b->bestscore = batch_best(m, bs);
+}
+
+/* As hmm_vit_eval_5st_lr_mpx(). */
+HMM_BATCH_INLINE void
+hmm_batch_5st_lr_mpx(hmm_batch_t *b)
+{
+    hmm_bvec_t const worst = batch_splat(WORST_SCORE);
+    hmm_bvec_t s5, s4, s3, s2, s1, s0, t2, t1, t0, m, hm, bs, c;
+
+    /* Don't propagate WORST_SCORE */
+    s4 = batch_sel(b->valid[4], b->score[4] + b->senscr[4], worst);
+    t1 = batch_sel(b->valid[4], s4 + batch_tprob(4, 1), worst);
+    s3 = batch_sel(b->valid[3], b->score[3] + b->senscr[3], worst);
+    t2 = batch_sel(b->valid[3], s3 + batch_tprob(3, 2), worst);
+    c = t1 > t2;
+    s5 = batch_clamp(batch_sel(c, t1, t2));
+    b->out_score = s5;
+    b->out_from = batch_sel(c, batch_splat(4), batch_splat(3));
+    bs = s5;
+
+    /* Don't propagate WORST_SCORE */
+    s2 = batch_sel(b->valid[2], b->score[2] + b->senscr[2], worst);
+    t2 = batch_sel(b->valid[2], s2 + batch_tprob(2, 2), worst);
+    t0 = batch_sel(batch_active(s4), s4 + batch_tprob(4, 0), worst);
+    t1 = batch_sel(batch_active(s3), s3 + batch_tprob(3, 1), worst);
+    batch_best3(t0, 4, t1, 3, t2, 2);
+    m = batch_clamp(m);
+    b->score[4] = m;
+    b->from[4] = hm;
+    bs = batch_best(m, bs);
+
+    /* Don't propagate WORST_SCORE */
+    s1 = batch_sel(b->valid[1], b->score[1] + b->senscr[1], worst);
+    t2 = batch_sel(b->valid[1], s1 + batch_tprob(1, 2), worst);
+    t0 = batch_sel(batch_active(s3), s3 + batch_tprob(3, 0), worst);
+    t1 = batch_sel(batch_active(s2), s2 + batch_tprob(2, 1), worst);
+    batch_best3(t0, 3, t1, 2, t2, 1);
+    m = batch_clamp(m);
+    b->score[3] = m;
+    b->from[3] = hm;
+    bs = batch_best(m, bs);
+
+    /* State 0 is always active */
+    s0 = b->score[0] + b->senscr[0];
+
+    /* Don't propagate WORST_SCORE */
+    t0 = batch_sel(batch_active(s2), s2 + batch_tprob(2, 0), worst);
+    t1 = batch_sel(batch_active(s1), s1 + batch_tprob(1, 1), worst);
+    t2 = s0 + batch_tprob(0, 2);
+    batch_best3(t0, 2, t1, 1, t2, 0);
+    m = batch_clamp(m);
+    b->score[2] = m;
+    b->from[2] = hm;
+    bs = batch_best(m, bs);
+
+    /* Don't propagate WORST_SCORE */
+    t0 = batch_sel(batch_active(s1), s1 + batch_tprob(1, 0), worst);
+    t1 = s0 + batch_tprob(0, 1);
+    c = t0 > t1;
+    m = batch_clamp(batch_sel(c, t0, t1));
+    b->score[1] = m;
+    b->from[1] = batch_sel(c, batch_splat(1), batch_splat(0));
+    bs = batch_best(m, bs);
+
+    m = batch_clamp(s0 + batch_tprob(0, 0));
+    b->score[0] = m;
+    b->bestscore = batch_best(m, bs);
+}
+
+/* As hmm_vit_eval_3st_lr(). */
+HMM_BATCH_INLINE void
+hmm_batch_3st_lr(hmm_batch_t *b)
+{
+    hmm_bvec_t const worst = batch_splat(WORST_SCORE);
+    hmm_bvec_t s3, s2, s1, s0, t2, t1, t0, m, hm, bs, c;
+
+    s2 = b->score[2] + b->senscr[2];
+    s1 = b->score[1] + b->senscr[1];
+    s0 = b->score[0] + b->senscr[0];
+
+    /* Transitions into non-emitting state 3 */
+    c = s2 > worst;
+    t1 = batch_sel(c, s2 + batch_tprob(2, 1), worst);
+    t0 = batch_sel(c, s2 + batch_tprob(2, 0), worst);
+    t2 = batch_sel((s1 > worst) & (batch_tprob(1, 2) > worst),
+                   s1 + batch_tprob(1, 2), batch_splat(INT_MIN));
+    c = t1 > t2;
+    s3 = batch_clamp(batch_sel(c, t1, t2));
+    b->out_score = s3;
+    b->out_from = batch_sel(c, batch_splat(2), batch_splat(1));
+    bs = s3;
+
+    /* All transitions into state 2 (state 0 is always active) */
+    t1 = batch_sel(s1 > worst, s1 + batch_tprob(1, 1), worst);
+    t2 = batch_sel(batch_tprob(0, 2) > worst,
+                   s0 + batch_tprob(0, 2), worst);
+    batch_best3(t0, 2, t1, 1, t2, 0);
+    m = batch_clamp(m);
+    b->score[2] = m;
+    b->from[2] = hm;
+    bs = batch_best(m, bs);
+
+    /* All transitions into state 1 */
+    t0 = batch_sel(s1 > worst, s1 + batch_tprob(1, 0), worst);
+    t1 = batch_sel(s0 > worst, s0 + batch_tprob(0, 1), worst);
+    c = t0 > t1;
+    m = batch_clamp(batch_sel(c, t0, t1));
+    b->score[1] = m;
+    b->from[1] = batch_sel(c, batch_splat(1), batch_splat(0));
+    bs = batch_best(m, bs);
+
+    /* All transitions into state 0 */
+    m = batch_clamp(s0 + batch_tprob(0, 0));
+    b->score[0] = m;
+    b->bestscore = batch_best(m, bs);
+}
+
+/* As hmm_vit_eval_3st_lr_mpx(). */
+HMM_BATCH_INLINE void
+hmm_batch_3st_lr_mpx(hmm_batch_t *b)
+{
+    hmm_bvec_t const worst = batch_splat(WORST_SCORE);
+    hmm_bvec_t s3, s2, s1, s0, t2, t1, t0, m, hm, bs, c;
+
+    /* Don't propagate WORST_SCORE */
+    s2 = batch_sel(b->valid[2],
+                   batch_clamp(b->score[2] + b->senscr[2]), worst);
+    t1 = batch_sel(b->valid[2], s2 + batch_tprob(2, 1), worst);
+    s1 = batch_sel(b->valid[1],
+                   batch_clamp(b->score[1] + b->senscr[1]), worst);
+    t2 = batch_sel(b->valid[1], s1 + batch_tprob(1, 2),
+                   batch_splat(INT_MIN));
+    c = t1 > t2;
+    s3 = batch_clamp(batch_sel(c, t1, t2));
+    b->out_score = s3;
+    b->out_from = batch_sel(c, batch_splat(2), batch_splat(1));
+    bs = s3;
+
+    /* State 0 is always active */
+    s0 = batch_clamp(b->score[0] + b->senscr[0]);
+
+    /* Don't propagate WORST_SCORE */
+    t0 = batch_sel(batch_active(s2), s2 + batch_tprob(2, 0), worst);
+    t1 = batch_sel(batch_active(s1), s1 + batch_tprob(1, 1), worst);
+    t2 = batch_sel(batch_tprob(0, 2) > worst, s0 + batch_tprob(0, 2), t2);
+    batch_best3(t0, 2, t1, 1, t2, 0);
+    m = batch_clamp(m);
+    b->score[2] = m;
+    b->from[2] = hm;
+    bs = batch_best(m, bs);
+
+    /* Don't propagate WORST_SCORE */
+    t0 = batch_sel(batch_active(s1), s1 + batch_tprob(1, 0), worst);
+    t1 = s0 + batch_tprob(0, 1);
+    c = t0 > t1;
+    m = batch_clamp(batch_sel(c, t0, t1));
+    b->score[1] = m;
+    b->from[1] = batch_sel(c, batch_splat(1), batch_splat(0));
+    bs = batch_best(m, bs);
+
+    /* State 0 is always active */
+    m = batch_clamp(s0 + batch_tprob(0, 0));
+    b->score[0] = m;
+    b->bestscore = batch_best(m, bs);
+}
+
+HMM_BATCH_INLINE void
+hmm_batch_eval(hmm_batch_t *b, int n_state, int mpx)
+{
+    if (mpx) {
+        if (n_state == 5)
+            hmm_batch_5st_lr_mpx(b);
+        else
+            hmm_batch_3st_lr_mpx(b);
+    }
+    else {
+        if (n_state == 5)
+            hmm_batch_5st_lr(b);
+        else
+            hmm_batch_3st_lr(b);
+    }
+}
+
+static void
+hmm_batch_eval_default(hmm_batch_t *b, int n_state, int mpx)
+{
+    hmm_batch_eval(b, n_state, mpx);
+}
+
+#ifdef HMM_BATCH_AVX2
+__attribute__((target("avx2")))
+static void
+hmm_batch_eval_avx2(hmm_batch_t *b, int n_state, int mpx)
+{
+    hmm_batch_eval(b, n_state, mpx);
+}
+#endif
+
+/* Can hmm[0] to hmm[HMM_BATCH-1] be done together? */
+static int
+hmm_batch_ok(hmm_t **hmm)
+{
+    int i;
+
+    if (hmm_n_emit_state(hmm[0]) != 3 && hmm_n_emit_state(hmm[0]) != 5)
+        return FALSE;
+    for (i = 1; i < HMM_BATCH; ++i)
+        if (hmm_n_emit_state(hmm[i]) != hmm_n_emit_state(hmm[0])
+            || hmm_is_mpx(hmm[i]) != hmm_is_mpx(hmm[0]))
+            return FALSE;
+    return TRUE;
+}
+#endif /* __GNUC__ */
+
+int32
+hmm_vit_eval_batch(hmm_t **hmm, int32 n_hmm)
+{
+#ifdef HMM_BATCH_VEC
+    void (*batch_eval)(hmm_batch_t *, int, int) = hmm_batch_eval_default;
+    hmm_batch_t b;
+#endif
+    int32 bestscore, score;
+    int32 i;
+
+#ifdef HMM_BATCH_AVX2
+    if (__builtin_cpu_supports("avx2"))
+        batch_eval = hmm_batch_eval_avx2;
+#endif
+    bestscore = WORST_SCORE;
+    for (i = 0; i < n_hmm; ) {
+#ifdef HMM_BATCH_VEC
+        if (i + HMM_BATCH <= n_hmm && hmm_batch_ok(hmm + i)) {
+            int n_state = hmm_n_emit_state(hmm[i]);
+
+            hmm_batch_load(&b, hmm + i, n_state, hmm_is_mpx(hmm[i]));
+            (*batch_eval)(&b, n_state, hmm_is_mpx(hmm[i]));
+            score = hmm_batch_store(&b, hmm + i, n_state);
+            i += HMM_BATCH;
+        }
+        else
+#endif
+            score = hmm_vit_eval(hmm[i++]);
+        if (score > bestscore)
+            bestscore = score;
+    }
+    return bestscore;
+}
+
 int32
 hmm_dump_vit_eval(hmm_t * hmm, FILE * fp)
 {
@@ -1,65628 +0,0 @@
-/* ====================================================================
- * Copyright (c) 1999-2001 Carnegie Mellon University.  All rights
- * reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions
- * are met:
- *
- * 1. Redistributions of source code must retain the above copyright
- *    notice, this list of conditions and the following disclaimer. 
- *
- * 2. Redistributions in binary form must reproduce the above copyright
- *    notice, this list of conditions and the following disclaimer in
- *    the documentation and/or other materials provided with the
- *    distribution.
- *
- *
- * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
- * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
- * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
- * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
- * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
- * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
- * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
- * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
- * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
- * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *
- * ====================================================================
- *
- */
-
-/*
- * log_add.h -- Lookup table for addition for 8-bit logprob values.
- *
- * **********************************************
- * CMU ARPA Speech Project
- *
- * Copyright (c) 1996 Carnegie Mellon University.
- * ALL RIGHTS RESERVED.
- * **********************************************
- * 
- * HISTORY
- * 
- * $Log$
- * Revision 1.1  2006/04/05  20:14:26  dhdfu
- * Add cut-down support for Sphinx-2 fast GMM computation (from
- * PocketSphinx).  This does *not* support Sphinx2 format models, but
- * rather semi-continuous Sphinx3 models.  I'll try to write a model
- * converter at some point soon.
- * 
- * Unfortunately the smallest models I have for testing don't do so well
- * on the AN4 test sentence (should use AN4 models, maybe...) so it comes
- * with a "don't panic" warning.
- * 
- * Revision 1.1  2006/04/04 04:25:17  dhuggins
- * Add a cut-down version of sphinx2 fast GMM computation (SCVQ) from
- * PocketSphinx.  Not enabled or tested yet.  Doesn't support Sphinx2
- * models (write an external conversion tool instead, please).  Hopefully
- * this will put an end to me complaining about Sphinx3 being too slow :-)
- *
- * Revision 1.1  2005/10/04 02:06:51  dhuggins
- * Put the quantized log-add table in its place
- *
- * Revision 1.5  2004/12/10 16:48:55  rkm
- * Added continuous density acoustic model handling
- *
- * 
- * 16-May-95	M K Ravishankar (rkm@cs.cmu.edu) at Carnegie Mellon University
- * 		Created.
- */
-
-
-#ifndef __S2_LOGADD_H__
-#define __S2_LOGADD_H__		1
-
-
-/* Table for adding probs in log domain.  (See add_table.h for log base
- * and definition of LOG.):
- * (NOTE: Works only within the limited dynamic range of SCVQ, which keeps
- * the indexes into logadd_tbl within 255.)
- * 
- * LOG(p1+p2) = -(logadd_tbl[(-LOG(p1))>>10][(-LOG(p2))>>10] << 10).
- * 
- * (Although logically defined as a 2-d array, logadd_tbl is flattened out
- * below.)
- */
-unsigned char logadd_tbl[] = {
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    1,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    1,
-    1,
-    1,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    2,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    1,
-    1,
-    2,
-    2,
-    2,
-    2,
-    2,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    3,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    1,
-    2,
-    2,
-    2,
-    2,
-    3,
-    3,
-    3,
-    3,
-    3,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    4,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    1,
-    2,
-    2,
-    2,
-    3,
-    3,
-    3,
-    3,
-    4,
-    4,
-    4,
-    4,
-    4,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    5,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    2,
-    2,
-    2,
-    3,
-    3,
-    3,
-    4,
-    4,
-    4,
-    4,
-    5,
-    5,
-    5,
-    5,
-    5,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    6,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    2,
-    2,
-    3,
-    3,
-    3,
-    4,
-    4,
-    4,
-    5,
-    5,
-    5,
-    5,
-    6,
-    6,
-    6,
-    6,
-    6,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    7,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    2,
-    2,
-    3,
-    3,
-    4,
-    4,
-    4,
-    5,
-    5,
-    5,
-    6,
-    6,
-    6,
-    6,
-    7,
-    7,
-    7,
-    7,
-    7,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    8,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    2,
-    2,
-    3,
-    3,
-    4,
-    4,
-    5,
-    5,
-    5,
-    6,
-    6,
-    6,
-    7,
-    7,
-    7,
-    7,
-    8,
-    8,
-    8,
-    8,
-    8,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    9,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    2,
-    3,
-    3,
-    4,
-    4,
-    5,
-    5,
-    6,
-    6,
-    6,
-    7,
-    7,
-    7,
-    8,
-    8,
-    8,
-    8,
-    9,
-    9,
-    9,
-    9,
-    9,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    10,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    0,
-    0,
-    0,
-    0,
-    0,
-    1,
-    2,
-    2,
-    3,
-    4,
-    4,
-    5,
-    5,
-    6,
-    6,
-    7,
-    7,
-    7,
-    8,
-    8,
-    8,
-    9,
-    9,
-    9,
-    9,
-    10,
-    10,
-    10,
-    10,
-    10,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    11,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    0,
-    0,
-    0,
-    0,
-    1,
-    1,
-    2,
-    3,
-    3,
-    4,
-    5,
-    5,
-    6,
-    6,
-    7,
-    7,
-    8,
-    8,
-    8,
-    9,
-    9,
-    9,
-    10,
-    10,
-    10,
-    10,
-    11,
-    11,
-    11,
-    11,
-    11,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    12,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    0,
-    0,
-    0,
-    0,
-    1,
-    2,
-    2,
-    3,
-    4,
-    4,
-    5,
-    6,
-    6,
-    7,
-    7,
-    8,
-    8,
-    9,
-    9,
-    9,
-    10,
-    10,
-    10,
-    11,
-    11,
-    11,
-    11,
-    12,
-    12,
-    12,
-    12,
-    12,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    13,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    0,
-    0,
-    0,
-    0,
-    1,
-    2,
-    3,
-    3,
-    4,
-    5,
-    5,
-    6,
-    7,
-    7,
-    8,
-    8,
-    9,
-    9,
-    10,
-    10,
-    10,
-    11,
-    11,
-    11,
-    12,
-    12,
-    12,
-    12,
-    13,
-    13,
-    13,
-    13,
-    13,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    14,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    0,
-    0,
-    0,
-    1,
-    1,
-    2,
-    3,
-    4,
-    4,
-    5,
-    6,
-    6,
-    7,
-    8,
-    8,
-    9,
-    9,
-    10,
-    10,
-    11,
-    11,
-    11,
-    12,
-    12,
-    12,
-    13,
-    13,
-    13,
-    13,
-    14,
-    14,
-    14,
-    14,
-    14,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    15,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    0,
-    0,
-    0,
-    1,
-    2,
-    2,
-    3,
-    4,
-    5,
-    5,
-    6,
-    7,
-    7,
-    8,
-    9,
-    9,
-    10,
-    10,
-    11,
-    11,
-    12,
-    12,
-    12,
-    13,
-    13,
-    13,
-    14,
-    14,
-    14,
-    14,
-    15,
-    15,
-    15,
-    15,
-    15,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    16,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    0,
-    0,
-    0,
-    1,
-    2,
-    3,
-    3,
-    4,
-    5,
-    6,
-    6,
-    7,
-    8,
-    8,
-    9,
-    10,
-    10,
-    11,
-    11,
-    12,
-    12,
-    13,
-    13,
-    13,
-    14,
-    14,
-    14,
-    15,
-    15,
-    15,
-    15,
-    16,
-    16,
-    16,
-    16,
-    16,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    17,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    0,
-    0,
-    0,
-    1,
-    2,
-    3,
-    4,
-    4,
-    5,
-    6,
-    7,
-    7,
-    8,
-    9,
-    9,
-    10,
-    11,
-    11,
-    12,
-    12,
-    13,
-    13,
-    14,
-    14,
-    14,
-    15,
-    15,
-    15,
-    16,
-    16,
-    16,
-    16,
-    17,
-    17,
-    17,
-    17,
-    17,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    18,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    0,
-    0,
-    1,
-    1,
-    2,
-    3,
-    4,
-    5,
-    5,
-    6,
-    7,
-    8,
-    8,
-    9,
-    10,
-    10,
-    11,
-    12,
-    12,
-    13,
-    13,
-    14,
-    14,
-    15,
-    15,
-    15,
-    16,
-    16,
-    16,
-    17,
-    17,
-    17,
-    17,
-    18,
-    18,
-    18,
-    18,
-    18,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    19,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    0,
-    0,
-    1,
-    2,
-    2,
-    3,
-    4,
-    5,
-    6,
-    6,
-    7,
-    8,
-    9,
-    9,
-    10,
-    11,
-    11,
-    12,
-    13,
-    13,
-    14,
-    14,
-    15,
-    15,
-    16,
-    16,
-    16,
-    17,
-    17,
-    17,
-    18,
-    18,
-    18,
-    18,
-    19,
-    19,
-    19,
-    19,
-    19,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    20,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    0,
-    0,
-    1,
-    2,
-    3,
-    3,
-    4,
-    5,
-    6,
-    7,
-    7,
-    8,
-    9,
-    10,
-    10,
-    11,
-    12,
-    12,
-    13,
-    14,
-    14,
-    15,
-    15,
-    16,
-    16,
-    17,
-    17,
-    17,
-    18,
-    18,
-    18,
-    19,
-    19,
-    19,
-    19,
-    20,
-    20,
-    20,
-    20,
-    20,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    21,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    0,
-    0,
-    1,
-    2,
-    3,
-    4,
-    4,
-    5,
-    6,
-    7,
-    8,
-    8,
-    9,
-    10,
-    11,
-    11,
-    12,
-    13,
-    13,
-    14,
-    15,
-    15,
-    16,
-    16,
-    17,
-    17,
-    18,
-    18,
-    18,
-    19,
-    19,
-    19,
-    20,
-    20,
-    20,
-    20,
-    21,
-    21,
-    21,
-    21,
-    21,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    22,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    0,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    5,
-    6,
-    7,
-    8,
-    9,
-    9,
-    10,
-    11,
-    12,
-    12,
-    13,
-    14,
-    14,
-    15,
-    16,
-    16,
-    17,
-    17,
-    18,
-    18,
-    19,
-    19,
-    19,
-    20,
-    20,
-    20,
-    21,
-    21,
-    21,
-    21,
-    22,
-    22,
-    22,
-    22,
-    22,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    23,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    0,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    6,
-    7,
-    8,
-    9,
-    10,
-    10,
-    11,
-    12,
-    13,
-    13,
-    14,
-    15,
-    15,
-    16,
-    17,
-    17,
-    18,
-    18,
-    19,
-    19,
-    20,
-    20,
-    20,
-    21,
-    21,
-    21,
-    22,
-    22,
-    22,
-    22,
-    23,
-    23,
-    23,
-    23,
-    23,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    24,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    0,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    7,
-    8,
-    9,
-    10,
-    11,
-    11,
-    12,
-    13,
-    14,
-    14,
-    15,
-    16,
-    16,
-    17,
-    18,
-    18,
-    19,
-    19,
-    20,
-    20,
-    21,
-    21,
-    21,
-    22,
-    22,
-    22,
-    23,
-    23,
-    23,
-    23,
-    24,
-    24,
-    24,
-    24,
-    24,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    25,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    0,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    8,
-    9,
-    10,
-    11,
-    12,
-    12,
-    13,
-    14,
-    15,
-    15,
-    16,
-    17,
-    17,
-    18,
-    19,
-    19,
-    20,
-    20,
-    21,
-    21,
-    22,
-    22,
-    22,
-    23,
-    23,
-    23,
-    24,
-    24,
-    24,
-    24,
-    25,
-    25,
-    25,
-    25,
-    25,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    26,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    0,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    9,
-    10,
-    11,
-    12,
-    13,
-    13,
-    14,
-    15,
-    16,
-    16,
-    17,
-    18,
-    18,
-    19,
-    20,
-    20,
-    21,
-    21,
-    22,
-    22,
-    23,
-    23,
-    23,
-    24,
-    24,
-    24,
-    25,
-    25,
-    25,
-    25,
-    26,
-    26,
-    26,
-    26,
-    26,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    27,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    0,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    10,
-    11,
-    12,
-    13,
-    14,
-    14,
-    15,
-    16,
-    17,
-    17,
-    18,
-    19,
-    19,
-    20,
-    21,
-    21,
-    22,
-    22,
-    23,
-    23,
-    24,
-    24,
-    24,
-    25,
-    25,
-    25,
-    26,
-    26,
-    26,
-    26,
-    27,
-    27,
-    27,
-    27,
-    27,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    28,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    0,
-    1,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    11,
-    12,
-    13,
-    14,
-    15,
-    15,
-    16,
-    17,
-    18,
-    18,
-    19,
-    20,
-    20,
-    21,
-    22,
-    22,
-    23,
-    23,
-    24,
-    24,
-    25,
-    25,
-    25,
-    26,
-    26,
-    26,
-    27,
-    27,
-    27,
-    27,
-    28,
-    28,
-    28,
-    28,
-    28,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    29,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    0,
-    1,
-    2,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    12,
-    13,
-    14,
-    15,
-    16,
-    16,
-    17,
-    18,
-    19,
-    19,
-    20,
-    21,
-    21,
-    22,
-    23,
-    23,
-    24,
-    24,
-    25,
-    25,
-    26,
-    26,
-    26,
-    27,
-    27,
-    27,
-    28,
-    28,
-    28,
-    28,
-    29,
-    29,
-    29,
-    29,
-    29,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    30,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    0,
-    1,
-    2,
-    3,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    13,
-    14,
-    15,
-    16,
-    17,
-    17,
-    18,
-    19,
-    20,
-    20,
-    21,
-    22,
-    22,
-    23,
-    24,
-    24,
-    25,
-    25,
-    26,
-    26,
-    27,
-    27,
-    27,
-    28,
-    28,
-    28,
-    29,
-    29,
-    29,
-    29,
-    30,
-    30,
-    30,
-    30,
-    30,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    31,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    0,
-    1,
-    2,
-    3,
-    4,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    14,
-    15,
-    16,
-    17,
-    18,
-    18,
-    19,
-    20,
-    21,
-    21,
-    22,
-    23,
-    23,
-    24,
-    25,
-    25,
-    26,
-    26,
-    27,
-    27,
-    28,
-    28,
-    28,
-    29,
-    29,
-    29,
-    30,
-    30,
-    30,
-    30,
-    31,
-    31,
-    31,
-    31,
-    31,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    32,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    15,
-    16,
-    17,
-    18,
-    19,
-    19,
-    20,
-    21,
-    22,
-    22,
-    23,
-    24,
-    24,
-    25,
-    26,
-    26,
-    27,
-    27,
-    28,
-    28,
-    29,
-    29,
-    29,
-    30,
-    30,
-    30,
-    31,
-    31,
-    31,
-    31,
-    32,
-    32,
-    32,
-    32,
-    32,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    33,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    16,
-    17,
-    18,
-    19,
-    20,
-    20,
-    21,
-    22,
-    23,
-    23,
-    24,
-    25,
-    25,
-    26,
-    27,
-    27,
-    28,
-    28,
-    29,
-    29,
-    30,
-    30,
-    30,
-    31,
-    31,
-    31,
-    32,
-    32,
-    32,
-    32,
-    33,
-    33,
-    33,
-    33,
-    33,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    34,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    17,
-    18,
-    19,
-    20,
-    21,
-    21,
-    22,
-    23,
-    24,
-    24,
-    25,
-    26,
-    26,
-    27,
-    28,
-    28,
-    29,
-    29,
-    30,
-    30,
-    31,
-    31,
-    31,
-    32,
-    32,
-    32,
-    33,
-    33,
-    33,
-    33,
-    34,
-    34,
-    34,
-    34,
-    34,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    35,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    18,
-    19,
-    20,
-    21,
-    22,
-    22,
-    23,
-    24,
-    25,
-    25,
-    26,
-    27,
-    27,
-    28,
-    29,
-    29,
-    30,
-    30,
-    31,
-    31,
-    32,
-    32,
-    32,
-    33,
-    33,
-    33,
-    34,
-    34,
-    34,
-    34,
-    35,
-    35,
-    35,
-    35,
-    35,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    36,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    19,
-    20,
-    21,
-    22,
-    23,
-    23,
-    24,
-    25,
-    26,
-    26,
-    27,
-    28,
-    28,
-    29,
-    30,
-    30,
-    31,
-    31,
-    32,
-    32,
-    33,
-    33,
-    33,
-    34,
-    34,
-    34,
-    35,
-    35,
-    35,
-    35,
-    36,
-    36,
-    36,
-    36,
-    36,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    37,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    20,
-    21,
-    22,
-    23,
-    24,
-    24,
-    25,
-    26,
-    27,
-    27,
-    28,
-    29,
-    29,
-    30,
-    31,
-    31,
-    32,
-    32,
-    33,
-    33,
-    34,
-    34,
-    34,
-    35,
-    35,
-    35,
-    36,
-    36,
-    36,
-    36,
-    37,
-    37,
-    37,
-    37,
-    37,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    38,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    21,
-    22,
-    23,
-    24,
-    25,
-    25,
-    26,
-    27,
-    28,
-    28,
-    29,
-    30,
-    30,
-    31,
-    32,
-    32,
-    33,
-    33,
-    34,
-    34,
-    35,
-    35,
-    35,
-    36,
-    36,
-    36,
-    37,
-    37,
-    37,
-    37,
-    38,
-    38,
-    38,
-    38,
-    38,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    39,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    22,
-    23,
-    24,
-    25,
-    26,
-    26,
-    27,
-    28,
-    29,
-    29,
-    30,
-    31,
-    31,
-    32,
-    33,
-    33,
-    34,
-    34,
-    35,
-    35,
-    36,
-    36,
-    36,
-    37,
-    37,
-    37,
-    38,
-    38,
-    38,
-    38,
-    39,
-    39,
-    39,
-    39,
-    39,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    40,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    23,
-    24,
-    25,
-    26,
-    27,
-    27,
-    28,
-    29,
-    30,
-    30,
-    31,
-    32,
-    32,
-    33,
-    34,
-    34,
-    35,
-    35,
-    36,
-    36,
-    37,
-    37,
-    37,
-    38,
-    38,
-    38,
-    39,
-    39,
-    39,
-    39,
-    40,
-    40,
-    40,
-    40,
-    40,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    41,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    24,
-    25,
-    26,
-    27,
-    28,
-    28,
-    29,
-    30,
-    31,
-    31,
-    32,
-    33,
-    33,
-    34,
-    35,
-    35,
-    36,
-    36,
-    37,
-    37,
-    38,
-    38,
-    38,
-    39,
-    39,
-    39,
-    40,
-    40,
-    40,
-    40,
-    41,
-    41,
-    41,
-    41,
-    41,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    42,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    25,
-    26,
-    27,
-    28,
-    29,
-    29,
-    30,
-    31,
-    32,
-    32,
-    33,
-    34,
-    34,
-    35,
-    36,
-    36,
-    37,
-    37,
-    38,
-    38,
-    39,
-    39,
-    39,
-    40,
-    40,
-    40,
-    41,
-    41,
-    41,
-    41,
-    42,
-    42,
-    42,
-    42,
-    42,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    43,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    26,
-    27,
-    28,
-    29,
-    30,
-    30,
-    31,
-    32,
-    33,
-    33,
-    34,
-    35,
-    35,
-    36,
-    37,
-    37,
-    38,
-    38,
-    39,
-    39,
-    40,
-    40,
-    40,
-    41,
-    41,
-    41,
-    42,
-    42,
-    42,
-    42,
-    43,
-    43,
-    43,
-    43,
-    43,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    44,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    27,
-    28,
-    29,
-    30,
-    31,
-    31,
-    32,
-    33,
-    34,
-    34,
-    35,
-    36,
-    36,
-    37,
-    38,
-    38,
-    39,
-    39,
-    40,
-    40,
-    41,
-    41,
-    41,
-    42,
-    42,
-    42,
-    43,
-    43,
-    43,
-    43,
-    44,
-    44,
-    44,
-    44,
-    44,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    45,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    28,
-    29,
-    30,
-    31,
-    32,
-    32,
-    33,
-    34,
-    35,
-    35,
-    36,
-    37,
-    37,
-    38,
-    39,
-    39,
-    40,
-    40,
-    41,
-    41,
-    42,
-    42,
-    42,
-    43,
-    43,
-    43,
-    44,
-    44,
-    44,
-    44,
-    45,
-    45,
-    45,
-    45,
-    45,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    46,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    29,
-    30,
-    31,
-    32,
-    33,
-    33,
-    34,
-    35,
-    36,
-    36,
-    37,
-    38,
-    38,
-    39,
-    40,
-    40,
-    41,
-    41,
-    42,
-    42,
-    43,
-    43,
-    43,
-    44,
-    44,
-    44,
-    45,
-    45,
-    45,
-    45,
-    46,
-    46,
-    46,
-    46,
-    46,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    47,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    30,
-    31,
-    32,
-    33,
-    34,
-    34,
-    35,
-    36,
-    37,
-    37,
-    38,
-    39,
-    39,
-    40,
-    41,
-    41,
-    42,
-    42,
-    43,
-    43,
-    44,
-    44,
-    44,
-    45,
-    45,
-    45,
-    46,
-    46,
-    46,
-    46,
-    47,
-    47,
-    47,
-    47,
-    47,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    48,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    31,
-    32,
-    33,
-    34,
-    35,
-    35,
-    36,
-    37,
-    38,
-    38,
-    39,
-    40,
-    40,
-    41,
-    42,
-    42,
-    43,
-    43,
-    44,
-    44,
-    45,
-    45,
-    45,
-    46,
-    46,
-    46,
-    47,
-    47,
-    47,
-    47,
-    48,
-    48,
-    48,
-    48,
-    48,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    49,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    32,
-    33,
-    34,
-    35,
-    36,
-    36,
-    37,
-    38,
-    39,
-    39,
-    40,
-    41,
-    41,
-    42,
-    43,
-    43,
-    44,
-    44,
-    45,
-    45,
-    46,
-    46,
-    46,
-    47,
-    47,
-    47,
-    48,
-    48,
-    48,
-    48,
-    49,
-    49,
-    49,
-    49,
-    49,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    50,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    33,
-    34,
-    35,
-    36,
-    37,
-    37,
-    38,
-    39,
-    40,
-    40,
-    41,
-    42,
-    42,
-    43,
-    44,
-    44,
-    45,
-    45,
-    46,
-    46,
-    47,
-    47,
-    47,
-    48,
-    48,
-    48,
-    49,
-    49,
-    49,
-    49,
-    50,
-    50,
-    50,
-    50,
-    50,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    51,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    34,
-    35,
-    36,
-    37,
-    38,
-    38,
-    39,
-    40,
-    41,
-    41,
-    42,
-    43,
-    43,
-    44,
-    45,
-    45,
-    46,
-    46,
-    47,
-    47,
-    48,
-    48,
-    48,
-    49,
-    49,
-    49,
-    50,
-    50,
-    50,
-    50,
-    51,
-    51,
-    51,
-    51,
-    51,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    52,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    35,
-    36,
-    37,
-    38,
-    39,
-    39,
-    40,
-    41,
-    42,
-    42,
-    43,
-    44,
-    44,
-    45,
-    46,
-    46,
-    47,
-    47,
-    48,
-    48,
-    49,
-    49,
-    49,
-    50,
-    50,
-    50,
-    51,
-    51,
-    51,
-    51,
-    52,
-    52,
-    52,
-    52,
-    52,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    53,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    36,
-    37,
-    38,
-    39,
-    40,
-    40,
-    41,
-    42,
-    43,
-    43,
-    44,
-    45,
-    45,
-    46,
-    47,
-    47,
-    48,
-    48,
-    49,
-    49,
-    50,
-    50,
-    50,
-    51,
-    51,
-    51,
-    52,
-    52,
-    52,
-    52,
-    53,
-    53,
-    53,
-    53,
-    53,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    54,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    37,
-    38,
-    39,
-    40,
-    41,
-    41,
-    42,
-    43,
-    44,
-    44,
-    45,
-    46,
-    46,
-    47,
-    48,
-    48,
-    49,
-    49,
-    50,
-    50,
-    51,
-    51,
-    51,
-    52,
-    52,
-    52,
-    53,
-    53,
-    53,
-    53,
-    54,
-    54,
-    54,
-    54,
-    54,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    55,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    38,
-    39,
-    40,
-    41,
-    42,
-    42,
-    43,
-    44,
-    45,
-    45,
-    46,
-    47,
-    47,
-    48,
-    49,
-    49,
-    50,
-    50,
-    51,
-    51,
-    52,
-    52,
-    52,
-    53,
-    53,
-    53,
-    54,
-    54,
-    54,
-    54,
-    55,
-    55,
-    55,
-    55,
-    55,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    56,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    39,
-    40,
-    41,
-    42,
-    43,
-    43,
-    44,
-    45,
-    46,
-    46,
-    47,
-    48,
-    48,
-    49,
-    50,
-    50,
-    51,
-    51,
-    52,
-    52,
-    53,
-    53,
-    53,
-    54,
-    54,
-    54,
-    55,
-    55,
-    55,
-    55,
-    56,
-    56,
-    56,
-    56,
-    56,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    57,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    40,
-    41,
-    42,
-    43,
-    44,
-    44,
-    45,
-    46,
-    47,
-    47,
-    48,
-    49,
-    49,
-    50,
-    51,
-    51,
-    52,
-    52,
-    53,
-    53,
-    54,
-    54,
-    54,
-    55,
-    55,
-    55,
-    56,
-    56,
-    56,
-    56,
-    57,
-    57,
-    57,
-    57,
-    57,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    58,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    41,
-    42,
-    43,
-    44,
-    45,
-    45,
-    46,
-    47,
-    48,
-    48,
-    49,
-    50,
-    50,
-    51,
-    52,
-    52,
-    53,
-    53,
-    54,
-    54,
-    55,
-    55,
-    55,
-    56,
-    56,
-    56,
-    57,
-    57,
-    57,
-    57,
-    58,
-    58,
-    58,
-    58,
-    58,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    59,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    42,
-    43,
-    44,
-    45,
-    46,
-    46,
-    47,
-    48,
-    49,
-    49,
-    50,
-    51,
-    51,
-    52,
-    53,
-    53,
-    54,
-    54,
-    55,
-    55,
-    56,
-    56,
-    56,
-    57,
-    57,
-    57,
-    58,
-    58,
-    58,
-    58,
-    59,
-    59,
-    59,
-    59,
-    59,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    60,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    43,
-    44,
-    45,
-    46,
-    47,
-    47,
-    48,
-    49,
-    50,
-    50,
-    51,
-    52,
-    52,
-    53,
-    54,
-    54,
-    55,
-    55,
-    56,
-    56,
-    57,
-    57,
-    57,
-    58,
-    58,
-    58,
-    59,
-    59,
-    59,
-    59,
-    60,
-    60,
-    60,
-    60,
-    60,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    61,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    44,
-    45,
-    46,
-    47,
-    48,
-    48,
-    49,
-    50,
-    51,
-    51,
-    52,
-    53,
-    53,
-    54,
-    55,
-    55,
-    56,
-    56,
-    57,
-    57,
-    58,
-    58,
-    58,
-    59,
-    59,
-    59,
-    60,
-    60,
-    60,
-    60,
-    61,
-    61,
-    61,
-    61,
-    61,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    62,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    45,
-    46,
-    47,
-    48,
-    49,
-    49,
-    50,
-    51,
-    52,
-    52,
-    53,
-    54,
-    54,
-    55,
-    56,
-    56,
-    57,
-    57,
-    58,
-    58,
-    59,
-    59,
-    59,
-    60,
-    60,
-    60,
-    61,
-    61,
-    61,
-    61,
-    62,
-    62,
-    62,
-    62,
-    62,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    63,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    46,
-    47,
-    48,
-    49,
-    50,
-    50,
-    51,
-    52,
-    53,
-    53,
-    54,
-    55,
-    55,
-    56,
-    57,
-    57,
-    58,
-    58,
-    59,
-    59,
-    60,
-    60,
-    60,
-    61,
-    61,
-    61,
-    62,
-    62,
-    62,
-    62,
-    63,
-    63,
-    63,
-    63,
-    63,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    64,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    47,
-    48,
-    49,
-    50,
-    51,
-    51,
-    52,
-    53,
-    54,
-    54,
-    55,
-    56,
-    56,
-    57,
-    58,
-    58,
-    59,
-    59,
-    60,
-    60,
-    61,
-    61,
-    61,
-    62,
-    62,
-    62,
-    63,
-    63,
-    63,
-    63,
-    64,
-    64,
-    64,
-    64,
-    64,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    65,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    48,
-    49,
-    50,
-    51,
-    52,
-    52,
-    53,
-    54,
-    55,
-    55,
-    56,
-    57,
-    57,
-    58,
-    59,
-    59,
-    60,
-    60,
-    61,
-    61,
-    62,
-    62,
-    62,
-    63,
-    63,
-    63,
-    64,
-    64,
-    64,
-    64,
-    65,
-    65,
-    65,
-    65,
-    65,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    66,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    49,
-    50,
-    51,
-    52,
-    53,
-    53,
-    54,
-    55,
-    56,
-    56,
-    57,
-    58,
-    58,
-    59,
-    60,
-    60,
-    61,
-    61,
-    62,
-    62,
-    63,
-    63,
-    63,
-    64,
-    64,
-    64,
-    65,
-    65,
-    65,
-    65,
-    66,
-    66,
-    66,
-    66,
-    66,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    67,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    50,
-    51,
-    52,
-    53,
-    54,
-    54,
-    55,
-    56,
-    57,
-    57,
-    58,
-    59,
-    59,
-    60,
-    61,
-    61,
-    62,
-    62,
-    63,
-    63,
-    64,
-    64,
-    64,
-    65,
-    65,
-    65,
-    66,
-    66,
-    66,
-    66,
-    67,
-    67,
-    67,
-    67,
-    67,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    68,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    51,
-    52,
-    53,
-    54,
-    55,
-    55,
-    56,
-    57,
-    58,
-    58,
-    59,
-    60,
-    60,
-    61,
-    62,
-    62,
-    63,
-    63,
-    64,
-    64,
-    65,
-    65,
-    65,
-    66,
-    66,
-    66,
-    67,
-    67,
-    67,
-    67,
-    68,
-    68,
-    68,
-    68,
-    68,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    69,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    52,
-    53,
-    54,
-    55,
-    56,
-    56,
-    57,
-    58,
-    59,
-    59,
-    60,
-    61,
-    61,
-    62,
-    63,
-    63,
-    64,
-    64,
-    65,
-    65,
-    66,
-    66,
-    66,
-    67,
-    67,
-    67,
-    68,
-    68,
-    68,
-    68,
-    69,
-    69,
-    69,
-    69,
-    69,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    70,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    53,
-    54,
-    55,
-    56,
-    57,
-    57,
-    58,
-    59,
-    60,
-    60,
-    61,
-    62,
-    62,
-    63,
-    64,
-    64,
-    65,
-    65,
-    66,
-    66,
-    67,
-    67,
-    67,
-    68,
-    68,
-    68,
-    69,
-    69,
-    69,
-    69,
-    70,
-    70,
-    70,
-    70,
-    70,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    71,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    54,
-    55,
-    56,
-    57,
-    58,
-    58,
-    59,
-    60,
-    61,
-    61,
-    62,
-    63,
-    63,
-    64,
-    65,
-    65,
-    66,
-    66,
-    67,
-    67,
-    68,
-    68,
-    68,
-    69,
-    69,
-    69,
-    70,
-    70,
-    70,
-    70,
-    71,
-    71,
-    71,
-    71,
-    71,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    72,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    55,
-    56,
-    57,
-    58,
-    59,
-    59,
-    60,
-    61,
-    62,
-    62,
-    63,
-    64,
-    64,
-    65,
-    66,
-    66,
-    67,
-    67,
-    68,
-    68,
-    69,
-    69,
-    69,
-    70,
-    70,
-    70,
-    71,
-    71,
-    71,
-    71,
-    72,
-    72,
-    72,
-    72,
-    72,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    73,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    56,
-    57,
-    58,
-    59,
-    60,
-    60,
-    61,
-    62,
-    63,
-    63,
-    64,
-    65,
-    65,
-    66,
-    67,
-    67,
-    68,
-    68,
-    69,
-    69,
-    70,
-    70,
-    70,
-    71,
-    71,
-    71,
-    72,
-    72,
-    72,
-    72,
-    73,
-    73,
-    73,
-    73,
-    73,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    74,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    57,
-    58,
-    59,
-    60,
-    61,
-    61,
-    62,
-    63,
-    64,
-    64,
-    65,
-    66,
-    66,
-    67,
-    68,
-    68,
-    69,
-    69,
-    70,
-    70,
-    71,
-    71,
-    71,
-    72,
-    72,
-    72,
-    73,
-    73,
-    73,
-    73,
-    74,
-    74,
-    74,
-    74,
-    74,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    75,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    58,
-    59,
-    60,
-    61,
-    62,
-    62,
-    63,
-    64,
-    65,
-    65,
-    66,
-    67,
-    67,
-    68,
-    69,
-    69,
-    70,
-    70,
-    71,
-    71,
-    72,
-    72,
-    72,
-    73,
-    73,
-    73,
-    74,
-    74,
-    74,
-    74,
-    75,
-    75,
-    75,
-    75,
-    75,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    76,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    59,
-    60,
-    61,
-    62,
-    63,
-    63,
-    64,
-    65,
-    66,
-    66,
-    67,
-    68,
-    68,
-    69,
-    70,
-    70,
-    71,
-    71,
-    72,
-    72,
-    73,
-    73,
-    73,
-    74,
-    74,
-    74,
-    75,
-    75,
-    75,
-    75,
-    76,
-    76,
-    76,
-    76,
-    76,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    77,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    60,
-    61,
-    62,
-    63,
-    64,
-    64,
-    65,
-    66,
-    67,
-    67,
-    68,
-    69,
-    69,
-    70,
-    71,
-    71,
-    72,
-    72,
-    73,
-    73,
-    74,
-    74,
-    74,
-    75,
-    75,
-    75,
-    76,
-    76,
-    76,
-    76,
-    77,
-    77,
-    77,
-    77,
-    77,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    78,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    61,
-    62,
-    63,
-    64,
-    65,
-    65,
-    66,
-    67,
-    68,
-    68,
-    69,
-    70,
-    70,
-    71,
-    72,
-    72,
-    73,
-    73,
-    74,
-    74,
-    75,
-    75,
-    75,
-    76,
-    76,
-    76,
-    77,
-    77,
-    77,
-    77,
-    78,
-    78,
-    78,
-    78,
-    78,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    79,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    62,
-    63,
-    64,
-    65,
-    66,
-    66,
-    67,
-    68,
-    69,
-    69,
-    70,
-    71,
-    71,
-    72,
-    73,
-    73,
-    74,
-    74,
-    75,
-    75,
-    76,
-    76,
-    76,
-    77,
-    77,
-    77,
-    78,
-    78,
-    78,
-    78,
-    79,
-    79,
-    79,
-    79,
-    79,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    80,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    63,
-    64,
-    65,
-    66,
-    67,
-    67,
-    68,
-    69,
-    70,
-    70,
-    71,
-    72,
-    72,
-    73,
-    74,
-    74,
-    75,
-    75,
-    76,
-    76,
-    77,
-    77,
-    77,
-    78,
-    78,
-    78,
-    79,
-    79,
-    79,
-    79,
-    80,
-    80,
-    80,
-    80,
-    80,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    81,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    64,
-    65,
-    66,
-    67,
-    68,
-    68,
-    69,
-    70,
-    71,
-    71,
-    72,
-    73,
-    73,
-    74,
-    75,
-    75,
-    76,
-    76,
-    77,
-    77,
-    78,
-    78,
-    78,
-    79,
-    79,
-    79,
-    80,
-    80,
-    80,
-    80,
-    81,
-    81,
-    81,
-    81,
-    81,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    82,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    65,
-    66,
-    67,
-    68,
-    69,
-    69,
-    70,
-    71,
-    72,
-    72,
-    73,
-    74,
-    74,
-    75,
-    76,
-    76,
-    77,
-    77,
-    78,
-    78,
-    79,
-    79,
-    79,
-    80,
-    80,
-    80,
-    81,
-    81,
-    81,
-    81,
-    82,
-    82,
-    82,
-    82,
-    82,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    83,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    66,
-    67,
-    68,
-    69,
-    70,
-    70,
-    71,
-    72,
-    73,
-    73,
-    74,
-    75,
-    75,
-    76,
-    77,
-    77,
-    78,
-    78,
-    79,
-    79,
-    80,
-    80,
-    80,
-    81,
-    81,
-    81,
-    82,
-    82,
-    82,
-    82,
-    83,
-    83,
-    83,
-    83,
-    83,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    84,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    67,
-    68,
-    69,
-    70,
-    71,
-    71,
-    72,
-    73,
-    74,
-    74,
-    75,
-    76,
-    76,
-    77,
-    78,
-    78,
-    79,
-    79,
-    80,
-    80,
-    81,
-    81,
-    81,
-    82,
-    82,
-    82,
-    83,
-    83,
-    83,
-    83,
-    84,
-    84,
-    84,
-    84,
-    84,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    85,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    68,
-    69,
-    70,
-    71,
-    72,
-    72,
-    73,
-    74,
-    75,
-    75,
-    76,
-    77,
-    77,
-    78,
-    79,
-    79,
-    80,
-    80,
-    81,
-    81,
-    82,
-    82,
-    82,
-    83,
-    83,
-    83,
-    84,
-    84,
-    84,
-    84,
-    85,
-    85,
-    85,
-    85,
-    85,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    86,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    69,
-    70,
-    71,
-    72,
-    73,
-    73,
-    74,
-    75,
-    76,
-    76,
-    77,
-    78,
-    78,
-    79,
-    80,
-    80,
-    81,
-    81,
-    82,
-    82,
-    83,
-    83,
-    83,
-    84,
-    84,
-    84,
-    85,
-    85,
-    85,
-    85,
-    86,
-    86,
-    86,
-    86,
-    86,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    87,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    70,
-    71,
-    72,
-    73,
-    74,
-    74,
-    75,
-    76,
-    77,
-    77,
-    78,
-    79,
-    79,
-    80,
-    81,
-    81,
-    82,
-    82,
-    83,
-    83,
-    84,
-    84,
-    84,
-    85,
-    85,
-    85,
-    86,
-    86,
-    86,
-    86,
-    87,
-    87,
-    87,
-    87,
-    87,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    88,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    71,
-    72,
-    73,
-    74,
-    75,
-    75,
-    76,
-    77,
-    78,
-    78,
-    79,
-    80,
-    80,
-    81,
-    82,
-    82,
-    83,
-    83,
-    84,
-    84,
-    85,
-    85,
-    85,
-    86,
-    86,
-    86,
-    87,
-    87,
-    87,
-    87,
-    88,
-    88,
-    88,
-    88,
-    88,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    89,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    72,
-    73,
-    74,
-    75,
-    76,
-    76,
-    77,
-    78,
-    79,
-    79,
-    80,
-    81,
-    81,
-    82,
-    83,
-    83,
-    84,
-    84,
-    85,
-    85,
-    86,
-    86,
-    86,
-    87,
-    87,
-    87,
-    88,
-    88,
-    88,
-    88,
-    89,
-    89,
-    89,
-    89,
-    89,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    90,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    73,
-    74,
-    75,
-    76,
-    77,
-    77,
-    78,
-    79,
-    80,
-    80,
-    81,
-    82,
-    82,
-    83,
-    84,
-    84,
-    85,
-    85,
-    86,
-    86,
-    87,
-    87,
-    87,
-    88,
-    88,
-    88,
-    89,
-    89,
-    89,
-    89,
-    90,
-    90,
-    90,
-    90,
-    90,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    91,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    74,
-    75,
-    76,
-    77,
-    78,
-    78,
-    79,
-    80,
-    81,
-    81,
-    82,
-    83,
-    83,
-    84,
-    85,
-    85,
-    86,
-    86,
-    87,
-    87,
-    88,
-    88,
-    88,
-    89,
-    89,
-    89,
-    90,
-    90,
-    90,
-    90,
-    91,
-    91,
-    91,
-    91,
-    91,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    92,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    75,
-    76,
-    77,
-    78,
-    79,
-    79,
-    80,
-    81,
-    82,
-    82,
-    83,
-    84,
-    84,
-    85,
-    86,
-    86,
-    87,
-    87,
-    88,
-    88,
-    89,
-    89,
-    89,
-    90,
-    90,
-    90,
-    91,
-    91,
-    91,
-    91,
-    92,
-    92,
-    92,
-    92,
-    92,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    93,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    76,
-    77,
-    78,
-    79,
-    80,
-    80,
-    81,
-    82,
-    83,
-    83,
-    84,
-    85,
-    85,
-    86,
-    87,
-    87,
-    88,
-    88,
-    89,
-    89,
-    90,
-    90,
-    90,
-    91,
-    91,
-    91,
-    92,
-    92,
-    92,
-    92,
-    93,
-    93,
-    93,
-    93,
-    93,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    94,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    77,
-    78,
-    79,
-    80,
-    81,
-    81,
-    82,
-    83,
-    84,
-    84,
-    85,
-    86,
-    86,
-    87,
-    88,
-    88,
-    89,
-    89,
-    90,
-    90,
-    91,
-    91,
-    91,
-    92,
-    92,
-    92,
-    93,
-    93,
-    93,
-    93,
-    94,
-    94,
-    94,
-    94,
-    94,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    95,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    78,
-    79,
-    80,
-    81,
-    82,
-    82,
-    83,
-    84,
-    85,
-    85,
-    86,
-    87,
-    87,
-    88,
-    89,
-    89,
-    90,
-    90,
-    91,
-    91,
-    92,
-    92,
-    92,
-    93,
-    93,
-    93,
-    94,
-    94,
-    94,
-    94,
-    95,
-    95,
-    95,
-    95,
-    95,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    96,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    79,
-    80,
-    81,
-    82,
-    83,
-    83,
-    84,
-    85,
-    86,
-    86,
-    87,
-    88,
-    88,
-    89,
-    90,
-    90,
-    91,
-    91,
-    92,
-    92,
-    93,
-    93,
-    93,
-    94,
-    94,
-    94,
-    95,
-    95,
-    95,
-    95,
-    96,
-    96,
-    96,
-    96,
-    96,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    97,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    80,
-    81,
-    82,
-    83,
-    84,
-    84,
-    85,
-    86,
-    87,
-    87,
-    88,
-    89,
-    89,
-    90,
-    91,
-    91,
-    92,
-    92,
-    93,
-    93,
-    94,
-    94,
-    94,
-    95,
-    95,
-    95,
-    96,
-    96,
-    96,
-    96,
-    97,
-    97,
-    97,
-    97,
-    97,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    98,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    81,
-    82,
-    83,
-    84,
-    85,
-    85,
-    86,
-    87,
-    88,
-    88,
-    89,
-    90,
-    90,
-    91,
-    92,
-    92,
-    93,
-    93,
-    94,
-    94,
-    95,
-    95,
-    95,
-    96,
-    96,
-    96,
-    97,
-    97,
-    97,
-    97,
-    98,
-    98,
-    98,
-    98,
-    98,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    99,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    82,
-    83,
-    84,
-    85,
-    86,
-    86,
-    87,
-    88,
-    89,
-    89,
-    90,
-    91,
-    91,
-    92,
-    93,
-    93,
-    94,
-    94,
-    95,
-    95,
-    96,
-    96,
-    96,
-    97,
-    97,
-    97,
-    98,
-    98,
-    98,
-    98,
-    99,
-    99,
-    99,
-    99,
-    99,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    100,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    83,
-    84,
-    85,
-    86,
-    87,
-    87,
-    88,
-    89,
-    90,
-    90,
-    91,
-    92,
-    92,
-    93,
-    94,
-    94,
-    95,
-    95,
-    96,
-    96,
-    97,
-    97,
-    97,
-    98,
-    98,
-    98,
-    99,
-    99,
-    99,
-    99,
-    100,
-    100,
-    100,
-    100,
-    100,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    101,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    84,
-    85,
-    86,
-    87,
-    88,
-    88,
-    89,
-    90,
-    91,
-    91,
-    92,
-    93,
-    93,
-    94,
-    95,
-    95,
-    96,
-    96,
-    97,
-    97,
-    98,
-    98,
-    98,
-    99,
-    99,
-    99,
-    100,
-    100,
-    100,
-    100,
-    101,
-    101,
-    101,
-    101,
-    101,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    102,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    85,
-    86,
-    87,
-    88,
-    89,
-    89,
-    90,
-    91,
-    92,
-    92,
-    93,
-    94,
-    94,
-    95,
-    96,
-    96,
-    97,
-    97,
-    98,
-    98,
-    99,
-    99,
-    99,
-    100,
-    100,
-    100,
-    101,
-    101,
-    101,
-    101,
-    102,
-    102,
-    102,
-    102,
-    102,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    103,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    86,
-    87,
-    88,
-    89,
-    90,
-    90,
-    91,
-    92,
-    93,
-    93,
-    94,
-    95,
-    95,
-    96,
-    97,
-    97,
-    98,
-    98,
-    99,
-    99,
-    100,
-    100,
-    100,
-    101,
-    101,
-    101,
-    102,
-    102,
-    102,
-    102,
-    103,
-    103,
-    103,
-    103,
-    103,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    104,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    87,
-    88,
-    89,
-    90,
-    91,
-    91,
-    92,
-    93,
-    94,
-    94,
-    95,
-    96,
-    96,
-    97,
-    98,
-    98,
-    99,
-    99,
-    100,
-    100,
-    101,
-    101,
-    101,
-    102,
-    102,
-    102,
-    103,
-    103,
-    103,
-    103,
-    104,
-    104,
-    104,
-    104,
-    104,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    105,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    88,
-    89,
-    90,
-    91,
-    92,
-    92,
-    93,
-    94,
-    95,
-    95,
-    96,
-    97,
-    97,
-    98,
-    99,
-    99,
-    100,
-    100,
-    101,
-    101,
-    102,
-    102,
-    102,
-    103,
-    103,
-    103,
-    104,
-    104,
-    104,
-    104,
-    105,
-    105,
-    105,
-    105,
-    105,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    106,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    89,
-    90,
-    91,
-    92,
-    93,
-    93,
-    94,
-    95,
-    96,
-    96,
-    97,
-    98,
-    98,
-    99,
-    100,
-    100,
-    101,
-    101,
-    102,
-    102,
-    103,
-    103,
-    103,
-    104,
-    104,
-    104,
-    105,
-    105,
-    105,
-    105,
-    106,
-    106,
-    106,
-    106,
-    106,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    107,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    90,
-    91,
-    92,
-    93,
-    94,
-    94,
-    95,
-    96,
-    97,
-    97,
-    98,
-    99,
-    99,
-    100,
-    101,
-    101,
-    102,
-    102,
-    103,
-    103,
-    104,
-    104,
-    104,
-    105,
-    105,
-    105,
-    106,
-    106,
-    106,
-    106,
-    107,
-    107,
-    107,
-    107,
-    107,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    108,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    91,
-    92,
-    93,
-    94,
-    95,
-    95,
-    96,
-    97,
-    98,
-    98,
-    99,
-    100,
-    100,
-    101,
-    102,
-    102,
-    103,
-    103,
-    104,
-    104,
-    105,
-    105,
-    105,
-    106,
-    106,
-    106,
-    107,
-    107,
-    107,
-    107,
-    108,
-    108,
-    108,
-    108,
-    108,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    109,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    92,
-    93,
-    94,
-    95,
-    96,
-    96,
-    97,
-    98,
-    99,
-    99,
-    100,
-    101,
-    101,
-    102,
-    103,
-    103,
-    104,
-    104,
-    105,
-    105,
-    106,
-    106,
-    106,
-    107,
-    107,
-    107,
-    108,
-    108,
-    108,
-    108,
-    109,
-    109,
-    109,
-    109,
-    109,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    110,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    93,
-    94,
-    95,
-    96,
-    97,
-    97,
-    98,
-    99,
-    100,
-    100,
-    101,
-    102,
-    102,
-    103,
-    104,
-    104,
-    105,
-    105,
-    106,
-    106,
-    107,
-    107,
-    107,
-    108,
-    108,
-    108,
-    109,
-    109,
-    109,
-    109,
-    110,
-    110,
-    110,
-    110,
-    110,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    111,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    94,
-    95,
-    96,
-    97,
-    98,
-    98,
-    99,
-    100,
-    101,
-    101,
-    102,
-    103,
-    103,
-    104,
-    105,
-    105,
-    106,
-    106,
-    107,
-    107,
-    108,
-    108,
-    108,
-    109,
-    109,
-    109,
-    110,
-    110,
-    110,
-    110,
-    111,
-    111,
-    111,
-    111,
-    111,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    112,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    95,
-    96,
-    97,
-    98,
-    99,
-    99,
-    100,
-    101,
-    102,
-    102,
-    103,
-    104,
-    104,
-    105,
-    106,
-    106,
-    107,
-    107,
-    108,
-    108,
-    109,
-    109,
-    109,
-    110,
-    110,
-    110,
-    111,
-    111,
-    111,
-    111,
-    112,
-    112,
-    112,
-    112,
-    112,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    113,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    96,
-    97,
-    98,
-    99,
-    100,
-    100,
-    101,
-    102,
-    103,
-    103,
-    104,
-    105,
-    105,
-    106,
-    107,
-    107,
-    108,
-    108,
-    109,
-    109,
-    110,
-    110,
-    110,
-    111,
-    111,
-    111,
-    112,
-    112,
-    112,
-    112,
-    113,
-    113,
-    113,
-    113,
-    113,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    114,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    97,
-    98,
-    99,
-    100,
-    101,
-    101,
-    102,
-    103,
-    104,
-    104,
-    105,
-    106,
-    106,
-    107,
-    108,
-    108,
-    109,
-    109,
-    110,
-    110,
-    111,
-    111,
-    111,
-    112,
-    112,
-    112,
-    113,
-    113,
-    113,
-    113,
-    114,
-    114,
-    114,
-    114,
-    114,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    115,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    98,
-    99,
-    100,
-    101,
-    102,
-    102,
-    103,
-    104,
-    105,
-    105,
-    106,
-    107,
-    107,
-    108,
-    109,
-    109,
-    110,
-    110,
-    111,
-    111,
-    112,
-    112,
-    112,
-    113,
-    113,
-    113,
-    114,
-    114,
-    114,
-    114,
-    115,
-    115,
-    115,
-    115,
-    115,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    116,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    99,
-    100,
-    101,
-    102,
-    103,
-    103,
-    104,
-    105,
-    106,
-    106,
-    107,
-    108,
-    108,
-    109,
-    110,
-    110,
-    111,
-    111,
-    112,
-    112,
-    113,
-    113,
-    113,
-    114,
-    114,
-    114,
-    115,
-    115,
-    115,
-    115,
-    116,
-    116,
-    116,
-    116,
-    116,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    117,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    100,
-    101,
-    102,
-    103,
-    104,
-    104,
-    105,
-    106,
-    107,
-    107,
-    108,
-    109,
-    109,
-    110,
-    111,
-    111,
-    112,
-    112,
-    113,
-    113,
-    114,
-    114,
-    114,
-    115,
-    115,
-    115,
-    116,
-    116,
-    116,
-    116,
-    117,
-    117,
-    117,
-    117,
-    117,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    118,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    101,
-    102,
-    103,
-    104,
-    105,
-    105,
-    106,
-    107,
-    108,
-    108,
-    109,
-    110,
-    110,
-    111,
-    112,
-    112,
-    113,
-    113,
-    114,
-    114,
-    115,
-    115,
-    115,
-    116,
-    116,
-    116,
-    117,
-    117,
-    117,
-    117,
-    118,
-    118,
-    118,
-    118,
-    118,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    119,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    102,
-    103,
-    104,
-    105,
-    106,
-    106,
-    107,
-    108,
-    109,
-    109,
-    110,
-    111,
-    111,
-    112,
-    113,
-    113,
-    114,
-    114,
-    115,
-    115,
-    116,
-    116,
-    116,
-    117,
-    117,
-    117,
-    118,
-    118,
-    118,
-    118,
-    119,
-    119,
-    119,
-    119,
-    119,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    120,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    103,
-    104,
-    105,
-    106,
-    107,
-    107,
-    108,
-    109,
-    110,
-    110,
-    111,
-    112,
-    112,
-    113,
-    114,
-    114,
-    115,
-    115,
-    116,
-    116,
-    117,
-    117,
-    117,
-    118,
-    118,
-    118,
-    119,
-    119,
-    119,
-    119,
-    120,
-    120,
-    120,
-    120,
-    120,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    121,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    104,
-    105,
-    106,
-    107,
-    108,
-    108,
-    109,
-    110,
-    111,
-    111,
-    112,
-    113,
-    113,
-    114,
-    115,
-    115,
-    116,
-    116,
-    117,
-    117,
-    118,
-    118,
-    118,
-    119,
-    119,
-    119,
-    120,
-    120,
-    120,
-    120,
-    121,
-    121,
-    121,
-    121,
-    121,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    122,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    105,
-    106,
-    107,
-    108,
-    109,
-    109,
-    110,
-    111,
-    112,
-    112,
-    113,
-    114,
-    114,
-    115,
-    116,
-    116,
-    117,
-    117,
-    118,
-    118,
-    119,
-    119,
-    119,
-    120,
-    120,
-    120,
-    121,
-    121,
-    121,
-    121,
-    122,
-    122,
-    122,
-    122,
-    122,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    123,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    106,
-    107,
-    108,
-    109,
-    110,
-    110,
-    111,
-    112,
-    113,
-    113,
-    114,
-    115,
-    115,
-    116,
-    117,
-    117,
-    118,
-    118,
-    119,
-    119,
-    120,
-    120,
-    120,
-    121,
-    121,
-    121,
-    122,
-    122,
-    122,
-    122,
-    123,
-    123,
-    123,
-    123,
-    123,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    124,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    107,
-    108,
-    109,
-    110,
-    111,
-    111,
-    112,
-    113,
-    114,
-    114,
-    115,
-    116,
-    116,
-    117,
-    118,
-    118,
-    119,
-    119,
-    120,
-    120,
-    121,
-    121,
-    121,
-    122,
-    122,
-    122,
-    123,
-    123,
-    123,
-    123,
-    124,
-    124,
-    124,
-    124,
-    124,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    125,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    108,
-    109,
-    110,
-    111,
-    112,
-    112,
-    113,
-    114,
-    115,
-    115,
-    116,
-    117,
-    117,
-    118,
-    119,
-    119,
-    120,
-    120,
-    121,
-    121,
-    122,
-    122,
-    122,
-    123,
-    123,
-    123,
-    124,
-    124,
-    124,
-    124,
-    125,
-    125,
-    125,
-    125,
-    125,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    126,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    109,
-    110,
-    111,
-    112,
-    113,
-    113,
-    114,
-    115,
-    116,
-    116,
-    117,
-    118,
-    118,
-    119,
-    120,
-    120,
-    121,
-    121,
-    122,
-    122,
-    123,
-    123,
-    123,
-    124,
-    124,
-    124,
-    125,
-    125,
-    125,
-    125,
-    126,
-    126,
-    126,
-    126,
-    126,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    127,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    110,
-    111,
-    112,
-    113,
-    114,
-    114,
-    115,
-    116,
-    117,
-    117,
-    118,
-    119,
-    119,
-    120,
-    121,
-    121,
-    122,
-    122,
-    123,
-    123,
-    124,
-    124,
-    124,
-    125,
-    125,
-    125,
-    126,
-    126,
-    126,
-    126,
-    127,
-    127,
-    127,
-    127,
-    127,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    111,
-    112,
-    113,
-    114,
-    115,
-    115,
-    116,
-    117,
-    118,
-    118,
-    119,
-    120,
-    120,
-    121,
-    122,
-    122,
-    123,
-    123,
-    124,
-    124,
-    125,
-    125,
-    125,
-    126,
-    126,
-    126,
-    127,
-    127,
-    127,
-    127,
-    128,
-    128,
-    128,
-    128,
-    128,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    129,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    112,
-    113,
-    114,
-    115,
-    116,
-    116,
-    117,
-    118,
-    119,
-    119,
-    120,
-    121,
-    121,
-    122,
-    123,
-    123,
-    124,
-    124,
-    125,
-    125,
-    126,
-    126,
-    126,
-    127,
-    127,
-    127,
-    128,
-    128,
-    128,
-    128,
-    129,
-    129,
-    129,
-    129,
-    129,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    130,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    113,
-    114,
-    115,
-    116,
-    117,
-    117,
-    118,
-    119,
-    120,
-    120,
-    121,
-    122,
-    122,
-    123,
-    124,
-    124,
-    125,
-    125,
-    126,
-    126,
-    127,
-    127,
-    127,
-    128,
-    128,
-    128,
-    129,
-    129,
-    129,
-    129,
-    130,
-    130,
-    130,
-    130,
-    130,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    131,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    114,
-    115,
-    116,
-    117,
-    118,
-    118,
-    119,
-    120,
-    121,
-    121,
-    122,
-    123,
-    123,
-    124,
-    125,
-    125,
-    126,
-    126,
-    127,
-    127,
-    128,
-    128,
-    128,
-    129,
-    129,
-    129,
-    130,
-    130,
-    130,
-    130,
-    131,
-    131,
-    131,
-    131,
-    131,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    132,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    115,
-    116,
-    117,
-    118,
-    119,
-    119,
-    120,
-    121,
-    122,
-    122,
-    123,
-    124,
-    124,
-    125,
-    126,
-    126,
-    127,
-    127,
-    128,
-    128,
-    129,
-    129,
-    129,
-    130,
-    130,
-    130,
-    131,
-    131,
-    131,
-    131,
-    132,
-    132,
-    132,
-    132,
-    132,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    133,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    116,
-    117,
-    118,
-    119,
-    120,
-    120,
-    121,
-    122,
-    123,
-    123,
-    124,
-    125,
-    125,
-    126,
-    127,
-    127,
-    128,
-    128,
-    129,
-    129,
-    130,
-    130,
-    130,
-    131,
-    131,
-    131,
-    132,
-    132,
-    132,
-    132,
-    133,
-    133,
-    133,
-    133,
-    133,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    134,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    117,
-    118,
-    119,
-    120,
-    121,
-    121,
-    122,
-    123,
-    124,
-    124,
-    125,
-    126,
-    126,
-    127,
-    128,
-    128,
-    129,
-    129,
-    130,
-    130,
-    131,
-    131,
-    131,
-    132,
-    132,
-    132,
-    133,
-    133,
-    133,
-    133,
-    134,
-    134,
-    134,
-    134,
-    134,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    135,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    118,
-    119,
-    120,
-    121,
-    122,
-    122,
-    123,
-    124,
-    125,
-    125,
-    126,
-    127,
-    127,
-    128,
-    129,
-    129,
-    130,
-    130,
-    131,
-    131,
-    132,
-    132,
-    132,
-    133,
-    133,
-    133,
-    134,
-    134,
-    134,
-    134,
-    135,
-    135,
-    135,
-    135,
-    135,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    136,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    119,
-    120,
-    121,
-    122,
-    123,
-    123,
-    124,
-    125,
-    126,
-    126,
-    127,
-    128,
-    128,
-    129,
-    130,
-    130,
-    131,
-    131,
-    132,
-    132,
-    133,
-    133,
-    133,
-    134,
-    134,
-    134,
-    135,
-    135,
-    135,
-    135,
-    136,
-    136,
-    136,
-    136,
-    136,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    137,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    120,
-    121,
-    122,
-    123,
-    124,
-    124,
-    125,
-    126,
-    127,
-    127,
-    128,
-    129,
-    129,
-    130,
-    131,
-    131,
-    132,
-    132,
-    133,
-    133,
-    134,
-    134,
-    134,
-    135,
-    135,
-    135,
-    136,
-    136,
-    136,
-    136,
-    137,
-    137,
-    137,
-    137,
-    137,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    138,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    121,
-    122,
-    123,
-    124,
-    125,
-    125,
-    126,
-    127,
-    128,
-    128,
-    129,
-    130,
-    130,
-    131,
-    132,
-    132,
-    133,
-    133,
-    134,
-    134,
-    135,
-    135,
-    135,
-    136,
-    136,
-    136,
-    137,
-    137,
-    137,
-    137,
-    138,
-    138,
-    138,
-    138,
-    138,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    139,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    122,
-    123,
-    124,
-    125,
-    126,
-    126,
-    127,
-    128,
-    129,
-    129,
-    130,
-    131,
-    131,
-    132,
-    133,
-    133,
-    134,
-    134,
-    135,
-    135,
-    136,
-    136,
-    136,
-    137,
-    137,
-    137,
-    138,
-    138,
-    138,
-    138,
-    139,
-    139,
-    139,
-    139,
-    139,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    140,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    123,
-    124,
-    125,
-    126,
-    127,
-    127,
-    128,
-    129,
-    130,
-    130,
-    131,
-    132,
-    132,
-    133,
-    134,
-    134,
-    135,
-    135,
-    136,
-    136,
-    137,
-    137,
-    137,
-    138,
-    138,
-    138,
-    139,
-    139,
-    139,
-    139,
-    140,
-    140,
-    140,
-    140,
-    140,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    141,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    124,
-    125,
-    126,
-    127,
-    128,
-    128,
-    129,
-    130,
-    131,
-    131,
-    132,
-    133,
-    133,
-    134,
-    135,
-    135,
-    136,
-    136,
-    137,
-    137,
-    138,
-    138,
-    138,
-    139,
-    139,
-    139,
-    140,
-    140,
-    140,
-    140,
-    141,
-    141,
-    141,
-    141,
-    141,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    142,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    125,
-    126,
-    127,
-    128,
-    129,
-    129,
-    130,
-    131,
-    132,
-    132,
-    133,
-    134,
-    134,
-    135,
-    136,
-    136,
-    137,
-    137,
-    138,
-    138,
-    139,
-    139,
-    139,
-    140,
-    140,
-    140,
-    141,
-    141,
-    141,
-    141,
-    142,
-    142,
-    142,
-    142,
-    142,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    143,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    126,
-    127,
-    128,
-    129,
-    130,
-    130,
-    131,
-    132,
-    133,
-    133,
-    134,
-    135,
-    135,
-    136,
-    137,
-    137,
-    138,
-    138,
-    139,
-    139,
-    140,
-    140,
-    140,
-    141,
-    141,
-    141,
-    142,
-    142,
-    142,
-    142,
-    143,
-    143,
-    143,
-    143,
-    143,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    144,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    127,
-    128,
-    129,
-    130,
-    131,
-    131,
-    132,
-    133,
-    134,
-    134,
-    135,
-    136,
-    136,
-    137,
-    138,
-    138,
-    139,
-    139,
-    140,
-    140,
-    141,
-    141,
-    141,
-    142,
-    142,
-    142,
-    143,
-    143,
-    143,
-    143,
-    144,
-    144,
-    144,
-    144,
-    144,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    145,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    128,
-    129,
-    130,
-    131,
-    132,
-    132,
-    133,
-    134,
-    135,
-    135,
-    136,
-    137,
-    137,
-    138,
-    139,
-    139,
-    140,
-    140,
-    141,
-    141,
-    142,
-    142,
-    142,
-    143,
-    143,
-    143,
-    144,
-    144,
-    144,
-    144,
-    145,
-    145,
-    145,
-    145,
-    145,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    146,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    129,
-    130,
-    131,
-    132,
-    133,
-    133,
-    134,
-    135,
-    136,
-    136,
-    137,
-    138,
-    138,
-    139,
-    140,
-    140,
-    141,
-    141,
-    142,
-    142,
-    143,
-    143,
-    143,
-    144,
-    144,
-    144,
-    145,
-    145,
-    145,
-    145,
-    146,
-    146,
-    146,
-    146,
-    146,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    147,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    130,
-    131,
-    132,
-    133,
-    134,
-    134,
-    135,
-    136,
-    137,
-    137,
-    138,
-    139,
-    139,
-    140,
-    141,
-    141,
-    142,
-    142,
-    143,
-    143,
-    144,
-    144,
-    144,
-    145,
-    145,
-    145,
-    146,
-    146,
-    146,
-    146,
-    147,
-    147,
-    147,
-    147,
-    147,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    148,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    131,
-    132,
-    133,
-    134,
-    135,
-    135,
-    136,
-    137,
-    138,
-    138,
-    139,
-    140,
-    140,
-    141,
-    142,
-    142,
-    143,
-    143,
-    144,
-    144,
-    145,
-    145,
-    145,
-    146,
-    146,
-    146,
-    147,
-    147,
-    147,
-    147,
-    148,
-    148,
-    148,
-    148,
-    148,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    149,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    132,
-    133,
-    134,
-    135,
-    136,
-    136,
-    137,
-    138,
-    139,
-    139,
-    140,
-    141,
-    141,
-    142,
-    143,
-    143,
-    144,
-    144,
-    145,
-    145,
-    146,
-    146,
-    146,
-    147,
-    147,
-    147,
-    148,
-    148,
-    148,
-    148,
-    149,
-    149,
-    149,
-    149,
-    149,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    150,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    133,
-    134,
-    135,
-    136,
-    137,
-    137,
-    138,
-    139,
-    140,
-    140,
-    141,
-    142,
-    142,
-    143,
-    144,
-    144,
-    145,
-    145,
-    146,
-    146,
-    147,
-    147,
-    147,
-    148,
-    148,
-    148,
-    149,
-    149,
-    149,
-    149,
-    150,
-    150,
-    150,
-    150,
-    150,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    151,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    134,
-    135,
-    136,
-    137,
-    138,
-    138,
-    139,
-    140,
-    141,
-    141,
-    142,
-    143,
-    143,
-    144,
-    145,
-    145,
-    146,
-    146,
-    147,
-    147,
-    148,
-    148,
-    148,
-    149,
-    149,
-    149,
-    150,
-    150,
-    150,
-    150,
-    151,
-    151,
-    151,
-    151,
-    151,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    152,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    135,
-    136,
-    137,
-    138,
-    139,
-    139,
-    140,
-    141,
-    142,
-    142,
-    143,
-    144,
-    144,
-    145,
-    146,
-    146,
-    147,
-    147,
-    148,
-    148,
-    149,
-    149,
-    149,
-    150,
-    150,
-    150,
-    151,
-    151,
-    151,
-    151,
-    152,
-    152,
-    152,
-    152,
-    152,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    153,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    136,
-    137,
-    138,
-    139,
-    140,
-    140,
-    141,
-    142,
-    143,
-    143,
-    144,
-    145,
-    145,
-    146,
-    147,
-    147,
-    148,
-    148,
-    149,
-    149,
-    150,
-    150,
-    150,
-    151,
-    151,
-    151,
-    152,
-    152,
-    152,
-    152,
-    153,
-    153,
-    153,
-    153,
-    153,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    154,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    137,
-    138,
-    139,
-    140,
-    141,
-    141,
-    142,
-    143,
-    144,
-    144,
-    145,
-    146,
-    146,
-    147,
-    148,
-    148,
-    149,
-    149,
-    150,
-    150,
-    151,
-    151,
-    151,
-    152,
-    152,
-    152,
-    153,
-    153,
-    153,
-    153,
-    154,
-    154,
-    154,
-    154,
-    154,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    155,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    138,
-    139,
-    140,
-    141,
-    142,
-    142,
-    143,
-    144,
-    145,
-    145,
-    146,
-    147,
-    147,
-    148,
-    149,
-    149,
-    150,
-    150,
-    151,
-    151,
-    152,
-    152,
-    152,
-    153,
-    153,
-    153,
-    154,
-    154,
-    154,
-    154,
-    155,
-    155,
-    155,
-    155,
-    155,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    156,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    139,
-    140,
-    141,
-    142,
-    143,
-    143,
-    144,
-    145,
-    146,
-    146,
-    147,
-    148,
-    148,
-    149,
-    150,
-    150,
-    151,
-    151,
-    152,
-    152,
-    153,
-    153,
-    153,
-    154,
-    154,
-    154,
-    155,
-    155,
-    155,
-    155,
-    156,
-    156,
-    156,
-    156,
-    156,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    157,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    140,
-    141,
-    142,
-    143,
-    144,
-    144,
-    145,
-    146,
-    147,
-    147,
-    148,
-    149,
-    149,
-    150,
-    151,
-    151,
-    152,
-    152,
-    153,
-    153,
-    154,
-    154,
-    154,
-    155,
-    155,
-    155,
-    156,
-    156,
-    156,
-    156,
-    157,
-    157,
-    157,
-    157,
-    157,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    158,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    141,
-    142,
-    143,
-    144,
-    145,
-    145,
-    146,
-    147,
-    148,
-    148,
-    149,
-    150,
-    150,
-    151,
-    152,
-    152,
-    153,
-    153,
-    154,
-    154,
-    155,
-    155,
-    155,
-    156,
-    156,
-    156,
-    157,
-    157,
-    157,
-    157,
-    158,
-    158,
-    158,
-    158,
-    158,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    159,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    142,
-    143,
-    144,
-    145,
-    146,
-    146,
-    147,
-    148,
-    149,
-    149,
-    150,
-    151,
-    151,
-    152,
-    153,
-    153,
-    154,
-    154,
-    155,
-    155,
-    156,
-    156,
-    156,
-    157,
-    157,
-    157,
-    158,
-    158,
-    158,
-    158,
-    159,
-    159,
-    159,
-    159,
-    159,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    160,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    143,
-    144,
-    145,
-    146,
-    147,
-    147,
-    148,
-    149,
-    150,
-    150,
-    151,
-    152,
-    152,
-    153,
-    154,
-    154,
-    155,
-    155,
-    156,
-    156,
-    157,
-    157,
-    157,
-    158,
-    158,
-    158,
-    159,
-    159,
-    159,
-    159,
-    160,
-    160,
-    160,
-    160,
-    160,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    161,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    144,
-    145,
-    146,
-    147,
-    148,
-    148,
-    149,
-    150,
-    151,
-    151,
-    152,
-    153,
-    153,
-    154,
-    155,
-    155,
-    156,
-    156,
-    157,
-    157,
-    158,
-    158,
-    158,
-    159,
-    159,
-    159,
-    160,
-    160,
-    160,
-    160,
-    161,
-    161,
-    161,
-    161,
-    161,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    162,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    145,
-    146,
-    147,
-    148,
-    149,
-    149,
-    150,
-    151,
-    152,
-    152,
-    153,
-    154,
-    154,
-    155,
-    156,
-    156,
-    157,
-    157,
-    158,
-    158,
-    159,
-    159,
-    159,
-    160,
-    160,
-    160,
-    161,
-    161,
-    161,
-    161,
-    162,
-    162,
-    162,
-    162,
-    162,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    163,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    146,
-    147,
-    148,
-    149,
-    150,
-    150,
-    151,
-    152,
-    153,
-    153,
-    154,
-    155,
-    155,
-    156,
-    157,
-    157,
-    158,
-    158,
-    159,
-    159,
-    160,
-    160,
-    160,
-    161,
-    161,
-    161,
-    162,
-    162,
-    162,
-    162,
-    163,
-    163,
-    163,
-    163,
-    163,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    164,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    147,
-    148,
-    149,
-    150,
-    151,
-    151,
-    152,
-    153,
-    154,
-    154,
-    155,
-    156,
-    156,
-    157,
-    158,
-    158,
-    159,
-    159,
-    160,
-    160,
-    161,
-    161,
-    161,
-    162,
-    162,
-    162,
-    163,
-    163,
-    163,
-    163,
-    164,
-    164,
-    164,
-    164,
-    164,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    165,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    148,
-    149,
-    150,
-    151,
-    152,
-    152,
-    153,
-    154,
-    155,
-    155,
-    156,
-    157,
-    157,
-    158,
-    159,
-    159,
-    160,
-    160,
-    161,
-    161,
-    162,
-    162,
-    162,
-    163,
-    163,
-    163,
-    164,
-    164,
-    164,
-    164,
-    165,
-    165,
-    165,
-    165,
-    165,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    166,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    149,
-    150,
-    151,
-    152,
-    153,
-    153,
-    154,
-    155,
-    156,
-    156,
-    157,
-    158,
-    158,
-    159,
-    160,
-    160,
-    161,
-    161,
-    162,
-    162,
-    163,
-    163,
-    163,
-    164,
-    164,
-    164,
-    165,
-    165,
-    165,
-    165,
-    166,
-    166,
-    166,
-    166,
-    166,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    167,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    150,
-    151,
-    152,
-    153,
-    154,
-    154,
-    155,
-    156,
-    157,
-    157,
-    158,
-    159,
-    159,
-    160,
-    161,
-    161,
-    162,
-    162,
-    163,
-    163,
-    164,
-    164,
-    164,
-    165,
-    165,
-    165,
-    166,
-    166,
-    166,
-    166,
-    167,
-    167,
-    167,
-    167,
-    167,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    168,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    151,
-    152,
-    153,
-    154,
-    155,
-    155,
-    156,
-    157,
-    158,
-    158,
-    159,
-    160,
-    160,
-    161,
-    162,
-    162,
-    163,
-    163,
-    164,
-    164,
-    165,
-    165,
-    165,
-    166,
-    166,
-    166,
-    167,
-    167,
-    167,
-    167,
-    168,
-    168,
-    168,
-    168,
-    168,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    152,
-    153,
-    154,
-    155,
-    156,
-    156,
-    157,
-    158,
-    159,
-    159,
-    160,
-    161,
-    161,
-    162,
-    163,
-    163,
-    164,
-    164,
-    165,
-    165,
-    166,
-    166,
-    166,
-    167,
-    167,
-    167,
-    168,
-    168,
-    168,
-    168,
-    169,
-    169,
-    169,
-    169,
-    169,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    170,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    153,
-    154,
-    155,
-    156,
-    157,
-    157,
-    158,
-    159,
-    160,
-    160,
-    161,
-    162,
-    162,
-    163,
-    164,
-    164,
-    165,
-    165,
-    166,
-    166,
-    167,
-    167,
-    167,
-    168,
-    168,
-    168,
-    169,
-    169,
-    169,
-    169,
-    170,
-    170,
-    170,
-    170,
-    170,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    171,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    154,
-    155,
-    156,
-    157,
-    158,
-    158,
-    159,
-    160,
-    161,
-    161,
-    162,
-    163,
-    163,
-    164,
-    165,
-    165,
-    166,
-    166,
-    167,
-    167,
-    168,
-    168,
-    168,
-    169,
-    169,
-    169,
-    170,
-    170,
-    170,
-    170,
-    171,
-    171,
-    171,
-    171,
-    171,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    172,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    155,
-    156,
-    157,
-    158,
-    159,
-    159,
-    160,
-    161,
-    162,
-    162,
-    163,
-    164,
-    164,
-    165,
-    166,
-    166,
-    167,
-    167,
-    168,
-    168,
-    169,
-    169,
-    169,
-    170,
-    170,
-    170,
-    171,
-    171,
-    171,
-    171,
-    172,
-    172,
-    172,
-    172,
-    172,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    173,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    156,
-    157,
-    158,
-    159,
-    160,
-    160,
-    161,
-    162,
-    163,
-    163,
-    164,
-    165,
-    165,
-    166,
-    167,
-    167,
-    168,
-    168,
-    169,
-    169,
-    170,
-    170,
-    170,
-    171,
-    171,
-    171,
-    172,
-    172,
-    172,
-    172,
-    173,
-    173,
-    173,
-    173,
-    173,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    174,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    157,
-    158,
-    159,
-    160,
-    161,
-    161,
-    162,
-    163,
-    164,
-    164,
-    165,
-    166,
-    166,
-    167,
-    168,
-    168,
-    169,
-    169,
-    170,
-    170,
-    171,
-    171,
-    171,
-    172,
-    172,
-    172,
-    173,
-    173,
-    173,
-    173,
-    174,
-    174,
-    174,
-    174,
-    174,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    175,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    158,
-    159,
-    160,
-    161,
-    162,
-    162,
-    163,
-    164,
-    165,
-    165,
-    166,
-    167,
-    167,
-    168,
-    169,
-    169,
-    170,
-    170,
-    171,
-    171,
-    172,
-    172,
-    172,
-    173,
-    173,
-    173,
-    174,
-    174,
-    174,
-    174,
-    175,
-    175,
-    175,
-    175,
-    175,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    176,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    159,
-    160,
-    161,
-    162,
-    163,
-    163,
-    164,
-    165,
-    166,
-    166,
-    167,
-    168,
-    168,
-    169,
-    170,
-    170,
-    171,
-    171,
-    172,
-    172,
-    173,
-    173,
-    173,
-    174,
-    174,
-    174,
-    175,
-    175,
-    175,
-    175,
-    176,
-    176,
-    176,
-    176,
-    176,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    177,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    160,
-    161,
-    162,
-    163,
-    164,
-    164,
-    165,
-    166,
-    167,
-    167,
-    168,
-    169,
-    169,
-    170,
-    171,
-    171,
-    172,
-    172,
-    173,
-    173,
-    174,
-    174,
-    174,
-    175,
-    175,
-    175,
-    176,
-    176,
-    176,
-    176,
-    177,
-    177,
-    177,
-    177,
-    177,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    178,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    161,
-    162,
-    163,
-    164,
-    165,
-    165,
-    166,
-    167,
-    168,
-    168,
-    169,
-    170,
-    170,
-    171,
-    172,
-    172,
-    173,
-    173,
-    174,
-    174,
-    175,
-    175,
-    175,
-    176,
-    176,
-    176,
-    177,
-    177,
-    177,
-    177,
-    178,
-    178,
-    178,
-    178,
-    178,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    179,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    162,
-    163,
-    164,
-    165,
-    166,
-    166,
-    167,
-    168,
-    169,
-    169,
-    170,
-    171,
-    171,
-    172,
-    173,
-    173,
-    174,
-    174,
-    175,
-    175,
-    176,
-    176,
-    176,
-    177,
-    177,
-    177,
-    178,
-    178,
-    178,
-    178,
-    179,
-    179,
-    179,
-    179,
-    179,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    180,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    163,
-    164,
-    165,
-    166,
-    167,
-    167,
-    168,
-    169,
-    170,
-    170,
-    171,
-    172,
-    172,
-    173,
-    174,
-    174,
-    175,
-    175,
-    176,
-    176,
-    177,
-    177,
-    177,
-    178,
-    178,
-    178,
-    179,
-    179,
-    179,
-    179,
-    180,
-    180,
-    180,
-    180,
-    180,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    181,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    164,
-    165,
-    166,
-    167,
-    168,
-    168,
-    169,
-    170,
-    171,
-    171,
-    172,
-    173,
-    173,
-    174,
-    175,
-    175,
-    176,
-    176,
-    177,
-    177,
-    178,
-    178,
-    178,
-    179,
-    179,
-    179,
-    180,
-    180,
-    180,
-    180,
-    181,
-    181,
-    181,
-    181,
-    181,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    182,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    165,
-    166,
-    167,
-    168,
-    169,
-    169,
-    170,
-    171,
-    172,
-    172,
-    173,
-    174,
-    174,
-    175,
-    176,
-    176,
-    177,
-    177,
-    178,
-    178,
-    179,
-    179,
-    179,
-    180,
-    180,
-    180,
-    181,
-    181,
-    181,
-    181,
-    182,
-    182,
-    182,
-    182,
-    182,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    183,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    166,
-    167,
-    168,
-    169,
-    170,
-    170,
-    171,
-    172,
-    173,
-    173,
-    174,
-    175,
-    175,
-    176,
-    177,
-    177,
-    178,
-    178,
-    179,
-    179,
-    180,
-    180,
-    180,
-    181,
-    181,
-    181,
-    182,
-    182,
-    182,
-    182,
-    183,
-    183,
-    183,
-    183,
-    183,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    184,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    167,
-    168,
-    169,
-    170,
-    171,
-    171,
-    172,
-    173,
-    174,
-    174,
-    175,
-    176,
-    176,
-    177,
-    178,
-    178,
-    179,
-    179,
-    180,
-    180,
-    181,
-    181,
-    181,
-    182,
-    182,
-    182,
-    183,
-    183,
-    183,
-    183,
-    184,
-    184,
-    184,
-    184,
-    184,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    185,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    168,
-    169,
-    170,
-    171,
-    172,
-    172,
-    173,
-    174,
-    175,
-    175,
-    176,
-    177,
-    177,
-    178,
-    179,
-    179,
-    180,
-    180,
-    181,
-    181,
-    182,
-    182,
-    182,
-    183,
-    183,
-    183,
-    184,
-    184,
-    184,
-    184,
-    185,
-    185,
-    185,
-    185,
-    185,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    186,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    169,
-    170,
-    171,
-    172,
-    173,
-    173,
-    174,
-    175,
-    176,
-    176,
-    177,
-    178,
-    178,
-    179,
-    180,
-    180,
-    181,
-    181,
-    182,
-    182,
-    183,
-    183,
-    183,
-    184,
-    184,
-    184,
-    185,
-    185,
-    185,
-    185,
-    186,
-    186,
-    186,
-    186,
-    186,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    187,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    170,
-    171,
-    172,
-    173,
-    174,
-    174,
-    175,
-    176,
-    177,
-    177,
-    178,
-    179,
-    179,
-    180,
-    181,
-    181,
-    182,
-    182,
-    183,
-    183,
-    184,
-    184,
-    184,
-    185,
-    185,
-    185,
-    186,
-    186,
-    186,
-    186,
-    187,
-    187,
-    187,
-    187,
-    187,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    188,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    171,
-    172,
-    173,
-    174,
-    175,
-    175,
-    176,
-    177,
-    178,
-    178,
-    179,
-    180,
-    180,
-    181,
-    182,
-    182,
-    183,
-    183,
-    184,
-    184,
-    185,
-    185,
-    185,
-    186,
-    186,
-    186,
-    187,
-    187,
-    187,
-    187,
-    188,
-    188,
-    188,
-    188,
-    188,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    189,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    172,
-    173,
-    174,
-    175,
-    176,
-    176,
-    177,
-    178,
-    179,
-    179,
-    180,
-    181,
-    181,
-    182,
-    183,
-    183,
-    184,
-    184,
-    185,
-    185,
-    186,
-    186,
-    186,
-    187,
-    187,
-    187,
-    188,
-    188,
-    188,
-    188,
-    189,
-    189,
-    189,
-    189,
-    189,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    190,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    173,
-    174,
-    175,
-    176,
-    177,
-    177,
-    178,
-    179,
-    180,
-    180,
-    181,
-    182,
-    182,
-    183,
-    184,
-    184,
-    185,
-    185,
-    186,
-    186,
-    187,
-    187,
-    187,
-    188,
-    188,
-    188,
-    189,
-    189,
-    189,
-    189,
-    190,
-    190,
-    190,
-    190,
-    190,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    191,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    174,
-    175,
-    176,
-    177,
-    178,
-    178,
-    179,
-    180,
-    181,
-    181,
-    182,
-    183,
-    183,
-    184,
-    185,
-    185,
-    186,
-    186,
-    187,
-    187,
-    188,
-    188,
-    188,
-    189,
-    189,
-    189,
-    190,
-    190,
-    190,
-    190,
-    191,
-    191,
-    191,
-    191,
-    191,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    192,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    175,
-    176,
-    177,
-    178,
-    179,
-    179,
-    180,
-    181,
-    182,
-    182,
-    183,
-    184,
-    184,
-    185,
-    186,
-    186,
-    187,
-    187,
-    188,
-    188,
-    189,
-    189,
-    189,
-    190,
-    190,
-    190,
-    191,
-    191,
-    191,
-    191,
-    192,
-    192,
-    192,
-    192,
-    192,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    193,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    176,
-    177,
-    178,
-    179,
-    180,
-    180,
-    181,
-    182,
-    183,
-    183,
-    184,
-    185,
-    185,
-    186,
-    187,
-    187,
-    188,
-    188,
-    189,
-    189,
-    190,
-    190,
-    190,
-    191,
-    191,
-    191,
-    192,
-    192,
-    192,
-    192,
-    193,
-    193,
-    193,
-    193,
-    193,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    194,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    177,
-    178,
-    179,
-    180,
-    181,
-    181,
-    182,
-    183,
-    184,
-    184,
-    185,
-    186,
-    186,
-    187,
-    188,
-    188,
-    189,
-    189,
-    190,
-    190,
-    191,
-    191,
-    191,
-    192,
-    192,
-    192,
-    193,
-    193,
-    193,
-    193,
-    194,
-    194,
-    194,
-    194,
-    194,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    195,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    178,
-    179,
-    180,
-    181,
-    182,
-    182,
-    183,
-    184,
-    185,
-    185,
-    186,
-    187,
-    187,
-    188,
-    189,
-    189,
-    190,
-    190,
-    191,
-    191,
-    192,
-    192,
-    192,
-    193,
-    193,
-    193,
-    194,
-    194,
-    194,
-    194,
-    195,
-    195,
-    195,
-    195,
-    195,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    196,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    179,
-    180,
-    181,
-    182,
-    183,
-    183,
-    184,
-    185,
-    186,
-    186,
-    187,
-    188,
-    188,
-    189,
-    190,
-    190,
-    191,
-    191,
-    192,
-    192,
-    193,
-    193,
-    193,
-    194,
-    194,
-    194,
-    195,
-    195,
-    195,
-    195,
-    196,
-    196,
-    196,
-    196,
-    196,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    197,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    180,
-    181,
-    182,
-    183,
-    184,
-    184,
-    185,
-    186,
-    187,
-    187,
-    188,
-    189,
-    189,
-    190,
-    191,
-    191,
-    192,
-    192,
-    193,
-    193,
-    194,
-    194,
-    194,
-    195,
-    195,
-    195,
-    196,
-    196,
-    196,
-    196,
-    197,
-    197,
-    197,
-    197,
-    197,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    198,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    181,
-    182,
-    183,
-    184,
-    185,
-    185,
-    186,
-    187,
-    188,
-    188,
-    189,
-    190,
-    190,
-    191,
-    192,
-    192,
-    193,
-    193,
-    194,
-    194,
-    195,
-    195,
-    195,
-    196,
-    196,
-    196,
-    197,
-    197,
-    197,
-    197,
-    198,
-    198,
-    198,
-    198,
-    198,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    199,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    182,
-    183,
-    184,
-    185,
-    186,
-    186,
-    187,
-    188,
-    189,
-    189,
-    190,
-    191,
-    191,
-    192,
-    193,
-    193,
-    194,
-    194,
-    195,
-    195,
-    196,
-    196,
-    196,
-    197,
-    197,
-    197,
-    198,
-    198,
-    198,
-    198,
-    199,
-    199,
-    199,
-    199,
-    199,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    200,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    183,
-    184,
-    185,
-    186,
-    187,
-    187,
-    188,
-    189,
-    190,
-    190,
-    191,
-    192,
-    192,
-    193,
-    194,
-    194,
-    195,
-    195,
-    196,
-    196,
-    197,
-    197,
-    197,
-    198,
-    198,
-    198,
-    199,
-    199,
-    199,
-    199,
-    200,
-    200,
-    200,
-    200,
-    200,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    201,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    184,
-    185,
-    186,
-    187,
-    188,
-    188,
-    189,
-    190,
-    191,
-    191,
-    192,
-    193,
-    193,
-    194,
-    195,
-    195,
-    196,
-    196,
-    197,
-    197,
-    198,
-    198,
-    198,
-    199,
-    199,
-    199,
-    200,
-    200,
-    200,
-    200,
-    201,
-    201,
-    201,
-    201,
-    201,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    202,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    185,
-    186,
-    187,
-    188,
-    189,
-    189,
-    190,
-    191,
-    192,
-    192,
-    193,
-    194,
-    194,
-    195,
-    196,
-    196,
-    197,
-    197,
-    198,
-    198,
-    199,
-    199,
-    199,
-    200,
-    200,
-    200,
-    201,
-    201,
-    201,
-    201,
-    202,
-    202,
-    202,
-    202,
-    202,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    203,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    186,
-    187,
-    188,
-    189,
-    190,
-    190,
-    191,
-    192,
-    193,
-    193,
-    194,
-    195,
-    195,
-    196,
-    197,
-    197,
-    198,
-    198,
-    199,
-    199,
-    200,
-    200,
-    200,
-    201,
-    201,
-    201,
-    202,
-    202,
-    202,
-    202,
-    203,
-    203,
-    203,
-    203,
-    203,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    204,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    187,
-    188,
-    189,
-    190,
-    191,
-    191,
-    192,
-    193,
-    194,
-    194,
-    195,
-    196,
-    196,
-    197,
-    198,
-    198,
-    199,
-    199,
-    200,
-    200,
-    201,
-    201,
-    201,
-    202,
-    202,
-    202,
-    203,
-    203,
-    203,
-    203,
-    204,
-    204,
-    204,
-    204,
-    204,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    205,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    188,
-    189,
-    190,
-    191,
-    192,
-    192,
-    193,
-    194,
-    195,
-    195,
-    196,
-    197,
-    197,
-    198,
-    199,
-    199,
-    200,
-    200,
-    201,
-    201,
-    202,
-    202,
-    202,
-    203,
-    203,
-    203,
-    204,
-    204,
-    204,
-    204,
-    205,
-    205,
-    205,
-    205,
-    205,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    206,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    189,
-    190,
-    191,
-    192,
-    193,
-    193,
-    194,
-    195,
-    196,
-    196,
-    197,
-    198,
-    198,
-    199,
-    200,
-    200,
-    201,
-    201,
-    202,
-    202,
-    203,
-    203,
-    203,
-    204,
-    204,
-    204,
-    205,
-    205,
-    205,
-    205,
-    206,
-    206,
-    206,
-    206,
-    206,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    207,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    190,
-    191,
-    192,
-    193,
-    194,
-    194,
-    195,
-    196,
-    197,
-    197,
-    198,
-    199,
-    199,
-    200,
-    201,
-    201,
-    202,
-    202,
-    203,
-    203,
-    204,
-    204,
-    204,
-    205,
-    205,
-    205,
-    206,
-    206,
-    206,
-    206,
-    207,
-    207,
-    207,
-    207,
-    207,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    208,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    191,
-    192,
-    193,
-    194,
-    195,
-    195,
-    196,
-    197,
-    198,
-    198,
-    199,
-    200,
-    200,
-    201,
-    202,
-    202,
-    203,
-    203,
-    204,
-    204,
-    205,
-    205,
-    205,
-    206,
-    206,
-    206,
-    207,
-    207,
-    207,
-    207,
-    208,
-    208,
-    208,
-    208,
-    208,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    209,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    192,
-    193,
-    194,
-    195,
-    196,
-    196,
-    197,
-    198,
-    199,
-    199,
-    200,
-    201,
-    201,
-    202,
-    203,
-    203,
-    204,
-    204,
-    205,
-    205,
-    206,
-    206,
-    206,
-    207,
-    207,
-    207,
-    208,
-    208,
-    208,
-    208,
-    209,
-    209,
-    209,
-    209,
-    209,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    210,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    193,
-    194,
-    195,
-    196,
-    197,
-    197,
-    198,
-    199,
-    200,
-    200,
-    201,
-    202,
-    202,
-    203,
-    204,
-    204,
-    205,
-    205,
-    206,
-    206,
-    207,
-    207,
-    207,
-    208,
-    208,
-    208,
-    209,
-    209,
-    209,
-    209,
-    210,
-    210,
-    210,
-    210,
-    210,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    211,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    194,
-    195,
-    196,
-    197,
-    198,
-    198,
-    199,
-    200,
-    201,
-    201,
-    202,
-    203,
-    203,
-    204,
-    205,
-    205,
-    206,
-    206,
-    207,
-    207,
-    208,
-    208,
-    208,
-    209,
-    209,
-    209,
-    210,
-    210,
-    210,
-    210,
-    211,
-    211,
-    211,
-    211,
-    211,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    212,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    195,
-    196,
-    197,
-    198,
-    199,
-    199,
-    200,
-    201,
-    202,
-    202,
-    203,
-    204,
-    204,
-    205,
-    206,
-    206,
-    207,
-    207,
-    208,
-    208,
-    209,
-    209,
-    209,
-    210,
-    210,
-    210,
-    211,
-    211,
-    211,
-    211,
-    212,
-    212,
-    212,
-    212,
-    212,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    213,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    196,
-    197,
-    198,
-    199,
-    200,
-    200,
-    201,
-    202,
-    203,
-    203,
-    204,
-    205,
-    205,
-    206,
-    207,
-    207,
-    208,
-    208,
-    209,
-    209,
-    210,
-    210,
-    210,
-    211,
-    211,
-    211,
-    212,
-    212,
-    212,
-    212,
-    213,
-    213,
-    213,
-    213,
-    213,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    214,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    197,
-    198,
-    199,
-    200,
-    201,
-    201,
-    202,
-    203,
-    204,
-    204,
-    205,
-    206,
-    206,
-    207,
-    208,
-    208,
-    209,
-    209,
-    210,
-    210,
-    211,
-    211,
-    211,
-    212,
-    212,
-    212,
-    213,
-    213,
-    213,
-    213,
-    214,
-    214,
-    214,
-    214,
-    214,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    215,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    198,
-    199,
-    200,
-    201,
-    202,
-    202,
-    203,
-    204,
-    205,
-    205,
-    206,
-    207,
-    207,
-    208,
-    209,
-    209,
-    210,
-    210,
-    211,
-    211,
-    212,
-    212,
-    212,
-    213,
-    213,
-    213,
-    214,
-    214,
-    214,
-    214,
-    215,
-    215,
-    215,
-    215,
-    215,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    216,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    199,
-    200,
-    201,
-    202,
-    203,
-    203,
-    204,
-    205,
-    206,
-    206,
-    207,
-    208,
-    208,
-    209,
-    210,
-    210,
-    211,
-    211,
-    212,
-    212,
-    213,
-    213,
-    213,
-    214,
-    214,
-    214,
-    215,
-    215,
-    215,
-    215,
-    216,
-    216,
-    216,
-    216,
-    216,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    217,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    200,
-    201,
-    202,
-    203,
-    204,
-    204,
-    205,
-    206,
-    207,
-    207,
-    208,
-    209,
-    209,
-    210,
-    211,
-    211,
-    212,
-    212,
-    213,
-    213,
-    214,
-    214,
-    214,
-    215,
-    215,
-    215,
-    216,
-    216,
-    216,
-    216,
-    217,
-    217,
-    217,
-    217,
-    217,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    218,
-    219,
-    219,
-    219,
-    219,
-    219,
-    219,
-    219,
-    219,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    201,
-    202,
-    203,
-    204,
-    205,
-    205,
-    206,
-    207,
-    208,
-    208,
-    209,
-    210,
-    210,
-    211,
-    212,
-    212,
-    213,
-    213,
-    214,
-    214,
-    215,
-    215,
-    215,
-    216,
-    216,
-    216,
-    217,
-    217,
-    217,
-    217,
-    218,
-    218,
-    218,
-    218,
-    218,
-    219,
-    219,
-    219,
-    219,
-    219,
-    219,
-    219,
-    219,
-    219,
-    219,
-    219,
-    220,
-    220,
-    220,
-    220,
-    220,
-    220,
-    220,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    202,
-    203,
-    204,
-    205,
-    206,
-    206,
-    207,
-    208,
-    209,
-    209,
-    210,
-    211,
-    211,
-    212,
-    213,
-    213,
-    214,
-    214,
-    215,
-    215,
-    216,
-    216,
-    216,
-    217,
-    217,
-    217,
-    218,
-    218,
-    218,
-    218,
-    219,
-    219,
-    219,
-    219,
-    219,
-    220,
-    220,
-    220,
-    220,
-    220,
-    220,
-    220,
-    220,
-    220,
-    220,
-    220,
-    221,
-    221,
-    221,
-    221,
-    221,
-    221,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    203,
-    204,
-    205,
-    206,
-    207,
-    207,
-    208,
-    209,
-    210,
-    210,
-    211,
-    212,
-    212,
-    213,
-    214,
-    214,
-    215,
-    215,
-    216,
-    216,
-    217,
-    217,
-    217,
-    218,
-    218,
-    218,
-    219,
-    219,
-    219,
-    219,
-    220,
-    220,
-    220,
-    220,
-    220,
-    221,
-    221,
-    221,
-    221,
-    221,
-    221,
-    221,
-    221,
-    221,
-    221,
-    221,
-    222,
-    222,
-    222,
-    222,
-    222,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    204,
-    205,
-    206,
-    207,
-    208,
-    208,
-    209,
-    210,
-    211,
-    211,
-    212,
-    213,
-    213,
-    214,
-    215,
-    215,
-    216,
-    216,
-    217,
-    217,
-    218,
-    218,
-    218,
-    219,
-    219,
-    219,
-    220,
-    220,
-    220,
-    220,
-    221,
-    221,
-    221,
-    221,
-    221,
-    222,
-    222,
-    222,
-    222,
-    222,
-    222,
-    222,
-    222,
-    222,
-    222,
-    222,
-    223,
-    223,
-    223,
-    223,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    205,
-    206,
-    207,
-    208,
-    209,
-    209,
-    210,
-    211,
-    212,
-    212,
-    213,
-    214,
-    214,
-    215,
-    216,
-    216,
-    217,
-    217,
-    218,
-    218,
-    219,
-    219,
-    219,
-    220,
-    220,
-    220,
-    221,
-    221,
-    221,
-    221,
-    222,
-    222,
-    222,
-    222,
-    222,
-    223,
-    223,
-    223,
-    223,
-    223,
-    223,
-    223,
-    223,
-    223,
-    223,
-    223,
-    224,
-    224,
-    224,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    206,
-    207,
-    208,
-    209,
-    210,
-    210,
-    211,
-    212,
-    213,
-    213,
-    214,
-    215,
-    215,
-    216,
-    217,
-    217,
-    218,
-    218,
-    219,
-    219,
-    220,
-    220,
-    220,
-    221,
-    221,
-    221,
-    222,
-    222,
-    222,
-    222,
-    223,
-    223,
-    223,
-    223,
-    223,
-    224,
-    224,
-    224,
-    224,
-    224,
-    224,
-    224,
-    224,
-    224,
-    224,
-    224,
-    225,
-    225,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    207,
-    208,
-    209,
-    210,
-    211,
-    211,
-    212,
-    213,
-    214,
-    214,
-    215,
-    216,
-    216,
-    217,
-    218,
-    218,
-    219,
-    219,
-    220,
-    220,
-    221,
-    221,
-    221,
-    222,
-    222,
-    222,
-    223,
-    223,
-    223,
-    223,
-    224,
-    224,
-    224,
-    224,
-    224,
-    225,
-    225,
-    225,
-    225,
-    225,
-    225,
-    225,
-    225,
-    225,
-    225,
-    225,
-    226,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    208,
-    209,
-    210,
-    211,
-    212,
-    212,
-    213,
-    214,
-    215,
-    215,
-    216,
-    217,
-    217,
-    218,
-    219,
-    219,
-    220,
-    220,
-    221,
-    221,
-    222,
-    222,
-    222,
-    223,
-    223,
-    223,
-    224,
-    224,
-    224,
-    224,
-    225,
-    225,
-    225,
-    225,
-    225,
-    226,
-    226,
-    226,
-    226,
-    226,
-    226,
-    226,
-    226,
-    226,
-    226,
-    226,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    209,
-    210,
-    211,
-    212,
-    213,
-    213,
-    214,
-    215,
-    216,
-    216,
-    217,
-    218,
-    218,
-    219,
-    220,
-    220,
-    221,
-    221,
-    222,
-    222,
-    223,
-    223,
-    223,
-    224,
-    224,
-    224,
-    225,
-    225,
-    225,
-    225,
-    226,
-    226,
-    226,
-    226,
-    226,
-    227,
-    227,
-    227,
-    227,
-    227,
-    227,
-    227,
-    227,
-    227,
-    227,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    210,
-    211,
-    212,
-    213,
-    214,
-    214,
-    215,
-    216,
-    217,
-    217,
-    218,
-    219,
-    219,
-    220,
-    221,
-    221,
-    222,
-    222,
-    223,
-    223,
-    224,
-    224,
-    224,
-    225,
-    225,
-    225,
-    226,
-    226,
-    226,
-    226,
-    227,
-    227,
-    227,
-    227,
-    227,
-    228,
-    228,
-    228,
-    228,
-    228,
-    228,
-    228,
-    228,
-    228,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    211,
-    212,
-    213,
-    214,
-    215,
-    215,
-    216,
-    217,
-    218,
-    218,
-    219,
-    220,
-    220,
-    221,
-    222,
-    222,
-    223,
-    223,
-    224,
-    224,
-    225,
-    225,
-    225,
-    226,
-    226,
-    226,
-    227,
-    227,
-    227,
-    227,
-    228,
-    228,
-    228,
-    228,
-    228,
-    229,
-    229,
-    229,
-    229,
-    229,
-    229,
-    229,
-    229,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    212,
-    213,
-    214,
-    215,
-    216,
-    216,
-    217,
-    218,
-    219,
-    219,
-    220,
-    221,
-    221,
-    222,
-    223,
-    223,
-    224,
-    224,
-    225,
-    225,
-    226,
-    226,
-    226,
-    227,
-    227,
-    227,
-    228,
-    228,
-    228,
-    228,
-    229,
-    229,
-    229,
-    229,
-    229,
-    230,
-    230,
-    230,
-    230,
-    230,
-    230,
-    230,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    213,
-    214,
-    215,
-    216,
-    217,
-    217,
-    218,
-    219,
-    220,
-    220,
-    221,
-    222,
-    222,
-    223,
-    224,
-    224,
-    225,
-    225,
-    226,
-    226,
-    227,
-    227,
-    227,
-    228,
-    228,
-    228,
-    229,
-    229,
-    229,
-    229,
-    230,
-    230,
-    230,
-    230,
-    230,
-    231,
-    231,
-    231,
-    231,
-    231,
-    231,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    214,
-    215,
-    216,
-    217,
-    218,
-    218,
-    219,
-    220,
-    221,
-    221,
-    222,
-    223,
-    223,
-    224,
-    225,
-    225,
-    226,
-    226,
-    227,
-    227,
-    228,
-    228,
-    228,
-    229,
-    229,
-    229,
-    230,
-    230,
-    230,
-    230,
-    231,
-    231,
-    231,
-    231,
-    231,
-    232,
-    232,
-    232,
-    232,
-    232,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    215,
-    216,
-    217,
-    218,
-    219,
-    219,
-    220,
-    221,
-    222,
-    222,
-    223,
-    224,
-    224,
-    225,
-    226,
-    226,
-    227,
-    227,
-    228,
-    228,
-    229,
-    229,
-    229,
-    230,
-    230,
-    230,
-    231,
-    231,
-    231,
-    231,
-    232,
-    232,
-    232,
-    232,
-    232,
-    233,
-    233,
-    233,
-    233,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    216,
-    217,
-    218,
-    219,
-    220,
-    220,
-    221,
-    222,
-    223,
-    223,
-    224,
-    225,
-    225,
-    226,
-    227,
-    227,
-    228,
-    228,
-    229,
-    229,
-    230,
-    230,
-    230,
-    231,
-    231,
-    231,
-    232,
-    232,
-    232,
-    232,
-    233,
-    233,
-    233,
-    233,
-    233,
-    234,
-    234,
-    234,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    217,
-    218,
-    219,
-    220,
-    221,
-    221,
-    222,
-    223,
-    224,
-    224,
-    225,
-    226,
-    226,
-    227,
-    228,
-    228,
-    229,
-    229,
-    230,
-    230,
-    231,
-    231,
-    231,
-    232,
-    232,
-    232,
-    233,
-    233,
-    233,
-    233,
-    234,
-    234,
-    234,
-    234,
-    234,
-    235,
-    235,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    218,
-    219,
-    220,
-    221,
-    222,
-    222,
-    223,
-    224,
-    225,
-    225,
-    226,
-    227,
-    227,
-    228,
-    229,
-    229,
-    230,
-    230,
-    231,
-    231,
-    232,
-    232,
-    232,
-    233,
-    233,
-    233,
-    234,
-    234,
-    234,
-    234,
-    235,
-    235,
-    235,
-    235,
-    235,
-    236,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    219,
-    220,
-    221,
-    222,
-    223,
-    223,
-    224,
-    225,
-    226,
-    226,
-    227,
-    228,
-    228,
-    229,
-    230,
-    230,
-    231,
-    231,
-    232,
-    232,
-    233,
-    233,
-    233,
-    234,
-    234,
-    234,
-    235,
-    235,
-    235,
-    235,
-    236,
-    236,
-    236,
-    236,
-    236,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    220,
-    221,
-    222,
-    223,
-    224,
-    224,
-    225,
-    226,
-    227,
-    227,
-    228,
-    229,
-    229,
-    230,
-    231,
-    231,
-    232,
-    232,
-    233,
-    233,
-    234,
-    234,
-    234,
-    235,
-    235,
-    235,
-    236,
-    236,
-    236,
-    236,
-    237,
-    237,
-    237,
-    237,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    221,
-    222,
-    223,
-    224,
-    225,
-    225,
-    226,
-    227,
-    228,
-    228,
-    229,
-    230,
-    230,
-    231,
-    232,
-    232,
-    233,
-    233,
-    234,
-    234,
-    235,
-    235,
-    235,
-    236,
-    236,
-    236,
-    237,
-    237,
-    237,
-    237,
-    238,
-    238,
-    238,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    222,
-    223,
-    224,
-    225,
-    226,
-    226,
-    227,
-    228,
-    229,
-    229,
-    230,
-    231,
-    231,
-    232,
-    233,
-    233,
-    234,
-    234,
-    235,
-    235,
-    236,
-    236,
-    236,
-    237,
-    237,
-    237,
-    238,
-    238,
-    238,
-    238,
-    239,
-    239,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    223,
-    224,
-    225,
-    226,
-    227,
-    227,
-    228,
-    229,
-    230,
-    230,
-    231,
-    232,
-    232,
-    233,
-    234,
-    234,
-    235,
-    235,
-    236,
-    236,
-    237,
-    237,
-    237,
-    238,
-    238,
-    238,
-    239,
-    239,
-    239,
-    239,
-    240,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    224,
-    224,
-    225,
-    226,
-    227,
-    228,
-    228,
-    229,
-    230,
-    231,
-    231,
-    232,
-    233,
-    233,
-    234,
-    235,
-    235,
-    236,
-    236,
-    237,
-    237,
-    238,
-    238,
-    238,
-    239,
-    239,
-    239,
-    240,
-    240,
-    240,
-    240,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    224,
-    225,
-    225,
-    226,
-    227,
-    228,
-    229,
-    229,
-    230,
-    231,
-    232,
-    232,
-    233,
-    234,
-    234,
-    235,
-    236,
-    236,
-    237,
-    237,
-    238,
-    238,
-    239,
-    239,
-    239,
-    240,
-    240,
-    240,
-    241,
-    241,
-    241,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    224,
-    225,
-    226,
-    226,
-    227,
-    228,
-    229,
-    230,
-    230,
-    231,
-    232,
-    233,
-    233,
-    234,
-    235,
-    235,
-    236,
-    237,
-    237,
-    238,
-    238,
-    239,
-    239,
-    240,
-    240,
-    240,
-    241,
-    241,
-    241,
-    242,
-    242,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    224,
-    225,
-    226,
-    227,
-    227,
-    228,
-    229,
-    230,
-    231,
-    231,
-    232,
-    233,
-    234,
-    234,
-    235,
-    236,
-    236,
-    237,
-    238,
-    238,
-    239,
-    239,
-    240,
-    240,
-    241,
-    241,
-    241,
-    242,
-    242,
-    242,
-    243,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    224,
-    225,
-    226,
-    227,
-    228,
-    228,
-    229,
-    230,
-    231,
-    232,
-    232,
-    233,
-    234,
-    235,
-    235,
-    236,
-    237,
-    237,
-    238,
-    239,
-    239,
-    240,
-    240,
-    241,
-    241,
-    242,
-    242,
-    242,
-    243,
-    243,
-    243,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    219,
-    220,
-    221,
-    222,
-    223,
-    224,
-    225,
-    226,
-    227,
-    228,
-    229,
-    229,
-    230,
-    231,
-    232,
-    233,
-    233,
-    234,
-    235,
-    236,
-    236,
-    237,
-    238,
-    238,
-    239,
-    240,
-    240,
-    241,
-    241,
-    242,
-    242,
-    243,
-    243,
-    243,
-    244,
-    244,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    220,
-    221,
-    222,
-    223,
-    224,
-    225,
-    226,
-    227,
-    228,
-    229,
-    230,
-    230,
-    231,
-    232,
-    233,
-    234,
-    234,
-    235,
-    236,
-    237,
-    237,
-    238,
-    239,
-    239,
-    240,
-    241,
-    241,
-    242,
-    242,
-    243,
-    243,
-    244,
-    244,
-    244,
-    245,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    221,
-    222,
-    223,
-    224,
-    225,
-    226,
-    227,
-    228,
-    229,
-    230,
-    231,
-    231,
-    232,
-    233,
-    234,
-    235,
-    235,
-    236,
-    237,
-    238,
-    238,
-    239,
-    240,
-    240,
-    241,
-    242,
-    242,
-    243,
-    243,
-    244,
-    244,
-    245,
-    245,
-    245,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    222,
-    223,
-    224,
-    225,
-    226,
-    227,
-    228,
-    229,
-    230,
-    231,
-    232,
-    232,
-    233,
-    234,
-    235,
-    236,
-    236,
-    237,
-    238,
-    239,
-    239,
-    240,
-    241,
-    241,
-    242,
-    243,
-    243,
-    244,
-    244,
-    245,
-    245,
-    246,
-    246,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    223,
-    224,
-    225,
-    226,
-    227,
-    228,
-    229,
-    230,
-    231,
-    232,
-    233,
-    233,
-    234,
-    235,
-    236,
-    237,
-    237,
-    238,
-    239,
-    240,
-    240,
-    241,
-    242,
-    242,
-    243,
-    244,
-    244,
-    245,
-    245,
-    246,
-    246,
-    247,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    224,
-    224,
-    225,
-    226,
-    227,
-    228,
-    229,
-    230,
-    231,
-    232,
-    233,
-    234,
-    234,
-    235,
-    236,
-    237,
-    238,
-    238,
-    239,
-    240,
-    241,
-    241,
-    242,
-    243,
-    243,
-    244,
-    245,
-    245,
-    246,
-    246,
-    247,
-    247,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    224,
-    225,
-    225,
-    226,
-    227,
-    228,
-    229,
-    230,
-    231,
-    232,
-    233,
-    234,
-    235,
-    235,
-    236,
-    237,
-    238,
-    239,
-    239,
-    240,
-    241,
-    242,
-    242,
-    243,
-    244,
-    244,
-    245,
-    246,
-    246,
-    247,
-    247,
-    248,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    8,
-    9,
-    10,
-    11,
-    12,
-    13,
-    14,
-    15,
-    16,
-    17,
-    18,
-    19,
-    20,
-    21,
-    22,
-    23,
-    24,
-    25,
-    26,
-    27,
-    28,
-    29,
-    30,
-    31,
-    32,
-    33,
-    34,
-    35,
-    36,
-    37,
-    38,
-    39,
-    40,
-    41,
-    42,
-    43,
-    44,
-    45,
-    46,
-    47,
-    48,
-    49,
-    50,
-    51,
-    52,
-    53,
-    54,
-    55,
-    56,
-    57,
-    58,
-    59,
-    60,
-    61,
-    62,
-    63,
-    64,
-    65,
-    66,
-    67,
-    68,
-    69,
-    70,
-    71,
-    72,
-    73,
-    74,
-    75,
-    76,
-    77,
-    78,
-    79,
-    80,
-    81,
-    82,
-    83,
-    84,
-    85,
-    86,
-    87,
-    88,
-    89,
-    90,
-    91,
-    92,
-    93,
-    94,
-    95,
-    96,
-    97,
-    98,
-    99,
-    100,
-    101,
-    102,
-    103,
-    104,
-    105,
-    106,
-    107,
-    108,
-    109,
-    110,
-    111,
-    112,
-    113,
-    114,
-    115,
-    116,
-    117,
-    118,
-    119,
-    120,
-    121,
-    122,
-    123,
-    124,
-    125,
-    126,
-    127,
-    128,
-    129,
-    130,
-    131,
-    132,
-    133,
-    134,
-    135,
-    136,
-    137,
-    138,
-    139,
-    140,
-    141,
-    142,
-    143,
-    144,
-    145,
-    146,
-    147,
-    148,
-    149,
-    150,
-    151,
-    152,
-    153,
-    154,
-    155,
-    156,
-    157,
-    158,
-    159,
-    160,
-    161,
-    162,
-    163,
-    164,
-    165,
-    166,
-    167,
-    168,
-    169,
-    170,
-    171,
-    172,
-    173,
-    174,
-    175,
-    176,
-    177,
-    178,
-    179,
-    180,
-    181,
-    182,
-    183,
-    184,
-    185,
-    186,
-    187,
-    188,
-    189,
-    190,
-    191,
-    192,
-    193,
-    194,
-    195,
-    196,
-    197,
-    198,
-    199,
-    200,
-    201,
-    202,
-    203,
-    204,
-    205,
-    206,
-    207,
-    208,
-    209,
-    210,
-    211,
-    212,
-    213,
-    214,
-    215,
-    216,
-    217,
-    218,
-    219,
-    220,
-    221,
-    222,
-    223,
-    224,
-    225,
-    226,
-    226,
-    227,
-    228,
-    229,
-    230,
-    231,
-    232,
-    233,
-    234,
-    235,
-    236,
-    236,
-    237,
-    238,
-    239,
-    240,
-    240,
-    241,
-    242,
-    243,
-    243,
-    244,
-    245,
-    245,
-    246,
-    247,
-    247,
-    248,
-    248,
-};
-
-#endif
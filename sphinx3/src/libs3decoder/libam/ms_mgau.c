@@ -252,13 +252,44 @@ ms_mgau_free(ms_mgau_model_t * msg)
     ckd_free(msg);
 }
 
+ms_mgau_model_t *
+ms_mgau_share(ms_mgau_model_t * msg)
+{
+    ms_mgau_model_t *copy;
+    gauden_t *g;
+
+    g = ms_mgau_gauden(msg);
+    copy = (ms_mgau_model_t *) ckd_calloc(1, sizeof(*copy));
+    copy->g = msg->g;
+    copy->s = msg->s;
+    copy->mgau2sen = msg->mgau2sen;
+    copy->i = msg->i;
+    copy->topn = msg->topn;
+    copy->dist = (gauden_dist_t ***)
+        ckd_calloc_3d(g->n_mgau, g->n_feat, copy->topn,
+                      sizeof(gauden_dist_t));
+    copy->mgau_active = ckd_calloc(g->n_mgau, sizeof(int8));
+
+    return copy;
+}
+
+void
+ms_mgau_share_free(ms_mgau_model_t * msg)
+{
+    if (msg == NULL)
+        return;
+    ckd_free_3d((void *) msg->dist);
+    ckd_free(msg->mgau_active);
+    ckd_free(msg);
+}
+
 int32
 ms_cont_mgau_frame_eval(ascr_t * ascr,
                         ms_mgau_model_t * msg,
                         mdef_t * mdef, float32 ** feat, int32 frame)
 {
     int32 gid;
-    int32 s;
+    int32 s, i;
     int32 topn;
     int32 best;
     gauden_t *g;
@@ -285,11 +316,9 @@ ms_cont_mgau_frame_eval(ascr_t * ascr,
     for (gid = 0; gid < g->n_mgau; gid++)
         msg->mgau_active[gid] = 0;
 
-    for (s = 0; s < ascr->n_sen; s++) {
-        if (ascr->sen_active[s]) {
-            msg->mgau_active[sen->mgau[s]] = 1;
-        }
-    }
+    ascr_flags2list(ascr);
+    for (i = 0; i < ascr->n_sen_active; i++)
+        msg->mgau_active[sen->mgau[ascr->sen_active_list[i]]] = 1;
 
     /* Compute topn gaussian density values (for active codebooks) */
     for (gid = 0; gid < g->n_mgau; gid++) {
@@ -298,32 +327,28 @@ ms_cont_mgau_frame_eval(ascr_t * ascr,
     }
 
     if (interp) {
-        for (s = 0; s < ascr->n_sen; s++) {
-            if (ascr->sen_active[s]) {
-                if (s >= mdef->n_ci_sen) {
-                    interp_cd_ci(interp, ascr->senscr, s,
-                                 mdef->cd2cisen[s]);
-                }
+        for (i = 0; i < ascr->n_sen_active; i++) {
+            s = ascr->sen_active_list[i];
+            if (s >= mdef->n_ci_sen) {
+                interp_cd_ci(interp, ascr->senscr, s,
+                             mdef->cd2cisen[s]);
             }
         }
     }
 
     best = (int32) 0x80000000;
-    for (s = 0; s < ascr->n_sen; s++) {
-        if (ascr->sen_active[s]) {
-            ascr->senscr[s] =
-                senone_eval(sen, s, msg->dist[sen->mgau[s]], topn);
-            if (best < ascr->senscr[s])
-                best = ascr->senscr[s];
-        }
+    for (i = 0; i < ascr->n_sen_active; i++) {
+        s = ascr->sen_active_list[i];
+        ascr->senscr[s] =
+            senone_eval(sen, s, msg->dist[sen->mgau[s]], topn);
+        if (best < ascr->senscr[s])
+            best = ascr->senscr[s];
     }
 
 
     /* Normalize senone scores (interpolation above can only lower best score) */
-    for (s = 0; s < ascr->n_sen; s++) {
-        if (ascr->sen_active[s])
-            ascr->senscr[s] -= best;
-    }
+    for (i = 0; i < ascr->n_sen_active; i++)
+        ascr->senscr[ascr->sen_active_list[i]] -= best;
 
     return best;
 }
@@ -415,6 +415,7 @@ senone_init(const char *mixwfile, const char *sen2mgau_map_file, float32 mixwflo
     }
 
     s->featscr = NULL;
+    s->cwscr = NULL;
     return s;
 }
 
@@ -429,6 +430,8 @@ senone_free(senone_t * s)
         ckd_free(s->mgau);
     if (s->featscr)
         ckd_free(s->featscr);
+    if (s->cwscr)
+        ckd_free(s->cwscr);
     ckd_free(s);
 }
 
@@ -498,17 +501,20 @@ void
 senone_eval_all(senone_t * s, gauden_dist_t ** dist, int32 n_top,
                 int32 * senscr)
 {
-    int32 i, f, k, cwdist, scr;
+    int32 i, f, k, cwdist;
 
     senprob_t *pdf;
-    int32 *featscr = NULL;
-    featscr = s->featscr;
+    int32 *featscr, *cwscr;
 
     assert(s->n_gauden == 1);
     assert((n_top > 0) && (n_top <= s->n_cw));
 
-    if ((s->n_feat > 1) && (!featscr))
-        featscr = (int32 *) ckd_calloc(s->n_sen, sizeof(int32));
+    if ((s->n_feat > 1) && (!s->featscr))
+        s->featscr = (int32 *) ckd_calloc(s->n_sen, sizeof(int32));
+    if ((n_top > 1) && (!s->cwscr))
+        s->cwscr = (int32 *) ckd_calloc(s->n_sen, sizeof(int32));
+    featscr = s->featscr;
+    cwscr = s->cwscr;
 
     /* Feature 0 */
     /* Top-N codeword 0 */
@@ -531,12 +537,12 @@ senone_eval_all(senone_t * s, gauden_dist_t ** dist, int32 n_top,
 
         for (i = 0; i < s->n_sen; i++) {
 #if TRUNCATE_LOGPDF
-            scr = cwdist - (pdf[i] << s->shift);
+            cwscr[i] = cwdist - (pdf[i] << s->shift);
 #else
-            scr = cwdist - (pdf[i]);
+            cwscr[i] = cwdist - (pdf[i]);
 #endif
-            senscr[i] = logmath_add(s->logmath, senscr[i], scr);
         }
+        logmath_add_array(s->logmath, senscr, cwscr, s->n_sen);
     }
 
     /* Remaining features */
@@ -560,12 +566,12 @@ senone_eval_all(senone_t * s, gauden_dist_t ** dist, int32 n_top,
 
             for (i = 0; i < s->n_sen; i++) {
 #if TRUNCATE_LOGPDF
-                scr = cwdist - (pdf[i] << s->shift);
+                cwscr[i] = cwdist - (pdf[i] << s->shift);
 #else
-                scr = cwdist - (pdf[i]);
+                cwscr[i] = cwdist - (pdf[i]);
 #endif
-                featscr[i] = logmath_add(s->logmath, featscr[i], scr);
             }
+            logmath_add_array(s->logmath, featscr, cwscr, s->n_sen);
         }
 
         for (i = 0; i < s->n_sen; i++)
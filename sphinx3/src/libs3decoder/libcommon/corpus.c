@@ -92,12 +92,14 @@
 #include <string.h>
 #ifndef WIN32
 #include <unistd.h>
+#include <fcntl.h>
 #else
 #include <stdlib.h>
 #endif
 
 #include <sphinxbase/pio.h>
 #include <sphinxbase/filename.h>
+#include <sphinxbase/sbthread.h>
 
 #include "corpus.h"
 #include "kb.h"
@@ -680,7 +682,304 @@ ctl_process(const char *ctlfile, const char *ctllmfile, const char *ctlmllrfile,
     return tm;
 }
 
+/** An entry of the control file queued by ctl_process_mt(). */
+typedef struct ctl_job_s {
+    utt_res_t ur;
+    char *uttid;
+    int32 sf, ef;
+    char **out;         /**< What func wrote to each stream */
+    size_t *out_len;
+    int32 done;         /**< Whether func has finished with it */
+} ctl_job_t;
+
+/** Entries queued by ctl_process_mt(), and the threads taking them. */
+typedef struct ctl_pool_s {
+    sbmtx_t *mtx;
+    sbevent_t *queued;  /**< Signalled when there is more to take */
+    sbevent_t *done;    /**< Signalled when a job is done */
+    ctl_job_t *jobs;    /**< Ring of jobs indexed modulo depth */
+    int32 depth;
+    int32 head;         /**< Oldest job not written out yet */
+    int32 next;         /**< Next job to be taken */
+    int32 tail;         /**< One past the last job queued */
+    int32 finished;     /**< Whether all jobs have been queued */
+    int32 n_out;
+    void (*func) (void *wdata, utt_res_t * ur, int32 sf, int32 ef,
+                  char *uttid, FILE ** out);
+} ctl_pool_t;
+
+typedef struct ctl_worker_s {
+    ctl_pool_t *pool;
+    void *wdata;
+    FILE **tmpfp;       /**< Temporary streams passed to func */
+    sbthread_t *thr;
+} ctl_worker_t;
+
+static void
+ctl_job_run(ctl_worker_t * w, ctl_job_t * job)
+{
+    ctl_pool_t *pool = w->pool;
+    int32 i;
+
+    /* The streams are reused, only what this job wrote is read back. */
+    for (i = 0; i < pool->n_out; ++i)
+        fseek(w->tmpfp[i], 0, SEEK_SET);
+    (*pool->func) (w->wdata, &job->ur, job->sf, job->ef, job->uttid,
+                   w->tmpfp);
+    for (i = 0; i < pool->n_out; ++i) {
+        long len = ftell(w->tmpfp[i]);
+
+        job->out_len[i] = 0;
+        if (len <= 0)
+            continue;
+        job->out[i] = ckd_malloc(len);
+        fseek(w->tmpfp[i], 0, SEEK_SET);
+        job->out_len[i] = fread(job->out[i], 1, len, w->tmpfp[i]);
+    }
+}
 
+static int
+ctl_worker_main(sbthread_t * th)
+{
+    ctl_worker_t *w = sbthread_arg(th);
+    ctl_pool_t *pool = w->pool;
+    ctl_job_t *job;
+    int32 more;
+
+    for (;;) {
+        sbmtx_lock(pool->mtx);
+        while (pool->next == pool->tail && !pool->finished) {
+            sbmtx_unlock(pool->mtx);
+            sbevent_wait(pool->queued, -1, -1);
+            sbmtx_lock(pool->mtx);
+        }
+        if (pool->next == pool->tail) {
+            sbmtx_unlock(pool->mtx);
+            /* Pass it on to the others, so they exit too. */
+            sbevent_signal(pool->queued);
+            break;
+        }
+        job = &pool->jobs[pool->next++ % pool->depth];
+        more = pool->next < pool->tail;
+        sbmtx_unlock(pool->mtx);
+        /* Only one waiting thread wakes up per signal. */
+        if (more)
+            sbevent_signal(pool->queued);
+
+        ctl_job_run(w, job);
+        sbmtx_lock(pool->mtx);
+        job->done = TRUE;
+        sbmtx_unlock(pool->mtx);
+        sbevent_signal(pool->done);
+    }
+    return 0;
+}
+
+/* Copy out a finished job and free it, returns FALSE if not finished. */
+static int32
+ctl_pool_write(ctl_pool_t * pool, FILE ** outfp)
+{
+    ctl_job_t *job;
+    int32 i;
+
+    sbmtx_lock(pool->mtx);
+    job = (pool->head < pool->tail) ? &pool->jobs[pool->head % pool->depth]
+        : NULL;
+    if (job == NULL || !job->done) {
+        sbmtx_unlock(pool->mtx);
+        return FALSE;
+    }
+    sbmtx_unlock(pool->mtx);
+
+    for (i = 0; i < pool->n_out; ++i) {
+        if (job->out_len[i] && outfp[i]) {
+            fwrite(job->out[i], 1, job->out_len[i], outfp[i]);
+            fflush(outfp[i]);
+        }
+        ckd_free(job->out[i]);
+        job->out[i] = NULL;
+    }
+    ckd_free(job->ur.uttfile);
+    ckd_free(job->ur.lmname);
+    ckd_free(job->uttid);
+    memset(&job->ur, 0, sizeof(job->ur));
+    job->uttid = NULL;
+
+    sbmtx_lock(pool->mtx);
+    job->done = FALSE;
+    ++pool->head;
+    sbmtx_unlock(pool->mtx);
+    return TRUE;
+}
+
+ptmr_t
+ctl_process_mt(const char *ctlfile, const char *ctllmfile, int32 nskip,
+               int32 count, int32 n_thread,
+               void (*func) (void *wdata, utt_res_t * ur, int32 sf,
+                             int32 ef, char *uttid, FILE ** out),
+               void **wdata,
+               void (*prefetch) (void *pdata, utt_res_t * ur, char *uttid),
+               void *pdata, FILE ** outfp, int32 n_out)
+{
+    FILE *fp, *ctllmfp;
+    char uttfile[16384], uttid[4096];
+    char lmname[4096], tmp[4096];
+    int32 sf, ef, tmp1, tmp2, i, eof;
+    ctl_pool_t pool;
+    ctl_worker_t *workers;
+    ptmr_t tm;
+
+    ptmr_init(&tm);
+    ctllmfp = NULL;
+    if (ctlfile) {
+        if ((fp = fopen(ctlfile, "r")) == NULL)
+            E_FATAL_SYSTEM("fopen(%s,r) failed\n", ctlfile);
+    }
+    else
+        fp = stdin;
+    if (ctllmfile) {
+        E_INFO("LM is used in this session\n");
+        if ((ctllmfp = fopen(ctllmfile, "r")) == NULL)
+            E_FATAL_SYSTEM("fopen(%s,r) failed\n", ctllmfile);
+    }
+
+    if (nskip > 0)
+        E_INFO("Skipping %d entries at the beginning of %s\n", nskip,
+               ctlfile);
+    eof = FALSE;
+    for (; nskip > 0 && !eof; --nskip) {
+        if (ctl_read_entry(fp, uttfile, &sf, &ef, uttid) < 0)
+            eof = TRUE;
+        else if (ctllmfp
+                 && ctl_read_entry(ctllmfp, lmname, &tmp1, &tmp2, tmp) < 0) {
+            E_ERROR("An LM control file is specified but LM cannot be read when skipping the %d-th sentence\n",
+                    nskip);
+            eof = TRUE;
+        }
+    }
+
+    if (n_thread < 1)
+        n_thread = 1;
+    memset(&pool, 0, sizeof(pool));
+    pool.mtx = sbmtx_init();
+    pool.queued = sbevent_init();
+    pool.done = sbevent_init();
+    pool.depth = 4 * n_thread;
+    pool.jobs = ckd_calloc(pool.depth, sizeof(*pool.jobs));
+    for (i = 0; i < pool.depth; ++i) {
+        pool.jobs[i].out = ckd_calloc(n_out, sizeof(*pool.jobs[i].out));
+        pool.jobs[i].out_len =
+            ckd_calloc(n_out, sizeof(*pool.jobs[i].out_len));
+    }
+    pool.n_out = n_out;
+    pool.func = func;
+
+    ptmr_start(&tm);
+    workers = ckd_calloc(n_thread, sizeof(*workers));
+    for (i = 0; i < n_thread; ++i) {
+        ctl_worker_t *w = &workers[i];
+        int32 j;
+
+        w->pool = &pool;
+        w->wdata = wdata[i];
+        w->tmpfp = ckd_calloc(n_out, sizeof(*w->tmpfp));
+        for (j = 0; j < n_out; ++j)
+            if ((w->tmpfp[j] = tmpfile()) == NULL)
+                E_FATAL_SYSTEM("Failed to create temporary file");
+        if ((w->thr = sbthread_start(NULL, ctl_worker_main, w)) == NULL)
+            E_FATAL("Failed to start thread %d\n", i);
+    }
+    E_INFO("Processing control file with %d threads\n", n_thread);
+
+    for (;;) {
+        int32 wrote;
+
+        /* Keep the queue full. */
+        while (!eof && count > 0 && pool.tail - pool.head < pool.depth) {
+            ctl_job_t *job;
+
+            if (ctl_read_entry(fp, uttfile, &sf, &ef, uttid) < 0) {
+                eof = TRUE;
+                break;
+            }
+            if (ctllmfp
+                && ctl_read_entry(ctllmfp, lmname, &tmp1, &tmp2, tmp) < 0) {
+                E_ERROR("LM control file is specified but LM cannot be read when counting the %d-th sentence\n",
+                        count);
+                eof = TRUE;
+                break;
+            }
+            --count;
+            job = &pool.jobs[pool.tail % pool.depth];
+            job->ur.uttfile = ckd_salloc(uttfile);
+            if (ctllmfp)
+                job->ur.lmname = ckd_salloc(lmname);
+            job->uttid = ckd_salloc(uttid);
+            job->sf = sf;
+            job->ef = ef;
+            if (prefetch)
+                (*prefetch) (pdata, &job->ur, job->uttid);
+            sbmtx_lock(pool.mtx);
+            ++pool.tail;
+            sbmtx_unlock(pool.mtx);
+            sbevent_signal(pool.queued);
+        }
+        if (eof || count <= 0) {
+            sbmtx_lock(pool.mtx);
+            pool.finished = TRUE;
+            sbmtx_unlock(pool.mtx);
+            sbevent_signal(pool.queued);
+        }
+
+        /* Write out whatever is finished, in order. */
+        wrote = FALSE;
+        while (ctl_pool_write(&pool, outfp))
+            wrote = TRUE;
+        if (pool.finished && pool.head == pool.tail)
+            break;
+        if (!wrote)
+            sbevent_wait(pool.done, -1, -1);
+    }
+    ptmr_stop(&tm);
+
+    for (i = 0; i < n_thread; ++i) {
+        int32 j;
+
+        sbthread_free(workers[i].thr);
+        for (j = 0; j < n_out; ++j)
+            fclose(workers[i].tmpfp[j]);
+        ckd_free(workers[i].tmpfp);
+    }
+    ckd_free(workers);
+    for (i = 0; i < pool.depth; ++i) {
+        ckd_free(pool.jobs[i].out);
+        ckd_free(pool.jobs[i].out_len);
+    }
+    ckd_free(pool.jobs);
+    sbevent_free(pool.queued);
+    sbevent_free(pool.done);
+    sbmtx_free(pool.mtx);
+
+    if (fp != stdin)
+        fclose(fp);
+    if (ctllmfp)
+        fclose(ctllmfp);
+
+    return tm;
+}
+
+void
+ctl_prefetch_file(const char *file)
+{
+#ifdef POSIX_FADV_WILLNEED
+    int fd;
+
+    if ((fd = open(file, O_RDONLY)) < 0)
+        return;
+    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    close(fd);
+#endif
+}
 
 ptmr_t
 ctl_process_utt(const char *uttfile, int32 count,
@@ -97,6 +97,7 @@
 #include <sphinxbase/profile.h>
 #include <sphinxbase/bitvec.h>
 #include <sphinxbase/genrand.h>
+#include <sphinxbase/sbthread.h>
 
 #include "vector.h"
 
@@ -386,13 +387,86 @@ vector_vqlabel(float32 * vec, float32 ** mean, int32 rows, int32 cols,
 }
 
 
+/** One thread's share of the labelling step of vector_vqgen(). */
+typedef struct {
+    float32 **data, **mean;
+    int32 *map;
+    float64 *err;
+    int32 start, end, vqrows, cols;
+} vqlabel_share_t;
+
+static int
+vector_vqlabel_share(sbthread_t * th)
+{
+    vqlabel_share_t *sh = sbthread_arg(th);
+    int32 i;
+
+    for (i = sh->start; i < sh->end; i++)
+        sh->map[i] = vector_vqlabel(sh->data[i], sh->mean, sh->vqrows,
+                                    sh->cols, &sh->err[i]);
+    return 0;
+}
+
+/*
+ * Label every row of data with its closest codeword, splitting the rows
+ * among n_thread threads.  Per-row errors are summed afterwards in row
+ * order, so the total does not depend on the number of threads.
+ */
+static float64
+vector_vqlabel_all(float32 ** data, int32 rows, int32 cols,
+                   float32 ** mean, int32 vqrows, int32 * map,
+                   float64 * err, int32 n_thread)
+{
+    vqlabel_share_t *sh;
+    sbthread_t **th;
+    float64 sqerr;
+    int32 i;
+
+    sh = ckd_calloc(n_thread, sizeof(*sh));
+    th = ckd_calloc(n_thread, sizeof(*th));
+    for (i = 0; i < n_thread; i++) {
+        sh[i].data = data;
+        sh[i].mean = mean;
+        sh[i].map = map;
+        sh[i].err = err;
+        sh[i].vqrows = vqrows;
+        sh[i].cols = cols;
+        sh[i].start = (int32) ((int64) rows * i / n_thread);
+        sh[i].end = (int32) ((int64) rows * (i + 1) / n_thread);
+    }
+    for (i = 1; i < n_thread; i++) {
+        if ((th[i] = sbthread_start(NULL, vector_vqlabel_share, &sh[i]))
+            == NULL) {
+            E_WARN("Failed to start labelling thread %d\n", i);
+            /* Fold this share into the calling thread's. */
+            sh[0].end = sh[i].end;
+            n_thread = i;
+            break;
+        }
+    }
+    for (i = 0; i < sh[0].end; i++)
+        map[i] = vector_vqlabel(data[i], mean, vqrows, cols, &err[i]);
+    for (i = 1; i < n_thread; i++) {
+        sbthread_wait(th[i]);
+        sbthread_free(th[i]);
+    }
+    ckd_free(th);
+    ckd_free(sh);
+
+    sqerr = 0.0;
+    for (i = 0; i < rows; i++)
+        sqerr += err[i];
+    return sqerr;
+}
+
 float64
 vector_vqgen(float32 ** data, int32 rows, int32 cols, int32 vqrows,
              float64 epsilon, int32 maxiter,
-             float32 ** mean, int32 * map, int32 seed)
+             float32 ** mean, int32 * map, int32 seed, int32 n_thread)
 {
     int32 i, j, r, it;
     float64 sqerr, prev_sqerr = 0, t;
+    float64 *err;
     bitvec_t *sel;
     int32 *count;
     float32 *gmean;
@@ -450,13 +524,16 @@ vector_vqgen(float32 ** data, int32 rows, int32 cols, int32 vqrows,
     gmean = (float32 *) ckd_calloc(cols, sizeof(float32));
     vector_mean(gmean, mean, vqrows, cols);
 
+    err = (float64 *) ckd_calloc(rows, sizeof(float64));
+    if (n_thread < 1)
+        n_thread = 1;
+    if (n_thread > rows)
+        n_thread = rows;
+
     for (it = 0;; it++) {       /* Iterations of k-means algorithm */
         /* Find the current data->mean mappings (labels) */
-        sqerr = 0.0;
-        for (i = 0; i < rows; i++) {
-            map[i] = vector_vqlabel(data[i], mean, vqrows, cols, &t);
-            sqerr += t;
-        }
+        sqerr = vector_vqlabel_all(data, rows, cols, mean, vqrows, map,
+                                   err, n_thread);
         ptmr_stop(&tm);
 
         if (it == 0)
@@ -500,6 +577,7 @@ vector_vqgen(float32 ** data, int32 rows, int32 cols, int32 vqrows,
 
     ckd_free(count);
     ckd_free(gmean);
+    ckd_free(err);
 
     return sqerr;
 }
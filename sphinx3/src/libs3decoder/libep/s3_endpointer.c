@@ -31,6 +31,7 @@ enum {
 #define VOTING_LEN		5
 #define CEP_LEN			13
 #define FRAME_LEN		(13 * sizeof(float32))
+#define CLASSIFY_BLOCK		64	/* Frames classified together */
 
 static void
 get_frame_classes(s3_endpointer_t *_ep,
@@ -47,6 +48,9 @@ update_frame_stats(s3_endpointer_t *_ep);
 static int
 update_available(s3_endpointer_t *_ep);
 
+static void
+make_room(s3_endpointer_t *_ep, int _n_frames);
+
 void
 s3_endpointer_init(s3_endpointer_t *_ep,
 		   const char *_means_file,
@@ -73,9 +77,12 @@ s3_endpointer_init(s3_endpointer_t *_ep,
     _ep->frames = NULL;
     _ep->classes = NULL;
     _ep->n_frames = 0;
+    _ep->max_frames = 0;
     _ep->offset = 0;
     _ep->count = 0;
     _ep->eof = 0;
+    _ep->cep = NULL;
+    _ep->max_cep = 0;
 
     _ep->gmm = mgau_init(_means_file, _vars_file, _var_floor,
 			 _mix_weights_file, _mix_weight_floor, TRUE, _gm_type,
@@ -115,15 +122,19 @@ s3_endpointer_close(s3_endpointer_t *_ep)
     
     mgau_free(_ep->gmm);
     ckd_free_2d(_ep->frames);
+    ckd_free(_ep->classes);
+    ckd_free_2d(_ep->cep);
     _ep->frames = NULL;
     _ep->classes = NULL;
+    _ep->cep = NULL;
     _ep->n_frames = 0;
+    _ep->max_frames = 0;
+    _ep->max_cep = 0;
     _ep->offset = 0;
     _ep->count = 0;
     _ep->eof = 0;
     _ep->end_countdown = -1;
 
-    ckd_free(_ep->classes);
     ckd_free(_ep->priors);
     ckd_free(_ep->voters);
 }
@@ -133,9 +144,7 @@ s3_endpointer_reset(s3_endpointer_t *_ep)
 {
     assert(_ep != NULL);
 
-    ckd_free_2d(_ep->frames);
-    _ep->frames = NULL;
-    _ep->classes = NULL;
+    /* Keep the buffers for the next stream. */
     _ep->n_frames = 0;
     _ep->offset = 0;
     _ep->count = 0;
@@ -150,50 +159,73 @@ s3_endpointer_feed_frames(s3_endpointer_t *_ep,
 			  int _n_frames,
 			  int _eof)
 {
-    float32 **fbuf;
-    int *cbuf;
-    int i, sz, leftover;
+    int i;
 
     assert(_ep != NULL);
 
-    if (_ep->n_frames > _ep->offset) {
-	leftover = _ep->n_frames - _ep->offset;
-	sz = _n_frames + leftover;
-	fbuf = (float32 **)ckd_calloc_2d(sz, CEP_LEN, sizeof(float32));
-	cbuf = (int *)ckd_calloc(sizeof(int), sz);
-	for (i = 0; i < leftover; i++)
-	    memcpy(fbuf[i], _ep->frames[_ep->offset + i], FRAME_LEN);
-	memcpy(cbuf, &_ep->classes[_ep->offset], leftover * sizeof(int));
-	for (i = leftover; i < sz; i++)
-	    memcpy(fbuf[i], _frames[i - leftover], FRAME_LEN);
-	get_frame_classes(_ep, _frames, _n_frames, &cbuf[leftover]);
+    make_room(_ep, _n_frames);
+    for (i = 0; i < _n_frames; i++)
+	memcpy(_ep->frames[_ep->n_frames + i], _frames[i], FRAME_LEN);
+    get_frame_classes(_ep, _frames, _n_frames, &_ep->classes[_ep->n_frames]);
+    _ep->n_frames += _n_frames;
 
-	ckd_free_2d((void **)_ep->frames);
-	ckd_free(_ep->classes);
-	_ep->frames = fbuf;
-	_ep->classes = cbuf;
-	_ep->n_frames = sz;
-	_ep->offset = 0;
+    if (_ep->state == STATE_BEGIN_STREAM && update_available(_ep))
+	init_frame_stats(_ep);
+
+    _ep->eof = _eof;
+}
+
+int
+s3_endpointer_feed_raw(s3_endpointer_t *_ep,
+		       fe_t *_fe,
+		       int16 const *_raw,
+		       size_t _n_samples,
+		       int _eof)
+{
+    int32 n_cep, n_last, n_fed;
+
+    assert(_ep != NULL);
+    assert(_fe != NULL);
+
+    if (fe_get_output_size(_fe) != CEP_LEN) {
+	E_ERROR("Front end gives %d cepstra, the classifier needs %d\n",
+		fe_get_output_size(_fe), CEP_LEN);
+	return -1;
     }
-    else {
-	fbuf = (float32 **)ckd_calloc_2d(_n_frames, CEP_LEN, sizeof(float32));
-	cbuf = (int *)ckd_calloc(sizeof(int), _n_frames);
-	for (i = 0; i < _n_frames; i++)
-	    memcpy(fbuf[i], _frames[i], FRAME_LEN);
-	get_frame_classes(_ep, _frames, _n_frames, cbuf);
 
-	ckd_free_2d((void **)_ep->frames);
-	ckd_free(_ep->classes);
-	_ep->frames = fbuf;
-	_ep->classes = cbuf;
-	_ep->n_frames = _n_frames;
-	_ep->offset = 0;
+    n_fed = 0;
+    do {
+	/* Room for all the frames these samples make, and for the one
+	 * fe_end_utt() may flush after them. */
+	fe_process_frames(_fe, &_raw, &_n_samples, NULL, &n_cep, NULL);
+	if (n_fed + n_cep + 1 > _ep->max_cep) {
+	    mfcc_t **cep;
+
+	    cep = (mfcc_t **)ckd_calloc_2d(n_fed + n_cep + 1, CEP_LEN,
+					   sizeof(mfcc_t));
+	    if (n_fed > 0)
+		memcpy(cep[0], _ep->cep[0], n_fed * CEP_LEN * sizeof(mfcc_t));
+	    ckd_free_2d(_ep->cep);
+	    _ep->cep = cep;
+	    _ep->max_cep = n_fed + n_cep + 1;
+	}
+	if (fe_process_frames(_fe, &_raw, &_n_samples, _ep->cep + n_fed,
+			      &n_cep, NULL) < 0)
+	    return -1;
+	n_fed += n_cep;
+    } while (_n_samples > 0 && n_cep > 0);
+
+    if (_eof) {
+	if (fe_end_utt(_fe, _ep->cep[n_fed], &n_last) < 0)
+	    return -1;
+	n_fed += n_last;
     }
 
-    if (_ep->state == STATE_BEGIN_STREAM && update_available(_ep))
-	init_frame_stats(_ep);
+    /* sphinx3 only builds with floating point cepstra. */
+    if (n_fed > 0 || _eof)
+	s3_endpointer_feed_frames(_ep, (float32 **)_ep->cep, n_fed, _eof);
 
-    _ep->eof = _eof;
+    return n_fed;
 }
 
 int
@@ -231,6 +263,47 @@ s3_endpointer_frame_count(s3_endpointer_t *_ep)
     return _ep->count;
 }
 
+/*
+ * Move the frames not yet read to the front of the buffer and make sure
+ * there is room after them for _n_frames more.  The buffer only grows,
+ * so a stream fed in blocks of the same size allocates nothing once it
+ * is running.
+ */
+static void
+make_room(s3_endpointer_t *_ep, int _n_frames)
+{
+    int leftover, max_frames;
+
+    leftover = _ep->n_frames - _ep->offset;
+    if (leftover + _n_frames > _ep->max_frames) {
+	float32 **fbuf;
+	int *cbuf;
+
+	max_frames = 2 * _ep->max_frames;
+	if (max_frames < leftover + _n_frames)
+	    max_frames = leftover + _n_frames;
+	fbuf = (float32 **)ckd_calloc_2d(max_frames, CEP_LEN, sizeof(float32));
+	cbuf = (int *)ckd_calloc(sizeof(int), max_frames);
+	if (leftover > 0) {
+	    memcpy(fbuf[0], _ep->frames[_ep->offset], leftover * FRAME_LEN);
+	    memcpy(cbuf, &_ep->classes[_ep->offset], leftover * sizeof(int));
+	}
+	ckd_free_2d((void **)_ep->frames);
+	ckd_free(_ep->classes);
+	_ep->frames = fbuf;
+	_ep->classes = cbuf;
+	_ep->max_frames = max_frames;
+    }
+    else if (_ep->offset > 0 && leftover > 0) {
+	memmove(_ep->frames[0], _ep->frames[_ep->offset],
+		leftover * FRAME_LEN);
+	memmove(_ep->classes, &_ep->classes[_ep->offset],
+		leftover * sizeof(int));
+    }
+    _ep->n_frames = leftover;
+    _ep->offset = 0;
+}
+
 static int
 update_available(s3_endpointer_t *_ep)
 {
@@ -362,27 +435,34 @@ get_frame_classes(s3_endpointer_t *_ep,
 		  int _n_frames,
 		  int *_classes)
 {
-    int i, c, k;
+    int i, j, n, c, k;
     int32 best_class, best_votes, best_score, score;
+    int32 scores[NUM_CLASSES][CLASSIFY_BLOCK];
     int votes[NUM_CLASSES];
     int *voters;
 
     assert(_ep != NULL);
     assert(_classes != NULL);
 
-    for (i = 0; i < _n_frames; i++) {
-	best_score = S3_LOGPROB_ZERO;
-	best_class = -1;
-	for (c = 0; c < NUM_CLASSES; c++) {
-	    score = _ep->priors[c];
-	    score += mgau_eval(_ep->gmm, c, NULL, _frames[i], i, 0);
-	    if (best_score < score) {
-		best_score = score;
-		best_class = c;
+    /* Score each class's mixture over a block of frames at a time. */
+    for (i = 0; i < _n_frames; i += CLASSIFY_BLOCK) {
+	n = _n_frames - i < CLASSIFY_BLOCK ? _n_frames - i : CLASSIFY_BLOCK;
+	for (c = 0; c < NUM_CLASSES; c++)
+	    mgau_eval_frames(_ep->gmm, c, &_frames[i], n, scores[c]);
+
+	for (j = 0; j < n; j++) {
+	    best_score = S3_LOGPROB_ZERO;
+	    best_class = -1;
+	    for (c = 0; c < NUM_CLASSES; c++) {
+		score = _ep->priors[c] + scores[c][j];
+		if (best_score < score) {
+		    best_score = score;
+		    best_class = c;
+		}
 	    }
-	}
 
-	_classes[i] = best_class;
+	    _classes[i + j] = best_class;
+	}
     }
 
     if (_ep->post_classify) {
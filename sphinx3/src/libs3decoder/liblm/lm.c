@@ -264,6 +264,32 @@ lm_get_classid(lm_t * model, const char *name)
 
 
 
+/* Invalidate every entry of the trigram cache */
+static void
+lm_tgcache_flush(lm_t * lm)
+{
+    int32 i;
+
+    if (lm->tgcache == NULL)
+        return;
+    for (i = 0; i < LM_TGCACHE_SIZE; i++)
+        lm->tgcache[i].lwid[0] = BAD_S3LMWID32;
+}
+
+/* Return the set of trigram cache entries that <lw1,lw2,lw3> maps to */
+static lm_tgcache_entry_t *
+lm_tgcache_set(lm_t * lm, s3lmwid32_t lw1, s3lmwid32_t lw2, s3lmwid32_t lw3)
+{
+    uint32 h;
+
+    h = (uint32) lw1 * 0x9e3779b1;
+    h = (h ^ lw2) * 0x9e3779b1;
+    h = (h ^ lw3) * 0x9e3779b1;
+    h >>= 32 - LM_TGCACHE_LOG_N_SET;
+
+    return lm->tgcache + h * LM_TGCACHE_WAYS;
+}
+
 void
 lm_null_struct(lm_t * lm)
 {
@@ -277,12 +303,12 @@ lm_null_struct(lm_t * lm)
     lm->tginfo = NULL;
     lm->tgcache = NULL;
     lm->dict2lmwid = NULL;
+    lm->mmf = NULL;
 
     lm->bg32 = NULL;
     lm->tg32 = NULL;
     lm->membg32 = NULL;
     lm->tginfo32 = NULL;
-    lm->tgcache32 = NULL;
 
     lm->bgprob = NULL;
     lm->tgprob = NULL;
@@ -388,6 +414,9 @@ lm_set_param(lm_t * lm, float64 lw, float64 wip)
 
     lm->lw = (float32) lw;
     lm->wip = iwip;
+
+    /* Cached trigram scores are stale now */
+    lm_tgcache_flush(lm);
 }
 
 
@@ -594,7 +623,7 @@ lm_read_advance2(const char *file, const char *lmname, float64 lw,
                  int32 applyWeight, int lminmemory, logmath_t *logmath,
                  int32 ugonly, int32 bgonly)
 {
-    int32 i, u;
+    int32 u;
     lm_t *lm;
     int32 err_no;
 
@@ -712,21 +741,10 @@ lm_read_advance2(const char *file, const char *lmname, float64 lw,
 
     /* Initialize the fast trigram cache, with all entries invalid */
     if (lm->n_tg > 0) {
-        if (lm->is32bits) {
-            lm->tgcache32 =
-                (lm_tgcache_entry32_t *) ckd_calloc(LM_TGCACHE_SIZE,
-                        sizeof
-                        (lm_tgcache_entry32_t));
-            for (i = 0; i < LM_TGCACHE_SIZE; i++)
-                lm->tgcache32[i].lwid[0] = (s3lmwid32_t) BAD_LMWID(lm);
-        }
-        else {
-            lm->tgcache =
-                (lm_tgcache_entry_t *) ckd_calloc(LM_TGCACHE_SIZE,
-                        sizeof(lm_tgcache_entry_t));
-            for (i = 0; i < LM_TGCACHE_SIZE; i++)
-                lm->tgcache[i].lwid[0] = (s3lmwid_t) BAD_LMWID(lm);
-        }
+        lm->tgcache =
+            (lm_tgcache_entry_t *) ckd_calloc(LM_TGCACHE_SIZE,
+                                              sizeof(lm_tgcache_entry_t));
+        lm_tgcache_flush(lm);
     }
 
     if (applyWeight) {
@@ -970,11 +988,16 @@ lm_cache_stats_dump(lm_t * lm)
         ("%9d tg(), %9d tgcache, %8d bo; %5d fills, %8d in mem (%.1f%%)\n",
          lm->n_tg_score, lm->n_tgcache_hit, lm->n_tg_bo, lm->n_tg_fill,
          lm->n_tg_inmem, (lm->n_tg_inmem * 100.0) / (lm->n_tg + 1));
+    E_INFO("%9d tgcache hits, %9d misses (%.1f%% hits)\n",
+           lm->n_tgcache_hit, lm->n_tgcache_miss,
+           (lm->n_tgcache_hit * 100.0)
+           / (lm->n_tgcache_hit + lm->n_tgcache_miss + 1));
     E_INFO("%8d bg(), %8d bo; %5d fills, %8d in mem (%.1f%%)\n",
            lm->n_bg_score, lm->n_bg_bo, lm->n_bg_fill, lm->n_bg_inmem,
            (lm->n_bg_inmem * 100.0) / (lm->n_bg + 1));
 
     lm->n_tgcache_hit = 0;
+    lm->n_tgcache_miss = 0;
     lm->n_tg_fill = 0;
     lm->n_tg_score = 0;
     lm->n_tg_bo = 0;
@@ -1132,52 +1155,56 @@ load_bg(lm_t * lm, s3lmwid32_t lw1)
 
 #define BINARY_SEARCH_THRESH	16
 
+/*
+ * Body of the find_{bg,tg}{,32} functions: locate word w in the list
+ * ng of n N-grams, sorted by word ID.  Word IDs in a list are spread
+ * fairly evenly, so the search alternates interpolation steps, which
+ * guess the position from the IDs at both ends of the segment, with
+ * bisection steps, which bound it on lists where they are not.
+ */
+#define LM_FIND_WID(ng, n, w) do {                                      \
+        int32 i, b, e, interp;                                          \
+        s3lmwid32_t lo, hi;                                             \
+                                                                        \
+        b = 0;                                                          \
+        e = (n);                                                        \
+        interp = TRUE;                                                  \
+        while (e - b > BINARY_SEARCH_THRESH) {                          \
+            lo = (ng)[b].wid;                                           \
+            hi = (ng)[e - 1].wid;                                       \
+            if ((w) < lo || (w) > hi)                                   \
+                return -1;                                              \
+            if (interp && hi > lo)                                      \
+                i = b + (int32) ((float64) ((w) - lo) * (e - 1 - b)     \
+                                 / (hi - lo));                          \
+            else                                                        \
+                i = (b + e) >> 1;                                       \
+            interp = !interp;                                           \
+            if ((ng)[i].wid < (w))                                      \
+                b = i + 1;                                              \
+            else if ((ng)[i].wid > (w))                                 \
+                e = i;                                                  \
+            else                                                        \
+                return i;                                               \
+        }                                                               \
+                                                                        \
+        /* Linear search within narrowed segment */                    \
+        for (i = b; (i < e) && ((ng)[i].wid != (w)); i++);              \
+        return ((i < e) ? i : -1);                                      \
+    } while (0)
+
 /* Locate a specific bigram within a bigram list */
 int32
 find_bg(bg_t * bg, int32 n, s3lmwid32_t w)
 {
-    int32 i, b, e;
-
-    /* Binary search until segment size < threshold */
-    b = 0;
-    e = n;
-    while (e - b > BINARY_SEARCH_THRESH) {
-        i = (b + e) >> 1;
-        if (bg[i].wid < w)
-            b = i + 1;
-        else if (bg[i].wid > w)
-            e = i;
-        else
-            return i;
-    }
-
-    /* Linear search within narrowed segment */
-    for (i = b; (i < e) && (bg[i].wid != w); i++);
-    return ((i < e) ? i : -1);
+    LM_FIND_WID(bg, n, w);
 }
 
 /* Locate a specific bigram within a bigram list */
 int32
 find_bg32(bg32_t * bg, int32 n, s3lmwid32_t w)
 {
-    int32 i, b, e;
-
-    /* Binary search until segment size < threshold */
-    b = 0;
-    e = n;
-    while (e - b > BINARY_SEARCH_THRESH) {
-        i = (b + e) >> 1;
-        if (bg[i].wid < w)
-            b = i + 1;
-        else if (bg[i].wid > w)
-            e = i;
-        else
-            return i;
-    }
-
-    /* Linear search within narrowed segment */
-    for (i = b; (i < e) && (bg[i].wid != w); i++);
-    return ((i < e) ? i : -1);
+    LM_FIND_WID(bg, n, w);
 }
 
 
@@ -1533,43 +1560,13 @@ load_tg(lm_t * lm, s3lmwid32_t lw1, s3lmwid32_t lw2)
 int32
 find_tg(tg_t * tg, int32 n, s3lmwid32_t w)
 {
-    int32 i, b, e;
-
-    b = 0;
-    e = n;
-    while (e - b > BINARY_SEARCH_THRESH) {
-        i = (b + e) >> 1;
-        if (tg[i].wid < w)
-            b = i + 1;
-        else if (tg[i].wid > w)
-            e = i;
-        else
-            return i;
-    }
-
-    for (i = b; (i < e) && (tg[i].wid != w); i++);
-    return ((i < e) ? i : -1);
+    LM_FIND_WID(tg, n, w);
 }
 
 int32
 find_tg32(tg32_t * tg, int32 n, s3lmwid32_t w)
 {
-    int32 i, b, e;
-
-    b = 0;
-    e = n;
-    while (e - b > BINARY_SEARCH_THRESH) {
-        i = (b + e) >> 1;
-        if (tg[i].wid < w)
-            b = i + 1;
-        else if (tg[i].wid > w)
-            e = i;
-        else
-            return i;
-    }
-
-    for (i = b; (i < e) && (tg[i].wid != w); i++);
-    return ((i < e) ? i : -1);
+    LM_FIND_WID(tg, n, w);
 }
 
 
@@ -1666,11 +1663,12 @@ int32
 lm_tg_score(lm_t * lm, s3lmwid32_t lw1, s3lmwid32_t lw2, s3lmwid32_t lw3,
             s3wid_t w3)
 {
-    int32 i, h, n, score, inclass_ugscore = 0;
+    int32 i, k, n, score, inclass_ugscore = 0;
     tg_t *tg;
     tginfo_t *tginfo, *prev_tginfo;
     tg32_t *tg32;
     tginfo32_t *tginfo32, *prev_tginfo32;
+    lm_tgcache_entry_t *set, ent;
     int32 is32bits;
 
     tg = NULL;
@@ -1701,28 +1699,32 @@ lm_tg_score(lm_t * lm, s3lmwid32_t lw1, s3lmwid32_t lw2, s3lmwid32_t lw3,
     if (NOT_LMWID(lm, lw3) || (lw3 >= lm->n_ug))
         E_FATAL("Bad lw3 argument (%d) to lm_tg_score\n", lw3);
 
-    /* Lookup tgcache first; compute hash(lw1, lw2, lw3) */
-    h = ((lw1 & 0x000003ff) << 21) + ((lw2 & 0x000003ff) << 11) +
-        (lw3 & 0x000007ff);
-    h %= LM_TGCACHE_SIZE;
-
-
     if (lm->inclass_ugscore)
         inclass_ugscore = lm->inclass_ugscore[w3];
 
     /*
+     * Lookup tgcache first.  A hit moves to the front of its set, so
+     * that the last entry is always the least recently used one.
+     *
      * Have to add within class score to the cached language score since
      *  the former cannot be cached.
      */
-    if (is32bits) {
-        if ((lm->tgcache32[h].lwid[0] == lw1) &&
-            (lm->tgcache32[h].lwid[1] == lw2) &&
-            (lm->tgcache32[h].lwid[2] == lw3)) {
-
+    set = lm_tgcache_set(lm, lw1, lw2, lw3);
+    for (k = 0; k < LM_TGCACHE_WAYS; k++) {
+        if ((set[k].lwid[0] == lw1) &&
+            (set[k].lwid[1] == lw2) && (set[k].lwid[2] == lw3)) {
+            if (k > 0) {
+                ent = set[k];
+                memmove(set + 1, set, k * sizeof(*set));
+                set[0] = ent;
+            }
             lm->n_tgcache_hit++;
-            return lm->tgcache32[h].lscr + inclass_ugscore;
+            return set[0].lscr + inclass_ugscore;
         }
+    }
+    lm->n_tgcache_miss++;
 
+    if (is32bits) {
         prev_tginfo32 = NULL;
         for (tginfo32 = lm->tginfo32[lw2]; tginfo32;
              tginfo32 = tginfo32->next) {
@@ -1733,14 +1735,6 @@ lm_tg_score(lm_t * lm, s3lmwid32_t lw1, s3lmwid32_t lw2, s3lmwid32_t lw3,
 
     }
     else {
-        if ((lm->tgcache[h].lwid[0] == lw1) &&
-            (lm->tgcache[h].lwid[1] == lw2) &&
-            (lm->tgcache[h].lwid[2] == lw3)) {
-
-            lm->n_tgcache_hit++;
-            return lm->tgcache[h].lscr + inclass_ugscore;
-        }
-
         prev_tginfo = NULL;
         for (tginfo = lm->tginfo[lw2]; tginfo; tginfo = tginfo->next) {
             if (tginfo->w1 == lw1)
@@ -1808,20 +1802,14 @@ lm_tg_score(lm_t * lm, s3lmwid32_t lw1, s3lmwid32_t lw2, s3lmwid32_t lw3,
     }
 
     /*
+     * Replace the least recently used entry of the set.
      * Have to subtract within class score since it cannot be cached
      */
-    if (is32bits) {
-        lm->tgcache32[h].lwid[0] = lw1;
-        lm->tgcache32[h].lwid[1] = lw2;
-        lm->tgcache32[h].lwid[2] = lw3;
-        lm->tgcache32[h].lscr = score - inclass_ugscore;
-    }
-    else {
-        lm->tgcache[h].lwid[0] = lw1;
-        lm->tgcache[h].lwid[1] = lw2;
-        lm->tgcache[h].lwid[2] = lw3;
-        lm->tgcache[h].lscr = score - inclass_ugscore;
-    }
+    memmove(set + 1, set, (LM_TGCACHE_WAYS - 1) * sizeof(*set));
+    set[0].lwid[0] = lw1;
+    set[0].lwid[1] = lw2;
+    set[0].lwid[2] = lw3;
+    set[0].lscr = score - inclass_ugscore;
 
 
 #if 0
@@ -1949,6 +1937,7 @@ lm_free(lm_t * lm)
 
     if (lm->fp)
         fclose(lm->fp);
+    ckd_free(lm->file);
 
     ckd_free((void *) lm->ug);
 
@@ -1960,7 +1949,7 @@ lm_free(lm_t * lm)
         if (lm->bg || lm->bg32) {       /* Memory-based; free all bg */
             if (lm->bg)
                 ckd_free(lm->bg);
-            if (lm->bg32)
+            if (lm->bg32 && !lm->mmf)
                 ckd_free(lm->bg32);
 
             if (lm->membg)
@@ -1987,7 +1976,7 @@ lm_free(lm_t * lm)
     if (lm->n_tg > 0) {
         if (lm->tg)
             ckd_free((void *) lm->tg);
-        if (lm->tg32)
+        if (lm->tg32 && !lm->mmf)
             ckd_free((void *) lm->tg32);
 
         if (lm->tginfo) {
@@ -2024,8 +2013,6 @@ lm_free(lm_t * lm)
 
         if (lm->tgcache)
             ckd_free((void *) lm->tgcache);
-        if (lm->tgcache32)
-            ckd_free((void *) lm->tgcache32);
 
         ckd_free((void *) lm->tg_segbase);
         ckd_free((void *) lm->tgprob);
@@ -2053,9 +2040,92 @@ lm_free(lm_t * lm)
     if (lm->name)
         ckd_free(lm->name);
 
+    if (lm->mmf)
+        mmio_file_unmap(lm->mmf);
+
     ckd_free((void *) lm);
 }
 
+lm_t *
+lm_share(lm_t * lm)
+{
+    lm_t *copy;
+    FILE *fp = NULL;
+
+    if (!lm->isLM_IN_MEMORY
+        && (lm->file == NULL || (fp = fopen(lm->file, "rb")) == NULL)) {
+        E_ERROR_SYSTEM("Failed to open %s to share LM %s",
+                       lm->file ? lm->file : "(unknown)", lm->name);
+        return NULL;
+    }
+
+    copy = (lm_t *) ckd_malloc(sizeof(*copy));
+    *copy = *lm;
+    copy->fp = fp;
+    if (lm->membg)
+        copy->membg = (membg_t *) ckd_calloc(lm->n_ug, sizeof(membg_t));
+    if (lm->membg32)
+        copy->membg32 = (membg32_t *) ckd_calloc(lm->n_ug, sizeof(membg32_t));
+    if (lm->tginfo)
+        copy->tginfo = (tginfo_t **) ckd_calloc(lm->n_ug, sizeof(tginfo_t *));
+    if (lm->tginfo32)
+        copy->tginfo32 =
+            (tginfo32_t **) ckd_calloc(lm->n_ug, sizeof(tginfo32_t *));
+    if (lm->tgcache) {
+        copy->tgcache =
+            (lm_tgcache_entry_t *) ckd_calloc(LM_TGCACHE_SIZE,
+                                              sizeof(lm_tgcache_entry_t));
+        lm_tgcache_flush(copy);
+    }
+
+    copy->n_bg_fill = copy->n_bg_score = copy->n_bg_bo = 0;
+    copy->n_tg_fill = copy->n_tg_score = copy->n_tg_bo = 0;
+    copy->n_bg_inmem = copy->n_tg_inmem = 0;
+    copy->n_tgcache_hit = copy->n_tgcache_miss = 0;
+    return copy;
+}
+
+void
+lm_share_free(lm_t * lm)
+{
+    int32 i;
+    tginfo_t *tginfo;
+    tginfo32_t *tginfo32;
+
+    if (lm == NULL)
+        return;
+    /* The n-grams it read in are its own, if disk-based, and otherwise
+     * point into the shared tables. */
+    for (i = 0; lm->tginfo && i < lm->n_ug; i++) {
+        while ((tginfo = lm->tginfo[i]) != NULL) {
+            lm->tginfo[i] = tginfo->next;
+            if (!lm->isLM_IN_MEMORY)
+                ckd_free(tginfo->tg);
+            ckd_free(tginfo);
+        }
+    }
+    for (i = 0; lm->tginfo32 && i < lm->n_ug; i++) {
+        while ((tginfo32 = lm->tginfo32[i]) != NULL) {
+            lm->tginfo32[i] = tginfo32->next;
+            if (!lm->isLM_IN_MEMORY)
+                ckd_free(tginfo32->tg32);
+            ckd_free(tginfo32);
+        }
+    }
+    for (i = 0; !lm->isLM_IN_MEMORY && lm->membg && i < lm->n_ug; i++)
+        ckd_free(lm->membg[i].bg);
+    for (i = 0; !lm->isLM_IN_MEMORY && lm->membg32 && i < lm->n_ug; i++)
+        ckd_free(lm->membg32[i].bg32);
+    if (lm->fp)
+        fclose(lm->fp);
+    ckd_free(lm->tginfo);
+    ckd_free(lm->tginfo32);
+    ckd_free(lm->membg);
+    ckd_free(lm->membg32);
+    ckd_free(lm->tgcache);
+    ckd_free(lm);
+}
+
 static void
 copy_bgt_to_bg32t(bg_t * b16, bg32_t * b32)
 {
@@ -690,6 +690,37 @@ lm_read_dump_ug(lm_t * lm, const char *file)
 
 
 
+/**
+   Map the DMP file into memory, so that an N-gram array of size
+   bytes at offset off can be used in place.  This is only possible
+   for an in-memory LM in native byte order, with the array aligned.
+   Decoders loading the same LM then share one copy of it in the page
+   cache instead of each reading their own.
+
+   @return a pointer to the array, or NULL if it must be read.
+ */
+static void *
+lm_read_dump_map(lm_t * lm, const char *file, long off, long size)
+{
+    long pos, end;
+
+    if (!lm->isLM_IN_MEMORY || lm->byteswap || (off % sizeof(int32)) != 0)
+        return NULL;
+
+    /* Make sure the array is actually there before touching it */
+    pos = ftell(lm->fp);
+    if (fseek(lm->fp, 0, SEEK_END) < 0)
+        return NULL;
+    end = ftell(lm->fp);
+    fseek(lm->fp, pos, SEEK_SET);
+    if (end < off + size)
+        return NULL;
+
+    if (lm->mmf == NULL && (lm->mmf = mmio_file_read(file)) == NULL)
+        return NULL;
+    return (char *) mmio_file_ptr(lm->mmf) + off;
+}
+
 /**
    Reading bigram in the DMP format. 
 
@@ -718,6 +749,16 @@ lm_read_dump_bg(lm_t * lm,             /**< LM */
     mem_sz = is32bits ? sizeof(bg32_t) : sizeof(bg_t);
     lmptr = NULL;
 
+    /** Use DMP32 bigrams in place if possible */
+    if (is32bits
+        && (lm->bg32 = lm_read_dump_map(lm, file, ftell(lm->fp),
+                                        (long) (lm->n_bg + 1) * mem_sz))) {
+        lm->bgoff = ftell(lm->fp);
+        fseek(lm->fp, (long) (lm->n_bg + 1) * mem_sz, SEEK_CUR);
+        E_INFO("Read %8d bigrams [memory-mapped]\n", lm->n_bg);
+        return LM_SUCCESS;
+    }
+
   /** Allocate memory */
     if (lm->isLM_IN_MEMORY) {   /* Remember the sentinel */
         if ((lmptr = ckd_calloc(lm->n_bg + 1, mem_sz)) == NULL) {
@@ -790,6 +831,16 @@ lm_read_dump_tg(lm_t * lm,             /**< LM */
     mem_sz = is32bits ? sizeof(tg32_t) : sizeof(tg_t);
     lmptr = NULL;
 
+    /** Use DMP32 trigrams in place if possible */
+    if (is32bits && lm->n_tg > 0
+        && (lm->tg32 = lm_read_dump_map(lm, file, ftell(lm->fp),
+                                        (long) lm->n_tg * mem_sz))) {
+        lm->tgoff = ftell(lm->fp);
+        fseek(lm->fp, (long) lm->n_tg * mem_sz, SEEK_CUR);
+        E_INFO("Read %8d trigrams [memory-mapped]\n", lm->n_tg);
+        return LM_SUCCESS;
+    }
+
     if (lm->isLM_IN_MEMORY && lm->n_tg > 0) {
         if ((lmptr = ckd_calloc(lm->n_tg + 1, mem_sz)) == NULL) {
             E_ERROR
@@ -1321,6 +1372,9 @@ lm_read_dump(const char *file,        /**< The file name*/
         return NULL;
     }
 
+    /* Remember the file so that lm_share() can reopen it. */
+    if (!lminmemory)
+        lm->file = ckd_salloc(file);
 
     return lm;
 }
@@ -102,6 +102,7 @@ ascr_init(int32 n_sen, int32 n_comsen, int32 n_sseq, int32 n_comsseq,
     /* MEMORY ALLOCATION : Active senones */
     ascr->sen_active = (uint8 *) ckd_calloc(n_sen, sizeof(uint8));
     ascr->rec_sen_active = (uint8 *) ckd_calloc(n_sen, sizeof(uint8));
+    ascr->sen_active_list = (int32 *) ckd_calloc(n_sen, sizeof(int32));
     ascr->ssid_active = (uint8 *) ckd_calloc(n_sseq, sizeof(uint8));
     if (n_comsseq > 0)
         ascr->comssid_active =
@@ -186,6 +187,9 @@ ascr_free(ascr_t * a)
         if (a->rec_sen_active)
             ckd_free((void *) a->rec_sen_active);
 
+        if (a->sen_active_list)
+            ckd_free((void *) a->sen_active_list);
+
         if (a->ssid_active)
             ckd_free((void *) a->ssid_active);
 
@@ -210,6 +214,32 @@ ascr_clear_sen_active(ascr_t * a)
     memset(a->sen_active, 0, a->n_sen * sizeof(*a->sen_active));
 }
 
+int32
+ascr_flags2list(ascr_t * a)
+{
+    uint8 const *flags;
+    uint64 w;
+    int32 s, i, n;
+
+    flags = a->sen_active;
+    n = 0;
+    /* Look at the flags eight at a time and skip the all-zero words,
+       which are most of them when few senones are active. */
+    for (s = 0; s + (int32) sizeof(w) <= a->n_sen; s += sizeof(w)) {
+        memcpy(&w, flags + s, sizeof(w));
+        if (w == 0)
+            continue;
+        for (i = 0; i < (int32) sizeof(w); ++i)
+            if (flags[s + i])
+                a->sen_active_list[n++] = s + i;
+    }
+    for (; s < a->n_sen; ++s)
+        if (flags[s])
+            a->sen_active_list[n++] = s;
+
+    a->n_sen_active = n;
+    return n;
+}
 
 void
 ascr_clear_ssid_active(ascr_t * a)
@@ -70,26 +70,36 @@
 #include <blkarray_list.h>
 
 #define BLKARRAY_DEFAULT_MAXBLKS	16380
-#define BLKARRAY_DEFAULT_BLKSIZE	16380
+#define BLKARRAY_DEFAULT_BLKSIZE	16384
 
 
 blkarray_list_t *
 _blkarray_list_init(int32 maxblks, int32 blksize)
 {
     blkarray_list_t *bl;
+    int32 shift;
 
     if ((maxblks <= 0) || (blksize <= 0)) {
         E_ERROR("Cannot allocate %dx%d blkarray\n", maxblks, blksize);
         return NULL;
     }
 
+    /* Round the block size up to a power of two, so that an index is
+     * split into row and column with a shift and a mask. */
+    for (shift = 0; (1 << shift) < blksize; shift++)
+        ;
+    blksize = 1 << shift;
+
     bl = (blkarray_list_t *) ckd_calloc(1, sizeof(blkarray_list_t));
     bl->ptr = (void ***) ckd_calloc(maxblks, sizeof(void **));
     bl->maxblks = maxblks;
     bl->blksize = blksize;
+    bl->blkshift = shift;
     bl->n_valid = 0;
     bl->cur_row = -1;           /* No row is allocated (dummy) */
     bl->cur_row_free = blksize; /* The dummy row is full */
+    bl->n_blks = 0;
+    bl->max_valid = 0;
 
     return bl;
 }
@@ -105,9 +115,34 @@ blkarray_list_init(void)
 void
 blkarray_list_free(blkarray_list_t *bl)
 {
-	blkarray_list_reset(bl);
-	ckd_free(bl->ptr);
-	ckd_free(bl);
+    int32 i;
+
+    blkarray_list_reset(bl);
+    for (i = 0; i < bl->n_blks; i++)
+        ckd_free(bl->ptr[i]);
+    ckd_free(bl->ptr);
+    ckd_free(bl);
+}
+
+
+void
+blkarray_list_set_max(blkarray_list_t *bl, int32 max_valid)
+{
+    int32 n_blks;
+
+    bl->max_valid = (max_valid > 0) ? max_valid : 0;
+    if (bl->max_valid == 0)
+        return;
+
+    /* Release spare blocks which the list can no longer fill */
+    n_blks = (bl->max_valid + bl->blksize - 1) >> bl->blkshift;
+    if (n_blks <= bl->cur_row)
+        n_blks = bl->cur_row + 1;
+    while (bl->n_blks > n_blks) {
+        bl->n_blks--;
+        ckd_free(bl->ptr[bl->n_blks]);
+        bl->ptr[bl->n_blks] = NULL;
+    }
 }
 
 
@@ -118,8 +153,11 @@ blkarray_list_append(blkarray_list_t * bl, void *data)
 
     assert(bl);
 
+    if ((bl->max_valid > 0) && (bl->n_valid >= bl->max_valid))
+        return -1;
+
     if (bl->cur_row_free >= bl->blksize) {
-        /* Previous row is filled; need to allocate a new row */
+        /* Previous row is filled; need a new row */
         bl->cur_row++;
 
         if (bl->cur_row >= bl->maxblks) {
@@ -129,10 +167,12 @@ blkarray_list_append(blkarray_list_t * bl, void *data)
             return -1;
         }
 
-        /* Allocate the new row */
-        assert(bl->ptr[bl->cur_row] == NULL);
-        bl->ptr[bl->cur_row] = (void **) ckd_calloc(bl->blksize,
-                                                    sizeof(void *));
+        /* Reuse a row kept from before the last reset, or allocate one */
+        if (bl->cur_row == bl->n_blks) {
+            bl->ptr[bl->cur_row] = (void **) ckd_malloc(bl->blksize *
+                                                        sizeof(void *));
+            bl->n_blks++;
+        }
 
         bl->cur_row_free = 0;
     }
@@ -152,23 +192,27 @@ blkarray_list_reset(blkarray_list_t * bl)
 {
     int32 i, j;
 
-    /* Free all the allocated elements as well as the blocks */
+    /* Free all the elements, keeping the blocks for the next use */
     for (i = 0; i < bl->cur_row; i++) {
         for (j = 0; j < bl->blksize; j++)
             ckd_free(bl->ptr[i][j]);
-
-        ckd_free(bl->ptr[i]);
-        bl->ptr[i] = NULL;
     }
     if (i == bl->cur_row) {     /* NEED THIS! (in case cur_row < 0) */
         for (j = 0; j < bl->cur_row_free; j++)
             ckd_free(bl->ptr[i][j]);
-
-        ckd_free(bl->ptr[i]);
-        bl->ptr[i] = NULL;
     }
 
     bl->n_valid = 0;
     bl->cur_row = -1;
     bl->cur_row_free = bl->blksize;
 }
+
+void *
+blkarray_list_get(blkarray_list_t *list, int32 n)
+{
+    if ((n < 0) || (n >= blkarray_list_n_valid(list)))
+        return NULL;
+
+    return blkarray_list_ptr(list, n >> list->blkshift,
+                             n & (list->blksize - 1));
+}
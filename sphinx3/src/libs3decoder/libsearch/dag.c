@@ -385,11 +385,20 @@ dag_param_read(FILE * fp, char *param, int32 * lineno)
 }
 
 
+/** One pending link on the explicit stack used by dag_bestpath(). */
+typedef struct {
+    daglink_t *l;               /* Backward link being evaluated */
+    dagnode_t *src;             /* Source node for l */
+    daglink_t *pl;              /* Next predecessor link of l->node to examine */
+} dag_bestpath_frame_t;
+
 /*
- * Recursive step in dag_search: best backward path from src to root
- * beginning with l.
+ * Best backward path from src to root beginning with l.
  *
- * FIXME: Why is this implemented recursively like this?
+ * This used to recurse once per link along the path, which for long
+ * utterances with dense lattices could run out of C stack.  It now
+ * walks the same depth-first order with an explicit stack, so the
+ * resulting scores and the number of LM operations are unchanged.
  *
  * Return value: 0 if successful, -1 otherwise.
  */
@@ -403,84 +412,112 @@ dag_bestpath(dag_t * dagp,      /* A pointer of the dag */
              s3lmwid32_t * dict2lmwid   /* A map from dictionary id to lm id, should use wid2lm insteead */
     )
 {
+    dag_bestpath_frame_t *stack, *f;
+    int32 n_stack, max_stack;
     dagnode_t *d, *pd;
     daglink_t *pl;
     int32 lscr, score;
 
     assert(!l->pscr_valid);
 
-    if ((d = l->node) == NULL) {
-        /* If no destination at end of l, src is root node.  Recursion termination */
-        /* This doesn't necessarily have to be <s>. But it should be the root of the DAG. */
-        assert(src == dagp->root);
-        l->lscr = 0;
-        l->pscr = 0;
-        l->pscr_valid = 1;
-        l->history = NULL;
+    max_stack = 64;
+    stack = ckd_calloc(max_stack, sizeof(*stack));
+    stack[0].l = l;
+    stack[0].src = src;
+    stack[0].pl = l->node ? l->node->predlist : NULL;
+    n_stack = 1;
+
+    while (n_stack > 0) {
+        f = &stack[n_stack - 1];
+        l = f->l;
+        src = f->src;
+
+        if ((d = l->node) == NULL) {
+            /* If no destination at end of l, src is root node.  Path termination */
+            /* This doesn't necessarily have to be <s>. But it should be the root of the DAG. */
+            assert(src == dagp->root);
+            l->lscr = 0;
+            l->pscr = 0;
+            l->pscr_valid = 1;
+            l->history = NULL;
+            --n_stack;
+            continue;
+        }
 
-        return 0;
-    }
+        /* Search all remaining predecessor links of l */
+        for (pl = f->pl; pl; pl = pl->next) {
+            pd = pl->node;
+            if (pd && dict_filler_word(dict, pd->wid))  /* Skip filler node */
+                continue;
 
-    /* Search all predecessor links of l */
-    for (pl = d->predlist; pl; pl = pl->next) {
-        pd = pl->node;
-        if (pd && dict_filler_word(dict, pd->wid))      /* Skip filler node */
-            continue;
+            /* Evaluate best path along pl first if not yet evaluated;
+             * come back to pl once it is done. */
+            if (!pl->pscr_valid)
+                break;
 
-        /* Evaluate best path along pl if not yet evaluated (recursive step) */
-        if (!pl->pscr_valid)
-            if (dag_bestpath(dagp, pl, d, lwf, dict, lm, dict2lmwid) < 0)
-                return -1;
+            /* Accumulated path score along pl->l */
+            score = pl->pscr + l->ascr;
+            if (score > l->pscr) {  /* rkm: Added 20-Nov-1996 */
+                /* FIXME: This scales the wip implicitly */
+                if (pd)
+                    lscr = lwf * lm_tg_score(lm,
+                                             dict2lmwid[dict_basewid
+                                                        (dict, pd->wid)],
+                                             dict2lmwid[dict_basewid
+                                                        (dict, d->wid)],
+                                             dict2lmwid[dict_basewid
+                                                        (dict, src->wid)],
+                                             dict_basewid(dict, src->wid));
+                else
+                    lscr = lwf * lm_bg_score(lm,
+                                             dict2lmwid[dict_basewid
+                                                        (dict, d->wid)],
+                                             dict2lmwid[dict_basewid
+                                                        (dict, src->wid)],
+                                             dict_basewid(dict, src->wid));
+                score += lscr;
+
+                if (dagp->lmop++ >= dagp->maxlmop) {
+                    ckd_free(stack);
+                    return -1;
+                }
 
-        /* Accumulated path score along pl->l */
-        /*      E_INFO("lwid1 %d, wid1 %d, lwid2 %d, wid2 %d\n",
-           dict2lmwid[dict_basewid(dict,d->wid)],
-           d->wid,
-           dict2lmwid[dict_basewid(dict,src->wid)],
-           src->wid); */
-        score = pl->pscr + l->ascr;
-        if (score > l->pscr) {      /* rkm: Added 20-Nov-1996 */
-            /* FIXME: This scales the wip implicitly */
-            if (pd)
-                lscr = lwf * lm_tg_score(lm,
-                                         dict2lmwid[dict_basewid
-                                                    (dict, pd->wid)],
-                                         dict2lmwid[dict_basewid
-                                                    (dict, d->wid)],
-                                         dict2lmwid[dict_basewid
-                                                    (dict, src->wid)],
-                                         dict_basewid(dict, src->wid));
-            else
-                lscr = lwf * lm_bg_score(lm,
-                                         dict2lmwid[dict_basewid
-                                                    (dict, d->wid)],
-                                         dict2lmwid[dict_basewid
-                                                    (dict, src->wid)],
-                                         dict_basewid(dict, src->wid));
-            score += lscr;
-
-            if (dagp->lmop++ >= dagp->maxlmop)
-                return -1;
+                /* Update best path and score beginning with l */
+                if (score > l->pscr) {
+                    l->lscr = lscr;
+                    l->pscr = score;
+                    l->history = pl;
+                }
+            }
+        }
 
-            /* Update best path and score beginning with l */
-            if (score > l->pscr) {
-                l->lscr = lscr;
-                l->pscr = score;
-                l->history = pl;
+        if (pl) {
+            /* Descend into pl, which must be evaluated before l. */
+            f->pl = pl;
+            if (n_stack == max_stack) {
+                max_stack *= 2;
+                stack = ckd_realloc(stack, max_stack * sizeof(*stack));
             }
+            f = &stack[n_stack++];
+            f->l = pl;
+            f->src = d;
+            f->pl = pl->node ? pl->node->predlist : NULL;
+            continue;
         }
-    }
 
 #if 0
-    printf("%s,%d -> %s,%d = %d\n",
-           dict_wordstr(dict, dict_basewid(dict, d->wid)), d->sf,
-           dict_wordstr(dict, dict_basewid(dict, src->wid)), src->sf,
-           l->pscr);
-    fflush(stdout);
+        printf("%s,%d -> %s,%d = %d\n",
+               dict_wordstr(dict, dict_basewid(dict, d->wid)), d->sf,
+               dict_wordstr(dict, dict_basewid(dict, src->wid)), src->sf,
+               l->pscr);
+        fflush(stdout);
 #endif
 
-    l->pscr_valid = 1;
+        l->pscr_valid = 1;
+        --n_stack;
+    }
 
+    ckd_free(stack);
     return 0;
 }
 
@@ -884,8 +921,8 @@ dag_write_htk(dag_t *dag,
  * Final global best path through DAG constructed from the word lattice.
  * Assumes that the DAG has already been constructed and is consistent with the word
  * lattice.
- * The search uses a recursive algorithm to find the best (reverse) path from the final
- * DAG node to the root:  The best path from any node (beginning with a particular link L)
+ * The search finds the best (reverse) path from the final DAG node to the root
+ * depth-first:  The best path from any node (beginning with a particular link L)
  * depends on a similar best path for all links leaving the endpoint of L.  (This is
  * sufficient to handle trigram LMs.)
  */
@@ -341,6 +341,7 @@
 void
 dump_all_whmm(srch_FLAT_FWD_graph_t * fwg, whmm_t ** whmm, int32 n_frm, int32 * senscr)
 {
+    int32 i;
     s3wid_t w;
     whmm_t *h;
     kbcore_t *kbc;
@@ -353,11 +354,10 @@ dump_all_whmm(srch_FLAT_FWD_graph_t * fwg, whmm_t ** whmm, int32 n_frm, int32 *
     dict = kbcore_dict(kbc);
     mdef = kbcore_mdef(kbc);
 
-    for (w = 0; w < dict->n_word; w++) {
-        if (whmm[w]) {
-            for (h = whmm[w]; h; h = h->next) {
-                dump_whmm(w, h, senscr, tmat, n_frm, dict, mdef);
-            }
+    for (i = 0; i < fwg->n_active_word; i++) {
+        w = fwg->active_word[i];
+        for (h = whmm[w]; h; h = h->next) {
+            dump_whmm(w, h, senscr, tmat, n_frm, dict, mdef);
         }
     }
 }
@@ -367,7 +367,7 @@ dump_all_word(srch_FLAT_FWD_graph_t * fwg, whmm_t ** whmm)
 {
     s3wid_t w;
     whmm_t *h;
-    int32 last, bestlast;
+    int32 i, last, bestlast;
     kbcore_t *kbc;
     tmat_t *tmat;
     dict_t *dict;
@@ -376,71 +376,95 @@ dump_all_word(srch_FLAT_FWD_graph_t * fwg, whmm_t ** whmm)
     tmat = kbcore_tmat(kbc);
     dict = kbcore_dict(kbc);
 
-    for (w = 0; w < dict->n_word; w++) {
-        if (whmm[w]) {
-            printf("[%4d] %-24s", fwg->n_frm, dict->word[w].word);
+    for (i = 0; i < fwg->n_active_word; i++) {
+        w = fwg->active_word[i];
+        printf("[%4d] %-24s", fwg->n_frm, dict->word[w].word);
 
-            last = dict->word[w].pronlen - 1;
-            bestlast = (int32) 0x80000000;
+        last = dict->word[w].pronlen - 1;
+        bestlast = (int32) 0x80000000;
 
-            for (h = whmm[w]; h; h = h->next) {
-                if (h->pos < last)
-                    printf(" %9d.%2d", -hmm_out_score(h), h->pos);
-                else if (bestlast < hmm_out_score(h))
-                    bestlast = hmm_out_score(h);
-            }
+        for (h = whmm[w]; h; h = h->next) {
+            if (h->pos < last)
+                printf(" %9d.%2d", -hmm_out_score(h), h->pos);
+            else if (bestlast < hmm_out_score(h))
+                bestlast = hmm_out_score(h);
+        }
 
-            if (bestlast > (int32) 0x80000000)
-                printf(" %9d.%2d", -bestlast, last);
+        if (bestlast > (int32) 0x80000000)
+            printf(" %9d.%2d", -bestlast, last);
 
-            printf("\n");
-        }
+        printf("\n");
+    }
+}
+
+static int
+cmp_wid(const void *a, const void *b)
+{
+    return *(const s3wid_t *) a - *(const s3wid_t *) b;
+}
+
+/**
+ * Drop words with no HMMs left from the active list and put the words
+ * entered since the last call in order, so that words are visited
+ * (and their lattice entries made) in the same order as a scan of the
+ * whole dictionary would.
+ */
+static void
+active_word_update(srch_FLAT_FWD_graph_t * fwg)
+{
+    int32 i, n;
+    s3wid_t w;
+
+    for (i = n = 0; i < fwg->n_active_word; i++) {
+        w = fwg->active_word[i];
+        if (fwg->whmm[w])
+            fwg->active_word[n++] = w;
     }
+    if (n > 0 && fwg->n_active_word > fwg->n_sorted_word)
+        qsort(fwg->active_word, n, sizeof(*fwg->active_word), cmp_wid);
+    fwg->n_active_word = fwg->n_sorted_word = n;
 }
 
 
 int32
 whmm_eval(srch_FLAT_FWD_graph_t * fwg, int32 * senscr)
 {
-    int32 best, cf;
+    int32 best, cf, i, n_eval;
     s3wid_t w;
     whmm_t *h, *nexth, *prevh;
     int32 n_mpx, n_nonmpx;
+    hmm_t *tmp;
     kbcore_t *kbc;
     tmat_t *tmat;
-    dict_t *dict;
     mdef_t *mdef;
     whmm_t **whmm;
 
     kbc = fwg->kbcore;
     tmat = kbcore_tmat(kbc);
-    dict = kbcore_dict(kbc);
     mdef = kbcore_mdef(kbc);
     whmm = fwg->whmm;
 
     best = S3_LOGPROB_ZERO;
-    n_mpx = n_nonmpx = 0;
+    n_mpx = n_nonmpx = n_eval = 0;
     cf = fwg->n_frm;
 
+    /* Reclaim HMMs not active in this frame and gather the others */
     hmm_context_set_senscore(fwg->hmmctx, senscr);
-    for (w = 0; w < dict->n_word; w++) {
+    for (i = 0; i < fwg->n_active_word; i++) {
+        w = fwg->active_word[i];
         prevh = NULL;
         for (h = whmm[w]; h; h = nexth) {
             nexth = h->next;
             if (hmm_frame(h) == cf) {
-                int32 score;
-
-                score = hmm_vit_eval((hmm_t *)h);
-                if (hmm_is_mpx(h))
-                    n_mpx++;
-                else
-                    n_nonmpx++;
-
-                if (best < score)
-                    best = score;
-
+                if (n_eval == fwg->max_eval_hmm) {
+                    fwg->max_eval_hmm = fwg->max_eval_hmm
+                        ? fwg->max_eval_hmm * 2 : 1024;
+                    fwg->eval_hmm = ckd_realloc(fwg->eval_hmm,
+                                                fwg->max_eval_hmm
+                                                * sizeof(*fwg->eval_hmm));
+                }
+                fwg->eval_hmm[n_eval++] = (hmm_t *)h;
                 prevh = h;
-
             }
             else {
                 if (prevh)
@@ -448,10 +472,25 @@ whmm_eval(srch_FLAT_FWD_graph_t * fwg, int32 * senscr)
                 else
                     whmm[w] = nexth;
 
-                whmm_free(h);
+                whmm_free(fwg->whmm_pool, h);
             }
         }
     }
+    active_word_update(fwg);
+
+    /* Multiplex ones first, so that each kind is evaluated in batches */
+    for (i = 0; i < n_eval; i++) {
+        if (hmm_is_mpx(fwg->eval_hmm[i])) {
+            tmp = fwg->eval_hmm[n_mpx];
+            fwg->eval_hmm[n_mpx++] = fwg->eval_hmm[i];
+            fwg->eval_hmm[i] = tmp;
+        }
+    }
+    n_nonmpx = n_eval - n_mpx;
+    best = hmm_vit_eval_batch(fwg->eval_hmm, n_mpx);
+    i = hmm_vit_eval_batch(fwg->eval_hmm + n_mpx, n_nonmpx);
+    if (best < i)
+        best = i;
 
     pctr_increment(fwg->ctr_mpx_whmm, n_mpx);
     pctr_increment(fwg->ctr_nonmpx_whmm, n_nonmpx);
@@ -464,14 +503,15 @@ whmm_renorm(srch_FLAT_FWD_graph_t * fwg, whmm_t ** whmm, int32 bestscr)
 {
     s3wid_t w;
     whmm_t *h;
-    dict_t *dict;
+    int32 i;
 
-    dict = fwg->kbcore->dict;
     fwg->renormalized = 1;
 
-    for (w = 0; w < dict->n_word; w++)
+    for (i = 0; i < fwg->n_active_word; i++) {
+        w = fwg->active_word[i];
         for (h = whmm[w]; h; h = h->next)
             hmm_normalize((hmm_t *)h, bestscr);
+    }
 }
 
 
@@ -508,7 +548,7 @@ whmm_transition(srch_FLAT_FWD_graph_t * fwg, whmm_t ** whmm, int32 w, whmm_t * h
          * the HMM if not already present.
          */
         if ((!h->next) || (h->next->pos != h->pos + 1)) {
-            nexth = whmm_alloc(fwg->hmmctx, h->pos + 1, FALSE,
+            nexth = whmm_alloc(fwg->whmm_pool, fwg->hmmctx, h->pos + 1, FALSE,
                                ctxt_table_word_int_ssid(ct_table, w, h->pos + 1),
                                dict->word[w].ciphone[h->pos + 1]);
             nexth->next = h->next;
@@ -529,8 +569,8 @@ whmm_transition(srch_FLAT_FWD_graph_t * fwg, whmm_t ** whmm, int32 w, whmm_t * h
         get_rcssid(ct_table, w, &ssid, &nssid, dict);
         for (rc = 0; rc < nssid; rc++) {
             if ((!prevh->next) || (prevh->next->rc != rc)) {
-                nexth = whmm_alloc(fwg->hmmctx, h->pos + 1, FALSE,
-                                   ssid[rc],
+                nexth = whmm_alloc(fwg->whmm_pool, fwg->hmmctx, h->pos + 1,
+                                   FALSE, ssid[rc],
                                    dict->word[w].ciphone[h->pos + 1]);
 
                 nexth->rc = rc;
@@ -556,7 +596,7 @@ whmm_exit(srch_FLAT_FWD_graph_t * fwg,
 {
     s3wid_t w;
     whmm_t *h;
-    int32 pronlen, nf;
+    int32 i, pronlen, nf;
     dict_t *dict;
     kbcore_t *kbc;
     tmat_t *tmat;
@@ -567,7 +607,8 @@ whmm_exit(srch_FLAT_FWD_graph_t * fwg,
 
     nf = fwg->n_frm + 1;
 
-    for (w = 0; w < dict->n_word; w++) {
+    for (i = 0; i < fwg->n_active_word; i++) {
+        w = fwg->active_word[i];
         pronlen = dict->word[w].pronlen;
 
         for (h = whmm[w]; h; h = h->next) {
@@ -647,6 +688,10 @@ word_enter(srch_FLAT_FWD_graph_t * fwg, s3wid_t w,
     b = dict->word[w].ciphone[0];
     lcmap = get_lc_cimap(ct_table, w, dict);
 
+    /* Newly active words are put in order by the next whmm_eval */
+    if (!whmm[w])
+        fwg->active_word[fwg->n_active_word++] = w;
+
     if (dict->word[w].pronlen > 1) {    /* Multi-phone word; no right context problem */
 
         rc = dict->word[w].ciphone[1];
@@ -664,7 +709,7 @@ word_enter(srch_FLAT_FWD_graph_t * fwg, s3wid_t w,
         /* Allocate and initialize a multiplex HMM for the next phone if necessary. */
         if ((!whmm[w]) || (whmm[w]->pos != 0)) {
             /* If whmm is not allocated or it is not the first phone */
-            h = whmm_alloc(fwg->hmmctx, 0, TRUE, ssid, b);
+            h = whmm_alloc(fwg->whmm_pool, fwg->hmmctx, 0, TRUE, ssid, b);
             h->next = whmm[w];
             whmm[w] = h;
         }
@@ -697,7 +742,8 @@ word_enter(srch_FLAT_FWD_graph_t * fwg, s3wid_t w,
             ssid = *(ssidp);
 
             if ((!h) || (h->rc != rc)) {
-                h = whmm_alloc(fwg->hmmctx, 0, TRUE, rssid[rc], b);
+                h = whmm_alloc(fwg->whmm_pool, fwg->hmmctx, 0, TRUE,
+                               rssid[rc], b);
                 h->rc = rc;
 
                 if (prevh) {
@@ -48,6 +48,7 @@
 
 
 #include <assert.h>
+#include <stdlib.h>
 #include <fsg_history.h>
 #include <kb.h>
 #include <search.h>
@@ -84,6 +85,7 @@ fsg_history_free(fsg_history_t *h)
 {
 	blkarray_list_free(h->entries);
 	ckd_free_2d((void **)h->frame_entries);
+	ckd_free(h->frame_scores);
 	ckd_free(h);
 }
 
@@ -132,7 +134,8 @@ fsg_history_entry_add(fsg_history_t * h,
         new_entry->lc = lc;
         new_entry->rc = rc;
 
-        blkarray_list_append(h->entries, (void *) new_entry);
+        if (blkarray_list_append(h->entries, (void *) new_entry) < 0)
+            ckd_free(new_entry);
         return;
     }
 
@@ -191,6 +194,69 @@ fsg_history_entry_add(fsg_history_t * h,
 }
 
 
+static int
+cmp_score_desc(const void *a, const void *b)
+{
+    int32 sa = *(const int32 *) a;
+    int32 sb = *(const int32 *) b;
+
+    return (sa < sb) - (sa > sb);
+}
+
+
+/*
+ * Find the score threshold for this frame's entries to fit in what is
+ * left of a size limited history table, and how many entries scoring
+ * exactly the threshold fit.  Returns FALSE if they all fit.
+ */
+static int32
+fsg_history_frame_thresh(fsg_history_t * h, int32 * out_thresh,
+                         int32 * out_n_at_thresh)
+{
+    int32 s, lc, ns, np, n, room, i;
+    gnode_t *gn;
+
+    ns = word_fsg_n_state(h->fsg);
+    np = h->n_ciphone;
+
+    n = 0;
+    for (s = 0; s < ns; s++) {
+        for (lc = 0; lc < np; lc++) {
+            for (gn = h->frame_entries[s][lc]; gn; gn = gnode_next(gn)) {
+                if (n == h->n_frame_scores_alloc) {
+                    h->n_frame_scores_alloc += 256;
+                    h->frame_scores = (int32 *)
+                        ckd_realloc(h->frame_scores,
+                                    h->n_frame_scores_alloc * sizeof(int32));
+                }
+                h->frame_scores[n++] =
+                    ((fsg_hist_entry_t *) gnode_ptr(gn))->score;
+            }
+        }
+    }
+
+    room = h->entries->max_valid - blkarray_list_n_valid(h->entries);
+    if (n <= room)
+        return FALSE;
+
+    if (h->n_pruned == 0)
+        E_WARN("History table full (%d entries), pruning word exits\n",
+               h->entries->max_valid);
+    h->n_pruned += n - room;
+
+    /* Keep the best room entries, ties going to the first ones */
+    *out_thresh = MAX_INT32;
+    *out_n_at_thresh = 0;
+    if (room <= 0)
+        return TRUE;
+    qsort(h->frame_scores, n, sizeof(int32), cmp_score_desc);
+    *out_thresh = h->frame_scores[room - 1];
+    for (i = room - 1; i >= 0 && h->frame_scores[i] == *out_thresh; --i)
+        ++*out_n_at_thresh;
+    return TRUE;
+}
+
+
 /*
  * Transfer the surviving history entries for this frame into the permanent
  * history table.
@@ -199,17 +265,31 @@ void
 fsg_history_end_frame(fsg_history_t * h)
 {
     int32 s, lc, ns, np;
+    int32 limited, thresh, n_at_thresh;
     gnode_t *gn;
     fsg_hist_entry_t *entry;
 
     ns = word_fsg_n_state(h->fsg);
     np = h->n_ciphone;
 
+    limited = FALSE;
+    thresh = n_at_thresh = 0;
+    if (h->entries->max_valid > 0)
+        limited = fsg_history_frame_thresh(h, &thresh, &n_at_thresh);
+
     for (s = 0; s < ns; s++) {
         for (lc = 0; lc < np; lc++) {
             for (gn = h->frame_entries[s][lc]; gn; gn = gnode_next(gn)) {
                 entry = (fsg_hist_entry_t *) gnode_ptr(gn);
-                blkarray_list_append(h->entries, (void *) entry);
+                if (limited && entry->score <= thresh) {
+                    if (entry->score < thresh || n_at_thresh == 0) {
+                        ckd_free(entry);
+                        continue;
+                    }
+                    --n_at_thresh;
+                }
+                if (blkarray_list_append(h->entries, (void *) entry) < 0)
+                    ckd_free(entry);
             }
 
             glist_free(h->frame_entries[s][lc]);
@@ -222,18 +302,7 @@ fsg_history_end_frame(fsg_history_t * h)
 fsg_hist_entry_t *
 fsg_history_entry_get(fsg_history_t * h, int32 id)
 {
-    blkarray_list_t *entries;
-    int32 r, c;
-
-    entries = h->entries;
-
-    if (id >= blkarray_list_n_valid(entries))
-        return NULL;
-
-    r = id / blkarray_list_blksize(entries);
-    c = id - (r * blkarray_list_blksize(entries));
-
-    return ((fsg_hist_entry_t *) blkarray_list_ptr(entries, r, c));
+    return ((fsg_hist_entry_t *) blkarray_list_get(h->entries, id));
 }
 
 
@@ -244,6 +313,13 @@ fsg_history_reset(fsg_history_t * h)
 }
 
 
+void
+fsg_history_set_max(fsg_history_t * h, int32 max_entries)
+{
+    blkarray_list_set_max(h->entries, max_entries);
+}
+
+
 int32
 fsg_history_n_entries(fsg_history_t * h)
 {
@@ -366,6 +442,7 @@ fsg_history_utt_start(fsg_history_t * h)
     int32 s, lc, ns, np;
 
     blkarray_list_reset(h->entries);
+    h->n_pruned = 0;
     assert(h->frame_entries);
 
     ns = word_fsg_n_state(h->fsg);
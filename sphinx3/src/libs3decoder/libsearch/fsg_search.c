@@ -258,6 +258,8 @@ fsg_search_init(word_fsg_t * fsg, void *srch)
     search->isUsealtpron = cmd_ln_int32_r(search->config, "-fsgusealtpron");
     search->isUseFiller = cmd_ln_int32_r(search->config, "-fsgusefiller");
     search->isBacktrace = cmd_ln_int32_r(search->config, "-backtrace");
+    fsg_history_set_max(search->history,
+                        cmd_ln_int32_r(search->config, "-fsghistmax"));
     search->matchfp = s->matchfp;
     search->matchsegfp = s->matchsegfp;
     search->senscale = s->ascale;
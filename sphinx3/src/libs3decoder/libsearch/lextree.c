@@ -139,6 +139,8 @@
 #include <string.h>
 
 #include <sphinxbase/err.h>
+#include <sphinxbase/hash_table.h>
+#include <sphinxbase/listelem_alloc.h>
 
 /*
  * Lextree nodes, and the HMMs contained within, are cleared upon creation, and whenever
@@ -356,6 +358,64 @@ num_lextree_links(lextree_t * ltree)
 
 }
 
+size_t
+lextree_mem_size(lextree_t * ltree)
+{
+    size_t n_link;
+
+    /* Every link is a list node pointing to a tree node; nodes shared
+       between left context roots are counted more than once. */
+    n_link = num_lextree_links(ltree);
+    return sizeof(*ltree)
+        + n_link * (sizeof(gnode_t) + sizeof(lextree_node_t))
+        + ltree->n_lc * sizeof(lextree_lcroot_t)
+        + 2 * (size_t)ltree->n_alloc_active * sizeof(lextree_node_t *);
+}
+
+
+/*
+ * While a lextree is being built, internal (non-leaf) children are looked up by
+ * (parent, ssid) in a hash table rather than by scanning the parent's child list,
+ * which made building trees for large dictionaries quadratic.  The table always
+ * holds the most recently added matching child, i.e. the one a scan of the
+ * (prepended-to) child list would have found first.
+ */
+typedef struct {
+    lextree_node_t *parent;
+    int32 ssid;
+} lextree_edge_t;
+
+static lextree_node_t *
+lextree_child_find(hash_table_t * children, lextree_node_t * parent,
+                   int32 ssid)
+{
+    lextree_edge_t key;
+    void *val;
+
+    memset(&key, 0, sizeof(key));
+    key.parent = parent;
+    key.ssid = ssid;
+    if (hash_table_lookup_bkey(children, (char *) &key, sizeof(key), &val) < 0)
+        return NULL;
+    return (lextree_node_t *) val;
+}
+
+static void
+lextree_child_add(hash_table_t * children, listelem_alloc_t * edge_alloc,
+                  lextree_node_t * parent, lextree_node_t * ln)
+{
+    lextree_edge_t *key;
+
+    parent->children = glist_add_ptr(parent->children, (void *) ln);
+    if (ln->composite || IS_S3WID(ln->wid))
+        return;
+
+    key = listelem_malloc(edge_alloc);
+    memset(key, 0, sizeof(*key));
+    key->parent = parent;
+    key->ssid = ln->ssid;
+    hash_table_replace_bkey(children, (char *) key, sizeof(*key), ln);
+}
 
 lextree_t *
 lextree_build(kbcore_t * kbc, wordprob_t * wordprob, int32 n_word,
@@ -370,9 +430,11 @@ lextree_build(kbcore_t * kbc, wordprob_t * wordprob, int32 n_word,
     lextree_lcroot_t *lcroot;
     int32 n_lc, n_node, n_ci, n_sseq, pronlen, ssid, prob, ci, rc, wid, np,
         n_st;
-    lextree_node_t *ln = 0, **parent, **ssid2ln;
+    lextree_node_t *ln = 0, **parent, **ssid2ln, **comssid2ln;
     gnode_t *gn = 0;
     bitvec_t **ssid_lc;
+    hash_table_t *children;
+    listelem_alloc_t *edge_alloc;
     int32 i, j, k, p;
 
     mdef = kbc->mdef;
@@ -398,6 +460,15 @@ lextree_build(kbcore_t * kbc, wordprob_t * wordprob, int32 n_word,
     /* Table mapping from root level ssid to lexnode (temporary) */
     ssid2ln =
         (lextree_node_t **) ckd_calloc(n_sseq, sizeof(lextree_node_t *));
+    /* Same for composite root ssids when there is no left context */
+    comssid2ln = NULL;
+    if (d2p->is_composite)
+        comssid2ln = (lextree_node_t **)
+            ckd_calloc(dict2pid_n_comsseq(d2p), sizeof(lextree_node_t *));
+
+    /* Internal children by (parent, ssid) (temporary) */
+    children = hash_table_new(n_word, HASH_CASE_YES);
+    edge_alloc = listelem_alloc_init(sizeof(lextree_edge_t));
 
     /* ssid_lc[ssid] = bitvec indicating which lc's this (root) ssid is entered under */
     ssid_lc = (bitvec_t **) ckd_calloc(n_sseq, sizeof(bitvec_t *));
@@ -527,14 +598,10 @@ lextree_build(kbcore_t * kbc, wordprob_t * wordprob, int32 n_word,
                 ssid = d2p->internal[wid][0];
                 ci = dict_pron(dict, wid, 0);
 
-                /* Check if this ssid already allocated for another word */
-                for (gn = lextree->root; gn; gn = gnode_next(gn)) {
-                    ln = (lextree_node_t *) gnode_ptr(gn);
-                    if ((ln->ssid == ssid) && ln->composite
-                        && NOT_S3WID(ln->wid))
-                        break;
-                }
-                if (!gn) {
+                /* Check if this ssid already allocated for another
+                 * word; only composite roots are ever shared. */
+                ln = comssid2ln ? comssid2ln[ssid] : NULL;
+                if (!ln) {
                     ln = lextree_node_alloc(lextree, BAD_S3WID, prob,
                                             d2p->is_composite, ssid, ci, BAD_S3CIPID,
                                             mdef_pid2tmatid(mdef, ci));
@@ -542,6 +609,8 @@ lextree_build(kbcore_t * kbc, wordprob_t * wordprob, int32 n_word,
                     lextree->root =
                         glist_add_ptr(lextree->root, (void *) ln);
                     n_node++;
+                    if (comssid2ln)
+                        comssid2ln[ssid] = ln;
                 }
                 else {
                     if (ln->prob < prob)
@@ -597,29 +666,22 @@ lextree_build(kbcore_t * kbc, wordprob_t * wordprob, int32 n_word,
                 ci = dict_pron(dict, wid, p);
 
                 /* Check for ssid under each parent (#parents(np) > 1 only when p==1) */
+                ln = NULL;
                 for (j = 0; j < np; j++) {
-                    for (gn = parent[j]->children; gn; gn = gnode_next(gn)) {
-                        ln = (lextree_node_t *) gnode_ptr(gn);
-
-                        if ((ln->ssid == ssid) && (!ln->composite)) {
-                            assert(NOT_S3WID(ln->wid));
-                            break;
-                        }
-                    }
-                    if (gn)
+                    if ((ln = lextree_child_find(children, parent[j], ssid))
+                        != NULL)
                         break;
                 }
 
-                if (!gn) {      /* Not found under any parent; allocate new node */
+                if (!ln) {      /* Not found under any parent; allocate new node */
                     ln = lextree_node_alloc(lextree, BAD_S3WID,
                                             prob, NOT_COMPOSITE,
                                             ssid, ci, BAD_S3CIPID,
                                             mdef_pid2tmatid(mdef, ci));
 
                     for (j = 0; j < np; j++)
-                        parent[j]->children =
-                            glist_add_ptr(parent[j]->children,
-                                          (void *) ln);
+                        lextree_child_add(children, edge_alloc,
+                                          parent[j], ln);
                     n_node++;
                 }
                 else {          /* Already exists under parent[j] */
@@ -630,20 +692,27 @@ lextree_build(kbcore_t * kbc, wordprob_t * wordprob, int32 n_word,
 
                     /* Child was not found under parent[0..k-1]; add */
                     for (j = 0; j < k; j++)
-                        parent[j]->children =
-                            glist_add_ptr(parent[j]->children,
-                                          (void *) ln);
+                        lextree_child_add(children, edge_alloc,
+                                          parent[j], ln);
 
-                    /* Parents beyond k have not been checked; add if not present */
+                    /* Parents beyond k have not been checked; add if not
+                     * present.  If the table holds another child with this
+                     * ssid, ln may still be further down the list. */
                     for (j = k + 1; j < np; j++) {
-                        gnode_t *gn;
-                        for (gn = parent[j]->children; gn; gn = gnode_next(gn))
-                            if (gnode_ptr(gn) == ln)
-                                break;
-                        if (gn == NULL)
-                            parent[j]->children =
-                                glist_add_ptr(parent[j]->children,
-                                              (void *) ln);
+                        lextree_node_t *ln2;
+
+                        ln2 = lextree_child_find(children, parent[j], ssid);
+                        if (ln2 == ln)
+                            continue;
+                        if (ln2 != NULL) {
+                            for (gn = parent[j]->children; gn; gn = gnode_next(gn))
+                                if (gnode_ptr(gn) == ln)
+                                    break;
+                            if (gn != NULL)
+                                continue;
+                        }
+                        lextree_child_add(children, edge_alloc,
+                                          parent[j], ln);
                     }
                 }
 
@@ -677,13 +746,12 @@ lextree_build(kbcore_t * kbc, wordprob_t * wordprob, int32 n_word,
      */
     lextree->n_alloc_blk_sz = ((n_word * mdef_n_ciphone(mdef)) >> 3);
 
+    lextree->n_alloc_active = n_node + n_word * mdef_n_ciphone(mdef);
     lextree->active =
-        (lextree_node_t **) ckd_calloc(n_node +
-                                       n_word * mdef_n_ciphone(mdef),
+        (lextree_node_t **) ckd_calloc(lextree->n_alloc_active,
                                        sizeof(lextree_node_t *));
     lextree->next_active =
-        (lextree_node_t **) ckd_calloc(n_node +
-                                       n_word * mdef_n_ciphone(mdef),
+        (lextree_node_t **) ckd_calloc(lextree->n_alloc_active,
                                        sizeof(lextree_node_t *));
 
     /*    lextree->active = (lextree_node_t **) ckd_calloc (n_node, sizeof(lextree_node_t *));
@@ -694,6 +762,9 @@ lextree_build(kbcore_t * kbc, wordprob_t * wordprob, int32 n_word,
     lextree->n_next_active = 0;
 
     ckd_free((void *) ssid2ln);
+    ckd_free(comssid2ln);
+    hash_table_free(children);
+    listelem_alloc_free(edge_alloc);
     for (i = 0; i < n_sseq; i++)
         bitvec_free(ssid_lc[i]);
     ckd_free((void *) ssid_lc);
@@ -1375,7 +1446,7 @@ lextree_hmm_propagate_non_leaves(lextree_t * lextree, kbcore_t * kbc,
     tmat_t *tmat;
     gnode_t *gn, *gn2;
     int32 i, n;
-    int32 hth;
+    int32 hth, maxHeurScore;
     int32 *phn_heur_list;
     int32 heur_beam;
     int32 heur_type;
@@ -1384,8 +1455,7 @@ lextree_hmm_propagate_non_leaves(lextree_t * lextree, kbcore_t * kbc,
     s3ssid_t *rmap;
 
     /* Code for heursitic score */
-    kbc->maxNewHeurScore = MAX_NEG_INT32;
-    kbc->lastfrm = -1;
+    maxHeurScore = MAX_NEG_INT32;
     hth = 0;
     mdef = kbcore_mdef(kbc);
     n_ci = mdef_n_ciphone(mdef);
@@ -1441,21 +1511,16 @@ lextree_hmm_propagate_non_leaves(lextree_t * lextree, kbcore_t * kbc,
             E_DEBUG("Propagating (%d >= %d)\n", hmm_out_score(&ln->hmm), pth);
             if (heur_type > 0) {        /* In full expansion, this part is not
                                            really correct */
-                if (cf != kbc->lastfrm) {
-                    kbc->lastfrm = cf;
-                    kbc->maxNewHeurScore = MAX_NEG_INT32;
-                }
-
                 for (gn = ln->children; gn; gn = gnode_next(gn)) {
                     ln2 = gnode_ptr(gn);
 
                     newHeurScore =
                         hmm_out_score(ln) + (ln2->prob - ln->prob) +
                         phn_heur_list[(int32) ln2->ci];
-                    if (kbc->maxNewHeurScore < newHeurScore)
-                        kbc->maxNewHeurScore = newHeurScore;
+                    if (maxHeurScore < newHeurScore)
+                        maxHeurScore = newHeurScore;
                 }
-                hth = kbc->maxNewHeurScore + heur_beam;
+                hth = maxHeurScore + heur_beam;
             }
 
             /* Transition to each child */
@@ -212,6 +212,8 @@ srch_FLAT_FWD_init(kb_t * kb,    /**< The KB */
 				   kbcore_tmat(kbc)->tp, NULL,
 				   mdef->sseq);
     fwg->whmm = (whmm_t **) ckd_calloc(dict->n_word, sizeof(whmm_t *));
+    fwg->whmm_pool = whmm_pool_init();
+    fwg->active_word = (s3wid_t *) ckd_calloc(dict->n_word, sizeof(s3wid_t));
 
     /* Data structures needed during word transition */
     /* These five things need to be tied into the same structure.  Such that when multiple LM they could be switched.  */
@@ -309,6 +311,10 @@ srch_FLAT_FWD_uninit(void *srch)
     if (fwg->whmm)
 	ckd_free(fwg->whmm);
 
+    whmm_pool_free(fwg->whmm_pool);
+    ckd_free(fwg->active_word);
+    ckd_free(fwg->eval_hmm);
+
     if (fwg->hmmctx)
 	hmm_context_free(fwg->hmmctx);
 
@@ -404,19 +410,16 @@ srch_FLAT_FWD_end(void *srch)
 {
     srch_FLAT_FWD_graph_t *fwg;
     srch_t *s;
-    kbcore_t *kbc;
-    dict_t *dict;
     stat_t *st;
 
     whmm_t *h, *nexth;
     s3wid_t w;
     lm_t *lm;
+    int32 i;
 
 
     s = (srch_t *) srch;
     fwg = (srch_FLAT_FWD_graph_t *) s->grh->graph_struct;
-    kbc = s->kbc;
-    dict = kbcore_dict(kbc);
     st = s->stat;
 
     lm = s->kbc->lmset->cur_lm;
@@ -425,13 +428,15 @@ srch_FLAT_FWD_end(void *srch)
     pctr_increment(fwg->ctr_latentry, fwg->lathist->n_lat_entry);
 
     /* Free whmm search structures */
-    for (w = 0; w < dict->n_word; w++) {
+    for (i = 0; i < fwg->n_active_word; i++) {
+        w = fwg->active_word[i];
         for (h = fwg->whmm[w]; h; h = nexth) {
             nexth = h->next;
-            whmm_free(h);
+            whmm_free(fwg->whmm_pool, h);
         }
         fwg->whmm[w] = NULL;
     }
+    fwg->n_active_word = fwg->n_sorted_word = 0;
 
     if (fwg->n_word_cand > 0) {
         word_cand_free(fwg->word_cand);
@@ -549,26 +554,25 @@ srch_FLAT_FWD_select_active_gmm(void *srch)
     kbcore_t *kbc;
     s3wid_t w;
     whmm_t *h;
-    int32 st;
+    int32 i, st;
     s3pid_t p;
     s3senid_t *senp;
     ascr_t *ascr;
     srch_FLAT_FWD_graph_t *fwg;
     srch_t *s;
     mdef_t *mdef;
-    dict_t *dict;
 
     s = (srch_t *) srch;
     fwg = (srch_FLAT_FWD_graph_t *) s->grh->graph_struct;
     ascr = s->ascr;
     kbc = s->kbc;
     mdef = kbcore_mdef(kbc);
-    dict = kbcore_dict(kbc);
 
     ascr_clear_sen_active(ascr);
 
     /* Flag active senones */
-    for (w = 0; w < dict->n_word; w++) {
+    for (i = 0; i < fwg->n_active_word; i++) {
+        w = fwg->active_word[i];
         for (h = fwg->whmm[w]; h; h = h->next) {
             if (hmm_is_mpx(h)) {
 		for (st = 0; st < hmm_n_emit_state(h); ++st) {
@@ -177,6 +177,13 @@ typedef struct srch_FLAT_FWD_graph_s {
      */
     hmm_context_t *hmmctx; /**< The HMM context. */
     whmm_t **whmm;         /**< The word hmms list.  For actual search traverse */
+    whmm_pool_t *whmm_pool; /**< Freed whmm, kept for reuse */
+    s3wid_t *active_word;  /**< Words w with whmm[w] non-NULL.  Ascending after
+                              whmm_eval; word_enter appends new ones after that. */
+    int32 n_active_word;   /**< Number of entries in active_word */
+    int32 n_sorted_word;   /**< Leading entries of active_word in ascending order */
+    hmm_t **eval_hmm;      /**< HMMs evaluated in the current frame */
+    int32 max_eval_hmm;    /**< Allocated size of eval_hmm */
 
     word_ugprob_t **word_ugprob; /**< word unigram probability */
     backoff_t *ug_backoff;       /**< Unigram backoff probability */
@@ -154,6 +154,7 @@
 #include <string.h>
 
 #include <sphinxbase/err.h>
+#include <sphinxbase/sbthread.h>
 
 /** 
     \file srch_time_switch_tree.h 
@@ -231,7 +232,31 @@
    
 */
 
-typedef struct {
+/** Jobs run by the search threads. */
+enum {
+    TST_JOB_EVAL,       /**< Evaluate active HMMs */
+    TST_JOB_PROPAGATE,  /**< Propagate non-leaf HMMs to the next frame */
+    TST_JOB_EXIT        /**< Exit worker thread */
+};
+
+struct srch_TST_graph_s;
+
+/**
+ * Search thread state.  Each thread handles a contiguous share of
+ * the unigram and filler lextrees.  Word exits (the leaves) touch
+ * the shared Viterbi history and are always propagated by the
+ * calling thread once every share is finished.
+ */
+typedef struct tst_worker_s {
+    struct srch_TST_graph_s *tstg;
+    int32 idx;          /**< Index of this thread's share */
+    sbthread_t *thr;    /**< Worker thread (NULL for the calling thread) */
+    sbevent_t *start;   /**< Signalled when a job is ready */
+    sbevent_t *done;    /**< Signalled when this share is finished */
+    int32 failed;       /**< Tree which failed to propagate, or -1 */
+} tst_worker_t;
+
+typedef struct srch_TST_graph_s {
 
     /**
      * There can be several unigram lextrees.  If we're at the end of frame f, we can only
@@ -242,7 +267,9 @@ typedef struct {
     int32 n_lextree;		/**< Number of lexical tree for time switching: n_lextree */
     lextree_t **curugtree;        /**< The current unigram tree that used in the search for this utterance. */
 
-    lextree_t **ugtree;           /**< The pool of trees that stores all word trees. */
+    lextree_t **ugtree;           /**< The pool of trees that stores all word trees,
+                                     n_lextree per LM; NULL for LMs whose trees
+                                     are not built. */
     lextree_t **fillertree;       /**< The pool of trees that stores all filler trees. */
     int32 n_lextrans;		/**< #Transitions to lextree (root) made so far */
     int32 epl ;                   /**< The number of entry per lexical tree */
@@ -250,12 +277,245 @@ typedef struct {
     lmset_t* lmset;               /**< The LM set */
     int32 isLMLA;  /**< Is LM lookahead used?*/
 
+    size_t ugtree_budget;   /**< Memory for the trees of LMs not in use, 0 for no limit */
+    size_t *ugtree_mem;     /**< Memory of each LM's trees when last switched away from */
+    int32 *ugtree_used;     /**< When each LM's trees were last switched to */
+    int32 ugtree_clock;     /**< Number of LM switches so far */
+
     histprune_t *histprune; /**< Structure that wraps up parameters related to  */
   
     vithist_t *vithist;     /**< Viterbi history (backpointer) table */
 
+    tst_worker_t *workers;  /**< Search threads, workers[0] is the caller */
+    int32 n_thread;         /**< Number of search threads */
+    int32 job;              /**< Job being run by the search threads */
+    srch_t *job_srch;       /**< Search the job is run for */
+    int32 job_frm;          /**< Frame the job is run for */
+    int32 job_pth;          /**< Phone transition threshold for propagation */
+
 } srch_TST_graph_t ;
 
+static lextree_t *
+srch_TST_tree(srch_TST_graph_t *tstg, int32 i)
+{
+    return (i < tstg->n_lextree)
+        ? tstg->curugtree[i] : tstg->fillertree[i - tstg->n_lextree];
+}
+
+static void
+srch_TST_run_share(srch_TST_graph_t *tstg, tst_worker_t *w)
+{
+    srch_t *s = tstg->job_srch;
+    int32 n, lo, hi, i;
+
+    n = tstg->n_lextree << 1;
+    lo = n * w->idx / tstg->n_thread;
+    hi = n * (w->idx + 1) / tstg->n_thread;
+    w->failed = -1;
+    for (i = lo; i < hi; ++i) {
+        lextree_t *lextree = srch_TST_tree(tstg, i);
+
+        if (tstg->job == TST_JOB_EVAL) {
+            lextree_hmm_eval(lextree, s->kbc, s->ascr, tstg->job_frm, NULL);
+        }
+        else if (lextree_hmm_propagate_non_leaves(lextree, s->kbc,
+                                                  tstg->job_frm,
+                                                  s->beam->thres,
+                                                  tstg->job_pth,
+                                                  s->beam->word_thres,
+                                                  s->pl) !=
+                 LEXTREE_OPERATION_SUCCESS) {
+            w->failed = i;
+            return;
+        }
+    }
+}
+
+static int
+srch_TST_worker_main(sbthread_t *th)
+{
+    tst_worker_t *w = sbthread_arg(th);
+    srch_TST_graph_t *tstg = w->tstg;
+
+    while (sbevent_wait(w->start, -1, -1) == 0) {
+        if (tstg->job == TST_JOB_EXIT)
+            break;
+        srch_TST_run_share(tstg, w);
+        sbevent_signal(w->done);
+    }
+    return 0;
+}
+
+/**
+ * Run a job over all lextrees on the search threads and wait for it
+ * to finish.  Returns the first tree that failed, or -1.
+ */
+static int32
+srch_TST_run(srch_TST_graph_t *tstg, srch_t *s, int32 job, int32 frm)
+{
+    int32 t, failed;
+
+    tstg->job = job;
+    tstg->job_srch = s;
+    tstg->job_frm = frm;
+    for (t = 1; t < tstg->n_thread; ++t)
+        sbevent_signal(tstg->workers[t].start);
+    srch_TST_run_share(tstg, &tstg->workers[0]);
+    for (t = 1; t < tstg->n_thread; ++t)
+        sbevent_wait(tstg->workers[t].done, -1, -1);
+
+    failed = -1;
+    for (t = 0; t < tstg->n_thread && failed < 0; ++t)
+        failed = tstg->workers[t].failed;
+    return failed;
+}
+
+static void
+srch_TST_start_workers(srch_TST_graph_t *tstg, int32 n_thread)
+{
+    int32 t;
+
+    /* There is nothing to share beyond one thread per tree. */
+    if (n_thread > (tstg->n_lextree << 1))
+        n_thread = tstg->n_lextree << 1;
+    if (n_thread < 1)
+        n_thread = 1;
+    tstg->workers = ckd_calloc(n_thread, sizeof(*tstg->workers));
+    tstg->n_thread = 1;
+    tstg->workers[0].tstg = tstg;
+    for (t = 1; t < n_thread; ++t) {
+        tst_worker_t *w = &tstg->workers[t];
+
+        w->tstg = tstg;
+        w->idx = t;
+        if ((w->start = sbevent_init()) == NULL
+            || (w->done = sbevent_init()) == NULL
+            || (w->thr = sbthread_start(NULL, srch_TST_worker_main, w)) == NULL) {
+            E_WARN("Failed to start search thread %d; using %d\n",
+                   t, tstg->n_thread);
+            if (w->start)
+                sbevent_free(w->start);
+            if (w->done)
+                sbevent_free(w->done);
+            break;
+        }
+        tstg->n_thread = t + 1;
+    }
+    if (tstg->n_thread > 1)
+        E_INFO("Using %d threads for lextree search\n", tstg->n_thread);
+}
+
+/**
+ * Build the unigram lextrees for LM idx.
+ */
+static int
+srch_TST_build_ugtree(srch_TST_graph_t *tstg, kbcore_t *kbc, int32 idx,
+                      ptmr_t *tm_build)
+{
+    lextree_t **tree;
+    int32 j;
+
+    tree = tstg->ugtree + idx * tstg->n_lextree;
+    for (j = 0; j < tstg->n_lextree; j++) {
+        ptmr_start(tm_build);
+        tree[j] = lextree_init(kbc, kbc->lmset->lmarray[idx],
+                               lmset_idx_to_name(kbc->lmset, idx),
+                               tstg->isLMLA, REPORT_SRCH_TST,
+                               LEXTREE_TYPE_UNIGRAM);
+        ptmr_stop(tm_build);
+
+        if (tree[j] == NULL) {
+            E_INFO
+                ("Fail to allocate lexical tree for lm %d and lextree %d\n",
+                 idx, j);
+            while (--j >= 0) {
+                lextree_free(tree[j]);
+                tree[j] = NULL;
+            }
+            return SRCH_FAILURE;
+        }
+
+        /* Just report the lexical tree parameters for the first tree */
+        if (j == 0)
+            lextree_report(tree[0]);
+
+        if (REPORT_SRCH_TST) {
+            E_INFO
+                ("Lextrees (%d) for lm %d, its name is %s, it has %d nodes(ug)\n",
+                 j, idx, lmset_idx_to_name(kbc->lmset, idx),
+                 lextree_n_node(tree[j]));
+        }
+    }
+    tstg->ugtree_mem[idx] = 0;
+    tstg->ugtree_used[idx] = tstg->ugtree_clock;
+
+    return SRCH_SUCCESS;
+}
+
+static void
+srch_TST_free_ugtree(srch_TST_graph_t *tstg, int32 idx)
+{
+    int32 j;
+
+    for (j = 0; j < tstg->n_lextree; j++) {
+        if (tstg->ugtree[idx * tstg->n_lextree + j])
+            lextree_free(tstg->ugtree[idx * tstg->n_lextree + j]);
+        tstg->ugtree[idx * tstg->n_lextree + j] = NULL;
+    }
+    tstg->ugtree_mem[idx] = 0;
+}
+
+/**
+ * Free the least recently used trees of LMs other than cur until the
+ * rest fit in the memory budget.
+ */
+static void
+srch_TST_trim_ugtree(srch_TST_graph_t *tstg, lmset_t *lms, int32 cur)
+{
+    size_t total;
+    int32 i, lru;
+
+    if (tstg->ugtree_budget == 0)
+        return;
+    for (;;) {
+        total = 0;
+        lru = -1;
+        for (i = 0; i < lms->n_lm; i++) {
+            if (i == cur || tstg->ugtree[i * tstg->n_lextree] == NULL)
+                continue;
+            total += tstg->ugtree_mem[i];
+            if (lru < 0 || tstg->ugtree_used[i] < tstg->ugtree_used[lru])
+                lru = i;
+        }
+        if (total <= tstg->ugtree_budget)
+            break;
+        E_INFO("Freeing lextrees of LM %s (%lu bytes)\n",
+               lmset_idx_to_name(lms, lru),
+               (unsigned long) tstg->ugtree_mem[lru]);
+        srch_TST_free_ugtree(tstg, lru);
+    }
+}
+
+static void
+srch_TST_stop_workers(srch_TST_graph_t *tstg)
+{
+    int32 t;
+
+    if (tstg->workers == NULL)
+        return;
+    tstg->job = TST_JOB_EXIT;
+    for (t = 1; t < tstg->n_thread; ++t) {
+        tst_worker_t *w = &tstg->workers[t];
+        sbevent_signal(w->start);
+        sbthread_free(w->thr);
+        sbevent_free(w->start);
+        sbevent_free(w->done);
+    }
+    ckd_free(tstg->workers);
+    tstg->workers = NULL;
+    tstg->n_thread = 0;
+}
+
 int
 srch_TST_init(kb_t * kb, void *srch)
 {
@@ -291,6 +551,8 @@ srch_TST_init(kb_t * kb, void *srch)
     tstg->epl = cmd_ln_int32_r(kbcore_config(kbc), "-epl");
     tstg->n_lextree = cmd_ln_int32_r(kbcore_config(kbc), "-Nlextree");
     tstg->isLMLA = cmd_ln_int32_r(kbcore_config(kbc), "-treeugprob");
+    tstg->ugtree_budget =
+        (size_t) cmd_ln_int32_r(kbcore_config(kbc), "-lextreemem") << 20;
 
     /* CHECK: make sure the number of lexical tree is at least one. */
 
@@ -315,48 +577,29 @@ srch_TST_init(kb_t * kb, void *srch)
     tstg->curugtree =
         (lextree_t **) ckd_calloc(n_ltree, sizeof(lextree_t *));
 
-    /* Just allocate pointers */
+    tstg->ugtree_mem =
+        (size_t *) ckd_calloc(kbc->lmset->n_lm, sizeof(size_t));
+    tstg->ugtree_used =
+        (int32 *) ckd_calloc(kbc->lmset->n_lm, sizeof(int32));
 
+    /* With a memory budget, the trees of the other LMs are only
+       built when they are first switched to. */
     ptmr_reset(&(tm_build));
     for (i = 0; i < kbc->lmset->n_lm; i++) {
-        for (j = 0; j < n_ltree; j++) {
-            /*     ptmr_reset(&(tm_build)); */
-            ptmr_start(&tm_build);
-
-            tstg->ugtree[i * n_ltree + j] =
-                lextree_init(kbc, kbc->lmset->lmarray[i],
-                             lmset_idx_to_name(kbc->lmset, i),
-                             tstg->isLMLA, REPORT_SRCH_TST,
-                             LEXTREE_TYPE_UNIGRAM);
-
-            ptmr_stop(&tm_build);
-
-            /* Just report the lexical tree parameters for the first tree */
-            lextree_report(tstg->ugtree[0]);
-
-            if (tstg->ugtree[i * n_ltree + j] == NULL) {
-                E_INFO
-                    ("Fail to allocate lexical tree for lm %d and lextree %d\n",
-                     i, j);
-                return SRCH_FAILURE;
-            }
-
-            if (REPORT_SRCH_TST) {
-                E_INFO
-                    ("Lextrees (%d) for lm %d, its name is %s, it has %d nodes(ug)\n",
-                     j, i, lmset_idx_to_name(kbc->lmset, i),
-                     lextree_n_node(tstg->ugtree[i * n_ltree + j]));
-            }
-        }
+        if (tstg->ugtree_budget && i != kbc->lmset->cur_lm_idx)
+            continue;
+        if (srch_TST_build_ugtree(tstg, kbc, i, &tm_build) != SRCH_SUCCESS)
+            return SRCH_FAILURE;
     }
     E_INFO("Time for building trees, %4.4f CPU %4.4f Clk\n",
            tm_build.t_cpu, tm_build.t_elapsed);
 
 
 
-    /* By default, curugtree will be pointed to the first sets of tree */
+    /* By default, curugtree will be pointed to the trees of the current LM */
     for (j = 0; j < n_ltree; j++)
-        tstg->curugtree[j] = tstg->ugtree[j];
+        tstg->curugtree[j] =
+            tstg->ugtree[kbc->lmset->cur_lm_idx * n_ltree + j];
 
 
     /* STRUCTURE: Create filler lextrees */
@@ -378,6 +621,8 @@ srch_TST_init(kb_t * kb, void *srch)
 
     if (cmd_ln_int32_r(kbcore_config(kbc), "-lextreedump")) {
         for (i = 0; i < kbc->lmset->n_lm; i++) {
+            if (tstg->ugtree[i * n_ltree] == NULL)
+                continue;
             for (j = 0; j < n_ltree; j++) {
                 E_INFO("LM %d name %s UGTREE %d\n", i,
                         lmset_idx_to_name(kbc->lmset, i), j);
@@ -413,6 +658,9 @@ srch_TST_init(kb_t * kb, void *srch)
 
     tstg->lmset = kbc->lmset;
 
+    srch_TST_start_workers(tstg,
+                           cmd_ln_int32_r(kbcore_config(kbc), "-srchthreads"));
+
     return SRCH_SUCCESS;
 
 }
@@ -430,14 +678,16 @@ srch_TST_uninit(void *srch)
 
     tstg = (srch_TST_graph_t *) s->grh->graph_struct;
 
-    for (i = 0; i < kbc->lmset->n_lm; i++) {
-        for (j = 0; j < tstg->n_lextree; j++) {
-            lextree_free(tstg->ugtree[i * tstg->n_lextree + j]);
-            lextree_free(tstg->fillertree[i * tstg->n_lextree + j]);
-        }
-    }
+    srch_TST_stop_workers(tstg);
+
+    for (i = 0; i < kbc->lmset->n_lm; i++)
+        srch_TST_free_ugtree(tstg, i);
+    for (j = 0; j < tstg->n_lextree; j++)
+        lextree_free(tstg->fillertree[j]);
 
     ckd_free(tstg->ugtree);
+    ckd_free(tstg->ugtree_mem);
+    ckd_free(tstg->ugtree_used);
     ckd_free(tstg->curugtree);
     ckd_free(tstg->fillertree);
 
@@ -559,8 +809,8 @@ srch_TST_add_lm(void *srch, lm_t * lm, const char *lmname)
     srch_TST_graph_t *tstg;
     kbcore_t *kbc;
     int32 n_ltree;
-    int32 j;
     int32 idx;
+    ptmr_t tm_build;
 
     s = (srch_t *) srch;
     tstg = (srch_TST_graph_t *) s->grh->graph_struct;
@@ -579,33 +829,24 @@ srch_TST_add_lm(void *srch, lm_t * lm, const char *lmname)
         (lextree_t **) ckd_realloc(tstg->ugtree,
                                    (lms->n_lm * n_ltree) *
                                    sizeof(lextree_t *));
+    tstg->ugtree_mem =
+        (size_t *) ckd_realloc(tstg->ugtree_mem,
+                               lms->n_lm * sizeof(size_t));
+    tstg->ugtree_used =
+        (int32 *) ckd_realloc(tstg->ugtree_used,
+                              lms->n_lm * sizeof(int32));
 
     idx = lms->n_lm - 1;
-    for (j = 0; j < n_ltree; j++) {
-        tstg->ugtree[(idx) * n_ltree + j] = lextree_init(kbc,
-                                                         lms->lmarray[idx],
-                                                         lmset_idx_to_name
-                                                         (lms, idx),
-                                                         tstg->isLMLA,
-                                                         REPORT_SRCH_TST,
-                                                         LEXTREE_TYPE_UNIGRAM);
-
-        if (tstg->ugtree[idx * n_ltree + j] == NULL) {
-            E_INFO
-                ("Fail to allocate lexical tree for lm %d and lextree %d\n",
-                 idx, j);
-            return SRCH_FAILURE;
-        }
+    memset(tstg->ugtree + idx * n_ltree, 0, n_ltree * sizeof(lextree_t *));
+    tstg->ugtree_mem[idx] = 0;
+    tstg->ugtree_used[idx] = 0;
 
-        if (REPORT_SRCH_TST) {
-            E_INFO
-                ("Lextrees (%d) for lm %d, its name is %s, it has %d nodes(ug)\n",
-                 j, idx, lmset_idx_to_name(kbc->lmset, idx),
-                 lextree_n_node(tstg->ugtree[idx * n_ltree + j]));
-        }
-    }
+    /* With a memory budget, wait until the LM is switched to. */
+    if (tstg->ugtree_budget)
+        return SRCH_SUCCESS;
 
-    return SRCH_SUCCESS;
+    ptmr_init(&tm_build);
+    return srch_TST_build_ugtree(tstg, kbc, idx, &tm_build);
 }
 
 int
@@ -628,18 +869,22 @@ srch_TST_delete_lm(void *srch, const char *lmname)
     /* Get the index of a the lm name */
     lmidx = lmset_name_to_idx(lms, lmname);
 
-    /* Free the n_ltree copies of tree */
-    for (j = 0; j < n_ltree; j++) {
-        lextree_free(tstg->curugtree[lmidx * n_ltree + j]);
-        tstg->curugtree[lmidx * n_ltree + j] = NULL;
+    if (lmidx == LM_NOT_FOUND) {
+        E_ERROR("LM name %s cannot be found\n", lmname);
+        return SRCH_FAILURE;
     }
 
+    /* Free the n_ltree copies of tree */
+    srch_TST_free_ugtree(tstg, lmidx);
+
     /* Shift the pointer by one in the trees */
-    for (i = lmidx; i < kbc->lmset->n_lm; i++) {
+    for (i = lmidx; i < kbc->lmset->n_lm - 1; i++) {
         for (j = 0; j < n_ltree; j++) {
-            tstg->curugtree[i * n_ltree + j] =
-                tstg->curugtree[(i + 1) * n_ltree + j];
+            tstg->ugtree[i * n_ltree + j] =
+                tstg->ugtree[(i + 1) * n_ltree + j];
         }
+        tstg->ugtree_mem[i] = tstg->ugtree_mem[i + 1];
+        tstg->ugtree_used[i] = tstg->ugtree_used[i + 1];
     }
     /* Tree is handled, now also handled the lmset */
 
@@ -657,9 +902,10 @@ srch_TST_set_lm(void *srch, const char *lmname)
     lm_t *lm;
     kbcore_t *kbc = NULL;
     int j;
-    int idx;
+    int idx, prev;
     srch_t *s;
     srch_TST_graph_t *tstg;
+    ptmr_t tm_build;
 
     /*  s3wid_t dictid; */
 
@@ -668,12 +914,6 @@ srch_TST_set_lm(void *srch, const char *lmname)
     kbc = s->kbc;
     lms = kbc->lmset;
 
-    kbc->lmset->cur_lm = NULL;
-
-    for (j = 0; j < tstg->n_lextree; j++) {
-        tstg->curugtree[j] = NULL;
-    }
-
     assert(lms != NULL);
     assert(lms->lmarray != NULL);
     assert(lmname != NULL);
@@ -691,6 +931,26 @@ srch_TST_set_lm(void *srch, const char *lmname)
         return SRCH_SUCCESS;
     }
 
+    /* The trees of the LM being left have grown with the right
+       contexts seen so far; note what they take up now. */
+    prev = lms->cur_lm_idx;
+    if (tstg->ugtree_budget && lms->cur_lm == lms->lmarray[prev]) {
+        tstg->ugtree_mem[prev] = 0;
+        for (j = 0; j < tstg->n_lextree; j++)
+            tstg->ugtree_mem[prev] +=
+                lextree_mem_size(tstg->ugtree[prev * tstg->n_lextree + j]);
+    }
+
+    if (tstg->ugtree[idx * tstg->n_lextree] == NULL) {
+        ptmr_init(&tm_build);
+        if (srch_TST_build_ugtree(tstg, kbc, idx, &tm_build) != SRCH_SUCCESS)
+            return SRCH_FAILURE;
+        E_INFO("Time for building trees, %4.4f CPU %4.4f Clk\n",
+               tm_build.t_cpu, tm_build.t_elapsed);
+    }
+    tstg->ugtree_used[idx] = ++tstg->ugtree_clock;
+    srch_TST_trim_ugtree(tstg, lms, idx);
+
     lmset_set_curlm_widx(lms, idx);
 
     for (j = 0; j < tstg->n_lextree; j++) {
@@ -829,15 +1089,23 @@ srch_TST_hmm_compute_lv2(void *srch, int32 frmno)
     bestwordscr = MAX_NEG_INT32;
     frm_nhmm = 0;
 
-    for (i = 0; i < (n_ltree << 1); i++) {
-        lextree =
-            (i <
-             n_ltree) ? tstg->curugtree[i] : tstg->fillertree[i - n_ltree];
-        if (s->hmmdumpfp != NULL)
-            fprintf(s->hmmdumpfp, "Fr %d Lextree %d #HMM %d\n", frmno, i,
-                    lextree->n_active);
-        lextree_hmm_eval(lextree, kbcore, ascr, frmno, s->hmmdumpfp);
+    /* Trees are independent until their word exits are propagated,
+       so they may be spread over the search threads.  Dumps are
+       written in tree order, though. */
+    if (s->hmmdumpfp == NULL && tstg->n_thread > 1)
+        srch_TST_run(tstg, s, TST_JOB_EVAL, frmno);
+    else {
+        for (i = 0; i < (n_ltree << 1); i++) {
+            lextree = srch_TST_tree(tstg, i);
+            if (s->hmmdumpfp != NULL)
+                fprintf(s->hmmdumpfp, "Fr %d Lextree %d #HMM %d\n", frmno,
+                        i, lextree->n_active);
+            lextree_hmm_eval(lextree, kbcore, ascr, frmno, s->hmmdumpfp);
+        }
+    }
 
+    for (i = 0; i < (n_ltree << 1); i++) {
+        lextree = srch_TST_tree(tstg, i);
         if (besthmmscr < lextree->best)
             besthmmscr = lextree->best;
         if (bestwordscr < lextree->wbest)
@@ -928,7 +1196,7 @@ srch_TST_propagate_graph_ph_lv2(void *srch, int32 frmno)
     srch_TST_graph_t *tstg;
     int32 n_ltree;              /* Local version of number of lexical trees used */
     int32 ptranskip;            /* intervals at which wbeam is used for phone transitions, don't expect it to change */
-    int32 pheurtype;            /* Local version of pheurtype, don't expect it to change */
+    int32 pth;                  /* Phone transition threshold in this frame */
 
     lextree_t *lextree;
     kbcore_t *kbcore;
@@ -938,69 +1206,41 @@ srch_TST_propagate_graph_ph_lv2(void *srch, int32 frmno)
     tstg = (srch_TST_graph_t *) s->grh->graph_struct;
     kbcore = s->kbc;
     pl = s->pl;
-    pheurtype = pl->pheurtype;
 
     n_ltree = tstg->n_lextree;
     ptranskip = s->beam->ptranskip;
 
-    /*  This stupid is the legacy when we try to make the intel compiler happy. */
-    if (ptranskip == 0) {
-        for (i = 0; i < (n_ltree << 1); i++) {
-            lextree =
-                (i <
-                 n_ltree) ? tstg->curugtree[i] : tstg->fillertree[i -
-                                                                  tstg->
-                                                                  n_lextree];
+    /* Every ptranskip frames, phone transitions use the word beam. */
+    if (ptranskip == 0 || (frmno % ptranskip) != 0)
+        pth = s->beam->phone_thres;
+    else
+        pth = s->beam->word_thres;
 
-            if (lextree_hmm_propagate_non_leaves(lextree, kbcore, frmno,
-                                                 s->beam->thres,
-                                                 s->beam->phone_thres,
+    if (tstg->n_thread > 1) {
+        tstg->job_pth = pth;
+        i = srch_TST_run(tstg, s, TST_JOB_PROPAGATE, frmno);
+    }
+    else {
+        for (i = 0; i < (n_ltree << 1); i++) {
+            if (lextree_hmm_propagate_non_leaves(srch_TST_tree(tstg, i),
+                                                 kbcore, frmno,
+                                                 s->beam->thres, pth,
                                                  s->beam->word_thres,
                                                  pl) !=
-                LEXTREE_OPERATION_SUCCESS) {
-                E_ERROR
-                    ("Propagation Failed for lextree_hmm_propagate_non_leave at tree %d\n",
-                     i);
-                lextree_utt_end(lextree, kbcore);
-                return SRCH_FAILURE;
-            }
-
+                LEXTREE_OPERATION_SUCCESS)
+                break;
         }
+        if (i == (n_ltree << 1))
+            i = -1;
     }
-    else {
-        for (i = 0; i < (n_ltree << 1); i++) {
-            lextree =
-                (i <
-                 n_ltree) ? tstg->curugtree[i] : tstg->fillertree[i -
-                                                                  n_ltree];
-
-            if ((frmno % ptranskip) != 0) {
-                if (lextree_hmm_propagate_non_leaves
-                    (lextree, kbcore, frmno, s->beam->thres,
-                     s->beam->phone_thres, s->beam->word_thres,
-                     pl) != LEXTREE_OPERATION_SUCCESS) {
-                    E_ERROR
-                        ("Propagation Failed for lextree_hmm_propagate_non_leave at tree %d\n",
-                         i);
-                    lextree_utt_end(lextree, kbcore);
-                    return SRCH_FAILURE;
-                }
-
-            }
-            else {
 
-                if (lextree_hmm_propagate_non_leaves
-                    (lextree, kbcore, frmno, s->beam->thres,
-                     s->beam->word_thres, s->beam->word_thres,
-                     pl) != LEXTREE_OPERATION_SUCCESS) {
-                    E_ERROR
-                        ("Propagation Failed for lextree_hmm_propagate_non_leave at tree %d\n",
-                         i);
-                    lextree_utt_end(lextree, kbcore);
-                    return SRCH_FAILURE;
-                }
-            }
-        }
+    if (i >= 0) {
+        lextree = srch_TST_tree(tstg, i);
+        E_ERROR
+            ("Propagation Failed for lextree_hmm_propagate_non_leave at tree %d\n",
+             i);
+        lextree_utt_end(lextree, kbcore);
+        return SRCH_FAILURE;
     }
 
     return SRCH_SUCCESS;
@@ -205,67 +205,6 @@ vithist_init(kbcore_t * kbc, int32 wbeam, int32 bghist, int32 report)
     return vh;
 }
 
-/**
-   This function cleans up rc_info
- */
-static void
-clean_up_rc_info(backpointer_t * rc_info, int32 n_rc_info)
-{
-    int32 i;
-    for (i = 0; i < n_rc_info; i++) {
-        rc_info[i].score = S3_LOGPROB_ZERO;
-        rc_info[i].pred = -1;
-    }
-}
-
-/**
-   Copy vithist entry from the source vb to to destination va without
-   copying rc_info. This is a specific function and please don't use
-   it for copying if you haven't traced it.
- */
-static void
-vithist_entry_dirty_cp(vithist_entry_t * va, vithist_entry_t * vb,
-                       int32 n_rc_info)
-{
-    backpointer_t *tmpshp;
-    assert(vb->rc == NULL);
-
-    tmpshp = va->rc;
-    /* Do a direct copy */
-    *va = *vb;
-    va->rc = tmpshp;
-    va->n_rc = n_rc_info;
-}
-
-/**
-   Whole thing copying. 
- */
-
-static void
-vithist_entry_cp(vithist_entry_t * va, vithist_entry_t * vb)
-{
-    int i;
-    /* Do a direct copy */
-    va->wid = vb->wid;
-    va->sf = vb->sf;
-    va->ef = vb->ef;
-    va->ascr = vb->ascr;
-    va->lscr = vb->lscr;
-    va->path.score = vb->path.score;
-    va->path.pred = vb->path.pred;
-    va->type = vb->type;
-    va->valid = vb->valid;
-    va->lmstate.lm3g.lwid[0] = vb->lmstate.lm3g.lwid[0];
-    va->lmstate.lm3g.lwid[1] = vb->lmstate.lm3g.lwid[1];
-    va->n_rc = vb->n_rc;
-
-    if (va->rc) {
-        for (i = 0; i < vb->n_rc; i++)
-            va->rc[i] = vb->rc[i];
-    }
-}
-
-
 /*
  * Allocate a new entry at vh->n_entry if one doesn't exist and return ptr to it.
  */
@@ -392,93 +331,35 @@ vithist_lmstate_enter(vithist_t * vh, int32 vhid, vithist_entry_t * ve)
 }
 
 
-/* Rclist is separate from tve because C structure copying is used in *ve = *tve 
+/*
+ * Entries only keep the best exit over all right contexts; comp_rc is
+ * accepted for the callers' sake but not recorded.
  */
 void
 vithist_enter(vithist_t * vh,              /**< The history table */
               kbcore_t * kbc,              /**< a KB core */
               vithist_entry_t * tve,       /**< an input vithist element */
-              int32 comp_rc                /**< a compressed rc. If it is the actual rc, it won't work. */
+              int32 comp_rc                /**< a compressed rc (not recorded) */
     )
 {
     vithist_entry_t *ve;
     int32 vhid;
-    int32 n_ci;
-    dict_t *d;
-    int32 n_rc_info;
-    int32 old_n_rc_info;
 
-    d = kbc->dict;
-    n_ci = vh->n_ci;
     /* Check if an entry with this LM state already exists in current frame */
     vhid = vh_lmstate_find(vh, &(tve->lmstate));
-    n_rc_info = 0;          /* Just fill in something if not using crossword triphon */
-
-
-    assert(comp_rc < n_rc_info);
 
     if (vhid < 0) {             /* Not found; allocate new entry */
         vhid = vh->n_entry;
         ve = vithist_entry_alloc(vh);
 
-        vithist_entry_dirty_cp(ve, tve, n_rc_info);
+        *ve = *tve;
         vithist_lmstate_enter(vh, vhid, ve);    /* Enter new vithist info into LM state tree */
-
-        /*      E_INFO("Start a new entry wid %d\n",ve->wid); */
-        if (ve->rc != NULL)
-            clean_up_rc_info(ve->rc, ve->n_rc);
-
-        if (comp_rc != -1) {
-            if (ve->rc == NULL) {
-                ve->n_rc =
-                    get_rc_nssid(kbc->dict2pid, ve->wid, kbc->dict);
-                /* Always allocate n_ci for rc_info */
-                ve->rc = ckd_calloc(vh->n_ci, sizeof(*ve->rc));
-                clean_up_rc_info(ve->rc, ve->n_rc);
-            }
-
-            assert(comp_rc < ve->n_rc);
-            if (ve->rc[comp_rc].score < tve->path.score) {
-                ve->rc[comp_rc].score = tve->path.score;
-                ve->rc[comp_rc].pred = tve->path.pred;
-            }
-        }
-
-
     }
     else {
+        /* Replace the old entry if this one is better */
         ve = vithist_id2entry(vh, vhid);
-
-        /*      E_INFO("Replace the old entry\n"); */
-        /*              E_INFO("Old entry wid %d, New entry wid %d\n",ve->wid, tve->wid); */
-
-        if (comp_rc == -1) {
-            if (ve->path.score < tve->path.score) {
-                vithist_entry_dirty_cp(ve, tve, n_rc_info);
-                assert(comp_rc < n_rc_info);
-                if (ve->rc != NULL)
-                    clean_up_rc_info(ve->rc, ve->n_rc);
-            }
-
-        }
-        else {
-
-            /* This is wrong, the score 
-               Alright, how vhid was searched in the first place? 
-             */
-            if (ve->path.score < tve->path.score) {
-                old_n_rc_info = ve->n_rc;
-                vithist_entry_dirty_cp(ve, tve, n_rc_info);
-                assert(comp_rc < n_rc_info);
-
-                assert(ve->rc);
-                clean_up_rc_info(ve->rc, ve->n_rc);
-                ve->rc[comp_rc].score = tve->path.score;
-                ve->rc[comp_rc].pred = tve->path.pred;
-            }
-
-        }
-
+        if (ve->path.score < tve->path.score)
+            *ve = *tve;
     }
 
     /* Update best exit score in this frame */
@@ -520,8 +401,6 @@ vithist_rescore(vithist_t * vh, kbcore_t * kbc,
     tve.valid = 1;
     tve.ascr = score - pve->path.score;
     tve.lscr = 0;
-    tve.rc = NULL;
-    tve.n_rc = 0;
 
     if (pred == 0) {            /* Special case for the initial <s> entry */
         se = 0;
@@ -583,10 +462,7 @@ vithist_frame_gc(vithist_t * vh, int32 frm)
     vithist_entry_t *ve, *tve;
     int32 se, fe, te, bs, bv;
     int32 i, j;
-    int32 l;
-    int32 n_rc_info;
 
-    n_rc_info = 0;
     se = vh->frame_start[frm];
     fe = vh->n_entry - 1;
     te = se;
@@ -601,8 +477,7 @@ vithist_frame_gc(vithist_t * vh, int32 frm)
             E_DEBUG("Valid entry %d score %d\n", i, ve->path.score);
             if (i != te) {      /* Move i to te */
                 tve = vithist_id2entry(vh, te);
-                /**tve = *ve;*/
-                vithist_entry_cp(tve, ve);
+                *tve = *ve;
             }
 
             if (ve->path.score > bs) {
@@ -628,15 +503,6 @@ vithist_frame_gc(vithist_t * vh, int32 frm)
     i = VITHIST_ID2BLK(vh->n_entry - 1);
     j = VITHIST_ID2BLK(te - 1);
     for (; i > j; --i) {
-
-        for (l = 0; l < VITHIST_BLKSIZE; l++) {
-            ve = vh->entry[i] + l;
-            if (ve->rc != NULL) {
-                ckd_free(ve->rc);
-                ve->rc = NULL;
-            }
-        }
-
         ckd_free((void *) vh->entry[i]);
         vh->entry[i] = NULL;
     }
@@ -917,17 +783,10 @@ void
 vithist_utt_reset(vithist_t * vh)
 {
     int32 b;
-    int32 ent;
 
     vithist_lmstate_reset(vh);
 
     for (b = VITHIST_ID2BLK(vh->n_entry - 1); b >= 0; --b) {
-
-        /* If rc_info is used, then free them */
-        if (b != 0)
-            ent = VITHIST_BLKSIZE - 1;
-        else
-            ent = vh->n_entry - 1;
         ckd_free((void *) vh->entry[b]);
         vh->entry[b] = NULL;
     }
@@ -79,23 +79,81 @@
  *
  */
 
+#include <string.h>
+
 #include <whmm.h>
 
+whmm_pool_t *
+whmm_pool_init(void)
+{
+    return ckd_calloc(1, sizeof(whmm_pool_t));
+}
+
+static void
+whmm_list_free(whmm_t * h)
+{
+    whmm_t *nexth;
+
+    for (; h; h = nexth) {
+        nexth = h->next;
+        hmm_deinit((hmm_t *)h);
+        ckd_free(h);
+    }
+}
+
+void
+whmm_pool_free(whmm_pool_t * pool)
+{
+    if (pool == NULL)
+        return;
+    whmm_list_free(pool->free_mpx);
+    whmm_list_free(pool->free_nonmpx);
+    ckd_free(pool);
+}
+
 void
-whmm_free(whmm_t * h)
+whmm_free(whmm_pool_t * pool, whmm_t * h)
 {
-    hmm_deinit((hmm_t *)h);
-    ckd_free(h);
+    if (hmm_is_mpx(h)) {
+        h->next = pool->free_mpx;
+        pool->free_mpx = h;
+    }
+    else {
+        h->next = pool->free_nonmpx;
+        pool->free_nonmpx = h;
+    }
 }
 
 
 whmm_t *
-whmm_alloc(hmm_context_t *ctx, int32 pos, int mpx, s3ssid_t ssid, s3tmatid_t tmatid)
+whmm_alloc(whmm_pool_t * pool, hmm_context_t *ctx, int32 pos, int mpx,
+           s3ssid_t ssid, s3tmatid_t tmatid)
 {
     whmm_t *h;
+    whmm_t **freelist;
 
-    h = ckd_calloc(1, sizeof(*h));
-    hmm_init(ctx, (hmm_t *)h, mpx, ssid, tmatid);
+    freelist = mpx ? &pool->free_mpx : &pool->free_nonmpx;
+    if ((h = *freelist) != NULL
+        && hmm_n_emit_state(h) == ctx->n_emit_state) {
+        /* Reset it as hmm_init() would, keeping the ssid array. */
+        *freelist = h->next;
+        h->hmm.ctx = ctx;
+        if (mpx) {
+            memset(h->hmm.s.mpx_ssid, -1,
+                   hmm_n_emit_state(h) * sizeof(*h->hmm.s.mpx_ssid));
+            h->hmm.s.mpx_ssid[0] = ssid;
+        }
+        else
+            h->hmm.s.ssid = ssid;
+        h->hmm.tmatid = tmatid;
+        hmm_clear((hmm_t *)h);
+        h->rc = h->lc = 0;
+        h->next = NULL;
+    }
+    else {
+        h = ckd_calloc(1, sizeof(*h));
+        hmm_init(ctx, (hmm_t *)h, mpx, ssid, tmatid);
+    }
     h->pos = pos;
     return h;
 }
@@ -44,6 +44,7 @@
 #include <sphinxbase/pio.h>
 #include <sphinxbase/feat.h>
 #include <sphinxbase/filename.h>
+#include <sphinxbase/strfuncs.h>
 #include <sphinxbase/cmd_ln.h>
 #include <sphinxbase/agc.h>
 #include <sphinxbase/cmn.h>
@@ -142,6 +143,10 @@ static arg_t defn[] = {
      ARG_INT32,
      "1",
      "Whether to insert optional silences and fillers between words."},
+    {"-nthreads",
+     ARG_INT32,
+     "1",
+     "No. of threads aligning utterances at once, sharing the models (each keeps its own live CMN/AGC estimates)"},
     fast_GMM_computation_command_line_macro(),
     {NULL, ARG_INT32, NULL, NULL}
 };
@@ -159,8 +164,6 @@ static adapt_am_t *adapt_am;    /* An adaptation structure. */
  */
 static dict_t *dict;
 
-static float32 ***feat = NULL;  /* Speech feature data */
-
 static int32 ctloffset;
 
 static const char *outsentfile;
@@ -180,29 +183,63 @@ static char *wdsegdir = NULL;
 
 /* For profiling/timing */
 enum { tmr_utt, tmr_gauden, tmr_senone, tmr_align };
-ptmr_t timers[5];
 
-static int32 tot_nfr;
-static ptmr_t tm_utt;
-static ptmr_t tm_ovrhd;
+/*
+ * What each thread needs of its own to align utterances.  Only
+ * multi-stream (.s3cont., .semi., .ptm.) models can be shared, so the
+ * others are only ever evaluated by the main worker.
+ */
+typedef struct align_worker_s {
+    align_t *al;                /* Its aligner */
+    ascr_t *ascr;               /* Senone scores */
+    feat_t *fcb;                /* Feature computation, which keeps CMN/AGC state */
+    float32 ***feat;            /* Speech feature data */
+    fe_t *fe;                   /* Waveform data handling ('-adcin') */
+    ms_mgau_model_t *ms_mgau;   /* Multi-stream models, or NULL */
+    int32 copy;                 /* Whether the above are its own copies */
+    ptmr_t timers[5];
+    ptmr_t tm_utt;
+    ptmr_t tm_ovrhd;
+    int32 tot_nfr;
+} align_worker_t;
+
+static align_worker_t main_worker;      /* Works with the models themselves */
+
+
+static feat_t *
+align_feat_init(cmd_ln_t *config)
+{
+    return feat_init(cmd_ln_str_r(config, "-feat"),
+                     cmn_type_from_str(cmd_ln_str_r(config, "-cmn")),
+                     cmd_ln_boolean_r(config, "-varnorm"),
+                     agc_type_from_str(cmd_ln_str_r(config, "-agc")), 1,
+                     cmd_ln_int32_r(config, "-ceplen"));
+}
+
+static ascr_t *
+align_ascr_init(void)
+{
+    int32 cisencnt;
+
+    for (cisencnt = 0; cisencnt == kbc->mdef->cd2cisen[cisencnt];
+         cisencnt++);
 
+    return ascr_init(kbc->mdef->n_sen, 0,       /* No composite senone */
+                     mdef_n_sseq(kbc->mdef), 0, /* No composite senone sequence */
+                     1,         /* Phoneme lookahead window =1. Not enabled phoneme lookahead at this moment */
+                     cisencnt);
+}
 
 static void
 models_init(cmd_ln_t *config)
 {
-    int32 cisencnt;
-
     kbc = New_kbcore(config);
 
     kbc->logmath = logs3_init(cmd_ln_float64_r(config, "-logbase"), 1,
                               cmd_ln_int32_r(config, "-log3table"));
 
     /* Initialize feaure stream type */
-    kbc->fcb = feat_init(cmd_ln_str_r(config, "-feat"),
-			 cmn_type_from_str(cmd_ln_str_r(config, "-cmn")),
-			 cmd_ln_boolean_r(config, "-varnorm"),
-			 agc_type_from_str(cmd_ln_str_r(config, "-agc")), 1,
-			 cmd_ln_int32_r(config, "-ceplen"));
+    kbc->fcb = align_feat_init(config);
 
     s3_am_init(kbc);
 
@@ -226,16 +263,7 @@ models_init(cmd_ln_t *config)
 		     FALSE,
 		     TRUE);
 
-
-
-
-    for (cisencnt = 0; cisencnt == kbc->mdef->cd2cisen[cisencnt];
-         cisencnt++);
-
-    ascr = ascr_init(kbc->mdef->n_sen, 0,       /* No composite senone */
-                     mdef_n_sseq(kbc->mdef), 0, /* No composite senone sequence */
-                     1,         /* Phoneme lookahead window =1. Not enabled phoneme lookahead at this moment */
-                     cisencnt);
+    ascr = align_ascr_init();
 
     fastgmm = fast_gmm_init(cmd_ln_int32_r(config, "-ds"),
                             cmd_ln_int32_r(config, "-cond_ds"),
@@ -266,6 +294,66 @@ static void models_free(void)
 }
 
 
+/*
+ * Set up a worker, with the models themselves if it is the main one,
+ * otherwise with copies of whatever cannot be shared between threads.
+ */
+static void
+worker_init(align_worker_t * w, cmd_ln_t * config, int32 copy)
+{
+    memset(w, 0, sizeof(*w));
+    w->copy = copy;
+    if (copy) {
+        char const *fn;
+
+        /* As s3_am_init() does for kbc->fcb. */
+        w->fcb = align_feat_init(config);
+        if ((fn = cmd_ln_str_r(config, "-lda"))
+            && feat_read_lda(w->fcb, fn,
+                             cmd_ln_int32_r(config, "-ldadim")) < 0)
+            E_FATAL("LDA initialization failed.\n");
+        if (cmd_ln_str_r(config, "-svspec")) {
+            int32 **subvecs;
+
+            if ((subvecs = parse_subvecs(cmd_ln_str_r(config, "-svspec")))
+                == NULL || feat_set_subvecs(w->fcb, subvecs) < 0)
+                E_FATAL("Failed to set subvector specification.\n");
+        }
+        w->ascr = align_ascr_init();
+        if (fe && (w->fe = fe_clone(fe)) == NULL)
+            E_FATAL("fe_clone() failed\n");
+        w->ms_mgau = ms_mgau_share(kbc->ms_mgau);
+    }
+    else {
+        w->fcb = kbcore_fcb(kbc);
+        w->ascr = ascr;
+        w->fe = fe;
+        w->ms_mgau = kbc->ms_mgau;
+    }
+    w->feat = feat_array_alloc(w->fcb, S3_MAX_FRAMES);
+    w->al = align_init(kbc->mdef, kbc->tmat, dict, config, kbc->logmath);
+
+    w->timers[tmr_utt].name = "U";
+    w->timers[tmr_gauden].name = "G";
+    w->timers[tmr_senone].name = "S";
+    w->timers[tmr_align].name = "A";
+}
+
+static void
+worker_free(align_worker_t * w)
+{
+    align_free(w->al);
+    feat_array_free(w->feat);
+    if (w->copy) {
+        ms_mgau_share_free(w->ms_mgau);
+        if (w->fe)
+            fe_free(w->fe);
+        ascr_free(w->ascr);
+        feat_free(w->fcb);
+    }
+}
+
+
 /*
  * Build a filename int buf as follows (without file extension):
  *     if dir ends with ,CTLand ctlspec does not begin with /, filename is dir/ctlspec
@@ -319,8 +407,11 @@ write_s2stseg(char *dir, align_stseg_t * stseg, char *uttid, char *ctlspec, int3
     s3cipid_t ci[3];
     word_posn_t wpos;
     int16 s2_info;
-    char buf[8];
-    static int32 byterev = -1;  /* Whether to byte reverse output data */
+#ifdef WORDS_BIGENDIAN
+    int32 byterev = 0;          /* Whether to byte reverse output data */
+#else
+    int32 byterev = 1;
+#endif
 
     build_output_uttfile(filename, dir, uttid, ctlspec);
     strcat(filename, ".v8_seg");        /* .v8_seg for compatibility */
@@ -338,32 +429,6 @@ write_s2stseg(char *dir, align_stseg_t * stseg, char *uttid, char *ctlspec, int3
         return;
     }
 
-    if (byterev < 0) {
-        /* Byte ordering of host machine unknown; first figure it out */
-        k = (int32) BYTE_ORDER_MAGIC;
-        if (fwrite(&k, sizeof(int32), 1, fp) != 1)
-            goto write_error;
-
-        fclose(fp);
-        if ((fp = fopen(filename, "rb")) == NULL) {
-            E_ERROR_SYSTEM("Failed to open file %s for reading", filename);
-            return;
-        }
-        if (fread(buf, 1, sizeof(int32), fp) != sizeof(int32)) {
-            E_ERROR_SYSTEM("Failed to read from the file %s", filename);
-            return;
-        }
-        fclose(fp);
-
-        /* If buf[0] == lsB of BYTE_ORDER_MAGIC, we are little-endian.  Need to byterev */
-        byterev = (buf[0] == (BYTE_ORDER_MAGIC & 0x000000ff)) ? 1 : 0;
-
-        if ((fp = fopen(filename, "wb")) == NULL) {
-            E_ERROR_SYSTEM("Failed to open file %s for writing", filename);
-            return;
-        }
-    }
-
     /* Write #frames */
     for (k = 0, tmp = stseg; tmp; k++, tmp = tmp->next);
     if (byterev)
@@ -484,7 +549,8 @@ write_stseg(char *dir, align_stseg_t * stseg, char *uttid, char *ctlspec)
 
 /* Write phone segmentation output file */
 static void
-write_phseg(char *dir, align_phseg_t * phseg, char *uttid, char *ctlspec)
+write_phseg(char *dir, align_phseg_t * phseg, char *uttid, char *ctlspec,
+            FILE * out)
 {
     char str[1024];
     FILE *fp;
@@ -496,7 +562,7 @@ write_phseg(char *dir, align_phseg_t * phseg, char *uttid, char *ctlspec)
     E_INFO("Writing phone segmentation to: %s\n", str);
     if ((fp = fopen(str, "w")) == NULL) {
         E_ERROR_SYSTEM("Failed to open file %s for writing", str);
-        fp = stdout;            /* Segmentations can be directed to stdout this way */
+        fp = out;               /* Segmentations can be directed to stdout this way */
         E_INFO("Phone segmentation (%s):\n", uttid);
         dir = NULL;             /* Flag to indicate fp shouldn't be closed at the end */
     }
@@ -538,7 +604,8 @@ write_phseg(char *dir, align_phseg_t * phseg, char *uttid, char *ctlspec)
 
 /* Write xlabel style phone segmentation output file */
 static void
-write_phlab(char *dir, align_phseg_t * phseg, char *uttid, char *ctlspec, int32 fps)
+write_phlab(char *dir, align_phseg_t * phseg, char *uttid, char *ctlspec, int32 fps,
+            FILE * out)
 {
     char str[1024];
     FILE *fp;
@@ -549,7 +616,7 @@ write_phlab(char *dir, align_phseg_t * phseg, char *uttid, char *ctlspec, int32
     E_INFO("Writing xlabel style phone labels to: %s\n", str);
     if ((fp = fopen(str, "w")) == NULL) {
         E_ERROR_SYSTEM("Failed to open file %s for writing", str);
-        fp = stdout;            /* Segmentations can be directed to stdout this way */
+        fp = out;               /* Segmentations can be directed to stdout this way */
         E_INFO("Phone segmentation (%s):\n", uttid);
         dir = NULL;             /* Flag to indicate fp shouldn't be closed at the end */
     }
@@ -584,7 +651,8 @@ write_phlab(char *dir, align_phseg_t * phseg, char *uttid, char *ctlspec, int32
 
 /* Write word segmentation output file */
 static void
-write_wdseg(char *dir, align_wdseg_t * wdseg, char *uttid, char *ctlspec)
+write_wdseg(char *dir, align_wdseg_t * wdseg, char *uttid, char *ctlspec,
+            FILE * out)
 {
     char str[1024];
     FILE *fp;
@@ -596,7 +664,7 @@ write_wdseg(char *dir, align_wdseg_t * wdseg, char *uttid, char *ctlspec)
     E_INFO("Writing word segmentation to: %s\n", str);
     if ((fp = fopen(str, "w")) == NULL) {
         E_ERROR_SYSTEM("Failed to open file %s for writing", str);
-        fp = stdout;            /* Segmentations can be directed to stdout this way */
+        fp = out;               /* Segmentations can be directed to stdout this way */
         E_INFO("Word segmentation (%s):\n", uttid);
         dir = NULL;             /* Flag to indicate fp shouldn't be closed at the end */
     }
@@ -662,18 +730,24 @@ write_outctl(FILE * fp, char *uttctl)
  * Find Viterbi alignment.
  */
 static void
-align_utt(char *sent,           /* In: Reference transcript */
+align_utt(align_worker_t * wk,  /* In: Worker to align it with */
+          char *sent,           /* In: Reference transcript */
           int32 nfr,            /* In: #frames of input */
           char *ctlspec,        /* In: Utt specifiction from control file */
-          char *uttid)
-{                               /* In: Utterance id, for logging and other use */
+          char *uttid,          /* In: Utterance id, for logging and other use */
+          FILE * out,           /* In: Stream for the log of the alignment */
+          FILE * sentfp,        /* In: Stream for the exact transcript, or NULL */
+          FILE * ctlfp)         /* In: Stream for the output control entry, or NULL */
+{
     int32 i;
     align_stseg_t *stseg;
     align_phseg_t *phseg;
     align_wdseg_t *wdseg;
+    ascr_t *ascr = wk->ascr;
+    float32 ***feat = wk->feat;
     int32 w;
 
-    w = feat_window_size(kbcore_fcb(kbc));  /* #MFC vectors needed on either side of current
+    w = feat_window_size(wk->fcb);  /* #MFC vectors needed on either side of current
                                    frame to compute one feature vector */
     if (nfr <= (w << 1)) {
         E_ERROR("Utterance %s < %d frames (%d); ignored\n", uttid,
@@ -681,39 +755,41 @@ align_utt(char *sent,           /* In: Reference transcript */
         return;
     }
 
-    ptmr_reset_all(timers);
+    ptmr_reset_all(wk->timers);
 
-    ptmr_reset(&tm_utt);
-    ptmr_start(&tm_utt);
-    ptmr_reset(&tm_ovrhd);
-    ptmr_start(&tm_ovrhd);
-    ptmr_start(timers + tmr_utt);
+    ptmr_reset(&wk->tm_utt);
+    ptmr_start(&wk->tm_utt);
+    ptmr_reset(&wk->tm_ovrhd);
+    ptmr_start(&wk->tm_ovrhd);
+    ptmr_start(wk->timers + tmr_utt);
 
 
-    if (align_build_sent_hmm(sent, cmd_ln_int32_r(kbc->config, "-insert_sil")) != 0) {
-        align_destroy_sent_hmm();
-        ptmr_stop(timers + tmr_utt);
+    /* The sentence HMM is kept for the next utterance, in case it has
+     * the same transcript. */
+    if (align_build_sent_hmm(wk->al, sent, cmd_ln_int32_r(kbc->config, "-insert_sil")) != 0) {
+        align_destroy_sent_hmm(wk->al);
+        ptmr_stop(wk->timers + tmr_utt);
 
         E_ERROR("No sentence HMM; no alignment for %s\n", uttid);
 
         return;
     }
 
-    align_start_utt(uttid);
+    align_start_utt(wk->al, uttid);
 
     for (i = 0; i < nfr; i++) {
-        ptmr_start(timers + tmr_utt);
+        ptmr_start(wk->timers + tmr_utt);
 
         /* Obtain active senone flags */
-        ptmr_start(timers + tmr_gauden);
-        ptmr_start(timers + tmr_senone);
+        ptmr_start(wk->timers + tmr_gauden);
+        ptmr_start(wk->timers + tmr_senone);
 
-        align_sen_active(ascr->sen_active, ascr->n_sen);
+        align_sen_active(wk->al, ascr->sen_active, ascr->n_sen);
 
         /* Bah, there ought to be a function for this. */
-        if (kbc->ms_mgau) {
+        if (wk->ms_mgau) {
             ms_cont_mgau_frame_eval(ascr,
-				    kbc->ms_mgau,
+				    wk->ms_mgau,
 				    kbc->mdef, feat[i], i);
         }
         else if (kbc->s2_mgau) {
@@ -739,26 +815,26 @@ align_utt(char *sent,           /* In: Reference transcript */
 					feat[i][0], i,
 					ascr->
 					cache_ci_senscr[0],
-					&tm_ovrhd,
+					&wk->tm_ovrhd,
 					kbcore_logmath(kbc));
         }
 
-        ptmr_stop(timers + tmr_gauden);
-        ptmr_stop(timers + tmr_senone);
+        ptmr_stop(wk->timers + tmr_gauden);
+        ptmr_stop(wk->timers + tmr_senone);
 
         /* Step alignment one frame forward */
-        ptmr_start(timers + tmr_align);
-        align_frame(ascr->senscr);
-        ptmr_stop(timers + tmr_align);
-        ptmr_stop(timers + tmr_utt);
+        ptmr_start(wk->timers + tmr_align);
+        align_frame(wk->al, ascr->senscr);
+        ptmr_stop(wk->timers + tmr_align);
+        ptmr_stop(wk->timers + tmr_utt);
     }
-    ptmr_stop(&tm_utt);
-    ptmr_stop(&tm_ovrhd);
+    ptmr_stop(&wk->tm_utt);
+    ptmr_stop(&wk->tm_ovrhd);
 
-    printf("\n");
+    fprintf(out, "\n");
 
     /* Wind up alignment for this utterance */
-    if (align_end_utt(&stseg, &phseg, &wdseg) < 0)
+    if (align_end_utt(wk->al, &stseg, &phseg, &wdseg) < 0)
         E_ERROR("Final state not reached; no alignment for %s\n\n", uttid);
     else {
         if (s2stsegdir)
@@ -766,27 +842,25 @@ align_utt(char *sent,           /* In: Reference transcript */
         if (stsegdir)
             write_stseg(stsegdir, stseg, uttid, ctlspec);
         if (phsegdir)
-            write_phseg(phsegdir, phseg, uttid, ctlspec);
+            write_phseg(phsegdir, phseg, uttid, ctlspec, out);
         if (phlabdir)
-            write_phlab(phlabdir, phseg, uttid, ctlspec, cmd_ln_int32_r(kbc->config, "-frate"));
+            write_phlab(phlabdir, phseg, uttid, ctlspec, cmd_ln_int32_r(kbc->config, "-frate"), out);
         if (wdsegdir)
-            write_wdseg(wdsegdir, wdseg, uttid, ctlspec);
-        if (outsentfp)
-            write_outsent(outsentfp, wdseg, uttid);
-        if (outctlfp)
-            write_outctl(outctlfp, ctlspec);
+            write_wdseg(wdsegdir, wdseg, uttid, ctlspec, out);
+        if (sentfp)
+            write_outsent(sentfp, wdseg, uttid);
+        if (ctlfp)
+            write_outctl(ctlfp, ctlspec);
     }
 
-    align_destroy_sent_hmm();
+    ptmr_print_all(out, wk->timers, nfr * 0.1);
 
-    ptmr_print_all(stdout, timers, nfr * 0.1);
+    fprintf(out,
+            "EXECTIME: %5d frames, %7.2f sec CPU, %6.2f xRT; %7.2f sec elapsed, %6.2f xRT\n",
+            nfr, wk->tm_utt.t_cpu, wk->tm_utt.t_cpu * 100.0 / nfr,
+            wk->tm_utt.t_elapsed, wk->tm_utt.t_elapsed * 100.0 / nfr);
 
-    printf
-        ("EXECTIME: %5d frames, %7.2f sec CPU, %6.2f xRT; %7.2f sec elapsed, %6.2f xRT\n",
-         nfr, tm_utt.t_cpu, tm_utt.t_cpu * 100.0 / nfr, tm_utt.t_elapsed,
-         tm_utt.t_elapsed * 100.0 / nfr);
-
-    tot_nfr += nfr;
+    wk->tot_nfr += nfr;
 }
 
 
@@ -809,23 +883,14 @@ id_cmp(char *str1, char *str2)
     }
 }
 
+/* Read the next transcript, and match it with the control file entry. */
 static void
-utt_align(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
+read_sent(char *sent, int32 len, char *uttid)
 {
-    int32 nfr;
     int k, i;
-    const char *cepdir;
-    const char *cepext;
-    char sent[16384];
-    cmd_ln_t *config = (cmd_ln_t*) data;
-
-    cepdir = cmd_ln_str_r(kbc->config, "-cepdir");
-    cepext = cmd_ln_str_r(kbc->config, "-cepext");
-
 
     /* UGLY! */
-    /* Read utterance transcript and match it with the control file. */
-    if (fgets(sent, sizeof(sent), sentfp) == NULL) {
+    if (fgets(sent, len, sentfp) == NULL) {
         E_FATAL("EOF(%s) of the transcription\n", sentfile);
     }
     /*  E_INFO("SENT %s\n",sent); */
@@ -850,6 +915,19 @@ utt_align(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
                      uttid, sent + k);
         }
     }
+}
+
+/* Compute the features of an utterance, returning the no. of frames. */
+static int32
+utt_feat(align_worker_t * wk, cmd_ln_t * config, utt_res_t * ur,
+         int32 sf, int32 ef, char *uttid)
+{
+    int32 nfr;
+    const char *cepdir;
+    const char *cepext;
+
+    cepdir = cmd_ln_str_r(kbc->config, "-cepdir");
+    cepext = cmd_ln_str_r(kbc->config, "-cepext");
 
     /* Convert input file to cepstra if waveform input is selected */
     if (cmd_ln_boolean_r(config, "-adcin")) {
@@ -865,19 +943,19 @@ utt_align(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
     				        &nsamps)) == NULL) {
             E_FATAL("Cannot read file %s\n", ur->uttfile);
         }
-        fe_start_utt(fe);
-        if (fe_process_utt(fe, adcdata, nsamps, &mfcc, &nfr) < 0) {
+        fe_start_utt(wk->fe);
+        if (fe_process_utt(wk->fe, adcdata, nsamps, &mfcc, &nfr) < 0) {
             E_FATAL("MFCC calculation failed\n", ur->uttfile);
         }
         ckd_free(adcdata);
         if (nfr > S3_MAX_FRAMES) {
             E_FATAL("Maximum number of frames (%d) exceeded\n", S3_MAX_FRAMES);
         }
-        if ((nfr = feat_s2mfc2feat_live(kbcore_fcb(kbc),
+        if ((nfr = feat_s2mfc2feat_live(wk->fcb,
 						mfcc,
 						&nfr,
 						TRUE, TRUE,
-						feat)) < 0) {
+						wk->feat)) < 0) {
             E_FATAL("Feature computation failed\n");
         }
         if (mfcc)
@@ -885,21 +963,10 @@ utt_align(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
     }
     else {
         nfr =
-            feat_s2mfc2feat(kbcore_fcb(kbc), ur->uttfile, cepdir, cepext, sf, ef, feat,
+            feat_s2mfc2feat(wk->fcb, ur->uttfile, cepdir, cepext, sf, ef, wk->feat,
                             S3_MAX_FRAMES);
     }
 
-    if (ur->regmatname) {
-        if (kbc->mgau)
-            adapt_set_mllr(adapt_am, kbc->mgau, ur->regmatname,
-                           ur->cb2mllrname, kbc->mdef, kbc->config);
-        else if (kbc->ms_mgau)
-            model_set_mllr(kbc->ms_mgau, ur->regmatname, ur->cb2mllrname,
-                           kbcore_fcb(kbc), kbc->mdef, kbc->config);
-        else
-            E_WARN("Can't use MLLR matrices with .s2semi. yet\n");
-    }
-
     if (nfr <= 0) {
         if (cepdir != NULL) {
             E_ERROR
@@ -912,17 +979,116 @@ utt_align(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
                  uttid, ur->uttfile, cepext);
         }
     }
-    else {
+    else
         E_INFO("%s: %d input frames\n", uttid, nfr);
-        align_utt(sent, nfr, ur->uttfile, uttid);
+
+    return nfr;
+}
+
+static void
+utt_align(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
+{
+    int32 nfr;
+    char sent[16384];
+    cmd_ln_t *config = (cmd_ln_t*) data;
+
+    read_sent(sent, sizeof(sent), uttid);
+
+    if (ur->regmatname) {
+        if (kbc->mgau)
+            adapt_set_mllr(adapt_am, kbc->mgau, ur->regmatname,
+                           ur->cb2mllrname, kbc->mdef, kbc->config);
+        else if (kbc->ms_mgau)
+            model_set_mllr(kbc->ms_mgau, ur->regmatname, ur->cb2mllrname,
+                           kbcore_fcb(kbc), kbc->mdef, kbc->config);
+        else
+            E_WARN("Can't use MLLR matrices with .s2semi. yet\n");
     }
 
+    if ((nfr = utt_feat(&main_worker, config, ur, sf, ef, uttid)) > 0)
+        align_utt(&main_worker, sent, nfr, ur->uttfile, uttid,
+                  stdout, outsentfp, outctlfp);
 }
+
+/* Align an utterance in one of several threads, writing to streams
+ * which are copied out in order. */
+static void
+utt_align_mt(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid,
+             FILE ** out)
+{
+    align_worker_t *wk = (align_worker_t *) data;
+    char *sent = (char *) ur->data;
+    int32 nfr;
+
+    if ((nfr = utt_feat(wk, kbc->config, ur, sf, ef, uttid)) > 0)
+        align_utt(wk, sent, nfr, ur->uttfile, uttid, out[0],
+                  outsentfp ? out[1] : NULL, outctlfp ? out[2] : NULL);
+    ckd_free(sent);
+}
+
+/* Transcripts are read in control file order, as entries are queued. */
+static void
+prefetch_align(void *data, utt_res_t * ur, char *uttid)
+{
+    char sent[16384];
+    char const *cepdir;
+    char *file;
+
+    read_sent(sent, sizeof(sent), uttid);
+    ur->data = ckd_salloc(sent);
+
+    if ((cepdir = cmd_ln_str_r(kbc->config, "-cepdir")) != NULL)
+        file = string_join(cepdir, "/", ur->uttfile,
+                           cmd_ln_str_r(kbc->config, "-cepext"), NULL);
+    else
+        file = string_join(ur->uttfile,
+                           cmd_ln_str_r(kbc->config, "-cepext"), NULL);
+    ctl_prefetch_file(file);
+    ckd_free(file);
+}
+
+/* Align utterances in several threads, returning the elapsed time. */
+static ptmr_t
+process_mt(cmd_ln_t * config, int32 n_thread)
+{
+    align_worker_t *workers;
+    void **wdata;
+    FILE *outfp[3];
+    ptmr_t tm;
+    int32 i;
+
+    workers = ckd_calloc(n_thread, sizeof(*workers));
+    wdata = ckd_calloc(n_thread, sizeof(*wdata));
+    wdata[0] = &main_worker;
+    for (i = 1; i < n_thread; ++i) {
+        worker_init(&workers[i], config, TRUE);
+        wdata[i] = &workers[i];
+    }
+    outfp[0] = stdout;
+    outfp[1] = outsentfp;
+    outfp[2] = outctlfp;
+    tm = ctl_process_mt(cmd_ln_str_r(config, "-ctl"),
+                        NULL,
+                        cmd_ln_int32_r(config, "-ctloffset"),
+                        cmd_ln_int32_r(config, "-ctlcount"),
+                        n_thread, utt_align_mt, wdata,
+                        prefetch_align, NULL, outfp, 3);
+    for (i = 1; i < n_thread; ++i) {
+        main_worker.tot_nfr += workers[i].tot_nfr;
+        worker_free(&workers[i]);
+    }
+    ckd_free(workers);
+    ckd_free(wdata);
+    return tm;
+}
+
 int
 main(int32 argc, char *argv[])
 {
     char sent[16384];
     cmd_ln_t *config;
+    ptmr_t tm_tot;
+    int32 n_thread;
 
     cmd_ln_appl_enter(argc, argv, "default.arg", defn);
 
@@ -985,16 +1151,8 @@ main(int32 argc, char *argv[])
     /* Read in input databases */
     models_init(config);
 
-    if (!feat)
-        feat = feat_array_alloc(kbcore_fcb(kbc), S3_MAX_FRAMES);
-
-    timers[tmr_utt].name = "U";
-    timers[tmr_gauden].name = "G";
-    timers[tmr_senone].name = "S";
-    timers[tmr_align].name = "A";
-
     /* Initialize align module */
-    align_init(kbc->mdef, kbc->tmat, dict, config, kbc->logmath);
+    worker_init(&main_worker, config, FALSE);
     printf("\n");
 
     if (cmd_ln_str_r(config, "-mllr") != NULL) {
@@ -1008,11 +1166,24 @@ main(int32 argc, char *argv[])
             E_WARN("Can't use MLLR matrices with .s2semi. yet\n");
     }
 
-    tot_nfr = 0;
+    n_thread = cmd_ln_int32_r(config, "-nthreads");
+    if (n_thread > 1 && kbc->ms_mgau == NULL) {
+        E_WARN("Only .s3cont., .semi. and .ptm. models can be shared between threads; using one\n");
+        n_thread = 1;
+    }
+    if (n_thread > 1 && cmd_ln_str_r(config, "-ctl_mllr") != NULL) {
+        E_WARN("-ctl_mllr adapts the models shared between threads; using one\n");
+        n_thread = 1;
+    }
 
     /*  process_ctlfile (); */
 
-    if (cmd_ln_str_r(config, "-ctl")) {
+    if (cmd_ln_str_r(config, "-ctl") && n_thread > 1) {
+        tm_tot = process_mt(config, n_thread);
+        main_worker.tm_utt.t_tot_cpu = tm_tot.t_tot_cpu;
+        main_worker.tm_utt.t_tot_elapsed = tm_tot.t_tot_elapsed;
+    }
+    else if (cmd_ln_str_r(config, "-ctl")) {
         /* When -ctlfile is speicified, corpus.c will look at -ctl_mllr to get
            the corresponding  MLLR for the utterance */
         ctl_process(cmd_ln_str_r(config, "-ctl"),
@@ -1026,14 +1197,17 @@ main(int32 argc, char *argv[])
         E_FATAL(" -ctl are not specified.\n");
     }
 
-    if (tot_nfr > 0) {
+    if (main_worker.tot_nfr > 0) {
+        int32 tot_nfr = main_worker.tot_nfr;
+        ptmr_t *tm_utt = &main_worker.tm_utt;
+
         printf("\n");
         printf("TOTAL FRAMES:       %8d\n", tot_nfr);
         printf("TOTAL CPU TIME:     %11.2f sec, %7.2f xRT\n",
-               tm_utt.t_tot_cpu, tm_utt.t_tot_cpu / (tot_nfr * 0.01));
+               tm_utt->t_tot_cpu, tm_utt->t_tot_cpu / (tot_nfr * 0.01));
         printf("TOTAL ELAPSED TIME: %11.2f sec, %7.2f xRT\n",
-               tm_utt.t_tot_elapsed,
-               tm_utt.t_tot_elapsed / (tot_nfr * 0.01));
+               tm_utt->t_tot_elapsed,
+               tm_utt->t_tot_elapsed / (tot_nfr * 0.01));
     }
 
     if (outsentfp)
@@ -1048,8 +1222,7 @@ main(int32 argc, char *argv[])
     ckd_free(phsegdir);
     ckd_free(wdsegdir);
 
-    feat_array_free(feat);
-    align_free();
+    worker_free(&main_worker);
     models_free();
 
     cmd_ln_free_r(config);
@@ -242,6 +242,12 @@ static logmath_t *logmath;
 static const char *nbestdir;
 static cmd_ln_t *config;
 
+/* What each thread needs of its own to search lattices. */
+typedef struct astar_worker_s {
+    lm_t **lms;                 /* Its copies of the LMs in lmset, made as needed */
+    ptmr_t tm_utt;
+} astar_worker_t;
+
 /*
  * Command line arguments.
  */
@@ -290,6 +296,10 @@ static arg_t defn[] = {
      ARG_BOOLEAN,
      "no",
      "Generate debugging information for the search. "},
+    {"-nthreads",
+     ARG_INT32,
+     "1",
+     "No. of threads searching lattices at once, sharing the models"},
 
     {NULL, ARG_INT32, NULL, NULL}
 };
@@ -371,23 +381,14 @@ build_output_uttfile(char *buf, const char *dir, const char *uttid, const char *
     }
 }
 
-/* Decode the given mfc file and write result to given directory */
 static void
-utt_astar(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
+build_dagfile(char *dagfile, utt_res_t * ur, char *uttid)
 {
-    char dagfile[1024], nbestfile[1024];
     const char *latdir;
     const char *latext;
-    const char *nbestext;
-    dag_t *dag;
-    int32 nfrm;
-
-    if (ur->lmname)
-        lmset_set_curlm_wname(lmset, ur->lmname);
 
     latdir = cmd_ln_str_r(config, "-inlatdir");
     latext = cmd_ln_str_r(config, "-latext");
-    nbestext = cmd_ln_str_r(config, "-nbestext");
     if (latdir) {
         build_output_uttfile(dagfile, latdir, uttid, ur->uttfile);
         strcat(dagfile, ".");
@@ -395,9 +396,23 @@ utt_astar(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
     }
     else
         sprintf(dagfile, "%s.%s", uttid, latext);
+}
 
-    ptmr_reset(&tm_utt);
-    ptmr_start(&tm_utt);
+/* Find the N best paths in the lattice for an utterance with lm, and
+ * write them to the given directory, and timings to outfp */
+static void
+decode_utt(utt_res_t * ur, char *uttid, lm_t * lm, ptmr_t * tm, FILE * outfp)
+{
+    char dagfile[1024], nbestfile[1024];
+    const char *nbestext;
+    dag_t *dag;
+    int32 nfrm;
+
+    nbestext = cmd_ln_str_r(config, "-nbestext");
+    build_dagfile(dagfile, ur, uttid);
+
+    ptmr_reset(tm);
+    ptmr_start(tm);
 
     nfrm = 0;
     if ((dag = dag_load(dagfile,
@@ -412,7 +427,7 @@ utt_astar(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
             E_ERROR("maxedge limit (%d) exceeded\n", dag->maxedge);
             goto search_done;
         }
-        dag_compute_hscr(dag, dict, lmset->cur_lm, 1.0);
+        dag_compute_hscr(dag, dict, lm, 1.0);
         dag_remove_bypass_links(dag);
 
         E_INFO("%5d frames, %6d nodes, %8d edges, %8d bypass\n",
@@ -422,25 +437,93 @@ utt_astar(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
         build_output_uttfile(nbestfile, nbestdir, uttid, ur->uttfile);
         strcat(nbestfile, ".");
         strcat(nbestfile, nbestext);
-        nbest_search(dag, nbestfile, uttid, 1.0, dict, lmset->cur_lm, fpen);
+        nbest_search(dag, nbestfile, uttid, 1.0, dict, lm, fpen);
 
-        lm_cache_stats_dump(lmset->cur_lm);
-        lm_cache_reset(lmset->cur_lm);
+        lm_cache_stats_dump(lm);
+        lm_cache_reset(lm);
     }
     else
         E_ERROR("Dag load (%s) failed\n", uttid);
 search_done:
     dag_destroy(dag);
 
-    ptmr_stop(&tm_utt);
+    ptmr_stop(tm);
 
-    printf("%s: TMR: %5d Frm", uttid, nfrm);
+    fprintf(outfp, "%s: TMR: %5d Frm", uttid, nfrm);
     if (nfrm > 0) {
-        printf(" %6.2f xEl", tm_utt.t_elapsed * 100.0 / nfrm);
-        printf(" %6.2f xCPU", tm_utt.t_cpu * 100.0 / nfrm);
+        fprintf(outfp, " %6.2f xEl", tm->t_elapsed * 100.0 / nfrm);
+        fprintf(outfp, " %6.2f xCPU", tm->t_cpu * 100.0 / nfrm);
+    }
+    fprintf(outfp, "\n");
+    fflush(outfp);
+}
+
+static void
+utt_astar(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
+{
+    if (ur->lmname)
+        lmset_set_curlm_wname(lmset, ur->lmname);
+    decode_utt(ur, uttid, lmset->cur_lm, &tm_utt, stdout);
+}
+
+/* Search a lattice in one of several threads, with the thread's own
+ * copy of the LM, writing timings to a stream copied out in order */
+static void
+utt_astar_mt(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid,
+             FILE ** out)
+{
+    astar_worker_t *w = (astar_worker_t *) data;
+    lm_t *lm;
+    int32 i;
+
+    lm = ur->lmname ? lmset_get_lm_wname(lmset, ur->lmname) : lmset->cur_lm;
+    for (i = 0; i < lmset->n_lm; ++i)
+        if (lmset->lmarray[i] == lm)
+            break;
+    if (w->lms[i] == NULL && (w->lms[i] = lm_share(lm)) == NULL)
+        E_FATAL("Failed to share LM %s\n", lm->name);
+    decode_utt(ur, uttid, w->lms[i], &w->tm_utt, out[0]);
+}
+
+static void
+prefetch_dag(void *data, utt_res_t * ur, char *uttid)
+{
+    char dagfile[1024];
+
+    build_dagfile(dagfile, ur, uttid);
+    ctl_prefetch_file(dagfile);
+}
+
+/* Search lattices in several threads. */
+static void
+process_mt(int32 n_thread)
+{
+    astar_worker_t *workers;
+    void **wdata;
+    FILE *outfp[1];
+    int32 i, j;
+
+    workers = ckd_calloc(n_thread, sizeof(*workers));
+    wdata = ckd_calloc(n_thread, sizeof(*wdata));
+    for (i = 0; i < n_thread; ++i) {
+        workers[i].lms = ckd_calloc(lmset->n_lm, sizeof(*workers[i].lms));
+        ptmr_init(&workers[i].tm_utt);
+        wdata[i] = &workers[i];
+    }
+    outfp[0] = stdout;
+    ctl_process_mt(cmd_ln_str_r(config, "-ctl"),
+                   cmd_ln_str_r(config, "-ctl_lm"),
+                   cmd_ln_int32_r(config, "-ctloffset"),
+                   cmd_ln_int32_r(config, "-ctlcount"),
+                   n_thread, utt_astar_mt, wdata,
+                   prefetch_dag, NULL, outfp, 1);
+    for (i = 0; i < n_thread; ++i) {
+        for (j = 0; j < lmset->n_lm; ++j)
+            lm_share_free(workers[i].lms[j]);
+        ckd_free(workers[i].lms);
     }
-    printf("\n");
-    fflush(stdout);
+    ckd_free(workers);
+    ckd_free(wdata);
 }
 
 int
@@ -462,7 +545,13 @@ main(int32 argc, char *argv[])
 
     nbestdir = cmd_ln_str_r(config, "-nbestdir");
 
-    if (cmd_ln_str_r(config, "-ctl")) {
+    if (cmd_ln_str_r(config, "-ctl") == NULL) {
+        E_FATAL("-ctl is not specified\n");
+    }
+    else if (cmd_ln_int32_r(config, "-nthreads") > 1) {
+        process_mt(cmd_ln_int32_r(config, "-nthreads"));
+    }
+    else {
         ctl_process(cmd_ln_str_r(config, "-ctl"),
                     cmd_ln_str_r(config, "-ctl_lm"),
                     NULL,
@@ -470,9 +559,6 @@ main(int32 argc, char *argv[])
                     cmd_ln_int32_r(config, "-ctlcount"), utt_astar, NULL);
 
     }
-    else {
-        E_FATAL("-ctl is not specified\n");
-    }
 
     models_free();
 
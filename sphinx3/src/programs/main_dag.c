@@ -241,7 +241,6 @@ static mdef_t *mdef;            /* Model definition */
 static dict_t *dict;            /* The dictionary */
 
 static fillpen_t *fpen;         /* The filler penalty structure */
-static dag_t *dag;
 static lmset_t *lmset;          /* The lmset. Replace lm */
 
 static ptmr_t tm_utt;
@@ -252,6 +251,13 @@ static FILE *matchfp, *matchsegfp;
 static cmd_ln_t *config;
 static logmath_t *logmath;
 
+/* What each thread needs of its own to search lattices. */
+typedef struct dag_worker_s {
+    lm_t **lms;                 /* Its copies of the LMs in lmset, made as needed */
+    ptmr_t tm_utt;
+    int32 tot_nfr;
+} dag_worker_t;
+
 /*
  * Command line arguments.
  */
@@ -284,6 +290,10 @@ static arg_t defn[] = {
      ARG_INT32,
      "1",
      "Whether detailed backtrace information (word segmentation/scores) shown in log"},
+    {"-nthreads",
+     ARG_INT32,
+     "1",
+     "No. of threads searching lattices at once, sharing the models"},
 
     {NULL, ARG_INT32, NULL, NULL}
 };
@@ -353,8 +363,9 @@ models_free(void)
 static void
 s3dag_log_hypseg(char *uttid, FILE * fp,        /* Out: output file */
                  srch_hyp_t * hypptr,   /* In: Hypothesis */
-                 int32 nfrm)
-{                               /* In: #frames in utterance */
+                 int32 nfrm,    /* In: #frames in utterance */
+                 lm_t * lm)
+{                               /* In: LM the hypothesis was scored with */
     srch_hyp_t *h;
     int32 ascr, lscr, tscr;
 
@@ -362,7 +373,7 @@ s3dag_log_hypseg(char *uttid, FILE * fp,        /* Out: output file */
     for (h = hypptr; h; h = h->next) {
         ascr += h->ascr;
         if (dict_basewid(dict, h->id) != dict->startwid) {
-            lscr += lm_rawscore(lmset->cur_lm, h->lscr);
+            lscr += lm_rawscore(lm, h->lscr);
         }
         else {
             assert(h->lscr == 0);
@@ -378,7 +389,7 @@ s3dag_log_hypseg(char *uttid, FILE * fp,        /* Out: output file */
         for (h = hypptr; h; h = h->next) {
             lscr =
                 (dict_basewid(dict, h->id) !=
-                 dict->startwid) ? lm_rawscore(lmset->cur_lm, h->lscr) : 0;
+                 dict->startwid) ? lm_rawscore(lm, h->lscr) : 0;
             fprintf(fp, " %d %d %d %s", h->sf, h->ascr, lscr,
                     dict_wordstr(dict, h->id));
         }
@@ -389,19 +400,11 @@ s3dag_log_hypseg(char *uttid, FILE * fp,        /* Out: output file */
 }
 
 
-/* Find the best path in the lattice file and write result to matchfp and matchsegfp */
 static void
-decode_utt(char *uttid, FILE * _matchfp, FILE * _matchsegfp)
+dag_filename(char *dagfile, char *uttid)
 {
-    char dagfile[1024];
-    srch_hyp_t *h, *hyp;
     const char *latdir;
     const char *latext;
-    int32 ascr, lscr;
-
-    hyp = NULL;
-    ptmr_reset(&tm_utt);
-    ptmr_start(&tm_utt);
 
     latdir = cmd_ln_str_r(config, "-inlatdir");
     latext = cmd_ln_str_r(config, "-latext");
@@ -410,15 +413,32 @@ decode_utt(char *uttid, FILE * _matchfp, FILE * _matchsegfp)
         sprintf(dagfile, "%s/%s.%s", latdir, uttid, latext);
     else
         sprintf(dagfile, "%s.%s", uttid, latext);
+}
+
+/* Find the best path in the lattice file and write the result to
+ * outfp, _matchfp and _matchsegfp, returning the number of frames */
+static int32
+decode_utt(char *uttid, lm_t * lm, ptmr_t * tm,
+           FILE * outfp, FILE * _matchfp, FILE * _matchsegfp)
+{
+    char dagfile[1024];
+    srch_hyp_t *h, *hyp;
+    dag_t *dag;
+    int32 ascr, lscr;
 
+    hyp = NULL;
+    ptmr_reset(tm);
+    ptmr_start(tm);
+
+    dag_filename(dagfile, uttid);
     dag = dag_load(dagfile,
                    cmd_ln_int32_r(config, "-maxedge"),
                    cmd_ln_float32_r(config, "-logbase"),
                    cmd_ln_int32_r(config, "-dagfudge"), dict, fpen, config, logmath);
     if (dag == NULL) {
-        ptmr_stop(&tm_utt);
+        ptmr_stop(tm);
         E_ERROR("Failed to load dag from %s\n", dagfile);
-        return;
+        return 0;
     }
     if (dict_filler_word(dict, dag->end->wid))
         dag->end->wid = dict->finishwid;
@@ -431,10 +451,10 @@ decode_utt(char *uttid, FILE * _matchfp, FILE * _matchsegfp)
     dag->final.node = dag->end;
 
     hyp = dag_search(dag, uttid, 1.0, dag->final.node,
-                     dict, lmset->cur_lm, fpen);
+                     dict, lm, fpen);
     if (hyp != NULL) {
         if (cmd_ln_boolean_r(config, "-backtrace"))
-            log_hyp_detailed(stdout, hyp, uttid, "BP", "bp", NULL);
+            log_hyp_detailed(outfp, hyp, uttid, "BP", "bp", NULL);
 
         /* Total acoustic score and LM score */
         ascr = lscr = 0;
@@ -443,14 +463,14 @@ decode_utt(char *uttid, FILE * _matchfp, FILE * _matchsegfp)
             lscr += h->lscr;
         }
 
-        printf("BSTPTH: ");
-        log_hypstr(stdout, hyp, uttid, 0, ascr + lscr, dict);
+        fprintf(outfp, "BSTPTH: ");
+        log_hypstr(outfp, hyp, uttid, 0, ascr + lscr, dict);
 
-        printf("BSTXCT: ");
-        s3dag_log_hypseg(uttid, stdout, hyp, dag->nfrm);
+        fprintf(outfp, "BSTXCT: ");
+        s3dag_log_hypseg(uttid, outfp, hyp, dag->nfrm, lm);
 
-        lm_cache_stats_dump(lmset->cur_lm);
-        lm_cache_reset(lmset->cur_lm);
+        lm_cache_stats_dump(lm);
+        lm_cache_reset(lm);
     }
     else {
         E_ERROR("DAG search (%s) failed\n", uttid);
@@ -462,26 +482,26 @@ decode_utt(char *uttid, FILE * _matchfp, FILE * _matchsegfp)
         log_hypstr(_matchfp, hyp, uttid, 0, 0, dict);
     }
     if (_matchsegfp)
-        s3dag_log_hypseg(uttid, _matchsegfp, hyp, dag->nfrm);
+        s3dag_log_hypseg(uttid, _matchsegfp, hyp, dag->nfrm, lm);
 
     lscr = dag->nfrm;
 
     dag_destroy(dag);
 
-    ptmr_stop(&tm_utt);
+    ptmr_stop(tm);
 
-    printf("%s: TMR: %5d Frm", uttid, lscr);
+    fprintf(outfp, "%s: TMR: %5d Frm", uttid, lscr);
     if (lscr > 0) {
-        printf(" %6.2f xEl", tm_utt.t_elapsed * 100.0 / lscr);
-        printf(" %6.2f xCPU", tm_utt.t_cpu * 100.0 / lscr);
+        fprintf(outfp, " %6.2f xEl", tm->t_elapsed * 100.0 / lscr);
+        fprintf(outfp, " %6.2f xCPU", tm->t_cpu * 100.0 / lscr);
     }
-    printf("\n");
-    fflush(stdout);
-
-    tot_nfr += lscr;
+    fprintf(outfp, "\n");
+    fflush(outfp);
 
     if (hyp != NULL)
         hyp_free(hyp);
+
+    return lscr;
 }
 
 static void
@@ -490,12 +510,83 @@ utt_dag(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid)
 
     if (ur->lmname)
         lmset_set_curlm_wname(lmset, ur->lmname);
-    decode_utt(uttid, matchfp, matchsegfp);
+    tot_nfr += decode_utt(uttid, lmset->cur_lm, &tm_utt,
+                          stdout, matchfp, matchsegfp);
+}
+
+/* Search a lattice in one of several threads, with the thread's own
+ * copy of the LM, writing to streams which are copied out in order */
+static void
+utt_dag_mt(void *data, utt_res_t * ur, int32 sf, int32 ef, char *uttid,
+           FILE ** out)
+{
+    dag_worker_t *w = (dag_worker_t *) data;
+    lm_t *lm;
+    int32 i;
+
+    lm = ur->lmname ? lmset_get_lm_wname(lmset, ur->lmname) : lmset->cur_lm;
+    for (i = 0; i < lmset->n_lm; ++i)
+        if (lmset->lmarray[i] == lm)
+            break;
+    if (w->lms[i] == NULL && (w->lms[i] = lm_share(lm)) == NULL)
+        E_FATAL("Failed to share LM %s\n", lm->name);
+    w->tot_nfr += decode_utt(uttid, w->lms[i], &w->tm_utt, out[0],
+                             matchfp ? out[1] : NULL,
+                             matchsegfp ? out[2] : NULL);
+}
+
+static void
+prefetch_dag(void *data, utt_res_t * ur, char *uttid)
+{
+    char dagfile[1024];
+
+    dag_filename(dagfile, uttid);
+    ctl_prefetch_file(dagfile);
+}
+
+/* Search lattices in several threads, returning the elapsed time. */
+static ptmr_t
+process_mt(int32 n_thread)
+{
+    dag_worker_t *workers;
+    void **wdata;
+    FILE *outfp[3];
+    ptmr_t tm;
+    int32 i, j;
+
+    workers = ckd_calloc(n_thread, sizeof(*workers));
+    wdata = ckd_calloc(n_thread, sizeof(*wdata));
+    for (i = 0; i < n_thread; ++i) {
+        workers[i].lms = ckd_calloc(lmset->n_lm, sizeof(*workers[i].lms));
+        ptmr_init(&workers[i].tm_utt);
+        wdata[i] = &workers[i];
+    }
+    outfp[0] = stdout;
+    outfp[1] = matchfp;
+    outfp[2] = matchsegfp;
+    tm = ctl_process_mt(cmd_ln_str_r(config, "-ctl"),
+                        cmd_ln_str_r(config, "-ctl_lm"),
+                        cmd_ln_int32_r(config, "-ctloffset"),
+                        cmd_ln_int32_r(config, "-ctlcount"),
+                        n_thread, utt_dag_mt, wdata,
+                        prefetch_dag, NULL, outfp, 3);
+    for (i = 0; i < n_thread; ++i) {
+        tot_nfr += workers[i].tot_nfr;
+        for (j = 0; j < lmset->n_lm; ++j)
+            lm_share_free(workers[i].lms[j]);
+        ckd_free(workers[i].lms);
+    }
+    ckd_free(workers);
+    ckd_free(wdata);
+    return tm;
 }
 
 int
 main(int32 argc, char *argv[])
 {
+    ptmr_t tm_tot;
+    int32 n_thread;
+
     cmd_ln_appl_enter(argc, argv, "default.arg", defn);
 
     config = cmd_ln_get();
@@ -536,7 +627,16 @@ main(int32 argc, char *argv[])
             E_ERROR("fopen(%s,w) failed\n", matchsegfile);
     }
 
-    if (cmd_ln_str_r(config, "-ctl")) {
+    n_thread = cmd_ln_int32_r(config, "-nthreads");
+    if (cmd_ln_str_r(config, "-ctl") == NULL) {
+        E_FATAL("-ctl is not specified\n");
+    }
+    else if (n_thread > 1) {
+        tm_tot = process_mt(n_thread);
+        tm_utt.t_tot_cpu = tm_tot.t_tot_cpu;
+        tm_utt.t_tot_elapsed = tm_tot.t_tot_elapsed;
+    }
+    else {
         ctl_process(cmd_ln_str_r(config, "-ctl"),
                     cmd_ln_str_r(config, "-ctl_lm"),
                     NULL,
@@ -544,9 +644,6 @@ main(int32 argc, char *argv[])
                     cmd_ln_int32_r(config, "-ctlcount"), utt_dag, NULL);
 
     }
-    else {
-        E_FATAL("-ctl is not specified\n");
-    }
 
     if (matchfp)
         fclose(matchfp);
@@ -105,6 +105,10 @@ static arg_t arg[] = {
      ARG_STRING,
      NULL,
      "Output subvq file (stdout if not specified)"},
+    {"-nthreads",
+     ARG_INT32,
+     "1",
+     "Number of threads used to assign Gaussians to codewords in each k-means iteration"},
 
     {NULL, ARG_INT32, NULL, NULL}
 };
@@ -246,7 +250,8 @@ main(int32 argc, char *argv[])
         /* VQ the subvector copy built above */
         sqerr = vector_vqgen(data, datarows, svqcols, svqrows,
                              cmd_ln_float64_r(config, "-eps"), cmd_ln_int32_r(config, "-iter"),
-                             vqmean, vqmap, cmd_ln_int32_r(config, "-seed"));
+                             vqmean, vqmap, cmd_ln_int32_r(config, "-seed"),
+                             cmd_ln_int32_r(config, "-nthreads"));
 
         /* Output VQ */
         fprintf(fpout, "Codebook %d Sqerr %e\n", v, sqerr);
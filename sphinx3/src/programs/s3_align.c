@@ -97,6 +97,7 @@
 
 #include <sphinxbase/feat.h>
 #include <sphinxbase/strfuncs.h>
+#include <sphinxbase/listelem_alloc.h>
 
 #include "s3types.h"
 #include "mdef.h"
@@ -159,9 +160,7 @@ typedef struct history_s {
     int32 score;
     struct snode_s *snode;              /** State for which this history node created */
     struct history_s *pred;             /** Previous frame history */
-    struct history_s *alloc_next;       /** Linear list of all allocated history nodes */
 } history_t;
-static history_t *hist_head;            /** Head of list of all history nodes */
 
 /**
  * State DAG structures similar to phone DAG structures.
@@ -183,70 +182,64 @@ typedef struct slink_s {
     int32 prob;
 } slink_t;
 
-static pnode_t phead, ptail;    /** Dummies at the beginning and end of the sent hmm */
-static pnode_t *pnode_list;     /** List of all dynamically allocated pnodes */
-static int32 n_pnode;           /** #pnodes allocated (used to ID each pnode) */
+#define ACTIVE_LIST_SIZE_INCR   16380
 
-static snode_t shead, stail;    /** State-level DAG head and tail */
+/**
+ * State of one aligner.  The nodes and links of the sentence HMM, the
+ * Viterbi history and the segmentations are taken from allocators
+ * which are emptied all at once, so an aligner reuses their memory
+ * from one utterance to the next instead of freeing it node by node.
+ */
+struct align_s {
+    dict_t *dict;               /** The dictionary */
+    mdef_t *mdef;               /** Model definition */
+    tmat_t *tmat;               /** Transition probability matrices */
 
-static dict_t *dict;            /** The dictionary */
-static mdef_t *mdef;            /** Model definition */
-static tmat_t *tmat;            /** Transition probability matrices */
+    s3wid_t *fillwid;           /** BAD_S3WID terminated array of optional filler basewid */
 
-static s3wid_t *fillwid;        /** BAD_S3WID terminated array of optional filler basewid */
+    pnode_t phead, ptail;       /** Dummies at the beginning and end of the sent hmm */
+    pnode_t *pnode_list;        /** List of all pnodes of the sent hmm */
+    int32 n_pnode;              /** #pnodes allocated (used to ID each pnode) */
 
-static snode_t **cur_active;    /** NULL-terminated active state list for current frame */
-static snode_t **next_active;   /** Similar list for next frame */
-static int32 active_list_size = 0;
-#define ACTIVE_LIST_SIZE_INCR   16380
-static int32 n_active;
+    snode_t shead, stail;       /** State-level DAG head and tail */
 
-static int32 curfrm;            /** Current frame */
-static int32 beam;              /** Pruning beamwidth */
-static int32 *score_scale;      /** Score by which state scores scaled in each frame */
+    char *sent;                 /** Transcript the sent hmm was built for, or NULL */
+    int insert_sil;             /** Whether fillers were inserted in it */
 
-/** Lists of state, phone and word-level alignments for most recent utterance */
-static align_stseg_t *align_stseg;
-static align_phseg_t *align_phseg;
-static align_wdseg_t *align_wdseg;
+    listelem_alloc_t *pnode_alloc;
+    listelem_alloc_t *plink_alloc;
+    listelem_alloc_t *snode_alloc;      /** States of one pnode at a time */
+    listelem_alloc_t *slink_alloc;
+    listelem_alloc_t *hist_alloc;
+    listelem_alloc_t *stseg_alloc;
+    listelem_alloc_t *phseg_alloc;
+    listelem_alloc_t *wdseg_alloc;
 
-/** Free all allocated pnodes */
-static void
-pnodes_free(void)
-{
-    pnode_t *p;
+    snode_t **cur_active;       /** NULL-terminated active state list for current frame */
+    snode_t **next_active;      /** Similar list for next frame */
+    int32 active_list_size;
+    int32 n_active;
 
-    while (pnode_list) {
-        p = pnode_list->alloc_next;
-        ckd_free((char *) pnode_list);
-        pnode_list = p;
-    }
-}
+    int32 curfrm;               /** Current frame */
+    int32 beam;                 /** Pruning beamwidth */
+    int32 *score_scale;         /** Score by which state scores scaled in each frame */
 
-
-/** Free the specified set of plinks */
-static void
-plinks_free(plink_t * l)
-{
-    plink_t *tmp;
-
-    while (l) {
-        tmp = l->next;
-        ckd_free((char *) l);
-        l = tmp;
-    }
-}
+    /** Lists of state, phone and word-level alignments for most recent utterance */
+    align_stseg_t *align_stseg;
+    align_phseg_t *align_phseg;
+    align_wdseg_t *align_wdseg;
+};
 
 
 /**
  * Append a pnode to a list of pnodes (maintained in a list of plinks).
  */
 static plink_t *
-append_pnode(plink_t * list, pnode_t * node)
+append_pnode(align_t * al, plink_t * list, pnode_t * node)
 {
     plink_t *l;
 
-    l = (plink_t *) ckd_calloc(1, sizeof(*l));
+    l = (plink_t *) listelem_malloc(al->plink_alloc);
     l->node = node;
     l->next = list;
     return l;
@@ -258,30 +251,30 @@ append_pnode(plink_t * list, pnode_t * node)
  * list.  Return the allocated node pointer.
  */
 static pnode_t *
-alloc_pnode(s3wid_t w, int32 pos,
+alloc_pnode(align_t * al, s3wid_t w, int32 pos,
             s3cipid_t ci, s3cipid_t lc, s3cipid_t rc, word_posn_t wpos)
 {
     pnode_t *p;
 
-    p = (pnode_t *) ckd_calloc(1, sizeof(*p));
+    p = (pnode_t *) listelem_malloc(al->pnode_alloc);
     p->wid = w;
     p->ci = ci;
     p->lc = lc;
     p->rc = rc;
     p->pos = pos;
 
-    p->pid = mdef_phone_id_nearest(mdef, ci, lc, rc, wpos);
+    p->pid = mdef_phone_id_nearest(al->mdef, ci, lc, rc, wpos);
 
     p->succlist = NULL;
     p->predlist = NULL;
     p->next = NULL;
 
-    p->id = n_pnode++;
+    p->id = al->n_pnode++;
 
     p->startstate = NULL;
 
-    p->alloc_next = pnode_list;
-    pnode_list = p;
+    p->alloc_next = al->pnode_list;
+    al->pnode_list = p;
 
     return p;
 }
@@ -291,10 +284,10 @@ alloc_pnode(s3wid_t w, int32 pos,
  * Link source and destination phone HMM nodes.
  */
 static void
-link_pnodes(pnode_t * src, pnode_t * dst)
+link_pnodes(align_t * al, pnode_t * src, pnode_t * dst)
 {
-    src->succlist = append_pnode(src->succlist, dst);
-    dst->predlist = append_pnode(dst->predlist, src);
+    src->succlist = append_pnode(al, src->succlist, dst);
+    dst->predlist = append_pnode(al, dst->predlist, src);
 }
 
 
@@ -305,7 +298,7 @@ link_pnodes(pnode_t * src, pnode_t * dst)
  * Return a list of the final HMM nodes for the single word appended.
  */
 static pnode_t *
-append_word(s3wid_t w,
+append_word(align_t * al, s3wid_t w,
             pnode_t * prev_end, s3cipid_t * pred_ci, s3cipid_t * succ_ci)
 {
     int32 i, M, N, m, n, pronlen, pron;
@@ -317,20 +310,20 @@ append_word(s3wid_t w,
     for (i = 0; IS_S3CIPID(succ_ci[i]); i++);
     N = (i > 0) ? i : 1;        /* #successor CI phones */
 
-    if ((pronlen = dict->word[w].pronlen) == 1) {
+    if ((pronlen = al->dict->word[w].pronlen) == 1) {
         /* Single phone case; replicated MxN times for all possible contexts */
         nodelist = NULL;
 
         for (m = 0; m < M; m++) {
             for (n = 0; n < N; n++) {
-                node = alloc_pnode(w, 0,
-                                   dict->word[w].ciphone[0], pred_ci[m],
+                node = alloc_pnode(al, w, 0,
+                                   al->dict->word[w].ciphone[0], pred_ci[m],
                                    succ_ci[n], WORD_POSN_SINGLE);
                 /* Link to all predecessor nodes matching context requirements */
                 for (p = prev_end; p; p = p->next) {
                     if ((p->ci == node->lc) &&
                         ((NOT_S3CIPID(p->rc)) || (p->rc == node->ci))) {
-                        link_pnodes(p, node);
+                        link_pnodes(al, p, node);
                     }
                 }
 
@@ -345,15 +338,15 @@ append_word(s3wid_t w,
     /* Multi-phone case.  First phone, replicated M times */
     nodelist = NULL;
     for (m = 0; m < M; m++) {
-        node = alloc_pnode(w, 0,
-                           dict->word[w].ciphone[0],
+        node = alloc_pnode(al, w, 0,
+                           al->dict->word[w].ciphone[0],
                            pred_ci[m],
-                           dict->word[w].ciphone[1], WORD_POSN_BEGIN);
+                           al->dict->word[w].ciphone[1], WORD_POSN_BEGIN);
         /* Link to predecessor node(s) matching context requirements */
         for (p = prev_end; p; p = p->next) {
             if ((p->ci == node->lc) &&
                 ((NOT_S3CIPID(p->rc)) || (p->rc == node->ci))) {
-                link_pnodes(p, node);
+                link_pnodes(al, p, node);
             }
         }
         node->next = nodelist;
@@ -362,13 +355,13 @@ append_word(s3wid_t w,
 
     /* Intermediate phones */
     for (pron = 1; pron < pronlen - 1; pron++) {
-        node = alloc_pnode(w, pron,
-                           dict->word[w].ciphone[pron],
-                           dict->word[w].ciphone[pron - 1],
-                           dict->word[w].ciphone[pron + 1],
+        node = alloc_pnode(al, w, pron,
+                           al->dict->word[w].ciphone[pron],
+                           al->dict->word[w].ciphone[pron - 1],
+                           al->dict->word[w].ciphone[pron + 1],
                            WORD_POSN_INTERNAL);
         for (p = nodelist; p; p = p->next)
-            link_pnodes(p, node);
+            link_pnodes(al, p, node);
         nodelist = node;
     }
 
@@ -376,12 +369,12 @@ append_word(s3wid_t w,
     prev_end = nodelist;
     nodelist = NULL;
     for (n = 0; n < N; n++) {
-        node = alloc_pnode(w, pron,
-                           dict->word[w].ciphone[pron],
-                           dict->word[w].ciphone[pron - 1],
+        node = alloc_pnode(al, w, pron,
+                           al->dict->word[w].ciphone[pron],
+                           al->dict->word[w].ciphone[pron - 1],
                            succ_ci[n], WORD_POSN_END);
         for (p = prev_end; p; p = p->next)
-            link_pnodes(p, node);
+            link_pnodes(al, p, node);
         node->next = nodelist;
         nodelist = node;
     }
@@ -391,12 +384,12 @@ append_word(s3wid_t w,
 
 
 static void
-build_pred_ci(pnode_t * nodelist, s3cipid_t * pred_ci)
+build_pred_ci(align_t * al, pnode_t * nodelist, s3cipid_t * pred_ci)
 {
     int32 i, p;
     pnode_t *node;
 
-    for (p = 0; p < mdef->n_ciphone; p++)
+    for (p = 0; p < al->mdef->n_ciphone; p++)
         pred_ci[p] = 0;
 
     for (node = nodelist; node; node = node->next)
@@ -404,7 +397,7 @@ build_pred_ci(pnode_t * nodelist, s3cipid_t * pred_ci)
             pred_ci[(unsigned) node->ci] = 1;
 
     i = 0;
-    for (p = 0; p < mdef->n_ciphone; p++) {
+    for (p = 0; p < al->mdef->n_ciphone; p++) {
         if (pred_ci[p])
             pred_ci[i++] = p;
     }
@@ -413,24 +406,25 @@ build_pred_ci(pnode_t * nodelist, s3cipid_t * pred_ci)
 
 
 static void
-build_succ_ci(s3wid_t w, int32 append_filler, s3cipid_t * succ_ci)
+build_succ_ci(align_t * al, s3wid_t w, int32 append_filler,
+              s3cipid_t * succ_ci)
 {
     int32 i, p;
 
-    for (p = 0; p < mdef->n_ciphone; p++)
+    for (p = 0; p < al->mdef->n_ciphone; p++)
         succ_ci[p] = 0;
 
-    for (; IS_S3WID(w); w = dict->word[w].alt)
-        succ_ci[(unsigned) dict->word[w].ciphone[0]] = 1;
+    for (; IS_S3WID(w); w = al->dict->word[w].alt)
+        succ_ci[(unsigned) al->dict->word[w].ciphone[0]] = 1;
 
     if (append_filler) {
-        for (i = 0; IS_S3WID(fillwid[i]); i++)
-            for (w = fillwid[i]; IS_S3WID(w); w = dict->word[w].alt)
-                succ_ci[(unsigned) dict->word[w].ciphone[0]] = 1;
+        for (i = 0; IS_S3WID(al->fillwid[i]); i++)
+            for (w = al->fillwid[i]; IS_S3WID(w); w = al->dict->word[w].alt)
+                succ_ci[(unsigned) al->dict->word[w].ciphone[0]] = 1;
     }
 
     i = 0;
-    for (p = 0; p < mdef->n_ciphone; p++) {
+    for (p = 0; p < al->mdef->n_ciphone; p++) {
         if (succ_ci[p])
             succ_ci[i++] = p;
     }
@@ -447,7 +441,8 @@ build_succ_ci(s3wid_t w, int32 append_filler, s3cipid_t * succ_ci)
  * the global node list.)
  */
 static pnode_t *
-append_transcript_word(s3wid_t w,
+append_transcript_word(align_t * al,
+                       s3wid_t w,
                                 /** Transcript word to be appended */
                        pnode_t * prev_end,
                                 /** Previous end points to be attached to w */
@@ -463,21 +458,21 @@ append_transcript_word(s3wid_t w,
     s3cipid_t pred_ci[256], succ_ci[256];
     s3wid_t fw;
 
-    if (mdef->n_ciphone >= 256)
+    if (al->mdef->n_ciphone >= 256)
         E_FATAL
             ("Increase pred_ci, succ_ci array sizes to > #CIphones (%d)\n",
-             mdef->n_ciphone);
+             al->mdef->n_ciphone);
     assert(prev_end != NULL);
 
     /* Add optional silence/filler words before w, if indicated */
     if (prefix_filler) {
-        build_pred_ci(prev_end, pred_ci);       /* Predecessor CI list for fillers */
-        build_succ_ci(w, 0, succ_ci);   /* Successor CI list for fillers */
+        build_pred_ci(al, prev_end, pred_ci);       /* Predecessor CI list for fillers */
+        build_succ_ci(al, w, 0, succ_ci);   /* Successor CI list for fillers */
 
         new_end = NULL;
-        for (i = 0; IS_S3WID(fillwid[i]); i++) {
-            for (fw = fillwid[i]; IS_S3WID(fw); fw = dict->word[fw].alt) {
-                tmp_end = append_word(fw, prev_end, pred_ci, succ_ci);
+        for (i = 0; IS_S3WID(al->fillwid[i]); i++) {
+            for (fw = al->fillwid[i]; IS_S3WID(fw); fw = al->dict->word[fw].alt) {
+                tmp_end = append_word(al, fw, prev_end, pred_ci, succ_ci);
 
                 for (node = tmp_end; node->next; node = node->next);
                 node->next = new_end;
@@ -491,12 +486,12 @@ append_transcript_word(s3wid_t w,
     }
 
     /* Add w */
-    build_pred_ci(prev_end, pred_ci);   /* Predecessor CI list for w */
-    build_succ_ci(nextw, append_filler, succ_ci);       /* Successor CI list for w */
+    build_pred_ci(al, prev_end, pred_ci);   /* Predecessor CI list for w */
+    build_succ_ci(al, nextw, append_filler, succ_ci);       /* Successor CI list for w */
 
     new_end = NULL;
-    for (; IS_S3WID(w); w = dict->word[w].alt) {
-        tmp_end = append_word(w, prev_end, pred_ci, succ_ci);
+    for (; IS_S3WID(w); w = al->dict->word[w].alt) {
+        tmp_end = append_word(al, w, prev_end, pred_ci, succ_ci);
 
         for (node = tmp_end; node->next; node = node->next);
         node->next = new_end;
@@ -510,50 +505,50 @@ append_transcript_word(s3wid_t w,
 #if _DEBUG_ALIGN_
 
 static void
-dump_pnode_info(pnode_t * p)
+dump_pnode_info(align_t * al, pnode_t * p)
 {
     if (NOT_S3WID(p->wid))
         printf("%s", (p->id == -1) ? "<head>" : "<tail>");
     else
         printf("%s.%d.",
-               dict_wordstr(p->wid), p->pos, mdef_ciphone_str(mdef,
+               dict_wordstr(al->dict, p->wid), p->pos, mdef_ciphone_str(al->mdef,
                                                               p->ci));
-    printf("%s", IS_CIPID(p->lc) ? mdef_ciphone_str(mdef, p->lc) : "-");
-    printf("(%s)", IS_CIPID(p->ci) ? mdef_ciphone_str(mdef, p->ci) : "-");
-    printf("%s", IS_CIPID(p->rc) ? mdef_ciphone_str(mdef, p->rc) : "-");
+    printf("%s", IS_CIPID(p->lc) ? mdef_ciphone_str(al->mdef, p->lc) : "-");
+    printf("(%s)", IS_CIPID(p->ci) ? mdef_ciphone_str(al->mdef, p->ci) : "-");
+    printf("%s", IS_CIPID(p->rc) ? mdef_ciphone_str(al->mdef, p->rc) : "-");
 }
 
 
 static void
-dump_pnode_succ_dag(pnode_t * p)
+dump_pnode_succ_dag(align_t * al, pnode_t * p)
 {
     plink_t *l;
 
     for (l = p->succlist; l; l = l->next) {
-        dump_pnode_info(p);
+        dump_pnode_info(al, p);
         printf("\t\t");
-        dump_pnode_info(l->node);
+        dump_pnode_info(al, l->node);
         printf(";\n");
     }
 }
 
 
 static void
-dump_pnode_succ(pnode_t * p)
+dump_pnode_succ(align_t * al, pnode_t * p)
 {
     plink_t *l;
 
     printf("  %5d", p->id);
     if (IS_S3WID(p->wid))
         printf(" %20s %02d %6d %4s",
-               dict_wordstr(p->wid), p->pos, p->pid, mdef_ciphone_str(mdef,
+               dict_wordstr(al->dict, p->wid), p->pos, p->pid, mdef_ciphone_str(al->mdef,
                                                                       p->
                                                                       ci));
     else
         printf(" %20s %02d %6d %4s", "<phead>", 0, BAD_S3PID, "");
     printf(" %4s %4s",
-           IS_CIPID(p->lc) ? mdef_ciphone_str(mdef, p->lc) : "-",
-           IS_CIPID(p->rc) ? mdef_ciphone_str(mdef, p->rc) : "-");
+           IS_CIPID(p->lc) ? mdef_ciphone_str(al->mdef, p->lc) : "-",
+           IS_CIPID(p->rc) ? mdef_ciphone_str(al->mdef, p->rc) : "-");
     printf("\t");
 
     for (l = p->succlist; l; l = l->next)
@@ -564,21 +559,21 @@ dump_pnode_succ(pnode_t * p)
 
 
 static void
-dump_pdag(void)
+dump_pdag(align_t * al)
 {
     pnode_t *p;
 
     printf("SUCCESSOR LIST (DAG format):\n");
     printf(".GS 5 5 fill\n");
-    dump_pnode_succ_dag(&phead);
-    for (p = pnode_list; p; p = p->alloc_next)
-        dump_pnode_succ_dag(p);
+    dump_pnode_succ_dag(al, &al->phead);
+    for (p = al->pnode_list; p; p = p->alloc_next)
+        dump_pnode_succ_dag(al, p);
     printf(".GE\n");
 
     printf("SUCCESSOR LIST:\n");
-    dump_pnode_succ(&phead);
-    for (p = pnode_list; p; p = p->alloc_next)
-        dump_pnode_succ(p);
+    dump_pnode_succ(al, &al->phead);
+    for (p = al->pnode_list; p; p = p->alloc_next)
+        dump_pnode_succ(al, p);
 }
 
 #endif
@@ -588,11 +583,11 @@ dump_pdag(void)
  * Append an snode to a list of snodes (maintained in a list of slinks).
  */
 static slink_t *
-append_snode(slink_t * list, snode_t * node, int32 prob)
+append_snode(align_t * al, slink_t * list, snode_t * node, int32 prob)
 {
     slink_t *l;
 
-    l = (slink_t *) ckd_calloc(1, sizeof(*l));
+    l = (slink_t *) listelem_malloc(al->slink_alloc);
     l->node = node;
     l->next = list;
     l->prob = prob;
@@ -605,10 +600,10 @@ append_snode(slink_t * list, snode_t * node, int32 prob)
  * Link source and destination state nodes.
  */
 static void
-link_snodes(snode_t * src, snode_t * dst, int32 prob)
+link_snodes(align_t * al, snode_t * src, snode_t * dst, int32 prob)
 {
-    src->succlist = append_snode(src->succlist, dst, prob);
-    dst->predlist = append_snode(dst->predlist, src, prob);
+    src->succlist = append_snode(al, src->succlist, dst, prob);
+    dst->predlist = append_snode(al, dst->predlist, src, prob);
 }
 
 
@@ -616,7 +611,7 @@ link_snodes(snode_t * src, snode_t * dst, int32 prob)
  * Remove src->dst link and return the associated prob.
  */
 static int32
-un_slink_succ(snode_t * src, snode_t * dst)
+un_slink_succ(align_t * al, snode_t * src, snode_t * dst)
 {
     slink_t *l, *prevl;
     int32 prob;
@@ -633,20 +628,20 @@ un_slink_succ(snode_t * src, snode_t * dst)
         prevl->next = l->next;
 
     prob = l->prob;
-    ckd_free((char *) l);
+    listelem_free(al->slink_alloc, l);
 
     return prob;
 }
 
 
 static void
-slinks_free(slink_t * l)
+slinks_free(align_t * al, slink_t * l)
 {
     slink_t *tmp;
 
     while (l) {
         tmp = l->next;
-        ckd_free((char *) l);
+        listelem_free(al->slink_alloc, l);
         l = tmp;
     }
 }
@@ -657,7 +652,7 @@ slinks_free(slink_t * l)
  * searched.
  */
 static int32
-build_state_dag(void)
+build_state_dag(align_t * al)
 {
     pnode_t *p;
     plink_t *pl;
@@ -667,12 +662,12 @@ build_state_dag(void)
     int32 i, j;
     int32 **tp, prob;
 
-    n_state = mdef->n_emit_state + 1;
+    n_state = al->mdef->n_emit_state + 1;
     final_state = n_state - 1;
 
-    for (p = pnode_list; p; p = p->alloc_next) {
+    for (p = al->pnode_list; p; p = p->alloc_next) {
         /* Allocate states for p */
-        s = (snode_t *) ckd_calloc(n_state, sizeof(snode_t));
+        s = (snode_t *) listelem_malloc(al->snode_alloc);
         p->startstate = s;
 
         for (i = 0; i < n_state; i++) {
@@ -683,22 +678,22 @@ build_state_dag(void)
             s[i].hist = NULL;
             s[i].active_frm = -1;
             /* s[i].sen = mdef->phone[p->pid].state[i]; */
-            s[i].sen = mdef->sseq[mdef->phone[p->pid].ssid][i];
+            s[i].sen = al->mdef->sseq[al->mdef->phone[p->pid].ssid][i];
             s[i].state = i;
         }
 
         /* Create transitions between states */
-        tp = tmat->tp[mdef->phone[p->pid].tmat];
+        tp = al->tmat->tp[al->mdef->phone[p->pid].tmat];
         for (i = 0; i < final_state; i++) {     /* #from states excludes final state */
             for (j = 0; j < n_state; j++) {
                 if (tp[i][j] > S3_LOGPROB_ZERO) /* Link from i to j */
-                    link_snodes(s + i, s + j, tp[i][j]);
+                    link_snodes(al, s + i, s + j, tp[i][j]);
             }
         }
     }
 
     /* Eliminate non-emitting nodes (final states of HMMs) from state DAG structure */
-    for (p = pnode_list; p; p = p->alloc_next) {
+    for (p = al->pnode_list; p; p = p->alloc_next) {
         fs = p->startstate + final_state;
         assert(!fs->succlist);
 
@@ -708,59 +703,78 @@ build_state_dag(void)
          */
         for (sl = fs->predlist; sl; sl = sl->next) {
             /* Unlink successor link between this predecessor and final state */
-            prob = un_slink_succ(sl->node, fs);
+            prob = un_slink_succ(al, sl->node, fs);
 
             /* Link this predecessor to start states of successor phones */
             for (pl = p->succlist; pl; pl = pl->next) {
                 if (pl->node->startstate)
-                    link_snodes(sl->node, pl->node->startstate, prob);
+                    link_snodes(al, sl->node, pl->node->startstate, prob);
                 else
-                    link_snodes(sl->node, &stail, prob);
+                    link_snodes(al, sl->node, &al->stail, prob);
             }
         }
 
-        slinks_free(fs->predlist);
+        slinks_free(al, fs->predlist);
         fs->predlist = NULL;
     }
 
     /* Link shead to initial states */
-    for (pl = phead.succlist; pl; pl = pl->next)
-        link_snodes(&shead, pl->node->startstate, 0);
+    for (pl = al->phead.succlist; pl; pl = pl->next)
+        link_snodes(al, &al->shead, pl->node->startstate, 0);
 
     return 0;
 }
 
 
+/**
+ * Empty the sentence HMM, keeping the memory of its nodes and links for
+ * the next one.
+ */
+static void
+sent_hmm_reset(align_t * al)
+{
+    listelem_alloc_reset(al->pnode_alloc);
+    listelem_alloc_reset(al->plink_alloc);
+    listelem_alloc_reset(al->snode_alloc);
+    listelem_alloc_reset(al->slink_alloc);
+    al->pnode_list = NULL;
+    al->n_pnode = 0;
+    al->shead.succlist = NULL;
+    al->stail.predlist = NULL;
+    ckd_free(al->sent);
+    al->sent = NULL;
+}
+
+
+/**
+ * Make the sentence HMM ready to align another utterance, as if it had
+ * just been built.
+ */
 static void
-destroy_state_dag(void)
+sent_hmm_rewind(align_t * al)
 {
     pnode_t *p;
     snode_t *s;
     int32 i, n_state;
 
-    n_state = mdef->n_emit_state + 1;
-
-    for (p = pnode_list; p; p = p->alloc_next) {
-        if ((s = p->startstate) != NULL) {      /* Maybe NULL if state dag not built */
-            for (i = 0; i < n_state; i++) {
-                slinks_free(s[i].succlist);
-                slinks_free(s[i].predlist);
-            }
-
-            ckd_free(s);
-            p->startstate = NULL;
+    n_state = al->mdef->n_emit_state + 1;
+    for (p = al->pnode_list; p; p = p->alloc_next) {
+        s = p->startstate;
+        for (i = 0; i < n_state; i++) {
+            s[i].score = S3_LOGPROB_ZERO;
+            s[i].hist = NULL;
+            s[i].active_frm = -1;
         }
     }
-
-    slinks_free(shead.succlist);
-    slinks_free(stail.predlist);
+    al->shead.hist = NULL;
+    al->stail.hist = NULL;
 }
 
 
 #if _DEBUG_ALIGN_
 
 static void
-dump_snode_succ(snode_t * s)
+dump_snode_succ(align_t * al, snode_t * s)
 {
     slink_t *l;
     pnode_t *p;
@@ -775,28 +789,28 @@ dump_snode_succ(snode_t * s)
 
 
 static void
-dump_sdag(void)
+dump_sdag(align_t * al)
 {
     pnode_t *p;
     snode_t *s;
     int32 i;
 
     printf("STATE DAG:\n");
-    for (p = pnode_list; p; p = p->alloc_next) {
+    for (p = al->pnode_list; p; p = p->alloc_next) {
         s = p->startstate;
-        for (i = 0; i <= mdef->n_emit_state; i++)
-            dump_snode_succ(s + i);
+        for (i = 0; i <= al->mdef->n_emit_state; i++)
+            dump_snode_succ(al, s + i);
     }
 }
 
 
 static void
-dump_sent_hmm(void)
+dump_sent_hmm(align_t * al)
 {
-    dump_pdag();
-    dump_sdag();
-    E_INFO("%d pnodes, %d snodes\n", n_pnode,
-           n_pnode * mdef->n_emit_state);
+    dump_pdag(al);
+    dump_sdag(al);
+    E_INFO("%d pnodes, %d snodes\n", al->n_pnode,
+           al->n_pnode * al->mdef->n_emit_state);
 }
 
 #endif
@@ -816,71 +830,80 @@ dump_sent_hmm(void)
  * Return 0 if successful, \<0 if any error (eg, OOV word encountered).
  */
 int32
-align_build_sent_hmm(char *wordstr, int insert_sil)
+align_build_sent_hmm(align_t * al, char *wordstr, int insert_sil)
 {
     s3wid_t w, nextw;
     int32 k, oov;
     pnode_t *word_end, *node;
-    char *wd, delim, *wdcopy = NULL;
+    char *wd, delim, *wdcopy = NULL, *sent;
+
+    /* The same transcript as last time needs no new sentence HMM. */
+    if (al->sent && al->insert_sil == insert_sil
+        && strcmp(al->sent, wordstr) == 0) {
+        sent_hmm_rewind(al);
+        return 0;
+    }
+    sent_hmm_reset(al);
+    sent = ckd_salloc(wordstr);
 
     /* Initialize dummy head and tail entries of sent hmm */
-    phead.wid = BAD_S3WID;
-    phead.ci = BAD_S3CIPID;
-    phead.lc = BAD_S3CIPID;     /* No predecessor */
-    phead.rc = BAD_S3CIPID;     /* Any phone can follow head */
-    phead.pid = BAD_S3PID;
-    phead.succlist = NULL;
-    phead.predlist = NULL;
-    phead.next = NULL;          /* Will ultimately be the head of list of all pnodes */
-    phead.id = -1;              /* Hardwired */
-    phead.startstate = NULL;
-
-    ptail.wid = BAD_S3WID;
-    ptail.ci = BAD_S3CIPID;
-    ptail.lc = BAD_S3CIPID;     /* Any phone can precede tail */
-    ptail.rc = BAD_S3CIPID;     /* No successor */
-    ptail.pid = BAD_S3PID;
-    ptail.succlist = NULL;
-    ptail.predlist = NULL;
-    ptail.next = NULL;
-    ptail.id = -2;              /* Hardwired */
-    ptail.startstate = NULL;
-
-    n_pnode = 0;
-    pnode_list = NULL;
+    al->phead.wid = BAD_S3WID;
+    al->phead.ci = BAD_S3CIPID;
+    al->phead.lc = BAD_S3CIPID;     /* No predecessor */
+    al->phead.rc = BAD_S3CIPID;     /* Any phone can follow head */
+    al->phead.pid = BAD_S3PID;
+    al->phead.succlist = NULL;
+    al->phead.predlist = NULL;
+    al->phead.next = NULL;          /* Will ultimately be the head of list of all pnodes */
+    al->phead.id = -1;              /* Hardwired */
+    al->phead.startstate = NULL;
+
+    al->ptail.wid = BAD_S3WID;
+    al->ptail.ci = BAD_S3CIPID;
+    al->ptail.lc = BAD_S3CIPID;     /* Any phone can precede tail */
+    al->ptail.rc = BAD_S3CIPID;     /* No successor */
+    al->ptail.pid = BAD_S3PID;
+    al->ptail.succlist = NULL;
+    al->ptail.predlist = NULL;
+    al->ptail.next = NULL;
+    al->ptail.id = -2;              /* Hardwired */
+    al->ptail.startstate = NULL;
+
+    al->n_pnode = 0;
+    al->pnode_list = NULL;
     oov = 0;
 
     /* State-level DAG initialization should be here in case the build is aborted */
-    shead.pnode = &phead;
-    shead.succlist = NULL;
-    shead.predlist = NULL;
-    shead.sen = BAD_S3SENID;
-    shead.state = mdef->n_emit_state;
-    shead.hist = NULL;
-
-    stail.pnode = &ptail;
-    stail.succlist = NULL;
-    stail.predlist = NULL;
-    stail.sen = BAD_S3SENID;
-    stail.state = 0;
-    stail.hist = NULL;
+    al->shead.pnode = &al->phead;
+    al->shead.succlist = NULL;
+    al->shead.predlist = NULL;
+    al->shead.sen = BAD_S3SENID;
+    al->shead.state = al->mdef->n_emit_state;
+    al->shead.hist = NULL;
+
+    al->stail.pnode = &al->ptail;
+    al->stail.succlist = NULL;
+    al->stail.predlist = NULL;
+    al->stail.sen = BAD_S3SENID;
+    al->stail.state = 0;
+    al->stail.hist = NULL;
 
     /* Obtain the first transcript word */
     k = nextword(wordstr, " \t\n", &wd, &delim);
     if (k < 0)
-        nextw = dict->finishwid;
+        nextw = al->dict->finishwid;
     else {
         wordstr = wd + k;
         wdcopy = ckd_salloc(wd);
         *wordstr = delim;
-        nextw = dict_wordid(dict, wdcopy);
+        nextw = dict_wordid(al->dict, wdcopy);
         if (IS_S3WID(nextw))
-            nextw = dict_basewid(dict, nextw);
+            nextw = dict_basewid(al->dict, nextw);
     }
 
     /* Create node(s) for <s> before any transcript word */
     word_end =
-        append_transcript_word(dict->startwid, &phead, nextw, 0,
+        append_transcript_word(al, al->dict->startwid, &al->phead, nextw, 0,
                                insert_sil);
 
     /* Append each word in transcription to partial sent HMM created so far */
@@ -890,111 +913,100 @@ align_build_sent_hmm(char *wordstr, int insert_sil)
             E_ERROR("%s not in dictionary\n", wdcopy);
             oov = 1;
             /* Hack!! Temporarily set w to some dummy just to run through sentence */
-            w = dict->finishwid;
+            w = al->dict->finishwid;
         }
         ckd_free(wdcopy);
 
         k = nextword(wordstr, " \t\n", &wd, &delim);
         if (k < 0)
-            nextw = dict->finishwid;
+            nextw = al->dict->finishwid;
         else {
             wordstr = wd + k;
             wdcopy = ckd_salloc(wd);
             *wordstr = delim;
-            nextw = dict_wordid(dict, wdcopy);
+            nextw = dict_wordid(al->dict, wdcopy);
             if (IS_S3WID(nextw))
-                nextw = dict_basewid(dict, nextw);
+                nextw = dict_basewid(al->dict, nextw);
         }
 
         word_end =
-            append_transcript_word(w, word_end, nextw, insert_sil,
+            append_transcript_word(al, w, word_end, nextw, insert_sil,
                                    insert_sil);
     }
-    if (oov)
+    if (oov) {
+        ckd_free(sent);
         return -1;
+    }
 
     /* Append phone HMMs for </s> at the end; link to tail node */
     word_end =
-        append_transcript_word(dict->finishwid, word_end, BAD_S3WID,
+        append_transcript_word(al, al->dict->finishwid, word_end, BAD_S3WID,
                                insert_sil, 0);
     for (node = word_end; node; node = node->next)
-        link_pnodes(node, &ptail);
+        link_pnodes(al, node, &al->ptail);
 
     /* Build state-level DAG from the phone-level one */
-    build_state_dag();
+    build_state_dag(al);
     /* Dag must begin and end at shead and stail, respectively */
-    assert(shead.succlist);
-    assert(stail.predlist);
-    assert(!shead.predlist);
-    assert(!stail.succlist);
+    assert(al->shead.succlist);
+    assert(al->stail.predlist);
+    assert(!al->shead.predlist);
+    assert(!al->stail.succlist);
 
 #if _DEBUG_ALIGN_
-    dump_sent_hmm();            /* For debugging */
+    dump_sent_hmm(al);            /* For debugging */
 #endif
 
-    k = n_pnode * mdef->n_emit_state;
-    if (k > active_list_size) { /* Need to grow active list arrays */
-        if (active_list_size > 0) {
-            ckd_free(cur_active);
-            ckd_free(next_active);
+    k = al->n_pnode * al->mdef->n_emit_state;
+    if (k > al->active_list_size) { /* Need to grow active list arrays */
+        if (al->active_list_size > 0) {
+            ckd_free(al->cur_active);
+            ckd_free(al->next_active);
         }
-        for (; active_list_size <= k;
-             active_list_size += ACTIVE_LIST_SIZE_INCR);
-        cur_active =
-            (snode_t **) ckd_calloc(active_list_size, sizeof(snode_t *));
-        next_active =
-            (snode_t **) ckd_calloc(active_list_size, sizeof(snode_t *));
+        for (; al->active_list_size <= k;
+             al->active_list_size += ACTIVE_LIST_SIZE_INCR);
+        al->cur_active =
+            (snode_t **) ckd_calloc(al->active_list_size, sizeof(snode_t *));
+        al->next_active =
+            (snode_t **) ckd_calloc(al->active_list_size, sizeof(snode_t *));
     }
+    al->sent = sent;
+    al->insert_sil = insert_sil;
 
     return 0;
 }
 
 
 int32
-align_destroy_sent_hmm(void)
+align_destroy_sent_hmm(align_t * al)
 {
-    pnode_t *p;
-
-    destroy_state_dag();
-
-    for (p = pnode_list; p; p = p->alloc_next) {
-        plinks_free(p->succlist);
-        plinks_free(p->predlist);
-    }
-    pnodes_free();
-
-    plinks_free(phead.succlist);
-    plinks_free(ptail.predlist);
-
+    sent_hmm_reset(al);
     return 0;
 }
 
 
 static history_t *
-lat_entry(snode_t * s)
+lat_entry(align_t * al, snode_t * s)
 {
     history_t *h;
 
-    h = (history_t *) ckd_calloc(1, sizeof(*h));
+    h = (history_t *) listelem_malloc(al->hist_alloc);
     h->snode = s;
     h->score = s->newscore;
     h->pred = s->newhist;
 
-    h->alloc_next = hist_head;
-    hist_head = h;
-
     return h;
 }
 
 
 static void
-activate(snode_t * s, int32 frm)
+activate(align_t * al, snode_t * s, int32 frm)
 {
     if (s->active_frm != frm) {
         assert(s->active_frm < frm);
 
         s->active_frm = frm;
-        next_active[n_active++] = s;
+        al->next_active[al->n_active++] = s;
     }
 }
 
@@ -1003,16 +1015,16 @@ activate(snode_t * s, int32 frm)
  * Flag the active senones. 
  */
 void
-align_sen_active(uint8 * senlist, int32 n_sen)
+align_sen_active(align_t * al, uint8 * senlist, int32 n_sen)
 {
     int32 i, sen;
 
     for (sen = 0; sen < n_sen; sen++)
         senlist[sen] = 0;
 
-    for (i = 0; cur_active[i]; i++) {
-        assert(IS_S3SENID(cur_active[i]->sen));
-        senlist[cur_active[i]->sen] = 1;
+    for (i = 0; al->cur_active[i]; i++) {
+        assert(IS_S3SENID(al->cur_active[i]->sen));
+        senlist[al->cur_active[i]->sen] = 1;
     }
 }
 
@@ -1023,22 +1035,22 @@ align_sen_active(uint8 * senlist, int32 n_sen)
  * initialized during sentence HMM building.
  */
 int32
-align_start_utt(char *uttid)
+align_start_utt(align_t * al, char *uttid)
 {
     slink_t *l;
 
-    curfrm = 0;
-    shead.score = 0;
-    shead.hist = NULL;
-    hist_head = NULL;
+    al->curfrm = 0;
+    al->shead.score = 0;
+    al->shead.hist = NULL;
+    listelem_alloc_reset(al->hist_alloc);
 
-    n_active = 0;
-    for (l = shead.succlist; l; l = l->next) {
+    al->n_active = 0;
+    for (l = al->shead.succlist; l; l = l->next) {
         assert(l->node->active_frm < 0);
         l->node->active_frm = 0;
-        cur_active[n_active++] = l->node;
+        al->cur_active[al->n_active++] = l->node;
     }
-    cur_active[n_active++] = NULL;
+    al->cur_active[al->n_active++] = NULL;
 
     return 0;
 }
@@ -1048,7 +1060,7 @@ align_start_utt(char *uttid)
  * One frame of Viterbi time alignment.
  */
 int32
-align_frame(int32 * senscr)
+align_frame(align_t * al, int32 * senscr)
 {
     int32 i, scr, tmpbest, bestscore, nf, thresh;
     snode_t *s, *ps;
@@ -1056,20 +1068,20 @@ align_frame(int32 * senscr)
     history_t *tmphist = NULL;
     snode_t **tmpswap;
 
-    nf = curfrm + 1;
-    n_active = 0;
+    nf = al->curfrm + 1;
+    al->n_active = 0;
 
     /* For each active state update state score and history */
     bestscore = (int32) 0x80000000;
-    for (i = 0; cur_active[i]; i++) {
-        s = cur_active[i];
+    for (i = 0; al->cur_active[i]; i++) {
+        s = al->cur_active[i];
         assert(IS_S3SENID(s->sen));
 
         tmpbest = (int32) 0x80000000;
         for (l = s->predlist; l; l = l->next) {
             ps = l->node;
 
-            if (ps->active_frm == curfrm) {
+            if (ps->active_frm == al->curfrm) {
                 scr = ps->score + l->prob;
 
                 if (scr > tmpbest) {
@@ -1088,25 +1100,25 @@ align_frame(int32 * senscr)
     }
 
     if (bestscore <= S3_LOGPROB_ZERO)
-        E_ERROR("Bestscore= %d in frame %d\n", bestscore, curfrm);
-    score_scale[curfrm] = bestscore;
-    thresh = bestscore + beam;
+        E_ERROR("Bestscore= %d in frame %d\n", bestscore, al->curfrm);
+    al->score_scale[al->curfrm] = bestscore;
+    thresh = bestscore + al->beam;
 
     /* Update history lattice for each active state */
-    for (i = 0; cur_active[i]; i++) {
-        s = cur_active[i];
+    for (i = 0; al->cur_active[i]; i++) {
+        s = al->cur_active[i];
 
         if (s->newscore >= thresh) {
             s->newscore -= bestscore;   /* Scale, to avoid underflow */
             s->score = s->newscore;
 
-            s->hist = lat_entry(s);
-            activate(s, nf);
+            s->hist = lat_entry(al, s);
+            activate(al, s, nf);
 
             /* Also activate successor nodes of s as they are reachable next frame */
             for (l = s->succlist; l; l = l->next) {
                 if (IS_S3SENID(l->node->sen))
-                    activate(l->node, nf);
+                    activate(al, l->node, nf);
             }
         }
         else {
@@ -1116,32 +1128,32 @@ align_frame(int32 * senscr)
     }
 
     /* Update active state list */
-    next_active[n_active] = NULL;
-    tmpswap = cur_active;
-    cur_active = next_active;
-    next_active = tmpswap;
+    al->next_active[al->n_active] = NULL;
+    tmpswap = al->cur_active;
+    al->cur_active = al->next_active;
+    al->next_active = tmpswap;
 
-    curfrm = nf;
+    al->curfrm = nf;
 
     return 0;
 }
 
 
 static void
-build_stseg(history_t * rooth)
+build_stseg(align_t * al, history_t * rooth)
 {
     history_t *h, *prevh;
     align_stseg_t *stseg, *tail = NULL;
     int32 f, prevscr;
 
-    assert(align_stseg == NULL);
+    assert(al->align_stseg == NULL);
 
     prevscr = 0;
     prevh = NULL;
     for (f = 0, h = rooth; h; h = h->pred, f++) {
-        stseg = (align_stseg_t *) ckd_calloc(1, sizeof(*stseg));
-        if (!align_stseg)
-            align_stseg = stseg;
+        stseg = (align_stseg_t *) listelem_malloc(al->stseg_alloc);
+        if (!al->align_stseg)
+            al->align_stseg = stseg;
         else
             tail->next = stseg;
         tail = stseg;
@@ -1153,7 +1165,7 @@ build_stseg(history_t * rooth)
         stseg->start = ((!prevh)
                         || (prevh->snode->pnode->id !=
                             h->snode->pnode->id));
-        stseg->score = h->score - prevscr + score_scale[f];
+        stseg->score = h->score - prevscr + al->score_scale[f];
         stseg->bsdiff = h->score;
 
         prevscr = h->score;
@@ -1163,13 +1175,13 @@ build_stseg(history_t * rooth)
 
 
 static void
-build_phseg(history_t * rooth)
+build_phseg(align_t * al, history_t * rooth)
 {
     history_t *h, *nh;
     align_phseg_t *phseg, *tail = NULL;
     int32 f, prevf, prevscr, scale, bsdiff;
 
-    assert(align_phseg == NULL);
+    assert(al->align_phseg == NULL);
 
     prevscr = 0;
     bsdiff = 0;
@@ -1178,14 +1190,13 @@ build_phseg(history_t * rooth)
 
     for (f = 0, h = rooth; h; h = h->pred, f++) {
         bsdiff += h->score;
-        scale += score_scale[f];
+        scale += al->score_scale[f];
 
         nh = h->pred;
         if ((!nh) || (nh->snode->pnode->id != h->snode->pnode->id)) {
-            phseg =
-                (align_phseg_t *) ckd_calloc(1, sizeof(*phseg));
-            if (!align_phseg)
-                align_phseg = phseg;
+            phseg = (align_phseg_t *) listelem_malloc(al->phseg_alloc);
+            if (!al->align_phseg)
+                al->align_phseg = phseg;
             else
                 tail->next = phseg;
             tail = phseg;
@@ -1207,13 +1218,13 @@ build_phseg(history_t * rooth)
 
 
 static void
-build_wdseg(history_t * rooth)
+build_wdseg(align_t * al, history_t * rooth)
 {
     history_t *h, *nh;
     align_wdseg_t *wdseg, *tail = NULL;
     int32 f, prevf, prevscr, scale, bsdiff;
 
-    assert(align_wdseg == NULL);
+    assert(al->align_wdseg == NULL);
 
     prevscr = 0;
     bsdiff = 0;
@@ -1222,15 +1233,14 @@ build_wdseg(history_t * rooth)
 
     for (f = 0, h = rooth; h; h = h->pred, f++) {
         bsdiff += h->score;
-        scale += score_scale[f];
+        scale += al->score_scale[f];
 
         nh = h->pred;
         if ((!nh) || ((nh->snode->pnode->id != h->snode->pnode->id) && (nh->snode->pnode->pos == 0))) { /* End of current word */
 
-            wdseg =
-                (align_wdseg_t *) ckd_calloc(1, sizeof(*wdseg));
-            if (!align_wdseg)
-                align_wdseg = wdseg;
+            wdseg = (align_wdseg_t *) listelem_malloc(al->wdseg_alloc);
+            if (!al->align_wdseg)
+                al->align_wdseg = wdseg;
             else
                 tail->next = wdseg;
             tail = wdseg;
@@ -1255,123 +1265,122 @@ build_wdseg(history_t * rooth)
  * All frames consumed.  Trace back best Viterbi state sequence and dump it out.
  */
 int32
-align_end_utt(align_stseg_t ** stseg_out,
+align_end_utt(align_t * al, align_stseg_t ** stseg_out,
               align_phseg_t ** phseg_out, align_wdseg_t ** wdseg_out)
 {
     slink_t *l;
     snode_t *s;
     history_t *h, *ph, *nh;
-    align_stseg_t *stseg;
-    align_phseg_t *phseg;
-    align_wdseg_t *wdseg;
 
     /* Free up previous result, if any */
-    while (align_stseg) {
-        stseg = align_stseg->next;
-        ckd_free((char *) align_stseg);
-        align_stseg = stseg;
-    }
-    while (align_phseg) {
-        phseg = align_phseg->next;
-        ckd_free((char *) align_phseg);
-        align_phseg = phseg;
-    }
-    while (align_wdseg) {
-        wdseg = align_wdseg->next;
-        ckd_free((char *) align_wdseg);
-        align_wdseg = wdseg;
-    }
+    listelem_alloc_reset(al->stseg_alloc);
+    listelem_alloc_reset(al->phseg_alloc);
+    listelem_alloc_reset(al->wdseg_alloc);
+    al->align_stseg = NULL;
+    al->align_phseg = NULL;
+    al->align_wdseg = NULL;
 
     /* First find best ending history and link to stail */
-    stail.score = (int32) 0x80000000;
-    stail.hist = NULL;
-    for (l = stail.predlist; l; l = l->next) {
+    al->stail.score = (int32) 0x80000000;
+    al->stail.hist = NULL;
+    for (l = al->stail.predlist; l; l = l->next) {
         s = l->node;
-        if ((s->active_frm == curfrm)
-            && (s->score + l->prob > stail.score)) {
-            stail.score = s->score + l->prob;
-            stail.hist = s->hist;
+        if ((s->active_frm == al->curfrm)
+            && (s->score + l->prob > al->stail.score)) {
+            al->stail.score = s->score + l->prob;
+            al->stail.hist = s->hist;
         }
     }
 
-    if (stail.hist) {
+    if (al->stail.hist) {
         /* Reverse the best Viterbi path (back trace) so it is forward in time */
         nh = NULL;
-        for (h = stail.hist; h; h = ph) {
+        for (h = al->stail.hist; h; h = ph) {
             ph = h->pred;
             h->pred = nh;
             nh = h;
         }
 
         /* Trace state, phone, and word segmentations */
-        build_stseg(nh);
-        build_phseg(nh);
-        build_wdseg(nh);
+        build_stseg(al, nh);
+        build_phseg(al, nh);
+        build_wdseg(al, nh);
     }
 
-    *stseg_out = align_stseg;
-    *phseg_out = align_phseg;
-    *wdseg_out = align_wdseg;
-
-    /* delete history list */
-    while (hist_head) {
-        h = hist_head->alloc_next;
-        ckd_free((char *) hist_head);
-        hist_head = h;
-    }
+    *stseg_out = al->align_stseg;
+    *phseg_out = al->align_phseg;
+    *wdseg_out = al->align_wdseg;
 
-    return (stail.hist ? 0 : -1);
+    return (al->stail.hist ? 0 : -1);
 }
 
 
-int32
+align_t *
 align_init(mdef_t * _mdef, tmat_t * _tmat, dict_t * _dict, cmd_ln_t *_config, logmath_t * _logmath)
 {
+    align_t *al;
     int32 k;
     s3wid_t w;
 
-    mdef = _mdef;
-    tmat = _tmat;
-    dict = _dict;
+    al = (align_t *) ckd_calloc(1, sizeof(*al));
+    al->mdef = _mdef;
+    al->tmat = _tmat;
+    al->dict = _dict;
 
-    assert(mdef);
-    assert(tmat);
-    assert(dict);
+    assert(al->mdef);
+    assert(al->tmat);
+    assert(al->dict);
 
     /* Create list of optional filler words to be inserted between transcript words */
-    fillwid =
-        (s3wid_t *) ckd_calloc((dict->filler_end - dict->filler_start + 3),
+    al->fillwid =
+        (s3wid_t *) ckd_calloc((al->dict->filler_end - al->dict->filler_start + 3),
                                sizeof(s3wid_t));
     k = 0;
-    if (IS_S3WID(dict->silwid))
-        fillwid[k++] = dict->silwid;
-    for (w = dict->filler_start; w <= dict->filler_end; w++) {
-        if ((dict_basewid(dict, w) == w) &&
-            (w != dict->silwid) && (w != dict->startwid)
-            && (w != dict->finishwid))
-            fillwid[k++] = w;
+    if (IS_S3WID(al->dict->silwid))
+        al->fillwid[k++] = al->dict->silwid;
+    for (w = al->dict->filler_start; w <= al->dict->filler_end; w++) {
+        if ((dict_basewid(al->dict, w) == w) &&
+            (w != al->dict->silwid) && (w != al->dict->startwid)
+            && (w != al->dict->finishwid))
+            al->fillwid[k++] = w;
     }
-    fillwid[k] = BAD_S3WID;
-
-    beam = logs3(_logmath, cmd_ln_float64_r(_config, "-beam"));
-    E_INFO("logs3(beam)= %d\n", beam);
+    al->fillwid[k] = BAD_S3WID;
 
-    score_scale = (int32 *) ckd_calloc(S3_MAX_FRAMES, sizeof(int32));
+    al->beam = logs3(_logmath, cmd_ln_float64_r(_config, "-beam"));
+    E_INFO("logs3(beam)= %d\n", al->beam);
 
-    hist_head = NULL;
+    al->score_scale = (int32 *) ckd_calloc(S3_MAX_FRAMES, sizeof(int32));
 
-    align_stseg = NULL;
-    align_phseg = NULL;
-    align_wdseg = NULL;
+    al->pnode_alloc = listelem_alloc_init(sizeof(pnode_t));
+    al->plink_alloc = listelem_alloc_init(sizeof(plink_t));
+    al->snode_alloc = listelem_alloc_init((al->mdef->n_emit_state + 1)
+                                          * sizeof(snode_t));
+    al->slink_alloc = listelem_alloc_init(sizeof(slink_t));
+    al->hist_alloc = listelem_alloc_init(sizeof(history_t));
+    al->stseg_alloc = listelem_alloc_init(sizeof(align_stseg_t));
+    al->phseg_alloc = listelem_alloc_init(sizeof(align_phseg_t));
+    al->wdseg_alloc = listelem_alloc_init(sizeof(align_wdseg_t));
 
-    return 0;
+    return al;
 }
 
 void
-align_free(void)
+align_free(align_t * al)
 {
-    if (fillwid)
-        ckd_free(fillwid);
-    if (score_scale)
-        ckd_free(score_scale);
+    if (al == NULL)
+        return;
+    ckd_free(al->fillwid);
+    ckd_free(al->score_scale);
+    ckd_free(al->cur_active);
+    ckd_free(al->next_active);
+    ckd_free(al->sent);
+    listelem_alloc_free(al->pnode_alloc);
+    listelem_alloc_free(al->plink_alloc);
+    listelem_alloc_free(al->snode_alloc);
+    listelem_alloc_free(al->slink_alloc);
+    listelem_alloc_free(al->hist_alloc);
+    listelem_alloc_free(al->stseg_alloc);
+    listelem_alloc_free(al->phseg_alloc);
+    listelem_alloc_free(al->wdseg_alloc);
+    ckd_free(al);
 }
@@ -155,29 +155,45 @@ typedef struct align_wdseg_s {
 } align_wdseg_t;
 
 
-int32 align_init(mdef_t * _mdef, tmat_t * _tmat, dict_t * _dict, cmd_ln_t *_config, logmath_t *_logmath);
+/**
+ * Time aligner.  Each one holds its own sentence HMM, search state and
+ * results, so several of them can align utterances in different threads
+ * over the same (read-only) models.
+ */
+typedef struct align_s align_t;
+
+/** Create a time aligner. */
+align_t *align_init(mdef_t * _mdef, tmat_t * _tmat, dict_t * _dict, cmd_ln_t *_config, logmath_t *_logmath);
 
-void align_free(void);
+void align_free(align_t *al);
 
-int32 align_build_sent_hmm(char *transcript,  /**< In: Word transcript */
+/**
+ * Build the sentence HMM for a transcript.  If it is the same as the
+ * last one built (and not destroyed since), that HMM is kept and only
+ * its scores are reset.
+ */
+int32 align_build_sent_hmm(align_t *al,
+                           char *transcript,  /**< In: Word transcript */
                            int insert_sil     /**< In: Whether to insert silences/fillers */
     );
 
-int32 align_destroy_sent_hmm(void);
+int32 align_destroy_sent_hmm(align_t *al);
 
-int32 align_start_utt(char *uttid);
+int32 align_start_utt(align_t *al, char *uttid);
 
 /**
  * Called at the beginning of a frame to flag the active senones (any senone used
  * by active HMMs) in that frame.
  */
-void align_sen_active(uint8 * senlist,  /**< Out: senlist[s] TRUE iff active in frame */
+void align_sen_active(align_t *al,
+                      uint8 * senlist,  /**< Out: senlist[s] TRUE iff active in frame */
                       int32 n_sen               /**< In: Size of senlist[] array */
     );
 
 
 /** Step time aligner one frame forward */
-int32 align_frame(int32 * senscr                /**< In: array of senone scores this frame */
+int32 align_frame(align_t *al,
+                  int32 * senscr                /**< In: array of senone scores this frame */
     );
 
 
@@ -185,7 +201,8 @@ int32 align_frame(int32 * senscr                /**< In: array of senone scores
  * Wind up utterance and return final result (READ-ONLY).  Results only valid until
  * the next utterance is begun.
  */
-int32 align_end_utt(align_stseg_t ** stseg,     /**< Out: list of state segmentation */
+int32 align_end_utt(align_t *al,
+                    align_stseg_t ** stseg,     /**< Out: list of state segmentation */
                     align_phseg_t ** phseg,     /**< Out: list of phone segmentation */
                     align_wdseg_t ** wdseg      /**< Out: list of word segmentation */
     );
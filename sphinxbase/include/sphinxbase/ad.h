@@ -118,6 +118,36 @@ int32 ad_close (ad_rec_t *);
 SPHINXBASE_EXPORT
 int32 ad_read (ad_rec_t *, int16 *buf, int32 max);
 
+/**
+ * Function called with each block of audio captured by
+ * ad_start_callback().
+ *
+ * It runs in the capture thread, and buf points into the device's own
+ * buffer, which is only valid until it returns.  It should pass the
+ * samples on (e.g. to ps_process_raw()) without blocking for longer
+ * than a period, or the device will overrun.
+ */
+typedef void (*ad_callback_t)(ad_rec_t *ad, int16 const *buf,
+                              int32 n_samples, void *user_data);
+
+/**
+ * Start recording, delivering audio to a callback from a capture
+ * thread as soon as each period is available, rather than waiting
+ * for ad_read().  ad_stop_rec() stops the thread before returning.
+ *
+ * @return 0 if successful, AD_ERR_GEN if this device (or backend)
+ * does not support it, in which case use ad_start_rec() and ad_read().
+ */
+SPHINXBASE_EXPORT
+int32 ad_start_callback(ad_rec_t *, ad_callback_t cb, void *user_data);
+
+/**
+ * Number of times the device has overrun, losing audio, since it was
+ * opened.  Backends that cannot tell always return 0.
+ */
+SPHINXBASE_EXPORT
+int32 ad_n_overruns(ad_rec_t *);
+
 
 #ifdef __cplusplus
 }
@@ -136,6 +136,63 @@ bitvec_t *bitvec_realloc(bitvec_t *vec,	/* In: Bit vector to search */
 
 #define bitvec_is_clear(v,b)	(! (bitvec_is_set(v,b)))
 
+/**
+ * Index of the lowest set bit in the nonzero bitvec_t word w.
+ */
+#if defined(__GNUC__)
+#define bitvec_ctz(w)		__builtin_ctz(w)
+#else
+#define bitvec_ctz(w)		bitvec_ctz_generic(w)
+#endif
+
+/**
+ * Number of bits set in the bitvec_t word w.
+ */
+#if defined(__GNUC__)
+#define bitvec_popcount(w)	__builtin_popcount(w)
+#else
+#define bitvec_popcount(w)	bitvec_popcount_generic(w)
+#endif
+
+/**
+ * Portable versions of bitvec_ctz() and bitvec_popcount().
+ */
+SPHINXBASE_EXPORT
+int bitvec_ctz_generic(bitvec_t w);
+SPHINXBASE_EXPORT
+int bitvec_popcount_generic(bitvec_t w);
+
+/**
+ * Find the next set bit in a bit vector.
+ *
+ * Whole words of clear bits are skipped at once, so iterating over
+ * the set bits with this is proportional to the number of words plus
+ * the number of set bits, not the number of bits:
+ *
+ * <code>
+ * for (b = bitvec_next_set(v, len, 0); b < len; b = bitvec_next_set(v, len, b + 1))
+ * </code>
+ *
+ * @param vec is the bit vector
+ * @param len is the length of bit vector <code>vec</code>
+ * @param b is the first bit to look at
+ * @return the index of the first set bit at or after <code>b</code>,
+ *         or <code>len</code> if there is none.
+ */
+SPHINXBASE_EXPORT
+size_t bitvec_next_set(bitvec_t const *vec, size_t len, size_t b);
+
+/**
+ * Set in dst all the bits that are set in src.
+ *
+ * @param dst is the bit vector to update
+ * @param src is the bit vector to merge into it
+ * @param len is the length of both bit vectors
+ * @return the number of bits set in <code>dst</code> afterwards
+ */
+SPHINXBASE_EXPORT
+size_t bitvec_or(bitvec_t *dst, bitvec_t const *src, size_t len);
+
 
 /**
  * Return the number of bits set in the given bitvector.
@@ -302,6 +302,86 @@ void ckd_free_4d(void *ptr);
  */
 #define ckd_free_3d_ptr(bf) ckd_free_2d(bf)
 
+/**
+ * Arena ("bump") allocator.
+ *
+ * An arena hands out memory from large blocks, and frees it all at
+ * once.  This suits structures which live for one utterance: the
+ * arena is reset at the end of it, which keeps its blocks for the
+ * next one.  Scopes may be nested by taking a mark with
+ * ckd_arena_mark() and later releasing everything allocated since
+ * then with ckd_arena_release().
+ */
+typedef struct arena_s arena_t;
+
+/**
+ * Position in an arena, returned by ckd_arena_mark().
+ */
+typedef struct arena_mark_s {
+    struct arena_blk_s *blk; /**< Current block. */
+    size_t pos;              /**< Offset of free space in blk. */
+} arena_mark_t;
+
+/**
+ * Create an arena.
+ *
+ * @param blksize Size of blocks to allocate, or 0 for a default.
+ * Larger allocations get a block of their own.
+ */
+SPHINXBASE_EXPORT
+arena_t *ckd_arena_init(size_t blksize);
+
+/**
+ * Free an arena and everything allocated from it.
+ */
+SPHINXBASE_EXPORT
+void ckd_arena_free(arena_t *arena);
+
+/**
+ * Free everything allocated from an arena, keeping its blocks for
+ * reuse.
+ */
+SPHINXBASE_EXPORT
+void ckd_arena_reset(arena_t *arena);
+
+/**
+ * Get the current position in an arena, to start a nested scope.
+ */
+SPHINXBASE_EXPORT
+arena_mark_t ckd_arena_mark(arena_t *arena);
+
+/**
+ * Free everything allocated from an arena since mark was taken.
+ */
+SPHINXBASE_EXPORT
+void ckd_arena_release(arena_t *arena, arena_mark_t mark);
+
+/**
+ * Allocate zeroed memory from an arena, like calloc().  There is no
+ * way to free it except through ckd_arena_release(),
+ * ckd_arena_reset() or ckd_arena_free().
+ */
+SPHINXBASE_EXPORT
+void *__ckd_arena_calloc__(arena_t *arena, size_t n_elem, size_t elem_size,
+                           const char *caller_file, int caller_line);
+
+/**
+ * Like ckd_salloc(), but copy the string into an arena.
+ */
+SPHINXBASE_EXPORT
+char *__ckd_arena_salloc__(arena_t *arena, const char *origstr,
+                           const char *caller_file, int caller_line);
+
+/**
+ * Macro for __ckd_arena_calloc__
+ */
+#define ckd_arena_calloc(a,n,sz) __ckd_arena_calloc__((a),(n),(sz),__FILE__,__LINE__)
+
+/**
+ * Macro for __ckd_arena_salloc__
+ */
+#define ckd_arena_salloc(a,s)	__ckd_arena_salloc__((a),(s),__FILE__,__LINE__)
+
 
 #ifdef __cplusplus
 }
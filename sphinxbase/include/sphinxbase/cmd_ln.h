@@ -207,6 +207,19 @@ cmd_ln_t *cmd_ln_init(cmd_ln_t *inout_cmdln, arg_t const *defn, int32 strict, ..
 SPHINXBASE_EXPORT
 cmd_ln_t *cmd_ln_retain(cmd_ln_t *cmdln);
 
+/**
+ * Make an independent copy of a command-line argument set.
+ *
+ * The copy shares its values with the original until either of them
+ * is modified, so this is cheap enough to do for every decoder
+ * created from a common configuration.
+ *
+ * @return a new command-line object with a reference count of 1,
+ *         which must be freed with cmd_ln_free_r().
+ */
+SPHINXBASE_EXPORT
+cmd_ln_t *cmd_ln_clone(cmd_ln_t *cmdln);
+
 /**
  * Release a command-line argument set and all associated strings.
  *
@@ -333,6 +346,55 @@ double cmd_ln_float_r(cmd_ln_t *cmdln, char const *name);
  */
 #define cmd_ln_boolean_r(c,n) (cmd_ln_int_r(c,n) != 0)
 
+/**
+ * Handle for an argument, resolved once with cmd_ln_key_r().
+ *
+ * A key stays valid for the command-line object it was resolved in
+ * and for any clones of it, and lets the value be retrieved without
+ * looking up its name.  It is invalidated if the object is freed.
+ */
+typedef int32 cmd_ln_key_t;
+#define CMD_LN_NO_KEY ((cmd_ln_key_t)-1)
+
+/**
+ * Resolve an argument name to a key.
+ *
+ * @return the key for <tt>name</tt>, or CMD_LN_NO_KEY if it does not
+ *         exist.
+ */
+SPHINXBASE_EXPORT
+cmd_ln_key_t cmd_ln_key_r(cmd_ln_t *cmdln, char const *name);
+
+/**
+ * Access the generic type union for a key.
+ *
+ * @return the value, or NULL if <tt>key</tt> is not valid.
+ */
+SPHINXBASE_EXPORT
+anytype_t *cmd_ln_access_k(cmd_ln_t *cmdln, cmd_ln_key_t key);
+
+/**
+ * Retrieve a string by key, as with cmd_ln_str_r().
+ */
+SPHINXBASE_EXPORT
+char const *cmd_ln_str_k(cmd_ln_t *cmdln, cmd_ln_key_t key);
+
+/**
+ * Retrieve an integer by key, as with cmd_ln_int_r().
+ */
+SPHINXBASE_EXPORT
+long cmd_ln_int_k(cmd_ln_t *cmdln, cmd_ln_key_t key);
+
+/**
+ * Retrieve a floating-point number by key, as with cmd_ln_float_r().
+ */
+SPHINXBASE_EXPORT
+double cmd_ln_float_k(cmd_ln_t *cmdln, cmd_ln_key_t key);
+
+#define cmd_ln_boolean_k(c,k)	(cmd_ln_int_k(c,k) != 0)
+#define cmd_ln_int32_k(c,k)	(int32)cmd_ln_int_k(c,k)
+#define cmd_ln_float32_k(c,k)	(float32)cmd_ln_float_k(c,k)
+
 /**
  * Set a string in a command-line object.
  *
@@ -110,7 +110,8 @@ extern "C" {
 typedef enum cmn_type_e {
     CMN_NONE = 0,
     CMN_BATCH,
-    CMN_LIVE
+    CMN_LIVE,
+    CMN_EMA     /**< Live, with an exponential moving window. */
 } cmn_type_t;
 
 /** String representations of cmn_type_t values. */
@@ -129,8 +130,12 @@ typedef struct {
     mfcc_t *cmn_mean;   /**< Temporary variable: current means */
     mfcc_t *cmn_var;    /**< Temporary variables: stored the cmn variance */
     mfcc_t *sum;        /**< The sum of the cmn frames */
+    mfcc_t *sumsq;      /**< The sum of squares of the cmn frames (not
+                           kept in fixed point) */
     int32 nframe;	/**< Number of frames */
     int32 veclen;	/**< Length of cepstral vector */
+    uint8 ema;          /**< Whether live CMN uses an exponential moving
+                           window rather than shifting it in steps */
 } cmn_t;
 
 SPHINXBASE_EXPORT
@@ -152,13 +157,20 @@ void cmn (cmn_t *cmn,   /**< In/Out: cmn normalization, which contains the cmn_m
 #define CMN_WIN         500
 
 /**
- * CMN for one block of data, using live mean
+ * CMN for one block of data, using live mean.
+ *
+ * The mean (and, with varnorm, the inverse standard deviations) used
+ * are those of the frames seen up to the last cmn_live_update(),
+ * unless cmn->ema is set, in which case the mean is updated after
+ * every frame, with the frames older than about CMN_WIN decaying
+ * exponentially.  Variance normalization is not available in fixed
+ * point.
  */
 SPHINXBASE_EXPORT
 void cmn_live(cmn_t *cmn,        /**< In/Out: cmn normalization, which contains
                                     the cmn_mean and cmn_var) */
                mfcc_t **incep,  /**< In/Out: mfc[f] = mfc vector in frame f*/
-	       int32 varnorm,    /**< This flag should always be 0 for live */
+	       int32 varnorm,    /**< Also normalize the variance */
 	       int32 nfr         /**< Number of incoming frames */
     );
 
@@ -180,6 +192,28 @@ void cmn_live_set(cmn_t *cmn, mfcc_t const *vec);
 SPHINXBASE_EXPORT
 void cmn_live_get(cmn_t *cmn, mfcc_t *vec);
 
+/**
+ * Set the live mean and variances from a file written by
+ * cmn_live_write(), for instance one kept for each channel or speaker
+ * from the end of its last stream, so that a new stream starts out
+ * normalized.
+ *
+ * The file has the means on one line, and optionally the variances
+ * on the next.
+ *
+ * @return 0, or -1 on failure.
+ */
+SPHINXBASE_EXPORT
+int cmn_live_read(cmn_t *cmn, char const *file);
+
+/**
+ * Write the live mean and variances to a file.
+ *
+ * @return 0, or -1 on failure.
+ */
+SPHINXBASE_EXPORT
+int cmn_live_write(cmn_t *cmn, char const *file);
+
 /* RAH, free previously allocated memory */
 SPHINXBASE_EXPORT
 void cmn_free (cmn_t *cmn);
@@ -136,6 +136,11 @@ extern "C" {
     ARG_STRINGIFY(DEFAULT_SAMPLING_RATE), \
     "Sampling rate" }, \
    \
+  { "-input_samprate", \
+    ARG_FLOAT32, \
+    "0", \
+    "Sampling rate of input audio, if different from -samprate (it will be resampled)" }, \
+   \
   { "-frate", \
     ARG_INT32, \
     ARG_STRINGIFY(DEFAULT_FRAME_RATE), \
@@ -337,6 +342,21 @@ arg_t const *fe_get_args(void);
 SPHINXBASE_EXPORT
 fe_t *fe_init_auto_r(cmd_ln_t *config);
 
+/**
+ * Create a new front end for another audio stream, sharing the
+ * read-only tables (filterbank, DCT, window, twiddle factors) of an
+ * existing one.
+ *
+ * The clone has its own buffers, pre-emphasis, noise statistics and
+ * VAD state, so it can be used on a different stream (or in a
+ * different thread) from the original.  It holds a reference to the
+ * original, which is released when the clone is freed.
+ *
+ * @return Newly created front-end object.
+ */
+SPHINXBASE_EXPORT
+fe_t *fe_clone(fe_t *fe);
+
 /**
  * Retrieve the command-line object used to initialize this front-end.
  *
@@ -370,6 +390,10 @@ int fe_start_utt(fe_t *fe);
  * the <tt>-logspec</tt> or <tt>-smoothspec</tt> options to
  * fe_init_auto() were true.
  *
+ * If warp candidates were set with fe_set_warp_candidates(), each
+ * frame holds the output for every candidate after the usual one, so
+ * this is that many times larger.
+ *
  * @param fe Front-end object
  * @return Dimensionality of front-end output.
  */
@@ -401,6 +425,17 @@ void fe_get_input_size(fe_t *fe, int *out_frame_shift,
 SPHINXBASE_EXPORT
 uint8 fe_get_vad_state(fe_t *fe);
 
+/**
+ * Get the number of silence frames since the last speech frame,
+ * which are still counted as speech until there are -vad_postspeech
+ * of them.
+ *
+ * @return number of frames, 0 if the last frame was speech or the
+ *         speech has ended.
+ */
+SPHINXBASE_EXPORT
+int32 fe_get_vad_silence(fe_t *fe);
+
 /**
  * Finish processing an utterance.
  *
@@ -443,7 +478,11 @@ int fe_free(fe_t *fe);
  *
  * DO NOT MIX fe_process_frames calls
  *
- * @param voiced_spch Output: obtain voiced audio samples here
+ * @param voiced_spch Output: obtain voiced audio samples here, one
+ *                    frame shift per frame of speech, starting with
+ *                    the prespeech frames when speech begins.  It
+ *                    must have room for (*inout_nframes + pre-speech
+ *                    frames + 1) frame shifts of samples.
  *
  * @param voiced_spch_nsamps Output: shows voiced_spch length
  *
@@ -489,6 +528,11 @@ int fe_process_frames_ext(fe_t *fe,
  *          do_some_stuff(cepstra, nframes);
  *  }
  *
+ * If <code>-input_samprate</code> differs from <code>-samprate</code>,
+ * the input is at <code>-input_samprate</code> and is resampled as it
+ * is processed.  Frame indices and voiced speech are always at
+ * <code>-samprate</code>.
+ *
  * @param inout_spch Input: Pointer to pointer to speech samples
  *                   (signed 16-bit linear PCM).
  *                   Output: Pointer to remaining samples.
@@ -516,6 +560,97 @@ int fe_process_frames(fe_t *fe,
                       int32 *inout_nframes,
                       int32 *out_frameidx);
 
+/**
+ * Process blocks of samples from several streams at once.
+ *
+ * This is equivalent to calling fe_process_frames() on each of
+ * <code>fe[0..nstreams-1]</code>, with the arguments taken from the
+ * corresponding elements of the other arrays.  Each stream must have
+ * its own front end (usually created with fe_clone()) with the same
+ * frame size, frame shift and output size.
+ *
+ * @param fe Array of front-end objects, one per stream.
+ * @param nstreams Number of streams.
+ * @param inout_spch Array of pointers to each stream's sample pointer.
+ * @param inout_nsamps Array of sample counts.
+ * @param buf_cep Array of output buffers, or NULL to only count frames.
+ * @param inout_nframes Array of frame counts.
+ * @param out_frameidx Array of first frame indices, or NULL.
+ * @return 0 for success, <0 for failure in any of the streams (see
+ *         enum fe_error_e)
+ */
+SPHINXBASE_EXPORT
+int fe_process_frames_batch(fe_t **fe, int nstreams,
+                            int16 const ***inout_spch,
+                            size_t *inout_nsamps,
+                            mfcc_t ***buf_cep,
+                            int32 *inout_nframes,
+                            int32 *out_frameidx);
+
+/**
+ * Compute features for several VTLN warp candidates at once.
+ *
+ * After this, every frame output by fe_process_frames() and
+ * fe_end_utt() holds the usual features followed by those computed
+ * with each of the candidate warps, in order, all from the same power
+ * spectrum.  fe_get_output_size() grows accordingly.  Noise removal
+ * is only applied to the usual features, so if they are to be
+ * compared with the candidates, use <tt>-remove_noise no</tt>.
+ *
+ * This must be called between utterances, and before any clones of
+ * the front end are made (they share the candidates).
+ *
+ * @param fe Front-end object.
+ * @param warp_type Type of warping for the candidates (see
+ *                  <tt>-warp_type</tt>), or NULL for that of the
+ *                  front end.
+ * @param warp_params Array of parameter strings (see
+ *                    <tt>-warp_params</tt>), one per candidate.
+ * @param n_warp Number of candidates, or 0 to stop computing them.
+ * @return 0 for success, <0 for failure (see enum fe_error_e)
+ */
+SPHINXBASE_EXPORT
+int fe_set_warp_candidates(fe_t *fe, char const *warp_type,
+                           char const * const *warp_params, int n_warp);
+
+/**
+ * Get the parameters of a warp candidate.
+ *
+ * @return parameter string for candidate <code>idx</code>, or NULL if
+ *         there is no such candidate.
+ */
+SPHINXBASE_EXPORT
+char const *fe_get_warp_candidate(fe_t *fe, int idx);
+
+/**
+ * Score the features for one warp candidate.
+ *
+ * @param udata Data passed to fe_select_warp().
+ * @param cep Features for the candidate, one row per frame.
+ * @param nfr Number of frames.
+ * @return Score, higher being better (e.g. log-likelihood under a
+ *         speaker-independent model).
+ */
+typedef float64 (*fe_warp_score_f)(void *udata, mfcc_t **cep, int32 nfr);
+
+/**
+ * Pick the best warp candidate for some features.
+ *
+ * @param fe Front-end object with warp candidates.
+ * @param buf_cep Frames output by fe_process_frames() with the
+ *                candidates set.
+ * @param nfr Number of frames.
+ * @param score Function to score each candidate's features.
+ * @param udata Data passed to <code>score</code>.
+ * @param out_score Output: score of the best candidate, or NULL.
+ * @return Index of the best candidate (the first one in case of a
+ *         tie), or <0 for failure (see enum fe_error_e)
+ */
+SPHINXBASE_EXPORT
+int fe_select_warp(fe_t *fe, mfcc_t **buf_cep, int32 nfr,
+                   fe_warp_score_f score, void *udata,
+                   float64 *out_score);
+
 /** 
  * Process a block of samples, returning as many frames as possible.
  *
@@ -0,0 +1,123 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file fe_cache.h
+ * @brief Persistent cache of front-end output, keyed by audio content.
+ *
+ * Each entry is a file in the cache directory named after a hash of
+ * the audio samples and of every front-end parameter, so that
+ * processing the same audio with the same configuration again can
+ * skip feature extraction and memory-map the stored cepstra instead.
+ */
+
+#ifndef __FE_CACHE_H__
+#define __FE_CACHE_H__
+
+#include <sphinxbase/sphinxbase_export.h>
+#include <sphinxbase/prim_type.h>
+#include <sphinxbase/fe.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#if 0
+/* Fool Emacs. */
+}
+#endif
+
+/**
+ * Feature cache object.
+ */
+typedef struct fe_cache_s fe_cache_t;
+
+/**
+ * Create a feature cache for a front end.
+ *
+ * @param fe Front end whose output is cached.  This is retained by
+ *           the cache.
+ * @param dir Directory to keep cache entries in.  It is created if
+ *            it does not exist.
+ * @return Newly created cache, or NULL on failure.
+ */
+SPHINXBASE_EXPORT
+fe_cache_t *fe_cache_init(fe_t *fe, char const *dir);
+
+/**
+ * Retain a feature cache.
+ */
+SPHINXBASE_EXPORT
+fe_cache_t *fe_cache_retain(fe_cache_t *fc);
+
+/**
+ * Release a feature cache.
+ *
+ * @return new reference count (0 if freed completely)
+ */
+SPHINXBASE_EXPORT
+int fe_cache_free(fe_cache_t *fc);
+
+/**
+ * Compute the cache key for a block of audio.
+ *
+ * This covers the samples and the full front-end configuration, and
+ * is what names the entry in the cache directory.
+ */
+SPHINXBASE_EXPORT
+uint64 fe_cache_key(fe_cache_t *fc, int16 const *spch, size_t nsamps);
+
+/**
+ * Get the features for a whole utterance, using the cache if possible.
+ *
+ * On a cache miss, this runs fe_start_utt(), fe_process_frames() and
+ * fe_end_utt() over all of the audio, as for batch processing, and
+ * stores the result.  On a hit the front end is not run at all.
+ *
+ * @param spch Speech samples for the whole utterance.
+ * @param nsamps Number of samples.
+ * @param out_cep Output: features for the utterance.  These belong
+ *                to the cache and are only valid until the next call
+ *                to this function or fe_cache_free().  They may be in
+ *                read-only memory, so copy them if they are to be
+ *                modified (e.g. by in-place CMN).
+ * @param out_nframes Output: number of frames in <code>*out_cep</code>.
+ * @return 1 for a cache hit, 0 for a miss, <0 on error.
+ */
+SPHINXBASE_EXPORT
+int fe_cache_process_utt(fe_cache_t *fc, int16 const *spch, size_t nsamps,
+                         mfcc_t ***out_cep, int32 *out_nframes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FE_CACHE_H__ */
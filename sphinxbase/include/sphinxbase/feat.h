@@ -77,15 +77,15 @@ extern "C" {
 { "-cmn",                                                               \
       ARG_STRING,                                                       \
       "live",                                                        \
-      "Cepstral mean normalization scheme ('live', 'batch', or 'none')" }, \
+      "Cepstral mean normalization scheme ('live', 'ema', 'batch', or 'none')" }, \
 { "-cmninit",                                                           \
       ARG_STRING,                                                       \
       "40,3,-1",                                                        \
-      "Initial values (comma-separated) for cepstral mean when 'live' is used" }, \
+      "Initial values (comma-separated) for cepstral mean when 'live' is used, or a file written by cmn_live_write()" }, \
 { "-varnorm",                                                           \
       ARG_BOOLEAN,                                                      \
       "no",                                                             \
-      "Variance normalize each utterance (only if CMN == current)" },   \
+      "Variance normalize each utterance (not in fixed point for 'live')" }, \
 { "-agc",                                                               \
       ARG_STRING,                                                       \
       "none",                                                           \
@@ -155,12 +155,27 @@ typedef struct feat_s {
     mfcc_t **tmpcepbuf; /**< Array of pointers into cepbuf to handle border cases. */
     int32   bufpos;     /**< Write index in cepbuf. */
     int32   curpos;     /**< Read index in cepbuf. */
+    mfcc_t **dcepbuf;   /**< Circular buffer of delta cepstra, parallel to cepbuf, for
+                           incremental computation of 1s_c_d_dd (else NULL). */
+    int32   dcepvalid;  /**< Whether dcepbuf holds the deltas preceding curpos. */
 
     mfcc_t ***lda; /**< Array of linear transformations (for LDA, MLLT, or whatever) */
     uint32 n_lda;   /**< Number of linear transformations in lda. */
     uint32 out_dim; /**< Output dimensionality */
+    mfcc_t *lda_t;  /**< First transformation, transposed and padded to
+                       lda_t_stride columns for vectorized projection (or NULL) */
+    int32 lda_t_stride; /**< Row stride of lda_t */
+
+    int32 frame_stride; /**< Distance between frames in arrays from
+                           feat_array_alloc(), in mfcc_t. */
 } feat_t;
 
+/**
+ * Alignment in bytes of frames in arrays from feat_array_alloc(), if
+ * requested with feat_set_frame_align().
+ */
+#define FEAT_ARRAY_ALIGN 64
+
 /**
  * Name of feature type.
  */
@@ -201,6 +216,21 @@ typedef struct feat_s {
  * Array with stream/subvector lengths
  */
 #define feat_stream_lengths(f)  ((f)->lda ? (&(f)->out_dim) : (f)->sv_len ? (f)->sv_len : f->stream_len)
+/**
+ * Distance in mfcc_t between successive frames of an array allocated
+ * with feat_array_alloc().  The streams of a frame are contiguous, so
+ * the whole array can also be treated as a matrix of this stride.
+ */
+#define feat_frame_stride(f)    ((f)->frame_stride)
+/**
+ * Contiguous data of an array allocated with feat_array_alloc().
+ */
+#define feat_array_data(a)      ((a)[0][0])
+/**
+ * Start of frame i in an array allocated with feat_array_alloc(),
+ * without going through the frame and stream pointers.
+ */
+#define feat_array_frame(f,a,i) (feat_array_data(a) + (i) * feat_frame_stride(f))
 
 /**
  * Parse subvector specification string.
@@ -243,7 +273,8 @@ void subvecs_free(int32 **subvecs);
  * - data[2][0] = frame 2 stream 0 vector, data[0][1] = frame 2 stream 1 vector, ...
  * - ...
  *
- * NOTE: For I/O convenience, the entire data area is allocated as one contiguous block.
+ * NOTE: For I/O convenience, the entire data area is allocated as one contiguous block,
+ * with frames feat_frame_stride() apart (see feat_set_frame_align()).
  * @return pointer to the allocated space if successful, NULL if any error.
  */
 SPHINXBASE_EXPORT
@@ -252,6 +283,20 @@ mfcc_t ***feat_array_alloc(feat_t *fcb,	/**< In: Descriptor from feat_init(), us
                            int32 nfr	/**< In: Number of frames for which to allocate */
     );
 
+/**
+ * Pad and align frames in feature arrays.
+ *
+ * After this, arrays allocated with feat_array_alloc() will start on
+ * a FEAT_ARRAY_ALIGN byte boundary and have a frame stride which is a
+ * multiple of it, so that each frame is also aligned.  This does not
+ * affect arrays which have already been allocated.  By default frames
+ * are packed with no padding, which some callers rely on for I/O.
+ *
+ * @param aligned TRUE to pad and align frames, FALSE to pack them.
+ */
+SPHINXBASE_EXPORT
+void feat_set_frame_align(feat_t *fcb, int aligned);
+
 /**
  * Realloate the array of features. Requires us to know the old size
  */
@@ -281,6 +281,40 @@ int32 fsg_model_tag_trans_add(fsg_model_t * fsg, int32 from, int32 to,
 SPHINXBASE_EXPORT
 glist_t fsg_model_null_trans_closure(fsg_model_t * fsg, glist_t nulls);
 
+/**
+ * Create a smaller FSG which accepts the same word sequences with the
+ * same best path scores.
+ *
+ * Null transitions are removed by copying the word transitions they
+ * lead to back to their source states, except for those into the
+ * final state, which are kept so that the FSG still has a single
+ * final state.  States which cannot be reached from the start state
+ * or cannot reach the final state are dropped, and states with
+ * identical futures are merged.  Word IDs are the same in the new
+ * FSG.
+ *
+ * This computes the null transition closure of <code>fsg</code> if
+ * it has not already been done, but does not otherwise change it.
+ *
+ * @return a new FSG, which the caller must free.
+ */
+SPHINXBASE_EXPORT
+fsg_model_t *fsg_model_minimize(fsg_model_t *fsg);
+
+/**
+ * Create an FSG which accepts the same word sequences with the same
+ * best path scores, and which the search can follow more cheaply.
+ *
+ * This is fsg_model_minimize(), followed where possible by
+ * determinization, so that no state has two transitions for the same
+ * word, and by minimizing again.  Grammars for which determinization
+ * would greatly increase the number of states are only minimized.
+ *
+ * @return a new FSG, which the caller must free.
+ */
+SPHINXBASE_EXPORT
+fsg_model_t *fsg_model_optimize(fsg_model_t *fsg);
+
 /**
  * Get the list of transitions (if any) from state i to j.
  */
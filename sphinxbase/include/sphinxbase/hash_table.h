@@ -96,6 +96,9 @@
  * 3, this is a reasonable practice because hash table is only used in
  * lookup in initialization or in lookups which is not critical for
  * speed.
+ *
+ * (The table has since been changed to open addressing, as it is now
+ * used in places where speed does matter.)
  */
 
 /**
@@ -140,10 +143,13 @@ extern "C" {
 /**
  * The hash table structures.
  * Each hash table is identified by a hash_table_t structure.  hash_table_t.table is
- * pre-allocated for a user-controlled max size, and is initially empty.  As new
- * entries are created (using hash_enter()), the empty entries get filled.  If multiple
- * keys hash to the same entry, new entries are allocated and linked together in a
- * linear list.
+ * an open-addressed array of entries, with one control byte per entry in
+ * hash_table_t.ctrl marking it as empty, deleted, or full.  Keys which
+ * collide go into the next free entries of their probe sequence.  When
+ * the table gets too full it is reallocated at twice the size, which
+ * moves the entries: pointers to entries (from hash_table_tolist() or an
+ * iterator) stay valid until the next key is entered.  For the same
+ * reason, keys must not be entered while iterating over a table.
  */
 
 typedef struct hash_entry_s {
@@ -153,22 +159,26 @@ typedef struct hash_entry_s {
 	size_t len;			/** Key-length; the key string does not have to be a C-style NULL
 					    terminated string; it can have arbitrary binary bytes */
 	void *val;			/** Value associated with above key */
-	struct hash_entry_s *next;	/** For collision resolution */
+	uint32 hash;			/** Hash value of key */
 } hash_entry_t;
 
 typedef struct hash_table_s {
-	hash_entry_t *table;	/**Primary hash table, excluding entries that collide */
-	int32 size;		/** Primary hash table size, (is a prime#); NOTE: This is the
-				    number of primary entries ALLOCATED, NOT the number of valid
-				    entries in the table */
+	hash_entry_t *table;	/** Array of entries */
+	uint8 *ctrl;		/** Control byte for each entry, followed by a copy
+				    of the first few */
+	int32 size;		/** Number of entries ALLOCATED (a power of 2), NOT
+				    the number of valid entries in the table */
 	int32 inuse;		/** Number of valid entries in the table. */
+	int32 n_deleted;	/** Number of deleted entries not yet reused */
 	int32 nocase;		/** Whether case insensitive for key comparisons */
+	struct hash_index_s *index; /** Perfect hash index built by
+				    hash_table_freeze(), or NULL */
 } hash_table_t;
 
 typedef struct hash_iter_s {
 	hash_table_t *ht;  /**< Hash table we are iterating over. */
 	hash_entry_t *ent; /**< Current entry in that table. */
-	size_t idx;        /**< Index of next bucket to search. */
+	size_t idx;        /**< Index of next entry to search. */
 } hash_iter_t;
 
 /** Access macros */
@@ -205,6 +215,14 @@ SPHINXBASE_EXPORT
 void hash_table_free(hash_table_t *h /**< In: Handle of hash table to free */
     );
 
+/**
+ * Get the number of bytes allocated for a hash table and its index,
+ * not counting the keys and values, which belong to the caller.
+ */
+SPHINXBASE_EXPORT
+size_t hash_table_mem_size(hash_table_t *h /**< In: Handle of hash table */
+    );
+
 
 /**
  * Try to add a new entry with given key and associated value to hash table h.  If key doesn't
@@ -291,6 +309,27 @@ SPHINXBASE_EXPORT
 void hash_table_empty(hash_table_t *h    /**< In: Handle of hash table */
     );
 
+/**
+ * Build a perfect hash index over the keys currently in a table.
+ *
+ * Once a table holds a large, mostly static set of string keys (a
+ * vocabulary, say), this makes hash_table_lookup() and friends find
+ * each key with a single probe and one string comparison, instead of
+ * probing the table.  Keys entered afterwards still go into
+ * the ordinary table and are found there.  Deleting a key or emptying
+ * the table discards the index; call this again to rebuild it.
+ *
+ * All keys in the table must be C strings (not entered with
+ * hash_table_enter_bkey()).  Only hash_table_lookup() and
+ * hash_table_lookup_int32() use the index.
+ *
+ * @return 0 for success, -1 if no index could be built (in which
+ * case the table works as before).
+ */
+SPHINXBASE_EXPORT
+int32 hash_table_freeze(hash_table_t *h /**< In: Handle of hash table */
+    );
+
 /**
  * Like hash_table_enter, but with an explicitly specified key length,
  * instead of a NULL-terminated, C-style key string.  So the key
@@ -393,6 +432,11 @@ int32 hash_table_lookup_bkey_int32(hash_table_t *h,/**< In: Handle of hash table
 
 /**
  * Start iterating over key-value pairs in a hash table.
+ *
+ * Keys may be deleted and values replaced while iterating, but no new
+ * key may be entered in the table until the iteration is finished or
+ * the iterator freed: entering one can move the entries, so that some
+ * would be skipped and others visited twice.
  */
 SPHINXBASE_EXPORT
 hash_iter_t *hash_table_iter(hash_table_t *h);
@@ -425,7 +469,7 @@ glist_t hash_table_tolist(hash_table_t *h,	/**< In: Hash table from which list i
 	);
 
 /**
- * Display a hash-with-chaining representation on the screen.
+ * Display the occupied entries of a hash table on the screen.
  * Currently, it will only works for situation where hash_enter was
  * used to enter the keys. 
  */
@@ -110,6 +110,19 @@ int heap_insert(heap_t *heap,	/**< In: Heap into which item is to be inserted */
                 void *data,	/**< In: Application-determined data pointer */
                 int32 val	/**< In: According to item entered in sorted heap */
 	);
+
+/**
+ * Insert n items into the given heap at once.  This takes time
+ * linear in the size of the heap, so it is faster than inserting them
+ * one at a time when there are many.
+ * Return value: 0 if successful, -1 otherwise.
+ */
+SPHINXBASE_EXPORT
+int heap_insert_n(heap_t *heap,	/**< In: Heap into which items are to be inserted */
+                  void **data,	/**< In: Application-determined data pointers */
+                  int32 const *val, /**< In: Values of the items in data */
+                  size_t n	/**< In: Number of items */
+	);
 /**
  * Return the topmost item in the heap.
  * Return value: 1 if heap is not empty and the topmost value is returned;
@@ -127,11 +140,20 @@ SPHINXBASE_EXPORT
 int heap_pop(heap_t *heap, void **data, int32 *val);
 
 /**
- * Remove an item from the heap.
+ * Remove an item from the heap.  The item is found by a linear
+ * search, so this takes time proportional to the size of the heap.
  */
 SPHINXBASE_EXPORT
 int heap_remove(heap_t *heap, void *data);
 
+/**
+ * Change the value of an item in the heap, moving it up or down as
+ * needed.  Like heap_remove(), this searches the heap for the item.
+ * Return value: 0 if successful, -1 if the item is not in the heap.
+ */
+SPHINXBASE_EXPORT
+int heap_update(heap_t *heap, void *data, int32 val);
+
 /**
  * Return the number of items in the heap.
  */
@@ -111,12 +111,72 @@ void __listelem_free__(listelem_alloc_t *le, void *elem, char *file, int line);
  */
 #define listelem_free(le,el)	__listelem_free__((le),(el),__FILE__,__LINE__)
 
+/**
+ * Free all elements of a list element allocator at once.
+ *
+ * This is a quick way to clear out everything allocated during an
+ * utterance.  Elements allocated before the reset must not be freed
+ * afterwards.  No other thread may use the allocator, or a cache for
+ * it, while it is being reset.
+ */
+SPHINXBASE_EXPORT
+void listelem_alloc_reset(listelem_alloc_t *le);
+
+/**
+ * Per-thread cache for a list element allocator.
+ *
+ * listelem_malloc() and listelem_free() are not thread-safe.  Threads
+ * which share an allocator should instead each allocate and free
+ * elements through their own cache.  A cache hands out elements from
+ * its own freelist without locking, and only locks the allocator to
+ * take or give back a batch of elements.  Elements may be freed
+ * through a different cache from the one which allocated them.
+ */
+typedef struct listelem_cache_s listelem_cache_t;
+
+/**
+ * Create a cache for a list element allocator, to be used by one
+ * thread at a time.
+ */
+SPHINXBASE_EXPORT
+listelem_cache_t *listelem_cache_init(listelem_alloc_t *le);
+
+/**
+ * Return a cache's free elements to its allocator and release it.
+ */
+SPHINXBASE_EXPORT
+void listelem_cache_free(listelem_cache_t *lc);
+
+SPHINXBASE_EXPORT
+void *__listelem_cache_malloc__(listelem_cache_t *lc, char *file, int line);
+
+/**
+ * Allocate a list element through a cache.
+ */
+#define listelem_cache_malloc(lc)	__listelem_cache_malloc__((lc),__FILE__,__LINE__)
+
+SPHINXBASE_EXPORT
+void __listelem_cache_release__(listelem_cache_t *lc, void *elem,
+                             char *file, int line);
+
+/**
+ * Free a list element through a cache.
+ */
+#define listelem_cache_release(lc,el)	__listelem_cache_release__((lc),(el),__FILE__,__LINE__)
+
 /**
    Print number of allocation, numer of free operation stats 
 */
 SPHINXBASE_EXPORT
 void listelem_stats(listelem_alloc_t *le);
 
+/**
+ * Get the number of bytes in the blocks of a list element allocator,
+ * whether or not their elements are in use.
+ */
+SPHINXBASE_EXPORT
+size_t listelem_mem_size(listelem_alloc_t *le);
+
 
 #ifdef __cplusplus
 }
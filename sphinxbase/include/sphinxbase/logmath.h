@@ -193,6 +193,27 @@ int logmath_add_exact(logmath_t *lmath, int logb_p, int logb_q);
 SPHINXBASE_EXPORT
 int logmath_add(logmath_t *lmath, int logb_p, int logb_q);
 
+/**
+ * Add n values in log space.
+ *
+ * Values too far below the largest one to change the sum are skipped
+ * without a table lookup, which is most of them when combining scores
+ * that differ a lot.
+ */
+SPHINXBASE_EXPORT
+int logmath_add_n(logmath_t *lmath, int const *logb, int n);
+
+/**
+ * Add two arrays of values in log space, element by element, leaving
+ * the result in the first.
+ *
+ * The results are those of logmath_add() on each pair (except that if
+ * both are zero, either may be returned), but this is much faster on
+ * long arrays such as per-senone scores.
+ */
+SPHINXBASE_EXPORT
+void logmath_add_array(logmath_t *lmath, int *logb_x, int const *logb_y, int n);
+
 /**
  * Convert linear floating point number to integer log in base B.
  */
@@ -43,6 +43,8 @@
 #ifndef __MMIO_H__
 #define __MMIO_H__
 
+#include <stddef.h>
+
 #include <sphinxbase/sphinxbase_export.h>
 
 #ifdef __cplusplus
@@ -77,6 +79,31 @@ void *mmio_file_ptr(mmio_file_t *mf);
 SPHINXBASE_EXPORT
 void mmio_file_unmap(mmio_file_t *mf);
 
+/**
+ * Hint that the whole of a mapped file will be needed soon, so that
+ * it is read ahead instead of faulted in a page at a time.  This does
+ * nothing on platforms that do not support it.
+ **/
+SPHINXBASE_EXPORT
+void mmio_file_prefetch(mmio_file_t *mf);
+
+/**
+ * Hint that a mapped file should be backed by huge pages, to save
+ * TLB misses when it is accessed all over, like acoustic model
+ * parameters are.  This does nothing on platforms or filesystems
+ * that do not support it.
+ **/
+SPHINXBASE_EXPORT
+void mmio_file_hugepages(mmio_file_t *mf);
+
+/**
+ * Hint that some large allocated memory should be backed by huge
+ * pages.  Only the whole pages inside it are affected.  This does
+ * nothing on platforms that do not support it.
+ **/
+SPHINXBASE_EXPORT
+void mmio_hugepages(void *ptr, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
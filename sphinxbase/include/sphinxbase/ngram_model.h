@@ -82,13 +82,38 @@ typedef enum ngram_file_type_e {
 
 #define NGRAM_INVALID_WID -1 /**< Impossible word ID */
 
+#define NGRAM_STATE_MAX_HIST 4 /**< Longest history kept in a state */
+
+/**
+ * Language model state, that is, the part of the history which can
+ * affect the score of the next word.
+ *
+ * States are created by ngram_state_init() and ngram_state_score(),
+ * and are only meaningful to the model (and, for a set, the current
+ * model selection) which created them.  They hold no more history
+ * than that model can use, so states which are equal according to
+ * ngram_state_equal() give the same scores for all following words.
+ */
+typedef struct ngram_state_s {
+    int32 n_hist;                         /**< Number of history words */
+    int32 hist[NGRAM_STATE_MAX_HIST];     /**< History, most recent first */
+    float32 backoff[NGRAM_STATE_MAX_HIST]; /**< Backoff weight of each
+                                               history length, if the
+                                               model keeps them */
+} ngram_state_t;
+
 /**
  * Read an N-Gram model from a file on disk.
  *
  * @param config Optional pointer to a set of command-line arguments.
  * Recognized arguments are:
  *
+ *  - -lmbloom (boolean) whether to build Bloom filters which reject
+ *    most lookups of missing n-grams without searching for them
  *  - -mmap (boolean) whether to use memory-mapped I/O
+ *  - -nthreads (int32) number of threads to use for reading ARPA files
+ *  - -quant (string) bits to quantize probabilities and backoffs to when
+ *    reading ARPA or DMP files, per order from bigrams, such as "8/8,8"
  *  - -lw (float32) language weight to apply to the model
  *  - -wip (float32) word insertion penalty to apply to the model
  *
@@ -157,6 +182,41 @@ ngram_model_t *ngram_model_retain(ngram_model_t *model);
 SPHINXBASE_EXPORT
 int ngram_model_free(ngram_model_t *model);
 
+/**
+ * Create a lightweight copy of an N-Gram model.
+ *
+ * The copy shares the N-Grams, vocabulary and classes of the model
+ * and has its own score caches, weights and (for sets) current
+ * model and interpolation weights, so the two can be scored from
+ * different threads.  The original is retained until all copies are
+ * freed.  Neither may have words, classes or models added or removed
+ * while copies exist.
+ *
+ * Since reference counts are not atomic, copies must be created and
+ * freed from one thread at a time.
+ *
+ * @return New model, or NULL if this model type cannot be copied.
+ */
+SPHINXBASE_EXPORT
+ngram_model_t *ngram_model_clone(ngram_model_t *model);
+
+/**
+ * Get the memory used by an N-Gram model.
+ *
+ * Memory shared by a model and its copies (see ngram_model_clone())
+ * is counted separately, so that it is not counted twice when adding
+ * up those of several copies.
+ *
+ * @param out_shared Output: bytes of heap memory shared with copies
+ *                   of the model, or NULL.
+ * @param out_mapped Output: bytes used in place from memory-mapped
+ *                   files, or NULL.
+ * @return Bytes of heap memory used by this model alone.
+ */
+SPHINXBASE_EXPORT
+size_t ngram_model_mem_size(ngram_model_t *model, size_t *out_shared,
+                            size_t *out_mapped);
+
 /**
  * Constants for case folding.
  */
@@ -214,9 +274,7 @@ float32 ngram_model_get_weights(ngram_model_t *model, int32 *out_log_wip);
  *
  * This is not the function to use in decoding, because it has some
  * overhead for looking up words.  Use ngram_ng_score(),
- * ngram_tg_score(), or ngram_bg_score() instead.  In the future there
- * will probably be a version that takes a general language model
- * state object, to support suffix-array LM and things like that.
+ * ngram_tg_score(), ngram_bg_score(), or ngram_state_score() instead.
  *
  * If one of the words is not in the LM's vocabulary, the result will
  * depend on whether this is an open or closed vocabulary language
@@ -257,6 +315,39 @@ SPHINXBASE_EXPORT
 int32 ngram_ng_score(ngram_model_t *model, int32 wid, int32 *history,
                      int32 n_hist, int32 *n_used);
 
+/**
+ * Initialize a language model state from a word history.
+ *
+ * @param history Word IDs of the history, most recent first.  A
+ *                NGRAM_INVALID_WID ends the history early.
+ */
+SPHINXBASE_EXPORT
+void ngram_state_init(ngram_model_t *model, ngram_state_t *state,
+                      int32 const *history, int32 n_hist);
+
+/**
+ * Get the score of a word following a language model state, and the
+ * state which follows it.
+ *
+ * This gives the same score as ngram_ng_score() with the history
+ * the state was built from, but models which support it do not
+ * search for the history again, so this is the function to use when
+ * the same history is extended by many words.
+ *
+ * @param in State preceding the word.
+ * @param out State following the word, or NULL if not wanted.  It
+ *            must not be the same as in.
+ */
+SPHINXBASE_EXPORT
+int32 ngram_state_score(ngram_model_t *model, ngram_state_t const *in,
+                        int32 wid, ngram_state_t *out, int32 *n_used);
+
+/**
+ * Check whether two language model states are the same.
+ */
+SPHINXBASE_EXPORT
+int ngram_state_equal(ngram_state_t const *a, ngram_state_t const *b);
+
 /**
  * Get the "raw" log-probability for a general N-Gram.
  *
@@ -478,6 +569,71 @@ int32 ngram_model_add_class_word(ngram_model_t *model,
                                  const char *word,
                                  float32 weight);
 
+/**
+ * Boost list, a set of N-Grams whose scores are adjusted at query time.
+ */
+typedef struct ngram_boost_s ngram_boost_t;
+
+/**
+ * Create an empty boost list for a language model.
+ *
+ * The model is used only to look up word IDs and log-math
+ * parameters, and is not retained.  The list stores word IDs, so it
+ * should only be attached to this same model.
+ */
+SPHINXBASE_EXPORT
+ngram_boost_t *ngram_boost_init(ngram_model_t *model);
+
+/**
+ * Retain a boost list.
+ */
+SPHINXBASE_EXPORT
+ngram_boost_t *ngram_boost_retain(ngram_boost_t *boost);
+
+/**
+ * Release a boost list.
+ *
+ * @return new reference count (0 if freed)
+ */
+SPHINXBASE_EXPORT
+int ngram_boost_free(ngram_boost_t *boost);
+
+/**
+ * Add an N-Gram to a boost list.
+ *
+ * The score of the last word in <code>words</code>, when preceded by
+ * the others, is multiplied by <code>weight</code>.  Only the longest
+ * boosted N-Gram which matches is applied, so a boosted bigram
+ * replaces, rather than adds to, the boost of its final word.  Adding
+ * the same N-Gram again replaces its weight.
+ *
+ * @param words Words of the N-Gram, in the usual order (oldest first).
+ * @param n Number of words, at most NGRAM_STATE_MAX_HIST + 1.
+ * @param weight Linear factor to apply to the probability.
+ * @return 0 for success, or -1 if a word is not in the model.
+ */
+SPHINXBASE_EXPORT
+int ngram_boost_add(ngram_boost_t *boost, const char *const *words,
+                    int32 n, float32 weight);
+
+/**
+ * Attach a boost list to a language model.
+ *
+ * Scores returned by ngram_ng_score(), ngram_ng_prob(),
+ * ngram_state_score() and the functions built on them include the
+ * boost from then on.  The model itself is not copied or modified, so
+ * attaching and detaching a list costs almost nothing.  Only one list
+ * can be attached at a time.  A list which is changed while attached
+ * takes effect after ngram_model_flush().
+ *
+ * @param boost Boost list to attach (retained by the model), or NULL
+ *              to detach the current one.
+ * @return 0 for success, -1 if the list was made for a model with
+ *         different log-math parameters.
+ */
+SPHINXBASE_EXPORT
+int ngram_model_boost(ngram_model_t *model, ngram_boost_t *boost);
+
 /**
  * Create a set of language models sharing a common space of word IDs.
  *
@@ -691,6 +847,9 @@ int32 ngram_model_set_known_wid(ngram_model_t *set, int32 set_wid);
 
 /**
  * Flush any cached N-Gram information
+ *
+ * Model sets cache the scores of their language models, so this must
+ * be called on the set after changing one of its models directly.
  */
 SPHINXBASE_EXPORT
 void ngram_model_flush(ngram_model_t *lm);
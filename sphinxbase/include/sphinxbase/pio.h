@@ -112,6 +112,10 @@ extern "C" {
 /**
  * Like fopen, but use popen and zcat if it is determined that "file" is compressed
  * (i.e., has a .z, .Z, .gz, or .GZ extension).
+ *
+ * Where zlib is available, .gz files are decompressed in this process
+ * rather than by an external gunzip.  The stream returned is still not
+ * seekable, and *ispipe is still TRUE for it.
  */
 SPHINXBASE_EXPORT
 FILE *fopen_comp (const char *file,		/**< In: File to be opened */
@@ -173,6 +177,12 @@ char *fread_line(FILE *stream, size_t *out_len);
 
 /**
  * Line iterator for files.
+ *
+ * Where possible, a regular file is memory-mapped and lines are
+ * copied out of the mapping instead of being read through stdio.
+ * The position of the file is updated when the iterator is freed, so
+ * it can still be read from or seeked afterwards, but not while the
+ * iterator is in use.
  */
 typedef struct lineiter_t {
     char *buf;
@@ -181,6 +191,9 @@ typedef struct lineiter_t {
     int32 len;
     int32 clean;
     int32 lineno;
+    char const *map;    /**< Contents of fh, if it is mapped, or NULL */
+    size_t map_size;    /**< Size of map */
+    size_t map_pos;     /**< Offset of the next line in map */
 } lineiter_t;
 
 /**
@@ -212,6 +212,35 @@ int sbevent_signal(sbevent_t *evt);
 SPHINXBASE_EXPORT
 int sbevent_wait(sbevent_t *evt, int sec, int nsec);
 
+/**
+ * Get the number of NUMA nodes, that is, groups of CPUs with their
+ * own memory.  This is 1 where it cannot be determined.
+ */
+SPHINXBASE_EXPORT
+int sbthread_n_nodes(void);
+
+/**
+ * Restrict the calling thread to the CPUs of a NUMA node.
+ *
+ * Memory is placed on the node of the thread which first touches it,
+ * so a thread bound to a node before it loads or allocates something
+ * will find it there.
+ *
+ * @param node Node to bind to, or -1 to allow any CPU again.
+ * @return 0, or <0 if it failed or is not supported.
+ */
+SPHINXBASE_EXPORT
+int sbthread_bind_node(int node);
+
+/**
+ * Spread the pages that the calling thread touches from now on
+ * evenly over all NUMA nodes, or go back to placing them on its own.
+ *
+ * @return 0, or <0 if it failed or is not supported.
+ */
+SPHINXBASE_EXPORT
+int sbthread_interleave(int enable);
+
 
 #ifdef __cplusplus
 }
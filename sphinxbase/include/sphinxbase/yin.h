@@ -49,6 +49,8 @@ extern "C"
 } /* Fool Emacs. */
 #endif
 
+#include <stddef.h>
+
 /* Win32/WinCE DLL gunk */
 #include <sphinxbase/sphinxbase_export.h>
 #include <sphinxbase/prim_type.h>
@@ -109,6 +111,42 @@ void yin_write(yin_t *pe, int16 const *frame);
 SPHINXBASE_EXPORT
 int yin_read(yin_t *pe, uint16 *out_period, uint16 *out_bestdiff);
 
+/**
+ * Set the number of samples between the starts of successive frames
+ * for yin_process_frames().  By default frames do not overlap.
+ */
+SPHINXBASE_EXPORT
+void yin_set_frame_shift(yin_t *pe, int frame_shift);
+
+/**
+ * Estimate pitch from a block of audio of any length, cutting it into
+ * frames the way fe_process_frames() does, so the two can be run side
+ * by side on the same input.
+ *
+ * Samples left over at the end of the block are kept for the next
+ * call.  At the end of the utterance, call yin_end() and then
+ * yin_read() for the remaining estimates.
+ *
+ * @param pe Pitch estimator.
+ * @param inout_raw Input: pointer to the first sample.
+ *                  Output: pointer to the first unused sample.
+ * @param inout_nsamps Input: number of samples available.
+ *                     Output: number of samples left unused.
+ * @param stride Distance between successive samples, for interleaved
+ *               multi-channel audio (each channel with its own
+ *               estimator), or 1 for a single channel.
+ * @param out_period Output: period estimates, as in yin_read().
+ * @param out_bestdiff Output: normalized differences, as in yin_read().
+ * @param inout_nframes Input: size of the output arrays.
+ *                      Output: number of estimates written to them.
+ * @return Number of estimates written.
+ */
+SPHINXBASE_EXPORT
+int32 yin_process_frames(yin_t *pe, int16 const **inout_raw,
+                         size_t *inout_nsamps, int stride,
+                         uint16 *out_period, uint16 *out_bestdiff,
+                         int32 *inout_nframes);
+
 #ifdef __cplusplus
 }
 #endif
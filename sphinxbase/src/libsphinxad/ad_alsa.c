@@ -80,10 +80,13 @@
 
 #include "prim_type.h"
 #include "ad.h"
+#include "sbthread.h"
 
 #define AUDIO_FORMAT SND_PCM_SFMT_S16_LE        /* 16-bit signed, little endian */
 #define INPUT_GAIN 85
 #define SPS_EPSILON 200
+#define PERIOD_TIME 10000       /* Period to ask for, in microseconds */
+#define WAIT_TIMEOUT 100        /* Longest wait for audio in capture thread, in ms */
 
 #define DEFAULT_DEVICE "default"
 
@@ -92,10 +95,16 @@ struct ad_rec_s {
     int32 recording;
     int32 sps;
     int32 bps;
+    int32 mmap;                 /**< Device buffer is memory-mapped */
+    int32 n_overruns;
+    sbthread_t *thread;         /**< Capture thread for ad_start_callback() */
+    volatile int32 running;     /**< Cleared to stop the capture thread */
+    ad_callback_t cb;
+    void *cb_data;
 };
 
 static int
-setparams(int32 sps, snd_pcm_t * handle)
+setparams(int32 sps, snd_pcm_t * handle, int32 *out_mmap)
 {
     snd_pcm_hw_params_t *hwparams;
     unsigned int out_sps, buffer_time, period_time;
@@ -109,9 +118,19 @@ setparams(int32 sps, snd_pcm_t * handle)
         return -1;
     }
 
+    /* Read straight out of the device's buffer if it can be mapped,
+     * which saves a copy and lets the capture thread hand it to its
+     * callback as is. */
+    *out_mmap = 1;
     err =
         snd_pcm_hw_params_set_access(handle, hwparams,
-                                     SND_PCM_ACCESS_RW_INTERLEAVED);
+                                     SND_PCM_ACCESS_MMAP_INTERLEAVED);
+    if (err < 0) {
+        *out_mmap = 0;
+        err =
+            snd_pcm_hw_params_set_access(handle, hwparams,
+                                         SND_PCM_ACCESS_RW_INTERLEAVED);
+    }
     if (err < 0) {
         fprintf(stderr,
                 "Failed to set PCM device to interleaved: %s\n",
@@ -150,9 +169,13 @@ setparams(int32 sps, snd_pcm_t * handle)
         return -1;
     }
 
-    /* Set buffer time to the maximum. */
+    /* Set buffer time to the maximum, so that slow readers do not
+     * overrun, but keep periods short, since audio only becomes
+     * available a period at a time. */
     err = snd_pcm_hw_params_get_buffer_time_max(hwparams, &buffer_time, 0);
     period_time = buffer_time / 4;
+    if (period_time > PERIOD_TIME)
+        period_time = PERIOD_TIME;
     err = snd_pcm_hw_params_set_period_time_near(handle, hwparams,
                                                  &period_time, 0);
     if (err < 0) {
@@ -188,6 +211,7 @@ ad_open_dev(const char *dev, int32 sps)
 {
     ad_rec_t *handle;
     snd_pcm_t *dspH;
+    int32 use_mmap;
 
     int err;
 
@@ -202,7 +226,7 @@ ad_open_dev(const char *dev, int32 sps)
         return NULL;
     }
 
-    if (setparams(sps, dspH) < 0) {
+    if (setparams(sps, dspH, &use_mmap) < 0) {
         return NULL;
     }
     if ((handle = (ad_rec_t *) calloc(1, sizeof(ad_rec_t))) == NULL) {
@@ -214,6 +238,7 @@ ad_open_dev(const char *dev, int32 sps)
     handle->recording = 0;
     handle->sps = sps;
     handle->bps = sizeof(int16);
+    handle->mmap = use_mmap;
 
     return (handle);
 }
@@ -286,6 +311,12 @@ ad_stop_rec(ad_rec_t * handle)
     if (!handle->recording)
         return AD_ERR_GEN;
 
+    if (handle->thread) {
+        handle->running = 0;
+        sbthread_free(handle->thread);
+        handle->thread = NULL;
+    }
+
     err = snd_pcm_drop(handle->dspH);
     if (err < 0) {
         fprintf(stderr, "snd_pcm_drop failed: %s\n", snd_strerror(err));
@@ -297,31 +328,29 @@ ad_stop_rec(ad_rec_t * handle)
 }
 
 
-int32
-ad_read(ad_rec_t * handle, int16 * buf, int32 max)
+/**
+ * Recover from an overrun or suspend reported as error err.
+ *
+ * @return 0 if recovered, AD_ERR_GEN otherwise.
+ */
+static int32
+ad_recover(ad_rec_t * handle, int err)
 {
-    int32 length, err;
-
-    if (!handle->recording) {
-	fprintf(stderr, "Recording is stopped, start recording with ad_start_rec\n");
-	return AD_EOF;
-    }
-
-    length = snd_pcm_readi(handle->dspH, buf, max);
-    if (length == -EAGAIN) {
-        length = 0;
-    }
-    else if (length == -EPIPE) {
+    if (err == -EPIPE) {
         fprintf(stderr, "Input overrun, read calls are too rare (non-fatal)\n");
+        ++handle->n_overruns;
         err = snd_pcm_prepare(handle->dspH);
 	if (err < 0) {
 		fprintf(stderr, "Can't recover from underrun: %s\n",
 			snd_strerror(err));
 		return AD_ERR_GEN;
 	}
-        length = 0;
+        /* Capture has to be restarted after an overrun. */
+        if (handle->mmap)
+            snd_pcm_start(handle->dspH);
+        return 0;
     }
-    else if (length == -ESTRPIPE) {
+    else if (err == -ESTRPIPE) {
         fprintf(stderr, "Resuming sound driver (non-fatal)\n");
 	while ((err = snd_pcm_resume(handle->dspH)) == -EAGAIN)
 		usleep(10000); /* Wait for the driver to wake up */
@@ -333,12 +362,125 @@ ad_read(ad_rec_t * handle, int16 * buf, int32 max)
 			return AD_ERR_GEN;
 		}
 	}
-	length = 0;
+        return 0;
     }
-    else if (length < 0) {
-	fprintf(stderr, "Audio read error: %s\n",
-		snd_strerror(length));
+    fprintf(stderr, "Audio read error: %s\n", snd_strerror(err));
+    return AD_ERR_GEN;
+}
+
+int32
+ad_read(ad_rec_t * handle, int16 * buf, int32 max)
+{
+    int32 length;
+
+    if (!handle->recording) {
+	fprintf(stderr, "Recording is stopped, start recording with ad_start_rec\n");
+	return AD_EOF;
+    }
+    if (handle->thread) {
+	fprintf(stderr, "Audio is being passed to a callback, not read\n");
 	return AD_ERR_GEN;
     }
+
+    if (handle->mmap)
+        length = snd_pcm_mmap_readi(handle->dspH, buf, max);
+    else
+        length = snd_pcm_readi(handle->dspH, buf, max);
+    if (length == -EAGAIN)
+        length = 0;
+    else if (length < 0) {
+        if (ad_recover(handle, length) < 0)
+            return AD_ERR_GEN;
+        length = 0;
+    }
     return length;
 }
+
+/**
+ * Capture thread for ad_start_callback().
+ *
+ * In mmap mode the device buffer is itself a period-aligned ring
+ * shared with the driver: each time a period or more is available,
+ * the filled part of it is passed to the callback in place and then
+ * released back to the driver, with no locks and no copies.
+ */
+static int
+ad_capture_main(sbthread_t * th)
+{
+    ad_rec_t *handle = sbthread_arg(th);
+    snd_pcm_t *pcm = handle->dspH;
+    int16 buf[1024];
+
+    while (handle->running) {
+        snd_pcm_sframes_t avail;
+        int err;
+
+        if ((err = snd_pcm_wait(pcm, WAIT_TIMEOUT)) < 0) {
+            if (ad_recover(handle, err) < 0)
+                return -1;
+            continue;
+        }
+        if (!handle->mmap) {
+            avail = snd_pcm_readi(pcm, buf, sizeof(buf) / sizeof(*buf));
+            if (avail == -EAGAIN)
+                continue;
+            if (avail < 0) {
+                if (ad_recover(handle, avail) < 0)
+                    return -1;
+                continue;
+            }
+            (*handle->cb)(handle, buf, avail, handle->cb_data);
+            continue;
+        }
+        if ((avail = snd_pcm_avail_update(pcm)) < 0) {
+            if (ad_recover(handle, avail) < 0)
+                return -1;
+            continue;
+        }
+        /* This may take two goes when the data wraps around the end
+         * of the buffer. */
+        while (avail > 0) {
+            const snd_pcm_channel_area_t *areas;
+            snd_pcm_uframes_t offset, frames = avail;
+            snd_pcm_sframes_t committed;
+            int16 const *data;
+
+            if ((err = snd_pcm_mmap_begin(pcm, &areas, &offset, &frames)) < 0)
+                break;
+            data = (int16 const *)((char const *)areas[0].addr
+                                   + (areas[0].first
+                                      + offset * areas[0].step) / 8);
+            (*handle->cb)(handle, data, frames, handle->cb_data);
+            committed = snd_pcm_mmap_commit(pcm, offset, frames);
+            if (committed < 0 || (snd_pcm_uframes_t)committed != frames) {
+                err = committed < 0 ? committed : -EPIPE;
+                break;
+            }
+            avail -= frames;
+        }
+        if (err < 0 && ad_recover(handle, err) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+int32
+ad_start_callback(ad_rec_t * handle, ad_callback_t cb, void *user_data)
+{
+    if (ad_start_rec(handle) < 0)
+        return AD_ERR_GEN;
+    handle->cb = cb;
+    handle->cb_data = user_data;
+    handle->running = 1;
+    if ((handle->thread = sbthread_start(NULL, ad_capture_main, handle)) == NULL) {
+        ad_stop_rec(handle);
+        return AD_ERR_GEN;
+    }
+    return 0;
+}
+
+int32
+ad_n_overruns(ad_rec_t * handle)
+{
+    return handle->n_overruns;
+}
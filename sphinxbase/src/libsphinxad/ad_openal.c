@@ -126,3 +126,17 @@ ad_close(ad_rec_t * r)
         return -1;
     }
 }
+
+
+int32
+ad_start_callback(ad_rec_t * r, ad_callback_t cb, void *user_data)
+{
+    return AD_ERR_GEN;
+}
+
+
+int32
+ad_n_overruns(ad_rec_t * r)
+{
+    return 0;
+}
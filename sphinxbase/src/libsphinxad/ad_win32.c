@@ -506,3 +506,17 @@ ad_read(ad_rec_t * r, int16 * buf, int32 max)
 
     return len;
 }
+
+
+int32
+ad_start_callback(ad_rec_t * r, ad_callback_t cb, void *user_data)
+{
+    return AD_ERR_GEN;
+}
+
+
+int32
+ad_n_overruns(ad_rec_t * r)
+{
+    return 0;
+}
@@ -0,0 +1,407 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file fe_cache.c
+ * @brief Persistent, content-addressed cache of front-end output.
+ *
+ * An entry is a single file holding a small header followed by the
+ * cepstra in native byte order, so that a hit is a stat() and a
+ * memory map with no parsing.  Entries are written to a temporary
+ * file and renamed into place, which keeps concurrent writers (other
+ * threads or processes sharing the directory) from ever exposing a
+ * partial entry.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#if defined(_WIN32) && !defined(CYGWIN)
+#include <process.h>
+#define getpid _getpid
+#elif defined(HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#include "sphinxbase/prim_type.h"
+#include "sphinxbase/err.h"
+#include "sphinxbase/ckd_alloc.h"
+#include "sphinxbase/cmd_ln.h"
+#include "sphinxbase/mmio.h"
+#include "sphinxbase/pio.h"
+#include "sphinxbase/strfuncs.h"
+#include "sphinxbase/fe_cache.h"
+
+/**
+ * Bump this whenever the front end's numerical output changes, so
+ * that stale entries are never hit.
+ */
+#define FE_CACHE_VERSION 1
+#define FE_CACHE_MAGIC 0x43454653 /* "SFEC" */
+#define FE_CACHE_BYTEORDER 0x11223344
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+/**
+ * On-disk header.  All fields are 32 bits wide so that the layout
+ * has no padding and the data following it is suitably aligned.
+ */
+enum {
+    HDR_MAGIC,
+    HDR_BYTEORDER,
+    HDR_VERSION,
+    HDR_MFCC_SIZE,
+    HDR_KEY_HI,
+    HDR_KEY_LO,
+    HDR_NSAMPS_HI,
+    HDR_NSAMPS_LO,
+    HDR_NFRAMES,
+    HDR_VECLEN,
+    HDR_SIZE
+};
+
+struct fe_cache_s {
+    int refcount;
+    fe_t *fe;
+    char *dir;
+    uint64 cfg_hash;  /**< Hash of the front-end configuration. */
+    int veclen;
+    int enabled;      /**< FALSE if output is not reproducible. */
+
+    mmio_file_t *mf;  /**< Current mapped entry, if a hit. */
+    mfcc_t **rows;    /**< Row pointers into mf. */
+    mfcc_t **cep;     /**< Current computed block, if a miss. */
+};
+
+static uint64
+fnv_hash(uint64 h, void const *data, size_t len)
+{
+    uint8 const *p = data;
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        h ^= p[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+static uint64
+fnv_hash_str(uint64 h, char const *str)
+{
+    if (str == NULL)
+        str = "(null)";
+    /* Include the terminator so that adjacent strings can't run together. */
+    return fnv_hash(h, str, strlen(str) + 1);
+}
+
+/**
+ * Hash the canonical value of every front-end argument.  Values are
+ * formatted by type rather than taken as the user typed them, so
+ * that "-lowerf 133.33334" and "-lowerf 1.3333334e2" hit the same
+ * entry.
+ */
+static uint64
+fe_cache_hash_config(fe_t *fe)
+{
+    cmd_ln_t *config = (cmd_ln_t *)fe_get_config(fe);
+    arg_t const *args;
+    uint32 ident[3];
+    uint64 h;
+    char buf[64];
+
+    ident[0] = FE_CACHE_VERSION;
+    ident[1] = sizeof(mfcc_t);
+#ifdef FIXED_POINT
+    ident[2] = 1;
+#else
+    ident[2] = 0;
+#endif
+    h = fnv_hash(FNV_OFFSET, ident, sizeof(ident));
+
+    for (args = fe_get_args(); args->name; ++args) {
+        if (0 == strcmp(args->name, "-verbose"))
+            continue;
+        if (!cmd_ln_exists_r(config, args->name))
+            continue;
+        h = fnv_hash_str(h, args->name);
+        switch (args->type & ~ARG_REQUIRED) {
+        case ARG_INTEGER:
+        case ARG_BOOLEAN:
+            sprintf(buf, "%ld", cmd_ln_int_r(config, args->name));
+            h = fnv_hash_str(h, buf);
+            break;
+        case ARG_FLOATING:
+            sprintf(buf, "%.17g", cmd_ln_float_r(config, args->name));
+            h = fnv_hash_str(h, buf);
+            break;
+        default:
+            h = fnv_hash_str(h, cmd_ln_str_r(config, args->name));
+            break;
+        }
+    }
+    return h;
+}
+
+fe_cache_t *
+fe_cache_init(fe_t *fe, char const *dir)
+{
+    fe_cache_t *fc;
+    cmd_ln_t *config;
+
+    if (build_directory(dir) < 0) {
+        E_ERROR_SYSTEM("Failed to create feature cache directory %s", dir);
+        return NULL;
+    }
+
+    fc = ckd_calloc(1, sizeof(*fc));
+    fc->refcount = 1;
+    fc->fe = fe_retain(fe);
+    fc->dir = ckd_salloc(dir);
+    fc->veclen = fe_get_output_size(fe);
+    fc->cfg_hash = fe_cache_hash_config(fe);
+    fc->enabled = TRUE;
+
+    config = (cmd_ln_t *)fe_get_config(fe);
+    if (cmd_ln_boolean_r(config, "-dither")) {
+        /* The dither sequence depends on everything processed so
+         * far, so the same audio does not give the same features. */
+        E_WARN("Dither is enabled, feature cache in %s will not be used\n",
+               dir);
+        fc->enabled = FALSE;
+    }
+    E_INFO("Using feature cache in %s\n", dir);
+
+    return fc;
+}
+
+fe_cache_t *
+fe_cache_retain(fe_cache_t *fc)
+{
+    ++fc->refcount;
+    return fc;
+}
+
+static void
+fe_cache_release_entry(fe_cache_t *fc)
+{
+    if (fc->mf)
+        mmio_file_unmap(fc->mf);
+    fc->mf = NULL;
+    ckd_free(fc->rows);
+    fc->rows = NULL;
+    ckd_free_2d(fc->cep);
+    fc->cep = NULL;
+}
+
+int
+fe_cache_free(fe_cache_t *fc)
+{
+    if (fc == NULL)
+        return 0;
+    if (--fc->refcount > 0)
+        return fc->refcount;
+    fe_cache_release_entry(fc);
+    fe_free(fc->fe);
+    ckd_free(fc->dir);
+    ckd_free(fc);
+    return 0;
+}
+
+uint64
+fe_cache_key(fe_cache_t *fc, int16 const *spch, size_t nsamps)
+{
+    uint64 n = nsamps;
+    uint64 h;
+
+    h = fnv_hash(fc->cfg_hash, &n, sizeof(n));
+    return fnv_hash(h, spch, nsamps * sizeof(*spch));
+}
+
+static char *
+fe_cache_path(fe_cache_t *fc, uint64 key)
+{
+    char name[32];
+
+    sprintf(name, "%08x%08x.fec",
+            (unsigned int)(key >> 32), (unsigned int)(key & 0xffffffff));
+    return string_join(fc->dir, "/", name, NULL);
+}
+
+/**
+ * Map an entry and check that it really is the one we want.
+ */
+static int
+fe_cache_lookup(fe_cache_t *fc, char const *path, uint64 key, size_t nsamps,
+                mfcc_t ***out_cep, int32 *out_nframes)
+{
+    struct stat st;
+    uint32 const *hdr;
+    mfcc_t *data;
+    int32 nframes, i;
+
+    if (stat(path, &st) < 0 || st.st_size < (off_t)(HDR_SIZE * sizeof(uint32)))
+        return FALSE;
+    if ((fc->mf = mmio_file_read(path)) == NULL)
+        return FALSE;
+    hdr = mmio_file_ptr(fc->mf);
+    nframes = hdr[HDR_NFRAMES];
+    if (hdr[HDR_MAGIC] != FE_CACHE_MAGIC
+        || hdr[HDR_BYTEORDER] != FE_CACHE_BYTEORDER
+        || hdr[HDR_VERSION] != FE_CACHE_VERSION
+        || hdr[HDR_MFCC_SIZE] != sizeof(mfcc_t)
+        || hdr[HDR_KEY_HI] != (uint32)(key >> 32)
+        || hdr[HDR_KEY_LO] != (uint32)(key & 0xffffffff)
+        || hdr[HDR_NSAMPS_HI] != (uint32)((uint64)nsamps >> 32)
+        || hdr[HDR_NSAMPS_LO] != (uint32)(nsamps & 0xffffffff)
+        || hdr[HDR_VECLEN] != (uint32)fc->veclen
+        || nframes < 0
+        || st.st_size != (off_t)(HDR_SIZE * sizeof(uint32)
+                                 + (size_t)nframes * fc->veclen
+                                 * sizeof(mfcc_t))) {
+        E_WARN("Ignoring invalid feature cache entry %s\n", path);
+        mmio_file_unmap(fc->mf);
+        fc->mf = NULL;
+        return FALSE;
+    }
+
+    data = (mfcc_t *)(hdr + HDR_SIZE);
+    fc->rows = ckd_calloc(nframes + 1, sizeof(*fc->rows));
+    for (i = 0; i < nframes; ++i)
+        fc->rows[i] = data + i * fc->veclen;
+    *out_cep = fc->rows;
+    *out_nframes = nframes;
+    return TRUE;
+}
+
+static int
+fe_cache_store(fe_cache_t *fc, char const *path, uint64 key, size_t nsamps,
+               mfcc_t **cep, int32 nframes)
+{
+    uint32 hdr[HDR_SIZE];
+    char tmpname[64];
+    char *tmppath;
+    FILE *fh;
+    int rv = 0;
+
+    hdr[HDR_MAGIC] = FE_CACHE_MAGIC;
+    hdr[HDR_BYTEORDER] = FE_CACHE_BYTEORDER;
+    hdr[HDR_VERSION] = FE_CACHE_VERSION;
+    hdr[HDR_MFCC_SIZE] = sizeof(mfcc_t);
+    hdr[HDR_KEY_HI] = (uint32)(key >> 32);
+    hdr[HDR_KEY_LO] = (uint32)(key & 0xffffffff);
+    hdr[HDR_NSAMPS_HI] = (uint32)((uint64)nsamps >> 32);
+    hdr[HDR_NSAMPS_LO] = (uint32)(nsamps & 0xffffffff);
+    hdr[HDR_NFRAMES] = nframes;
+    hdr[HDR_VECLEN] = fc->veclen;
+
+    /* Unique per process and per cache object. */
+    sprintf(tmpname, ".tmp.%d.%lx", (int)getpid(), (unsigned long)(size_t)fc);
+    tmppath = string_join(path, tmpname, NULL);
+    if ((fh = fopen(tmppath, "wb")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open %s for writing", tmppath);
+        ckd_free(tmppath);
+        return -1;
+    }
+    if (fwrite(hdr, sizeof(uint32), HDR_SIZE, fh) != HDR_SIZE
+        || (nframes > 0
+            && fwrite(cep[0], sizeof(mfcc_t), (size_t)nframes * fc->veclen, fh)
+            != (size_t)nframes * fc->veclen)) {
+        E_ERROR_SYSTEM("Failed to write %s", tmppath);
+        rv = -1;
+    }
+    if (fclose(fh) != 0)
+        rv = -1;
+    if (rv == 0 && rename(tmppath, path) < 0) {
+        /* Most likely someone else stored it first (rename() will
+         * not replace an existing file on Windows). */
+        rv = -1;
+    }
+    if (rv < 0)
+        remove(tmppath);
+    ckd_free(tmppath);
+    return rv;
+}
+
+int
+fe_cache_process_utt(fe_cache_t *fc, int16 const *spch, size_t nsamps,
+                     mfcc_t ***out_cep, int32 *out_nframes)
+{
+    char *path = NULL;
+    uint64 key = 0;
+    int32 nframes, ntail;
+    size_t nleft;
+
+    fe_cache_release_entry(fc);
+
+    if (fc->enabled) {
+        key = fe_cache_key(fc, spch, nsamps);
+        path = fe_cache_path(fc, key);
+        if (fe_cache_lookup(fc, path, key, nsamps, out_cep, out_nframes)) {
+            ckd_free(path);
+            return 1;
+        }
+    }
+
+    /* Process the utterance as its own stream, since the noise
+     * statistics would otherwise depend on what came before it. */
+    fe_start_stream(fc->fe);
+    fe_start_utt(fc->fe);
+    nleft = nsamps;
+    if (fe_process_frames(fc->fe, NULL, &nleft, NULL, &nframes, NULL) < 0) {
+        ckd_free(path);
+        return -1;
+    }
+    fc->cep = ckd_calloc_2d(nframes + 1, fc->veclen, sizeof(**fc->cep));
+    if (fe_process_frames(fc->fe, &spch, &nleft, fc->cep, &nframes, NULL) < 0) {
+        ckd_free(path);
+        return -1;
+    }
+    fe_end_utt(fc->fe, fc->cep[nframes], &ntail);
+    nframes += ntail;
+
+    if (fc->enabled && fe_cache_store(fc, path, key, nsamps,
+                                      fc->cep, nframes) < 0)
+        E_WARN("Failed to store features in cache entry %s\n", path);
+    ckd_free(path);
+
+    *out_cep = fc->cep;
+    *out_nframes = nframes;
+    return 0;
+}
@@ -0,0 +1,361 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file fe_fft_simd.c
+ * @brief Vectorized backends for the real FFT in fe_sigproc.c
+ *
+ * These follow exactly the same butterfly structure as
+ * fe_fft_real_ref(), but do several of the complex-twiddle
+ * butterflies in each stage at once.  Within a stage, butterflies
+ * for different twiddle indices touch disjoint points, so this is
+ * safe, and since each lane does the same operations in the same
+ * order as the scalar code, the results are identical to it.  This
+ * only holds if the compiler does not fuse multiplies and adds into
+ * FMA instructions in the scalar code, so the front end is built
+ * with -ffp-contract=off where the compiler supports it.
+ *
+ * The fixed-point front end always uses the reference code.
+ */
+
+#include <string.h>
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "sphinxbase/prim_type.h"
+#include "sphinxbase/ckd_alloc.h"
+#include "sphinxbase/err.h"
+
+#include "fe_internal.h"
+
+#if !defined(FIXED_POINT)
+#if defined(__SSE2__) || defined(_M_X64)
+#define FE_FFT_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FE_FFT_AVX2
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define FE_FFT_NEON
+#include <arm_neon.h>
+#endif
+#endif /* !FIXED_POINT */
+
+#if defined(FE_FFT_SSE2) || defined(FE_FFT_AVX2) || defined(FE_FFT_NEON)
+/**
+ * Repack the twiddle factors so that each stage's are contiguous.
+ * Stage k uses the (1<<(k-1)) entries starting at (1<<(k-1)).
+ */
+static void
+fe_fft_pack_twiddle(fe_t * fe)
+{
+    int k, j, m;
+
+    m = fe->fft_order;
+    fe->stage_ccc = ckd_calloc(fe->fft_size / 2, sizeof(*fe->stage_ccc));
+    fe->stage_sss = ckd_calloc(fe->fft_size / 2, sizeof(*fe->stage_sss));
+    for (k = 1; k < m; ++k) {
+        int quarter = 1 << (k - 1);
+        for (j = 0; j < quarter; ++j) {
+            fe->stage_ccc[quarter + j] = fe->ccc[j << (m - k - 1)];
+            fe->stage_sss[quarter + j] = fe->sss[j << (m - k - 1)];
+        }
+    }
+}
+
+/**
+ * Scalar butterflies with complex twiddle factors, for the leftover
+ * indices [j, quarter) in a block that do not fill a vector.
+ */
+static void
+fe_fft_block_scalar(frame_t * x, frame_t const *cs, frame_t const *ss,
+                    int i, int half, int quarter, int j)
+{
+    for (; j < quarter; ++j) {
+        frame_t cc, sn, t1, t2;
+        int i1, i2, i3, i4;
+
+        i1 = i + j;
+        i2 = i + half - j;
+        i3 = i + half + j;
+        i4 = i + half + half - j;
+        cc = cs[j];
+        sn = ss[j];
+
+        t1 = x[i3] * cc + x[i4] * sn;
+        t2 = x[i3] * sn - x[i4] * cc;
+
+        x[i4] = (x[i2] - t2);
+        x[i3] = (-x[i2] - t2);
+        x[i2] = (x[i1] - t1);
+        x[i1] = (x[i1] + t1);
+    }
+}
+
+/**
+ * Butterflies with real twiddle factors at the start of each block.
+ */
+static void
+fe_fft_block_head(frame_t * x, int i, int half, int quarter)
+{
+    frame_t xt;
+
+    xt = x[i];
+    x[i] = (xt + x[i + half]);
+    x[i + half] = (xt - x[i + half]);
+    x[i + half + quarter] = -x[i + half + quarter];
+}
+#endif
+
+#ifdef FE_FFT_SSE2
+static int
+fe_fft_real_sse2(fe_t * fe)
+{
+    frame_t *x;
+    int i, j, k, m, n;
+    __m128d signmask;
+
+    x = fe->frame;
+    m = fe->fft_order;
+    n = fe->fft_size;
+    signmask = _mm_set1_pd(-0.0);
+
+    fe_fft_stage0(x, n);
+    for (k = 1; k < m; ++k) {
+        int half = 1 << k, quarter = 1 << (k - 1);
+        frame_t const *cs = fe->stage_ccc + quarter;
+        frame_t const *ss = fe->stage_sss + quarter;
+
+        for (i = 0; i < n; i += 2 * half) {
+            fe_fft_block_head(x, i, half, quarter);
+            for (j = 1; j + 2 <= quarter; j += 2) {
+                __m128d x1, x2, x3, x4, cc, sn, t1, t2;
+
+                x1 = _mm_loadu_pd(x + i + j);
+                x3 = _mm_loadu_pd(x + i + half + j);
+                x2 = _mm_loadu_pd(x + i + half - j - 1);
+                x4 = _mm_loadu_pd(x + i + half + half - j - 1);
+                x2 = _mm_shuffle_pd(x2, x2, 1);
+                x4 = _mm_shuffle_pd(x4, x4, 1);
+                cc = _mm_loadu_pd(cs + j);
+                sn = _mm_loadu_pd(ss + j);
+
+                t1 = _mm_add_pd(_mm_mul_pd(x3, cc), _mm_mul_pd(x4, sn));
+                t2 = _mm_sub_pd(_mm_mul_pd(x3, sn), _mm_mul_pd(x4, cc));
+
+                x4 = _mm_sub_pd(x2, t2);
+                x3 = _mm_sub_pd(_mm_xor_pd(x2, signmask), t2);
+                x2 = _mm_sub_pd(x1, t1);
+                x1 = _mm_add_pd(x1, t1);
+
+                _mm_storeu_pd(x + i + j, x1);
+                _mm_storeu_pd(x + i + half + j, x3);
+                _mm_storeu_pd(x + i + half - j - 1,
+                              _mm_shuffle_pd(x2, x2, 1));
+                _mm_storeu_pd(x + i + half + half - j - 1,
+                              _mm_shuffle_pd(x4, x4, 1));
+            }
+            fe_fft_block_scalar(x, cs, ss, i, half, quarter, j);
+        }
+    }
+    return m;
+}
+#endif /* FE_FFT_SSE2 */
+
+#ifdef FE_FFT_AVX2
+__attribute__((target("avx2")))
+static int
+fe_fft_real_avx2(fe_t * fe)
+{
+    frame_t *x;
+    int i, j, k, m, n;
+    __m256d signmask;
+
+    x = fe->frame;
+    m = fe->fft_order;
+    n = fe->fft_size;
+    signmask = _mm256_set1_pd(-0.0);
+
+    fe_fft_stage0(x, n);
+    for (k = 1; k < m; ++k) {
+        int half = 1 << k, quarter = 1 << (k - 1);
+        frame_t const *cs = fe->stage_ccc + quarter;
+        frame_t const *ss = fe->stage_sss + quarter;
+
+        for (i = 0; i < n; i += 2 * half) {
+            fe_fft_block_head(x, i, half, quarter);
+            for (j = 1; j + 4 <= quarter; j += 4) {
+                __m256d x1, x2, x3, x4, cc, sn, t1, t2;
+
+                x1 = _mm256_loadu_pd(x + i + j);
+                x3 = _mm256_loadu_pd(x + i + half + j);
+                x2 = _mm256_loadu_pd(x + i + half - j - 3);
+                x4 = _mm256_loadu_pd(x + i + half + half - j - 3);
+                x2 = _mm256_permute4x64_pd(x2, 0x1b);
+                x4 = _mm256_permute4x64_pd(x4, 0x1b);
+                cc = _mm256_loadu_pd(cs + j);
+                sn = _mm256_loadu_pd(ss + j);
+
+                t1 = _mm256_add_pd(_mm256_mul_pd(x3, cc),
+                                   _mm256_mul_pd(x4, sn));
+                t2 = _mm256_sub_pd(_mm256_mul_pd(x3, sn),
+                                   _mm256_mul_pd(x4, cc));
+
+                x4 = _mm256_sub_pd(x2, t2);
+                x3 = _mm256_sub_pd(_mm256_xor_pd(x2, signmask), t2);
+                x2 = _mm256_sub_pd(x1, t1);
+                x1 = _mm256_add_pd(x1, t1);
+
+                _mm256_storeu_pd(x + i + j, x1);
+                _mm256_storeu_pd(x + i + half + j, x3);
+                _mm256_storeu_pd(x + i + half - j - 3,
+                                 _mm256_permute4x64_pd(x2, 0x1b));
+                _mm256_storeu_pd(x + i + half + half - j - 3,
+                                 _mm256_permute4x64_pd(x4, 0x1b));
+            }
+            fe_fft_block_scalar(x, cs, ss, i, half, quarter, j);
+        }
+    }
+    return m;
+}
+#endif /* FE_FFT_AVX2 */
+
+#ifdef FE_FFT_NEON
+static int
+fe_fft_real_neon(fe_t * fe)
+{
+    frame_t *x;
+    int i, j, k, m, n;
+
+    x = fe->frame;
+    m = fe->fft_order;
+    n = fe->fft_size;
+
+    fe_fft_stage0(x, n);
+    for (k = 1; k < m; ++k) {
+        int half = 1 << k, quarter = 1 << (k - 1);
+        frame_t const *cs = fe->stage_ccc + quarter;
+        frame_t const *ss = fe->stage_sss + quarter;
+
+        for (i = 0; i < n; i += 2 * half) {
+            fe_fft_block_head(x, i, half, quarter);
+            for (j = 1; j + 2 <= quarter; j += 2) {
+                float64x2_t x1, x2, x3, x4, cc, sn, t1, t2;
+
+                x1 = vld1q_f64(x + i + j);
+                x3 = vld1q_f64(x + i + half + j);
+                x2 = vld1q_f64(x + i + half - j - 1);
+                x4 = vld1q_f64(x + i + half + half - j - 1);
+                x2 = vextq_f64(x2, x2, 1);
+                x4 = vextq_f64(x4, x4, 1);
+                cc = vld1q_f64(cs + j);
+                sn = vld1q_f64(ss + j);
+
+                /* Separate multiplies and adds (no FMA) to match the
+                 * reference rounding exactly. */
+                t1 = vaddq_f64(vmulq_f64(x3, cc), vmulq_f64(x4, sn));
+                t2 = vsubq_f64(vmulq_f64(x3, sn), vmulq_f64(x4, cc));
+
+                x4 = vsubq_f64(x2, t2);
+                x3 = vsubq_f64(vnegq_f64(x2), t2);
+                x2 = vsubq_f64(x1, t1);
+                x1 = vaddq_f64(x1, t1);
+
+                vst1q_f64(x + i + j, x1);
+                vst1q_f64(x + i + half + j, x3);
+                vst1q_f64(x + i + half - j - 1, vextq_f64(x2, x2, 1));
+                vst1q_f64(x + i + half + half - j - 1,
+                          vextq_f64(x4, x4, 1));
+            }
+            fe_fft_block_scalar(x, cs, ss, i, half, quarter, j);
+        }
+    }
+    return m;
+}
+#endif /* FE_FFT_NEON */
+
+int
+fe_fft_set_backend(fe_t * fe, char const *name)
+{
+    if (0 == strcmp(name, "reference")) {
+        fe->fft_real = fe_fft_real_ref;
+        fe->fft_backend = "reference";
+        return 0;
+    }
+#if defined(FE_FFT_SSE2) || defined(FE_FFT_AVX2) || defined(FE_FFT_NEON)
+    /* Too small to be worth it (and stage 2 has no vector work) */
+    if (fe->fft_order < 4)
+        return -1;
+    if (fe->stage_ccc == NULL)
+        fe_fft_pack_twiddle(fe);
+#endif
+#ifdef FE_FFT_NEON
+    if (0 == strcmp(name, "neon")) {
+        fe->fft_real = fe_fft_real_neon;
+        fe->fft_backend = "neon";
+        return 0;
+    }
+#endif
+#ifdef FE_FFT_SSE2
+    if (0 == strcmp(name, "sse2")) {
+        fe->fft_real = fe_fft_real_sse2;
+        fe->fft_backend = "sse2";
+        return 0;
+    }
+#endif
+#ifdef FE_FFT_AVX2
+    if (0 == strcmp(name, "avx2")) {
+        __builtin_cpu_init();
+        if (!__builtin_cpu_supports("avx2"))
+            return -1;
+        fe->fft_real = fe_fft_real_avx2;
+        fe->fft_backend = "avx2";
+        return 0;
+    }
+#endif
+    return -1;
+}
+
+void
+fe_fft_select_backend(fe_t * fe)
+{
+    /* Widest vectors first. */
+    if (fe_fft_set_backend(fe, "avx2") == 0
+        || fe_fft_set_backend(fe, "sse2") == 0
+        || fe_fft_set_backend(fe, "neon") == 0)
+        return;
+    fe_fft_set_backend(fe, "reference");
+}
@@ -67,6 +67,17 @@ fe_parse_general_params(cmd_ln_t *config, fe_t * fe)
 
     fe->config = config;
     fe->sampling_rate = cmd_ln_float32_r(config, "-samprate");
+    fe->input_sampling_rate = cmd_ln_float32_r(config, "-input_samprate");
+    if (fe->input_sampling_rate == 0)
+        fe->input_sampling_rate = fe->sampling_rate;
+    if (fe->input_sampling_rate != fe->sampling_rate
+        && (fe->input_sampling_rate != (int32)fe->input_sampling_rate
+            || fe->sampling_rate != (int32)fe->sampling_rate
+            || fe->input_sampling_rate < 0)) {
+        E_ERROR("Can only resample between integral rates, not %.02f and %.02f\n",
+                fe->input_sampling_rate, fe->sampling_rate);
+        return -1;
+    }
     frate = cmd_ln_int32_r(config, "-frate");
     if (frate > MAX_INT16 || frate > fe->sampling_rate || frate < 1) {
         E_ERROR
@@ -172,9 +183,12 @@ fe_print_current(fe_t const *fe)
 {
     E_INFO("Current FE Parameters:\n");
     E_INFO("\tSampling Rate:             %f\n", fe->sampling_rate);
+    if (fe->resampler)
+        E_INFO("\tInput Sampling Rate:       %f\n", fe->input_sampling_rate);
     E_INFO("\tFrame Size:                %d\n", fe->frame_size);
     E_INFO("\tFrame Shift:               %d\n", fe->frame_shift);
     E_INFO("\tFFT Size:                  %d\n", fe->fft_size);
+    E_INFO("\tFFT Backend:               %s\n", fe->fft_backend);
     E_INFO("\tLower Frequency:           %g\n",
            fe->mel_fb->lower_filt_freq);
     E_INFO("\tUpper Frequency:           %g\n",
@@ -202,6 +216,52 @@ fe_print_current(fe_t const *fe)
            fe->mel_fb->doublewide ? "" : "not ");
 }
 
+/**
+ * Allocate the per-stream state (buffers, noise statistics and VAD
+ * data) for a front end whose shared tables are already set up.
+ */
+/* Length of the frames held in the prespeech buffer. */
+static int
+fe_prespch_frame_len(fe_t *fe)
+{
+    /* Features for the warp candidates follow the usual ones. */
+    if (fe->n_warp > 0)
+        return fe_get_output_size(fe);
+    return fe->log_spec != RAW_LOG_SPEC ? fe->num_cepstra : fe->mel_fb->num_filters;
+}
+
+static void
+fe_alloc_stream(fe_t *fe)
+{
+
+    /* establish buffers for overflow samps */
+    fe->overflow_samps = ckd_calloc(fe->frame_size, sizeof(int16));
+
+    /* Resampler and its output buffer (allocated as needed). */
+    if (fe->input_sampling_rate != fe->sampling_rate)
+        fe->resampler = fe_resampler_init((int32)fe->input_sampling_rate,
+                                          (int32)fe->sampling_rate);
+    else
+        fe->resampler = NULL;
+    fe->resamp_buf = NULL;
+    fe->resamp_nbuf = fe->resamp_alloc = 0;
+
+    if (fe->remove_noise || fe->remove_silence)
+        fe->noise_stats = fe_init_noisestats(fe->mel_fb->num_filters);
+
+    fe->vad_data = (vad_data_t*)ckd_calloc(1, sizeof(*fe->vad_data));
+    fe->vad_data->prespch_buf = fe_prespch_init(fe->pre_speech + 1, fe_prespch_frame_len(fe), fe->frame_shift);
+
+    /* Create temporary FFT, spectrum and mel-spectrum buffers. */
+    /* FIXME: Gosh there are a lot of these. */
+    fe->spch = ckd_calloc(fe->frame_size, sizeof(*fe->spch));
+    fe->frame = ckd_calloc(fe->fft_size, sizeof(*fe->frame));
+    fe->spec = ckd_calloc(fe->fft_size, sizeof(*fe->spec));
+    /* Padded for fe_mel_cep() */
+    fe->mfspec = ckd_calloc((fe->mel_fb->num_filters + FE_MEL_PAD - 1)
+                            & ~(FE_MEL_PAD - 1), sizeof(*fe->mfspec));
+}
+
 fe_t *
 fe_init_auto()
 {
@@ -212,7 +272,6 @@ fe_t *
 fe_init_auto_r(cmd_ln_t *config)
 {
     fe_t *fe;
-    int prespch_frame_len;
 
     fe = (fe_t*)ckd_calloc(1, sizeof(*fe));
     fe->refcount = 1;
@@ -255,8 +314,7 @@ fe_init_auto_r(cmd_ln_t *config)
     if (fe->dither)
         fe_init_dither(fe->dither_seed);
 
-    /* establish buffers for overflow samps and hamming window */
-    fe->overflow_samps = ckd_calloc(fe->frame_size, sizeof(int16));
+    /* establish buffer for hamming window */
     fe->hamming_window = ckd_calloc(fe->frame_size/2, sizeof(window_t));
 
     /* create hamming window */
@@ -278,24 +336,14 @@ fe_init_auto_r(cmd_ln_t *config)
     fe_build_melfilters(fe->mel_fb);
 
     fe_compute_melcosine(fe->mel_fb);
-    if (fe->remove_noise || fe->remove_silence)
-        fe->noise_stats = fe_init_noisestats(fe->mel_fb->num_filters);
-
-    fe->vad_data = (vad_data_t*)ckd_calloc(1, sizeof(*fe->vad_data));
-    prespch_frame_len = fe->log_spec != RAW_LOG_SPEC ? fe->num_cepstra : fe->mel_fb->num_filters;
-    fe->vad_data->prespch_buf = fe_prespch_init(fe->pre_speech + 1, prespch_frame_len, fe->frame_shift);
-
-    /* Create temporary FFT, spectrum and mel-spectrum buffers. */
-    /* FIXME: Gosh there are a lot of these. */
-    fe->spch = ckd_calloc(fe->frame_size, sizeof(*fe->spch));
-    fe->frame = ckd_calloc(fe->fft_size, sizeof(*fe->frame));
-    fe->spec = ckd_calloc(fe->fft_size, sizeof(*fe->spec));
-    fe->mfspec = ckd_calloc(fe->mel_fb->num_filters, sizeof(*fe->mfspec));
+    fe_compute_dct_matrix(fe);
+    fe_alloc_stream(fe);
 
     /* create twiddle factors */
     fe->ccc = ckd_calloc(fe->fft_size / 4, sizeof(*fe->ccc));
     fe->sss = ckd_calloc(fe->fft_size / 4, sizeof(*fe->sss));
     fe_create_twiddle(fe);
+    fe_fft_select_backend(fe);
 
     if (cmd_ln_boolean_r(config, "-verbose")) {
         fe_print_current(fe);
@@ -306,6 +354,25 @@ fe_init_auto_r(cmd_ln_t *config)
     return fe;
 }
 
+fe_t *
+fe_clone(fe_t *fe)
+{
+    fe_t *cfe;
+
+    cfe = (fe_t*)ckd_malloc(sizeof(*cfe));
+    memcpy(cfe, fe, sizeof(*cfe));
+    cfe->refcount = 1;
+    cmd_ln_retain(cfe->config);
+    /* Tables are always owned by the original front end. */
+    cfe->parent = fe_retain(fe->parent ? fe->parent : fe);
+    cfe->noise_stats = NULL;
+    fe_alloc_stream(cfe);
+
+    fe_start_stream(cfe);
+    fe_start_utt(cfe);
+    return cfe;
+}
+
 arg_t const *
 fe_get_args(void)
 {
@@ -341,6 +408,9 @@ fe_start_utt(fe_t * fe)
     memset(fe->overflow_samps, 0, fe->frame_size * sizeof(int16));
     fe->pre_emphasis_prior = 0;
     fe_reset_vad_data(fe->vad_data);
+    if (fe->resampler)
+        fe_resampler_reset(fe->resampler);
+    fe->resamp_nbuf = 0;
     return 0;
 }
 
@@ -354,7 +424,7 @@ fe_start_stream(fe_t *fe)
 int
 fe_get_output_size(fe_t *fe)
 {
-    return (int)fe->feature_dimension;
+    return (int)fe->feature_dimension * (1 + fe->n_warp);
 }
 
 void
@@ -373,6 +443,12 @@ fe_get_vad_state(fe_t *fe)
     return fe->vad_data->in_speech;
 }
 
+int32
+fe_get_vad_silence(fe_t *fe)
+{
+    return fe->vad_data->post_speech_frames;
+}
+
 int
 fe_process_frames(fe_t *fe,
                   int16 const **inout_spch,
@@ -398,11 +474,28 @@ fe_copy_from_prespch(fe_t *fe, int32 *inout_nframes, mfcc_t **buf_cep, int outid
     return outidx;    
 }
 
+/**
+ * Append the audio held in the prespeech buffer to the voiced speech.
+ */
+static void
+fe_copy_pcm_from_prespch(fe_t *fe, int16 *voiced_spch,
+                         int32 *voiced_spch_nsamps)
+{
+    int32 nsamps;
+
+    if (voiced_spch == NULL)
+        return;
+    fe_prespch_read_pcm(fe->vad_data->prespch_buf,
+                        voiced_spch + *voiced_spch_nsamps, &nsamps);
+    *voiced_spch_nsamps += nsamps;
+}
+
 /**
  * Update pointers after we processed a frame. A complex logic used in two places in fe_process_frames
  */
 static int
-fe_check_prespeech(fe_t *fe, int32 *inout_nframes, mfcc_t **buf_cep, int outidx, int32 *out_frameidx, size_t *inout_nsamps, int orig_nsamps)
+fe_check_prespeech(fe_t *fe, int32 *inout_nframes, mfcc_t **buf_cep, int outidx, int32 *out_frameidx, size_t *inout_nsamps, int orig_nsamps,
+                   int16 *voiced_spch, int32 *voiced_spch_nsamps)
 {
     if (fe->vad_data->in_speech) {    
 	if (fe_prespch_ncep(fe->vad_data->prespch_buf) > 0) {
@@ -410,6 +503,7 @@ fe_check_prespeech(fe_t *fe, int32 *inout_nframes, mfcc_t **buf_cep, int outidx,
     	    /* Previous frame triggered vad into speech state. Last frame is in the end of 
     	       prespeech buffer, so overwrite it */
     	    outidx = fe_copy_from_prespch(fe, inout_nframes, buf_cep, outidx);
+            fe_copy_pcm_from_prespch(fe, voiced_spch, voiced_spch_nsamps);
 
             /* Sets the start frame for the returned data so that caller can update timings */
 	    if (out_frameidx) {
@@ -418,6 +512,12 @@ fe_check_prespeech(fe_t *fe, int32 *inout_nframes, mfcc_t **buf_cep, int outidx,
     	} else {
 	    outidx++;
     	    (*inout_nframes)--;
+            /* Each frame contributes the samples it advances by. */
+            if (voiced_spch) {
+                memcpy(voiced_spch + *voiced_spch_nsamps, fe->spch,
+                       fe->frame_shift * sizeof(*voiced_spch));
+                *voiced_spch_nsamps += fe->frame_shift;
+            }
     	}
     }
     /* Amount of data behind the original input which is still needed. */
@@ -427,15 +527,15 @@ fe_check_prespeech(fe_t *fe, int32 *inout_nframes, mfcc_t **buf_cep, int outidx,
     return outidx;
 }
 
-int 
-fe_process_frames_ext(fe_t *fe,
-                  int16 const **inout_spch,
-                  size_t *inout_nsamps,
-                  mfcc_t **buf_cep,
-                  int32 *inout_nframes,
-                  int16 *voiced_spch,
-                  int32 *voiced_spch_nsamps,
-                  int32 *out_frameidx)
+static int
+fe_process_frames_core(fe_t *fe,
+                       int16 const **inout_spch,
+                       size_t *inout_nsamps,
+                       mfcc_t **buf_cep,
+                       int32 *inout_nframes,
+                       int16 *voiced_spch,
+                       int32 *voiced_spch_nsamps,
+                       int32 *out_frameidx)
 {
     int outidx, n_overflow, orig_n_overflow;
     int16 const *orig_spch;
@@ -461,6 +561,8 @@ fe_process_frames_ext(fe_t *fe,
 
     if (out_frameidx)
         *out_frameidx = 0;
+    if (voiced_spch_nsamps)
+        *voiced_spch_nsamps = 0;
 
     /* Are there not enough samples to make at least 1 frame? */
     if (*inout_nsamps + fe->num_overflow_samps < (size_t)fe->frame_size) {
@@ -490,6 +592,7 @@ fe_process_frames_ext(fe_t *fe,
     /* Try to read from prespeech buffer */
     if (fe->vad_data->in_speech && fe_prespch_ncep(fe->vad_data->prespch_buf) > 0) {
     	outidx = fe_copy_from_prespch(fe, inout_nframes, buf_cep, outidx);
+        fe_copy_pcm_from_prespch(fe, voiced_spch, voiced_spch_nsamps);
         if ((*inout_nframes) < 1) {
             /* mfcc buffer is filled from prespeech buffer */
             *inout_nframes = outidx;
@@ -520,14 +623,16 @@ fe_process_frames_ext(fe_t *fe,
     }
 
     fe_write_frame(fe, buf_cep[outidx], voiced_spch != NULL);
-    outidx = fe_check_prespeech(fe, inout_nframes, buf_cep, outidx, out_frameidx, inout_nsamps, orig_nsamps);
+    outidx = fe_check_prespeech(fe, inout_nframes, buf_cep, outidx, out_frameidx, inout_nsamps, orig_nsamps,
+                                voiced_spch, voiced_spch_nsamps);
 
     /* Process all remaining frames. */
     while (*inout_nframes > 0 && *inout_nsamps >= (size_t)fe->frame_shift) {
         fe_shift_frame(fe, *inout_spch, fe->frame_shift);
         fe_write_frame(fe, buf_cep[outidx], voiced_spch != NULL);
 
-	outidx = fe_check_prespeech(fe, inout_nframes, buf_cep, outidx, out_frameidx, inout_nsamps, orig_nsamps);
+	outidx = fe_check_prespeech(fe, inout_nframes, buf_cep, outidx, out_frameidx, inout_nsamps, orig_nsamps,
+                                    voiced_spch, voiced_spch_nsamps);
 
         /* Update input-output pointers and counters. */
         *inout_spch += fe->frame_shift;
@@ -582,6 +687,118 @@ fe_process_frames_ext(fe_t *fe,
     return 0;
 }
 
+/**
+ * Resample input and pass it on to fe_process_frames_core().
+ *
+ * No more input is resampled than the core could consume given the
+ * number of frames requested, so that unused input stays with the
+ * caller as usual.  Resampled audio is only left over (and kept for
+ * the next call) when prespeech frames are output first.
+ */
+static int
+fe_process_frames_resampled(fe_t *fe,
+                            int16 const **inout_spch,
+                            size_t *inout_nsamps,
+                            mfcc_t **buf_cep,
+                            int32 *inout_nframes,
+                            int16 *voiced_spch,
+                            int32 *voiced_spch_nsamps,
+                            int32 *out_frameidx)
+{
+    int16 const *rsptr;
+    size_t rsnsamps;
+    int32 want;
+    int rv;
+
+    if (buf_cep == NULL) {
+        rsnsamps = fe->resamp_nbuf
+            + fe_resampler_max_output(fe->resampler, *inout_nsamps);
+        return fe_process_frames_core(fe, NULL, &rsnsamps, NULL,
+                                      inout_nframes, NULL, NULL, NULL);
+    }
+
+    /* Number of samples the core will take without leaving any,
+     * including what goes into the overflow buffer. */
+    if (*inout_nframes > 0)
+        want = *inout_nframes * fe->frame_shift - 1
+            + fe->frame_size - fe->num_overflow_samps;
+    else
+        want = fe->frame_size - fe->num_overflow_samps - 1;
+    if (want > fe->resamp_nbuf) {
+        if (want > fe->resamp_alloc) {
+            fe->resamp_buf = ckd_realloc(fe->resamp_buf,
+                                         want * sizeof(*fe->resamp_buf));
+            fe->resamp_alloc = want;
+        }
+        fe->resamp_nbuf += (int32)
+            fe_resampler_process(fe->resampler, inout_spch, inout_nsamps,
+                                 fe->resamp_buf + fe->resamp_nbuf,
+                                 want - fe->resamp_nbuf);
+    }
+
+    rsptr = fe->resamp_buf;
+    rsnsamps = fe->resamp_nbuf;
+    rv = fe_process_frames_core(fe, &rsptr, &rsnsamps, buf_cep, inout_nframes,
+                                voiced_spch, voiced_spch_nsamps, out_frameidx);
+    memmove(fe->resamp_buf, rsptr, rsnsamps * sizeof(*fe->resamp_buf));
+    fe->resamp_nbuf = (int32)rsnsamps;
+    return rv;
+}
+
+int
+fe_process_frames_ext(fe_t *fe,
+                  int16 const **inout_spch,
+                  size_t *inout_nsamps,
+                  mfcc_t **buf_cep,
+                  int32 *inout_nframes,
+                  int16 *voiced_spch,
+                  int32 *voiced_spch_nsamps,
+                  int32 *out_frameidx)
+{
+    if (fe->resampler)
+        return fe_process_frames_resampled(fe, inout_spch, inout_nsamps,
+                                           buf_cep, inout_nframes,
+                                           voiced_spch, voiced_spch_nsamps,
+                                           out_frameidx);
+    return fe_process_frames_core(fe, inout_spch, inout_nsamps,
+                                  buf_cep, inout_nframes,
+                                  voiced_spch, voiced_spch_nsamps,
+                                  out_frameidx);
+}
+
+int
+fe_process_frames_batch(fe_t **fe, int nstreams,
+                        int16 const ***inout_spch,
+                        size_t *inout_nsamps,
+                        mfcc_t ***buf_cep,
+                        int32 *inout_nframes,
+                        int32 *out_frameidx)
+{
+    int i, rv;
+
+    /* Check that the streams are compatible before starting. */
+    for (i = 1; i < nstreams; ++i) {
+        if (fe[i]->frame_size != fe[0]->frame_size
+            || fe[i]->frame_shift != fe[0]->frame_shift
+            || fe_get_output_size(fe[i]) != fe_get_output_size(fe[0])) {
+            E_ERROR("Stream %d has different front-end parameters "
+                    "from stream 0\n", i);
+            return FE_INVALID_PARAM_ERROR;
+        }
+    }
+
+    rv = 0;
+    for (i = 0; i < nstreams; ++i) {
+        int irv = fe_process_frames(fe[i], inout_spch[i], &inout_nsamps[i],
+                                    buf_cep ? buf_cep[i] : NULL,
+                                    &inout_nframes[i],
+                                    out_frameidx ? &out_frameidx[i] : NULL);
+        if (irv < 0 && rv == 0)
+            rv = irv;
+    }
+    return rv;
+}
+
 int
 fe_process_utt(fe_t * fe, int16 const * spch, size_t nsamps,
                mfcc_t *** cep_block, int32 * nframes)
@@ -593,9 +810,9 @@ fe_process_utt(fe_t * fe, int16 const * spch, size_t nsamps,
     fe_process_frames(fe, NULL, &nsamps, NULL, nframes, NULL);
     /* Create the output buffer (it has to exist, even if there are no output frames). */
     if (*nframes)
-        cep = (mfcc_t **)ckd_calloc_2d(*nframes, fe->feature_dimension, sizeof(**cep));
+        cep = (mfcc_t **)ckd_calloc_2d(*nframes, fe_get_output_size(fe), sizeof(**cep));
     else
-        cep = (mfcc_t **)ckd_calloc_2d(1, fe->feature_dimension, sizeof(**cep));
+        cep = (mfcc_t **)ckd_calloc_2d(1, fe_get_output_size(fe), sizeof(**cep));
     /* Now just call fe_process_frames() with the allocated buffer. */
     rv = fe_process_frames(fe, &spch, &nsamps, cep, nframes, NULL);
     *cep_block = cep;
@@ -604,6 +821,130 @@ fe_process_utt(fe_t * fe, int16 const * spch, size_t nsamps,
 }
 
 
+static void
+fe_free_melfilters(melfb_t *mel_fb)
+{
+    ckd_free(mel_fb->spec_start);
+    ckd_free(mel_fb->filt_start);
+    ckd_free(mel_fb->filt_width);
+    ckd_free(mel_fb->filt_coeffs);
+    ckd_free(mel_fb->pad_start);
+    ckd_free(mel_fb->pad_width);
+    ckd_free(mel_fb->pad_coeffs);
+}
+
+static void
+fe_free_warp_candidates(fe_t *fe)
+{
+    int i;
+
+    for (i = 0; i < fe->n_warp; ++i) {
+        fe_free_melfilters(&fe->warp_fb[i]);
+        ckd_free(fe->warp_cand[i]);
+    }
+    ckd_free(fe->warp_fb);
+    ckd_free(fe->warp_cand);
+    fe->warp_fb = NULL;
+    fe->warp_cand = NULL;
+    fe->n_warp = 0;
+}
+
+int
+fe_set_warp_candidates(fe_t *fe, char const *warp_type,
+                       char const * const *warp_params, int n_warp)
+{
+    melfb_t *mel_fb = fe->mel_fb;
+    int i;
+
+    if (fe->parent || fe->refcount > 1) {
+        E_ERROR("Warp candidates must be set before cloning the front end\n");
+        return FE_INVALID_PARAM_ERROR;
+    }
+    if (fe->log_spec == SMOOTH_LOG_SPEC) {
+        E_ERROR("Warp candidates are not supported with -smoothspec\n");
+        return FE_INVALID_PARAM_ERROR;
+    }
+    fe_free_warp_candidates(fe);
+    if (n_warp > 0) {
+        if (warp_type == NULL)
+            warp_type = mel_fb->warp_type;
+        fe->warp_fb = ckd_calloc(n_warp, sizeof(*fe->warp_fb));
+        fe->warp_cand = ckd_calloc(n_warp, sizeof(*fe->warp_cand));
+        for (i = 0; i < n_warp; ++i) {
+            melfb_t *wfb = &fe->warp_fb[i];
+
+            /* Share everything but the filters themselves. */
+            memcpy(wfb, mel_fb, sizeof(*wfb));
+            if (fe_warp_set(wfb, warp_type) != FE_SUCCESS) {
+                fe_free_warp_candidates(fe);
+                return FE_INVALID_PARAM_ERROR;
+            }
+            fe->warp_cand[i] = ckd_salloc(warp_params[i]);
+            /* Only warp_id is used after this. */
+            wfb->warp_type = NULL;
+            wfb->warp_params = fe->warp_cand[i];
+            /* Warping parameters are global, so each candidate's
+             * are set in turn while building its filters. */
+            fe_warp_set_parameters(wfb, wfb->warp_params,
+                                   wfb->sampling_rate);
+            fe_build_melfilters(wfb);
+            ++fe->n_warp;
+        }
+        /* Put back the front end's own. */
+        fe_warp_set_parameters(mel_fb, mel_fb->warp_params,
+                               mel_fb->sampling_rate);
+    }
+
+    /* The prespeech buffer holds whole output frames. */
+    fe_prespch_free(fe->vad_data->prespch_buf);
+    fe->vad_data->prespch_buf =
+        fe_prespch_init(fe->pre_speech + 1, fe_prespch_frame_len(fe),
+                        fe->frame_shift);
+    fe_reset_vad_data(fe->vad_data);
+    return 0;
+}
+
+char const *
+fe_get_warp_candidate(fe_t *fe, int idx)
+{
+    if (idx < 0 || idx >= fe->n_warp)
+        return NULL;
+    return fe->warp_cand[idx];
+}
+
+int
+fe_select_warp(fe_t *fe, mfcc_t **buf_cep, int32 nfr,
+               fe_warp_score_f score, void *udata,
+               float64 *out_score)
+{
+    mfcc_t **cep;
+    float64 best_score = 0;
+    int i, best;
+    int32 j;
+
+    if (fe->n_warp == 0) {
+        E_ERROR("No warp candidates to select from\n");
+        return FE_INVALID_PARAM_ERROR;
+    }
+    cep = ckd_calloc(nfr > 0 ? nfr : 1, sizeof(*cep));
+    best = -1;
+    for (i = 0; i < fe->n_warp; ++i) {
+        float64 s;
+
+        for (j = 0; j < nfr; ++j)
+            cep[j] = buf_cep[j] + (1 + i) * fe->feature_dimension;
+        s = (*score)(udata, cep, nfr);
+        if (best == -1 || s > best_score) {
+            best = i;
+            best_score = s;
+        }
+    }
+    ckd_free(cep);
+    if (out_score)
+        *out_score = best_score;
+    return best;
+}
+
 int32
 fe_end_utt(fe_t * fe, mfcc_t * cepvector, int32 * nframes)
 {
@@ -638,24 +979,33 @@ fe_free(fe_t * fe)
         return fe->refcount;
 
     /* kill FE instance - free everything... */
-    if (fe->mel_fb) {
-        if (fe->mel_fb->mel_cosine)
-            fe_free_2d((void *) fe->mel_fb->mel_cosine);
-        ckd_free(fe->mel_fb->lifter);
-        ckd_free(fe->mel_fb->spec_start);
-        ckd_free(fe->mel_fb->filt_start);
-        ckd_free(fe->mel_fb->filt_width);
-        ckd_free(fe->mel_fb->filt_coeffs);
-        ckd_free(fe->mel_fb);
+    if (fe->parent) {
+        /* Shared tables belong to the parent. */
+        fe_free(fe->parent);
+    }
+    else {
+        if (fe->mel_fb) {
+            if (fe->mel_fb->mel_cosine)
+                fe_free_2d((void *) fe->mel_fb->mel_cosine);
+            ckd_free(fe->mel_fb->lifter);
+            fe_free_melfilters(fe->mel_fb);
+            ckd_free(fe->mel_fb->dct_matrix);
+            ckd_free(fe->mel_fb);
+        }
+        ckd_free(fe->ccc);
+        ckd_free(fe->sss);
+        ckd_free(fe->stage_ccc);
+        ckd_free(fe->stage_sss);
+        ckd_free(fe->hamming_window);
+        fe_free_warp_candidates(fe);
     }
     ckd_free(fe->spch);
     ckd_free(fe->frame);
-    ckd_free(fe->ccc);
-    ckd_free(fe->sss);
     ckd_free(fe->spec);
     ckd_free(fe->mfspec);
     ckd_free(fe->overflow_samps);
-    ckd_free(fe->hamming_window);
+    fe_resampler_free(fe->resampler);
+    ckd_free(fe->resamp_buf);
 
     if (fe->noise_stats)
         fe_free_noisestats(fe->noise_stats);
@@ -682,9 +1032,9 @@ fe_mfcc_to_float(fe_t * fe,
 
 #ifndef FIXED_POINT
     if ((void *) input == (void *) output)
-        return nframes * fe->feature_dimension;
+        return nframes * fe_get_output_size(fe);
 #endif
-    for (i = 0; i < nframes * fe->feature_dimension; ++i)
+    for (i = 0; i < nframes * fe_get_output_size(fe); ++i)
         output[0][i] = MFCC2FLOAT(input[0][i]);
 
     return i;
@@ -701,9 +1051,9 @@ fe_float_to_mfcc(fe_t * fe,
 
 #ifndef FIXED_POINT
     if ((void *) input == (void *) output)
-        return nframes * fe->feature_dimension;
+        return nframes * fe_get_output_size(fe);
 #endif
-    for (i = 0; i < nframes * fe->feature_dimension; ++i)
+    for (i = 0; i < nframes * fe_get_output_size(fe); ++i)
         output[0][i] = FLOAT2MFCC(input[0][i]);
 
     return i;
@@ -47,6 +47,7 @@
 
 #include "fe_noise.h"
 #include "fe_prespch_buf.h"
+#include "fe_resample.h"
 #include "fe_type.h"
 
 #ifdef __cplusplus
@@ -86,6 +87,12 @@ struct melfb_s {
     int16 *spec_start;
     int16 *filt_start;
     int16 *filt_width;
+    /* Filter coefficients again, with each filter zero-padded to a
+     * multiple of FE_MEL_PAD points and starting at a multiple of
+     * FE_MEL_PAD in this array (floating point only). */
+    mfcc_t *pad_coeffs;
+    int16 *pad_start;
+    int16 *pad_width;
     /* Luxury mobile home. */
     int32 doublewide;
     char const *warp_type;
@@ -93,6 +100,10 @@ struct melfb_s {
     uint32 warp_id;
     /* Precomputed normalization constants for unitary DCT-II/DCT-III */
     mfcc_t sqrt_inv_n, sqrt_inv_2n;
+    /* Full cepstral transform matrix, including normalization, with
+     * rows of dct_stride points (floating point only). */
+    powspec_t *dct_matrix;
+    int32 dct_stride;
     /* Value and coefficients for HTK-style liftering */
     int32 lifter_val;
     mfcc_t *lifter;
@@ -103,6 +114,9 @@ struct melfb_s {
     int32 round_filters;
 };
 
+/* Padding for filter coefficients and DCT rows. */
+#define FE_MEL_PAD 4
+
 /* sqrt(1/2), also used for unitary DCT-II/DCT-III */
 #define SQRT_HALF FLOAT2MFCC(0.707106781186548)
 
@@ -113,12 +127,18 @@ typedef struct vad_data_s {
     prespch_buf_t* prespch_buf;
 } vad_data_t;
 
+/** Real FFT over fe->frame, in place.  Returns the scaling factor in bits. */
+typedef int (*fe_fft_func_t)(fe_t *fe);
+
 /** Structure for the front-end computation. */
 struct fe_s {
     cmd_ln_t *config;
     int refcount;
+    /* Front end owning the read-only tables, if this is a clone. */
+    fe_t *parent;
 
     float32 sampling_rate;
+    float32 input_sampling_rate;
     int16 frame_rate;
     int16 frame_shift;
 
@@ -146,8 +166,18 @@ struct fe_s {
 
     /* Twiddle factors for FFT. */
     frame_t *ccc, *sss;
+    /* Twiddle factors repacked contiguously per stage (vector backends). */
+    frame_t *stage_ccc, *stage_sss;
+    /* FFT backend selected at initialization. */
+    fe_fft_func_t fft_real;
+    char const *fft_backend;
     /* Mel filter parameters. */
     melfb_t *mel_fb;
+    /* Filterbanks for VTLN warp candidates, sharing the DCT and
+     * lifter of mel_fb, and the parameters they were built with. */
+    melfb_t *warp_fb;
+    char **warp_cand;
+    int32 n_warp;
     /* Half of a Hamming Window. */
     window_t *hamming_window;
 
@@ -167,6 +197,13 @@ struct fe_s {
     frame_t *frame;
     powspec_t *spec, *mfspec;
     int16 *overflow_samps;
+
+    /* Resampling of input to sampling_rate, if needed. */
+    fe_resampler_t *resampler;
+    /* Resampled audio not yet consumed. */
+    int16 *resamp_buf;
+    int32 resamp_nbuf;
+    int32 resamp_alloc;
 };
 
 void fe_init_dither(int32 seed);
@@ -186,9 +223,17 @@ void fe_write_frame(fe_t *fe, mfcc_t *feat, int32 store_pcm);
 /* Initialization functions. */
 int32 fe_build_melfilters(melfb_t *MEL_FB);
 int32 fe_compute_melcosine(melfb_t *MEL_FB);
+void fe_compute_dct_matrix(fe_t *fe);
 void fe_create_hamming(window_t *in, int32 in_len);
 void fe_create_twiddle(fe_t *fe);
 
+/* FFT backends. */
+void fe_fft_stage0(frame_t *x, int32 n);
+int fe_fft_real_ref(fe_t *fe);
+void fe_fft_select_backend(fe_t *fe);
+/* Force a backend by name, returns -1 if it is not available. */
+int fe_fft_set_backend(fe_t *fe, char const *name);
+
 fixed32 fe_log_add(fixed32 x, fixed32 y);
 fixed32 fe_log_sub(fixed32 x, fixed32 y);
 
@@ -89,6 +89,9 @@ struct noise_stats_s {
     powspec_t *floor;
     /* Peak for temporal masking */
     powspec_t *peak;
+    /* Per-frame scratch space for the signal estimate and gains */
+    powspec_t *signal;
+    powspec_t *gain;
 
     /* Initialize it next time */
     uint8 undefined;
@@ -113,22 +116,13 @@ struct noise_stats_s {
     powspec_t smooth_scaling[2 * SMOOTH_WINDOW + 3];
 };
 
+#ifdef FIXED_POINT
 static void
 fe_lower_envelope(noise_stats_t *noise_stats, powspec_t * buf, powspec_t * floor_buf, int32 num_filt)
 {
     int i;
 
     for (i = 0; i < num_filt; i++) {
-#ifndef FIXED_POINT
-        if (buf[i] >= floor_buf[i]) {
-            floor_buf[i] =
-                noise_stats->lambda_a * floor_buf[i] + noise_stats->comp_lambda_a * buf[i];
-        }
-        else {
-            floor_buf[i] =
-                noise_stats->lambda_b * floor_buf[i] + noise_stats->comp_lambda_b * buf[i];
-        }
-#else
         if (buf[i] >= floor_buf[i]) {
             floor_buf[i] = fe_log_add(noise_stats->lambda_a + floor_buf[i],
                                   noise_stats->comp_lambda_a + buf[i]);
@@ -137,30 +131,18 @@ fe_lower_envelope(noise_stats_t *noise_stats, powspec_t * buf, powspec_t * floor
             floor_buf[i] = fe_log_add(noise_stats->lambda_b + floor_buf[i],
                                   noise_stats->comp_lambda_b + buf[i]);
         }
-#endif
     }
 }
+#endif
 
-/* update slow peaks, check if max signal level big enough compared to peak */
+/* update slow peaks, check if max signal level (log of total signal
+ * power) big enough compared to peak */
 static int16
-fe_is_frame_quiet(noise_stats_t *noise_stats, powspec_t *buf, int32 num_filt)
+fe_update_slow_peak(noise_stats_t *noise_stats, powspec_t sum)
 {
-    int i;
     int16 is_quiet;
-    powspec_t sum;
     double smooth_factor;
 
-    sum = 0.0;
-    for (i = 0; i < num_filt; i++) {
-#ifndef FIXED_POINT
-        sum += buf[i];
-#else 
-        sum = fe_log_add(sum, buf[i]);
-#endif
-    }
-#ifndef FIXED_POINT
-    sum = log(sum);
-#endif
     smooth_factor = (sum > noise_stats->slow_peak_sum) ? SLOW_PEAK_LEARN_FACTOR : SLOW_PEAK_FORGET_FACTOR;
     noise_stats->slow_peak_sum = noise_stats->slow_peak_sum * smooth_factor +
                                  sum * (1 - smooth_factor);
@@ -180,6 +162,21 @@ fe_is_frame_quiet(noise_stats_t *noise_stats, powspec_t *buf, int32 num_filt)
     return is_quiet;
 }
 
+#ifdef FIXED_POINT
+static int16
+fe_is_frame_quiet(noise_stats_t *noise_stats, powspec_t *buf, int32 num_filt)
+{
+    int i;
+    powspec_t sum;
+
+    sum = 0;
+    for (i = 0; i < num_filt; i++)
+        sum = fe_log_add(sum, buf[i]);
+    return fe_update_slow_peak(noise_stats, sum);
+}
+#endif
+
+#ifdef FIXED_POINT
 /* temporal masking */
 static void
 fe_temp_masking(noise_stats_t *noise_stats, powspec_t * buf, powspec_t * peak, int32 num_filt)
@@ -190,20 +187,15 @@ fe_temp_masking(noise_stats_t *noise_stats, powspec_t * buf, powspec_t * peak, i
     for (i = 0; i < num_filt; i++) {
         cur_in = buf[i];
 
-#ifndef FIXED_POINT
-        peak[i] *= noise_stats->lambda_t;
-        if (buf[i] < noise_stats->lambda_t * peak[i])
-            buf[i] = peak[i] * noise_stats->mu_t;
-#else
         peak[i] += noise_stats->lambda_t;
         if (buf[i] < noise_stats->lambda_t + peak[i])
             buf[i] = peak[i] + noise_stats->mu_t;
-#endif
 
         if (cur_in > peak[i])
             peak[i] = cur_in;
     }
 }
+#endif
 
 /* spectral weight smoothing */
 static void
@@ -251,6 +243,10 @@ fe_init_noisestats(int num_filters)
         (powspec_t *) ckd_calloc(num_filters, sizeof(powspec_t));
     noise_stats->peak =
         (powspec_t *) ckd_calloc(num_filters, sizeof(powspec_t));
+    noise_stats->signal =
+        (powspec_t *) ckd_calloc(num_filters, sizeof(powspec_t));
+    noise_stats->gain =
+        (powspec_t *) ckd_calloc(num_filters, sizeof(powspec_t));
 
     noise_stats->undefined = TRUE;
     noise_stats->num_filters = num_filters;
@@ -308,6 +304,8 @@ fe_free_noisestats(noise_stats_t * noise_stats)
     ckd_free(noise_stats->noise);
     ckd_free(noise_stats->floor);
     ckd_free(noise_stats->peak);
+    ckd_free(noise_stats->signal);
+    ckd_free(noise_stats->gain);
     ckd_free(noise_stats);
 #ifdef VAD_DEBUG
     fclose(vad_stats);
@@ -316,6 +314,94 @@ fe_free_noisestats(noise_stats_t * noise_stats)
 
 }
 
+#ifndef FIXED_POINT
+/**
+ * Update the noise statistics for one frame in a single sweep over
+ * the filterbank, computing the signal estimate and gains along the
+ * way.  This is the same series of lower envelope, SNR, temporal
+ * masking and gain computations as the fixed-point version below,
+ * done per filter rather than per pass.
+ *
+ * The SNR is only needed for its maximum, and log() is monotonic, so
+ * the largest power to noise ratio is found first and its log taken
+ * once per frame rather than once per filter.
+ */
+static int16
+fe_track_snr_sweep(noise_stats_t *noise_stats, powspec_t *mfspec,
+                   int32 num_filts, int compute_gain, powspec_t *out_lrt)
+{
+    powspec_t *power = noise_stats->power;
+    powspec_t *noise = noise_stats->noise;
+    powspec_t *floor_buf = noise_stats->floor;
+    powspec_t *peak = noise_stats->peak;
+    powspec_t *gain = noise_stats->gain;
+    powspec_t lambda_power = noise_stats->lambda_power;
+    powspec_t comp_lambda_power = noise_stats->comp_lambda_power;
+    powspec_t lambda_a = noise_stats->lambda_a;
+    powspec_t comp_lambda_a = noise_stats->comp_lambda_a;
+    powspec_t lambda_b = noise_stats->lambda_b;
+    powspec_t comp_lambda_b = noise_stats->comp_lambda_b;
+    powspec_t lambda_t = noise_stats->lambda_t;
+    powspec_t mu_t = noise_stats->mu_t;
+    powspec_t max_gain = noise_stats->max_gain;
+    powspec_t inv_max_gain = noise_stats->inv_max_gain;
+    powspec_t sum, max_ratio;
+    int32 i;
+
+    sum = 0.0;
+    max_ratio = 1.0;
+    for (i = 0; i < num_filts; i++) {
+        powspec_t p, n, sig, ratio, cur_in, pk;
+
+        /* Smoothed power */
+        p = lambda_power * power[i] + comp_lambda_power * mfspec[i];
+        power[i] = p;
+
+        /* Noise estimate */
+        n = noise[i];
+        n = (p >= n)
+            ? lambda_a * n + comp_lambda_a * p
+            : lambda_b * n + comp_lambda_b * p;
+        noise[i] = n;
+
+        /* Signal estimate and SNR */
+        sig = p - n;
+        if (sig < 1.0)
+            sig = 1.0;
+        ratio = p / n;
+        if (ratio > max_ratio)
+            max_ratio = ratio;
+        sum += sig;
+
+        /* The rest is only needed for noise removal. */
+        if (!compute_gain)
+            continue;
+
+        /* Signal floor */
+        floor_buf[i] = (sig >= floor_buf[i])
+            ? lambda_a * floor_buf[i] + comp_lambda_a * sig
+            : lambda_b * floor_buf[i] + comp_lambda_b * sig;
+
+        /* Temporal masking */
+        cur_in = sig;
+        pk = peak[i] * lambda_t;
+        if (sig < lambda_t * pk)
+            sig = pk * mu_t;
+        peak[i] = (cur_in > pk) ? cur_in : pk;
+
+        /* Gain */
+        if (sig < floor_buf[i])
+            sig = floor_buf[i];
+        gain[i] = (sig < max_gain * p) ? sig / p : max_gain;
+        if (gain[i] < inv_max_gain)
+            gain[i] = inv_max_gain;
+    }
+
+    *out_lrt = log(max_ratio);
+    return fe_update_slow_peak(noise_stats, log(sum));
+}
+#endif
+
 /**
  * For fixed point we are doing the computation in a fixlog domain,
  * so we have to add many processing cases.
@@ -323,13 +409,14 @@ fe_free_noisestats(noise_stats_t * noise_stats)
 void
 fe_track_snr(fe_t * fe, int32 *in_speech)
 {
-    powspec_t *signal;
-    powspec_t *gain;
     noise_stats_t *noise_stats;
     powspec_t *mfspec;
     int32 i, num_filts;
     int16 is_quiet;
-    powspec_t lrt, snr;
+    powspec_t lrt;
+#ifdef FIXED_POINT
+    powspec_t *signal, *gain;
+#endif
 
     if (!(fe->remove_noise || fe->remove_silence)) {
         *in_speech = TRUE;
@@ -340,8 +427,6 @@ fe_track_snr(fe_t * fe, int32 *in_speech)
     mfspec = fe->mfspec;
     num_filts = noise_stats->num_filters;
 
-    signal = (powspec_t *) ckd_calloc(num_filts, sizeof(powspec_t));
-
     if (noise_stats->undefined) {
         noise_stats->slow_peak_sum = FIX2FLOAT(0.0);
         for (i = 0; i < num_filts; i++) {
@@ -359,15 +444,17 @@ fe_track_snr(fe_t * fe, int32 *in_speech)
         noise_stats->undefined = FALSE;
     }
 
-    /* Calculate smoothed power */
-    for (i = 0; i < num_filts; i++) {
 #ifndef FIXED_POINT
-        noise_stats->power[i] =
-            noise_stats->lambda_power * noise_stats->power[i] + noise_stats->comp_lambda_power * mfspec[i];   
+    is_quiet = fe_track_snr_sweep(noise_stats, mfspec, num_filts,
+                                  fe->remove_noise, &lrt);
 #else
+    signal = noise_stats->signal;
+    gain = noise_stats->gain;
+
+    /* Calculate smoothed power */
+    for (i = 0; i < num_filts; i++) {
         noise_stats->power[i] = fe_log_add(noise_stats->lambda_power + noise_stats->power[i],
             noise_stats->comp_lambda_power + mfspec[i]);
-#endif
     }
 
     /* Noise estimation and vad decision */
@@ -375,19 +462,15 @@ fe_track_snr(fe_t * fe, int32 *in_speech)
 
     lrt = FLOAT2FIX(0.0);
     for (i = 0; i < num_filts; i++) {
-#ifndef FIXED_POINT
-        signal[i] = noise_stats->power[i] - noise_stats->noise[i];
-        if (signal[i] < 1.0)
-            signal[i] = 1.0;
-        snr = log(noise_stats->power[i] / noise_stats->noise[i]);
-#else
+        powspec_t snr;
+
         signal[i] = fe_log_sub(noise_stats->power[i], noise_stats->noise[i]);
         snr = noise_stats->power[i] - noise_stats->noise[i];
-#endif    
         if (snr > lrt)
             lrt = snr;
     }
     is_quiet = fe_is_frame_quiet(noise_stats, signal, num_filts);
+#endif
 
 #ifdef VAD_DEBUG
     if (lrt < fe->vad_threshold)
@@ -414,32 +497,21 @@ fe_track_snr(fe_t * fe, int32 *in_speech)
 #endif
 #endif
 
-    fe_lower_envelope(noise_stats, signal, noise_stats->floor, num_filts);
-
-    fe_temp_masking(noise_stats, signal, noise_stats->peak, num_filts);
-
     if (!fe->remove_noise) {
         /* no need for further calculations if noise cancellation disabled */
-        ckd_free(signal);
         return;
     }
 
+#ifdef FIXED_POINT
+    fe_lower_envelope(noise_stats, signal, noise_stats->floor, num_filts);
+
+    fe_temp_masking(noise_stats, signal, noise_stats->peak, num_filts);
+
     for (i = 0; i < num_filts; i++) {
         if (signal[i] < noise_stats->floor[i])
             signal[i] = noise_stats->floor[i];
     }
 
-    gain = (powspec_t *) ckd_calloc(num_filts, sizeof(powspec_t));
-#ifndef FIXED_POINT
-    for (i = 0; i < num_filts; i++) {
-        if (signal[i] < noise_stats->max_gain * noise_stats->power[i])
-            gain[i] = signal[i] / noise_stats->power[i];
-        else
-            gain[i] = noise_stats->max_gain;
-        if (gain[i] < noise_stats->inv_max_gain)
-            gain[i] = noise_stats->inv_max_gain;
-    }
-#else
     for (i = 0; i < num_filts; i++) {
         gain[i] = signal[i] - noise_stats->power[i];
         if (gain[i] > noise_stats->max_gain)
@@ -450,10 +522,7 @@ fe_track_snr(fe_t * fe, int32 *in_speech)
 #endif
 
     /* Weight smoothing and time frequency normalization */
-    fe_weight_smooth(noise_stats, mfspec, gain, num_filts);
-
-    ckd_free(gain);
-    ckd_free(signal);
+    fe_weight_smooth(noise_stats, mfspec, noise_stats->gain, num_filts);
 }
 
 void
@@ -89,7 +89,7 @@ fe_prespch_init(int num_frames, int num_cepstra, int num_samples)
     prespch_buf->num_cepstra = num_cepstra;
     prespch_buf->num_frames_cep = num_frames;
     prespch_buf->num_samples = num_samples;
-    prespch_buf->num_frames_pcm = 0;
+    prespch_buf->num_frames_pcm = num_frames;
 
     prespch_buf->cep_write_ptr = 0;
     prespch_buf->cep_read_ptr = 0;
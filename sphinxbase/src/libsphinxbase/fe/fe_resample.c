@@ -0,0 +1,293 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file fe_resample.c
+ * @brief Streaming polyphase resampler for the front end.
+ *
+ * The ratio between the input and output rates is reduced to up/down,
+ * and each output sample is computed directly from the input with one
+ * of up sets of Kaiser-windowed sinc coefficients, selected by the
+ * fractional position of the output sample between two input samples.
+ * The filter is centered on the output sample, so output lags input
+ * by half a filter length, which is kept in an internal buffer between
+ * calls.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <math.h>
+
+#include "sphinxbase/prim_type.h"
+#include "sphinxbase/ckd_alloc.h"
+#include "sphinxbase/err.h"
+
+#include "fe_resample.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Zero crossings of the sinc on either side of center. */
+#define RESAMP_ZERO_CROSSINGS 12
+/* Passband edge as a fraction of the lower Nyquist frequency. */
+#define RESAMP_ROLLOFF 0.95
+/* Kaiser window shape parameter. */
+#define RESAMP_KAISER_BETA 8.0
+/* Input samples read per refill, beyond the filter history. */
+#define RESAMP_BLOCK 2048
+
+#ifdef FIXED_POINT
+#define RESAMP_COEF_SHIFT 15
+typedef int32 resamp_coef_t;
+typedef int64 resamp_acc_t;
+#else
+typedef float32 resamp_coef_t;
+typedef float32 resamp_acc_t;
+#endif
+
+struct fe_resampler_s {
+    int32 up, down;     /**< Reduced ratio of output to input rate. */
+    int32 half;         /**< Half the filter length, in input samples. */
+    int32 ntaps;        /**< Coefficients per phase (2 * half). */
+    resamp_coef_t *coeffs; /**< up rows of ntaps coefficients. */
+
+    int16 *buf;         /**< Buffered input. */
+    int32 nbuf;         /**< Number of samples in buf. */
+    int32 buf_alloc;
+    int32 idx;          /**< Input sample at or before the next output. */
+    int32 phase;        /**< Fractional position of next output, in 1/up. */
+};
+
+static int32
+gcd(int32 a, int32 b)
+{
+    while (b) {
+        int32 t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Zeroth order modified Bessel function of the first kind. */
+static double
+bessel_i0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    int k;
+
+    for (k = 1; k < 50; ++k) {
+        term *= (x / (2 * k)) * (x / (2 * k));
+        sum += term;
+        if (term < sum * 1e-12)
+            break;
+    }
+    return sum;
+}
+
+static void
+fe_resampler_design(fe_resampler_t *rs, double fc)
+{
+    double inv_i0_beta = 1.0 / bessel_i0(RESAMP_KAISER_BETA);
+    double *h;
+    int32 p, k;
+
+    h = ckd_calloc(rs->ntaps, sizeof(*h));
+    for (p = 0; p < rs->up; ++p) {
+        double frac = (double)p / rs->up;
+        double sum = 0.0;
+
+        for (k = 0; k < rs->ntaps; ++k) {
+            /* Distance from the output sample to input sample k. */
+            double d = k - rs->half + 1 - frac;
+            double x = d / rs->half;
+            double w = (x * x < 1.0)
+                ? bessel_i0(RESAMP_KAISER_BETA * sqrt(1.0 - x * x)) * inv_i0_beta
+                : 0.0;
+            double s = (d == 0.0) ? 1.0 : sin(M_PI * fc * d) / (M_PI * fc * d);
+            h[k] = fc * s * w;
+            sum += h[k];
+        }
+        /* Normalize to unity gain at DC. */
+        for (k = 0; k < rs->ntaps; ++k) {
+#ifdef FIXED_POINT
+            rs->coeffs[p * rs->ntaps + k] = (resamp_coef_t)
+                floor(h[k] / sum * (1 << RESAMP_COEF_SHIFT) + 0.5);
+#else
+            rs->coeffs[p * rs->ntaps + k] = (resamp_coef_t)(h[k] / sum);
+#endif
+        }
+    }
+    ckd_free(h);
+}
+
+fe_resampler_t *
+fe_resampler_init(int32 in_rate, int32 out_rate)
+{
+    fe_resampler_t *rs;
+    double fc;
+    int32 g;
+
+    if (in_rate <= 0 || out_rate <= 0) {
+        E_ERROR("Invalid resampling rates %d and %d\n", in_rate, out_rate);
+        return NULL;
+    }
+    g = gcd(in_rate, out_rate);
+    rs = ckd_calloc(1, sizeof(*rs));
+    rs->up = out_rate / g;
+    rs->down = in_rate / g;
+    /* Cutoff relative to the input Nyquist frequency. */
+    fc = RESAMP_ROLLOFF * (rs->up < rs->down
+                           ? (double)rs->up / rs->down : 1.0);
+    rs->half = (int32)ceil(RESAMP_ZERO_CROSSINGS / fc);
+    rs->ntaps = 2 * rs->half;
+    rs->coeffs = ckd_calloc(rs->up * rs->ntaps, sizeof(*rs->coeffs));
+    fe_resampler_design(rs, fc);
+
+    rs->buf_alloc = rs->ntaps + RESAMP_BLOCK;
+    rs->buf = ckd_calloc(rs->buf_alloc, sizeof(*rs->buf));
+    fe_resampler_reset(rs);
+
+    E_INFO("Resampling from %d to %d Hz (%d/%d), %d taps per phase\n",
+           in_rate, out_rate, rs->up, rs->down, rs->ntaps);
+    return rs;
+}
+
+void
+fe_resampler_free(fe_resampler_t *rs)
+{
+    if (rs == NULL)
+        return;
+    ckd_free(rs->coeffs);
+    ckd_free(rs->buf);
+    ckd_free(rs);
+}
+
+void
+fe_resampler_reset(fe_resampler_t *rs)
+{
+    /* Pretend there was silence before the start of input, so that
+     * the first output sample lines up with the first input one. */
+    rs->nbuf = rs->half - 1;
+    memset(rs->buf, 0, rs->nbuf * sizeof(*rs->buf));
+    rs->idx = rs->half - 1;
+    rs->phase = 0;
+}
+
+size_t
+fe_resampler_max_output(fe_resampler_t *rs, size_t nsamps)
+{
+    /* Output k is available when its input position, idx + (phase +
+     * k * down) / up, is more than half a filter short of the end. */
+    int64 avail = (int64)rs->nbuf + nsamps - rs->half - rs->idx;
+
+    if (avail <= 0)
+        return 0;
+    return (size_t)((avail * rs->up - rs->phase + rs->down - 1) / rs->down);
+}
+
+static int16
+fe_resampler_filter(fe_resampler_t *rs)
+{
+    resamp_coef_t const *c = rs->coeffs + rs->phase * rs->ntaps;
+    int16 const *x = rs->buf + rs->idx - rs->half + 1;
+    resamp_acc_t acc = 0;
+    int32 k;
+
+    for (k = 0; k < rs->ntaps; ++k)
+        acc += c[k] * x[k];
+#ifdef FIXED_POINT
+    acc = (acc + (1 << (RESAMP_COEF_SHIFT - 1))) >> RESAMP_COEF_SHIFT;
+#else
+    acc = floor(acc + 0.5);
+#endif
+    if (acc > 32767)
+        return 32767;
+    if (acc < -32768)
+        return -32768;
+    return (int16)acc;
+}
+
+size_t
+fe_resampler_process(fe_resampler_t *rs,
+                     int16 const **inout_spch, size_t *inout_nsamps,
+                     int16 *out, size_t max_out)
+{
+    size_t nout = 0;
+
+    while (nout < max_out) {
+        int32 keep, n;
+
+        if (rs->idx + rs->half < rs->nbuf) {
+            out[nout++] = fe_resampler_filter(rs);
+            rs->phase += rs->down;
+            rs->idx += rs->phase / rs->up;
+            rs->phase %= rs->up;
+            continue;
+        }
+        if (*inout_nsamps == 0)
+            break;
+
+        /* Drop input that is too old to be needed again. */
+        keep = rs->idx - rs->half + 1;
+        if (keep > rs->nbuf) {
+            /* When downsampling, the next output may be past some
+             * input samples we have not even read yet. */
+            size_t skip = keep - rs->nbuf;
+            if (skip > *inout_nsamps)
+                skip = *inout_nsamps;
+            *inout_spch += skip;
+            *inout_nsamps -= skip;
+            rs->idx -= rs->nbuf + (int32)skip;
+            rs->nbuf = 0;
+            continue;
+        }
+        memmove(rs->buf, rs->buf + keep,
+                (rs->nbuf - keep) * sizeof(*rs->buf));
+        rs->nbuf -= keep;
+        rs->idx -= keep;
+
+        /* And read some more. */
+        n = rs->buf_alloc - rs->nbuf;
+        if ((size_t)n > *inout_nsamps)
+            n = (int32)*inout_nsamps;
+        memcpy(rs->buf + rs->nbuf, *inout_spch, n * sizeof(*rs->buf));
+        rs->nbuf += n;
+        *inout_spch += n;
+        *inout_nsamps -= n;
+    }
+    return nout;
+}
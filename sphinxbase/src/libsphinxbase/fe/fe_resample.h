@@ -0,0 +1,71 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2016 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+#ifndef FE_RESAMPLE_H
+#define FE_RESAMPLE_H
+
+#include "sphinxbase/prim_type.h"
+
+typedef struct fe_resampler_s fe_resampler_t;
+
+/**
+ * Create a polyphase resampler from in_rate to out_rate (both in Hz,
+ * and integral).
+ */
+fe_resampler_t *fe_resampler_init(int32 in_rate, int32 out_rate);
+
+/* Frees a resampler */
+void fe_resampler_free(fe_resampler_t *rs);
+
+/* Forget all buffered input, as at the start of a new utterance. */
+void fe_resampler_reset(fe_resampler_t *rs);
+
+/**
+ * Upper bound on the number of output samples obtained by passing
+ * nsamps more input samples to fe_resampler_process().
+ */
+size_t fe_resampler_max_output(fe_resampler_t *rs, size_t nsamps);
+
+/**
+ * Resample as much input as fits in max_out output samples.
+ *
+ * Input that was not used is left in *inout_spch and *inout_nsamps,
+ * as for fe_process_frames().  Up to a filter length of input is
+ * retained internally between calls.
+ *
+ * @return number of samples written to out.
+ */
+size_t fe_resampler_process(fe_resampler_t *rs,
+                            int16 const **inout_spch, size_t *inout_nsamps,
+                            int16 *out, size_t max_out);
+
+#endif                          /* FE_RESAMPLE_H */
@@ -77,6 +77,42 @@
 #define COSMUL(x,y) ((x)*(y))
 #endif
 
+#if defined(FIXED_POINT) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define FE_NEON_FIXED
+#include <arm_neon.h>
+
+/* COSMUL() of each lane: the 64-bit product shifted down and
+ * truncated, as the scalar code does. */
+static inline int32x4_t
+fe_neon_cosmul(int32x4_t a, int32x4_t b)
+{
+    int64x2_t lo = vmull_s32(vget_low_s32(a), vget_low_s32(b));
+    int64x2_t hi = vmull_s32(vget_high_s32(a), vget_high_s32(b));
+
+    return vcombine_s32(vmovn_s64(vshrq_n_s64(lo, 30)),
+                        vmovn_s64(vshrq_n_s64(hi, 30)));
+}
+
+/* Sum of COSMUL(x[j], c[j]) for j < n. */
+static fixed32
+fe_neon_cos_dot(int32 const *x, int32 const *c, int32 n)
+{
+    int32x4_t acc = vdupq_n_s32(0);
+    int32x2_t h;
+    fixed32 sum;
+    int32 j;
+
+    for (j = 0; j + 4 <= n; j += 4)
+        acc = vaddq_s32(acc, fe_neon_cosmul(vld1q_s32(x + j),
+                                            vld1q_s32(c + j)));
+    h = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+    sum = vget_lane_s32(h, 0) + vget_lane_s32(h, 1);
+    for (; j < n; ++j)
+        sum += COSMUL(x[j], c[j]);
+    return sum;
+}
+#endif /* FIXED_POINT && NEON */
+
 #ifdef FIXED_POINT
 
 /* Internal log-addition table for natural log with radix point at 8
@@ -680,6 +716,30 @@ fe_build_melfilters(melfb_t * mel_fb)
         }
     }
 
+#ifndef FIXED_POINT
+    /* Repack the coefficients so that each filter can be applied in
+     * blocks of FE_MEL_PAD points with no remainder.  The power
+     * spectrum is large enough that this never reads past its end. */
+    mel_fb->pad_start =
+        ckd_calloc(mel_fb->num_filters, sizeof(*mel_fb->pad_start));
+    mel_fb->pad_width =
+        ckd_calloc(mel_fb->num_filters, sizeof(*mel_fb->pad_width));
+    n_coeffs = 0;
+    for (i = 0; i < mel_fb->num_filters; ++i) {
+        mel_fb->pad_start[i] = n_coeffs;
+        mel_fb->pad_width[i] = (mel_fb->filt_width[i] + FE_MEL_PAD - 1)
+            & ~(FE_MEL_PAD - 1);
+        n_coeffs += mel_fb->pad_width[i];
+    }
+    mel_fb->pad_coeffs =
+        ckd_calloc(n_coeffs, sizeof(*mel_fb->pad_coeffs));
+    for (i = 0; i < mel_fb->num_filters; ++i) {
+        memcpy(mel_fb->pad_coeffs + mel_fb->pad_start[i],
+               mel_fb->filt_coeffs + mel_fb->filt_start[i],
+               mel_fb->filt_width[i] * sizeof(*mel_fb->filt_coeffs));
+    }
+#endif
+
     return FE_SUCCESS;
 }
 
@@ -724,6 +784,54 @@ fe_compute_melcosine(melfb_t * mel_fb)
     return (0);
 }
 
+/**
+ * Precompute the whole cepstral transform for the selected DCT as a
+ * single matrix, so that fe_mel_cep() is one matrix-vector product.
+ * Only done in floating point, since the fixed-point DCT needs the
+ * extra precision of the separate normalization steps.
+ */
+void
+fe_compute_dct_matrix(fe_t * fe)
+{
+#ifndef FIXED_POINT
+    melfb_t *mel_fb = fe->mel_fb;
+    int32 i, j, nfilt;
+
+    if (fe->log_spec)
+        return;
+
+    nfilt = mel_fb->num_filters;
+    mel_fb->dct_stride = (nfilt + FE_MEL_PAD - 1) & ~(FE_MEL_PAD - 1);
+    mel_fb->dct_matrix = ckd_calloc(fe->num_cepstra * mel_fb->dct_stride,
+                                    sizeof(*mel_fb->dct_matrix));
+    for (i = 0; i < fe->num_cepstra; ++i) {
+        powspec_t *row = mel_fb->dct_matrix + i * mel_fb->dct_stride;
+
+        for (j = 0; j < nfilt; ++j) {
+            switch (fe->transform) {
+            case LEGACY_DCT:
+                /* See fe_spec2cep() for the weights. */
+                if (i == 0)
+                    row[j] = (j == 0 ? 0.5 : 1.0) / nfilt;
+                else
+                    row[j] = mel_fb->mel_cosine[i][j]
+                        * (j == 0 ? 1.0 : 2.0) / (nfilt * 2);
+                break;
+            case DCT_II:
+            case DCT_HTK:
+                if (i == 0)
+                    row[j] = (fe->transform == DCT_HTK)
+                        ? mel_fb->sqrt_inv_2n : mel_fb->sqrt_inv_n;
+                else
+                    row[j] = (powspec_t)mel_fb->mel_cosine[i][j]
+                        * mel_fb->sqrt_inv_2n;
+                break;
+            }
+        }
+    }
+#endif
+}
+
 static void
 fe_pre_emphasis(int16 const *in, frame_t * out, int32 len,
                 float32 factor, int16 prior)
@@ -787,7 +895,21 @@ fe_hamming_window(frame_t * in, window_t * window, int32 in_len,
             in[i] -= (frame_t) mean;
     }
 
-    for (i = 0; i < in_len / 2; i++) {
+    i = 0;
+#ifdef FE_NEON_FIXED
+    for (; i + 4 <= in_len / 2; i += 4) {
+        int32x4_t w = vld1q_s32(window + i);
+        int32x4_t wr;
+
+        vst1q_s32(in + i, fe_neon_cosmul(vld1q_s32(in + i), w));
+        /* The second half has the same coefficients backwards. */
+        wr = vrev64q_s32(w);
+        wr = vcombine_s32(vget_high_s32(wr), vget_low_s32(wr));
+        vst1q_s32(in + in_len - 4 - i,
+                  fe_neon_cosmul(vld1q_s32(in + in_len - 4 - i), wr));
+    }
+#endif
+    for (; i < in_len / 2; i++) {
         in[i] = COSMUL(in[i], window[i]);
         in[in_len - 1 - i] = COSMUL(in[in_len - 1 - i], window[i]);
     }
@@ -885,15 +1007,16 @@ fe_create_twiddle(fe_t * fe)
 }
 
 
-static int
-fe_fft_real(fe_t * fe)
+/**
+ * Bit-reverse the input and do the first stage of 2-point
+ * butterflies, which have only real twiddle factors.  This is shared
+ * by all FFT backends.
+ */
+void
+fe_fft_stage0(frame_t * x, int32 n)
 {
-    int i, j, k, m, n;
-    frame_t *x, xt;
-
-    x = fe->frame;
-    m = fe->fft_order;
-    n = fe->fft_size;
+    int i, j, k;
+    frame_t xt;
 
     /* Bit-reverse the input. */
     j = 0;
@@ -920,6 +1043,23 @@ fe_fft_real(fe_t * fe)
         x[i] = (xt + x[i + 1]);
         x[i + 1] = (xt - x[i + 1]);
     }
+}
+
+/**
+ * Portable reference implementation of the real FFT.  The vectorized
+ * backends in fe_fft_simd.c must give the same results as this one.
+ */
+int
+fe_fft_real_ref(fe_t * fe)
+{
+    int i, j, k, m, n;
+    frame_t *x, xt;
+
+    x = fe->frame;
+    m = fe->fft_order;
+    n = fe->fft_size;
+
+    fe_fft_stage0(x, n);
 
     /* The rest of the butterflies, in stages from 1..m */
     for (k = 1; k < m; ++k) {
@@ -992,7 +1132,7 @@ fe_spec_magnitude(fe_t * fe)
 
     /* Do FFT and get the scaling factor back (only actually used in
      * fixed-point).  Note the scaling factor is expressed in bits. */
-    scale = fe_fft_real(fe);
+    scale = fe->fft_real(fe);
 
     /* Convenience pointers to make things less awkward below. */
     fft = fe->frame;
@@ -1032,12 +1172,12 @@ fe_mel_spec(fe_t * fe)
     spec = fe->spec;
     mfspec = fe->mfspec;
     for (whichfilt = 0; whichfilt < fe->mel_fb->num_filters; whichfilt++) {
+#ifdef FIXED_POINT
         int spec_start, filt_start, i;
 
         spec_start = fe->mel_fb->spec_start[whichfilt];
         filt_start = fe->mel_fb->filt_start[whichfilt];
 
-#ifdef FIXED_POINT
         mfspec[whichfilt] =
             spec[spec_start] + fe->mel_fb->filt_coeffs[filt_start];
         for (i = 1; i < fe->mel_fb->filt_width[whichfilt]; i++) {
@@ -1047,11 +1187,22 @@ fe_mel_spec(fe_t * fe)
                                            filt_coeffs[filt_start + i]);
         }
 #else                           /* !FIXED_POINT */
-        mfspec[whichfilt] = 0;
-        for (i = 0; i < fe->mel_fb->filt_width[whichfilt]; i++)
-            mfspec[whichfilt] +=
-                spec[spec_start + i] * fe->mel_fb->filt_coeffs[filt_start +
-                                                               i];
+        powspec_t const *sp;
+        mfcc_t const *coeffs;
+        powspec_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        int i;
+
+        /* Use the padded coefficients, FE_MEL_PAD points at a time. */
+        sp = spec + fe->mel_fb->spec_start[whichfilt];
+        coeffs = fe->mel_fb->pad_coeffs + fe->mel_fb->pad_start[whichfilt];
+        for (i = 0; i < fe->mel_fb->pad_width[whichfilt];
+             i += FE_MEL_PAD) {
+            acc0 += sp[i] * coeffs[i];
+            acc1 += sp[i + 1] * coeffs[i + 1];
+            acc2 += sp[i + 2] * coeffs[i + 2];
+            acc3 += sp[i + 3] * coeffs[i + 3];
+        }
+        mfspec[whichfilt] = (acc0 + acc1) + (acc2 + acc3);
 #endif                          /* !FIXED_POINT */
     }
 
@@ -1059,6 +1210,28 @@ fe_mel_spec(fe_t * fe)
 
 #define LOG_FLOOR 1e-4
 
+#ifndef FIXED_POINT
+static void
+fe_dct_matrix_mul(fe_t * fe, const powspec_t * mflogspec, mfcc_t * mfcep)
+{
+    melfb_t *mel_fb = fe->mel_fb;
+    int32 i, j;
+
+    for (i = 0; i < fe->num_cepstra; ++i) {
+        powspec_t const *row = mel_fb->dct_matrix + i * mel_fb->dct_stride;
+        powspec_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+
+        for (j = 0; j < mel_fb->dct_stride; j += FE_MEL_PAD) {
+            acc0 += mflogspec[j] * row[j];
+            acc1 += mflogspec[j + 1] * row[j + 1];
+            acc2 += mflogspec[j + 2] * row[j + 2];
+            acc3 += mflogspec[j + 3] * row[j + 3];
+        }
+        mfcep[i] = (mfcc_t) ((acc0 + acc1) + (acc2 + acc3));
+    }
+}
+#endif
+
 static void
 fe_mel_cep(fe_t * fe, mfcc_t * mfcep)
 {
@@ -1089,6 +1262,10 @@ fe_mel_cep(fe_t * fe, mfcc_t * mfcep)
             mfcep[i] = (mfcc_t) mfspec[i];
         }
     }
+#ifndef FIXED_POINT
+    else if (fe->mel_fb->dct_matrix)
+        fe_dct_matrix_mul(fe, mfspec, mfcep);
+#endif
     else if (fe->transform == DCT_II)
         fe_dct2(fe, mfspec, mfcep, FALSE);
     else if (fe->transform == DCT_HTK)
@@ -1102,7 +1279,7 @@ fe_mel_cep(fe_t * fe, mfcc_t * mfcep)
 void
 fe_spec2cep(fe_t * fe, const powspec_t * mflogspec, mfcc_t * mfcep)
 {
-    int32 i, j, beta;
+    int32 i, j;
 
     /* Compute C0 separately (its basis vector is 1) to avoid
      * costly multiplications. */
@@ -1112,8 +1289,17 @@ fe_spec2cep(fe_t * fe, const powspec_t * mflogspec, mfcc_t * mfcep)
     mfcep[0] /= (frame_t) fe->mel_fb->num_filters;
 
     for (i = 1; i < fe->num_cepstra; ++i) {
+#ifdef FE_NEON_FIXED
+        /* As below, with beta factored out of the filters after the
+         * first. */
+        mfcep[i] = COSMUL(mflogspec[0], fe->mel_fb->mel_cosine[i][0])
+            + fe_neon_cos_dot(mflogspec + 1, fe->mel_fb->mel_cosine[i] + 1,
+                              fe->mel_fb->num_filters - 1) * 2;
+#else
         mfcep[i] = 0;
         for (j = 0; j < fe->mel_fb->num_filters; j++) {
+            int32 beta;
+
             if (j == 0)
                 beta = 1;       /* 0.5 */
             else
@@ -1121,6 +1307,7 @@ fe_spec2cep(fe_t * fe, const powspec_t * mflogspec, mfcc_t * mfcep)
             mfcep[i] += COSMUL(mflogspec[j],
                                fe->mel_fb->mel_cosine[i][j]) * beta;
         }
+#endif
         /* Note that this actually normalizes by num_filters, like the
          * original Sphinx front-end, due to the doubled 'beta' factor
          * above.  */
@@ -1144,10 +1331,15 @@ fe_dct2(fe_t * fe, const powspec_t * mflogspec, mfcc_t * mfcep, int htk)
         mfcep[0] = COSMUL(mfcep[0], fe->mel_fb->sqrt_inv_n);
 
     for (i = 1; i < fe->num_cepstra; ++i) {
+#ifdef FE_NEON_FIXED
+        mfcep[i] = fe_neon_cos_dot(mflogspec, fe->mel_fb->mel_cosine[i],
+                                   fe->mel_fb->num_filters);
+#else
         mfcep[i] = 0;
         for (j = 0; j < fe->mel_fb->num_filters; j++) {
             mfcep[i] += COSMUL(mflogspec[j], fe->mel_fb->mel_cosine[i][j]);
         }
+#endif
         mfcep[i] = COSMUL(mfcep[i], fe->mel_fb->sqrt_inv_2n);
     }
 }
@@ -1179,6 +1371,27 @@ fe_dct3(fe_t * fe, const mfcc_t * mfcep, powspec_t * mflogspec)
     }
 }
 
+/**
+ * Apply each warp candidate's filterbank to the power spectrum
+ * already computed for this frame, writing their features one after
+ * the other.
+ */
+static void
+fe_warp_cep(fe_t * fe, mfcc_t * feat)
+{
+    melfb_t *mel_fb = fe->mel_fb;
+    int32 i;
+
+    for (i = 0; i < fe->n_warp; ++i) {
+        fe->mel_fb = &fe->warp_fb[i];
+        fe_mel_spec(fe);
+        fe_mel_cep(fe, feat);
+        fe_lifter(fe, feat);
+        feat += fe->feature_dimension;
+    }
+    fe->mel_fb = mel_fb;
+}
+
 void
 fe_write_frame(fe_t * fe, mfcc_t * feat, int32 store_pcm)
 {
@@ -1189,6 +1402,8 @@ fe_write_frame(fe_t * fe, mfcc_t * feat, int32 store_pcm)
     fe_track_snr(fe, &is_speech);
     fe_mel_cep(fe, feat);
     fe_lifter(fe, feat);
+    if (fe->n_warp > 0)
+        fe_warp_cep(fe, feat + fe->feature_dimension);
     fe_vad_hangover(fe, feat, is_speech, store_pcm);
 }
 
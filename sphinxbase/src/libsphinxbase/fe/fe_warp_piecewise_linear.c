@@ -115,6 +115,8 @@ fe_warp_piecewise_linear_set_parameters(char const *param_str,
     nyquist_frequency = sampling_rate / 2;
     if (param_str == NULL) {
         is_neutral = YES;
+        /* So that setting the last ones again is not skipped. */
+        p_str[0] = '\0';
         return;
     }
     /* The new parameters are the same as the current ones, so do nothing. */
@@ -39,6 +39,10 @@
  * Society of America, 111 (4), April 2002.
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
 #include "sphinxbase/prim_type.h"
 #include "sphinxbase/ckd_alloc.h"
 #include "sphinxbase/fixpoint.h"
@@ -47,9 +51,25 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#if !defined(FIXED_POINT)
+#if defined(__SSE2__) || defined(_M_X64)
+#define YIN_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define YIN_NEON
+#include <arm_neon.h>
+#endif
+#endif /* !FIXED_POINT */
 
 struct yin_s {
     uint16 frame_size;       /** Size of analysis frame. */
+    uint16 frame_shift;      /**< Samples between frames in yin_process_frames(). */
     uint16 search_threshold; /**< Threshold for finding period, in Q15 */
     uint16 search_range;     /**< Range around best local estimate to search, in Q15 */
     uint16 nfr;              /**< Number of frames read so far. */
@@ -61,13 +81,24 @@ struct yin_s {
 
     fixed32 **diff_window;  /**< Window of difference function outputs. */
     uint16 *period_window;  /**< Window of best period estimates. */
+
+    int16 *buf;             /**< Partial frame for yin_process_frames(). */
+    uint16 nbuf;            /**< Number of samples in buf. */
+
+#if !defined(FIXED_POINT)
+    int fft_size;           /**< Size of FFT for the autocorrelation. */
+    float64 *zr, *zi;       /**< FFT buffer, real and imaginary parts. */
+    float64 *cs, *ss;       /**< Twiddle factors, by stage. */
+    int32 *bitrev;          /**< Bit reversal permutation. */
+#endif
 };
 
+#if defined(FIXED_POINT)
 /**
  * The core of YIN: cumulative mean normalized difference function.
  */
 static void
-cmn_diff(int16 const *signal, int32 *out_diff, int ndiff)
+cmn_diff(yin_t *pe, int16 const *signal, int32 *out_diff, int ndiff)
 {
     uint32 cum, cshift;
     int32 t, tscale;
@@ -126,6 +157,179 @@ cmn_diff(int16 const *signal, int32 *out_diff, int ndiff)
            dd, cshift, dshift, (t<<tscale), cum, norm, out_diff[t]); */
     }
 }
+#else /* !FIXED_POINT */
+/**
+ * Set up the FFT for frames of ndiff lags.  The correlations are
+ * linear as long as the FFT is as long as the 2 * ndiff - 1 samples
+ * they cover.
+ */
+static void
+yin_fft_init(yin_t *pe, int ndiff)
+{
+    int i, j, n, order, half, k;
+
+    for (order = 1; (1 << order) < 2 * ndiff; ++order)
+        ;
+    n = pe->fft_size = 1 << order;
+    pe->zr = ckd_calloc(n, sizeof(*pe->zr));
+    pe->zi = ckd_calloc(n, sizeof(*pe->zi));
+    /* Stage with half-span h uses the h entries starting at h. */
+    pe->cs = ckd_calloc(n, sizeof(*pe->cs));
+    pe->ss = ckd_calloc(n, sizeof(*pe->ss));
+    for (half = 1; half < n; half <<= 1) {
+        for (k = 0; k < half; ++k) {
+            double a = -M_PI * k / half;
+            pe->cs[half + k] = cos(a);
+            pe->ss[half + k] = sin(a);
+        }
+    }
+    pe->bitrev = ckd_calloc(n, sizeof(*pe->bitrev));
+    for (i = 0; i < n; ++i) {
+        int r = 0;
+        for (j = 0; j < order; ++j)
+            if (i & (1 << j))
+                r |= 1 << (order - 1 - j);
+        pe->bitrev[i] = r;
+    }
+}
+
+static void
+yin_fft_free(yin_t *pe)
+{
+    ckd_free(pe->zr);
+    ckd_free(pe->zi);
+    ckd_free(pe->cs);
+    ckd_free(pe->ss);
+    ckd_free(pe->bitrev);
+}
+
+/**
+ * Forward complex FFT of zr + i zi, in place.
+ */
+static void
+yin_fft(yin_t *pe)
+{
+    float64 *zr = pe->zr, *zi = pe->zi;
+    int n = pe->fft_size;
+    int i, j, half;
+
+    for (i = 0; i < n; ++i) {
+        j = pe->bitrev[i];
+        if (j > i) {
+            float64 t;
+            t = zr[i]; zr[i] = zr[j]; zr[j] = t;
+            t = zi[i]; zi[i] = zi[j]; zi[j] = t;
+        }
+    }
+    for (half = 1; half < n; half <<= 1) {
+        float64 const *cs = pe->cs + half, *ss = pe->ss + half;
+
+        for (i = 0; i < n; i += 2 * half) {
+            float64 *ar = zr + i, *ai = zi + i;
+            float64 *br = zr + i + half, *bi = zi + i + half;
+            int k = 0;
+#if defined(YIN_SSE2)
+            for (; k + 2 <= half; k += 2) {
+                __m128d c = _mm_loadu_pd(cs + k), s = _mm_loadu_pd(ss + k);
+                __m128d xr = _mm_loadu_pd(br + k), xi = _mm_loadu_pd(bi + k);
+                __m128d yr = _mm_loadu_pd(ar + k), yi = _mm_loadu_pd(ai + k);
+                __m128d tr = _mm_sub_pd(_mm_mul_pd(c, xr), _mm_mul_pd(s, xi));
+                __m128d ti = _mm_add_pd(_mm_mul_pd(c, xi), _mm_mul_pd(s, xr));
+                _mm_storeu_pd(br + k, _mm_sub_pd(yr, tr));
+                _mm_storeu_pd(bi + k, _mm_sub_pd(yi, ti));
+                _mm_storeu_pd(ar + k, _mm_add_pd(yr, tr));
+                _mm_storeu_pd(ai + k, _mm_add_pd(yi, ti));
+            }
+#elif defined(YIN_NEON)
+            for (; k + 2 <= half; k += 2) {
+                float64x2_t c = vld1q_f64(cs + k), s = vld1q_f64(ss + k);
+                float64x2_t xr = vld1q_f64(br + k), xi = vld1q_f64(bi + k);
+                float64x2_t yr = vld1q_f64(ar + k), yi = vld1q_f64(ai + k);
+                float64x2_t tr = vsubq_f64(vmulq_f64(c, xr), vmulq_f64(s, xi));
+                float64x2_t ti = vaddq_f64(vmulq_f64(c, xi), vmulq_f64(s, xr));
+                vst1q_f64(br + k, vsubq_f64(yr, tr));
+                vst1q_f64(bi + k, vsubq_f64(yi, ti));
+                vst1q_f64(ar + k, vaddq_f64(yr, tr));
+                vst1q_f64(ai + k, vaddq_f64(yi, ti));
+            }
+#endif
+            for (; k < half; ++k) {
+                float64 tr = cs[k] * br[k] - ss[k] * bi[k];
+                float64 ti = cs[k] * bi[k] + ss[k] * br[k];
+                br[k] = ar[k] - tr;
+                bi[k] = ai[k] - ti;
+                ar[k] += tr;
+                ai[k] += ti;
+            }
+        }
+    }
+}
+
+/**
+ * The core of YIN: cumulative mean normalized difference function.
+ *
+ * The difference at lag t is e(0) + e(t) - 2 r(t), where e(t) is the
+ * energy of the ndiff samples from t, updated from one lag to the
+ * next, and r(t) the correlation of the first ndiff samples with
+ * those from t, all at once with an FFT.  The first half of the frame
+ * goes in the real part of the FFT and the whole of it in the
+ * imaginary part, so that one forward and one inverse transform do.
+ */
+static void
+cmn_diff(yin_t *pe, int16 const *signal, int32 *out_diff, int ndiff)
+{
+    float64 *zr = pe->zr, *zi = pe->zi;
+    int n = pe->fft_size;
+    int64 e0, et;
+    float64 cum;
+    int j, t;
+
+    for (j = 0; j < ndiff; ++j)
+        zr[j] = signal[j];
+    memset(zr + ndiff, 0, (n - ndiff) * sizeof(*zr));
+    for (j = 0; j < 2 * ndiff - 1; ++j)
+        zi[j] = signal[j];
+    memset(zi + 2 * ndiff - 1, 0, (n - 2 * ndiff + 1) * sizeof(*zi));
+    yin_fft(pe);
+
+    /* Split the spectra of the two halves A and B out of Z and form
+     * conj(A) B, conjugated again for the inverse transform. */
+    for (j = 0; j <= n / 2; ++j) {
+        int k = (n - j) & (n - 1);
+        float64 ar = (zr[j] + zr[k]) * 0.5, ai = (zi[j] - zi[k]) * 0.5;
+        float64 br = (zi[j] + zi[k]) * 0.5, bi = (zr[k] - zr[j]) * 0.5;
+        float64 pr = ar * br + ai * bi, pi = ar * bi - ai * br;
+        zr[j] = pr;
+        zi[j] = -pi;
+        if (k != j) {
+            /* The product is Hermitian, P(n - j) = conj(P(j)). */
+            zr[k] = pr;
+            zi[k] = pi;
+        }
+    }
+    yin_fft(pe);
+
+    e0 = 0;
+    for (j = 0; j < ndiff; ++j)
+        e0 += (int32)signal[j] * signal[j];
+    et = e0;
+    out_diff[0] = 32768;
+    cum = 0;
+    for (t = 1; t < ndiff; ++t) {
+        int64 r, d;
+
+        et += (int32)signal[t + ndiff - 1] * signal[t + ndiff - 1]
+            - (int32)signal[t - 1] * signal[t - 1];
+        /* Sums of products of integers, so round off the FFT's error. */
+        r = (int64)floor(zr[t] / n + 0.5);
+        d = e0 + et - 2 * r;
+        if (d < 0)
+            d = 0;
+        cum += d;
+        out_diff[t] = (cum > 0) ? (int32)(d * t * 32768.0 / cum) : 0;
+    }
+}
+#endif /* !FIXED_POINT */
 
 yin_t *
 yin_init(int frame_size, float search_threshold,
@@ -135,6 +339,7 @@ yin_init(int frame_size, float search_threshold,
 
     pe = ckd_calloc(1, sizeof(*pe));
     pe->frame_size = frame_size;
+    pe->frame_shift = frame_size;
     pe->search_threshold = (uint16)(search_threshold * 32768);
     pe->search_range = (uint16)(search_range * 32768);
     pe->wsize = smooth_window * 2 + 1;
@@ -143,14 +348,32 @@ yin_init(int frame_size, float search_threshold,
                                     sizeof(**pe->diff_window));
     pe->period_window = ckd_calloc(pe->wsize,
                                    sizeof(*pe->period_window));
+    pe->buf = ckd_calloc(pe->frame_size, sizeof(*pe->buf));
+#if !defined(FIXED_POINT)
+    yin_fft_init(pe, pe->frame_size / 2);
+#endif
     return pe;
 }
 
+void
+yin_set_frame_shift(yin_t *pe, int frame_shift)
+{
+    if (frame_shift < 1)
+        frame_shift = 1;
+    if (frame_shift > pe->frame_size)
+        frame_shift = pe->frame_size;
+    pe->frame_shift = frame_shift;
+}
+
 void
 yin_free(yin_t *pe)
 {
     ckd_free_2d(pe->diff_window);
     ckd_free(pe->period_window);
+    ckd_free(pe->buf);
+#if !defined(FIXED_POINT)
+    yin_fft_free(pe);
+#endif
     ckd_free(pe);
 }
 
@@ -160,6 +383,7 @@ yin_start(yin_t *pe)
     /* Reset the circular window pointers. */
     pe->wstart = pe->endut = 0;
     pe->nfr = 0;
+    pe->nbuf = 0;
 }
 
 void
@@ -206,7 +430,7 @@ yin_write(yin_t *pe, int16 const *frame)
 
     /* Now calculate normalized difference function. */
     difflen = pe->frame_size / 2;
-    cmn_diff(frame, pe->diff_window[outptr], difflen);
+    cmn_diff(pe, frame, pe->diff_window[outptr], difflen);
 
     /* Find the first point under threshold.  If not found, then
      * use the absolute minimum. */
@@ -320,3 +544,31 @@ yin_read(yin_t *pe, uint16 *out_period, uint16 *out_bestdiff)
         pe->wcur = 0;
     return 1;
 }
+
+int32
+yin_process_frames(yin_t *pe, int16 const **inout_raw, size_t *inout_nsamps,
+                   int stride, uint16 *out_period, uint16 *out_bestdiff,
+                   int32 *inout_nframes)
+{
+    int32 nfr = 0;
+
+    while (nfr < *inout_nframes) {
+        /* Fill up the frame from the input. */
+        while (pe->nbuf < pe->frame_size && *inout_nsamps > 0) {
+            pe->buf[pe->nbuf++] = **inout_raw;
+            *inout_raw += stride;
+            --*inout_nsamps;
+        }
+        if (pe->nbuf < pe->frame_size)
+            break;
+        yin_write(pe, pe->buf);
+        if (yin_read(pe, out_period + nfr, out_bestdiff + nfr))
+            ++nfr;
+        /* Keep the overlap with the next frame. */
+        memmove(pe->buf, pe->buf + pe->frame_shift,
+                (pe->frame_size - pe->frame_shift) * sizeof(*pe->buf));
+        pe->nbuf -= pe->frame_shift;
+    }
+    *inout_nframes = nfr;
+    return nfr;
+}
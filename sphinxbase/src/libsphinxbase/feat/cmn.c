@@ -59,12 +59,14 @@
 const char *cmn_type_str[] = {
     "none",
     "batch",
-    "live"
+    "live",
+    "ema"
 };
 const char *cmn_alt_type_str[] = {
     "none",
     "current",
-    "prior"
+    "prior",
+    "ema"
 };
 static const int n_cmn_type_str = sizeof(cmn_type_str)/sizeof(cmn_type_str[0]);
 
@@ -85,12 +87,17 @@ cmn_t *
 cmn_init(int32 veclen)
 {
     cmn_t *cmn;
+    int32 i;
     cmn = (cmn_t *) ckd_calloc(1, sizeof(cmn_t));
     cmn->veclen = veclen;
     cmn->cmn_mean = (mfcc_t *) ckd_calloc(veclen, sizeof(mfcc_t));
     cmn->cmn_var = (mfcc_t *) ckd_calloc(veclen, sizeof(mfcc_t));
     cmn->sum = (mfcc_t *) ckd_calloc(veclen, sizeof(mfcc_t));
+    cmn->sumsq = (mfcc_t *) ckd_calloc(veclen, sizeof(mfcc_t));
     cmn->nframe = 0;
+    /* Live variance normalization starts with unit variances. */
+    for (i = 0; i < veclen; i++)
+        cmn->cmn_var[i] = FLOAT2MFCC(1.0);
 
     return cmn;
 }
@@ -183,6 +190,9 @@ cmn_free(cmn_t * cmn)
         if (cmn->sum)
             ckd_free((void *) cmn->sum);
 
+        if (cmn->sumsq)
+            ckd_free((void *) cmn->sumsq);
+
         ckd_free((void *) cmn);
     }
 }
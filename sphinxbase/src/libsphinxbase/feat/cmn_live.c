@@ -39,6 +39,9 @@
 #include <config.h>
 #endif
 
+#include <stdio.h>
+#include <math.h>
+
 #ifdef _MSC_VER
 #pragma warning (disable: 4244)
 #endif
@@ -47,26 +50,159 @@
 #include "sphinxbase/err.h"
 #include "sphinxbase/cmn.h"
 
-void
-cmn_live_set(cmn_t *cmn, mfcc_t const * vec)
+#if !defined(FIXED_POINT)
+#if defined(__SSE2__) || defined(_M_X64)
+#define CMN_LIVE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define CMN_LIVE_NEON
+#include <arm_neon.h>
+#endif
+#endif /* !FIXED_POINT */
+
+/* Smallest variance used for live variance normalization. */
+#define CMN_VAR_FLOOR 1e-4
+
+/**
+ * Add one frame to the statistics and normalize it.
+ *
+ * The sums (and sums of squares, unless sumsq is NULL) are first
+ * multiplied by decay, which is 1 except in a full exponential
+ * window.  The current mean is subtracted from the frame, which is
+ * then scaled by the inverse standard deviations, unless ivar is NULL.
+ */
+static void
+cmn_live_frame(mfcc_t *x, int32 veclen, mfcc_t *sum, mfcc_t *sumsq,
+               mfcc_t const *mean, mfcc_t const *ivar, mfcc_t decay)
+{
+    int32 j;
+
+    for (j = 0; j < veclen; j++) {
+        sum[j] = MFCCMUL(sum[j], decay) + x[j];
+        if (sumsq)
+            sumsq[j] = MFCCMUL(sumsq[j], decay) + MFCCMUL(x[j], x[j]);
+        x[j] -= mean[j];
+        if (ivar)
+            x[j] = MFCCMUL(x[j], ivar[j]);
+    }
+}
+
+/*
+ * The vector versions of cmn_live_frame() do the same operations on
+ * four dimensions at a time, in the same order, so the results are
+ * the same.
+ */
+#ifdef CMN_LIVE_SSE2
+static void
+cmn_live_frame_sse2(mfcc_t *x, int32 veclen, mfcc_t *sum, mfcc_t *sumsq,
+                    mfcc_t const *mean, mfcc_t const *ivar, mfcc_t decay)
+{
+    __m128 d = _mm_set1_ps(decay);
+    int32 j;
+
+    for (j = 0; j + 4 <= veclen; j += 4) {
+        __m128 v = _mm_loadu_ps(x + j);
+
+        _mm_storeu_ps(sum + j,
+                      _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(sum + j), d), v));
+        if (sumsq)
+            _mm_storeu_ps(sumsq + j,
+                          _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(sumsq + j), d),
+                                     _mm_mul_ps(v, v)));
+        v = _mm_sub_ps(v, _mm_loadu_ps(mean + j));
+        if (ivar)
+            v = _mm_mul_ps(v, _mm_loadu_ps(ivar + j));
+        _mm_storeu_ps(x + j, v);
+    }
+    cmn_live_frame(x + j, veclen - j, sum + j, sumsq ? sumsq + j : NULL,
+                   mean + j, ivar ? ivar + j : NULL, decay);
+}
+#define CMN_LIVE_FRAME cmn_live_frame_sse2
+#endif /* CMN_LIVE_SSE2 */
+
+#ifdef CMN_LIVE_NEON
+static void
+cmn_live_frame_neon(mfcc_t *x, int32 veclen, mfcc_t *sum, mfcc_t *sumsq,
+                    mfcc_t const *mean, mfcc_t const *ivar, mfcc_t decay)
+{
+    float32x4_t d = vdupq_n_f32(decay);
+    int32 j;
+
+    for (j = 0; j + 4 <= veclen; j += 4) {
+        float32x4_t v = vld1q_f32(x + j);
+
+        vst1q_f32(sum + j, vaddq_f32(vmulq_f32(vld1q_f32(sum + j), d), v));
+        if (sumsq)
+            vst1q_f32(sumsq + j,
+                      vaddq_f32(vmulq_f32(vld1q_f32(sumsq + j), d),
+                                vmulq_f32(v, v)));
+        v = vsubq_f32(v, vld1q_f32(mean + j));
+        if (ivar)
+            v = vmulq_f32(v, vld1q_f32(ivar + j));
+        vst1q_f32(x + j, v);
+    }
+    cmn_live_frame(x + j, veclen - j, sum + j, sumsq ? sumsq + j : NULL,
+                   mean + j, ivar ? ivar + j : NULL, decay);
+}
+#define CMN_LIVE_FRAME cmn_live_frame_neon
+#endif /* CMN_LIVE_NEON */
+
+#ifndef CMN_LIVE_FRAME
+#define CMN_LIVE_FRAME cmn_live_frame
+#endif
+
+static void
+cmn_live_print(char const *what, cmn_t *cmn)
 {
     int32 i;
 
-    E_INFO("Update from < ");
+    E_INFO("%s < ", what);
     for (i = 0; i < cmn->veclen; i++)
         E_INFOCONT("%5.2f ", MFCC2FLOAT(cmn->cmn_mean[i]));
     E_INFOCONT(">\n");
+}
+
+/**
+ * Recompute the mean and, in floating point, the inverse standard
+ * deviations from the sums.
+ */
+static void
+cmn_live_estimate(cmn_t *cmn)
+{
+    int32 i;
 
+    for (i = 0; i < cmn->veclen; i++)
+        cmn->cmn_mean[i] = cmn->sum[i] / cmn->nframe;
+#ifndef FIXED_POINT
     for (i = 0; i < cmn->veclen; i++) {
+        float64 var = (float64)cmn->sumsq[i] / cmn->nframe
+            - (float64)cmn->cmn_mean[i] * cmn->cmn_mean[i];
+
+        if (var < CMN_VAR_FLOOR)
+            var = CMN_VAR_FLOOR;
+        cmn->cmn_var[i] = (mfcc_t)(1.0 / sqrt(var));
+    }
+#endif
+}
+
+void
+cmn_live_set(cmn_t *cmn, mfcc_t const * vec)
+{
+    int32 i;
+
+    cmn_live_print("Update from", cmn);
+    for (i = 0; i < cmn->veclen; i++) {
+#ifndef FIXED_POINT
+        /* Keep the variances. */
+        cmn->sumsq[i] = (1.0 / (cmn->cmn_var[i] * cmn->cmn_var[i])
+                         + vec[i] * vec[i]) * CMN_WIN;
+#endif
         cmn->cmn_mean[i] = vec[i];
         cmn->sum[i] = vec[i] * CMN_WIN;
     }
     cmn->nframe = CMN_WIN;
-
-    E_INFO("Update to   < ");
-    for (i = 0; i < cmn->veclen; i++)
-        E_INFOCONT("%5.2f ", MFCC2FLOAT(cmn->cmn_mean[i]));
-    E_INFOCONT(">\n");
+    cmn_live_print("Update to  ", cmn);
 }
 
 void
@@ -79,33 +215,103 @@ cmn_live_get(cmn_t *cmn, mfcc_t * vec)
 
 }
 
+int
+cmn_live_read(cmn_t *cmn, char const *file)
+{
+    FILE *fp;
+    mfcc_t *mean;
+    float64 val;
+    int32 i, n_var;
+
+    if ((fp = fopen(file, "r")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open CMN prior '%s'", file);
+        return -1;
+    }
+    mean = ckd_calloc(cmn->veclen, sizeof(*mean));
+    for (i = 0; i < cmn->veclen; i++) {
+        if (fscanf(fp, "%lf", &val) != 1)
+            break;
+        mean[i] = FLOAT2MFCC(val);
+    }
+    if (i < cmn->veclen) {
+        E_ERROR("CMN prior '%s' has fewer than %d means\n",
+                file, cmn->veclen);
+        ckd_free(mean);
+        fclose(fp);
+        return -1;
+    }
+    /* The variances are optional. */
+    for (n_var = 0; n_var < cmn->veclen; n_var++) {
+        if (fscanf(fp, "%lf", &val) != 1)
+            break;
+        if (val < CMN_VAR_FLOOR)
+            val = CMN_VAR_FLOOR;
+#ifndef FIXED_POINT
+        cmn->cmn_var[n_var] = (mfcc_t)(1.0 / sqrt(val));
+#endif
+    }
+    fclose(fp);
+    if (n_var != 0 && n_var != cmn->veclen) {
+        E_ERROR("CMN prior '%s' has %d variances, not %d\n",
+                file, n_var, cmn->veclen);
+        ckd_free(mean);
+        return -1;
+    }
+    cmn_live_set(cmn, mean);
+    ckd_free(mean);
+
+    return 0;
+}
+
+int
+cmn_live_write(cmn_t *cmn, char const *file)
+{
+    FILE *fp;
+    int32 i;
+
+    if ((fp = fopen(file, "w")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open CMN prior '%s' for writing", file);
+        return -1;
+    }
+    for (i = 0; i < cmn->veclen; i++)
+        fprintf(fp, "%s%g", i ? " " : "", MFCC2FLOAT(cmn->cmn_mean[i]));
+    fprintf(fp, "\n");
+#ifndef FIXED_POINT
+    for (i = 0; i < cmn->veclen; i++)
+        fprintf(fp, "%s%g", i ? " " : "",
+                1.0 / (cmn->cmn_var[i] * cmn->cmn_var[i]));
+    fprintf(fp, "\n");
+#endif
+    if (fclose(fp) < 0) {
+        E_ERROR_SYSTEM("Failed to write CMN prior '%s'", file);
+        return -1;
+    }
+
+    return 0;
+}
+
 static void
 cmn_live_shiftwin(cmn_t *cmn)
 {
     mfcc_t sf;
     int32 i;
 
-    E_INFO("Update from < ");
-    for (i = 0; i < cmn->veclen; i++)
-        E_INFOCONT("%5.2f ", MFCC2FLOAT(cmn->cmn_mean[i]));
-    E_INFOCONT(">\n");
-
-    sf = FLOAT2MFCC(1.0) / cmn->nframe;
-    for (i = 0; i < cmn->veclen; i++)
-        cmn->cmn_mean[i] = cmn->sum[i] / cmn->nframe; /* sum[i] * sf */
+    cmn_live_print("Update from", cmn);
+    cmn_live_estimate(cmn);
 
     /* Make the accumulation decay exponentially */
     if (cmn->nframe >= CMN_WIN_HWM) {
+        sf = FLOAT2MFCC(1.0) / cmn->nframe;
         sf = CMN_WIN * sf;
-        for (i = 0; i < cmn->veclen; i++)
+        for (i = 0; i < cmn->veclen; i++) {
             cmn->sum[i] = MFCCMUL(cmn->sum[i], sf);
+#ifndef FIXED_POINT
+            cmn->sumsq[i] = MFCCMUL(cmn->sumsq[i], sf);
+#endif
+        }
         cmn->nframe = CMN_WIN;
     }
-
-    E_INFO("Update to   < ");
-    for (i = 0; i < cmn->veclen; i++)
-        E_INFOCONT("%5.2f ", MFCC2FLOAT(cmn->cmn_mean[i]));
-    E_INFOCONT(">\n");
+    cmn_live_print("Update to  ", cmn);
 }
 
 void
@@ -117,57 +323,66 @@ cmn_live_update(cmn_t *cmn)
     if (cmn->nframe <= 0)
         return;
 
-    E_INFO("Update from < ");
-    for (i = 0; i < cmn->veclen; i++)
-        E_INFOCONT("%5.2f ", MFCC2FLOAT(cmn->cmn_mean[i]));
-    E_INFOCONT(">\n");
-
+    cmn_live_print("Update from", cmn);
     /* Update mean buffer */
-    sf = FLOAT2MFCC(1.0) / cmn->nframe;
-    for (i = 0; i < cmn->veclen; i++)
-        cmn->cmn_mean[i] = cmn->sum[i] / cmn->nframe; /* sum[i] * sf; */
+    cmn_live_estimate(cmn);
 
     /* Make the accumulation decay exponentially */
-    if (cmn->nframe > CMN_WIN_HWM) {
+    if (!cmn->ema && cmn->nframe > CMN_WIN_HWM) {
+        sf = FLOAT2MFCC(1.0) / cmn->nframe;
         sf = CMN_WIN * sf;
-        for (i = 0; i < cmn->veclen; i++)
+        for (i = 0; i < cmn->veclen; i++) {
             cmn->sum[i] = MFCCMUL(cmn->sum[i], sf);
+#ifndef FIXED_POINT
+            cmn->sumsq[i] = MFCCMUL(cmn->sumsq[i], sf);
+#endif
+        }
         cmn->nframe = CMN_WIN;
     }
-
-    E_INFO("Update to   < ");
-    for (i = 0; i < cmn->veclen; i++)
-        E_INFOCONT("%5.2f ", MFCC2FLOAT(cmn->cmn_mean[i]));
-    E_INFOCONT(">\n");
+    cmn_live_print("Update to  ", cmn);
 }
 
 void
 cmn_live(cmn_t *cmn, mfcc_t **incep, int32 varnorm, int32 nfr)
 {
+    mfcc_t *sumsq, *ivar;
     int32 i, j;
 
     if (nfr <= 0)
         return;
 
+#ifdef FIXED_POINT
     if (varnorm)
         E_FATAL
-            ("Variance normalization not implemented in live mode decode\n");
+            ("Variance normalization not implemented in fixed-point live mode\n");
+    sumsq = NULL;
+#else
+    sumsq = cmn->sumsq;
+#endif
+    ivar = varnorm ? cmn->cmn_var : NULL;
 
     for (i = 0; i < nfr; i++) {
+        mfcc_t decay = FLOAT2MFCC(1.0);
 
 	/* Skip zero energy frames */
 	if (incep[i][0] < 0)
 	    continue;
 
-        for (j = 0; j < cmn->veclen; j++) {
-            cmn->sum[j] += incep[i][j];
-            incep[i][j] -= cmn->cmn_mean[j];
+        /* Once the exponential window is full, old frames decay
+         * rather than new ones being counted. */
+        if (cmn->ema && cmn->nframe >= CMN_WIN)
+            decay = FLOAT2MFCC(1.0 - 1.0 / CMN_WIN);
+        else
+            ++cmn->nframe;
+        CMN_LIVE_FRAME(incep[i], cmn->veclen, cmn->sum, sumsq,
+                       cmn->cmn_mean, ivar, decay);
+        if (cmn->ema) {
+            for (j = 0; j < cmn->veclen; j++)
+                cmn->cmn_mean[j] = cmn->sum[j] / cmn->nframe;
         }
-
-        ++cmn->nframe;
     }
 
     /* Shift buffer down if we have more than CMN_WIN_HWM frames */
-    if (cmn->nframe > CMN_WIN_HWM)
+    if (!cmn->ema && cmn->nframe > CMN_WIN_HWM)
         cmn_live_shiftwin(cmn);
 }
@@ -117,6 +117,7 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 #ifdef HAVE_CONFIG_H
 #include <config.h>
@@ -352,6 +353,40 @@ feat_subvec_project(feat_t *fcb, mfcc_t ***inout_feat, uint32 nfr)
     }
 }
 
+void
+feat_set_frame_align(feat_t *fcb, int aligned)
+{
+    int32 i, k, align;
+
+    k = 0;
+    for (i = 0; i < fcb->n_stream; ++i)
+        k += fcb->stream_len[i];
+    if (aligned) {
+        align = FEAT_ARRAY_ALIGN / sizeof(mfcc_t);
+        k = (k + align - 1) / align * align;
+    }
+    fcb->frame_stride = k;
+}
+
+/**
+ * Allocate zeroed feature data, aligned if possible.  The result can
+ * be freed with ckd_free(), which some callers do directly.
+ */
+static mfcc_t *
+feat_data_alloc(size_t n)
+{
+#ifdef HAVE_POSIX_MEMALIGN
+    void *mem;
+
+    if (posix_memalign(&mem, FEAT_ARRAY_ALIGN, n * sizeof(mfcc_t)) != 0)
+        E_FATAL("posix_memalign(%d) failed\n", (int)(n * sizeof(mfcc_t)));
+    memset(mem, 0, n * sizeof(mfcc_t));
+    return (mfcc_t *)mem;
+#else
+    return (mfcc_t *) ckd_calloc(n, sizeof(mfcc_t));
+#endif
+}
+
 mfcc_t ***
 feat_array_alloc(feat_t * fcb, int32 nfr)
 {
@@ -369,10 +404,12 @@ feat_array_alloc(feat_t * fcb, int32 nfr)
         k += fcb->stream_len[i];
     assert(k >= feat_dimension(fcb));
     assert(k >= fcb->sv_dim);
+    assert(feat_frame_stride(fcb) >= k);
+    k = feat_frame_stride(fcb);
 
     feat =
         (mfcc_t ***) ckd_calloc_2d(nfr, feat_dimension1(fcb), sizeof(mfcc_t *));
-    data = (mfcc_t *) ckd_calloc(nfr * k, sizeof(mfcc_t));
+    data = feat_data_alloc(nfr * k);
 
     for (i = 0; i < nfr; i++) {
         d = data + i * k;
@@ -403,6 +440,7 @@ feat_array_realloc(feat_t *fcb, mfcc_t ***old_feat, int32 ofr, int32 nfr)
         k += fcb->stream_len[i];
     assert(k >= feat_dimension(fcb));
     assert(k >= fcb->sv_dim);
+    k = feat_frame_stride(fcb);
     
     new_feat = feat_array_alloc(fcb, nfr);
 
@@ -621,6 +659,51 @@ feat_1s_c_d_dd_cep2feat(feat_t * fcb, mfcc_t ** mfc, mfcc_t ** feat)
     }
 }
 
+/*
+ * Incremental version of feat_1s_c_d_dd_cep2feat().  Since D2CEP is
+ * just the difference of the DCEP of neighbouring frames, each DCEP
+ * vector is computed once into fcb->dcepbuf and reused for the two
+ * following frames, rather than recomputing three of them per frame.
+ * The window is addressed by index into cep (modulo ncep), so the
+ * live buffer needs no flattening at the wraparound.  Frames must be
+ * computed in order; first is TRUE for the first one (when no deltas
+ * are available yet).  The results are identical to the original.
+ */
+static void
+feat_1s_c_d_dd_incr(feat_t * fcb, mfcc_t ** cep, int32 ncep, int32 pos,
+                    int32 first, mfcc_t ** feat)
+{
+    mfcc_t *f, *d, *d1, *d_1, *w, *_w;
+    int32 i, j, cepsize;
+
+    cepsize = feat_cepsize(fcb);
+
+    /* DCEP for the frame after this one, and at the start of the
+     * utterance, for this one and the one before as well. */
+    for (j = first ? -1 : 1; j <= 1; ++j) {
+        d = fcb->dcepbuf[(pos + j + LIVEBUFBLOCKSIZE) % LIVEBUFBLOCKSIZE];
+        w = cep[(pos + j + FEAT_DCEP_WIN + ncep) % ncep];
+        _w = cep[(pos + j - FEAT_DCEP_WIN + ncep) % ncep];
+        for (i = 0; i < cepsize; i++)
+            d[i] = w[i] - _w[i];
+    }
+
+    /* CEP */
+    memcpy(feat[0], cep[pos], cepsize * sizeof(mfcc_t));
+
+    /* DCEP */
+    f = feat[0] + cepsize;
+    d = fcb->dcepbuf[pos % LIVEBUFBLOCKSIZE];
+    memcpy(f, d, cepsize * sizeof(mfcc_t));
+
+    /* D2CEP */
+    f += cepsize;
+    d1 = fcb->dcepbuf[(pos + 1) % LIVEBUFBLOCKSIZE];
+    d_1 = fcb->dcepbuf[(pos - 1 + LIVEBUFBLOCKSIZE) % LIVEBUFBLOCKSIZE];
+    for (i = 0; i < cepsize; i++)
+        f[i] = d1[i] - d_1[i];
+}
+
 static void
 feat_1s_c_d_ld_dd_cep2feat(feat_t * fcb, mfcc_t ** mfc, mfcc_t ** feat)
 {
@@ -862,8 +945,10 @@ feat_init(char const *type, cmn_type_t cmn, int32 varnorm,
         ckd_free(wd);
     }
 
-    if (cmn != CMN_NONE)
+    if (cmn != CMN_NONE) {
         fcb->cmn_struct = cmn_init(feat_cepsize(fcb));
+        fcb->cmn_struct->ema = (cmn == CMN_EMA);
+    }
     fcb->cmn = cmn;
     fcb->varnorm = varnorm;
     if (agc != AGC_NONE) {
@@ -887,6 +972,11 @@ feat_init(char const *type, cmn_type_t cmn, int32 varnorm,
      * wraparounds. */
     fcb->tmpcepbuf = (mfcc_t** )ckd_calloc(2 * feat_window_size(fcb) + 1,
                                 sizeof(*fcb->tmpcepbuf));
+    if (fcb->compute_feat == feat_1s_c_d_dd_cep2feat)
+        fcb->dcepbuf = (mfcc_t **) ckd_calloc_2d(LIVEBUFBLOCKSIZE,
+                                                 feat_cepsize(fcb),
+                                                 sizeof(mfcc_t));
+    feat_set_frame_align(fcb, FALSE);
 
     return fcb;
 }
@@ -918,7 +1008,7 @@ feat_cmn(feat_t *fcb, mfcc_t **mfc, int32 nfr, int32 beginutt, int32 endutt)
     cmn_type_t cmn_type = fcb->cmn;
 
     if (!(beginutt && endutt)
-        && cmn_type != CMN_NONE) /* Only cmn_prior in block computation mode. */
+        && cmn_type == CMN_BATCH) /* Only cmn_prior in block computation mode. */
         fcb->cmn = cmn_type = CMN_LIVE;
 
     switch (cmn_type) {
@@ -926,6 +1016,7 @@ feat_cmn(feat_t *fcb, mfcc_t **mfc, int32 nfr, int32 beginutt, int32 endutt)
         cmn(fcb->cmn_struct, mfc, fcb->varnorm, nfr);
         break;
     case CMN_LIVE:
+    case CMN_EMA:
         cmn_live(fcb->cmn_struct, mfc, fcb->varnorm, nfr);
         if (endutt)
             cmn_live_update(fcb->cmn_struct);
@@ -971,8 +1062,14 @@ feat_compute_utt(feat_t *fcb, mfcc_t **mfc, int32 nfr, int32 win, mfcc_t ***feat
     cep_dump_dbg(fcb, mfc, nfr, "Incoming features (after padding)");
 
     /* Create feature vectors */
-    for (i = win; i < nfr - win; i++) {
-        fcb->compute_feat(fcb, mfc + i, feat[i - win]);
+    if (fcb->dcepbuf) {
+        for (i = win; i < nfr - win; i++)
+            feat_1s_c_d_dd_incr(fcb, mfc, nfr, i, i == win, feat[i - win]);
+    }
+    else {
+        for (i = win; i < nfr - win; i++) {
+            fcb->compute_feat(fcb, mfc + i, feat[i - win]);
+        }
     }
 
     feat_print_dbg(fcb, feat, nfr - win * 2, "After dynamic feature computation");
@@ -1323,8 +1420,10 @@ feat_s2mfc2feat_live(feat_t * fcb, mfcc_t ** uttcep, int32 *inout_ncep,
     cepsize = feat_cepsize(fcb);
 
     /* Empty the input buffer on start of utterance. */
-    if (beginutt)
+    if (beginutt) {
         fcb->bufpos = fcb->curpos;
+        fcb->dcepvalid = FALSE;
+    }
 
     /* Calculate how much data is in the buffer already. */
     nbufcep = fcb->bufpos - fcb->curpos;
@@ -1393,8 +1492,13 @@ feat_s2mfc2feat_live(feat_t * fcb, mfcc_t ** uttcep, int32 *inout_ncep,
         return 0; /* Do nothing. */
 
     for (i = 0; i < nfeatvec; ++i) {
+        if (fcb->dcepbuf) {
+            feat_1s_c_d_dd_incr(fcb, fcb->cepbuf, LIVEBUFBLOCKSIZE,
+                                fcb->curpos, !fcb->dcepvalid, ofeat[i]);
+            fcb->dcepvalid = TRUE;
+        }
         /* Handle wraparound cases. */
-        if (fcb->curpos - win < 0 || fcb->curpos + win >= LIVEBUFBLOCKSIZE) {
+        else if (fcb->curpos - win < 0 || fcb->curpos + win >= LIVEBUFBLOCKSIZE) {
             /* Use tmpcepbuf for this case.  Actually, we just need the pointers. */
             for (j = -win; j <= win; ++j) {
                 int32 tmppos =
@@ -1423,7 +1527,7 @@ feat_s2mfc2feat_live(feat_t * fcb, mfcc_t ** uttcep, int32 *inout_ncep,
 void 
 feat_update_stats(feat_t *fcb)
 {
-    if (fcb->cmn == CMN_LIVE) {
+    if (fcb->cmn == CMN_LIVE || fcb->cmn == CMN_EMA) {
         cmn_live_update(fcb->cmn_struct);
     }
     if (fcb->agc == AGC_EMAX || fcb->agc == AGC_MAX) {
@@ -1449,12 +1553,15 @@ feat_free(feat_t * f)
     if (f->cepbuf)
         ckd_free_2d((void **) f->cepbuf);
     ckd_free(f->tmpcepbuf);
+    if (f->dcepbuf)
+        ckd_free_2d((void **) f->dcepbuf);
 
     if (f->name) {
         ckd_free((void *) f->name);
     }
     if (f->lda)
         ckd_free_3d((void ***) f->lda);
+    ckd_free(f->lda_t);
 
     ckd_free(f->stream_len);
     ckd_free(f->sv_len);
@@ -55,8 +55,162 @@
 #include "sphinxbase/bio.h"
 #include "sphinxbase/err.h"
 
+#if !defined(FIXED_POINT)
+#if defined(__SSE2__) || defined(_M_X64)
+#define FEAT_LDA_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FEAT_LDA_AVX
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define FEAT_LDA_NEON
+#include <arm_neon.h>
+#endif
+#endif /* !FIXED_POINT */
+
 #define MATRIX_FILE_VERSION "0.1"
 
+/* Frames and output dimensions done at once by the vector kernels. */
+#define LDA_BLOCK_FRAMES 4
+#define LDA_BLOCK_DIMS 8
+
+typedef void (*feat_lda_kernel_t)(feat_t *fcb, mfcc_t **in, mfcc_t *out);
+
+#if defined(FEAT_LDA_SSE2) || defined(FEAT_LDA_AVX) || defined(FEAT_LDA_NEON)
+/*
+ * The kernels below multiply LDA_BLOCK_FRAMES frames by the
+ * transposed matrix, LDA_BLOCK_DIMS output dimensions at a time, so
+ * that each row of the matrix is loaded once per block of frames.
+ * Each lane accumulates one output dimension over the input in the
+ * same order as the scalar loop, without fused multiply-adds, so the
+ * results are the same.
+ */
+#ifdef FEAT_LDA_SSE2
+static void
+feat_lda_block_sse2(feat_t *fcb, mfcc_t **in, mfcc_t *out)
+{
+    uint32 j, k, f;
+
+    for (j = 0; j < fcb->lda_t_stride; j += LDA_BLOCK_DIMS) {
+        __m128 acc[LDA_BLOCK_FRAMES][2];
+
+        for (f = 0; f < LDA_BLOCK_FRAMES; ++f)
+            acc[f][0] = acc[f][1] = _mm_setzero_ps();
+        for (k = 0; k < fcb->stream_len[0]; ++k) {
+            mfcc_t const *row = fcb->lda_t + k * fcb->lda_t_stride + j;
+            __m128 m0 = _mm_loadu_ps(row);
+            __m128 m1 = _mm_loadu_ps(row + 4);
+            for (f = 0; f < LDA_BLOCK_FRAMES; ++f) {
+                __m128 x = _mm_set1_ps(in[f][k]);
+                acc[f][0] = _mm_add_ps(acc[f][0], _mm_mul_ps(x, m0));
+                acc[f][1] = _mm_add_ps(acc[f][1], _mm_mul_ps(x, m1));
+            }
+        }
+        for (f = 0; f < LDA_BLOCK_FRAMES; ++f) {
+            _mm_storeu_ps(out + f * fcb->lda_t_stride + j, acc[f][0]);
+            _mm_storeu_ps(out + f * fcb->lda_t_stride + j + 4, acc[f][1]);
+        }
+    }
+}
+#endif /* FEAT_LDA_SSE2 */
+
+#ifdef FEAT_LDA_AVX
+__attribute__((target("avx")))
+static void
+feat_lda_block_avx(feat_t *fcb, mfcc_t **in, mfcc_t *out)
+{
+    uint32 j, k, f;
+
+    for (j = 0; j < fcb->lda_t_stride; j += LDA_BLOCK_DIMS) {
+        __m256 acc[LDA_BLOCK_FRAMES];
+
+        for (f = 0; f < LDA_BLOCK_FRAMES; ++f)
+            acc[f] = _mm256_setzero_ps();
+        for (k = 0; k < fcb->stream_len[0]; ++k) {
+            __m256 m = _mm256_loadu_ps(fcb->lda_t + k * fcb->lda_t_stride + j);
+            for (f = 0; f < LDA_BLOCK_FRAMES; ++f)
+                acc[f] = _mm256_add_ps(acc[f],
+                                       _mm256_mul_ps(_mm256_set1_ps(in[f][k]), m));
+        }
+        for (f = 0; f < LDA_BLOCK_FRAMES; ++f)
+            _mm256_storeu_ps(out + f * fcb->lda_t_stride + j, acc[f]);
+    }
+}
+#endif /* FEAT_LDA_AVX */
+
+#ifdef FEAT_LDA_NEON
+static void
+feat_lda_block_neon(feat_t *fcb, mfcc_t **in, mfcc_t *out)
+{
+    uint32 j, k, f;
+
+    for (j = 0; j < fcb->lda_t_stride; j += LDA_BLOCK_DIMS) {
+        float32x4_t acc[LDA_BLOCK_FRAMES][2];
+
+        for (f = 0; f < LDA_BLOCK_FRAMES; ++f)
+            acc[f][0] = acc[f][1] = vdupq_n_f32(0);
+        for (k = 0; k < fcb->stream_len[0]; ++k) {
+            mfcc_t const *row = fcb->lda_t + k * fcb->lda_t_stride + j;
+            float32x4_t m0 = vld1q_f32(row);
+            float32x4_t m1 = vld1q_f32(row + 4);
+            for (f = 0; f < LDA_BLOCK_FRAMES; ++f) {
+                float32x4_t x = vdupq_n_f32(in[f][k]);
+                acc[f][0] = vaddq_f32(acc[f][0], vmulq_f32(x, m0));
+                acc[f][1] = vaddq_f32(acc[f][1], vmulq_f32(x, m1));
+            }
+        }
+        for (f = 0; f < LDA_BLOCK_FRAMES; ++f) {
+            vst1q_f32(out + f * fcb->lda_t_stride + j, acc[f][0]);
+            vst1q_f32(out + f * fcb->lda_t_stride + j + 4, acc[f][1]);
+        }
+    }
+}
+#endif /* FEAT_LDA_NEON */
+
+/**
+ * Transpose the first transformation into fcb->lda_t, with the output
+ * dimensions padded with zeros to a multiple of LDA_BLOCK_DIMS.
+ */
+static void
+feat_lda_pack(feat_t *fcb)
+{
+    uint32 j, k;
+
+    ckd_free(fcb->lda_t);
+    fcb->lda_t_stride = (fcb->out_dim + LDA_BLOCK_DIMS - 1)
+        / LDA_BLOCK_DIMS * LDA_BLOCK_DIMS;
+    fcb->lda_t = ckd_calloc(fcb->stream_len[0] * fcb->lda_t_stride,
+                            sizeof(*fcb->lda_t));
+    for (j = 0; j < fcb->out_dim; ++j)
+        for (k = 0; k < fcb->stream_len[0]; ++k)
+            fcb->lda_t[k * fcb->lda_t_stride + j] = fcb->lda[0][j][k];
+}
+#endif
+
+/**
+ * Choose the best vector kernel for this machine, if any.
+ */
+static feat_lda_kernel_t
+feat_lda_kernel(void)
+{
+    feat_lda_kernel_t kernel = NULL;
+
+#ifdef FEAT_LDA_NEON
+    kernel = feat_lda_block_neon;
+#endif
+#ifdef FEAT_LDA_SSE2
+    kernel = feat_lda_block_sse2;
+#endif
+#ifdef FEAT_LDA_AVX
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx"))
+        kernel = feat_lda_block_avx;
+#endif
+    return kernel;
+}
+
 int32
 feat_read_lda(feat_t *feat, const char *ldafile, int32 dim)
 {
@@ -131,6 +285,9 @@ feat_read_lda(feat_t *feat, const char *ldafile, int32 dim)
         dim = m;
     }
     feat->out_dim = dim;
+#if defined(FEAT_LDA_SSE2) || defined(FEAT_LDA_AVX) || defined(FEAT_LDA_NEON)
+    feat_lda_pack(feat);
+#endif
 
     return 0;
 }
@@ -140,6 +297,29 @@ feat_lda_transform(feat_t *fcb, mfcc_t ***inout_feat, uint32 nfr)
 {
     mfcc_t *tmp;
     uint32 i, j, k;
+    feat_lda_kernel_t kernel;
+
+    if (fcb->lda_t && (kernel = feat_lda_kernel()) != NULL) {
+        mfcc_t *in[LDA_BLOCK_FRAMES];
+        uint32 f, nb;
+
+        tmp = ckd_calloc(LDA_BLOCK_FRAMES * fcb->lda_t_stride, sizeof(mfcc_t));
+        for (i = 0; i < nfr; i += nb) {
+            nb = (nfr - i < LDA_BLOCK_FRAMES) ? nfr - i : LDA_BLOCK_FRAMES;
+            /* Pad out a partial block by repeating the last frame. */
+            for (f = 0; f < LDA_BLOCK_FRAMES; ++f)
+                in[f] = inout_feat[i + (f < nb ? f : nb - 1)][0];
+            kernel(fcb, in, tmp);
+            for (f = 0; f < nb; ++f) {
+                memcpy(inout_feat[i + f][0], tmp + f * fcb->lda_t_stride,
+                       fcb->out_dim * sizeof(mfcc_t));
+                memset(inout_feat[i + f][0] + fcb->out_dim, 0,
+                       (fcb->stream_len[0] - fcb->out_dim) * sizeof(mfcc_t));
+            }
+        }
+        ckd_free(tmp);
+        return;
+    }
 
     tmp = ckd_calloc(fcb->stream_len[0], sizeof(mfcc_t));
     for (i = 0; i < nfr; ++i) {
@@ -33,6 +33,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
@@ -272,6 +273,445 @@ fsg_model_null_trans_closure(fsg_model_t * fsg, glist_t nulls)
     return nulls;
 }
 
+/* A word transition, as seen by fsg_model_minimize(). */
+typedef struct fsg_arc_s {
+    int32 wid;
+    int32 to;
+    int32 logp;
+} fsg_arc_t;
+
+#define FSG_NOT_FINAL 1         /* No logprob is ever positive. */
+
+static int
+fsg_arc_cmp(const void *a, const void *b)
+{
+    fsg_arc_t const *x = a, *y = b;
+
+    if (x->wid != y->wid)
+        return x->wid - y->wid;
+    if (x->to != y->to)
+        return x->to - y->to;
+    /* Best first, so that it survives fsg_arc_uniq(). */
+    return (y->logp > x->logp) - (y->logp < x->logp);
+}
+
+/* Sort arcs and keep only the best one with each word and destination. */
+static int32
+fsg_arc_uniq(fsg_arc_t *arcs, int32 n)
+{
+    int32 i, j;
+
+    if (n == 0)
+        return 0;
+    qsort(arcs, n, sizeof(*arcs), fsg_arc_cmp);
+    for (i = 0, j = 1; j < n; ++j) {
+        if (arcs[j].wid != arcs[i].wid || arcs[j].to != arcs[i].to)
+            arcs[++i] = arcs[j];
+    }
+    return i + 1;
+}
+
+/* Append the word transitions out of state j to arcs, adding logp. */
+static int32
+fsg_arc_collect(fsg_model_t *fsg, int32 j, int32 logp,
+                fsg_arc_t **arcs, int32 n, int32 *n_alloc)
+{
+    hash_iter_t *itor;
+
+    if (fsg->trans[j].trans == NULL)
+        return n;
+    for (itor = hash_table_iter(fsg->trans[j].trans);
+         itor; itor = hash_table_iter_next(itor)) {
+        gnode_t *gn;
+        for (gn = hash_entry_val(itor->ent); gn; gn = gnode_next(gn)) {
+            fsg_link_t *link = gnode_ptr(gn);
+            if (n == *n_alloc) {
+                *n_alloc = *n_alloc ? *n_alloc * 2 : 16;
+                *arcs = ckd_realloc(*arcs, *n_alloc * sizeof(**arcs));
+            }
+            (*arcs)[n].wid = link->wid;
+            (*arcs)[n].to = link->to_state;
+            (*arcs)[n].logp = link->logs2prob + logp;
+            ++n;
+        }
+    }
+    return n;
+}
+
+/* Give an empty FSG the vocabulary of another, with the same IDs. */
+static void
+fsg_model_copy_vocab(fsg_model_t *to, fsg_model_t *from)
+{
+    int32 i;
+
+    for (i = 0; i < from->n_word; ++i)
+        fsg_model_word_add(to, from->vocab[i]);
+    if (from->silwords) {
+        to->silwords = bitvec_alloc(to->n_word_alloc);
+        for (i = 0; i < from->n_word; ++i)
+            if (bitvec_is_set(from->silwords, i))
+                bitvec_set(to->silwords, i);
+    }
+    if (from->altwords) {
+        to->altwords = bitvec_alloc(to->n_word_alloc);
+        for (i = 0; i < from->n_word; ++i)
+            if (bitvec_is_set(from->altwords, i))
+                bitvec_set(to->altwords, i);
+    }
+}
+
+fsg_model_t *
+fsg_model_minimize(fsg_model_t * fsg)
+{
+    fsg_model_t *min;
+    fsg_arc_t **arcs, *tmp;
+    int32 *n_arcs, *fin, *live, *cls, *rep, *sig, *sigstart;
+    int32 i, j, n, n_tmp, n_alloc, n_cls, n_sig, updated;
+    hash_table_t *sigs;
+
+    glist_free(fsg_model_null_trans_closure(fsg, NULL));
+
+    /* Replace null transitions with the word transitions they lead
+     * to (the closure means that one step is enough). */
+    arcs = ckd_calloc(fsg->n_state, sizeof(*arcs));
+    n_arcs = ckd_calloc(fsg->n_state, sizeof(*n_arcs));
+    fin = ckd_calloc(fsg->n_state, sizeof(*fin));
+    for (i = 0; i < fsg->n_state; ++i) {
+        n_alloc = 0;
+        n = fsg_arc_collect(fsg, i, 0, &arcs[i], 0, &n_alloc);
+        fin[i] = (i == fsg->final_state) ? 0 : FSG_NOT_FINAL;
+        if (fsg->trans[i].null_trans) {
+            hash_iter_t *itor;
+            for (itor = hash_table_iter(fsg->trans[i].null_trans);
+                 itor; itor = hash_table_iter_next(itor)) {
+                fsg_link_t *link = hash_entry_val(itor->ent);
+                if (link->to_state == fsg->final_state
+                    && (fin[i] == FSG_NOT_FINAL || link->logs2prob > fin[i]))
+                    fin[i] = link->logs2prob;
+                n = fsg_arc_collect(fsg, link->to_state, link->logs2prob,
+                                    &arcs[i], n, &n_alloc);
+            }
+        }
+        n_arcs[i] = fsg_arc_uniq(arcs[i], n);
+    }
+
+    /* Keep only states on some path from start to final. */
+    live = ckd_calloc(fsg->n_state, sizeof(*live));
+    live[fsg->start_state] = TRUE;
+    do {
+        updated = FALSE;
+        for (i = 0; i < fsg->n_state; ++i) {
+            if (!live[i])
+                continue;
+            for (j = 0; j < n_arcs[i]; ++j) {
+                if (!live[arcs[i][j].to])
+                    live[arcs[i][j].to] = updated = TRUE;
+            }
+        }
+    } while (updated);
+    /* Now mark those which can also reach the final state (2). */
+    do {
+        updated = FALSE;
+        for (i = 0; i < fsg->n_state; ++i) {
+            if (live[i] != TRUE)
+                continue;
+            if (fin[i] != FSG_NOT_FINAL)
+                live[i] = updated = 2;
+            for (j = 0; j < n_arcs[i] && live[i] != 2; ++j) {
+                if (live[arcs[i][j].to] == 2)
+                    live[i] = updated = 2;
+            }
+        }
+    } while (updated);
+    live[fsg->start_state] = live[fsg->final_state] = 2;
+
+    /* Merge states with the same futures, refining an initial
+     * partition by finality until it stops changing. */
+    cls = ckd_calloc(fsg->n_state, sizeof(*cls));
+    sigstart = ckd_calloc(fsg->n_state + 1, sizeof(*sigstart));
+    tmp = NULL;
+    n_alloc = 0;
+    sig = NULL;
+    n_cls = 0;
+    do {
+        int32 n_sig_alloc = 0;
+
+        /* Each signature is the state's class, its final weight, and
+         * its transitions to other classes. */
+        n_sig = 0;
+        for (i = 0; i < fsg->n_state; ++i) {
+            sigstart[i] = n_sig;
+            if (live[i] != 2)
+                continue;
+            for (j = n_tmp = 0; j < n_arcs[i]; ++j) {
+                if (live[arcs[i][j].to] != 2)
+                    continue;
+                if (n_tmp == n_alloc) {
+                    n_alloc = n_alloc ? n_alloc * 2 : 16;
+                    tmp = ckd_realloc(tmp, n_alloc * sizeof(*tmp));
+                }
+                tmp[n_tmp] = arcs[i][j];
+                tmp[n_tmp].to = cls[arcs[i][j].to];
+                ++n_tmp;
+            }
+            n_tmp = fsg_arc_uniq(tmp, n_tmp);
+            if (n_sig + 2 + 3 * n_tmp > n_sig_alloc) {
+                n_sig_alloc = (n_sig + 2 + 3 * n_tmp) * 2;
+                sig = ckd_realloc(sig, n_sig_alloc * sizeof(*sig));
+            }
+            sig[n_sig++] = cls[i];
+            sig[n_sig++] = fin[i];
+            for (j = 0; j < n_tmp; ++j) {
+                sig[n_sig++] = tmp[j].wid;
+                sig[n_sig++] = tmp[j].to;
+                sig[n_sig++] = tmp[j].logp;
+            }
+        }
+        sigstart[fsg->n_state] = n_sig;
+
+        /* Number the distinct signatures in order of first appearance. */
+        sigs = hash_table_new(fsg->n_state, HASH_CASE_YES);
+        n = 0;
+        for (i = 0; i < fsg->n_state; ++i) {
+            void *val;
+            if (live[i] != 2)
+                continue;
+            val = hash_table_enter_bkey(sigs, (char const *)(sig + sigstart[i]),
+                                        (sigstart[i + 1] - sigstart[i])
+                                        * sizeof(*sig), (void *)(long)n);
+            if ((long)val == n)
+                ++n;
+            cls[i] = (int32)(long)val;
+        }
+        hash_table_free(sigs);
+        updated = (n != n_cls);
+        n_cls = n;
+    } while (updated);
+
+    /* Now build the new FSG, with the same vocabulary. */
+    min = fsg_model_init(fsg->name, fsg->lmath, fsg->lw, n_cls);
+    fsg_model_copy_vocab(min, fsg);
+    min->start_state = cls[fsg->start_state];
+    min->final_state = cls[fsg->final_state];
+    /* The first state of each class stands for the others. */
+    rep = ckd_calloc(n_cls, sizeof(*rep));
+    for (i = 0; i < n_cls; ++i)
+        rep[i] = -1;
+    for (i = 0; i < fsg->n_state; ++i) {
+        if (live[i] == 2 && rep[cls[i]] == -1)
+            rep[cls[i]] = i;
+    }
+    for (i = 0; i < n_cls; ++i) {
+        int32 s = rep[i];
+        for (j = 0; j < n_arcs[s]; ++j) {
+            if (live[arcs[s][j].to] == 2) {
+                fsg_model_trans_add(min, i, cls[arcs[s][j].to],
+                                    arcs[s][j].logp, arcs[s][j].wid);
+            }
+        }
+        if (i != min->final_state && fin[s] != FSG_NOT_FINAL)
+            fsg_model_null_trans_add(min, i, min->final_state, fin[s]);
+    }
+    E_INFO("Minimized FSG from %d to %d states\n", fsg->n_state, n_cls);
+
+    for (i = 0; i < fsg->n_state; ++i)
+        ckd_free(arcs[i]);
+    ckd_free(arcs);
+    ckd_free(n_arcs);
+    ckd_free(fin);
+    ckd_free(live);
+    ckd_free(cls);
+    ckd_free(rep);
+    ckd_free(sig);
+    ckd_free(sigstart);
+    ckd_free(tmp);
+    return min;
+}
+
+/* Give up on determinization if it makes this many times more states. */
+#define FSG_DET_MAX_GROWTH 8
+
+/*
+ * Determinization of a minimized FSG.  Each new state is a set of old
+ * states, each with the part of its best incoming score which has not
+ * yet been put on a transition, stored as {n, state, residual, ...}.
+ */
+static fsg_model_t *
+fsg_model_determinize(fsg_model_t *fsg)
+{
+    fsg_model_t *det = NULL;
+    fsg_arc_t **arcs, *tmp, *out;
+    int32 **subsets, *n_arcs, *fin, *key, *outfin, *outstart;
+    int32 i, j, k, n, n_tmp, n_alloc, n_sub, n_sub_alloc;
+    int32 n_out, n_out_alloc, n_key_alloc;
+    hash_table_t *index;
+
+    /* Word transitions and final weights of the old states. */
+    arcs = ckd_calloc(fsg->n_state, sizeof(*arcs));
+    n_arcs = ckd_calloc(fsg->n_state, sizeof(*n_arcs));
+    fin = ckd_calloc(fsg->n_state, sizeof(*fin));
+    for (i = 0; i < fsg->n_state; ++i) {
+        n_alloc = 0;
+        n_arcs[i] = fsg_arc_collect(fsg, i, 0, &arcs[i], 0, &n_alloc);
+        fin[i] = (i == fsg->final_state) ? 0 : FSG_NOT_FINAL;
+    }
+    for (i = 0; i < fsg->n_state; ++i) {
+        fsg_link_t *link;
+        if (fsg->trans[i].null_trans == NULL)
+            continue;
+        if (hash_table_lookup_bkey(fsg->trans[i].null_trans,
+                                   (char const *) &fsg->final_state,
+                                   sizeof(fsg->final_state),
+                                   (void **) &link) == 0)
+            fin[i] = link->logs2prob;
+    }
+
+    index = hash_table_new(fsg->n_state, HASH_CASE_YES);
+    n_sub_alloc = fsg->n_state;
+    subsets = ckd_calloc(n_sub_alloc, sizeof(*subsets));
+    outfin = ckd_calloc(n_sub_alloc, sizeof(*outfin));
+    outstart = ckd_calloc(n_sub_alloc + 1, sizeof(*outstart));
+    subsets[0] = ckd_calloc(3, sizeof(**subsets));
+    subsets[0][0] = 1;
+    subsets[0][1] = fsg->start_state;
+    subsets[0][2] = 0;
+    hash_table_enter_bkey(index, (char const *) subsets[0],
+                          3 * sizeof(**subsets), (void *) 0);
+    n_sub = 1;
+    tmp = out = NULL;
+    key = NULL;
+    n_alloc = n_out = n_out_alloc = n_key_alloc = 0;
+    for (k = 0; k < n_sub; ++k) {
+        int32 *sub = subsets[k];
+
+        /* Gather all transitions out of this subset. */
+        outfin[k] = FSG_NOT_FINAL;
+        for (i = n_tmp = 0; i < sub[0]; ++i) {
+            int32 s = sub[1 + 2 * i], r = sub[2 + 2 * i];
+            if (fin[s] != FSG_NOT_FINAL
+                && (outfin[k] == FSG_NOT_FINAL || fin[s] + r > outfin[k]))
+                outfin[k] = fin[s] + r;
+            for (j = 0; j < n_arcs[s]; ++j) {
+                if (n_tmp == n_alloc) {
+                    n_alloc = n_alloc ? n_alloc * 2 : 16;
+                    tmp = ckd_realloc(tmp, n_alloc * sizeof(*tmp));
+                }
+                tmp[n_tmp] = arcs[s][j];
+                tmp[n_tmp].logp += r;
+                ++n_tmp;
+            }
+        }
+        n_tmp = fsg_arc_uniq(tmp, n_tmp);
+
+        /* Each word leads to the subset of its destinations. */
+        for (i = 0; i < n_tmp; i = j) {
+            int32 best = tmp[i].logp;
+            void *val;
+
+            for (j = i; j < n_tmp && tmp[j].wid == tmp[i].wid; ++j)
+                if (tmp[j].logp > best)
+                    best = tmp[j].logp;
+            n = 1 + 2 * (j - i);
+            if (n > n_key_alloc) {
+                n_key_alloc = n * 2;
+                key = ckd_realloc(key, n_key_alloc * sizeof(*key));
+            }
+            key[0] = j - i;
+            for (n = i; n < j; ++n) {
+                key[1 + 2 * (n - i)] = tmp[n].to;
+                key[2 + 2 * (n - i)] = tmp[n].logp - best;
+            }
+            n = 1 + 2 * (j - i);
+            if (hash_table_lookup_bkey(index, (char const *) key,
+                                       n * sizeof(*key), &val) < 0) {
+                if (n_sub > FSG_DET_MAX_GROWTH * fsg->n_state)
+                    goto give_up;
+                if (n_sub == n_sub_alloc) {
+                    n_sub_alloc *= 2;
+                    subsets = ckd_realloc(subsets,
+                                          n_sub_alloc * sizeof(*subsets));
+                    outfin = ckd_realloc(outfin,
+                                         n_sub_alloc * sizeof(*outfin));
+                    outstart = ckd_realloc(outstart, (n_sub_alloc + 1)
+                                           * sizeof(*outstart));
+                }
+                subsets[n_sub] = ckd_malloc(n * sizeof(*key));
+                memcpy(subsets[n_sub], key, n * sizeof(*key));
+                val = (void *)(long)n_sub;
+                hash_table_enter_bkey(index, (char const *) subsets[n_sub],
+                                      n * sizeof(*key), val);
+                ++n_sub;
+            }
+            if (n_out == n_out_alloc) {
+                n_out_alloc = n_out_alloc ? n_out_alloc * 2 : 16;
+                out = ckd_realloc(out, n_out_alloc * sizeof(*out));
+            }
+            out[n_out].wid = tmp[i].wid;
+            out[n_out].to = (int32)(long)val;
+            out[n_out].logp = best;
+            ++n_out;
+        }
+        outstart[k + 1] = n_out;
+    }
+
+    /* Subsets are numbered in the order they were found, and a new
+     * final state gets their final weights. */
+    det = fsg_model_init(fsg->name, fsg->lmath, fsg->lw, n_sub + 1);
+    fsg_model_copy_vocab(det, fsg);
+    det->start_state = 0;
+    det->final_state = n_sub;
+    for (k = 0; k < n_sub; ++k) {
+        for (i = outstart[k]; i < outstart[k + 1]; ++i)
+            fsg_model_trans_add(det, k, out[i].to, out[i].logp, out[i].wid);
+        if (outfin[k] != FSG_NOT_FINAL)
+            fsg_model_null_trans_add(det, k, n_sub, outfin[k]);
+    }
+
+  give_up:
+    if (det == NULL) {
+        E_WARN("Determinizing FSG %s would make too many states, "
+               "leaving it as is\n", fsg->name);
+    }
+    else
+        E_INFO("Determinized FSG from %d to %d states\n",
+               fsg->n_state, n_sub);
+    for (i = 0; i < fsg->n_state; ++i)
+        ckd_free(arcs[i]);
+    for (k = 0; k < n_sub; ++k)
+        ckd_free(subsets[k]);
+    hash_table_free(index);
+    ckd_free(arcs);
+    ckd_free(n_arcs);
+    ckd_free(fin);
+    ckd_free(subsets);
+    ckd_free(outfin);
+    ckd_free(outstart);
+    ckd_free(tmp);
+    ckd_free(out);
+    ckd_free(key);
+    return det;
+}
+
+fsg_model_t *
+fsg_model_optimize(fsg_model_t *fsg)
+{
+    fsg_model_t *min, *det, *out;
+
+    min = fsg_model_minimize(fsg);
+    if ((det = fsg_model_determinize(min)) == NULL)
+        return min;
+    out = fsg_model_minimize(det);
+    fsg_model_free(det);
+    /* Splitting states to make it deterministic may cost more
+     * states than merging them again saves. */
+    if (out->n_state > min->n_state) {
+        fsg_model_free(out);
+        return min;
+    }
+    fsg_model_free(min);
+    return out;
+}
+
 glist_t
 fsg_model_trans(fsg_model_t * fsg, int32 i, int32 j)
 {
@@ -489,6 +929,14 @@ fsg_model_add_alt(fsg_model_t * fsg, char const *baseword,
                 fsg_link_t *fl = gnode_ptr(gn);
                 if (fl->wid == basewid) {
                     fsg_link_t *link;
+                    gnode_t *gn2;
+
+                    /* Don't add it twice if the FSG is reused. */
+                    for (gn2 = trans; gn2; gn2 = gnode_next(gn2))
+                        if (((fsg_link_t *)gnode_ptr(gn2))->wid == altwid)
+                            break;
+                    if (gn2)
+                        continue;
 
                     /* Create transition object */
                     link = listelem_malloc(fsg->link_alloc);
@@ -48,6 +48,10 @@
 #include "lm_trie_quant.h"
 
 static void lm_trie_alloc_ngram(lm_trie_t * trie, uint32 * counts, int order);
+static size_t lm_trie_ngram_size(lm_trie_t * trie, uint32 * counts,
+                                 int order);
+static void lm_trie_init_ngram(lm_trie_t * trie, uint32 * counts,
+                               int order);
 
 static uint32
 base_size(uint32 entries, uint32 max_vocab, uint8 remaining_bits)
@@ -366,24 +370,103 @@ lm_trie_init(uint32 unigram_count)
 }
 
 lm_trie_t *
-lm_trie_create(uint32 unigram_count, int order)
+lm_trie_create(uint32 unigram_count, int order, char const *quant_spec)
 {
-    lm_trie_t *trie = lm_trie_init(unigram_count);
+    lm_trie_t *trie;
+    uint8 prob_bits[NGRAM_MAX_ORDER - 1], bo_bits[NGRAM_MAX_ORDER - 1];
+
+    if (order > 1
+        && lm_trie_quant_parse(quant_spec, order, prob_bits, bo_bits) < 0)
+        return NULL;
+    trie = lm_trie_init(unigram_count);
     trie->quant =
-        (order > 1) ? lm_trie_quant_create(order) : 0;
+        (order > 1) ? lm_trie_quant_create(order, prob_bits, bo_bits) : 0;
     return trie;
 }
 
+static void
+skip_pad(FILE * fp, size_t size)
+{
+    char pad[LM_TRIE_ALIGN];
+    size_t n = LM_TRIE_PAD(size) - size;
+
+    if (n)
+        fread(pad, 1, n, fp);
+}
+
+static void
+write_pad(FILE * fp, size_t size)
+{
+    char const pad[LM_TRIE_ALIGN] = { 0 };
+    size_t n = LM_TRIE_PAD(size) - size;
+
+    if (n)
+        fwrite(pad, 1, n, fp);
+}
+
 lm_trie_t *
-lm_trie_read_bin(uint32 * counts, int order, FILE * fp)
+lm_trie_read_bin(uint32 * counts, int order, FILE * fp, int aligned)
 {
-    lm_trie_t *trie = lm_trie_init(counts[0]);
-    trie->quant = (order > 1) ? lm_trie_quant_read_bin(fp, order) : NULL;
+    lm_trie_quant_t *quant = NULL;
+    lm_trie_t *trie;
+    size_t ug_size = (counts[0] + 1) * sizeof(unigram_t);
+
+    if (order > 1
+        && (quant = lm_trie_quant_read_bin(fp, order, aligned)) == NULL)
+        return NULL;
+    trie = lm_trie_init(counts[0]);
+    trie->quant = quant;
     fread(trie->unigrams, sizeof(*trie->unigrams), (counts[0] + 1), fp);
+    if (aligned)
+        skip_pad(fp, ug_size);
     if (order > 1) {
         lm_trie_alloc_ngram(trie, counts, order);
         fread(trie->ngram_mem, 1, trie->ngram_mem_size, fp);
+        if (aligned)
+            skip_pad(fp, trie->ngram_mem_size);
+    }
+    return trie;
+}
+
+lm_trie_t *
+lm_trie_map_bin(uint32 * counts, int order, uint8 * mem, size_t * size)
+{
+    lm_trie_quant_t *quant = NULL;
+    lm_trie_t *trie;
+    size_t ug_size = (counts[0] + 1) * sizeof(unigram_t);
+    size_t used, ngram_size;
+
+    used = 0;
+    if (order > 1) {
+        /* The quantization bits give the size of everything else. */
+        if ((quant = lm_trie_quant_map_bin(mem, *size, order)) == NULL)
+            return NULL;
+        used += LM_TRIE_PAD(lm_trie_quant_bin_size(quant));
+    }
+    if (used + LM_TRIE_PAD(ug_size) > *size) {
+        if (quant)
+            lm_trie_quant_free(quant);
+        return NULL;
     }
+    trie = lm_trie_init(counts[0]);
+    trie->quant = quant;
+    ckd_free(trie->unigrams);
+    trie->unigrams = (unigram_t *) (mem + used);
+    trie->ug_mapped = TRUE;
+    used += LM_TRIE_PAD(ug_size);
+    if (order > 1) {
+        ngram_size = lm_trie_ngram_size(trie, counts, order);
+        if (used + LM_TRIE_PAD(ngram_size) > *size) {
+            lm_trie_free(trie);
+            return NULL;
+        }
+        trie->ngram_mem_size = ngram_size;
+        trie->ngram_mem = mem + used;
+        trie->mapped = TRUE;
+        lm_trie_init_ngram(trie, counts, order);
+        used += LM_TRIE_PAD(ngram_size);
+    }
+    *size = used;
     return trie;
 }
 
@@ -395,43 +478,106 @@ lm_trie_write_bin(lm_trie_t * trie, uint32 unigram_count, FILE * fp)
         lm_trie_quant_write_bin(trie->quant, fp);
     fwrite(trie->unigrams, sizeof(*trie->unigrams), (unigram_count + 1),
            fp);
-    if (trie->ngram_mem)
+    write_pad(fp, (unigram_count + 1) * sizeof(*trie->unigrams));
+    if (trie->ngram_mem) {
         fwrite(trie->ngram_mem, 1, trie->ngram_mem_size, fp);
+        write_pad(fp, trie->ngram_mem_size);
+    }
 }
 
 void
 lm_trie_free(lm_trie_t * trie)
 {
     if (trie->ngram_mem) {
-        ckd_free(trie->ngram_mem);
+        middle_t *middle;
+
+        if (!trie->mapped)
+            ckd_free(trie->ngram_mem);
+        for (middle = trie->middle_begin; middle != trie->middle_end;
+             middle++)
+            ckd_free(middle->base.bloom);
+        ckd_free(trie->longest->base.bloom);
         ckd_free(trie->middle_begin);
         ckd_free(trie->longest);
     }
     if (trie->quant)
         lm_trie_quant_free(trie->quant);
-    ckd_free(trie->unigrams);
+    if (!trie->ug_mapped)
+        ckd_free(trie->unigrams);
     ckd_free(trie);
 }
 
-static void
-lm_trie_alloc_ngram(lm_trie_t * trie, uint32 * counts, int order)
+size_t
+lm_trie_mem_size(lm_trie_t * trie, uint32 unigram_count,
+                 size_t * out_mapped)
+{
+    size_t heap, size;
+    middle_t *middle;
+
+    heap = sizeof(*trie);
+    size = (unigram_count + 1) * sizeof(*trie->unigrams);
+    if (trie->quant)
+        size += lm_trie_quant_bin_size(trie->quant);
+    if (trie->ug_mapped)
+        *out_mapped += size;
+    else
+        heap += size;
+    if (trie->ngram_mem) {
+        if (trie->mapped)
+            *out_mapped += trie->ngram_mem_size;
+        else
+            heap += trie->ngram_mem_size;
+        for (middle = trie->middle_begin; middle != trie->middle_end;
+             middle++) {
+            heap += sizeof(*middle);
+            if (middle->base.bloom)
+                heap += (middle->base.bloom_mask + 1)
+                    * sizeof(*middle->base.bloom);
+        }
+        heap += sizeof(*trie->longest);
+        if (trie->longest->base.bloom)
+            heap += (trie->longest->base.bloom_mask + 1)
+                * sizeof(*trie->longest->base.bloom);
+    }
+    return heap;
+}
+
+static size_t
+lm_trie_ngram_size(lm_trie_t * trie, uint32 * counts, int order)
 {
+    size_t size;
     int i;
-    uint8 *mem_ptr;
-    uint8 **middle_starts;
 
-    trie->ngram_mem_size = 0;
+    size = 0;
     for (i = 1; i < order - 1; i++) {
-        trie->ngram_mem_size +=
-            middle_size(lm_trie_quant_msize(trie->quant), counts[i],
+        size +=
+            middle_size(lm_trie_quant_msize(trie->quant, i - 1), counts[i],
                         counts[0], counts[i + 1]);
     }
-    trie->ngram_mem_size +=
+    size +=
         longest_size(lm_trie_quant_lsize(trie->quant), counts[order - 1],
                      counts[0]);
+    return size;
+}
+
+static void
+lm_trie_alloc_ngram(lm_trie_t * trie, uint32 * counts, int order)
+{
+    trie->ngram_mem_size = lm_trie_ngram_size(trie, counts, order);
     trie->ngram_mem =
         (uint8 *) ckd_calloc(trie->ngram_mem_size,
                              sizeof(*trie->ngram_mem));
+    lm_trie_init_ngram(trie, counts, order);
+}
+
+/* Set up the middle and longest tables over trie->ngram_mem. */
+static void
+lm_trie_init_ngram(lm_trie_t * trie, uint32 * counts, int order)
+{
+    int i;
+    uint8 *mem_ptr;
+    uint8 **middle_starts;
+
     mem_ptr = trie->ngram_mem;
     trie->middle_begin =
         (middle_t *) ckd_calloc(order - 2, sizeof(*trie->middle_begin));
@@ -441,7 +587,8 @@ lm_trie_alloc_ngram(lm_trie_t * trie, uint32 * counts, int order)
     for (i = 2; i < order; i++) {
         middle_starts[i - 2] = mem_ptr;
         mem_ptr +=
-            middle_size(lm_trie_quant_msize(trie->quant), counts[i - 1],
+            middle_size(lm_trie_quant_msize(trie->quant, i - 2),
+                        counts[i - 1],
                         counts[0], counts[i]);
     }
     trie->longest = (longest_t *) ckd_calloc(1, sizeof(*trie->longest));
@@ -449,7 +596,7 @@ lm_trie_alloc_ngram(lm_trie_t * trie, uint32 * counts, int order)
     for (i = order - 1; i >= 2; --i) {
         middle_t *middle_ptr = &trie->middle_begin[i - 2];
         middle_init(middle_ptr, middle_starts[i - 2],
-                    lm_trie_quant_msize(trie->quant), counts[i - 1],
+                    lm_trie_quant_msize(trie->quant, i - 2), counts[i - 1],
                     counts[0], counts[i],
                     (i ==
                      order -
@@ -549,6 +696,108 @@ uniform_find(void *base, uint8 total_bits, uint8 key_bits, uint32 key_mask,
     return FALSE;
 }
 
+static uint64
+bloom_hash(uint32 parent, uint32 word)
+{
+    uint64 h = ((uint64) parent << 32) | word;
+
+    h *= 0x9e3779b97f4a7c15ULL;
+    h ^= h >> 29;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    return h ^ (h >> 32);
+}
+
+/* Three bits of one word, taken from the low bits of the hash. */
+static uint64
+bloom_bits(uint64 h)
+{
+    return (1ULL << (h & 63)) | (1ULL << ((h >> 6) & 63))
+        | (1ULL << ((h >> 12) & 63));
+}
+
+static void
+bloom_add(base_t * base, uint32 parent, uint32 word)
+{
+    uint64 h = bloom_hash(parent, word);
+    base->bloom[(h >> 32) & base->bloom_mask] |= bloom_bits(h);
+}
+
+/* FALSE if word is certainly not a child of the node at parent. */
+static int
+bloom_test(base_t * base, uint32 parent, uint32 word)
+{
+    uint64 h, bits;
+
+    if (base->bloom == NULL)
+        return TRUE;
+    h = bloom_hash(parent, word);
+    bits = bloom_bits(h);
+    return (base->bloom[(h >> 32) & base->bloom_mask] & bits) == bits;
+}
+
+static void
+bloom_alloc(base_t * base, uint32 entries)
+{
+    uint64 words = ((uint64) entries * LM_TRIE_BLOOM_BITS + 63) / 64;
+    uint32 size = 1;
+
+    while (size < words && size < (1U << 31))
+        size <<= 1;
+    ckd_free(base->bloom);
+    base->bloom = (uint64 *) ckd_calloc(size, sizeof(*base->bloom));
+    base->bloom_mask = size - 1;
+}
+
+static uint32
+base_word(base_t * base, uint32 ptr)
+{
+    bitarr_address_t address;
+
+    address.base = base->base;
+    address.offset = ptr * base->total_bits;
+    return bitarr_read_int25(address, base->word_bits, base->word_mask);
+}
+
+static uint32
+middle_next(middle_t * middle, uint32 ptr)
+{
+    bitarr_address_t address;
+
+    address.base = middle->base.base;
+    address.offset = ptr * middle->base.total_bits
+        + middle->base.word_bits + middle->quant_bits;
+    return bitarr_read_int25(address, middle->next_mask.bits,
+                             middle->next_mask.mask);
+}
+
+void
+lm_trie_build_bloom(lm_trie_t * trie, uint32 * counts, int order)
+{
+    uint32 i, parent, ptr, begin, end;
+    base_t *base;
+    int j;
+
+    for (j = 2; j <= order; j++) {
+        base = (j == order) ? &trie->longest->base
+            : &trie->middle_begin[j - 2].base;
+        bloom_alloc(base, counts[j - 1]);
+        /* Walk the parents, adding each of their children. */
+        for (i = 0; i < counts[j - 2]; i++) {
+            if (j == 2) {
+                begin = trie->unigrams[i].next;
+                end = trie->unigrams[i + 1].next;
+            }
+            else {
+                begin = middle_next(&trie->middle_begin[j - 3], i);
+                end = middle_next(&trie->middle_begin[j - 3], i + 1);
+            }
+            parent = begin;
+            for (ptr = begin; ptr < end; ptr++)
+                bloom_add(base, parent, base_word(base, ptr));
+        }
+    }
+}
+
 static bitarr_address_t
 middle_find(middle_t * middle, uint32 word, node_range_t * range)
 {
@@ -556,7 +805,8 @@ middle_find(middle_t * middle, uint32 word, node_range_t * range)
     bitarr_address_t address;
 
     /* finding BitPacked with uniform find */
-    if (!uniform_find
+    if (!bloom_test(&middle->base, range->begin, word)
+        || !uniform_find
         ((void *) middle->base.base, middle->base.total_bits,
          middle->base.word_bits, middle->base.word_mask, range->begin - 1,
          0, range->end, middle->base.max_vocab, word, &at_pointer)) {
@@ -588,7 +838,8 @@ longest_find(longest_t * longest, uint32 word, node_range_t * range)
     bitarr_address_t address;
 
     /* finding BitPacked with uniform find */
-    if (!uniform_find
+    if (!bloom_test(&longest->base, range->begin, word)
+        || !uniform_find
         ((void *) longest->base.base, longest->base.total_bits,
          longest->base.word_bits, longest->base.word_mask,
          range->begin - 1, 0, range->end, longest->base.max_vocab, word,
@@ -681,6 +932,38 @@ get_available_backoff(lm_trie_t * trie, int32 start, int32 * hist,
     return backoff;
 }
 
+float
+lm_trie_backoff(lm_trie_t * trie, int32 * hist, int32 n_hist)
+{
+    if (n_hist == 0)
+        return 0.0f;
+    return get_available_backoff(trie, 1, hist, n_hist);
+}
+
+void
+lm_trie_append_ug(lm_trie_t * trie, uint32 n_ug, float const *probs,
+                  uint32 n_add)
+{
+    unigram_t *unigrams;
+    uint32 i, end;
+
+    unigrams =
+        (unigram_t *) ckd_calloc(n_ug + n_add + 1, sizeof(*unigrams));
+    memcpy(unigrams, trie->unigrams, (n_ug + 1) * sizeof(*unigrams));
+    if (!trie->ug_mapped)
+        ckd_free(trie->unigrams);
+    trie->unigrams = unigrams;
+    trie->ug_mapped = FALSE;
+    /* New words are in no bigrams, so their ranges are empty. */
+    end = unigrams[n_ug].next;
+    for (i = 0; i < n_add; i++) {
+        unigrams[n_ug + i].prob = probs[i];
+        unigrams[n_ug + i].bo = 0;
+        unigrams[n_ug + i].next = end;
+    }
+    unigrams[n_ug + n_add].next = end;
+}
+
 static float
 lm_trie_nobo_score(lm_trie_t * trie, int32 wid, int32 * hist,
                    int max_order, int32 n_hist, int32 * n_used)
@@ -776,6 +1059,52 @@ lm_trie_score(lm_trie_t * trie, int order, int32 wid, int32 * hist,
     }
 }
 
+float
+lm_trie_state_score(lm_trie_t * trie, int order, int32 wid,
+                    ngram_state_t const *in, ngram_state_t * out,
+                    int32 * n_used)
+{
+    float prob;
+    int32 i, n_hist;
+    node_range_t node;
+    bitarr_address_t address;
+    unigram_t *ug;
+
+    n_hist = (in->n_hist < order - 1) ? in->n_hist : order - 1;
+    ug = unigram_find(trie->unigrams, wid, &node);
+    prob = ug->prob;
+    *n_used = 1;
+    out->hist[0] = wid;
+    out->backoff[0] = ug->bo;
+    out->n_hist = 1;
+    /* Walk down from the word as far as the history matches,
+     * collecting the backoff weights of the new state on the way. */
+    for (i = 0; i < n_hist && node.begin != node.end; i++) {
+        if (i == order - 2) {
+            address = longest_find(trie->longest, in->hist[i], &node);
+            if (address.base != NULL) {
+                prob = lm_trie_quant_lpread(trie->quant, address);
+                *n_used = order;
+            }
+            break;
+        }
+        address = middle_find(&trie->middle_begin[i], in->hist[i], &node);
+        if (address.base == NULL)
+            break;
+        prob = lm_trie_quant_mpread(trie->quant, address, i);
+        *n_used = i + 2;
+        out->hist[i + 1] = in->hist[i];
+        out->backoff[i + 1] = lm_trie_quant_mboread(trie->quant, address, i);
+        out->n_hist = i + 2;
+    }
+    /* Back off from the histories which were not matched. */
+    for (i = *n_used - 1; i < n_hist; i++)
+        prob += in->backoff[i];
+    if (out->n_hist > order - 1)
+        out->n_hist = order - 1;
+    return prob;
+}
+
 void
 lm_trie_fill_raw_ngram(lm_trie_t * trie,
     		       ngram_raw_t * raw_ngrams, uint32 * raw_ngram_idx,
@@ -44,6 +44,13 @@
 #include "ngram_model_internal.h"
 #include "lm_trie_quant.h"
 
+/**
+ * Sections of aligned binary files start on this boundary, so that
+ * they can be used in place from a memory map.
+ */
+#define LM_TRIE_ALIGN 8
+#define LM_TRIE_PAD(n) (((n) + LM_TRIE_ALIGN - 1) / LM_TRIE_ALIGN * LM_TRIE_ALIGN)
+
 typedef struct unigram_s {
     float prob;
     float bo;
@@ -55,6 +62,9 @@ typedef struct node_range_s {
     uint32 end;
 } node_range_t;
 
+/** Bits of Bloom filter per n-gram, see lm_trie_build_bloom(). */
+#define LM_TRIE_BLOOM_BITS 16
+
 typedef struct base_s {
     uint8 word_bits;
     uint8 total_bits;
@@ -62,6 +72,8 @@ typedef struct base_s {
     uint8 *base;
     uint32 insert_index;
     uint32 max_vocab;
+    uint64 *bloom;      /**< Filter of (parent, word) pairs, or NULL */
+    uint32 bloom_mask;  /**< Number of words in bloom, minus one */
 } base_t;
 
 typedef struct middle_s {
@@ -84,6 +96,8 @@ typedef struct lm_trie_s {
     middle_t *middle_end;
     longest_t *longest;
     lm_trie_quant_t *quant;
+    uint8 mapped;       /**< ngram_mem points into a file mapping */
+    uint8 ug_mapped;    /**< unigrams point into a file mapping */
 
     float backoff_cache[NGRAM_MAX_ORDER];
     uint32 hist_cache[NGRAM_MAX_ORDER - 1];
@@ -91,15 +105,60 @@ typedef struct lm_trie_s {
 
 /**
  * Creates lm_trie structure. Fills it if binary file with correspondent data is provided
+ *
+ * @param quant_spec bits used to quantize probabilities and backoffs,
+ *        see lm_trie_quant_parse(), or NULL for 16 bits each.
+ * @return NULL if quant_spec is invalid.
  */
-lm_trie_t *lm_trie_create(uint32 unigram_count, int order);
+lm_trie_t *lm_trie_create(uint32 unigram_count, int order,
+                          char const *quant_spec);
 
-lm_trie_t *lm_trie_read_bin(uint32 * counts, int order, FILE * fp);
+/**
+ * Reads lm_trie structure from binary file.
+ *
+ * @param aligned whether the file is in the aligned format written by
+ *        lm_trie_write_bin(), where each section is padded to
+ *        LM_TRIE_ALIGN bytes.
+ * @return NULL if the quantization header is invalid.
+ */
+lm_trie_t *lm_trie_read_bin(uint32 * counts, int order, FILE * fp,
+                            int aligned);
+
+/**
+ * Uses lm_trie structure in place from an aligned binary file, usually
+ * memory mapped.  Nothing is copied, so mem must stay valid until the
+ * trie is freed.  Words added later are kept outside the trie, see
+ * lm_trie_append_ug().
+ *
+ * @param size on input, the number of bytes available at mem; on
+ *        output, the number used, including padding.
+ * @return NULL if mem is too short for the trie.
+ */
+lm_trie_t *lm_trie_map_bin(uint32 * counts, int order, uint8 * mem,
+                           size_t * size);
+
+/**
+ * Builds a Bloom filter for each order above unigrams, so that most
+ * searches for n-grams which are not in the trie stop without
+ * touching it.  Each n-gram is keyed by its word and the position of
+ * its parent, and sets a few bits in a single 64-bit word.
+ */
+void lm_trie_build_bloom(lm_trie_t * trie, uint32 * counts, int order);
 
+/**
+ * Writes lm_trie structure in aligned binary format.
+ */
 void lm_trie_write_bin(lm_trie_t * trie, uint32 unigram_count, FILE * fp);
 
 void lm_trie_free(lm_trie_t * trie);
 
+/**
+ * Get the number of bytes of heap memory used by a trie, adding those
+ * it uses in place from a file mapping to *out_mapped.
+ */
+size_t lm_trie_mem_size(lm_trie_t * trie, uint32 unigram_count,
+                        size_t * out_mapped);
+
 void lm_trie_build(lm_trie_t * trie, ngram_raw_t ** raw_ngrams,
                    uint32 * counts, uint32 *out_counts, int order);
 
@@ -111,4 +170,26 @@ void lm_trie_fill_raw_ngram(lm_trie_t * trie,
 float lm_trie_score(lm_trie_t * trie, int order, int32 wid, int32 * hist,
                     int32 n_hist, int32 * n_used);
 
+/**
+ * Total backoff weight of a history, which is what a word with no
+ * N-Grams of its own gets added to its unigram probability.
+ */
+float lm_trie_backoff(lm_trie_t * trie, int32 * hist, int32 n_hist);
+
+/**
+ * Appends unigrams with no N-Grams after the n_ug already in the trie,
+ * copying the unigram array.  Used to fold words added to a model into
+ * the trie before writing it.
+ */
+void lm_trie_append_ug(lm_trie_t * trie, uint32 n_ug, float const *probs,
+                       uint32 n_add);
+
+/**
+ * Scores a word following a state, and fills in the state following it.
+ * Only the history which exists in the trie is kept in the new state.
+ */
+float lm_trie_state_score(lm_trie_t * trie, int order, int32 wid,
+                          ngram_state_t const *in, ngram_state_t * out,
+                          int32 * n_used);
+
 #endif                          /* __LM_TRIE_H__ */
@@ -46,6 +46,10 @@
 
 #define FLOAT_INF (0x7f800000)
 
+/* Quantization types in binary files. */
+#define QUANT_16 1      /* 16 bit probs and backoffs for all orders */
+#define QUANT_BITS 2    /* Bits for each order follow the type */
+
 typedef struct bins_s {
     float *begin;
     const float *end;
@@ -56,10 +60,12 @@ struct lm_trie_quant_s {
     bins_t *longest;
     uint8 *mem;
     size_t mem_size;
-    uint8 prob_bits;
-    uint8 bo_bits;
-    uint32 prob_mask;
-    uint32 bo_mask;
+    uint8 mapped;       /**< mem points into a file mapping */
+    uint8 order;
+    uint8 prob_bits[NGRAM_MAX_ORDER - 1]; /**< Bits for each order from 2 */
+    uint8 bo_bits[NGRAM_MAX_ORDER - 1];   /**< Unused for the highest order */
+    uint32 prob_mask[NGRAM_MAX_ORDER - 1];
+    uint32 bo_mask[NGRAM_MAX_ORDER - 1];
 };
 
 static void
@@ -109,91 +115,249 @@ bins_decode(bins_t * bins, size_t off)
 }
 
 static size_t
-quant_size(int order)
+quant_size(int order, uint8 const *prob_bits, uint8 const *bo_bits)
 {
-    int prob_bits = 16;
-    int bo_bits = 16;
-    size_t longest_table = (1U << prob_bits) * sizeof(float);
-    size_t middle_table = (1U << bo_bits) * sizeof(float) + longest_table;
+    size_t size;
+    int i;
+
     /* unigrams are currently not quantized so no need for a table. */
-    return (order - 2) * middle_table + longest_table;
+    size = 0;
+    for (i = 0; i < order - 2; i++)
+        size += ((1U << prob_bits[i]) + (1U << bo_bits[i])) * sizeof(float);
+    size += (1U << prob_bits[order - 2]) * sizeof(float);
+    return size;
 }
 
-lm_trie_quant_t *
-lm_trie_quant_create(int order)
+static lm_trie_quant_t *
+lm_trie_quant_init(int order, uint8 const *prob_bits, uint8 const *bo_bits,
+                   uint8 *mem)
 {
     float *start;
     int i;
     lm_trie_quant_t *quant =
         (lm_trie_quant_t *) ckd_calloc(1, sizeof(*quant));
-    quant->mem_size = quant_size(order);
-    quant->mem =
-        (uint8 *) ckd_calloc(quant->mem_size, sizeof(*quant->mem));
-
-    quant->prob_bits = 16;
-    quant->bo_bits = 16;
-    quant->prob_mask = (1U << quant->prob_bits) - 1;
-    quant->bo_mask = (1U << quant->bo_bits) - 1;
+    quant->mem_size = quant_size(order, prob_bits, bo_bits);
+    quant->mem = mem;
+    quant->order = order;
+
+    for (i = 0; i < order - 1; i++) {
+        quant->prob_bits[i] = prob_bits[i];
+        quant->bo_bits[i] = (i < order - 2) ? bo_bits[i] : 0;
+        quant->prob_mask[i] = (1U << quant->prob_bits[i]) - 1;
+        quant->bo_mask[i] = (1U << quant->bo_bits[i]) - 1;
+    }
 
     start = (float *) (quant->mem);
     for (i = 0; i < order - 2; i++) {
-        bins_create(&quant->tables[i][0], quant->prob_bits, start);
-        start += (1ULL << quant->prob_bits);
-        bins_create(&quant->tables[i][1], quant->bo_bits, start);
-        start += (1ULL << quant->bo_bits);
+        bins_create(&quant->tables[i][0], quant->prob_bits[i], start);
+        start += (1ULL << quant->prob_bits[i]);
+        bins_create(&quant->tables[i][1], quant->bo_bits[i], start);
+        start += (1ULL << quant->bo_bits[i]);
     }
-    bins_create(&quant->tables[order - 2][0], quant->prob_bits, start);
+    bins_create(&quant->tables[order - 2][0], quant->prob_bits[order - 2],
+                start);
     quant->longest = &quant->tables[order - 2][0];
     return quant;
 }
 
+int
+lm_trie_quant_parse(char const *spec, int order, uint8 * prob_bits,
+                    uint8 * bo_bits)
+{
+    char const *spec_start = spec;
+    int i, prob, bo, nread;
+
+    prob = bo = LM_TRIE_QUANT_MAX_BITS;
+    for (i = 0; i < order - 1; i++) {
+        if (spec && *spec) {
+            if (sscanf(spec, "%d%n", &prob, &nread) != 1)
+                goto error_out;
+            spec += nread;
+            bo = prob;
+            if (*spec == '/') {
+                if (sscanf(spec + 1, "%d%n", &bo, &nread) != 1)
+                    goto error_out;
+                spec += nread + 1;
+            }
+            if (*spec == ',')
+                ++spec;
+            else if (*spec)
+                goto error_out;
+        }
+        /* Orders which are not given use the last ones which were. */
+        if (prob < LM_TRIE_QUANT_MIN_BITS || prob > LM_TRIE_QUANT_MAX_BITS
+            || bo < LM_TRIE_QUANT_MIN_BITS || bo > LM_TRIE_QUANT_MAX_BITS)
+            goto error_out;
+        prob_bits[i] = prob;
+        bo_bits[i] = bo;
+    }
+    return 0;
+
+error_out:
+    E_ERROR("Invalid quantization '%s', should be probability/backoff "
+            "bits for each order, from %d to %d bits, separated by commas\n",
+            spec_start, LM_TRIE_QUANT_MIN_BITS, LM_TRIE_QUANT_MAX_BITS);
+    return -1;
+}
+
+lm_trie_quant_t *
+lm_trie_quant_create(int order, uint8 const *prob_bits, uint8 const *bo_bits)
+{
+    uint8 bits[NGRAM_MAX_ORDER - 1];
+
+    if (prob_bits == NULL) {
+        memset(bits, LM_TRIE_QUANT_MAX_BITS, sizeof(bits));
+        prob_bits = bo_bits = bits;
+    }
+    return lm_trie_quant_init(order, prob_bits, bo_bits,
+                              (uint8 *) ckd_calloc(quant_size(order,
+                                                              prob_bits,
+                                                              bo_bits),
+                                                   sizeof(uint8)));
+}
+
+/* Whether bits read from a file can be used. */
+static int
+quant_bits_valid(int order, uint8 const *prob_bits, uint8 const *bo_bits)
+{
+    int i;
+
+    for (i = 0; i < order - 1; i++) {
+        if (prob_bits[i] < LM_TRIE_QUANT_MIN_BITS
+            || prob_bits[i] > LM_TRIE_QUANT_MAX_BITS)
+            return FALSE;
+        if (i < order - 2 && (bo_bits[i] < LM_TRIE_QUANT_MIN_BITS
+                              || bo_bits[i] > LM_TRIE_QUANT_MAX_BITS))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* Whether the file needs bits for each order. */
+static int
+quant_is_16(lm_trie_quant_t * quant)
+{
+    int i;
+
+    for (i = 0; i < quant->order - 1; i++) {
+        if (quant->prob_bits[i] != 16
+            || (i < quant->order - 2 && quant->bo_bits[i] != 16))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+size_t
+lm_trie_quant_bin_size(lm_trie_quant_t * quant)
+{
+    /* Quantization type and a reserved word, then bits if needed. */
+    return 2 * sizeof(int32)
+        + (quant_is_16(quant) ? 0 : 2 * (NGRAM_MAX_ORDER - 1))
+        + quant->mem_size;
+}
 
 lm_trie_quant_t *
-lm_trie_quant_read_bin(FILE * fp, int order)
+lm_trie_quant_read_bin(FILE * fp, int order, int aligned)
 {
-    int dummy;
+    int32 type[2];
+    uint8 bits[2][NGRAM_MAX_ORDER - 1];
     lm_trie_quant_t *quant;
 
-    fread(&dummy, sizeof(dummy), 1, fp);
-    quant = lm_trie_quant_create(order);
+    /* Before it was quantization type.  Aligned files also have a
+     * reserved word so that the tables start on an 8-byte boundary. */
+    fread(type, sizeof(*type), aligned ? 2 : 1, fp);
+    if (aligned && type[0] == QUANT_BITS) {
+        if (fread(bits, sizeof(**bits), sizeof(bits), fp) != sizeof(bits)
+            || !quant_bits_valid(order, bits[0], bits[1])) {
+            E_ERROR("Invalid quantization bits in trie LM\n");
+            return NULL;
+        }
+        quant = lm_trie_quant_create(order, bits[0], bits[1]);
+    }
+    else
+        quant = lm_trie_quant_create(order, NULL, NULL);
     fread(quant->mem, sizeof(*quant->mem), quant->mem_size, fp);
 
     return quant;
 }
 
+lm_trie_quant_t *
+lm_trie_quant_map_bin(uint8 * mem, size_t size, int order)
+{
+    lm_trie_quant_t *quant;
+    uint8 bits[NGRAM_MAX_ORDER - 1];
+    int32 type;
+
+    if (size < 2 * sizeof(int32))
+        return NULL;
+    memcpy(&type, mem, sizeof(type));
+    mem += 2 * sizeof(int32);
+    size -= 2 * sizeof(int32);
+    if (type == QUANT_BITS) {
+        if (size < 2 * sizeof(bits)
+            || !quant_bits_valid(order, mem, mem + sizeof(bits)))
+            return NULL;
+        quant = lm_trie_quant_init(order, mem, mem + sizeof(bits),
+                                   mem + 2 * sizeof(bits));
+    }
+    else {
+        memset(bits, LM_TRIE_QUANT_MAX_BITS, sizeof(bits));
+        quant = lm_trie_quant_init(order, bits, bits, mem);
+    }
+    quant->mapped = TRUE;
+    if (lm_trie_quant_bin_size(quant) > size + 2 * sizeof(int32)) {
+        lm_trie_quant_free(quant);
+        return NULL;
+    }
+    return quant;
+}
+
 void
 lm_trie_quant_write_bin(lm_trie_quant_t * quant, FILE * fp)
 {
     /* Before it was quantization type */
-    int dummy = 1;
-    fwrite(&dummy, sizeof(dummy), 1, fp);
+    int32 type[2] = { QUANT_16, 0 };
+
+    if (quant_is_16(quant)) {
+        fwrite(type, sizeof(*type), 2, fp);
+    }
+    else {
+        type[0] = QUANT_BITS;
+        fwrite(type, sizeof(*type), 2, fp);
+        fwrite(quant->prob_bits, 1, sizeof(quant->prob_bits), fp);
+        fwrite(quant->bo_bits, 1, sizeof(quant->bo_bits), fp);
+    }
     fwrite(quant->mem, sizeof(*quant->mem), quant->mem_size, fp);
 }
 
 void
 lm_trie_quant_free(lm_trie_quant_t * quant)
 {
-    if (quant->mem)
+    if (quant->mem && !quant->mapped)
         ckd_free(quant->mem);
     ckd_free(quant);
 }
 
 uint8
-lm_trie_quant_msize(lm_trie_quant_t * quant)
+lm_trie_quant_msize(lm_trie_quant_t * quant, int order_minus_2)
 {
-    return 32;
+    return quant->prob_bits[order_minus_2] + quant->bo_bits[order_minus_2];
 }
 
 uint8
 lm_trie_quant_lsize(lm_trie_quant_t * quant)
 {
-    return 16;
+    return quant->prob_bits[quant->order - 2];
 }
 
 static int
 weights_comparator(const void *a, const void *b)
 {
-    return (int) (*(float *) a - *(float *) b);
+    float fa = *(float *) a, fb = *(float *) b;
+
+    /* Weights closer than 1 apart are still different, and sorting
+     * them properly matters with fewer bins. */
+    return (fa > fb) - (fa < fb);
 }
 
 static void
@@ -243,9 +407,10 @@ lm_trie_quant_train(lm_trie_quant_t * quant, int order, uint32 counts,
     }
 
     make_bins(probs, prob_num, quant->tables[order - 2][0].begin,
-              1ULL << quant->prob_bits);
+              1ULL << quant->prob_bits[order - 2]);
     centers = quant->tables[order - 2][1].begin;
-    make_bins(backoffs, backoff_num, centers, (1ULL << quant->bo_bits));
+    make_bins(backoffs, backoff_num, centers,
+              (1ULL << quant->bo_bits[order - 2]));
     ckd_free(probs);
     ckd_free(backoffs);
 }
@@ -266,7 +431,7 @@ lm_trie_quant_train_prob(lm_trie_quant_t * quant, int order, uint32 counts,
     }
 
     make_bins(probs, prob_num, quant->tables[order - 2][0].begin,
-              1ULL << quant->prob_bits);
+              1ULL << quant->prob_bits[order - 2]);
     ckd_free(probs);
 }
 
@@ -274,22 +439,23 @@ void
 lm_trie_quant_mwrite(lm_trie_quant_t * quant, bitarr_address_t address,
                      int order_minus_2, float prob, float backoff)
 {
-    bitarr_write_int57(address, quant->prob_bits + quant->bo_bits,
+    bitarr_write_int57(address, quant->prob_bits[order_minus_2]
+                       + quant->bo_bits[order_minus_2],
                        (uint64) ((bins_encode
                                   (&quant->tables[order_minus_2][0],
                                    prob) << quant->
-                                  bo_bits) | bins_encode(&quant->
-                                                         tables
-                                                         [order_minus_2]
-                                                         [1],
-                                                         backoff)));
+                                  bo_bits[order_minus_2]) |
+                                 bins_encode(&quant->
+                                             tables
+                                             [order_minus_2]
+                                             [1], backoff)));
 }
 
 void
 lm_trie_quant_lwrite(lm_trie_quant_t * quant, bitarr_address_t address,
                      float prob)
 {
-    bitarr_write_int25(address, quant->prob_bits,
+    bitarr_write_int25(address, quant->prob_bits[quant->order - 2],
                        (uint32) bins_encode(quant->longest, prob));
 }
 
@@ -298,24 +464,27 @@ lm_trie_quant_mboread(lm_trie_quant_t * quant, bitarr_address_t address,
                       int order_minus_2)
 {
     return bins_decode(&quant->tables[order_minus_2][1],
-                       bitarr_read_int25(address, quant->bo_bits,
-                                         quant->bo_mask));
+                       bitarr_read_int25(address,
+                                         quant->bo_bits[order_minus_2],
+                                         quant->bo_mask[order_minus_2]));
 }
 
 float
 lm_trie_quant_mpread(lm_trie_quant_t * quant, bitarr_address_t address,
                      int order_minus_2)
 {
-    address.offset += quant->bo_bits;
+    address.offset += quant->bo_bits[order_minus_2];
     return bins_decode(&quant->tables[order_minus_2][0],
-                       bitarr_read_int25(address, quant->prob_bits,
-                                         quant->prob_mask));
+                       bitarr_read_int25(address,
+                                         quant->prob_bits[order_minus_2],
+                                         quant->prob_mask[order_minus_2]));
 }
 
 float
 lm_trie_quant_lpread(lm_trie_quant_t * quant, bitarr_address_t address)
 {
     return bins_decode(quant->longest,
-                       bitarr_read_int25(address, quant->prob_bits,
-                                         quant->prob_mask));
+                       bitarr_read_int25(address,
+                                         quant->prob_bits[quant->order - 2],
+                                         quant->prob_mask[quant->order - 2]));
 }
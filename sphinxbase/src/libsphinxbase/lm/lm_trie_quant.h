@@ -43,15 +43,55 @@
 
 typedef struct lm_trie_quant_s lm_trie_quant_t;
 
+/** Fewest and most bits for a quantized probability or backoff. */
+#define LM_TRIE_QUANT_MIN_BITS 1
+#define LM_TRIE_QUANT_MAX_BITS 16
+
+/**
+ * Parse a quantization spec, such as "8/8,12" or "16/16".
+ *
+ * Entries are separated by commas, one for each order starting at
+ * bigrams, and give probability/backoff bits.  A single number is used
+ * for both.  Orders past the last entry reuse it, and backoff bits for
+ * the highest order are ignored.  NULL or "" means 16 bits everywhere.
+ *
+ * @param prob_bits, bo_bits filled in for orders 2 to order.
+ * @return 0, or -1 if spec is invalid.
+ */
+int lm_trie_quant_parse(char const *spec, int order, uint8 * prob_bits,
+                        uint8 * bo_bits);
+
 /**
  * Create qunatizing
+ *
+ * @param prob_bits, bo_bits bits for orders 2 to order, as filled in
+ *        by lm_trie_quant_parse(), or NULL for 16 bits each.
  */
-lm_trie_quant_t *lm_trie_quant_create(int order);
+lm_trie_quant_t *lm_trie_quant_create(int order, uint8 const *prob_bits,
+                                      uint8 const *bo_bits);
 
 /**
- * Write quant data to binary file
+ * Read quant data from binary file
+ *
+ * @param aligned whether the file is in the aligned format written by
+ *        lm_trie_quant_write_bin(), rather than the original one.
+ */
+lm_trie_quant_t *lm_trie_quant_read_bin(FILE * fp, int order, int aligned);
+
+/**
+ * Use quant data in an aligned binary file in place, for instance
+ * in a memory map.  mem must stay valid until the quant is freed.
+ *
+ * @param size bytes available at mem.
+ * @return NULL if they are too few or the header is invalid.
+ */
+lm_trie_quant_t *lm_trie_quant_map_bin(uint8 * mem, size_t size,
+                                       int order);
+
+/**
+ * Size of quant data in an aligned binary file
  */
-lm_trie_quant_t *lm_trie_quant_read_bin(FILE * fp, int order);
+size_t lm_trie_quant_bin_size(lm_trie_quant_t * quant);
 
 /**
  * Write quant data to binary file
@@ -67,7 +107,7 @@ void lm_trie_quant_free(lm_trie_quant_t * quant);
  * Memory required for storing weights of middle-order ngrams.
  * Both backoff and probability should be stored
  */
-uint8 lm_trie_quant_msize(lm_trie_quant_t * quant);
+uint8 lm_trie_quant_msize(lm_trie_quant_t * quant, int order_minus_2);
 
 /**
  * Memory required for storing weights of largest-order ngrams.
@@ -0,0 +1,278 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+/* ====================================================================
+ * Copyright (c) 2015 Carnegie Mellon University.  All rights
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/**
+ * @file ngram_boost.c Boost lists applied to N-Gram scores at query time.
+ *
+ * A boost list is a small trie over reversed N-Grams: the root's
+ * children are final words, and each level below adds one more word
+ * of history.  Edges live in a single open-addressed hash table keyed
+ * on (parent node, word ID), so a lookup costs one probe per matched
+ * word and the base model is never touched.
+ */
+
+#include <string.h>
+
+#include "sphinxbase/err.h"
+#include "sphinxbase/ckd_alloc.h"
+
+#include "ngram_model_internal.h"
+
+typedef struct boost_node_s {
+    int32 delta;     /**< Log-probability adjustment for this N-Gram */
+    int32 boosted;   /**< Was this N-Gram added (or is it only a prefix)? */
+} boost_node_t;
+
+typedef struct boost_edge_s {
+    int32 parent;    /**< Parent node, or -1 for an empty slot */
+    int32 wid;       /**< Word ID labeling this edge */
+    int32 child;     /**< Child node */
+} boost_edge_t;
+
+struct ngram_boost_s {
+    int refcount;
+    logmath_t *lmath;        /**< Log-math used for weights */
+    ngram_model_t *model;    /**< Model used for word lookup (not retained) */
+    boost_node_t *nodes;     /**< Trie nodes, the root is node 0 */
+    int32 n_nodes;
+    int32 n_nodes_alloc;
+    boost_edge_t *edges;     /**< Edge hash table (power of 2 size) */
+    int32 n_edges_alloc;
+};
+
+#define BOOST_INIT_EDGES 64
+
+static uint32
+boost_hash(int32 parent, int32 wid)
+{
+    uint32 h = (uint32) parent * 0x9e3779b1U ^ (uint32) wid;
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    return h;
+}
+
+static int32
+boost_child(ngram_boost_t *boost, int32 parent, int32 wid)
+{
+    uint32 mask = boost->n_edges_alloc - 1;
+    uint32 i = boost_hash(parent, wid) & mask;
+
+    while (boost->edges[i].parent != -1) {
+        if (boost->edges[i].parent == parent && boost->edges[i].wid == wid)
+            return boost->edges[i].child;
+        i = (i + 1) & mask;
+    }
+    return -1;
+}
+
+static void
+boost_insert_edge(boost_edge_t *edges, int32 n_alloc,
+                  int32 parent, int32 wid, int32 child)
+{
+    uint32 mask = n_alloc - 1;
+    uint32 i = boost_hash(parent, wid) & mask;
+
+    while (edges[i].parent != -1)
+        i = (i + 1) & mask;
+    edges[i].parent = parent;
+    edges[i].wid = wid;
+    edges[i].child = child;
+}
+
+static boost_edge_t *
+boost_alloc_edges(int32 n_alloc)
+{
+    boost_edge_t *edges;
+    int32 i;
+
+    edges = ckd_calloc(n_alloc, sizeof(*edges));
+    for (i = 0; i < n_alloc; ++i)
+        edges[i].parent = -1;
+    return edges;
+}
+
+static int32
+boost_add_child(ngram_boost_t *boost, int32 parent, int32 wid)
+{
+    int32 child;
+
+    /* Keep the edge table at most half full. */
+    if (boost->n_nodes * 2 >= boost->n_edges_alloc) {
+        boost_edge_t *edges;
+        int32 n_alloc, i;
+
+        n_alloc = boost->n_edges_alloc * 2;
+        edges = boost_alloc_edges(n_alloc);
+        for (i = 0; i < boost->n_edges_alloc; ++i) {
+            if (boost->edges[i].parent != -1)
+                boost_insert_edge(edges, n_alloc, boost->edges[i].parent,
+                                  boost->edges[i].wid,
+                                  boost->edges[i].child);
+        }
+        ckd_free(boost->edges);
+        boost->edges = edges;
+        boost->n_edges_alloc = n_alloc;
+    }
+    if (boost->n_nodes == boost->n_nodes_alloc) {
+        boost->n_nodes_alloc *= 2;
+        boost->nodes = ckd_realloc(boost->nodes,
+                                   boost->n_nodes_alloc
+                                   * sizeof(*boost->nodes));
+    }
+    child = boost->n_nodes++;
+    boost->nodes[child].delta = 0;
+    boost->nodes[child].boosted = FALSE;
+    boost_insert_edge(boost->edges, boost->n_edges_alloc,
+                      parent, wid, child);
+    return child;
+}
+
+ngram_boost_t *
+ngram_boost_init(ngram_model_t *model)
+{
+    ngram_boost_t *boost;
+
+    boost = ckd_calloc(1, sizeof(*boost));
+    boost->refcount = 1;
+    boost->lmath = logmath_retain(model->lmath);
+    boost->model = model;
+    boost->n_nodes_alloc = BOOST_INIT_EDGES / 2;
+    boost->nodes = ckd_calloc(boost->n_nodes_alloc, sizeof(*boost->nodes));
+    boost->n_nodes = 1;
+    boost->n_edges_alloc = BOOST_INIT_EDGES;
+    boost->edges = boost_alloc_edges(boost->n_edges_alloc);
+    return boost;
+}
+
+ngram_boost_t *
+ngram_boost_retain(ngram_boost_t *boost)
+{
+    ++boost->refcount;
+    return boost;
+}
+
+int
+ngram_boost_free(ngram_boost_t *boost)
+{
+    if (boost == NULL)
+        return 0;
+    if (--boost->refcount > 0)
+        return boost->refcount;
+    logmath_free(boost->lmath);
+    ckd_free(boost->nodes);
+    ckd_free(boost->edges);
+    ckd_free(boost);
+    return 0;
+}
+
+int
+ngram_boost_add(ngram_boost_t *boost, const char *const *words,
+                int32 n, float32 weight)
+{
+    ngram_model_t *model = boost->model;
+    int32 wids[NGRAM_MAX_ORDER];
+    int32 i, node;
+
+    if (n < 1 || n > NGRAM_MAX_ORDER) {
+        E_ERROR("Cannot boost a %d-gram\n", n);
+        return -1;
+    }
+    if (weight <= 0) {
+        E_ERROR("Boost weight must be positive, got %f\n", weight);
+        return -1;
+    }
+    for (i = 0; i < n; ++i) {
+        /* Don't map unknown words to <UNK> as ngram_wid() would. */
+        if (hash_table_lookup_int32(model->wid, words[i], &wids[i]) < 0) {
+            E_ERROR("Unknown word '%s' in boost list\n", words[i]);
+            return -1;
+        }
+        /* History is matched after declassification. */
+        if (i < n - 1 && NGRAM_IS_CLASSWID(wids[i]))
+            wids[i] = model->classes[NGRAM_CLASSID(wids[i])]->tag_wid;
+    }
+
+    /* Walk from the final word back through its history. */
+    node = 0;
+    for (i = n - 1; i >= 0; --i) {
+        int32 child = boost_child(boost, node, wids[i]);
+        if (child == -1)
+            child = boost_add_child(boost, node, wids[i]);
+        node = child;
+    }
+    boost->nodes[node].delta = logmath_log(boost->lmath, weight);
+    boost->nodes[node].boosted = TRUE;
+    return 0;
+}
+
+int32
+ngram_boost_delta(ngram_boost_t *boost, int32 wid,
+                  const int32 *history, int32 n_hist)
+{
+    int32 i, node, delta;
+
+    if ((node = boost_child(boost, 0, wid)) == -1)
+        return 0;
+    delta = boost->nodes[node].boosted ? boost->nodes[node].delta : 0;
+    for (i = 0; i < n_hist; ++i) {
+        if (history[i] == NGRAM_INVALID_WID)
+            break;
+        if ((node = boost_child(boost, node, history[i])) == -1)
+            break;
+        if (boost->nodes[node].boosted)
+            delta = boost->nodes[node].delta;
+    }
+    return delta;
+}
+
+int
+ngram_model_boost(ngram_model_t *model, ngram_boost_t *boost)
+{
+    if (boost && (logmath_get_base(boost->lmath)
+                  != logmath_get_base(model->lmath)
+                  || logmath_get_shift(boost->lmath)
+                  != logmath_get_shift(model->lmath))) {
+        E_ERROR("Boost list log-math parameters do not match the model\n");
+        return -1;
+    }
+    if (boost)
+        ngram_boost_retain(boost);
+    ngram_boost_free(model->boost);
+    model->boost = boost;
+    ngram_model_flush(model);
+    return 0;
+}
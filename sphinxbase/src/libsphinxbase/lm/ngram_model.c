@@ -143,8 +143,10 @@ ngram_model_read(cmd_ln_t * config,
             return NULL;
         }
     case NGRAM_ARPA:
-        model = ngram_model_trie_read_arpa(config, file_name, lmath);
-        break;
+        if ((model =
+             ngram_model_trie_read_arpa(config, file_name, lmath)) != NULL)
+            break;
+        return NULL;
     case NGRAM_BIN:
         if ((model =
              ngram_model_trie_read_bin(config, file_name, lmath)) != NULL)
@@ -157,6 +159,8 @@ ngram_model_read(cmd_ln_t * config,
         E_ERROR("language model file type not supported\n");
         return NULL;
     }
+    /* The vocabulary is static from here on, save for added words. */
+    hash_table_freeze(model->wid);
 
     /* Now set weights based on config if present. */
     if (config) {
@@ -252,6 +256,39 @@ ngram_model_retain(ngram_model_t * model)
     return model;
 }
 
+ngram_model_t *
+ngram_model_clone(ngram_model_t * model)
+{
+    ngram_model_t *clone;
+
+    /* Clones of clones share the original directly. */
+    if (model->shared)
+        model = model->shared;
+    if (model->funcs == NULL || model->funcs->clone == NULL) {
+        E_ERROR("This language model type cannot be cloned\n");
+        return NULL;
+    }
+    if ((clone = (*model->funcs->clone) (model)) == NULL)
+        return NULL;
+    clone->refcount = 1;
+    clone->n_clones = 0;
+    clone->shared = ngram_model_retain(model);
+    ++model->n_clones;
+    if (clone->boost)
+        ngram_boost_retain(clone->boost);
+    return clone;
+}
+
+int
+ngram_model_check_mutable(ngram_model_t * model, char const *what)
+{
+    if (model->shared || model->n_clones) {
+        E_ERROR("Cannot %s in a language model shared by clones\n", what);
+        return -1;
+    }
+    return 0;
+}
+
 void
 ngram_model_flush(ngram_model_t * model)
 {
@@ -270,6 +307,14 @@ ngram_model_free(ngram_model_t * model)
         return model->refcount;
     if (model->funcs && model->funcs->free)
         (*model->funcs->free) (model);
+    ngram_boost_free(model->boost);
+    if (model->shared) {
+        /* Everything else belongs to the original. */
+        --model->shared->n_clones;
+        ngram_model_free(model->shared);
+        ckd_free(model);
+        return 0;
+    }
     if (model->writable) {
         /* Free all words. */
         for (i = 0; i < model->n_words; ++i) {
@@ -304,12 +349,47 @@ ngram_model_free(ngram_model_t * model)
     return 0;
 }
 
+size_t
+ngram_model_mem_size(ngram_model_t * model, size_t * out_shared,
+                     size_t * out_mapped)
+{
+    ngram_model_t *base;
+    size_t heap, shared, mapped, words;
+    int32 i;
+
+    heap = sizeof(*model);
+    shared = mapped = 0;
+    if (model->funcs && model->funcs->mem_size)
+        heap += (*model->funcs->mem_size) (model, &shared, &mapped);
+
+    /* The vocabulary belongs to the original. */
+    base = model->shared ? model->shared : model;
+    words = base->n_1g_alloc * sizeof(*base->word_str)
+        + base->n * sizeof(*base->n_counts)
+        + hash_table_mem_size(base->wid);
+    for (i = 0; i < base->n_words; ++i)
+        if (base->word_str[i])
+            words += strlen(base->word_str[i]) + 1;
+    if (model->shared || model->n_clones)
+        shared += words;
+    else
+        heap += words;
+
+    if (out_shared)
+        *out_shared = shared;
+    if (out_mapped)
+        *out_mapped = mapped;
+    return heap;
+}
+
 int
 ngram_model_casefold(ngram_model_t * model, int kase)
 {
     int writable, i;
     hash_table_t *new_wid;
 
+    if (ngram_model_check_mutable(model, "case-fold words") < 0)
+        return -1;
     /* Were word strings already allocated? */
     writable = model->writable;
     /* Either way, we are going to allocate some word strings. */
@@ -353,6 +433,7 @@ ngram_model_casefold(ngram_model_t * model, int kase)
     /* Swap out the hash table. */
     hash_table_free(model->wid);
     model->wid = new_wid;
+    hash_table_freeze(model->wid);
     return 0;
 }
 
@@ -375,14 +456,23 @@ int32
 ngram_ng_score(ngram_model_t * model, int32 wid, int32 * history,
                int32 n_hist, int32 * n_used)
 {
-    int32 score, class_weight = 0;
+    int32 score, class_weight = 0, boost = 0;
     int i;
 
     /* Closed vocabulary, OOV word probability is zero */
     if (wid == NGRAM_INVALID_WID)
         return model->log_zero;
 
-    /* "Declassify" wid and history */
+    /* "Declassify" history */
+    for (i = 0; i < n_hist; ++i) {
+        if (history[i] != NGRAM_INVALID_WID
+            && NGRAM_IS_CLASSWID(history[i]))
+            history[i] =
+                model->classes[NGRAM_CLASSID(history[i])]->tag_wid;
+    }
+    if (model->boost)
+        boost = ngram_boost_delta(model->boost, wid, history, n_hist);
+    /* "Declassify" wid */
     if (NGRAM_IS_CLASSWID(wid)) {
         ngram_class_t *lmclass = model->classes[NGRAM_CLASSID(wid)];
 
@@ -391,13 +481,9 @@ ngram_ng_score(ngram_model_t * model, int32 wid, int32 * history,
             return model->log_zero;
         wid = lmclass->tag_wid;
     }
-    for (i = 0; i < n_hist; ++i) {
-        if (history[i] != NGRAM_INVALID_WID
-            && NGRAM_IS_CLASSWID(history[i]))
-            history[i] =
-                model->classes[NGRAM_CLASSID(history[i])]->tag_wid;
-    }
     score = (*model->funcs->score) (model, wid, history, n_hist, n_used);
+    if (boost)
+        score += (int32) (boost * model->lw);
 
     /* Multiply by unigram in-class weight. */
     return score + class_weight;
@@ -450,18 +536,109 @@ ngram_bg_score(ngram_model_t * model, int32 w2, int32 w1, int32 * n_used)
     return ngram_ng_score(model, w2, &w1, 1, n_used);
 }
 
+void
+ngram_state_init(ngram_model_t * model, ngram_state_t * state,
+                 int32 const *history, int32 n_hist)
+{
+    ngram_state_t prev;
+    int32 n_used;
+
+    for (n_used = 0; n_used < n_hist; ++n_used)
+        if (history[n_used] == NGRAM_INVALID_WID)
+            break;
+    n_hist = n_used;
+    state->n_hist = 0;
+    /* Extend the empty state by each word in turn, oldest first. */
+    while (n_hist-- > 0) {
+        prev = *state;
+        ngram_state_score(model, &prev, history[n_hist], state, &n_used);
+    }
+}
+
+int32
+ngram_state_score_hist(ngram_model_t * model, ngram_state_t const *in,
+                       int32 wid, ngram_state_t * out, int32 * n_used)
+{
+    int32 hist[NGRAM_STATE_MAX_HIST];
+    int32 i;
+
+    memcpy(hist, in->hist, in->n_hist * sizeof(*hist));
+    out->hist[0] = wid;
+    out->backoff[0] = 0;
+    for (i = 0; i < in->n_hist && i + 1 < model->n - 1; ++i) {
+        out->hist[i + 1] = in->hist[i];
+        out->backoff[i + 1] = 0;
+    }
+    out->n_hist = (model->n > 1) ? i + 1 : 0;
+    return (*model->funcs->score) (model, wid, hist, in->n_hist, n_used);
+}
+
+int32
+ngram_state_score(ngram_model_t * model, ngram_state_t const *in,
+                  int32 wid, ngram_state_t * out, int32 * n_used)
+{
+    ngram_state_t tmp;
+    int32 score, class_weight = 0, boost = 0;
+
+    if (out == NULL)
+        out = &tmp;
+    /* Closed vocabulary, OOV word probability is zero */
+    if (wid == NGRAM_INVALID_WID) {
+        out->n_hist = 0;
+        return model->log_zero;
+    }
+    if (model->boost)
+        boost = ngram_boost_delta(model->boost, wid, in->hist, in->n_hist);
+    /* History words in states are already declassified. */
+    if (NGRAM_IS_CLASSWID(wid)) {
+        ngram_class_t *lmclass = model->classes[NGRAM_CLASSID(wid)];
+
+        class_weight = ngram_class_prob(lmclass, wid);
+        if (class_weight == 1) {
+            out->n_hist = 0;
+            return model->log_zero;
+        }
+        wid = lmclass->tag_wid;
+    }
+    if (model->funcs->state_score)
+        score = (*model->funcs->state_score) (model, in, wid, out, n_used);
+    else
+        score = ngram_state_score_hist(model, in, wid, out, n_used);
+    if (boost)
+        score += (int32) (boost * model->lw);
+
+    /* Multiply by unigram in-class weight. */
+    return score + class_weight;
+}
+
+int
+ngram_state_equal(ngram_state_t const *a, ngram_state_t const *b)
+{
+    return a->n_hist == b->n_hist
+        && memcmp(a->hist, b->hist, a->n_hist * sizeof(*a->hist)) == 0;
+}
+
 int32
 ngram_ng_prob(ngram_model_t * model, int32 wid, int32 * history,
               int32 n_hist, int32 * n_used)
 {
-    int32 prob, class_weight = 0;
+    int32 prob, class_weight = 0, boost = 0;
     int i;
 
     /* Closed vocabulary, OOV word probability is zero */
     if (wid == NGRAM_INVALID_WID)
         return model->log_zero;
 
-    /* "Declassify" wid and history */
+    /* "Declassify" history */
+    for (i = 0; i < n_hist; ++i) {
+        if (history[i] != NGRAM_INVALID_WID
+            && NGRAM_IS_CLASSWID(history[i]))
+            history[i] =
+                model->classes[NGRAM_CLASSID(history[i])]->tag_wid;
+    }
+    if (model->boost)
+        boost = ngram_boost_delta(model->boost, wid, history, n_hist);
+    /* "Declassify" wid */
     if (NGRAM_IS_CLASSWID(wid)) {
         ngram_class_t *lmclass = model->classes[NGRAM_CLASSID(wid)];
 
@@ -470,14 +647,9 @@ ngram_ng_prob(ngram_model_t * model, int32 wid, int32 * history,
             return class_weight;
         wid = lmclass->tag_wid;
     }
-    for (i = 0; i < n_hist; ++i) {
-        if (history[i] != NGRAM_INVALID_WID
-            && NGRAM_IS_CLASSWID(history[i]))
-            history[i] =
-                model->classes[NGRAM_CLASSID(history[i])]->tag_wid;
-    }
     prob = (*model->funcs->raw_score) (model, wid, history,
                                        n_hist, n_used);
+    prob += boost;
     /* Multiply by unigram in-class weight. */
     return prob + class_weight;
 }
@@ -612,6 +784,8 @@ ngram_add_word_internal(ngram_model_t * model,
 
     /* Check for hash collisions. */
     int32 wid;
+    if (ngram_model_check_mutable(model, "add words") < 0)
+        return NGRAM_INVALID_WID;
     if (hash_table_lookup_int32(model->wid, word, &wid) == 0) {
         E_WARN("Omit duplicate word '%s'\n", word);
         return wid;
@@ -73,6 +73,9 @@ struct ngram_model_s {
     int32 *tmp_wids;    /**< Temporary array of word IDs for ngram_model_get_ngram() */
     struct ngram_class_s **classes; /**< Word class definitions. */
     struct ngram_funcs_s *funcs;   /**< Implementation-specific methods. */
+    struct ngram_boost_s *boost;   /**< Boost list applied to scores, or NULL. */
+    ngram_model_t *shared; /**< Model this is a clone of, or NULL. */
+    int32 n_clones;     /**< Number of clones sharing this model. */
 };
 
 /**
@@ -96,6 +99,9 @@ struct ngram_class_s {
 };
 
 #define NGRAM_MAX_ORDER 5
+#if NGRAM_MAX_ORDER - 1 > NGRAM_STATE_MAX_HIST
+#error NGRAM_STATE_MAX_HIST is too small for NGRAM_MAX_ORDER
+#endif
 
 #define NGRAM_HASH_SIZE 128
 
@@ -146,6 +152,37 @@ typedef struct ngram_funcs_s {
      * Implementation-specific function for purging N-Gram cache
      */
     void (*flush) (ngram_model_t * model);
+
+    /**
+     * Implementation-specific function for scoring a word following
+     * a state (optional).  The word is never a class word, and out
+     * is never NULL.  Models without it are scored with
+     * ngram_state_score_hist().
+     */
+     int32(*state_score) (ngram_model_t * model,
+                          ngram_state_t const *in, int32 wid,
+                          ngram_state_t * out, int32 * n_used);
+
+    /**
+     * Implementation-specific function for cloning a model (optional).
+     *
+     * This allocates a copy of the implementation structure sharing
+     * all read-only data with the model, with its own caches.  The
+     * base fields are fixed up by ngram_model_clone().  The free
+     * function must not free shared data when base->shared is set.
+     */
+    ngram_model_t *(*clone) (ngram_model_t * model);
+
+    /**
+     * Implementation-specific function for counting memory (optional).
+     *
+     * This adds heap memory shared with clones to *out_shared and
+     * memory-mapped files to *out_mapped, and returns the heap
+     * memory used only by this model, not including the base fields
+     * counted by ngram_model_mem_size().
+     */
+    size_t (*mem_size) (ngram_model_t * model,
+                        size_t * out_shared, size_t * out_mapped);
 } ngram_funcs_t;
 
 /**
@@ -165,6 +202,19 @@ ngram_model_init(ngram_model_t * model,
                  ngram_funcs_t * funcs,
                  logmath_t * lmath, int32 n, int32 n_unigram);
 
+/**
+ * Score a word following a state using only the history words in it.
+ */
+/**
+ * Check that the vocabulary of a model may be changed, that is, it
+ * neither is nor has clones.
+ */
+int ngram_model_check_mutable(ngram_model_t * model, char const *what);
+
+int32 ngram_state_score_hist(ngram_model_t * model,
+                             ngram_state_t const *in, int32 wid,
+                             ngram_state_t * out, int32 * n_used);
+
 /**
  * Read a probdef file.
  */
@@ -194,4 +244,13 @@ void ngram_class_free(ngram_class_t * lmclass);
  */
 int32 ngram_class_prob(ngram_class_t * lmclass, int32 wid);
 
+/**
+ * Get the log-probability adjustment from a boost list.
+ *
+ * @param history Declassified history, most recent first.
+ * @return Adjustment for the longest matching boosted N-Gram, or 0.
+ */
+int32 ngram_boost_delta(struct ngram_boost_s *boost, int32 wid,
+                        const int32 *history, int32 n_hist);
+
 #endif                          /* __NGRAM_MODEL_INTERNAL_H__ */
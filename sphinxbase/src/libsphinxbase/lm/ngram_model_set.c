@@ -63,6 +63,52 @@ my_compare(const void *a, const void *b)
         return strcmp(*(char *const *) a, *(char *const *) b);
 }
 
+/* (Re)allocate and empty the score caches, for instance when the
+ * models or their weights change. */
+static void
+reset_cache(ngram_model_set_t * set)
+{
+    ckd_free_2d((void **) set->cache);
+    set->cache = NULL;
+    if (set->n_models == 0)
+        return;
+    set->cache = (ngram_set_cache_t **)
+        ckd_calloc_2d(set->n_models, NGRAM_SET_CACHE_SIZE,
+                      sizeof(**set->cache));
+    memset(set->cache[0], 0xff, set->n_models * NGRAM_SET_CACHE_SIZE
+           * sizeof(**set->cache));
+    set->scores = ckd_realloc(set->scores,
+                              set->n_models * sizeof(*set->scores));
+}
+
+/* Score of mapped IDs in submodel i, from the cache if possible. */
+static int32
+cached_score(ngram_model_set_t * set, int32 i, int32 wid,
+             int32 * history, int32 n_hist, int32 * n_used)
+{
+    ngram_set_cache_t *ent;
+    uint32 h;
+    int32 j;
+
+    h = (uint32) wid;
+    for (j = 0; j < n_hist; ++j)
+        h = h * 31 + (uint32) history[j];
+    h = (h * 2654435761U) >> 16;
+    ent = &set->cache[i][h & (NGRAM_SET_CACHE_SIZE - 1)];
+    if (ent->wid == wid && ent->n_hist == n_hist
+        && 0 == memcmp(ent->hist, history, n_hist * sizeof(*history))) {
+        *n_used = ent->n_used;
+        return ent->score;
+    }
+    ent->score = ngram_ng_score(set->lms[i], wid, history, n_hist,
+                                &ent->n_used);
+    ent->wid = wid;
+    ent->n_hist = n_hist;
+    memcpy(ent->hist, history, n_hist * sizeof(*history));
+    *n_used = ent->n_used;
+    return ent->score;
+}
+
 static void
 build_widmap(ngram_model_t * base, logmath_t * lmath, int32 n)
 {
@@ -118,6 +164,7 @@ build_widmap(ngram_model_t * base, logmath_t * lmath, int32 n)
         /* printf("\n"); */
     }
     hash_table_free(vocab);
+    hash_table_freeze(base->wid);
 }
 
 ngram_model_t *
@@ -178,6 +225,7 @@ ngram_model_set_init(cmd_ln_t * config,
 
     /* Now build the word-ID mapping and merged vocabulary. */
     build_widmap(base, lmath, n);
+    reset_cache(model);
     return base;
 }
 
@@ -529,6 +577,8 @@ ngram_model_set_add(ngram_model_t * base,
     float32 fprob;
     int32 scale, i;
 
+    if (ngram_model_check_mutable(base, "add models") < 0)
+        return NULL;
     /* Add it to the array of lms. */
     ++set->n_models;
     set->lms = ckd_realloc(set->lms, set->n_models * sizeof(*set->lms));
@@ -576,6 +626,7 @@ ngram_model_set_add(ngram_model_t * base,
     else {
         build_widmap(base, base->lmath, base->n);
     }
+    reset_cache(set);
     return model;
 }
 
@@ -588,6 +639,8 @@ ngram_model_set_remove(ngram_model_t * base,
     int32 lmidx, scale, n, i;
     float32 fprob;
 
+    if (ngram_model_check_mutable(base, "remove models") < 0)
+        return NULL;
     for (lmidx = 0; lmidx < set->n_models; ++lmidx)
         if (0 == strcmp(name, set->names[lmidx]))
             break;
@@ -632,6 +685,7 @@ ngram_model_set_remove(ngram_model_t * base,
     else {
         build_widmap(base, base->lmath, n);
     }
+    reset_cache(set);
     return submodel;
 }
 
@@ -642,6 +696,8 @@ ngram_model_set_map_words(ngram_model_t * base,
     ngram_model_set_t *set = (ngram_model_set_t *) base;
     int32 i;
 
+    if (ngram_model_check_mutable(base, "map words") < 0)
+        return;
     /* Recreate the word mapping. */
     if (base->writable) {
         for (i = 0; i < base->n_words; ++i) {
@@ -665,6 +721,7 @@ ngram_model_set_map_words(ngram_model_t * base,
             set->widmap[i][j] = ngram_wid(set->lms[j], base->word_str[i]);
         }
     }
+    hash_table_freeze(base->wid);
 }
 
 static int
@@ -677,9 +734,21 @@ ngram_model_set_apply_weights(ngram_model_t * base, float32 lw,
     /* Apply weights to each sub-model. */
     for (i = 0; i < set->n_models; ++i)
         ngram_model_apply_weights(set->lms[i], lw, wip);
+    reset_cache(set);
     return 0;
 }
 
+static void
+ngram_model_set_flush(ngram_model_t * base)
+{
+    ngram_model_set_t *set = (ngram_model_set_t *) base;
+    int32 i;
+
+    for (i = 0; i < set->n_models; ++i)
+        ngram_model_flush(set->lms[i]);
+    reset_cache(set);
+}
+
 static int32
 ngram_model_set_score(ngram_model_t * base, int32 wid,
                       int32 * history, int32 n_hist, int32 * n_used)
@@ -695,7 +764,7 @@ ngram_model_set_score(ngram_model_t * base, int32 wid,
 
     /* Interpolate if there is no current. */
     if (set->cur == -1) {
-        score = base->log_zero;
+        /* Score each model, then combine them all at once. */
         for (i = 0; i < set->n_models; ++i) {
             int32 j;
             /* Map word and history IDs for each model. */
@@ -706,12 +775,11 @@ ngram_model_set_score(ngram_model_t * base, int32 wid,
                 else
                     set->maphist[j] = set->widmap[history[j]][i];
             }
-            score = logmath_add(base->lmath, score,
-                                set->lweights[i] +
-                                ngram_ng_score(set->lms[i],
-                                               mapwid, set->maphist,
-                                               n_hist, n_used));
+            set->scores[i] = set->lweights[i] +
+                cached_score(set, i, mapwid, set->maphist,
+                             n_hist, n_used);
         }
+        score = logmath_add_n(base->lmath, set->scores, set->n_models);
     }
     else {
         int32 j;
@@ -723,13 +791,56 @@ ngram_model_set_score(ngram_model_t * base, int32 wid,
             else
                 set->maphist[j] = set->widmap[history[j]][set->cur];
         }
-        score = ngram_ng_score(set->lms[set->cur],
-                               mapwid, set->maphist, n_hist, n_used);
+        score = cached_score(set, set->cur,
+                             mapwid, set->maphist, n_hist, n_used);
     }
 
     return score;
 }
 
+static int32
+ngram_model_set_state_score(ngram_model_t * base, ngram_state_t const *in,
+                            int32 wid, ngram_state_t * out, int32 * n_used)
+{
+    ngram_model_set_t *set = (ngram_model_set_t *) base;
+    ngram_model_t *lm;
+    ngram_state_t mapin, mapout;
+    int32 score;
+    int32 j;
+
+    /* Interpolated scores depend on the whole history. */
+    if (set->cur == -1)
+        return ngram_state_score_hist(base, in, wid, out, n_used);
+
+    /* Map history IDs, which the current model's states keep
+     * declassified. */
+    lm = set->lms[set->cur];
+    for (j = 0; j < in->n_hist && j < base->n - 1; ++j) {
+        int32 mapwid = set->widmap[in->hist[j]][set->cur];
+        if (mapwid == NGRAM_INVALID_WID)
+            break;
+        if (NGRAM_IS_CLASSWID(mapwid))
+            mapwid = lm->classes[NGRAM_CLASSID(mapwid)]->tag_wid;
+        mapin.hist[j] = mapwid;
+        mapin.backoff[j] = in->backoff[j];
+    }
+    mapin.n_hist = j;
+    score = ngram_state_score(lm, &mapin, set->widmap[wid][set->cur],
+                              &mapout, n_used);
+
+    /* The new state is the word followed by some of the old one. */
+    out->n_hist = mapout.n_hist;
+    if (out->n_hist > 0) {
+        out->hist[0] = wid;
+        out->backoff[0] = mapout.backoff[0];
+    }
+    for (j = 1; j < out->n_hist; ++j) {
+        out->hist[j] = in->hist[j - 1];
+        out->backoff[j] = mapout.backoff[j];
+    }
+    return score;
+}
+
 static int32
 ngram_model_set_raw_score(ngram_model_t * base, int32 wid,
                           int32 * history, int32 n_hist, int32 * n_used)
@@ -837,6 +948,8 @@ ngram_model_set_add_ug(ngram_model_t * base, int32 wid, int32 lweight)
         set->widmap[i] = set->widmap[0] + i * set->n_models;
     memcpy(set->widmap[wid], newwid, set->n_models * sizeof(*newwid));
     ckd_free(newwid);
+    /* Submodels may have renormalized their unigrams. */
+    reset_cache(set);
     return prob;
 }
 
@@ -854,7 +967,75 @@ ngram_model_set_free(ngram_model_t * base)
     ckd_free(set->names);
     ckd_free(set->lweights);
     ckd_free(set->maphist);
-    ckd_free_2d((void **) set->widmap);
+    if (base->shared == NULL)
+        ckd_free_2d((void **) set->widmap);
+    ckd_free_2d((void **) set->cache);
+    ckd_free(set->scores);
+}
+
+static ngram_model_t *
+ngram_model_set_clone(ngram_model_t * base)
+{
+    ngram_model_set_t *set = (ngram_model_set_t *) base;
+    ngram_model_set_t *clone;
+    int32 i;
+
+    /* Submodels have caches of their own, so clone them first. */
+    clone = ckd_calloc(1, sizeof(*clone));
+    clone->lms = ckd_calloc(set->n_models, sizeof(*clone->lms));
+    for (i = 0; i < set->n_models; ++i) {
+        if ((clone->lms[i] = ngram_model_clone(set->lms[i])) == NULL) {
+            while (--i >= 0)
+                ngram_model_free(clone->lms[i]);
+            ckd_free(clone->lms);
+            ckd_free(clone);
+            return NULL;
+        }
+    }
+    clone->base = set->base;
+    clone->n_models = set->n_models;
+    clone->cur = set->cur;
+    clone->names = ckd_calloc(set->n_models, sizeof(*clone->names));
+    for (i = 0; i < set->n_models; ++i)
+        clone->names[i] = ckd_salloc(set->names[i]);
+    clone->lweights = ckd_malloc(set->n_models * sizeof(*clone->lweights));
+    memcpy(clone->lweights, set->lweights,
+           set->n_models * sizeof(*clone->lweights));
+    /* The word ID mapping is shared with the original. */
+    clone->widmap = set->widmap;
+    clone->maphist = ckd_calloc(base->n - 1, sizeof(*clone->maphist));
+    reset_cache(clone);
+    return &clone->base;
+}
+
+static size_t
+ngram_model_set_mem_size(ngram_model_t * base, size_t * out_shared,
+                         size_t * out_mapped)
+{
+    ngram_model_set_t *set = (ngram_model_set_t *) base;
+    size_t heap, widmap, shared, mapped;
+    int32 i;
+
+    heap = sizeof(*set) - sizeof(*base)
+        + set->n_models * (sizeof(*set->lms) + sizeof(*set->names)
+                           + sizeof(*set->lweights))
+        + (base->n - 1) * sizeof(*set->maphist)
+        + set->n_models * sizeof(*set->scores)
+        + set->n_models * NGRAM_SET_CACHE_SIZE * sizeof(**set->cache);
+    for (i = 0; i < set->n_models; ++i) {
+        heap += ngram_model_mem_size(set->lms[i], &shared, &mapped);
+        heap += strlen(set->names[i]) + 1;
+        *out_shared += shared;
+        *out_mapped += mapped;
+    }
+    /* The word ID mapping is shared with clones. */
+    widmap = (size_t) base->n_words * set->n_models * sizeof(**set->widmap)
+        + base->n_words * sizeof(*set->widmap);
+    if (base->shared || base->n_clones)
+        *out_shared += widmap;
+    else
+        heap += widmap;
+    return heap;
 }
 
 static ngram_funcs_t ngram_model_set_funcs = {
@@ -863,4 +1044,8 @@ static ngram_funcs_t ngram_model_set_funcs = {
     ngram_model_set_score,      /* score */
     ngram_model_set_raw_score,  /* raw_score */
     ngram_model_set_add_ug,     /* add_ug */
+    ngram_model_set_flush,      /* flush */
+    ngram_model_set_state_score, /* state_score */
+    ngram_model_set_clone,      /* clone */
+    ngram_model_set_mem_size    /* mem_size */
 };
@@ -44,6 +44,24 @@
 
 #include "ngram_model_internal.h"
 
+/**
+ * Number of entries in the score cache for each model in a set (a
+ * power of two).
+ */
+#define NGRAM_SET_CACHE_SIZE 512
+
+/**
+ * Entry in a direct-mapped cache of a submodel's scores, keyed on the
+ * word and history IDs in that submodel.
+ */
+typedef struct ngram_set_cache_s {
+    int32 wid;           /**< Word ID. */
+    int32 n_hist;        /**< Length of history, or -1 if empty. */
+    int32 hist[NGRAM_MAX_ORDER - 1]; /**< History IDs. */
+    int32 score;         /**< Score from ngram_ng_score(). */
+    int32 n_used;        /**< N-Gram order used for it. */
+} ngram_set_cache_t;
+
 /**
  * Subclass of ngram_model for grouping language models.
  */
@@ -57,6 +75,8 @@ typedef struct ngram_model_set_s {
     int32 *lweights;     /**< Log interpolation weights. */
     int32 **widmap;      /**< Word ID mapping for submodels. */
     int32 *maphist;      /**< Word ID mapping for N-Gram history. */
+    ngram_set_cache_t **cache; /**< Score cache for each model. */
+    int32 *scores;       /**< Weighted scores of each model for a query. */
 } ngram_model_set_t;
 
 /**
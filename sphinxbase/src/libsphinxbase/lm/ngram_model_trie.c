@@ -43,13 +43,79 @@
 #include <sphinxbase/strfuncs.h>
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/byteorder.h>
+#include <sphinxbase/mmio.h>
 
 #include "ngram_model_trie.h"
 
 static const char trie_hdr[] = "Trie Language Model";
+/* Same length as trie_hdr, followed by a byte order marker and with
+ * every section aligned so that the file can be used in place. */
+static const char trie_hdr_aligned[] = "Aligned Trie LM 1.0";
+#define TRIE_BYTE_ORDER 0x11223344
 static const char dmp_hdr[] = "Darpa Trigram LM";
 static ngram_funcs_t ngram_model_trie_funcs;
 
+/* Make room for n added words, filling new ones with zero probability. */
+static void
+trie_grow_added(ngram_model_trie_t * model, uint32 n)
+{
+    if (n > model->n_added_alloc) {
+        uint32 alloc = model->n_added_alloc ? model->n_added_alloc : 16;
+
+        while (alloc < n)
+            alloc *= 2;
+        model->added = (float *) ckd_realloc(model->added,
+                                             alloc * sizeof(*model->added));
+        model->n_added_alloc = alloc;
+    }
+    for (; model->n_added < n; model->n_added++)
+        model->added[model->n_added] = (float) model->base.log_zero;
+}
+
+/* Add Bloom filters to a loaded model if requested in config. */
+static void
+trie_bloom(cmd_ln_t * config, ngram_model_trie_t * model)
+{
+    if (model->base.n > 1 && config
+        && cmd_ln_exists_r(config, "-lmbloom")
+        && cmd_ln_boolean_r(config, "-lmbloom"))
+        lm_trie_build_bloom(model->trie, model->base.n_counts,
+                            model->base.n);
+}
+
+/* Move added words into the trie, so that it can be written. */
+static void
+trie_merge_added(ngram_model_trie_t * model)
+{
+    uint32 n_ug = model->base.n_counts[0];
+
+    if (n_ug <= model->n_trie_ug)
+        return;
+    trie_grow_added(model, n_ug - model->n_trie_ug);
+    lm_trie_append_ug(model->trie, model->n_trie_ug, model->added,
+                      n_ug - model->n_trie_ug);
+    model->n_trie_ug = n_ug;
+    model->n_added = 0;
+}
+
+/* Threads requested in config for reading and writing ARPA files. */
+static int
+trie_nthreads(cmd_ln_t * config)
+{
+    if (config && cmd_ln_exists_r(config, "-nthreads"))
+        return cmd_ln_int32_r(config, "-nthreads");
+    return 1;
+}
+
+/* Quantization requested in config, NULL for the default. */
+static char const *
+trie_quant_spec(cmd_ln_t * config)
+{
+    if (config && cmd_ln_exists_r(config, "-quant"))
+        return cmd_ln_str_r(config, "-quant");
+    return NULL;
+}
+
 /*
  * Read and return #unigrams, #bigrams, #trigrams as stated in input file.
  */
@@ -181,6 +247,7 @@ ngram_model_trie_read_arpa(cmd_ln_t * config,
     }
 
     model = (ngram_model_trie_t *) ckd_calloc(1, sizeof(*model));
+    model->nthreads = trie_nthreads(config);
     li = lineiter_start_clean(fp);
     /* Read n-gram counts from file */
     if (read_counts_arpa(&li, counts, &order) == -1) {
@@ -198,10 +265,12 @@ ngram_model_trie_read_arpa(cmd_ln_t * config,
     base = &model->base;
     ngram_model_init(base, &ngram_model_trie_funcs, lmath, order,
                      (int32) counts[0]);
+    model->n_trie_ug = counts[0];
     base->writable = TRUE;
 
-    model->trie = lm_trie_create(counts[0], order);
-    if (read_1grams_arpa(&li, counts[0], base, model->trie->unigrams) < 0) {
+    model->trie = lm_trie_create(counts[0], order, trie_quant_spec(config));
+    if (model->trie == NULL
+        || read_1grams_arpa(&li, counts[0], base, model->trie->unigrams) < 0) {
 	ngram_model_free(base);
         lineiter_free(li);
         fclose_comp(fp, is_pipe);
@@ -211,7 +280,7 @@ ngram_model_trie_read_arpa(cmd_ln_t * config,
     if (order > 1) {
         raw_ngrams =
             ngrams_raw_read_arpa(&li, base->lmath, counts, order,
-                                 base->wid);
+                                 base->wid, model->nthreads);
         if (raw_ngrams == NULL) {
             ngram_model_free(base);
             lineiter_free(li);
@@ -224,6 +293,7 @@ ngram_model_trie_read_arpa(cmd_ln_t * config,
 
     lineiter_free(li);
     fclose_comp(fp, is_pipe);
+    trie_bloom(config, model);
 
     return base;
 }
@@ -231,11 +301,16 @@ ngram_model_trie_read_arpa(cmd_ln_t * config,
 int
 ngram_model_trie_write_arpa(ngram_model_t * base, const char *path)
 {
-    int i;
+    int i, rv = 0;
     uint32 j;
     ngram_model_trie_t *model = (ngram_model_trie_t *) base;
-    FILE *fp = fopen(path, "w");
-    if (!fp) {
+    int32 is_pipe;
+    char buf[64];
+    FILE *fp;
+
+    trie_merge_added(model);
+    /* Compressed according to the extension. */
+    if ((fp = fopen_comp(path, "w", &is_pipe)) == NULL) {
         E_ERROR("Unable to open %s to write arpa LM from trie\n", path);
         return -1;
     }
@@ -250,18 +325,22 @@ ngram_model_trie_write_arpa(ngram_model_t * base, const char *path)
     fprintf(fp, "\n\\1-grams:\n");
     for (j = 0; j < base->n_counts[0]; j++) {
         unigram_t *unigram = &model->trie->unigrams[j];
-        fprintf(fp, "%.4f\t%s",
-                logmath_log_float_to_log10(base->lmath, unigram->prob),
-                base->word_str[j]);
+        ngrams_raw_format_weight
+            (buf, logmath_log_float_to_log10(base->lmath, unigram->prob));
+        fputs(buf, fp);
+        putc('\t', fp);
+        fputs(base->word_str[j], fp);
         if (base->n > 1) {
-            fprintf(fp, "\t%.4f",
-                    logmath_log_float_to_log10(base->lmath, unigram->bo));
+            ngrams_raw_format_weight
+                (buf, logmath_log_float_to_log10(base->lmath, unigram->bo));
+            putc('\t', fp);
+            fputs(buf, fp);
         }
-        fprintf(fp, "\n");
+        putc('\n', fp);
     }
     /* Write ngrams */
     if (base->n > 1) {
-        for (i = 2; i <= base->n; ++i) {
+        for (i = 2; i <= base->n && rv == 0; ++i) {
             ngram_raw_t *raw_ngrams =
                 (ngram_raw_t *) ckd_calloc((size_t) base->n_counts[i - 1],
                                            sizeof(*raw_ngrams));
@@ -277,28 +356,24 @@ ngram_model_trie_write_arpa(ngram_model_t * base, const char *path)
                            &raw_ngram_idx, base->n_counts, range, hist, 0,
                            i, base->n);
             assert(raw_ngram_idx == base->n_counts[i - 1]);
-            qsort(raw_ngrams, (size_t) base->n_counts[i - 1],
-                  sizeof(ngram_raw_t), &ngram_ord_comparator);
 
             fprintf(fp, "\n\\%d-grams:\n", i);
-            for (j = 0; j < base->n_counts[i - 1]; j++) {
-                int k;
-                fprintf(fp, "%.4f", logmath_log_float_to_log10(base->lmath, raw_ngrams[j].prob));
-                for (k = 0; k < i; k++) {
-                    fprintf(fp, "\t%s",
-                            base->word_str[raw_ngrams[j].words[k]]);
-                }
+            if (rv == 0
+                && ngrams_raw_write_arpa(fp, raw_ngrams,
+                                         base->n_counts[i - 1], i, base->n,
+                                         base->word_str, base->n_counts[0],
+                                         base->lmath, model->nthreads) < 0)
+                rv = -1;
+            for (j = 0; j < base->n_counts[i - 1]; j++)
                 ckd_free(raw_ngrams[j].words);
-                if (i < base->n) {
-                    fprintf(fp, "\t%.4f", logmath_log_float_to_log10(base->lmath, raw_ngrams[j].backoff));
-                }
-                fprintf(fp, "\n");
-            }
             ckd_free(raw_ngrams);
         }
     }
     fprintf(fp, "\n\\end\\\n");
-    return fclose(fp);
+    if (fflush(fp) != 0 || ferror(fp))
+        rv = -1;
+    fclose_comp(fp, is_pipe);
+    return rv;
 }
 
 static void
@@ -343,13 +418,17 @@ ngram_model_trie_read_bin(cmd_ln_t * config,
 {
     int32 is_pipe;
     FILE *fp;
-    size_t hdr_size;
+    size_t hdr_size, data_size = 0;
     char *hdr;
-    int cmp_res;
+    int aligned, do_mmap;
     uint8 i, order;
+    uint32 byte_order;
     uint32 counts[NGRAM_MAX_ORDER];
     ngram_model_trie_t *model;
     ngram_model_t *base;
+    mmio_file_t *filemap;
+    lm_trie_t *trie;
+    long file_size;
 
     E_INFO("Trying to read LM in trie binary format\n");
     if ((fp = fopen_comp(path, "rb", &is_pipe)) == NULL) {
@@ -359,28 +438,104 @@ ngram_model_trie_read_bin(cmd_ln_t * config,
     hdr_size = strlen(trie_hdr);
     hdr = (char *) ckd_calloc(hdr_size + 1, sizeof(*hdr));
     fread(hdr, sizeof(*hdr), hdr_size, fp);
-    cmp_res = strcmp(hdr, trie_hdr);
-    ckd_free(hdr);
-    if (cmp_res) {
+    aligned = (strcmp(hdr, trie_hdr_aligned) == 0);
+    if (!aligned && strcmp(hdr, trie_hdr) != 0) {
         E_INFO("Header doesn't match\n");
+        ckd_free(hdr);
         fclose_comp(fp, is_pipe);
         return NULL;
     }
-    model = (ngram_model_trie_t *) ckd_calloc(1, sizeof(*model));
-    base = &model->base;
+    ckd_free(hdr);
     fread(&order, sizeof(order), 1, fp);
+    hdr_size += sizeof(order);
+    if (aligned) {
+        fread(&byte_order, sizeof(byte_order), 1, fp);
+        hdr_size += sizeof(byte_order);
+        if (byte_order != TRIE_BYTE_ORDER) {
+            E_ERROR("%s was written on a machine with different byte order\n",
+                    path);
+            fclose_comp(fp, is_pipe);
+            return NULL;
+        }
+    }
+    if (order < 1 || order > NGRAM_MAX_ORDER) {
+        E_ERROR("Invalid order %d in %s\n", order, path);
+        fclose_comp(fp, is_pipe);
+        return NULL;
+    }
     for (i = 0; i < order; i++) {
         fread(&counts[i], sizeof(counts[i]), 1, fp);
     }
+    hdr_size += order * sizeof(*counts);
+
+    /* Only the aligned format can be used in place, and pipes can't
+     * be mapped. */
+    filemap = NULL;
+    trie = NULL;
+    do_mmap = aligned && !is_pipe && config
+        && cmd_ln_exists_r(config, "-mmap")
+        && cmd_ln_boolean_r(config, "-mmap");
+    if (do_mmap) {
+        fseek(fp, 0, SEEK_END);
+        file_size = ftell(fp);
+        fseek(fp, hdr_size, SEEK_SET);
+        if ((filemap = mmio_file_read(path)) == NULL) {
+            E_WARN("Failed to map %s, reading it instead\n", path);
+            do_mmap = FALSE;
+        }
+    }
+    if (do_mmap) {
+        /* The trie checks its sections against what is left of the
+         * file, since their sizes depend on the quantization. */
+        data_size = (size_t) file_size > LM_TRIE_PAD(hdr_size)
+            ? file_size - LM_TRIE_PAD(hdr_size) : 0;
+        trie = lm_trie_map_bin(counts, order,
+                               (uint8 *) mmio_file_ptr(filemap)
+                               + LM_TRIE_PAD(hdr_size), &data_size);
+        if (trie == NULL) {
+            E_ERROR("%s is truncated\n", path);
+            mmio_file_unmap(filemap);
+            fclose_comp(fp, is_pipe);
+            return NULL;
+        }
+        data_size += LM_TRIE_PAD(hdr_size);
+    }
+
+    model = (ngram_model_trie_t *) ckd_calloc(1, sizeof(*model));
+    model->nthreads = trie_nthreads(config);
+    base = &model->base;
     ngram_model_init(base, &ngram_model_trie_funcs, lmath, order,
                      (int32) counts[0]);
+    model->n_trie_ug = counts[0];
     for (i = 0; i < order; i++) {
         base->n_counts[i] = counts[i];
     }
 
-    model->trie = lm_trie_read_bin(counts, order, fp);
+    if (do_mmap) {
+        E_INFO("Mapping trie from %s\n", path);
+        model->filemap = filemap;
+        model->trie = trie;
+        /* The n-grams are read in no particular order, so start
+         * paging them in now rather than on the first lookups. */
+        mmio_file_prefetch(filemap);
+        fseek(fp, data_size, SEEK_SET);
+    }
+    else {
+        if (aligned) {
+            /* Skip header padding. */
+            for (; hdr_size % LM_TRIE_ALIGN; ++hdr_size)
+                fgetc(fp);
+        }
+        model->trie = lm_trie_read_bin(counts, order, fp, aligned);
+        if (model->trie == NULL) {
+            ngram_model_free(base);
+            fclose_comp(fp, is_pipe);
+            return NULL;
+        }
+    }
     read_word_str(base, fp);
     fclose_comp(fp, is_pipe);
+    trie_bloom(config, model);
 
     return base;
 }
@@ -404,19 +559,30 @@ ngram_model_trie_write_bin(ngram_model_t * base, const char *path)
 {
     int i;
     int32 is_pipe;
+    uint32 byte_order = TRIE_BYTE_ORDER;
+    size_t hdr_size;
     ngram_model_trie_t *model = (ngram_model_trie_t *) base;
     FILE *fp = fopen_comp(path, "wb", &is_pipe);
+
+    trie_merge_added(model);
     if (!fp) {
         E_ERROR("Unable to open %s to write binary trie LM\n", path);
         return -1;
     }
 
-    fwrite(trie_hdr, sizeof(*trie_hdr), strlen(trie_hdr), fp);
+    fwrite(trie_hdr_aligned, sizeof(*trie_hdr_aligned),
+           strlen(trie_hdr_aligned), fp);
     fwrite(&model->base.n, sizeof(model->base.n), 1, fp);
+    fwrite(&byte_order, sizeof(byte_order), 1, fp);
+    hdr_size = strlen(trie_hdr_aligned) + sizeof(model->base.n)
+        + sizeof(byte_order);
     for (i = 0; i < model->base.n; i++) {
         fwrite(&model->base.n_counts[i], sizeof(model->base.n_counts[i]),
                1, fp);
+        hdr_size += sizeof(model->base.n_counts[i]);
     }
+    for (; hdr_size % LM_TRIE_ALIGN; ++hdr_size)
+        fputc(0, fp);
     lm_trie_write_bin(model->trie, base->n_counts[0], fp);
     write_word_str(fp, base);
     fclose_comp(fp, is_pipe);
@@ -527,6 +693,7 @@ ngram_model_trie_read_dmp(cmd_ln_t * config,
     E_INFO("ngrams 1=%d, 2=%d, 3=%d\n", counts[0], counts[1], counts[2]);
 
     model = (ngram_model_trie_t *) ckd_calloc(1, sizeof(*model));
+    model->nthreads = trie_nthreads(config);
     base = &model->base;
     if (counts[2] > 0)
         order = 3;
@@ -536,8 +703,14 @@ ngram_model_trie_read_dmp(cmd_ln_t * config,
         order = 1;
     ngram_model_init(base, &ngram_model_trie_funcs, lmath, order,
                      (int32) counts[0]);
+    model->n_trie_ug = counts[0];
 
-    model->trie = lm_trie_create(counts[0], order);
+    model->trie = lm_trie_create(counts[0], order, trie_quant_spec(config));
+    if (model->trie == NULL) {
+        ngram_model_free(base);
+        fclose_comp(fp, is_pipe);
+        return NULL;
+    }
 
     unigram_next =
         (uint32 *) ckd_calloc((int32) counts[0] + 1, sizeof(unigram_next));
@@ -585,6 +758,7 @@ ngram_model_trie_read_dmp(cmd_ln_t * config,
     read_word_str(base, fp);
 
     fclose_comp(fp, is_pipe);
+    trie_bloom(config, model);
     return base;
 }
 
@@ -592,7 +766,16 @@ static void
 ngram_model_trie_free(ngram_model_t * base)
 {
     ngram_model_trie_t *model = (ngram_model_trie_t *) base;
-    lm_trie_free(model->trie);
+    if (base->shared) {
+        /* Only the caches are ours. */
+        ckd_free(model->trie);
+        return;
+    }
+    if (model->trie)
+        lm_trie_free(model->trie);
+    if (model->filemap)
+        mmio_file_unmap(model->filemap);
+    ckd_free(model->added);
 }
 
 static int
@@ -619,12 +802,20 @@ ngram_model_trie_raw_score(ngram_model_t * base, int32 wid, int32 * hist,
 
     if (n_hist > model->base.n - 1)
         n_hist = model->base.n - 1;
+    /* Added words are in no N-Grams, so nothing beyond them matches. */
     for (i = 0; i < n_hist; i++) {
-        if (hist[i] < 0) {
+        if (hist[i] < 0 || (uint32) hist[i] >= model->n_trie_ug) {
             n_hist = i;
             break;
         }
     }
+    if ((uint32) wid >= model->n_trie_ug) {
+        *n_used = 1;
+        if ((uint32) wid - model->n_trie_ug >= model->n_added)
+            return base->log_zero;
+        return (int32) (model->added[wid - model->n_trie_ug]
+                        + lm_trie_backoff(model->trie, hist, n_hist));
+    }
 
     return (int32) lm_trie_score(model->trie, model->base.n, wid, hist,
                                  n_hist, n_used);
@@ -639,6 +830,44 @@ ngram_model_trie_score(ngram_model_t * base, int32 wid, int32 * hist,
                                                    n_used));
 }
 
+static int32
+ngram_model_trie_state_score(ngram_model_t * base, ngram_state_t const *in,
+                             int32 wid, ngram_state_t * out,
+                             int32 * n_used)
+{
+    ngram_model_trie_t *model = (ngram_model_trie_t *) base;
+    ngram_state_t trunc;
+    float prob;
+    int32 i;
+
+    /* Added words end the history, as in raw_score. */
+    for (i = 0; i < in->n_hist; i++)
+        if ((uint32) in->hist[i] >= model->n_trie_ug)
+            break;
+    if (i < in->n_hist) {
+        trunc = *in;
+        trunc.n_hist = i;
+        in = &trunc;
+    }
+    if ((uint32) wid >= model->n_trie_ug) {
+        *n_used = 1;
+        out->hist[0] = wid;
+        out->backoff[0] = 0;
+        out->n_hist = (model->base.n > 1) ? 1 : 0;
+        if ((uint32) wid - model->n_trie_ug >= model->n_added)
+            return base->log_zero;
+        prob = model->added[wid - model->n_trie_ug];
+        for (i = 0; i < in->n_hist && i < model->base.n - 1; i++)
+            prob += in->backoff[i];
+        return weight_score(base, (int32) prob);
+    }
+
+    return weight_score(base,
+                        (int32) lm_trie_state_score(model->trie,
+                                                    model->base.n, wid,
+                                                    in, out, n_used));
+}
+
 static int32
 lm_trie_add_ug(ngram_model_t * base, int32 wid, int32 lweight)
 {
@@ -646,22 +875,14 @@ lm_trie_add_ug(ngram_model_t * base, int32 wid, int32 lweight)
 
     /* This would be very bad if this happened! */
     assert(!NGRAM_IS_CLASSWID(wid));
+    assert((uint32) wid >= model->n_trie_ug);
 
-    /* Reallocate unigram array. */
-    model->trie->unigrams =
-        (unigram_t *) ckd_realloc(model->trie->unigrams,
-                                  sizeof(*model->trie->unigrams) *
-                                  (base->n_1g_alloc + 1));
-    memset(model->trie->unigrams + (base->n_counts[0] + 1), 0,
-           (size_t) (base->n_1g_alloc -
-                     base->n_counts[0]) * sizeof(*model->trie->unigrams));
     ++base->n_counts[0];
     lweight += logmath_log(base->lmath, 1.0 / base->n_counts[0]);
-    model->trie->unigrams[wid + 1].next = model->trie->unigrams[wid].next;
-    model->trie->unigrams[wid].prob = (float) lweight;
-    /* This unigram by definition doesn't participate in any bigrams,
-     * so its backoff weight is undefined and next pointer same as in finish unigram*/
-    model->trie->unigrams[wid].bo = 0;
+    /* The trie is left alone, added words only have unigram
+     * probabilities, which are kept beside it until it is written. */
+    trie_grow_added(model, wid - model->n_trie_ug + 1);
+    model->added[wid - model->n_trie_ug] = (float) lweight;
     /* Finally, increase the unigram count */
     /* FIXME: Note that this can actually be quite bogus due to the
      * presence of class words.  If wid falls outside the unigram
@@ -683,11 +904,58 @@ lm_trie_flush(ngram_model_t * base)
     return;
 }
 
+static ngram_model_t *
+ngram_model_trie_clone(ngram_model_t * base)
+{
+    ngram_model_trie_t *model = (ngram_model_trie_t *) base;
+    ngram_model_trie_t *clone;
+
+    /* No words can be added once shared, so put them in the trie now,
+     * otherwise writing a clone would modify it. */
+    trie_merge_added(model);
+    clone = (ngram_model_trie_t *) ckd_malloc(sizeof(*clone));
+    *clone = *model;
+    /* The trie structure holds the backoff and history caches. */
+    clone->trie = (lm_trie_t *) ckd_malloc(sizeof(*clone->trie));
+    *clone->trie = *model->trie;
+    lm_trie_flush(&clone->base);
+    clone->filemap = NULL;
+    clone->added = NULL;
+    clone->n_added = clone->n_added_alloc = 0;
+    return &clone->base;
+}
+
+static size_t
+ngram_model_trie_mem_size(ngram_model_t * base, size_t * out_shared,
+                          size_t * out_mapped)
+{
+    ngram_model_trie_t *model = (ngram_model_trie_t *) base;
+    size_t heap, trie;
+
+    heap = sizeof(*model) - sizeof(*base)
+        + model->n_added_alloc * sizeof(*model->added);
+    if (model->trie == NULL)
+        return heap;
+    trie = lm_trie_mem_size(model->trie, model->n_trie_ug, out_mapped);
+    /* Clones have their own copy of the trie structure, for its
+     * caches, but share everything it points to. */
+    if (base->shared || base->n_clones) {
+        heap += sizeof(*model->trie);
+        *out_shared += trie - sizeof(*model->trie);
+    }
+    else
+        heap += trie;
+    return heap;
+}
+
 static ngram_funcs_t ngram_model_trie_funcs = {
     ngram_model_trie_free,      /* free */
     trie_apply_weights,         /* apply_weights */
     ngram_model_trie_score,     /* score */
     ngram_model_trie_raw_score, /* raw_score */
     lm_trie_add_ug,             /* add_ug */
-    lm_trie_flush               /* flush */
+    lm_trie_flush,              /* flush */
+    ngram_model_trie_state_score, /* state_score */
+    ngram_model_trie_clone,     /* clone */
+    ngram_model_trie_mem_size   /* mem_size */
 };
@@ -39,6 +39,7 @@
 
 #include <sphinxbase/prim_type.h>
 #include <sphinxbase/logmath.h>
+#include <sphinxbase/mmio.h>
 
 #include "ngram_model_internal.h"
 #include "lm_trie.h"
@@ -46,6 +47,12 @@
 typedef struct ngram_model_trie_s {
     ngram_model_t base;  /**< Base ngram_model_t structure */
     lm_trie_t *trie;     /**< Trie structure that stores ngram relations and weights */
+    mmio_file_t *filemap; /**< File the trie is mapped from, if any */
+    uint32 n_trie_ug;    /**< Unigrams in the trie, later words were added */
+    float *added;        /**< Unigram probabilities of added words */
+    uint32 n_added;      /**< Number of entries in added */
+    uint32 n_added_alloc; /**< Allocated entries in added */
+    int nthreads;        /**< Threads to read and write ARPA files with */
 } ngram_model_trie_t;
 
 /**
@@ -36,12 +36,14 @@
  */
 
 #include <string.h>
+#include <math.h>
 
 #include <sphinxbase/err.h>
 #include <sphinxbase/pio.h>
 #include <sphinxbase/strfuncs.h>
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/byteorder.h>
+#include <sphinxbase/sbthread.h>
 
 #include "ngram_model_internal.h"
 #include "ngrams_raw.h"
@@ -67,8 +69,34 @@ ngram_ord_comparator(const void *a_raw, const void *b_raw)
     return a->order - b->order;
 }
 
+/* Lines parsed by each thread at a time when reading in parallel. */
+#define NGRAMS_RAW_BATCH 65536
+/* Don't bother sorting in parallel below this many n-grams per thread. */
+#define NGRAMS_RAW_MIN_SORT 16384
+
+/**
+ * Slice of a section for one worker thread.  Lines and sort chunks
+ * are handed out in contiguous slices so that the results are the
+ * same as reading with one thread.
+ */
+typedef struct ngrams_raw_job_s {
+    char **lines;
+    int32 *linenos;
+    uint32 n;
+    ngram_raw_t *raw_ngrams;
+    hash_table_t *wid;
+    logmath_t *lmath;
+    int order;
+    int order_max;
+    char **word_str;
+    char *buf;          /**< Formatted lines, when writing */
+    size_t len;
+    size_t alloc;
+    size_t line_max;    /**< Longest a formatted line can be */
+} ngrams_raw_job_t;
+
 static int
-ngrams_raw_read_line(lineiter_t *li, hash_table_t *wid,
+ngrams_raw_read_line(char *buf, int32 lineno, hash_table_t *wid,
                     logmath_t *lmath, int order, int order_max,
                     ngram_raw_t *raw_ngram)
 {
@@ -79,9 +107,9 @@ ngrams_raw_read_line(lineiter_t *li, hash_table_t *wid,
 
     words_expected = order + 1;
     if ((n =
-         str2words(li->buf, wptr,
+         str2words(buf, wptr,
                    NGRAM_MAX_ORDER + 1)) < words_expected) {
-        E_ERROR("Format error; %d-gram ignored at line %d\n", order, li->lineno);
+        E_ERROR("Format error; %d-gram ignored at line %d\n", order, lineno);
         return -1;
     }
 
@@ -127,10 +155,197 @@ ngrams_raw_read_line(lineiter_t *li, hash_table_t *wid,
     return 0;
 }
 
+static int
+ngrams_raw_parse_main(sbthread_t *th)
+{
+    ngrams_raw_job_t *job = (ngrams_raw_job_t *) sbthread_arg(th);
+    uint32 i;
+
+    for (i = 0; i < job->n; ++i) {
+        /* Failed lines keep NULL words and are dropped afterwards. */
+        ngrams_raw_read_line(job->lines[i], job->linenos[i], job->wid,
+                             job->lmath, job->order, job->order_max,
+                             job->raw_ngrams + i);
+    }
+    return 0;
+}
+
+static int
+ngrams_raw_sort_main(sbthread_t *th)
+{
+    ngrams_raw_job_t *job = (ngrams_raw_job_t *) sbthread_arg(th);
+
+    qsort(job->raw_ngrams, job->n, sizeof(ngram_raw_t),
+          &ngram_ord_comparator);
+    return 0;
+}
+
+/* Run a job on each slice in its own thread, and wait for them all. */
+static int
+ngrams_raw_run_jobs(ngrams_raw_job_t *jobs, int nthreads,
+                    sbthread_main func)
+{
+    sbthread_t **threads;
+    int i, rv = 0;
+
+    threads = (sbthread_t **) ckd_calloc(nthreads, sizeof(*threads));
+    for (i = 0; i < nthreads; ++i) {
+        if ((threads[i] = sbthread_start(NULL, func, jobs + i)) == NULL)
+            rv = -1;
+    }
+    for (i = 0; i < nthreads; ++i) {
+        if (threads[i]) {
+            sbthread_wait(threads[i]);
+            sbthread_free(threads[i]);
+        }
+    }
+    ckd_free(threads);
+    return rv;
+}
+
+/* Sort raw n-grams in nthreads slices, then merge the slices. */
+static void
+ngrams_raw_sort(ngram_raw_t *raw_ngrams, uint32 count, int nthreads)
+{
+    ngrams_raw_job_t *jobs;
+    ngram_raw_t *merged;
+    uint32 *pos, i, start;
+    int j;
+
+    if (nthreads > (int) (count / NGRAMS_RAW_MIN_SORT))
+        nthreads = count / NGRAMS_RAW_MIN_SORT;
+    if (nthreads <= 1) {
+        qsort(raw_ngrams, count, sizeof(ngram_raw_t), &ngram_ord_comparator);
+        return;
+    }
+
+    jobs = (ngrams_raw_job_t *) ckd_calloc(nthreads, sizeof(*jobs));
+    for (start = 0, j = 0; j < nthreads; ++j) {
+        jobs[j].raw_ngrams = raw_ngrams + start;
+        jobs[j].n = (uint32) ((uint64) count * (j + 1) / nthreads) - start;
+        start += jobs[j].n;
+    }
+    if (ngrams_raw_run_jobs(jobs, nthreads, ngrams_raw_sort_main) < 0) {
+        E_WARN("Failed to start threads, sorting %d-grams in one\n",
+               raw_ngrams->order);
+        qsort(raw_ngrams, count, sizeof(ngram_raw_t), &ngram_ord_comparator);
+        ckd_free(jobs);
+        return;
+    }
+
+    merged = (ngram_raw_t *) ckd_calloc(count, sizeof(*merged));
+    pos = (uint32 *) ckd_calloc(nthreads, sizeof(*pos));
+    for (i = 0; i < count; ++i) {
+        int best = -1;
+        for (j = 0; j < nthreads; ++j) {
+            if (pos[j] == jobs[j].n)
+                continue;
+            if (best == -1
+                || ngram_ord_comparator(jobs[j].raw_ngrams + pos[j],
+                                        jobs[best].raw_ngrams
+                                        + pos[best]) < 0)
+                best = j;
+        }
+        merged[i] = jobs[best].raw_ngrams[pos[best]++];
+    }
+    memcpy(raw_ngrams, merged, count * sizeof(*raw_ngrams));
+    ckd_free(merged);
+    ckd_free(pos);
+    ckd_free(jobs);
+}
+
+/**
+ * Read the lines of a section in batches, and parse each batch in
+ * nthreads threads.  The file itself can only be read in order, but
+ * splitting the lines into words and converting them is most of the
+ * work.
+ */
+static int
+ngrams_raw_read_lines_parallel(ngram_raw_t * raw_ngrams, lineiter_t ** li,
+                               hash_table_t * wid, logmath_t * lmath,
+                               uint32 *count, int order, int order_max,
+                               int nthreads)
+{
+    ngrams_raw_job_t *jobs;
+    char *text, **lines;
+    size_t text_size, text_alloc, *offsets;
+    int32 *linenos;
+    uint32 i, j, batch, n, start;
+    int t, rv = 0;
+
+    batch = nthreads * NGRAMS_RAW_BATCH;
+    lines = (char **) ckd_calloc(batch, sizeof(*lines));
+    offsets = (size_t *) ckd_calloc(batch, sizeof(*offsets));
+    linenos = (int32 *) ckd_calloc(batch, sizeof(*linenos));
+    text_alloc = batch * 32;
+    text = (char *) ckd_malloc(text_alloc);
+    jobs = (ngrams_raw_job_t *) ckd_calloc(nthreads, sizeof(*jobs));
+
+    for (i = 0; i < *count && rv == 0; i += n) {
+        /* Copy the next batch of lines. */
+        text_size = 0;
+        for (n = 0; n < batch && i + n < *count; ++n) {
+            size_t len;
+
+            *li = lineiter_next(*li);
+            if (*li == NULL) {
+                E_ERROR("Unexpected end of ARPA file. Failed to read %d-gram\n",
+                        order);
+                rv = -1;
+                break;
+            }
+            len = strlen((*li)->buf) + 1;
+            if (text_size + len > text_alloc) {
+                text_alloc = (text_size + len) * 2;
+                text = (char *) ckd_realloc(text, text_alloc);
+            }
+            memcpy(text + text_size, (*li)->buf, len);
+            offsets[n] = text_size;
+            linenos[n] = (*li)->lineno;
+            text_size += len;
+        }
+        for (j = 0; j < n; ++j)
+            lines[j] = text + offsets[j];
+
+        /* And parse it. */
+        for (start = 0, t = 0; t < nthreads; ++t) {
+            jobs[t].lines = lines + start;
+            jobs[t].linenos = linenos + start;
+            jobs[t].n = (uint32) ((uint64) n * (t + 1) / nthreads) - start;
+            jobs[t].raw_ngrams = raw_ngrams + i + start;
+            jobs[t].wid = wid;
+            jobs[t].lmath = lmath;
+            jobs[t].order = order;
+            jobs[t].order_max = order_max;
+            start += jobs[t].n;
+        }
+        if (ngrams_raw_run_jobs(jobs, nthreads, ngrams_raw_parse_main) < 0) {
+            E_ERROR("Failed to start threads to read %d-grams\n", order);
+            rv = -1;
+        }
+    }
+
+    /* Drop the lines which could not be parsed. */
+    if (rv == 0) {
+        for (i = j = 0; i < *count; ++i) {
+            if (raw_ngrams[i].words != NULL)
+                raw_ngrams[j++] = raw_ngrams[i];
+        }
+        *count = j;
+    }
+
+    ckd_free(jobs);
+    ckd_free(text);
+    ckd_free(linenos);
+    ckd_free(offsets);
+    ckd_free(lines);
+    return rv;
+}
+
 static int
 ngrams_raw_read_section(ngram_raw_t ** raw_ngrams, lineiter_t ** li,
                       hash_table_t * wid, logmath_t * lmath, uint32 *count,
-                      int order, int order_max)
+                      int order, int order_max, int nthreads)
 {
     char expected_header[20];
     uint32 i, cur;
@@ -146,6 +361,14 @@ ngrams_raw_read_section(ngram_raw_t ** raw_ngrams, lineiter_t ** li,
     }
     
     *raw_ngrams = (ngram_raw_t *) ckd_calloc(*count, sizeof(ngram_raw_t));
+    if (nthreads > 1) {
+        if (ngrams_raw_read_lines_parallel(*raw_ngrams, li, wid, lmath,
+                                           count, order, order_max,
+                                           nthreads) < 0)
+            return -1;
+        ngrams_raw_sort(*raw_ngrams, *count, nthreads);
+        return 0;
+    }
     for (i = 0, cur = 0; i < *count && *li != NULL; i++) {
 	*li = lineiter_next(*li);
         if (*li == NULL) {
@@ -153,8 +376,8 @@ ngrams_raw_read_section(ngram_raw_t ** raw_ngrams, lineiter_t ** li,
                 order);
     	    return -1;
 	}
-        if (ngrams_raw_read_line(*li, wid, lmath, order, order_max,
-                                *raw_ngrams + cur) == 0) {
+        if (ngrams_raw_read_line((*li)->buf, (*li)->lineno, wid, lmath,
+                                 order, order_max, *raw_ngrams + cur) == 0) {
             cur++;
         }
     }
@@ -165,7 +388,7 @@ ngrams_raw_read_section(ngram_raw_t ** raw_ngrams, lineiter_t ** li,
 
 ngram_raw_t **
 ngrams_raw_read_arpa(lineiter_t ** li, logmath_t * lmath, uint32 * counts,
-                     int order, hash_table_t * wid)
+                     int order, hash_table_t * wid, int nthreads)
 {
     ngram_raw_t **raw_ngrams;
     int order_it;
@@ -175,7 +398,8 @@ ngrams_raw_read_arpa(lineiter_t ** li, logmath_t * lmath, uint32 * counts,
 
     for (order_it = 2; order_it <= order; order_it++) {
         if (ngrams_raw_read_section(&raw_ngrams[order_it - 2], li, wid, lmath,
-                              counts + order_it - 1, order_it, order) < 0)
+                              counts + order_it - 1, order_it, order,
+                              nthreads) < 0)
         break;
     }
 
@@ -371,6 +595,151 @@ ngrams_raw_read_dmp(FILE * fp, logmath_t * lmath, uint32 * counts,
     return raw_ngrams;
 }
 
+size_t
+ngrams_raw_format_weight(char *buf, float64 weight)
+{
+    float64 a, f;
+    uint32 x, ip;
+    char digits[10], *c;
+    int n;
+
+    /* Only weights that are not close to halfway between two outputs
+     * are done here, since "%.4f" rounds the exact binary value.  For
+     * these, a * 10000 is within 1e-7 of it. */
+    a = weight < 0 ? -weight : weight;
+    f = a * 10000.0;
+    if (!(a > 0.0 && a < 100000.0) || fabs(f - floor(f) - 0.5) < 1e-6)
+        return sprintf(buf, "%.4f", weight);
+
+    c = buf;
+    if (weight < 0)
+        *c++ = '-';
+    x = (uint32) (f + 0.5);
+    ip = x / 10000;
+    n = 0;
+    do {
+        digits[n++] = '0' + ip % 10;
+        ip /= 10;
+    } while (ip);
+    while (n > 0)
+        *c++ = digits[--n];
+    x %= 10000;
+    c[0] = '.';
+    c[1] = '0' + x / 1000;
+    c[2] = '0' + x / 100 % 10;
+    c[3] = '0' + x / 10 % 10;
+    c[4] = '0' + x % 10;
+    c[5] = '\0';
+    return c + 5 - buf;
+}
+
+static void
+ngrams_raw_format(ngrams_raw_job_t *job)
+{
+    char *c;
+    uint32 i;
+    int k;
+
+    if (job->n * job->line_max > job->alloc) {
+        job->alloc = job->n * job->line_max;
+        job->buf = (char *) ckd_realloc(job->buf, job->alloc);
+    }
+    c = job->buf;
+    for (i = 0; i < job->n; ++i) {
+        ngram_raw_t *raw_ngram = job->raw_ngrams + i;
+
+        c += ngrams_raw_format_weight
+            (c, logmath_log_float_to_log10(job->lmath, raw_ngram->prob));
+        for (k = 0; k < job->order; ++k) {
+            char const *word = job->word_str[raw_ngram->words[k]];
+            size_t len = strlen(word);
+
+            *c++ = '\t';
+            memcpy(c, word, len);
+            c += len;
+        }
+        if (job->order < job->order_max) {
+            *c++ = '\t';
+            c += ngrams_raw_format_weight
+                (c, logmath_log_float_to_log10(job->lmath,
+                                               raw_ngram->backoff));
+        }
+        *c++ = '\n';
+    }
+    job->len = c - job->buf;
+}
+
+static int
+ngrams_raw_format_main(sbthread_t *th)
+{
+    ngrams_raw_format((ngrams_raw_job_t *) sbthread_arg(th));
+    return 0;
+}
+
+int
+ngrams_raw_write_arpa(FILE * fp, ngram_raw_t * raw_ngrams, uint32 count,
+                      int order, int order_max, char **word_str,
+                      uint32 n_words, logmath_t * lmath, int nthreads)
+{
+    ngrams_raw_job_t *jobs;
+    size_t word_max;
+    uint32 i, start;
+    int t, n_jobs, rv = 0;
+
+    if (count == 0)
+        return 0;
+    if (nthreads < 1)
+        nthreads = 1;
+    for (word_max = 0, i = 0; i < n_words; ++i) {
+        size_t len = strlen(word_str[i]);
+        if (len > word_max)
+            word_max = len;
+    }
+
+    /* Lines are formatted in batches of NGRAMS_RAW_BATCH for each
+     * thread, and written in order once the whole batch is done. */
+    jobs = (ngrams_raw_job_t *) ckd_calloc(nthreads, sizeof(*jobs));
+    for (start = 0; start < count && rv == 0;) {
+        for (n_jobs = 0; n_jobs < nthreads && start < count; ++n_jobs) {
+            ngrams_raw_job_t *job = jobs + n_jobs;
+
+            job->raw_ngrams = raw_ngrams + start;
+            job->n = count - start;
+            if (job->n > NGRAMS_RAW_BATCH)
+                job->n = NGRAMS_RAW_BATCH;
+            job->lmath = lmath;
+            job->order = order;
+            job->order_max = order_max;
+            job->word_str = word_str;
+            /* See ngrams_raw_format_weight() for the weights. */
+            job->line_max = job->order * (word_max + 1) + 2 * 64 + 2;
+            start += job->n;
+        }
+        if (n_jobs == 1
+            || ngrams_raw_run_jobs(jobs, n_jobs,
+                                   ngrams_raw_format_main) < 0) {
+            if (n_jobs > 1)
+                E_WARN("Failed to start threads, writing %d-grams in one\n",
+                       order);
+            for (t = 0; t < n_jobs; ++t)
+                ngrams_raw_format(jobs + t);
+        }
+        for (t = 0; t < n_jobs; ++t) {
+            if (fwrite(jobs[t].buf, 1, jobs[t].len, fp) != jobs[t].len) {
+                E_ERROR_SYSTEM("Failed to write %d-grams\n",
+                               order);
+                rv = -1;
+                break;
+            }
+        }
+    }
+
+    for (t = 0; t < nthreads; ++t)
+        ckd_free(jobs[t].buf);
+    ckd_free(jobs);
+    return rv;
+}
+
 void
 ngrams_raw_free(ngram_raw_t ** raw_ngrams, uint32 * counts, int order)
 {
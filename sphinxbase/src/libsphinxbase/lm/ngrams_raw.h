@@ -63,16 +63,17 @@ int ngram_ord_comparator(const void *a_raw, const void *b_raw);
 
 /**
  * Read ngrams of order > 1 from ARPA file
- * @param li     [in] sphinxbase file line iterator that point to bigram description in ARPA file
- * @param wid    [in] hashtable that maps string word representation to id
- * @param lmath  [in] log math used for log convertions
- * @param counts [in] amount of ngrams for each order
- * @param order  [in] maximum order of ngrams
- * @return            raw ngrams of order bigger than 1
+ * @param li       [in] sphinxbase file line iterator that point to bigram description in ARPA file
+ * @param wid      [in] hashtable that maps string word representation to id
+ * @param lmath    [in] log math used for log convertions
+ * @param counts   [in] amount of ngrams for each order
+ * @param order    [in] maximum order of ngrams
+ * @param nthreads [in] number of threads to parse and sort ngrams with
+ * @return              raw ngrams of order bigger than 1
  */
 ngram_raw_t **ngrams_raw_read_arpa(lineiter_t ** li, logmath_t * lmath,
                                    uint32 * counts, int order,
-                                   hash_table_t * wid);
+                                   hash_table_t * wid, int nthreads);
 
 /**
  * Reads ngrams of order > 1 from DMP file.
@@ -91,4 +92,31 @@ ngram_raw_t **ngrams_raw_read_dmp(FILE * fp, logmath_t * lmath,
 void ngrams_raw_free(ngram_raw_t ** raw_ngrams, uint32 * counts,
                      int order);
 
+/**
+ * Format a log10 weight as printf("%.4f") would.
+ * @param buf    [out] buffer of at least 64 characters
+ * @param weight [in] weight to format
+ * @return            length of the text written to buf
+ */
+size_t ngrams_raw_format_weight(char *buf, float64 weight);
+
+/**
+ * Write the lines of an ARPA file section for raw ngrams of one order.
+ * The lines are formatted by nthreads threads in batches and written
+ * in order.
+ * @param fp        [in] file to write to
+ * @param raw_ngrams [in] ngrams of the same order, in the order to write
+ * @param count     [in] number of ngrams
+ * @param order     [in] order of the ngrams
+ * @param order_max [in] maximum order of the model (its ngrams have no backoff)
+ * @param word_str  [in] word strings by word id
+ * @param n_words   [in] number of entries in word_str
+ * @param lmath     [in] log math the weights are in
+ * @param nthreads  [in] number of threads to format lines with
+ * @return               0 on success, -1 if writing failed
+ */
+int ngrams_raw_write_arpa(FILE * fp, ngram_raw_t * raw_ngrams, uint32 count,
+                          int order, int order_max, char **word_str,
+                          uint32 n_words, logmath_t * lmath, int nthreads);
+
 #endif                          /* __LM_NGRAMS_RAW_H__ */
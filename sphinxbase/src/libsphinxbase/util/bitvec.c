@@ -76,26 +76,80 @@ bitvec_realloc(bitvec_t *vec,
     return new_vec;
 }
 
+int
+bitvec_ctz_generic(bitvec_t w)
+{
+    int n;
+
+    for (n = 0; !(w & 1); ++n)
+        w >>= 1;
+    return n;
+}
+
+int
+bitvec_popcount_generic(bitvec_t w)
+{
+    w = w - ((w >> 1) & 0x55555555);
+    w = (w & 0x33333333) + ((w >> 2) & 0x33333333);
+    w = (w + (w >> 4)) & 0x0f0f0f0f;
+    return (w * 0x01010101) >> 24;
+}
+
+/* Mask of the bits of the last word that are inside a vector of len bits. */
+#define TAIL_MASK(len) ((len) % BITVEC_BITS        \
+                        ? ((bitvec_t)1 << ((len) % BITVEC_BITS)) - 1 \
+                        : ~(bitvec_t)0)
+
 size_t
 bitvec_count_set(bitvec_t *vec, size_t len)
 {
-    size_t words, bits, w, b, n;
-    bitvec_t *v;
+    size_t words, w, n;
 
     words = len / BITVEC_BITS;
-    bits = len % BITVEC_BITS;
-    v = vec;
     n = 0;
-    for (w = 0; w < words; ++w, ++v) {
-        if (*v == 0)
-            continue;
-        for (b = 0; b < BITVEC_BITS; ++b)
-            if (*v & (1<<b))
-                ++n;
+    for (w = 0; w < words; ++w)
+        n += bitvec_popcount(vec[w]);
+    if (len % BITVEC_BITS)
+        n += bitvec_popcount(vec[w] & TAIL_MASK(len));
+
+    return n;
+}
+
+size_t
+bitvec_next_set(bitvec_t const *vec, size_t len, size_t b)
+{
+    size_t w, words;
+    bitvec_t bits;
+
+    if (b >= len)
+        return len;
+    words = bitvec_size(len);
+    w = b / BITVEC_BITS;
+    /* Drop the bits below b in the first word. */
+    bits = vec[w] & (~(bitvec_t)0 << (b % BITVEC_BITS));
+    while (bits == 0) {
+        if (++w == words)
+            return len;
+        bits = vec[w];
     }
-    for (b = 0; b < bits; ++b)
-        if (*v & (1<<b))
-            ++n;
+    b = w * BITVEC_BITS + bitvec_ctz(bits);
+    return b < len ? b : len;
+}
+
+size_t
+bitvec_or(bitvec_t *dst, bitvec_t const *src, size_t len)
+{
+    size_t words, w, n;
+
+    /* Keep this loop simple so that the compiler can vectorize it. */
+    words = bitvec_size(len);
+    for (w = 0; w < words; ++w)
+        dst[w] |= src[w];
+    n = 0;
+    for (w = 0; w + 1 < words; ++w)
+        n += bitvec_popcount(dst[w]);
+    if (words)
+        n += bitvec_popcount(dst[w] & TAIL_MASK(len));
 
     return n;
 }
@@ -424,4 +424,138 @@ __ckd_alloc_2d_ptr(size_t d1,
     return out;
 }
 
+/*
+ * Arena blocks are kept in a list in the order they are used, and are
+ * reused after a reset or release.  Allocations bigger than the block
+ * size get a block of their own, inserted after the current one.
+ */
+typedef struct arena_blk_s {
+    struct arena_blk_s *next;
+    size_t size;                /**< Bytes of data in this block */
+} arena_blk_t;
+
+struct arena_s {
+    arena_blk_t *head;          /**< First block */
+    arena_blk_t *cur;           /**< Block being allocated from */
+    size_t pos;                 /**< Offset of free space in cur */
+    size_t blksize;             /**< Default block size */
+};
+
+/* Alignment for arena allocations, enough for any basic type. */
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(x) (((x) + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1))
+#define ARENA_HDR ARENA_ROUND(sizeof(arena_blk_t))
+#define ARENA_DATA(b) ((char *)(b) + ARENA_HDR)
+
+static arena_blk_t *
+arena_blk_new(size_t size, const char *caller_file, int caller_line)
+{
+    arena_blk_t *blk;
+
+    blk = __ckd_malloc__(ARENA_HDR + size, caller_file, caller_line);
+    blk->next = NULL;
+    blk->size = size;
+    return blk;
+}
+
+arena_t *
+ckd_arena_init(size_t blksize)
+{
+    arena_t *arena;
+
+    if (blksize == 0)
+        blksize = 1 << 16;
+    arena = ckd_calloc(1, sizeof(*arena));
+    arena->blksize = ARENA_ROUND(blksize);
+    arena->head = arena->cur =
+        arena_blk_new(arena->blksize, __FILE__, __LINE__);
+    return arena;
+}
+
+void
+ckd_arena_free(arena_t *arena)
+{
+    arena_blk_t *blk, *next;
+
+    if (arena == NULL)
+        return;
+    for (blk = arena->head; blk; blk = next) {
+        next = blk->next;
+        ckd_free(blk);
+    }
+    ckd_free(arena);
+}
+
+void
+ckd_arena_reset(arena_t *arena)
+{
+    arena->cur = arena->head;
+    arena->pos = 0;
+}
+
+arena_mark_t
+ckd_arena_mark(arena_t *arena)
+{
+    arena_mark_t mark;
+
+    mark.blk = arena->cur;
+    mark.pos = arena->pos;
+    return mark;
+}
+
+void
+ckd_arena_release(arena_t *arena, arena_mark_t mark)
+{
+    arena->cur = mark.blk;
+    arena->pos = mark.pos;
+}
+
+void *
+__ckd_arena_calloc__(arena_t *arena, size_t n_elem, size_t elem_size,
+                     const char *caller_file, int caller_line)
+{
+    size_t size;
+    char *mem;
+
+    if (elem_size && n_elem > ((size_t)-1 - ARENA_HDR - ARENA_ALIGN) / elem_size)
+        ckd_fail("arena calloc(%lu,%lu) overflows from %s(%d)\n",
+                 (unsigned long)n_elem, (unsigned long)elem_size,
+                 caller_file, caller_line);
+    size = ARENA_ROUND(n_elem * elem_size);
+    if (arena->pos + size > arena->cur->size) {
+        arena_blk_t *next = arena->cur->next;
+
+        /* Reuse the next block if it is big enough, otherwise put a
+         * new one in front of it. */
+        if (next == NULL || next->size < size) {
+            next = arena_blk_new(size > arena->blksize ? size : arena->blksize,
+                                 caller_file, caller_line);
+            next->next = arena->cur->next;
+            arena->cur->next = next;
+        }
+        arena->cur = next;
+        arena->pos = 0;
+    }
+    mem = ARENA_DATA(arena->cur) + arena->pos;
+    arena->pos += size;
+    memset(mem, 0, n_elem * elem_size);
+    return mem;
+}
+
+char *
+__ckd_arena_salloc__(arena_t *arena, const char *orig,
+                     const char *caller_file, int caller_line)
+{
+    size_t len;
+    char *buf;
+
+    if (!orig)
+        return NULL;
+
+    len = strlen(orig) + 1;
+    buf = __ckd_arena_calloc__(arena, len, 1, caller_file, caller_line);
+    memcpy(buf, orig, len);
+    return buf;
+}
+
 /* vim: set ts=4 sw=4: */
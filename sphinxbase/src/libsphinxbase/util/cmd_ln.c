@@ -81,6 +81,7 @@
 #include "sphinxbase/hash_table.h"
 #include "sphinxbase/case.h"
 #include "sphinxbase/strfuncs.h"
+#include "sphinxbase/sbthread.h"
 
 typedef struct cmd_ln_val_s {
     anytype_t val;
@@ -88,9 +89,26 @@ typedef struct cmd_ln_val_s {
     char *name;
 } cmd_ln_val_t;
 
+/**
+ * Argument values, shared copy-on-write between a command-line
+ * object and its clones.  Values are kept in the order they were
+ * first entered, so an index into vals (a cmd_ln_key_t) stays valid
+ * for the lifetime of the table and of any copies made of it.
+ * Clones may be used from other threads, so the reference count is
+ * only touched with mtx held.
+ */
+typedef struct cmd_ln_tbl_s {
+    int refcount;
+    sbmtx_t *mtx;         /**< Lock for refcount. */
+    hash_table_t *ht;     /**< Argument name to index in vals. */
+    cmd_ln_val_t **vals;
+    int32 n_vals;
+    int32 n_alloc;
+} cmd_ln_tbl_t;
+
 struct cmd_ln_s {
     int refcount;
-    hash_table_t *ht;
+    cmd_ln_tbl_t *tbl;
     char **f_argv;
     uint32 f_argc;
 };
@@ -104,6 +122,9 @@ arg_dump_r(cmd_ln_t *, FILE *, arg_t const *, int32);
 static cmd_ln_t *
 parse_options(cmd_ln_t *, const arg_t *, int32, char* [], int32);
 
+void
+cmd_ln_val_free(cmd_ln_val_t *val);
+
 /*
  * Find max length of name and default fields in the given defn array.
  * Return #items in defn array.
@@ -429,6 +450,140 @@ cmd_ln_val_init(int t, const char *name, const char *str)
     return v;
 }
 
+static cmd_ln_val_t *
+cmd_ln_val_copy(cmd_ln_val_t const *val)
+{
+    cmd_ln_val_t *v;
+
+    v = (cmd_ln_val_t *)ckd_calloc(1, sizeof(*v));
+    memcpy(v, val, sizeof(*v));
+    v->name = ckd_salloc(val->name);
+    if ((val->type & ARG_STRING_LIST) && val->val.ptr) {
+        char **array = (char **)val->val.ptr;
+        char **copy;
+        int i;
+
+        for (i = 0; array[i] != NULL; i++)
+            ;
+        copy = (char **)ckd_calloc(i + 1, sizeof(*copy));
+        for (i = 0; array[i] != NULL; i++)
+            copy[i] = ckd_salloc(array[i]);
+        v->val.ptr = copy;
+    }
+    else if (val->type & ARG_STRING)
+        v->val.ptr = ckd_salloc(val->val.ptr);
+
+    return v;
+}
+
+static cmd_ln_tbl_t *
+cmd_ln_tbl_init(int32 size)
+{
+    cmd_ln_tbl_t *tbl;
+
+    tbl = (cmd_ln_tbl_t *)ckd_calloc(1, sizeof(*tbl));
+    tbl->refcount = 1;
+    tbl->mtx = sbmtx_init();
+    tbl->ht = hash_table_new(size, 0 /* argument names are case-sensitive */ );
+    tbl->n_alloc = size > 0 ? size : 16;
+    tbl->vals = (cmd_ln_val_t **)ckd_calloc(tbl->n_alloc, sizeof(*tbl->vals));
+    return tbl;
+}
+
+static cmd_ln_tbl_t *
+cmd_ln_tbl_retain(cmd_ln_tbl_t *tbl)
+{
+    sbmtx_lock(tbl->mtx);
+    ++tbl->refcount;
+    sbmtx_unlock(tbl->mtx);
+    return tbl;
+}
+
+static int
+cmd_ln_tbl_free(cmd_ln_tbl_t *tbl)
+{
+    int32 i;
+    int refcount;
+
+    if (tbl == NULL)
+        return 0;
+    sbmtx_lock(tbl->mtx);
+    refcount = --tbl->refcount;
+    sbmtx_unlock(tbl->mtx);
+    if (refcount > 0)
+        return refcount;
+    sbmtx_free(tbl->mtx);
+    for (i = 0; i < tbl->n_vals; ++i)
+        cmd_ln_val_free(tbl->vals[i]);
+    ckd_free(tbl->vals);
+    hash_table_free(tbl->ht);
+    ckd_free(tbl);
+    return 0;
+}
+
+static int32
+cmd_ln_tbl_find(cmd_ln_tbl_t *tbl, char const *name)
+{
+    int32 idx;
+
+    if (tbl == NULL || hash_table_lookup_int32(tbl->ht, name, &idx) < 0)
+        return -1;
+    return idx;
+}
+
+/**
+ * Enter a value in a table.  If one of the same name is already
+ * present it is returned and the table is unchanged, otherwise val is
+ * returned (as with hash_table_enter()).
+ */
+static cmd_ln_val_t *
+cmd_ln_tbl_enter(cmd_ln_tbl_t *tbl, cmd_ln_val_t *val)
+{
+    int32 idx;
+
+    if ((idx = cmd_ln_tbl_find(tbl, val->name)) >= 0)
+        return tbl->vals[idx];
+    if (tbl->n_vals == tbl->n_alloc) {
+        tbl->n_alloc *= 2;
+        tbl->vals = (cmd_ln_val_t **)ckd_realloc(tbl->vals,
+                                                 tbl->n_alloc
+                                                 * sizeof(*tbl->vals));
+    }
+    tbl->vals[tbl->n_vals] = val;
+    hash_table_enter(tbl->ht, val->name, (void *)(long)tbl->n_vals);
+    ++tbl->n_vals;
+    return val;
+}
+
+/**
+ * Get a table for cmdln that nobody else shares, copying its values
+ * if they are currently shared with a clone.  The copy is made with
+ * the shared table locked, so that another sharer cannot see itself
+ * as the last one and start modifying it in place meanwhile.
+ */
+static cmd_ln_tbl_t *
+cmd_ln_tbl_writable(cmd_ln_t *cmdln, int32 size)
+{
+    cmd_ln_tbl_t *tbl, *shared;
+    int32 i;
+
+    if (cmdln->tbl == NULL)
+        return (cmdln->tbl = cmd_ln_tbl_init(size));
+
+    shared = cmdln->tbl;
+    sbmtx_lock(shared->mtx);
+    if (shared->refcount == 1) {
+        sbmtx_unlock(shared->mtx);
+        return shared;
+    }
+    tbl = cmd_ln_tbl_init(shared->n_alloc);
+    for (i = 0; i < shared->n_vals; ++i)
+        cmd_ln_tbl_enter(tbl, cmd_ln_val_copy(shared->vals[i]));
+    --shared->refcount;
+    sbmtx_unlock(shared->mtx);
+    return (cmdln->tbl = tbl);
+}
+
 /*
  * Handles option parsing for cmd_ln_parse_file_r() and cmd_ln_init()
  * also takes care of storing argv.
@@ -557,6 +712,7 @@ cmd_ln_parse_r(cmd_ln_t *inout_cmdln, const arg_t * defn, int32 argc, char *argv
 {
     int32 i, j, n, argstart;
     hash_table_t *defidx = NULL;
+    cmd_ln_tbl_t *tbl;
     cmd_ln_t *cmdln;
 
     /* Construct command-line object */
@@ -586,8 +742,7 @@ cmd_ln_parse_r(cmd_ln_t *inout_cmdln, const arg_t * defn, int32 argc, char *argv
     }
 
     /* Allocate memory for argument values */
-    if (cmdln->ht == NULL)
-        cmdln->ht = hash_table_new(n, 0 /* argument names are case-sensitive */ );
+    tbl = cmd_ln_tbl_writable(cmdln, n);
 
 
     /* skip argv[0] if it doesn't start with dash */
@@ -632,8 +787,7 @@ cmd_ln_parse_r(cmd_ln_t *inout_cmdln, const arg_t * defn, int32 argc, char *argv
             }
         }
 
-        if ((v = hash_table_enter(cmdln->ht, val->name, (void *)val)) !=
-            (void *)val)
+        if ((v = cmd_ln_tbl_enter(tbl, val)) != (void *)val)
         {
             if (strict) {
                 cmd_ln_val_free(val);
@@ -642,7 +796,10 @@ cmd_ln_parse_r(cmd_ln_t *inout_cmdln, const arg_t * defn, int32 argc, char *argv
                 goto error;
             }
             else {
-                v = hash_table_replace(cmdln->ht, val->name, (void *)val);
+                int32 idx = cmd_ln_tbl_find(tbl, val->name);
+                tbl->vals[idx] = val;
+                /* Also re-key it, since the old name is going away. */
+                hash_table_replace(tbl->ht, val->name, (void *)(long)idx);
                 cmd_ln_val_free((cmd_ln_val_t *)v);
             }
         }
@@ -651,16 +808,15 @@ cmd_ln_parse_r(cmd_ln_t *inout_cmdln, const arg_t * defn, int32 argc, char *argv
     /* Fill in default values, if any, for unspecified arguments */
     for (i = 0; i < n; i++) {
         cmd_ln_val_t *val;
-        void *v;
 
-        if (hash_table_lookup(cmdln->ht, defn[i].name, &v) < 0) {
+        if (cmd_ln_tbl_find(tbl, defn[i].name) < 0) {
             if ((val = cmd_ln_val_init(defn[i].type, defn[i].name, defn[i].deflt)) == NULL) {
                 E_ERROR
                     ("Bad default argument value for %s: %s\n",
                      defn[i].name, defn[i].deflt);
                 goto error;
             }
-            hash_table_enter(cmdln->ht, val->name, (void *)val);
+            cmd_ln_tbl_enter(tbl, val);
         }
     }
 
@@ -668,8 +824,7 @@ cmd_ln_parse_r(cmd_ln_t *inout_cmdln, const arg_t * defn, int32 argc, char *argv
     j = 0;
     for (i = 0; i < n; i++) {
         if (defn[i].type & ARG_REQUIRED) {
-            void *v;
-            if (hash_table_lookup(cmdln->ht, defn[i].name, &v) != 0)
+            if (cmd_ln_tbl_find(tbl, defn[i].name) < 0)
                 E_ERROR("Missing required argument %s\n", defn[i].name);
         }
     }
@@ -928,21 +1083,66 @@ cmd_ln_print_values_r(cmd_ln_t *cmdln, FILE *fp, arg_t const* defn)
 int
 cmd_ln_exists_r(cmd_ln_t *cmdln, const char *name)
 {
-    void *val;
     if (cmdln == NULL)
         return FALSE;
-    return (hash_table_lookup(cmdln->ht, name, &val) == 0);
+    return (cmd_ln_tbl_find(cmdln->tbl, name) >= 0);
 }
 
 anytype_t *
 cmd_ln_access_r(cmd_ln_t *cmdln, const char *name)
 {
-    void *val;
-    if (hash_table_lookup(cmdln->ht, name, &val) < 0) {
+    int32 idx;
+    if ((idx = cmd_ln_tbl_find(cmdln->tbl, name)) < 0) {
         E_ERROR("Unknown argument: %s\n", name);
         return NULL;
     }
-    return (anytype_t *)val;
+    return &cmdln->tbl->vals[idx]->val;
+}
+
+cmd_ln_key_t
+cmd_ln_key_r(cmd_ln_t *cmdln, char const *name)
+{
+    int32 idx;
+    if ((idx = cmd_ln_tbl_find(cmdln->tbl, name)) < 0) {
+        E_ERROR("Unknown argument: %s\n", name);
+        return CMD_LN_NO_KEY;
+    }
+    return idx;
+}
+
+anytype_t *
+cmd_ln_access_k(cmd_ln_t *cmdln, cmd_ln_key_t key)
+{
+    if (key < 0 || cmdln->tbl == NULL || key >= cmdln->tbl->n_vals)
+        return NULL;
+    return &cmdln->tbl->vals[key]->val;
+}
+
+char const *
+cmd_ln_str_k(cmd_ln_t *cmdln, cmd_ln_key_t key)
+{
+    anytype_t *val;
+    if ((val = cmd_ln_access_k(cmdln, key)) == NULL)
+        return NULL;
+    return (char const *)val->ptr;
+}
+
+long
+cmd_ln_int_k(cmd_ln_t *cmdln, cmd_ln_key_t key)
+{
+    anytype_t *val;
+    if ((val = cmd_ln_access_k(cmdln, key)) == NULL)
+        return 0L;
+    return val->i;
+}
+
+double
+cmd_ln_float_k(cmd_ln_t *cmdln, cmd_ln_key_t key)
+{
+    anytype_t *val;
+    if ((val = cmd_ln_access_k(cmdln, key)) == NULL)
+        return 0.0;
+    return val->fl;
 }
 
 char const *
@@ -989,6 +1189,7 @@ void
 cmd_ln_set_str_r(cmd_ln_t *cmdln, char const *name, char const *str)
 {
     anytype_t *val;
+    cmd_ln_tbl_writable(cmdln, 0);
     val = cmd_ln_access_r(cmdln, name);
     if (val == NULL) {
         E_ERROR("Unknown argument: %s\n", name);
@@ -1001,11 +1202,16 @@ cmd_ln_set_str_r(cmd_ln_t *cmdln, char const *name, char const *str)
 void
 cmd_ln_set_str_extra_r(cmd_ln_t *cmdln, char const *name, char const *str)
 {
+    cmd_ln_tbl_t *tbl;
     cmd_ln_val_t *val;
-    if (hash_table_lookup(cmdln->ht, name, (void **)&val) < 0) {
+    int32 idx;
+
+    tbl = cmd_ln_tbl_writable(cmdln, 0);
+    if ((idx = cmd_ln_tbl_find(tbl, name)) < 0) {
 	val = cmd_ln_val_init(ARG_STRING, name, str);
-	hash_table_enter(cmdln->ht, val->name, (void *)val);
+	cmd_ln_tbl_enter(tbl, val);
     } else {
+        val = tbl->vals[idx];
         ckd_free(val->val.ptr);
         val->val.ptr = ckd_salloc(str);
     }
@@ -1015,6 +1221,7 @@ void
 cmd_ln_set_int_r(cmd_ln_t *cmdln, char const *name, long iv)
 {
     anytype_t *val;
+    cmd_ln_tbl_writable(cmdln, 0);
     val = cmd_ln_access_r(cmdln, name);
     if (val == NULL) {
         E_ERROR("Unknown argument: %s\n", name);
@@ -1027,6 +1234,7 @@ void
 cmd_ln_set_float_r(cmd_ln_t *cmdln, char const *name, double fv)
 {
     anytype_t *val;
+    cmd_ln_tbl_writable(cmdln, 0);
     val = cmd_ln_access_r(cmdln, name);
     if (val == NULL) {
         E_ERROR("Unknown argument: %s\n", name);
@@ -1042,6 +1250,18 @@ cmd_ln_retain(cmd_ln_t *cmdln)
     return cmdln;
 }
 
+cmd_ln_t *
+cmd_ln_clone(cmd_ln_t *cmdln)
+{
+    cmd_ln_t *clone;
+
+    clone = (cmd_ln_t *)ckd_calloc(1, sizeof(*clone));
+    clone->refcount = 1;
+    if (cmdln->tbl != NULL)
+        clone->tbl = cmd_ln_tbl_retain(cmdln->tbl);
+    return clone;
+}
+
 int
 cmd_ln_free_r(cmd_ln_t *cmdln)
 {
@@ -1050,20 +1270,8 @@ cmd_ln_free_r(cmd_ln_t *cmdln)
     if (--cmdln->refcount > 0)
         return cmdln->refcount;
 
-    if (cmdln->ht) {
-        glist_t entries;
-        gnode_t *gn;
-        int32 n;
-
-        entries = hash_table_tolist(cmdln->ht, &n);
-        for (gn = entries; gn; gn = gnode_next(gn)) {
-            hash_entry_t *e = (hash_entry_t *)gnode_ptr(gn);
-            cmd_ln_val_free((cmd_ln_val_t *)e->val);
-        }
-        glist_free(entries);
-        hash_table_free(cmdln->ht);
-        cmdln->ht = NULL;
-    }
+    cmd_ln_tbl_free(cmdln->tbl);
+    cmdln->tbl = NULL;
 
     if (cmdln->f_argv) {
         int32 i;
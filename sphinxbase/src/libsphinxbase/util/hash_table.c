@@ -84,6 +84,10 @@
  */
 
 
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -97,136 +101,160 @@
 #include "sphinxbase/err.h"
 #include "sphinxbase/ckd_alloc.h"
 #include "sphinxbase/case.h"
+#include "sphinxbase/bitvec.h"
 
 
-#if 0
-static void
-prime_sieve(int32 max)
-{
-    char *notprime;
-    int32 p, pp;
-
-    notprime = (char *) ckd_calloc(max + 1, 1);
-    p = 2;
-    for (;;) {
-        printf("%d\n", p);
-        for (pp = p + p; pp <= max; pp += p)
-            notprime[pp] = 1;
-        for (++p; (p <= max) && notprime[p]; p++);
-        if (p > max)
-            break;
-    }
-}
+/*
+ * The table is open-addressed.  Besides the array of entries it keeps
+ * one control byte per slot: CTRL_EMPTY, CTRL_DELETED (a tombstone
+ * left by hash_table_delete()), or the low 7 bits of the hash of the
+ * key in the slot.  Lookups probe a group of GROUP_WIDTH control bytes
+ * at a time, comparing all of them with the key's 7 bits in a few
+ * word operations, and only compare keys for the slots that match.
+ * The first GROUP_WIDTH control bytes are repeated after the last
+ * one, so that a group can start at any slot.
+ */
+#define CTRL_EMPTY    0x80
+#define CTRL_DELETED  0xfe
+#define GROUP_WIDTH   8
+#define MIN_SIZE      16
+
+#define GROUP_LSB 0x0101010101010101ULL
+#define GROUP_MSB 0x8080808080808080ULL
+
+/* Top bit of byte i of a group, as loaded from memory. */
+#ifdef WORDS_BIGENDIAN
+#define GROUP_BIT(i) ((uint64)0x80 << (8 * (GROUP_WIDTH - 1 - (i))))
+#else
+#define GROUP_BIT(i) ((uint64)0x80 << (8 * (i)))
 #endif
 
+static uint64
+group_load(uint8 const *ctrl)
+{
+    uint64 g;
+    memcpy(&g, ctrl, sizeof(g));
+    return g;
+}
 
 /*
- * HACK!!  Initial hash table size is restricted by this set of primes.  (Of course,
- * collision resolution by chaining will accommodate more entries indefinitely, but
- * efficiency will drop.)
+ * Bytes of a group which may equal c (the top bit of each is set in
+ * the result).  There can be false positives next to a true match,
+ * which the key comparison weeds out.
  */
-const int32 prime[] = {
-    101, 211, 307, 401, 503, 601, 701, 809, 907,
-    1009, 1201, 1601, 2003, 2411, 3001, 4001, 5003, 6007, 7001, 8009,
-    9001,
-    10007, 12007, 16001, 20011, 24001, 30011, 40009, 50021, 60013,
-    70001, 80021, 90001,
-    100003, 120011, 160001, 200003, 240007, 300007, 400009, 500009,
-    600011, 700001, 800011, 900001,
-    -1
-};
+static uint64
+group_match(uint64 g, uint8 c)
+{
+    uint64 x = g ^ (GROUP_LSB * c);
+    return (x - GROUP_LSB) & ~x & GROUP_MSB;
+}
 
+/* Bytes of a group which are CTRL_EMPTY. */
+#define group_match_empty(g) ((g) & ~((g) << 6) & GROUP_MSB)
+/* Bytes of a group which are CTRL_EMPTY or CTRL_DELETED. */
+#define group_match_free(g) ((g) & ~((g) << 7) & GROUP_MSB)
 
-/**
- * This function returns a very large prime. 
- */
-static int32
-prime_size(int32 size)
+/* Index of the first byte set in a (non-zero) match. */
+static int
+group_first(uint64 m)
 {
-    int32 i;
+#if defined(__GNUC__) && !defined(WORDS_BIGENDIAN)
+    return __builtin_ctzll(m) >> 3;
+#elif defined(__GNUC__)
+    return __builtin_clzll(m) >> 3;
+#else
+    int i;
+    for (i = 0; !(m & GROUP_BIT(i)); ++i)
+        ;
+    return i;
+#endif
+}
 
-    for (i = 0; (prime[i] > 0) && (prime[i] < size); i++);
-    if (prime[i] <= 0) {
-        E_WARN("Very large hash table requested (%d entries)\n", size);
-        --i;
-    }
-    return (prime[i]);
+static void
+set_ctrl(hash_table_t * h, uint32 i, uint8 c)
+{
+    h->ctrl[i] = c;
+    if (i < GROUP_WIDTH)
+        h->ctrl[h->size + i] = c;
 }
 
+/* Number of slots which may be used before the table is rebuilt. */
+#define max_load(size) ((size) - (size) / 8)
+
+static void
+alloc_slots(hash_table_t * h, int32 size)
+{
+    h->size = size;
+    h->table = ckd_calloc(size, sizeof(*h->table));
+    h->ctrl = ckd_malloc(size + GROUP_WIDTH);
+    memset(h->ctrl, CTRL_EMPTY, size + GROUP_WIDTH);
+    h->n_deleted = 0;
+}
 
 hash_table_t *
 hash_table_new(int32 size, int32 casearg)
 {
     hash_table_t *h;
+    int32 n_slots;
 
     h = (hash_table_t *) ckd_calloc(1, sizeof(hash_table_t));
-    h->size = prime_size(size + (size >> 1));
     h->nocase = (casearg == HASH_CASE_NO);
-    h->table = (hash_entry_t *) ckd_calloc(h->size, sizeof(hash_entry_t));
-    /* The above calloc clears h->table[*].key and .next to NULL, i.e. an empty table */
+    for (n_slots = MIN_SIZE; max_load(n_slots) < size; n_slots <<= 1)
+        ;
+    alloc_slots(h, n_slots);
 
     return h;
 }
 
 
+#define INDEX_MUL 0x9e3779b97f4a7c15ULL
+
 /*
- * Compute hash value for given key string.
- * Somewhat tuned for English text word strings.
+ * 64-bit hash of a key, split into a bucket hash (h1) and a slot hash
+ * (h2), so that no displacement separates two keys only if all 64
+ * bits match.
+ * Case-sensitive keys are hashed a word at a time.
  */
-static uint32
-key2hash(hash_table_t * h, const char *key)
+static void
+index_hash(const char *key, size_t len, int32 nocase, uint32 seed,
+           uint32 *h1, uint32 *h2)
 {
+    uint64 h = (seed + 1) * INDEX_MUL ^ len;
+    uint64 w;
 
-    register const char *cp;
-
-    /* This is a hack because the best way to solve it is to make sure 
-       all character representation is unsigned character in the first place.        
-       (or better unicode.) */
-    register unsigned char c;
-    register int32 s;
-    register uint32 hash;
-
-    hash = 0;
-    s = 0;
-
-    if (h->nocase) {
-        for (cp = key; *cp; cp++) {
-            c = *cp;
-            c = UPPER_CASE(c);
-            hash += c << s;
-            s += 5;
-            if (s >= 25)
-                s -= 24;
+    if (nocase) {
+        for (; len > 0; --len) {
+            unsigned char c = *key++;
+            h = (h ^ (unsigned char) UPPER_CASE(c)) * INDEX_MUL;
         }
     }
     else {
-        for (cp = key; *cp; cp++) {
-            hash += (*cp) << s;
-            s += 5;
-            if (s >= 25)
-                s -= 24;
+        for (; len >= sizeof(w); len -= sizeof(w), key += sizeof(w)) {
+            memcpy(&w, key, sizeof(w));
+            h = (h ^ w) * INDEX_MUL;
+            h ^= h >> 29;
+        }
+        if (len > 0) {
+            w = 0;
+            memcpy(&w, key, len);
+            h = (h ^ w) * INDEX_MUL;
         }
     }
-
-    return (hash % h->size);
+    h ^= h >> 32;
+    h *= INDEX_MUL;
+    h ^= h >> 29;
+    *h1 = (uint32) (h >> 32);
+    *h2 = (uint32) h;
 }
 
-
-static char *
-makekey(uint8 * data, size_t len, char *key)
+/* Hash of a key for the table (not the index). */
+static uint32
+key2hash(hash_table_t * h, const char *key, size_t len)
 {
-    size_t i, j;
-
-    if (!key)
-        key = (char *) ckd_calloc(len * 2 + 1, sizeof(char));
+    uint32 h1, h2;
 
-    for (i = 0, j = 0; i < len; i++, j += 2) {
-        key[j] = 'A' + (data[i] & 0x000f);
-        key[j + 1] = 'J' + ((data[i] >> 4) & 0x000f);
-    }
-    key[j] = '\0';
-
-    return key;
+    index_hash(key, len, h->nocase, 0, &h1, &h2);
+    return h1;
 }
 
 
@@ -251,67 +279,302 @@ keycmp_nocase(hash_entry_t * entry, const char *key)
 }
 
 
+/*
+ * Find the slot holding key in table h.
+ * Return value: index of that slot, or -1 if key is not in the table.
+ */
 static int32
-keycmp_case(hash_entry_t * entry, const char *key)
+lookup(hash_table_t * h, uint32 hash, const char *key, size_t len)
 {
-    char c1, c2;
-    int32 i;
-    const char *str;
+    uint32 mask = h->size - 1;
+    uint32 pos = (hash >> 7) & mask;
+    uint32 step = 0;
 
-    str = entry->key;
-    for (i = 0; i < entry->len; i++) {
-        c1 = *(str++);
-        c2 = *(key++);
-        if (c1 != c2)
-            return (c1 - c2);
+    for (;;) {
+        uint64 g = group_load(h->ctrl + pos);
+        uint64 m;
+
+        for (m = group_match(g, hash & 0x7f); m; ) {
+            int i = group_first(m);
+            uint32 slot = (pos + i) & mask;
+            hash_entry_t *entry = &h->table[slot];
+
+            m &= ~GROUP_BIT(i);
+            if (h->ctrl[slot] == (hash & 0x7f)
+                && entry->hash == hash && entry->len == len
+                && (h->nocase ? keycmp_nocase(entry, key) == 0
+                    : memcmp(entry->key, key, len) == 0))
+                return slot;
+        }
+        if (group_match_empty(g))
+            return -1;
+        /* Triangular steps visit every group once. */
+        step += GROUP_WIDTH;
+        pos = (pos + step) & mask;
     }
+}
 
-    return 0;
+/* Find the first empty or deleted slot in the probe sequence of hash. */
+static uint32
+find_free(hash_table_t * h, uint32 hash)
+{
+    uint32 mask = h->size - 1;
+    uint32 pos = (hash >> 7) & mask;
+    uint32 step = 0;
+    uint64 m;
+
+    while ((m = group_match_free(group_load(h->ctrl + pos))) == 0) {
+        step += GROUP_WIDTH;
+        pos = (pos + step) & mask;
+    }
+    return (pos + group_first(m)) & mask;
+}
+
+/*
+ * Move all entries into a table of the given size, dropping the
+ * tombstones.  Entries keep their hashes, so no key is rehashed.
+ */
+static void
+resize(hash_table_t * h, int32 size)
+{
+    hash_entry_t *table = h->table;
+    uint8 *ctrl = h->ctrl;
+    int32 i, old_size = h->size;
+
+    alloc_slots(h, size);
+    for (i = 0; i < old_size; ++i) {
+        uint32 slot;
+
+        if (ctrl[i] & CTRL_EMPTY)
+            continue;
+        slot = find_free(h, table[i].hash);
+        h->table[slot] = table[i];
+        set_ctrl(h, slot, ctrl[i]);
+    }
+    ckd_free(table);
+    ckd_free(ctrl);
 }
 
 
 /*
- * Lookup entry with hash-value hash in table h for given key
- * Return value: hash_entry_t for key
+ * Perfect hash index over the entries of a table ("hash, displace"
+ * construction).  Keys are spread over buckets of about
+ * INDEX_BUCKET_KEYS keys each, and each bucket gets the smallest
+ * displacement which places all its keys in free slots.  Slots hold
+ * copies of the table's keys and values, so that a lookup touches only
+ * the slot and the key.
  */
-static hash_entry_t *
-lookup(hash_table_t * h, uint32 hash, const char *key, size_t len)
+typedef struct index_slot_s {
+    const char *key;       /**< Key string, NULL if this slot is empty */
+    void *val;             /**< Value associated with key */
+} index_slot_t;
+
+struct hash_index_s {
+    index_slot_t *slots;   /**< Entry for each slot */
+    uint32 n_slots;        /**< Number of slots (a power of 2) */
+    uint32 *disp;          /**< Displacement for each bucket */
+    uint32 n_buckets;      /**< Number of buckets */
+    uint32 seed;           /**< Seed which gave a perfect hash */
+    int32 n_keys;          /**< Number of entries indexed */
+};
+
+#define INDEX_BUCKET_KEYS 4
+#define INDEX_MAX_SEEDS 8
+
+/* Map a hash onto buckets without a division. */
+#define index_bucket(idx, h1) \
+    ((uint32) (((uint64) (h1) * (idx)->n_buckets) >> 32))
+/* Steps are odd, so every slot is reachable by some displacement. */
+#define index_slot(idx, h1, h2, d) \
+    (((h2) + (d) * ((h1) | 1)) & ((idx)->n_slots - 1))
+
+static void
+index_free(struct hash_index_s *idx)
 {
-    hash_entry_t *entry;
+    if (idx == NULL)
+        return;
+    ckd_free(idx->slots);
+    ckd_free(idx->disp);
+    ckd_free(idx);
+}
 
-    entry = &(h->table[hash]);
-    if (entry->key == NULL)
-        return NULL;
+/* Try to place all entries with one seed. */
+static int
+index_build(struct hash_index_s *idx, hash_entry_t **ents, int32 n,
+            int32 nocase, uint32 *h1, uint32 *h2, uint32 *tmp)
+{
+    uint32 *start, *order, *by_size, *slots;
+    uint32 i, j, b, max_size;
+    bitvec_t *taken;
+    int rv = -1;
+
+    for (i = 0; i < n; ++i)
+        index_hash(ents[i]->key, ents[i]->len, nocase, idx->seed,
+                   &h1[i], &h2[i]);
+
+    /* Group entries by bucket (start[b] .. start[b+1] in tmp). */
+    start = ckd_calloc(idx->n_buckets + 1, sizeof(*start));
+    for (i = 0; i < n; ++i)
+        ++start[index_bucket(idx, h1[i]) + 1];
+    max_size = 0;
+    for (b = 0; b < idx->n_buckets; ++b) {
+        if (start[b + 1] > max_size)
+            max_size = start[b + 1];
+        start[b + 1] += start[b];
+    }
+    order = ckd_calloc(idx->n_buckets + 1, sizeof(*order));
+    memcpy(order, start, idx->n_buckets * sizeof(*order));
+    for (i = 0; i < n; ++i)
+        tmp[order[index_bucket(idx, h1[i])]++] = i;
+
+    /* Place the largest buckets first, while most slots are free. */
+    by_size = ckd_calloc(max_size + 2, sizeof(*by_size));
+    for (b = 0; b < idx->n_buckets; ++b)
+        ++by_size[max_size - (start[b + 1] - start[b]) + 1];
+    for (i = 0; i <= max_size; ++i)
+        by_size[i + 1] += by_size[i];
+    for (b = 0; b < idx->n_buckets; ++b)
+        order[by_size[max_size - (start[b + 1] - start[b])]++] = b;
+
+    taken = bitvec_alloc(idx->n_slots);
+    slots = ckd_calloc(max_size + 1, sizeof(*slots));
+    for (i = 0; i < idx->n_buckets; ++i) {
+        uint32 size, d;
+
+        b = order[i];
+        size = start[b + 1] - start[b];
+        if (size == 0)
+            break;
+        for (d = 0; d < idx->n_slots; ++d) {
+            for (j = 0; j < size; ++j) {
+                uint32 k = tmp[start[b] + j], l;
+                slots[j] = index_slot(idx, h1[k], h2[k], d);
+                if (bitvec_is_set(taken, slots[j]))
+                    break;
+                for (l = 0; l < j; ++l)
+                    if (slots[l] == slots[j])
+                        break;
+                if (l < j)
+                    break;
+            }
+            if (j == size)
+                break;
+        }
+        if (d == idx->n_slots)
+            goto error_out;
+        idx->disp[b] = d;
+        for (j = 0; j < size; ++j) {
+            bitvec_set(taken, slots[j]);
+            idx->slots[slots[j]].key = ents[tmp[start[b] + j]]->key;
+            idx->slots[slots[j]].val = ents[tmp[start[b] + j]]->val;
+        }
+    }
+    rv = 0;
+
+error_out:
+    bitvec_free(taken);
+    ckd_free(slots);
+    ckd_free(by_size);
+    ckd_free(order);
+    ckd_free(start);
+    return rv;
+}
+
+int32
+hash_table_freeze(hash_table_t * h)
+{
+    struct hash_index_s *idx;
+    hash_entry_t **ents;
+    hash_iter_t *itor;
+    uint32 *h1, *h2, *tmp;
+    int32 n;
+
+    index_free(h->index);
+    h->index = NULL;
+    if (h->inuse == 0)
+        return -1;
 
-    if (h->nocase) {
-        while (entry && ((entry->len != len)
-                         || (keycmp_nocase(entry, key) != 0)))
-            entry = entry->next;
+    n = 0;
+    ents = ckd_calloc(h->inuse, sizeof(*ents));
+    for (itor = hash_table_iter(h); itor; itor = hash_table_iter_next(itor))
+        ents[n++] = itor->ent;
+    assert(n == h->inuse);
+
+    idx = ckd_calloc(1, sizeof(*idx));
+    idx->n_keys = n;
+    idx->n_buckets = n / INDEX_BUCKET_KEYS + 1;
+    for (idx->n_slots = 2; idx->n_slots < n + n / 16; idx->n_slots <<= 1)
+        ;
+    idx->slots = ckd_calloc(idx->n_slots, sizeof(*idx->slots));
+    idx->disp = ckd_calloc(idx->n_buckets, sizeof(*idx->disp));
+    h1 = ckd_calloc(n, sizeof(*h1));
+    h2 = ckd_calloc(n, sizeof(*h2));
+    tmp = ckd_calloc(n, sizeof(*tmp));
+    for (idx->seed = 0; idx->seed < INDEX_MAX_SEEDS; ++idx->seed) {
+        if (index_build(idx, ents, n, h->nocase, h1, h2, tmp) == 0) {
+            h->index = idx;
+            break;
+        }
+        memset(idx->slots, 0, idx->n_slots * sizeof(*idx->slots));
     }
-    else {
-        while (entry && ((entry->len != len)
-                         || (keycmp_case(entry, key) != 0)))
-            entry = entry->next;
+    if (h->index == NULL) {
+        E_WARN("Failed to build perfect hash for %d keys\n", n);
+        index_free(idx);
     }
+    ckd_free(tmp);
+    ckd_free(h2);
+    ckd_free(h1);
+    ckd_free(ents);
+    return h->index ? 0 : -1;
+}
 
-    return entry;
+static void
+thaw(hash_table_t * h)
+{
+    index_free(h->index);
+    h->index = NULL;
 }
 
+static index_slot_t *
+index_lookup(hash_table_t * h, const char *key, size_t len)
+{
+    struct hash_index_s *idx = h->index;
+    index_slot_t *slot;
+    uint32 h1, h2;
+
+    index_hash(key, len, h->nocase, idx->seed, &h1, &h2);
+    slot = &idx->slots[index_slot(idx, h1, h2,
+                                  idx->disp[index_bucket(idx, h1)])];
+    if (slot->key == NULL)
+        return NULL;
+    if (h->nocase ? strcmp_nocase(slot->key, key) : strcmp(slot->key, key))
+        return NULL;
+    return slot;
+}
 
 int32
 hash_table_lookup(hash_table_t * h, const char *key, void ** val)
 {
-    hash_entry_t *entry;
-    uint32 hash;
+    int32 slot;
     size_t len;
 
-    hash = key2hash(h, key);
     len = strlen(key);
+    if (h->index) {
+        index_slot_t *islot;
 
-    entry = lookup(h, hash, key, len);
-    if (entry) {
+        if ((islot = index_lookup(h, key, len)) != NULL) {
+            if (val)
+                *val = islot->val;
+            return 0;
+        }
+        /* Keys entered since the index was built are in the table. */
+        if (h->inuse == h->index->n_keys)
+            return -1;
+    }
+    slot = lookup(h, key2hash(h, key, len), key, len);
+    if (slot >= 0) {
         if (val)
-            *val = entry->val;
+            *val = h->table[slot].val;
         return 0;
     }
     else
@@ -336,18 +599,12 @@ hash_table_lookup_int32(hash_table_t * h, const char *key, int32 *val)
 int32
 hash_table_lookup_bkey(hash_table_t * h, const char *key, size_t len, void ** val)
 {
-    hash_entry_t *entry;
-    uint32 hash;
-    char *str;
-
-    str = makekey((uint8 *) key, len, NULL);
-    hash = key2hash(h, str);
-    ckd_free(str);
+    int32 slot;
 
-    entry = lookup(h, hash, key, len);
-    if (entry) {
+    slot = lookup(h, key2hash(h, key, len), key, len);
+    if (slot >= 0) {
         if (val)
-            *val = entry->val;
+            *val = h->table[slot].val;
         return 0;
     }
     else
@@ -372,11 +629,13 @@ hash_table_lookup_bkey_int32(hash_table_t * h, const char *key, size_t len, int3
 static void *
 enter(hash_table_t * h, uint32 hash, const char *key, size_t len, void *val, int32 replace)
 {
-    hash_entry_t *cur, *new;
+    hash_entry_t *cur;
+    int32 slot;
 
-    if ((cur = lookup(h, hash, key, len)) != NULL) {
+    if ((slot = lookup(h, hash, key, len)) >= 0) {
         void *oldval;
         /* Key already exists. */
+        cur = &h->table[slot];
         oldval = cur->val;
         if (replace) {
             /* Replace the pointer if replacement is requested,
@@ -384,30 +643,35 @@ enter(hash_table_t * h, uint32 hash, const char *key, size_t len, void *val, int
              * string (this verges on magic, sorry) */
             cur->key = key;
             cur->val = val;
+            if (h->index) {
+                index_slot_t *islot;
+
+                if ((islot = index_lookup(h, key, len)) != NULL) {
+                    islot->key = key;
+                    islot->val = val;
+                }
+            }
         }
         return oldval;
     }
 
-    cur = &(h->table[hash]);
-    if (cur->key == NULL) {
-        /* Empty slot at hashed location; add this entry */
-        cur->key = key;
-        cur->len = len;
-        cur->val = val;
-
-        /* Added by ARCHAN at 20050515. This allows deletion could work. */
-        cur->next = NULL;
-
-    }
-    else {
-        /* Key collision; create new entry and link to hashed location */
-        new = (hash_entry_t *) ckd_calloc(1, sizeof(hash_entry_t));
-        new->key = key;
-        new->len = len;
-        new->val = val;
-        new->next = cur->next;
-        cur->next = new;
+    if (h->inuse + h->n_deleted >= max_load(h->size)) {
+        /* Grow if the table is really full, otherwise just sweep
+         * out the tombstones. */
+        if (h->inuse >= max_load(h->size) / 2)
+            resize(h, h->size * 2);
+        else
+            resize(h, h->size);
     }
+    slot = find_free(h, hash);
+    if (h->ctrl[slot] == CTRL_DELETED)
+        --h->n_deleted;
+    cur = &h->table[slot];
+    cur->key = key;
+    cur->len = len;
+    cur->val = val;
+    cur->hash = hash;
+    set_ctrl(h, slot, hash & 0x7f);
     ++h->inuse;
 
     return val;
@@ -417,64 +681,19 @@ enter(hash_table_t * h, uint32 hash, const char *key, size_t len, void *val, int
 static void *
 delete(hash_table_t * h, uint32 hash, const char *key, size_t len)
 {
-    hash_entry_t *entry, *prev;
+    int32 slot;
     void *val;
 
-    prev = NULL;
-    entry = &(h->table[hash]);
-    if (entry->key == NULL)
+    if ((slot = lookup(h, hash, key, len)) < 0)
         return NULL;
 
-    if (h->nocase) {
-        while (entry && ((entry->len != len)
-                         || (keycmp_nocase(entry, key) != 0))) {
-            prev = entry;
-            entry = entry->next;
-        }
-    }
-    else {
-        while (entry && ((entry->len != len)
-                         || (keycmp_case(entry, key) != 0))) {
-            prev = entry;
-            entry = entry->next;
-        }
-    }
-
-    if (entry == NULL)
-        return NULL;
-
-    /* At this point, entry will be the one required to be deleted, prev
-       will contain the previous entry
-     */
-    val = entry->val;
-
-    if (prev == NULL) {
-        /* That is to say the entry in the hash table (not the chain) matched the key. */
-        /* We will then copy the things from the next entry to the hash table */
-        prev = entry;
-        if (entry->next) {      /* There is a next entry, great, copy it. */
-            entry = entry->next;
-            prev->key = entry->key;
-            prev->len = entry->len;
-            prev->val = entry->val;
-            prev->next = entry->next;
-            ckd_free(entry);
-        }
-        else {                  /* There is not a next entry, just set the key to null */
-            prev->key = NULL;
-            prev->len = 0;
-            prev->next = NULL;
-        }
-
-    }
-    else {                      /* This case is simple */
-        prev->next = entry->next;
-        ckd_free(entry);
-    }
-
-    /* Do wiring and free the entry */
-
+    val = h->table[slot].val;
+    memset(&h->table[slot], 0, sizeof(h->table[slot]));
+    /* Leave a tombstone so that probes for other keys go past it. */
+    set_ctrl(h, slot, CTRL_DELETED);
+    ++h->n_deleted;
     --h->inuse;
+    thaw(h);
 
     return val;
 }
@@ -482,92 +701,57 @@ delete(hash_table_t * h, uint32 hash, const char *key, size_t len)
 void
 hash_table_empty(hash_table_t *h)
 {
-    hash_entry_t *e, *e2;
-    int32 i;
-
-    for (i = 0; i < h->size; i++) {
-        /* Free collision lists. */
-        for (e = h->table[i].next; e; e = e2) {
-            e2 = e->next;
-            ckd_free((void *) e);
-        }
-        memset(&h->table[i], 0, sizeof(h->table[i]));
-    }
+    memset(h->table, 0, h->size * sizeof(*h->table));
+    memset(h->ctrl, CTRL_EMPTY, h->size + GROUP_WIDTH);
     h->inuse = 0;
+    h->n_deleted = 0;
+    thaw(h);
 }
 
 
 void *
 hash_table_enter(hash_table_t * h, const char *key, void *val)
 {
-    uint32 hash;
     size_t len;
 
-    hash = key2hash(h, key);
     len = strlen(key);
-    return (enter(h, hash, key, len, val, 0));
+    return (enter(h, key2hash(h, key, len), key, len, val, 0));
 }
 
 void *
 hash_table_replace(hash_table_t * h, const char *key, void *val)
 {
-    uint32 hash;
     size_t len;
 
-    hash = key2hash(h, key);
     len = strlen(key);
-    return (enter(h, hash, key, len, val, 1));
+    return (enter(h, key2hash(h, key, len), key, len, val, 1));
 }
 
 void *
 hash_table_delete(hash_table_t * h, const char *key)
 {
-    uint32 hash;
     size_t len;
 
-    hash = key2hash(h, key);
     len = strlen(key);
-
-    return (delete(h, hash, key, len));
+    return (delete(h, key2hash(h, key, len), key, len));
 }
 
 void *
 hash_table_enter_bkey(hash_table_t * h, const char *key, size_t len, void *val)
 {
-    uint32 hash;
-    char *str;
-
-    str = makekey((uint8 *) key, len, NULL);
-    hash = key2hash(h, str);
-    ckd_free(str);
-
-    return (enter(h, hash, key, len, val, 0));
+    return (enter(h, key2hash(h, key, len), key, len, val, 0));
 }
 
 void *
 hash_table_replace_bkey(hash_table_t * h, const char *key, size_t len, void *val)
 {
-    uint32 hash;
-    char *str;
-
-    str = makekey((uint8 *) key, len, NULL);
-    hash = key2hash(h, str);
-    ckd_free(str);
-
-    return (enter(h, hash, key, len, val, 1));
+    return (enter(h, key2hash(h, key, len), key, len, val, 1));
 }
 
 void *
 hash_table_delete_bkey(hash_table_t * h, const char *key, size_t len)
 {
-    uint32 hash;
-    char *str;
-
-    str = makekey((uint8 *) key, len, NULL);
-    hash = key2hash(h, str);
-    ckd_free(str);
-
-    return (delete(h, hash, key, len));
+    return (delete(h, key2hash(h, key, len), key, len));
 }
 
 void
@@ -577,35 +761,19 @@ hash_table_display(hash_table_t * h, int32 showdisplay)
     int i, j;
     j = 0;
 
-    printf("Hash with chaining representation of the hash table\n");
+    printf("Open addressing representation of the hash table\n");
 
     for (i = 0; i < h->size; i++) {
+        if (h->ctrl[i] & CTRL_EMPTY)
+            continue;
         e = &(h->table[i]);
-        if (e->key != NULL) {
-            printf("|key:");
-            if (showdisplay)
-                printf("%s", e->key);
-            else
-                printf("%p", e->key);
-
-            printf("|len:%zd|val=%ld|->", e->len, (long)e->val);
-            if (e->next == NULL) {
-                printf("NULL\n");
-            }
-            j++;
-
-            for (e = e->next; e; e = e->next) {
-                printf("|key:");
-                if (showdisplay)
-                    printf("%s", e->key);
-
-                printf("|len:%zd|val=%ld|->", e->len, (long)e->val);
-                if (e->next == NULL) {
-                    printf("NULL\n");
-                }
-                j++;
-            }
-        }
+        printf("|slot:%d|key:", i);
+        if (showdisplay)
+            printf("%s", e->key);
+        else
+            printf("%p", e->key);
+        printf("|len:%zd|val=%ld|\n", e->len, (long)e->val);
+        j++;
     }
 
     printf("The total number of keys =%d\n", j);
@@ -616,23 +784,15 @@ glist_t
 hash_table_tolist(hash_table_t * h, int32 * count)
 {
     glist_t g;
-    hash_entry_t *e;
     int32 i, j;
 
     g = NULL;
 
     j = 0;
     for (i = 0; i < h->size; i++) {
-        e = &(h->table[i]);
-
-        if (e->key != NULL) {
-            g = glist_add_ptr(g, (void *) e);
+        if (!(h->ctrl[i] & CTRL_EMPTY)) {
+            g = glist_add_ptr(g, (void *) &h->table[i]);
             j++;
-
-            for (e = e->next; e; e = e->next) {
-                g = glist_add_ptr(g, (void *) e);
-                j++;
-            }
         }
     }
 
@@ -655,26 +815,20 @@ hash_table_iter(hash_table_t *h)
 hash_iter_t *
 hash_table_iter_next(hash_iter_t *itor)
 {
-	/* If there is an entry, walk down its list. */
-	if (itor->ent)
-		itor->ent = itor->ent->next;
-	/* If we got to the end of the chain, or we had no entry, scan
-	 * forward in the table to find the next non-empty bucket. */
-	if (itor->ent == NULL) {
-		while (itor->idx < itor->ht->size
-		       && itor->ht->table[itor->idx].key == NULL) 
-			++itor->idx;
-		/* If we did not find one then delete the iterator and
-		 * return NULL. */
-		if (itor->idx == itor->ht->size) {
-			hash_table_iter_free(itor);
-			return NULL;
-		}
-		/* Otherwise use this next entry. */
-		itor->ent = itor->ht->table + itor->idx;
-		/* Increase idx for the next time around. */
+	/* Scan forward in the table to find the next full slot. */
+	while (itor->idx < itor->ht->size
+	       && (itor->ht->ctrl[itor->idx] & CTRL_EMPTY))
 		++itor->idx;
+	/* If we did not find one then delete the iterator and
+	 * return NULL. */
+	if (itor->idx == itor->ht->size) {
+		hash_table_iter_free(itor);
+		return NULL;
 	}
+	/* Otherwise use this entry. */
+	itor->ent = itor->ht->table + itor->idx;
+	/* Increase idx for the next time around. */
+	++itor->idx;
 	return itor;
 }
 
@@ -687,20 +841,24 @@ hash_table_iter_free(hash_iter_t *itor)
 void
 hash_table_free(hash_table_t * h)
 {
-    hash_entry_t *e, *e2;
-    int32 i;
-
     if (h == NULL)
         return;
 
-    /* Free additional entries created for key collision cases */
-    for (i = 0; i < h->size; i++) {
-        for (e = h->table[i].next; e; e = e2) {
-            e2 = e->next;
-            ckd_free((void *) e);
-        }
-    }
-
+    index_free(h->index);
+    ckd_free((void *) h->ctrl);
     ckd_free((void *) h->table);
     ckd_free((void *) h);
 }
+
+size_t
+hash_table_mem_size(hash_table_t * h)
+{
+    size_t size;
+
+    size = sizeof(*h) + h->size * sizeof(*h->table) + h->size + GROUP_WIDTH;
+    if (h->index)
+        size += sizeof(*h->index)
+            + h->index->n_slots * sizeof(*h->index->slots)
+            + h->index->n_buckets * sizeof(*h->index->disp);
+    return size;
+}
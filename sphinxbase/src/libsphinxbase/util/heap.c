@@ -72,41 +72,30 @@
 #include "sphinxbase/ckd_alloc.h"
 
 /**
- * One node on the heap
+ * One item on the heap
  */
 typedef struct heapnode_s {
-    void *data;                 /**< Application data at this node */
-    int32 val;                  /**< Associated with above application data; according to which
+    int32 val;                  /**< Associated with data; according to which
                                    heap is sorted (in ascending order) */
-    int32 nl, nr;               /**< left/right descendants of this node (for balancing heap) */
-    struct heapnode_s *l;       /**< Root of left descendant heap */
-    struct heapnode_s *r;       /**< Root of right descendant heap */
+    void *data;                 /**< Application data at this node */
 } heapnode_t;
 
 /**
  * Internal heap data structure.
+ *
+ * This is an implicit 4-ary heap: the children of item i are items
+ * 4i+1 to 4i+4.  This is shallower than a binary heap, and all the
+ * children compared when popping an item are next to each other.
  */
 struct heap_s {
-    heapnode_t *top;
+    heapnode_t *nodes;
+    size_t n_nodes;
+    size_t n_alloc;
 };
 
-
-#if 0
-static void
-heap_dump(heapnode_t * top, int32 level)
-{
-    int32 i;
-
-    if (!top)
-        return;
-
-    for (i = 0; i < level; i++)
-        printf("  ");
-    /* print top info */
-    heap_dump(top->l, level + 1);
-    heap_dump(top->r, level + 1);
-}
-#endif
+#define HEAP_ARITY 4
+#define HEAP_PARENT(i) (((i) - 1) / HEAP_ARITY)
+#define HEAP_CHILD(i) ((i) * HEAP_ARITY + 1)
 
 
 heap_t *
@@ -117,102 +106,117 @@ heap_new(void)
 }
 
 
-static heapnode_t *
-subheap_insert(heapnode_t * root, void *data, int32 val)
+/* Move an item up from position i until its parent is no greater. */
+static void
+heap_sift_up(heap_t *heap, size_t i, heapnode_t node)
 {
-    heapnode_t *h;
-    void *tmpdata;
-    int32 tmpval;
-
-    if (!root) {
-        h = (heapnode_t *) ckd_calloc(1, sizeof(heapnode_t));
-        h->data = data;
-        h->val = val;
-        h->l = h->r = NULL;
-        h->nl = h->nr = 0;
-        return h;
+    while (i > 0) {
+        size_t p = HEAP_PARENT(i);
+        if (heap->nodes[p].val <= node.val)
+            break;
+        heap->nodes[i] = heap->nodes[p];
+        i = p;
     }
+    heap->nodes[i] = node;
+}
 
-    /* Root already exists; if new value is less, replace root node */
-    if (root->val > val) {
-        tmpdata = root->data;
-        tmpval = root->val;
-        root->data = data;
-        root->val = val;
-        data = tmpdata;
-        val = tmpval;
-    }
 
-    /* Insert new or old (replaced) node in right or left subtree; keep them balanced */
-    if (root->nl > root->nr) {
-        root->r = subheap_insert(root->r, data, val);
-        root->nr++;
-    }
-    else {
-        root->l = subheap_insert(root->l, data, val);
-        root->nl++;
+/* Move an item down from position i until its children are no less. */
+static void
+heap_sift_down(heap_t *heap, size_t i, heapnode_t node)
+{
+    heapnode_t *nodes = heap->nodes;
+    size_t n = heap->n_nodes;
+
+    for (;;) {
+        size_t c = HEAP_CHILD(i), best, end;
+
+        if (c >= n)
+            break;
+        end = c + HEAP_ARITY < n ? c + HEAP_ARITY : n;
+        for (best = c++; c < end; ++c)
+            if (nodes[c].val < nodes[best].val)
+                best = c;
+        if (nodes[best].val >= node.val)
+            break;
+        nodes[i] = nodes[best];
+        i = best;
     }
+    nodes[i] = node;
+}
 
-    return root;
+
+static void
+heap_grow(heap_t *heap, size_t n)
+{
+    if (heap->n_nodes + n <= heap->n_alloc)
+        return;
+    heap->n_alloc = heap->n_alloc ? heap->n_alloc * 2 : 16;
+    if (heap->n_alloc < heap->n_nodes + n)
+        heap->n_alloc = heap->n_nodes + n;
+    heap->nodes = ckd_realloc(heap->nodes,
+                              heap->n_alloc * sizeof(*heap->nodes));
 }
 
 
 int
 heap_insert(heap_t *heap, void *data, int32 val)
 {
-    heap->top = subheap_insert(heap->top, data, val);
+    heapnode_t node;
+
+    heap_grow(heap, 1);
+    node.data = data;
+    node.val = val;
+    heap_sift_up(heap, heap->n_nodes++, node);
     return 0;
 }
 
 
-static heapnode_t *
-subheap_pop(heapnode_t * root)
+int
+heap_insert_n(heap_t *heap, void **data, int32 const *val, size_t n)
 {
-    heapnode_t *l, *r;
-
-    /* Propagate best value from below into root, if any */
-    l = root->l;
-    r = root->r;
-
-    if (!l) {
-        if (!r) {
-            ckd_free((char *) root);
-            return NULL;
-        }
-        else {
-            root->data = r->data;
-            root->val = r->val;
-            root->r = subheap_pop(r);
-            root->nr--;
-        }
+    size_t i;
+
+    heap_grow(heap, n);
+    for (i = 0; i < n; ++i) {
+        heap->nodes[heap->n_nodes + i].data = data[i];
+        heap->nodes[heap->n_nodes + i].val = val[i];
     }
-    else {
-        if ((!r) || (l->val < r->val)) {
-            root->data = l->data;
-            root->val = l->val;
-            root->l = subheap_pop(l);
-            root->nl--;
-        }
-        else {
-            root->data = r->data;
-            root->val = r->val;
-            root->r = subheap_pop(r);
-            root->nr--;
-        }
+    heap->n_nodes += n;
+    /* Heapify everything from the bottom up, in linear time. */
+    if (heap->n_nodes > 1) {
+        i = HEAP_PARENT(heap->n_nodes - 1) + 1;
+        while (i-- > 0)
+            heap_sift_down(heap, i, heap->nodes[i]);
     }
+    return 0;
+}
 
-    return root;
+
+/* Take out the item at position i. */
+static void
+heap_delete(heap_t *heap, size_t i)
+{
+    heapnode_t last;
+
+    last = heap->nodes[--heap->n_nodes];
+    if (i == heap->n_nodes)
+        return;
+    if (i > 0 && heap->nodes[HEAP_PARENT(i)].val > last.val)
+        heap_sift_up(heap, i, last);
+    else
+        heap_sift_down(heap, i, last);
 }
 
 
 int
 heap_pop(heap_t *heap, void **data, int32 * val)
 {
-    if (heap->top == NULL)
+    if (heap->n_nodes == 0)
         return 0;
-    *data = heap->top->data;
-    *val = heap->top->val;
-    heap->top = subheap_pop(heap->top);
+    *data = heap->nodes[0].data;
+    *val = heap->nodes[0].val;
+    heap_delete(heap, 0);
     return 1;
 }
 
@@ -220,72 +224,66 @@ heap_pop(heap_t *heap, void **data, int32 * val)
 int
 heap_top(heap_t *heap, void **data, int32 * val)
 {
-    if (heap->top == NULL)
+    if (heap->n_nodes == 0)
         return 0;
-    *data = heap->top->data;
-    *val = heap->top->val;
+    *data = heap->nodes[0].data;
+    *val = heap->nodes[0].val;
     return 1;
 }
 
-static int
-heap_remove_one(heap_t *heap, heapnode_t *top, void *data)
+
+static size_t
+heap_find(heap_t *heap, void *data)
 {
-    if (top == NULL)
-        return -1;
-    else if (top->data == data) {
-        assert(top == heap->top);
-        heap->top = subheap_pop(heap->top);
-        return 0;
-    }
-    if (top->l) {
-        if (top->l->data == data) {
-            top->l = subheap_pop(top->l);
-            --top->nl;
-            return 0;
-        }
-        else if (heap_remove_one(heap, top->l, data) == 0) {
-            --top->nl;
-            return 0;
-        }
-    }
-    if (top->r) {
-        if (top->r->data == data) {
-            top->r = subheap_pop(top->r);
-            --top->nr;
-            return 0;
-        }
-        else if (heap_remove_one(heap, top->r, data) == 0) {
-            --top->nr;
-            return 0;
-        }
-    }
-    return -1;
+    size_t i;
+
+    for (i = 0; i < heap->n_nodes; ++i)
+        if (heap->nodes[i].data == data)
+            break;
+    return i;
 }
 
 int
 heap_remove(heap_t *heap, void *data)
 {
-    return heap_remove_one(heap, heap->top, data);
+    size_t i;
+
+    if ((i = heap_find(heap, data)) == heap->n_nodes)
+        return -1;
+    heap_delete(heap, i);
+    return 0;
+}
+
+
+int
+heap_update(heap_t *heap, void *data, int32 val)
+{
+    heapnode_t node;
+    size_t i;
+
+    if ((i = heap_find(heap, data)) == heap->n_nodes)
+        return -1;
+    node.data = data;
+    node.val = val;
+    if (val < heap->nodes[i].val)
+        heap_sift_up(heap, i, node);
+    else
+        heap_sift_down(heap, i, node);
+    return 0;
 }
 
 
 size_t
 heap_size(heap_t *heap)
 {
-    if (heap->top == NULL)
-        return 0;
-    return heap->top->nl + heap->top->nr + 1;
+    return heap->n_nodes;
 }
 
 int
 heap_destroy(heap_t *heap)
 {
-    void *data;
-    int32 val;
-
-    /* Empty the heap and free it */
-    while (heap_pop(heap, &data, &val) > 0)
-        ;
+    /* Free the heap; the data belongs to the caller */
+    ckd_free(heap->nodes);
     ckd_free(heap);
 
     return 0;
@@ -42,6 +42,7 @@
 #include "sphinxbase/ckd_alloc.h"
 #include "sphinxbase/listelem_alloc.h"
 #include "sphinxbase/glist.h"
+#include "sphinxbase/sbthread.h"
 
 /**
  * Fast linked list allocator.
@@ -61,6 +62,10 @@
  * have to add a linked list of block pointers.  This shouldn't create
  * much overhead since we never access it except when freeing the
  * allocator.
+ *
+ * Threads share an allocator through caches (listelem_cache_t), each
+ * of which keeps its own freelist and only takes the allocator's lock
+ * to move a batch of elements to or from the shared freelist.
  */
 struct listelem_alloc_s {
     char **freelist;            /**< ptr to first element in freelist */
@@ -71,11 +76,23 @@ struct listelem_alloc_s {
     size_t n_blocks;
     size_t n_alloc;
     size_t n_freed;
+    sbmtx_t *mtx;               /**< Lock for caches */
+    int32 generation;           /**< Incremented by listelem_alloc_reset() */
+};
+
+struct listelem_cache_s {
+    listelem_alloc_t *list;     /**< Allocator shared with other caches */
+    char **freelist;            /**< This thread's free elements */
+    size_t n_free;              /**< Number of elements in freelist */
+    size_t n_alloc;             /**< Allocations not yet added to list */
+    size_t n_freed;             /**< Frees not yet added to list */
+    int32 generation;           /**< Generation of list for freelist */
 };
 
 #define MIN_ALLOC	50      /**< Minimum number of elements to allocate in one block */
 #define BLKID_SHIFT     16      /**< Bit position of block number in element ID */
 #define BLKID_MASK ((1<<BLKID_SHIFT)-1)
+#define CACHE_BATCH     64      /**< Number of elements moved between a cache and its allocator at once */
 
 /**
  * Allocate a new block of elements.
@@ -111,6 +128,7 @@ listelem_alloc_init(size_t elemsize)
     }
     list->n_alloc = 0;
     list->n_freed = 0;
+    list->mtx = sbmtx_init();
 
     /* Allocate an initial block to minimize latency. */
     listelem_add_block(list, __FILE__, __LINE__);
@@ -127,14 +145,35 @@ listelem_alloc_free(listelem_alloc_t *list)
 	ckd_free(gnode_ptr(gn));
     glist_free(list->blocks);
     glist_free(list->blocksize);
+    sbmtx_free(list->mtx);
     ckd_free(list);
 }
 
+/**
+ * Link up the elements of a block via their first machine word,
+ * ending with next, and return the first one.
+ */
+static char **
+link_block(listelem_alloc_t *list, char **block, int32 blocksize, char **next)
+{
+    char **cpp, *cp;
+    int32 j;
+
+    cpp = block;
+    cp = (char *) cpp;
+    for (j = blocksize - 1; j > 0; --j) {
+	cp += list->elemsize;
+	*cpp = cp;
+	cpp = (char **) cp;
+    }
+    *cpp = (char *) next;
+    return block;
+}
+
 static void
 listelem_add_block(listelem_alloc_t *list, char *caller_file, int caller_line)
 {
-    char **cpp, *cp;
-    size_t j;
+    char **cpp;
     int32 blocksize;
 
     blocksize = list->blocksize ? gnode_int32(list->blocksize) : MIN_ALLOC;
@@ -150,20 +189,12 @@ listelem_add_block(listelem_alloc_t *list, char *caller_file, int caller_line)
     }
 
     /* Allocate block */
-    cpp = list->freelist =
-	(char **) __ckd_calloc__(blocksize, list->elemsize,
-				 caller_file, caller_line);
+    cpp = (char **) __ckd_calloc__(blocksize, list->elemsize,
+                                   caller_file, caller_line);
     list->blocks = glist_add_ptr(list->blocks, cpp);
     list->blocksize = glist_add_int32(list->blocksize, blocksize);
-    cp = (char *) cpp;
-    /* Link up the blocks via their first machine word. */
-    for (j = blocksize - 1; j > 0; --j) {
-	cp += list->elemsize;
-	*cpp = cp;
-	cpp = (char **) cp;
-    }
-    /* Make sure the last element's forward pointer is NULL */
-    *cpp = NULL;
+    /* The last element's forward pointer is NULL */
+    list->freelist = link_block(list, cpp, blocksize, NULL);
     --list->blk_alloc;
     ++list->n_blocks;
 }
@@ -268,6 +299,145 @@ __listelem_free__(listelem_alloc_t *list, void *elem,
     (list->n_freed)++;
 }
 
+void
+listelem_alloc_reset(listelem_alloc_t *list)
+{
+    gnode_t *gn, *gn2;
+    char **head;
+
+    /* Relink every block, so that all elements are free. */
+    head = NULL;
+    gn2 = list->blocksize;
+    for (gn = list->blocks; gn; gn = gnode_next(gn)) {
+        head = link_block(list, gnode_ptr(gn), gnode_int32(gn2), head);
+        gn2 = gnode_next(gn2);
+    }
+    list->freelist = head;
+    list->n_freed = list->n_alloc;
+    /* Anything in a cache is now on the freelist too. */
+    ++list->generation;
+}
+
+
+listelem_cache_t *
+listelem_cache_init(listelem_alloc_t *list)
+{
+    listelem_cache_t *lc;
+
+    lc = ckd_calloc(1, sizeof(*lc));
+    lc->list = list;
+    lc->generation = list->generation;
+    return lc;
+}
+
+/**
+ * Forget the cache's elements if the allocator was reset since it got
+ * them, as they are on the allocator's freelist already.
+ */
+static void
+listelem_cache_sync(listelem_cache_t *lc)
+{
+    if (lc->generation == lc->list->generation)
+        return;
+    lc->freelist = NULL;
+    lc->n_free = 0;
+    lc->n_alloc = lc->n_freed = 0;
+    lc->generation = lc->list->generation;
+}
+
+/**
+ * Move the first n elements of the cache's freelist to the
+ * allocator, along with its counts.
+ */
+static void
+listelem_cache_flush(listelem_cache_t *lc, size_t n)
+{
+    listelem_alloc_t *list = lc->list;
+    char **head, **tail;
+    size_t i;
+
+    head = tail = lc->freelist;
+    for (i = 1; i < n; ++i)
+        tail = (char **) *tail;
+    if (n > 0) {
+        lc->freelist = (char **) *tail;
+        lc->n_free -= n;
+    }
+    sbmtx_lock(list->mtx);
+    if (n > 0) {
+        *tail = (char *) list->freelist;
+        list->freelist = head;
+    }
+    list->n_alloc += lc->n_alloc;
+    list->n_freed += lc->n_freed;
+    sbmtx_unlock(list->mtx);
+    lc->n_alloc = lc->n_freed = 0;
+}
+
+void
+listelem_cache_free(listelem_cache_t *lc)
+{
+    if (lc == NULL)
+        return;
+    listelem_cache_sync(lc);
+    listelem_cache_flush(lc, lc->n_free);
+    ckd_free(lc);
+}
+
+void *
+__listelem_cache_malloc__(listelem_cache_t *lc,
+                          char *caller_file, int caller_line)
+{
+    listelem_alloc_t *list = lc->list;
+    char **ptr;
+
+    listelem_cache_sync(lc);
+    if (lc->freelist == NULL) {
+        char **tail;
+        size_t n;
+
+        /* Take a batch of elements from the allocator. */
+        sbmtx_lock(list->mtx);
+        if (list->freelist == NULL)
+            listelem_add_block(list, caller_file, caller_line);
+        tail = list->freelist;
+        for (n = 1; n < CACHE_BATCH && *tail; ++n)
+            tail = (char **) *tail;
+        lc->freelist = list->freelist;
+        list->freelist = (char **) *tail;
+        list->n_alloc += lc->n_alloc;
+        list->n_freed += lc->n_freed;
+        sbmtx_unlock(list->mtx);
+        *tail = NULL;
+        lc->n_free = n;
+        lc->n_alloc = lc->n_freed = 0;
+    }
+
+    ptr = lc->freelist;
+    lc->freelist = (char **) *ptr;
+    --lc->n_free;
+    ++lc->n_alloc;
+
+    return (void *) ptr;
+}
+
+void
+__listelem_cache_release__(listelem_cache_t *lc, void *elem,
+                        char *caller_file, int caller_line)
+{
+    char **cpp;
+
+    listelem_cache_sync(lc);
+    cpp = (char **) elem;
+    *cpp = (char *) lc->freelist;
+    lc->freelist = cpp;
+    ++lc->n_free;
+    ++lc->n_freed;
+    /* Give back a batch once we are holding on to two. */
+    if (lc->n_free >= 2 * CACHE_BATCH)
+        listelem_cache_flush(lc, CACHE_BATCH);
+}
+
 
 void
 listelem_stats(listelem_alloc_t *list)
@@ -292,3 +462,15 @@ listelem_stats(listelem_alloc_t *list)
         gn2 = gnode_next(gn2);
     }
 }
+
+size_t
+listelem_mem_size(listelem_alloc_t *list)
+{
+    gnode_t *gn;
+    size_t size;
+
+    size = 0;
+    for (gn = list->blocksize; gn; gn = gnode_next(gn))
+        size += gnode_int32(gn) * list->elemsize;
+    return size;
+}
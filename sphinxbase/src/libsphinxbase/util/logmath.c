@@ -435,6 +435,73 @@ logmath_add(logmath_t *lmath, int logb_x, int logb_y)
     return r;
 }
 
+int
+logmath_add_n(logmath_t *lmath, int const *logb, int n)
+{
+    logadd_t *t = LOGMATH_TABLE(lmath);
+    int i, imax, r;
+
+    if (n <= 0)
+        return lmath->zero;
+    imax = 0;
+    for (i = 1; i < n; ++i)
+        if (logb[i] > logb[imax])
+            imax = i;
+    r = logb[imax];
+    if (r <= lmath->zero)
+        return r;
+    for (i = 0; i < n; ++i) {
+        if (i == imax || logb[i] <= lmath->zero)
+            continue;
+        /* The sum only grows, so this stays out of the table. */
+        if (t->table && (size_t)(logb[imax] - logb[i]) >= t->table_size)
+            continue;
+        r = logmath_add(lmath, r, logb[i]);
+    }
+    return r;
+}
+
+/*
+ * The loop body for logmath_add_array() with a table of the given
+ * type.  There are no branches, so that compilers can vectorize it:
+ * differences which are negative (overflowed), too large, or come
+ * from a zero all look up the last entry of the table, which is zero.
+ */
+#define LOGMATH_ADD_ARRAY(type)                                 \
+    for (i = 0; i < n; ++i) {                                   \
+        int x = logb_x[i], y = logb_y[i];                       \
+        int r = x > y ? x : y, m = x > y ? y : x;               \
+        uint32 d = (uint32) r - (uint32) m;                     \
+        d = (d >= size || m <= zero) ? size - 1 : d;            \
+        logb_x[i] = r + ((type const *) t->table)[d];           \
+    }
+
+void
+logmath_add_array(logmath_t *lmath, int *logb_x, int const *logb_y, int n)
+{
+    logadd_t *t = LOGMATH_TABLE(lmath);
+    uint32 size = t->table_size;
+    int zero = lmath->zero;
+    int i;
+
+    if (t->table == NULL) {
+        for (i = 0; i < n; ++i)
+            logb_x[i] = logmath_add(lmath, logb_x[i], logb_y[i]);
+        return;
+    }
+    switch (t->width) {
+    case 1:
+        LOGMATH_ADD_ARRAY(uint8);
+        break;
+    case 2:
+        LOGMATH_ADD_ARRAY(uint16);
+        break;
+    case 4:
+        LOGMATH_ADD_ARRAY(uint32);
+        break;
+    }
+}
+
 int
 logmath_add_exact(logmath_t *lmath, int logb_p, int logb_q)
 {
@@ -126,6 +126,24 @@ mmio_file_ptr(mmio_file_t *mf)
     return (void *)mf;
 }
 
+void
+mmio_file_prefetch(mmio_file_t *mf)
+{
+    /* Not supported, pages are read on demand. */
+}
+
+void
+mmio_file_hugepages(mmio_file_t *mf)
+{
+    /* Not supported. */
+}
+
+void
+mmio_hugepages(void *ptr, size_t len)
+{
+    /* Not supported. */
+}
+
 #elif defined(_WIN32) && !defined(_WIN32_WP) /* !WINCE */
 struct mmio_file_s {
 	int dummy;
@@ -170,6 +188,24 @@ mmio_file_ptr(mmio_file_t *mf)
     return (void *)mf;
 }
 
+void
+mmio_file_prefetch(mmio_file_t *mf)
+{
+    /* Not supported, pages are read on demand. */
+}
+
+void
+mmio_file_hugepages(mmio_file_t *mf)
+{
+    /* Not supported. */
+}
+
+void
+mmio_hugepages(void *ptr, size_t len)
+{
+    /* Not supported. */
+}
+
 #else /* !WIN32, !WINCE */
 #if defined(__ADSPBLACKFIN__) || defined(_WIN32_WP) 
 				/* This is true for both uClinux and VisualDSP++,
@@ -197,6 +233,23 @@ mmio_file_ptr(mmio_file_t *mf)
     E_ERROR("mmio is not implemented on this platform!");
     return NULL;
 }
+
+void
+mmio_file_prefetch(mmio_file_t *mf)
+{
+    E_ERROR("mmio is not implemented on this platform!");
+}
+
+void
+mmio_file_hugepages(mmio_file_t *mf)
+{
+    E_ERROR("mmio is not implemented on this platform!");
+}
+
+void
+mmio_hugepages(void *ptr, size_t len)
+{
+}
 #else /* !__ADSPBLACKFIN__ */
 struct mmio_file_s {
     void *ptr;
@@ -253,5 +306,37 @@ mmio_file_ptr(mmio_file_t *mf)
 {
     return mf->ptr;
 }
+
+void
+mmio_file_prefetch(mmio_file_t *mf)
+{
+#ifdef MADV_WILLNEED
+    if (madvise(mf->ptr, mf->mapsize, MADV_WILLNEED) < 0)
+        E_ERROR_SYSTEM("Failed to prefetch %ld bytes at %p",
+                       mf->mapsize, mf->ptr);
+#endif
+}
+
+void
+mmio_file_hugepages(mmio_file_t *mf)
+{
+    mmio_hugepages(mf->ptr, mf->mapsize);
+}
+
+void
+mmio_hugepages(void *ptr, size_t len)
+{
+#ifdef MADV_HUGEPAGE
+    size_t pagesize = sysconf(_SC_PAGESIZE);
+    size_t start = ((size_t)ptr + pagesize - 1) / pagesize * pagesize;
+    size_t end = ((size_t)ptr + len) / pagesize * pagesize;
+
+    /* Many kernels and filesystems refuse, which is no great loss. */
+    if (end > start
+        && madvise((void *)start, end - start, MADV_HUGEPAGE) < 0)
+        E_INFO("Huge pages not available for %ld bytes at %p\n",
+               (long)(end - start), (void *)start);
+#endif
+}
 #endif /* !__ADSPBLACKFIN__ */ 
 #endif /* !(WINCE || WIN32) */
@@ -39,6 +39,11 @@
 #include <config.h>
 #endif
 
+/* fopencookie() is a GNU extension. */
+#if defined(HAVE_FOPENCOOKIE) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -60,6 +65,16 @@
 #include <direct.h>
 #endif
 
+#if defined(HAVE_MMAP) && !defined(_WIN32)
+#include <sys/mman.h>
+#define USE_MMAP_LINEITER
+#endif
+
+#if defined(HAVE_LIBZ) && defined(HAVE_FOPENCOOKIE)
+#include <zlib.h>
+#define USE_ZLIB_STREAM
+#endif
+
 #include "sphinxbase/pio.h"
 #include "sphinxbase/filename.h"
 #include "sphinxbase/err.h"
@@ -103,6 +118,60 @@ guess_comptype(char const *file, int32 *ispipe, int32 *isgz)
     }
 }
 
+#ifdef USE_ZLIB_STREAM
+/* Size of zlib's compressed input buffer and of the stdio buffer on
+ * top of it.  Both are large since these are mostly big language
+ * models that are read from start to end. */
+#define GZ_BUFSIZE (256 * 1024)
+
+static ssize_t
+gz_cookie_read(void *cookie, char *buf, size_t size)
+{
+    return gzread((gzFile)cookie, buf, (unsigned)size);
+}
+
+static ssize_t
+gz_cookie_write(void *cookie, const char *buf, size_t size)
+{
+    return gzwrite((gzFile)cookie, buf, (unsigned)size);
+}
+
+static int
+gz_cookie_close(void *cookie)
+{
+    return gzclose((gzFile)cookie) == Z_OK ? 0 : EOF;
+}
+
+/**
+ * Open a gzip file as a stdio stream that is (de)compressed in this
+ * process.  Like a pipe it cannot be seeked, but unlike a pipe it
+ * has no file descriptor, which is how fclose_comp() tells them
+ * apart.
+ */
+static FILE *
+fopen_gz(const char *file, const char *mode)
+{
+    cookie_io_functions_t io;
+    gzFile gz;
+    FILE *fp;
+
+    if ((gz = gzopen(file, strcmp(mode, "r") == 0 ? "rb" : "wb")) == NULL)
+        return NULL;
+    gzbuffer(gz, GZ_BUFSIZE);
+    memset(&io, 0, sizeof(io));
+    io.read = gz_cookie_read;
+    io.write = gz_cookie_write;
+    io.close = gz_cookie_close;
+    if ((fp = fopencookie(gz, mode, io)) == NULL) {
+        E_ERROR_SYSTEM("Failed to open a stream for '%s'", file);
+        gzclose(gz);
+        return NULL;
+    }
+    setvbuf(fp, NULL, _IOFBF, GZ_BUFSIZE);
+    return fp;
+}
+#endif /* USE_ZLIB_STREAM */
+
 FILE *
 fopen_comp(const char *file, const char *mode, int32 * ispipe)
 {
@@ -120,6 +189,11 @@ fopen_comp(const char *file, const char *mode, int32 * ispipe)
         /* Shouldn't get here, anyway */
         E_FATAL("No popen() on WinCE\n");
 #else
+#ifdef USE_ZLIB_STREAM
+        if (isgz == COMP_GZIP
+            && (strcmp(mode, "r") == 0 || strcmp(mode, "w") == 0))
+            return fopen_gz(file, mode);
+#endif
         if (strcmp(mode, "r") == 0) {
             char *command;
             switch (isgz) {
@@ -183,6 +257,11 @@ fopen_comp(const char *file, const char *mode, int32 * ispipe)
 void
 fclose_comp(FILE * fp, int32 ispipe)
 {
+#ifdef USE_ZLIB_STREAM
+    /* Streams from fopen_gz() have no descriptor and are not pipes. */
+    if (ispipe && fileno(fp) == -1)
+        ispipe = FALSE;
+#endif
     if (ispipe) {
 #ifdef HAVE_POPEN
 #if defined(_WIN32) && (!defined(__SYMBIAN32__))
@@ -260,6 +339,38 @@ fopen_compchk(const char *file, int32 * ispipe)
 #endif /* HAVE_POPEN */
 }
 
+#ifdef USE_MMAP_LINEITER
+/**
+ * Map the file under a line iterator if it is a regular one, so that
+ * lines can be found with memchr() rather than read through stdio.
+ */
+static void
+lineiter_map(lineiter_t *li)
+{
+    struct stat st;
+    void *ptr;
+    long pos;
+    int fd;
+
+    if ((fd = fileno(li->fh)) < 0
+        || fstat(fd, &st) < 0
+        || !S_ISREG(st.st_mode)
+        || (off_t)(size_t)st.st_size != st.st_size)
+        return;
+    if ((pos = ftell(li->fh)) < 0 || pos >= st.st_size)
+        return;
+    ptr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ptr == MAP_FAILED)
+        return;
+#ifdef MADV_SEQUENTIAL
+    madvise(ptr, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+    li->map = ptr;
+    li->map_size = (size_t)st.st_size;
+    li->map_pos = (size_t)pos;
+}
+#endif /* USE_MMAP_LINEITER */
+
 lineiter_t *
 lineiter_start(FILE *fh)
 {
@@ -271,6 +382,9 @@ lineiter_start(FILE *fh)
     li->bsiz = 128;
     li->len = 0;
     li->fh = fh;
+#ifdef USE_MMAP_LINEITER
+    lineiter_map(li);
+#endif
 
     li = lineiter_next(li);
     
@@ -312,6 +426,29 @@ lineiter_next_plain(lineiter_t *li)
     /* We are reading the next line */
     li->lineno++;
     
+    if (li->map) {
+        char const *line, *nl;
+        size_t len;
+
+        if (li->map_pos >= li->map_size) {
+            lineiter_free(li);
+            return NULL;
+        }
+        line = li->map + li->map_pos;
+        nl = memchr(line, '\n', li->map_size - li->map_pos);
+        len = nl ? (size_t)(nl - line) + 1 : li->map_size - li->map_pos;
+        if (len >= (size_t)li->bsiz) {
+            while (len >= (size_t)li->bsiz)
+                li->bsiz *= 2;
+            li->buf = (char *)ckd_realloc(li->buf, li->bsiz);
+        }
+        memcpy(li->buf, line, len);
+        li->buf[len] = '\0';
+        li->len = (int32)len;
+        li->map_pos += len;
+        return li;
+    }
+
     /* Read a line and check for EOF. */
     if (fgets(li->buf, li->bsiz, li->fh) == NULL) {
         lineiter_free(li);
@@ -369,6 +506,13 @@ lineiter_free(lineiter_t *li)
 {
     if (li == NULL)
         return;
+#ifdef USE_MMAP_LINEITER
+    if (li->map) {
+        /* Leave the file where the lines we returned end. */
+        fseek(li->fh, (long)li->map_pos, SEEK_SET);
+        munmap((void *)li->map, li->map_size);
+    }
+#endif
     ckd_free(li->buf);
     ckd_free(li);
 }
@@ -41,6 +41,9 @@
  * @author David Huggins-Daines <dhuggins@cs.cmu.edu>
  */
 
+#ifdef __linux__
+#define _GNU_SOURCE /* For sched_setaffinity() */
+#endif
 #include <string.h>
 
 #include "sphinxbase/sbthread.h"
@@ -655,8 +658,9 @@ sbevent_wait(sbevent_t *evt, int sec, int nsec)
 
     /* Lock the mutex before we check its signalled state. */
     pthread_mutex_lock(&evt->mtx);
-    /* If it's not signalled, then wait until it is. */
-    if (!evt->signalled)
+    /* If it's not signalled, then wait until it is (the wait can
+     * return spuriously, so check again when it does). */
+    while (rv == 0 && !evt->signalled)
         rv = cond_timed_wait(&evt->cond, &evt->mtx, sec, nsec);
     /* Set its state to unsignalled if we were successful. */
     if (rv == 0)
@@ -737,3 +741,119 @@ sbthread_free(sbthread_t *th)
     sbmsgq_free(th->msgq);
     ckd_free(th);
 }
+
+/*
+ * NUMA placement, done by hand rather than with libnuma, which is
+ * not usually installed.
+ */
+#ifdef __linux__
+#include <stdio.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/syscall.h>
+
+/* From <numaif.h>. */
+#define SB_MPOL_DEFAULT 0
+#define SB_MPOL_INTERLEAVE 3
+#define SB_MAX_NODES 1024
+
+int
+sbthread_n_nodes(void)
+{
+    char path[64];
+    int n;
+
+    for (n = 0; n < SB_MAX_NODES; ++n) {
+        sprintf(path, "/sys/devices/system/node/node%d", n);
+        if (access(path, F_OK) < 0)
+            break;
+    }
+    return n ? n : 1;
+}
+
+int
+sbthread_bind_node(int node)
+{
+    cpu_set_t cpus;
+    char path[64];
+    FILE *fh;
+    int first, last, c;
+
+    CPU_ZERO(&cpus);
+    if (node < 0) {
+        for (c = 0; c < CPU_SETSIZE; ++c)
+            CPU_SET(c, &cpus);
+        return sched_setaffinity(0, sizeof(cpus), &cpus);
+    }
+    /* The list of CPUs looks like 0-7,16-23 */
+    sprintf(path, "/sys/devices/system/node/node%d/cpulist", node);
+    if ((fh = fopen(path, "r")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open %s", path);
+        return -1;
+    }
+    while (fscanf(fh, "%d", &first) == 1) {
+        last = first;
+        if ((c = fgetc(fh)) == '-') {
+            if (fscanf(fh, "%d", &last) != 1)
+                break;
+            c = fgetc(fh);
+        }
+        for (; first <= last && first < CPU_SETSIZE; ++first)
+            CPU_SET(first, &cpus);
+        if (c != ',')
+            break;
+    }
+    fclose(fh);
+    if (CPU_COUNT(&cpus) == 0) {
+        E_ERROR("Node %d has no CPUs\n", node);
+        return -1;
+    }
+    if (sched_setaffinity(0, sizeof(cpus), &cpus) < 0) {
+        E_ERROR_SYSTEM("Failed to bind thread to node %d", node);
+        return -1;
+    }
+    return 0;
+}
+
+int
+sbthread_interleave(int enable)
+{
+#ifdef SYS_set_mempolicy
+    unsigned long mask[SB_MAX_NODES / (8 * sizeof(unsigned long))];
+    int i, n;
+
+    if (!enable)
+        return syscall(SYS_set_mempolicy, SB_MPOL_DEFAULT, NULL, 0);
+    memset(mask, 0, sizeof(mask));
+    n = sbthread_n_nodes();
+    for (i = 0; i < n; ++i)
+        mask[i / (8 * sizeof(*mask))] |= 1UL << (i % (8 * sizeof(*mask)));
+    if (syscall(SYS_set_mempolicy, SB_MPOL_INTERLEAVE,
+                mask, (unsigned long)SB_MAX_NODES + 1) < 0) {
+        E_ERROR_SYSTEM("Failed to interleave memory over %d nodes", n);
+        return -1;
+    }
+    return 0;
+#else
+    return -1;
+#endif
+}
+#else /* !__linux__ */
+int
+sbthread_n_nodes(void)
+{
+    return 1;
+}
+
+int
+sbthread_bind_node(int node)
+{
+    return -1;
+}
+
+int
+sbthread_interleave(int enable)
+{
+    return -1;
+}
+#endif /* !__linux__ */
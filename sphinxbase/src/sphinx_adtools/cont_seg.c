@@ -62,7 +62,7 @@
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/err.h>
 
-#define BLOCKSIZE 1024
+#define BLOCKSIZE 16384
 
 static const arg_t cont_args_def[] = {
     waveform_to_cepstral_command_line_macro(),
@@ -141,105 +141,143 @@ read_audio_adev(int16 * buf, int len)
     return k;
 }
 
-void
-segment_audio()
+/**
+ * Handlers for the events found by segment_audio().
+ */
+typedef struct seg_callbacks_s {
+    /** Speech starts at frame frameidx. */
+    void (*start)(int32 frameidx);
+    /** More speech, including the prespeech audio at the start. */
+    void (*speech)(int16 const *pcm, int32 nsamps);
+    /** Speech has ended. */
+    void (*end)(void);
+} seg_callbacks_t;
+
+static FILE *seg_file;
+static char seg_file_name[1024];
+static int seg_no, seg_len;
+static int32 seg_start_frame;
+
+static void
+seg_start(int32 frameidx)
+{
+    seg_no++;
+    seg_len = 0;
+    seg_start_frame = frameidx;
+    if (!singlefile) {
+        sprintf(seg_file_name, "%s%04d.raw", infile_path, seg_no);
+        if ((seg_file = fopen(seg_file_name, "wb")) == NULL)
+            E_FATAL_SYSTEM("Failed to open '%s' for writing", seg_file_name);
+    } else {
+        sprintf(seg_file_name, "%s.raw", infile_path);
+        if ((seg_file = fopen(seg_file_name, "ab")) == NULL)
+            E_FATAL_SYSTEM("Failed to open '%s' for writing", seg_file_name);
+    }
+}
+
+static void
+seg_speech(int16 const *pcm, int32 nsamps)
+{
+    fwrite(pcm, sizeof(int16), nsamps, seg_file);
+    seg_len += nsamps;
+}
+
+static void
+seg_end(void)
+{
+    int sample_rate = (int) cmd_ln_float32_r(config, "-samprate");
+    int frame_rate = cmd_ln_int32_r(config, "-frate");
+
+    fclose(seg_file);
+    seg_file = NULL;
+    printf("Utterance %04d: file %s start %.1f sec length %d samples ( %.2f sec )\n",
+           seg_no, seg_file_name,
+           ((double) seg_start_frame) / frame_rate,
+           seg_len, ((double) seg_len) / sample_rate);
+    fflush(stdout);
+}
+
+static const seg_callbacks_t seg_callbacks = {
+    seg_start, seg_speech, seg_end
+};
+
+/**
+ * Segment audio into utterances, passing them to callbacks.
+ *
+ * Audio is read in large blocks and handed to the front end, which
+ * keeps the frames before speech starts in its prespeech buffer and
+ * returns nothing at all during silence.  Each block is fed in chunks
+ * of no more than -vad_postspeech frames, which is too short to hold
+ * both the end of one utterance and the start of the next, so that
+ * no boundary is missed between checks of the VAD state.
+ */
+static void
+segment_audio(seg_callbacks_t const *cb)
 {
-    FILE *file;
-    int16 pcm_buf[BLOCKSIZE];
+    int16 *pcm_buf, *voiced_buf;
     mfcc_t **cep_buf;
-    int16 *voiced_buf = NULL;
-    int32 voiced_nsamps, out_frameidx, uttstart = 0;
-    char file_name[1024];
-    uint8 cur_vad_state, vad_state, writing;
-    int uttno, uttlen, sample_rate;
-    int32 nframes, nframes_tmp;
-    int16 frame_size, frame_shift, frame_rate;
-    size_t k;
-
-    sample_rate = (int) cmd_ln_float32_r(config, "-samprate");
-    frame_rate = cmd_ln_int32_r(config, "-frate");
-    frame_size =
-        (int32) (cmd_ln_float32_r(config, "-wlen") * sample_rate + 0.5);
-    frame_shift =
-        (int32) (sample_rate / cmd_ln_int32_r(config, "-frate") + 0.5);
-    nframes = (BLOCKSIZE - frame_size) / frame_shift;
-    cep_buf =
-        (mfcc_t **) ckd_calloc_2d(nframes, fe_get_output_size(fe),
-                                  sizeof(mfcc_t));
-
-    uttno = 0;
-    uttlen = 0;
-    cur_vad_state = 0;
-    voiced_nsamps = 0;
-    writing = 0;
-    file = NULL;
+    int32 voiced_nsamps, out_frameidx, nframes, nframes_tmp;
+    int32 chunk_frames, pre_speech;
+    int frame_shift, frame_size;
+    uint8 in_utt;
+    int k;
+
+    fe_get_input_size(fe, &frame_shift, &frame_size);
+    chunk_frames = cmd_ln_int32_r(config, "-vad_postspeech");
+    if (chunk_frames < 1)
+        chunk_frames = 1;
+    pre_speech = cmd_ln_int32_r(config, "-vad_prespeech");
+    /* Output includes the prespeech frames when speech starts. */
+    nframes = chunk_frames + pre_speech + 2;
+    cep_buf = (mfcc_t **) ckd_calloc_2d(nframes, fe_get_output_size(fe),
+                                        sizeof(mfcc_t));
+    pcm_buf = ckd_calloc(BLOCKSIZE, sizeof(*pcm_buf));
+    voiced_buf = ckd_calloc((nframes + pre_speech + 1) * frame_shift,
+                            sizeof(*voiced_buf));
+
+    in_utt = FALSE;
     fe_start_stream(fe);
     fe_start_utt(fe);
     while ((k = read_audio(pcm_buf, BLOCKSIZE)) > 0) {
-        int16 const *pcm_buf_tmp;
-        pcm_buf_tmp = &pcm_buf[0];
-        while (k) {
-            nframes_tmp = nframes;
-            fe_process_frames_ext(fe, &pcm_buf_tmp, &k, cep_buf,
-                                  &nframes_tmp, voiced_buf,
-                                  &voiced_nsamps, &out_frameidx);
-            if (out_frameidx > 0) {
-        	uttstart = out_frameidx;
-            }
-            vad_state = fe_get_vad_state(fe);
-            if (!cur_vad_state && vad_state) {
-                /* silence->speech transition, time to start new file */
-                uttno++;
-                if (!singlefile) {
-                    sprintf(file_name, "%s%04d.raw", infile_path, uttno);
-                    if ((file = fopen(file_name, "wb")) == NULL)
-                          E_FATAL_SYSTEM("Failed to open '%s' for writing",
-                                         file_name);
-                } else {
-                    sprintf(file_name, "%s.raw", infile_path);
-                    if ((file = fopen(file_name, "ab")) == NULL)
-                          E_FATAL_SYSTEM("Failed to open '%s' for writing",
-                                         file_name);
-		}
-		writing = 1;
-            }
+        int16 const *pcm = pcm_buf;
+        size_t left = k;
 
-            if (writing && file && voiced_nsamps > 0) {
-                fwrite(voiced_buf, sizeof(int16), voiced_nsamps, file);
-                uttlen += voiced_nsamps;
-            }
+        while (left) {
+            size_t chunk, rest;
 
-            if (cur_vad_state && !vad_state) {
-                /* speech -> silence transition, time to finish file */
-                fclose(file);
-	        printf("Utterance %04d: file %s start %.1f sec length %d samples ( %.2f sec )\n",
-    		       uttno,
-    		       file_name,
-    	    	       ((double) uttstart) / frame_rate,
-            	        uttlen,
-            	       ((double) uttlen) / sample_rate);
-                fflush(stdout);
+            chunk = chunk_frames * frame_shift;
+            if (chunk > left)
+                chunk = left;
+            rest = left - chunk;
+            /* Let the front end take all the frames it can out of
+             * this chunk before moving on. */
+            do {
+                nframes_tmp = nframes;
+                fe_process_frames_ext(fe, &pcm, &chunk, cep_buf,
+                                      &nframes_tmp, voiced_buf,
+                                      &voiced_nsamps, &out_frameidx);
+                if (!in_utt && (voiced_nsamps > 0 || fe_get_vad_state(fe))) {
+                    (*cb->start)(out_frameidx);
+                    in_utt = TRUE;
+                }
+                if (in_utt && voiced_nsamps > 0)
+                    (*cb->speech)(voiced_buf, voiced_nsamps);
+            } while (chunk > 0 && nframes_tmp > 0);
+            if (in_utt && !fe_get_vad_state(fe)) {
+                (*cb->end)();
+                in_utt = FALSE;
                 fe_end_utt(fe, cep_buf[0], &nframes_tmp);
-                writing = 0;
-                uttlen = 0;
-                voiced_nsamps = 0;
                 fe_start_utt(fe);
             }
-            cur_vad_state = vad_state;
+            left = rest + chunk;
         }
     }
 
-    if (writing) {
-        fclose(file);
-	printf("Utterance %04d: file %s start %.1f sec length %d samples ( %.2f sec )\n",
-    	        uttno,
-    		file_name,
-    	    	((double) uttstart) / frame_rate,
-            	uttlen,
-                ((double) uttlen) / sample_rate);
-        fflush(stdout);
-    }
-    fe_end_utt(fe, cep_buf[0], &nframes);
+    if (in_utt)
+        (*cb->end)();
+    fe_end_utt(fe, cep_buf[0], &nframes_tmp);
+    ckd_free(voiced_buf);
+    ckd_free(pcm_buf);
     ckd_free_2d(cep_buf);
 }
 
@@ -299,7 +337,7 @@ main(int argc, char *argv[])
     if (fe == NULL)
         return 1;
 
-    segment_audio();
+    segment_audio(&seg_callbacks);
 
     if (ad)
         ad_close(ad);
@@ -214,6 +214,11 @@ static arg_t defn[] = {
     "no",
     "Input is cepstral files, output is log spectral files" },
 
+  { "-nthreads",
+    ARG_INT32,
+    "1",
+    "Number of worker threads to use when processing a control file" },
+
   { NULL, 0, NULL, NULL }
 };
 
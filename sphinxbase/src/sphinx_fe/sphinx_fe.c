@@ -53,6 +53,8 @@
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/byteorder.h>
 #include <sphinxbase/hash_table.h>
+#include <sphinxbase/sbthread.h>
+#include <sphinxbase/profile.h>
 
 #include "sphinx_wave2feat.h"
 #include "cmd_ln_defn.h"
@@ -84,6 +86,7 @@ struct sphinx_wave2feat_s {
     int veclen;       /**< Length of each output vector. */
     int in_veclen;    /**< Length of each input vector (for cep<->spec). */
     int byteswap;     /**< Whether byteswapping is necessary. */
+    int nframes;      /**< Number of frames written for the last file. */
     output_type_t const *ot;/**< Output type object. */
 };
 
@@ -103,6 +106,19 @@ typedef struct RIFFHeader{
     int32 datalength;       /* Raw data length */
 } MSWAV_hdr;
 
+/**
+ * Get the expected sampling rate of input files.
+ */
+static double
+input_samprate(sphinx_wave2feat_t *wtf)
+{
+    double samprate = cmd_ln_float32_r(wtf->config, "-input_samprate");
+
+    if (samprate == 0)
+        samprate = cmd_ln_float32_r(wtf->config, "-samprate");
+    return samprate;
+}
+
 /**
  * Detect RIFF file and parse its header if detected.
  *
@@ -134,7 +150,7 @@ detect_riff(sphinx_wave2feat_t *wtf)
 	fclose(fh);
 	return -1;
     }
-    samprate = cmd_ln_float32_r(wtf->config, "-samprate");
+    samprate = input_samprate(wtf);
     if (samprate != hdr.SamplingFreq) {
 	E_ERROR("Sample rate %d does not match configured value %.1f in file '%s'\n", 
 	        hdr.SamplingFreq, samprate, wtf->infile);
@@ -185,7 +201,7 @@ open_nist_file(sphinx_wave2feat_t *wtf, char const *infile, FILE **out_fh, int d
         str2words(li->buf, words, nword);
         if (0 == strcmp(words[0], "sample_rate")) {
             float samprate = atof_c(words[2]);
-            if (cmd_ln_float32_r(wtf->config, "-samprate") != samprate) {
+            if (input_samprate(wtf) != samprate) {
 	        E_ERROR("Sample rate %.1f does not match configured value in file '%s'\n", samprate, infile);
 	        lineiter_free(li);
 	        fclose(fh);
@@ -693,6 +709,20 @@ sphinx_wave2feat_init(cmd_ln_t *config)
     return wtf;
 }
 
+sphinx_wave2feat_t *
+sphinx_wave2feat_clone(sphinx_wave2feat_t *wtf)
+{
+    sphinx_wave2feat_t *cwtf;
+
+    cwtf = (sphinx_wave2feat_t *)ckd_calloc(1, sizeof(*cwtf));
+    cwtf->refcount = 1;
+    cwtf->config = cmd_ln_retain(wtf->config);
+    cwtf->fe = fe_clone(wtf->fe);
+    cwtf->ot = wtf->ot;
+
+    return cwtf;
+}
+
 int
 sphinx_wave2feat_free(sphinx_wave2feat_t *wtf)
 {
@@ -790,6 +820,7 @@ sphinx_wave2feat_convert_file(sphinx_wave2feat_t *wtf,
 
     E_INFO("Converting %s to %s\n", infile, outfile);
 
+    wtf->nframes = 0;
     wtf->infile = ckd_salloc(infile);
 
     /* Detect input file type. */
@@ -843,6 +874,7 @@ sphinx_wave2feat_convert_file(sphinx_wave2feat_t *wtf,
     	E_ERROR("Failed to convert");
     	goto error_out;
     }
+    wtf->nframes = nfloat / wtf->veclen;
 
     if (wtf->ot->output_header) {
         if (fseek(wtf->outfh, 0, SEEK_SET) < 0) {
@@ -934,6 +966,84 @@ build_filenames(cmd_ln_t *config, char const *basename,
     }
 }
 
+/**
+ * Files to convert from a control file, in control file order.
+ */
+typedef struct ctl_jobs_s {
+    char **infiles;    /**< Input file for each job. */
+    char **outfiles;   /**< Output file for each job. */
+    int *nframes;      /**< Frames written for each job, or -1 on error. */
+    int njobs;         /**< Number of jobs. */
+    int next;          /**< Next job to hand out to a worker. */
+    sbmtx_t *mtx;      /**< Lock for next. */
+} ctl_jobs_t;
+
+typedef struct ctl_worker_s {
+    sphinx_wave2feat_t *wtf;
+    ctl_jobs_t *jobs;
+} ctl_worker_t;
+
+static void
+convert_job(sphinx_wave2feat_t *wtf, ctl_jobs_t *jobs, int i)
+{
+    if (sphinx_wave2feat_convert_file(wtf, jobs->infiles[i],
+                                      jobs->outfiles[i]) < 0)
+        jobs->nframes[i] = -1;
+    else
+        jobs->nframes[i] = wtf->nframes;
+}
+
+static int
+ctl_worker_main(sbthread_t *th)
+{
+    ctl_worker_t *worker = sbthread_arg(th);
+    ctl_jobs_t *jobs = worker->jobs;
+
+    while (TRUE) {
+        int i;
+
+        sbmtx_lock(jobs->mtx);
+        i = jobs->next++;
+        sbmtx_unlock(jobs->mtx);
+        if (i >= jobs->njobs)
+            break;
+        convert_job(worker->wtf, jobs, i);
+    }
+    return 0;
+}
+
+/**
+ * Run jobs on a pool of worker threads, each with its own converter
+ * sharing the front-end tables of wtf.  Jobs are handed out in
+ * control file order and the results are stored by job index, so the
+ * outcome does not depend on scheduling.
+ */
+static void
+run_jobs_parallel(sphinx_wave2feat_t *wtf, ctl_jobs_t *jobs, int nthreads)
+{
+    ctl_worker_t *workers;
+    sbthread_t **threads;
+    int i;
+
+    workers = ckd_calloc(nthreads, sizeof(*workers));
+    threads = ckd_calloc(nthreads, sizeof(*threads));
+    jobs->mtx = sbmtx_init();
+    for (i = 0; i < nthreads; ++i) {
+        workers[i].wtf = sphinx_wave2feat_clone(wtf);
+        workers[i].jobs = jobs;
+        threads[i] = sbthread_start(wtf->config, ctl_worker_main,
+                                    &workers[i]);
+    }
+    for (i = 0; i < nthreads; ++i) {
+        sbthread_wait(threads[i]);
+        sbthread_free(threads[i]);
+        sphinx_wave2feat_free(workers[i].wtf);
+    }
+    sbmtx_free(jobs->mtx);
+    ckd_free(threads);
+    ckd_free(workers);
+}
+
 static int
 run_control_file(sphinx_wave2feat_t *wtf, char const *ctlfile)
 {
@@ -941,7 +1051,10 @@ run_control_file(sphinx_wave2feat_t *wtf, char const *ctlfile)
     hash_iter_t *itor;
     lineiter_t *li;
     FILE *ctlfh;
-    int nskip, runlen, npart;
+    ctl_jobs_t jobs;
+    ptmr_t tm;
+    int nskip, runlen, npart, nthreads, maxjobs, nfail, i;
+    long totframes;
 
     if ((ctlfh = fopen(ctlfile, "r")) == NULL) {
         E_ERROR_SYSTEM("Failed to open control file %s", ctlfile);
@@ -971,6 +1084,10 @@ run_control_file(sphinx_wave2feat_t *wtf, char const *ctlfile)
         E_INFO("Processing all remaining utterances at position %d\n", nskip);
         files = hash_table_new(1000, HASH_CASE_YES);
     }
+
+    /* Read the whole list first, so it can be shared out to workers. */
+    memset(&jobs, 0, sizeof(jobs));
+    maxjobs = 0;
     for (li = lineiter_start(ctlfh); li; li = lineiter_next(li)) {
         char *c, *infile, *outfile;
 
@@ -991,18 +1108,82 @@ run_control_file(sphinx_wave2feat_t *wtf, char const *ctlfile)
     	    continue;
         }
         build_filenames(wtf->config, li->buf, &infile, &outfile);
-        if (hash_table_lookup(files, infile, NULL) == 0)
+        if (hash_table_lookup(files, infile, NULL) == 0) {
+            ckd_free(infile);
+            ckd_free(outfile);
             continue;
-        sphinx_wave2feat_convert_file(wtf, infile, outfile);
+        }
         hash_table_enter(files, infile, outfile);
+        if (jobs.njobs == maxjobs) {
+            maxjobs = maxjobs ? maxjobs * 2 : 1024;
+            jobs.infiles = ckd_realloc(jobs.infiles,
+                                       maxjobs * sizeof(*jobs.infiles));
+            jobs.outfiles = ckd_realloc(jobs.outfiles,
+                                        maxjobs * sizeof(*jobs.outfiles));
+        }
+        jobs.infiles[jobs.njobs] = infile;
+        jobs.outfiles[jobs.njobs] = outfile;
+        ++jobs.njobs;
+    }
+    fclose(ctlfh);
+    jobs.nframes = ckd_calloc(jobs.njobs ? jobs.njobs : 1,
+                              sizeof(*jobs.nframes));
+
+    nthreads = cmd_ln_int32_r(wtf->config, "-nthreads");
+    if (nthreads > 1 && cmd_ln_boolean_r(wtf->config, "-dither")) {
+        E_WARN("Dithering is not reproducible with multiple threads, "
+               "using -nthreads 1\n");
+        nthreads = 1;
     }
+    /* MFCC input detection updates the configuration per file. */
+    if (nthreads > 1 && (cmd_ln_boolean_r(wtf->config, "-spec2cep")
+                         || cmd_ln_boolean_r(wtf->config, "-cep2spec"))) {
+        E_WARN("-spec2cep and -cep2spec do not support multiple threads, "
+               "using -nthreads 1\n");
+        nthreads = 1;
+    }
+    if (nthreads > jobs.njobs)
+        nthreads = jobs.njobs;
+
+    ptmr_init(&tm);
+    ptmr_start(&tm);
+    if (nthreads > 1) {
+        E_INFO("Converting %d files with %d threads\n",
+               jobs.njobs, nthreads);
+        run_jobs_parallel(wtf, &jobs, nthreads);
+    }
+    else {
+        for (i = 0; i < jobs.njobs; ++i)
+            convert_job(wtf, &jobs, i);
+    }
+    ptmr_stop(&tm);
+
+    /* Report results in control file order. */
+    nfail = 0;
+    totframes = 0;
+    for (i = 0; i < jobs.njobs; ++i) {
+        if (jobs.nframes[i] < 0) {
+            E_ERROR("Failed to convert %s\n", jobs.infiles[i]);
+            ++nfail;
+        }
+        else
+            totframes += jobs.nframes[i];
+    }
+    E_INFO("Converted %d files (%d failed), %ld frames in %.2f sec\n",
+           jobs.njobs - nfail, nfail, totframes, tm.t_elapsed);
+    if (tm.t_elapsed > 0)
+        E_INFO("Throughput: %.2f files/sec, %.2f frames/sec\n",
+               jobs.njobs / tm.t_elapsed, totframes / tm.t_elapsed);
+
     for (itor = hash_table_iter(files); itor;
          itor = hash_table_iter_next(itor)) {
         ckd_free((void *)hash_entry_key(itor->ent));
         ckd_free(hash_entry_val(itor->ent));
     }
     hash_table_free(files);
-    fclose(ctlfh);
+    ckd_free(jobs.infiles);
+    ckd_free(jobs.outfiles);
+    ckd_free(jobs.nframes);
 
     return 0;
 }
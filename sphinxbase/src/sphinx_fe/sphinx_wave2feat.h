@@ -47,6 +47,12 @@ typedef struct sphinx_wave2feat_s sphinx_wave2feat_t;
  */
 sphinx_wave2feat_t *sphinx_wave2feat_init(cmd_ln_t *config);
 
+/**
+ * Create a new converter for use in another thread, sharing the
+ * configuration and front-end tables of an existing one.
+ */
+sphinx_wave2feat_t *sphinx_wave2feat_clone(sphinx_wave2feat_t *w2f);
+
 /**
  * Release a waveform to feature converter.
  */
@@ -79,6 +79,11 @@ static const arg_t defn[] = {
     "no",
     "Compute grammar closure to speedup loading"},
 
+  { "-optimize",
+    ARG_BOOLEAN,
+    "no",
+    "Remove null transitions, determinize and minimize the grammar"},
+
   { NULL, 0, NULL, NULL }
 };
 
@@ -87,7 +92,7 @@ static void
 usagemsg(char *pgm)
 {
     E_INFO("Usage: %s -jsgf <input.jsgf> -toprule <rule name>\\\n", pgm);
-    E_INFOCONT("\t[-fsm yes/no] [-compile yes/no]\n");
+    E_INFOCONT("\t[-fsm yes/no] [-compile yes/no] [-optimize yes/no]\n");
     E_INFOCONT("\t-fsg <output.fsg>\n");
 
     exit(0);
@@ -154,7 +159,12 @@ main(int argc, char *argv[])
     }
 
 
-    if (cmd_ln_boolean_r(config, "-compile")) {
+    if (cmd_ln_boolean_r(config, "-optimize")) {
+        fsg_model_t *opt = fsg_model_optimize(fsg);
+        fsg_model_free(fsg);
+        fsg = opt;
+    }
+    else if (cmd_ln_boolean_r(config, "-compile")) {
 	fsg_model_null_trans_closure(fsg, NULL);
     }
 
@@ -91,6 +91,21 @@ static const arg_t defn[] = {
     "no",
     "Use memory-mapped I/O for reading binary LM files"},
 
+  { "-nthreads",
+    ARG_INT32,
+    "1",
+    "Number of threads to use when reading and writing ARPA files" },
+
+  { "-quant",
+    ARG_STRING,
+    NULL,
+    "Bits to quantize probabilities/backoffs to in binary output, for each order from bigrams, e.g. 8/8,8 (with -quanteval, several separated by spaces)" },
+
+  { "-quanteval",
+    ARG_STRING,
+    NULL,
+    "Transcript file to report size and perplexity for each -quant setting on" },
+
   { NULL, 0, NULL, NULL }
 };
 
@@ -104,6 +119,134 @@ usagemsg(char *pgm)
     exit(0);
 }
 
+static ngram_model_t *
+read_input(cmd_ln_t *config, logmath_t *lmath)
+{
+    int itype;
+
+    itype = NGRAM_AUTO;
+    if (cmd_ln_str_r(config, "-ifmt")) {
+        if ((itype = ngram_str_to_type(cmd_ln_str_r(config, "-ifmt")))
+            == NGRAM_INVALID) {
+            E_ERROR("Invalid input type %s\n", cmd_ln_str_r(config, "-ifmt"));
+            return NULL;
+        }
+    }
+    return ngram_model_read(config, cmd_ln_str_r(config, "-i"),
+                            itype, lmath);
+}
+
+/* Perplexity of lm on each line of a transcript, as in sphinx_lm_eval. */
+static float64
+perplexity(ngram_model_t *lm, logmath_t *lmath, const char *lsnfn)
+{
+    FILE *fh;
+    lineiter_t *litor;
+    int32 i, n, nwords, startwid, unk;
+    int32 *wids;
+    char **words;
+    float64 ch;
+
+    if ((fh = fopen(lsnfn, "r")) == NULL) {
+        E_ERROR_SYSTEM("Failed to open transcript file %s", lsnfn);
+        return -1.0;
+    }
+    unk = ngram_unknown_wid(lm);
+    startwid = ngram_wid(lm, "<s>");
+    ch = 0.0;
+    nwords = 0;
+    for (litor = lineiter_start(fh); litor; litor = lineiter_next(litor)) {
+        if ((n = str2words(litor->buf, NULL, 0)) <= 0)
+            continue;
+        words = ckd_calloc(n, sizeof(*words));
+        str2words(litor->buf, words, n);
+        /* Remove any utterance ID */
+        if (words[n-1][0] == '('
+            && words[n-1][strlen(words[n-1])-1] == ')')
+            --n;
+        /* Reversed, so the rest of the array is the history. */
+        wids = ckd_calloc(n, sizeof(*wids));
+        for (i = 0; i < n; ++i)
+            wids[n-i-1] = ngram_wid(lm, words[i]);
+        for (i = 0; i < n; ++i) {
+            int32 n_used;
+
+            /* Skip context cues and OOVs. */
+            if (wids[i] == startwid || wids[i] == NGRAM_INVALID_WID
+                || wids[i] == unk)
+                continue;
+            ch -= ngram_ng_score(lm, wids[i], wids + i + 1,
+                                 n - i - 1, &n_used);
+            ++nwords;
+        }
+        ckd_free(wids);
+        ckd_free(words);
+    }
+    fclose(fh);
+    if (nwords == 0)
+        return 0.0;
+    /* pplx = 2^CH, with CH in bits per word */
+    ch = ch / nwords * log(logmath_get_base(lmath)) / log(2);
+    return pow(2.0, ch);
+}
+
+/* Write the model with each quantization in turn and report what it
+ * costs in size and perplexity. */
+static int
+quant_tradeoffs(cmd_ln_t *config, logmath_t *lmath)
+{
+    char const *outfn = cmd_ln_str_r(config, "-o");
+    char *specs;
+    char **spec;
+    int32 i, n;
+    int rv = 0;
+
+    specs = ckd_salloc(cmd_ln_str_r(config, "-quant")
+                       ? cmd_ln_str_r(config, "-quant") : "16/16");
+    n = str2words(specs, NULL, 0);
+    spec = ckd_calloc(n, sizeof(*spec));
+    str2words(specs, spec, n);
+
+    printf("%-20s %12s %12s\n", "quant", "bytes", "perplexity");
+    for (i = 0; i < n; ++i) {
+        ngram_model_t *lm;
+        FILE *fh;
+        long size;
+
+        cmd_ln_set_str_r(config, "-quant", spec[i]);
+        if ((lm = read_input(config, lmath)) == NULL) {
+            rv = -1;
+            break;
+        }
+        /* Only binary models are quantized. */
+        if (ngram_model_write(lm, outfn, NGRAM_BIN) != 0) {
+            E_ERROR("Failed to write language model to %s\n", outfn);
+            ngram_model_free(lm);
+            rv = -1;
+            break;
+        }
+        ngram_model_free(lm);
+        if ((fh = fopen(outfn, "rb")) == NULL) {
+            E_ERROR_SYSTEM("Failed to open %s", outfn);
+            rv = -1;
+            break;
+        }
+        fseek(fh, 0, SEEK_END);
+        size = ftell(fh);
+        fclose(fh);
+        if ((lm = ngram_model_read(config, outfn, NGRAM_BIN, lmath)) == NULL) {
+            rv = -1;
+            break;
+        }
+        printf("%-20s %12ld %12.3f\n", spec[i], size,
+               perplexity(lm, lmath, cmd_ln_str_r(config, "-quanteval")));
+        ngram_model_free(lm);
+    }
+    ckd_free(spec);
+    ckd_free(specs);
+    return rv;
+}
+
 
 int
 main(int argc, char *argv[])
@@ -111,7 +254,7 @@ main(int argc, char *argv[])
 	cmd_ln_t *config;
 	ngram_model_t *lm = NULL;
 	logmath_t *lmath;
-        int itype, otype;
+        int otype;
         char const *kase;
 
 	if ((config = cmd_ln_parse_r(NULL, defn, argc, argv, TRUE)) == NULL)
@@ -127,27 +270,21 @@ main(int argc, char *argv[])
 		E_FATAL("Failed to initialize log math\n");
 	}
 	
-	if (cmd_ln_str_r(config, "-i") == NULL || cmd_ln_str_r(config, "-i") == NULL) {
+	if (cmd_ln_str_r(config, "-i") == NULL || cmd_ln_str_r(config, "-o") == NULL) {
             E_ERROR("Please specify both input and output models\n");
             goto error_out;
         }	    
-	
-	/* Load the input language model. */
-        if (cmd_ln_str_r(config, "-ifmt")) {
-            if ((itype = ngram_str_to_type(cmd_ln_str_r(config, "-ifmt")))
-                == NGRAM_INVALID) {
-                E_ERROR("Invalid input type %s\n", cmd_ln_str_r(config, "-ifmt"));
+
+        if (cmd_ln_str_r(config, "-quanteval")) {
+            if (quant_tradeoffs(config, lmath) < 0)
                 goto error_out;
-            }
-            lm = ngram_model_read(config, cmd_ln_str_r(config, "-i"),
-                                  itype, lmath);
+            logmath_free(lmath);
+            cmd_ln_free_r(config);
+            return 0;
         }
-        else {
-            lm = ngram_model_read(config, cmd_ln_str_r(config, "-i"),
-                                  NGRAM_AUTO, lmath);
-	}
-
-	if (lm == NULL) {
+	
+	/* Load the input language model. */
+	if ((lm = read_input(config, lmath)) == NULL) {
 	    E_ERROR("Failed to read the model from the file '%s'\n", cmd_ln_str_r(config, "-i"));
 	    goto error_out;
 	}
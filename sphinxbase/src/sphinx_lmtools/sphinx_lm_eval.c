@@ -45,6 +45,7 @@
 #include <sphinxbase/err.h>
 #include <sphinxbase/pio.h>
 #include <sphinxbase/strfuncs.h>
+#include <sphinxbase/sbthread.h>
 
 #include <stdio.h>
 #include <string.h>
@@ -74,7 +75,7 @@ static const arg_t defn[] = {
   { "-lmctlfn",
     ARG_STRING,
     NULL,
-    "Control file listing a set of language models"},
+    "Control file listing a set of language models, all of which are evaluated"},
 
   { "-lmname",
     ARG_STRING,
@@ -88,6 +89,7 @@ static const arg_t defn[] = {
 
   { "-text",
     ARG_STRING,
+    NULL,
     "Text string to evaluate"},
 
   { "-mmap",
@@ -105,176 +107,337 @@ static const arg_t defn[] = {
     "1.0",
     "Word insertion probability" },
 
+  { "-nthreads",
+    ARG_INT32,
+    "1",
+    "Number of threads to use for evaluating -lsn" },
+
   { "-verbose",
     ARG_BOOLEAN,
     "no",
     "Print details of perplexity calculation" },
 
-  /* FIXME: Support -lmstartsym, -lmendsym, -lmctlfn, -ctl_lm */
+  /* FIXME: Support -lmstartsym, -lmendsym, -ctl_lm */
   { NULL, 0, NULL, NULL }
 };
 
+/* Lines of the transcription given to each thread at a time. */
+#define EVAL_CHUNK_LINES 1024
+
+/**
+ * Statistics accumulated while evaluating text with one model.
+ */
+typedef struct eval_stats_s {
+    float64 lscr;   /**< Sum of scores of evaluated words */
+    int32 nwords;   /**< Words seen, including OOVs and context cues */
+    int32 noovs;    /**< Out-of-vocabulary words */
+    int32 nccs;     /**< Context cues */
+} eval_stats_t;
+
+/**
+ * Work for one thread: a range of lines, evaluated against every model.
+ */
+typedef struct eval_job_s {
+    ngram_model_t **lms;
+    int32 n_lms;
+    char **lines;
+    int32 n_lines;
+    eval_stats_t *stats; /**< One per model */
+} eval_job_t;
+
 static int verbose;
 
+/**
+ * Score a sentence, adding it to stats.
+ *
+ * This walks the sentence with ngram_state_score(), which does not
+ * modify the model, so several threads can share one model.
+ */
+static void
+calc_entropy(ngram_model_t *lm, char **words, int32 n, eval_stats_t *stats)
+{
+    ngram_state_t state, next;
+    int32 startwid, unk, i;
+
+    unk = ngram_unknown_wid(lm);
+    /* Skip <s> as it's a context cue (HACK, this should be configurable). */
+    startwid = ngram_wid(lm, "<s>");
+
+    ngram_state_init(lm, &state, NULL, 0);
+    for (i = 0; i < n; ++i) {
+        int32 wid, n_used, prob;
+
+        /* Context cues and OOVs are not scored, but still go
+         * into the history as they would in ngram_ng_score(). */
+        wid = ngram_wid(lm, words[i]);
+        prob = ngram_state_score(lm, &state, wid, &next, &n_used);
+        if (wid == startwid)
+            ++stats->nccs;
+        else if (wid == NGRAM_INVALID_WID || wid == unk)
+            ++stats->noovs;
+        else {
+            if (verbose) {
+                int m;
+                printf("log P(%s|", ngram_word(lm, wid));
+                for (m = state.n_hist - 1; m >= 0; --m)
+                    printf("%s ", ngram_word(lm, state.hist[m]));
+                printf(") = %d\n", prob);
+            }
+            stats->lscr += prob;
+        }
+        state = next;
+    }
+    stats->nwords += n;
+}
+
+/**
+ * Split a line into words, dropping any utterance ID.
+ *
+ * @return Number of words, words are pointers into line.
+ */
+static int32
+split_line(char *line, char ***out_words)
+{
+    char **words;
+    int32 n;
+
+    n = str2words(line, NULL, 0);
+    if (n < 0)
+        E_FATAL("str2words(line, NULL, 0) = %d, should not happen\n", n);
+    if (n == 0) {
+        *out_words = NULL;
+        return 0;
+    }
+    words = ckd_calloc(n, sizeof(*words));
+    str2words(line, words, n);
+
+    /* Remove any utterance ID (FIXME: has to be a single "word") */
+    if (words[n-1][0] == '('
+        && words[n-1][strlen(words[n-1])-1] == ')')
+        n = n - 1;
+    *out_words = words;
+    return n;
+}
+
+static void
+eval_job_run(eval_job_t *job)
+{
+    int32 i, j;
+
+    for (i = 0; i < job->n_lines; ++i) {
+        char **words;
+        int32 n;
+
+        /* Each line is only split once for all the models. */
+        n = split_line(job->lines[i], &words);
+        for (j = 0; j < job->n_lms; ++j)
+            calc_entropy(job->lms[j], words, n, &job->stats[j]);
+        ckd_free(words);
+    }
+}
+
 static int
-calc_entropy(ngram_model_t *lm, char **words, int32 n,
-	     int32 *out_n_ccs, int32 *out_n_oovs, int32 *out_lm_score)
+eval_job_main(sbthread_t *th)
 {
-	int32 *wids;
-	int32 startwid;
-	int32 i, ch, nccs, noovs, unk;
-
-        if (n == 0)
-            return 0;
-
-        unk = ngram_unknown_wid(lm);
-
-	/* Reverse this array into an array of word IDs. */
-	wids = ckd_calloc(n, sizeof(*wids));
-	for (i = 0; i < n; ++i)
-		wids[n-i-1] = ngram_wid(lm, words[i]);
-	/* Skip <s> as it's a context cue (HACK, this should be configurable). */
-	startwid = ngram_wid(lm, "<s>");
-
-	/* Now evaluate the list of words in reverse using the
-	 * remainder of the array as the history. */
-	ch = noovs = nccs = 0;
-	for (i = 0; i < n; ++i) {
-		int32 n_used;
-		int32 prob;
-
-		/* Skip <s> as it's a context cue (HACK, this should be configurable). */
-		if (wids[i] == startwid) {
-			++nccs;
-			continue;
-		}
-		/* Skip and count OOVs. */
-		if (wids[i] == NGRAM_INVALID_WID || wids[i] == unk) {
-			++noovs;
-			continue;
-		}
-		/* Sum up information for each N-gram */
-		prob = ngram_ng_score(lm,
-				      wids[i], wids + i + 1,
-				      n - i - 1, &n_used);
-                if (verbose) {
-                    int m;
-                    printf("log P(%s|", ngram_word(lm, wids[i]));
-                    m = i + ngram_model_get_size(lm) - 1;
-                    if (m >= n)
-                        m = n - 1;
-                    while (m > i) {
-                        printf("%s ", ngram_word(lm, wids[m--]));
-                    }
-                    printf(") = %d\n", prob);
-                }
-		ch -= prob;
-	}
+    eval_job_run(sbthread_arg(th));
+    return 0;
+}
 
-	if (out_n_ccs) *out_n_ccs = nccs;
-	if (out_n_oovs) *out_n_oovs = noovs;
+/**
+ * Read up to max_lines lines, returning the number read.
+ */
+static int32
+read_chunk(lineiter_t **litor, char **lines, int32 max_lines)
+{
+    int32 n;
 
-	/* Calculate cross-entropy CH = - 1/N sum log P(W|H) */
-        n -= (nccs + noovs);
-        if (n <= 0)
-            return 0;
-        if (out_lm_score)
-            *out_lm_score = -ch;
-	return ch / n;
+    for (n = 0; *litor && n < max_lines; *litor = lineiter_next(*litor))
+        lines[n++] = ckd_salloc((*litor)->buf);
+    return n;
 }
 
-static void
-evaluate_file(ngram_model_t *lm, logmath_t *lmath, const char *lsnfn)
+/**
+ * Start evaluating lines, one contiguous range per thread.
+ *
+ * @return Threads to pass to wait_jobs(), or NULL if the work will be
+ * done there in this thread.
+ */
+static sbthread_t **
+start_jobs(eval_job_t *jobs, int32 nthreads, char **lines, int32 n_lines)
 {
-	FILE *fh;
-        lineiter_t *litor;
-	int32 nccs, noovs, nwords, lscr;
-	float64 ch, log_to_log2;;
-
-	if ((fh = fopen(lsnfn, "r")) == NULL)
-		E_FATAL_SYSTEM("failed to open transcript file %s", lsnfn);
-
-	/* We have to keep ch in floating-point to avoid overflows, so
-	 * we might as well use log2. */
-	log_to_log2 = log(logmath_get_base(lmath)) / log(2);
-	lscr = nccs = noovs = nwords = 0;
-	ch = 0.0;
-        for (litor = lineiter_start(fh); litor; litor = lineiter_next(litor)) {
-		char **words;
-		int32 n, tmp_ch, tmp_noovs, tmp_nccs, tmp_lscr;
-
-		n = str2words(litor->buf, NULL, 0);
-		if (n < 0)
-			E_FATAL("str2words(line, NULL, 0) = %d, should not happen\n", n);
-		if (n == 0) /* Do nothing! */
-			continue;
-		words = ckd_calloc(n, sizeof(*words));
-		str2words(litor->buf, words, n);
-
-		/* Remove any utterance ID (FIXME: has to be a single "word") */
-		if (words[n-1][0] == '('
-		    && words[n-1][strlen(words[n-1])-1] == ')')
-			n = n - 1;
-
-		tmp_ch = calc_entropy(lm, words, n, &tmp_nccs,
-                                      &tmp_noovs, &tmp_lscr);
-
-		ch += (float64) tmp_ch * (n - tmp_nccs - tmp_noovs) * log_to_log2;
-		nccs += tmp_nccs;
-		noovs += tmp_noovs;
-                lscr += tmp_lscr;
-		nwords += n;
-		
-		ckd_free(words);
-	}
+    sbthread_t **threads;
+    int32 i, per_job;
+
+    per_job = (n_lines + nthreads - 1) / nthreads;
+    for (i = 0; i < nthreads; ++i) {
+        int32 first = i * per_job;
+        jobs[i].lines = lines + first;
+        jobs[i].n_lines = (first >= n_lines) ? 0
+            : (n_lines - first < per_job ? n_lines - first : per_job);
+    }
+    if (nthreads == 1)
+        return NULL;
+    threads = ckd_calloc(nthreads, sizeof(*threads));
+    for (i = 0; i < nthreads; ++i) {
+        if ((threads[i] = sbthread_start(NULL, eval_job_main, &jobs[i])) == NULL) {
+            E_ERROR("Failed to start thread %d, evaluating in this one\n", i);
+            eval_job_run(&jobs[i]);
+        }
+    }
+    return threads;
+}
 
-	ch /= (nwords - nccs - noovs);
-	printf("cross-entropy: %f bits\n", ch);
+static void
+wait_jobs(sbthread_t **threads, eval_job_t *jobs, int32 nthreads)
+{
+    int32 i;
+
+    if (threads == NULL) {
+        eval_job_run(&jobs[0]);
+        return;
+    }
+    for (i = 0; i < nthreads; ++i) {
+        if (threads[i]) {
+            sbthread_wait(threads[i]);
+            sbthread_free(threads[i]);
+        }
+    }
+    ckd_free(threads);
+}
 
-	/* Calculate perplexity pplx = exp CH */
-	printf("perplexity: %f\n", pow(2.0, ch));
-        printf("lm score: %d\n", lscr);
+static void
+print_stats(eval_stats_t const *stats, logmath_t *lmath, int pct_oovs)
+{
+    float64 ch;
+    int32 nscored;
+
+    /* Calculate cross-entropy CH = - 1/N sum log P(W|H), in log2
+     * since we have it in floating point anyway. */
+    nscored = stats->nwords - stats->nccs - stats->noovs;
+    ch = 0.0;
+    if (nscored > 0)
+        ch = -stats->lscr / nscored
+            * log(logmath_get_base(lmath)) / log(2);
+    printf("cross-entropy: %f bits\n", ch);
+
+    /* Calculate perplexity pplx = exp CH */
+    printf("perplexity: %f\n", pow(2.0, ch));
+    printf("lm score: %.0f\n", stats->lscr);
+
+    /* Report OOVs and CCs */
+    printf("%d words evaluated\n", stats->nwords);
+    if (pct_oovs)
+        printf("%d OOVs (%.2f%%), %d context cues removed\n",
+               stats->noovs,
+               stats->nwords ? (double)stats->noovs / stats->nwords * 100 : 0.0,
+               stats->nccs);
+    else
+        printf("%d OOVs, %d context cues removed\n",
+               stats->noovs, stats->nccs);
+}
 
-	/* Report OOVs and CCs */
-	printf("%d words evaluated\n", nwords);
-	printf("%d OOVs (%.2f%%), %d context cues removed\n",
-	       noovs, (double)noovs / nwords * 100, nccs);
+static void
+evaluate_file(ngram_model_t **lms, char const **names, int32 n_lms,
+              logmath_t *lmath, const char *lsnfn, int32 nthreads)
+{
+    FILE *fh;
+    lineiter_t *litor;
+    eval_job_t *jobs;
+    eval_stats_t *total;
+    char **lines, **next_lines;
+    int32 i, j, n_lines, max_lines;
+
+    if ((fh = fopen(lsnfn, "r")) == NULL)
+        E_FATAL_SYSTEM("failed to open transcript file %s", lsnfn);
+
+    jobs = ckd_calloc(nthreads, sizeof(*jobs));
+    for (i = 0; i < nthreads; ++i) {
+        jobs[i].lms = lms;
+        jobs[i].n_lms = n_lms;
+        jobs[i].stats = ckd_calloc(n_lms, sizeof(*jobs[i].stats));
+    }
+
+    /* Read the next chunk of the transcription while the current
+     * one is being evaluated, so that it is never all in memory. */
+    max_lines = nthreads * EVAL_CHUNK_LINES;
+    lines = ckd_calloc(max_lines, sizeof(*lines));
+    next_lines = ckd_calloc(max_lines, sizeof(*next_lines));
+    litor = lineiter_start(fh);
+    n_lines = read_chunk(&litor, lines, max_lines);
+    while (n_lines > 0) {
+        char **tmp;
+        int32 n_next;
+
+        sbthread_t **threads;
+
+        threads = start_jobs(jobs, nthreads, lines, n_lines);
+        n_next = read_chunk(&litor, next_lines, max_lines);
+        wait_jobs(threads, jobs, nthreads);
+        for (i = 0; i < n_lines; ++i)
+            ckd_free(lines[i]);
+        tmp = lines;
+        lines = next_lines;
+        next_lines = tmp;
+        n_lines = n_next;
+    }
+    lineiter_free(litor);
+    fclose(fh);
+
+    /* Merge the per-thread statistics. */
+    total = ckd_calloc(n_lms, sizeof(*total));
+    for (i = 0; i < nthreads; ++i) {
+        for (j = 0; j < n_lms; ++j) {
+            total[j].lscr += jobs[i].stats[j].lscr;
+            total[j].nwords += jobs[i].stats[j].nwords;
+            total[j].noovs += jobs[i].stats[j].noovs;
+            total[j].nccs += jobs[i].stats[j].nccs;
+        }
+        ckd_free(jobs[i].stats);
+    }
+    for (j = 0; j < n_lms; ++j) {
+        if (n_lms > 1)
+            printf("%s:\n", names[j]);
+        print_stats(&total[j], lmath, TRUE);
+    }
+    ckd_free(total);
+    ckd_free(jobs);
+    ckd_free(lines);
+    ckd_free(next_lines);
 }
 
 static void
-evaluate_string(ngram_model_t *lm, logmath_t *lmath, const char *text)
+evaluate_string(ngram_model_t **lms, char const **names, int32 n_lms,
+                logmath_t *lmath, const char *text)
 {
-	char *textfoo;
-	char **words;
-	int32 n, ch, noovs, nccs, lscr;
-
-	/* Split it into an array of strings. */
-	textfoo = ckd_salloc(text);
-	n = str2words(textfoo, NULL, 0);
-	if (n < 0)
-		E_FATAL("str2words(textfoo, NULL, 0) = %d, should not happen\n", n);
-	if (n == 0) /* Do nothing! */
-		return;
-	words = ckd_calloc(n, sizeof(*words));
-	str2words(textfoo, words, n);
-
-	ch = calc_entropy(lm, words, n, &nccs, &noovs, &lscr);
-
-	printf("input: %s\n", text);
-	printf("cross-entropy: %f bits\n",
-	       ch * log(logmath_get_base(lmath)) / log(2));
-
-	/* Calculate perplexity pplx = exp CH */
-	printf("perplexity: %f\n", logmath_exp(lmath, ch));
-        printf("lm score: %d\n", lscr);
-
-	/* Report OOVs and CCs */
-	printf("%d words evaluated\n", n);
-	printf("%d OOVs, %d context cues removed\n",
-	      noovs, nccs);
-
-	ckd_free(textfoo);
-	ckd_free(words);
+    char *textfoo;
+    char **words;
+    int32 i, n;
+
+    /* Split it into an array of strings. */
+    textfoo = ckd_salloc(text);
+    n = str2words(textfoo, NULL, 0);
+    if (n < 0)
+        E_FATAL("str2words(textfoo, NULL, 0) = %d, should not happen\n", n);
+    if (n == 0) { /* Do nothing! */
+        ckd_free(textfoo);
+        return;
+    }
+    words = ckd_calloc(n, sizeof(*words));
+    str2words(textfoo, words, n);
+
+    printf("input: %s\n", text);
+    for (i = 0; i < n_lms; ++i) {
+        eval_stats_t stats;
+
+        memset(&stats, 0, sizeof(stats));
+        calc_entropy(lms[i], words, n, &stats);
+        if (n_lms > 1)
+            printf("%s:\n", names[i]);
+        print_stats(&stats, lmath, FALSE);
+    }
+
+    ckd_free(textfoo);
+    ckd_free(words);
 }
 
 int
@@ -282,13 +445,23 @@ main(int argc, char *argv[])
 {
 	cmd_ln_t *config;
 	ngram_model_t *lm = NULL;
+	ngram_model_t **lms;
+	char const **names;
 	logmath_t *lmath;
-	const char *lmfn, *probdefn, *lsnfn, *text;
+	const char *lmfn, *lmctlfn, *lmname, *probdefn, *lsnfn, *text;
+	int32 n_lms, nthreads;
 
 	if ((config = cmd_ln_parse_r(NULL, defn, argc, argv, TRUE)) == NULL)
 		return 1;
 
         verbose = cmd_ln_boolean_r(config, "-verbose");
+        nthreads = cmd_ln_int32_r(config, "-nthreads");
+        if (nthreads < 1)
+            nthreads = 1;
+        if (verbose && nthreads > 1) {
+            E_WARN("-verbose output needs a single thread, using one\n");
+            nthreads = 1;
+        }
 
 	/* Create log math object. */
 	if ((lmath = logmath_init
@@ -296,29 +469,73 @@ main(int argc, char *argv[])
 		E_FATAL("Failed to initialize log math\n");
 	}
 
-	/* Load the language model. */
+	/* Load the language model(s). */
 	lmfn = cmd_ln_str_r(config, "-lm");
-	if (lmfn == NULL
-	    || (lm = ngram_model_read(config, lmfn,
-				      NGRAM_AUTO, lmath)) == NULL) {
-		E_FATAL("Failed to load language model from %s\n",
-			cmd_ln_str_r(config, "-lm"));
+	lmctlfn = cmd_ln_str_r(config, "-lmctlfn");
+	if (lmfn) {
+		if ((lm = ngram_model_read(config, lmfn,
+					   NGRAM_AUTO, lmath)) == NULL)
+			E_FATAL("Failed to load language model from %s\n", lmfn);
+		if ((probdefn = cmd_ln_str_r(config, "-probdef")) != NULL)
+			ngram_model_read_classdef(lm, probdefn);
+	}
+	else if (lmctlfn) {
+		if ((lm = ngram_model_set_read(config, lmctlfn, lmath)) == NULL)
+			E_FATAL("Failed to load language models from %s\n", lmctlfn);
 	}
-        if ((probdefn = cmd_ln_str_r(config, "-probdef")) != NULL)
-            ngram_model_read_classdef(lm, probdefn);
+	else
+		E_FATAL("Either -lm or -lmctlfn must be given\n");
         ngram_model_apply_weights(lm,
                                   cmd_ln_float32_r(config, "-lw"),
                                   cmd_ln_float32_r(config, "-wip"));
 
+	/* Evaluate each model in a set directly rather than through the
+	 * set, which is both faster and safe to share between threads. */
+	if (lmfn) {
+		n_lms = 1;
+		lms = ckd_calloc(1, sizeof(*lms));
+		names = ckd_calloc(1, sizeof(*names));
+		lms[0] = lm;
+		names[0] = lmfn;
+	}
+	else if ((lmname = cmd_ln_str_r(config, "-lmname")) != NULL) {
+		n_lms = 1;
+		lms = ckd_calloc(1, sizeof(*lms));
+		names = ckd_calloc(1, sizeof(*names));
+		if ((lms[0] = ngram_model_set_lookup(lm, lmname)) == NULL)
+			E_FATAL("No language model named %s in %s\n",
+				lmname, lmctlfn);
+		names[0] = lmname;
+	}
+	else {
+		ngram_model_set_iter_t *itor;
+
+		n_lms = ngram_model_set_count(lm);
+		lms = ckd_calloc(n_lms, sizeof(*lms));
+		names = ckd_calloc(n_lms, sizeof(*names));
+		n_lms = 0;
+		for (itor = ngram_model_set_iter(lm); itor;
+		     itor = ngram_model_set_iter_next(itor)) {
+			lms[n_lms] = ngram_model_set_iter_model(itor, &names[n_lms]);
+			++n_lms;
+		}
+	}
+
 	/* Now evaluate some text. */
 	lsnfn = cmd_ln_str_r(config, "-lsn");
 	text = cmd_ln_str_r(config, "-text");
 	if (lsnfn) {
-		evaluate_file(lm, lmath, lsnfn);
+		evaluate_file(lms, names, n_lms, lmath, lsnfn, nthreads);
 	}
 	else if (text) {
-		evaluate_string(lm, lmath, text);
+		evaluate_string(lms, names, n_lms, lmath, text);
 	}
 
+	ckd_free(lms);
+	ckd_free(names);
+	ngram_model_free(lm);
+	logmath_free(lmath);
+	cmd_ln_free_r(config);
+
 	return 0;
 }
@@ -0,0 +1,31 @@
+#!/bin/sh
+. ./testfuncs.sh
+
+tmpout="test-sphinx_fe-noise.out"
+
+echo "WAVE2FEAT-NOISE TEST"
+run_program sphinx_fe/sphinx_fe \
+-remove_noise yes \
+-remove_silence no \
+-logspec yes \
+-samprate 11025 \
+-frate 105 \
+-wlen 0.024 \
+-alpha 0.97 \
+-nfft 512 \
+-nfilt 36 \
+-upperf 5400 \
+-lowerf 130 \
+-i $tests/regression/chan3.raw \
+-input_endian little \
+-o test-sphinx_fe-noise.logspec.out  \
+-raw yes > $tmpout 2>&1 
+
+run_program sphinx_cepview/sphinx_cepview \
+-i 36 \
+-d 36 \
+-f test-sphinx_fe-noise.logspec.out \
+> test-sphinx_fe-noise.cepview.out 2>>$tmpout
+
+compare_table "WAVE2FEAT-NOISE test" test-sphinx_fe-noise.cepview.out \
+    $tests/regression/chan3-noise.cepview 0.002
@@ -0,0 +1,39 @@
+#!/bin/sh
+. ./testfuncs.sh
+
+tmpout="test-sphinx_fe-threads.out"
+
+echo "WAVE2FEAT THREADS TEST"
+for n in 1 3; do
+    run_program sphinx_fe/sphinx_fe \
+    -samprate 11025 \
+    -vad_threshold 2.0 \
+    -frate 105 \
+    -wlen 0.024 \
+    -alpha 0.97 \
+    -ncep 13 \
+    -nfft 512 \
+    -nfilt 36 \
+    -upperf 5400 \
+    -lowerf 130 \
+    -blocksize 262500 \
+    -nthreads $n \
+    -c $tests/regression/chan3.ctl \
+    -di $tests/regression \
+    -do . \
+    -eo threads$n.mfc \
+    -input_endian little \
+    >> $tmpout 2>&1
+done
+
+for f in chan3.raw chan3.wav chan3.sph; do
+    if ! cmp $f.threads1.mfc $f.threads3.mfc; then
+        fail "$f threaded compare"
+    fi
+done
+
+if grep -q "Throughput:" $tmpout; then
+    pass "WAVE2FEAT threads test"
+else
+    fail "WAVE2FEAT throughput report"
+fi
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <string.h>
 
 #include <ckd_alloc.h>
 
@@ -99,5 +100,46 @@ main(int argc, char *argv[])
 	ckd_free_3d_ptr(alloc3);
 	ckd_free(alloc1);
 
+	/* Arenas. */
+	{
+		arena_t *arena;
+		arena_mark_t mark;
+		char *str, *big;
+		int *first;
+
+		TEST_ASSERT(arena = ckd_arena_init(256));
+		first = ckd_arena_calloc(arena, 27, sizeof(*first));
+		for (i = 0; i < 27; ++i) {
+			TEST_EQUAL(first[i], 0);
+			first[i] = i + 1;
+		}
+		str = ckd_arena_salloc(arena, "hello");
+		TEST_EQUAL(0, strcmp(str, "hello"));
+		TEST_EQUAL(0, (size_t)str % 8);
+		/* Bigger than a block. */
+		big = ckd_arena_calloc(arena, 1000, 1);
+		memset(big, 0xff, 1000);
+		for (i = 0; i < 27; ++i)
+			TEST_EQUAL(first[i], i + 1);
+
+		/* A nested scope gives its memory back. */
+		mark = ckd_arena_mark(arena);
+		for (i = 0; i < 100; ++i)
+			str = ckd_arena_salloc(arena, "goodbye");
+		ckd_arena_release(arena, mark);
+		TEST_ASSERT(ckd_arena_salloc(arena, "goodbye") != str);
+		TEST_EQUAL(0, strcmp(str, "goodbye"));
+
+		/* A reset starts over, with zeroed memory. */
+		ckd_arena_reset(arena);
+		TEST_ASSERT(ckd_arena_calloc(arena, 27, sizeof(*first)) == first);
+		for (i = 0; i < 27; ++i)
+			TEST_EQUAL(first[i], 0);
+		big = ckd_arena_calloc(arena, 1000, 1);
+		for (i = 0; i < 1000; ++i)
+			TEST_EQUAL(big[i], 0);
+		ckd_arena_free(arena);
+	}
+
 	return 0;
 }
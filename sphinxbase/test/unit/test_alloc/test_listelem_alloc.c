@@ -2,6 +2,7 @@
 #include <string.h>
 
 #include <listelem_alloc.h>
+#include <sbthread.h>
 
 #include "test_macros.h"
 
@@ -10,6 +11,28 @@ struct bogus {
 	long foobie;
 };
 
+static int
+cache_thread(sbthread_t *th)
+{
+	listelem_cache_t *lc;
+	struct bogus *bogus[1000];
+	int i, j;
+
+	lc = listelem_cache_init(sbthread_arg(th));
+	for (j = 0; j < 10; ++j) {
+		for (i = 0; i < 1000; ++i) {
+			bogus[i] = listelem_cache_malloc(lc);
+			bogus[i]->foobie = i;
+		}
+		for (i = 0; i < 1000; ++i) {
+			TEST_EQUAL(i, bogus[i]->foobie);
+			listelem_cache_release(lc, bogus[i]);
+		}
+	}
+	listelem_cache_free(lc);
+	return 0;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -56,6 +79,46 @@ main(int argc, char *argv[])
 		listelem_stats(le);
 		for (i = 0; i < 600; ++i)
 			TEST_EQUAL(bogus[i], listelem_get_item(le, bogus_id[i]));
+
+		/* Resetting frees everything without adding blocks. */
+		listelem_alloc_reset(le);
+		for (i = 0; i < 600; ++i)
+			TEST_EQUAL(bogus[i], listelem_get_item(le, bogus_id[i]));
+		for (i = 0; i < 600; ++i)
+			bogus[i] = listelem_malloc_id(le, bogus_id + i);
+		for (i = 0; i < 600; ++i)
+			TEST_EQUAL(((i / 50) << 16) | (i % 50), bogus_id[i]);
+		listelem_alloc_free(le);
+	}
+
+	{
+		listelem_cache_t *lc, *lc2;
+		sbthread_t *th[4];
+
+		le = listelem_alloc_init(sizeof(struct bogus));
+		lc = listelem_cache_init(le);
+		lc2 = listelem_cache_init(le);
+		bogus1 = listelem_cache_malloc(lc);
+		bogus2 = listelem_cache_malloc(lc2);
+		TEST_ASSERT(bogus1 != bogus2);
+		/* Elements can go back through another cache. */
+		listelem_cache_release(lc2, bogus1);
+		listelem_cache_release(lc, bogus2);
+		listelem_cache_free(lc2);
+		/* A reset empties the caches too. */
+		bogus1 = listelem_cache_malloc(lc);
+		listelem_alloc_reset(le);
+		bogus2 = listelem_cache_malloc(lc);
+		listelem_cache_free(lc);
+		listelem_stats(le);
+
+		for (i = 0; i < 4; ++i)
+			TEST_ASSERT(th[i] = sbthread_start(NULL, cache_thread, le));
+		for (i = 0; i < 4; ++i) {
+			TEST_EQUAL(0, sbthread_wait(th[i]));
+			sbthread_free(th[i]);
+		}
+		listelem_stats(le);
 		listelem_alloc_free(le);
 	}
 
@@ -26,6 +26,38 @@ main(int argc, char *argv[])
 	bitvec_clear(bv, 43);
 	TEST_EQUAL(0, bitvec_is_set(bv,43));
 
+	/* Iterate over the set bits. */
+	TEST_EQUAL(0, bitvec_next_set(bv, 199, 0));
+	TEST_EQUAL(42, bitvec_next_set(bv, 199, 1));
+	TEST_EQUAL(44, bitvec_next_set(bv, 199, 43));
+	TEST_EQUAL(198, bitvec_next_set(bv, 199, 45));
+	TEST_EQUAL(199, bitvec_next_set(bv, 199, 199));
+	TEST_EQUAL(198, bitvec_next_set(bv, 198, 45));
+	j = 0;
+	for (i = bitvec_next_set(bv, 199, 0); i < 199;
+	     i = bitvec_next_set(bv, 199, i + 1)) {
+		TEST_ASSERT(bitvec_is_set(bv, i));
+		++j;
+	}
+	TEST_EQUAL(4, j);
+	TEST_EQUAL(4, bitvec_count_set(bv, 199));
+	TEST_EQUAL(3, bitvec_count_set(bv, 198));
+	TEST_EQUAL(1, bitvec_ctz_generic(2));
+	TEST_EQUAL(31, bitvec_ctz_generic(0x80000000));
+	TEST_EQUAL(32, bitvec_popcount_generic(0xffffffff));
+	TEST_EQUAL(3, bitvec_popcount_generic(0x80000101));
+	{
+		bitvec_t *bv2 = bitvec_alloc(199);
+		bitvec_set(bv2, 43);
+		bitvec_set(bv2, 44);
+		bitvec_set(bv2, 100);
+		TEST_EQUAL(6, bitvec_or(bv2, bv, 199));
+		TEST_ASSERT(bitvec_is_set(bv2, 0));
+		TEST_ASSERT(bitvec_is_set(bv2, 43));
+		TEST_ASSERT(bitvec_is_set(bv2, 198));
+		bitvec_free(bv2);
+	}
+
 	c = clock();
 	for (j = 0; j < 1000000; ++j)
 		bitvec_count_set(bv, 199);
@@ -0,0 +1,78 @@
+/* -*- c-basic-offset: 4; indent-tabs-mode: nil -*- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmd_ln.h"
+#include "ckd_alloc.h"
+
+#include "test_macros.h"
+
+const arg_t defs[] = {
+    { "-a", ARG_INT32, "42", "This is the first argument." },
+    { "-b", ARG_STRING, NULL, "This is the second argument." },
+    { "-c", ARG_BOOLEAN, "no", "This is the third argument." },
+    { "-d", ARG_FLOAT64, "1e-50", "This is the fourth argument." },
+    { "-l", ARG_STRING_LIST, "foo,bar", "This is the fifth argument." },
+    { NULL, 0, NULL, NULL }
+};
+
+int
+main(int argc, char *argv[])
+{
+    cmd_ln_t *config, *clone, *clone2;
+    cmd_ln_key_t a, b, c, d;
+
+    TEST_ASSERT(config = cmd_ln_init(NULL, defs, TRUE,
+                                     "-b", "foobie", "-c", "yes", NULL));
+
+    /* Keys give the same values as names. */
+    TEST_ASSERT((a = cmd_ln_key_r(config, "-a")) != CMD_LN_NO_KEY);
+    TEST_ASSERT((b = cmd_ln_key_r(config, "-b")) != CMD_LN_NO_KEY);
+    TEST_ASSERT((c = cmd_ln_key_r(config, "-c")) != CMD_LN_NO_KEY);
+    TEST_ASSERT((d = cmd_ln_key_r(config, "-d")) != CMD_LN_NO_KEY);
+    TEST_EQUAL(CMD_LN_NO_KEY, cmd_ln_key_r(config, "-e"));
+    TEST_EQUAL(42, cmd_ln_int32_k(config, a));
+    TEST_EQUAL(0, strcmp("foobie", cmd_ln_str_k(config, b)));
+    TEST_EQUAL(TRUE, cmd_ln_boolean_k(config, c));
+    TEST_EQUAL(cmd_ln_float_r(config, "-d"), cmd_ln_float_k(config, d));
+    TEST_ASSERT(cmd_ln_access_k(config, CMD_LN_NO_KEY) == NULL);
+    TEST_EQUAL(0, cmd_ln_int_k(config, CMD_LN_NO_KEY));
+
+    /* And see values that are set later. */
+    cmd_ln_set_int32_r(config, "-a", 69);
+    TEST_EQUAL(69, cmd_ln_int32_k(config, a));
+
+    /* A clone shares values until one of them changes. */
+    TEST_ASSERT(clone = cmd_ln_clone(config));
+    TEST_ASSERT(cmd_ln_str_r(clone, "-b") == cmd_ln_str_r(config, "-b"));
+    TEST_EQUAL(69, cmd_ln_int32_k(clone, a));
+    cmd_ln_set_str_r(clone, "-b", "bazbiz");
+    cmd_ln_set_int32_r(clone, "-a", 7);
+    TEST_EQUAL(0, strcmp("bazbiz", cmd_ln_str_k(clone, b)));
+    TEST_EQUAL(0, strcmp("foobie", cmd_ln_str_k(config, b)));
+    TEST_EQUAL(7, cmd_ln_int32_k(clone, a));
+    TEST_EQUAL(69, cmd_ln_int32_k(config, a));
+    TEST_EQUAL(0, strcmp("bar", cmd_ln_str_list_r(clone, "-l")[1]));
+    TEST_ASSERT(cmd_ln_str_list_r(clone, "-l")
+                != cmd_ln_str_list_r(config, "-l"));
+
+    /* Changing the original leaves its clones alone too. */
+    TEST_ASSERT(clone2 = cmd_ln_clone(config));
+    cmd_ln_set_boolean_r(config, "-c", FALSE);
+    cmd_ln_set_str_extra_r(config, "_extra", "quux");
+    TEST_EQUAL(FALSE, cmd_ln_boolean_k(config, c));
+    TEST_EQUAL(TRUE, cmd_ln_boolean_k(clone2, c));
+    TEST_ASSERT(cmd_ln_exists_r(config, "_extra"));
+    TEST_ASSERT(!cmd_ln_exists_r(clone2, "_extra"));
+
+    /* Clones outlive the original. */
+    TEST_EQUAL(0, cmd_ln_free_r(config));
+    TEST_EQUAL(0, strcmp("foobie", cmd_ln_str_k(clone2, b)));
+    TEST_EQUAL(0, cmd_ln_free_r(clone2));
+    TEST_EQUAL(0, strcmp("bazbiz", cmd_ln_str_k(clone, b)));
+    TEST_EQUAL(0, cmd_ln_free_r(clone));
+
+    return 0;
+}
@@ -208,6 +208,38 @@ main(int argc, char *argv[])
     }
     printf("\n");
 
+    /* Voiced speech comes out one frame shift per frame of speech,
+     * including the prespeech frames. */
+    {
+        int16 *voiced;
+        int32 nvoiced, total_voiced, total_frames, frameidx;
+        size_t nread;
+
+        voiced = ckd_calloc((5 + cmd_ln_int32_r(config, "-vad_prespeech") + 1)
+                            * frame_shift, sizeof(*voiced));
+        fseek(raw, 0, SEEK_SET);
+        fe_start_stream(fe);
+        TEST_EQUAL(0, fe_start_utt(fe));
+        total_voiced = total_frames = 0;
+        while ((nread = fread(buf, sizeof(int16), 1024, raw)) > 0) {
+            inptr = &buf[0];
+            nsamp = nread;
+            while (nsamp) {
+                nfr = 5;
+                TEST_ASSERT(fe_process_frames_ext(fe, &inptr, &nsamp, cepbuf1,
+                                                  &nfr, voiced, &nvoiced,
+                                                  &frameidx) >= 0);
+                total_frames += nfr;
+                total_voiced += nvoiced;
+            }
+        }
+        TEST_ASSERT(fe_end_utt(fe, cepbuf1[0], &nfr) >= 0);
+        printf("%d voiced frames %d samples\n", total_frames, total_voiced);
+        TEST_ASSERT(total_frames > 0);
+        TEST_EQUAL(total_frames * frame_shift, total_voiced);
+        ckd_free(voiced);
+    }
+
     ckd_free_2d(cepbuf1);
     ckd_free_2d(cepbuf2);
     fclose(raw);
@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "fe.h"
+#include "cmd_ln.h"
+#include "ckd_alloc.h"
+
+#include "test_macros.h"
+
+#define NSTREAMS 3
+#define NSAMPS 16000
+#define NFR 200
+
+/* Batched processing of several streams with cloned front ends must
+ * give the same output as processing each one on its own. */
+int
+main(int argc, char *argv[])
+{
+    static const arg_t fe_args[] = {
+        waveform_to_cepstral_command_line_macro(),
+        { NULL, 0, NULL, NULL }
+    };
+    FILE *raw;
+    cmd_ln_t *config;
+    fe_t *fe, *fes[NSTREAMS];
+    int16 *buf;
+    int16 const *inptr[NSTREAMS];
+    int16 const **inptrs[NSTREAMS];
+    size_t nsamps[NSTREAMS];
+    int32 nfr[NSTREAMS];
+    mfcc_t **cep[NSTREAMS], ***ceps, **refcep;
+    int i, j, k;
+
+    TEST_ASSERT(config = cmd_ln_parse_r(NULL, fe_args, argc, argv, FALSE));
+    TEST_ASSERT(fe = fe_init_auto_r(config));
+
+    TEST_ASSERT(raw = fopen(TESTDATADIR "/chan3.raw", "rb"));
+    buf = ckd_calloc(NSAMPS * NSTREAMS, sizeof(*buf));
+    TEST_EQUAL(NSAMPS * NSTREAMS,
+               fread(buf, sizeof(*buf), NSAMPS * NSTREAMS, raw));
+    fclose(raw);
+
+    fes[0] = fe_retain(fe);
+    for (i = 1; i < NSTREAMS; ++i)
+        TEST_ASSERT(fes[i] = fe_clone(fe));
+    ceps = ckd_calloc(NSTREAMS, sizeof(*ceps));
+    for (i = 0; i < NSTREAMS; ++i) {
+        cep[i] = ckd_calloc_2d(NFR, fe_get_output_size(fe), sizeof(**cep[i]));
+        ceps[i] = cep[i];
+        inptr[i] = buf + i * NSAMPS;
+        inptrs[i] = &inptr[i];
+        nsamps[i] = NSAMPS;
+        nfr[i] = NFR;
+        fe_start_stream(fes[i]);
+        fe_start_utt(fes[i]);
+    }
+    TEST_EQUAL(0, fe_process_frames_batch(fes, NSTREAMS, inptrs, nsamps,
+                                          ceps, nfr, NULL));
+
+    /* Now do each one separately with a fresh front end. */
+    refcep = ckd_calloc_2d(NFR, fe_get_output_size(fe), sizeof(**refcep));
+    for (i = 0; i < NSTREAMS; ++i) {
+        fe_t *rfe;
+        int16 const *p = buf + i * NSAMPS;
+        size_t ns = NSAMPS;
+        int32 nf = NFR;
+
+        TEST_ASSERT(rfe = fe_init_auto_r(cmd_ln_retain(config)));
+        fe_start_stream(rfe);
+        fe_start_utt(rfe);
+        TEST_EQUAL(0, fe_process_frames(rfe, &p, &ns, refcep, &nf, NULL));
+        printf("stream %d: %d frames, %d remaining\n", i, nf, (int)ns);
+        TEST_EQUAL(nf, nfr[i]);
+        TEST_EQUAL(ns, nsamps[i]);
+        for (j = 0; j < nf; ++j)
+            for (k = 0; k < fe_get_output_size(fe); ++k)
+                TEST_EQUAL(refcep[j][k], cep[i][j][k]);
+        fe_free(rfe);
+    }
+
+    for (i = 0; i < NSTREAMS; ++i) {
+        ckd_free_2d(cep[i]);
+        fe_free(fes[i]);
+    }
+    ckd_free_2d(refcep);
+    ckd_free(ceps);
+    ckd_free(buf);
+    /* The clones should have released their references. */
+    TEST_EQUAL(0, fe_free(fe));
+    cmd_ln_free_r(config);
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "fe.h"
+#include "fe_cache.h"
+#include "cmd_ln.h"
+#include "ckd_alloc.h"
+
+#include "test_macros.h"
+
+#define NSAMPS 16000
+
+/* A miss must store exactly what the front end computes, and a hit
+ * must give it back without running the front end. */
+int
+main(int argc, char *argv[])
+{
+    static const arg_t fe_args[] = {
+        waveform_to_cepstral_command_line_macro(),
+        { NULL, 0, NULL, NULL }
+    };
+    FILE *raw;
+    cmd_ln_t *config;
+    fe_t *fe;
+    fe_cache_t *fc;
+    int16 *buf;
+    int16 const *inptr;
+    size_t nsamps;
+    mfcc_t **cep, **refcep;
+    int32 nfr, nref, ntail;
+    char *path;
+    uint64 key;
+    int i, j;
+
+    TEST_ASSERT(config = cmd_ln_parse_r(NULL, fe_args, argc, argv, FALSE));
+    TEST_ASSERT(fe = fe_init_auto_r(config));
+
+    TEST_ASSERT(raw = fopen(TESTDATADIR "/chan3.raw", "rb"));
+    buf = ckd_calloc(NSAMPS, sizeof(*buf));
+    TEST_EQUAL(NSAMPS, fread(buf, sizeof(*buf), NSAMPS, raw));
+    fclose(raw);
+
+    /* Reference output, straight from the front end. */
+    refcep = ckd_calloc_2d(NSAMPS / 160 + 1, fe_get_output_size(fe),
+                           sizeof(**refcep));
+    inptr = buf;
+    nsamps = NSAMPS;
+    nref = NSAMPS / 160 + 1;
+    fe_start_stream(fe);
+    fe_start_utt(fe);
+    TEST_EQUAL(0, fe_process_frames(fe, &inptr, &nsamps, refcep, &nref, NULL));
+    fe_end_utt(fe, refcep[nref], &ntail);
+    nref += ntail;
+
+    TEST_ASSERT(fc = fe_cache_init(fe, "fecache"));
+    key = fe_cache_key(fc, buf, NSAMPS);
+    path = ckd_calloc(64, 1);
+    sprintf(path, "fecache/%08x%08x.fec",
+            (unsigned int)(key >> 32), (unsigned int)(key & 0xffffffff));
+    remove(path);
+
+    /* The key depends on the audio. */
+    buf[NSAMPS / 2] ^= 1;
+    TEST_ASSERT(key != fe_cache_key(fc, buf, NSAMPS));
+    buf[NSAMPS / 2] ^= 1;
+
+    /* First time is a miss. */
+    TEST_EQUAL(0, fe_cache_process_utt(fc, buf, NSAMPS, &cep, &nfr));
+    TEST_EQUAL(nref, nfr);
+    for (i = 0; i < nfr; ++i)
+        for (j = 0; j < fe_get_output_size(fe); ++j)
+            TEST_EQUAL(refcep[i][j], cep[i][j]);
+    TEST_ASSERT(NULL != (raw = fopen(path, "rb")));
+    fclose(raw);
+
+    /* Second time is a hit. */
+    TEST_EQUAL(1, fe_cache_process_utt(fc, buf, NSAMPS, &cep, &nfr));
+    TEST_EQUAL(nref, nfr);
+    for (i = 0; i < nfr; ++i)
+        for (j = 0; j < fe_get_output_size(fe); ++j)
+            TEST_EQUAL(refcep[i][j], cep[i][j]);
+
+    /* A truncated entry is ignored and replaced. */
+    TEST_ASSERT(raw = fopen(path, "wb"));
+    fwrite(buf, 1, 17, raw);
+    fclose(raw);
+    TEST_EQUAL(0, fe_cache_process_utt(fc, buf, NSAMPS, &cep, &nfr));
+    TEST_EQUAL(nref, nfr);
+    remove(path);
+
+    fe_cache_free(fc);
+    ckd_free(path);
+    ckd_free_2d(refcep);
+    ckd_free(buf);
+    fe_free(fe);
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "fe.h"
+#include "cmd_ln.h"
+#include "ckd_alloc.h"
+#include "genrand.h"
+
+#include "fe_internal.h"
+
+#include "test_macros.h"
+
+/* Each FFT backend compiled in must give exactly the same output as
+ * the reference implementation. */
+int
+main(int argc, char *argv[])
+{
+    static const arg_t fe_args[] = {
+        waveform_to_cepstral_command_line_macro(),
+        { NULL, 0, NULL, NULL }
+    };
+    static char const *backends[] = {
+        "sse2", "avx2", "neon"
+    };
+    static char const *params[][3] = {
+        { "8000", "256", "3500" },
+        { "16000", "512", "6855.4976" },
+        { "16000", "1024", "6855.4976" },
+        { "44100", "2048", "6855.4976" }
+    };
+    cmd_ln_t *config;
+    fe_t *fe;
+    frame_t *input, *output;
+    int i, j, k, b;
+
+    s3_rand_seed(1337);
+    for (k = 0; k < (int)(sizeof(params) / sizeof(params[0])); ++k) {
+        TEST_ASSERT(config = cmd_ln_init(NULL, fe_args, TRUE,
+                                         "-samprate", params[k][0],
+                                         "-nfft", params[k][1],
+                                         "-upperf", params[k][2], NULL));
+        TEST_ASSERT(fe = fe_init_auto_r(config));
+        printf("nfft %d default backend %s\n",
+               fe->fft_size, fe->fft_backend);
+
+        input = ckd_calloc(fe->fft_size, sizeof(*input));
+        output = ckd_calloc(fe->fft_size, sizeof(*output));
+        for (b = 0; b < (int)(sizeof(backends) / sizeof(backends[0])); ++b) {
+            if (fe_fft_set_backend(fe, backends[b]) < 0)
+                continue;
+            printf("nfft %d testing backend %s\n",
+                   fe->fft_size, fe->fft_backend);
+            for (j = 0; j < 10; ++j) {
+                for (i = 0; i < fe->frame_size; ++i)
+#ifdef FIXED_POINT
+                    input[i] = (frame_t)(s3_rand_int31() % 65536 - 32768)
+                        << DEFAULT_RADIX;
+#else
+                    input[i] = (frame_t)(s3_rand_int31() % 65536 - 32768);
+#endif
+                memcpy(fe->frame, input, fe->fft_size * sizeof(*input));
+                fe_fft_real_ref(fe);
+                memcpy(output, fe->frame, fe->fft_size * sizeof(*output));
+
+                memcpy(fe->frame, input, fe->fft_size * sizeof(*input));
+                fe->fft_real(fe);
+                for (i = 0; i < fe->fft_size; ++i)
+                    TEST_EQUAL(output[i], fe->frame[i]);
+            }
+        }
+        ckd_free(input);
+        ckd_free(output);
+        fe_free(fe);
+        cmd_ln_free_r(config);
+    }
+
+    return 0;
+}
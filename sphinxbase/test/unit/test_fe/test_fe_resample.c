@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "fe.h"
+#include "cmd_ln.h"
+#include "ckd_alloc.h"
+
+#include "fe_resample.h"
+#include "test_macros.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define NSAMPS 16000
+
+/* Resample a sine wave, feeding it in odd-sized blocks, and compare
+ * it to the same sine wave generated at the output rate. */
+static void
+test_sine(int32 in_rate, int32 out_rate)
+{
+    fe_resampler_t *rs;
+    int16 *in, *out;
+    int16 const *inptr;
+    size_t nin, nout, maxout;
+    double err, ref;
+    int i, n;
+
+    printf("sine %d -> %d\n", in_rate, out_rate);
+    in = ckd_calloc(NSAMPS, sizeof(*in));
+    for (i = 0; i < NSAMPS; ++i)
+        in[i] = (int16)(10000 * sin(2 * M_PI * 440 * i / in_rate));
+    maxout = (size_t)((double)NSAMPS * out_rate / in_rate) + 1;
+    out = ckd_calloc(maxout, sizeof(*out));
+
+    TEST_ASSERT(rs = fe_resampler_init(in_rate, out_rate));
+    TEST_ASSERT(fe_resampler_max_output(rs, NSAMPS) <= maxout);
+    inptr = in;
+    nout = 0;
+    for (i = 0; i < NSAMPS; i += n) {
+        n = 37 + i % 101;
+        if (i + n > NSAMPS)
+            n = NSAMPS - i;
+        nin = n;
+        nout += fe_resampler_process(rs, &inptr, &nin,
+                                     out + nout, maxout - nout);
+        TEST_EQUAL(0, nin);
+    }
+    TEST_ASSERT(nout <= maxout);
+    TEST_ASSERT(nout > maxout - 100);
+
+    /* Skip the start, where the filter sees the silence before it. */
+    err = 0;
+    for (i = 100; i < (int)nout; ++i) {
+        ref = 10000 * sin(2 * M_PI * 440 * i / out_rate);
+        err += (out[i] - ref) * (out[i] - ref);
+    }
+    err = sqrt(err / (nout - 100));
+    printf("RMS error %f\n", err);
+    TEST_ASSERT(err < 20);
+
+    fe_resampler_free(rs);
+    ckd_free(out);
+    ckd_free(in);
+}
+
+/* Processing a resampled stream in small blocks must give the same
+ * features as all at once. */
+static void
+test_fe_blocks(void)
+{
+    static const arg_t fe_args[] = {
+        waveform_to_cepstral_command_line_macro(),
+        { NULL, 0, NULL, NULL }
+    };
+    FILE *raw;
+    cmd_ln_t *config;
+    fe_t *fe;
+    int16 *buf;
+    int16 const *inptr;
+    size_t nsamps;
+    mfcc_t **cep1, **cep2;
+    int32 nfr, nfr1, nfr2, ntail;
+    int i, j;
+
+    TEST_ASSERT(config = cmd_ln_init(NULL, fe_args, TRUE,
+                                     "-input_samprate", "8000",
+                                     "-remove_silence", "no",
+                                     NULL));
+    TEST_ASSERT(fe = fe_init_auto_r(config));
+
+    TEST_ASSERT(raw = fopen(TESTDATADIR "/chan3.raw", "rb"));
+    buf = ckd_calloc(NSAMPS, sizeof(*buf));
+    TEST_EQUAL(NSAMPS, fread(buf, sizeof(*buf), NSAMPS, raw));
+    fclose(raw);
+
+    nsamps = NSAMPS;
+    fe_process_frames(fe, NULL, &nsamps, NULL, &nfr, NULL);
+    printf("%d frames expected from %d samples\n", nfr, NSAMPS);
+    /* At 16kHz and 100 frames/sec. */
+    TEST_ASSERT(nfr >= NSAMPS * 2 / 160 - 3);
+    cep1 = ckd_calloc_2d(nfr + 1, fe_get_output_size(fe), sizeof(**cep1));
+    cep2 = ckd_calloc_2d(nfr + 1, fe_get_output_size(fe), sizeof(**cep2));
+
+    fe_start_stream(fe);
+    fe_start_utt(fe);
+    inptr = buf;
+    nfr1 = nfr;
+    TEST_EQUAL(0, fe_process_frames(fe, &inptr, &nsamps, cep1, &nfr1, NULL));
+    TEST_EQUAL(0, nsamps);
+    fe_end_utt(fe, cep1[nfr1], &ntail);
+    nfr1 += ntail;
+
+    /* Now in blocks of a few frames, as for live input. */
+    fe_start_stream(fe);
+    fe_start_utt(fe);
+    inptr = buf;
+    nsamps = NSAMPS;
+    nfr2 = 0;
+    while (nsamps > 0) {
+        size_t nblk = nsamps < 133 ? nsamps : 133;
+        size_t nleft = nblk;
+
+        while (nleft > 0) {
+            int32 n = 2;
+            TEST_EQUAL(0, fe_process_frames(fe, &inptr, &nleft,
+                                            cep2 + nfr2, &n, NULL));
+            nfr2 += n;
+            TEST_ASSERT(nfr2 <= nfr);
+        }
+        nsamps -= nblk;
+    }
+    fe_end_utt(fe, cep2[nfr2], &ntail);
+    nfr2 += ntail;
+
+    printf("%d frames all at once, %d in blocks\n", nfr1, nfr2);
+    TEST_EQUAL(nfr1, nfr2);
+    for (i = 0; i < nfr1; ++i)
+        for (j = 0; j < fe_get_output_size(fe); ++j)
+            TEST_EQUAL(cep1[i][j], cep2[i][j]);
+
+    ckd_free_2d(cep1);
+    ckd_free_2d(cep2);
+    ckd_free(buf);
+    fe_free(fe);
+}
+
+int
+main(int argc, char *argv[])
+{
+    test_sine(8000, 16000);
+    test_sine(16000, 8000);
+    test_sine(44100, 16000);
+    test_sine(48000, 16000);
+    test_fe_blocks();
+    return 0;
+}
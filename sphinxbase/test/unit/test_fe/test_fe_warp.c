@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "fe.h"
+#include "cmd_ln.h"
+#include "ckd_alloc.h"
+
+#include "test_macros.h"
+
+#define NSAMPS 16000
+#define NFR 200
+#define NWARP 3
+
+static const arg_t fe_args[] = {
+    waveform_to_cepstral_command_line_macro(),
+    { NULL, 0, NULL, NULL }
+};
+
+static char const *warps[NWARP] = { "0.9", "1.0", "1.1" };
+
+static int16 *buf;
+
+/* Process the test audio, returning the number of frames. */
+static int32
+process(fe_t *fe, mfcc_t **cep)
+{
+    int16 const *p = buf;
+    size_t ns = NSAMPS;
+    int32 nf = NFR, nlast;
+
+    fe_start_utt(fe);
+    TEST_EQUAL(0, fe_process_frames(fe, &p, &ns, cep, &nf, NULL));
+    TEST_EQUAL(0, fe_end_utt(fe, cep[nf], &nlast));
+    return nf + nlast;
+}
+
+static fe_t *
+init_fe(char const *remove, char const *warp_params)
+{
+    cmd_ln_t *config;
+    fe_t *fe;
+
+    TEST_ASSERT(config = cmd_ln_init(NULL, fe_args, TRUE,
+                                     "-remove_noise", remove,
+                                     "-remove_silence", remove,
+                                     "-warp_type", "inverse_linear",
+                                     warp_params ? "-warp_params" : NULL,
+                                     warp_params, NULL));
+    fe = fe_init_auto_r(config);
+    cmd_ln_free_r(config);
+    return fe;
+}
+
+/* Distance of a candidate's features from some reference ones. */
+typedef struct {
+    mfcc_t **ref;
+    int dim;
+} ref_t;
+
+static float64
+score_ref(void *udata, mfcc_t **cep, int32 nfr)
+{
+    ref_t *r = (ref_t *)udata;
+    float64 d = 0;
+    int32 i;
+    int j;
+
+    for (i = 0; i < nfr; ++i)
+        for (j = 0; j < r->dim; ++j)
+            d += fabs(MFCC2FLOAT(cep[i][j]) - MFCC2FLOAT(r->ref[i][j]));
+    return -d;
+}
+
+int
+main(int argc, char *argv[])
+{
+    FILE *raw;
+    fe_t *fe, *wfe, *cfe;
+    mfcc_t **cep, **refcep;
+    int32 nfr, nref;
+    int dim, i, j, k;
+    ref_t r;
+    float64 score;
+
+    TEST_ASSERT(raw = fopen(TESTDATADIR "/chan3.raw", "rb"));
+    buf = ckd_calloc(NSAMPS, sizeof(*buf));
+    TEST_EQUAL(NSAMPS, fread(buf, sizeof(*buf), NSAMPS, raw));
+    fclose(raw);
+
+    /* With voice activity detection, the usual features are the same
+     * as without candidates. */
+    TEST_ASSERT(fe = init_fe("yes", NULL));
+    dim = fe_get_output_size(fe);
+    refcep = ckd_calloc_2d(NFR + 1, dim, sizeof(**refcep));
+    nref = process(fe, refcep);
+    TEST_EQUAL(0, fe_set_warp_candidates(fe, NULL, warps, NWARP));
+    TEST_EQUAL(dim * (1 + NWARP), fe_get_output_size(fe));
+    TEST_EQUAL(0, strcmp("1.1", fe_get_warp_candidate(fe, 2)));
+    TEST_ASSERT(fe_get_warp_candidate(fe, NWARP) == NULL);
+    cep = ckd_calloc_2d(NFR + 1, fe_get_output_size(fe), sizeof(**cep));
+    fe_start_stream(fe);
+    nfr = process(fe, cep);
+    printf("%d frames with candidates, %d without\n", nfr, nref);
+    TEST_EQUAL(nref, nfr);
+    for (i = 0; i < nfr; ++i)
+        for (j = 0; j < dim; ++j)
+            TEST_EQUAL(refcep[i][j], cep[i][j]);
+    /* Clones share them, and they cannot be changed any more. */
+    TEST_ASSERT(cfe = fe_clone(fe));
+    TEST_EQUAL(fe_get_output_size(fe), fe_get_output_size(cfe));
+    TEST_ASSERT(fe_set_warp_candidates(cfe, NULL, NULL, 0) < 0);
+    TEST_ASSERT(fe_set_warp_candidates(fe, NULL, NULL, 0) < 0);
+    fe_free(cfe);
+    TEST_EQUAL(0, fe_set_warp_candidates(fe, NULL, NULL, 0));
+    TEST_EQUAL(dim, fe_get_output_size(fe));
+    TEST_EQUAL(0, fe_free(fe));
+    ckd_free_2d(cep);
+
+    /* Each candidate's features are those of a front end with its
+     * warp, and the one closest to some of them is picked. */
+    TEST_ASSERT(fe = init_fe("no", NULL));
+    TEST_EQUAL(0, fe_set_warp_candidates(fe, NULL, warps, NWARP));
+    cep = ckd_calloc_2d(NFR + 1, fe_get_output_size(fe), sizeof(**cep));
+    nfr = process(fe, cep);
+    for (k = 0; k < NWARP; ++k) {
+        TEST_ASSERT(wfe = init_fe("no", warps[k]));
+        nref = process(wfe, refcep);
+        TEST_EQUAL(nref, nfr);
+        for (i = 0; i < nfr; ++i)
+            for (j = 0; j < dim; ++j)
+                TEST_EQUAL(refcep[i][j], cep[i][(1 + k) * dim + j]);
+        fe_free(wfe);
+        r.ref = refcep;
+        r.dim = dim;
+        TEST_EQUAL(k, fe_select_warp(fe, cep, nfr, score_ref, &r, &score));
+        TEST_EQUAL(0, score);
+    }
+    /* The neutral warp is the same as none at all. */
+    for (i = 0; i < nfr; ++i)
+        for (j = 0; j < dim; ++j)
+            TEST_EQUAL(cep[i][j], cep[i][2 * dim + j]);
+    TEST_EQUAL(0, fe_free(fe));
+
+    ckd_free_2d(cep);
+    ckd_free_2d(refcep);
+    ckd_free(buf);
+    return 0;
+}
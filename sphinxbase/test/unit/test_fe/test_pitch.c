@@ -1,10 +1,43 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
 
 #include "yin.h"
 #include "ckd_alloc.h"
 
 #include "test_macros.h"
 
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Estimate pitch through yin_process_frames() in blocks of an odd
+ * size, from channel chan of nchan interleaved ones. */
+static int
+process_blocks(yin_t *pe, int16 const *buf, size_t nsamp, int chan,
+	       int nchan, uint16 *period, uint16 *bestdiff, int max_nfr)
+{
+	int16 const *raw = buf + chan;
+	int nfr = 0;
+
+	yin_start(pe);
+	while (nsamp > 0) {
+		size_t nblock = nsamp < 1001 ? nsamp : 1001;
+		size_t nleft = nblock;
+		int32 nout = max_nfr - nfr;
+
+		yin_process_frames(pe, &raw, &nleft, nchan,
+				   period + nfr, bestdiff + nfr, &nout);
+		TEST_EQUAL(0, nleft);
+		nfr += nout;
+		nsamp -= nblock;
+	}
+	yin_end(pe);
+	while (nfr < max_nfr && yin_read(pe, period + nfr, bestdiff + nfr))
+		++nfr;
+	return nfr;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -12,10 +45,11 @@ main(int argc, char *argv[])
 	static const int frame_shift = 110, frame_size = 265;
 	FILE *raw;
 	yin_t *pe;
-	int16 *buf;
-	size_t nsamp, start;
+	int16 *buf, *stereo;
+	size_t nsamp, start, i;
 	uint16 period, bestdiff;
-	int nfr;
+	uint16 *ref_period, *ref_bestdiff, *out_period, *out_bestdiff;
+	int nfr, n;
 
 	/* To make life easier, read the whole thing. */
 	TEST_ASSERT(raw = fopen(TESTDATADIR "/chan3.raw", "rb"));
@@ -26,12 +60,19 @@ main(int argc, char *argv[])
 	TEST_EQUAL(nsamp, fread(buf, 2, nsamp, raw));
 	fclose(raw);
 
+	ref_period = ckd_calloc(nsamp, sizeof(*ref_period));
+	ref_bestdiff = ckd_calloc(nsamp, sizeof(*ref_bestdiff));
+	out_period = ckd_calloc(nsamp, sizeof(*out_period));
+	out_bestdiff = ckd_calloc(nsamp, sizeof(*out_bestdiff));
+
 	TEST_ASSERT(pe = yin_init(frame_size, 0.1, 0.2, 2));
 	yin_start(pe);
 	nfr = 0;
-	for (start = 0; start + frame_size < nsamp; start += frame_shift) {
+	for (start = 0; start + frame_size <= nsamp; start += frame_shift) {
 		yin_write(pe, buf + start);
 		if (yin_read(pe, &period, &bestdiff)) {
+			ref_period[nfr] = period;
+			ref_bestdiff[nfr] = bestdiff;
 			if (bestdiff < 0.2 * 32768)
 				printf("%d ", period ? 11025/period : 0);
 			else
@@ -41,6 +82,8 @@ main(int argc, char *argv[])
 	}
 	yin_end(pe);
 	while (yin_read(pe, &period, &bestdiff)) {
+		ref_period[nfr] = period;
+		ref_bestdiff[nfr] = bestdiff;
 		if (bestdiff < 0.2 * 32768)
 			printf("%d ", period ? 11025/period : 0);
 		else
@@ -48,7 +91,40 @@ main(int argc, char *argv[])
 		++nfr;
 	}
 	printf("\n");
+
+	/* Framing the audio itself gives the same, from either channel
+	 * of a stereo stream. */
+	stereo = ckd_calloc(nsamp * 2, sizeof(*stereo));
+	for (i = 0; i < nsamp; ++i) {
+		stereo[i * 2] = buf[i];
+		stereo[i * 2 + 1] = (int16)(8000 * sin(i * 2 * M_PI * 150 / 11025));
+	}
+	yin_set_frame_shift(pe, frame_shift);
+	n = process_blocks(pe, stereo, nsamp, 0, 2,
+			   out_period, out_bestdiff, nsamp);
+	TEST_EQUAL(nfr, n);
+	for (i = 0; i < nfr; ++i) {
+		TEST_EQUAL(ref_period[i], out_period[i]);
+		TEST_EQUAL(ref_bestdiff[i], out_bestdiff[i]);
+	}
+
+	/* And finds the pitch of a sine wave in the other one. */
+	n = process_blocks(pe, stereo, nsamp, 1, 2,
+			   out_period, out_bestdiff, nsamp);
+	TEST_EQUAL(nfr, n);
+	for (i = 0; i < nfr; ++i) {
+		TEST_ASSERT(out_bestdiff[i] < 0.1 * 32768);
+		/* Within a tenth, as the first dip under the threshold is
+		 * taken, not the bottom of it. */
+		TEST_ASSERT(abs(11025 / out_period[i] - 150) < 15);
+	}
+
 	yin_free(pe);
+	ckd_free(stereo);
+	ckd_free(ref_period);
+	ckd_free(ref_bestdiff);
+	ckd_free(out_period);
+	ckd_free(out_bestdiff);
 	ckd_free(buf);
 
 	return 0;
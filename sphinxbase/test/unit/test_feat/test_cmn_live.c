@@ -0,0 +1,162 @@
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "cmn.h"
+#include "ckd_alloc.h"
+#include "test_macros.h"
+
+#define NFR 2000
+#define VECLEN 13
+
+/* Uniform noise in [-1, 1). */
+static float64
+noise(uint32 *seed)
+{
+	*seed = *seed * 1103515245 + 12345;
+	return ((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+static mfcc_t **
+make_frames(float64 mean, float64 scale)
+{
+	mfcc_t **cep;
+	uint32 seed = 42;
+	int32 i, j;
+
+	cep = (mfcc_t **)ckd_calloc_2d(NFR, VECLEN, sizeof(mfcc_t));
+	for (i = 0; i < NFR; ++i)
+		for (j = 0; j < VECLEN; ++j)
+			cep[i][j] = FLOAT2MFCC(mean + j + scale * noise(&seed));
+	return cep;
+}
+
+/* The windowed live CMN as it was done one dimension at a time. */
+static void
+ref_cmn_live(cmn_t *cmn, mfcc_t **incep, int32 nfr)
+{
+	int32 i, j;
+
+	for (i = 0; i < nfr; i++) {
+		if (incep[i][0] < 0)
+			continue;
+		for (j = 0; j < cmn->veclen; j++) {
+			cmn->sum[j] += incep[i][j];
+			incep[i][j] -= cmn->cmn_mean[j];
+		}
+		++cmn->nframe;
+	}
+	if (cmn->nframe > CMN_WIN_HWM) {
+		mfcc_t sf = FLOAT2MFCC(1.0) / cmn->nframe;
+		for (j = 0; j < cmn->veclen; j++)
+			cmn->cmn_mean[j] = cmn->sum[j] / cmn->nframe;
+		sf = CMN_WIN * sf;
+		for (j = 0; j < cmn->veclen; j++)
+			cmn->sum[j] = MFCCMUL(cmn->sum[j], sf);
+		cmn->nframe = CMN_WIN;
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	cmn_t *cmn, *ref;
+	mfcc_t **cep, **cep2;
+	mfcc_t vec[VECLEN];
+	int32 i, j;
+
+	TEST_EQUAL(CMN_EMA, cmn_type_from_str("ema"));
+
+	/* Windowed live CMN is the same as before, in blocks of 7. */
+	cep = make_frames(10.0, 3.0);
+	cep2 = make_frames(10.0, 3.0);
+	cmn = cmn_init(VECLEN);
+	ref = cmn_init(VECLEN);
+	for (i = 0; i < NFR; i += 7) {
+		int32 n = NFR - i < 7 ? NFR - i : 7;
+		cmn_live(cmn, cep + i, FALSE, n);
+		ref_cmn_live(ref, cep2 + i, n);
+	}
+	for (i = 0; i < NFR; ++i)
+		for (j = 0; j < VECLEN; ++j)
+			TEST_EQUAL(cep[i][j], cep2[i][j]);
+	for (j = 0; j < VECLEN; ++j)
+		TEST_EQUAL(cmn->sum[j], ref->sum[j]);
+	TEST_EQUAL(cmn->nframe, ref->nframe);
+	cmn_free(ref);
+	ckd_free_2d(cep2);
+	ckd_free_2d(cep);
+
+	/* It estimates the mean. */
+	cmn_live_update(cmn);
+	cmn_live_get(cmn, vec);
+	for (j = 0; j < VECLEN; ++j)
+		TEST_ASSERT(fabs(MFCC2FLOAT(vec[j]) - (10.0 + j)) < 0.2);
+
+#ifndef FIXED_POINT
+	/* And the variance: uniform noise scaled by 3 has variance 3. */
+	for (j = 0; j < VECLEN; ++j) {
+		printf("%.3f ", MFCC2FLOAT(cmn->cmn_var[j]));
+		TEST_ASSERT(fabs(cmn->cmn_var[j] - 1 / sqrt(3.0)) < 0.05);
+	}
+	printf("\n");
+
+	/* Which is normalized with varnorm. */
+	cep = make_frames(10.0, 3.0);
+	cmn_live(cmn, cep, TRUE, NFR);
+	{
+		float64 sumsq = 0;
+		for (i = 0; i < NFR; ++i)
+			sumsq += cep[i][5] * cep[i][5];
+		printf("Normalized variance %f\n", sumsq / NFR);
+		TEST_ASSERT(fabs(sumsq / NFR - 1.0) < 0.1);
+	}
+	ckd_free_2d(cep);
+
+	/* A prior can be saved and loaded for the next stream. */
+	TEST_EQUAL(0, cmn_live_write(cmn, "_cmn_prior.txt"));
+	ref = cmn_init(VECLEN);
+	TEST_EQUAL(0, cmn_live_read(ref, "_cmn_prior.txt"));
+	for (j = 0; j < VECLEN; ++j) {
+		TEST_EQUAL_FLOAT(cmn->cmn_mean[j], ref->cmn_mean[j]);
+		TEST_EQUAL_FLOAT(cmn->cmn_var[j], ref->cmn_var[j]);
+	}
+	/* Loading it does not change the estimates. */
+	cmn_live_update(ref);
+	for (j = 0; j < VECLEN; ++j) {
+		TEST_EQUAL_FLOAT(cmn->cmn_mean[j], ref->cmn_mean[j]);
+		TEST_EQUAL_FLOAT(cmn->cmn_var[j], ref->cmn_var[j]);
+	}
+	cmn_free(ref);
+	TEST_EQUAL(-1, cmn_live_read(cmn, "_no_such_prior.txt"));
+#endif
+	cmn_free(cmn);
+
+	/* The exponential window follows a change in the mean frame by
+	 * frame. */
+	cmn = cmn_init(VECLEN);
+	cmn->ema = TRUE;
+	for (j = 0; j < VECLEN; ++j)
+		vec[j] = FLOAT2MFCC(10.0 + j);
+	cmn_live_set(cmn, vec);
+	cep = make_frames(20.0, 1.0);
+	cmn_live(cmn, cep, FALSE, NFR / 4);
+	printf("After %d frames: %.3f\n", NFR / 4, MFCC2FLOAT(cmn->cmn_mean[0]));
+	TEST_ASSERT(cmn->cmn_mean[0] > FLOAT2MFCC(12.0));
+	TEST_ASSERT(cmn->cmn_mean[0] < FLOAT2MFCC(18.0));
+	cmn_live(cmn, cep + NFR / 4, FALSE, NFR - NFR / 4);
+	printf("After %d frames: %.3f\n", NFR, MFCC2FLOAT(cmn->cmn_mean[0]));
+	TEST_EQUAL(CMN_WIN, cmn->nframe);
+	TEST_ASSERT(fabs(MFCC2FLOAT(cmn->cmn_mean[0]) - 20.0) < 0.5);
+	/* The last frames have had close to the right mean removed. */
+	TEST_ASSERT(fabs(MFCC2FLOAT(cep[NFR - 1][0])) < 1.5);
+	ckd_free_2d(cep);
+	cmn_free(cmn);
+
+	return 0;
+}
@@ -71,6 +71,31 @@ main(int argc, char *argv[])
 					featbuf1));
 	TEST_EQUAL(ncep, total_frames);
 
+	/* The deltas are computed incrementally, so check them against
+	 * the direct computation over the padded window. */
+	{
+		mfcc_t **padbuf, **refbuf;
+		int32 j, win = feat_window_size(fcb);
+
+		padbuf = ckd_calloc(total_frames + win * 2, sizeof(*padbuf));
+		for (i = 0; i < total_frames + win * 2; ++i) {
+			j = i - win;
+			if (j < 0)
+				j = 0;
+			if (j >= total_frames)
+				j = total_frames - 1;
+			padbuf[i] = cepbuf[j];
+		}
+		refbuf = ckd_calloc_2d(1, feat_dimension(fcb), sizeof(**refbuf));
+		for (i = 0; i < total_frames; ++i) {
+			fcb->compute_feat(fcb, padbuf + win + i, refbuf);
+			for (j = 0; j < feat_dimension(fcb); ++j)
+				TEST_EQUAL(refbuf[0][j], featbuf1[i][0][j]);
+		}
+		ckd_free_2d(refbuf);
+		ckd_free(padbuf);
+	}
+
 	/* Process one frame at a time. */
 	cptr = cepbuf;
 	fptr = featbuf2;
@@ -0,0 +1,80 @@
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "feat.h"
+#include "bio.h"
+#include "ckd_alloc.h"
+#include "test_macros.h"
+
+#define NFR 11
+#define LDAFILE "test_feat_lda.out"
+
+/* Project features with a random matrix, with output dimensions and
+ * frame counts that are not multiples of the vector block sizes, and
+ * compare to a straightforward matrix multiplication. */
+static void
+test_lda(int32 dim)
+{
+	feat_t *fcb;
+	float32 ***lda;
+	mfcc_t ***feats;
+	float64 **ref;
+	uint32 chksum = 0;
+	FILE *fh;
+	int32 i, j, k, n;
+
+	fcb = feat_init("1s_c_d_dd", CMN_NONE, 0, AGC_NONE, 1, 13);
+	TEST_ASSERT(fcb);
+	n = feat_dimension(fcb);
+
+	lda = (float32 ***)ckd_calloc_3d(1, 36, n, sizeof(float32));
+	for (j = 0; j < 36; ++j)
+		for (k = 0; k < n; ++k)
+			lda[0][j][k] = (float32)(rand() % 2001 - 1000) / 2000;
+	TEST_ASSERT(fh = fopen(LDAFILE, "wb"));
+	TEST_EQUAL(0, bio_writehdr(fh, "version", "0.1", NULL));
+	TEST_ASSERT(bio_fwrite_3d((void ***)lda, sizeof(float32),
+				  1, 36, n, fh, &chksum) > 0);
+	fclose(fh);
+	TEST_EQUAL(0, feat_read_lda(fcb, LDAFILE, dim));
+	printf("LDA %d -> %d\n", n, feat_dimension(fcb));
+	TEST_EQUAL(dim, feat_dimension(fcb));
+
+	feats = feat_array_alloc(fcb, NFR);
+	ref = (float64 **)ckd_calloc_2d(NFR, dim, sizeof(float64));
+	for (i = 0; i < NFR; ++i) {
+		for (k = 0; k < n; ++k)
+			feats[i][0][k] = FLOAT2MFCC((float32)(rand() % 2001 - 1000) / 1000);
+		for (j = 0; j < dim; ++j)
+			for (k = 0; k < n; ++k)
+				ref[i][j] += MFCC2FLOAT(feats[i][0][k]) * lda[0][j][k];
+	}
+
+	feat_lda_transform(fcb, feats, NFR);
+	for (i = 0; i < NFR; ++i) {
+		for (j = 0; j < dim; ++j)
+			TEST_EQUAL_FLOAT(MFCC2FLOAT(feats[i][0][j]), ref[i][j]);
+		for (; j < n; ++j)
+			TEST_EQUAL(0, feats[i][0][j]);
+	}
+
+	remove(LDAFILE);
+	ckd_free_2d((void **)ref);
+	ckd_free_3d((void ***)lda);
+	feat_array_free(feats);
+	feat_free(fcb);
+}
+
+int
+main(int argc, char *argv[])
+{
+	test_lda(36);
+	test_lda(29);
+	return 0;
+}
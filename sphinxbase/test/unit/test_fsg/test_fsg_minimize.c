@@ -0,0 +1,216 @@
+#include <jsgf.h>
+#include <fsg_model.h>
+#include <string.h>
+
+#include "test_macros.h"
+
+#define NOT_ACCEPTED ((int32)0x80000000)
+
+/* Best path score for a word sequence, or NOT_ACCEPTED. */
+static int32
+best_score(fsg_model_t *fsg, char const *const *words)
+{
+	int32 *score, *next, i, n_state = fsg_model_n_state(fsg);
+	fsg_arciter_t *itor;
+
+	score = ckd_calloc(n_state, sizeof(*score));
+	next = ckd_calloc(n_state, sizeof(*next));
+	for (i = 0; i < n_state; ++i)
+		score[i] = NOT_ACCEPTED;
+	score[fsg_model_start_state(fsg)] = 0;
+	for (;;) {
+		int32 wid;
+		/* Follow null transitions (one step is enough after closure) */
+		for (i = 0; i < n_state; ++i)
+			next[i] = score[i];
+		for (i = 0; i < n_state; ++i) {
+			if (score[i] == NOT_ACCEPTED)
+				continue;
+			for (itor = fsg_model_arcs(fsg, i); itor;
+			     itor = fsg_arciter_next(itor)) {
+				fsg_link_t *l = fsg_arciter_get(itor);
+				if (fsg_link_wid(l) == -1
+				    && score[i] + fsg_link_logs2prob(l) > next[fsg_link_to_state(l)])
+					next[fsg_link_to_state(l)] = score[i] + fsg_link_logs2prob(l);
+			}
+		}
+		memcpy(score, next, n_state * sizeof(*score));
+		if (*words == NULL)
+			break;
+		wid = fsg_model_word_id(fsg, *words++);
+		for (i = 0; i < n_state; ++i)
+			next[i] = NOT_ACCEPTED;
+		for (i = 0; i < n_state; ++i) {
+			if (score[i] == NOT_ACCEPTED)
+				continue;
+			for (itor = fsg_model_arcs(fsg, i); itor;
+			     itor = fsg_arciter_next(itor)) {
+				fsg_link_t *l = fsg_arciter_get(itor);
+				if (fsg_link_wid(l) == wid && wid != -1
+				    && score[i] + fsg_link_logs2prob(l) > next[fsg_link_to_state(l)])
+					next[fsg_link_to_state(l)] = score[i] + fsg_link_logs2prob(l);
+			}
+		}
+		memcpy(score, next, n_state * sizeof(*score));
+	}
+	i = score[fsg_model_final_state(fsg)];
+	ckd_free(score);
+	ckd_free(next);
+	return i;
+}
+
+static int
+n_null(fsg_model_t *fsg)
+{
+	int32 i, n = 0;
+	fsg_arciter_t *itor;
+
+	for (i = 0; i < fsg_model_n_state(fsg); ++i) {
+		for (itor = fsg_model_arcs(fsg, i); itor;
+		     itor = fsg_arciter_next(itor)) {
+			fsg_link_t *l = fsg_arciter_get(itor);
+			if (fsg_link_wid(l) == -1) {
+				TEST_EQUAL(fsg_model_final_state(fsg), fsg_link_to_state(l));
+				++n;
+			}
+		}
+	}
+	return n;
+}
+
+/* No state has two transitions with the same word. */
+static int
+is_deterministic(fsg_model_t *fsg)
+{
+	int32 i, *seen, rv = TRUE;
+	fsg_arciter_t *itor;
+
+	seen = ckd_calloc(fsg_model_n_word(fsg), sizeof(*seen));
+	for (i = 0; i < fsg_model_n_state(fsg); ++i) {
+		for (itor = fsg_model_arcs(fsg, i); itor;
+		     itor = fsg_arciter_next(itor)) {
+			fsg_link_t *l = fsg_arciter_get(itor);
+			if (fsg_link_wid(l) == -1)
+				continue;
+			if (seen[fsg_link_wid(l)] == i + 1)
+				rv = FALSE;
+			seen[fsg_link_wid(l)] = i + 1;
+		}
+	}
+	ckd_free(seen);
+	return rv;
+}
+
+int
+main(int argc, char *argv[])
+{
+	static char const *const sents[][6] = {
+		{ "go", "forward", "one", "meters", NULL },
+		{ "move", "backward", "two", "three", NULL },
+		{ "go", "one", NULL },
+		{ "go", NULL },
+		{ "forward", "one", NULL },
+		{ "go", "forward", "meters", NULL },
+	};
+	logmath_t *lmath;
+	fsg_model_t *fsg, *min;
+	jsgf_t *jsgf;
+	size_t i;
+
+	lmath = logmath_init(1.0001, 0, 0);
+	jsgf = jsgf_parse_string("#JSGF V1.0; grammar cmd;"
+				 "<num> = one | two | three;"
+				 "public <cmd> = (go | move) [/0.3/ forward | /0.7/ backward]"
+				 " <num>+ [meters];", NULL);
+	TEST_ASSERT(jsgf);
+	fsg = jsgf_build_fsg(jsgf, jsgf_get_rule(jsgf, "cmd.cmd"), lmath, 7.5);
+	TEST_ASSERT(fsg);
+	TEST_ASSERT(min = fsg_model_minimize(fsg));
+	printf("%d states => %d states\n",
+	       fsg_model_n_state(fsg), fsg_model_n_state(min));
+	fsg_model_write(min, stdout);
+
+	/* Smaller, with no null transitions except into the final state */
+	TEST_ASSERT(fsg_model_n_state(min) < fsg_model_n_state(fsg));
+	n_null(min);
+	TEST_EQUAL(fsg_model_n_word(fsg), fsg_model_n_word(min));
+	TEST_EQUAL(fsg_model_word_id(fsg, "meters"),
+		   fsg_model_word_id(min, "meters"));
+
+	/* But the same language, with the same scores */
+	for (i = 0; i < sizeof(sents) / sizeof(sents[0]); ++i) {
+		printf("%s... %d %d\n", sents[i][0],
+		       best_score(fsg, sents[i]), best_score(min, sents[i]));
+		TEST_EQUAL(best_score(fsg, sents[i]), best_score(min, sents[i]));
+	}
+	TEST_ASSERT(best_score(min, sents[0]) != NOT_ACCEPTED);
+	TEST_ASSERT(best_score(min, sents[1]) != NOT_ACCEPTED);
+	TEST_EQUAL(NOT_ACCEPTED, best_score(min, sents[3]));
+	TEST_EQUAL(NOT_ACCEPTED, best_score(min, sents[4]));
+
+	/* Minimizing again changes nothing */
+	fsg_model_free(fsg);
+	TEST_ASSERT(fsg = fsg_model_minimize(min));
+	TEST_EQUAL(fsg_model_n_state(min), fsg_model_n_state(fsg));
+	fsg_model_free(fsg);
+	fsg_model_free(min);
+	jsgf_grammar_free(jsgf);
+
+	/* Alternatives with common prefixes are shared once optimized */
+	jsgf = jsgf_parse_string("#JSGF V1.0; grammar alt;"
+				 "public <alt> = /0.5/ go forward one meters"
+				 " | /0.2/ go forward two"
+				 " | /0.3/ go backward one meters"
+				 " | move forward one meters;", NULL);
+	TEST_ASSERT(jsgf);
+	fsg = jsgf_build_fsg(jsgf, jsgf_get_rule(jsgf, "alt.alt"), lmath, 7.5);
+	TEST_ASSERT(min = fsg_model_minimize(fsg));
+	TEST_ASSERT(!is_deterministic(min));
+	fsg_model_free(min);
+	TEST_ASSERT(min = fsg_model_optimize(fsg));
+	printf("%d states => %d states\n",
+	       fsg_model_n_state(fsg), fsg_model_n_state(min));
+	fsg_model_write(min, stdout);
+	TEST_ASSERT(is_deterministic(min));
+	n_null(min);
+	for (i = 0; i < sizeof(sents) / sizeof(sents[0]); ++i)
+		TEST_EQUAL(best_score(fsg, sents[i]), best_score(min, sents[i]));
+	{
+		static char const *const alts[][6] = {
+			{ "go", "forward", "one", "meters", NULL },
+			{ "go", "forward", "two", NULL },
+			{ "go", "backward", "one", "meters", NULL },
+			{ "move", "forward", "one", "meters", NULL },
+			{ "go", "forward", "two", "meters", NULL },
+		};
+		for (i = 0; i < sizeof(alts) / sizeof(alts[0]); ++i) {
+			printf("%s %s %s... %d %d\n", alts[i][0], alts[i][1],
+			       alts[i][2], best_score(fsg, alts[i]),
+			       best_score(min, alts[i]));
+			TEST_EQUAL(best_score(fsg, alts[i]),
+				   best_score(min, alts[i]));
+		}
+		TEST_ASSERT(best_score(min, alts[1]) != NOT_ACCEPTED);
+		TEST_EQUAL(NOT_ACCEPTED, best_score(min, alts[4]));
+	}
+	fsg_model_free(fsg);
+	fsg_model_free(min);
+	jsgf_grammar_free(jsgf);
+
+	/* A grammar that only accepts the empty sentence */
+	jsgf = jsgf_parse_string("#JSGF V1.0; grammar e;"
+				 "public <e> = <NULL>;", NULL);
+	TEST_ASSERT(jsgf);
+	fsg = jsgf_build_fsg(jsgf, jsgf_get_rule(jsgf, "e.e"), lmath, 1.0);
+	TEST_ASSERT(min = fsg_model_minimize(fsg));
+	TEST_EQUAL(0, best_score(min, sents[3] + 1));
+	fsg_model_free(min);
+	TEST_ASSERT(min = fsg_model_optimize(fsg));
+	TEST_EQUAL(0, best_score(min, sents[3] + 1));
+	fsg_model_free(fsg);
+	fsg_model_free(min);
+	jsgf_grammar_free(jsgf);
+
+	logmath_free(lmath);
+	return 0;
+}
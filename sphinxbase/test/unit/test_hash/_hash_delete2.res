@@ -1,7 +1,9 @@
-Hash with chaining representation of the hash table
-|key:-bla|len:4|val=8|->NULL
-|key:-hmmdump|len:8|val=1|->|key:-outlatdir|len:10|val=3|->NULL
-|key:-svq4svq|len:8|val=2|->|key:-lminmemory|len:11|val=6|->NULL
-|key:-lm|len:3|val=4|->NULL
-|key:-beam|len:5|val=5|->NULL
+Open addressing representation of the hash table
+|slot:20|key:-beam|len:5|val=5|
+|slot:46|key:-hmmdump|len:8|val=1|
+|slot:81|key:-lm|len:3|val=4|
+|slot:82|key:-bla|len:4|val=8|
+|slot:103|key:-lminmemory|len:11|val=6|
+|slot:120|key:-svq4svq|len:8|val=2|
+|slot:122|key:-outlatdir|len:10|val=3|
 The total number of keys =7
@@ -1,6 +1,7 @@
-Hash with chaining representation of the hash table
-|key:-hmmdump|len:8|val=1|->NULL
-|key:-svq4svq|len:8|val=1|->|key:-lminmemory|len:11|val=1|->NULL
-|key:-lm|len:3|val=1|->NULL
-|key:-beam|len:5|val=1|->NULL
+Open addressing representation of the hash table
+|slot:20|key:-beam|len:5|val=1|
+|slot:46|key:-hmmdump|len:8|val=1|
+|slot:81|key:-lm|len:3|val=1|
+|slot:103|key:-lminmemory|len:11|val=1|
+|slot:120|key:-svq4svq|len:8|val=1|
 The total number of keys =5
@@ -0,0 +1,103 @@
+/**
+ * @file test_hash_freeze.c Test perfect hash indices on hash tables
+ */
+
+#include "hash_table.h"
+#include "ckd_alloc.h"
+#include "test_macros.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N_KEYS 100000
+
+static char **
+make_keys(int n, char const *fmt)
+{
+	char **keys;
+	int i;
+
+	keys = ckd_calloc(n, sizeof(*keys));
+	for (i = 0; i < n; ++i) {
+		keys[i] = ckd_calloc(32, 1);
+		sprintf(keys[i], fmt, i);
+	}
+	return keys;
+}
+
+int
+main(int argc, char *argv[])
+{
+	hash_table_t *h;
+	char **keys, **more;
+	char const *added = "added";
+	int32 i, val;
+
+	keys = make_keys(N_KEYS, "word%d");
+	more = make_keys(N_KEYS, "other%d");
+
+	/* Every key is found through the index, and no others. */
+	TEST_ASSERT(h = hash_table_new(N_KEYS, HASH_CASE_YES));
+	TEST_EQUAL(-1, hash_table_freeze(h));
+	for (i = 0; i < N_KEYS; ++i)
+		TEST_EQUAL(i, hash_table_enter_int32(h, keys[i], i));
+	TEST_EQUAL(0, hash_table_freeze(h));
+	TEST_ASSERT(h->index != NULL);
+	for (i = 0; i < N_KEYS; ++i) {
+		TEST_EQUAL(0, hash_table_lookup_int32(h, keys[i], &val));
+		TEST_EQUAL(i, val);
+		TEST_EQUAL(-1, hash_table_lookup_int32(h, more[i], &val));
+	}
+	TEST_EQUAL(-1, hash_table_lookup_int32(h, "WORD42", &val));
+	TEST_EQUAL(-1, hash_table_lookup_int32(h, "word", &val));
+	TEST_EQUAL(-1, hash_table_lookup_int32(h, "", &val));
+
+	/* Keys entered later are found in the table. */
+	TEST_EQUAL(-42, hash_table_enter_int32(h, added, -42));
+	TEST_EQUAL(0, hash_table_lookup_int32(h, "added", &val));
+	TEST_EQUAL(-42, val);
+	TEST_EQUAL(0, hash_table_lookup_int32(h, keys[42], &val));
+	TEST_EQUAL(42, val);
+
+	/* Replaced values are seen through the index. */
+	hash_table_replace_int32(h, keys[42], 4242);
+	TEST_EQUAL(0, hash_table_lookup_int32(h, keys[42], &val));
+	TEST_EQUAL(4242, val);
+
+	/* Deleting discards the index. */
+	hash_table_delete(h, keys[0]);
+	TEST_ASSERT(h->index == NULL);
+	TEST_EQUAL(-1, hash_table_lookup_int32(h, keys[0], &val));
+	TEST_EQUAL(0, hash_table_lookup_int32(h, keys[1], &val));
+	TEST_EQUAL(1, val);
+	TEST_EQUAL(0, hash_table_freeze(h));
+	TEST_EQUAL(-1, hash_table_lookup_int32(h, keys[0], &val));
+	TEST_EQUAL(0, hash_table_lookup_int32(h, "added", &val));
+	TEST_EQUAL(-42, val);
+	hash_table_empty(h);
+	TEST_ASSERT(h->index == NULL);
+	TEST_EQUAL(-1, hash_table_lookup_int32(h, keys[1], &val));
+	hash_table_free(h);
+
+	/* Case-insensitive tables stay case-insensitive. */
+	TEST_ASSERT(h = hash_table_new(N_KEYS, HASH_CASE_NO));
+	for (i = 0; i < N_KEYS; ++i)
+		hash_table_enter_int32(h, keys[i], i);
+	TEST_EQUAL(0, hash_table_freeze(h));
+	TEST_EQUAL(0, hash_table_lookup_int32(h, "WORD42", &val));
+	TEST_EQUAL(42, val);
+	TEST_EQUAL(0, hash_table_lookup_int32(h, "Word99999", &val));
+	TEST_EQUAL(99999, val);
+	TEST_EQUAL(-1, hash_table_lookup_int32(h, "OTHER42", &val));
+	hash_table_free(h);
+
+	for (i = 0; i < N_KEYS; ++i) {
+		ckd_free(keys[i]);
+		ckd_free(more[i]);
+	}
+	ckd_free(keys);
+	ckd_free(more);
+
+	return 0;
+}
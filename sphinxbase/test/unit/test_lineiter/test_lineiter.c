@@ -9,6 +9,7 @@ main(int argc, char *argv[])
 	FILE *fp;
 	fp = fopen(FILEDIR "/test.txt", "rb");
 	lineiter_t *li;
+	char line[256];
 	int i;
 	
 	for (i = 0, li = lineiter_start(fp); i < 3 && li; li = lineiter_next(li), i++) {
@@ -20,6 +21,10 @@ main(int argc, char *argv[])
 	TEST_EQUAL(lineiter_lineno(li), 4);
 
 	lineiter_free(li);
+
+	/* The file is left just after the last line returned. */
+	TEST_ASSERT(fgets(line, sizeof(line), fp));
+	TEST_EQUAL_STRING(line, "# This is a comment again\n");
 	
         fseek(fp, 0L, SEEK_SET);
 	
@@ -38,6 +38,21 @@ main(int argc, char *argv[])
 		       logmath_log(lmath, 6e-48));
 	TEST_EQUAL_LOG(logmath_add(lmath, logmath_log(lmath, 1e-48),
 				   logmath_log(lmath, 42)), 1247);
+
+	/* Adding whole arrays matches adding each pair. */
+	{
+		int x[500], y[500], sum[500], i;
+
+		for (i = 0; i < 500; ++i) {
+			sum[i] = x[i] = logmath_log(lmath, (i % 37 + 1) * 1e-3);
+			y[i] = (i % 10 == 0) ? logmath_get_zero(lmath)
+				: x[i] - (i * 97) % 20000;
+		}
+		sum[1] = x[1] = logmath_get_zero(lmath);
+		logmath_add_array(lmath, sum, y, 500);
+		for (i = 0; i < 500; ++i)
+			TEST_EQUAL(sum[i], logmath_add(lmath, x[i], y[i]));
+	}
 	logmath_free(lmath);
 
 	return 0;
@@ -39,6 +39,20 @@ main(int argc, char *argv[])
 	TEST_EQUAL_LOG(logmath_add(lmath, logmath_log(lmath, 1e-48),
 				   logmath_log(lmath, 42)),
 		       logmath_log(lmath, 42));
+	{
+		int logb[4];
+
+		logb[0] = logmath_log(lmath, 1e-48);
+		logb[1] = logmath_log(lmath, 5e-48);
+		logb[2] = logmath_get_zero(lmath);
+		logb[3] = logmath_log(lmath, 3e-48);
+		TEST_EQUAL_LOG(logmath_add_n(lmath, logb, 4),
+			       logmath_log(lmath, 9e-48));
+		logb[3] = logmath_log(lmath, 42);
+		TEST_EQUAL(logmath_add_n(lmath, logb, 4), logb[3]);
+		TEST_EQUAL(logmath_add_n(lmath, logb, 0),
+			   logmath_get_zero(lmath));
+	}
 
 	rv = logmath_write(lmath, "tmp.logadd");
 	TEST_EQUAL(rv, 0);
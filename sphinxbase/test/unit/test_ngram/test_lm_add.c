@@ -22,6 +22,33 @@ run_tests(logmath_t *lmath, ngram_model_t *model)
 	TEST_EQUAL_LOG(score, logmath_log(lmath, 0.5/402)); /* #unigrams */
 }
 
+/* Added words back off like any word with no N-Grams. */
+void
+run_hist_tests(ngram_model_t *model)
+{
+	ngram_state_t state, next;
+	int32 hist[2], n_used, score;
+
+	hist[0] = ngram_wid(model, "david");
+	hist[1] = ngram_wid(model, "foobie");
+	score = ngram_score(model, "quux", "david", NULL);
+	ngram_state_init(model, &state, hist, 1);
+	TEST_EQUAL(score, ngram_state_score(model, &state,
+					    ngram_wid(model, "quux"),
+					    &next, &n_used));
+	TEST_EQUAL(n_used, 1);
+	/* Nothing follows an added word in the history. */
+	TEST_EQUAL(ngram_score(model, "huggins", "foobie", NULL),
+		   ngram_score(model, "huggins", NULL));
+	TEST_EQUAL(ngram_ng_score(model, ngram_wid(model, "huggins"),
+				  hist + 1, 1, &n_used),
+		   ngram_score(model, "huggins", NULL));
+	TEST_EQUAL(ngram_state_score(model, &next,
+				     ngram_wid(model, "huggins"),
+				     NULL, &n_used),
+		   ngram_score(model, "huggins", NULL));
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -36,6 +63,14 @@ main(int argc, char *argv[])
 
 	model = ngram_model_read(NULL, LMDIR "/100.lm.gz", NGRAM_ARPA, lmath);
 	run_tests(lmath, model);
+	run_hist_tests(model);
+	/* Written models include them. */
+	TEST_EQUAL(0, ngram_model_write(model, "100.add.tmp.lm", NGRAM_ARPA));
+	ngram_model_free(model);
+	model = ngram_model_read(NULL, "100.add.tmp.lm", NGRAM_ARPA, lmath);
+	TEST_EQUAL_LOG(ngram_score(model, "quux", NULL),
+		       logmath_log(lmath, 0.5/402));
+	run_hist_tests(model);
 	ngram_model_free(model);
 
 	logmath_free(lmath);
@@ -0,0 +1,92 @@
+#include <ngram_model.h>
+#include <logmath.h>
+#include <strfuncs.h>
+
+#include "test_macros.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/* Scores from states must include the same boost as from histories. */
+static int32
+state_score(ngram_model_t *model, char const *w, char const *h)
+{
+	ngram_state_t state;
+	int32 hist, n_used;
+
+	hist = ngram_wid(model, h);
+	ngram_state_init(model, &state, &hist, 1);
+	return ngram_state_score(model, &state, ngram_wid(model, w),
+				 NULL, &n_used);
+}
+
+static void
+run_tests(logmath_t *lmath, ngram_model_t *model)
+{
+	ngram_boost_t *boost;
+	char const *unigram[] = { "huggins" };
+	char const *bigram[] = { "david", "huggins" };
+	char const *unknown[] = { "david", "foobie" };
+	int32 dh, nh, d, dprob, d10, d100;
+
+	dh = ngram_score(model, "huggins", "david", NULL);
+	nh = ngram_score(model, "huggins", "daines", NULL);
+	d = ngram_score(model, "david", NULL);
+	dprob = ngram_probv(model, "huggins", "david", NULL);
+	d10 = logmath_log(lmath, 10.0);
+	d100 = logmath_log(lmath, 100.0);
+
+	TEST_ASSERT(boost = ngram_boost_init(model));
+	TEST_EQUAL(0, ngram_boost_add(boost, unigram, 1, 10.0));
+	TEST_EQUAL(-1, ngram_boost_add(boost, unknown, 2, 10.0));
+	TEST_EQUAL(0, ngram_model_boost(model, boost));
+	TEST_EQUAL(dh + d10, ngram_score(model, "huggins", "david", NULL));
+	TEST_EQUAL(nh + d10, ngram_score(model, "huggins", "daines", NULL));
+	TEST_EQUAL(d, ngram_score(model, "david", NULL));
+	TEST_EQUAL(dprob + d10, ngram_probv(model, "huggins", "david", NULL));
+	TEST_EQUAL(dh + d10, state_score(model, "huggins", "david"));
+
+	/* The longest match wins. */
+	TEST_EQUAL(0, ngram_boost_add(boost, bigram, 2, 100.0));
+	ngram_model_flush(model);
+	TEST_EQUAL(dh + d100, ngram_score(model, "huggins", "david", NULL));
+	TEST_EQUAL(nh + d10, ngram_score(model, "huggins", "daines", NULL));
+	TEST_EQUAL(dh + d100, state_score(model, "huggins", "david"));
+
+	/* Detaching restores the original scores. */
+	TEST_EQUAL(0, ngram_model_boost(model, NULL));
+	TEST_EQUAL(dh, ngram_score(model, "huggins", "david", NULL));
+	TEST_EQUAL(nh, ngram_score(model, "huggins", "daines", NULL));
+	TEST_EQUAL(dprob, ngram_probv(model, "huggins", "david", NULL));
+
+	/* Boosts are scaled by the language weight like everything else. */
+	ngram_model_apply_weights(model, 2.0, 1.0);
+	dh = ngram_score(model, "huggins", "david", NULL);
+	TEST_EQUAL(0, ngram_model_boost(model, boost));
+	TEST_EQUAL(dh + (int32)(d100 * 2.0),
+		   ngram_score(model, "huggins", "david", NULL));
+	TEST_EQUAL(0, ngram_model_boost(model, NULL));
+	ngram_model_apply_weights(model, 1.0, 1.0);
+	TEST_EQUAL(0, ngram_boost_free(boost));
+}
+
+int
+main(int argc, char *argv[])
+{
+	logmath_t *lmath;
+	ngram_model_t *model;
+
+	lmath = logmath_init(1.0001, 0, 0);
+
+	model = ngram_model_read(NULL, LMDIR "/100.lm.bin", NGRAM_BIN, lmath);
+	run_tests(lmath, model);
+	ngram_model_free(model);
+
+	model = ngram_model_read(NULL, LMDIR "/100.lm.gz", NGRAM_ARPA, lmath);
+	run_tests(lmath, model);
+	ngram_model_free(model);
+
+	logmath_free(lmath);
+	return 0;
+}
@@ -0,0 +1,109 @@
+#include <ngram_model.h>
+#include <logmath.h>
+#include <strfuncs.h>
+
+#include "test_macros.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/* A clone scores every word exactly like the original. */
+static void
+compare_scores(ngram_model_t *model, ngram_model_t *clone,
+	       char const *w2, char const *w1)
+{
+	int32 i, n_words, n_used, n_used2;
+	int32 h2 = ngram_wid(model, w2), h1 = ngram_wid(model, w1);
+
+	n_words = ngram_model_get_counts(model)[0];
+	for (i = 0; i < n_words; ++i) {
+		TEST_EQUAL(ngram_tg_score(model, i, h2, h1, &n_used),
+			   ngram_tg_score(clone, i, h2, h1, &n_used2));
+		TEST_EQUAL(n_used, n_used2);
+	}
+}
+
+static void
+run_tests(ngram_model_t *model)
+{
+	ngram_model_t *clone, *clone2;
+	size_t heap, shared, mapped, heap2, shared2, mapped2;
+
+	heap = ngram_model_mem_size(model, &shared, &mapped);
+	TEST_EQUAL(0, shared);
+	TEST_ASSERT(clone = ngram_model_clone(model));
+	/* Now most of it is shared, and the clone is a small addition. */
+	heap2 = ngram_model_mem_size(model, &shared2, &mapped2);
+	printf("heap %lu mapped %lu, with clone %lu + shared %lu\n",
+	       (unsigned long)heap, (unsigned long)mapped,
+	       (unsigned long)heap2, (unsigned long)shared2);
+	TEST_EQUAL(heap, heap2 + shared2);
+	TEST_EQUAL(mapped, mapped2);
+	TEST_ASSERT(heap2 < shared2);
+	TEST_EQUAL(heap2, ngram_model_mem_size(clone, &shared, NULL));
+	TEST_EQUAL(shared2, shared);
+	TEST_EQUAL(ngram_model_get_size(model), ngram_model_get_size(clone));
+	TEST_EQUAL(ngram_wid(model, "daines"), ngram_wid(clone, "daines"));
+	compare_scores(model, clone, "huggins", "david");
+	compare_scores(model, clone, "david", "david");
+
+	/* Interleaving queries does not disturb either one's caches. */
+	TEST_EQUAL_LOG(ngram_score(model, "daines", "huggins", "david", NULL),
+		       -9452);
+	TEST_EQUAL(ngram_score(clone, "huggins", "david", NULL),
+		   ngram_score(model, "huggins", "david", NULL));
+	TEST_EQUAL_LOG(ngram_score(clone, "daines", "huggins", "david", NULL),
+		       -9452);
+
+	/* Neither vocabulary can change while they share it. */
+	TEST_EQUAL(NGRAM_INVALID_WID,
+		   ngram_model_add_word(clone, "foobie", 1.0));
+	TEST_EQUAL(NGRAM_INVALID_WID,
+		   ngram_model_add_word(model, "foobie", 1.0));
+	TEST_EQUAL(-1, ngram_model_casefold(model, NGRAM_UPPER));
+
+	/* Clones of clones share the original, which stays alive. */
+	TEST_ASSERT(clone2 = ngram_model_clone(clone));
+	TEST_EQUAL(0, ngram_model_free(clone));
+	compare_scores(model, clone2, "huggins", "david");
+	TEST_EQUAL(0, ngram_model_free(clone2));
+
+	/* Once they are gone it can be changed again. */
+	TEST_ASSERT(ngram_model_add_word(model, "foobie", 1.0)
+		    != NGRAM_INVALID_WID);
+}
+
+int
+main(int argc, char *argv[])
+{
+	logmath_t *lmath;
+	ngram_model_t *model, *lmset, *clone;
+	const char *name = "100";
+
+	lmath = logmath_init(1.0001, 0, 0);
+
+	model = ngram_model_read(NULL, LMDIR "/100.lm.bin", NGRAM_BIN, lmath);
+	run_tests(model);
+	ngram_model_free(model);
+
+	/* Sets clone each of their models. */
+	model = ngram_model_read(NULL, LMDIR "/100.lm.gz", NGRAM_ARPA, lmath);
+	lmset = ngram_model_set_init(NULL, &model, (char **)&name, NULL, 1);
+	TEST_ASSERT(lmset);
+	TEST_EQUAL(ngram_model_set_select(lmset, "100"), model);
+	TEST_ASSERT(clone = ngram_model_clone(lmset));
+	TEST_ASSERT(ngram_model_set_lookup(clone, "100") != model);
+	compare_scores(lmset, clone, "huggins", "david");
+	TEST_ASSERT(ngram_model_set_remove(lmset, "100", FALSE) == NULL);
+
+	/* The original may be freed first. */
+	ngram_model_free(lmset);
+	ngram_model_free(model);
+	TEST_EQUAL_LOG(ngram_score(clone, "daines", "huggins", "david", NULL),
+		       -9452);
+	ngram_model_free(clone);
+
+	logmath_free(lmath);
+	return 0;
+}
@@ -1,6 +1,7 @@
 #include <ngram_model.h>
 #include <logmath.h>
 #include <strfuncs.h>
+#include <cmd_ln.h>
 
 #include "test_macros.h"
 
@@ -42,11 +43,17 @@ test_lm_ug_vals(ngram_model_t *model)
 	return 0;
 }
 
+static const arg_t thread_args[] = {
+	{ "-nthreads", ARG_INT32, "1", "Threads for reading ARPA files" },
+	{ NULL, 0, NULL, NULL }
+};
+
 int
 main(int argc, char *argv[])
 {
 	logmath_t *lmath;
 	ngram_model_t *model;
+	cmd_ln_t *config;
 
 	/* Initialize a logmath object to pass to ngram_read */
 	lmath = logmath_init(1.0001, 0, 0);
@@ -82,6 +89,16 @@ main(int argc, char *argv[])
 	test_lm_vals(model);
 	TEST_EQUAL(0, ngram_model_free(model));
 
+	/* Read it with several threads */
+	config = cmd_ln_init(NULL, thread_args, TRUE, "-nthreads", "3", NULL);
+	model = ngram_model_read(config, LMDIR "/100.lm.bz2", NGRAM_ARPA, lmath);
+	test_lm_vals(model);
+	TEST_EQUAL(0, ngram_model_free(model));
+	/* Wrong format lines are dropped the same way */
+	model = ngram_model_read(config, LMDIR "/107.lm.gz", NGRAM_ARPA, lmath);
+	TEST_EQUAL(0, ngram_model_free(model));
+	cmd_ln_free_r(config);
+
 	/* Read a language model */
 	model = ngram_model_read(NULL, LMDIR "/100.lm.bin", NGRAM_BIN, lmath);
 	test_lm_vals(model);
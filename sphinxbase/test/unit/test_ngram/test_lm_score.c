@@ -1,6 +1,7 @@
 #include <ngram_model.h>
 #include <logmath.h>
 #include <strfuncs.h>
+#include <cmd_ln.h>
 
 #include "test_macros.h"
 
@@ -67,13 +68,54 @@ run_tests(ngram_model_t *model)
 	TEST_EQUAL(n_used, 3);
 }
 
+static const arg_t bloom_args[] = {
+	{ "-lmbloom", ARG_BOOLEAN, "no", "Bloom filters for n-gram lookups" },
+	{ NULL, 0, NULL, NULL }
+};
+
+/* Filters may only reject n-grams which are not there. */
+static void
+compare_bloom(ngram_model_t *model, ngram_model_t *bloom)
+{
+	int32 i, j, k, n, n_used, n_used2;
+
+	n = ngram_model_get_counts(model)[0];
+	if (n > 60)
+		n = 60;
+	for (i = 0; i < n; ++i)
+		for (j = 0; j < n; ++j) {
+			TEST_EQUAL(ngram_bg_score(model, i, j, &n_used),
+				   ngram_bg_score(bloom, i, j, &n_used2));
+			TEST_EQUAL(n_used, n_used2);
+			for (k = 0; k < n; ++k) {
+				TEST_EQUAL(ngram_tg_score(model, i, j, k, &n_used),
+					   ngram_tg_score(bloom, i, j, k, &n_used2));
+				TEST_EQUAL(n_used, n_used2);
+			}
+		}
+}
+
 int
 main(int argc, char *argv[])
 {
 	logmath_t *lmath;
-	ngram_model_t *model;
+	ngram_model_t *model, *bloom;
+	cmd_ln_t *config;
 
 	lmath = logmath_init(1.0001, 0, 0);
+	config = cmd_ln_init(NULL, bloom_args, TRUE, "-lmbloom", "yes", NULL);
+
+	model = ngram_model_read(NULL, LMDIR "/100.lm.bin", NGRAM_BIN, lmath);
+	bloom = ngram_model_read(config, LMDIR "/100.lm.bin", NGRAM_BIN, lmath);
+	compare_bloom(model, bloom);
+	run_tests(bloom);
+	ngram_model_free(bloom);
+	ngram_model_free(model);
+
+	bloom = ngram_model_read(config, LMDIR "/100.lm.gz", NGRAM_ARPA, lmath);
+	run_tests(bloom);
+	ngram_model_free(bloom);
+	cmd_ln_free_r(config);
 
 	model = ngram_model_read(NULL, LMDIR "/100.lm.bin", NGRAM_BIN, lmath);
 	run_tests(model);
@@ -64,6 +64,20 @@ main(int argc, char *argv[])
 		       logmath_log(lmath,
 				   0.6 * pow(10, -2.7884)
 				   + 0.4 * pow(10, -2.8192)));
+	/* Cached scores are the same, and follow language weights. */
+	{
+		int32 bg, tg;
+
+		bg = ngram_score(lmset, "huggins", "david", NULL);
+		tg = ngram_score(lmset, "daines", "huggins", "david", NULL);
+		TEST_EQUAL(bg, ngram_score(lmset, "huggins", "david", NULL));
+		TEST_EQUAL(tg, ngram_score(lmset, "daines", "huggins", "david", NULL));
+		ngram_model_apply_weights(lmset, 2.0, 1.0);
+		TEST_ASSERT(tg != ngram_score(lmset, "daines", "huggins", "david", NULL));
+		ngram_model_apply_weights(lmset, 1.0, 1.0);
+		TEST_EQUAL(bg, ngram_score(lmset, "huggins", "david", NULL));
+		TEST_EQUAL(tg, ngram_score(lmset, "daines", "huggins", "david", NULL));
+	}
 
 	/* Test switching back to selected mode. */
 	TEST_EQUAL(ngram_model_set_select(lmset, "102"), lms[1]);
@@ -0,0 +1,98 @@
+#include <ngram_model.h>
+#include <logmath.h>
+#include <strfuncs.h>
+
+#include "test_macros.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/* Scores from states must be exactly those from word histories. */
+static void
+compare_scores(ngram_model_t *model, int32 w2, int32 w1)
+{
+	ngram_state_t state;
+	int32 hist[2];
+	int32 i, n_words, n_used, n_used2;
+
+	hist[0] = w2;
+	hist[1] = w1;
+	ngram_state_init(model, &state, hist, 2);
+	n_words = ngram_model_get_counts(model)[0];
+	for (i = 0; i < n_words; ++i) {
+		TEST_EQUAL(ngram_tg_score(model, i, w2, w1, &n_used),
+			   ngram_state_score(model, &state, i, NULL, &n_used2));
+		TEST_EQUAL(n_used, n_used2);
+	}
+}
+
+static void
+run_tests(ngram_model_t *model)
+{
+	ngram_state_t state, state2, state3;
+	int32 hist[2];
+	int32 n_used;
+
+	compare_scores(model, ngram_wid(model, "huggins"),
+		       ngram_wid(model, "david"));
+	compare_scores(model, ngram_wid(model, "david"),
+		       ngram_wid(model, "david"));
+	compare_scores(model, ngram_wid(model, "sphinxtrain"),
+		       NGRAM_INVALID_WID);
+
+	/* Walk through "david huggins daines" one word at a time. */
+	ngram_state_init(model, &state, NULL, 0);
+	TEST_EQUAL(state.n_hist, 0);
+	ngram_state_score(model, &state, ngram_wid(model, "david"),
+			  &state2, &n_used);
+	TEST_EQUAL(state2.n_hist, 1);
+	TEST_EQUAL_LOG(ngram_state_score(model, &state2,
+					 ngram_wid(model, "huggins"),
+					 &state3, &n_used), -831);
+	TEST_EQUAL(n_used, 2);
+	TEST_EQUAL(state3.n_hist, 2);
+	TEST_EQUAL_LOG(ngram_state_score(model, &state3,
+					 ngram_wid(model, "daines"),
+					 &state, &n_used), -9452);
+	TEST_EQUAL(n_used, 3);
+
+	/* Histories which the model can't use are dropped. */
+	hist[0] = ngram_wid(model, "david");
+	hist[1] = ngram_wid(model, "david");
+	ngram_state_init(model, &state, hist, 2);
+	ngram_state_init(model, &state2, hist, 1);
+	TEST_ASSERT(ngram_state_equal(&state, &state2));
+	hist[0] = ngram_wid(model, "huggins");
+	hist[1] = ngram_wid(model, "david");
+	ngram_state_init(model, &state3, hist, 2);
+	TEST_ASSERT(!ngram_state_equal(&state, &state3));
+}
+
+int
+main(int argc, char *argv[])
+{
+	logmath_t *lmath;
+	ngram_model_t *model, *lmset;
+	const char *name = "100";
+
+	lmath = logmath_init(1.0001, 0, 0);
+
+	model = ngram_model_read(NULL, LMDIR "/100.lm.bin", NGRAM_BIN, lmath);
+	run_tests(model);
+
+	/* Sets pass states through to the current model. */
+	lmset = ngram_model_set_init(NULL, &model, (char **)&name, NULL, 1);
+	TEST_ASSERT(lmset);
+	TEST_EQUAL(ngram_model_set_select(lmset, "100"), model);
+	run_tests(lmset);
+	ngram_model_free(lmset);
+	ngram_model_free(model);
+
+	model = ngram_model_read(NULL, LMDIR "/100.lm.gz", NGRAM_ARPA, lmath);
+	run_tests(model);
+	ngram_model_free(model);
+
+	logmath_free(lmath);
+	return 0;
+}
@@ -2,6 +2,7 @@
 #include <logmath.h>
 #include <strfuncs.h>
 #include <err.h>
+#include <cmd_ln.h>
 
 #include "test_macros.h"
 
@@ -37,11 +38,57 @@ test_lm_vals(ngram_model_t *model)
 	return 0;
 }
 
+static const arg_t lm_args[] = {
+	{ "-mmap", ARG_BOOLEAN, "no", "Memory-map binary LMs" },
+	{ "-quant", ARG_STRING, NULL, "Quantization bits" },
+	{ "-nthreads", ARG_INT32, "1", "Threads to read and write ARPA files" },
+	{ NULL, 0, NULL, NULL }
+};
+
+/* Quantized scores are close to the originals, and survive a round trip
+ * through the binary format. */
+static int
+test_lm_quant(logmath_t *lmath, char const *spec)
+{
+	ngram_model_t *model;
+	cmd_ln_t *config;
+	int32 bg, tg;
+
+	E_INFO("Converting ARPA to BIN with %s quantization\n", spec);
+	config = cmd_ln_init(NULL, lm_args, TRUE, "-quant", spec, NULL);
+	model = ngram_model_read(config, LMDIR "/100.lm.bz2", NGRAM_ARPA, lmath);
+	TEST_ASSERT(model);
+	TEST_EQUAL_LOG(ngram_score(model, "sphinxtrain", NULL), -64208);
+	bg = ngram_score(model, "huggins", "david", NULL);
+	tg = ngram_score(model, "daines", "huggins", "david", NULL);
+	printf("%s: %d %d\n", spec, bg, tg);
+	TEST_ASSERT(abs(bg - -831) < 1000);
+	TEST_ASSERT(abs(tg - -9450) < 1000);
+	TEST_EQUAL(0, ngram_model_write(model, "100.quant.tmp.lm.bin", NGRAM_BIN));
+	ngram_model_free(model);
+
+	model = ngram_model_read(config, "100.quant.tmp.lm.bin", NGRAM_BIN, lmath);
+	TEST_ASSERT(model);
+	TEST_EQUAL(bg, ngram_score(model, "huggins", "david", NULL));
+	TEST_EQUAL(tg, ngram_score(model, "daines", "huggins", "david", NULL));
+	ngram_model_free(model);
+
+	cmd_ln_set_boolean_r(config, "-mmap", TRUE);
+	model = ngram_model_read(config, "100.quant.tmp.lm.bin", NGRAM_BIN, lmath);
+	TEST_ASSERT(model);
+	TEST_EQUAL(bg, ngram_score(model, "huggins", "david", NULL));
+	TEST_EQUAL(tg, ngram_score(model, "daines", "huggins", "david", NULL));
+	ngram_model_free(model);
+	cmd_ln_free_r(config);
+	return 0;
+}
+
 int
 main(int argc, char *argv[])
 {
 	logmath_t *lmath;
 	ngram_model_t *model;
+	cmd_ln_t *config;
 
 	/* Initialize a logmath object to pass to ngram_read */
 	lmath = logmath_init(1.0001, 0, 0);
@@ -63,6 +110,21 @@ main(int argc, char *argv[])
 	test_lm_vals(model);
 	ngram_model_free(model);
 
+	E_INFO("Testing converted BIN mapped in place\n");
+	config = cmd_ln_init(NULL, lm_args, TRUE, "-mmap", "yes", NULL);
+	model = ngram_model_read(config, "100.tmp.lm.bin", NGRAM_BIN, lmath);
+	test_lm_vals(model);
+	/* Words can still be added to a mapped model. */
+	TEST_ASSERT(ngram_model_add_word(model, "foobie", 1.0) != NGRAM_INVALID_WID);
+	TEST_ASSERT(ngram_wid(model, "foobie") != NGRAM_INVALID_WID);
+	ngram_model_free(model);
+
+	E_INFO("Testing BIN in the previous format with -mmap\n");
+	model = ngram_model_read(config, LMDIR "/100.lm.bin", NGRAM_BIN, lmath);
+	test_lm_vals(model);
+	ngram_model_free(model);
+	cmd_ln_free_r(config);
+
 	E_INFO("Testing converted ARPA\n");
 	model = ngram_model_read(NULL, "100.tmp.lm", NGRAM_ARPA, lmath);
 	test_lm_vals(model);
@@ -80,11 +142,29 @@ main(int argc, char *argv[])
 	TEST_EQUAL(0, ngram_model_write(model, "100.tmp.lm", NGRAM_ARPA));
 	ngram_model_free(model);
 
+	E_INFO("Writing compressed ARPA in several threads\n");
+	config = cmd_ln_init(NULL, lm_args, TRUE, "-nthreads", "4", NULL);
+	model = ngram_model_read(config, "100.tmp.lm.bin", NGRAM_BIN, lmath);
+	TEST_EQUAL(0, ngram_model_write(model, "100.tmp.lm.gz", NGRAM_ARPA));
+	ngram_model_free(model);
+	model = ngram_model_read(config, "100.tmp.lm.gz", NGRAM_ARPA, lmath);
+	test_lm_vals(model);
+	ngram_model_free(model);
+	cmd_ln_free_r(config);
+
 	E_INFO("Converting unigram ARPA to BIN\n");
 	model = ngram_model_read(NULL, LMDIR "/turtle.ug.lm", NGRAM_ARPA, lmath);
 	TEST_EQUAL(0, ngram_model_write(model, "turtle.ug.tmp.lm.bin", NGRAM_BIN));
 	ngram_model_free(model);
 
+	test_lm_quant(lmath, "8/8");
+	test_lm_quant(lmath, "12/8,10");
+	E_INFO("Testing invalid quantization\n");
+	config = cmd_ln_init(NULL, lm_args, TRUE, "-quant", "8/17", NULL);
+	TEST_EQUAL(NULL, ngram_model_read(config, LMDIR "/100.lm.bz2",
+					  NGRAM_ARPA, lmath));
+	cmd_ln_free_r(config);
+
 	logmath_free(lmath);
 	return 0;
 }
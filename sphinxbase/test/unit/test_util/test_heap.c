@@ -36,5 +36,45 @@ main(int argc, char *argv[])
 	TEST_EQUAL(0, heap_remove(heap, (void *)(long)9));
 	TEST_EQUAL(0, heap_remove(heap, (void *)(long)0));
 	TEST_EQUAL(heap_size(heap), 21);
+
+	/* Changing values reorders items. */
+	TEST_EQUAL(0, heap_update(heap, (void *)(long)20, -1));
+	TEST_EQUAL(0, heap_update(heap, (void *)(long)1, 100));
+	TEST_EQUAL(-1, heap_update(heap, (void *)(long)10, 0));
+	{
+		int32 val;
+		void *data;
+		TEST_EQUAL(1, heap_top(heap, &data, &val));
+		TEST_EQUAL(-1, val);
+		TEST_EQUAL(20, (int)(long)data);
+	}
+	heap_destroy(heap);
+
+	/* Inserting many items at once, into a heap that has some. */
+	heap = heap_new();
+	heap_insert(heap, (void *)(long)-1, 500);
+	{
+		void *data[1000];
+		int32 val[1000], prev;
+
+		for (i = 0; i < 1000; ++i) {
+			val[i] = (i * 7919) % 1000;
+			data[i] = (void *)(long)val[i];
+		}
+		TEST_EQUAL(0, heap_insert_n(heap, data, val, 1000));
+		TEST_EQUAL(1001, heap_size(heap));
+		prev = -1;
+		for (i = 0; i < 1001; ++i) {
+			int32 v;
+			void *d;
+			TEST_EQUAL(1, heap_pop(heap, &d, &v));
+			TEST_ASSERT(v >= prev);
+			if ((long)d != -1)
+				TEST_EQUAL(v, (int)(long)d);
+			prev = v;
+		}
+		TEST_EQUAL(0, heap_size(heap));
+	}
+	heap_destroy(heap);
 	return 0;
 }
@@ -57,6 +57,11 @@ extern "C" {
 #include <sphinxbase/prim_type.h>
 #include <s3/quest.h>
 
+/* Evaluate the candidate questions in best_q() in this many threads
+   (default 1). */
+void
+best_q_set_nthreads(uint32 n);
+
 float64
 best_q(float32 ****mixw,
        float32 ****means,
@@ -154,6 +154,11 @@ corpus_set_partition(uint32 r,
 uint32
 corpus_get_begin(void);
 
+/* Read MFCC data and transcripts of up to n_utt utts ahead in a
+ * background thread */
+int
+corpus_set_prefetch(uint32 n_utt, uint32 veclen);
+
 /* Initialization function to be called after
    configuration functions */
 
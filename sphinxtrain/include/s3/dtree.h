@@ -96,6 +96,32 @@ typedef struct dtree_s {
     uint32 n_node;
 } dtree_t;
 
+/*
+ * A final tree flattened into an array for looking up tied states.
+ * Each conjunction of a node's question is kept as one bitmask per
+ * context (left, base, right, word position), the intersection of
+ * the phone sets it asks about, so evaluating it is a bit test per
+ * context.
+ */
+#define DTREE_N_CTXT 4
+
+typedef struct dtree_flat_node_s {
+    uint32 y;			/* yes child, or NO_ID for a leaf */
+    uint32 n;			/* no child */
+    uint32 clust;		/* tied state id of a leaf */
+    uint32 term;		/* first conjunction of the question */
+    uint32 n_term;		/* # of conjunctions in the question */
+} dtree_flat_node_t;
+
+typedef struct dtree_flat_s {
+    dtree_flat_node_t *node;
+    uint32 n_node;
+    uint32 *mask;		/* DTREE_N_CTXT masks of n_word words
+				   for each conjunction */
+    uint32 n_word;
+    uint32 n_bit;		/* # of phones or positions in a mask */
+} dtree_flat_t;
+
 uint32
 cnt_node(dtree_node_t *node);
 
@@ -121,6 +147,20 @@ tied_state(dtree_node_t *node,
 	   word_posn_t wp,
 	   pset_t *pset);
 
+dtree_flat_t *
+flatten_tree(dtree_node_t *node,
+	     uint32 n_phone);
+
+uint32
+flat_tied_state(dtree_flat_t *tr,
+		acmod_id_t b,
+		acmod_id_t l,
+		acmod_id_t r,
+		word_posn_t wp);
+
+void
+free_flat_tree(dtree_flat_t *tr);
+
 uint32
 cnt_twig(dtree_node_t *node);
 
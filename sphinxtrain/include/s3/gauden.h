@@ -299,6 +299,40 @@ gauden_norm_wt_fullvar(vector_t ****in_var,
 		       uint32 n_density,
 		       const uint32 *veclen,
 		       int32 tiedvar);
+
+/* Normalize the sums of codebook i alone, as the functions above do
+ * for each of them when variances are not tied. */
+void
+gauden_norm_wt_mean_cb(vector_t **in_mean,
+		       vector_t **wt_mean,
+		       float32 **dnom,
+		       uint32 i,
+		       uint32 n_feat,
+		       uint32 n_density,
+		       const uint32 *veclen);
+
+void
+gauden_norm_wt_var_cb(vector_t **in_var,
+		      vector_t **wt_var,
+		      int32 pass2var,
+		      float32 **dnom,
+		      vector_t **mean,
+		      uint32 i,
+		      uint32 n_feat,
+		      uint32 n_density,
+		      const uint32 *veclen);
+
+void
+gauden_norm_wt_fullvar_cb(vector_t ***in_var,
+			  vector_t ***wt_var,
+			  int32 pass2var,
+			  float32 **dnom,
+			  vector_t **mean,
+			  uint32 i,
+			  uint32 n_feat,
+			  uint32 n_density,
+			  const uint32 *veclen);
+
 int
 gauden_eval_precomp(gauden_t *g);
 
@@ -66,6 +66,10 @@ typedef struct idx_dist_s {
 
 void k_means_set_get_obs(vector_t (*fn)(uint32 i));
 
+/* Label and update using this many threads (default 1).  get_obs
+   must then be safe to call from several threads at once. */
+void k_means_set_nthreads(uint32 n);
+
 float64
 k_means(vector_t *mean,			/* initial set of means */
 	uint32 n_mean,			/* # of means (should be k_mean?) */
@@ -116,6 +120,17 @@ k_means_update(vector_t *mean,
 	       uint32 n_obs);
 
 
+float64
+k_means_minibatch(vector_t *mean,		/* initial set of means */
+		  uint32 n_mean,		/* # of means */
+		  uint32 n_obs,			/* # of observations */
+		  uint32 veclen,		/* vector length of means and corpus */
+		  uint32 batch_size,		/* # of observations per batch */
+		  uint32 max_iter,		/* # of batches */
+		  codew_t **out_label);		/* The final labelling of the corpus according
+						   to the adjusted means; if NULL passed, just
+						   discarded. */
+
 float64
 k_means_subset(vector_t *mean,			/* initial set of means */
 	       uint32 n_mean,			/* # of means (should be k_mean?) */
@@ -53,6 +53,7 @@ extern "C" {
 #endif
 
 #include <s3/vector.h>
+#include <s3/s3io.h>
 
 #define GAU_FILE_VERSION	"1.0"
 #define GAUCNT_FILE_VERSION	"1.0"
@@ -66,6 +67,16 @@ s3gau_read(const char *fn,
 	   uint32 *out_n_density,
 	   uint32 **out_veclen);
 
+/* Map fn read-only instead of reading it; see s3mmap_open(). */
+int
+s3gau_map(const char *fn,
+	  s3mmap_t **out_map,
+	  vector_t ****out,
+	  uint32 *out_n_mgau,
+	  uint32 *out_n_feat,
+	  uint32 *out_n_density,
+	  uint32 **out_veclen);
+
 int
 s3gau_read_full(const char *fn,
 		vector_t *****out,
@@ -74,6 +85,16 @@ s3gau_read_full(const char *fn,
 		uint32 *out_n_density,
 		uint32 **out_veclen);
 
+/* Map fn read-only instead of reading it; see s3mmap_open(). */
+int
+s3gau_map_full(const char *fn,
+	       s3mmap_t **out_map,
+	       vector_t *****out,
+	       uint32 *out_n_mgau,
+	       uint32 *out_n_feat,
+	       uint32 *out_n_density,
+	       uint32 **out_veclen);
+
 int
 s3gau_read_maybe_full(const char *fn,
 		      vector_t *****out,
@@ -110,6 +131,19 @@ s3gaucnt_read(const char *fn,
 	      uint32 *out_n_density,
 	      uint32 **out_veclen);
 
+/* Map fn read-only instead of reading it; see s3mmap_open(). */
+int
+s3gaucnt_map(const char *fn,
+	     s3mmap_t **out_map,
+	     vector_t ****out_wt_mean,
+	     vector_t ****out_wt_var,
+	     int32 *out_pass2var,
+	     float32 ****out_dnom,
+	     uint32 *out_n_cb,
+	     uint32 *out_n_feat,
+	     uint32 *out_n_density,
+	     uint32 **out_veclen);
+
 int
 s3gaucnt_write(const char *fn,
 	       vector_t ***wt_mean,
@@ -139,6 +173,18 @@ s3gaucnt_read_full(const char *fn,
 		   uint32 *out_n_density,
 		   uint32 **out_veclen);
 
+int
+s3gaucnt_map_full(const char *fn,
+		  s3mmap_t **out_map,
+		  vector_t ****out_wt_mean,
+		  vector_t *****out_wt_var,
+		  int32 *out_pass2var,
+		  float32 ****out_dnom,
+		  uint32 *out_n_cb,
+		  uint32 *out_n_feat,
+		  uint32 *out_n_density,
+		  uint32 **out_veclen);
+
 int
 s3gaucnt_write_full(const char *fn,
 		    vector_t ***wt_mean,
@@ -157,6 +203,35 @@ s3gaudnom_write(const char *fn,
 		uint32 n_feat,
 		uint32 n_density);
 
+/* Writer of a parameter or dnom file one codebook at a time, so that
+ * the whole array need not be in memory.  Each s3gau_write_cb() call
+ * takes the contiguous values of the next codebook, laid out as in
+ * s3gau_write() or s3gau_write_full(), or for dnom files, its
+ * n_feat x n_density counts. */
+typedef struct s3gau_wr_s s3gau_wr_t;
+
+s3gau_wr_t *
+s3gau_write_open(const char *fn,
+		 uint32 n_mgau,
+		 uint32 n_feat,
+		 uint32 n_density,
+		 const uint32 *veclen,
+		 int32 full);
+
+s3gau_wr_t *
+s3gaudnom_write_open(const char *fn,
+		     uint32 n_cb,
+		     uint32 n_feat,
+		     uint32 n_density);
+
+int
+s3gau_write_cb(s3gau_wr_t *wr,
+	       const float32 *cb);
+
+/* Finish the file, which fails unless every codebook was written. */
+int
+s3gau_write_close(s3gau_wr_t *wr);
+
 #ifdef __cplusplus
 }
 #endif
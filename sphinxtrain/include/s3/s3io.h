@@ -82,6 +82,55 @@ s3add_fattr(char *attrib,
 int
 s3close(FILE *fp);
 
+/* Read-only view of a native-endian SPHINX-III binary file.  Arrays
+ * read from it point into the mapping and are valid until
+ * s3mmap_close().  Checksums are not verified. */
+typedef struct s3mmap_s s3mmap_t;
+
+/* Map a file and parse its header as s3open() does.  Returns NULL if
+ * the file is byte-swapped (see s3swap_file()) or cannot be mapped. */
+s3mmap_t *
+s3mmap_open(const char *file_name);
+
+/* Return a pointer to the next n_byte bytes and skip past them. */
+void *
+s3mmap_read(s3mmap_t *m,
+	    size_t n_byte);
+
+/* Map an array written by bio_fwrite_1d(). */
+int32
+s3mmap_read_1d(s3mmap_t *m,
+	       void **arr,
+	       size_t e_sz,
+	       uint32 *d1);
+
+/* Map an array written by bio_fwrite_3d(). */
+int32
+s3mmap_read_3d(s3mmap_t *m,
+	       void ****arr,
+	       size_t e_sz,
+	       uint32 *d1,
+	       uint32 *d2,
+	       uint32 *d3);
+
+/* Free arr, allocated with ckd_calloc_3d(), when m is closed. */
+void
+s3mmap_own_3d(s3mmap_t *m,
+	      void ***arr);
+
+/* Free arr, allocated with ckd_calloc_4d(), when m is closed. */
+void
+s3mmap_own_4d(s3mmap_t *m,
+	      void ****arr);
+
+void
+s3mmap_close(s3mmap_t *m);
+
+/* Convert a SPHINX-III binary file to native byte order in place so
+ * that it can be mapped.  Does nothing if it already is. */
+int32
+s3swap_file(const char *file_name);
+
 int32
 s3read_intv_3d(void ****arr,
 	       size_t e_sz,
@@ -56,6 +56,7 @@ extern "C" {
 
 #include <sphinxbase/prim_type.h>
 #include <s3/s3.h>
+#include <s3/s3io.h>
 
 int
 s3mixw_read(const char *fn,
@@ -65,6 +66,15 @@ s3mixw_read(const char *fn,
 	    uint32 *out_n_density);
 
 
+/* Map fn read-only instead of reading it; see s3mmap_open(). */
+int
+s3mixw_map(const char *fn,
+	   s3mmap_t **out_map,
+	   float32 ****out_mixw,
+	   uint32 *out_n_mixw,
+	   uint32 *out_n_feat,
+	   uint32 *out_n_density);
+
 int
 s3mixw_intv_read(const char *fn,
 		 uint32 mixw_s,
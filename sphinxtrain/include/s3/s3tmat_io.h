@@ -57,6 +57,7 @@ extern "C" {
 
 #include <sphinxbase/prim_type.h>
 #include <s3/s3.h>
+#include <s3/s3io.h>
 
 int
 s3tmat_read(const char *fn,
@@ -64,6 +65,14 @@ s3tmat_read(const char *fn,
 	    uint32 *out_n_tmat,
 	    uint32 *out_n_state);
 
+/* Map fn read-only instead of reading it; see s3mmap_open(). */
+int
+s3tmat_map(const char *fn,
+	   s3mmap_t **out_map,
+	   float32 ****out_tmat,
+	   uint32 *out_n_tmat,
+	   uint32 *out_n_state);
+
 int
 s3tmat_write(const char *fn,
 	     float32 ***tmat,
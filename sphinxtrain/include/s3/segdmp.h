@@ -104,6 +104,18 @@ segdmp_next_feat(acmod_id_t p,
 		 vector_t ***out_feat,	/* use feat_*() routines to find out other dims */
 		 uint32 *out_n_frame);
 
+/*
+ * All the frames of an id, which are contiguous in the dump.  They
+ * are returned in place if the dump is mapped, and otherwise read
+ * into *buf, which is reallocated as needed and freed by the caller.
+ * Calls for different ids and buffers may be made from several
+ * threads at once.
+ */
+float32 *
+segdmp_id_frames(uint32 id,
+		 uint32 *out_n_frame,
+		 float32 **buf);
+
 /*
  * Segment dump state query calls
  */
@@ -117,6 +129,10 @@ segdmp_n_seg(uint32 id);
 void
 segdmp_set_bufsz(uint32 sz_in_meg);
 
+/* Map dumps opened for reading after this, if possible */
+void
+segdmp_set_mmap(int mmap);
+
 
 #ifdef __cplusplus
 }
@@ -60,6 +60,14 @@ int
 state_seq_free(state_t *s,
 	       unsigned int n);
 
+/* Return a private copy of the state sequence s, which must later be
+ * released with state_seq_free().  state_seq_make() reuses its storage
+ * on every call, so this is needed to keep a sequence beyond the next
+ * one. */
+state_t *
+state_seq_copy(state_t *s,
+	       uint32 n);
+
 state_t *
 state_seq_make(uint32 *n_state,
 	       acmod_id_t *phone,
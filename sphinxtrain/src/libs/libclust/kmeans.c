@@ -51,21 +51,166 @@
 #include <sphinxbase/profile.h>
 
 #include <s3/kmeans.h>
+#include <s3/run_jobs.h>
 #include <s3/s3.h>
 
+#include <sys_compat/misc.h>
+
 #include <assert.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define KMEANS_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#define KMEANS_NEON
+#include <arm_neon.h>
+#endif
 
 #ifndef NULL
 #define NULL (void *)0
 #endif
 
 static vector_t (*get_obs)(uint32 i);
+static uint32 n_thread = 1;
 
 void k_means_set_get_obs(vector_t (*fn)(uint32 i))
 {
     get_obs = fn;
 }
 
+void k_means_set_nthreads(uint32 n)
+{
+    n_thread = (n > 0 ? n : 1);
+}
+
+/*
+ * Squared Euclidean distance between m and c.  Differences are taken
+ * in float32 and summed in float64 like the original scalar loops.
+ * Once the partial sum reaches bound the remaining dimensions cannot
+ * make it smaller, so the (partial) sum is returned early; the check
+ * is made every four dimensions.
+ */
+static float64
+sq_dist(vector_t m,
+	vector_t c,
+	uint32 veclen,
+	float64 bound)
+{
+    float64 d = 0.0, t;
+    uint32 l = 0;
+
+#if defined(KMEANS_SSE2)
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    __m128d s;
+
+    for (; l + 4 <= veclen; l += 4) {
+	__m128 df = _mm_sub_ps(_mm_loadu_ps(m + l), _mm_loadu_ps(c + l));
+	__m128d d0 = _mm_cvtps_pd(df);
+	__m128d d1 = _mm_cvtps_pd(_mm_movehl_ps(df, df));
+
+	acc0 = _mm_add_pd(acc0, _mm_mul_pd(d0, d0));
+	acc1 = _mm_add_pd(acc1, _mm_mul_pd(d1, d1));
+	s = _mm_add_pd(acc0, acc1);
+	d = _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+	if (d >= bound)
+	    return d;
+    }
+#elif defined(KMEANS_NEON)
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = vdupq_n_f64(0.0);
+
+    for (; l + 4 <= veclen; l += 4) {
+	float32x4_t df = vsubq_f32(vld1q_f32(m + l), vld1q_f32(c + l));
+	float64x2_t d0 = vcvt_f64_f32(vget_low_f32(df));
+	float64x2_t d1 = vcvt_high_f64_f32(df);
+
+	acc0 = vaddq_f64(acc0, vmulq_f64(d0, d0));
+	acc1 = vaddq_f64(acc1, vmulq_f64(d1, d1));
+	d = vaddvq_f64(vaddq_f64(acc0, acc1));
+	if (d >= bound)
+	    return d;
+    }
+#endif
+
+    for (; (l < veclen) && (d < bound); l++) {
+	t = m[l] - c[l];
+	d += t * t;
+    }
+
+    return d;
+}
+
+/*
+ * A contiguous slice [beg, end) of the observations (or of subset,
+ * if it is not NULL) to be labelled or summed by one thread.
+ */
+typedef struct km_job_s km_job_t;
+struct km_job_s {
+    float64 (*fn)(km_job_t *job);
+    codew_t *label;
+    vector_t *mean;
+    uint32 n_mean;
+    uint32 veclen;
+    idx_dist_t **nnmap;
+    uint32 *subset;
+    uint32 beg;
+    uint32 end;
+    vector_t *sum;
+    uint32 *cnt;
+    float64 sqerr;
+};
+
+static uint32
+km_split(km_job_t *proto, uint32 n_obs, km_job_t **out_job)
+{
+    km_job_t *job;
+    uint32 n_job, j;
+
+    n_job = n_thread;
+    if (n_job > n_obs)
+	n_job = (n_obs > 0 ? n_obs : 1);
+
+    job = (km_job_t *)ckd_calloc(n_job, sizeof(km_job_t));
+    for (j = 0; j < n_job; j++) {
+	job[j] = *proto;
+	job[j].beg = (uint32)((uint64)n_obs * j / n_job);
+	job[j].end = (uint32)((uint64)n_obs * (j + 1) / n_job);
+    }
+
+    *out_job = job;
+
+    return n_job;
+}
+
+static void
+km_job(void *arg)
+{
+    km_job_t *job = (km_job_t *)arg;
+
+    job->sqerr = job->fn(job);
+}
+
+/*
+ * Run the jobs in threads, then return the total of their squared
+ * errors, summed in order so that the result does not depend on
+ * scheduling.
+ */
+static float64
+km_run(km_job_t *job, uint32 n_job)
+{
+    float64 sqerr;
+    uint32 j;
+
+    run_jobs(km_job, job, sizeof(km_job_t), n_job);
+
+    for (j = 0, sqerr = 0; j < n_job; j++)
+	sqerr += job[j].sqerr;
+
+    return sqerr;
+}
+
 static void nn_sort_kmeans(vector_t *mean,
 			   uint32 n_mean,
 			   uint32 veclen,
@@ -205,41 +350,29 @@ k_means_trineq(vector_t *mean,			/* initial set of means */
  * 
  *********************************************************************/
 
-float64
-k_means_label(codew_t *label,
-	      vector_t *mean,
-	      uint32 n_mean,       /* # of mean vectors */
-	      uint32 n_obs,   /* in # of vectors */
-	      uint32 veclen)
+static float64
+label_range(km_job_t *job)
 {
-    uint32 i, j, b_j, l;
-    float64 t, d;
+    uint32 i, j, b_j;
+    float64 d;
     float64 b_d;
     float64 sqerr;
     vector_t c;
-    vector_t m;
+    vector_t *mean = job->mean;
+    codew_t *label = job->label;
 
-    for (i = 0, sqerr = 0; i < n_obs; i++, sqerr += b_d) {
+    for (i = job->beg, sqerr = 0; i < job->end; i++, sqerr += b_d) {
 	c = get_obs(i);
 	if (c == NULL) {
-	    E_INFO("No observations for %u, but expected up through %u\n", i, n_obs-1);
+	    E_INFO("No observations for %u, but expected up through %u\n", i, job->end-1);
 	}
 
 	/* Get an estimate of best distance (b_d) and codeword (b_j) */
 	b_j = label[i];
-	m = mean[b_j];
-	for (l = 0, b_d = 0.0; l < veclen; l++) {
-	    t = m[l] - c[l];
-	    b_d += t * t;
-	}
+	b_d = sq_dist(mean[b_j], c, job->veclen, MAX_POS_FLOAT64);
 
-	for (j = 0; j < n_mean; j++) {
-	    m = mean[j];
-
-	    for (l = 0, d = 0.0; (l < veclen) && (d < b_d); l++) {
-		t = m[l] - c[l];
-		d += t * t;
-	    }
+	for (j = 0; j < job->n_mean; j++) {
+	    d = sq_dist(mean[j], c, job->veclen, b_d);
 
 	    if (d < b_d) {
 		b_d = d;
@@ -252,6 +385,31 @@ k_means_label(codew_t *label,
 
     return sqerr;
 }
+
+float64
+k_means_label(codew_t *label,
+	      vector_t *mean,
+	      uint32 n_mean,       /* # of mean vectors */
+	      uint32 n_obs,   /* in # of vectors */
+	      uint32 veclen)
+{
+    km_job_t proto, *job;
+    uint32 n_job;
+    float64 sqerr;
+
+    memset(&proto, 0, sizeof(proto));
+    proto.fn = label_range;
+    proto.label = label;
+    proto.mean = mean;
+    proto.n_mean = n_mean;
+    proto.veclen = veclen;
+
+    n_job = km_split(&proto, n_obs, &job);
+    sqerr = km_run(job, n_job);
+    ckd_free(job);
+
+    return sqerr;
+}
 int
 cmp_dist(const void *a, const void *b)
 {
@@ -301,47 +459,34 @@ nn_sort_kmeans(vector_t *mean,
     }
 }
 
-float64
-k_means_label_trineq(codew_t *label,
-		     vector_t *mean,
-		     uint32 n_mean,       /* # of mean vectors */
-		     idx_dist_t **nnmap,
-		     uint32 n_obs,   /* in # of vectors */
-		     uint32 veclen)
+static float64
+label_trineq_range(km_job_t *job)
 {
-    uint32 i, eb_j, b_j, l, k;
-    float64 t, d;
+    uint32 i, eb_j, b_j, k;
+    float64 d;
     float64 b_d, eb_d;
     float64 sqerr;
     vector_t c;
-    vector_t m;
+    vector_t *mean = job->mean;
+    codew_t *label = job->label;
     idx_dist_t *nnmap_eb;
 
-    for (i = 0, sqerr = 0; i < n_obs; i++) {
+    for (i = job->beg, sqerr = 0; i < job->end; i++) {
 	c = get_obs(i);
 	if (c == NULL) {
-	    E_INFO("No observations for %u, but expected up through %u\n", i, n_obs-1);
+	    E_INFO("No observations for %u, but expected up through %u\n", i, job->end-1);
 	}
 
 	/* Get an estimate of b_d */
 	eb_j = label[i];
-	m = mean[eb_j];
-	for (l = 0, eb_d = 0.0; l < veclen; l++) {
-	    t = m[l] - c[l];
-	    eb_d += t * t;
-	}
+	eb_d = sq_dist(mean[eb_j], c, job->veclen, MAX_POS_FLOAT64);
 
-	nnmap_eb = nnmap[eb_j];
+	nnmap_eb = job->nnmap[eb_j];
 	b_d = eb_d;
 	b_j = eb_j;
 
-	for (k = 0; k < n_mean-1 && nnmap_eb[k].d <= 4.0 * eb_d; k++) {
-	    m = mean[nnmap_eb[k].idx];
-
-	    for (l = 0, d = 0.0; (l < veclen) && (d < b_d); l++) {
-		t = m[l] - c[l];
-		d += t * t;
-	    }
+	for (k = 0; k < job->n_mean-1 && nnmap_eb[k].d <= 4.0 * eb_d; k++) {
+	    d = sq_dist(mean[nnmap_eb[k].idx], c, job->veclen, b_d);
 	    
 	    if (d < b_d) {
 		b_j = nnmap_eb[k].idx;
@@ -357,6 +502,33 @@ k_means_label_trineq(codew_t *label,
     return sqerr;
 }
 
+float64
+k_means_label_trineq(codew_t *label,
+		     vector_t *mean,
+		     uint32 n_mean,       /* # of mean vectors */
+		     idx_dist_t **nnmap,
+		     uint32 n_obs,   /* in # of vectors */
+		     uint32 veclen)
+{
+    km_job_t proto, *job;
+    uint32 n_job;
+    float64 sqerr;
+
+    memset(&proto, 0, sizeof(proto));
+    proto.fn = label_trineq_range;
+    proto.label = label;
+    proto.mean = mean;
+    proto.n_mean = n_mean;
+    proto.veclen = veclen;
+    proto.nnmap = nnmap;
+
+    n_job = km_split(&proto, n_obs, &job);
+    sqerr = km_run(job, n_job);
+    ckd_free(job);
+
+    return sqerr;
+}
+
 #include <sphinxbase/ckd_alloc.h>
 
 /*********************************************************************
@@ -385,19 +557,49 @@ k_means_label_trineq(codew_t *label,
  * 
  *********************************************************************/
 
-int
-k_means_update(vector_t *mean,
-	       uint32 n_mean,
-	       uint32 veclen,
-	       codew_t *label,
-	       uint32 n_obs)
+static float64
+update_range(km_job_t *job)
 {
-    uint32 i, j, l, *cnt;
+    uint32 i, l;
     vector_t m;
     vector_t c;
-    int ret = K_MEANS_SUCCESS;
+    codew_t *label = job->label;
 
-    cnt = (uint32 *)ckd_calloc(n_mean, sizeof(uint32));
+    for (i = job->beg; i < job->end; i++) {
+	assert((0 <= label[i]) && (label[i] < job->n_mean));
+
+	m = job->sum[label[i]];
+	job->cnt[label[i]]++;
+
+	c = get_obs(job->subset ? job->subset[i] : i);
+	if (c == NULL) {
+	    E_INFO("No observations for %u, but expected up through %u\n", i, job->end-1);
+	}
+
+	for (l = 0; l < job->veclen; l++) {
+	    m[l] += c[l];
+	}
+    }
+
+    return 0;
+}
+
+/*
+ * Sum the observations of each codeword into mean and count them in
+ * cnt.  Each thread but the first sums into its own buffers, which
+ * are then added to the first one's.
+ */
+static void
+update_sum(vector_t *mean,
+	   uint32 *cnt,
+	   uint32 n_mean,
+	   uint32 veclen,
+	   uint32 *subset,
+	   codew_t *label,
+	   uint32 n_obs)
+{
+    km_job_t proto, *job;
+    uint32 n_job, i, j, l;
 
     for (i = 0; i < n_mean; i++) {
 	for (l = 0; l < veclen; l++) {
@@ -405,22 +607,49 @@ k_means_update(vector_t *mean,
 	}
     }
 
-    
-    for (i = 0; i < n_obs; i++) {
-	assert((0 <= label[i]) && (label[i] < n_mean));
-
-	m = mean[label[i]];
-	cnt[label[i]]++;
+    memset(&proto, 0, sizeof(proto));
+    proto.fn = update_range;
+    proto.label = label;
+    proto.n_mean = n_mean;
+    proto.veclen = veclen;
+    proto.subset = subset;
+
+    n_job = km_split(&proto, n_obs, &job);
+    job[0].sum = mean;
+    job[0].cnt = cnt;
+    for (j = 1; j < n_job; j++) {
+	job[j].sum = (vector_t *)ckd_calloc_2d(n_mean, veclen, sizeof(float32));
+	job[j].cnt = (uint32 *)ckd_calloc(n_mean, sizeof(uint32));
+    }
 
-	c = get_obs(i);
-	if (c == NULL) {
-	    E_INFO("No observations for %u, but expected up through %u\n", i, n_obs-1);
-	}
+    km_run(job, n_job);
 
-	for (l = 0; l < veclen; l++) {
-	    m[l] += c[l];
+    for (j = 1; j < n_job; j++) {
+	for (i = 0; i < n_mean; i++) {
+	    cnt[i] += job[j].cnt[i];
+	    for (l = 0; l < veclen; l++) {
+		mean[i][l] += job[j].sum[i][l];
+	    }
 	}
+	ckd_free_2d((void **)job[j].sum);
+	ckd_free(job[j].cnt);
     }
+    ckd_free(job);
+}
+
+int
+k_means_update(vector_t *mean,
+	       uint32 n_mean,
+	       uint32 veclen,
+	       codew_t *label,
+	       uint32 n_obs)
+{
+    uint32 i, j, l, *cnt;
+    int ret = K_MEANS_SUCCESS;
+
+    cnt = (uint32 *)ckd_calloc(n_mean, sizeof(uint32));
+
+    update_sum(mean, cnt, n_mean, veclen, NULL, label, n_obs);
 
     for (i = 0; i < n_mean; i++) {
 	j = cnt[i];
@@ -466,33 +695,22 @@ k_means_update(vector_t *mean,
  * 
  *********************************************************************/
 
-float64
-k_means_label_subset(codew_t *label,
-		     vector_t *mean,
-		     uint32 n_mean,       /* # of mean vectors */
-		     uint32 *subset,
-		     uint32 n_obs_subset,   /* in # of vectors */
-		     uint32 veclen)
+static float64
+label_subset_range(km_job_t *job)
 {
-    uint32 i, j, b_j=0, l;
-    float64 t, d;
+    uint32 i, j, b_j=0;
+    float64 d;
     float64 b_d;
     float64 sqerr;
     vector_t c;
-    vector_t m;
 
-    for (i = 0, sqerr = 0; i < n_obs_subset; i++) {
+    for (i = job->beg, sqerr = 0; i < job->end; i++) {
 	b_d = 1e300;
 
-	c = get_obs(subset[i]);
+	c = get_obs(job->subset[i]);
 	
-	for (j = 0; j < n_mean; j++) {
-	    m = mean[j];
-
-	    for (l = 0, d = 0.0; (l < veclen) && (d < b_d); l++) {
-		t = m[l] - c[l];
-		d += t * t;
-	    }
+	for (j = 0; j < job->n_mean; j++) {
+	    d = sq_dist(job->mean[j], c, job->veclen, b_d);
 
 	    if (d < b_d) {
 		b_d = d;
@@ -500,13 +718,40 @@ k_means_label_subset(codew_t *label,
 	    }
 	}
 
-	label[i] = b_j;
+	job->label[i] = b_j;
 
 	sqerr += b_d;
     }
 
     return sqerr;
 }
+
+float64
+k_means_label_subset(codew_t *label,
+		     vector_t *mean,
+		     uint32 n_mean,       /* # of mean vectors */
+		     uint32 *subset,
+		     uint32 n_obs_subset,   /* in # of vectors */
+		     uint32 veclen)
+{
+    km_job_t proto, *job;
+    uint32 n_job;
+    float64 sqerr;
+
+    memset(&proto, 0, sizeof(proto));
+    proto.fn = label_subset_range;
+    proto.label = label;
+    proto.mean = mean;
+    proto.n_mean = n_mean;
+    proto.veclen = veclen;
+    proto.subset = subset;
+
+    n_job = km_split(&proto, n_obs_subset, &job);
+    sqerr = km_run(job, n_job);
+    ckd_free(job);
+
+    return sqerr;
+}
 
 /*********************************************************************
  *
@@ -543,30 +788,11 @@ k_means_update_subset(vector_t *mean,
 		      uint32 n_obs_subset)
 {
     uint32 i, j, l, *cnt;
-    vector_t m;
-    vector_t c;
     int ret = K_MEANS_SUCCESS;
 
     cnt = (uint32 *)ckd_calloc(n_mean, sizeof(uint32));
 
-    for (i = 0; i < n_mean; i++) {
-	for (l = 0; l < veclen; l++) {
-	    mean[i][l] = 0.0;
-	}
-    }
-
-    for (i = 0; i < n_obs_subset; i++) {
-	assert((0 <= label[i]) && (label[i] < n_mean));
-	
-	m = mean[label[i]];
-	cnt[label[i]]++;
-	
-	c = get_obs(subset[i]);
-
-	for (l = 0; l < veclen; l++) {
-	    m[l] += c[l];
-	}
-    }
+    update_sum(mean, cnt, n_mean, veclen, subset, label, n_obs_subset);
 
     for (i = 0; i < n_mean; i++) {
 	j = cnt[i];
@@ -634,3 +860,77 @@ k_means_subset(vector_t *mean,			/* initial set of means */
 
     return sqerr;
 }
+
+/*
+ * Mini-batch k-means (Sculley, "Web-scale k-means clustering", 2010).
+ * Each iteration labels a random batch of observations and moves each
+ * of their codewords towards them with a per-codeword learning rate
+ * of 1 / (# of observations it has seen so far).  The corpus is only
+ * read in full once, to label it against the final means.
+ */
+float64
+k_means_minibatch(vector_t *mean,		/* initial set of means */
+		  uint32 n_mean,		/* # of means */
+		  uint32 n_obs,			/* # of observations */
+		  uint32 veclen,		/* vector length of means and corpus */
+		  uint32 batch_size,		/* # of observations per batch */
+		  uint32 max_iter,		/* # of batches */
+		  codew_t **out_label)		/* The final labelling of the corpus according
+						   to the adjusted means; if NULL passed, just
+						   discarded. */
+{
+    uint32 i, b, k, l, *cnt, *batch;
+    codew_t *label;
+    vector_t m, c;
+    float32 eta;
+    float64 sqerr;
+
+    if (batch_size > n_obs)
+	batch_size = n_obs;
+
+    cnt = (uint32 *)ckd_calloc(n_mean, sizeof(uint32));
+    batch = (uint32 *)ckd_calloc(batch_size, sizeof(uint32));
+    label = (codew_t *)ckd_calloc(n_obs, sizeof(codew_t));
+
+    for (i = 0; i < max_iter; i++) {
+	for (b = 0; b < batch_size; b++) {
+	    batch[b] = (uint32)(drand48() * n_obs);
+	    if (batch[b] >= n_obs)
+		batch[b] = n_obs - 1;
+	}
+
+	k_means_label_subset(label, mean, n_mean, batch, batch_size, veclen);
+
+	for (b = 0; b < batch_size; b++) {
+	    k = label[b];
+	    m = mean[k];
+	    c = get_obs(batch[b]);
+	    eta = 1.0f / (float32)++cnt[k];
+
+	    for (l = 0; l < veclen; l++) {
+		m[l] += eta * (c[l] - m[l]);
+	    }
+	}
+    }
+
+    for (k = 0; k < n_mean; k++) {
+	if (cnt[k] == 0)
+	    E_WARN("Codeword %u never chosen by mini-batch k-means\n", k);
+    }
+
+    memset(label, 0, n_obs * sizeof(codew_t));
+    sqerr = k_means_label(label, mean, n_mean, n_obs, veclen);
+    E_INFO("kmminibatch n_iter %u sqerr %e\n", max_iter, sqerr);
+
+    ckd_free(batch);
+    ckd_free(cnt);
+
+    if (out_label) {
+	*out_label = label;
+    }
+    else {
+	ckd_free(label);
+    }
+
+    return sqerr;
+}
@@ -48,6 +48,7 @@
 #include <sphinxbase/cmd_ln.h>
 
 #include <s3/best_q.h>
+#include <s3/run_jobs.h>
 #include <s3/metric.h>
 #include <s3/s3.h>
 #include <s3/div.h>
@@ -55,59 +56,77 @@
 #include <stdio.h>
 #include <string.h>
 
-float64
-best_q(float32 ****mixw,
-       float32 ****means,
-       float32 ****vars,
-       uint32  *veclen,
-       uint32 n_model,
-       uint32 n_state,
-       uint32 n_stream,
-       uint32 n_density,
-       float32 *stwt,
-       uint32 **dfeat,
-       uint32 n_dfeat,
-       quest_t *all_q,
-       uint32 n_all_q,
-       pset_t *pset,
-       uint32 *id,
-       uint32 n_id,
-       float32 ***dist,
-       float64 node_wt_ent,  /* Weighted entropy of node */
-       quest_t **out_best_q)
+static uint32 n_thread = 1;
+
+void
+best_q_set_nthreads(uint32 n)
+{
+    n_thread = (n > 0 ? n : 1);
+}
+
+/*
+ * The questions [beg, end) to be evaluated by one thread, with its
+ * own scratch distributions, and the best of them.
+ */
+typedef struct bq_job_s {
+    float32 ****mixw;
+    float32 ****means;
+    float32 ****vars;
+    uint32 *veclen;
+    uint32 n_state;
+    uint32 n_stream;
+    uint32 n_density;
+    float32 *stwt;
+    uint32 **dfeat;
+    uint32 n_dfeat;
+    quest_t *all_q;
+    uint32 *id;
+    uint32 n_id;
+    float32 ***dist;
+    float64 node_wt_ent;
+    uint32 continuous;
+    float32 varfloor;
+
+    uint32 beg;
+    uint32 end;
+
+    uint32 b_q;
+    uint32 n_b_yes;
+    uint32 n_b_no;
+    float64 b_einc;
+} bq_job_t;
+
+static int
+best_q_range(bq_job_t *job)
 {
+    float32 ****mixw = job->mixw;
+    float32 ****means = job->means;
+    float32 ****vars = job->vars;
+    uint32 *veclen = job->veclen;
+    uint32 n_state = job->n_state;
+    uint32 n_stream = job->n_stream;
+    uint32 n_density = job->n_density;
+    float32 *stwt = job->stwt;
+    float32 varfloor = job->varfloor;
+    uint32 continuous = job->continuous;
     float32 ***yes_dist;
     float32 ***yes_means=0;
     float32 ***yes_vars=0;
-    float32 varfloor=0;
     float64 y_ent;
     float64 yes_dnom, yes_norm;
-    uint32 *yes_id;
     float32 ***no_dist;
     float32 ***no_means=0;
     float32 ***no_vars=0;
     float64 n_ent;
     float64 no_dnom, no_norm;
-    uint32 *no_id;
     uint32 n_yes, n_b_yes = 0;
     uint32 n_no, n_b_no = 0;
     uint32 i, j, k, q, b_q=0, s;
     uint32 ii;
+    uint32 sumveclen=0;
     float64 einc, b_einc = -1.0e+50;
 
-    const char*  type;
-    uint32 continuous, sumveclen=0;
-
-    type = cmd_ln_str("-ts2cbfn");
-    if (strcmp(type,".semi.")!=0 && strcmp(type,".cont.") != 0)
-        E_FATAL("Type %s unsupported; trees can only be built on types .semi. or .cont.\n",type);
-    if (strcmp(type,".cont.") == 0)
-        continuous = 1;
-    else
-        continuous = 0;
-
     if (continuous == 1) {
-        varfloor = cmd_ln_float32("-varfloor");
         /* Allocating for sumveclen is overallocation, but it eases coding */
         for (ii=0,sumveclen=0;ii<n_stream;ii++) sumveclen += veclen[ii];
         yes_means = (float32 ***)ckd_calloc_3d(n_state,n_stream,sumveclen,sizeof(float32));
@@ -116,12 +135,10 @@ best_q(float32 ****mixw,
         no_vars = (float32 ***)ckd_calloc_3d(n_state,n_stream,sumveclen,sizeof(float32));
     }
 
-    n_yes = n_no = 0;
-
     yes_dist = (float32 ***)ckd_calloc_3d(n_state, n_stream, n_density, sizeof(float32));
     no_dist = (float32 ***)ckd_calloc_3d(n_state, n_stream, n_density, sizeof(float32));
 
-    for (q = 0; q < n_all_q; q++) {
+    for (q = job->beg; q < job->end; q++) {
 	memset(&yes_dist[0][0][0], 0, sizeof(float32) * n_state * n_stream * n_density);
 	memset(&no_dist[0][0][0], 0, sizeof(float32) * n_state * n_stream * n_density);
 
@@ -134,9 +151,9 @@ best_q(float32 ****mixw,
 
 	n_yes = n_no = 0;
 
-	for (ii = 0; ii < n_id; ii++) {
-	    i = id[ii];
-	    if (eval_quest(&all_q[q], dfeat[i], n_dfeat)) {
+	for (ii = 0; ii < job->n_id; ii++) {
+	    i = job->id[ii];
+	    if (eval_quest(&job->all_q[q], job->dfeat[i], job->n_dfeat)) {
 	        for (s = 0; s < n_state; s++) {
 		    for (j = 0; j < n_stream; j++) {
 			for (k = 0; k < n_density; k++) {
@@ -243,12 +260,12 @@ best_q(float32 ****mixw,
             else {
 	        einc += (float64)stwt[s] * wt_ent_inc(yes_dist[s], yes_dnom,
 	    				     no_dist[s], no_dnom,
-					     dist[s], n_stream, n_density);
+					     job->dist[s], n_stream, n_density);
             }
 	}
 
         if (continuous == 1) {
-            einc -=  node_wt_ent;
+            einc -=  job->node_wt_ent;
         }
 
 	if (s < n_state) {
@@ -264,50 +281,8 @@ best_q(float32 ****mixw,
 	}
     }
 
-    if ((n_b_yes == 0) || (n_b_no == 0)) {
-	/* No best question */
-	*out_best_q = NULL;
-
-	return 0;
-    }
-
-    yes_id = (uint32 *)ckd_calloc(n_b_yes, sizeof(uint32));
-    no_id  = (uint32 *)ckd_calloc(n_b_no, sizeof(uint32));
-
-    memset(&yes_dist[0][0][0], 0, sizeof(float32) * n_state * n_stream * n_density);
-    memset(&no_dist[0][0][0], 0, sizeof(float32) * n_state * n_stream * n_density);
-    n_yes = n_no = 0;
-
-    for (ii = 0; ii < n_id; ii++) {
-	i = id[ii];
-	if (eval_quest(&all_q[b_q], dfeat[i], n_dfeat)) {
-	    for (s = 0; s < n_state; s++) {
-		for (j = 0; j < n_stream; j++) {
-		    for (k = 0; k < n_density; k++) {
-			yes_dist[s][j][k] += mixw[i][s][j][k];
-		    }
-		}
-	    }
-	    yes_id[n_yes] = i;
-	    ++n_yes;
-	}
-	else {
-	    for (s = 0; s < n_state; s++) {
-		for (j = 0; j < n_stream; j++) {
-		    for (k = 0; k < n_density; k++) {
-			no_dist[s][j][k] += mixw[i][s][j][k];
-		    }
-		}
-	    }
-	    no_id[n_no] = i;
-	    ++n_no;
-	}
-    }
-    
     ckd_free_3d((void ***)yes_dist);
-    ckd_free((void *)yes_id);
     ckd_free_3d((void ***)no_dist);
-    ckd_free((void *)no_id);
 
     if (continuous == 1) {
         ckd_free_3d((void ***)yes_means);
@@ -316,6 +291,108 @@ best_q(float32 ****mixw,
         ckd_free_3d((void ***)no_vars);
     }
 
+    job->b_q = b_q;
+    job->n_b_yes = n_b_yes;
+    job->n_b_no = n_b_no;
+    job->b_einc = b_einc;
+
+    return 0;
+}
+
+static void
+best_q_job(void *arg)
+{
+    best_q_range((bq_job_t *)arg);
+}
+
+float64
+best_q(float32 ****mixw,
+       float32 ****means,
+       float32 ****vars,
+       uint32  *veclen,
+       uint32 n_model,
+       uint32 n_state,
+       uint32 n_stream,
+       uint32 n_density,
+       float32 *stwt,
+       uint32 **dfeat,
+       uint32 n_dfeat,
+       quest_t *all_q,
+       uint32 n_all_q,
+       pset_t *pset,
+       uint32 *id,
+       uint32 n_id,
+       float32 ***dist,
+       float64 node_wt_ent,  /* Weighted entropy of node */
+       quest_t **out_best_q)
+{
+    bq_job_t proto, *job;
+    uint32 n_job, t;
+    uint32 b_q=0, n_b_yes = 0, n_b_no = 0;
+    float64 b_einc = -1.0e+50;
+    const char*  type;
+
+    memset(&proto, 0, sizeof(proto));
+
+    type = cmd_ln_str("-ts2cbfn");
+    if (strcmp(type,".semi.")!=0 && strcmp(type,".cont.") != 0)
+        E_FATAL("Type %s unsupported; trees can only be built on types .semi. or .cont.\n",type);
+    if (strcmp(type,".cont.") == 0)
+        proto.continuous = 1;
+    else
+        proto.continuous = 0;
+
+    if (proto.continuous == 1)
+        proto.varfloor = cmd_ln_float32("-varfloor");
+
+    proto.mixw = mixw;
+    proto.means = means;
+    proto.vars = vars;
+    proto.veclen = veclen;
+    proto.n_state = n_state;
+    proto.n_stream = n_stream;
+    proto.n_density = n_density;
+    proto.stwt = stwt;
+    proto.dfeat = dfeat;
+    proto.n_dfeat = n_dfeat;
+    proto.all_q = all_q;
+    proto.id = id;
+    proto.n_id = n_id;
+    proto.dist = dist;
+    proto.node_wt_ent = node_wt_ent;
+
+    /* Each thread takes a contiguous range of questions, so keeping
+     * the first of equally good ones in thread order picks the same
+     * question as a single thread would. */
+    n_job = n_thread;
+    if (n_job > n_all_q)
+	n_job = (n_all_q > 0 ? n_all_q : 1);
+    job = (bq_job_t *)ckd_calloc(n_job, sizeof(bq_job_t));
+    for (t = 0; t < n_job; t++) {
+	job[t] = proto;
+	job[t].beg = n_all_q * t / n_job;
+	job[t].end = n_all_q * (t + 1) / n_job;
+    }
+    run_jobs(best_q_job, job, sizeof(bq_job_t), n_job);
+
+    for (t = 0; t < n_job; t++) {
+	if ((job[t].n_b_yes != 0) && (job[t].n_b_no != 0)
+	    && (job[t].b_einc > b_einc)) {
+	    b_einc = job[t].b_einc;
+	    b_q = job[t].b_q;
+	    n_b_yes = job[t].n_b_yes;
+	    n_b_no = job[t].n_b_no;
+	}
+    }
+    ckd_free(job);
+
+    if ((n_b_yes == 0) || (n_b_no == 0)) {
+	/* No best question */
+	*out_best_q = NULL;
+
+	return 0;
+    }
+
     *out_best_q = &all_q[b_q];
 
     return b_einc;
@@ -648,6 +648,164 @@ tied_state(dtree_node_t *node,
     }
 }
 
+static uint32
+cnt_flat_term(dtree_node_t *node)
+{
+    if (IS_LEAF(node))
+	return 0;
+    else
+	return ((comp_quest_t *)node->q)->sum_len
+	    + cnt_flat_term(node->y) + cnt_flat_term(node->n);
+}
+
+static uint32
+flatten_node(dtree_flat_t *tr,
+	     dtree_node_t *node,
+	     uint32 n_phone,
+	     uint32 *next_node,
+	     uint32 *next_term)
+{
+    dtree_flat_node_t *fn;
+    comp_quest_t *q;
+    uint32 id, i, j, k;
+
+    id = (*next_node)++;
+    fn = &tr->node[id];
+    fn->clust = NO_ID;
+    fn->y = fn->n = NO_ID;
+
+    if (IS_LEAF(node)) {
+	fn->clust = node->clust;
+
+	return id;
+    }
+
+    q = (comp_quest_t *)node->q;
+    fn->term = *next_term;
+    fn->n_term = q->sum_len;
+    *next_term += q->sum_len;
+
+    for (i = 0; i < q->sum_len; i++) {
+	uint32 *mask = tr->mask + (fn->term + i) * DTREE_N_CTXT * tr->n_word;
+
+	/* Any value of a context not asked about satisfies the term */
+	memset(mask, 0xff, DTREE_N_CTXT * tr->n_word * sizeof(uint32));
+
+	for (j = 0; j < q->prod_len[i]; j++) {
+	    quest_t *sq = &q->conj_q[i][j];
+	    uint32 *set, n_set;
+	    int c;
+
+	    if (sq->member) {
+		c = sq->ctxt + 1;
+		set = sq->member;
+		n_set = n_phone;
+		if (c < 0 || c >= DTREE_N_CTXT - 1)
+		    E_FATAL("Context %d question cannot be flattened\n",
+			    sq->ctxt);
+	    }
+	    else if (sq->posn) {
+		c = DTREE_N_CTXT - 1;
+		set = sq->posn;
+		n_set = N_WORD_POSN;
+	    }
+	    else {
+		E_FATAL("Ill-formed question\n");
+	    }
+
+	    for (k = 0; k < tr->n_bit; k++) {
+		int in = FALSE;
+
+		if (k < n_set)
+		    in = (sq->neg ? !set[k] : set[k]);
+		if (!in)
+		    mask[c * tr->n_word + k / 32] &= ~(1U << (k % 32));
+	    }
+	}
+    }
+
+    /* The yes subtree follows its parent */
+    fn->y = flatten_node(tr, node->y, n_phone, next_node, next_term);
+    fn->n = flatten_node(tr, node->n, n_phone, next_node, next_term);
+
+    return id;
+}
+
+dtree_flat_t *
+flatten_tree(dtree_node_t *node,
+	     uint32 n_phone)
+{
+    dtree_flat_t *tr;
+    uint32 n_node = 0, n_term = 0;
+
+    tr = ckd_calloc(1, sizeof(dtree_flat_t));
+    tr->n_node = cnt_node(node);
+    tr->node = ckd_calloc(tr->n_node, sizeof(dtree_flat_node_t));
+    tr->n_bit = (n_phone > N_WORD_POSN ? n_phone : N_WORD_POSN);
+    tr->n_word = (tr->n_bit + 31) / 32;
+    tr->mask = ckd_calloc(cnt_flat_term(node) * DTREE_N_CTXT * tr->n_word
+			  + 1, sizeof(uint32));
+
+    flatten_node(tr, node, n_phone, &n_node, &n_term);
+    assert(n_node == tr->n_node);
+
+    return tr;
+}
+
+uint32
+flat_tied_state(dtree_flat_t *tr,
+		acmod_id_t b,
+		acmod_id_t l,
+		acmod_id_t r,
+		word_posn_t wp)
+{
+    uint32 dfeat[DTREE_N_CTXT];
+    uint32 off[DTREE_N_CTXT], bit[DTREE_N_CTXT];
+    uint32 stride = DTREE_N_CTXT * tr->n_word;
+    dtree_flat_node_t *fn;
+    uint32 c, i;
+
+    dfeat[0] = (uint32)l;
+    dfeat[1] = (uint32)b;
+    dfeat[2] = (uint32)r;
+    dfeat[3] = (uint32)wp;
+
+    /* Values no question knows about satisfy none of them */
+    for (c = 0; c < DTREE_N_CTXT; c++) {
+	if (dfeat[c] < tr->n_bit) {
+	    off[c] = c * tr->n_word + dfeat[c] / 32;
+	    bit[c] = 1U << (dfeat[c] % 32);
+	}
+	else {
+	    off[c] = 0;
+	    bit[c] = 0;
+	}
+    }
+
+    fn = &tr->node[0];
+    while (fn->y != NO_ID) {
+	const uint32 *mask = tr->mask + fn->term * stride;
+
+	for (i = 0; i < fn->n_term; i++, mask += stride) {
+	    if ((mask[off[0]] & bit[0]) && (mask[off[1]] & bit[1])
+		&& (mask[off[2]] & bit[2]) && (mask[off[3]] & bit[3]))
+		break;
+	}
+
+	fn = &tr->node[i < fn->n_term ? fn->y : fn->n];
+    }
+
+    return fn->clust;
+}
+
+void
+free_flat_tree(dtree_flat_t *tr)
+{
+    ckd_free(tr->node);
+    ckd_free(tr->mask);
+    ckd_free(tr);
+}
+
 /*
  * A "twig" is a node where both children are leaves
  */
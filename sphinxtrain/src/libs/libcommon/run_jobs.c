@@ -0,0 +1,102 @@
+/* ====================================================================
+ * Copyright (c) 2026 Carnegie Mellon University.  All rights 
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/*********************************************************************
+ *
+ * File: run_jobs.c
+ * 
+ * Description: 
+ *	Run an array of independent jobs in threads.
+ * 
+ *********************************************************************/
+
+#include <s3/run_jobs.h>
+
+#include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <sphinxbase/sbthread.h>
+
+typedef struct {
+    void (*fn)(void *job);
+    void *job;
+} run_job_t;
+
+static int
+run_job_thread(sbthread_t *th)
+{
+    run_job_t *rj = (run_job_t *)sbthread_arg(th);
+
+    rj->fn(rj->job);
+
+    return 0;
+}
+
+void
+run_jobs(void (*fn)(void *job),
+	 void *jobs,
+	 size_t job_size,
+	 uint32 n_job)
+{
+    run_job_t *rj;
+    sbthread_t **th;
+    uint32 j;
+
+    if (n_job == 0)
+	return;
+
+    rj = (run_job_t *)ckd_calloc(n_job, sizeof(run_job_t));
+    th = (sbthread_t **)ckd_calloc(n_job, sizeof(sbthread_t *));
+    for (j = 0; j < n_job; j++) {
+	rj[j].fn = fn;
+	rj[j].job = (char *)jobs + j * job_size;
+    }
+    for (j = 1; j < n_job; j++) {
+	th[j] = sbthread_start(NULL, run_job_thread, &rj[j]);
+	if (th[j] == NULL) {
+	    E_WARN("Failed to start thread for job %u; running it here\n", j);
+	    fn(rj[j].job);
+	}
+    }
+    fn(rj[0].job);
+
+    for (j = 1; j < n_job; j++) {
+	if (th[j]) {
+	    sbthread_wait(th[j]);
+	    sbthread_free(th[j]);
+	}
+    }
+    ckd_free(th);
+    ckd_free(rj);
+}
@@ -427,6 +427,49 @@ state_seq_free(state_t *s,
 
     return S3_SUCCESS;
 }
+
+state_t *
+state_seq_copy(state_t *s,
+	       uint32 n)
+{
+    state_t *out;
+    uint32 i, total_next, total_prior;
+    uint32 *next_state, *prior_state;
+    float32 *next_tprob, *prior_tprob;
+
+    for (i = 0, total_next = total_prior = 0; i < n; i++) {
+	total_next += s[i].n_next;
+	total_prior += s[i].n_prior;
+    }
+
+    out = ckd_calloc(n, sizeof(state_t));
+    memcpy(out, s, n * sizeof(state_t));
+
+    /* Pack the adjacency lists into single blocks in state order, as
+     * state_seq_make() does, so that state_seq_free() can release them. */
+    next_state = ckd_calloc(total_next, sizeof(uint32));
+    next_tprob = ckd_calloc(total_next, sizeof(float32));
+    prior_state = ckd_calloc(total_prior, sizeof(uint32));
+    prior_tprob = ckd_calloc(total_prior, sizeof(float32));
+
+    for (i = 0; i < n; i++) {
+	memcpy(next_state, s[i].next_state, s[i].n_next * sizeof(uint32));
+	memcpy(next_tprob, s[i].next_tprob, s[i].n_next * sizeof(float32));
+	out[i].next_state = next_state;
+	out[i].next_tprob = next_tprob;
+	next_state += s[i].n_next;
+	next_tprob += s[i].n_next;
+
+	memcpy(prior_state, s[i].prior_state, s[i].n_prior * sizeof(uint32));
+	memcpy(prior_tprob, s[i].prior_tprob, s[i].n_prior * sizeof(float32));
+	out[i].prior_state = prior_state;
+	out[i].prior_tprob = prior_tprob;
+	prior_state += s[i].n_prior;
+	prior_tprob += s[i].n_prior;
+    }
+
+    return out;
+}
 
 state_t *
 state_seq_make(uint32 *n_state,
@@ -68,6 +68,7 @@
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/pio.h>
 #include <sphinxbase/case.h>
+#include <sphinxbase/sbthread.h>
 
 #include <sys_compat/file.h>
 #include <sys_compat/misc.h>
@@ -89,6 +90,9 @@
 static char *
 mk_filename(uint32 type, char *rel_path);
 
+static char *
+mk_filename_r(uint32 type, const char *rel_path, char *fn);
+
 static FILE *
 open_file_for_reading(uint32 type);
 
@@ -98,6 +102,12 @@ corpus_read_next_sent_file(char **trans);
 static int
 corpus_read_next_transcription_line(char **trans);
 
+static void
+prefetch_start(void);
+
+static void
+prefetch_stop(void);
+
 /*
  * Data folders
  */
@@ -195,6 +205,46 @@ static uint32 n_proc = 0;
 
 static uint32 begin;
 
+/* Data for one utterance, read ahead of time by the prefetch thread */
+typedef struct prefetch_utt_s {
+    char *path;		/* Control file path, NULL at the end of the run */
+    uint32 sf;		/* Start frame, or NO_FRAME */
+    uint32 ef;		/* End frame, or NO_FRAME */
+    char *utt_id;	/* Utterance id, or NULL */
+    int32 have_mfcc;	/* Whether coeff and n_c hold this utt's MFCC data */
+    int32 mfcc_ret;	/* What areadfloat() or areadfloat_part() returned */
+    float32 *coeff;
+    int32 n_c;
+    char *sent;		/* The transcript from a sent file, or NULL */
+} prefetch_utt_t;
+
+/* The number of utterances to read ahead, 0 to read synchronously */
+static uint32 prefetch_depth = 0;
+
+/* The MFCC vector length the prefetch thread reads frame ranges with */
+static uint32 prefetch_veclen;
+
+static sbthread_t *prefetch_thread = NULL;
+
+/* Guards the queue below and prefetch_quit */
+static sbmtx_t *prefetch_mtx = NULL;
+
+/* Signalled when the queue gains an utt, and when it loses one */
+static sbevent_t *prefetch_filled = NULL;
+static sbevent_t *prefetch_drained = NULL;
+
+/* A ring of prefetch_depth utts */
+static prefetch_utt_t *prefetch_queue = NULL;
+static uint32 prefetch_head;
+static uint32 prefetch_count;
+static int32 prefetch_quit;
+
+/* Serializes areadfloat_part(), which keeps its open file in statics */
+static sbmtx_t *prefetch_io_mtx = NULL;
+
+/* What was read ahead for the current utterance */
+static prefetch_utt_t cur_prefetch;
+
 int32
 corpus_provides_mfcc()
 {
@@ -419,6 +469,8 @@ int
 corpus_reset()
 {
     lineiter_t* li;
+
+    prefetch_stop();
     n_run = UNTIL_EOF;
 
     assert(ctl_fp);
@@ -443,6 +495,7 @@ corpus_reset()
 
 
     corpus_set_interval(sv_n_skip, sv_run_len);
+    prefetch_start();
 
     return S3_SUCCESS;
 }
@@ -992,6 +1045,238 @@ corpus_set_mllr_filename(const char *fn)
     return S3_SUCCESS;
 }
 
+/*********************************************************************
+ *
+ * Function: corpus_set_prefetch
+ * 
+ * Description: 
+ *    Read the MFCC data and sent file transcripts of up to n_utt
+ *    utterances ahead of the current one in a background thread, so
+ *    that waiting on the file system overlaps with using the data.
+ *    The thread is started by corpus_init().
+ * 
+ * Function Inputs: 
+ *    uint32 n_utt -
+ *	The number of utterances to read ahead.  0, the default,
+ *	reads each utterance when it is asked for.
+ *    uint32 veclen -
+ *	The MFCC vector length, used to read the frame ranges given
+ *	in the control file.  Utterances asked for with another
+ *	length are read again.
+ *
+ * Global Inputs: 
+ *    None
+ *
+ * Return Values: 
+ *    S3_SUCCESS - Currently the only return value.
+ *
+ * Global Outputs: 
+ *    None
+ * 
+ *********************************************************************/
+
+int
+corpus_set_prefetch(uint32 n_utt, uint32 veclen)
+{
+    prefetch_depth = n_utt;
+    prefetch_veclen = veclen;
+
+    return S3_SUCCESS;
+}
+
+static void
+prefetch_utt_free(prefetch_utt_t *u)
+{
+    free(u->path);
+    free(u->utt_id);
+    free(u->coeff);
+    free(u->sent);
+    memset(u, 0, sizeof(*u));
+}
+
+/* Read everything the application will ask for about an utt.
+ * Failures are left for the synchronous readers to retry and
+ * report. */
+static void
+prefetch_read(prefetch_utt_t *u)
+{
+    char fn[MAXPATHLEN];
+    FILE *fp;
+    lineiter_t *li;
+
+    if (requires_mfcc) {
+	mk_filename_r(DATA_TYPE_MFCC, u->path, fn);
+	if ((u->sf == NO_FRAME) && (u->ef == NO_FRAME)) {
+	    u->mfcc_ret = areadfloat(fn, &u->coeff, (int *)&u->n_c);
+	}
+	else if ((u->sf != NO_FRAME) && (u->ef != NO_FRAME)) {
+	    sbmtx_lock(prefetch_io_mtx);
+	    u->mfcc_ret = areadfloat_part(fn,
+					  u->sf * prefetch_veclen,
+					  (u->ef + 1) * prefetch_veclen - 1,
+					  &u->coeff, (int *)&u->n_c);
+	    sbmtx_unlock(prefetch_io_mtx);
+	}
+	else {
+	    u->mfcc_ret = S3_ERROR;
+	}
+	u->have_mfcc = (u->mfcc_ret != S3_ERROR);
+    }
+
+    if (requires_sent && (transcription_fp == NULL)) {
+	mk_filename_r(DATA_TYPE_SENT, u->path, fn);
+	if ((fp = fopen(fn, "r")) != NULL) {
+	    if ((li = lineiter_start_clean(fp)) != NULL) {
+		u->sent = strdup(li->buf);
+		lineiter_free(li);
+	    }
+	    fclose(fp);
+	}
+    }
+}
+
+/* Queue an utt, waiting for room.  Returns FALSE if the reader has
+ * stopped taking them. */
+static int
+prefetch_push(prefetch_utt_t *u)
+{
+    sbmtx_lock(prefetch_mtx);
+    while (prefetch_count == prefetch_depth && !prefetch_quit) {
+	sbmtx_unlock(prefetch_mtx);
+	sbevent_wait(prefetch_drained, -1, -1);
+	sbmtx_lock(prefetch_mtx);
+    }
+    if (prefetch_quit) {
+	sbmtx_unlock(prefetch_mtx);
+	return FALSE;
+    }
+    prefetch_queue[(prefetch_head + prefetch_count) % prefetch_depth] = *u;
+    ++prefetch_count;
+    sbmtx_unlock(prefetch_mtx);
+    sbevent_signal(prefetch_filled);
+
+    return TRUE;
+}
+
+static void
+prefetch_pop(prefetch_utt_t *u)
+{
+    sbmtx_lock(prefetch_mtx);
+    while (prefetch_count == 0) {
+	sbmtx_unlock(prefetch_mtx);
+	sbevent_wait(prefetch_filled, -1, -1);
+	sbmtx_lock(prefetch_mtx);
+    }
+    *u = prefetch_queue[prefetch_head];
+    prefetch_head = (prefetch_head + 1) % prefetch_depth;
+    --prefetch_count;
+    sbmtx_unlock(prefetch_mtx);
+    sbevent_signal(prefetch_drained);
+}
+
+/* While it runs, the prefetch thread owns the control file and the
+ * next_ctl_* variables.  It queues an utt with a NULL path once the
+ * run is over. */
+static int
+prefetch_main(sbthread_t *th)
+{
+    uint32 n_left = *(uint32 *)sbthread_arg(th);
+    prefetch_utt_t u;
+    lineiter_t *li;
+    int done;
+
+    do {
+	memset(&u, 0, sizeof(u));
+	done = (n_left == 0
+		|| next_ctl_path == NULL || strlen(next_ctl_path) == 0);
+	if (!done) {
+	    u.path = next_ctl_path;
+	    u.sf = next_ctl_sf;
+	    u.ef = next_ctl_ef;
+	    u.utt_id = next_ctl_utt_id;
+	    if (n_left != UNTIL_EOF)
+		--n_left;
+
+	    li = lineiter_start_clean(ctl_fp);
+	    if (li != NULL) {
+		parse_ctl_line(li->buf,
+			       &next_ctl_path,
+			       &next_ctl_sf,
+			       &next_ctl_ef,
+			       &next_ctl_utt_id);
+		lineiter_free(li);
+	    } else {
+		next_ctl_path = NULL;
+		next_ctl_sf = NO_FRAME;
+		next_ctl_ef = NO_FRAME;
+		next_ctl_utt_id = NULL;
+	    }
+
+	    prefetch_read(&u);
+	}
+	if (!prefetch_push(&u)) {
+	    prefetch_utt_free(&u);
+	    break;
+	}
+    } while (!done);
+
+    return 0;
+}
+
+static void
+prefetch_start(void)
+{
+    static uint32 n_left;
+
+    if (prefetch_depth == 0 || prefetch_thread != NULL)
+	return;
+
+    if (prefetch_queue == NULL) {
+	prefetch_queue = ckd_calloc(prefetch_depth, sizeof(*prefetch_queue));
+	prefetch_mtx = sbmtx_init();
+	prefetch_io_mtx = sbmtx_init();
+	prefetch_filled = sbevent_init();
+	prefetch_drained = sbevent_init();
+    }
+    prefetch_head = prefetch_count = 0;
+    prefetch_quit = FALSE;
+
+    n_left = n_run;
+    prefetch_thread = sbthread_start(NULL, prefetch_main, &n_left);
+    if (prefetch_thread == NULL) {
+	E_WARN("Failed to start the prefetch thread, reading utts as needed\n");
+    }
+    else {
+	E_INFO("Reading up to %u utts ahead\n", prefetch_depth);
+    }
+}
+
+static void
+prefetch_stop(void)
+{
+    if (prefetch_thread == NULL)
+	return;
+
+    sbmtx_lock(prefetch_mtx);
+    prefetch_quit = TRUE;
+    sbmtx_unlock(prefetch_mtx);
+    sbevent_signal(prefetch_drained);
+
+    sbthread_free(prefetch_thread);
+    prefetch_thread = NULL;
+
+    for (; prefetch_count > 0; --prefetch_count) {
+	prefetch_utt_free(&prefetch_queue[prefetch_head]);
+	prefetch_head = (prefetch_head + 1) % prefetch_depth;
+    }
+
+    /* Nothing more is read until corpus_reset() */
+    free(next_ctl_path);
+    free(next_ctl_utt_id);
+    next_ctl_path = NULL;
+    next_ctl_utt_id = NULL;
+}
+
 /*********************************************************************
  *
  * Function: corpus_init
@@ -1064,6 +1349,8 @@ corpus_init()
     else {
 	E_INFO("Will process %d utts starting at %d\n", n_run, begin);
     }
+
+    prefetch_start();
     
     return S3_SUCCESS;
 }
@@ -1076,16 +1363,38 @@ corpus_next_utt()
     if (cur_ctl_path) {
 	free(cur_ctl_path);
     }
-    cur_ctl_path = next_ctl_path;
-
     if (cur_ctl_utt_id) {
 	free(cur_ctl_utt_id);
 	cur_ctl_utt_id = NULL;
     }
-    cur_ctl_utt_id = next_ctl_utt_id;
-    
-    cur_ctl_sf = next_ctl_sf;
-    cur_ctl_ef = next_ctl_ef;
+    prefetch_utt_free(&cur_prefetch);
+
+    if (prefetch_thread) {
+	if (n_run == 0) {
+	    cur_ctl_path = NULL;
+	    prefetch_stop();
+	    return FALSE;
+	}
+
+	prefetch_pop(&cur_prefetch);
+	cur_ctl_path = cur_prefetch.path;
+	cur_ctl_utt_id = cur_prefetch.utt_id;
+	cur_ctl_sf = cur_prefetch.sf;
+	cur_ctl_ef = cur_prefetch.ef;
+	cur_prefetch.path = NULL;
+	cur_prefetch.utt_id = NULL;
+
+	if (cur_ctl_path == NULL) {
+	    prefetch_stop();
+	    return FALSE;
+	}
+    }
+    else {
+	cur_ctl_path = next_ctl_path;
+	cur_ctl_utt_id = next_ctl_utt_id;
+	cur_ctl_sf = next_ctl_sf;
+	cur_ctl_ef = next_ctl_ef;
+    }
 
     if (n_run != UNTIL_EOF) {
 	if (n_run == 0) return FALSE;
@@ -1114,6 +1423,10 @@ corpus_next_utt()
 	lineiter_free(trans_li);
     }  
 
+    /* The prefetch thread has already read ahead in the control file */
+    if (prefetch_thread)
+	return TRUE;
+
     li = lineiter_start_clean(ctl_fp);
 
     if (li != NULL) {
@@ -1194,9 +1507,16 @@ static char *
 mk_filename(uint32 type, char *rel_path)
 {
     static char fn[MAXPATHLEN];
+
+    return mk_filename_r(type, rel_path, fn);
+}
+
+static char *
+mk_filename_r(uint32 type, const char *rel_path, char *fn)
+{
     const char *r;
     const char *e;
-    char *tt;
+    const char *tt;
 
     r = data_dir[type];
     e = extension[type];
@@ -1266,6 +1586,13 @@ corpus_read_next_sent_file(char **trans)
     FILE *fp;
     lineiter_t *li;
 
+    if (cur_prefetch.sent) {
+	*trans = cur_prefetch.sent;
+	cur_prefetch.sent = NULL;
+
+	return S3_SUCCESS;
+    }
+
     /* open the current file */
     fp = open_file_for_reading(DATA_TYPE_SENT);
 
@@ -1309,16 +1636,31 @@ corpus_get_generic_featurevec(vector_t **mfc,
 	cptr = NULL;
     }
 
-    do {
+    if (cur_prefetch.have_mfcc
+	&& ((cur_ctl_sf == NO_FRAME) || (veclen == prefetch_veclen))) {
+	/* The prefetch thread has read it already */
+	ret = cur_prefetch.mfcc_ret;
+	n_c = cur_prefetch.n_c;
+	if (mfc) {
+	    coeff = cur_prefetch.coeff;
+	    cur_prefetch.coeff = NULL;
+	    cur_prefetch.have_mfcc = FALSE;
+	}
+    }
+    else do {
 	if ((cur_ctl_sf == NO_FRAME) && (cur_ctl_ef == NO_FRAME)) {
 	    ret = areadfloat(mk_filename(DATA_TYPE_MFCC, cur_ctl_path),
 			     cptr, (int *)&n_c);
 	}
 	else if ((cur_ctl_sf != NO_FRAME) && (cur_ctl_ef != NO_FRAME)) {
+	    if (prefetch_io_mtx)
+		sbmtx_lock(prefetch_io_mtx);
 	    ret = areadfloat_part(mk_filename(DATA_TYPE_MFCC, cur_ctl_path),
 				  cur_ctl_sf * veclen,
 				  (cur_ctl_ef + 1) * veclen - 1,
 				  cptr, (int *)&n_c);
+	    if (prefetch_io_mtx)
+		sbmtx_unlock(prefetch_io_mtx);
 	}
 	else {
 	    E_FATAL("Both start and end frame must be set in the ctl file\n");
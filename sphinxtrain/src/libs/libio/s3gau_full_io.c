@@ -195,6 +195,101 @@ s3gau_read_full(const char *fn,
                                  out_n_density, out_veclen, TRUE);
 }
 
+/* Point full covariance matrices at raw, laid out as in
+ * s3gau_write_full(), with the pointer array owned by m. */
+static vector_t ****
+s3gau_map_fullvar(s3mmap_t *m,
+		  float32 *raw,
+		  uint32 n_mgau,
+		  uint32 n_feat,
+		  uint32 n_density,
+		  const uint32 *veclen)
+{
+    uint32 maxveclen, i, j, k, l, r;
+    vector_t ****o;
+
+    for (i = 0, maxveclen = 0; i < n_feat; i++) {
+	if (veclen[i] > maxveclen) maxveclen = veclen[i];
+    }
+
+    o = (vector_t ****)ckd_calloc_4d(n_mgau, n_feat, n_density,
+				     maxveclen, sizeof(vector_t));
+    s3mmap_own_4d(m, (void ****)o);
+
+    for (i = 0, r = 0; i < n_mgau; i++) {
+	for (j = 0; j < n_feat; j++) {
+	    for (k = 0; k < n_density; k++) {
+		for (l = 0; l < veclen[j]; l++) {
+		    o[i][j][k][l] = &raw[r];
+
+		    r += veclen[j];
+		}
+	    }
+	}
+    }
+
+    return o;
+}
+
+int
+s3gau_map_full(const char *fn,
+	       s3mmap_t **out_map,
+	       vector_t *****out,
+	       uint32 *out_n_mgau,
+	       uint32 *out_n_feat,
+	       uint32 *out_n_density,
+	       uint32 **out_veclen)
+{
+    s3mmap_t *m;
+    const char *ver;
+    uint32 *hdr, *veclen;
+    uint32 blk, i, n;
+    float32 *raw;
+
+    if ((m = s3mmap_open(fn)) == NULL)
+	return S3_ERROR;
+
+    ver = s3get_gvn_fattr("version");
+    if (ver == NULL || strcmp(ver, GAU_FILE_VERSION) != 0) {
+	E_ERROR("Version mismatch for %s, file ver: %s != reader ver: %s\n",
+		fn, ver ? ver : "(none)", GAU_FILE_VERSION);
+	goto error;
+    }
+
+    /* n_mgau, n_feat, n_density */
+    if ((hdr = s3mmap_read(m, 3 * sizeof(uint32))) == NULL)
+	goto error;
+    if ((veclen = s3mmap_read(m, hdr[1] * sizeof(uint32))) == NULL)
+	goto error;
+    if (s3mmap_read_1d(m, (void **)&raw, sizeof(float32), &n) != S3_SUCCESS)
+	goto error;
+
+    for (i = 0, blk = 0; i < hdr[1]; i++) {
+	blk += veclen[i] * veclen[i];
+    }
+    if (n != hdr[0] * hdr[2] * blk) {
+	E_ERROR("Failed to map full covariance file %s (expected %d values, got %d)\n",
+		fn, hdr[0] * hdr[2] * blk, n);
+	goto error;
+    }
+
+    *out_map = m;
+    *out = s3gau_map_fullvar(m, raw, hdr[0], hdr[1], hdr[2], veclen);
+    *out_n_mgau = hdr[0];
+    *out_n_feat = hdr[1];
+    *out_n_density = hdr[2];
+    *out_veclen = veclen;
+
+    E_INFO("Mapped %s [%ux%ux%u array of full matrices]\n",
+	   fn, hdr[0], hdr[1], hdr[2]);
+
+    return S3_SUCCESS;
+
+error:
+    s3mmap_close(m);
+    return S3_ERROR;
+}
+
 int
 s3gau_write_full(const char *fn,
 		 const vector_t ****out,
@@ -420,6 +515,114 @@ s3gaucnt_read_full(const char *fn,
     return S3_SUCCESS;
 }
 
+int
+s3gaucnt_map_full(const char *fn,
+		  s3mmap_t **out_map,
+		  vector_t ****out_wt_mean,
+		  vector_t *****out_wt_var,
+		  int32 *out_pass2var,
+		  float32 ****out_dnom,
+		  uint32 *out_n_cb,
+		  uint32 *out_n_feat,
+		  uint32 *out_n_density,
+		  uint32 **out_veclen)
+{
+    s3mmap_t *m;
+    const char *ver;
+    uint32 *hdr, *veclen;
+    uint32 n_feat, blk, n, i, j, k, r, d1, d2, d3;
+    float32 *raw;
+    float32 ***dnom;
+    vector_t ***wt_mean = NULL;
+    vector_t ****wt_var = NULL;
+
+    if ((m = s3mmap_open(fn)) == NULL)
+	return S3_ERROR;
+
+    ver = s3get_gvn_fattr("version");
+    if (ver == NULL || strcmp(ver, GAUCNT_FILE_VERSION) != 0) {
+	E_ERROR("Version mismatch for %s, file ver: %s != reader ver: %s\n",
+		fn, ver ? ver : "(none)", GAUCNT_FILE_VERSION);
+	goto error;
+    }
+
+    /* has_means, has_vars, pass2var, n_cb, n_density */
+    if ((hdr = s3mmap_read(m, 5 * sizeof(uint32))) == NULL)
+	goto error;
+    if (s3mmap_read_1d(m, (void **)&veclen, sizeof(uint32), &n_feat) != S3_SUCCESS)
+	goto error;
+    for (i = 0, blk = 0; i < n_feat; i++) {
+	blk += veclen[i];
+    }
+
+    if (hdr[0]) {
+	if (s3mmap_read_1d(m, (void **)&raw, sizeof(float32), &n) != S3_SUCCESS)
+	    goto error;
+	if (n != hdr[3] * hdr[4] * blk) {
+	    E_ERROR("Failed to map counts file %s (expected %d means, got %d)\n",
+		    fn, hdr[3] * hdr[4] * blk, n);
+	    goto error;
+	}
+
+	wt_mean = (vector_t ***)ckd_calloc_3d(hdr[3], n_feat, hdr[4],
+					      sizeof(vector_t));
+	s3mmap_own_3d(m, (void ***)wt_mean);
+
+	for (i = 0, r = 0; i < hdr[3]; i++) {
+	    for (j = 0; j < n_feat; j++) {
+		for (k = 0; k < hdr[4]; k++) {
+		    wt_mean[i][j][k] = &raw[r];
+
+		    r += veclen[j];
+		}
+	    }
+	}
+    }
+
+    if (hdr[1]) {
+	if (s3mmap_read_1d(m, (void **)&raw, sizeof(float32), &n) != S3_SUCCESS)
+	    goto error;
+	if (n != hdr[3] * hdr[4] * blk * blk) {
+	    E_ERROR("Failed to map counts file %s (expected %d variances, got %d)\n",
+		    fn, hdr[3] * hdr[4] * blk * blk, n);
+	    goto error;
+	}
+	wt_var = s3gau_map_fullvar(m, raw, hdr[3], n_feat, hdr[4], veclen);
+    }
+
+    if (s3mmap_read_3d(m, (void ****)&dnom, sizeof(float32),
+		       &d1, &d2, &d3) != S3_SUCCESS)
+	goto error;
+    if (d1 != hdr[3] || d2 != n_feat || d3 != hdr[4]) {
+	E_ERROR("Density counts in %s are %ux%ux%u, expected %ux%ux%u\n",
+		fn, d1, d2, d3, hdr[3], n_feat, hdr[4]);
+	goto error;
+    }
+
+    *out_map = m;
+    *out_wt_mean = wt_mean;
+    *out_wt_var = wt_var;
+    *out_pass2var = hdr[2];
+    *out_dnom = dnom;
+    *out_n_cb = hdr[3];
+    *out_n_feat = n_feat;
+    *out_n_density = hdr[4];
+    *out_veclen = veclen;
+
+    E_INFO("Mapped %s%s%s%s [%ux%ux%u vector arrays]\n",
+	   fn,
+	   (wt_mean ? " with means" : ""),
+	   (wt_var ? " with full vars" : ""),
+	   (wt_var && hdr[2] ? " (2pass)" : ""),
+	   hdr[3], n_feat, hdr[4]);
+
+    return S3_SUCCESS;
+
+error:
+    s3mmap_close(m);
+    return S3_ERROR;
+}
+
 int
 s3gaucnt_write_full(const char *fn,
 		    vector_t ***wt_mean,
@@ -176,6 +176,80 @@ error:
     return S3_ERROR;
 }
 
+int
+s3gau_map(const char *fn,
+	  s3mmap_t **out_map,
+	  vector_t ****out,
+	  uint32 *out_n_mgau,
+	  uint32 *out_n_feat,
+	  uint32 *out_n_density,
+	  uint32 **out_veclen)
+{
+    s3mmap_t *m;
+    const char *ver;
+    uint32 *hdr, *veclen;
+    uint32 blk, i, j, k, r, n;
+    float32 *raw;
+    vector_t ***o;
+
+    if ((m = s3mmap_open(fn)) == NULL)
+	return S3_ERROR;
+
+    ver = s3get_gvn_fattr("version");
+    if (ver == NULL || strcmp(ver, GAU_FILE_VERSION) != 0) {
+	E_ERROR("Version mismatch for %s, file ver: %s != reader ver: %s\n",
+		fn, ver ? ver : "(none)", GAU_FILE_VERSION);
+	goto error;
+    }
+
+    /* n_mgau, n_feat, n_density */
+    if ((hdr = s3mmap_read(m, 3 * sizeof(uint32))) == NULL)
+	goto error;
+    if ((veclen = s3mmap_read(m, hdr[1] * sizeof(uint32))) == NULL)
+	goto error;
+    if (s3mmap_read_1d(m, (void **)&raw, sizeof(float32), &n) != S3_SUCCESS)
+	goto error;
+
+    for (i = 0, blk = 0; i < hdr[1]; i++) {
+	blk += veclen[i];
+    }
+    if (n != hdr[0] * hdr[2] * blk) {
+	E_ERROR("Failed to map parameter file %s (expected %d values, got %d)\n",
+		fn, hdr[0] * hdr[2] * blk, n);
+	goto error;
+    }
+
+    o = (vector_t ***)ckd_calloc_3d(hdr[0], hdr[1], hdr[2],
+				    sizeof(vector_t));
+    s3mmap_own_3d(m, (void ***)o);
+
+    for (i = 0, r = 0; i < hdr[0]; i++) {
+	for (j = 0; j < hdr[1]; j++) {
+	    for (k = 0; k < hdr[2]; k++) {
+		o[i][j][k] = &raw[r];
+
+		r += veclen[j];
+	    }
+	}
+    }
+
+    *out_map = m;
+    *out = o;
+    *out_n_mgau = hdr[0];
+    *out_n_feat = hdr[1];
+    *out_n_density = hdr[2];
+    *out_veclen = veclen;
+
+    E_INFO("Mapped %s [%ux%ux%u array]\n",
+	   fn, hdr[0], hdr[1], hdr[2]);
+
+    return S3_SUCCESS;
+
+error:
+    s3mmap_close(m);
+    return S3_ERROR;
+}
+
 int
 s3gau_write(const char *fn,
 	    const vector_t ***out,
@@ -388,6 +462,124 @@ s3gaucnt_read(const char *fn,
     return S3_SUCCESS;
 }
 
+/* Map an array of n_cb x n_feat x n_density vectors, as written by
+ * s3gaucnt_write(). */
+static vector_t ***
+s3gaucnt_map_param(s3mmap_t *m,
+		   const char *fn,
+		   uint32 n_cb,
+		   uint32 n_feat,
+		   uint32 n_density,
+		   const uint32 *veclen)
+{
+    uint32 blk, i, j, k, r, n;
+    float32 *raw;
+    vector_t ***o;
+
+    for (i = 0, blk = 0; i < n_feat; i++) {
+	blk += veclen[i];
+    }
+    if (s3mmap_read_1d(m, (void **)&raw, sizeof(float32), &n) != S3_SUCCESS)
+	return NULL;
+    if (n != n_cb * n_density * blk) {
+	E_ERROR("Failed to map counts file %s (expected %d values, got %d)\n",
+		fn, n_cb * n_density * blk, n);
+	return NULL;
+    }
+
+    o = (vector_t ***)ckd_calloc_3d(n_cb, n_feat, n_density,
+				    sizeof(vector_t));
+    s3mmap_own_3d(m, (void ***)o);
+
+    for (i = 0, r = 0; i < n_cb; i++) {
+	for (j = 0; j < n_feat; j++) {
+	    for (k = 0; k < n_density; k++) {
+		o[i][j][k] = &raw[r];
+
+		r += veclen[j];
+	    }
+	}
+    }
+
+    return o;
+}
+
+int
+s3gaucnt_map(const char *fn,
+	     s3mmap_t **out_map,
+	     vector_t ****out_wt_mean,
+	     vector_t ****out_wt_var,
+	     int32 *out_pass2var,
+	     float32 ****out_dnom,
+	     uint32 *out_n_cb,
+	     uint32 *out_n_feat,
+	     uint32 *out_n_density,
+	     uint32 **out_veclen)
+{
+    s3mmap_t *m;
+    const char *ver;
+    uint32 *hdr, *veclen;
+    uint32 n_feat, d1, d2, d3;
+    float32 ***dnom;
+    vector_t ***wt_mean = NULL;
+    vector_t ***wt_var = NULL;
+
+    if ((m = s3mmap_open(fn)) == NULL)
+	return S3_ERROR;
+
+    ver = s3get_gvn_fattr("version");
+    if (ver == NULL || strcmp(ver, GAUCNT_FILE_VERSION) != 0) {
+	E_ERROR("Version mismatch for %s, file ver: %s != reader ver: %s\n",
+		fn, ver ? ver : "(none)", GAUCNT_FILE_VERSION);
+	goto error;
+    }
+
+    /* has_means, has_vars, pass2var, n_cb, n_density */
+    if ((hdr = s3mmap_read(m, 5 * sizeof(uint32))) == NULL)
+	goto error;
+    if (s3mmap_read_1d(m, (void **)&veclen, sizeof(uint32), &n_feat) != S3_SUCCESS)
+	goto error;
+
+    if (hdr[0] && (wt_mean = s3gaucnt_map_param(m, fn, hdr[3], n_feat,
+						hdr[4], veclen)) == NULL)
+	goto error;
+    if (hdr[1] && (wt_var = s3gaucnt_map_param(m, fn, hdr[3], n_feat,
+					       hdr[4], veclen)) == NULL)
+	goto error;
+
+    if (s3mmap_read_3d(m, (void ****)&dnom, sizeof(float32),
+		       &d1, &d2, &d3) != S3_SUCCESS)
+	goto error;
+    if (d1 != hdr[3] || d2 != n_feat || d3 != hdr[4]) {
+	E_ERROR("Density counts in %s are %ux%ux%u, expected %ux%ux%u\n",
+		fn, d1, d2, d3, hdr[3], n_feat, hdr[4]);
+	goto error;
+    }
+
+    *out_map = m;
+    *out_wt_mean = wt_mean;
+    *out_wt_var = wt_var;
+    *out_pass2var = hdr[2];
+    *out_dnom = dnom;
+    *out_n_cb = hdr[3];
+    *out_n_feat = n_feat;
+    *out_n_density = hdr[4];
+    *out_veclen = veclen;
+
+    E_INFO("Mapped %s%s%s%s [%ux%ux%u vector arrays]\n",
+	   fn,
+	   (wt_mean ? " with means" : ""),
+	   (wt_var ? " with vars" : ""),
+	   (wt_var && hdr[2] ? " (2pass)" : ""),
+	   hdr[3], n_feat, hdr[4]);
+
+    return S3_SUCCESS;
+
+error:
+    s3mmap_close(m);
+    return S3_ERROR;
+}
+
 int
 s3gaucnt_write(const char *fn,
 	       vector_t ***wt_mean,
@@ -598,3 +790,159 @@ s3gaudnom_write(const char *fn,
 
     return S3_SUCCESS;
 }
+
+struct s3gau_wr_s {
+    FILE *fp;
+    char *fn;
+    uint32 chksum;
+    uint32 n_cb;	/* codebooks in the file */
+    uint32 n_done;	/* codebooks written so far */
+    uint32 cb_size;	/* values per codebook */
+    uint32 n_feat;
+    uint32 n_density;
+    int32 full;		/* of full covariance matrices */
+};
+
+/* Write the part of the header common to all the files and the size
+ * of their one array of values. */
+static s3gau_wr_t *
+s3gau_wr_open(const char *fn,
+	      const char *version,
+	      uint32 n_cb,
+	      uint32 n_feat,
+	      uint32 n_density,
+	      uint32 cb_size)
+{
+    s3gau_wr_t *wr;
+
+    s3clr_fattr();
+    s3add_fattr("version", (char *)version, TRUE);
+    s3add_fattr("chksum0", "yes", TRUE);
+
+    wr = ckd_calloc(1, sizeof(*wr));
+    if ((wr->fp = s3open(fn, "wb", NULL)) == NULL) {
+	ckd_free(wr);
+	return NULL;
+    }
+    wr->fn = ckd_salloc(fn);
+    wr->n_cb = n_cb;
+    wr->cb_size = cb_size;
+    wr->n_feat = n_feat;
+    wr->n_density = n_density;
+
+    return wr;
+}
+
+s3gau_wr_t *
+s3gau_write_open(const char *fn,
+		 uint32 n_mgau,
+		 uint32 n_feat,
+		 uint32 n_density,
+		 const uint32 *veclen,
+		 int32 full)
+{
+    s3gau_wr_t *wr;
+    uint32 blk, n, i;
+
+    for (blk = 0, i = 0; i < n_feat; i++)
+	blk += full ? veclen[i] * veclen[i] : veclen[i];
+
+    wr = s3gau_wr_open(fn, GAU_FILE_VERSION,
+		       n_mgau, n_feat, n_density, n_density * blk);
+    if (wr == NULL)
+	return NULL;
+    wr->full = full;
+
+    n = n_mgau * n_density * blk;
+    if (bio_fwrite(&n_mgau, sizeof(uint32), 1, wr->fp, 0, &wr->chksum) != 1
+	|| bio_fwrite(&n_feat, sizeof(uint32), 1, wr->fp, 0, &wr->chksum) != 1
+	|| bio_fwrite(&n_density, sizeof(uint32), 1, wr->fp, 0, &wr->chksum) != 1
+	|| bio_fwrite(veclen, sizeof(uint32), n_feat, wr->fp, 0, &wr->chksum) != n_feat
+	|| bio_fwrite(&n, sizeof(uint32), 1, wr->fp, 0, &wr->chksum) != 1) {
+	E_ERROR_SYSTEM("Unable to write %s", fn);
+	s3gau_write_close(wr);
+	return NULL;
+    }
+
+    return wr;
+}
+
+s3gau_wr_t *
+s3gaudnom_write_open(const char *fn,
+		     uint32 n_cb,
+		     uint32 n_feat,
+		     uint32 n_density)
+{
+    s3gau_wr_t *wr;
+    uint32 n;
+
+    wr = s3gau_wr_open(fn, GAUDNOM_FILE_VERSION,
+		       n_cb, n_feat, n_density, n_feat * n_density);
+    if (wr == NULL)
+	return NULL;
+
+    /* As bio_fwrite_3d() would */
+    n = n_cb * n_feat * n_density;
+    if (bio_fwrite(&n_cb, sizeof(uint32), 1, wr->fp, 0, &wr->chksum) != 1
+	|| bio_fwrite(&n_feat, sizeof(uint32), 1, wr->fp, 0, &wr->chksum) != 1
+	|| bio_fwrite(&n_density, sizeof(uint32), 1, wr->fp, 0, &wr->chksum) != 1
+	|| bio_fwrite(&n, sizeof(uint32), 1, wr->fp, 0, &wr->chksum) != 1) {
+	E_ERROR_SYSTEM("Unable to write %s", fn);
+	s3gau_write_close(wr);
+	return NULL;
+    }
+
+    return wr;
+}
+
+int
+s3gau_write_cb(s3gau_wr_t *wr,
+	       const float32 *cb)
+{
+    if (wr->n_done == wr->n_cb) {
+	E_ERROR("All %u codebooks of %s are already written\n",
+		wr->n_cb, wr->fn);
+	return S3_ERROR;
+    }
+    if (bio_fwrite(cb, sizeof(float32), wr->cb_size,
+		   wr->fp, 0, &wr->chksum) != wr->cb_size) {
+	E_ERROR_SYSTEM("Unable to write %s", wr->fn);
+	return S3_ERROR;
+    }
+    ++wr->n_done;
+
+    return S3_SUCCESS;
+}
+
+int
+s3gau_write_close(s3gau_wr_t *wr)
+{
+    uint32 ignore = 0;
+    int rv = S3_SUCCESS;
+
+    if (wr == NULL)
+	return S3_ERROR;
+
+    if (wr->n_done != wr->n_cb) {
+	E_ERROR("Only %u of %u codebooks of %s were written\n",
+		wr->n_done, wr->n_cb, wr->fn);
+	rv = S3_ERROR;
+    }
+    else if (bio_fwrite(&wr->chksum, sizeof(uint32), 1,
+			wr->fp, 0, &ignore) != 1) {
+	E_ERROR_SYSTEM("Unable to write %s", wr->fn);
+	rv = S3_ERROR;
+    }
+    if (s3close(wr->fp) != 0)
+	rv = S3_ERROR;
+
+    if (rv == S3_SUCCESS)
+	E_INFO("Wrote %s [%ux%ux%u array%s]\n",
+	       wr->fn, wr->n_cb, wr->n_feat, wr->n_density,
+	       wr->full ? " of full matrices" : "");
+
+    ckd_free(wr->fn);
+    ckd_free(wr);
+
+    return rv;
+}
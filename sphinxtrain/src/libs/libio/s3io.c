@@ -51,6 +51,8 @@
 
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/bio.h>
+#include <sphinxbase/mmio.h>
+#include <sphinxbase/glist.h>
 
 #include <stdio.h>
 #include <string.h>
@@ -312,6 +314,218 @@ error_loc:
     return NULL;
 }
 
+struct s3mmap_s {
+    mmio_file_t *mf;
+    char *base;		/* start of the file */
+    size_t size;	/* size of the file in bytes */
+    size_t pos;		/* read cursor, in bytes from base */
+    glist_t ptr3d;	/* from ckd_alloc_3d_ptr(), freed with ckd_free_3d_ptr() */
+    glist_t arr3d;	/* from ckd_calloc_3d(), freed with ckd_free_3d() */
+    glist_t arr4d;	/* from ckd_calloc_4d(), freed with ckd_free_4d() */
+};
+
+s3mmap_t *
+s3mmap_open(const char *file_name)
+{
+    s3mmap_t *m;
+    FILE *fp;
+    uint32 swap;
+    long pos, size;
+
+    /* Parse the header as usual, which leaves its attributes set. */
+    if ((fp = s3open(file_name, "rb", &swap)) == NULL)
+	return NULL;
+    pos = ftell(fp);
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fclose(fp);
+
+    if (swap) {
+	E_INFO("%s is byte-swapped and cannot be mapped; see swap_parm\n",
+	       file_name);
+	return NULL;
+    }
+    if (pos & 3) {
+	E_ERROR("Data in %s is not aligned\n", file_name);
+	return NULL;
+    }
+
+    m = ckd_calloc(1, sizeof(*m));
+    if ((m->mf = mmio_file_read(file_name)) == NULL) {
+	E_ERROR("Failed to map %s\n", file_name);
+	ckd_free(m);
+	return NULL;
+    }
+    m->base = mmio_file_ptr(m->mf);
+    m->size = size;
+    m->pos = pos;
+
+    return m;
+}
+
+void *
+s3mmap_read(s3mmap_t *m,
+	    size_t n_byte)
+{
+    void *ptr;
+
+    if (n_byte > m->size - m->pos) {
+	E_ERROR("Unexpected end of mapped file\n");
+	return NULL;
+    }
+    ptr = m->base + m->pos;
+    m->pos += (n_byte + 3) & ~3;
+
+    return ptr;
+}
+
+int32
+s3mmap_read_1d(s3mmap_t *m,
+	       void **arr,
+	       size_t e_sz,
+	       uint32 *d1)
+{
+    uint32 *n;
+
+    if ((n = s3mmap_read(m, sizeof(uint32))) == NULL)
+	return S3_ERROR;
+    if ((*arr = s3mmap_read(m, (size_t)*n * e_sz)) == NULL)
+	return S3_ERROR;
+    *d1 = *n;
+
+    return S3_SUCCESS;
+}
+
+int32
+s3mmap_read_3d(s3mmap_t *m,
+	       void ****arr,
+	       size_t e_sz,
+	       uint32 *d1,
+	       uint32 *d2,
+	       uint32 *d3)
+{
+    uint32 *dim, n;
+    void *raw;
+
+    if ((dim = s3mmap_read(m, 3 * sizeof(uint32))) == NULL)
+	return S3_ERROR;
+    if (s3mmap_read_1d(m, &raw, e_sz, &n) != S3_SUCCESS)
+	return S3_ERROR;
+    if (n != dim[0] * dim[1] * dim[2]) {
+	E_ERROR("Expected %u values in mapped array, but found %u\n",
+		dim[0] * dim[1] * dim[2], n);
+	return S3_ERROR;
+    }
+
+    *arr = ckd_alloc_3d_ptr(dim[0], dim[1], dim[2], raw, e_sz);
+    m->ptr3d = glist_add_ptr(m->ptr3d, *arr);
+    *d1 = dim[0];
+    *d2 = dim[1];
+    *d3 = dim[2];
+
+    return S3_SUCCESS;
+}
+
+void
+s3mmap_own_3d(s3mmap_t *m,
+	      void ***arr)
+{
+    m->arr3d = glist_add_ptr(m->arr3d, arr);
+}
+
+void
+s3mmap_own_4d(s3mmap_t *m,
+	      void ****arr)
+{
+    m->arr4d = glist_add_ptr(m->arr4d, arr);
+}
+
+void
+s3mmap_close(s3mmap_t *m)
+{
+    gnode_t *gn;
+
+    if (m == NULL)
+	return;
+    for (gn = m->ptr3d; gn; gn = gnode_next(gn))
+	ckd_free_3d_ptr(gnode_ptr(gn));
+    glist_free(m->ptr3d);
+    for (gn = m->arr3d; gn; gn = gnode_next(gn))
+	ckd_free_3d(gnode_ptr(gn));
+    glist_free(m->arr3d);
+    for (gn = m->arr4d; gn; gn = gnode_next(gn))
+	ckd_free_4d(gnode_ptr(gn));
+    glist_free(m->arr4d);
+    mmio_file_unmap(m->mf);
+    ckd_free(m);
+    s3clr_fattr();
+}
+
+int32
+s3swap_file(const char *file_name)
+{
+    FILE *fp;
+    uint32 swap, magic, buf[4096];
+    long stamp, pos;
+    size_t n, i;
+
+    if ((fp = s3open(file_name, "rb", &swap)) == NULL)
+	return S3_ERROR;
+    pos = ftell(fp);
+    fclose(fp);
+    s3clr_fattr();
+
+    if (!swap) {
+	E_INFO("%s is already in native byte order\n", file_name);
+	return S3_SUCCESS;
+    }
+
+    if ((fp = fopen(file_name, "r+b")) == NULL) {
+	E_ERROR_SYSTEM("Unable to open %s for update", file_name);
+	return S3_ERROR;
+    }
+
+    /* Everything after the header is 32-bit words, so swapping each of
+     * them, byte order stamp included, converts the whole file. */
+    stamp = pos - sizeof(uint32);
+    if (fseek(fp, stamp, SEEK_SET) < 0)
+	goto error_loc;
+    pos = stamp;
+    while ((n = fread(buf, sizeof(uint32), 4096, fp)) > 0) {
+	for (i = 0; i < n; i++)
+	    SWAP_INT32(&buf[i]);
+	if (fseek(fp, pos, SEEK_SET) < 0
+	    || fwrite(buf, sizeof(uint32), n, fp) != n)
+	    goto error_loc;
+	pos += n * sizeof(uint32);
+	/* Required between a write and a read on the same stream. */
+	if (fseek(fp, pos, SEEK_SET) < 0)
+	    goto error_loc;
+    }
+    if (ferror(fp) || fgetc(fp) != EOF) {
+	E_ERROR("%s does not end on a 32-bit word boundary\n", file_name);
+	goto error_loc;
+    }
+
+    if (fseek(fp, stamp, SEEK_SET) < 0
+	|| fread(&magic, sizeof(uint32), 1, fp) != 1
+	|| magic != BYTE_ORDER_MAGIC) {
+	E_ERROR("Byte order stamp of %s was not converted\n", file_name);
+	goto error_loc;
+    }
+
+    fclose(fp);
+    E_INFO("Converted %s to native byte order\n", file_name);
+
+    return S3_SUCCESS;
+
+error_loc:
+    E_ERROR_SYSTEM("Failed to convert %s", file_name);
+    fclose(fp);
+
+    return S3_ERROR;
+}
+
 int
 bio_fread_intv_3d(void ****arr,
 	       size_t e_sz,
@@ -119,6 +119,43 @@ s3mixw_read(const char *fn,
     return S3_SUCCESS;
 }
 
+int
+s3mixw_map(const char *fn,
+	   s3mmap_t **out_map,
+	   float32 ****out_mixw,
+	   uint32 *out_n_mixw,
+	   uint32 *out_n_feat,
+	   uint32 *out_n_density)
+{
+    s3mmap_t *m;
+    char *ver;
+
+    if ((m = s3mmap_open(fn)) == NULL)
+	return S3_ERROR;
+
+    ver = s3get_gvn_fattr("version");
+    if (ver == NULL || strcmp(ver, MIXW_FILE_VERSION) != 0) {
+	E_ERROR("Version mismatch for %s, file ver: %s != reader ver: %s\n",
+		fn, ver ? ver : "(none)", MIXW_FILE_VERSION);
+	goto error;
+    }
+
+    if (s3mmap_read_3d(m, (void ****)out_mixw, sizeof(float32),
+		       out_n_mixw, out_n_feat, out_n_density) != S3_SUCCESS)
+	goto error;
+
+    *out_map = m;
+
+    E_INFO("Mapped %s [%ux%ux%u array]\n",
+	   fn, *out_n_mixw, *out_n_feat, *out_n_density);
+
+    return S3_SUCCESS;
+
+error:
+    s3mmap_close(m);
+    return S3_ERROR;
+}
+
 int
 s3mixw_intv_read(const char *fn,
 		 uint32  mixw_s,
@@ -120,6 +120,43 @@ s3tmat_read(const char *fn,
     return S3_SUCCESS;
 }
 
+int
+s3tmat_map(const char *fn,
+	   s3mmap_t **out_map,
+	   float32 ****out_tmat,
+	   uint32 *out_n_tmat,
+	   uint32 *out_n_state)
+{
+    s3mmap_t *m;
+    uint32 tmp;
+    char *ver;
+
+    if ((m = s3mmap_open(fn)) == NULL)
+	return S3_ERROR;
+
+    ver = s3get_gvn_fattr("version");
+    if (ver == NULL || strcmp(ver, TMAT_FILE_VERSION) != 0) {
+	E_ERROR("Version mismatch for %s, file ver: %s != reader ver: %s\n",
+		fn, ver ? ver : "(none)", TMAT_FILE_VERSION);
+	goto error;
+    }
+
+    if (s3mmap_read_3d(m, (void ****)out_tmat, sizeof(float32),
+		       out_n_tmat, &tmp, out_n_state) != S3_SUCCESS)
+	goto error;
+
+    *out_map = m;
+
+    E_INFO("Mapped %s [%ux%ux%u array]\n",
+	   fn, *out_n_tmat, tmp, *out_n_state);
+
+    return S3_SUCCESS;
+
+error:
+    s3mmap_close(m);
+    return S3_ERROR;
+}
+
 int
 s3tmat_write(const char *fn,
 	     float32 ***tmat,
@@ -49,6 +49,7 @@
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/cmd_ln.h>
 #include <sphinxbase/err.h>
+#include <sphinxbase/mmio.h>
 
 #include <s3/segdmp.h>
 #include <s3/s3io.h>
@@ -85,6 +86,12 @@ static FILE **dmp_fp = NULL;
 static uint32 *dmp_swp = NULL;
 static FILE **idx_fp = NULL;
 
+/* read: names of the dump parts, and their mappings if they are
+ * mapped for segdmp_id_frames() */
+static char **dmp_part_fn = NULL;
+static mmio_file_t **dmp_mm = NULL;
+static int use_mmap = FALSE;
+
 static const uint32 *vecsize;
 static uint32 n_stream;
 static uint32 blksize;
@@ -109,6 +116,12 @@ segdmp_set_bufsz(uint32 sz_in_mb)
     frm_buf_sz = sz_in_mb MEG;
 }
 
+void
+segdmp_set_mmap(int mmap)
+{
+    use_mmap = mmap;
+}
+
 typedef struct seg_struct {
     uint32 len;
     uint32 idx;
@@ -376,15 +389,13 @@ segdmp_open_read(const char **dirs,		/* directories available for dump files */
 {
     char fn[MAXPATHLEN+1];
     uint32 n_dir;
-    uint32 i, swp;
-    uint32 *n_frame;
+    uint32 i, j, swp;
     
     n_stream = i_n_stream;
     vecsize = i_vecsize;
     blksize = i_blksize;
     
     n_seg = NULL;
-    n_frame = NULL;
 
     for (i = 0; dirs[i]; i++);
     n_dir = i;
@@ -414,6 +425,30 @@ segdmp_open_read(const char **dirs,		/* directories available for dump files */
 
     n_part = n_dir;
 
+    /* Total # of frames of each id, which are contiguous */
+    for (i = 0; i < n_id; i++) {
+	if (n_frame == NULL) {
+	    id_len[i] = n_seg[i];
+	}
+	else {
+	    for (j = 0, id_len[i] = 0; j < n_seg[i]; j++)
+		id_len[i] += n_frame[i][j];
+	}
+    }
+
+    /* Map the parts in native byte order, so that segdmp_id_frames()
+     * can return the frames in place. */
+    dmp_part_fn = ckd_calloc(n_part, sizeof(char *));
+    dmp_mm = ckd_calloc(n_part, sizeof(mmio_file_t *));
+    for (i = 0; i < n_part; i++) {
+	sprintf(fn, "%s/%s", dirs[i], dfn);
+	dmp_part_fn[i] = ckd_salloc(fn);
+	if (use_mmap && !dmp_swp[i]) {
+	    if ((dmp_mm[i] = mmio_file_read(fn)) == NULL)
+		E_WARN("Failed to map %s; reading it instead\n", fn);
+	}
+    }
+
     *out_data_type = cur_type;
     *out_n_id = n_id;
 
@@ -573,8 +608,10 @@ segdmp_open_write(const char **dirs,		/* directories available for dump files */
 
 	dmp_fp[i] = s3open(dmp_fn, "wb", NULL);
 
-	/* add the file header size to all the offsets computed above. */
-	hdr_sz = ftell(dmp_fp[i]);
+	/* add the file header size to all the offsets computed above,
+	 * padding it so that the frames are aligned. */
+	for (hdr_sz = ftell(dmp_fp[i]); hdr_sz % sizeof(float32); hdr_sz++)
+	    fputc(0, dmp_fp[i]);
 	for (j = 0; j < n_id; j++) {
 	    if (id_part[j] == i)
 		id_off[j] += hdr_sz;
@@ -631,9 +668,28 @@ segdmp_open_write(const char **dirs,		/* directories available for dump files */
 int
 segdmp_close()
 {
+    uint32 i;
+
     if (frm_buf)
 	dump_frm_buf();
 
+    if (dmp_fp) {
+	for (i = 0; i < n_part; i++)
+	    s3close(dmp_fp[i]);
+    }
+
+    if (dmp_part_fn) {
+	for (i = 0; i < n_part; i++) {
+	    ckd_free(dmp_part_fn[i]);
+	    if (dmp_mm[i])
+		mmio_file_unmap(dmp_mm[i]);
+	}
+	ckd_free(dmp_part_fn);
+	ckd_free(dmp_mm);
+	dmp_part_fn = NULL;
+	dmp_mm = NULL;
+    }
+
     ckd_free(id_part);
     id_part = NULL;
 
@@ -758,6 +814,40 @@ segdmp_next_feat(uint32 id,
 }
 
 
+float32 *
+segdmp_id_frames(uint32 id,
+		 uint32 *out_n_frame,
+		 float32 **buf)
+{
+    uint32 part = id_part[id];
+    uint32 n_float;
+    FILE *fp;
+
+    *out_n_frame = id_len[id];
+    if (id_len[id] == 0)
+	return NULL;
+
+    if (dmp_mm[part] && (id_off[id] % sizeof(float32)) == 0)
+	return (float32 *)((char *)mmio_file_ptr(dmp_mm[part]) + id_off[id]);
+
+    /* Read them with a FILE of our own, so that several threads can
+     * do this at once. */
+    n_float = id_len[id] * (frame_sz / sizeof(float32));
+    *buf = ckd_realloc(*buf, n_float * sizeof(float32));
+    if ((fp = fopen(dmp_part_fn[part], "rb")) == NULL) {
+	E_FATAL_SYSTEM("Unable to open %s", dmp_part_fn[part]);
+    }
+    if (fseek(fp, id_off[id], SEEK_SET) < 0) {
+	E_FATAL_SYSTEM("Unable to seek to position in dmp file");
+    }
+    if (bio_fread(*buf, sizeof(float32), n_float, fp, dmp_swp[part], &ignore) != n_float) {
+	E_FATAL_SYSTEM("Unable to read frames from dmp file");
+    }
+    fclose(fp);
+
+    return *buf;
+}
+
 uint32
 segdmp_n_seg(uint32 id)
 {
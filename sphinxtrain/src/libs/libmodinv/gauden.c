@@ -69,6 +69,14 @@
 #include <assert.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define GAUDEN_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define GAUDEN_NEON
+#include <arm_neon.h>
+#endif
+
 static float32 min_var = 1e38;	/* just a big num */
 
 /* M_PI is not uniformly defined on all machines.  Do it here
@@ -828,6 +836,68 @@ dist_unrolled(float32 *out,
 }
 #endif
 
+/*
+ * Sum of var_fact[l] * (obs[l] - mean[l])^2 over the first veclen
+ * dimensions, i.e. the -1 / (2 sigma ^2) * (x - m) ^ 2 terms of a
+ * diagonal Gaussian.  Like the scalar loop, differences are taken in
+ * float32 and the terms summed in float64, but four dimensions at a
+ * time in two pairs of lanes, so the result differs from a sequential
+ * sum only by rounding.
+ */
+static float64
+diag_dist(vector_t obs,
+	  vector_t mean,
+	  vector_t var_fact,
+	  uint32 veclen)
+{
+    float64 d = 0.0, diff;
+    uint32 l = 0;
+
+#if defined(GAUDEN_SSE2)
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+
+    for (; l + 4 <= veclen; l += 4) {
+	__m128 o = _mm_loadu_ps(obs + l);
+	__m128 m = _mm_loadu_ps(mean + l);
+	__m128 v = _mm_loadu_ps(var_fact + l);
+	__m128 df = _mm_sub_ps(o, m);
+	__m128d d0 = _mm_cvtps_pd(df);
+	__m128d d1 = _mm_cvtps_pd(_mm_movehl_ps(df, df));
+
+	acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_mul_pd(_mm_cvtps_pd(v), d0), d0));
+	acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v)),
+						      d1), d1));
+    }
+    acc0 = _mm_add_pd(acc0, acc1);
+    acc0 = _mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0));
+    d = _mm_cvtsd_f64(acc0);
+#elif defined(GAUDEN_NEON)
+    float64x2_t acc0 = vdupq_n_f64(0.0);
+    float64x2_t acc1 = vdupq_n_f64(0.0);
+
+    for (; l + 4 <= veclen; l += 4) {
+	float32x4_t o = vld1q_f32(obs + l);
+	float32x4_t m = vld1q_f32(mean + l);
+	float32x4_t v = vld1q_f32(var_fact + l);
+	float32x4_t df = vsubq_f32(o, m);
+	float64x2_t d0 = vcvt_f64_f32(vget_low_f32(df));
+	float64x2_t d1 = vcvt_high_f64_f32(df);
+
+	acc0 = vaddq_f64(acc0, vmulq_f64(vmulq_f64(vcvt_f64_f32(vget_low_f32(v)), d0), d0));
+	acc1 = vaddq_f64(acc1, vmulq_f64(vmulq_f64(vcvt_high_f64_f32(v), d1), d1));
+    }
+    d = vaddvq_f64(vaddq_f64(acc0, acc1));
+#endif
+
+    for (; l < veclen; l++) {
+	diff = obs[l] - mean[l];
+	d += var_fact[l] * diff * diff;
+    }
+
+    return d;
+}
+
 /* This is a most used function during the training. Be very careful
  * when you modify it */
 float64
@@ -837,29 +907,7 @@ log_diag_eval(vector_t obs,
 	      vector_t var_fact,
 	      uint32 veclen)
 {
-    float64 d = 0.0, diff;
-    uint32 l;
-
-    if (veclen == 39) {
-	/* Most common case, optimized for loop unrolling */
-        for (l = 0; l < 39; l++) {
-	    diff = obs[l] - mean[l];
-	    d += var_fact[l] * diff * diff;	/* compute -1 / (2 sigma ^2) * (x - m) ^ 2 terms */
-	}
-    } else if (veclen == 32) {
-	/* Most common case, optimized for loop unrolling */
-        for (l = 0; l < 32; l++) {
-	    diff = obs[l] - mean[l];
-	    d += var_fact[l] * diff * diff;	/* compute -1 / (2 sigma ^2) * (x - m) ^ 2 terms */
-	}
-    } else {
-        for (l = 0; l < veclen; l++) {
-	    diff = obs[l] - mean[l];
-	    d += var_fact[l] * diff * diff;	/* compute -1 / (2 sigma ^2) * (x - m) ^ 2 terms */
-	}
-    }
-    
-    return norm - d;	/* log (1 / 2 pi |sigma^2|) */
+    return norm - diag_dist(obs, mean, var_fact, veclen);	/* log (1 / 2 pi |sigma^2|) */
 }
 
 float64
@@ -1046,7 +1094,11 @@ log_topn_densities(float64 *den,
 
 	d = log_norm[i];
 
-	for (j = 0; (j < veclen) && (d > worst); j++) {
+	/* The terms are all positive, so stop as soon as the density
+	   falls out of the top N, checking every four dimensions. */
+	for (j = 0; (j + 4 <= veclen) && (d > worst); j += 4)
+	    d -= diag_dist(obs + j, m + j, v + j, 4);
+	for (; (j < veclen) && (d > worst); j++) {
 	    diff = obs[j] - m[j];
 	    d -= diff * diff * v[j];
 	}
@@ -1541,6 +1593,38 @@ gauden_accum_param_full(vector_t ****out,
     }
 }
 
+void
+gauden_norm_wt_mean_cb(vector_t **in_mean,
+		       vector_t **wt_mean,
+		       float32 **dnom,
+		       uint32 i,
+		       uint32 n_feat,
+		       uint32 n_density,
+		       const uint32 *veclen)
+{
+    uint32 j, k, l;
+
+    for (j = 0; j < n_feat; j++) {
+	for (k = 0; k < n_density; k++) {
+	    if (dnom[j][k] != 0) {
+		for (l = 0; l < veclen[j]; l++) {
+		    wt_mean[j][k][l] /= dnom[j][k];
+		}
+	    }
+	    else {
+		E_WARN("(mgau= %u, feat= %u, density= %u) never observed\n",
+		       i, j, k);
+		if (in_mean) {
+		    E_INFO("Copying it from in_mean\n");
+		    for (l = 0; l < veclen[j]; l++) {
+			wt_mean[j][k][l] = in_mean[j][k][l];
+		    }
+		}
+	    }
+	}
+    }
+}
+
 void
 gauden_norm_wt_mean(vector_t ***in_mean,
 		    vector_t ***wt_mean,
@@ -1550,28 +1634,12 @@ gauden_norm_wt_mean(vector_t ***in_mean,
 		    uint32 n_density,
 		    const uint32 *veclen)
 {
-    uint32 i, j, k, l;
+    uint32 i;
 
     for (i = 0; i < n_mgau; i++) {
-	for (j = 0; j < n_feat; j++) {
-	    for (k = 0; k < n_density; k++) {
-		if (dnom[i][j][k] != 0) {
-		    for (l = 0; l < veclen[j]; l++) {
-			wt_mean[i][j][k][l] /= dnom[i][j][k];
-		    }
-		}
-		else {
-		    E_WARN("(mgau= %u, feat= %u, density= %u) never observed\n",
-			   i, j, k);
-		    if (in_mean) {
-			E_INFO("Copying it from in_mean\n");
-			for (l = 0; l < veclen[j]; l++) {
-			    wt_mean[i][j][k][l] = in_mean[i][j][k][l];
-			}
-		    }
-		}
-	    }
-	}
+	gauden_norm_wt_mean_cb(in_mean ? in_mean[i] : NULL,
+			       wt_mean[i], dnom[i],
+			       i, n_feat, n_density, veclen);
     }
 }
 
@@ -1641,6 +1709,55 @@ gauden_tie_vars_dnoms(vector_t ***wt_var,
     }
 }
 
+void
+gauden_norm_wt_var_cb(vector_t **in_var,
+		      vector_t **wt_var,
+		      int32 pass2var,
+		      float32 **dnom,
+		      vector_t **mean,
+		      uint32 i,
+		      uint32 n_feat,
+		      uint32 n_density,
+		      const uint32 *veclen)
+{
+    uint32 j, k, l;
+
+    for (j = 0; j < n_feat; j++) {
+	for (k = 0; k < n_density; k++) {
+	    if (dnom[j][k] != 0) {
+		for (l = 0; l < veclen[j]; l++) {
+		    if (!pass2var) {
+			wt_var[j][k][l] =
+			    (wt_var[j][k][l] / dnom[j][k]) -
+			    (mean[j][k][l] * mean[j][k][l]);
+		    }
+		    else {
+			wt_var[j][k][l] /= dnom[j][k];
+		    }
+
+		    if (wt_var[j][k][l] < 0) {
+			E_ERROR("Variance (mgau= %u, feat= %u, "
+				"density=%u, component=%u) is less then 0. "
+				"Most probably the number of senones is "
+				"too high for such a small training "
+				"database. Use smaller $CFG_N_TIED_STATES.\n",
+				i, j, k, l);
+		    }
+		}
+	    }
+	    else {
+		if (in_var) {
+		    E_INFO("Copying unseen var (%u, %u, %u) from in_var\n",
+			   i, j, k);
+		    for (l = 0; l < veclen[j]; l++) {
+			wt_var[j][k][l] = in_var[j][k][l];
+		    }
+		}
+	    }
+	}
+    }
+}
+
 void
 gauden_norm_wt_var(vector_t ***in_var,
 		   vector_t ***wt_var,
@@ -1653,47 +1770,17 @@ gauden_norm_wt_var(vector_t ***in_var,
 		   const uint32 *veclen,
 		   int32 tiedvar)
 {
-    uint32 i, j, k, l;
+    uint32 i;
 
     if (tiedvar) {
 	gauden_tie_vars_dnoms(wt_var, pass2var, dnom, mean,
 			      n_mgau, n_feat, n_density, veclen);
     }
     for (i = 0; i < n_mgau; i++) {
-	for (j = 0; j < n_feat; j++) {
-	    for (k = 0; k < n_density; k++) {
-		if (dnom[i][j][k] != 0) {
-		    for (l = 0; l < veclen[j]; l++) {
-			if (!pass2var) {
-			    wt_var[i][j][k][l] =
-				(wt_var[i][j][k][l] / dnom[i][j][k]) -
-				(mean[i][j][k][l] * mean[i][j][k][l]);
-			}
-			else {
-			    wt_var[i][j][k][l] /= dnom[i][j][k];
-			}
-
-			if (wt_var[i][j][k][l] < 0) {
-			    E_ERROR("Variance (mgau= %u, feat= %u, "
-				    "density=%u, component=%u) is less then 0. "
-				    "Most probably the number of senones is "
-				    "too high for such a small training "
-				    "database. Use smaller $CFG_N_TIED_STATES.\n",
-				    i, j, k, l);
-			}
-		    }
-		}
-		else {
-		    if (in_var) {
-			E_INFO("Copying unseen var (%u, %u, %u) from in_var\n",
-			       i, j, k);
-			for (l = 0; l < veclen[j]; l++) {
-			    wt_var[i][j][k][l] = in_var[i][j][k][l];
-			}
-		    }
-		}
-	    }
-	}
+	gauden_norm_wt_var_cb(in_var ? in_var[i] : NULL,
+			      wt_var[i], pass2var, dnom[i],
+			      mean ? mean[i] : NULL,
+			      i, n_feat, n_density, veclen);
     }
 }
 
@@ -1768,6 +1855,58 @@ gauden_tie_fullvars_dnoms(vector_t ****wt_fullvar,
     }
 }
 
+void
+gauden_norm_wt_fullvar_cb(vector_t ***in_var,
+			  vector_t ***wt_var,
+			  int32 pass2var,
+			  float32 **dnom,
+			  vector_t **mean,
+			  uint32 i,
+			  uint32 n_feat,
+			  uint32 n_density,
+			  const uint32 *veclen)
+{
+    uint32 j, k, l, ll;
+
+    for (j = 0; j < n_feat; j++) {
+	vector_t *outermean = NULL;
+	if (!pass2var)
+	    outermean = (vector_t *)ckd_calloc_2d(veclen[j], veclen[j], sizeof(float32));
+	    
+	for (k = 0; k < n_density; k++) {
+	    if (!pass2var)
+		outerproduct(outermean,
+			     mean[j][k], mean[j][k],
+			     veclen[j]);
+	    if (dnom[j][k] != 0) {
+		for (l = 0; l < veclen[j]; l++) {
+		    for (ll = 0; ll < veclen[j]; ll++) {
+			if (!pass2var) {
+			    wt_var[j][k][l][ll] =
+				(wt_var[j][k][l][ll] / dnom[j][k]) -
+				outermean[l][ll];
+			}
+			else {
+			    wt_var[j][k][l][ll] /= dnom[j][k];
+			}
+		    }
+		}
+	    }
+	    else {
+		if (in_var) {
+		    E_INFO("Copying unseen var (%u, %u, %u) from in_var\n",
+			   i, j, k);
+		    for (l = 0; l < veclen[j]; l++) {
+			wt_var[j][k][l] = in_var[j][k][l];
+		    }
+		}
+	    }
+	}
+	if (!pass2var)
+	    ckd_free_2d((void **)outermean);
+    }
+}
+
 void
 gauden_norm_wt_fullvar(vector_t ****in_var,
 		       vector_t ****wt_var,
@@ -1780,50 +1919,17 @@ gauden_norm_wt_fullvar(vector_t ****in_var,
 		       const uint32 *veclen,
 		       int32 tiedvar)
 {
-    uint32 i, j, k, l, ll;
+    uint32 i;
 
     if (tiedvar) {
 	gauden_tie_fullvars_dnoms(wt_var, pass2var, dnom, mean,
 				  n_mgau, n_feat, n_density, veclen);
     }
     for (i = 0; i < n_mgau; i++) {
-	for (j = 0; j < n_feat; j++) {
-	    vector_t *outermean = NULL;
-	    if (!pass2var)
-		outermean = (vector_t *)ckd_calloc_2d(veclen[j], veclen[j], sizeof(float32));
-		
-	    for (k = 0; k < n_density; k++) {
-		if (!pass2var)
-		    outerproduct(outermean,
-				 mean[i][j][k], mean[i][j][k],
-				 veclen[j]);
-		if (dnom[i][j][k] != 0) {
-		    for (l = 0; l < veclen[j]; l++) {
-			for (ll = 0; ll < veclen[j]; ll++) {
-			    if (!pass2var) {
-				wt_var[i][j][k][l][ll] =
-				    (wt_var[i][j][k][l][ll] / dnom[i][j][k]) -
-				    outermean[l][ll];
-			    }
-			    else {
-				wt_var[i][j][k][l][ll] /= dnom[i][j][k];
-			    }
-			}
-		    }
-		}
-		else {
-		    if (in_var) {
-			E_INFO("Copying unseen var (%u, %u, %u) from in_var\n",
-			       i, j, k);
-			for (l = 0; l < veclen[j]; l++) {
-			    wt_var[i][j][k][l] = in_var[i][j][k][l];
-			}
-		    }
-		}
-	    }
-	    if (!pass2var)
-		ckd_free_2d((void **)outermean);
-	}
+	gauden_norm_wt_fullvar_cb(in_var ? in_var[i] : NULL,
+				  wt_var[i], pass2var, dnom[i],
+				  mean ? mean[i] : NULL,
+				  i, n_feat, n_density, veclen);
     }
 }
 
@@ -55,6 +55,7 @@
 #include <s3/s3mixw_io.h>
 #include <s3/pset_io.h>
 #include <s3/quest.h>
+#include <s3/best_q.h>
 #include <s3/dtree.h>
 #include <s3/metric.h>
 #include <s3/div.h>
@@ -732,6 +733,8 @@ int main(int argc, char *argv[])
 
     mwfloor = cmd_ln_float32("-mwfloor");
 
+    best_q_set_nthreads(cmd_ln_int32("-nthreads"));
+
     id = (uint32 *)ckd_calloc(n_model, sizeof(uint32));
 
     /* Initially, all states in the same class */
@@ -188,6 +188,11 @@ var -psetfn questions -stwt 1.0 0.05 0.01 -state 0 -ssplitmin 1 \n\
 	  "100",
 	  "Minimum # of compound tree splits to do" },
 
+	{ "-nthreads",
+	  ARG_INT32,
+	  "1",
+	  "# of threads to evaluate candidate questions in" },
+
 	{NULL, 0, NULL, NULL}
     };
 
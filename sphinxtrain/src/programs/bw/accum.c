@@ -211,6 +211,18 @@ accum_gauden(float32 ***denacc,
     int n_top = gauden_n_top(g);
     int n_density = gauden_n_density(g);
 
+    if (var_is_full) {
+	uint32 maxveclen;
+
+	/* Scratch space for the widest stream, shared by all of them */
+	for (j = 0, maxveclen = 0; j < gauden_n_feat(g); j++) {
+	    if (g->veclen[j] > maxveclen)
+		maxveclen = g->veclen[j];
+	}
+	cov = (vector_t *)ckd_calloc_2d(maxveclen, maxveclen, sizeof(float32));
+	dvec = ckd_calloc(maxveclen, sizeof(float32));
+    }
+
     /* for each density family found in the utterance */
     for (i = 0; i < n_lcl2gbl; i++) {
 
@@ -222,13 +234,6 @@ accum_gauden(float32 ***denacc,
 	    uint32* den_idx_row = den_idx[i][j];
 	    float32* denacc_row = denacc[i][j];
 
-	    if (var_is_full) {
-		ckd_free_2d((void **)cov);
-		cov = (vector_t *)ckd_calloc_2d(g->veclen[j], g->veclen[j], sizeof(float32));
-		ckd_free(dvec);
-		dvec = ckd_calloc(g->veclen[j], sizeof(float32));
-	    }
-	    
 
 	    /* for each density in the mixture density */
 	    for (kk = 0; kk < n_top; kk++) {
@@ -303,15 +308,14 @@ accum_gauden(float32 ***denacc,
 		/* accumulate observation count for all densities */
 		dnom[i][j][k] += obs_cnt;
 	    }
-	    if (var_is_full) {
-		ckd_free_2d((void **)cov);
-		cov = NULL;
-		ckd_free(dvec);
-		dvec = NULL;
-	    }
 	}
     }
 
+    if (var_is_full) {
+	ckd_free_2d((void **)cov);
+	ckd_free(dvec);
+    }
+
     if (pdumpfh)
 	    fputs("\n", pdumpfh);
 
@@ -388,11 +388,11 @@ backward_update(float64 **active_alpha,
     float64 p_reest_term;
     float64 post_j;
     float64 sum_reest_post_j = 0.0;
-    static float64 *p_op = NULL;
-    static float64 *p_ci_op = NULL;
+    float64 *p_op;
+    float64 *p_ci_op;
     float64 op;
-    static float64 **d_term = NULL;
-    static float64 **d_term_ci = NULL;
+    float64 **d_term;
+    float64 **d_term_ci;
 
     uint32 n_feat;
     uint32 n_density;
@@ -431,15 +431,12 @@ backward_update(float64 **active_alpha,
     n_density = gauden_n_density(g);
     n_top = gauden_n_top(g);
 
-    if (p_op == NULL) {
-	p_op    = ckd_calloc(n_feat, sizeof(float64));
-	p_ci_op = ckd_calloc(n_feat, sizeof(float64));
-    }
-
-    if (d_term == NULL) {
-	d_term    = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
-	d_term_ci = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
-    }
+    /* Scratch space is per call so that several threads may
+       accumulate at once */
+    p_op    = ckd_calloc(n_feat, sizeof(float64));
+    p_ci_op = ckd_calloc(n_feat, sizeof(float64));
+    d_term    = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
+    d_term_ci = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
 
     /* Allocate space for source/destination beta */
     beta_a = ckd_calloc(n_state, sizeof(float64));
@@ -1291,5 +1288,10 @@ free:
     ckd_free_3d((void ***)now_den);
     ckd_free_3d((void ***)now_den_idx);
 
+    ckd_free(p_op);
+    ckd_free(p_ci_op);
+    ckd_free_2d((void **)d_term);
+    ckd_free_2d((void **)d_term_ci);
+
     return (retval);
 }
@@ -118,6 +118,11 @@
  *      s3phseg_t *phseg -
  *              An optional phone segmentation to use to constrain the
  *              forward lattice.
+ *
+ *	sbmtx_t *accum_mtx -
+ *		If not NULL, held while the utterance sums are added
+ *		to the global reestimation sums, which may then be
+ *		shared by several threads.
  * Global Inputs: 
  *	None
  * 
@@ -147,7 +152,8 @@ baum_welch_update(float64 *log_forw_prob,
 		  int32 var_is_full,
 		  FILE *pdumpfh,
 		  bw_timers_t *timers,
-		  feat_t *fcb)
+		  feat_t *fcb,
+		  sbmtx_t *accum_mtx)
 {
     float64 *scale = NULL;
     float64 **dscale = NULL;
@@ -265,9 +271,13 @@ baum_welch_update(float64 *log_forw_prob,
      * global reestimation accumulators */
     if (timers)
 	ptmr_start(&timers->rstu_timer);
+    if (accum_mtx)
+	sbmtx_lock(accum_mtx);
     accum_global(inv, state, n_state,
 		 mixw_reest, tmat_reest, mean_reest, var_reest,
 		 var_is_full);
+    if (accum_mtx)
+	sbmtx_unlock(accum_mtx);
     if (timers)
 	ptmr_stop(&timers->rstu_timer);
 
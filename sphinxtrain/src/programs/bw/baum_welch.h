@@ -51,6 +51,7 @@
 #include <sphinxbase/prim_type.h>
 #include <sphinxbase/feat.h>
 #include <sphinxbase/profile.h>
+#include <sphinxbase/sbthread.h>
 
 #include <s3/vector.h>
 #include <s3/state.h>
@@ -94,6 +95,7 @@ baum_welch_update(float64 *log_forw_prob,
 		  int32 var_is_full,
 		  FILE *pdumpfh,
 		  bw_timers_t *timers,
-		  feat_t *fcb);
+		  feat_t *fcb,
+		  sbmtx_t *accum_mtx);
 
 #endif /* BAUM_WELCH_H */ 
@@ -65,6 +65,8 @@
 #include <s3/mllr_io.h>
 #include <s3/ts2cb.h>
 #include <s3/s3cb2mllr_io.h>
+#include <s3/s3phseg_io.h>
+#include <s3/state_seq.h>
 #include <sys_compat/misc.h>
 #include <sys_compat/time.h>
 #include <sys_compat/file.h>
@@ -72,6 +74,7 @@
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/profile.h>
 #include <sphinxbase/feat.h>
+#include <sphinxbase/sbthread.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -544,6 +547,8 @@ main_initialize(int argc,
 	}
     }
 
+    corpus_set_prefetch(cmd_ln_int32("-prefetch"), cmd_ln_int32("-ceplen"));
+
     /* BEWARE: this function call must be done after all the other corpus
        configuration */
     corpus_init();
@@ -612,6 +617,82 @@ main_initialize(int argc,
     return S3_SUCCESS;
 }
 
+static void
+print_column_defns(void)
+{
+    printf("column defns\n");
+    printf("\t<seq>\n");
+    printf("\t<id>\n");
+    printf("\t<n_frame_in>\n");
+    printf("\t<n_frame_del>\n");
+    printf("\t<n_state_shmm>\n");
+    printf("\t<avg_states_alpha>\n");
+    if (!cmd_ln_int32("-viterbi") && !cmd_ln_int32("-fastviterbi")) {
+	printf("\t<avg_states_beta>\n");
+	printf("\t<avg_states_reest>\n");
+	printf("\t<avg_posterior_prune>\n");
+    }
+    printf("\t<frame_log_lik>\n");
+    printf("\t<utt_log_lik>\n");
+    printf("\t... timing info ... \n");
+}
+
+static void
+dump_counts(model_inventory_t *inv,
+	    int32 mixw_reest,
+	    int32 tmat_reest,
+	    int32 mean_reest,
+	    int32 var_reest,
+	    int32 pass2var,
+	    int32 var_is_full)
+{
+    uint32 no_retries = 0;
+
+    /* dump the accumulators to a file system */
+    while (cmd_ln_str("-accumdir") != NULL &&
+	   accum_dump(cmd_ln_str("-accumdir"), inv,
+		      mixw_reest,
+		      tmat_reest,
+		      mean_reest,
+		      var_reest,
+		      pass2var,
+		      var_is_full,
+		      FALSE) != S3_SUCCESS) {
+	static int notified = FALSE;
+	time_t t;
+	char time_str[64];
+
+	/*
+	 * If we were not able to dump the parameters, write one log entry
+	 * about the failure
+	 */
+	if (notified == FALSE) {
+	    t = time(NULL);
+	    strcpy(time_str, (const char *)ctime((const time_t *)&t));
+	    /* nuke the newline at the end of this. */
+	    time_str[strlen(time_str)-1] = '\0';
+	    E_WARN("Count dump failed on %s.  Retrying dump every %3.1f hour until success.\n",
+		   time_str, DUMP_RETRY_PERIOD/3600.0);
+
+	    notified = TRUE;
+	    no_retries++;
+	    if(no_retries>10){ 
+	      E_FATAL("Failed to get the files after 10 retries(about 5 minutes).\n ");
+	    }
+	}
+	
+	sleep(DUMP_RETRY_PERIOD);
+
+
+    }
+
+    /* Write a log entry on success */
+    if (cmd_ln_str("-accumdir"))
+	E_INFO("Counts saved to %s\n", cmd_ln_str("-accumdir"));
+    else
+	E_INFO("Counts NOT saved.\n");
+}
+
 void
 main_reestimate(model_inventory_t *inv,
 		lexicon_t *lex,
@@ -660,9 +741,14 @@ main_reestimate(model_inventory_t *inv,
     uint32 no_retries = 0;
 
     uint32 outputfullpath = 0;
+    int32 fast_viterbi;
 
+    fast_viterbi = viterbi && cmd_ln_int32("-fastviterbi");
     E_INFO("Reestimation: %s\n",
-	(viterbi ? "Viterbi" : "Baum-Welch"));
+	(fast_viterbi ? "Viterbi, beam search"
+	 : viterbi ? "Viterbi" : "Baum-Welch"));
+    if (fast_viterbi && cmd_ln_str("-outphsegdir"))
+	E_FATAL("-outphsegdir is not supported with -fastviterbi\n");
 
     profile = cmd_ln_int32("-timing");
     if (profile) {
@@ -720,21 +806,7 @@ main_reestimate(model_inventory_t *inv,
 
     seq_no = corpus_get_begin();
 
-    printf("column defns\n");
-    printf("\t<seq>\n");
-    printf("\t<id>\n");
-    printf("\t<n_frame_in>\n");
-    printf("\t<n_frame_del>\n");
-    printf("\t<n_state_shmm>\n");
-    printf("\t<avg_states_alpha>\n");
-    if (!cmd_ln_int32("-viterbi")) {
-	printf("\t<avg_states_beta>\n");
-	printf("\t<avg_states_reest>\n");
-	printf("\t<avg_posterior_prune>\n");
-    }
-    printf("\t<frame_log_lik>\n");
-    printf("\t<utt_log_lik>\n");
-    printf("\t... timing info ... \n");
+    print_column_defns();
 
     n_utt = 0;
 
@@ -842,7 +914,8 @@ main_reestimate(model_inventory_t *inv,
 				  var_is_full,
 				  pdumpfh,
 				  timers,
-				  feat) == S3_SUCCESS) {
+				  feat,
+				  NULL) == S3_SUCCESS) {
 		total_frames += n_frame;
 		total_log_lik += log_lik;
 		
@@ -851,6 +924,29 @@ main_reestimate(model_inventory_t *inv,
 		       log_lik);
 	    }
 
+	} else if (fast_viterbi) {
+	    /* Best path search and hard assignment to its states */
+	    if (viterbi_fast_update(&log_lik,
+				    f, n_frame,
+				    state_seq, n_state,
+				    inv,
+				    a_beam,
+				    phseg,
+				    mixw_reest,
+				    tmat_reest,
+				    mean_reest,
+				    var_reest,
+				    pass2var,
+				    var_is_full,
+				    pdumpfh,
+				    timers,
+				    feat) == S3_SUCCESS) {
+		total_frames += n_frame;
+		total_log_lik += log_lik;
+		printf(" %e %e",
+		       (n_frame > 0 ? log_lik / n_frame : 0.0),
+		       log_lik);
+	    }
 	} else {
 	    /* Viterbi search and accumulate in it */
 	    if (viterbi_update(&log_lik,
@@ -951,71 +1047,334 @@ main_reestimate(model_inventory_t *inv,
     printf("\n");
     fflush(stdout);
 
-    no_retries=0;
-    /* dump the accumulators to a file system */
-    while (cmd_ln_str("-accumdir") != NULL &&
-	   accum_dump(cmd_ln_str("-accumdir"), inv,
-		      mixw_reest,
-		      tmat_reest,
-		      mean_reest,
-		      var_reest,
-		      pass2var,
-		      var_is_full,
-		      FALSE) != S3_SUCCESS) {
-	static int notified = FALSE;
-	time_t t;
-	char time_str[64];
+    if (profile) {
+	ckd_free(timers);
+    }
 
-	/*
-	 * If we were not able to dump the parameters, write one log entry
-	 * about the failure
-	 */
-	if (notified == FALSE) {
-	    t = time(NULL);
-	    strcpy(time_str, (const char *)ctime((const time_t *)&t));
-	    /* nuke the newline at the end of this. */
-	    time_str[strlen(time_str)-1] = '\0';
-	    E_WARN("Count dump failed on %s.  Retrying dump every %3.1f hour until success.\n",
-		   time_str, DUMP_RETRY_PERIOD/3600.0);
+    dump_counts(inv, mixw_reest, tmat_reest, mean_reest, var_reest,
+		pass2var, var_is_full);
+}
 
-	    notified = TRUE;
-	    no_retries++;
-	    if(no_retries>10){ 
-	      E_FATAL("Failed to get the files after 10 retries(about 5 minutes).\n ");
+/* Work shared by the threads of a multi-threaded Baum-Welch pass.
+ * The corpus, the feature computation and the construction of
+ * sentence HMMs are not reentrant, so they are done under mtx, which
+ * also guards the totals.  Forward-backward runs concurrently, each
+ * thread accumulating into its own per-utterance sums, which only
+ * cover the parameters the utterance touches.  These are added to the
+ * one set of global sums under accum_mtx. */
+typedef struct bw_shared_s {
+    sbmtx_t *mtx;
+    sbmtx_t *accum_mtx;
+    lexicon_t *lex;
+    model_def_t *mdef;
+    feat_t *feat;
+
+    float64 a_beam;
+    float64 b_beam;
+    float32 spthresh;
+    uint32 maxuttlen;
+    uint32 in_veclen;
+    uint32 outputfullpath;
+    int32 mixw_reest;
+    int32 tmat_reest;
+    int32 mean_reest;
+    int32 var_reest;
+    int32 pass2var;
+    int32 var_is_full;
+
+    uint32 seq_no;
+    float64 total_log_lik;
+    uint32 total_frames;
+    uint32 n_frame_skipped;
+
+    /* MMIE training only */
+    const char *lat_dir;
+    const char *lat_ext;
+    uint32 n_mmi_type;
+    float64 total_log_postprob;
+    uint32 n_utt;
+    uint32 n_utt_fail;
+} bw_shared_t;
+
+typedef struct bw_worker_s {
+    bw_shared_t *sh;
+    model_inventory_t *inv;	/* Shares the model and global sums with
+				   the main inventory but has its own
+				   per-utterance sums */
+    sbthread_t *thread;
+} bw_worker_t;
+
+static model_inventory_t *
+worker_inv_init(model_inventory_t *inv)
+{
+    model_inventory_t *w_inv;
+    gauden_t *g;
+
+    w_inv = ckd_calloc(1, sizeof(*w_inv));
+    *w_inv = *inv;
+    w_inv->l_mixw_acc = NULL;
+    w_inv->mixw_inverse = NULL;
+    w_inv->n_mixw_inverse = 0;
+    w_inv->cb_inverse = NULL;
+    w_inv->n_cb_inverse = 0;
+    w_inv->l_tmat_acc = NULL;
+
+    g = ckd_calloc(1, sizeof(*g));
+    *g = *inv->gauden;
+    g->l_macc = g->l_vacc = NULL;
+    g->l_fullvacc = NULL;
+    g->l_dnom = NULL;
+    w_inv->gauden = g;
+
+    return w_inv;
+}
+
+static void
+worker_inv_free(model_inventory_t *w_inv)
+{
+    if (w_inv->l_mixw_acc)
+	ckd_free_3d((void ***)w_inv->l_mixw_acc);
+    if (w_inv->l_tmat_acc)
+	ckd_free_2d((void **)w_inv->l_tmat_acc);
+    ckd_free(w_inv->mixw_inverse);
+    ckd_free(w_inv->cb_inverse);
+
+    gauden_free_l_acc(w_inv->gauden);
+    ckd_free(w_inv->gauden);
+    ckd_free(w_inv);
+}
+
+static int
+worker_main(sbthread_t *th)
+{
+    bw_worker_t *w = sbthread_arg(th);
+    bw_shared_t *sh = w->sh;
+    vector_t *mfcc;
+    int32 n_frame;
+    uint32 svd_n_frame;
+    vector_t **f;
+    state_t *state_seq;
+    uint32 n_state = 0;
+    float64 log_lik;
+    uint32 seq_no;
+    char *uttid;
+    char *trans;
+    s3phseg_t *phseg;
+
+    for (;;) {
+	sbmtx_lock(sh->mtx);
+	if (!corpus_next_utt()) {
+	    sbmtx_unlock(sh->mtx);
+	    break;
+	}
+
+	if (corpus_get_generic_featurevec(&mfcc, &n_frame,
+					  sh->in_veclen) < 0) {
+	    E_FATAL("Can't read input features\n");
+	}
+
+	if (n_frame < 9) {
+	    E_WARN("utt %s too short\n", corpus_utt());
+	    if (mfcc) {
+		ckd_free(mfcc[0]);
+		ckd_free(mfcc);
 	    }
+	    sbmtx_unlock(sh->mtx);
+	    continue;
+	}
+
+	if ((sh->maxuttlen > 0) && (n_frame > sh->maxuttlen)) {
+	    E_INFO("utt # frames > -maxuttlen; skipping\n");
+	    sh->n_frame_skipped += n_frame;
+	    if (mfcc) {
+		ckd_free(mfcc[0]);
+		ckd_free(mfcc);
+	    }
+	    sbmtx_unlock(sh->mtx);
+	    continue;
 	}
-	
-	sleep(DUMP_RETRY_PERIOD);
 
+	seq_no = sh->seq_no++;
+	uttid = ckd_salloc(sh->outputfullpath
+			   ? corpus_utt_full_name() : corpus_utt());
 
-    }
+	svd_n_frame = n_frame;
+	f = feat_array_alloc(sh->feat, n_frame + feat_window_size(sh->feat));
+	feat_s2mfc2feat_live(sh->feat, mfcc, &n_frame, TRUE, TRUE, f);
 
-    if (profile) {
-	ckd_free(timers);
+	corpus_get_sent(&trans);
+	phseg = NULL;
+	corpus_get_phseg(w->inv->acmod_set, &phseg);
+
+	state_seq = next_utt_states(&n_state, sh->lex, w->inv, sh->mdef, trans);
+	if (state_seq)
+	    state_seq = state_seq_copy(state_seq, n_state);
+	sbmtx_unlock(sh->mtx);
+
+	printf("utt> %5u %25s %4u %4u %5u",
+	       seq_no, uttid, svd_n_frame, n_frame - svd_n_frame, n_state);
+
+	if (state_seq == NULL) {
+	    E_WARN("Skipped utterance '%s'\n", trans);
+	}
+	else {
+	    if (baum_welch_update(&log_lik,
+				  f, n_frame,
+				  state_seq, n_state,
+				  w->inv,
+				  sh->a_beam,
+				  sh->b_beam,
+				  sh->spthresh,
+				  phseg,
+				  sh->mixw_reest,
+				  sh->tmat_reest,
+				  sh->mean_reest,
+				  sh->var_reest,
+				  sh->pass2var,
+				  sh->var_is_full,
+				  NULL,
+				  NULL,
+				  sh->feat,
+				  sh->accum_mtx) == S3_SUCCESS) {
+		sbmtx_lock(sh->mtx);
+		sh->total_frames += n_frame;
+		sh->total_log_lik += log_lik;
+		sbmtx_unlock(sh->mtx);
+
+		printf(" %e %e",
+		       (n_frame > 0 ? log_lik / n_frame : 0.0),
+		       log_lik);
+	    }
+	    state_seq_free(state_seq, n_state);
+	}
+	printf("\n");
+	fflush(stdout);
+
+	if (phseg)
+	    s3phseg_free(phseg);
+	free(mfcc[0]);
+	ckd_free(mfcc);
+	feat_array_free(f);
+	free(trans);	/* alloc'ed using strdup() */
+	ckd_free(uttid);
     }
 
-    /* Write a log entry on success */
-    if (cmd_ln_str("-accumdir"))
-	E_INFO("Counts saved to %s\n", cmd_ln_str("-accumdir"));
-    else
-	E_INFO("Counts NOT saved.\n");
+    return 0;
 }
 
-/* x=log(a) y=log(b), log_add(x,y) = log(a+b) */
-float64
-log_add(float64 x, float64 y)
+/*********************************************************************
+ *
+ * Function: 
+ *	main_reestimate_threaded
+ * 
+ * Description: 
+ *	Baum-Welch reestimation using n_thread threads.  Each thread
+ *	takes the next utterance from the corpus and adds its
+ *	reestimation sums to the global ones in inv.  The result is the
+ *	same as that of main_reestimate() up to the order in which
+ *	floating point sums are formed.
+ *
+ *********************************************************************/
+void
+main_reestimate_threaded(model_inventory_t *inv,
+			 lexicon_t *lex,
+			 model_def_t *mdef,
+			 feat_t *feat,
+			 int32 n_thread)
 {
-  float64 z;
-  
-  if (x<y)
-    return log_add(y, x);
-  if (y == LOG_ZERO)
-    return x;
-  else
-    {
-      z = exp(y-x);
-      return x+log(1.0+z);
+    bw_shared_t sh;
+    bw_worker_t *workers;
+    int32 i;
+
+    E_INFO("Reestimation: Baum-Welch, %d threads\n", n_thread);
+    if (cmd_ln_int32("-timing"))
+	E_INFO("Timing is not reported with more than one thread\n");
+
+    memset(&sh, 0, sizeof(sh));
+    sh.lex = lex;
+    sh.mdef = mdef;
+    sh.feat = feat;
+    sh.mixw_reest = cmd_ln_int32("-mixwreest");
+    sh.tmat_reest = cmd_ln_int32("-tmatreest");
+    sh.mean_reest = cmd_ln_int32("-meanreest");
+    sh.var_reest = cmd_ln_int32("-varreest");
+    sh.pass2var = cmd_ln_int32("-2passvar");
+    sh.var_is_full = cmd_ln_int32("-fullvar");
+    sh.in_veclen = cmd_ln_int32("-ceplen");
+    sh.outputfullpath = cmd_ln_int32("-outputfullpath");
+    sh.a_beam = cmd_ln_float64("-abeam");
+    sh.b_beam = cmd_ln_float64("-bbeam");
+    sh.spthresh = cmd_ln_float32("-spthresh");
+    sh.maxuttlen = cmd_ln_int32("-maxuttlen");
+
+    if (cmd_ln_str("-accumdir") == NULL) {
+	E_WARN("NO ACCUMDIR SET.  No counts will be written; assuming debug\n");
+    }
+
+    if (!sh.mixw_reest && !sh.tmat_reest && !sh.mean_reest && !sh.var_reest) {
+	E_WARN("No reestimation specified!  None done.\n");
+	
+	return;
     }
+
+    sh.seq_no = corpus_get_begin();
+    sh.mtx = sbmtx_init();
+    sh.accum_mtx = sbmtx_init();
+
+    print_column_defns();
+
+    workers = ckd_calloc(n_thread, sizeof(*workers));
+    for (i = 0; i < n_thread; i++) {
+	workers[i].sh = &sh;
+	workers[i].inv = worker_inv_init(inv);
+    }
+    for (i = 0; i < n_thread; i++) {
+	workers[i].thread = sbthread_start(NULL, worker_main, &workers[i]);
+	if (workers[i].thread == NULL)
+	    E_FATAL("Failed to start accumulation thread %d\n", i);
+    }
+    for (i = 0; i < n_thread; i++) {
+	sbthread_wait(workers[i].thread);
+	sbthread_free(workers[i].thread);
+	worker_inv_free(workers[i].inv);
+    }
+    ckd_free(workers);
+    sbmtx_free(sh.mtx);
+    sbmtx_free(sh.accum_mtx);
+
+    printf("overall> stats %u (-%u) %e %e",
+	   sh.total_frames,
+	   sh.n_frame_skipped,
+	   (sh.total_frames > 0 ? sh.total_log_lik / sh.total_frames : 0.0),
+	   sh.total_log_lik);
+    printf("\n");
+    fflush(stdout);
+
+    dump_counts(inv, sh.mixw_reest, sh.tmat_reest, sh.mean_reest,
+		sh.var_reest, sh.pass2var, sh.var_is_full);
+}
+
+/* log(sum_j exp(x[j])) over the n_x values in x.  Taking out the
+ * largest first costs one log for all of them, where adding them in
+ * pairs took a log and an exp for each. */
+static float64
+log_sum(const float64 *x, uint32 n_x)
+{
+  float64 max, sum;
+  uint32 j;
+
+  if (n_x == 0)
+    return LOG_ZERO;
+  max = x[0];
+  for (j=1; j<n_x; j++)
+    if (x[j] > max)
+      max = x[j];
+  if (max == LOG_ZERO)
+    return LOG_ZERO;
+  sum = 0;
+  for (j=0; j<n_x; j++)
+    sum += exp(x[j] - max);
+  return max + log(sum);
 }
 
 /* forward-backward computation on lattice */
@@ -1023,79 +1382,81 @@ int
 lat_fwd_bwd(s3lattice_t *lat)
 {
   int i, j;
-  uint32 id;
-  float64 ac_score, lm_score;
+  uint32 id, n_x, max_x;
+  float64 *arc_score;/* scaled acoustic plus lm score of each arc */
+  float64 *x;/* the terms summed for one arc */
+  float64 inv_lm_scale = 1.0 / lm_scale;
+
+  /* The summed terms are gathered for each arc, so that their sum
+   * costs one log rather than one per term. */
+  arc_score = ckd_calloc(lat->n_arcs, sizeof(float64));
+  max_x = 1;
+  for (i=0; i<lat->n_arcs; i++) {
+    arc_score[i] = lat->arc[i].ac_score * inv_lm_scale + lat->arc[i].lm_score;
+    if (lat->arc[i].n_prev_arcs > max_x)
+      max_x = lat->arc[i].n_prev_arcs;
+    if (lat->arc[i].n_next_arcs > max_x)
+      max_x = lat->arc[i].n_next_arcs;
+  }
+  x = ckd_calloc(max_x > lat->n_arcs ? max_x : lat->n_arcs, sizeof(float64));
 
   /* step forward */
   for (i=0; i<lat->n_arcs; i++) {
     /* initialise alpha */
     lat->arc[i].alpha = LOG_ZERO;
     if (lat->arc[i].good_arc == 1) {
-      /* get the acoustic and lm socre for a word hypothesis */
-      ac_score = lat->arc[i].ac_score / lm_scale;
-      lm_score = lat->arc[i].lm_score;
-
       /* compute alpha */
+      n_x = 0;
       for (j=0; j<lat->arc[i].n_prev_arcs; j++) {
 	id = lat->arc[i].prev_arcs[j];
 	if (id == 0) {
-	  if (lat->arc[i].sf == 1) {
-	    lat->arc[i].alpha = log_add(lat->arc[i].alpha, 0);
-	  }
+	  if (lat->arc[i].sf == 1)
+	    x[n_x++] = 0;
 	}
-	else {
-	  if (lat->arc[id-1].good_arc == 1)
-	    lat->arc[i].alpha = log_add(lat->arc[i].alpha, lat->arc[id-1].alpha);
+	else if (lat->arc[id-1].good_arc == 1) {
+	  x[n_x++] = lat->arc[id-1].alpha;
 	}
       }
-      lat->arc[i].alpha += ac_score + lm_score;
+      lat->arc[i].alpha = log_sum(x, n_x) + arc_score[i];
     }
   }
 
-  /* initialise overall log-likelihood */
-  lat->prob = LOG_ZERO;
-
   /* step backward */
   for (i=lat->n_arcs-1; i>=0 ;i--) {
     /* initialise beta */
     lat->arc[i].beta = LOG_ZERO;
 
     if (lat->arc[i].good_arc == 1) {
-      /* get the acoustic and lm socre for a word hypothesis */
-      ac_score = lat->arc[i].ac_score / lm_scale;
-      lm_score = lat->arc[i].lm_score;
-
       /* compute beta */
+      n_x = 0;
       for (j=0; j<lat->arc[i].n_next_arcs; j++) {
 	id = lat->arc[i].next_arcs[j];
-	if (id == 0) {
-	  lat->arc[i].beta = log_add(lat->arc[i].beta, 0);
-	}
-	else {
-	  if (lat->arc[id-1].good_arc == 1);
-	  lat->arc[i].beta = log_add(lat->arc[i].beta, lat->arc[id-1].beta);
-	}
+	if (id == 0)
+	  x[n_x++] = 0;
+	else if (lat->arc[id-1].good_arc == 1)
+	  x[n_x++] = lat->arc[id-1].beta;
       }
-      lat->arc[i].beta += ac_score + lm_score;
-
-      /* compute overall log-likelihood loglid=beta(1)=alpha(Q) */
-      if (lat->arc[i].sf == 1)
-	lat->prob = log_add(lat->prob, lat->arc[i].beta);
+      lat->arc[i].beta = log_sum(x, n_x) + arc_score[i];
     }
   }
 
+  /* compute overall log-likelihood loglid=beta(1)=alpha(Q) */
+  n_x = 0;
+  for (i=lat->n_arcs-1; i>=0 ;i--)
+    if (lat->arc[i].good_arc == 1 && lat->arc[i].sf == 1)
+      x[n_x++] = lat->arc[i].beta;
+  lat->prob = log_sum(x, n_x);
+
   /* compute gamma */
   for (i=0; i<lat->n_arcs; i++)
     {
       /* initialise gamma */
       lat->arc[i].gamma = LOG_ZERO;
       if (lat->arc[i].good_arc == 1)
-	{
-	  ac_score = lat->arc[i].ac_score / lm_scale;
-	  lm_score = lat->arc[i].lm_score;
-	  lat->arc[i].gamma = lat->arc[i].alpha + lat->arc[i].beta - (ac_score + lm_score + lat->prob);
-	}
+	lat->arc[i].gamma = lat->arc[i].alpha + lat->arc[i].beta - (arc_score[i] + lat->prob);
     }
+  ckd_free(x);
+  ckd_free(arc_score);
 
   /* compute the posterior probability of the true path */
   lat->postprob = 0;
@@ -1105,6 +1466,43 @@ lat_fwd_bwd(s3lattice_t *lat)
   return S3_SUCCESS;
 }
 
+/* HMM state sequence for a lattice arc, between the given boundary
+ * phones, or from context-independent word boundary models if they
+ * are NULL.  State sequences are built in storage shared by all
+ * threads, so with mtx, they are built under it and copied. */
+static state_t *
+mmi_arc_states(uint32 *n_state,
+	       lexicon_t *lex,
+	       model_inventory_t *inv,
+	       model_def_t *mdef,
+	       char *word,
+	       acmod_id_t *lphone,
+	       acmod_id_t *rphone,
+	       sbmtx_t *mtx)
+{
+  state_t *state_seq;
+
+  if (mtx)
+    sbmtx_lock(mtx);
+  if (lphone)
+    state_seq = next_utt_states_mmie(n_state, lex, inv, mdef, word, lphone, rphone);
+  else
+    state_seq = next_utt_states(n_state, lex, inv, mdef, word);
+  if (mtx && state_seq)
+    state_seq = state_seq_copy(state_seq, *n_state);
+  if (mtx)
+    sbmtx_unlock(mtx);
+
+  return state_seq;
+}
+
+static void
+mmi_arc_states_free(state_t *state_seq, uint32 n_state, sbmtx_t *mtx)
+{
+  if (mtx && state_seq)
+    state_seq_free(state_seq, n_state);
+}
+
 /* mmie training: take random left and right context for viterbi run */
 int
 mmi_rand_train(model_inventory_t *inv,
@@ -1115,7 +1513,9 @@ mmi_rand_train(model_inventory_t *inv,
 	       float64 a_beam,
 	       uint32 mean_reest,
 	       uint32 var_reest,
-	       feat_t *fcb)
+	       feat_t *fcb,
+               sbmtx_t *mtx,
+               sbmtx_t *accum_mtx)
 {
   uint32 k, n;
   uint32 n_rand;/* random number */
@@ -1130,7 +1530,6 @@ mmi_rand_train(model_inventory_t *inv,
   float64 log_lik;/* log-likelihood of an arc */
   
   /* viterbi run on each arc */
-  printf(" %5u", lat->n_arcs);
   
   for(n=0; n<lat->n_arcs; n++) {
 
@@ -1147,9 +1546,6 @@ mmi_rand_train(model_inventory_t *inv,
        at most randomly pick context n_prev_arcs * n_next_arcs times */
     n_max_run = lat->arc[n].n_prev_arcs * lat->arc[n].n_next_arcs;
     
-    /* seed the random-number generator with current time */
-    srand( (unsigned)time( NULL ) );
-    
     /* randomly pick the left and right context */
     while (n_max_run > 0 && lat->arc[n].good_arc == 0) {
       
@@ -1184,7 +1580,7 @@ mmi_rand_train(model_inventory_t *inv,
 	strcpy(nword, lat->arc[rand_next_id-1].word);
       rphone = mk_boundary_phone(nword, 1, lex);
 
-      state_seq = next_utt_states_mmie(&n_state, lex, inv, mdef, cword, lphone, rphone);
+      state_seq = mmi_arc_states(&n_state, lex, inv, mdef, cword, lphone, rphone, mtx);
 
       /* viterbi compuation to get the acoustic score for a word hypothesis */
       if (mmi_viterbi_run(&log_lik,
@@ -1198,6 +1594,7 @@ mmi_rand_train(model_inventory_t *inv,
 	lat->arc[n].best_next_arc = rand_next_id;
       }
 
+      mmi_arc_states_free(state_seq, n_state, mtx);
       n_max_run--;
       ckd_free(lphone);
       ckd_free(rphone);
@@ -1243,7 +1640,7 @@ mmi_rand_train(model_inventory_t *inv,
       rphone = mk_boundary_phone(nword, 1, lex);
       
       /* make state list */
-      state_seq = next_utt_states_mmie(&n_state, lex, inv, mdef, cword, lphone, rphone);
+      state_seq = mmi_arc_states(&n_state, lex, inv, mdef, cword, lphone, rphone, mtx);
       
       /* viterbi update model parameters */
       if (mmi_viterbi_update(arc_f, n_word_obs,
@@ -1253,9 +1650,11 @@ mmi_rand_train(model_inventory_t *inv,
 			     mean_reest,
 			     var_reest,
 			     lat->arc[n].gamma,
-			     fcb) != S3_SUCCESS) {
+			     fcb,
+			     accum_mtx) != S3_SUCCESS) {
 	E_ERROR("arc_%d is ignored (viterbi update failed)\n", n+1);
       }
+      mmi_arc_states_free(state_seq, n_state, mtx);
       ckd_free(arc_f);
       ckd_free(lphone);
       ckd_free(rphone);
@@ -1275,7 +1674,9 @@ mmi_best_train(model_inventory_t *inv,
 	       float64 a_beam,
 	       uint32 mean_reest,
 	       uint32 var_reest,
-	       feat_t *fcb)
+	       feat_t *fcb,
+               sbmtx_t *mtx,
+               sbmtx_t *accum_mtx)
 {
   uint32 i, j, k, n;
   char pword[128], cword[128], nword[128];      /* previous, current and next word hypothesis */
@@ -1289,7 +1690,6 @@ mmi_best_train(model_inventory_t *inv,
   float64 log_lik;/* log-likelihood of an arc */
   
   /* viterbi run on each arc */
-  printf(" %5u", lat->n_arcs);
   
   for(n=0; n<lat->n_arcs; n++) {
     
@@ -1345,7 +1745,7 @@ mmi_best_train(model_inventory_t *inv,
 	  if (*rphone != prev_rphone || j == 0) {
 	        
 	    /* make state list */
-	    state_seq = next_utt_states_mmie(&n_state, lex, inv, mdef, cword, lphone, rphone);
+	    state_seq = mmi_arc_states(&n_state, lex, inv, mdef, cword, lphone, rphone, mtx);
 	        
 	    /* viterbi compuation to get the acoustic score for a word hypothesis */
 	    if (mmi_viterbi_run(&log_lik,
@@ -1365,6 +1765,7 @@ mmi_best_train(model_inventory_t *inv,
 		lat->arc[n].best_next_arc = lat->arc[n].next_arcs[j];
 	      }
 	    }
+	    mmi_arc_states_free(state_seq, n_state, mtx);
 	    /* save the current right context */
 	    prev_rphone = *rphone;
 	  }
@@ -1416,7 +1817,7 @@ mmi_best_train(model_inventory_t *inv,
       rphone = mk_boundary_phone(nword, 1, lex);
       
       /* make state list */
-      state_seq = next_utt_states_mmie(&n_state, lex, inv, mdef, cword, lphone, rphone);
+      state_seq = mmi_arc_states(&n_state, lex, inv, mdef, cword, lphone, rphone, mtx);
       
       /* viterbi update model parameters */
       if (mmi_viterbi_update(arc_f, n_word_obs,
@@ -1426,9 +1827,11 @@ mmi_best_train(model_inventory_t *inv,
 			     mean_reest,
 			     var_reest,
 			     lat->arc[n].gamma,
-			     fcb) != S3_SUCCESS) {
+			     fcb,
+			     accum_mtx) != S3_SUCCESS) {
 	E_ERROR("arc_%d is ignored (viterbi update failed)\n", n+1);
       }
+      mmi_arc_states_free(state_seq, n_state, mtx);
       ckd_free(arc_f);
       ckd_free(lphone);
       ckd_free(rphone);
@@ -1448,7 +1851,9 @@ mmi_ci_train(model_inventory_t *inv,
 	     float64 a_beam,
 	     uint32 mean_reest,
 	     uint32 var_reest,
-	     feat_t *fcb)
+	     feat_t *fcb,
+             sbmtx_t *mtx,
+             sbmtx_t *accum_mtx)
 {
   uint32 k, n;
   vector_t **arc_f = NULL;/* feature vector for a word arc */
@@ -1458,7 +1863,6 @@ mmi_ci_train(model_inventory_t *inv,
   float64 log_lik;/* log-likelihood of an arc */
   
   /* viterbi run on each arc */
-  printf(" %5u", lat->n_arcs);
 
   for(n=0; n<lat->n_arcs; n++) {
     
@@ -1472,7 +1876,7 @@ mmi_ci_train(model_inventory_t *inv,
       arc_f[k] = f[k+lat->arc[n].sf-1];
     
     /* make state list */
-    state_seq = next_utt_states(&n_state, lex, inv, mdef, lat->arc[n].word);
+    state_seq = mmi_arc_states(&n_state, lex, inv, mdef, lat->arc[n].word, NULL, NULL, mtx);
     
     /* viterbi compuation to get the acoustic score for a word hypothesis */
     if (mmi_viterbi_run(&log_lik,
@@ -1483,6 +1887,7 @@ mmi_ci_train(model_inventory_t *inv,
       lat->arc[n].good_arc = 1;
       lat->arc[n].ac_score = log_lik;
     }
+    mmi_arc_states_free(state_seq, n_state, mtx);
     
     ckd_free(arc_f);
     
@@ -1507,7 +1912,7 @@ mmi_ci_train(model_inventory_t *inv,
 	arc_f[k] = f[k+lat->arc[n].sf-1];
       
       /* make state list */
-      state_seq = next_utt_states(&n_state, lex, inv, mdef, lat->arc[n].word);
+      state_seq = mmi_arc_states(&n_state, lex, inv, mdef, lat->arc[n].word, NULL, NULL, mtx);
       
       /* viterbi update model parameters */
       if (mmi_viterbi_update(arc_f, n_word_obs,
@@ -1517,9 +1922,11 @@ mmi_ci_train(model_inventory_t *inv,
 			     mean_reest,
 			     var_reest,
 			     lat->arc[n].gamma,
-			     fcb) != S3_SUCCESS) {
+			     fcb,
+			     accum_mtx) != S3_SUCCESS) {
 	E_ERROR("arc_%d is ignored (viterbi update failed)\n", n+1);
       }
+      mmi_arc_states_free(state_seq, n_state, mtx);
       
       ckd_free(arc_f);
     }
@@ -1528,12 +1935,205 @@ mmi_ci_train(model_inventory_t *inv,
   return S3_SUCCESS;
 }
 
+static void
+lattice_free(s3lattice_t *lat)
+{
+  uint32 i;
+
+  for(i=0; i<lat->n_arcs; i++) {
+    ckd_free(lat->arc[i].prev_arcs);
+    ckd_free(lat->arc[i].next_arcs);
+  }
+  ckd_free(lat->arc);
+  ckd_free(lat);
+}
+
+/* accumulate density counts on the lattice of one utterance, by
+ * the type of mmie training selected with -mmie_type */
+static int
+mmi_train_lattice(model_inventory_t *inv,
+		  model_def_t *mdef,
+		  lexicon_t *lex,
+		  vector_t **f,
+		  s3lattice_t *lat,
+		  uint32 n_mmi_type,
+		  float64 a_beam,
+		  uint32 mean_reest,
+		  uint32 var_reest,
+		  feat_t *fcb,
+		  sbmtx_t *mtx,
+		  sbmtx_t *accum_mtx)
+{
+  switch (n_mmi_type) {
+    /* take random left and right context for viterbi run */
+  case 1:
+    return mmi_rand_train(inv, mdef, lex, f, lat, a_beam,
+			  mean_reest, var_reest, fcb, mtx, accum_mtx);
+    /* take the best left and right context for viterbi run */
+  case 2:
+    return mmi_best_train(inv, mdef, lex, f, lat, a_beam,
+			  mean_reest, var_reest, fcb, mtx, accum_mtx);
+    /* use context-independent hmms for word boundary models */
+  case 3:
+    return mmi_ci_train(inv, mdef, lex, f, lat, a_beam,
+			mean_reest, var_reest, fcb, mtx, accum_mtx);
+    /* mmi_type error */
+  default:
+    E_FATAL("Invalid -mmie_type, try rand, best or ci \n");
+  }
+  return S3_ERROR;
+}
+
+static int
+mmi_worker_main(sbthread_t *th)
+{
+    bw_worker_t *w = sbthread_arg(th);
+    bw_shared_t *sh = w->sh;
+    vector_t *mfcc;
+    int32 n_frame;
+    uint32 svd_n_frame;
+    vector_t **f;
+    uint32 seq_no;
+    char *uttid;
+    s3lattice_t *lat;
+    int ret = S3_ERROR;
+
+    for (;;) {
+	sbmtx_lock(sh->mtx);
+	if (!corpus_next_utt()) {
+	    sbmtx_unlock(sh->mtx);
+	    break;
+	}
+
+	if (corpus_get_generic_featurevec(&mfcc, &n_frame,
+					  sh->in_veclen) < 0) {
+	    E_FATAL("Can't read input features\n");
+	}
+
+	if (n_frame < 9) {
+	    E_WARN("utt %s too short\n", corpus_utt());
+	    if (mfcc) {
+		ckd_free(mfcc[0]);
+		ckd_free(mfcc);
+	    }
+	    sbmtx_unlock(sh->mtx);
+	    continue;
+	}
+
+	if ((sh->maxuttlen > 0) && (n_frame > sh->maxuttlen)) {
+	    E_INFO("utt # frames > -maxuttlen; skipping\n");
+	    sh->n_frame_skipped += n_frame;
+	    if (mfcc) {
+		ckd_free(mfcc[0]);
+		ckd_free(mfcc);
+	    }
+	    sbmtx_unlock(sh->mtx);
+	    continue;
+	}
+
+	seq_no = sh->seq_no++;
+	uttid = ckd_salloc(corpus_utt());
+
+	svd_n_frame = n_frame;
+	f = feat_array_alloc(sh->feat, n_frame + feat_window_size(sh->feat));
+	feat_s2mfc2feat_live(sh->feat, mfcc, &n_frame, TRUE, TRUE, f);
+
+	if (corpus_load_lattice(&lat, sh->lat_dir, sh->lat_ext) != S3_SUCCESS) {
+	    E_WARN("Can't read input lattice");
+	    lat = NULL;
+	}
+	sbmtx_unlock(sh->mtx);
+
+	/* The lattice forward-backward and the Viterbi runs on its arcs
+	 * go on alongside the other threads.  Arc state sequences are
+	 * made under mtx, and the counts added under accum_mtx. */
+	if (lat)
+	    ret = mmi_train_lattice(w->inv, sh->mdef, sh->lex, f, lat,
+				    sh->n_mmi_type, sh->a_beam,
+				    sh->mean_reest, sh->var_reest, sh->feat,
+				    sh->mtx, sh->accum_mtx);
+
+	sbmtx_lock(sh->mtx);
+	sh->n_utt++;
+	if (lat && ret == S3_SUCCESS)
+	    sh->total_log_postprob += lat->postprob;
+	else if (lat)
+	    sh->n_utt_fail++;
+	sbmtx_unlock(sh->mtx);
+
+	printf("utt> %5u %25s %4u %4u",
+	       seq_no, uttid, svd_n_frame, n_frame - svd_n_frame);
+	if (lat) {
+	    printf(" %5u", lat->n_arcs);
+	    if (ret == S3_SUCCESS)
+		printf("   %e", lat->postprob);
+	    lattice_free(lat);
+	}
+	printf("\n");
+	fflush(stdout);
+
+	free(mfcc[0]);
+	ckd_free(mfcc);
+	feat_array_free(f);
+	ckd_free(uttid);
+    }
+
+    return 0;
+}
+
+/*********************************************************************
+ *
+ * Function: 
+ *	mmi_reestimate_threaded
+ * 
+ * Description: 
+ *	MMIE accumulation using n_thread threads, each taking the next
+ *	utterance and its lattice from the corpus.  Like
+ *	main_reestimate_threaded(), each thread has its own
+ *	per-arc density sums, which are added to the global ones in inv.
+ *	The utterance counts and total posterior are returned in sh.
+ *
+ *********************************************************************/
+static void
+mmi_reestimate_threaded(bw_shared_t *sh,
+			model_inventory_t *inv,
+			int32 n_thread)
+{
+    bw_worker_t *workers;
+    int32 i;
+
+    E_INFO("MMIE accumulation, %d threads\n", n_thread);
+
+    sh->mtx = sbmtx_init();
+    sh->accum_mtx = sbmtx_init();
+
+    workers = ckd_calloc(n_thread, sizeof(*workers));
+    for (i = 0; i < n_thread; i++) {
+	workers[i].sh = sh;
+	workers[i].inv = worker_inv_init(inv);
+    }
+    for (i = 0; i < n_thread; i++) {
+	workers[i].thread = sbthread_start(NULL, mmi_worker_main, &workers[i]);
+	if (workers[i].thread == NULL)
+	    E_FATAL("Failed to start accumulation thread %d\n", i);
+    }
+    for (i = 0; i < n_thread; i++) {
+	sbthread_wait(workers[i].thread);
+	sbthread_free(workers[i].thread);
+	worker_inv_free(workers[i].inv);
+    }
+    ckd_free(workers);
+    sbmtx_free(sh->mtx);
+    sbmtx_free(sh->accum_mtx);
+}
+
 /* main mmie training program */
 void
 main_mmi_reestimate(model_inventory_t *inv,
 		    lexicon_t *lex,
 		    model_def_t *mdef,
-		    feat_t *feat)
+		    feat_t *feat,
+		    int32 n_thread)
 {
   vector_t *mfcc;/* utterance cepstra */
   int32 n_frame;/* # of cepstrum frames  */
@@ -1555,7 +2155,6 @@ main_mmi_reestimate(model_inventory_t *inv,
   s3lattice_t *lat = NULL;/* input lattice */
   float64 total_log_postprob = 0;/* total posterior probability of the correct hypotheses */
   uint32 n_utt_fail = 0;        /* number of sentences failed */
-  uint32 i;
 
   char *trans;
   uint32 in_veclen;
@@ -1605,6 +2204,8 @@ main_mmi_reestimate(model_inventory_t *inv,
   if (strcmp(mmi_type, "rand") == 0) {
     n_mmi_type = 1;
     printf("MMIE training: take random left and right context for Viterbi run \n");
+    /* seed the random-number generator with current time */
+    srand( (unsigned)time( NULL ) );
   }
   else if (strcmp(mmi_type, "best") == 0) {
     n_mmi_type = 2;
@@ -1663,123 +2264,97 @@ main_mmi_reestimate(model_inventory_t *inv,
 
   /* accumulate density for each training sentence */
   n_utt = 0;
-  while (corpus_next_utt()) {
-    printf("utt> %5u %25s",  seq_no, corpus_utt());
+  if (n_thread > 1) {
+    bw_shared_t sh;
+
+    memset(&sh, 0, sizeof(sh));
+    sh.lex = lex;
+    sh.mdef = mdef;
+    sh.feat = feat;
+    sh.a_beam = a_beam;
+    sh.in_veclen = in_veclen;
+    sh.maxuttlen = maxuttlen;
+    sh.mean_reest = mean_reest;
+    sh.var_reest = var_reest;
+    sh.seq_no = seq_no;
+    sh.lat_dir = lat_dir;
+    sh.lat_ext = lat_ext;
+    sh.n_mmi_type = n_mmi_type;
+    mmi_reestimate_threaded(&sh, inv, n_thread);
+    n_utt = sh.n_utt;
+    n_utt_fail = sh.n_utt_fail;
+    total_log_postprob = sh.total_log_postprob;
+  }
+  else {
+    while (corpus_next_utt()) {
+      printf("utt> %5u %25s",  seq_no, corpus_utt());
     
-    if (corpus_get_generic_featurevec(&mfcc, &n_frame, in_veclen) < 0) {
-	E_FATAL("Can't read input features\n");
-    }
+      if (corpus_get_generic_featurevec(&mfcc, &n_frame, in_veclen) < 0) {
+	  E_FATAL("Can't read input features\n");
+      }
     
-    printf(" %4u", n_frame);
+      printf(" %4u", n_frame);
       
-    if (n_frame < 9) {
-      E_WARN("utt %s too short\n", corpus_utt());
-      if (mfcc) {
-	ckd_free(mfcc[0]);
-	ckd_free(mfcc);
+      if (n_frame < 9) {
+        E_WARN("utt %s too short\n", corpus_utt());
+        if (mfcc) {
+	  ckd_free(mfcc[0]);
+	  ckd_free(mfcc);
+        }
+        continue;
       }
-      continue;
-    }
       
-    if ((maxuttlen > 0) && (n_frame > maxuttlen)) {
-      E_INFO("utt # frames > -maxuttlen; skipping\n");
-      n_frame_skipped += n_frame;
-      if (mfcc) {
-	ckd_free(mfcc[0]);
-	ckd_free(mfcc);
+      if ((maxuttlen > 0) && (n_frame > maxuttlen)) {
+        E_INFO("utt # frames > -maxuttlen; skipping\n");
+        n_frame_skipped += n_frame;
+        if (mfcc) {
+	  ckd_free(mfcc[0]);
+	  ckd_free(mfcc);
+        }
+        continue;
       }
-      continue;
-    }
       
   
-    svd_n_frame = n_frame;
+      svd_n_frame = n_frame;
       
-    f = feat_array_alloc(feat, n_frame + feat_window_size(feat));
-    feat_s2mfc2feat_live(feat, mfcc, &n_frame, TRUE, TRUE, f);
+      f = feat_array_alloc(feat, n_frame + feat_window_size(feat));
+      feat_s2mfc2feat_live(feat, mfcc, &n_frame, TRUE, TRUE, f);
       
-    printf(" %4u", n_frame - svd_n_frame);
+      printf(" %4u", n_frame - svd_n_frame);
       
-    /* Get the transcript */
-    corpus_get_sent(&trans);
-
-    /* accumulate density counts on lattice */
-    if (corpus_load_lattice(&lat, lat_dir, lat_ext) == S3_SUCCESS) {
-      
-      /* different type of mmie training */
-      switch (n_mmi_type) {
-	/* take random left and right context for viterbi run */
-      case 1:
-	{
-	  if (mmi_rand_train(inv, mdef, lex, f, lat,
-			     a_beam, mean_reest,
-			     var_reest, feat) == S3_SUCCESS) {
-	    total_log_postprob += lat->postprob;
-	    printf("   %e", lat->postprob);
-	  }
-	  else {
-	    n_utt_fail++;
-	  }
-	  break;
-	}
-	/* take the best left and right context for viterbi run */
-      case 2:
-	{
-	  if (mmi_best_train(inv, mdef, lex, f, lat,
-			      a_beam, mean_reest,
-			     var_reest, feat) == S3_SUCCESS) {
-	    total_log_postprob += lat->postprob;
-	    printf("   %e", lat->postprob);
-	  }
-	  else {
-	    n_utt_fail++;
-	  }
-	  break;
-	}
-	/* use context-independent hmms for word boundary models */
-      case 3:
-	{
-	  if (mmi_ci_train(inv, mdef, lex, f, lat,
-			   a_beam, mean_reest,
-			   var_reest, feat) == S3_SUCCESS) {
-	    total_log_postprob += lat->postprob;
-	    printf("   %e", lat->postprob);
-	  }
-	  else {
-	    n_utt_fail++;
-	  }
-	  break;
-	}
-	/* mmi_type error */
-      default:
-	{
-	  E_FATAL("Invalid -mmie_type, try rand, best or ci \n");
-	  break;
-	}
+      /* Get the transcript */
+      corpus_get_sent(&trans);
+
+      /* accumulate density counts on lattice */
+      if (corpus_load_lattice(&lat, lat_dir, lat_ext) == S3_SUCCESS) {
+        printf(" %5u", lat->n_arcs);
+        if (mmi_train_lattice(inv, mdef, lex, f, lat, n_mmi_type,
+			      a_beam, mean_reest, var_reest, feat,
+			      NULL, NULL) == S3_SUCCESS) {
+	  total_log_postprob += lat->postprob;
+	  printf("   %e", lat->postprob);
+        }
+        else {
+	  n_utt_fail++;
+        }
+        lattice_free(lat);
       }
-      
-      /* free memory for lattice */
-      for(i=0; i<lat->n_arcs; i++) {
-	ckd_free(lat->arc[i].prev_arcs);
-	ckd_free(lat->arc[i].next_arcs);
+      else {
+        E_WARN("Can't read input lattice");
       }
-      ckd_free(lat->arc);
-      ckd_free(lat);
-    }
-    else {
-      E_WARN("Can't read input lattice");
-    }
     
-    free(mfcc[0]);
-    ckd_free(mfcc);
-    feat_array_free(f);
-    free(trans);
+      free(mfcc[0]);
+      ckd_free(mfcc);
+      feat_array_free(f);
+      free(trans);
       
-    seq_no++;
-    n_utt++;
+      seq_no++;
+      n_utt++;
 
-    printf("\n");
+      printf("\n");
+    }
   }
-    
+
   printf ("overall> stats %u (-%u) %e %e",
 	  n_utt-n_utt_fail,
 	  n_utt_fail,
@@ -1833,17 +2408,32 @@ int main(int argc, char *argv[])
     lexicon_t *lex = NULL;
     model_def_t *mdef = NULL;
     feat_t *feat = NULL;
+    int32 n_thread;
     
     if (main_initialize(argc, argv,
 			&inv, &lex, &mdef, &feat) != S3_SUCCESS) {
 	E_FATAL("initialization failed\n");
     }
 
+    n_thread = cmd_ln_int32("-nthreads");
+    if (n_thread > 1
+	&& (cmd_ln_int32("-viterbi") || cmd_ln_int32("-fastviterbi")
+	    || cmd_ln_str("-ckptintv")
+	    || cmd_ln_str("-pdumpdir") || cmd_ln_str("-outphsegdir"))) {
+	E_WARN("-nthreads is not supported with -viterbi, -fastviterbi, "
+	       "-ckptintv, -pdumpdir or -outphsegdir; using one thread\n");
+	n_thread = 1;
+    }
+
     if (cmd_ln_int32("-mmie")) {
-      main_mmi_reestimate(inv, lex, mdef, feat);
+      main_mmi_reestimate(inv, lex, mdef, feat, n_thread);
+    }
+    else if (n_thread > 1) {
+      main_reestimate_threaded(inv, lex, mdef, feat, n_thread);
     }
     else {
-      main_reestimate(inv, lex, mdef, feat, cmd_ln_int32("-viterbi"));
+      main_reestimate(inv, lex, mdef, feat,
+		      cmd_ln_int32("-viterbi") || cmd_ln_int32("-fastviterbi"));
     }
     
     if (feat)
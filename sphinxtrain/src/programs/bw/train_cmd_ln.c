@@ -491,6 +491,11 @@ If yo want to do parallel training for N machines. Run N trainers with \n\
 	  ARG_BOOLEAN,
 	  "no",
 	  "Controls whether Viterbi training is done"},
+
+	{ "-fastviterbi",
+	  ARG_BOOLEAN,
+	  "no",
+	  "Viterbi training from a beam search with integer scores instead of the forward pass, for early iterations and large corpora.  Implies -viterbi; -abeam is its beam"},
 	
 	{ "-2passvar",
 	  ARG_BOOLEAN,
@@ -506,6 +511,16 @@ If yo want to do parallel training for N machines. Run N trainers with \n\
 	  ARG_INT32,
 	  "0",
 	  "Maximum # of frames for an utt ( 0 => no fixed limit )"},
+
+	{ "-nthreads",
+	  ARG_INT32,
+	  "1",
+	  "Number of threads accumulating Baum-Welch or MMIE counts.  Per-utterance log lines of different threads may be interleaved" },
+
+	{ "-prefetch",
+	  ARG_INT32,
+	  "0",
+	  "Number of utts whose features and transcripts a background thread reads ahead ( 0 => read each utt when it is needed )" },
 	
 	{ "-ckptintv",
 	  ARG_INT32,
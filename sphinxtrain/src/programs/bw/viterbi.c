@@ -64,6 +64,7 @@
 
 #include <math.h>
 #include <string.h>
+#include <stdlib.h>
 #include <assert.h>
 #include <stdio.h>
 
@@ -693,6 +694,656 @@ viterbi_update(float64 *log_forw_prob,
     return ret;
 }
 
+/* Scores of the search in viterbi_fast_update(), in units of
+ * log(1.0001), relative to the best one of the frame.  Low enough to
+ * be below any beam and to add two of without overflow. */
+#define VIT_WORST_SCORE ((int32)-0x20000000)
+
+/* An entry of the Viterbi history: a state at some frame, and the
+ * entry it was reached from on the best path into it.  That is in the
+ * previous frame if the state is emitting, and in the same frame if
+ * not. */
+typedef struct vit_hist_s {
+    uint32 state;
+    int32 prev;
+} vit_hist_t;
+
+/* log(sum_k w[f][k] den[f][k]) over all feature streams f from the
+ * log densities computed by gauden_compute_log(), in log(1.0001)
+ * units. */
+static int32
+vit_log_outprob(float64 **den,
+		uint32 **den_idx,
+		float32 **w,
+		gauden_t *g)
+{
+    float64 lp, max, sum;
+    uint32 j, kk;
+
+    lp = 0;
+    for (j = 0; j < g->n_feat; j++) {
+	max = den[j][0];
+	for (kk = 1; kk < g->n_top; kk++)
+	    if (den[j][kk] > max)
+		max = den[j][kk];
+	sum = 0;
+	for (kk = 0; kk < g->n_top; kk++)
+	    sum += w[j][den_idx[j][kk]] * exp(den[j][kk] - max);
+	if (sum <= 0)
+	    return VIT_WORST_SCORE;
+	lp += max + log(sum);
+    }
+    lp *= INVLOGS3;
+    if (lp <= VIT_WORST_SCORE)
+	return VIT_WORST_SCORE;
+
+    return (int32)lp;
+}
+
+static int
+vit_cmp_state(const void *a, const void *b)
+{
+    uint32 x = *(const uint32 *)a;
+    uint32 y = *(const uint32 *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*********************************************************************
+ *
+ * Function: 
+ * 	viterbi_search
+ *
+ * Description: 
+ *	Best path search through the sentence HMM with integer scores.
+ *	Only states whose entry score is within the beam of the best
+ *	one have their output densities computed, and the history keeps
+ *	a single backpointer per active state.  On success, *out_hist
+ *	is the history, *out_final the entry of the final state in the
+ *	last frame and *out_log_lik the natural log of the best path
+ *	probability.
+ *
+ *********************************************************************/
+static int32
+viterbi_search(vit_hist_t **out_hist,
+	       int32 *out_final,
+	       float64 *out_log_lik,
+	       vector_t **feature,
+	       uint32 n_obs,
+	       state_t *state_seq,
+	       uint32 n_state,
+	       model_inventory_t *inv,
+	       float64 a_beam,
+	       s3phseg_t *phseg)
+{
+    gauden_t *g;
+    float32 ***mixw;
+    acmod_set_t *as;
+    uint32 n_l_cb, l_cb;
+    float64 ***now_den;
+    uint32 ***now_den_idx;
+    uint32 *acbframe;	/* Frame in which a codebook was last computed */
+    int32 **ltprob;	/* Log transition probabilities */
+    int32 *score, *nscore, *tmp;
+    int32 *hidx;	/* History entry of each state in its last frame */
+    int32 *nbp;		/* Best predecessor entry of each state */
+    uint32 *stamp;	/* Frame in which each state was last entered */
+    uint32 *active, *nactive, *ptmp;
+    uint32 n_active, n_nactive;
+    vit_hist_t *hist;
+    uint32 n_hist, n_hist_alloc, frame_hist;
+    int32 beam, best, best_in, x, op;
+    float64 norm;
+    uint32 i, j, k, s, u, t, n, total_next, n_sum_active;
+    int can_prune_phseg;
+    int32 retval = S3_SUCCESS;
+
+    g = inv->gauden;
+    mixw = inv->mixw;
+    as = inv->mdef->acmod_set;
+    n_l_cb = inv->n_cb_inverse;
+
+    if (state_seq[0].mixw == TYING_NON_EMITTING) {
+	E_ERROR("Initial state is non-emitting\n");
+	return S3_ERROR;
+    }
+
+    beam = VIT_WORST_SCORE;
+    if (a_beam > 0 && log(a_beam) * INVLOGS3 > VIT_WORST_SCORE)
+	beam = (int32)(log(a_beam) * INVLOGS3);
+
+    now_den = (float64 ***)ckd_calloc_3d(n_l_cb, gauden_n_feat(g), gauden_n_top(g),
+					 sizeof(float64));
+    now_den_idx = (uint32 ***)ckd_calloc_3d(n_l_cb, gauden_n_feat(g), gauden_n_top(g),
+					    sizeof(uint32));
+    acbframe = ckd_calloc(n_l_cb, sizeof(*acbframe));
+    for (i = 0; i < n_l_cb; i++)
+	acbframe[i] = (uint32)-1;
+
+    /* Transition probabilities are taken to the log domain once per
+     * utterance rather than on every frame. */
+    for (i = 0, total_next = 0; i < n_state; i++)
+	total_next += state_seq[i].n_next;
+    ltprob = ckd_calloc(n_state, sizeof(*ltprob));
+    ltprob[0] = ckd_calloc(total_next > 0 ? total_next : 1, sizeof(int32));
+    for (i = 0; i < n_state; i++) {
+	if (i > 0)
+	    ltprob[i] = ltprob[i-1] + state_seq[i-1].n_next;
+	for (u = 0; u < state_seq[i].n_next; u++) {
+	    float64 tp = state_seq[i].next_tprob[u];
+	    ltprob[i][u] = (tp > 0 && log(tp) * INVLOGS3 > VIT_WORST_SCORE)
+		? (int32)(log(tp) * INVLOGS3) : VIT_WORST_SCORE;
+	}
+    }
+
+    score = ckd_calloc(n_state, sizeof(*score));
+    nscore = ckd_calloc(n_state, sizeof(*nscore));
+    hidx = ckd_calloc(n_state, sizeof(*hidx));
+    nbp = ckd_calloc(n_state, sizeof(*nbp));
+    stamp = ckd_calloc(n_state, sizeof(*stamp));
+    for (i = 0; i < n_state; i++)
+	stamp[i] = (uint32)-1;
+    active = ckd_calloc(n_state, sizeof(*active));
+    nactive = ckd_calloc(n_state, sizeof(*nactive));
+
+    n_hist_alloc = n_obs * 4;
+    hist = ckd_calloc(n_hist_alloc, sizeof(*hist));
+    n_hist = 0;
+    frame_hist = 0;
+
+    norm = 0;
+    n_active = 0;
+    n_sum_active = 0;
+    for (t = 0; t < n_obs; t++) {
+	if (t == 0) {
+	    /* The initial state only */
+	    l_cb = state_seq[0].l_cb;
+	    gauden_compute_log(now_den[l_cb], now_den_idx[l_cb],
+			       feature[0], g, state_seq[0].cb, NULL);
+	    acbframe[l_cb] = 0;
+	    best = vit_log_outprob(now_den[l_cb], now_den_idx[l_cb],
+				   mixw[state_seq[0].mixw], g);
+	    if (best <= VIT_WORST_SCORE) {
+		E_ERROR("Small output prob seen at frame 0 state 0\n");
+		retval = S3_ERROR;
+		break;
+	    }
+	    nscore[0] = 0;
+	    nbp[0] = -1;
+	    stamp[0] = 0;
+	    nactive[0] = 0;
+	    n_nactive = 1;
+	    norm = best;
+	}
+	else {
+	    /* Enter the emitting successors of the states active in
+	     * the previous frame. */
+	    n_nactive = 0;
+	    best_in = VIT_WORST_SCORE;
+	    for (s = 0; s < n_active; s++) {
+		i = active[s];
+		for (u = 0; u < state_seq[i].n_next; u++) {
+		    j = state_seq[i].next_state[u];
+		    if (state_seq[j].mixw == TYING_NON_EMITTING)
+			continue;
+		    x = score[i] + ltprob[i][u];
+		    if (stamp[j] != t) {
+			stamp[j] = t;
+			nscore[j] = x;
+			nbp[j] = hidx[i];
+			nactive[n_nactive++] = j;
+		    }
+		    else if (x > nscore[j]) {
+			nscore[j] = x;
+			nbp[j] = hidx[i];
+		    }
+		    if (x > best_in)
+			best_in = x;
+		}
+	    }
+
+	    /* Compute output densities for those entered within the
+	     * beam. */
+	    best = VIT_WORST_SCORE;
+	    for (s = 0, n = 0; s < n_nactive; s++) {
+		j = nactive[s];
+		if (nscore[j] < best_in + beam)
+		    continue;
+		l_cb = state_seq[j].l_cb;
+		if (acbframe[l_cb] != t) {
+		    gauden_compute_log(now_den[l_cb],
+				       now_den_idx[l_cb],
+				       feature[t],
+				       g,
+				       state_seq[j].cb,
+				       n_l_cb == 1 ? now_den_idx[l_cb] : NULL);
+		    acbframe[l_cb] = t;
+		}
+		op = vit_log_outprob(now_den[l_cb], now_den_idx[l_cb],
+				     mixw[state_seq[j].mixw], g);
+		if (op <= VIT_WORST_SCORE)
+		    continue;
+		nscore[j] += op;
+		if (nscore[j] > best)
+		    best = nscore[j];
+		nactive[n++] = j;
+	    }
+	    n_nactive = n;
+	    if (n_nactive == 0) {
+		E_ERROR("No active states at time %u\n", t);
+		retval = S3_ERROR;
+		break;
+	    }
+
+	    /* Prune to the beam, or to the phone segmentation if it
+	     * would leave anything. */
+	    if (phseg && t > phseg->ef)
+		phseg = phseg->next;
+	    can_prune_phseg = 0;
+	    if (phseg) {
+		for (s = 0; s < n_nactive; s++)
+		    if (acmod_set_base_phone(as, state_seq[nactive[s]].phn)
+			== acmod_set_base_phone(as, phseg->phone))
+			break;
+		can_prune_phseg = (s < n_nactive);
+	    }
+	    for (s = 0, n = 0; s < n_nactive; s++) {
+		j = nactive[s];
+		if (can_prune_phseg) {
+		    if (acmod_set_base_phone(as, state_seq[j].phn)
+			!= acmod_set_base_phone(as, phseg->phone))
+			continue;
+		}
+		else if (nscore[j] < best + beam) {
+		    continue;
+		}
+		nscore[j] -= best;
+		nactive[n++] = j;
+	    }
+	    n_nactive = n;
+	    norm += best;
+	}
+
+	/* Record the surviving states in the history, in state order,
+	 * adding the non-emitting states reached from them, which
+	 * always follow their predecessors. */
+	qsort(nactive, n_nactive, sizeof(*nactive), vit_cmp_state);
+	frame_hist = n_hist;
+	for (s = 0; s < n_nactive; s++) {
+	    i = nactive[s];
+	    if (n_hist == n_hist_alloc) {
+		n_hist_alloc *= 2;
+		hist = ckd_realloc(hist, n_hist_alloc * sizeof(*hist));
+	    }
+	    hist[n_hist].state = i;
+	    hist[n_hist].prev = nbp[i];
+	    hidx[i] = n_hist++;
+
+	    for (u = 0; u < state_seq[i].n_next; u++) {
+		j = state_seq[i].next_state[u];
+		if (state_seq[j].mixw != TYING_NON_EMITTING)
+		    continue;
+		x = nscore[i] + ltprob[i][u];
+		if (x < beam)
+		    continue;
+		if (stamp[j] != t) {
+		    stamp[j] = t;
+		    nscore[j] = x;
+		    nbp[j] = hidx[i];
+		    for (k = n_nactive; k > s + 1 && nactive[k-1] > j; k--)
+			nactive[k] = nactive[k-1];
+		    nactive[k] = j;
+		    n_nactive++;
+		}
+		else if (x > nscore[j]) {
+		    nscore[j] = x;
+		    nbp[j] = hidx[i];
+		}
+	    }
+	}
+
+	tmp = score;
+	score = nscore;
+	nscore = tmp;
+	ptmp = active;
+	active = nactive;
+	nactive = ptmp;
+	n_active = n_nactive;
+	n_sum_active += n_active;
+    }
+
+    if (retval == S3_SUCCESS) {
+	i = n_state - 1;
+	if (stamp[i] != n_obs - 1
+	    || hidx[i] < (int32)frame_hist || hist[hidx[i]].state != i) {
+	    E_ERROR("Failed to align audio to trancript: final state of the search is not reached\n");
+	    retval = S3_ERROR;
+	}
+	else {
+	    *out_final = hidx[i];
+	    *out_log_lik = (norm + score[i]) / INVLOGS3;
+	}
+    }
+    printf(" %u ", n_sum_active / n_obs);
+
+    if (retval == S3_SUCCESS)
+	*out_hist = hist;
+    else
+	ckd_free(hist);
+    ckd_free(active);
+    ckd_free(nactive);
+    ckd_free(stamp);
+    ckd_free(nbp);
+    ckd_free(hidx);
+    ckd_free(nscore);
+    ckd_free(score);
+    ckd_free(ltprob[0]);
+    ckd_free(ltprob);
+    ckd_free(acbframe);
+    ckd_free_3d((void ***)now_den);
+    ckd_free_3d((void ***)now_den_idx);
+
+    return retval;
+}
+
+/*********************************************************************
+ *
+ * Function: 
+ * 	viterbi_fast_update
+ *
+ * Description: 
+ *	Viterbi training without the forward pass.  The best path is
+ *	found with integer log-domain scores and beam pruning, then
+ *	each frame's observation is counted for the one state on it,
+ *	as in viterbi_update().  *log_forw_prob is the log probability
+ *	of the best path rather than of all paths.
+ *
+ *********************************************************************/
+int32
+viterbi_fast_update(float64 *log_forw_prob,
+		    vector_t **feature,
+		    uint32 n_obs,
+		    state_t *state_seq,
+		    uint32 n_state,
+		    model_inventory_t *inv,
+		    float64 a_beam,
+		    s3phseg_t *phseg,
+		    int32 mixw_reest,
+		    int32 tmat_reest,
+		    int32 mean_reest,
+		    int32 var_reest,
+		    int32 pass2var,
+		    int32 var_is_full,
+		    FILE *pdumpfh,
+		    bw_timers_t *timers,
+		    feat_t *fcb)
+{
+    vit_hist_t *hist = NULL;
+    int32 e, final;
+    gauden_t *g;
+    float32 ***mixw;
+    float64 ***now_den = NULL;
+    uint32 ***now_den_idx = NULL;
+    uint32 active_cb[2];
+    uint32 n_active_cb;
+    float32 **tacc;
+    float32 ***wacc;
+    float32 ***denacc = NULL;
+    size_t denacc_size;
+    uint32 n_lcl_cb;
+    uint32 *cb_inv;
+    uint32 i, j;
+    int32 t;
+    uint32 n_feat;
+    uint32 n_density;
+    uint32 n_top;
+    uint32 n_cb;
+    uint32 max_n_next = 0;
+    float64 *p_op, *p_ci_op;
+    float64 **d_term, **d_term_ci;
+    int ret;
+
+    assert(n_obs > 0);
+    assert(n_state > 0);
+
+    g = inv->gauden;
+    n_feat = gauden_n_feat(g);
+    n_density = gauden_n_density(g);
+    n_top = gauden_n_top(g);
+    n_cb = gauden_n_mgau(g);
+    mixw = inv->mixw;
+
+    if (timers)
+	ptmr_start(&timers->fwd_timer);
+    ret = viterbi_search(&hist, &final, log_forw_prob,
+			 feature, n_obs, state_seq, n_state,
+			 inv, a_beam, phseg);
+    if (timers)
+	ptmr_stop(&timers->fwd_timer);
+    if (ret != S3_SUCCESS)
+	return ret;
+
+    p_op    = ckd_calloc(n_feat, sizeof(float64));
+    p_ci_op = ckd_calloc(n_feat, sizeof(float64));
+    d_term    = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
+    d_term_ci = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
+
+    if (mixw_reest) {
+	/* Need to reallocate mixing accumulators for utt */
+	if (inv->l_mixw_acc) {
+	    ckd_free_3d((void ***)inv->l_mixw_acc);
+	    inv->l_mixw_acc = NULL;
+	}
+	inv->l_mixw_acc = (float32 ***)ckd_calloc_3d(inv->n_mixw_inverse,
+						     n_feat,
+						     n_density,
+						     sizeof(float32));
+    }
+    wacc = inv->l_mixw_acc;
+    n_lcl_cb = inv->n_cb_inverse;
+    cb_inv = inv->cb_inverse;
+
+    gauden_alloc_l_acc(g, n_lcl_cb,
+		       mean_reest, var_reest,
+		       var_is_full);
+
+    if (tmat_reest) {
+	if (inv->l_tmat_acc) {
+	    ckd_free_2d((void **)inv->l_tmat_acc);
+	    inv->l_tmat_acc = NULL;
+	}
+	for (i = 0; i < n_state; i++) {
+	    if (state_seq[i].n_next > max_n_next)
+		max_n_next = state_seq[i].n_next;
+	}
+	inv->l_tmat_acc = (float32 **)ckd_calloc_2d(n_state,
+						    max_n_next,
+						    sizeof(float32));
+    }
+    tacc = inv->l_tmat_acc;
+
+    now_den = (float64 ***)ckd_calloc_3d(n_lcl_cb,
+					 n_feat,
+					 n_top,
+					 sizeof(float64));
+    now_den_idx =  (uint32 ***)ckd_calloc_3d(n_lcl_cb,
+					     n_feat,
+					     n_top,
+					     sizeof(uint32));
+
+    if (mean_reest || var_reest) {
+	denacc = (float32 ***)ckd_calloc_3d(n_lcl_cb,
+					    n_feat,
+					    n_density,
+					    sizeof(float32));
+	denacc_size = n_lcl_cb * n_feat * n_density * sizeof(float32);
+    }
+    else {
+	denacc = NULL;
+	denacc_size = 0;
+    }
+
+    /* Follow the best path back from the final state, counting each
+     * transition on it and each frame for its emitting state. */
+    t = n_obs - 1;
+    for (e = final; e >= 0; e = hist[e].prev) {
+	uint32 l_cb;
+	uint32 l_ci_cb;
+	float64 op, p_reest_term;
+	float64 *max_den;
+
+	j = hist[e].state;
+	if (tmat_reest && hist[e].prev >= 0) {
+	    i = hist[hist[e].prev].state;
+	    tacc[i][j - i] += 1.0;
+	}
+	if (state_seq[j].mixw == TYING_NON_EMITTING)
+	    continue;
+	assert(t >= 0);
+
+	if (timers)
+	    ptmr_start(&timers->gau_timer);
+	l_cb = state_seq[j].l_cb;
+	l_ci_cb = state_seq[j].l_ci_cb;
+	n_active_cb = 0;
+	gauden_compute_log(now_den[l_cb],
+			   now_den_idx[l_cb],
+			   feature[t],
+			   g,
+			   state_seq[j].cb,
+			   NULL);
+	active_cb[n_active_cb++] = l_cb;
+	if (l_cb != l_ci_cb) {
+	    gauden_compute_log(now_den[l_ci_cb],
+			       now_den_idx[l_ci_cb],
+			       feature[t],
+			       g,
+			       state_seq[j].ci_cb,
+			       NULL);
+	    active_cb[n_active_cb++] = l_ci_cb;
+	}
+	/* The scale cancels out of the density posteriors below. */
+	max_den = gauden_scale_densities_fwd(now_den, now_den_idx,
+					     active_cb, n_active_cb, g);
+	ckd_free(max_den);
+
+	op = gauden_mixture(now_den[l_cb], now_den_idx[l_cb],
+			    mixw[state_seq[j].mixw], g);
+	if (timers)
+	    ptmr_stop(&timers->gau_timer);
+
+	if (timers)
+	    ptmr_start(&timers->rsts_timer);
+	p_reest_term = 1.0 / op;
+	partial_op(p_op,
+		   op,
+		   now_den[l_cb],
+		   now_den_idx[l_cb],
+		   mixw[state_seq[j].mixw],
+		   n_feat,
+		   n_top);
+	den_terms(d_term,
+		  p_reest_term,
+		  p_op,
+		  now_den[l_cb],
+		  now_den_idx[l_cb],
+		  mixw[state_seq[j].mixw],
+		  n_feat,
+		  n_top);
+	if (l_cb != l_ci_cb) {
+	    partial_ci_op(p_ci_op,
+			  now_den[l_ci_cb],
+			  now_den_idx[l_ci_cb],
+			  mixw[state_seq[j].ci_mixw],
+			  n_feat,
+			  n_top);
+	    den_terms_ci(d_term_ci,
+			 1.0, /* post_j = 1.0 */
+			 p_ci_op,
+			 now_den[l_ci_cb],
+			 now_den_idx[l_ci_cb],
+			 mixw[state_seq[j].ci_mixw],
+			 n_feat,
+			 n_top);
+	}
+
+	if (mixw_reest) {
+	    accum_den_terms(wacc[state_seq[j].l_mixw], d_term,
+			    now_den_idx[l_cb], n_feat, n_top);
+	    /* check if mixw and ci_mixw are different to avoid
+	     * doubling the EM counts in a CI run. */
+	    if (state_seq[j].mixw != state_seq[j].ci_mixw) {
+		if (n_cb < inv->n_mixw) {
+		    /* semi-continuous, tied mixture, and discrete case */
+		    accum_den_terms(wacc[state_seq[j].l_ci_mixw], d_term,
+				    now_den_idx[l_cb], n_feat, n_top);
+		}
+		else {
+		    /* continuous case */
+		    accum_den_terms(wacc[state_seq[j].l_ci_mixw], d_term_ci,
+				    now_den_idx[l_ci_cb], n_feat, n_top);
+		}
+	    }
+	}
+
+	if (mean_reest || var_reest) {
+	    accum_den_terms(denacc[l_cb], d_term,
+			    now_den_idx[l_cb], n_feat, n_top);
+	    if (l_cb != l_ci_cb) {
+		accum_den_terms(denacc[l_ci_cb], d_term_ci,
+				now_den_idx[l_ci_cb], n_feat, n_top);
+	    }
+	}
+	if (timers)
+	    ptmr_stop(&timers->rsts_timer);
+
+	if (timers)
+	    ptmr_start(&timers->rstf_timer);
+	if (mean_reest || var_reest) {
+	    if (pdumpfh)
+		fprintf(pdumpfh, "time %d:\n", t);
+	    accum_gauden(denacc,
+			 cb_inv,
+			 n_lcl_cb,
+			 feature[t],
+			 now_den_idx,
+			 g,
+			 mean_reest,
+			 var_reest,
+			 pass2var,
+			 inv->l_mixw_acc,
+			 var_is_full,
+			 pdumpfh,
+			 fcb);
+	    memset(&denacc[0][0][0], 0, denacc_size);
+	}
+	if (timers)
+	    ptmr_stop(&timers->rstf_timer);
+	--t;
+    }
+    assert(t == -1);
+
+    if (timers)
+	ptmr_start(&timers->rstu_timer);
+    accum_global(inv, state_seq, n_state,
+		 mixw_reest, tmat_reest, mean_reest, var_reest,
+		 var_is_full);
+    if (timers)
+	ptmr_stop(&timers->rstu_timer);
+
+    ckd_free(hist);
+    ckd_free(p_op);
+    ckd_free(p_ci_op);
+    ckd_free_2d((void **)d_term);
+    ckd_free_2d((void **)d_term_ci);
+    if (denacc)
+	ckd_free_3d((void ***)denacc);
+    ckd_free_3d((void ***)now_den);
+    ckd_free_3d((void ***)now_den_idx);
+
+    return S3_SUCCESS;
+}
+
 int32
 mmi_viterbi_run(float64 *log_forw_prob,
 		vector_t **feature,
@@ -804,7 +1455,8 @@ mmi_viterbi_update(vector_t **feature,
 		   int32 mean_reest,
 		   int32 var_reest,
 		   float64 arc_gamma,
-		   feat_t *fcb)
+		   feat_t *fcb,
+		   sbmtx_t *accum_mtx)
 {
     float64 *scale = NULL;
     float64 **dscale = NULL;
@@ -831,10 +1483,10 @@ mmi_viterbi_update(vector_t **feature,
     int ret;
     uint32 n_cb;
 
-    static float64 *p_op = NULL;
-    static float64 *p_ci_op = NULL;
-    static float64 **d_term = NULL;
-    static float64 **d_term_ci = NULL;
+    float64 *p_op;
+    float64 *p_ci_op;
+    float64 **d_term;
+    float64 **d_term_ci;
 
     /* caller must ensure that there is some non-zero amount
        of work to be done here */
@@ -847,15 +1499,12 @@ mmi_viterbi_update(vector_t **feature,
     n_top = gauden_n_top(g);
     n_cb = gauden_n_mgau(g);
 
-    if (p_op == NULL) {
-	p_op    = ckd_calloc(n_feat, sizeof(float64));
-	p_ci_op = ckd_calloc(n_feat, sizeof(float64));
-    }
-
-    if (d_term == NULL) {
-	d_term    = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
-	d_term_ci = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
-    }
+    /* Not static, as several threads may be updating from different
+     * utterances at once. */
+    p_op    = ckd_calloc(n_feat, sizeof(float64));
+    p_ci_op = ckd_calloc(n_feat, sizeof(float64));
+    d_term    = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
+    d_term_ci = (float64 **)ckd_calloc_2d(n_feat, n_top, sizeof(float64));
 
     scale = (float64 *)ckd_calloc(n_obs, sizeof(float64));
     dscale = (float64 **)ckd_calloc(n_obs, sizeof(float64 *));
@@ -1066,11 +1715,19 @@ mmi_viterbi_update(vector_t **feature,
 
     /* If no error was found, add the resulting utterance reestimation
      * accumulators to the global reestimation accumulators */
+    if (accum_mtx)
+	sbmtx_lock(accum_mtx);
     accum_global(inv, state_seq, n_state,
 		 FALSE, FALSE, mean_reest, var_reest,
 		 FALSE);
+    if (accum_mtx)
+	sbmtx_unlock(accum_mtx);
 
  all_done:
+    ckd_free(p_op);
+    ckd_free(p_ci_op);
+    ckd_free_2d((void **)d_term);
+    ckd_free_2d((void **)d_term_ci);
     ckd_free((void *)scale);
     for (i = 0; i < n_obs; i++) {
 	if (dscale[i])
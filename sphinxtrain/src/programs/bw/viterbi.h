@@ -97,6 +97,25 @@ viterbi_update(float64 *log_forw_prob,
 	       bw_timers_t *timers,
 	       feat_t *fcb);
 
+int32
+viterbi_fast_update(float64 *log_forw_prob,
+		    vector_t **feature,
+		    uint32 n_obs,
+		    state_t *state,
+		    uint32 n_state,
+		    model_inventory_t *inv,
+		    float64 a_beam,
+		    s3phseg_t *phseg,
+		    int32 mixw_reest,
+		    int32 tmat_reest,
+		    int32 mean_reest,
+		    int32 var_reest,
+		    int32 pass2var,
+		    int32 var_is_full,
+		    FILE *pdumpfh,
+		    bw_timers_t *timers,
+		    feat_t *fcb);
+
 int32
 mmi_viterbi_run(float64 *log_forw_prob,
 		vector_t **feature,
@@ -116,7 +135,8 @@ mmi_viterbi_update(vector_t **feature,
 		   int32 mean_reest,
 		   int32 var_reest,
 		   float64 arc_gamma,
-		   feat_t *fcb);
+		   feat_t *fcb,
+		   sbmtx_t *accum_mtx);
 
 #endif /* VITERBI_H */ 
 
@@ -76,6 +76,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <sphinxbase/sbthread.h>
 #include "header.h"
 
 #define  QUIT(x)  {printf x; fflush (stdout); exit(-1);}
@@ -129,6 +130,115 @@ float Expectation(float *Tau,	/* Mode probablity of observation vector x */
 }
 
 
+/*----------------------------------------------------------------------------
+  The frames [beg, end) of one EM pass, with the accumulators of the
+  thread that goes over them.  A pass accumulates the counts, means and
+  log probability, or the variances about center[][], or both.
+------------------------------------------------------------------------------*/
+typedef struct em_job_s {
+	float **x;
+	int beg, end;
+	int Ndim, K;
+	float *c, **mean, **hafinvvar, *corprod;
+	int do_mean;		/* Accumulate Newc, Newmean and LogProb */
+	float **center;		/* Accumulate Newvar about these if not NULL */
+	float *Newc, **Newmean, **Newvar, *Tau;
+	float LogProb;
+} em_job_t;
+
+static int em_pass_range(em_job_t *job)
+{
+	float **x = job->x;
+	float *Tau = job->Tau;
+	int i, j, k;
+
+	for (i = job->beg; i < job->end; ++i) {
+		float p = Expectation(Tau, x[i], job->c, job->mean,
+				      job->hafinvvar, job->corprod,
+				      job->K, job->Ndim);
+		if (job->do_mean)
+			job->LogProb += p;
+		for (k = 0; k < job->K; ++k) {
+			if (Tau[k] > 0) {
+				if (job->do_mean) {
+					job->Newc[k] += Tau[k];
+					for (j = 0; j < job->Ndim; ++j)
+						job->Newmean[k][j] +=
+						    Tau[k] * x[i][j];
+				}
+				if (job->center) {
+					for (j = 0; j < job->Ndim; ++j)
+						job->Newvar[k][j] +=
+						    Tau[k] * (x[i][j] -
+							      job->center[k][j])
+						    * (x[i][j] - job->center[k][j]);
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static int em_pass_thread(sbthread_t *th)
+{
+	return em_pass_range((em_job_t *)sbthread_arg(th));
+}
+
+/*----------------------------------------------------------------------------
+  Run one pass over all frames in n_thread threads, each with its own
+  accumulators, and add theirs to those of the first in thread order.
+------------------------------------------------------------------------------*/
+static float em_pass(em_job_t *job, int n_thread, int do_mean, float **center)
+{
+	sbthread_t **th;
+	int t, j, k;
+
+	th = (sbthread_t **) ckd_calloc(n_thread, sizeof(sbthread_t *));
+	for (t = 0; t < n_thread; ++t) {
+		job[t].do_mean = do_mean;
+		job[t].center = center;
+		job[t].LogProb = 0;
+		if (t == 0)
+			continue;
+		for (k = 0; k < job[t].K; ++k) {
+			job[t].Newc[k] = 0;
+			for (j = 0; j < job[t].Ndim; ++j) {
+				job[t].Newmean[k][j] = 0;
+				job[t].Newvar[k][j] = 0;
+			}
+		}
+		th[t] = sbthread_start(NULL, em_pass_thread, &job[t]);
+		if (th[t] == NULL) {
+			E_WARN("Failed to start EM thread; running it here\n");
+			em_pass_range(&job[t]);
+		}
+	}
+	em_pass_range(&job[0]);
+	for (t = 1; t < n_thread; ++t) {
+		if (th[t]) {
+			sbthread_wait(th[t]);
+			sbthread_free(th[t]);
+		}
+		job[0].LogProb += job[t].LogProb;
+		for (k = 0; k < job[0].K; ++k) {
+			if (do_mean) {
+				job[0].Newc[k] += job[t].Newc[k];
+				for (j = 0; j < job[0].Ndim; ++j)
+					job[0].Newmean[k][j] +=
+					    job[t].Newmean[k][j];
+			}
+			if (center) {
+				for (j = 0; j < job[0].Ndim; ++j)
+					job[0].Newvar[k][j] +=
+					    job[t].Newvar[k][j];
+			}
+		}
+	}
+	ckd_free(th);
+	return job[0].LogProb;
+}
+
+
 void estimate_multi_modals(float **x,	/* The observation vectors */
 			   int N,	/* Number of observation vectors */
 			   int Ndim,	/* Dimensionality of observations */
@@ -139,9 +249,11 @@ void estimate_multi_modals(float **x,	/* The observation vectors */
 					   modes, or mixing proportion */
 			   const char *tempfile,	/* File to store temporary distributions */
 			   int numiters,	/* Number of iterations of EM to run */
-			   float Threshold      /* Convergence ratio */
+			   float Threshold,     /* Convergence ratio */
+			   int n_thread		/* Number of threads to run EM in */
     )
 {
+	em_job_t *job;
 	float **Newvar, **hafinvvar,
 	    **Newmean,
 	    *Newc,
@@ -149,7 +261,7 @@ void estimate_multi_modals(float **x,	/* The observation vectors */
 	    *corprod,
 	    Const, SumNewc, Prevlogprob, LogProb, Improvement;
 
-	int i, j, k, iter = 0;
+	int i, j, k, t, iter = 0;
 
 	FILE *temp;
 
@@ -174,6 +286,38 @@ void estimate_multi_modals(float **x,	/* The observation vectors */
 	Tau = (float *) ckd_calloc(K, sizeof(float));
 	corprod = (float *) ckd_calloc(K, sizeof(float));
 
+	/*
+	 * Each thread takes a contiguous range of the frames.  The first
+	 * accumulates into the arrays above, the others into their own.
+	 */
+	if (n_thread < 1)
+		n_thread = 1;
+	if (n_thread > N)
+		n_thread = N;
+	job = (em_job_t *) ckd_calloc(n_thread, sizeof(em_job_t));
+	for (t = 0; t < n_thread; ++t) {
+		job[t].x = x;
+		job[t].beg = (int) ((double) N * t / n_thread);
+		job[t].end = (int) ((double) N * (t + 1) / n_thread);
+		job[t].Ndim = Ndim;
+		job[t].K = K;
+		job[t].c = c;
+		job[t].mean = mean;
+		job[t].hafinvvar = hafinvvar;
+		job[t].corprod = corprod;
+		if (t == 0) {
+			job[t].Newc = Newc;
+			job[t].Newmean = Newmean;
+			job[t].Newvar = Newvar;
+			job[t].Tau = Tau;
+		} else {
+			job[t].Newc = (float *) ckd_calloc(K, sizeof(float));
+			job[t].Newmean = (float **) ckd_calloc_2d(K, Ndim, sizeof(float));
+			job[t].Newvar = (float **) ckd_calloc_2d(K, Ndim, sizeof(float));
+			job[t].Tau = (float *) ckd_calloc(K, sizeof(float));
+		}
+	}
+
 	/*
 	 * Initialize all New values to 0
 	 * Note the array position computation for Newmean, as it is a 1-D array
@@ -211,35 +355,11 @@ void estimate_multi_modals(float **x,	/* The observation vectors */
 	 * because the latter is an unstable formula and tends to give -ve
 	 * variances due to numerical errors
 	 */
-	Prevlogprob = 0;
-	for (i = 0; i < N; ++i) {
-		Prevlogprob +=
-		    Expectation(Tau, x[i], c, mean, hafinvvar, corprod, K,
-				Ndim);
-		for (k = 0; k < K; ++k) {
-			if (Tau[k] > 0) {
-				Newc[k] += Tau[k];
-				for (j = 0; j < Ndim; ++j)
-					Newmean[k][j] += Tau[k] * x[i][j];
-			}
-		}
-	}
+	Prevlogprob = em_pass(job, n_thread, TRUE, NULL);
 	for (k = 0; k < K; ++k)
 		for (j = 0; j < Ndim; ++j)
 			Newmean[k][j] /= Newc[k];
-	for (i = 0; i < N; ++i) {
-		Expectation(Tau, x[i], c, mean, hafinvvar, corprod, K,
-			    Ndim);
-		for (k = 0; k < K; ++k) {
-			if (Tau[k] > 0) {
-				for (j = 0; j < Ndim; ++j)
-					Newvar[k][j] +=
-					    Tau[k] * (x[i][j] -
-						      Newmean[k][j])
-					    * (x[i][j] - Newmean[k][j]);
-			}
-		}
-	}
+	em_pass(job, n_thread, FALSE, Newmean);
 	printf("EM : Initial log probablity = %f \n", Prevlogprob);
 
 	while ((Improvement > Threshold) && (iter < numiters)) {
@@ -306,25 +426,7 @@ void estimate_multi_modals(float **x,	/* The observation vectors */
 			}
 		}
 
-		LogProb = 0;
-		for (i = 0; i < N; ++i) {
-			LogProb +=
-			    Expectation(Tau, x[i], c, mean, hafinvvar,
-					corprod, K, Ndim);
-			for (k = 0; k < K; ++k) {
-				if (Tau[k] > 0) {
-					Newc[k] += Tau[k];
-					for (j = 0; j < Ndim; ++j) {
-						Newmean[k][j] +=
-						    Tau[k] * x[i][j];
-						Newvar[k][j] +=
-						    Tau[k] * (x[i][j] -
-							      mean[k][j]) *
-						    (x[i][j] - mean[k][j]);
-					}
-				}
-			}
-		}
+		LogProb = em_pass(job, n_thread, TRUE, mean);
 		for (k = 0; k < K; ++k)
 			for (j = 0; j < Ndim; ++j)
 				Newmean[k][j] /= Newc[k];
@@ -355,6 +457,13 @@ void estimate_multi_modals(float **x,	/* The observation vectors */
 	/*
 	 * Free local arrays
 	 */
+	for (t = 1; t < n_thread; ++t) {
+		ckd_free(job[t].Newc);
+		ckd_free_2d((void **)job[t].Newmean);
+		ckd_free_2d((void **)job[t].Newvar);
+		ckd_free(job[t].Tau);
+	}
+	ckd_free(job);
 	ckd_free(Tau);
 	ckd_free(corprod);
 	ckd_free_2d((void **)Newvar);
@@ -35,19 +35,60 @@
  */
 /*------------------------------------------------------------------------------
 	Function defining the gaussian density function given mean and variance
+	The squared distances are summed four coefficients at a time with
+	SSE2 or NEON, so the result differs from a sequential sum only by
+	rounding.
 ------------------------------------------------------------------------------*/
 #include <math.h>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define CDCN_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define CDCN_NEON
+#include <arm_neon.h>
+#endif
+
+#include "header.h"
+
 float gauss(float *x,
 	    float *mean, float *hafinvvar, float corprod, int Ndim)
 {
-	int j;
+	int j = 0;
 	float density, t;
 
-	density = corprod;
-	for (j = 0; j < Ndim; ++j) {
-		t = *x++ - *mean++;
-		density -= t * t * (*hafinvvar++);
+	density = 0;
+#if defined(CDCN_SSE2)
+	{
+		__m128 acc = _mm_setzero_ps();
+
+		for (; j + 4 <= Ndim; j += 4) {
+			__m128 d = _mm_sub_ps(_mm_loadu_ps(x + j),
+					      _mm_loadu_ps(mean + j));
+			acc = _mm_add_ps(acc,
+					 _mm_mul_ps(_mm_mul_ps(d, d),
+						    _mm_loadu_ps(hafinvvar + j)));
+		}
+		acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+		acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+		density = _mm_cvtss_f32(acc);
+	}
+#elif defined(CDCN_NEON)
+	{
+		float32x4_t acc = vdupq_n_f32(0);
+
+		for (; j + 4 <= Ndim; j += 4) {
+			float32x4_t d = vsubq_f32(vld1q_f32(x + j),
+						  vld1q_f32(mean + j));
+			acc = vmlaq_f32(acc, vmulq_f32(d, d),
+					vld1q_f32(hafinvvar + j));
+		}
+		density = vaddvq_f32(acc);
+	}
+#endif
+	for (; j < Ndim; ++j) {
+		t = x[j] - mean[j];
+		density += t * t * hafinvvar[j];
 	}
-	return (density);
+	return (corprod - density);
 }
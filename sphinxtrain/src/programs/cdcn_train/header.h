@@ -68,7 +68,7 @@ int store_distribution(const char *file,
 void estimate_multi_modals(float **x, int N, int Ndim, int K, 
 			   float **mean, float **var, float *c, 
 			   const char *tempfile, int numiters,
-			   float Threshold);
+			   float Threshold, int n_thread);
 
 
 
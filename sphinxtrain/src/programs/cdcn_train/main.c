@@ -229,7 +229,8 @@ int main(int argc, char **argv)
 		estimate_multi_modals(vector, numspch, Ndim, Nmodes, mean,
 				      variance, c, cmd_ln_str("-tmpfn"),
 				      cmd_ln_int32("-emiter"),
-				      cmd_ln_float32("-emthresh"));
+				      cmd_ln_float32("-emthresh"),
+				      cmd_ln_int32("-nthreads"));
 		if (store_distribution
 		    (cmd_ln_str("-outfn"), Nmodes, Ndim, noisec, noisemean, noisevar, c,
 		     mean, variance) != 0) {
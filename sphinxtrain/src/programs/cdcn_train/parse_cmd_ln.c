@@ -149,6 +149,11 @@ cdcn_stats -cepext mfc \n\
 	  "CDCN.DIST.TEMP",
 	  "The temporary file name" },
 
+	{ "-nthreads",
+	  ARG_INT32,
+	  "1",
+	  "Number of threads to run EM in"},
+
 	{NULL, 0, NULL, NULL}
     };
 
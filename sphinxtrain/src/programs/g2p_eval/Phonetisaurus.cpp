@@ -73,6 +73,10 @@ Phonetisaurus::Phonetisaurus(const char *_g2pmodel_file)
     //We need make sure the g2pmodel is arcsorted
     ILabelCompare<StdArc> icomp;
     ArcSort(g2pmodel, icomp);
+
+    //Compute its properties now, so that composing with it from
+    //several threads at once only ever reads it.
+    g2pmodel->Properties(kFstProperties, true);
 }
 
 
@@ -84,6 +88,7 @@ Phonetisaurus::loadClusters()
        subsequences generated during multiple-to-multiple alignment
      */
 
+    maxClusterLen = 0;
     for (size_t i = 2; i < isyms->NumSymbols(); i++) {
         string sym = isyms->Find(i);
 
@@ -98,6 +103,8 @@ Phonetisaurus::loadClusters()
             }
 
             clusters[cluster] = i;
+            if (cluster.size() > maxClusterLen)
+                maxClusterLen = cluster.size();
         }
     }
     return;
@@ -164,23 +171,35 @@ Phonetisaurus::entryToFSA(vector <string> entry)
 
     }
 
-    //Add any cluster arcs
-    map<vector<string>,int>::iterator it_i;
-    for (it_i = clusters.begin(); it_i != clusters.end(); it_i++) {
-        vector<string>::iterator it_j;
-        vector<string>::iterator start = entry.begin();
-        vector<string> cluster = (*it_i).first;
-        while (it_j != entry.end()) {
-            it_j =
-                search(start, entry.end(), cluster.begin(), cluster.end());
-            if (it_j != entry.end()) {
-                efst.AddArc(it_j - entry.begin() + 1, StdArc((*it_i).second,    //input symbol
-                            (*it_i).second,    //output symbol
-                            0, //weight
-                            it_j - entry.begin() + cluster.size() + 1  //destination state
-                                                            ));
-                start = it_j + cluster.size();
-            }
+    //Add any cluster arcs.  Only the subsequences of the entry which
+    //are short enough to be clusters are looked up, rather than
+    //searching the entry for every cluster.  Non-overlapping
+    //occurrences are taken from left to right, and the arcs are
+    //added in cluster order, as such a search would.
+    map<vector<string>, vector<size_t> > found;
+    for (size_t start = 0; start < entry.size(); start++) {
+        for (size_t len = 1;
+             len <= maxClusterLen && start + len <= entry.size(); len++) {
+            vector<string> sub(entry.begin() + start,
+                               entry.begin() + start + len);
+            if (clusters.find(sub) == clusters.end())
+                continue;
+            vector<size_t> &pos = found[sub];
+            if (pos.empty() || pos.back() + len <= start)
+                pos.push_back(start);
+        }
+    }
+    map<vector<string>, vector<size_t> >::iterator it_i;
+    for (it_i = found.begin(); it_i != found.end(); it_i++) {
+        int label = clusters[(*it_i).first];
+        size_t len = (*it_i).first.size();
+        for (size_t j = 0; j < (*it_i).second.size(); j++) {
+            size_t pos = (*it_i).second[j];
+            efst.AddArc(pos + 1, StdArc(label,     //input symbol
+                                        label,     //output symbol
+                                        0,         //weight
+                                        pos + len + 1      //destination state
+                                       ));
         }
     }
 
@@ -200,24 +219,42 @@ vector<PathData> Phonetisaurus::phoneticize(vector <string> entry,
        input entry.
      */
     StdVectorFst
-    result;
-    StdVectorFst
-    epsMapped;
+    result = compose(entry);
+
+    return search(result, nbest, beam);
+}
+
+StdVectorFst
+Phonetisaurus::compose(vector <string> entry)
+{
+    /*
+       Compose the FSA for an input entry with the model and
+       keep only the output side.
+     */
     StdVectorFst
-    shortest;
+    result;
     StdVectorFst
     efst = entryToFSA(entry);
-    StdVectorFst
-    smbr;
     Compose(efst, *g2pmodel, &result);
 
     Project(&result, PROJECT_OUTPUT);
+    return result;
+}
+
+vector<PathData> Phonetisaurus::search(const StdVectorFst & lattice,
+                                       int nbest, int beam)
+{
+    /*
+       Find the best hypotheses in a composed lattice.
+     */
+    StdVectorFst
+    shortest;
     if (nbest > 1) {
         //This is a cheesy hack.
-        ShortestPath(result, &shortest, beam);
+        ShortestPath(lattice, &shortest, beam);
     }
     else {
-        ShortestPath(result, &shortest, 1);
+        ShortestPath(lattice, &shortest, 1);
     }
     RmEpsilon(&shortest);
     FstPathFinder
@@ -228,7 +265,7 @@ vector<PathData> Phonetisaurus::phoneticize(vector <string> entry,
 }
 
 void
-printPath(PathData * path, string onepath, int k, ofstream * hypfile,
+printPath(PathData * path, string onepath, int k, ostream * hypfile,
           string correct, string word, bool output_cost)
 {
     if (word != "") {
@@ -257,7 +294,7 @@ printPath(PathData * path, string onepath, int k, ofstream * hypfile,
 
 bool
 Phonetisaurus::printPaths(vector<PathData> paths, int nbest,
-                          ofstream * hypfile, string correct, string word,
+                          ostream * hypfile, string correct, string word,
                           bool output_cost)
 {
     /*
@@ -50,6 +50,7 @@ public:
     string tie;
     set<string> skipSeqs;
     map<vector<string>,int> clusters;
+    size_t maxClusterLen;
     //FST stuff
     StdVectorFst *g2pmodel;
     StdVectorFst epsMapper;
@@ -67,8 +68,15 @@ public:
     vector<PathData>  phoneticize(vector<string> entry, int nbest,
                                     int beam = 500);
 
+    //Compose an entry with the model once, then search the result
+    //as many times as needed.
+    StdVectorFst compose(vector<string> entry);
+
+    vector<PathData> search(const StdVectorFst & lattice, int nbest,
+                            int beam = 500);
+
     bool printPaths(vector<PathData> paths, int nbest,
-                    ofstream * hypfile, string correct = "", string word =
+                    ostream * hypfile, string correct = "", string word =
                         "", bool output_cost = true);
 
 private:
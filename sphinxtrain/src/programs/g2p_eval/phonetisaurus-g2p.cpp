@@ -29,11 +29,16 @@
  */
 
 #include <iostream>
+#include <sstream>
+#include <sphinxbase/sbthread.h>
 #include "Phonetisaurus.hpp"
 #include "util.hpp"
 
 using namespace fst;
 
+//Number of test set lines given to each thread at a time.
+#define BATCH_LINES 1024
+
 void
 phoneticizeWord(const char *g2pmodel_file, const char *output,
                 string testword, int nbest, string sep, int beam = 500,
@@ -45,8 +50,9 @@ phoneticizeWord(const char *g2pmodel_file, const char *output,
     vector <string> entry =
         tokenize_entry(&testword, &sep, phonetisaurus.isyms);
 
+    StdVectorFst lattice = phonetisaurus.compose(entry);
     vector<PathData> paths =
-        phonetisaurus.phoneticize(entry, nbest, beam);
+        phonetisaurus.search(lattice, nbest, beam);
     ofstream hypfile;
     hypfile.open(output);
 
@@ -54,7 +60,7 @@ phoneticizeWord(const char *g2pmodel_file, const char *output,
         while (phonetisaurus.printPaths(paths, nbest, &hypfile) == true
                 && nbest <= paths.size()) {
             nbest++;
-            paths = phonetisaurus.phoneticize(entry, nbest, beam);
+            paths = phonetisaurus.search(lattice, nbest, beam);
         }
     }
     else {
@@ -62,7 +68,7 @@ phoneticizeWord(const char *g2pmodel_file, const char *output,
                 printPaths(paths, nbest, &hypfile, "", testword)
                 == true && nbest <= paths.size()) {
             nbest++;
-            paths = phonetisaurus.phoneticize(entry, nbest, beam);
+            paths = phonetisaurus.search(lattice, nbest, beam);
         }
     }
     hypfile.flush();
@@ -71,10 +77,107 @@ phoneticizeWord(const char *g2pmodel_file, const char *output,
     return;
 }
 
+/*
+  A slice [beg, end) of a batch of test set entries, phoneticized by
+  one thread into its own buffer.
+ */
+struct G2PJob {
+    Phonetisaurus *phonetisaurus;
+    const vector<pair<string, string> > *batch;
+    size_t beg;
+    size_t end;
+    ostringstream hyps;
+    const char *output;
+    int nbest;
+    string sep;
+    int beam;
+    int output_words;
+    bool output_cost;
+};
+
+static void
+phoneticizeEntries(G2PJob * job)
+{
+    Phonetisaurus & phonetisaurus = *job->phonetisaurus;
+
+    for (size_t k = job->beg; k < job->end; k++) {
+        string word = (*job->batch)[k].first;
+        string pron = (*job->batch)[k].second;
+
+        vector <string> entry = tokenize_entry(&word, &job->sep,
+                                               phonetisaurus.isyms);
+        StdVectorFst lattice = phonetisaurus.compose(entry);
+        vector<PathData> paths =
+            phonetisaurus.search(lattice, job->nbest, job->beam);
+        int nbest_new = job->nbest;
+        if (job->output_words == 0) {
+            while (phonetisaurus.
+                    printPaths(paths, nbest_new, &job->hyps, job->output,
+                               pron) == true
+                    && nbest_new <= paths.size()) {
+                nbest_new++;
+                paths = phonetisaurus.search(lattice, nbest_new, job->beam);
+            }
+        }
+        else {
+            while (phonetisaurus.
+                    printPaths(paths, nbest_new, &job->hyps, pron, word,
+                               job->output_cost) == true
+                    && nbest_new <= paths.size()) {
+                nbest_new++;
+                paths = phonetisaurus.search(lattice, nbest_new, job->beam);
+            }
+        }
+    }
+}
+
+static int
+phoneticizeThread(sbthread_t * th)
+{
+    phoneticizeEntries((G2PJob *) sbthread_arg(th));
+    return 0;
+}
+
+/*
+  Phoneticize a batch of entries in up to n_job threads, all sharing
+  the one model, and append the hypotheses to hypfile in input order.
+ */
+static void
+phoneticizeBatch(G2PJob * job, int n_job,
+                 const vector<pair<string, string> > &batch,
+                 ofstream & hypfile)
+{
+    vector<sbthread_t *> th(n_job, (sbthread_t *) NULL);
+    int j;
+
+    if (n_job > (int) batch.size())
+        n_job = batch.size();
+    for (j = 0; j < n_job; j++) {
+        job[j].batch = &batch;
+        job[j].beg = batch.size() * j / n_job;
+        job[j].end = batch.size() * (j + 1) / n_job;
+        job[j].hyps.str("");
+    }
+    for (j = 1; j < n_job; j++) {
+        th[j] = sbthread_start(NULL, phoneticizeThread, &job[j]);
+        if (th[j] == NULL)
+            phoneticizeEntries(&job[j]);
+    }
+    phoneticizeEntries(&job[0]);
+    for (j = 0; j < n_job; j++) {
+        if (th[j]) {
+            sbthread_wait(th[j]);
+            sbthread_free(th[j]);
+        }
+        hypfile << job[j].hyps.str();
+    }
+}
+
 void
 phoneticizeTestSet(const char *g2pmodel_file, const char *output,
                    string testset_file, int nbest, string sep, int beam =
-                       500, int output_words = 0, bool output_cost = true)
+                       500, int output_words = 0, bool output_cost = true,
+                   int nthreads = 1)
 {
 
     Phonetisaurus phonetisaurus(g2pmodel_file);
@@ -83,9 +186,25 @@ phoneticizeTestSet(const char *g2pmodel_file, const char *output,
     test_fp.open(testset_file.c_str());
     string line;
 
+    if (nthreads < 1)
+        nthreads = 1;
+
     if (test_fp.is_open()) {
         ofstream hypfile;
         hypfile.open(output);
+
+        G2PJob *job = new G2PJob[nthreads];
+        for (int j = 0; j < nthreads; j++) {
+            job[j].phonetisaurus = &phonetisaurus;
+            job[j].output = output;
+            job[j].nbest = nbest;
+            job[j].sep = sep;
+            job[j].beam = beam;
+            job[j].output_words = output_words;
+            job[j].output_cost = output_cost;
+        }
+
+        vector<pair<string, string> > batch;
         while (test_fp.good()) {
             getline(test_fp, line);
             if (line.compare("") == 0)
@@ -106,32 +225,16 @@ phoneticizeTestSet(const char *g2pmodel_file, const char *output,
                 p = strtok(NULL, "\t");
             }
 
-            vector <string> entry = tokenize_entry(&word, &sep,
-                                                   phonetisaurus.isyms);
-            vector<PathData> paths =
-                phonetisaurus.phoneticize(entry, nbest, beam);
-            int nbest_new = nbest;
-            if (output_words == 0) {
-                while (phonetisaurus.
-                        printPaths(paths, nbest_new, &hypfile, output,
-                                   pron) == true
-                        && nbest_new <= paths.size()) {
-                    nbest_new++;
-                    paths =
-                        phonetisaurus.phoneticize(entry, nbest_new, beam);
-                }
-            }
-            else {
-                while (phonetisaurus.
-                        printPaths(paths, nbest_new, &hypfile, pron, word,
-                                   output_cost) == true
-                        && nbest_new <= paths.size()) {
-                    nbest_new++;
-                    paths =
-                        phonetisaurus.phoneticize(entry, nbest_new, beam);
-                }
+            batch.push_back(make_pair(word, pron));
+            if (batch.size() == (size_t) BATCH_LINES * nthreads) {
+                phoneticizeBatch(job, nthreads, batch, hypfile);
+                batch.clear();
             }
         }
+        if (!batch.empty())
+            phoneticizeBatch(job, nthreads, batch, hypfile);
+
+        delete [] job;
         test_fp.close();
         hypfile.flush();
         hypfile.close();
@@ -32,6 +32,7 @@
 #include <fst/fstlib.h>
 #include <iostream>
 #include <set>
+#include <sphinxbase/sbthread.h>
 #include "M2MFstAligner.hpp"
 
 //Begin Utility functions (these really need to go somewhere else
@@ -101,6 +102,7 @@ M2MFstAligner::get_max_length(string joint_label)
 M2MFstAligner::M2MFstAligner()
 {
     //Default constructor
+    nthreads = 1;
 }
 
 M2MFstAligner::M2MFstAligner(bool _seq1_del, bool _seq2_del, int _seq1_max,
@@ -141,6 +143,7 @@ M2MFstAligner::M2MFstAligner(bool _seq1_del, bool _seq2_del, int _seq1_max,
     isyms->AddSymbol(model_params);
     total = LogWeight::Zero();
     prevTotal = LogWeight::Zero();
+    nthreads = 1;
 }
 
 M2MFstAligner::M2MFstAligner(string _model_file)
@@ -168,6 +171,7 @@ M2MFstAligner::M2MFstAligner(string _model_file)
     seq2_del = params[1].compare("true") ? false : true;
     seq1_max = atoi(params[2].c_str());
     seq2_max = atoi(params[3].c_str());
+    nthreads = 1;
 
 }
 
@@ -186,38 +190,126 @@ M2MFstAligner::write_model(string _model_file)
     return;
 }
 
+//One slice of the training data for the expectation step, with its
+// own expected counts
+struct EStepJob {
+    M2MFstAligner *aligner;
+    size_t beg;
+    size_t end;
+    vector<LogWeight> counts;
+    LogWeight subtotal;
+};
+
+static int
+expectation_thread(sbthread_t * th)
+{
+    EStepJob *job = (EStepJob *) sbthread_arg(th);
+
+    job->aligner->expectation(job->beg, job->end, &job->counts,
+                              &job->subtotal);
+    return 0;
+}
+
 void
 M2MFstAligner::expectation()
 {
-    for (int i = 0; i < fsas.size(); i++) {
-        //Comput Forward and Backward probabilities
-        ShortestDistance(fsas.at(i), &alpha);
-        ShortestDistance(fsas.at(i), &beta, true);
+    //Split the training data into contiguous slices, accumulate each
+    // one's counts separately, then add them up in order so that the
+    // result does not depend on scheduling.
+    size_t n_job = nthreads > 1 ? nthreads : 1;
+    if (n_job > fsas.size())
+        n_job = fsas.size() > 0 ? fsas.size() : 1;
+
+    vector<EStepJob> jobs(n_job);
+    vector<sbthread_t *> threads(n_job, (sbthread_t *) NULL);
+    for (size_t j = 0; j < n_job; j++) {
+        jobs[j].aligner = this;
+        jobs[j].beg = fsas.size() * j / n_job;
+        jobs[j].end = fsas.size() * (j + 1) / n_job;
+        jobs[j].counts.assign(weights.size(), LogWeight::Zero());
+        jobs[j].subtotal = LogWeight::Zero();
+    }
+    for (size_t j = 1; j < n_job; j++) {
+        threads[j] = sbthread_start(NULL, expectation_thread, &jobs[j]);
+        if (threads[j] == NULL)
+            expectation(jobs[j].beg, jobs[j].end, &jobs[j].counts,
+                        &jobs[j].subtotal);
+    }
+    expectation(jobs[0].beg, jobs[0].end, &jobs[0].counts,
+                &jobs[0].subtotal);
+
+    for (size_t j = 0; j < n_job; j++) {
+        if (threads[j]) {
+            sbthread_wait(threads[j]);
+            sbthread_free(threads[j]);
+        }
+        //We call this 'prev_alignment_model' which may seem misleading, but
+        // this conventions leads to 'alignment_model' being the final version.
+        map<LogArc::Label,LogWeight>::iterator it;
+        for (it = prev_alignment_model.begin();
+                it != prev_alignment_model.end(); it++) {
+            if ((size_t) (*it).first < jobs[j].counts.size())
+                (*it).second = Plus((*it).second, jobs[j].counts[(*it).first]);
+        }
+        total = Plus(total, jobs[j].subtotal);
+    }
+}
+
+void
+M2MFstAligner::expectation(size_t beg, size_t end,
+                           vector<LogWeight> *counts, LogWeight *subtotal)
+{
+    vector<LogWeight> alpha, beta;
+
+    for (size_t i = beg; i < end; i++) {
+        const VectorFst<LogArc> &fsa = fsas[i];
+        LogArc::StateId n = fsa.NumStates();
+
+        //Compute Forward and Backward probabilities.  Every arc goes
+        // to a higher numbered state, so a pass over the states in
+        // each direction will do, using the current model in place
+        // of the arc weights.
+        alpha.assign(n, LogWeight::Zero());
+        beta.assign(n, LogWeight::Zero());
+        alpha[fsa.Start()] = LogWeight::One();
+        for (LogArc::StateId q = 0; q < n; q++) {
+            for (ArcIterator<VectorFst<LogArc> > aiter(fsa, q);
+                    !aiter.Done(); aiter.Next()) {
+                const LogArc & arc = aiter.Value();
+                alpha[arc.nextstate] =
+                    Plus(alpha[arc.nextstate],
+                         Times(alpha[q], weights[arc.ilabel]));
+            }
+        }
+        for (LogArc::StateId q = n - 1; q >= 0; q--) {
+            beta[q] = fsa.Final(q);
+            for (ArcIterator<VectorFst<LogArc> > aiter(fsa, q);
+                    !aiter.Done(); aiter.Next()) {
+                const LogArc & arc = aiter.Value();
+                beta[q] = Plus(beta[q],
+                               Times(weights[arc.ilabel],
+                                     beta[arc.nextstate]));
+            }
+        }
 
         //Compute the normalized Gamma probabilities and
         // update our running tally
-        for (StateIterator<VectorFst<LogArc> > siter(fsas.at(i));
-                !siter.Done(); siter.Next()) {
-            LogArc::StateId q = siter.Value();
-            for (ArcIterator<VectorFst<LogArc> > aiter(fsas.at(i), q);
+        for (LogArc::StateId q = 0; q < n; q++) {
+            for (ArcIterator<VectorFst<LogArc> > aiter(fsa, q);
                     !aiter.Done(); aiter.Next()) {
                 const LogArc & arc = aiter.Value();
                 const LogWeight & gamma =
                     Divide(Times
-                           (Times(alpha[q], arc.weight),
+                           (Times(alpha[q], weights[arc.ilabel]),
                             beta[arc.nextstate]), beta[0]);
                 //Check for any BadValue results, otherwise add to the tally.
-                //We call this 'prev_alignment_model' which may seem misleading, but
-                // this conventions leads to 'alignment_model' being the final version.
                 if (gamma.Value() == gamma.Value()) {
-                    prev_alignment_model[arc.ilabel] =
-                        Plus(prev_alignment_model[arc.ilabel], gamma);
-                    total = Plus(total, gamma);
+                    (*counts)[arc.ilabel] =
+                        Plus((*counts)[arc.ilabel], gamma);
+                    *subtotal = Plus(*subtotal, gamma);
                 }
             }
         }
-        alpha.clear();
-        beta.clear();
     }
 }
 
@@ -485,13 +577,17 @@ M2MFstAligner::maximization(bool lastiter)
 
     //Normalize and iterate to the next model.  We apply it dynamically
     // during the expectation step.
+    weights.assign(isyms->AvailableKey(), LogWeight::Zero());
     for (it = prev_alignment_model.begin();
             it != prev_alignment_model.end(); it++) {
         alignment_model[(*it).first] = Divide((*it).second, total);
+        weights[(*it).first] = alignment_model[(*it).first];
         (*it).second = LogWeight::Zero();
     }
 
-    for (int i = 0; i < fsas.size(); i++) {
+    //The expectation step reads the weights from the model, so only
+    // the final one needs to be written into the alignment lattices.
+    for (int i = 0; lastiter && i < fsas.size(); i++) {
         for (StateIterator<VectorFst<LogArc> > siter(fsas[i]);
                 !siter.Done(); siter.Next()) {
             LogArc::StateId q = siter.Value();
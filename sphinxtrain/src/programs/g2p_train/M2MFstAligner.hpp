@@ -80,6 +80,12 @@ public:
     map<LogArc::Label,LogWeight> prev_alignment_model;
     LogWeight total;
     LogWeight prevTotal;
+    //The current model indexed by label, which the expectation step
+    // uses in place of the arc weights.  Only the last maximization
+    // writes it back into the fsas.
+    vector<LogWeight> weights;
+    //Number of threads to run the expectation step in
+    int nthreads;
 
     //Constructors
     M2MFstAligner();
@@ -110,6 +116,10 @@ public:
     vector<PathData> write_alignment_wrapper(int i, int nbest);
     //The expectation routine
     void expectation();
+    //Accumulate the expected counts for fsas [beg, end) into
+    // counts and *subtotal
+    void expectation(size_t beg, size_t end, vector<LogWeight> *counts,
+                     LogWeight *subtotal);
     //The maximization routine.  Returns the change since the last iteration
     float maximization(bool lastiter);
     //Print out the EM-optimized alignment for the training data
@@ -423,7 +423,7 @@ train_model(string eps, string s1s2_sep, string skip, int order,
 void
 align(string input_file, string prefix, bool seq1_del, bool seq2_del,
       int seq1_max, int seq2_max, string seq_sep, string s1s2_sep,
-      string eps, string skip, int iter)
+      string eps, string skip, int iter, int nthreads)
 {
 
     ifstream dict(input_file.c_str(), ifstream::in);
@@ -432,6 +432,7 @@ align(string input_file, string prefix, bool seq1_del, bool seq2_del,
     cout << "Loading..." << endl;
     M2MFstAligner fstaligner(seq1_del, seq2_del, seq1_max, seq2_max,
                              seq_sep, seq_sep, s1s2_sep, eps, skip, true);
+    fstaligner.nthreads = nthreads;
 
     string sep1 = "";
     string sep2 = " ";
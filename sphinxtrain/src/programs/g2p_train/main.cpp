@@ -71,6 +71,9 @@ main(int argc, char *argv[])
         {   "-iter", ARG_INT32, "10",
             "Maximum number of iterations for EM"
         },
+        {   "-nthreads", ARG_INT32, "1",
+            "Number of threads to run the EM expectation step in"
+        },
         {"-order", ARG_INT32, "6", "N-gram order"},
         {   "-prune", ARG_STRING, "no",
             "Pruning method. Available options are: 'no', 'count_prune', 'relative_entropy', 'seymore'"
@@ -115,6 +118,7 @@ main(int argc, char *argv[])
     string eps = "<eps>";
     string skip = "_";
     int iter = cmd_ln_int32("-iter");
+    int nthreads = cmd_ln_int32("-nthreads");
     int ratio = cmd_ln_int32("-ratio");
     int order = cmd_ln_int32("-order");
     string smooth = cmd_ln_str("-smooth");
@@ -146,7 +150,7 @@ main(int argc, char *argv[])
         cout << "Using dictionary: " << input_file << endl;
         align(input_file, prefix, seq1_del, seq2_del, seq1_max,
               seq2_max, seq_sep, s1s2_sep,
-              eps, skip, iter);
+              eps, skip, iter, nthreads);
     }
 
     train_model(eps, s1s2_sep, skip, order, smooth, prefix, seq_sep, prune,
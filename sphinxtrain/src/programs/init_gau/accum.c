@@ -44,56 +44,186 @@
  * 	Eric H. Thayer (eht@cs.cmu.edu)
  *********************************************************************/
 
-#include <sphinxbase/matrix.h>
 #include <sphinxbase/ckd_alloc.h>
+#include <sphinxbase/err.h>
+#include <s3/run_jobs.h>
 #include "accum.h"
 
 #include <stdio.h>
+#include <string.h>
 
-int
-accum_state_mean(vector_t ***mean,
-		 float32 ***dnom,
-		 vector_t **feat,
-		 uint32 n_feat,
-		 const uint32 *veclen,
-		 uint32 *sseq,
-		 uint32 *ci_sseq,
-		 uint32 n_frame)
+static uint32 n_thread = 1;
+
+void
+accum_set_nthreads(uint32 n)
+{
+    n_thread = (n > 0 ? n : 1);
+}
+
+/*
+ * The (state, feature) pairs whose index s * n_feat + f is congruent
+ * to id modulo n_job, to be accumulated by one thread.  Since every
+ * accumulator is owned by exactly one job and the frames are visited
+ * in order, the sums do not depend on the number of threads.
+ */
+typedef struct accum_job_s accum_job_t;
+struct accum_job_s {
+    vector_t ***mean_acc;
+    vector_t ***var_acc;
+    vector_t ****fullvar_acc;
+    vector_t ***mean;
+    float32 ***dnom;
+    vector_t **feat;
+    uint32 n_feat;
+    const uint32 *veclen;
+    uint32 *sseq;
+    uint32 *ci_sseq;
+    uint32 n_frame;
+    uint32 id;
+    uint32 n_job;
+    vector_t dvec;
+};
+
+/* Add the upper triangle of the outer product of d with itself to
+ * cov; accum_fullvar_symmetrize() fills in the rest afterwards. */
+static void
+add_outer_upper(vector_t *cov, const float32 *d, uint32 len)
+{
+    uint32 i, j;
+
+    for (i = 0; i < len; i++) {
+	float32 *row = cov[i];
+	float32 di = d[i];
+
+	for (j = i; j < len; j++)
+	    row[j] += di * d[j];
+    }
+}
+
+static void
+accum_one(accum_job_t *job, uint32 t, uint32 s, uint32 f)
+{
+    const float32 *x = job->feat[t][f];
+    uint32 len = job->veclen[f];
+    uint32 c;
+
+    /* only one Gaussian per state */
+    job->dnom[s][f][0] += 1.0;
+
+    if (job->mean_acc) {
+	float32 *m = job->mean_acc[s][f][0];
+
+	for (c = 0; c < len; c++)
+	    m[c] += x[c];
+    }
+    else if (job->var_acc) {
+	const float32 *mu = job->mean[s][f][0];
+	float32 *v = job->var_acc[s][f][0];
+	float32 diff;
+
+	for (c = 0; c < len; c++) {
+	    diff = x[c] - mu[c];
+	    v[c] += diff * diff;
+	}
+    }
+    else {
+	const float32 *mu = job->mean[s][f][0];
+
+	for (c = 0; c < len; c++)
+	    job->dvec[c] = x[c] - mu[c];
+	add_outer_upper(job->fullvar_acc[s][f][0], job->dvec, len);
+    }
+}
+
+static void
+accum_range(accum_job_t *job)
 {
     uint32 t;		/* time (in frames) */
     uint32 s;		/* a tied state */
     uint32 ci_s;	/* a CI tied state */
     uint32 f;		/* a feature stream idx */
-    uint32 c;		/* a vector component idx */
 
-    for (t = 0; t < n_frame; t++) {
-	if (sseq && ci_sseq) {
-	    s = sseq[t];
-	    ci_s = ci_sseq[t];
+    for (t = 0; t < job->n_frame; t++) {
+	if (job->sseq && job->ci_sseq) {
+	    s = job->sseq[t];
+	    ci_s = job->ci_sseq[t];
 	}
 	else {
 	    s = 0;
 	    ci_s = 0;
 	}
 
-	for (f = 0; f < n_feat; f++) {
-	    dnom[s][f][0] += 1.0;
-	    if (s != ci_s) {
-		dnom[ci_s][f][0] += 1.0;
-	    }
-	    for (c = 0; c < veclen[f]; c++) {
-		/* only one Gaussian per state */
-    		mean[s][f][0][c] += feat[t][f][c];
-
-		if (s != ci_s) {
-		    mean[ci_s][f][0][c] += feat[t][f][c];
-		}
-	    }
+	for (f = 0; f < job->n_feat; f++) {
+	    if ((s * job->n_feat + f) % job->n_job == job->id)
+		accum_one(job, t, s, f);
+	    if (s != ci_s && (ci_s * job->n_feat + f) % job->n_job == job->id)
+		accum_one(job, t, ci_s, f);
 	}
     }
+}
+
+static void
+accum_job(void *arg)
+{
+    accum_range((accum_job_t *)arg);
+}
+
+static int
+accum_run(accum_job_t *proto)
+{
+    accum_job_t *job;
+    uint32 n_job, max_veclen, j;
+
+    max_veclen = 0;
+    for (j = 0; j < proto->n_feat; j++) {
+	if (proto->veclen[j] > max_veclen)
+	    max_veclen = proto->veclen[j];
+    }
+
+    n_job = n_thread;
+    job = (accum_job_t *)ckd_calloc(n_job, sizeof(accum_job_t));
+    for (j = 0; j < n_job; j++) {
+	job[j] = *proto;
+	job[j].id = j;
+	job[j].n_job = n_job;
+	if (proto->fullvar_acc)
+	    job[j].dvec = ckd_calloc(max_veclen, sizeof(float32));
+    }
+
+    run_jobs(accum_job, job, sizeof(accum_job_t), n_job);
+
+    for (j = 0; j < n_job; j++)
+	ckd_free(job[j].dvec);
+    ckd_free(job);
+
     return 0;
 }
-
+
+int
+accum_state_mean(vector_t ***mean,
+		 float32 ***dnom,
+		 vector_t **feat,
+		 uint32 n_feat,
+		 const uint32 *veclen,
+		 uint32 *sseq,
+		 uint32 *ci_sseq,
+		 uint32 n_frame)
+{
+    accum_job_t proto;
+
+    memset(&proto, 0, sizeof(proto));
+    proto.mean_acc = mean;
+    proto.dnom = dnom;
+    proto.feat = feat;
+    proto.n_feat = n_feat;
+    proto.veclen = veclen;
+    proto.sseq = sseq;
+    proto.ci_sseq = ci_sseq;
+    proto.n_frame = n_frame;
+
+    return accum_run(&proto);
+}
+
 int
 accum_state_var(vector_t ***var,
 		vector_t ***mean,
@@ -105,48 +235,22 @@ accum_state_var(vector_t ***var,
 		uint32 *ci_sseq,
 		uint32 n_frame)
 {
-    uint32 t;		/* time (in frames) */
-    uint32 s;		/* a tied state */
-    uint32 ci_s;	/* a CI tied state */
-    uint32 f;		/* a feature stream idx */
-    uint32 c;		/* a vector component idx */
-    float32 diff;
-
-    for (t = 0; t < n_frame; t++) {
+    accum_job_t proto;
 
-	if (sseq && ci_sseq) {
-	    /* get the tied state for time t */
-	    s = sseq[t];
-	
-	    /* get the CI state as well */
-	    ci_s = ci_sseq[t];
-	}
-	else {
-	    s = 0;
-	    ci_s = 0;
-	}
+    memset(&proto, 0, sizeof(proto));
+    proto.var_acc = var;
+    proto.mean = mean;
+    proto.dnom = dnom;
+    proto.feat = feat;
+    proto.n_feat = n_feat;
+    proto.veclen = veclen;
+    proto.sseq = sseq;
+    proto.ci_sseq = ci_sseq;
+    proto.n_frame = n_frame;
 
-	for (f = 0; f < n_feat; f++) {
-	    dnom[s][f][0] += 1.0;
-	    if (s != ci_s) {
-		dnom[ci_s][f][0] += 1.0;
-	    }
-	    for (c = 0; c < veclen[f]; c++) {
-		/* only one Gaussian per state */
-
-		diff = feat[t][f][c] - mean[s][f][0][c];
-		var[s][f][0][c] += diff * diff;
-
-		if (s != ci_s) {
-		    diff = feat[t][f][c] - mean[ci_s][f][0][c];
-		    var[ci_s][f][0][c] += diff * diff;
-		}
-	    }
-	}
-    }
-    return 0;
+    return accum_run(&proto);
 }
-
+
 int
 accum_state_fullvar(vector_t ****var,
 		    vector_t ***mean,
@@ -158,50 +262,37 @@ accum_state_fullvar(vector_t ****var,
 		    uint32 *ci_sseq,
 		    uint32 n_frame)
 {
-    uint32 t;		/* time (in frames) */
-    uint32 s;		/* a tied state */
-    uint32 ci_s;	/* a CI tied state */
-    uint32 f;		/* a feature stream idx */
-    uint32 c;		/* a vector component idx */
+    accum_job_t proto;
 
-    for (t = 0; t < n_frame; t++) {
+    memset(&proto, 0, sizeof(proto));
+    proto.fullvar_acc = var;
+    proto.mean = mean;
+    proto.dnom = dnom;
+    proto.feat = feat;
+    proto.n_feat = n_feat;
+    proto.veclen = veclen;
+    proto.sseq = sseq;
+    proto.ci_sseq = ci_sseq;
+    proto.n_frame = n_frame;
 
-	if (sseq && ci_sseq) {
-	    /* get the tied state for time t */
-	    s = sseq[t];
-	
-	    /* get the CI state as well */
-	    ci_s = ci_sseq[t];
-	}
-	else {
-	    s = 0;
-	    ci_s = 0;
-	}
+    return accum_run(&proto);
+}
 
+void
+accum_fullvar_symmetrize(vector_t ****var,
+			 uint32 n_state,
+			 uint32 n_feat,
+			 const uint32 *veclen)
+{
+    uint32 s, f, i, j;
+
+    for (s = 0; s < n_state; s++) {
 	for (f = 0; f < n_feat; f++) {
-	    vector_t dvec = ckd_calloc(veclen[f], sizeof(float32));
-	    vector_t *cov = (vector_t *)ckd_calloc_2d(veclen[f], veclen[f], sizeof(float32));
-
-	    dnom[s][f][0] += 1.0;
-	    if (s != ci_s) {
-		dnom[ci_s][f][0] += 1.0;
-	    }
-	    for (c = 0; c < veclen[f]; c++)
-		dvec[c] = feat[t][f][c] - mean[s][f][0][c];
-
-	    outerproduct(cov, dvec, dvec, veclen[f]);
-	    matrixadd(var[s][f][0], cov, veclen[f]);
-
-	    if (s != ci_s) {
-		for (c = 0; c < veclen[f]; c++)
-		    dvec[c] = feat[t][f][c] - mean[ci_s][f][0][c];
-		outerproduct(cov, dvec, dvec, veclen[f]);
-		matrixadd(var[ci_s][f][0], cov, veclen[f]);
-	    }
-	    ckd_free(dvec);
-	    ckd_free_2d((void **)cov);
+	    vector_t *cov = var[s][f][0];
+
+	    for (i = 0; i < veclen[f]; i++)
+		for (j = i + 1; j < veclen[f]; j++)
+		    cov[j][i] = cov[i][j];
 	}
     }
-    return 0;
 }
-
@@ -72,5 +72,17 @@ accum_state_fullvar(vector_t ****var_acc,
 		    uint32 *ci_sseq,
 		    uint32 n_frame);
 
+/* Fill in the lower triangles of full covariance sums, of which
+ * accum_state_fullvar() only accumulates the upper ones. */
+void
+accum_fullvar_symmetrize(vector_t ****var_acc,
+			 uint32 n_state,
+			 uint32 n_feat,
+			 const uint32 *veclen);
+
+/* Split accumulation over this many threads. */
+void
+accum_set_nthreads(uint32 n);
+
 #endif /* ACCUM_H */ 
 
@@ -127,6 +127,7 @@ init_gau(lexicon_t *lex,
     }
 
     meanfn = cmd_ln_str("-meanfn");
+    accum_set_nthreads(cmd_ln_int32("-nthreads"));
 
     veclen = (uint32 *)feat_stream_lengths(feat);
     
@@ -297,6 +298,7 @@ init_gau(lexicon_t *lex,
     sprintf(fn, "%s/gauden_counts", cmd_ln_str("-accumdir"));
     
     if (var_is_full) {
+	accum_fullvar_symmetrize(fullvar_acc, n_ts, feat_dimension1(feat), veclen);
 	if (s3gaucnt_write_full(fn, mean_acc, fullvar_acc, TRUE /* 2-pass variance */, dnom,
 				n_ts, feat_dimension1(feat), 1, veclen) != 0) {
 	}
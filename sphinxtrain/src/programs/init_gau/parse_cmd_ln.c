@@ -169,6 +169,11 @@ init_gau -accumdir accumdir -ctlfn controlfn -part 1 -npart 1 -cepdir cepdir -fe
 	  "mfc",
 	  "Extension of the training corpus cepstrum files."},
 
+	{ "-nthreads",
+	  ARG_INT32,
+	  "1",
+	  "Number of threads to accumulate statistics in"},
+
 	cepstral_to_feature_command_line_macro(),
 	{NULL, 0, NULL, NULL}
     };
@@ -81,8 +81,6 @@ main(int argc, char *argv[])
 	if (n_mgau != r_n_mgau)
 		E_FATAL("Number of GMMs in variances doesn't match means: %d != %d\n",
 			r_n_mgau, n_mgau);
-	if (n_mgau != 1)
-		E_FATAL("Only semi-continuous models are currently supported\n");
 	if (n_density != r_n_density)
 		E_FATAL("Number of Gaussians in variances doesn't match means: %d != %d\n",
 			r_n_density, n_density);
@@ -95,11 +93,13 @@ main(int argc, char *argv[])
 				i, r_veclen[i], veclen[i]);
 	ckd_free(r_veclen);
 
-	/* Build one kd-tree for each feature stream. */
-	root = ckd_calloc(n_feat, sizeof(*root));
-	for (i = 0; i < n_feat; ++i) {
-		root[i] = build_kd_tree(means[0][i], variances[0][i],
-					n_density, veclen[i],
+	/* Build one kd-tree for each feature stream of each codebook
+	 * (there are several codebooks in phonetically-tied models). */
+	root = ckd_calloc(n_mgau * n_feat, sizeof(*root));
+	for (i = 0; i < n_mgau * n_feat; ++i) {
+		root[i] = build_kd_tree(means[i / n_feat][i % n_feat],
+					variances[i / n_feat][i % n_feat],
+					n_density, veclen[i % n_feat],
 					cmd_ln_float32("-threshold"),
 					cmd_ln_int32("-depth"),
 					cmd_ln_int32("-absolute"));
@@ -107,9 +107,9 @@ main(int argc, char *argv[])
 
 	if (cmd_ln_str("-outfn"))
 		write_kd_trees(cmd_ln_str("-outfn"),
-			       root, n_feat);
+			       root, n_mgau * n_feat);
 
-	for (i = 0; i < n_feat; ++i)
+	for (i = 0; i < n_mgau * n_feat; ++i)
 		free_kd_tree(root[i]);
 	ckd_free(root);
 	ckd_free(veclen);
@@ -51,6 +51,7 @@
 #include <sphinxbase/feat.h>
 #include <sphinxbase/err.h>
 #include <sphinxbase/profile.h>
+#include <sphinxbase/mmio.h>
 
 #include <s3/lexicon.h>
 #include <s3/model_def_io.h>
@@ -93,6 +94,24 @@ static uint32 n_tot_frame = 0;
 static FILE *dmp_fp = NULL;
 static uint32 dmp_swp = -1;
 
+/* A 1-class dump file in native byte order may be mapped and its
+ * observations used in place; obuf then points into the mapping. */
+static mmio_file_t *dmp_mm = NULL;
+static float32 *dmp_data = NULL;
+static int obuf_mapped = FALSE;
+
+/* # of float32 between consecutive observations in obuf */
+static uint32 obs_stride;
+
+static void
+free_obuf(void)
+{
+    if (obuf && !obuf_mapped)
+	ckd_free(obuf);
+    obuf = NULL;
+    obuf_mapped = FALSE;
+}
+
 static ptmr_t all_timer;
 static ptmr_t km_timer;
 static ptmr_t var_timer;
@@ -233,13 +252,22 @@ setup_obs_1class(uint32 strm, uint32 n_frame, uint32 n_stream, uint32 *veclen, u
 
     l_strm = strm;
 
+    free_obuf();
+
+    if (dmp_data) {
+	for (i = 0, l = 0; i < strm; i++)
+	    l += veclen[i];
+
+	E_INFO("Using mapped dump file for stream %u\n", strm);
+	obuf = dmp_data + l;
+	obuf_mapped = TRUE;
+
+	return n_sv_frame;
+    }
+
     E_INFO("alloc'ing %uMb obs buf\n",
 	   n_sv_frame*veclen[strm]*sizeof(float32) / (1024 * 1024));
 
-    if (obuf) {
-	ckd_free(obuf);
-	obuf = NULL;
-    }
     obuf = ckd_calloc(n_sv_frame * veclen[strm], sizeof(float32));
 
     buf = (float32 *)ckd_calloc(blksize, sizeof(float32));
@@ -280,11 +308,13 @@ setup_obs_1class(uint32 strm, uint32 n_frame, uint32 n_stream, uint32 *veclen, u
 }
 
 static uint32
-setup_obs_multiclass(uint32 ts, uint32 strm, uint32 n_frame, uint32 veclen)
+setup_obs_multiclass(uint32 ts, uint32 strm, uint32 n_frame, uint32 veclen,
+		     uint32 strm_off, uint32 blksize)
 {
     uint32 i, o, k;
     uint32 n_i_frame;
-    vector_t **feat;
+    float32 *frames;
+    float32 *buf = NULL;
     uint32 d_ts;
     uint32 n_sv_frame;
 
@@ -292,6 +322,8 @@ setup_obs_multiclass(uint32 ts, uint32 strm, uint32 n_frame, uint32 veclen)
 
     if ((l_ts == ts) && (l_strm == strm)) {
 	E_INFO("No need to read data; using existing buffered data\n");
+	if (obuf_mapped)
+	    obs_stride = blksize * stride;
 	
 	return n_sv_frame;
     }
@@ -301,12 +333,26 @@ setup_obs_multiclass(uint32 ts, uint32 strm, uint32 n_frame, uint32 veclen)
     l_ts = ts;
     l_strm = strm;
 
-    E_INFO("alloc'ing %uMb obs buf\n", n_sv_frame*veclen*sizeof(float32) / (1024 * 1024));
+    free_obuf();
 
-    if (obuf) {
-	ckd_free(obuf);
-	obuf = NULL;
+    /* The frames of one tied state in a mapped dump can be used in
+     * place, like those of a mapped 1-class dump. */
+    if (o2d == NULL) {
+	frames = segdmp_id_frames(ts, &n_i_frame, &buf);
+	if (frames != NULL && buf == NULL) {
+	    E_INFO("Using mapped dump for state %u stream %u\n", ts, strm);
+	    obuf = frames + strm_off;
+	    obuf_mapped = TRUE;
+	    obs_stride = blksize * stride;
+
+	    return n_sv_frame;
+	}
+	ckd_free(buf);
+	buf = NULL;
     }
+
+    E_INFO("alloc'ing %uMb obs buf\n", n_sv_frame*veclen*sizeof(float32) / (1024 * 1024));
+
     obuf = ckd_calloc(n_sv_frame * veclen, sizeof(float32));
 
     if (stride == 1) {
@@ -326,35 +372,26 @@ setup_obs_multiclass(uint32 ts, uint32 strm, uint32 n_frame, uint32 veclen)
 	for (k = 0, o = 0; k < n_o2d[ts]; k++) {
 	    d_ts = o2d[ts][k];
 
-	    for (i = 0; segdmp_next_feat(d_ts, &feat, &n_i_frame); i++) {
-		assert(n_i_frame == 1);
-
-		if ((i % stride) == 0) {
-		    memcpy(&obuf[o],
-			   (void *)&feat[0][strm][0],
-			   sizeof(float32) * veclen);
-		    o += veclen;
-		}
-		ckd_free((void *)&feat[0][0][0]);
-		ckd_free_2d((void **)feat);
+	    frames = segdmp_id_frames(d_ts, &n_i_frame, &buf);
+	    for (i = 0; i < n_i_frame && o < n_sv_frame * veclen; i += stride) {
+		memcpy(&obuf[o],
+		       &frames[(size_t)i * blksize + strm_off],
+		       sizeof(float32) * veclen);
+		o += veclen;
 	    }
 	}
     }
     else {
 	E_INFO("dmp mdef == output mdef\n");
-	for (i = 0, o = 0; segdmp_next_feat(ts, &feat, &n_i_frame); i++) {
-	    assert(n_i_frame == 1);
-
-	    if ((i % stride) == 0) {
-		memcpy(&obuf[o],
-		       (void *)&feat[0][strm][0],
-		       sizeof(float32) * veclen);
-		o += veclen;
-	    }
-	    ckd_free((void *)&feat[0][0][0]);
-	    ckd_free_2d((void **)feat);
+	frames = segdmp_id_frames(ts, &n_i_frame, &buf);
+	for (i = 0, o = 0; i < n_i_frame && o < n_sv_frame * veclen; i += stride) {
+	    memcpy(&obuf[o],
+		   &frames[(size_t)i * blksize + strm_off],
+		   sizeof(float32) * veclen);
+	    o += veclen;
 	}
     }	
+    ckd_free(buf);
 
     if ((o / veclen) != n_sv_frame) {
 	E_WARN("Expected %u frames, but read %u\n",
@@ -366,14 +403,17 @@ setup_obs_multiclass(uint32 ts, uint32 strm, uint32 n_frame, uint32 veclen)
     return n_sv_frame;
 }
 
-static uint32 vlen;
-
 uint32
 setup_obs(uint32 ts, uint32 strm, uint32 n_frame, uint32 n_stream, uint32 *veclen, uint32 blksize)
 {
-    vlen = veclen[strm];
+    uint32 i, strm_off;
+
+    obs_stride = (dmp_data ? blksize * stride : veclen[strm]);
     if (multiclass) {
-	return setup_obs_multiclass(ts, strm, n_frame, veclen[strm]);
+	for (i = 0, strm_off = 0; i < strm; i++)
+	    strm_off += veclen[i];
+	return setup_obs_multiclass(ts, strm, n_frame, veclen[strm],
+				    strm_off, blksize);
     }
     else {
 	return setup_obs_1class(strm, n_frame, n_stream, veclen, blksize);
@@ -383,7 +423,7 @@ setup_obs(uint32 ts, uint32 strm, uint32 n_frame, uint32 n_stream, uint32 *vecle
 vector_t
 get_obs(uint32 i)
 {
-    return &obuf[i*vlen];
+    return &obuf[(size_t)i*obs_stride];
 }
 
 
@@ -561,6 +601,7 @@ random_kmeans(uint32 n_trial,
 	      uint32 n_mean,
 	      float32 min_ratio,
 	      uint32 max_iter,
+	      uint32 minibatch,
 	      codew_t **out_label)
 {
     uint32 t, k, kk;
@@ -592,7 +633,15 @@ random_kmeans(uint32 n_trial,
 		}
 	    }
 
-	    if (n_mean > 1) {
+	    if (minibatch > 0) {
+		sqerr = k_means_minibatch(tmp_mean, n_mean,
+					  n_obs,
+					  veclen,
+					  minibatch,
+					  max_iter,
+					  &label);
+	    }
+	    else if (n_mean > 1) {
 		sqerr = k_means_trineq(tmp_mean, n_mean,
 				       n_obs,
 				       veclen,
@@ -822,6 +871,7 @@ cluster(int32 ts,
     *out_label = NULL;
 
     k_means_set_get_obs(&get_obs);
+    k_means_set_nthreads(cmd_ln_int32("-nthreads"));
 
     for (s = 0, sum_sqerr = 0; s < n_stream; s++, sum_sqerr += sqerr) {
 	meth = cmd_ln_str("-method");
@@ -836,6 +886,7 @@ cluster(int32 ts,
 				  n_density,
 				  cmd_ln_float32("-minratio"),
 				  cmd_ln_int32("-maxiter"),
+				  cmd_ln_int32("-minibatch"),
 				  out_label);
 	    if (sqerr < 0) {
 		E_ERROR("Too few observations for kmeans\n");
@@ -1322,6 +1373,7 @@ init_state(const char *obsdmp,
 
     if (cmd_ln_str("-segidxfn")) {
 	E_INFO("Multi-class dump\n");
+	segdmp_set_mmap(cmd_ln_boolean("-mmap"));
 	if (segdmp_open_read(cmd_ln_str_list("-segdmpdirs"),
 			     cmd_ln_str("-segdmpfn"),
 			     cmd_ln_str("-segidxfn"),
@@ -1363,6 +1415,21 @@ init_state(const char *obsdmp,
 	}
 
 	data_offset = ftell(dmp_fp);
+
+	if (cmd_ln_boolean("-mmap")) {
+	    if (dmp_swp) {
+		E_INFO("Dump file is byte-swapped; reading it into memory\n");
+	    }
+	    else if (data_offset % sizeof(float32) != 0) {
+		E_INFO("Dump file data is not aligned; reading it into memory\n");
+	    }
+	    else if ((dmp_mm = mmio_file_read(cmd_ln_str("-segdmpfn"))) == NULL) {
+		E_WARN("Failed to map dump file; reading it into memory\n");
+	    }
+	    else {
+		dmp_data = (float32 *)((char *)mmio_file_ptr(dmp_mm) + data_offset);
+	    }
+	}
     }
 
     tot_sqerr = 0;
@@ -1442,8 +1509,14 @@ init_state(const char *obsdmp,
 	E_INFO("sqerr = %e tot %e rms\n", tot_sqerr, sqrt(tot_sqerr/n_corpus));
     }
 
-    if (!multiclass)
+    if (!multiclass) {
+	free_obuf();
+	if (dmp_mm)
+	    mmio_file_unmap(dmp_mm);
+	dmp_mm = NULL;
+	dmp_data = NULL;
 	s3close(dmp_fp);
+    }
     
     if (meanfn) {
 	if (s3gau_write(meanfn,
@@ -205,6 +205,16 @@ kmeans_init -gthobj single -stride 1 -ntrial 1 -minratio 0.001 \n\
 	  "100",
 	  "K-means: maximum # of iterations of updating to apply"},
 
+	{ "-minibatch",
+	  ARG_INT32,
+	  "0",
+	  "K-means: if non-zero, use mini-batch k-means with batches of this many observations (-maxiter batches)"},
+
+	{ "-nthreads",
+	  ARG_INT32,
+	  "1",
+	  "K-means: # of threads to use for labelling and updating"},
+
 	{ "-mixwfn",
 	  ARG_STRING,
 	  NULL,
@@ -249,6 +259,11 @@ kmeans_init -gthobj single -stride 1 -ntrial 1 -minratio 0.001 \n\
 	  ARG_INT32,
 	  "32",
 	  "Gather every -stride'th frame" },
+
+	{ "-mmap",
+	  ARG_BOOLEAN,
+	  "yes",
+	  "Memory-map the dump files instead of copying them, if possible" },
 	
 	{ "-runlen",
 	  ARG_INT32,
@@ -130,6 +130,11 @@ const char examplestr[] =
           ARG_STRING,
           NULL,
           "The model definition file for the model inventory to train" },
+
+	{ "-nthreads",
+	  ARG_INT32,
+	  "1",
+	  "Number of threads to re-estimate Gaussians in" },
                                       
                                       
 	{NULL, 0, NULL, NULL},
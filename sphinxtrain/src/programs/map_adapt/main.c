@@ -34,9 +34,11 @@
 #include <s3/s3acc_io.h>
 #include <s3/s3.h>
 #include <s3/ts2cb.h>
+#include <s3/run_jobs.h>
 
 #include <sphinxbase/matrix.h>
 #include <sphinxbase/err.h>
+#include <sphinxbase/ckd_alloc.h>
 
 #include <stdio.h>
 #include <math.h>
@@ -67,59 +69,145 @@ check_consistency(const char *filename,
 		    s, filename);
 }
 
-static float32 ***
-estimate_tau(vector_t ***si_mean, vector_t ***si_var, float32 ***si_mixw,
-	     uint32 n_cb, uint32 n_stream, uint32 n_density, uint32 n_mixw, const uint32 *veclen,
-	     vector_t ***wt_mean, float32 ***wt_mixw, float32 ***wt_dcount)
-{
+/*
+ * A contiguous slice [beg, end) of the (codebook, stream) pairs,
+ * numbered i * n_stream + j, to be re-estimated by one thread.
+ */
+typedef struct map_job_s map_job_t;
+struct map_job_s {
+    void (*fn)(map_job_t *job);
+    vector_t ***si_mean;
+    vector_t ***si_var;
+    float32 ***si_mixw;
+    vector_t ***wt_mean;
+    vector_t ***wt_var;
+    float32 ***wt_mixw;
+    float32 ***wt_dcount;
+    int32 pass2var;
+    int32 bayesmean;
     float32 ***map_tau;
-    uint32 i, j, k, m;
+    float32 fixed_tau;
+    float32 varfloor;
+    vector_t ***map_mean;
+    vector_t ***map_var;
+    uint32 n_stream;
+    uint32 n_density;
+    const uint32 *veclen;
+    uint32 beg;
+    uint32 end;
+};
+
+static int32 n_thread = 1;
 
-    E_INFO("Estimating tau hyperparameter from variances and observations\n");
-    map_tau = (float32 ***)ckd_calloc_3d(n_cb, n_stream, n_density, sizeof(float32));
-    for (i = 0; i < n_cb; ++i) {
-	for (j = 0; j < n_stream; ++j) {
-	    for (k = 0; k < n_density; ++k) {
-		float32 tau_nom, tau_dnom;
+static void
+map_job(void *arg)
+{
+    map_job_t *job = (map_job_t *)arg;
+
+    job->fn(job);
+}
 
-		tau_nom = veclen[j] * wt_mixw[i][j][k];
-		tau_dnom = 0.0f;
-		for (m = 0; m < veclen[j]; ++m) {
-		    float32 ydiff, wvar, dnom, ml_mu, si_mu, si_sigma;
+/* Run proto->fn over all n_cb codebooks, split across n_thread threads. */
+static void
+map_run(map_job_t *proto, uint32 n_cb)
+{
+    map_job_t *job;
+    uint32 n_unit, n_job, j;
+
+    n_unit = n_cb * proto->n_stream;
+    n_job = n_thread;
+    if (n_job > n_unit)
+	n_job = (n_unit > 0 ? n_unit : 1);
+
+    job = (map_job_t *)ckd_calloc(n_job, sizeof(map_job_t));
+    for (j = 0; j < n_job; j++) {
+	job[j] = *proto;
+	job[j].beg = (uint32)((uint64)n_unit * j / n_job);
+	job[j].end = (uint32)((uint64)n_unit * (j + 1) / n_job);
+    }
+    run_jobs(map_job, job, sizeof(map_job_t), n_job);
+    ckd_free(job);
+}
 
-		    dnom = wt_dcount[i][j][k];
-		    si_mu = si_mean[i][j][k][m];
-		    si_sigma = si_var[i][j][k][m];
-		    ml_mu = dnom ? wt_mean[i][j][k][m] / dnom : si_mu;
+static void
+estimate_tau_range(map_job_t *job)
+{
+    vector_t ***si_mean = job->si_mean;
+    vector_t ***si_var = job->si_var;
+    float32 ***si_mixw = job->si_mixw;
+    vector_t ***wt_mean = job->wt_mean;
+    float32 ***wt_mixw = job->wt_mixw;
+    float32 ***wt_dcount = job->wt_dcount;
+    float32 ***map_tau = job->map_tau;
+    const uint32 *veclen = job->veclen;
+    uint32 u, i, j, k, m;
+
+    for (u = job->beg; u < job->end; ++u) {
+	i = u / job->n_stream;
+	j = u % job->n_stream;
+	for (k = 0; k < job->n_density; ++k) {
+	    float32 tau_nom, tau_dnom;
+
+	    tau_nom = veclen[j] * wt_mixw[i][j][k];
+	    tau_dnom = 0.0f;
+	    for (m = 0; m < veclen[j]; ++m) {
+		float32 ydiff, wvar, dnom, ml_mu, si_mu, si_sigma;
+
+		dnom = wt_dcount[i][j][k];
+		si_mu = si_mean[i][j][k][m];
+		si_sigma = si_var[i][j][k][m];
+		ml_mu = dnom ? wt_mean[i][j][k][m] / dnom : si_mu;
 		    
-		    ydiff = ml_mu - si_mu;
-		    /* Gauvain/Lee's estimation of this makes no
-		     * sense as I read it, it seems to simply
-		     * equal the precision matrix.  We want to use
-		     * the variance anyway, because higher
-		     * variance in the SI models should lead to
-		     * stronger adaptation. */
-		    /* And this is still less than ideal, because
-		     * it way overestimates tau for SCHMM due to
-		     * the large number of mixtures.  So for
-		     * semi-continuous models you probably want to
-		     * use -fixedtau. */
-		    wvar = si_mixw[i][j][k] * si_sigma;
-		    tau_dnom += dnom * ydiff * wvar * ydiff;
-		}
-		if (tau_dnom > 1e-5 && tau_nom > 1e-5)
-		    map_tau[i][j][k] = tau_nom / tau_dnom;
-		else
-		    map_tau[i][j][k] = 1000.0f; /* FIXME: Something big, I guess. */
+		ydiff = ml_mu - si_mu;
+		/* Gauvain/Lee's estimation of this makes no
+		 * sense as I read it, it seems to simply
+		 * equal the precision matrix.  We want to use
+		 * the variance anyway, because higher
+		 * variance in the SI models should lead to
+		 * stronger adaptation. */
+		/* And this is still less than ideal, because
+		 * it way overestimates tau for SCHMM due to
+		 * the large number of mixtures.  So for
+		 * semi-continuous models you probably want to
+		 * use -fixedtau. */
+		wvar = si_mixw[i][j][k] * si_sigma;
+		tau_dnom += dnom * ydiff * wvar * ydiff;
+	    }
+	    if (tau_dnom > 1e-5 && tau_nom > 1e-5)
+		map_tau[i][j][k] = tau_nom / tau_dnom;
+	    else
+		map_tau[i][j][k] = 1000.0f; /* FIXME: Something big, I guess. */
 #if 0
-		E_INFO("map_tau[%d][%d][%d] = %f / %f = %f\n",
-		       i, j, k, tau_nom, tau_dnom, map_tau[i][j][k]);
+	    E_INFO("map_tau[%d][%d][%d] = %f / %f = %f\n",
+		   i, j, k, tau_nom, tau_dnom, map_tau[i][j][k]);
 #endif
-	    }
 	}
     }
+}
 
-    return map_tau;
+static float32 ***
+estimate_tau(vector_t ***si_mean, vector_t ***si_var, float32 ***si_mixw,
+	     uint32 n_cb, uint32 n_stream, uint32 n_density, uint32 n_mixw, const uint32 *veclen,
+	     vector_t ***wt_mean, float32 ***wt_mixw, float32 ***wt_dcount)
+{
+    map_job_t proto;
+
+    E_INFO("Estimating tau hyperparameter from variances and observations\n");
+    memset(&proto, 0, sizeof(proto));
+    proto.fn = estimate_tau_range;
+    proto.si_mean = si_mean;
+    proto.si_var = si_var;
+    proto.si_mixw = si_mixw;
+    proto.wt_mean = wt_mean;
+    proto.wt_mixw = wt_mixw;
+    proto.wt_dcount = wt_dcount;
+    proto.n_stream = n_stream;
+    proto.n_density = n_density;
+    proto.veclen = veclen;
+    proto.map_tau = (float32 ***)ckd_calloc_3d(n_cb, n_stream, n_density, sizeof(float32));
+    map_run(&proto, n_cb);
+
+    return proto.map_tau;
 }
 
 static int
@@ -319,6 +407,47 @@ map_var_reest(float32 tau, vector_t ***si_mean, vector_t ***si_var,
     return S3_SUCCESS;
 }
 
+static void
+map_gau_range(map_job_t *job)
+{
+    uint32 u, i, j, k;
+
+    for (u = job->beg; u < job->end; ++u) {
+	i = u / job->n_stream;
+	j = u % job->n_stream;
+	for (k = 0; k < job->n_density; ++k) {
+	    float32 tau;
+
+	    if (job->map_tau == NULL)
+		tau = job->fixed_tau;
+	    else {
+		tau = job->map_tau[i][j][k];
+	    }
+
+	    /* Means re-estimation. */
+	    if (job->bayesmean)
+		bayes_mean_reest(job->si_mean, job->si_var,
+				 job->wt_mean, job->wt_var,
+				 job->wt_dcount, job->pass2var,
+				 job->map_mean, job->varfloor,
+				 i, j, k, job->veclen);
+	    else
+		map_mean_reest(tau, job->si_mean, job->wt_mean, job->wt_dcount,
+			       job->map_mean, i, j, k, job->veclen);
+
+
+	    /* Variance re-estimation.  Doesn't work with
+	     * -2passvar, and in many cases this can actually
+	     * degrade accuracy, so use it with caution. */
+	    if (job->map_var)
+		map_var_reest(tau, job->si_mean, job->si_var, job->wt_mean,
+			      job->wt_var, job->wt_dcount, job->map_mean,
+			      job->map_var, job->varfloor,
+			      i, j, k, job->veclen);
+	}
+    }
+}
+
 static int
 map_update(void)
 {
@@ -343,6 +472,7 @@ map_update(void)
     float32 mwfloor = 1e-5f;
     float32 varfloor = 1e-5f;
     float32 tpfloor = 1e-4f;
+    map_job_t proto;
 
     uint32 n_mixw, n_mixw_rd;
     uint32 n_tmat, n_tmat_rd, n_state, n_state_rd;
@@ -373,6 +503,9 @@ map_update(void)
     map_var_fn = cmd_ln_str("-mapvarfn");
     map_tmat_fn = cmd_ln_str("-maptmatfn");
     map_mixw_fn = cmd_ln_str("-mapmixwfn");
+    n_thread = cmd_ln_int32("-nthreads");
+    if (n_thread < 1)
+	n_thread = 1;
 
     /* Must be at least one accum dir. */
     if (accum_dir == NULL)
@@ -541,39 +674,24 @@ map_update(void)
     if (map_var)
 	E_INFO("Re-estimating variances using MAP\n");
 
-    for (i = 0; i < n_cb; ++i) {
-	for (j = 0; j < n_stream; ++j) {
-	    for (k = 0; k < n_density; ++k) {
-		float32 tau;
-
-		if (map_tau == NULL)
-		    tau = fixed_tau;
-		else {
-		    tau = map_tau[i][j][k];
-		}
-
-		/* Means re-estimation. */
-		if (cmd_ln_int32("-bayesmean"))
-		    bayes_mean_reest(si_mean, si_var,
-				     wt_mean, wt_var,
-				     wt_dcount, pass2var,
-				     map_mean, varfloor,
-				     i, j, k, veclen);
-		else
-		    map_mean_reest(tau, si_mean, wt_mean, wt_dcount,
-				   map_mean, i, j, k, veclen);
-
-
-		/* Variance re-estimation.  Doesn't work with
-		 * -2passvar, and in many cases this can actually
-		 * degrade accuracy, so use it with caution. */
-		if (map_var)
-		    map_var_reest(tau, si_mean, si_var, wt_mean, wt_var,
-				  wt_dcount, map_mean, map_var, varfloor,
-				  i, j, k, veclen);
-	    }
-	}
-    }
+    memset(&proto, 0, sizeof(proto));
+    proto.fn = map_gau_range;
+    proto.si_mean = si_mean;
+    proto.si_var = si_var;
+    proto.wt_mean = wt_mean;
+    proto.wt_var = wt_var;
+    proto.wt_dcount = wt_dcount;
+    proto.pass2var = pass2var;
+    proto.bayesmean = cmd_ln_int32("-bayesmean");
+    proto.map_tau = map_tau;
+    proto.fixed_tau = fixed_tau;
+    proto.varfloor = varfloor;
+    proto.map_mean = map_mean;
+    proto.map_var = map_var;
+    proto.n_stream = n_stream;
+    proto.n_density = n_density;
+    proto.veclen = veclen;
+    map_run(&proto, n_cb);
 
     if (map_mean_fn)
 	if (s3gau_write(map_mean_fn,
@@ -41,6 +41,7 @@
  *********************************************************************/
 
 #include <s3/s3.h>
+#include <sphinxbase/ckd_alloc.h>
 #include <stdlib.h>
 #include <string.h>
 #include "hash.h"
@@ -185,6 +186,7 @@ void freedicthash(dicthashelement_t **dicthash)
 	   free(e1->word);
 	   for (i=0;i<e1->nphns;i++) free(e1->phones[i]);
 	   free(e1->phones);
+	   ckd_free(e1->phnids);
            free(e1);
            e1 = e2;
         }
@@ -254,3 +256,85 @@ void freephnhash(phnhashelement_t **phnhash)
     }
     free(phnhash);
 }
+
+
+
+static uint32 tphnhash(uint64 key, uint32 size)
+{
+    /* Fibonacci hashing; size is a power of 2 */
+    return (uint32)((key * 0x9e3779b97f4a7c15ULL) >> 32) & (size - 1);
+}
+
+
+
+tphncount_t *tphncount_init(void)
+{
+    tphncount_t *tc;
+
+    tc = (tphncount_t *) ckd_calloc(1, sizeof(*tc));
+    tc->size = 4096;
+    tc->key = (uint64 *) ckd_malloc(tc->size * sizeof(uint64));
+    tc->count = (int32 *) ckd_calloc(tc->size, sizeof(int32));
+    memset(tc->key, 0xff, tc->size * sizeof(uint64));
+
+    return tc;
+}
+
+
+
+static void tphncount_grow(tphncount_t *tc)
+{
+    uint64 *okey = tc->key;
+    int32 *ocount = tc->count;
+    uint32 osize = tc->size, i, h;
+
+    tc->size *= 2;
+    tc->key = (uint64 *) ckd_malloc(tc->size * sizeof(uint64));
+    tc->count = (int32 *) ckd_calloc(tc->size, sizeof(int32));
+    memset(tc->key, 0xff, tc->size * sizeof(uint64));
+    for (i = 0; i < osize; i++){
+        if (okey[i] == TPHNKEY_EMPTY) continue;
+        for (h = tphnhash(okey[i], tc->size); tc->key[h] != TPHNKEY_EMPTY;
+             h = (h + 1) & (tc->size - 1));
+        tc->key[h] = okey[i];
+        tc->count[h] = ocount[i];
+    }
+    ckd_free(okey);
+    ckd_free(ocount);
+}
+
+
+
+void tphncount_add(tphncount_t *tc, uint64 key, int32 count)
+{
+    uint32 h;
+
+    for (h = tphnhash(key, tc->size); tc->key[h] != TPHNKEY_EMPTY;
+         h = (h + 1) & (tc->size - 1)) {
+        if (tc->key[h] == key) {
+            tc->count[h] += count;
+            return;
+        }
+    }
+
+    /* Keep the table at most half full */
+    if (2 * (tc->nkeys + 1) > tc->size) {
+        tphncount_grow(tc);
+        for (h = tphnhash(key, tc->size); tc->key[h] != TPHNKEY_EMPTY;
+             h = (h + 1) & (tc->size - 1));
+    }
+    tc->key[h] = key;
+    tc->count[h] = count;
+    tc->nkeys++;
+}
+
+
+
+void tphncount_free(tphncount_t *tc)
+{
+    if (tc == NULL)
+        return;
+    ckd_free(tc->key);
+    ckd_free(tc->count);
+    ckd_free(tc);
+}
@@ -71,6 +71,7 @@ typedef struct dicthashelement_t
 {
     char      *word;
     char      **phones;
+    int32     *phnids;
     int32     nphns;
     struct dicthashelement_t  *next;
 } dicthashelement_t;
@@ -80,10 +81,34 @@ typedef struct phnhashelement_t
 {
     char      *phone;
     int32     count;
+    int32     id;
     struct phnhashelement_t  *next;
 } phnhashelement_t;
 
 
+/*
+ * Open addressing table of triphone counts, keyed by the ids of the
+ * base phone, left and right contexts and word position packed into
+ * one 64-bit word.
+ */
+#define TPHNKEY(b,l,r,wp) (((uint64)(b) << 48) | ((uint64)(l) << 32) \
+			   | ((uint64)(r) << 16) | (uint64)(wp))
+#define TPHNKEY_BASE(k)   ((int32)(((k) >> 48) & 0xffff))
+#define TPHNKEY_LEFT(k)   ((int32)(((k) >> 32) & 0xffff))
+#define TPHNKEY_RIGHT(k)  ((int32)(((k) >> 16) & 0xffff))
+#define TPHNKEY_WPOS(k)   ((int32)((k) & 0xffff))
+#define TPHNKEY_EMPTY     (~(uint64)0)
+#define TPHNKEY_MAXID     0xfffe
+
+typedef struct tphncount_t
+{
+    uint64    *key;
+    int32     *count;
+    uint32    size;	/* always a power of 2 */
+    uint32    nkeys;
+} tphncount_t;
+
+
 hashelement_t *lookup(const char *basephone,
 		      const char *lctxt,
 		      const char *rctxt,
@@ -103,7 +128,12 @@ dicthashelement_t *dictlookup(char *word, dicthashelement_t **dicthash);
 dicthashelement_t *dictinstall(char *dictword, dicthashelement_t **dicthash);
 void freedicthash(dicthashelement_t **dicthash);
 
+phnhashelement_t *phnlookup(char *phone, phnhashelement_t **lhash);
 phnhashelement_t *phninstall(char *phone, phnhashelement_t **lhash);
 void freephnhash(phnhashelement_t **ephnhash);
 
+tphncount_t *tphncount_init(void);
+void tphncount_add(tphncount_t *tc, uint64 key, int32 count);
+void tphncount_free(tphncount_t *tc);
+
 #endif
@@ -50,6 +50,7 @@
 #include <sphinxbase/pio.h>
 #include <sphinxbase/cmd_ln.h>
 #include <sphinxbase/err.h>
+#include <sphinxbase/sbthread.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -453,142 +454,366 @@ int32 make_dict_triphone_list (dicthashelement_t **dicthash,
 }
 
 
+/* Lines of the transcript read at a time for each thread */
+#define LINES_PER_JOB 4096
+
+/*
+ * Counts of the triphones and phones in some lines of the transcript,
+ * kept by one thread until they are all merged at the end.
+ */
+typedef struct cnt_job_s {
+    dicthashelement_t **dicthash;
+    const int32 *isfiller;	/* isfiller[phone id] */
+    int32 silid;
+
+    char **lines;		/* lines of this job */
+    int32 nlines;
+    int32 lineno;		/* line number of the first of them */
+    dicthashelement_t **wordarr;
+    int32 wordarrsize;
+
+    tphncount_t *tphncount;
+    int32 *phncount;		/* phncount[phone id] */
+    uint64 *phnfirst;		/* where each phone was first seen */
+    int32 nwords, nswdtphns, nbwdtphns, niwdtphns, newdtphns;
+} cnt_job_t;
+
+
+static void count_phone(cnt_job_t *job, int32 id, uint64 where)
+{
+    if (job->phncount[id]++ == 0)
+	job->phnfirst[id] = where;
+}
+
+
+static int32 ctx_phone(cnt_job_t *job, int32 id)
+{
+    return job->isfiller[id] ? job->silid : id;
+}
+
+
+static void count_line(cnt_job_t *job, char *s, int32 lineno)
+{
+    dicthashelement_t **wordarr;
+    char *word;
+    int32 nwords, lnphns, *phn;
+    int32 basephone, lctxt, rctxt;
+    int32 i, j;
+    uint64 where;
+
+    /* Split the line in place, padding the words with NULL on
+     * both sides */
+    for (nwords = 0;; ) {
+	while (*s == ' ' || *s == '\t' || *s == '\n') s++;
+	if (*s == '\0') break;
+	word = s;
+	while (*s != '\0' && *s != ' ' && *s != '\t' && *s != '\n') s++;
+	if (*s != '\0') *s++ = '\0';
+
+	if (nwords + 2 >= job->wordarrsize) {
+	    job->wordarrsize = (nwords + 2) * 2;
+	    job->wordarr = (dicthashelement_t **)
+		ckd_realloc(job->wordarr,
+			    job->wordarrsize * sizeof(dicthashelement_t *));
+	}
+	nwords++;
+	if ((job->wordarr[nwords] = dictlookup(word,job->dicthash)) == NULL) {
+	    /* If word is surrounded by "()", assume it's the
+	     * utterance ID, and don't report it as an OOV */
+	    if (nwords == 1
+		|| ((word[0] != '(') && (word[strlen(word) - 1] != ')'))) {
+		E_WARN("Word %s not found in dictionary. Mapping to SIL.\n", word);
+	    }
+	}
+    }
+    if (nwords == 0)
+	return;
+    wordarr = job->wordarr;
+    wordarr[0] = wordarr[nwords+1] = NULL;
+    job->nwords += nwords;
+
+    /* Phones are numbered in transcript order, to install them in the
+     * same order as reading the transcript from one thread would. */
+    where = (uint64)lineno << 32;
+    for (i=1; i<=nwords; i++){/* Indices account for padded wordarr array */
+	if (wordarr[i] == NULL) continue;
+
+	lnphns = wordarr[i]->nphns;
+	phn = wordarr[i]->phnids;
+	if (lnphns == 1) {
+	    basephone = phn[0];
+	    count_phone(job, basephone, where++);
+	    if (job->isfiller[basephone]) continue;
+	    if (wordarr[i-1] != NULL)
+		lctxt = ctx_phone(job, wordarr[i-1]->phnids[wordarr[i-1]->nphns - 1]);
+	    else lctxt = job->silid;
+	    if (wordarr[i+1] != NULL)
+		rctxt = ctx_phone(job, wordarr[i+1]->phnids[0]);
+	    else rctxt = job->silid;
+	    tphncount_add(job->tphncount,
+			  TPHNKEY(basephone,lctxt,rctxt,WORD_POSN_SINGLE), 1);
+	    job->nswdtphns++;
+	}
+	else {
+	    basephone = phn[0];
+	    count_phone(job, basephone, where++);
+	    if (job->isfiller[basephone]) continue;
+	    if (wordarr[i-1] != NULL)
+		lctxt = ctx_phone(job, wordarr[i-1]->phnids[wordarr[i-1]->nphns - 1]);
+	    else lctxt = job->silid;
+	    rctxt = ctx_phone(job, phn[1]);
+	    tphncount_add(job->tphncount,
+			  TPHNKEY(basephone,lctxt,rctxt,WORD_POSN_BEGIN), 1);
+	    job->nbwdtphns++;
+
+	    for (j=1;j<lnphns-1;j++){
+		basephone = phn[j];
+		count_phone(job, basephone, where++);
+		if (job->isfiller[basephone]) continue;
+		lctxt = ctx_phone(job, phn[j-1]);
+		rctxt = ctx_phone(job, phn[j+1]);
+		tphncount_add(job->tphncount,
+			      TPHNKEY(basephone,lctxt,rctxt,WORD_POSN_INTERNAL), 1);
+		job->niwdtphns++;
+	    }
+
+	    basephone = phn[lnphns-1];
+	    count_phone(job, basephone, where++);
+	    if (job->isfiller[basephone]) continue;
+	    lctxt = ctx_phone(job, phn[lnphns-2]);
+	    if (wordarr[i+1] != NULL)
+		rctxt = ctx_phone(job, wordarr[i+1]->phnids[0]);
+	    else rctxt = job->silid;
+	    tphncount_add(job->tphncount,
+			  TPHNKEY(basephone,lctxt,rctxt,WORD_POSN_END), 1);
+	    job->newdtphns++;
+	}
+    }
+}
+
+
+static int count_lines(cnt_job_t *job)
+{
+    int32 i;
+
+    for (i = 0; i < job->nlines; i++)
+	count_line(job, job->lines[i], job->lineno + i);
+
+    return 0;
+}
+
+
+static int count_thread(sbthread_t *th)
+{
+    return count_lines((cnt_job_t *)sbthread_arg(th));
+}
+
+
+/* Give every phone in the dictionary an id, for counting by key */
+static int32 number_phones(dicthashelement_t **dicthash,
+			   phnhashelement_t **idhash,
+			   char ***out_phnname,
+			   int32 **out_isfiller)
+{
+    dicthashelement_t *word_el;
+    phnhashelement_t *phnptr;
+    char **phnname = NULL;
+    int32 *isfiller = NULL;
+    int32 nphones = 0, i, j;
+
+    phnptr = phninstall("SIL", idhash);
+    phnptr->id = nphones++;
+    for (i = 0; i < DICTHASHSIZE; i++){
+	for (word_el = dicthash[i]; word_el != NULL; word_el = word_el->next){
+	    ckd_free(word_el->phnids);
+	    word_el->phnids = (int32 *)ckd_calloc(word_el->nphns, sizeof(int32));
+	    for (j = 0; j < word_el->nphns; j++){
+		phnptr = phnlookup(word_el->phones[j], idhash);
+		if (phnptr == NULL) {
+		    if (nphones > TPHNKEY_MAXID)
+			E_FATAL("More than %d phones in dictionary\n",
+				TPHNKEY_MAXID);
+		    phnptr = phninstall(word_el->phones[j], idhash);
+		    phnptr->id = nphones++;
+		}
+		word_el->phnids[j] = phnptr->id;
+	    }
+	}
+    }
+
+    phnname = (char **)ckd_calloc(nphones, sizeof(char *));
+    isfiller = (int32 *)ckd_calloc(nphones, sizeof(int32));
+    for (i = 0; i < PHNHASHSIZE; i++){
+	for (phnptr = idhash[i]; phnptr != NULL; phnptr = phnptr->next){
+	    phnname[phnptr->id] = phnptr->phone;
+	    isfiller[phnptr->id] = IS_FILLER(phnptr->phone);
+	}
+    }
+
+    *out_phnname = phnname;
+    *out_isfiller = isfiller;
+    return nphones;
+}
+
+
+typedef struct phnfirst_s {
+    uint64 first;
+    int32 id;
+} phnfirst_t;
+
+
+static int cmp_phnfirst(const void *a, const void *b)
+{
+    uint64 fa = ((const phnfirst_t *)a)->first;
+    uint64 fb = ((const phnfirst_t *)b)->first;
+
+    return (fa > fb) - (fa < fb);
+}
+
+
 int32  count_triphones (const char *transfile,
 			dicthashelement_t **dicthash,
 			hashelement_t **tphnhash,
 			phnhashelement_t ***phnhash,
 			int ignore_wpos)
 {
-    int32  nbwdtphns, newdtphns, niwdtphns, nswdtphns;
-    int32  nwords, lnphns, n_totalwds;
+    int32  nbwdtphns, newdtphns, niwdtphns, nswdtphns, n_totalwds;
+    int32  nphones, nthreads, nlines, lineno, nfirst;
     lineiter_t *line = NULL;
-    char *tline;
-    char   *word, *basephone, *lctxt, *rctxt; 
-    char   silencephn[4];
-    const char* wpos;
-    int32  i, j;
-    dicthashelement_t **wordarr;
-    phnhashelement_t **lphnhash, *phnptr;
+    char   **phnname;
+    int32  *isfiller, *phncount;
+    uint64 *first;
+    phnfirst_t *order;
+    int32  i, t;
+    cnt_job_t *job;
+    sbthread_t **th;
+    phnhashelement_t **idhash, **lphnhash, *phnptr;
     hashelement_t *tphnptr;
     FILE   *fp;
 
-    strcpy(silencephn,"SIL");
     if ((fp = fopen(transfile,"r")) == NULL)
 	E_FATAL("Unable to open transcript file %s for reading!\n",transfile);
 
     E_INFO("Out of vocabulary words in transcript will be mapped to SIL!\n");
 
-    lphnhash = (phnhashelement_t**)calloc(PHNHASHSIZE,sizeof(phnhashelement_t));
-
-    n_totalwds = 0;
-    nbwdtphns = newdtphns = niwdtphns = nswdtphns = 0;
-
-    for (line = lineiter_start_clean(fp); line; line = lineiter_next(line)) {
-
-	tline = strdup(line->buf);
-        if (strtok(tline," \t\n") == NULL) {
-           free(tline);
-    	   continue;
-        }
+    idhash = (phnhashelement_t**)calloc(PHNHASHSIZE,sizeof(phnhashelement_t));
+    nphones = number_phones(dicthash, idhash, &phnname, &isfiller);
+
+    nthreads = cmd_ln_int32("-nthreads");
+    if (nthreads < 1) nthreads = 1;
+    job = (cnt_job_t *)ckd_calloc(nthreads, sizeof(cnt_job_t));
+    th = (sbthread_t **)ckd_calloc(nthreads, sizeof(sbthread_t *));
+    for (t = 0; t < nthreads; t++) {
+	job[t].dicthash = dicthash;
+	job[t].isfiller = isfiller;
+	job[t].silid = phnlookup("SIL", idhash)->id;
+	job[t].lines = (char **)ckd_calloc(LINES_PER_JOB, sizeof(char *));
+	job[t].tphncount = tphncount_init();
+	job[t].phncount = (int32 *)ckd_calloc(nphones, sizeof(int32));
+	job[t].phnfirst = (uint64 *)ckd_calloc(nphones, sizeof(uint64));
+    }
 
-        /* Count number of phones in pronunciation */
-        for(nwords=1; strtok(NULL," \t\n") != NULL; nwords++);
-	n_totalwds += nwords;
-	wordarr = (dicthashelement_t **)ckd_calloc(nwords+2,sizeof(dicthashelement_t*));
-        word = strtok(line->buf," \t\n"); 
-        if ((wordarr[1] = dictlookup(word,dicthash)) == NULL) {
-            E_WARN("Word %s not found in dictionary. Mapping to SIL.\n", word);
-        }
-        for (j=2; (word = strtok(NULL," \t\n")) != NULL; j++) {
-            if ((wordarr[j] = dictlookup(word,dicthash)) == NULL) {
-                /* If word is surrounded by "()", assume it's the
-                 * utterance ID, and don't report it as an OOV */
-                if ((word[0] != '(') && (word[strlen(word) - 1] != ')')) {
-                    E_WARN("Word %s not found in dictionary. Mapping to SIL.\n", word);
-                }
-            }
-        }       
-	for (i=1; i<=nwords; i++){/* Indices account for padded wordarr array */
-	    if (wordarr[i] == NULL) continue;
-
-	    lnphns = wordarr[i]->nphns;
-	    if (lnphns == 1) {
-		wpos = wordpos2str(WORD_POSN_SINGLE, ignore_wpos);
-		basephone = wordarr[i]->phones[0];
-		phnptr = phninstall(basephone,lphnhash);
-		phnptr->count++;
-		if (IS_FILLER(basephone)) continue;
-		if (wordarr[i-1] != NULL){
-		    lctxt = wordarr[i-1]->phones[wordarr[i-1]->nphns - 1];
-		    if (IS_FILLER(lctxt)) lctxt = silencephn;
-		}
-		else lctxt = silencephn;
-		if (wordarr[i+1] != NULL){
-		    rctxt = wordarr[i+1]->phones[0];
-		    if (IS_FILLER(rctxt)) rctxt = silencephn;
-		}
-		else rctxt = silencephn;
-		tphnptr = lookup(basephone,lctxt,rctxt,wpos,tphnhash);
-		(tphnptr->count)++;
-		nswdtphns++;
+    /* Read the transcript a batch of lines at a time, each thread
+     * counting its share of them into its own tables. */
+    line = lineiter_start_clean(fp);
+    lineno = 0;
+    while (line) {
+	for (t = 0; t < nthreads; t++) {
+	    for (nlines = 0; line && nlines < LINES_PER_JOB;
+		 line = lineiter_next(line)) {
+		ckd_free(job[t].lines[nlines]);
+		job[t].lines[nlines++] = ckd_salloc(line->buf);
 	    }
-	    else {
-		wpos = wordpos2str(WORD_POSN_BEGIN, ignore_wpos);
-		basephone = wordarr[i]->phones[0];
-		phnptr = phninstall(basephone,lphnhash);
-		phnptr->count++;
-		if (IS_FILLER(basephone)) continue;
-                if (!IS_FILLER(basephone)){
-		    if (wordarr[i-1] != NULL){
-		        lctxt = wordarr[i-1]->phones[wordarr[i-1]->nphns - 1];
-		        if (IS_FILLER(lctxt)) lctxt = silencephn;
-		    }
-		    else lctxt = silencephn;
-		    rctxt = wordarr[i]->phones[1];
-		    if (IS_FILLER(rctxt)) rctxt = silencephn;
-		    tphnptr = lookup(basephone,lctxt,rctxt,wpos,tphnhash);
-		    (tphnptr->count)++; 
-                    nbwdtphns++;
-	        }
-		wpos = wordpos2str(WORD_POSN_INTERNAL, ignore_wpos);
-		for (j=1;j<lnphns-1;j++){
-		    basephone = wordarr[i]->phones[j];
-		    phnptr = phninstall(basephone,lphnhash);
-		    phnptr->count++;
-		    if (IS_FILLER(basephone)) continue;
-		    lctxt = wordarr[i]->phones[j-1];
-		    if (IS_FILLER(lctxt)) lctxt = silencephn;
-		    rctxt = wordarr[i]->phones[j+1];
-		    if (IS_FILLER(rctxt)) rctxt = silencephn;
-		    tphnptr = lookup(basephone,lctxt,rctxt,wpos,tphnhash);
-		    (tphnptr->count)++;
-		    niwdtphns++;
-		}
-
-		wpos = wordpos2str(WORD_POSN_END, ignore_wpos);
-		basephone = wordarr[i]->phones[lnphns-1];
-		phnptr = phninstall(basephone,lphnhash);
-		phnptr->count++;
-		if (IS_FILLER(basephone)) continue;
-
-		lctxt = wordarr[i]->phones[lnphns-2];
-		if (IS_FILLER(lctxt)) lctxt = silencephn;
-		if (wordarr[i+1] != NULL){
-		    rctxt = wordarr[i+1]->phones[0];
-		    if (IS_FILLER(rctxt)) rctxt = silencephn;
-		}
-		else rctxt = silencephn;
-		tphnptr = lookup(basephone,lctxt,rctxt,wpos,tphnhash);
-		(tphnptr->count)++;
-		newdtphns++;
+	    job[t].nlines = nlines;
+	    job[t].lineno = lineno;
+	    lineno += nlines;
+	}
+	for (t = 1; t < nthreads; t++) {
+	    if (job[t].nlines == 0)
+		break;
+	    th[t] = sbthread_start(NULL, count_thread, &job[t]);
+	    if (th[t] == NULL) {
+		E_WARN("Failed to start counting thread; counting here\n");
+		count_lines(&job[t]);
+	    }
+	}
+	count_lines(&job[0]);
+	for (t = 1; t < nthreads; t++) {
+	    if (th[t]) {
+		sbthread_wait(th[t]);
+		sbthread_free(th[t]);
+		th[t] = NULL;
 	    }
 	}
-        free(wordarr);
-        free(tline);
     }
     fclose(fp);
     lineiter_free(line);
 
+    /* Merge the counts of all threads */
+    n_totalwds = nbwdtphns = newdtphns = niwdtphns = nswdtphns = 0;
+    phncount = (int32 *)ckd_calloc(nphones, sizeof(int32));
+    first = (uint64 *)ckd_calloc(nphones, sizeof(uint64));
+    for (t = 0; t < nthreads; t++) {
+	tphncount_t *tc = job[t].tphncount;
+
+	for (i = 0; i < tc->size; i++) {
+	    uint64 key = tc->key[i];
+
+	    if (key == TPHNKEY_EMPTY)
+		continue;
+	    tphnptr = lookup(phnname[TPHNKEY_BASE(key)],
+			     phnname[TPHNKEY_LEFT(key)],
+			     phnname[TPHNKEY_RIGHT(key)],
+			     wordpos2str(TPHNKEY_WPOS(key), ignore_wpos),
+			     tphnhash);
+	    if (tphnptr != NULL)
+		tphnptr->count += tc->count[i];
+	}
+	for (i = 0; i < nphones; i++) {
+	    if (job[t].phncount[i] == 0)
+		continue;
+	    if (phncount[i] == 0 || job[t].phnfirst[i] < first[i])
+		first[i] = job[t].phnfirst[i];
+	    phncount[i] += job[t].phncount[i];
+	}
+	n_totalwds += job[t].nwords;
+	nswdtphns += job[t].nswdtphns;
+	nbwdtphns += job[t].nbwdtphns;
+	niwdtphns += job[t].niwdtphns;
+	newdtphns += job[t].newdtphns;
+
+	for (i = 0; i < LINES_PER_JOB; i++)
+	    ckd_free(job[t].lines[i]);
+	ckd_free(job[t].lines);
+	ckd_free(job[t].wordarr);
+	tphncount_free(job[t].tphncount);
+	ckd_free(job[t].phncount);
+	ckd_free(job[t].phnfirst);
+    }
+    ckd_free(job);
+    ckd_free(th);
+
+    /* Install the phones in the order they were first seen */
+    order = (phnfirst_t *)ckd_calloc(nphones, sizeof(phnfirst_t));
+    for (i = nfirst = 0; i < nphones; i++) {
+	if (phncount[i] > 0) {
+	    order[nfirst].first = first[i];
+	    order[nfirst++].id = i;
+	}
+    }
+    qsort(order, nfirst, sizeof(phnfirst_t), cmp_phnfirst);
+    lphnhash = (phnhashelement_t**)calloc(PHNHASHSIZE,sizeof(phnhashelement_t));
+    for (i = 0; i < nfirst; i++) {
+	phnptr = phninstall(phnname[order[i].id],lphnhash);
+	phnptr->count = phncount[order[i].id];
+    }
+    ckd_free(order);
+    ckd_free(first);
+    ckd_free(phncount);
+    ckd_free(phnname);
+    ckd_free(isfiller);
+    freephnhash(idhash);
+
     *phnhash = lphnhash;
     E_INFO("%d words in transcripts\n",n_totalwds);
     E_INFO("%d single word triphones in transcripts\n",nswdtphns);
@@ -598,7 +823,7 @@ int32  count_triphones (const char *transfile,
 
     return S3_SUCCESS;
 }
-
+
 
 int32 find_threshold(hashelement_t  **triphonehash)
 {
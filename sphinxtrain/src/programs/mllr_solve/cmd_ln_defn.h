@@ -109,6 +109,11 @@ If you specific only -mllradd, then only b will be estimated. ";
           ARG_FLOAT32,
           "1e-3",
           "var floor value"},
+
+	{ "-nthreads",
+	  ARG_INT32,
+	  "1",
+	  "Number of threads to accumulate the MLLR statistics in" },
 	
 	{NULL, 0, NULL, NULL},
     };
@@ -51,6 +51,7 @@
 #include <s3/mllr.h>
 #include <s3/mllr_io.h>
 #include <s3/s3cb2mllr_io.h>
+#include <s3/run_jobs.h>
 
 #include <sys_compat/file.h>
 #include <sys_compat/misc.h>
@@ -63,6 +64,229 @@
 #define ABS(x)  	((x) < 0 ? (-(x)) : (x))
 #define VAR_CONST	0.5
 
+/* Number of densities whose statistics are gathered before they are
+ * added to G and Z */
+#define ACCUM_BLOCK	64
+
+/*
+ * A contiguous slice [beg, end) of the (class, stream, dimension)
+ * triples whose G and Z one thread accumulates.  Triple (m, j, l) is
+ * numbered m * tot_veclen + veclen[0] + ... + veclen[j - 1] + l.
+ */
+typedef struct accum_job_s {
+    vector_t ***mean;
+    vector_t ***wt_mean;
+    vector_t ***var;		/* inverted */
+    float32 ***wt_dcount;
+    uint32 **cls_cb;		/* codebooks of each class */
+    uint32 *n_cls_cb;
+    uint32 n_stream;
+    uint32 n_density;
+    const uint32 *veclen;
+    uint32 tot_veclen;
+    float32 *****regl;
+    float32 ****regr;
+    uint32 beg;
+    uint32 end;
+} accum_job_t;
+
+/*
+ * Accumulate G(l) and Z for dimensions [l_beg, l_end) of class m and
+ * stream j.  With xi = (mean, 1), a density with count c and inverse
+ * variances v adds c v_l xi xi^T to G(l), and v_l w_l xi to row l of
+ * Z, where w is its count-weighted observation sum.  The outer
+ * products of a block of densities are formed once, and each G(l)
+ * is then updated from all of them in one pass over its upper
+ * triangle.
+ */
+static void
+accum_class_stream(accum_job_t *job, uint32 m, uint32 j,
+		   uint32 l_beg, uint32 l_end)
+{
+    uint32 len = job->veclen[j];
+    uint32 n_l = l_end - l_beg;
+    uint32 n_xi = len + 1;
+    uint32 n_pq = n_xi * (n_xi + 1) / 2;
+    float64 *g, *z, *xx, *xi, *wc, *wm;
+    uint32 c, k, l, p, q, r, n_r, pq;
+
+    g = ckd_calloc((size_t)n_l * n_pq, sizeof(float64));
+    z = ckd_calloc((size_t)n_l * n_xi, sizeof(float64));
+    xx = ckd_calloc((size_t)ACCUM_BLOCK * n_pq, sizeof(float64));
+    xi = ckd_calloc((size_t)ACCUM_BLOCK * n_xi, sizeof(float64));
+    wc = ckd_calloc((size_t)ACCUM_BLOCK * n_l, sizeof(float64));
+    wm = ckd_calloc((size_t)ACCUM_BLOCK * n_l, sizeof(float64));
+
+    c = 0;
+    k = 0;
+    while (c < job->n_cls_cb[m]) {
+	/* Gather a block of densities that have been observed. */
+	for (n_r = 0; n_r < ACCUM_BLOCK && c < job->n_cls_cb[m]; ) {
+	    uint32 i = job->cls_cb[m][c];
+	    float32 dcount = job->wt_dcount[i][j][k];
+
+	    if (dcount > 0.) {
+		float32 *mu = job->mean[i][j][k];
+		float32 *iv = job->var[i][j][k];
+		float32 *wmu = job->wt_mean[i][j][k];
+		float64 *x = xi + n_r * n_xi;
+		float64 *o = xx + n_r * n_pq;
+
+		for (p = 0; p < len; p++)
+		    x[p] = mu[p];
+		x[len] = 1.0;
+		for (p = 0, pq = 0; p < n_xi; p++)
+		    for (q = p; q < n_xi; q++)
+			o[pq++] = x[p] * x[q];
+		for (l = l_beg; l < l_end; l++) {
+		    wc[n_r * n_l + l - l_beg] = (float64)dcount * iv[l];
+		    wm[n_r * n_l + l - l_beg] = (float64)wmu[l] * iv[l];
+		}
+		++n_r;
+	    }
+	    if (++k == job->n_density) {
+		k = 0;
+		++c;
+	    }
+	}
+
+	/* Add them to G and Z. */
+	for (l = 0; l < n_l; l++) {
+	    float64 *gl = g + (size_t)l * n_pq;
+	    float64 *zl = z + (size_t)l * n_xi;
+
+	    for (r = 0; r < n_r; r++) {
+		float64 a = wc[r * n_l + l];
+		float64 b = wm[r * n_l + l];
+		float64 *o = xx + r * n_pq;
+		float64 *x = xi + r * n_xi;
+
+		for (pq = 0; pq < n_pq; pq++)
+		    gl[pq] += a * o[pq];
+		for (p = 0; p < n_xi; p++)
+		    zl[p] += b * x[p];
+	    }
+	}
+    }
+
+    /* Store them, filling in the lower triangle of G(l). */
+    for (l = 0; l < n_l; l++) {
+	float32 **regl = job->regl[m][j][l_beg + l];
+	float32 *regr = job->regr[m][j][l_beg + l];
+	float64 *gl = g + (size_t)l * n_pq;
+
+	for (p = 0, pq = 0; p < n_xi; p++) {
+	    for (q = p; q < n_xi; q++, pq++)
+		regl[p][q] = regl[q][p] = (float32)gl[pq];
+	    regr[p] = (float32)z[l * n_xi + p];
+	}
+    }
+
+    ckd_free(g);
+    ckd_free(z);
+    ckd_free(xx);
+    ckd_free(xi);
+    ckd_free(wc);
+    ckd_free(wm);
+}
+
+static void
+accum_range(accum_job_t *job)
+{
+    uint32 u, m, j, l, l_end, off;
+
+    for (u = job->beg; u < job->end; u += l_end - l) {
+	m = u / job->tot_veclen;
+	off = u % job->tot_veclen;
+	for (j = 0; off >= job->veclen[j]; j++)
+	    off -= job->veclen[j];
+	l = off;
+	l_end = job->veclen[j];
+	if (l_end - l > job->end - u)
+	    l_end = l + job->end - u;
+	accum_class_stream(job, m, j, l, l_end);
+    }
+}
+
+static void
+accum_job(void *arg)
+{
+    accum_range((accum_job_t *)arg);
+}
+
+/* Accumulate Legetter's G and Z for all classes in n_thread threads. */
+static void
+accum_regl_regr(float32 *****regl,
+		float32 ****regr,
+		vector_t ***mean,
+		vector_t ***wt_mean,
+		vector_t ***var,
+		float32 ***wt_dcount,
+		uint32 gau_begin,
+		int32 *cb2mllr,
+		uint32 n_mgau,
+		uint32 n_stream,
+		uint32 n_density,
+		uint32 n_mllr_class,
+		const uint32 *veclen,
+		int32 n_thread)
+{
+    accum_job_t proto, *job;
+    uint32 **cls_cb, *n_cls_cb;
+    uint32 i, j, n_unit, n_job;
+    int32 mc;
+
+    /* List the codebooks of each class. */
+    n_cls_cb = ckd_calloc(n_mllr_class, sizeof(uint32));
+    for (i = gau_begin; i < n_mgau; i++) {
+	if (cb2mllr[i] >= 0)
+	    ++n_cls_cb[cb2mllr[i]];
+    }
+    cls_cb = ckd_calloc(n_mllr_class, sizeof(uint32 *));
+    for (j = 0; j < n_mllr_class; j++) {
+	cls_cb[j] = ckd_calloc(n_cls_cb[j] + 1, sizeof(uint32));
+	n_cls_cb[j] = 0;
+    }
+    for (i = gau_begin; i < n_mgau; i++) {
+	if ((mc = cb2mllr[i]) >= 0)
+	    cls_cb[mc][n_cls_cb[mc]++] = i;
+    }
+
+    memset(&proto, 0, sizeof(proto));
+    proto.mean = mean;
+    proto.wt_mean = wt_mean;
+    proto.var = var;
+    proto.wt_dcount = wt_dcount;
+    proto.cls_cb = cls_cb;
+    proto.n_cls_cb = n_cls_cb;
+    proto.n_stream = n_stream;
+    proto.n_density = n_density;
+    proto.veclen = veclen;
+    for (j = 0; j < n_stream; j++)
+	proto.tot_veclen += veclen[j];
+    proto.regl = regl;
+    proto.regr = regr;
+
+    n_unit = n_mllr_class * proto.tot_veclen;
+    n_job = (n_thread > 1 ? n_thread : 1);
+    if (n_job > n_unit)
+	n_job = (n_unit > 0 ? n_unit : 1);
+
+    job = (accum_job_t *)ckd_calloc(n_job, sizeof(accum_job_t));
+    for (j = 0; j < n_job; j++) {
+	job[j] = proto;
+	job[j].beg = (uint32)((uint64)n_unit * j / n_job);
+	job[j].end = (uint32)((uint64)n_unit * (j + 1) / n_job);
+    }
+    run_jobs(accum_job, job, sizeof(accum_job_t), n_job);
+    ckd_free(job);
+
+    for (j = 0; j < n_mllr_class; j++)
+	ckd_free(cls_cb[j]);
+    ckd_free(cls_cb);
+    ckd_free(n_cls_cb);
+}
+
 
 static int
 initialize(int argc,
@@ -106,19 +330,13 @@ mllr_mat(float32 	*****out_A,
       float32 	*****regl  	= NULL; 
       float32 	****regr   	= NULL; 
 
-      float32     wt_mean_var;
-      float32     wt_dcount_var;
-      float32     wt_dcount_var_mean;
-
-      float32	*tmean		= NULL; 
       uint32 	n_mgau_rd; 
       uint32 	n_stream_rd; 
       uint32 	n_density_rd; 
 
       uint32    *veclen_rd	= NULL; 
 
-      uint32 i, j, k, l, s, p , q;
-      int32 m, mc;
+      uint32 i, j, k, l, s;
       int32 len=0;
 
       /*      uint32 	i, j, k, l, p, q, s; 
@@ -221,63 +439,25 @@ mllr_mat(float32 	*****out_A,
           } 
       } 
       
-      /*      E_INFO(" Checking\n");*/
-
-      for (i = gau_begin; i < n_mgau; i++) { 
-        mc = cb2mllr[i]; 
-	if (mc < 0) continue;	/* skip */
-
-        for (j = 0; j < n_stream; j++) { 
-	  len=veclen[j];
-
-	  for (k = 0; k < n_density; k++) { 
-	    if (wt_dcount[i][j][k] > 0.) { 
-	      tmean = mean[i][j][k]; 
-	      for (l = 0; l < len; l++) { 
-		wt_mean_var   = wt_mean[i][j][k][l] * var[i][j][k][l]; 
-		wt_dcount_var = wt_dcount[i][j][k]  * var[i][j][k][l]; 
-		
-		for (p = 0; p < len; p++) { 
-		  wt_dcount_var_mean = wt_dcount_var * tmean[p]; 
-		  for (q = p; q < len; q++) { 
-		    /* This is g(l)_{pq} = sum_r(v_{ii}(r) d_{pq}(r))*/
-		    /* or in other words sum(likelihood * invvar * outer(mean, mean)) */
-		    regl[mc][j][l][p][q] += (float32) (wt_dcount_var_mean * tmean[q]); 
-		  } 
-		  /* G corresponding to extended element of q. */
-		  regl[mc][j][l][p][len] += (float32)(wt_dcount_var_mean); 
-		  /* This is z_{lp} = sum(likelihood * invvar * obs * mean_p) */
-		  regr[mc][j][l][p] += (float32)(wt_mean_var * tmean[p]); 
-		} 
-		/* G corresponding to extended element of p and q. */
-		/* Question: what about regl[mc][j][l][len][0..len]? */
-		/* Answer: G(l) is symmetric, so we already calculated them. */
-		regl[mc][j][l][len][len] += (float32)wt_dcount_var; 
-		/* Z corresponding to extended element of p. */
-		regr[mc][j][l][len] += (float32)(wt_mean_var); 
-	      } 
-	    } 
-	  } 
-	} 
-      }
+      accum_regl_regr(regl,
+		      regr,
+		      mean,
+		      wt_mean,
+		      var,
+		      wt_dcount,
+		      gau_begin,
+		      cb2mllr,
+		      n_mgau,
+		      n_stream,
+		      n_density,
+		      n_mllr_class,
+		      veclen,
+		      cmd_ln_int32("-nthreads"));
 
       gauden_free_param(mean); 
       gauden_free_param(wt_mean); 
       ckd_free_3d((void ***)wt_dcount); 
 
-      /* Fill in the lower triangular part of regl. */
-      for (m = 0; m < n_mllr_class; m++) { 
-        for (j = 0; j < n_stream; j++) { 
-	  for (l = 0; l < veclen[j]; l++) { 
-	    for (p = 0; p <= veclen[j]; p++) { 
-	      for (q = p+1; q <= veclen[j]; q++) { 
-		regl[m][j][l][q][p] = regl[m][j][l][p][q]; 
-	      } 
-	    } 
-	  } 
-        } 
-      } 
-
       E_INFO(" ---- B. Compute MLLR matrices (A,B)\n"); 
       if(compute_mllr(regl, 
   		    regr, 
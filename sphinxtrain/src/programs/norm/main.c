@@ -58,6 +58,7 @@
 #include <s3/mllr_io.h>
 
 #include <sphinxbase/matrix.h>
+#include <sphinxbase/sbthread.h>
 
 #include <sys_compat/file.h>
 #include <sys_compat/misc.h>
@@ -84,6 +85,806 @@ initialize(int argc,
 }
 
 
+/* Reestimation sums read from some of the accumulator directories */
+typedef struct norm_acc_s {
+    const char **dirs;
+    uint32 n_dirs;
+    int32 read_mixw;
+    int32 read_tmat;
+    int32 read_den;
+    int32 var_is_full;
+
+    float32 ***mixw_acc;
+    uint32 n_mixw;
+    uint32 n_stream;
+    uint32 n_density;
+
+    float32 ***tmat_acc;
+    uint32 n_tmat;
+    uint32 n_state_pm;
+
+    vector_t ***wt_mean;
+    vector_t ***wt_var;
+    vector_t ****wt_fullvar;
+    int32 pass2var;
+    float32 ***dnom;
+    uint32 n_mgau;
+    uint32 n_gau_stream;
+    uint32 n_gau_density;
+    uint32 *veclen;
+
+    struct norm_acc_s *other;	/* Sums to add to these ones */
+    sbthread_t *thread;
+} norm_acc_t;
+
+/* Add the counts of each directory in turn, so that only one of them
+ * is in memory at a time besides the sums. */
+static int
+read_accum_dirs(norm_acc_t *acc)
+{
+    uint32 i;
+
+    for (i = 0; i < acc->n_dirs; i++) {
+	E_INFO("Reading and accumulating counts from %s\n", acc->dirs[i]);
+
+	if (acc->read_mixw) {
+	    rdacc_mixw(acc->dirs[i],
+		       &acc->mixw_acc, &acc->n_mixw,
+		       &acc->n_stream, &acc->n_density);
+	}
+
+	if (acc->read_tmat) {
+	    rdacc_tmat(acc->dirs[i],
+		       &acc->tmat_acc, &acc->n_tmat, &acc->n_state_pm);
+	}
+
+	if (acc->read_den) {
+	    if (acc->var_is_full)
+		rdacc_den_full(acc->dirs[i],
+			       &acc->wt_mean,
+			       &acc->wt_fullvar,
+			       &acc->pass2var,
+			       &acc->dnom,
+			       &acc->n_mgau,
+			       &acc->n_gau_stream,
+			       &acc->n_gau_density,
+			       &acc->veclen);
+	    else
+		rdacc_den(acc->dirs[i],
+			  &acc->wt_mean,
+			  &acc->wt_var,
+			  &acc->pass2var,
+			  &acc->dnom,
+			  &acc->n_mgau,
+			  &acc->n_gau_stream,
+			  &acc->n_gau_density,
+			  &acc->veclen);
+	}
+    }
+
+    return 0;
+}
+
+/* Add the sums in acc->other to those in acc and free them. */
+static int
+merge_accum(norm_acc_t *acc)
+{
+    norm_acc_t *in = acc->other;
+    uint32 i;
+
+    if (in->mixw_acc) {
+	if (acc->mixw_acc == NULL) {
+	    acc->mixw_acc = in->mixw_acc;
+	    acc->n_mixw = in->n_mixw;
+	    acc->n_stream = in->n_stream;
+	    acc->n_density = in->n_density;
+	}
+	else if (acc->n_mixw != in->n_mixw
+		 || acc->n_stream != in->n_stream
+		 || acc->n_density != in->n_density) {
+	    E_ERROR("Mixing weight counts of %s and %s differ in shape\n",
+		    acc->dirs[0], in->dirs[0]);
+	    ckd_free_3d((void ***)in->mixw_acc);
+	}
+	else {
+	    accum_3d(acc->mixw_acc, in->mixw_acc,
+		     acc->n_mixw, acc->n_stream, acc->n_density);
+	    ckd_free_3d((void ***)in->mixw_acc);
+	}
+    }
+
+    if (in->tmat_acc) {
+	if (acc->tmat_acc == NULL) {
+	    acc->tmat_acc = in->tmat_acc;
+	    acc->n_tmat = in->n_tmat;
+	    acc->n_state_pm = in->n_state_pm;
+	}
+	else if (acc->n_tmat != in->n_tmat
+		 || acc->n_state_pm != in->n_state_pm) {
+	    E_ERROR("Transition counts of %s and %s differ in shape\n",
+		    acc->dirs[0], in->dirs[0]);
+	    ckd_free_3d((void ***)in->tmat_acc);
+	}
+	else {
+	    accum_3d(acc->tmat_acc, in->tmat_acc,
+		     acc->n_tmat, acc->n_state_pm - 1, acc->n_state_pm);
+	    ckd_free_3d((void ***)in->tmat_acc);
+	}
+    }
+
+    if (in->wt_mean) {
+	int err = FALSE;
+
+	if (acc->wt_mean == NULL) {
+	    acc->wt_mean = in->wt_mean;
+	    acc->wt_var = in->wt_var;
+	    acc->wt_fullvar = in->wt_fullvar;
+	    acc->pass2var = in->pass2var;
+	    acc->dnom = in->dnom;
+	    acc->n_mgau = in->n_mgau;
+	    acc->n_gau_stream = in->n_gau_stream;
+	    acc->n_gau_density = in->n_gau_density;
+	    acc->veclen = in->veclen;
+
+	    return 0;
+	}
+
+	if (acc->n_mgau != in->n_mgau
+	    || acc->n_gau_stream != in->n_gau_stream
+	    || acc->n_gau_density != in->n_gau_density
+	    || acc->pass2var != in->pass2var)
+	    err = TRUE;
+	for (i = 0; !err && i < acc->n_gau_stream; i++) {
+	    if (acc->veclen[i] != in->veclen[i])
+		err = TRUE;
+	}
+
+	if (err) {
+	    E_ERROR("Density counts of %s and %s differ in shape\n",
+		    acc->dirs[0], in->dirs[0]);
+	}
+	else {
+	    accum_3d(acc->dnom, in->dnom,
+		     acc->n_mgau, acc->n_gau_stream, acc->n_gau_density);
+	    gauden_accum_param(acc->wt_mean, in->wt_mean,
+			       acc->n_mgau, acc->n_gau_stream,
+			       acc->n_gau_density, acc->veclen);
+	    if (acc->wt_var && in->wt_var)
+		gauden_accum_param(acc->wt_var, in->wt_var,
+				   acc->n_mgau, acc->n_gau_stream,
+				   acc->n_gau_density, acc->veclen);
+	    if (acc->wt_fullvar && in->wt_fullvar)
+		gauden_accum_param_full(acc->wt_fullvar, in->wt_fullvar,
+					acc->n_mgau, acc->n_gau_stream,
+					acc->n_gau_density, acc->veclen);
+	}
+
+	ckd_free_3d((void ***)in->dnom);
+	gauden_free_param(in->wt_mean);
+	if (in->wt_var)
+	    gauden_free_param(in->wt_var);
+	if (in->wt_fullvar)
+	    gauden_free_param_full(in->wt_fullvar);
+	ckd_free(in->veclen);
+    }
+
+    return 0;
+}
+
+static int
+read_accum_thread(sbthread_t *th)
+{
+    return read_accum_dirs(sbthread_arg(th));
+}
+
+static int
+merge_accum_thread(sbthread_t *th)
+{
+    return merge_accum(sbthread_arg(th));
+}
+
+/*
+ * Sum the counts of all the accumulator directories into out.  With
+ * n_thread > 1 the directories are split between that many threads,
+ * each reading its share into its own sums, and these are then added
+ * pairwise, also in parallel, in a binary tree.
+ */
+static void
+read_accum(norm_acc_t *out,
+	   const char **dirs,
+	   uint32 n_thread)
+{
+    norm_acc_t *part;
+    uint32 n_dirs, i, step, start;
+
+    for (n_dirs = 0; dirs[n_dirs]; n_dirs++)
+	;
+    if (n_thread > n_dirs)
+	n_thread = n_dirs;
+    if (n_thread <= 1) {
+	out->dirs = dirs;
+	out->n_dirs = n_dirs;
+	read_accum_dirs(out);
+	return;
+    }
+
+    E_INFO("Reading %u accumulator directories in %u threads\n",
+	   n_dirs, n_thread);
+    part = ckd_calloc(n_thread, sizeof(*part));
+    for (i = start = 0; i < n_thread; i++) {
+	part[i] = *out;
+	part[i].dirs = dirs + start;
+	part[i].n_dirs = n_dirs / n_thread + (i < n_dirs % n_thread);
+	start += part[i].n_dirs;
+	if ((part[i].thread = sbthread_start(NULL, read_accum_thread,
+					     &part[i])) == NULL)
+	    E_FATAL("Failed to start thread %u\n", i);
+    }
+    for (i = 0; i < n_thread; i++) {
+	sbthread_wait(part[i].thread);
+	sbthread_free(part[i].thread);
+    }
+
+    for (step = 1; step < n_thread; step *= 2) {
+	for (i = 0; i + step < n_thread; i += 2 * step) {
+	    part[i].other = &part[i + step];
+	    if ((part[i].thread = sbthread_start(NULL, merge_accum_thread,
+						 &part[i])) == NULL)
+		E_FATAL("Failed to start thread %u\n", i);
+	}
+	for (i = 0; i + step < n_thread; i += 2 * step) {
+	    sbthread_wait(part[i].thread);
+	    sbthread_free(part[i].thread);
+	}
+    }
+
+    *out = part[0];
+    out->dirs = dirs;
+    out->n_dirs = n_dirs;
+    ckd_free(part);
+}
+
+/* Density counts mapped from every accumulator directory, to be
+ * summed and normalized one codebook at a time instead of all at
+ * once. */
+typedef struct norm_den_s {
+    uint32 n_dirs;
+    s3mmap_t **map;
+    vector_t ****wt_mean;	/* Per directory */
+    vector_t ****wt_var;
+    vector_t *****wt_fullvar;
+    float32 ****dnom;
+    int32 pass2var;
+    int32 var_is_full;
+    uint32 n_mgau;
+    uint32 n_stream;
+    uint32 n_density;
+    uint32 *veclen;
+    uint32 mean_size;		/* Values per codebook */
+    uint32 var_size;
+
+    vector_t ***in_mean;
+    vector_t ***in_var;
+    vector_t ****in_fullvar;
+    s3mmap_t *in_mean_map;
+    s3mmap_t *in_var_map;
+
+    int32 do_mean;
+    int32 do_var;
+} norm_den_t;
+
+/* One codebook of sums, normalized in place. */
+typedef struct norm_cb_s {
+    float32 *mean_buf;
+    float32 *var_buf;
+    float32 *dnom_buf;
+    vector_t **mean;
+    vector_t **var;
+    vector_t ***fullvar;
+    float32 **dnom;
+} norm_cb_t;
+
+/* Sums of codebooks first, first + step, ... queued in order for
+ * the writer. */
+typedef struct norm_worker_s {
+    norm_den_t *den;
+    uint32 first;
+    uint32 step;
+    norm_cb_t *ring;
+    uint32 depth;
+    uint32 head;
+    uint32 count;
+    sbmtx_t *mtx;		/* Guards head and count */
+    sbevent_t *filled;
+    sbevent_t *drained;
+    sbthread_t *thread;
+} norm_worker_t;
+
+static void
+norm_den_free(norm_den_t *den)
+{
+    uint32 i;
+
+    for (i = 0; i < den->n_dirs; i++)
+	s3mmap_close(den->map[i]);
+    ckd_free(den->map);
+    ckd_free(den->wt_mean);
+    ckd_free(den->wt_var);
+    ckd_free(den->wt_fullvar);
+    ckd_free(den->dnom);
+
+    if (den->in_mean_map)
+	s3mmap_close(den->in_mean_map);
+    else if (den->in_mean)
+	gauden_free_param(den->in_mean);
+    if (den->in_var_map)
+	s3mmap_close(den->in_var_map);
+    else if (den->in_var)
+	gauden_free_param(den->in_var);
+    else if (den->in_fullvar)
+	gauden_free_param_full(den->in_fullvar);
+
+    memset(den, 0, sizeof(*den));
+}
+
+/*
+ * Map the density counts of all the accumulator directories.  Returns
+ * FALSE, having mapped nothing, if some of them cannot be mapped or
+ * do not agree, in which case they are best read as usual.
+ */
+static int
+norm_den_map(norm_den_t *den,
+	     const char **dirs,
+	     int32 var_is_full)
+{
+    char file_name[MAXPATHLEN+1];
+    vector_t ***wt_var;
+    vector_t ****wt_fullvar;
+    uint32 i, j, n_mgau, n_stream, n_density, *veclen;
+    int32 pass2var, rv;
+
+    memset(den, 0, sizeof(*den));
+    for (den->n_dirs = 0; dirs[den->n_dirs]; den->n_dirs++)
+	;
+    den->map = ckd_calloc(den->n_dirs, sizeof(*den->map));
+    den->wt_mean = ckd_calloc(den->n_dirs, sizeof(*den->wt_mean));
+    den->wt_var = ckd_calloc(den->n_dirs, sizeof(*den->wt_var));
+    den->wt_fullvar = ckd_calloc(den->n_dirs, sizeof(*den->wt_fullvar));
+    den->dnom = ckd_calloc(den->n_dirs, sizeof(*den->dnom));
+    den->var_is_full = var_is_full;
+
+    for (i = 0; i < den->n_dirs; i++) {
+	sprintf(file_name, "%s/gauden_counts", dirs[i]);
+	wt_var = NULL;
+	wt_fullvar = NULL;
+	if (var_is_full)
+	    rv = s3gaucnt_map_full(file_name, &den->map[i],
+				   &den->wt_mean[i], &wt_fullvar,
+				   &pass2var, &den->dnom[i],
+				   &n_mgau, &n_stream, &n_density, &veclen);
+	else
+	    rv = s3gaucnt_map(file_name, &den->map[i],
+			      &den->wt_mean[i], &wt_var,
+			      &pass2var, &den->dnom[i],
+			      &n_mgau, &n_stream, &n_density, &veclen);
+	if (rv != S3_SUCCESS)
+	    goto error;
+	den->wt_var[i] = wt_var;
+	den->wt_fullvar[i] = wt_fullvar;
+
+	if (den->wt_mean[i] == NULL) {
+	    E_INFO("No means in %s\n", file_name);
+	    goto error;
+	}
+	if (i == 0) {
+	    den->pass2var = pass2var;
+	    den->n_mgau = n_mgau;
+	    den->n_stream = n_stream;
+	    den->n_density = n_density;
+	    den->veclen = veclen;
+	    continue;
+	}
+	if (n_mgau != den->n_mgau
+	    || n_stream != den->n_stream
+	    || n_density != den->n_density
+	    || pass2var != den->pass2var
+	    || (wt_var == NULL) != (den->wt_var[0] == NULL)
+	    || (wt_fullvar == NULL) != (den->wt_fullvar[0] == NULL)) {
+	    E_INFO("Density counts of %s and %s differ\n", dirs[0], dirs[i]);
+	    goto error;
+	}
+	for (j = 0; j < n_stream; j++) {
+	    if (veclen[j] != den->veclen[j]) {
+		E_INFO("Density counts of %s and %s differ\n", dirs[0], dirs[i]);
+		goto error;
+	    }
+	}
+    }
+
+    for (j = 0; j < den->n_stream; j++) {
+	den->mean_size += den->veclen[j];
+	den->var_size += var_is_full
+	    ? den->veclen[j] * den->veclen[j] : den->veclen[j];
+    }
+    den->mean_size *= den->n_density;
+    den->var_size *= den->n_density;
+
+    return TRUE;
+
+error:
+    norm_den_free(den);
+    return FALSE;
+}
+
+/* Map (or failing that, read) the parameters that unseen densities
+ * are copied from. */
+static void
+norm_den_map_in(norm_den_t *den,
+		const char *in_mean_fn,
+		const char *in_var_fn)
+{
+    uint32 n_mgau, n_stream, n_density, *veclen;
+    int32 rv;
+
+    if (in_mean_fn) {
+	if (s3gau_map(in_mean_fn, &den->in_mean_map, &den->in_mean,
+		      &n_mgau, &n_stream, &n_density, &veclen) != S3_SUCCESS) {
+	    den->in_mean_map = NULL;
+	    if (s3gau_read(in_mean_fn, &den->in_mean,
+			   &n_mgau, &n_stream, &n_density,
+			   &veclen) != S3_SUCCESS)
+		E_FATAL_SYSTEM("Couldn't read %s", in_mean_fn);
+	    ckd_free(veclen);
+	}
+	if (n_mgau != den->n_mgau || n_stream != den->n_stream
+	    || n_density != den->n_density)
+	    E_FATAL("%s is %ux%ux%u, but the counts are %ux%ux%u\n",
+		    in_mean_fn, n_mgau, n_stream, n_density,
+		    den->n_mgau, den->n_stream, den->n_density);
+    }
+
+    if (in_var_fn) {
+	if (den->var_is_full)
+	    rv = s3gau_map_full(in_var_fn, &den->in_var_map, &den->in_fullvar,
+				&n_mgau, &n_stream, &n_density, &veclen);
+	else
+	    rv = s3gau_map(in_var_fn, &den->in_var_map, &den->in_var,
+			   &n_mgau, &n_stream, &n_density, &veclen);
+	if (rv != S3_SUCCESS) {
+	    den->in_var_map = NULL;
+	    if (den->var_is_full)
+		rv = s3gau_read_full(in_var_fn, &den->in_fullvar,
+				     &n_mgau, &n_stream, &n_density, &veclen);
+	    else
+		rv = s3gau_read(in_var_fn, &den->in_var,
+				&n_mgau, &n_stream, &n_density, &veclen);
+	    if (rv != S3_SUCCESS)
+		E_FATAL_SYSTEM("Couldn't read %s", in_var_fn);
+	    ckd_free(veclen);
+	}
+	if (n_mgau != den->n_mgau || n_stream != den->n_stream
+	    || n_density != den->n_density)
+	    E_FATAL("%s is %ux%ux%u, but the counts are %ux%ux%u\n",
+		    in_var_fn, n_mgau, n_stream, n_density,
+		    den->n_mgau, den->n_stream, den->n_density);
+    }
+}
+
+static void
+norm_cb_init(norm_cb_t *cb,
+	     norm_den_t *den)
+{
+    uint32 maxveclen, j;
+
+    cb->mean_buf = ckd_calloc(den->mean_size, sizeof(float32));
+    cb->var_buf = ckd_calloc(den->var_size, sizeof(float32));
+    cb->dnom_buf = ckd_calloc(den->n_stream * den->n_density,
+			      sizeof(float32));
+    cb->mean = (vector_t **)ckd_calloc_2d(den->n_stream, den->n_density,
+					  sizeof(vector_t));
+    cb->dnom = ckd_calloc(den->n_stream, sizeof(float32 *));
+    if (den->var_is_full) {
+	for (j = 0, maxveclen = 0; j < den->n_stream; j++) {
+	    if (den->veclen[j] > maxveclen)
+		maxveclen = den->veclen[j];
+	}
+	cb->fullvar = (vector_t ***)ckd_calloc_3d(den->n_stream,
+						  den->n_density, maxveclen,
+						  sizeof(vector_t));
+    }
+    else {
+	cb->var = (vector_t **)ckd_calloc_2d(den->n_stream, den->n_density,
+					     sizeof(vector_t));
+    }
+}
+
+static void
+norm_cb_free(norm_cb_t *cb)
+{
+    ckd_free(cb->mean_buf);
+    ckd_free(cb->var_buf);
+    ckd_free(cb->dnom_buf);
+    ckd_free_2d((void **)cb->mean);
+    ckd_free(cb->dnom);
+    if (cb->fullvar)
+	ckd_free_3d((void ***)cb->fullvar);
+    if (cb->var)
+	ckd_free_2d((void **)cb->var);
+}
+
+/* Point cb's vectors at its buffers.  This is redone for each
+ * codebook, as full covariances of unseen densities are replaced by
+ * pointing them elsewhere. */
+static void
+norm_cb_layout(norm_cb_t *cb,
+	       norm_den_t *den)
+{
+    uint32 j, k, l, r, rv;
+
+    for (j = 0, r = rv = 0; j < den->n_stream; j++) {
+	cb->dnom[j] = &cb->dnom_buf[j * den->n_density];
+	for (k = 0; k < den->n_density; k++) {
+	    cb->mean[j][k] = &cb->mean_buf[r];
+	    if (cb->var)
+		cb->var[j][k] = &cb->var_buf[r];
+	    r += den->veclen[j];
+	    if (cb->fullvar) {
+		for (l = 0; l < den->veclen[j]; l++) {
+		    cb->fullvar[j][k][l] = &cb->var_buf[rv];
+		    rv += den->veclen[j];
+		}
+	    }
+	}
+    }
+}
+
+/* Sum in a the n values at b of every directory. */
+static void
+norm_cb_sum(float32 *a,
+	    float32 **b,
+	    uint32 n_dirs,
+	    uint32 n)
+{
+    uint32 d, i;
+
+    memcpy(a, b[0], n * sizeof(float32));
+    for (d = 1; d < n_dirs; d++) {
+	for (i = 0; i < n; i++)
+	    a[i] += b[d][i];
+    }
+}
+
+/* Sum the counts of codebook i and normalize them into cb. */
+static void
+norm_cb(norm_cb_t *cb,
+	norm_den_t *den,
+	uint32 i)
+{
+    float32 **src;
+    uint32 d;
+
+    norm_cb_layout(cb, den);
+
+    src = ckd_calloc(den->n_dirs, sizeof(*src));
+    for (d = 0; d < den->n_dirs; d++)
+	src[d] = den->dnom[d][i][0];
+    norm_cb_sum(cb->dnom_buf, src, den->n_dirs,
+		den->n_stream * den->n_density);
+    for (d = 0; d < den->n_dirs; d++)
+	src[d] = den->wt_mean[d][i][0][0];
+    norm_cb_sum(cb->mean_buf, src, den->n_dirs, den->mean_size);
+    if (den->do_var) {
+	for (d = 0; d < den->n_dirs; d++)
+	    src[d] = den->var_is_full
+		? den->wt_fullvar[d][i][0][0][0] : den->wt_var[d][i][0][0];
+	norm_cb_sum(cb->var_buf, src, den->n_dirs, den->var_size);
+    }
+    ckd_free(src);
+
+    if (den->do_mean)
+	gauden_norm_wt_mean_cb(den->in_mean ? den->in_mean[i] : NULL,
+			       cb->mean, cb->dnom,
+			       i, den->n_stream, den->n_density, den->veclen);
+    if (den->do_var) {
+	/* cb->mean is now just the mean */
+	if (den->var_is_full)
+	    gauden_norm_wt_fullvar_cb(den->in_fullvar ? den->in_fullvar[i] : NULL,
+				      cb->fullvar, den->pass2var,
+				      cb->dnom, cb->mean, i, den->n_stream,
+				      den->n_density, den->veclen);
+	else
+	    gauden_norm_wt_var_cb(den->in_var ? den->in_var[i] : NULL,
+				  cb->var, den->pass2var,
+				  cb->dnom, cb->mean, i, den->n_stream,
+				  den->n_density, den->veclen);
+    }
+}
+
+static int
+norm_worker_main(sbthread_t *th)
+{
+    norm_worker_t *w = sbthread_arg(th);
+    norm_cb_t *cb;
+    uint32 i;
+
+    for (i = w->first; i < w->den->n_mgau; i += w->step) {
+	sbmtx_lock(w->mtx);
+	while (w->count == w->depth) {
+	    sbmtx_unlock(w->mtx);
+	    sbevent_wait(w->drained, -1, -1);
+	    sbmtx_lock(w->mtx);
+	}
+	cb = &w->ring[(w->head + w->count) % w->depth];
+	sbmtx_unlock(w->mtx);
+
+	norm_cb(cb, w->den, i);
+
+	sbmtx_lock(w->mtx);
+	++w->count;
+	sbmtx_unlock(w->mtx);
+	sbevent_signal(w->filled);
+    }
+
+    return 0;
+}
+
+/* Take the next codebook of w, which the caller must hand back with
+ * norm_worker_pop() when done with it. */
+static norm_cb_t *
+norm_worker_peek(norm_worker_t *w)
+{
+    norm_cb_t *cb;
+
+    sbmtx_lock(w->mtx);
+    while (w->count == 0) {
+	sbmtx_unlock(w->mtx);
+	sbevent_wait(w->filled, -1, -1);
+	sbmtx_lock(w->mtx);
+    }
+    cb = &w->ring[w->head];
+    sbmtx_unlock(w->mtx);
+
+    return cb;
+}
+
+static void
+norm_worker_pop(norm_worker_t *w)
+{
+    sbmtx_lock(w->mtx);
+    w->head = (w->head + 1) % w->depth;
+    --w->count;
+    sbmtx_unlock(w->mtx);
+    sbevent_signal(w->drained);
+}
+
+/*
+ * Sum, normalize and write the densities one codebook at a time, so
+ * that only a few codebooks are in memory besides the mapped counts.
+ * With n_thread > 1 each thread normalizes every n_thread-th codebook
+ * while this one writes them in order.
+ */
+static int
+norm_den_write(norm_den_t *den,
+	       const char *out_mean_fn,
+	       const char *out_var_fn,
+	       const char *out_dcount_fn,
+	       uint32 n_thread)
+{
+    s3gau_wr_t *wr_mean = NULL, *wr_var = NULL, *wr_dnom = NULL;
+    norm_worker_t *worker;
+    norm_cb_t *cb;
+    uint32 i, j;
+    int rv = S3_SUCCESS;
+
+    den->do_mean = (out_mean_fn != NULL);
+    den->do_var = (out_var_fn != NULL
+		   && (den->wt_var[0] || den->wt_fullvar[0]));
+    if (out_var_fn && !den->do_var)
+	E_WARN("NO reestimated variances seen, but -varfn specified\n");
+    else if (!out_var_fn && (den->wt_var[0] || den->wt_fullvar[0]))
+	E_INFO("Ignoring variances since -varfn not specified\n");
+
+    if (den->do_mean) {
+	if ((wr_mean = s3gau_write_open(out_mean_fn, den->n_mgau,
+					den->n_stream, den->n_density,
+					den->veclen, FALSE)) == NULL)
+	    return S3_ERROR;
+	if (out_dcount_fn
+	    && (wr_dnom = s3gaudnom_write_open(out_dcount_fn, den->n_mgau,
+					       den->n_stream,
+					       den->n_density)) == NULL)
+	    rv = S3_ERROR;
+    }
+    else if (den->wt_mean[0]) {
+	E_INFO("Ignoring means since -meanfn not specified\n");
+    }
+    if (den->do_var
+	&& (wr_var = s3gau_write_open(out_var_fn, den->n_mgau,
+				      den->n_stream, den->n_density,
+				      den->veclen, den->var_is_full)) == NULL)
+	rv = S3_ERROR;
+    if (rv != S3_SUCCESS)
+	goto done;
+
+    E_INFO("Normalizing %u codebooks (n_stream= %u, n_density= %u)%s\n",
+	   den->n_mgau, den->n_stream, den->n_density,
+	   n_thread > 1 ? " in several threads" : "");
+
+    if (n_thread > den->n_mgau)
+	n_thread = den->n_mgau;
+    if (n_thread < 1)
+	n_thread = 1;
+    worker = ckd_calloc(n_thread, sizeof(*worker));
+    for (i = 0; i < n_thread; i++) {
+	worker[i].den = den;
+	worker[i].first = i;
+	worker[i].step = n_thread;
+	worker[i].depth = (n_thread > 1) ? 2 : 1;
+	worker[i].ring = ckd_calloc(worker[i].depth, sizeof(norm_cb_t));
+	for (j = 0; j < worker[i].depth; j++)
+	    norm_cb_init(&worker[i].ring[j], den);
+	if (n_thread == 1)
+	    break;
+	worker[i].mtx = sbmtx_init();
+	worker[i].filled = sbevent_init();
+	worker[i].drained = sbevent_init();
+	if ((worker[i].thread = sbthread_start(NULL, norm_worker_main,
+					       &worker[i])) == NULL)
+	    E_FATAL("Failed to start thread %u\n", i);
+    }
+
+    for (i = 0; i < den->n_mgau; i++) {
+	if (n_thread == 1) {
+	    cb = &worker[0].ring[0];
+	    norm_cb(cb, den, i);
+	}
+	else {
+	    cb = norm_worker_peek(&worker[i % n_thread]);
+	}
+
+	/* Having failed, go on taking the codebooks so as to let the
+	 * workers finish. */
+	if (rv == S3_SUCCESS) {
+	    if (wr_mean && s3gau_write_cb(wr_mean, cb->mean_buf) != S3_SUCCESS)
+		rv = S3_ERROR;
+	    if (wr_dnom && s3gau_write_cb(wr_dnom, cb->dnom_buf) != S3_SUCCESS)
+		rv = S3_ERROR;
+	    if (wr_var && s3gau_write_cb(wr_var, cb->var_buf) != S3_SUCCESS)
+		rv = S3_ERROR;
+	}
+
+	if (n_thread > 1)
+	    norm_worker_pop(&worker[i % n_thread]);
+    }
+
+    for (i = 0; i < n_thread; i++) {
+	if (worker[i].thread) {
+	    sbthread_wait(worker[i].thread);
+	    sbthread_free(worker[i].thread);
+	    sbevent_free(worker[i].filled);
+	    sbevent_free(worker[i].drained);
+	    sbmtx_free(worker[i].mtx);
+	}
+	if (worker[i].ring) {
+	    for (j = 0; j < worker[i].depth; j++)
+		norm_cb_free(&worker[i].ring[j]);
+	    ckd_free(worker[i].ring);
+	}
+    }
+    ckd_free(worker);
+
+done:
+    /* Each one must be closed, so no short-circuiting here. */
+    if (wr_mean && s3gau_write_close(wr_mean) != S3_SUCCESS)
+	rv = S3_ERROR;
+    if (wr_dnom && s3gau_write_close(wr_dnom) != S3_SUCCESS)
+	rv = S3_ERROR;
+    if (wr_var && s3gau_write_close(wr_var) != S3_SUCCESS)
+	rv = S3_ERROR;
+
+    return rv;
+}
+
 static int
 normalize()
 {
@@ -125,6 +926,9 @@ normalize()
     
     int err;
     uint32 no_retries=0;
+    norm_acc_t acc;
+    norm_den_t den;
+    int32 stream_den;
 
     
     accum_dir = cmd_ln_str_list("-accumdir");
@@ -160,10 +964,29 @@ normalize()
 	       in_mixw_fn);
     }
 
+    /* Unless their sums are needed as a whole, the densities are
+     * normalized and written one codebook at a time. */
+    stream_den = ((out_mean_fn || out_var_fn)
+		  && oaccum_dir == NULL
+		  && !cmd_ln_boolean("-tiedvar")
+		  && norm_den_map(&den, accum_dir, var_is_full));
+    if (!stream_den && (out_mean_fn || out_var_fn))
+	E_INFO("Reading all density counts into memory\n");
+
     if (in_mean_fn != NULL) {
 	E_INFO("Selecting unseen density mean parameters from %s\n",
 	       in_mean_fn);
+    }
+    if (in_var_fn != NULL) {
+	E_INFO("Selecting unseen density variance parameters from %s\n",
+	       in_var_fn);
+    }
+    if (stream_den) {
+	norm_den_map_in(&den, in_mean_fn, in_var_fn);
+	in_mean_fn = in_var_fn = NULL;
+    }
 
+    if (in_mean_fn != NULL) {
 	if (s3gau_read(in_mean_fn,
 		       &in_mean,
 		       &n_mgau,
@@ -176,9 +999,6 @@ normalize()
     }
 
     if (in_var_fn != NULL) {
-	E_INFO("Selecting unseen density variance parameters from %s\n",
-	       in_var_fn);
-
 	if (var_is_full) {
 	    if (s3gau_read_full(in_var_fn,
 			   &in_fullvar,
@@ -202,60 +1022,59 @@ normalize()
 	ckd_free(veclen);
     }
 
-    n_stream = 0;
-    for (i = 0; accum_dir[i]; i++) {
-	E_INFO("Reading and accumulating counts from %s\n", accum_dir[i]);
-
-	if (out_mixw_fn) {
-	    rdacc_mixw(accum_dir[i],
-		       &mixw_acc, &n_mixw, &n_stream, &n_density);
-	}
-
-	if (out_tmat_fn) {
-	    rdacc_tmat(accum_dir[i],
-		       &tmat_acc, &n_tmat, &n_state_pm);
-	}
+    memset(&acc, 0, sizeof(acc));
+    acc.read_mixw = (out_mixw_fn != NULL);
+    acc.read_tmat = (out_tmat_fn != NULL);
+    acc.read_den = (out_mean_fn || out_var_fn) && !stream_den;
+    acc.var_is_full = var_is_full;
+    read_accum(&acc, accum_dir, cmd_ln_int32("-nthreads"));
 
-	if (out_mean_fn || out_var_fn) {
-	    if (var_is_full)
-		rdacc_den_full(accum_dir[i],
-			       &wt_mean,
-			       &wt_fullvar,
-			       &pass2var,
-			       &dnom,
-			       &n_mgau,
-			       &n_gau_stream,
-			       &n_gau_density,
-			       &veclen);
-	    else
-		rdacc_den(accum_dir[i],
-			  &wt_mean,
-			  &wt_var,
-			  &pass2var,
-			  &dnom,
-			  &n_mgau,
-			  &n_gau_stream,
-			  &n_gau_density,
-			  &veclen);
-
-	    if (out_mixw_fn) {
-		if (n_stream != n_gau_stream) {
-		    E_ERROR("mixw inconsistent w/ densities WRT # "
-			    "streams (%u != %u)\n",
-			    n_stream, n_gau_stream);
-		}
+    n_stream = acc.n_stream;
+    if (acc.mixw_acc) {
+	mixw_acc = acc.mixw_acc;
+	n_mixw = acc.n_mixw;
+	n_density = acc.n_density;
+    }
+    if (acc.tmat_acc) {
+	tmat_acc = acc.tmat_acc;
+	n_tmat = acc.n_tmat;
+	n_state_pm = acc.n_state_pm;
+    }
+    if (acc.wt_mean) {
+	wt_mean = acc.wt_mean;
+	wt_var = acc.wt_var;
+	wt_fullvar = acc.wt_fullvar;
+	pass2var = acc.pass2var;
+	dnom = acc.dnom;
+	n_mgau = acc.n_mgau;
+	n_gau_stream = acc.n_gau_stream;
+	n_gau_density = acc.n_gau_density;
+	veclen = acc.veclen;
+    }
+    if (stream_den) {
+	pass2var = den.pass2var;
+	n_gau_stream = den.n_stream;
+	n_gau_density = den.n_density;
+    }
 
-		if (n_density != n_gau_density) {
-		    E_ERROR("mixw inconsistent w/ densities WRT # "
-			    "den/mix (%u != %u)\n",
-			    n_density, n_gau_density);
-		}
+    if (out_mean_fn || out_var_fn) {
+	if (out_mixw_fn) {
+	    if (n_stream != n_gau_stream) {
+		E_ERROR("mixw inconsistent w/ densities WRT # "
+			"streams (%u != %u)\n",
+			n_stream, n_gau_stream);
 	    }
-	    else {
-		n_stream = n_gau_stream;
-		n_density = n_gau_density;
+
+	    if (n_density != n_gau_density) {
+		E_ERROR("mixw inconsistent w/ densities WRT # "
+			"den/mix (%u != %u)\n",
+			n_density, n_gau_density);
 	    }
 	}
+	else {
+	    n_stream = n_gau_stream;
+	    n_density = n_gau_density;
+	}
     }
 
     if (oaccum_dir && mixw_acc) {
@@ -385,7 +1204,16 @@ normalize()
 	} while (err > 1);
     }
 
-    if (wt_mean || wt_var || wt_fullvar) {
+    if (stream_den) {
+	err = norm_den_write(&den, out_mean_fn, out_var_fn, out_dcount_fn,
+			     cmd_ln_int32("-nthreads"));
+	norm_den_free(&den);
+	if (err != S3_SUCCESS)
+	    return S3_ERROR;
+	/* They are written already. */
+	out_mean_fn = out_var_fn = NULL;
+    }
+    else if (wt_mean || wt_var || wt_fullvar) {
 	if (out_mean_fn) {
 	    E_INFO("Normalizing mean for n_mgau= %u, n_stream= %u, n_density= %u\n",
 		   n_mgau, n_stream, n_density);
@@ -98,6 +98,10 @@ norm \n\
 	  ARG_STRING,
 	  NULL,
 	  "Path to contain the overall reestimation sums" },
+	{ "-nthreads",
+	  ARG_INT32,
+	  "1",
+	  "Number of threads reading and summing the -accumdir directories, and normalizing the densities" },
 	{ "-tmatfn",
 	  ARG_STRING,
 	  NULL,
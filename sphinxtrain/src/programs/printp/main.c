@@ -165,15 +165,23 @@ print_gau(const char *fn)
     uint32 *veclen;
     uint32 n_density;
     uint32 i, j, k, l;
+    s3mmap_t *m = NULL;
 
     E_INFO("Reading %s\n",  fn);
     
-    if (s3gau_read(fn,
-		   &mean,
-		   &n_mgau,
-		   &n_feat,
-		   &n_density,
-		   &veclen) != S3_SUCCESS)
+    if (s3gau_map(fn,
+		  &m,
+		  &mean,
+		  &n_mgau,
+		  &n_feat,
+		  &n_density,
+		  &veclen) != S3_SUCCESS
+	&& s3gau_read(fn,
+		      &mean,
+		      &n_mgau,
+		      &n_feat,
+		      &n_density,
+		      &veclen) != S3_SUCCESS)
 	return S3_ERROR;
 
     printf("param %u %u %u\n", n_mgau, n_feat, n_density);
@@ -191,7 +199,10 @@ print_gau(const char *fn)
 	    }
 	}
     }
-    ckd_free(veclen);
+    if (m)
+	s3mmap_close(m);
+    else
+	ckd_free(veclen);
     return S3_SUCCESS;
 }
 
@@ -358,15 +369,21 @@ print_tmat(const char *fn)
     uint32 i, j, k;
     int32 normalize = cmd_ln_int32("-norm");
     float32 sum;
+    s3mmap_t *m = NULL;
     
     E_INFO("Reading %s%s\n",
 	   (normalize ? " and normalizing." : "."),
 	   fn);
     
-    if (s3tmat_read(fn,
-		    &tmat,
-		    &n_tmat,
-		    &n_state_pm) != S3_SUCCESS) {
+    if (s3tmat_map(fn,
+		   &m,
+		   &tmat,
+		   &n_tmat,
+		   &n_state_pm) != S3_SUCCESS
+	&& s3tmat_read(fn,
+		       &tmat,
+		       &n_tmat,
+		       &n_state_pm) != S3_SUCCESS) {
 	return S3_ERROR;
     }
 
@@ -402,6 +419,7 @@ print_tmat(const char *fn)
 	    printf("\n");
 	}
     }
+    s3mmap_close(m);
     return S3_SUCCESS;
 }
 int
@@ -416,6 +434,7 @@ print_mixw(const char *fn)
     uint32 i, p_i, j, k;
     int32 normalize = cmd_ln_int32("-norm");
     float64 sum;
+    s3mmap_t *m = NULL;
 
     E_INFO("Reading %s%s\n",
 	   fn, (normalize ? "and normalizing." : "."));
@@ -427,11 +446,17 @@ print_mixw(const char *fn)
 	mixw_e = cmd_ln_int32("-mixwe");
     }
     if (mixw_s == NO_ID && mixw_e == NO_ID) {
-	if (s3mixw_read(fn,
-			&mixw,
-			&n_mixw,
-			&n_feat,
-			&n_density) != S3_SUCCESS) {
+	if (s3mixw_map(fn,
+		       &m,
+		       &mixw,
+		       &n_mixw,
+		       &n_feat,
+		       &n_density) != S3_SUCCESS
+	    && s3mixw_read(fn,
+			   &mixw,
+			   &n_mixw,
+			   &n_feat,
+			   &n_density) != S3_SUCCESS) {
 	    return S3_ERROR;
 	}
 	printf("mixw %u %u %u\n", n_mixw, n_feat, n_density);
@@ -481,6 +506,7 @@ print_mixw(const char *fn)
 	    printf("\n");
 	}
     }
+    s3mmap_close(m);
     return S3_SUCCESS;
 }
 
@@ -0,0 +1,78 @@
+/* ====================================================================
+ * Copyright (c) 2026 Carnegie Mellon University.  All rights 
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/*********************************************************************
+ *
+ * File: cmd_ln_defn.h
+ * 
+ * Description: 
+ * 	Command line argument definition
+ *
+ *********************************************************************/
+
+#ifndef ARG_DEFN_H
+#define ARG_DEFN_H
+  const char helpstr[] =
+"Description: \n\
+Convert SPHINX-III binary parameter files (means, variances, mixing \n\
+weights, transition matrices) to the byte order of this machine, in \n\
+place.  Files in native byte order can be memory-mapped by tools such \n\
+as printp instead of being read and copied. Files which are already in \n\
+native byte order are left alone.";
+  const char examplestr[] =
+"Example: \n\
+swap_parm -parmfn means variances mixture_weights transition_matrices";
+
+    static arg_t defn[] = {
+	{ "-help",
+	  ARG_BOOLEAN,
+	  "no",
+	  "Shows the usage of the tool"},
+
+	{ "-example",
+	  ARG_BOOLEAN,
+	  "no",
+	  "Shows example of how to use the tool"},
+
+	{ "-parmfn",
+	  ARG_STRING_LIST,
+	  NULL,
+	  "Parameter files to convert" },
+
+	{NULL, 0, NULL, NULL},
+    };
+#define ARG_DEFN_H
+
+#endif /* ARG_DEFN_H */ 
@@ -0,0 +1,76 @@
+/* ====================================================================
+ * Copyright (c) 2026 Carnegie Mellon University.  All rights 
+ * reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer. 
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * This work was supported in part by funding from the Defense Advanced 
+ * Research Projects Agency and the National Science Foundation of the 
+ * United States of America, and the CMU Sphinx Speech Consortium.
+ *
+ * THIS SOFTWARE IS PROVIDED BY CARNEGIE MELLON UNIVERSITY ``AS IS'' AND 
+ * ANY EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL CARNEGIE MELLON UNIVERSITY
+ * NOR ITS EMPLOYEES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT 
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, 
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY 
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ====================================================================
+ *
+ */
+/*********************************************************************
+ *
+ * File: main.c
+ * 
+ * Description: 
+ * 	Converts parameter files to native byte order in place
+ *
+ *********************************************************************/
+
+#include "parse_cmd_ln.h"
+
+#include <s3/s3io.h>
+#include <s3/s3.h>
+
+#include <sphinxbase/cmd_ln.h>
+#include <sphinxbase/err.h>
+
+#include <stdio.h>
+
+int
+main(int argc, char *argv[])
+{
+    const char **fn;
+    int n_err = 0;
+
+    parse_cmd_ln(argc, argv);
+
+    fn = cmd_ln_str_list("-parmfn");
+    if (fn == NULL) {
+	E_FATAL("No files given; specify -parmfn\n");
+    }
+
+    for (; *fn; fn++) {
+	if (s3swap_file(*fn) != S3_SUCCESS) {
+	    E_ERROR("Failed to convert %s\n", *fn);
+	    ++n_err;
+	}
+    }
+
+    return n_err ? 1 : 0;
+}
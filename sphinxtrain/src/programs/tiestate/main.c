@@ -49,6 +49,7 @@
 #include <sphinxbase/ckd_alloc.h>
 #include <sphinxbase/cmd_ln.h>
 #include <sphinxbase/err.h>
+#include <sphinxbase/sbthread.h>
 
 #include <s3/model_def_io.h>
 #include <s3/dtree.h>
@@ -64,7 +65,7 @@ int
 init(model_def_t **out_imdef,
      pset_t **out_pset,
      uint32 *out_n_pset,
-     dtree_t ****out_tree,
+     dtree_flat_t ****out_tree,
      uint32 *out_n_seno)
 {
     model_def_t *imdef;
@@ -73,7 +74,8 @@ init(model_def_t **out_imdef,
     char fn[MAXPATHLEN+1];
     const char *a_fn;
     FILE *fp;
-    dtree_t ***tree, *tr;
+    dtree_flat_t ***tree;
+    dtree_t *tr;
     pset_t *pset;
     uint32 n_pset;
     uint32 n_seno;
@@ -101,7 +103,7 @@ init(model_def_t **out_imdef,
       n_ci = acmod_set_n_ci(imdef->acmod_set);
 
     treedir = cmd_ln_str("-treedir");
-    tree = (dtree_t ***)ckd_calloc(n_ci, sizeof(dtree_t **));
+    tree = (dtree_flat_t ***)ckd_calloc(n_ci, sizeof(dtree_flat_t **));
     *out_tree = tree;
 
     ts_id = imdef->n_tied_ci_state;
@@ -117,7 +119,7 @@ init(model_def_t **out_imdef,
 		n_state = imdef->defn[p].n_state;
 		pname = acmod_set_id2name(imdef->acmod_set, p);
 	    }
-	    tree[p] = (dtree_t **)ckd_calloc(n_state, sizeof(dtree_t *));
+	    tree[p] = (dtree_flat_t **)ckd_calloc(n_state, sizeof(dtree_flat_t *));
 
 	    for (s = 0; s < n_state-1; s++) {
 		E_INFO("%s-%u: offset %u\n",
@@ -129,13 +131,20 @@ init(model_def_t **out_imdef,
 		if (fp == NULL) {
 		    E_FATAL_SYSTEM("Unable to open %s for reading", fn);
 		}
-		tree[p][s] = tr = read_final_tree(fp, pset, n_pset);
+		tr = read_final_tree(fp, pset, n_pset);
+		if (tr == NULL) {
+		    E_FATAL("Error(s) while reading %s\n", fn);
+		}
 
 		label_leaves(&tr->node[0], &ts_id);
 
 		fclose(fp);
 
 		n_seno += cnt_leaf(&tr->node[0]);
+
+		tree[p][s] = flatten_tree(&tr->node[0],
+					  acmod_set_n_ci(imdef->acmod_set));
+		free_tree(tr);
 	    }
 	}
     }
@@ -149,6 +158,108 @@ init(model_def_t **out_imdef,
     return S3_SUCCESS;
 }
 
+/*
+ * The triphones [beg, end) whose states are to be tied by one thread.
+ */
+typedef struct tie_job_s {
+    model_def_t *imdef;
+    model_def_t *omdef;
+    dtree_flat_t ***tree;
+    int allphones;
+    uint32 beg;
+    uint32 end;
+} tie_job_t;
+
+static int
+tie_range(tie_job_t *job)
+{
+    model_def_entry_t *idefn, *odefn;
+    acmod_id_t b, l, r;
+    word_posn_t wp;
+    uint32 p, s, bb;
+
+    for (p = job->beg; p < job->end; p++) {
+	idefn = &job->imdef->defn[p];
+	odefn = &job->omdef->defn[p];
+
+	odefn->p    = idefn->p;
+	odefn->tmat = idefn->tmat;
+
+	odefn->state = ckd_calloc(idefn->n_state, sizeof(uint32));
+	odefn->n_state = idefn->n_state;
+
+	acmod_set_id2tri(job->omdef->acmod_set,
+			 &b, &l, &r, &wp,
+			 p);
+	assert(p != b);
+	bb = job->allphones ? 0 : b;
+
+	for (s = 0; s < idefn->n_state; s++) {
+	    if (idefn->state[s] == NO_ID)
+		/* Non-emitting state */
+		odefn->state[s] = NO_ID;
+	    else
+		/* emitting state: find the tied state */
+		odefn->state[s] = flat_tied_state(job->tree[bb][s],
+						  b, l, r, wp);
+	}
+    }
+
+    return 0;
+}
+
+static int
+tie_thread(sbthread_t *th)
+{
+    return tie_range((tie_job_t *)sbthread_arg(th));
+}
+
+static void
+tie_states(model_def_t *imdef,
+	   model_def_t *omdef,
+	   dtree_flat_t ***tree,
+	   uint32 beg,
+	   uint32 end,
+	   uint32 n_thread)
+{
+    tie_job_t *job;
+    sbthread_t **th;
+    uint32 t;
+
+    if (n_thread < 1)
+	n_thread = 1;
+    if (n_thread > end - beg)
+	n_thread = (end > beg ? end - beg : 1);
+
+    job = (tie_job_t *)ckd_calloc(n_thread, sizeof(tie_job_t));
+    th = (sbthread_t **)ckd_calloc(n_thread, sizeof(sbthread_t *));
+    for (t = 0; t < n_thread; t++) {
+	job[t].imdef = imdef;
+	job[t].omdef = omdef;
+	job[t].tree = tree;
+	job[t].allphones = cmd_ln_int32("-allphones");
+	job[t].beg = beg + (end - beg) * t / n_thread;
+	job[t].end = beg + (end - beg) * (t + 1) / n_thread;
+    }
+    for (t = 1; t < n_thread; t++) {
+	th[t] = sbthread_start(NULL, tie_thread, &job[t]);
+	if (th[t] == NULL) {
+	    E_WARN("Failed to start state tying thread; running it here\n");
+	    tie_range(&job[t]);
+	}
+    }
+    tie_range(&job[0]);
+
+    for (t = 1; t < n_thread; t++) {
+	if (th[t]) {
+	    sbthread_wait(th[t]);
+	    sbthread_free(th[t]);
+	}
+    }
+    ckd_free(th);
+    ckd_free(job);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -156,16 +267,12 @@ main(int argc, char *argv[])
     model_def_t *omdef;
     pset_t *pset;
     uint32 n_pset;
-    dtree_t ***tree;
+    dtree_flat_t ***tree;
     uint32 n_seno;
     uint32 n_ci;
-    uint32 n_acmod;
     uint32 p;
     uint32 s;
     model_def_entry_t *idefn, *odefn;
-    acmod_id_t b, l, r;
-    word_posn_t wp;
-    int allphones;
 
     parse_cmd_ln(argc, argv);
 
@@ -212,50 +319,9 @@ main(int argc, char *argv[])
     /*
      * Define the rest of the models
      */
-    allphones = cmd_ln_int32("-allphones");
-    n_acmod = acmod_set_n_acmod(omdef->acmod_set);
-    for (; p < n_acmod; p++) {
-	b = acmod_set_base_phone(omdef->acmod_set, p);
-
-	assert(p != b);
-
-	idefn = &imdef->defn[p];
-	odefn = &omdef->defn[p];
-
-	odefn->p    = idefn->p;
-	odefn->tmat = idefn->tmat;
-
-	odefn->state = ckd_calloc(idefn->n_state, sizeof(uint32));
-	odefn->n_state = idefn->n_state;
-	for (s = 0; s < idefn->n_state; s++) {
-	    if (idefn->state[s] == NO_ID)
-		/* Non-emitting state */
-		odefn->state[s] = NO_ID;
-	    else {
-		uint32 bb;
-
-		/* emitting state: find the tied state */
-		acmod_set_id2tri(omdef->acmod_set,
-				 &b, &l, &r, &wp,
-				 p);
-#ifdef HORRIBLY_VERBOSE
-		fprintf(stderr, "%s %u ",
-			acmod_set_id2name(omdef->acmod_set, p), s);
-#endif
-
-		bb = allphones ? 0 : b;
-		odefn->state[s] = tied_state(&tree[bb][s]->node[0],
-					     b, l, r, wp,
-					     pset);
-
-#ifdef HORRIBLY_VERBOSE
-		fprintf(stderr, "\t-> %u\n", odefn->state[s]);
-
-		fprintf(stderr, "\n");
-#endif
-	    }
-	}
-    }
+    tie_states(imdef, omdef, tree,
+	       n_ci, acmod_set_n_acmod(omdef->acmod_set),
+	       cmd_ln_int32("-nthreads"));
 
     if (model_def_write(omdef, cmd_ln_str("-omoddeffn")) != S3_SUCCESS) {
 	return 1;
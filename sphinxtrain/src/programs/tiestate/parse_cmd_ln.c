@@ -104,6 +104,11 @@ parse_cmd_ln(int argc, char *argv[])
 	  "no",
 	  "Use a single tree for each state of all phones"},
 
+	{ "-nthreads",
+	  ARG_INT32,
+	  "1",
+	  "# of threads to look up tied states in" },
+
 	{NULL, 0, NULL, NULL}
 	  
     };